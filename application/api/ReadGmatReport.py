@@ -0,0 +1,97 @@
+#-------------------------------------------------------------------------------
+# GMAT Binary Report File Reader
+#-------------------------------------------------------------------------------
+# Reads the report files GMAT writes with ReportFile.OutputFormat = Binary.
+#
+# The file starts with a header naming its columns, followed by rows of 8 byte
+# reals.  Each column holds a real number or a matrix; vectors are stored as
+# 1 x n matrices.  The columns are returned in a dictionary keyed by column
+# name.  Scalar columns are lists (or numpy arrays) of values, and matrix
+# columns are lists (or numpy arrays of shape (rows, r, c)) of matrices.
+#
+# To use:
+#    from ReadGmatReport import ReadGmatReport
+#    data = ReadGmatReport("ReportFile1.bin")
+#    print(data["Sat.A1ModJulian"])
+#
+# or, from the command line, to print the columns of a file:
+#    python3 ReadGmatReport.py ReportFile1.bin
+#===============================================================================
+import struct
+import sys
+
+try:
+   import numpy
+except ImportError:
+   numpy = None
+
+MAGIC = b"GMATReportFile"
+BYTE_ORDER_MARK = 0x01020304
+
+
+def ReadGmatReport(fileName):
+   """Returns the columns of a binary GMAT report file, keyed by name."""
+   with open(fileName, "rb") as f:
+      data = f.read()
+
+   if data[:16].rstrip(b"\0") != MAGIC:
+      raise ValueError(fileName + " is not a binary GMAT report file")
+
+   # The byte order mark tells the byte order of the file
+   order = "<"
+   if struct.unpack_from("<i", data, 20)[0] != BYTE_ORDER_MARK:
+      order = ">"
+   version, bom, columnCount, rowSize = struct.unpack_from(order + "4i",
+                                                           data, 16)
+   if bom != BYTE_ORDER_MARK:
+      raise ValueError(fileName + " has an invalid byte order mark")
+
+   offset = 32
+   columns = []
+   for i in range(columnCount):
+      rows, cols, nameLength = struct.unpack_from(order + "3i", data, offset)
+      offset += 12
+      name = data[offset:offset + nameLength].decode("utf-8")
+      offset += nameLength
+      columns.append((name, rows, cols))
+
+   # Rows start on an 8 byte boundary
+   offset += (8 - offset % 8) % 8
+   rowCount = (len(data) - offset) // (8 * rowSize) if rowSize > 0 else 0
+
+   if numpy is not None:
+      values = numpy.frombuffer(data, dtype=numpy.dtype(order + "f8"),
+                                count=rowCount * rowSize, offset=offset)
+      values = values.reshape(rowCount, rowSize)
+   else:
+      values = [struct.unpack_from(order + "%dd" % rowSize, data,
+                                   offset + 8 * rowSize * r)
+                for r in range(rowCount)]
+
+   report = {}
+   start = 0
+   for name, rows, cols in columns:
+      size = rows * cols
+      if numpy is not None:
+         column = values[:, start:start + size]
+         if size == 1:
+            column = column[:, 0]
+         else:
+            column = column.reshape(rowCount, rows, cols)
+      elif size == 1:
+         column = [row[start] for row in values]
+      else:
+         column = [[list(row[start + r * cols:start + (r + 1) * cols])
+                    for r in range(rows)] for row in values]
+      report[name] = column
+      start += size
+
+   return report
+
+
+if __name__ == "__main__":
+   for fileName in sys.argv[1:]:
+      report = ReadGmatReport(fileName)
+      print(fileName)
+      for name in report:
+         print("   " + name + ": %d rows" % len(report[name]))
@@ -54,6 +54,16 @@ double CINTERFACE_API *GetDerivativesForState(double epoch, double state[],
 double CINTERFACE_API *GetDerivatives(double dt, int order, int *pdim);
 //double CINTERFACE_API *GetDerivatives(double dt, int order);
 
+// Batch interfaces: models are addressed by the ID from FindOdeModel, and
+// results are written to caller supplied buffers
+int CINTERFACE_API GetModelStateSize(int modelID);
+int CINTERFACE_API GetDerivativesBatch(int modelID, int count,
+      const double epochs[], const double states[], int stateDim, double dt,
+      int order, double derivs[], int derivDim);
+int CINTERFACE_API PropagateToEpochs(int modelID, double epoch,
+      const double state[], int stateDim, int count, const double epochs[],
+      double states[], int outDim);
+
 int CINTERFACE_API CountObjects();
 const char CINTERFACE_API *GetObjectName(int which);
 const char CINTERFACE_API *GetRunSummary();
@@ -27,9 +27,13 @@
 #include "ODEModel.hpp"
 #include "Propagate.hpp"
 #include "Factory.hpp"
+#include "Propagator.hpp"
+#include "BaseException.hpp"
 
 #include "CCommandFactory.hpp"
 
+#include <mutex>
+
 //#define DEBUG_INTERFACE_FROM_MATLAB
 
 
@@ -45,6 +49,11 @@ std::map<Integer,ODEModel*> odeTable;
 std::map<Integer,PropSetup*> setupTable;
 std::map<std::string,Integer> odeNameTable;
 
+// The batch interfaces may be called from several client threads.  GMAT's
+// models share the solar system and other engine objects, so the calls are
+// run one at a time.
+std::mutex  batchMutex;
+
 #ifdef DEBUG_INTERFACE_FROM_MATLAB
    FILE *fp;
 #endif
@@ -722,6 +731,221 @@ extern "C"
       return retval;
    }
 
+   //---------------------------------------------------------------------------
+   // int GetModelStateSize(int modelID)
+   //---------------------------------------------------------------------------
+   /**
+    * Gets the size of the propagation state vector for an ODEModel
+    *
+    * Unlike GetStateSize(), this call does not change the current model.
+    *
+    * @param modelID The ID of the model, as returned from FindOdeModel()
+    *
+    * @return The state vector size, or a negative number if the model is not
+    *         known
+    */
+   //---------------------------------------------------------------------------
+   int GetModelStateSize(int modelID)
+   {
+      std::lock_guard<std::mutex> lock(batchMutex);
+
+      if (odeTable.find(modelID) == odeTable.end())
+         return -1;
+      return odeTable[modelID]->GetDimension();
+   }
+
+   //---------------------------------------------------------------------------
+   // int GetDerivativesBatch(int modelID, int count, const double epochs[],
+   //       const double states[], int stateDim, double dt, int order,
+   //       double derivs[], int derivDim)
+   //---------------------------------------------------------------------------
+   /**
+    * Calculates the derivatives of a set of states in one call
+    *
+    * Each state is handled as in GetDerivativesForState(), so the model's
+    * internal state vector is left set to the last input state.  The current
+    * model used by the single state calls is not changed.  The call is safe to
+    * make from several threads; the calls are serialized.
+    *
+    * @param modelID  The ID of the model, as returned from FindOdeModel()
+    * @param count    The number of states
+    * @param epochs   The A.1 modified Julian epochs of the states, count values
+    * @param states   The input states, stateDim values per state, stored one
+    *                 state after another
+    * @param stateDim The size of each input state
+    * @param dt       Time offset (in sec) off of the input epochs
+    * @param order    Order of the derivative data returned -- 1 or 2 for first
+    *                 or second derivative data
+    * @param derivs   Output buffer for the derivatives, derivDim values per
+    *                 state
+    * @param derivDim The row size of derivs; at least GetModelStateSize()
+    *
+    * @return 0 on success, or a negative number on error, with the error
+    *         described by getLastMessage()
+    */
+   //---------------------------------------------------------------------------
+   int GetDerivativesBatch(int modelID, int count, const double epochs[],
+         const double states[], int stateDim, double dt, int order,
+         double derivs[], int derivDim)
+   {
+      std::lock_guard<std::mutex> lock(batchMutex);
+
+      if (odeTable.find(modelID) == odeTable.end())
+      {
+         lastMsg = "ERROR in GetDerivativesBatch: Unknown ODE model ID";
+         return -1;
+      }
+
+      ODEModel *model = odeTable[modelID];
+      PropSetup *setup = setupTable[modelID];
+      int dim = model->GetDimension();
+      if (derivDim < dim)
+      {
+         lastMsg = "ERROR in GetDerivativesBatch: The derivative buffer rows "
+                   "are smaller than the propagation state vector";
+         return -3;
+      }
+
+      try
+      {
+         GmatState *theState = setup->GetPropStateManager()->GetState();
+         for (int i = 0; i < count; ++i)
+         {
+            int retval = SetModelState(modelID, model, setup, epochs[i],
+                  states + i * stateDim, stateDim);
+            if (retval != 0)
+               return retval;
+
+            model->GetDerivatives(theState->GetState(), dt, order);
+            memcpy(derivs + i * derivDim, model->GetDerivativeArray(),
+                  dim * sizeof(double));
+         }
+      }
+      catch (BaseException &ex)
+      {
+         lastMsg = "ERROR in GetDerivativesBatch: " + ex.GetFullMessage();
+         return -4;
+      }
+
+      lastMsg = "Derivatives calculated";
+      return 0;
+   }
+
+   //---------------------------------------------------------------------------
+   // int PropagateToEpochs(int modelID, double epoch, const double state[],
+   //       int stateDim, int count, const double epochs[], double states[],
+   //       int outDim)
+   //---------------------------------------------------------------------------
+   /**
+    * Propagates a state through a list of epochs
+    *
+    * The state is integrated with the propagator that owns the model, taking
+    * steps that end on each requested epoch, and the propagation state vector
+    * at each epoch is written to the output buffer.  The epochs must all lie
+    * on the same side of the input epoch, ordered in the direction of
+    * propagation.  The call is safe to make from several threads; the calls
+    * are serialized.
+    *
+    * @param modelID  The ID of the model, as returned from FindOdeModel()
+    * @param epoch    The A.1 modified Julian epoch of the input state
+    * @param state    The MJ2000 Earth equatorial input state vector
+    * @param stateDim The size of the input state vector
+    * @param count    The number of output epochs
+    * @param epochs   The A.1 modified Julian output epochs
+    * @param states   Output buffer for the propagated states, outDim values
+    *                 per epoch
+    * @param outDim   The row size of states; at least GetModelStateSize()
+    *
+    * @return 0 on success, or a negative number on error, with the error
+    *         described by getLastMessage()
+    */
+   //---------------------------------------------------------------------------
+   int PropagateToEpochs(int modelID, double epoch, const double state[],
+         int stateDim, int count, const double epochs[], double states[],
+         int outDim)
+   {
+      std::lock_guard<std::mutex> lock(batchMutex);
+
+      if (odeTable.find(modelID) == odeTable.end())
+      {
+         lastMsg = "ERROR in PropagateToEpochs: Unknown ODE model ID";
+         return -1;
+      }
+
+      ODEModel *model = odeTable[modelID];
+      PropSetup *setup = setupTable[modelID];
+      Propagator *prop = setup->GetPropagator();
+      PropagationStateManager *psm = setup->GetPropStateManager();
+      int dim = model->GetDimension();
+      if (outDim < dim)
+      {
+         lastMsg = "ERROR in PropagateToEpochs: The output buffer rows are "
+                   "smaller than the propagation state vector";
+         return -3;
+      }
+
+      bool forwards = ((count == 0) || (epochs[count-1] >= epoch));
+      for (int i = 0; i < count; ++i)
+      {
+         Real previous = (i == 0 ? epoch : epochs[i-1]);
+         if ((forwards && (epochs[i] < previous)) ||
+             (!forwards && (epochs[i] > previous)))
+         {
+            lastMsg = "ERROR in PropagateToEpochs: The epochs are not ordered "
+                      "in the direction of propagation";
+            return -5;
+         }
+      }
+
+      try
+      {
+         int retval = SetModelState(modelID, model, setup, epoch, state,
+               stateDim);
+         if (retval != 0)
+            return retval;
+
+         // Start the propagator from the input state, as the Propagate
+         // command does when it starts a propagation
+         psm->MapVectorToObjects();
+         model->SetTime(0.0);
+         model->UpdateInitialData();
+         prop->ResetInitialData();
+         prop->Initialize();
+         prop->Update(forwards);
+         prop->UpdateFromSpaceObject();
+
+         GmatState *theState = psm->GetState();
+         Real current = epoch;
+         for (int i = 0; i < count; ++i)
+         {
+            Real step = (epochs[i] - current) * GmatTimeConstants::SECS_PER_DAY;
+            if (step != 0.0)
+            {
+               if (!prop->Step(step))
+               {
+                  char msg[256];
+                  sprintf(msg, "ERROR in PropagateToEpochs: The propagator "
+                        "failed to step to epoch %.12lf", epochs[i]);
+                  lastMsg = msg;
+                  return -6;
+               }
+               prop->UpdateSpaceObject(epochs[i]);
+               current = epochs[i];
+            }
+            memcpy(states + i * outDim, theState->GetState(),
+                  dim * sizeof(double));
+         }
+      }
+      catch (BaseException &ex)
+      {
+         lastMsg = "ERROR in PropagateToEpochs: " + ex.GetFullMessage();
+         return -4;
+      }
+
+      lastMsg = "State propagated";
+      return 0;
+   }
+
    //---------------------------------------------------------------------------
    // int CountObjects()
    //---------------------------------------------------------------------------
@@ -834,6 +1058,49 @@ extern "C"
 // Internal functions
 //------------------------------------------------------------------------------
    
+//------------------------------------------------------------------------------
+// int SetModelState(int modelID, ODEModel *model, PropSetup *setup,
+//       double epoch, const double state[], int stateDim)
+//------------------------------------------------------------------------------
+/**
+ * Sets the propagation state vector and epoch of a model
+ *
+ * This is the part of SetState() used by the batch interfaces; it works on
+ * the model passed in rather than the current model.
+ *
+ * @param modelID  The ID of the model, used in error messages
+ * @param model    The ODE model
+ * @param setup    The PropSetup that owns the model
+ * @param epoch    The A.1 modified Julian epoch of the state
+ * @param state    The MJ2000 Earth equatorial input state vector
+ * @param stateDim The size of the input state vector
+ *
+ * @return 0 on success, or -2 if the state does not fit the state vector
+ */
+//------------------------------------------------------------------------------
+int SetModelState(int modelID, ODEModel *model, PropSetup *setup,
+      double epoch, const double state[], int stateDim)
+{
+   GmatState *theState = setup->GetPropStateManager()->GetState();
+
+   if (stateDim > theState->GetSize())
+   {
+      char msg[256];
+      sprintf(msg, "ERROR: Incoming state size (%d) is larger than the "
+            "propagation state vector size (%d) for model %d", stateDim,
+            theState->GetSize(), modelID);
+      lastMsg = msg;
+      return -2;
+   }
+
+   theState->SetEpoch(epoch);
+   theState->SetState(state, stateDim);
+   model->SetEpoch(epoch);
+
+   return 0;
+}
+
+
 //------------------------------------------------------------------------------
 // int GetODEModel(GmatCommand *cmd, std::string modelName)
 //------------------------------------------------------------------------------
@@ -52,6 +52,8 @@ extern "C"
    int GetODEModel(GmatCommand **cmd, const char *modelName = "");
    PropSetup *GetFirstPropagator(GmatCommand *cmd);
    PropSetup *GetPropagator(GmatCommand **current);
+   int SetModelState(int modelID, ODEModel *model, PropSetup *setup,
+         double epoch, const double state[], int stateDim);
 };
 
 #endif /*CInterfacePluginFunctions_hpp*/
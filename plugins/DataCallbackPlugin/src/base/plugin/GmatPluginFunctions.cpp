@@ -144,6 +144,53 @@ extern "C"
      return 0;
    }
 
+   //------------------------------------------------------------------------------
+   // int SetBatchCallback(const char* subscriberName,
+   //       void (*CBFcn)(const double*, int, int, void*), void* userData)
+   //------------------------------------------------------------------------------
+   /**
+    * Sets the batch callback function for a given DataCallback subscriber
+    *
+    * @param subscriberName Given name of the DataCallback subscriber
+    * @param CBFcn User-provided callback function that will be called with the
+    *              records of a batch in one double array, the number of records,
+    *              the number of values per record and the user-specified data
+    * @param userData User-specified additional data passed to CBFcn
+    */
+   //------------------------------------------------------------------------------
+   int SetBatchCallback(const char* subscriberName, void (*CBFcn)(const double*, int, int, void*), void* userData)
+   {
+     // Get GMAT moderator
+     Moderator *theModerator = Moderator::Instance();
+     if (theModerator == NULL)
+     {
+       lastMsg = "Cannot find the Moderator";
+       return -1;
+     }
+
+     // Get subscriber with specified name
+     Subscriber *sub = theModerator->GetSubscriber(subscriberName);
+     if(sub == NULL)
+     {
+       lastMsg = "Subscriber not found";
+       return -2;
+     }
+
+     // Make sure subscriber is a DataCallback (so callback can be set)
+     DataCallback *dc = dynamic_cast<DataCallback*>(sub);
+     if(dc == NULL)
+     {
+       lastMsg = "Subscriber is not a data callback";
+       return -3;
+     }
+
+     // Set callback function
+     dc->SetBatchCallback(CBFcn, userData);
+
+     lastMsg = "Batch callback successfully set";
+     return 0;
+   }
+
    //---------------------------------------------------------------------------
    // const char* getLastMessage()
    //---------------------------------------------------------------------------
@@ -46,6 +46,8 @@ extern "C"
 
    // Set the user-specified callback function
    int        DATACALLBACK_API SetCallback(const char* subscriberName, void (*CBFcn)(const double*, int, void*), void* userData);
+   // Set a callback function that receives batches of records
+   int        DATACALLBACK_API SetBatchCallback(const char* subscriberName, void (*CBFcn)(const double*, int, int, void*), void* userData);
 
    // Get last message from a CInterface function
    const char DATACALLBACK_API *getLastMessage();
@@ -42,13 +42,23 @@
 const std::string
 DataCallback::PARAMETER_TEXT[DataCallbackParamCount - SubscriberParamCount] =
 {
-  "DataElements"
+  "DataElements",
+  "BatchSize",
+  "BatchInterval",
+  "AsyncDelivery",
+  "QueueSize",
+  "DropWhenFull"
 };
 
 const Gmat::ParameterType
 DataCallback::PARAMETER_TYPE[DataCallbackParamCount - SubscriberParamCount] =
 {
-  Gmat::OBJECTARRAY_TYPE // "DataElements"
+  Gmat::OBJECTARRAY_TYPE, // "DataElements"
+  Gmat::INTEGER_TYPE,     // "BatchSize"
+  Gmat::REAL_TYPE,        // "BatchInterval"
+  Gmat::BOOLEAN_TYPE,     // "AsyncDelivery"
+  Gmat::INTEGER_TYPE,     // "QueueSize"
+  Gmat::BOOLEAN_TYPE      // "DropWhenFull"
 };
 
 //------------------------------------------------------------------------------
@@ -63,7 +73,18 @@ DataCallback::DataCallback(const std::string &type, const std::string &name,
     Parameter *firstParam)
 : Subscriber(type, name),
   mCallbackFcn(NULL),
-  mUserData(NULL)
+  mUserData(NULL),
+  mBatchCallbackFcn(NULL),
+  mBatchUserData(NULL),
+  mBatchSize(1),
+  mBatchInterval(0.0),
+  mAsyncDelivery(false),
+  mQueueSize(4),
+  mDropWhenFull(false),
+  mPendingRecords(0),
+  mRecordLength(0),
+  mStopping(false),
+  mDroppedRecords(0)
 {
   objectTypes.push_back(Gmat::SUBSCRIBER);
   objectTypeNames.push_back("DataCallback");
@@ -85,6 +106,7 @@ DataCallback::DataCallback(const std::string &type, const std::string &name,
 //------------------------------------------------------------------------------
 DataCallback::~DataCallback(void)
 {
+  StopDelivery();
 }
 
 //------------------------------------------------------------------------------
@@ -97,7 +119,18 @@ DataCallback::~DataCallback(void)
   DataCallback::DataCallback(const DataCallback &dc)
 : Subscriber(dc),
   mCallbackFcn(dc.mCallbackFcn),
-  mUserData(dc.mUserData)
+  mUserData(dc.mUserData),
+  mBatchCallbackFcn(dc.mBatchCallbackFcn),
+  mBatchUserData(dc.mBatchUserData),
+  mBatchSize(dc.mBatchSize),
+  mBatchInterval(dc.mBatchInterval),
+  mAsyncDelivery(dc.mAsyncDelivery),
+  mQueueSize(dc.mQueueSize),
+  mDropWhenFull(dc.mDropWhenFull),
+  mPendingRecords(0),
+  mRecordLength(0),
+  mStopping(false),
+  mDroppedRecords(0)
 {
   mParams = dc.mParams;
   mNumParams = dc.mNumParams;
@@ -126,6 +159,13 @@ DataCallback& DataCallback::operator=(const DataCallback& dc)
   mAllRefObjectNames = dc.mAllRefObjectNames;
   mCallbackFcn = dc.mCallbackFcn;
   mUserData = dc.mUserData;
+  mBatchCallbackFcn = dc.mBatchCallbackFcn;
+  mBatchUserData = dc.mBatchUserData;
+  mBatchSize = dc.mBatchSize;
+  mBatchInterval = dc.mBatchInterval;
+  mAsyncDelivery = dc.mAsyncDelivery;
+  mQueueSize = dc.mQueueSize;
+  mDropWhenFull = dc.mDropWhenFull;
 
   return *this;
 }
@@ -170,6 +210,36 @@ void DataCallback::SetCallback(void (*CBFcn)(const double*, int, void*), void *u
   mUserData = userdata;
 }
 
+//------------------------------------------------------------------------------
+// void SetBatchCallback(void (*)(const double*, int, int, void*), void*)
+//------------------------------------------------------------------------------
+/**
+ * Sets the callback function to which batches of records are sent
+ *
+ * The function receives the records of a batch one after another in a single
+ * buffer, the number of records and the number of values in each record.
+ * The buffer is only valid during the call.
+ */
+//------------------------------------------------------------------------------
+void DataCallback::SetBatchCallback(void (*CBFcn)(const double*, int, int, void*),
+    void *userdata)
+{
+  mBatchCallbackFcn = CBFcn;
+  mBatchUserData = userdata;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetDroppedRecordCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of records dropped from a full queue during the run
+ */
+//------------------------------------------------------------------------------
+Integer DataCallback::GetDroppedRecordCount() const
+{
+  return mDroppedRecords;
+}
+
 //------------------------------------------------------------------------------
 // virtual bool Initialize()
 //------------------------------------------------------------------------------
@@ -203,6 +273,10 @@ bool DataCallback::Initialize()
 
   Subscriber::Initialize();
 
+  // Records left from an earlier run are delivered before this one starts
+  StopDelivery();
+  mDroppedRecords = 0;
+
   // if active and not initialized already, then initialize
   if (active && !isInitialized)
   {
@@ -257,11 +331,12 @@ std::string DataCallback::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer DataCallback::GetParameterID(const std::string &str) const
 {
-  for (Integer i = SubscriberParamCount; i < DataCallbackParamCount; i++)
-  {
-    if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-      return i;
-  }
+  static const ParameterIndex
+        parameterIndex(PARAMETER_TEXT, SubscriberParamCount,
+              DataCallbackParamCount);
+  Integer parameterId = parameterIndex.Find(str);
+  if (parameterId != -1)
+     return parameterId;
 
   return Subscriber::GetParameterID(str);
 }
@@ -307,7 +382,7 @@ bool DataCallback::IsParameterCommandModeSettable(const Integer id) const
     return true;
 
   // Turn these off
-  if (id == DATA_ELEMENTS)
+  if (id == DATA_ELEMENTS || id == ASYNC_DELIVERY || id == QUEUE_SIZE)
     return false;
 
   // Turn on the rest that are DataCallback specific (FILENAME, PRECISION, ADD,
@@ -319,6 +394,116 @@ bool DataCallback::IsParameterCommandModeSettable(const Integer id) const
   return Subscriber::IsParameterCommandModeSettable(id);
 }
 
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+Integer DataCallback::GetIntegerParameter(const Integer id) const
+{
+  switch (id)
+  {
+    case BATCH_SIZE:
+      return mBatchSize;
+    case QUEUE_SIZE:
+      return mQueueSize;
+    default:
+      return Subscriber::GetIntegerParameter(id);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+Integer DataCallback::SetIntegerParameter(const Integer id, const Integer value)
+{
+  switch (id)
+  {
+    case BATCH_SIZE:
+    case QUEUE_SIZE:
+      if (value < 1)
+      {
+	SubscriberException se;
+	se.SetDetails(errorMessageFormat.c_str(),
+	    GmatStringUtil::ToString(value, 1).c_str(),
+	    GetParameterText(id).c_str(), "Integer Number > 0");
+	throw se;
+      }
+      if (id == BATCH_SIZE)
+	mBatchSize = value;
+      else
+	mQueueSize = value;
+      return value;
+    default:
+      return Subscriber::SetIntegerParameter(id, value);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Real GetRealParameter(const Integer id) const
+//------------------------------------------------------------------------------
+Real DataCallback::GetRealParameter(const Integer id) const
+{
+  if (id == BATCH_INTERVAL)
+    return mBatchInterval;
+
+  return Subscriber::GetRealParameter(id);
+}
+
+//------------------------------------------------------------------------------
+// Real SetRealParameter(const Integer id, const Real value)
+//------------------------------------------------------------------------------
+Real DataCallback::SetRealParameter(const Integer id, const Real value)
+{
+  if (id == BATCH_INTERVAL)
+  {
+    if (value < 0.0)
+    {
+      SubscriberException se;
+      se.SetDetails(errorMessageFormat.c_str(),
+	  GmatStringUtil::ToString(value, 16).c_str(),
+	  GetParameterText(id).c_str(), "Real Number >= 0");
+      throw se;
+    }
+    mBatchInterval = value;
+    return mBatchInterval;
+  }
+
+  return Subscriber::SetRealParameter(id, value);
+}
+
+//------------------------------------------------------------------------------
+// bool GetBooleanParameter(const Integer id) const
+//------------------------------------------------------------------------------
+bool DataCallback::GetBooleanParameter(const Integer id) const
+{
+  switch (id)
+  {
+    case ASYNC_DELIVERY:
+      return mAsyncDelivery;
+    case DROP_WHEN_FULL:
+      return mDropWhenFull;
+    default:
+      return Subscriber::GetBooleanParameter(id);
+  }
+}
+
+//------------------------------------------------------------------------------
+// bool SetBooleanParameter(const Integer id, const bool value)
+//------------------------------------------------------------------------------
+bool DataCallback::SetBooleanParameter(const Integer id, const bool value)
+{
+  switch (id)
+  {
+    case ASYNC_DELIVERY:
+      mAsyncDelivery = value;
+      return true;
+    case DROP_WHEN_FULL:
+      mDropWhenFull = value;
+      return true;
+    default:
+      return Subscriber::SetBooleanParameter(id, value);
+  }
+}
+
 //------------------------------------------------------------------------------
 // bool SetStringParameter(const Integer id, const std::string &value)
 //------------------------------------------------------------------------------
@@ -514,17 +699,216 @@ const StringArray& DataCallback::GetWrapperObjectNameArray(bool completeSet)
 //------------------------------------------------------------------------------
 bool DataCallback::Distribute(const Real *dat, Integer len)
 {
-  if((mCallbackFcn != NULL) && (len > 0))
+  if (len == 0)
+  {
+    // Partial batches go out with the end of the data; the background
+    // thread finishes its queue before the run ends
+    if (isEndOfDataBlock || isEndOfRun)
+      FlushBatch();
+    if (isEndOfRun)
+      StopDelivery();
+    return true;
+  }
+
+  if ((mCallbackFcn == NULL) && (mBatchCallbackFcn == NULL))
+    return true;
+
+  if (len != mRecordLength)
+  {
+    FlushBatch();
+    mRecordLength = len;
+  }
+
+  // The record is evaluated straight into the batch buffer
+  Integer offset = mPendingRecords * len;
+  if ((Integer)mPending.size() < offset + len)
+  {
+    if (mPending.capacity() < (size_t)(mBatchSize * len))
+      mPending.reserve(mBatchSize * len);
+    mPending.resize(offset + len);
+  }
+  for (int i = 0; i < len; ++i)
+  {
+    // Need to convert input data to the right reference frame
+    mPending[offset + i] = yParamWrappers[i]->EvaluateReal();
+  }
+  if (mPendingRecords == 0)
+    mBatchStart = std::chrono::steady_clock::now();
+  ++mPendingRecords;
+
+  if (!UsesBatches() || (mPendingRecords >= mBatchSize))
+    FlushBatch();
+  else if (mBatchInterval > 0.0)
+  {
+    std::chrono::duration<double> age =
+	std::chrono::steady_clock::now() - mBatchStart;
+    if (age.count() >= mBatchInterval)
+      FlushBatch();
+  }
+
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// bool UsesBatches() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if records are collected before delivery
+ */
+//------------------------------------------------------------------------------
+bool DataCallback::UsesBatches() const
+{
+  return (mBatchSize > 1) || (mBatchInterval > 0.0) ||
+    (mBatchCallbackFcn != NULL) || mAsyncDelivery;
+}
+
+//------------------------------------------------------------------------------
+// void FlushBatch()
+//------------------------------------------------------------------------------
+/**
+ * Delivers the records collected so far, or queues them for the background
+ * thread
+ */
+//------------------------------------------------------------------------------
+void DataCallback::FlushBatch()
+{
+  if (mPendingRecords == 0)
+    return;
+
+  if (mAsyncDelivery)
+    Enqueue();
+  else
+    Deliver(&mPending[0], mPendingRecords, mRecordLength);
+
+  mPendingRecords = 0;
+  mPending.clear();
+}
+
+//------------------------------------------------------------------------------
+// void Enqueue()
+//------------------------------------------------------------------------------
+/**
+ * Moves the collected records to the delivery queue, starting the background
+ * thread if needed
+ *
+ * A full queue blocks until the thread takes a batch, or drops the oldest
+ * waiting batch when DropWhenFull is set.
+ */
+//------------------------------------------------------------------------------
+void DataCallback::Enqueue()
+{
+  std::unique_lock<std::mutex> lock(mQueueMutex);
+
+  if (!mWorker.joinable())
   {
-    double *convertedData = new double[len];
-    for(int i = 0; i < len; ++i)
+    mStopping = false;
+    mWorker = std::thread(&DataCallback::RunDelivery, this);
+  }
+
+  while ((Integer)mQueue.size() >= mQueueSize)
+  {
+    if (mDropWhenFull)
     {
-      // Need to convert input data to the right reference frame
-      convertedData[i] = yParamWrappers[i]->EvaluateReal();
+      mDroppedRecords += mQueue.front().recordCount;
+      mSpareBuffers.push_back(std::vector<double>());
+      mSpareBuffers.back().swap(mQueue.front().data);
+      mQueue.pop_front();
     }
-    mCallbackFcn(convertedData, len, mUserData);
-	delete convertedData;
+    else
+      mQueueChanged.wait(lock);
   }
 
-  return true;
+  // The batch buffer is swapped into the queue; a spare buffer from an
+  // earlier batch, if there is one, becomes the next batch buffer
+  mQueue.push_back(Batch());
+  Batch &batch = mQueue.back();
+  batch.data.swap(mPending);
+  batch.recordCount = mPendingRecords;
+  batch.recordLength = mRecordLength;
+  if (!mSpareBuffers.empty())
+  {
+    mPending.swap(mSpareBuffers.back());
+    mSpareBuffers.pop_back();
+  }
+
+  lock.unlock();
+  mQueueChanged.notify_all();
+}
+
+//------------------------------------------------------------------------------
+// void StopDelivery()
+//------------------------------------------------------------------------------
+/**
+ * Waits for the background thread to deliver the queued batches, and stops it
+ */
+//------------------------------------------------------------------------------
+void DataCallback::StopDelivery()
+{
+  if (mWorker.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(mQueueMutex);
+      mStopping = true;
+    }
+    mQueueChanged.notify_all();
+    mWorker.join();
+  }
+
+  if (mDroppedRecords > 0)
+    MessageInterface::ShowMessage
+      ("*** WARNING *** The DataCallback named \"%s\" dropped %d records "
+       "because its callback did not keep up with the data.\n",
+       GetName().c_str(), mDroppedRecords);
+}
+
+//------------------------------------------------------------------------------
+// void RunDelivery()
+//------------------------------------------------------------------------------
+/**
+ * Body of the background thread: delivers queued batches in order until
+ * StopDelivery() is called and the queue is empty
+ */
+//------------------------------------------------------------------------------
+void DataCallback::RunDelivery()
+{
+  std::unique_lock<std::mutex> lock(mQueueMutex);
+  while (true)
+  {
+    while (mQueue.empty() && !mStopping)
+      mQueueChanged.wait(lock);
+    if (mQueue.empty())
+      break;
+
+    Batch batch;
+    batch.data.swap(mQueue.front().data);
+    batch.recordCount = mQueue.front().recordCount;
+    batch.recordLength = mQueue.front().recordLength;
+    mQueue.pop_front();
+    lock.unlock();
+    mQueueChanged.notify_all();
+
+    Deliver(&batch.data[0], batch.recordCount, batch.recordLength);
+
+    lock.lock();
+    batch.data.clear();
+    mSpareBuffers.push_back(std::vector<double>());
+    mSpareBuffers.back().swap(batch.data);
+  }
+}
+
+//------------------------------------------------------------------------------
+// void Deliver(const double *dat, int recordCount, int recordLength)
+//------------------------------------------------------------------------------
+/**
+ * Calls the batch callback with the records, or the record callback once for
+ * each record
+ */
+//------------------------------------------------------------------------------
+void DataCallback::Deliver(const double *dat, int recordCount, int recordLength)
+{
+  if (mBatchCallbackFcn != NULL)
+    mBatchCallbackFcn(dat, recordCount, recordLength, mBatchUserData);
+  else if (mCallbackFcn != NULL)
+    for (int i = 0; i < recordCount; ++i)
+      mCallbackFcn(dat + i * recordLength, recordLength, mUserData);
 }
@@ -34,9 +34,36 @@
 
 #include "datacallback_defs.hpp"
 #include "Subscriber.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 class Parameter;
 
+/**
+ * Sends the values of a list of Parameters to a user function
+ *
+ * By default the callback set with SetCallback() is called once per
+ * published record, on the thread running the mission.  Setting BatchSize,
+ * BatchInterval or a batch callback collects records into one contiguous
+ * buffer, record after record, delivered in a single call:
+ *
+ * - BatchSize is the number of records in a full batch.
+ * - BatchInterval, in seconds of wall clock time, sends a batch whose first
+ *   record is older than the interval when the next record arrives.
+ * - Partial batches are sent at the end of each data block and of the run.
+ *
+ * With AsyncDelivery on, batches are handed to a background thread through
+ * a queue holding up to QueueSize batches, and the callbacks run on that
+ * thread.  When the queue is full the mission waits for the callback to
+ * catch up, or, with DropWhenFull on, the oldest waiting batch is dropped.
+ * The queue is drained at the end of the run.
+ *
+ * A batch is delivered to the batch callback if one is set, and one record
+ * at a time to the record callback otherwise.
+ */
 class DATACALLBACK_API DataCallback : public Subscriber
 {
   public:
@@ -51,6 +78,9 @@ class DATACALLBACK_API DataCallback : public Subscriber
     // methods for this class
     bool AddParameter(const std::string &paramName, Integer index);
     void SetCallback(void (*CBFcn)(const double*, int, void*), void *userdata);
+    void SetBatchCallback(void (*CBFcn)(const double*, int, int, void*),
+	void *userdata);
+    Integer GetDroppedRecordCount() const;
 
     // methods inhereted from GmatBase
     virtual bool Initialize();
@@ -64,6 +94,15 @@ class DATACALLBACK_API DataCallback : public Subscriber
 
     virtual bool         IsParameterCommandModeSettable(const Integer id) const;
 
+    virtual Integer      GetIntegerParameter(const Integer id) const;
+    virtual Integer      SetIntegerParameter(const Integer id,
+	const Integer value);
+    virtual Real         GetRealParameter(const Integer id) const;
+    virtual Real         SetRealParameter(const Integer id, const Real value);
+    virtual bool         GetBooleanParameter(const Integer id) const;
+    virtual bool         SetBooleanParameter(const Integer id,
+	const bool value);
+
     virtual bool         SetStringParameter(const Integer id,
 	const std::string &value);
     virtual bool         SetStringParameter(const std::string &label,
@@ -105,10 +144,59 @@ class DATACALLBACK_API DataCallback : public Subscriber
 
     void (*mCallbackFcn)(const double *dat, int len, void *userdata);
     void *mUserData; // User data sent to callback function
+    void (*mBatchCallbackFcn)(const double *dat, int recordCount,
+	int recordLength, void *userdata);
+    void *mBatchUserData; // User data sent to the batch callback function
+
+    /// Records per full batch
+    Integer mBatchSize;
+    /// Age in seconds of the first record at which a batch is sent; 0 for none
+    Real mBatchInterval;
+    /// Flag for delivery on a background thread
+    bool mAsyncDelivery;
+    /// Batches allowed to wait for the background thread
+    Integer mQueueSize;
+    /// Flag for dropping the oldest batch, rather than waiting, on a full queue
+    bool mDropWhenFull;
+
+    /// A batch of records waiting for delivery
+    struct Batch
+    {
+      std::vector<double> data;
+      int recordCount;
+      int recordLength;
+    };
+
+    /// The batch being collected
+    std::vector<double> mPending;
+    Integer mPendingRecords;
+    Integer mRecordLength;
+    std::chrono::steady_clock::time_point mBatchStart;
+
+    /// Background delivery; the queue and flags are guarded by mQueueMutex
+    std::deque<Batch> mQueue;
+    std::vector<std::vector<double> > mSpareBuffers;
+    std::mutex mQueueMutex;
+    std::condition_variable mQueueChanged;
+    std::thread mWorker;
+    bool mStopping;
+    Integer mDroppedRecords;
+
+    bool UsesBatches() const;
+    void FlushBatch();
+    void Enqueue();
+    void StopDelivery();
+    void RunDelivery();
+    void Deliver(const double *dat, int recordCount, int recordLength);
 
     enum
     {
       DATA_ELEMENTS = SubscriberParamCount,
+      BATCH_SIZE,
+      BATCH_INTERVAL,
+      ASYNC_DELIVERY,
+      QUEUE_SIZE,
+      DROP_WHEN_FULL,
       DataCallbackParamCount /// Count of the parameters for this class
     };
 
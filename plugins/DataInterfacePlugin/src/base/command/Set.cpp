@@ -76,7 +76,10 @@ Set::Set() :
    target            (NULL),
    interfaceName     (""),
    theInterface      (NULL),
-   loadAll           (true)
+   loadAll           (true),
+   convertFromName   (""),
+   convertFromCS     (NULL),
+   convertToCS       (NULL)
 {
 }
 
@@ -90,6 +93,7 @@ Set::Set() :
 //------------------------------------------------------------------------------
 Set::~Set()
 {
+   ClearConversionSystems();
 }
 
 
@@ -109,7 +113,10 @@ Set::Set(const Set& sv) :
    interfaceName     (sv.interfaceName),
    theInterface      (NULL),
    loadAll           (sv.loadAll),
-   selections        (sv.selections)
+   selections        (sv.selections),
+   convertFromName   (""),
+   convertFromCS     (NULL),
+   convertToCS       (NULL)
 {
 }
 
@@ -135,6 +142,8 @@ Set& Set::operator=(const Set& sv)
       theInterface  = NULL;
       loadAll       = sv.loadAll;
       selections    = sv.selections;
+      fieldTargets.clear();
+      ClearConversionSystems();
    }
    
    return *this;
@@ -539,6 +548,11 @@ bool Set::Initialize()
       throw CommandException("The object \"" + interfaceName +
                "\" is not a FileInterface object."); 
 
+   // The target parameters and conversion systems are found again for the
+   // (possibly new) target and solar system
+   fieldTargets.clear();
+   ClearConversionSystems();
+
 
    // If specific data elements are requested, warn if not in the reader
    if (!loadAll)
@@ -606,7 +620,7 @@ bool Set::Execute()
          {
             theItem = (loadAll ? allItems[i] : selections[i]);
             DataReader::readerDataType fieldType =
-                     theInterface->GetReaderParameterType(theItem);
+                     GetFieldTarget(theItem).readerType;
 
             if (SetTargetParameterData(fieldType, theItem))
                valueSet = true;
@@ -652,6 +666,7 @@ bool Set::Execute()
 //------------------------------------------------------------------------------
 void Set::RunComplete()
 {
+   ClearConversionSystems();
    GmatCommand::RunComplete();
 }
 
@@ -794,16 +809,14 @@ bool Set::SetTargetParameterData(DataReader::readerDataType theType,
       const std::string& forField)
 {
    bool retval = false;
-   std::string theParmString;
 
    if (theInterface->WasDataLoaded(forField))
    {
-      theParmString =
-            theInterface->GetObjectParameterName(forField);
+      const FieldTarget &fieldTarget = GetFieldTarget(forField);
+      const std::string &theParmString = fieldTarget.parameter;
       if (theParmString != "")
       {
-         Integer id = target->GetParameterID(theParmString);
-         Integer type = target->GetParameterType(id);
+         Integer id = fieldTarget.id;
          switch (theType)
          {
          case DataReader::READER_REAL:
@@ -814,7 +827,7 @@ bool Set::SetTargetParameterData(DataReader::readerDataType theType,
                         "%.12lf\n", theParmString.c_str(),
                         targetName.c_str(), value);
                #endif
-               if (type != Gmat::REAL_TYPE)
+               if (!fieldTarget.isReal)
                   throw CommandException("The data interface parameter " +
                         forField + " has the wrong data type");
                target->SetRealParameter(id, value);
@@ -843,13 +856,11 @@ bool Set::SetTargetParameterData(DataReader::readerDataType theType,
                   #endif
                }
 
+               if (!fieldTarget.isReal)
+                  throw CommandException("The data interface parameter " +
+                        forField + " has the wrong data type");
                for (UnsignedInt i = 0; i < 6; ++i)
-               {
-                  if (target->GetParameterType(id + i) != Gmat::REAL_TYPE)
-                     throw CommandException("The data interface parameter " +
-                           forField + " has the wrong data type");
                   target->SetRealParameter(id + i, values[i]);
-               }
                retval = true;
             }
             break;
@@ -949,16 +960,26 @@ Rvector6 Set::ConvertToTargetCoordinateSystem(const std::string& from,
 
    if (target->IsOfType("SpaceObject") && (origin != NULL))
    {
-      #ifdef DEBUG_SET_EXEC
-         MessageInterface::ShowMessage("Creating local CS with axes %s and "
-               "origin at %s\n", axisType.c_str(), originName.c_str());
-      #endif
-      CoordinateSystem *fromCS = CoordinateSystem::CreateLocalCoordinateSystem(
-            from, axisType, origin, NULL, NULL, j2000body, solarSys);
-      //CoordinateSystem *toCS =
-      //      (CoordinateSystem*)target->GetRefObject(Gmat::COORDINATE_SYSTEM,"");
-      CoordinateSystem *toCS = CoordinateSystem::CreateLocalCoordinateSystem(
-            "temp", "MJ2000Eq", solarSys->GetBody("Earth"), NULL, NULL, j2000body, solarSys);
+      // The systems are built once and reused while the reader reports the
+      // same system, so a sequence of Set commands does not rebuild them
+      if ((from != convertFromName) || (convertFromCS == NULL) ||
+          (convertToCS == NULL))
+      {
+         ClearConversionSystems();
+         #ifdef DEBUG_SET_EXEC
+            MessageInterface::ShowMessage("Creating local CS with axes %s and "
+                  "origin at %s\n", axisType.c_str(), originName.c_str());
+         #endif
+         convertFromCS = CoordinateSystem::CreateLocalCoordinateSystem(
+               from, axisType, origin, NULL, NULL, j2000body, solarSys);
+         //CoordinateSystem *toCS =
+         //      (CoordinateSystem*)target->GetRefObject(Gmat::COORDINATE_SYSTEM,"");
+         convertToCS = CoordinateSystem::CreateLocalCoordinateSystem(
+               "temp", "MJ2000Eq", solarSys->GetBody("Earth"), NULL, NULL, j2000body, solarSys);
+         convertFromName = from;
+      }
+      CoordinateSystem *fromCS = convertFromCS;
+      CoordinateSystem *toCS = convertToCS;
 
       //GmatEpoch epoch = ConvertToSystemTime(
       //      theInterface->GetTimeSystemName("Epoch"),
@@ -977,11 +998,6 @@ Rvector6 Set::ConvertToTargetCoordinateSystem(const std::string& from,
                "coordinate system %s\n", from.c_str());
          newRep = fromState;
       }
-
-      if (fromCS)
-         delete fromCS;
-      if (toCS)
-         delete toCS;
    }
    else
    {
@@ -995,6 +1011,68 @@ Rvector6 Set::ConvertToTargetCoordinateSystem(const std::string& from,
 }
 
 
+//-----------------------------------------------------------------------------
+// const FieldTarget& GetFieldTarget(const std::string &forField)
+//-----------------------------------------------------------------------------
+/**
+ * Finds the target parameter that receives a data field
+ *
+ * The reader type, the target parameter name and its ID are looked up by
+ * string the first time a field is set in a run and kept, so repeated
+ * executions apply the data by ID.
+ *
+ * @param forField The data field
+ *
+ * @return The resolved target parameter
+ */
+//-----------------------------------------------------------------------------
+const Set::FieldTarget& Set::GetFieldTarget(const std::string &forField)
+{
+   std::map<std::string, FieldTarget>::iterator known =
+         fieldTargets.find(forField);
+   if (known != fieldTargets.end())
+      return known->second;
+
+   FieldTarget fieldTarget;
+   fieldTarget.readerType = theInterface->GetReaderParameterType(forField);
+   fieldTarget.parameter  = theInterface->GetObjectParameterName(forField);
+   fieldTarget.id         = -1;
+   fieldTarget.isReal     = false;
+
+   if (fieldTarget.parameter != "")
+   {
+      fieldTarget.id = target->GetParameterID(fieldTarget.parameter);
+      fieldTarget.isReal = true;
+      Integer count =
+            (fieldTarget.readerType == DataReader::READER_RVECTOR6 ? 6 : 1);
+      for (Integer i = 0; i < count; ++i)
+         if (target->GetParameterType(fieldTarget.id + i) != Gmat::REAL_TYPE)
+            fieldTarget.isReal = false;
+   }
+
+   return (fieldTargets[forField] = fieldTarget);
+}
+
+
+//-----------------------------------------------------------------------------
+// void ClearConversionSystems()
+//-----------------------------------------------------------------------------
+/**
+ * Deletes the coordinate systems used to convert 6-vectors
+ */
+//-----------------------------------------------------------------------------
+void Set::ClearConversionSystems()
+{
+   if (convertFromCS)
+      delete convertFromCS;
+   if (convertToCS)
+      delete convertToCS;
+   convertFromCS = NULL;
+   convertToCS = NULL;
+   convertFromName = "";
+}
+
+
 //-----------------------------------------------------------------------------
 // GmatEpoch ConvertToSystemTime(const std::string& from, GmatEpoch fromTime)
 //-----------------------------------------------------------------------------
@@ -37,6 +37,9 @@
 #include "DataInterface.hpp"
 #include "GmatCommand.hpp"
 #include <fstream>
+#include <map>
+
+class CoordinateSystem;
 
 /**
  * Retrieves data from a DataInterface and set it on a target object.
@@ -109,6 +112,32 @@ protected:
    bool                 loadAll;
    /// The list of data elements requested, used if loadAll is false
    StringArray          selections;
+
+   /// Target parameter that receives a data field, resolved once per run
+   struct FieldTarget
+   {
+      /// Reader type of the field
+      DataReader::readerDataType
+                        readerType;
+      /// Name of the target parameter; empty if the field sets nothing
+      std::string       parameter;
+      /// ID of the target parameter (the first element for 6-vectors)
+      Integer           id;
+      /// True if the target parameter(s) are Real
+      bool              isReal;
+   };
+   /// Resolved target parameters, by data field
+   std::map<std::string, FieldTarget>
+                        fieldTargets;
+
+   /// Name of the reader coordinate system that convertFromCS represents
+   std::string          convertFromName;
+   /// Coordinate systems used to convert 6-vectors to the target system
+   CoordinateSystem     *convertFromCS;
+   CoordinateSystem     *convertToCS;
+
+   const FieldTarget&   GetFieldTarget(const std::string &forField);
+   void                 ClearConversionSystems();
    
    bool                 SetTargetParameterData(
                                              DataReader::readerDataType theType,
@@ -35,6 +35,9 @@
 #include "MessageInterface.hpp"
 #include "InterfaceException.hpp"
 
+#include <sys/stat.h>               // for stat()
+#include <sstream>
+
 
 //#define DEBUG_FILEINTERFACE_PARAM
 //#define DEBUG_READER_CREATION
@@ -68,7 +71,8 @@ FileInterface::PARAMETER_TYPE[FileInterfaceParamCount - DataInterfaceParamCount]
 FileInterface::FileInterface(const std::string &name) :
    DataInterface           ("FileInterface", name),
    filename                (""),
-   streamIsBinary          (false)
+   streamIsBinary          (false),
+   loadedFileKey           ("")
 {
    objectTypeNames.push_back("FileInterface");
    parameterCount = FileInterfaceParamCount;
@@ -106,7 +110,8 @@ FileInterface::~FileInterface()
 FileInterface::FileInterface(const FileInterface& fi) :
    DataInterface           (fi),
    filename                (fi.filename),
-   streamIsBinary          (fi.streamIsBinary)
+   streamIsBinary          (fi.streamIsBinary),
+   loadedFileKey           ("")
 {
 }
 
@@ -129,6 +134,7 @@ FileInterface FileInterface::operator=(const FileInterface& fi)
 
       filename = fi.filename;
       streamIsBinary = fi.streamIsBinary;
+      loadedFileKey = "";
    }
    return *this;
 }
@@ -462,6 +468,7 @@ bool FileInterface::Initialize()
       if (theReader != NULL)
          delete theReader;
       theReader = (DataReader*)rf.CreateObject(readerFormat, "");
+      loadedFileKey = "";
       if (theReader != NULL)
       {
          #ifdef DEBUG_READER_CREATION
@@ -540,12 +547,44 @@ bool FileInterface::LoadData()
 
    if (theReader && theStream.is_open())
    {
+      // The reader keeps the data of the last read; when the file has not
+      // changed since, as for a Set command in a loop, it is not parsed again
+      std::string fileKey = GetFileKey();
+      if ((fileKey != "") && (fileKey == loadedFileKey))
+         return true;
+
+      loadedFileKey = "";
       retval = theReader->ReadData();
+      if (retval)
+         loadedFileKey = fileKey;
    }
 
    return retval;
 }
 
+
+//------------------------------------------------------------------------------
+// std::string GetFileKey() const
+//------------------------------------------------------------------------------
+/**
+ * Builds a key identifying the current version of the file
+ *
+ * @return The name, size and modification time of the file, or an empty
+ *         string if the file cannot be examined
+ */
+//------------------------------------------------------------------------------
+std::string FileInterface::GetFileKey() const
+{
+   struct stat fileStatus;
+   if ((filename == "") || (stat(filename.c_str(), &fileStatus) != 0))
+      return "";
+
+   std::stringstream key;
+   key << filename << "|" << (long long)fileStatus.st_size << "|"
+       << (long long)fileStatus.st_mtime;
+   return key.str();
+}
+
 //------------------------------------------------------------------------------
 // Integer Close(const std::string& name)
 //------------------------------------------------------------------------------
@@ -94,6 +94,10 @@ protected:
    std::ifstream theStream;
    /// Flag indicating if the stream is binary or text (ASCII only for now)
    bool streamIsBinary;
+   /// Name, size and modification time of the file the reader last loaded
+   std::string loadedFileKey;
+
+   std::string GetFileKey() const;
 
    /// Parameter IDs
    enum
@@ -360,18 +360,22 @@ bool TcopsVHFAscii::ParseDataBlock()
 {
    bool retval = false;
 
-   for (UnsignedInt i = 0; i < supportedFields.size(); ++i)
+   for (UnsignedInt j = 0; j < supportedFields.size(); ++j)
    {
-      std::string theField = supportedFields[i];
+      std::string theField = supportedFields[j];
       if (readAllSupportedFields || (find(selectedFields.begin(),
             selectedFields.end(), theField) != selectedFields.end()))
       {
+         // The key and type are found once for the scan of the block
+         const std::string &fileString = fileStringMap[theField];
+         readerDataType theType = dataType[theField];
+
          // Read the data block looking for a file string match
          for (UnsignedInt i = 0; i < dataBuffer.size(); ++i)
          {
-            if (dataBuffer[i].find(fileStringMap[theField])!=std::string::npos)
+            if (dataBuffer[i].find(fileString) != std::string::npos)
             {
-               switch (dataType[theField])
+               switch (theType)
                {
                case READER_REAL:
                   if (ParseRealValue(i, theField))
@@ -398,7 +402,7 @@ bool TcopsVHFAscii::ParseDataBlock()
                case READER_TIMESTRING:
                   if (ParseStringValue(i, theField))
                   {
-                     if (dataType[theField] == READER_TIMESTRING)
+                     if (theType == READER_TIMESTRING)
                         ParseTime(theField);
                      retval = true;
                   }
@@ -241,12 +241,12 @@ std::string CcsdsEphPropagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer CcsdsEphPropagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EphemerisPropagatorParamCount;
-         i < CcsdsEphPropagatorParamCount; ++i)
-   {
-       if (str == PARAMETER_TEXT[i - EphemerisPropagatorParamCount])
-           return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, EphemerisPropagatorParamCount,
+               CcsdsEphPropagatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return EphemerisPropagator::GetParameterID(str);
 }
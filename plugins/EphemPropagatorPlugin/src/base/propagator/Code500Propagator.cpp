@@ -38,6 +38,7 @@
 #include "CoordinateConverter.hpp"
 
 #include <sstream>                     // for stringstream
+#include <algorithm>                   // for upper_bound
 
 //#define DEBUG_INITIALIZATION
 //#define DEBUG_PROPAGATION
@@ -96,6 +97,9 @@ Code500Propagator::Code500Propagator(const std::string &name) :
    timeFromEphemStart         (-1.0),
    lastEpoch                  (-1.0),
    lastEpochGT                (-1.0),
+   recordHint                 (-1),
+   windowStart                (-1),
+   windowIsGT                 (false),
    ephemCoord                 (NULL),
    j2k                        (NULL)
 {
@@ -144,6 +148,9 @@ Code500Propagator::Code500Propagator(const Code500Propagator & prop) :
    timeFromEphemStart         (-1.0),
    lastEpoch                  (-1.0),
    lastEpochGT                (-1.0),
+   recordHint                 (-1),
+   windowStart                (-1),
+   windowIsGT                 (false),
    ephemCoord                 (NULL),
    j2k                        (NULL)
 {
@@ -178,6 +185,8 @@ Code500Propagator & Code500Propagator::operator=(const Code500Propagator & prop)
       ephemRecords = NULL;
       record = -1;
       stateIndex = -1;
+      recordHint = -1;
+      windowStart = -1;
       lastEpoch = currentEpoch = prop.currentEpoch;
       lastEpochGT = currentEpochGT = prop.currentEpochGT;
 
@@ -262,12 +271,12 @@ std::string Code500Propagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Code500Propagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EphemerisPropagatorParamCount;
-         i < Code500PropagatorParamCount; ++i)
-   {
-       if (str == PARAMETER_TEXT[i - EphemerisPropagatorParamCount])
-           return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, EphemerisPropagatorParamCount,
+               Code500PropagatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return EphemerisPropagator::GetParameterID(str);
 }
@@ -763,6 +772,9 @@ bool Code500Propagator::Initialize()
             startEpochs.clear();
             timeSteps.clear();
             timeSpans.clear();
+            blockOffsets.clear();
+            recordHint = -1;
+            Real blockOffset = 0.0;
             for (UnsignedInt i = 0; i < ephemRecords->size(); ++i)
             {
                // Save the data used by the Code500 propagator in GMAT compatible formats
@@ -800,6 +812,8 @@ bool Code500Propagator::Initialize()
                   span += theTimeConverter->NumberOfLeapSecondsFrom(epoch + span/GmatTimeConstants::SECS_PER_DAY) -
                           theTimeConverter->NumberOfLeapSecondsFrom(epoch);
                timeSpans.push_back(span);
+               blockOffsets.push_back(blockOffset);
+               blockOffset += span;
 
                #ifdef DEBUG_INITIALIZATION
                   MessageInterface::ShowMessage("   %3d: Date %.0lf : %lf secs "
@@ -873,6 +887,7 @@ bool Code500Propagator::Initialize()
             if (interp != NULL)
                delete interp;
             interp = new NotAKnotInterpolator("Code500NotAKnot", 6);
+            windowStart = -1;
             ephem.CloseForRead();
 
             Rvector6 outState;
@@ -1250,6 +1265,10 @@ void Code500Propagator::SetEphemSpan(Integer whichOne)
 /**
  * Sets up the indices into the ephem data for a input epoch
  *
+ * The block containing the epoch is the last one starting at or before it.
+ * Propagation usually stays in a block, or moves to the next one, so those
+ * two blocks are checked before the block start epochs are bisected.
+ *
  * @param forEpoch The epoch that is being set up
  */
 //------------------------------------------------------------------------------
@@ -1260,19 +1279,20 @@ void Code500Propagator::FindRecord(GmatEpoch forEpoch)
 
    if ((forEpoch >= ephemStart) && (forEpoch <= ephemEnd))
    {
+      Integer blockCount = ephemRecords->size();
+
       record = -2;
-      for (UnsignedInt i = 0; i < ephemRecords->size(); ++i)
-         if (forEpoch < startEpochs[i])
-         {
-            record = i - 1;
-            break;
-         }
+      for (Integer i = recordHint; (i >= 0) && (i <= recordHint + 1) &&
+            (i < blockCount) && (record == -2); ++i)
+         if ((startEpochs[i] <= forEpoch) &&
+             ((i == blockCount - 1) || (forEpoch < startEpochs[i+1])))
+            record = i;
 
-      // Handle epoch in the final block
       if (record == -2)
-      {
-         record = ephemRecords->size() - 1;
-      }
+         record = (Integer)(std::upper_bound(startEpochs.begin(),
+               startEpochs.begin() + blockCount, forEpoch) -
+               startEpochs.begin()) - 1;
+      recordHint = record;
 
       // Now figure out the record number in the block
       Real secsPastStart = (forEpoch - startEpochs[record]) *
@@ -1294,19 +1314,21 @@ void Code500Propagator::FindRecord(GmatTime forEpoch)
 
    if ((forEpoch >= ephemStart) && (forEpoch <= ephemEnd))
    {
+      Integer blockCount = ephemRecords->size();
+
       record = -2;
-      for (UnsignedInt i = 0; i < ephemRecords->size(); ++i)
-         if (forEpoch < startEpochs[i])
-         {
-            record = i - 1;
-            break;
-         }
+      for (Integer i = recordHint; (i >= 0) && (i <= recordHint + 1) &&
+            (i < blockCount) && (record == -2); ++i)
+         if (!(forEpoch < startEpochs[i]) &&
+             ((i == blockCount - 1) || (forEpoch < startEpochs[i+1])))
+            record = i;
 
-      // Handle epoch in the final block
       if (record == -2)
-      {
-         record = ephemRecords->size() - 1;
-      }
+         record = (Integer)(std::upper_bound(startEpochs.begin(),
+               startEpochs.begin() + blockCount, forEpoch,
+               [](const GmatTime &epoch, const Real blockStart)
+               { return epoch < blockStart; }) - startEpochs.begin()) - 1;
+      recordHint = record;
 
       // Now figure out the record number in the block
       Real secsPastStart = (forEpoch - GmatTime(startEpochs[record])).GetTimeInSec();
@@ -1494,18 +1516,26 @@ void Code500Propagator::UpdateInterpolator(const GmatEpoch &forEpoch)
    Real epoch;
    Real state[6];
 
-   // Brute force for now: refill the interpolator
-   interp->Clear();
+   // The interpolator buffer holds the last 5 points added, so as the window
+   // slides forward only the points entering it are added
+   Integer firstPoint = usedRecords[0][0] * 50 + usedRecords[0][1];
+   UnsignedInt firstNew = 0;
+   if (!windowIsGT && (windowStart != -1) && (firstPoint >= windowStart) &&
+       (firstPoint - windowStart < 5))
+      firstNew = 5 - (firstPoint - windowStart);
+   windowStart = firstPoint;
+   windowIsGT = false;
+
+   if (firstNew == 0)
+      interp->Clear();
 
    #ifdef DEBUG_INTERPOLATION
       MessageInterface::ShowMessage("Pairs used for epoch %.12lf:\n", forEpoch);
    #endif
 
-   for (UnsignedInt i = 0; i < 5; ++i)
+   for (UnsignedInt i = firstNew; i < 5; ++i)
    {
-      Real epochOffset = 0;
-      for (UnsignedInt j = 0; j < usedRecords[i][0]; ++j)
-         epochOffset += timeSpans.at(j);
+      Real epochOffset = blockOffsets[usedRecords[i][0]];
       epochOffset += timeSteps[usedRecords[i][0]] * (usedRecords[i][1]);
 
       if (ephem.GetTimeSystem() == 2.0)  // Check Leap seconds for UTC
@@ -1645,14 +1675,23 @@ void Code500Propagator::UpdateInterpolator(const GmatTime &forEpoch)
    GmatTime epoch;
    Real state[6];
 
-   // Brute force for now: refill the interpolator
-   interp->Clear();
+   // Add only the points entering the window, as in the GmatEpoch version
+   Integer firstPoint = usedRecords[0][0] * 50 + usedRecords[0][1];
+   UnsignedInt firstNew = 0;
+   if (windowIsGT && (windowStart != -1) && (firstPoint >= windowStart) &&
+       (firstPoint - windowStart < 5))
+      firstNew = 5 - (firstPoint - windowStart);
+   windowStart = firstPoint;
+   windowIsGT = true;
+
+   if (firstNew == 0)
+      interp->Clear();
 
 #ifdef DEBUG_INTERPOLATION
    MessageInterface::ShowMessage("Pairs used for epoch %s:\n", GmatTime(forEpoch).ToString().c_str());
 #endif
 
-   for (UnsignedInt i = 0; i < 5; ++i)
+   for (UnsignedInt i = firstNew; i < 5; ++i)
    {
       epoch = startEpochs[usedRecords[i][0]];
       epoch.AddSeconds(timeSteps[usedRecords[i][0]] * (usedRecords[i][1]));
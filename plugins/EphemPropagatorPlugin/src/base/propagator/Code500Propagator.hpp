@@ -128,6 +128,14 @@ protected:
    GmatTime                lastEpochGT;
    /// Time spanned by each data block
    RealArray               timeSpans;
+   /// Time from the ephem start to the start of each data block, in seconds
+   RealArray               blockOffsets;
+   /// Block found by the previous FindRecord() call, checked first
+   Integer                 recordHint;
+   /// Index (50 * block + line) of the first point loaded in the interpolator
+   Integer                 windowStart;
+   /// Flag indicating that the loaded points have precision time epochs
+   bool                    windowIsGT;
 
    /// CoordinateConverter instance
    CoordinateConverter     cc;
@@ -264,12 +264,12 @@ EphemerisPropagator& EphemerisPropagator::operator=(
 //------------------------------------------------------------------------------
 Integer EphemerisPropagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = PropagatorParamCount;
-         i < EphemerisPropagatorParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - PropagatorParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, PropagatorParamCount,
+               EphemerisPropagatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Propagator::GetParameterID(str);
 }
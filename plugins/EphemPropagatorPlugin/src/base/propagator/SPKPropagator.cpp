@@ -198,12 +198,12 @@ std::string SPKPropagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SPKPropagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EphemerisPropagatorParamCount;
-         i < SPKPropagatorParamCount; ++i)
-   {
-       if (str == PARAMETER_TEXT[i - EphemerisPropagatorParamCount])
-           return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, EphemerisPropagatorParamCount,
+               SPKPropagatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return EphemerisPropagator::GetParameterID(str);
 }
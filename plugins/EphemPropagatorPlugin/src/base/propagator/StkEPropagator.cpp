@@ -229,12 +229,12 @@ std::string StkEPropagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer StkEPropagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EphemerisPropagatorParamCount;
-         i < StkEPropagatorParamCount; ++i)
-   {
-       if (str == PARAMETER_TEXT[i - EphemerisPropagatorParamCount])
-           return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, EphemerisPropagatorParamCount,
+               StkEPropagatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return EphemerisPropagator::GetParameterID(str);
 }
@@ -194,11 +194,12 @@ std::string AngleAdapterDeg::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer AngleAdapterDeg::GetParameterID(const std::string& str) const
 {
-   for (Integer i = AdapterParamCount; i < AngleAdapterDegParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - AdapterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, AdapterParamCount,
+               AngleAdapterDegParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return TrackingDataAdapter::GetParameterID(str);
 }
 
@@ -285,11 +285,12 @@ std::string BRTSDopplerAdapter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer BRTSDopplerAdapter::GetParameterID(const std::string& str) const
 {
-   for (Integer i = BRTSRangeAdapterParamCount; i < BRTSDopplerAdapterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BRTSRangeAdapterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, BRTSRangeAdapterParamCount,
+               BRTSDopplerAdapterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return BRTSRangeAdapter::GetParameterID(str);
 }
 
@@ -170,11 +170,12 @@ std::string DSNRangeAdapter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer DSNRangeAdapter::GetParameterID(const std::string& str) const
 {
-   for (Integer i = RangeAdapterKmParamCount; i < DSNRangeAdapterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - RangeAdapterKmParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, RangeAdapterKmParamCount,
+               DSNRangeAdapterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return RangeAdapterKm::GetParameterID(str);
 }
 
@@ -855,6 +856,11 @@ Real DSNRangeAdapter::GetFrequencyFactor(Real frequency)
 /**
  * Calculate the integration of frequency factor in range from time t0 to time t1
  *
+ * With a ramp table the frequency factor is linear in the frequency for the
+ * band in use, so its integral is the factor applied to the integral of the
+ * ramped frequency, which TrackingDataAdapter takes from the ramp table's
+ * cumulative phases.
+ *
  * @param t1         The end time for integration (unit: A1Mjd)
  * @param delta_t    Elapse time (unit: second)
  * @param err        Error number
@@ -865,126 +871,8 @@ Real DSNRangeAdapter::GetFrequencyFactor(Real frequency)
 //------------------------------------------------------------------------------
 Real DSNRangeAdapter::IntegralRampedFrequency(GmatTime t1, Real delta_t, Integer& err)
 {
-   // Verify ramp table and elpase time
-   err = 0;
-   if (delta_t < 0)
-   {
-      err = 1;
-      errMsg = "Error: Elapse time has to be a non negative number\n";
-      throw MeasurementException("Error: Elapse time has to be a non negative number\n");
-   }
-
-   if (rampTB == NULL)
-   {
-      err = 2;
-      errMsg = "Error: No ramp table available for measurement calculation\n";
-      throw MeasurementException("Error: No ramp table available for measurement calculation\n");
-   }
-
-   if ((*rampTB).size() == 0)
-   {
-      err = 3;
-      std::stringstream ss;
-      ss << "Error: Ramp table has no data records. It needs at least 1 record.\n";
-      errMsg = ss.str();
-      throw MeasurementException(ss.str());
-   }
-
-   // Get the beginning index and the ending index for frequency data records for this measurement model 
-   BeginEndIndexesOfRampTable(err);
-
-   //Real t0 = t1 - delta_t / GmatTimeConstants::SECS_PER_DAY;
-   GmatTime t0 = t1;
-   t0.SubtractSeconds(delta_t);
-
-   GmatTime time_min = (*rampTB)[beginIndex].epochGT;
-
-   if (t1 < time_min)
-   {
-      // Convert t1 and time_min from A1Mjd to TAIMjd
-      GmatTime t1TAI, tminTAI;
-      std::string tais;
-      GmatTime a1Time = t1;
-      theTimeConverter->Convert("A1ModJulian", a1Time, "", "TAIModJulian", t1TAI, tais);
-      a1Time = time_min;
-      theTimeConverter->Convert("A1ModJulian", a1Time, "", "TAIModJulian", tminTAI, tais);
-
-      // Generate error message
-      char s[200];
-      sprintf(&s[0], "Error: End epoch t3R = %s is out of range [%s, +Inf) of ramp table\n", t1TAI.ToString().c_str(), tminTAI.ToString().c_str());
-      std::string st(&s[0]);
-      err = 4;
-      errMsg = st;
-      throw MeasurementException(st);
-   }
-
-   if (t0 < time_min)
-   {
-      // Convert t0 and time_min from A1Mjd to TAIMjd
-      GmatTime t0TAI, tminTAI;
-      std::string tais;
-      GmatTime a1Time = t0;
-      theTimeConverter->Convert("A1ModJulian", a1Time, "", "TAIModJulian", t0TAI, tais);
-      a1Time = time_min;
-      theTimeConverter->Convert("A1ModJulian", a1Time, "", "TAIModJulian", tminTAI, tais);
-
-      // Generate error message
-      char s[200];
-      sprintf(&s[0], "Error: Start epoch t1T = %s is out of range [%s, +Inf) of ramp table\n", t0TAI.ToString().c_str(), tminTAI.ToString().c_str());
-      std::string st(&s[0]);
-      err = 5;
-      errMsg = st;
-      throw MeasurementException(st);
-   }
-
-
-   // Search for end interval:
-   UnsignedInt end_interval = beginIndex;
-   for (UnsignedInt i = beginIndex; i < endIndex; ++i)
-   {
-      if (t1 >= (*rampTB)[i].epochGT)
-         end_interval = i;
-      else
-         break;
-   }
-
-   // Integration of the frequency from t0 to t1:
-   Real f0, f1, f_dot;
-   Real value1;
-   Real interval_len;
-
-   Real basedFreq = (*rampTB)[end_interval].rampFrequency;
-   Real basedFreqFactor = GetFrequencyFactor(basedFreq);
-   Real value = 0.0;
-   Real dt = delta_t;
-   for (Integer i = end_interval; dt > 0; --i)
-   {
-      // Specify frequency at the begining and lenght of the current interval   
-      if (i == end_interval)
-         interval_len = (t1 - (*rampTB)[i].epochGT).GetTimeInSec();                         // unit:sec
-      else
-         interval_len = ((*rampTB)[i + 1].epochGT - (*rampTB)[i].epochGT).GetTimeInSec();   // unit: sec
-
-      f0 = (*rampTB)[i].rampFrequency;                              // unit: Hz
-      f_dot = (*rampTB)[i].rampRate;                                // unit: Hz/second
-      if (dt < interval_len)
-      {
-         f0 = (*rampTB)[i].rampFrequency + f_dot*(interval_len - dt);
-         interval_len = dt;
-      }
-
-      // Specify frequency at the end of the current interval
-      f1 = f0 + f_dot*interval_len;
-
-      // Take integral for the current interval
-      value1 = ((GetFrequencyFactor(f0) + GetFrequencyFactor(f1)) / 2 - basedFreqFactor) * interval_len;
-      value = value + value1;
-
-      // Specify dt 
-      dt = dt - interval_len;
-   }
-   value = value + basedFreqFactor*delta_t;
+   Real value = TrackingDataAdapter::IntegralRampedFrequency(t1, delta_t, err);
 
-   return value;
+   return GetFrequencyFactor(value);
 }
 
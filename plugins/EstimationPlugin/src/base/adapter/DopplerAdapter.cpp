@@ -234,11 +234,12 @@ std::string DopplerAdapter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer DopplerAdapter::GetParameterID(const std::string& str) const
 {
-   for (Integer i = RangeAdapterKmParamCount; i < DopplerAdapterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - RangeAdapterKmParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, RangeAdapterKmParamCount,
+               DopplerAdapterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return RangeAdapterKm::GetParameterID(str);
 }
 
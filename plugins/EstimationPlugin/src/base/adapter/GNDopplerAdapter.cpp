@@ -257,11 +257,12 @@ std::string GNDopplerAdapter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer GNDopplerAdapter::GetParameterID(const std::string& str) const
 {
-   for (Integer i = RangeAdapterKmParamCount; i < GNDopplerAdapterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - RangeAdapterKmParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, RangeAdapterKmParamCount,
+               GNDopplerAdapterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    //return RangeAdapterKm::GetParameterID(str);
    return GNRangeAdapter::GetParameterID(str);
 }
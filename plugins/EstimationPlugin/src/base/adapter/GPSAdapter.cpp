@@ -49,7 +49,9 @@ GPSAdapter::GPSAdapter(const std::string& name) :
    TrackingDataAdapter("GPS_PosVec", name),
    ecf  (NULL),
    ej2k (NULL),
-   cv   (NULL)
+   cv   (NULL),
+   gpsReceiver      (NULL),
+   gpsReceiverOwner (NULL)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("GPSAdapter default constructor <%p>\n", this);
@@ -97,7 +99,9 @@ GPSAdapter::GPSAdapter(const GPSAdapter& gps) :
    TrackingDataAdapter      (gps),
    ecf                      (NULL),
    ej2k                     (NULL),
-   cv                       (NULL)
+   cv                       (NULL),
+   gpsReceiver              (NULL),
+   gpsReceiverOwner         (NULL)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("GPSAdapter copy constructor   from <%p> to <%p>\n", &gps, this);
@@ -131,6 +135,8 @@ GPSAdapter& GPSAdapter::operator=(const GPSAdapter& gps)
    ecf  = NULL;
    ej2k = NULL;
    cv   = NULL;
+   gpsReceiver      = NULL;
+   gpsReceiverOwner = NULL;
 
    return *this;
 }
@@ -187,11 +193,12 @@ std::string GPSAdapter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer GPSAdapter::GetParameterID(const std::string& str) const
 {
-   for (Integer i = AdapterParamCount; i < GPSAdapterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - AdapterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, AdapterParamCount,
+               GPSAdapterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return TrackingDataAdapter::GetParameterID(str);
 }
 
@@ -300,6 +307,8 @@ bool GPSAdapter::Initialize()
    if (TrackingDataAdapter::Initialize())
    {
       retval = true;
+      gpsReceiver      = NULL;
+      gpsReceiverOwner = NULL;
 
       if (participantLists.empty())
          throw MeasurementException("Error: No participant is defined in GPS tracking configuration.\n");
@@ -400,8 +409,8 @@ const MeasurementData& GPSAdapter::CalculateMeasurement(bool withEvents,
          pos = pos - fromScOriginToEarth;
       }
       // 2.3. Convert EarthMJ200Eq to EarthFixed coordinate system
-      Rvector instate(6, pos[0], pos[1], pos[2], 0.0, 0.0, 0.0);
-      Rvector outstate(6, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+      Real instate[6] = {pos[0], pos[1], pos[2], 0.0, 0.0, 0.0};
+      Real values[6];
       if (ecf == NULL)
          ecf = CoordinateSystem::CreateLocalCoordinateSystem("ecf", "BodyFixed",
             earthBody, NULL, NULL, earthBody, solarsys);
@@ -410,38 +419,39 @@ const MeasurementData& GPSAdapter::CalculateMeasurement(bool withEvents,
             earthBody, NULL, NULL, earthBody, solarsys);
       if (cv == NULL)
          cv = new CoordinateConverter();
-      cv->Convert(A1Mjd(cMeasurement.epoch), instate, ej2k, outstate, ecf, true, true);
+      cv->Convert(A1Mjd(cMeasurement.epoch), instate, ej2k, values, ecf, true, true);
 
-      RealArray values;
-      for (Integer i = 0; i < 3; ++i)
-         values.push_back(outstate[i]);
 
-
-      // Get GPS Receiver
-      std::string receiverName = gpsReceiverName.substr(gpsReceiverName.find_last_of('.') + 1);
-      std::string scName = gpsReceiverName.substr(0, gpsReceiverName.find_last_of('.'));
-      ObjectArray hwList = data[0]->rNode->GetRefObjectArray(Gmat::HARDWARE);
-      Receiver* gpsReceiver = NULL;
-      for (UnsignedInt i = 0; i < hwList.size(); ++i)
+      // Get GPS Receiver; it is looked up on the first fix for the spacecraft
+      if ((gpsReceiver == NULL) || (gpsReceiverOwner != data[0]->rNode))
       {
-         //if (hwList[i]->IsOfType("GPSReceiver"))
-         if (hwList[i]->IsOfType("Receiver"))
+         std::string receiverName = gpsReceiverName.substr(gpsReceiverName.find_last_of('.') + 1);
+         std::string scName = gpsReceiverName.substr(0, gpsReceiverName.find_last_of('.'));
+         ObjectArray hwList = data[0]->rNode->GetRefObjectArray(Gmat::HARDWARE);
+         gpsReceiver = NULL;
+         for (UnsignedInt i = 0; i < hwList.size(); ++i)
          {
-            //if (hwList[i]->GetName() == gpsReceiverName)
-            if (hwList[i]->GetName() == receiverName)
+            //if (hwList[i]->IsOfType("GPSReceiver"))
+            if (hwList[i]->IsOfType("Receiver"))
             {
-               gpsReceiver = (Receiver*)hwList[i];
-               break;
+               //if (hwList[i]->GetName() == gpsReceiverName)
+               if (hwList[i]->GetName() == receiverName)
+               {
+                  gpsReceiver = (Receiver*)hwList[i];
+                  break;
+               }
             }
          }
+         if (gpsReceiver == NULL)
+            throw MeasurementException("Error: No Receiver with name '" + receiverName + "' was defined in script and/or added to spacecraft '" + scName + "' to perform GPS measurement.\n");
+
+         gpsReceiverOwner = data[0]->rNode;
+         gpsReceiverId = gpsReceiver->GetStringParameter("Id");
       }
-      if (gpsReceiver == NULL)
-         throw MeasurementException("Error: No Receiver with name '" + receiverName + "' was defined in script and/or added to spacecraft '" + scName + "' to perform GPS measurement.\n");
 
       // Store value of Receiver.ID to MeasurementData 
-      std::string theReceiverID = gpsReceiver->GetStringParameter("Id");
       cMeasurement.sensorIDs.clear();
-      cMeasurement.sensorIDs.push_back(theReceiverID);
+      cMeasurement.sensorIDs.push_back(gpsReceiverId);
 
       // Get measurement ErrorModel
       if (measErrorModel == NULL)
@@ -517,11 +527,8 @@ const MeasurementData& GPSAdapter::CalculateMeasurement(bool withEvents,
 
 
       // Set measurement values
-      cMeasurement.value.clear();
-      for (UnsignedInt i = 0; i < values.size(); ++i)
-         cMeasurement.value.push_back(0.0);
-      
-      for (UnsignedInt i = 0; i < values.size(); ++i)
+      cMeasurement.value.resize(3);
+      for (UnsignedInt i = 0; i < 3; ++i)
       {
          Real measVal = values[i];
          
@@ -26,6 +26,8 @@
 #include "CoordinateSystem.hpp"
 #include "CoordinateConverter.hpp"
 
+class Receiver;
+
 
 /**
  * A measurement adapter for position vector in Km
@@ -86,7 +88,7 @@ public:
    Real                 GetTropoCorrection();
 
    
-   bool                 SetGPSReceiverName(const std::string name) { gpsReceiverName = name; return true; };
+   bool                 SetGPSReceiverName(const std::string name) { gpsReceiverName = name; gpsReceiver = NULL; return true; };
    std::string          GetGPSReceiverName() { return gpsReceiverName; };
 
 
@@ -103,6 +105,10 @@ protected:
    CoordinateConverter *cv;
 
    std::string gpsReceiverName;
+   /// The receiver found on the spacecraft for the previous fix, and its Id
+   Receiver    *gpsReceiver;
+   GmatBase    *gpsReceiverOwner;
+   std::string gpsReceiverId;
 
 
 private:
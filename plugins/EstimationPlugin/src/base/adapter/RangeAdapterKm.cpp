@@ -201,11 +201,12 @@ std::string RangeAdapterKm::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer RangeAdapterKm::GetParameterID(const std::string& str) const
 {
-   for (Integer i = AdapterParamCount; i < RangeAdapterKmParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - AdapterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, AdapterParamCount,
+               RangeAdapterKmParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return TrackingDataAdapter::GetParameterID(str);
 }
 
@@ -166,12 +166,12 @@ std::string RangeRateAdapterKps::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer RangeRateAdapterKps::GetParameterID(const std::string& str) const
 {
-   for (Integer i = RangeAdapterKmParamCount; i < RangeRateAdapterParamCount;
-         ++i)
-   {
-      if (str == PARAMETER_TEXT[i - RangeAdapterKmParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, RangeAdapterKmParamCount,
+               RangeRateAdapterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return RangeAdapterKm::GetParameterID(str);
 }
 
@@ -310,11 +310,12 @@ std::string TDRS3LReturnDopplerAdapter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer TDRS3LReturnDopplerAdapter::GetParameterID(const std::string& str) const
 {
-   for (Integer i = RangeAdapterKmParamCount; i < TDRS3LReturnDopplerAdapterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - RangeAdapterKmParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, RangeAdapterKmParamCount,
+               TDRS3LReturnDopplerAdapterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return RangeAdapterKm::GetParameterID(str);
 }
 
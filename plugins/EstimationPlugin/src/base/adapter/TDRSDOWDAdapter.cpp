@@ -310,11 +310,12 @@ std::string TDRSDOWDAdapter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer TDRSDOWDAdapter::GetParameterID(const std::string& str) const
 {
-   for (Integer i = AdapterParamCount; i < TDRSDOWDAdapterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - AdapterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, AdapterParamCount,
+               TDRSDOWDAdapterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return TrackingDataAdapter::GetParameterID(str);
 }
 
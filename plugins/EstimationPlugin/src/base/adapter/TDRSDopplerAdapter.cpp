@@ -282,11 +282,12 @@ std::string TDRSDopplerAdapter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer TDRSDopplerAdapter::GetParameterID(const std::string& str) const
 {
-   for (Integer i = RangeAdapterKmParamCount; i < TDRSDopplerAdapterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - RangeAdapterKmParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, RangeAdapterKmParamCount,
+               TDRSDopplerAdapterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return RangeAdapterKm::GetParameterID(str);
 }
 
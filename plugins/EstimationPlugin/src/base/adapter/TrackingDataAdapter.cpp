@@ -29,6 +29,7 @@
 #include "Spacecraft.hpp"
 #include "Receiver.hpp"
 #include <sstream>
+#include <algorithm>
 
 //#define DEBUG_CONSTRUCTION
 //#define DEBUG_SET_PARAMETER
@@ -112,9 +113,14 @@ TrackingDataAdapter::TrackingDataAdapter(const std::string &typeStr,
    withMediaCorrection  (true),
    errMsg               (""),
    ionosphereCache      (NULL),
+   lightTimeCache       (NULL),
    measParticipantIndex (-1),
    measErrorModel       (NULL),
-   biasType             (BIASTYPE_IS_UNDEFINED)
+   biasType             (BIASTYPE_IS_UNDEFINED),
+   biasSource           (NULL),
+   biasParameterId      (-1),
+   noiseSigmaParameterId(-1),
+   errorSourcesResolved (false)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("TrackingDataAdapter default constructor <%p>\n", this);
@@ -233,9 +239,14 @@ TrackingDataAdapter::TrackingDataAdapter(const TrackingDataAdapter& ma) :
    withMediaCorrection  (ma.withMediaCorrection),
    errMsg               (ma.errMsg),
    ionosphereCache      (NULL),
+   lightTimeCache       (NULL),
    measParticipantIndex (ma.measParticipantIndex),
    measErrorModel       (NULL),
-   biasType             (BIASTYPE_IS_UNDEFINED)
+   biasType             (BIASTYPE_IS_UNDEFINED),
+   biasSource           (NULL),
+   biasParameterId      (-1),
+   noiseSigmaParameterId(-1),
+   errorSourcesResolved (false)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("TrackingDataAdapter copy constructor  from <%p> to <%p>\n", &ma, this);
@@ -298,6 +309,7 @@ TrackingDataAdapter& TrackingDataAdapter::operator=(
       
       measErrorModel     = ma.measErrorModel;
       biasType           = ma.biasType;
+      errorSourcesResolved = false;
 
       // We require that these be set after a copy
       thePropagators     = NULL;
@@ -316,6 +328,7 @@ TrackingDataAdapter& TrackingDataAdapter::operator=(
    }
 
    ionosphereCache = NULL;
+   lightTimeCache = NULL;
 
    return *this;
 }
@@ -368,11 +381,12 @@ std::string TrackingDataAdapter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer TrackingDataAdapter::GetParameterID(const std::string& str) const
 {
-   for (Integer i = MeasurementModelBaseParamCount; i < AdapterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - MeasurementModelBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, MeasurementModelBaseParamCount,
+               AdapterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return MeasurementModelBase::GetParameterID(str);
 }
 
@@ -1373,8 +1387,10 @@ bool TrackingDataAdapter::Initialize()
       calcData->UsesLightTime(withLighttime);
 
       retval = calcData->Initialize();
+      errorSourcesResolved = false;
 
       calcData->UseIonosphereCache(ionosphereCache);
+      calcData->UseLightTimeCache(lightTimeCache);
 
       if (useHorp)
       {
@@ -1789,6 +1805,80 @@ ErrorModel* TrackingDataAdapter::GetMeasurementErrorModel(Integer measIndex, con
 }
 
 
+//------------------------------------------------------------------------------
+// void ResolveErrorSources(const std::string &biasName,
+//       const std::string &noiseSigmaName, const std::string &measType,
+//       Integer numTrip)
+//------------------------------------------------------------------------------
+/**
+* Resolves the objects and parameter IDs used for the bias and noise sigma
+*
+* The error model of a measurement, and the solve-for object that carries its
+* bias during estimation, do not change over a run.  They are found here once,
+* after initialization or a change of the solve-for objects, so that the bias
+* and noise sigma of each computed measurement are direct lookups rather than
+* searches by name.  The error model of the first signal path is used for
+* every path, as in earlier builds.
+*
+* @param biasName           Name of the bias parameter, "Bias"
+* @param noiseSigmaName     Name of the noise sigma parameter, "NoiseSigma"
+* @param measType           Measurement type of this tracking data
+* @param numTrip            Number of ways signal travel such as 1-way, 2-ways,
+*                           or 3-ways
+*/
+//------------------------------------------------------------------------------
+void TrackingDataAdapter::ResolveErrorSources(const std::string &biasName,
+      const std::string &noiseSigmaName, const std::string &measType,
+      Integer numTrip)
+{
+   if (measErrorModel == NULL)
+      measErrorModel = GetMeasurementErrorModel(0, measType, numTrip);
+
+   // During estimation the bias is read from the solve-for object with the
+   // error model's name; otherwise it is a consider parameter read from the
+   // error model itself
+   biasSource = measErrorModel;
+   std::string modelName = measErrorModel->GetFullName();
+   for (UnsignedInt j = 0; j < forObjects.size(); ++j)
+   {
+      if (forObjects[j]->GetFullName() == modelName)
+      {
+         biasSource = forObjects[j];
+         break;
+      }
+   }
+
+   if ((forObjects.size() > 0) && (biasType == BIASTYPE_IS_UNDEFINED))
+   {
+      biasType = BIASTYPE_IS_NONE;
+      StringArray solvefors = measErrorModel->GetStringArrayParameter("SolveFors");
+      for (UnsignedInt i = 0; i < solvefors.size(); ++i)
+      {
+         if (solvefors[i] == "Bias")
+         {
+            biasType = BIASTYPE_IS_BIAS;
+            break;
+         }
+         if (solvefors[i] == "PassBiases")
+         {
+            biasType = BIASTYPE_IS_PASSBIAS;
+            break;
+         }
+      }
+   }
+
+   biasParameterId = biasSource->GetParameterID(biasName);
+   noiseSigmaParameterId = measErrorModel->GetParameterID(noiseSigmaName);
+   errorSourcesResolved = true;
+
+   #ifdef DEBUG_ERROR_SOURCES
+      MessageInterface::ShowMessage("TrackingDataAdapter <%p> '%s': bias of "
+            "type %d read from <%p> '%s'\n", this, instanceName.c_str(),
+            biasType, biasSource, biasSource->GetFullName().c_str());
+   #endif
+}
+
+
 //------------------------------------------------------------------------------
 // void ComputeMeasurementBias(const std::string biasName, 
 //                             const std::string measType, Integer numTrip)
@@ -1821,57 +1911,12 @@ void TrackingDataAdapter::ComputeMeasurementBias(const std::string biasName, con
       return;
    }
 
-	for (UnsignedInt i = 0; i < measurementSize; ++i)
-	{
-      if (measErrorModel == NULL)
-         measErrorModel = GetMeasurementErrorModel(i, measType, numTrip);
+   if (!errorSourcesResolved)
+      ResolveErrorSources(biasName, "NoiseSigma", measType, numTrip);
 
-      Real bias = 0.0;
-      if (forObjects.size() > 0)
-      {
-         // This is case for running estimation: solve-for objects are stored in forObjects array
-         // Search for object with the same name with errmodels[k]
-         UnsignedInt j;
-         for (j = 0; j < forObjects.size(); ++j)
-         {
-            if (forObjects[j]->GetFullName() == measErrorModel->GetFullName())
-               break;
-         }
-
-         // Get Bias from that error model
-         if (j >= forObjects.size())
-            bias = measErrorModel->GetRealParameter(biasName);        // bias is a consider parameter
-         else
-            bias = forObjects[j]->GetRealParameter(biasName);         // bias is a solve-for parameter
-
-         if (biasType == BIASTYPE_IS_UNDEFINED)
-         {
-            biasType = BIASTYPE_IS_NONE;
-            StringArray solvefors = measErrorModel->GetStringArrayParameter("SolveFors");
-            for (Integer i = 0; i < solvefors.size(); ++i)
-            {
-               if (solvefors[i] == "Bias")
-               {
-                  biasType = BIASTYPE_IS_BIAS;
-                  break;
-               }
-               if (solvefors[i] == "PassBiases")
-               {
-                  biasType = BIASTYPE_IS_PASSBIAS;
-                  break;
-               }
-            }
-         }
-      }
-      else
-      {
-         // This is case for running simulation. no solve-for objects are stored in forObjects
-         // For this case, bias value is gotten from GroundStation.ErrorModels parameter
-         bias = measErrorModel->GetRealParameter(biasName);           // bias is consider parameter
-      }
-
-      measurementBias.push_back(bias);
-   }
+   // All signal paths read the same error model, so the bias is read once
+   Real bias = biasSource->GetRealParameter(biasParameterId);
+   measurementBias.assign(measurementSize, bias);
 
    // Clean up memory
    data.clear();
@@ -1909,14 +1954,11 @@ void TrackingDataAdapter::ComputeMeasurementNoiseSigma(const std::string noiseSi
       return;
    }
 
-   for (UnsignedInt i = 0; i < measurementSize; ++i)
-   {
-      if (measErrorModel == NULL)
-         measErrorModel = GetMeasurementErrorModel(i, measType, numTrip);
+   if (!errorSourcesResolved)
+      ResolveErrorSources("Bias", noiseSigmaName, measType, numTrip);
 
-      Real noise = measErrorModel->GetRealParameter(noiseSigmaName);
-		noiseSigma.push_back(noise);
-   }
+   Real noise = measErrorModel->GetRealParameter(noiseSigmaParameterId);
+   noiseSigma.assign(measurementSize, noise);
 
    // Clean up memory
    data.clear();
@@ -2016,20 +2058,21 @@ void TrackingDataAdapter::BeginEndIndexesOfRampTable(Integer & err)
       throw MeasurementException("Error: Ramp table has no data record.\n");
    }
 
-   beginIndex = 0;
-   for(; beginIndex < (*rampTB).size(); ++beginIndex)
+   // The table is sorted by index key, so the records starting with the
+   // search key are the ones from searchkey up to the key that follows its
+   // trailing blank
+   std::string endkey = searchkey;
+   endkey[endkey.size() - 1] = ' ' + 1;
+   auto keyLess = [](const RampTableData &record, const std::string &key)
    {
-      if (searchkey == (*rampTB)[beginIndex].indexkey.substr(0,searchkey.size()))
-         break;
-   }
+      return record.indexkey < key;
+   };
+   beginIndex = (UnsignedInt)(std::lower_bound(rampTB->begin(), rampTB->end(),
+         searchkey, keyLess) - rampTB->begin());
 
    // 3. Search for the ending index
-   endIndex = beginIndex; 
-   for(; endIndex < (*rampTB).size(); ++endIndex)
-   {
-      if (searchkey != (*rampTB)[endIndex].indexkey.substr(0,searchkey.size()))
-         break;
-   }
+   endIndex = (UnsignedInt)(std::lower_bound(rampTB->begin() + beginIndex,
+         rampTB->end(), endkey, keyLess) - rampTB->begin());
 
    // 4. Verify number of data records
    if ((endIndex - beginIndex) == 0)
@@ -2043,6 +2086,33 @@ void TrackingDataAdapter::BeginEndIndexesOfRampTable(Integer & err)
 }
 
 
+//----------------------------------------------------------------------------------
+// UnsignedInt FindRampInterval(const GmatTime &epoch) const
+//----------------------------------------------------------------------------------
+/**
+* Finds the ramp table record in effect at an epoch, among the records set by
+* BeginEndIndexesOfRampTable().
+*
+* @param epoch    The epoch (unit: A1Mjd)
+*
+* @return The index of the last record at or before the epoch, or beginIndex
+*         if the epoch precedes all of them
+*/
+//----------------------------------------------------------------------------------
+UnsignedInt TrackingDataAdapter::FindRampInterval(const GmatTime &epoch) const
+{
+   std::vector<RampTableData>::const_iterator after = std::upper_bound(
+         rampTB->begin() + beginIndex, rampTB->begin() + endIndex, epoch,
+         [](const GmatTime &t, const RampTableData &record)
+         {
+            return t < record.epochGT;
+         });
+
+   UnsignedInt index = (UnsignedInt)(after - rampTB->begin());
+   return (index > beginIndex ? index - 1 : beginIndex);
+}
+
+
 //------------------------------------------------------------------------------
 // Real RampedFrequencyIntergration(Real t0, Real delta_t, Integer& err)
 //------------------------------------------------------------------------------
@@ -2292,15 +2362,9 @@ Real TrackingDataAdapter::IntegralRampedFrequency(GmatTime t1, Real delta_t, Int
    MessageInterface::ShowMessage(" elapse time   = %.15lf s\n", delta_t);
 #endif
 
-   // Search for start index of the interval containing t1
-   UnsignedInt end_interval = beginIndex;
-   for (UnsignedInt i = beginIndex; i < endIndex; ++i)
-   {
-      if (t1 >= (*rampTB)[i].epochGT)
-         end_interval = i;
-      else
-         break;
-   }
+   // Search for start index of the intervals containing t1 and t0
+   UnsignedInt end_interval = FindRampInterval(t1);
+   UnsignedInt start_interval = FindRampInterval(t0);
 
    Real basedFreq = (*rampTB)[end_interval].rampFrequency;
 
@@ -2310,45 +2374,25 @@ Real TrackingDataAdapter::IntegralRampedFrequency(GmatTime t1, Real delta_t, Int
    MessageInterface::ShowMessage(" Based frequency = %.15le\n", basedFreq);
 #endif
 
-   // Integration of the frequency from t0 to t1:
-   Real f0, f1, f_dot;
-   Real value1;
-   Real interval_len;
-
-   Real value = 0.0;
-   Real dt = delta_t;
-   for (Integer i = end_interval; dt > 0.0; --i)
-   {
-      // Specify lenght of the "current" interval, f0, and f_dot
-      if (i == end_interval)
-         interval_len = (t1 - (*rampTB)[i].epochGT).GetTimeInSec();
-      else
-         interval_len = ((*rampTB)[i + 1].epochGT - (*rampTB)[i].epochGT).GetTimeInSec();
-
-      f0 = (*rampTB)[i].rampFrequency;
-      f_dot = (*rampTB)[i].rampRate;
-      if (dt < interval_len)
-      {
-         f0 = f0 + f_dot*(interval_len - dt);
-         interval_len = dt;
-      }
-
-      // Specify f1
-      f1 = f0 + f_dot*interval_len;
-
-      // Take integral for the current interval
-      value1 = ((f0 + f1) / 2 - basedFreq) * interval_len;
-      value = value + value1;
+   // Integration of the frequency from t0 to t1, relative to basedFreq: the
+   // cumulative phases (relative to the frequency of the first record) at
+   // the starts of the two intervals, plus the phases into the intervals
+   const RampTableData &r0 = (*rampTB)[start_interval];
+   const RampTableData &r1 = (*rampTB)[end_interval];
+   Real refFreq = (*rampTB)[beginIndex].rampFrequency;
+   Real dt0 = (t0 - r0.epochGT).GetTimeInSec();
+   Real dt1 = (t1 - r1.epochGT).GetTimeInSec();
+
+   Real value = (r1.cumulativePhase - r0.cumulativePhase) +
+         (r1.cumulativePhaseError - r0.cumulativePhaseError);
+   value += (r1.rampFrequency - refFreq + 0.5 * r1.rampRate * dt1) * dt1 -
+         (r0.rampFrequency - refFreq + 0.5 * r0.rampRate * dt0) * dt0;
+   value += (refFreq - basedFreq) * delta_t;
 
 #ifdef DEBUG_INTEGRAL_RAMPED_FREQUENCY
-      MessageInterface::ShowMessage("interval i = %d:    value1 = %.12lf    f0 = %.12lf   f1 = %.12lf     f_ave = %.12lfHz   width = %.12lfs \n", i, value1, f0, f1, (f0 + f1) / 2, interval_len);
-      MessageInterface::ShowMessage("interval i = %d: epoch = %s     band = %d    ramp type = %d   ramp freq = %.12le    ramp rate = %.12le\n", i,
-         (*rampTB)[i].epochGT.ToString().c_str(), (*rampTB)[i].uplinkBand, (*rampTB)[i].rampType, (*rampTB)[i].rampFrequency, (*rampTB)[i].rampRate);
+   MessageInterface::ShowMessage(" Intervals: i = %d to %d    cumulative phases = %.12lf and %.12lf\n", start_interval, end_interval, r0.cumulativePhase, r1.cumulativePhase);
 #endif
 
-      // Specify dt 
-      dt = dt - interval_len;
-   }
    Real rel_val = value;
    value = value + basedFreq*delta_t;
 
@@ -2409,6 +2453,23 @@ void TrackingDataAdapter::SetIonosphereCache(SignalDataCache::SimpleSignalDataCa
    ionosphereCache = cache;
 }
 
+//------------------------------------------------------------------------------
+// void SetLightTimeCache(SignalDataCache::LightTimeCache * cache)
+//------------------------------------------------------------------------------
+/**
+ * Sets a reference to the light time cache that will be passed in to the
+ * measure model, so that light time solutions of a signal leg can seed the
+ * solutions of the same leg made for this and the other adapters
+ *
+ * @param cache the light time cache started by the tracking file set
+ *
+ */
+ //------------------------------------------------------------------------------
+void TrackingDataAdapter::SetLightTimeCache(SignalDataCache::LightTimeCache * cache)
+{
+   lightTimeCache = cache;
+}
+
 //------------------------------------------------------------------------------
 // void SetupHorp(Real height, Real angle, bool useOblateness)
 //------------------------------------------------------------------------------
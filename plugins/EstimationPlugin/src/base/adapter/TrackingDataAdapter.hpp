@@ -198,7 +198,7 @@ public:
    virtual void         SetRangeOnly(bool isRangeOnly) {rangeOnly = isRangeOnly;}
    
    // Set solve-for and consider objects
-   virtual bool         SetUsedForObjects(ObjectArray objArray) {forObjects = objArray; return true;};
+   virtual bool         SetUsedForObjects(ObjectArray objArray) {forObjects = objArray; errorSourcesResolved = false; return true;};
 
    virtual StringArray  GetParticipants(Integer forPathIndex);
 
@@ -209,12 +209,17 @@ public:
    StringArray          GetMeasurementDimension() { return dimNames;};
 
    void                 SetIonosphereCache(SignalDataCache::SimpleSignalDataCache *cache);
+   void                 SetLightTimeCache(SignalDataCache::LightTimeCache *cache);
 
    void                 SetupHorp(Real height, Real angle, bool useOblateness = false, bool force = false);
 
    ErrorModel*          GetMeasurementErrorModel(Integer measIndex, const std::string measType, Integer numTrip);
 
 protected:
+   void                 ResolveErrorSources(const std::string &biasName,
+                              const std::string &noiseSigmaName,
+                              const std::string &measType, Integer numTrip);
+
    /// Measurement dimension
    StringArray               dimNames;
    /// The ordered list of participants in the measurement
@@ -319,6 +324,8 @@ protected:
 
    ///  Ionosphere cache
    SignalDataCache::SimpleSignalDataCache *ionosphereCache;
+   ///  Light time cache
+   SignalDataCache::LightTimeCache *lightTimeCache;
 
    /// Index of measuring participant. 
    /// Example: TDRS 3L Return Doppler's tracking config has participants {userSC, TDRS, GS2, GS1}.
@@ -346,6 +353,16 @@ protected:
    ///        BIASTYPE_IS_PASSBIAS:       pass bias is in the list of solve-for variables 
    Integer                   biasType;
 
+   /// Object the bias is read from: the solve-for object matching
+   /// measErrorModel when estimating, otherwise measErrorModel itself
+   GmatBase*                 biasSource;
+   /// Parameter ID of the bias on biasSource
+   Integer                   biasParameterId;
+   /// Parameter ID of the noise sigma on measErrorModel
+   Integer                   noiseSigmaParameterId;
+   /// Flag indicating that biasSource and the parameter IDs are resolved
+   bool                      errorSourcesResolved;
+
 
    /// Parameter IDs for the TrackingDataAdapter
    enum
@@ -375,6 +392,7 @@ protected:
    void                 ComputeMeasurementErrorCovarianceMatrix();
 
    void                 BeginEndIndexesOfRampTable(Integer & err);
+   UnsignedInt          FindRampInterval(const GmatTime &epoch) const;
    virtual Real         IntegralRampedFrequency(GmatTime t1, Real delta_t, Integer& err);
 };
 
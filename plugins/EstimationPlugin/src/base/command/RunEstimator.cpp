@@ -64,7 +64,11 @@ RunEstimator::RunEstimator(const std::string &typeStr) :
    bufferFilled            (false),
    currentEvent            (NULL),
    eventProcessComplete    (false),
-   eventMan                (NULL)
+   eventMan                (NULL),
+   groupActive             (false),
+   groupingDisabled        (false),
+   groupSpan               (0.0),
+   groupOffset             (0.0)
 {
    needToResetSTM		= true;
    overridePropInit		= true;
@@ -121,7 +125,11 @@ RunEstimator::RunEstimator(const RunEstimator & rs) :
    bufferFilled            (false),
    currentEvent            (NULL),
    eventProcessComplete    (false),
-   eventMan                (NULL)
+   eventMan                (NULL),
+   groupActive             (false),
+   groupingDisabled        (false),
+   groupSpan               (0.0),
+   groupOffset             (0.0)
 {
    overridePropInit     = true;
    
@@ -169,6 +177,8 @@ RunEstimator& RunEstimator::operator=(const RunEstimator & rs)
       bufferFilled         = false;
       currentEvent         = NULL;
       eventProcessComplete = false;
+      groupActive          = false;
+      groupingDisabled     = false;
 	  solveMode		       = rs.solveMode;
 
       if (eventMan)
@@ -1628,6 +1638,9 @@ void RunEstimator::PrepareToEstimate()
             "Entered RunEstimator::PrepareToEstimate()\n");
    #endif
 
+   groupActive = false;
+   groupingDisabled = false;
+
    if (!propPrepared)
    {
       // The code to register publised data should be to near the code to
@@ -1842,6 +1855,18 @@ void RunEstimator::Propagate()
    // reload the prop vector
    if (theEstimator->ResetState())
    {
+      // A reset inside a group continues from the observation's epoch
+      if (groupActive)
+      {
+         for (UnsignedInt i = 0; i < fm.size(); ++i)
+         {
+            fm[i]->SetTime(groupStartTimes[i] + groupOffset);
+            if (i < elapsedTime.size())
+               elapsedTime[i] = groupStartTimes[i] + groupOffset;
+         }
+         groupActive = false;
+      }
+
       #ifdef DEBUG_STATE_RESETS
          MessageInterface::ShowMessage("Calling UpdateFromSpaceObject()\n");
          Real* oldState = fm[0]->GetState();
@@ -1879,6 +1904,7 @@ void RunEstimator::Propagate()
    // reload prop vector and reset the epoch information
    if (startNewPass == true)
    {
+      groupActive = false;
       for (UnsignedInt i = 0; i < fm.size(); ++i)
       {
          if (fm[i])
@@ -1935,10 +1961,18 @@ void RunEstimator::Propagate()
       MessageInterface::ShowMessage("\n");
    #endif
 
-   // Ignore ephemeris gaps exceptions for TDRS measurements
-   skipEphemerisProp = true;
-   Step(dt);
-   skipEphemerisProp = false;
+   // Observations inside a grouped step take its dense output; the step
+   // that opens a group ends on the last observation of the group
+   if (groupActive)
+      dt = StepInObservationGroup(dt);
+
+   if ((dt != 0.0) && !StartObservationGroup(dt, maxStep))
+   {
+      // Ignore ephemeris gaps exceptions for TDRS measurements
+      skipEphemerisProp = true;
+      Step(dt);
+      skipEphemerisProp = false;
+   }
 
    bufferFilled = false;
 
@@ -1977,6 +2011,211 @@ void RunEstimator::Propagate()
 }
 
 
+//------------------------------------------------------------------------------
+// bool StartObservationGroup(Real step, Real maxStep)
+//------------------------------------------------------------------------------
+/**
+ * Opens a group of observations served from a single propagation step.
+ *
+ * When the estimator reports a group, the propagators step once to its last
+ * observation.  The step is kept only if every propagator took it as a single
+ * integration step with dense output; the state for the next observation is
+ * then interpolated and the integrated end state is saved for the end of the
+ * group.  Otherwise the propagators are returned to the start of the step.
+ *
+ * The step to the end of the group runs under the integrator's own error
+ * control, so only the observations strictly inside it carry the error of the
+ * cubic Hermite interpolant.  That error grows with the fourth power of the
+ * step, which is why ObservationGroupSpan bounds it.
+ *
+ * @param step    The time to the next observation, in seconds
+ * @param maxStep The largest step the propagators may take
+ *
+ * @return true if the group was opened and the next observation's state set
+ */
+//------------------------------------------------------------------------------
+bool RunEstimator::StartObservationGroup(Real step, Real maxStep)
+{
+   if (groupingDisabled || currEpochGT.empty())
+      return false;
+
+   GmatTime groupEnd;
+   if (!theEstimator->GetObservationGroupEnd(groupEnd))
+      return false;
+
+   UnsignedInt count = fm.size();
+   for (UnsignedInt i = 0; i < count; ++i)
+      if (fm[i] == NULL)
+         return false;
+
+   Real span = (groupEnd - currEpochGT[0]).GetTimeInSec();
+   if ((span * step <= 0.0) ||
+       (GmatMathUtil::Abs(span) <= GmatMathUtil::Abs(step) + ESTTIME_ROUNDOFF) ||
+       (GmatMathUtil::Abs(span) > maxStep))
+      return false;
+
+   // Keep the start of the step, so the group can be abandoned
+   std::vector<RealArray> startStates(count);
+   groupStartTimes.resize(count);
+   groupStartEpoch.resize(count);
+   groupStartEpochGT.resize(count);
+   for (UnsignedInt i = 0; i < count; ++i)
+   {
+      Real *state = fm[i]->GetState();
+      startStates[i].assign(state, state + fm[i]->GetDimension());
+      groupStartTimes[i] = fm[i]->GetTime();
+      groupStartEpoch[i] = currEpoch[i];
+      groupStartEpochGT[i] = currEpochGT[i];
+   }
+
+   // Ignore ephemeris gaps exceptions for TDRS measurements
+   skipEphemerisProp = true;
+   Step(span);
+   skipEphemerisProp = false;
+
+   bool interpolates = true;
+   groupEndStates.resize(count);
+   groupEndEpoch.resize(count);
+   groupEndEpochGT.resize(count);
+   for (UnsignedInt i = 0; (i < count) && interpolates; ++i)
+   {
+      Real *state = fm[i]->GetState();
+      groupEndStates[i].assign(state, state + fm[i]->GetDimension());
+      groupEndEpoch[i] = currEpoch[i];
+      groupEndEpochGT[i] = currEpochGT[i];
+
+      if (GmatMathUtil::Abs(p[i]->GetStepTaken() - span) > ESTTIME_ROUNDOFF)
+         interpolates = false;
+      else if (!p[i]->GetDenseState(step, state))
+      {
+         // The integrator has no dense output
+         interpolates = false;
+         groupingDisabled = true;
+      }
+   }
+
+   if (!interpolates)
+   {
+      #ifdef DEBUG_EXECUTION
+         MessageInterface::ShowMessage("RunEstimator::StartObservationGroup(): "
+               "the %.12lf sec step was not interpolated\n", span);
+      #endif
+
+      for (UnsignedInt i = 0; i < count; ++i)
+      {
+         fm[i]->SetTime(groupStartTimes[i]);
+         if (i < elapsedTime.size())
+            elapsedTime[i] = groupStartTimes[i];
+         SetGroupState(i, &startStates[i][0], groupStartEpoch[i],
+               groupStartEpochGT[i]);
+      }
+      return false;
+   }
+
+   for (UnsignedInt i = 0; i < count; ++i)
+   {
+      GmatTime epochGT = groupStartEpochGT[i];
+      epochGT.AddSeconds(step);
+      SetGroupState(i, fm[i]->GetState(), groupStartEpoch[i] + step /
+            GmatTimeConstants::SECS_PER_DAY, epochGT);
+   }
+
+   groupSpan = span;
+   groupOffset = step;
+   groupActive = true;
+
+   #ifdef DEBUG_EXECUTION
+      MessageInterface::ShowMessage("RunEstimator::StartObservationGroup(): "
+            "opened a %.12lf sec group\n", span);
+   #endif
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real StepInObservationGroup(Real step)
+//------------------------------------------------------------------------------
+/**
+ * Moves to the next observation inside an open group.
+ *
+ * Observations inside the grouped step take the interpolated state.  The
+ * last one takes the integrated end state, which closes the group.
+ *
+ * @param step The time to the next observation, in seconds
+ *
+ * @return The time left to propagate past the end of the group, or 0.0
+ */
+//------------------------------------------------------------------------------
+Real RunEstimator::StepInObservationGroup(Real step)
+{
+   Real target = groupOffset + step;
+   Real direction = (groupSpan > 0.0 ? 1.0 : -1.0);
+   Real beyond = (target - groupSpan) * direction;
+
+   if (beyond > -ESTTIME_ROUNDOFF)
+   {
+      for (UnsignedInt i = 0; i < fm.size(); ++i)
+         SetGroupState(i, &groupEndStates[i][0], groupEndEpoch[i],
+               groupEndEpochGT[i]);
+      groupActive = false;
+
+      return (beyond > ESTTIME_ROUNDOFF ? beyond * direction : 0.0);
+   }
+
+   for (UnsignedInt i = 0; i < fm.size(); ++i)
+   {
+      if (!p[i]->GetDenseState(target, fm[i]->GetState()))
+         throw EstimatorException("Error: The propagator " + p[i]->GetName() +
+               " lost the dense output of a grouped observation step\n");
+
+      GmatTime epochGT = groupStartEpochGT[i];
+      epochGT.AddSeconds(target);
+      SetGroupState(i, fm[i]->GetState(), groupStartEpoch[i] + target /
+            GmatTimeConstants::SECS_PER_DAY, epochGT);
+   }
+   groupOffset = target;
+
+   return 0.0;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetGroupState(Integer index, const Real *state, Real epoch,
+//       const GmatTime &epochGT)
+//------------------------------------------------------------------------------
+/**
+ * Loads a state into a force model and its space objects at an epoch.
+ *
+ * The force model time is not changed, so the propagator continues from the
+ * end of a grouped step.
+ *
+ * @param index   The index of the force model
+ * @param state   The propagation vector
+ * @param epoch   The epoch of the state
+ * @param epochGT The epoch of the state, in full precision
+ */
+//------------------------------------------------------------------------------
+void RunEstimator::SetGroupState(Integer index, const Real *state, Real epoch,
+      const GmatTime &epochGT)
+{
+   Real *modelState = fm[index]->GetState();
+   if (state != modelState)
+      memcpy(modelState, state, fm[index]->GetDimension() * sizeof(Real));
+
+   if (fm[index]->HasPrecisionTime())
+      fm[index]->UpdateSpaceObjectGT(epochGT);
+   else
+      fm[index]->UpdateSpaceObject(epoch);
+
+   if (index < (Integer)currEpoch.size())
+   {
+      currEpoch[index] = epoch;
+      currEpochGT[index] = epochGT;
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // void Calculate()
 //------------------------------------------------------------------------------
@@ -2059,6 +2298,7 @@ void RunEstimator::LocateEvent()
       #endif
       BufferSatelliteStates(true);
       eventMan->ClearObject(NULL);
+      eventMan->ResetEvaluationCount();
 
       #ifdef DEBUG_STATE_BUFFERING
          MessageInterface::ShowMessage("   Buffer has %d objects; contents:\n",
@@ -2190,6 +2430,12 @@ void RunEstimator::LocateEvent()
       {
          eventMan->ClearObject(currentEvent);
          currentEvent = NULL;
+         #ifdef DEBUG_EVENT_LOCATION
+            MessageInterface::ShowMessage("   Events located with %d event "
+                  "function evaluations and %d propagations\n",
+                  eventMan->GetEvaluationCount(),
+                  eventMan->GetPropagationCount());
+         #endif
          #ifdef DEBUG_EVENT_STATE
             Integer dim = fm[0]->GetDimension();
             Real *odeState = fm[0]->GetState();
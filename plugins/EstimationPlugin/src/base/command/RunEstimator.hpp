@@ -118,6 +118,25 @@ protected:
    /// Time different used while running the event code
    Real dt;
 
+   /// Flag indicating that observations are served from a dense output step
+   bool groupActive;
+   /// Flag set when a propagator cannot interpolate, turning grouping off
+   bool groupingDisabled;
+   /// Span of the grouped step, in seconds
+   Real groupSpan;
+   /// Time from the start of the grouped step to the current epoch
+   Real groupOffset;
+   /// Force model times at the start of the grouped step
+   RealArray groupStartTimes;
+   /// Epochs at the start of the grouped step, one per propagator
+   RealArray groupStartEpoch;
+   std::vector<GmatTime> groupStartEpochGT;
+   /// Epochs at the end of the grouped step
+   RealArray groupEndEpoch;
+   std::vector<GmatTime> groupEndEpochGT;
+   /// Propagation vectors at the end of the grouped step
+   std::vector<RealArray> groupEndStates;
+
    //Solve mode state when command is used
    std::string solveMode;
 
@@ -145,6 +164,11 @@ protected:
 
    virtual void UpdateCov();
 
+   bool StartObservationGroup(Real step, Real maxStep);
+   Real StepInObservationGroup(Real step);
+   void SetGroupState(Integer index, const Real *state, Real epoch,
+                      const GmatTime &epochGT);
+
 private:
    bool delayInitialization;
 
@@ -571,78 +571,90 @@ bool RunSimulator::Execute()
    #ifdef DEBUG_SIMULATOR_EXECUTION
       MessageInterface::ShowMessage("\nSimulator state is %d\n", state);
    #endif
-   switch (state)
+   // A simulation worker process must not fall back into the mission
+   // sequence, so it reports its errors and exits here
+   try
    {
-      case Solver::INITIALIZING:
+      switch (state)
       {
-         #ifdef DEBUG_SIMULATOR_EXECUTION
-            MessageInterface::ShowMessage("RunSimulator::Execute(): INITIALIZING state\n");
-         #endif
-         PrepareToSimulate();
+         case Solver::INITIALIZING:
          {
-            // Register to publishing data
-            covStartIndex = 0;
-            expandedDim = PrepareElementInfoToPublish(pubdataOwners, pubdataElements, covStartIndex);
-            publisher->UnregisterPublishedData(this);
-            streamID = publisher->RegisterPublishedData(this, streamID, pubdataOwners, pubdataElements);
-            pubdataSize = expandedDim;
-            if (pubdata)
+            #ifdef DEBUG_SIMULATOR_EXECUTION
+               MessageInterface::ShowMessage("RunSimulator::Execute(): INITIALIZING state\n");
+            #endif
+            PrepareToSimulate();
             {
-               delete[] pubdata;
-               //pubdataSize = 0;        // It resets size to 0. This cause incorrect size. 
+               // Register to publishing data
+               covStartIndex = 0;
+               expandedDim = PrepareElementInfoToPublish(pubdataOwners, pubdataElements, covStartIndex);
+               publisher->UnregisterPublishedData(this);
+               streamID = publisher->RegisterPublishedData(this, streamID, pubdataOwners, pubdataElements);
+               pubdataSize = expandedDim;
+               if (pubdata)
+               {
+                  delete[] pubdata;
+                  //pubdataSize = 0;        // It resets size to 0. This cause incorrect size. 
+               }
+               pubdata = new Real[pubdataSize];
+
+               // Publish data
+               PublishState();
             }
-            pubdata = new Real[pubdataSize];
+            break;
+         }
+         case Solver::PROPAGATING:
+            #ifdef DEBUG_SIMULATOR_EXECUTION
+               MessageInterface::ShowMessage("RunSimulator::Execute(): PROPAGATING state\n");
+            #endif
+            Propagate();
+            break;
+
+         case Solver::CALCULATING:
+            #ifdef DEBUG_SIMULATOR_EXECUTION
+               MessageInterface::ShowMessage("RunSimulator::Execute(): CALCULATING state\n");
+            #endif
+            Calculate();
+            break;
+
+         case Solver::LOCATING:
+            #ifdef DEBUG_SIMULATOR_EXECUTION
+               MessageInterface::ShowMessage("RunSimulator::Execute(): LOCATING state\n");
+            #endif
+            LocateEvent();
+            break;
+
+         case Solver::SIMULATING:
+         {
+            #ifdef DEBUG_SIMULATOR_EXECUTION
+               MessageInterface::ShowMessage("RunSimulator::Execute(): SIMULATING state\n");
+            #endif
+            Simulate();
 
             // Publish data
             PublishState();
+            break;
          }
-         break;
-      }
-      case Solver::PROPAGATING:
-         #ifdef DEBUG_SIMULATOR_EXECUTION
-            MessageInterface::ShowMessage("RunSimulator::Execute(): PROPAGATING state\n");
-         #endif
-         Propagate();
-         break;
-
-      case Solver::CALCULATING:
-         #ifdef DEBUG_SIMULATOR_EXECUTION
-            MessageInterface::ShowMessage("RunSimulator::Execute(): CALCULATING state\n");
-         #endif
-         Calculate();
-         break;
-
-      case Solver::LOCATING:
-         #ifdef DEBUG_SIMULATOR_EXECUTION
-            MessageInterface::ShowMessage("RunSimulator::Execute(): LOCATING state\n");
-         #endif
-         LocateEvent();
-         break;
-
-      case Solver::SIMULATING:
-      {
-         #ifdef DEBUG_SIMULATOR_EXECUTION
-            MessageInterface::ShowMessage("RunSimulator::Execute(): SIMULATING state\n");
-         #endif
-         Simulate();
-
-         // Publish data
-         PublishState();
-         break;
+         case Solver::FINISHED:
+            #ifdef DEBUG_SIMULATOR_EXECUTION
+               MessageInterface::ShowMessage("RunSimulator::Execute(): FINSIHED state\n");
+            #endif
+            Finalize();
+            break;
+
+         default:
+            throw CommandException("Unknown state "
+                  " encountered in the RunSimulator command");
       }
-      case Solver::FINISHED:
-         #ifdef DEBUG_SIMULATOR_EXECUTION
-            MessageInterface::ShowMessage("RunSimulator::Execute(): FINSIHED state\n");
-         #endif
-         Finalize();
-         break;
 
-      default:
-         throw CommandException("Unknown state "
-               " encountered in the RunSimulator command");
+      state = theSimulator->AdvanceState();
+   }
+   catch (BaseException &ex)
+   {
+      if (!theSimulator->IsSimulationWorker())
+         throw;
+      MessageInterface::ShowMessage("%s\n", ex.GetFullMessage().c_str());
+      theSimulator->EndWorkerProcess(false);
    }
-
-   state = theSimulator->AdvanceState();
 
    #ifdef DEBUG_SIMULATOR_EXECUTION
       MessageInterface::ShowMessage("Exit RunSimulator::Execute()\n");
@@ -1055,6 +1067,7 @@ void RunSimulator::LocateEvent()
       #endif
       BufferSatelliteStates(true);
       eventMan->ClearObject(NULL);
+      eventMan->ResetEvaluationCount();
 
       #ifdef DEBUG_STATE_BUFFERING
          MessageInterface::ShowMessage("   Buffer has %d objects; contents:\n",
@@ -1178,6 +1191,12 @@ void RunSimulator::LocateEvent()
       {
          eventMan->ClearObject(currentEvent);
          currentEvent = NULL;
+         #ifdef DEBUG_EVENT_LOCATION
+            MessageInterface::ShowMessage("   Events located with %d event "
+                  "function evaluations and %d propagations\n",
+                  eventMan->GetEvaluationCount(),
+                  eventMan->GetPropagationCount());
+         #endif
          #ifdef DEBUG_EVENT_STATE
             Integer dim = fm[0]->GetDimension();
             Real *odeState = fm[0]->GetState();
@@ -1323,6 +1342,10 @@ void RunSimulator::Finalize()
  //------------------------------------------------------------------------------
 void RunSimulator::PublishState()
 {
+   // Worker processes only write measurements
+   if (theSimulator->IsSimulationWorker())
+      return;
+
    // Clear pubdata
    for (Integer idx = 0; idx < pubdataSize; ++idx)
       pubdata[idx] = GmatMathConstants::QUIET_NAN;
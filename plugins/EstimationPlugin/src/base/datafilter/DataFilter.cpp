@@ -80,14 +80,20 @@ const Gmat::ParameterType DataFilter::PARAMETER_TYPE[] =
 //------------------------------------------------------------------------------
 DataFilter::DataFilter(const std::string &ofType, const std::string name) :
    GmatBase          (Gmat::DATA_FILTER, ofType, name),
-   epochFormat       ("TAIModJulian"),
-   initialEpoch      (DateUtil::EARLIEST_VALID_MJD), 
-   finalEpoch        (DateUtil::LATEST_VALID_MJD),
-   isChecked         (false),
    isDataFileDefaultVal  (true),
    isObserverDefaultVal  (true),
    isTrackerDefaultVal   (true),
    isDataTypeDefaultVal  (true),
+   epochFormat       ("TAIModJulian"),
+   initialEpoch      (DateUtil::EARLIEST_VALID_MJD), 
+   finalEpoch        (DateUtil::LATEST_VALID_MJD),
+   isChecked         (false),
+   isCompiled        (false),
+   acceptAllFiles    (true),
+   acceptAllObservers(true),
+   acceptAllTrackers (true),
+   acceptAllDataTypes(true),
+   isWindowUnbounded (true),
    isEpochFormatSet  (false)
 {
 #ifdef DEBUG_CONSTRUCTION
@@ -165,6 +171,12 @@ DataFilter::DataFilter(const DataFilter& saf) :
    strands               (saf.strands),
    //dataTypesMap          (saf.dataTypesMap),
    isChecked             (false),
+   isCompiled            (false),
+   acceptAllFiles        (true),
+   acceptAllObservers    (true),
+   acceptAllTrackers     (true),
+   acceptAllDataTypes    (true),
+   isWindowUnbounded     (true),
    isEpochFormatSet      (saf.isEpochFormatSet)
 {
 #ifdef DEBUG_CONSTRUCTION
@@ -213,6 +225,7 @@ DataFilter& DataFilter::operator=(const DataFilter& saf)
       strands      = saf.strands;
       //dataTypesMap = saf.dataTypesMap;
       isChecked    = false;
+      isCompiled   = false;
       isEpochFormatSet = saf.isEpochFormatSet;
    }
 
@@ -259,6 +272,8 @@ bool DataFilter::Initialize()
       throw MeasurementException(ss.str());
    }
 
+   CompileFilter();
+
 #ifdef DEBUG_INITIALIZATION
    MessageInterface::ShowMessage("DataFilter<%s,%p>::Initialize()   exit\n", GetName().c_str(), this);
 #endif
@@ -468,6 +483,8 @@ bool DataFilter::SetStringParameter(const Integer id, const std::string &value)
 #ifdef DEBUG_SET_PARAMETER
    MessageInterface::ShowMessage("DataFilter<%s,%p>::SetStringParameter(id = %d, value = <%s>) enter1\n", GetName().c_str(), this, id, value.c_str());
 #endif
+   isCompiled = false;
+
    if (id == FILENAMES)
    {
       if (isDataFileDefaultVal)
@@ -795,6 +812,7 @@ bool DataFilter::SetStringParameter(const Integer id, const std::string &value,
 #ifdef DEBUG_SET_PARAMETER
    MessageInterface::ShowMessage("DataFilter<%s,%p>::SetStringParameter(id = %d, value = <%s>, index = %d) enter2\n", GetName().c_str(), this, id, value.c_str(), index);
 #endif
+   isCompiled = false;
 
    if (id == FILENAMES)
    {
@@ -1097,6 +1115,7 @@ bool DataFilter::RenameRefObject(const UnsignedInt type,
       const std::string & oldName, const std::string & newName)
 {
    /// @todo Estimator rename code needs to be implemented
+   isCompiled = false;
    return GmatBase::RenameRefObject(type, oldName, newName);
 }
 
@@ -1298,6 +1317,7 @@ bool DataFilter::SetRefObject(GmatBase *obj, const UnsignedInt type,
       MessageInterface::ShowMessage("Setting ref object %s with type %s  %d\n",
             name.c_str(), obj->GetTypeName().c_str(), type);
    #endif
+      isCompiled = false;
       bool isTracker = false;
       bool isObserver = false;
 
@@ -1671,119 +1691,159 @@ ObservationData* DataFilter::FilteringData(ObservationData* dataObject, Integer&
 }
 
 
+//------------------------------------------------------------------------------
+// void CompileFilter()
+//------------------------------------------------------------------------------
+/**
+ * Builds the predicate tables used by the Has* checks
+ *
+ * The "All" entries are resolved into flags, and the Ids of the observer and
+ * tracker objects and the data type names are placed in hashed sets, so each
+ * check costs a lookup for each participant of a record rather than a scan of
+ * every list with a parameter access for each entry.  The tables are rebuilt
+ * on the next check after any setting or reference object changes.
+ */
+//------------------------------------------------------------------------------
+void DataFilter::CompileFilter()
+{
+   acceptAllFiles = (find(fileNames.begin(), fileNames.end(), "All") !=
+         fileNames.end());
+   acceptAllObservers = (find(observers.begin(), observers.end(), "All") !=
+         observers.end());
+   acceptAllTrackers = (find(trackers.begin(), trackers.end(), "All") !=
+         trackers.end());
+   acceptAllDataTypes = (find(dataTypes.begin(), dataTypes.end(), "All") !=
+         dataTypes.end());
+
+   observerIds.clear();
+   for (UnsignedInt i = 0; i < observerObjects.size(); ++i)
+      observerIds.insert(observerObjects[i]->GetStringParameter("Id"));
+
+   trackerIds.clear();
+   for (UnsignedInt i = 0; i < trackerObjects.size(); ++i)
+      trackerIds.insert(trackerObjects[i]->GetStringParameter("Id"));
+
+   dataTypeSet.clear();
+   dataTypeSet.insert(dataTypes.begin(), dataTypes.end());
+
+   fileMatches.clear();
+
+   // A window at the defaults holds every epoch a data file can provide, so
+   // the time system conversion is skipped for it
+   isWindowUnbounded =
+         (epochStart <= ConvertToRealEpoch(DateUtil::EARLIEST_VALID_MJD,
+                                           "TAIModJulian")) &&
+         (epochEnd   >= ConvertToRealEpoch(DateUtil::LATEST_VALID_MJD,
+                                           "TAIModJulian"));
+
+   #ifdef DEBUG_FILTER
+      MessageInterface::ShowMessage("DataFilter<%s,%p>::CompileFilter(): %d "
+            "observer Ids, %d tracker Ids, %d data types, unbounded window = "
+            "%s\n", GetName().c_str(), this, observerIds.size(),
+            trackerIds.size(), dataTypeSet.size(),
+            (isWindowUnbounded ? "true" : "false"));
+   #endif
+
+   isCompiled = true;
+}
+
+
 bool DataFilter::HasFile(ObservationData* dataObject)
 {
+   if (!isCompiled)
+      CompileFilter();
+
+   if (fileNames.empty())
+      return false;
+   if (acceptAllFiles)
+      return true;
+
+   // The file name is looked up once for each data file
+   DataFile* df = dataObject->fileIndex;
+   std::map<DataFile*, bool>::iterator match = fileMatches.find(df);
+   if (match != fileMatches.end())
+      return match->second;
+
    bool has = false;
-   if (!fileNames.empty())
+   if (df != NULL)
    {
-      if (find(fileNames.begin(), fileNames.end(), "All") == fileNames.end())
-      {
-         DataFile* df = dataObject->fileIndex;
-         std::string fname = df->GetStringParameter("Filename");
-         for (Integer i = 0; i < fileNames.size(); ++i)
-         {
-            if (fname == fileNames[i])
-            {
-               // When it found a DataFile object with a pointer matching to file index in observation data, it set true to "has" variable
-               has = true;
-               break;
-            }
-         }
-      }
-      else
-         has = true;
+      std::string fname = df->GetStringParameter("Filename");
+      has = (find(fileNames.begin(), fileNames.end(), fname) !=
+            fileNames.end());
    }
-   
+   fileMatches[df] = has;
+
    return has;
 }
 
 
 bool DataFilter::HasObserver(ObservationData* dataObject)
 {
-   bool has = false;
-   if (!observers.empty())
-   {
-      if (find(observers.begin(), observers.end(), "All") == observers.end())
-      {
-         for(UnsignedInt i = 0; i < observerObjects.size(); ++i)
-         {
-            for(UnsignedInt j = 1; j < dataObject->participantIDs.size(); ++j)
-            {
-               if (observerObjects[i]->GetStringParameter("Id") == dataObject->participantIDs[j])
-               {
-                  // When it found a spacecraft matching to a observer list in DataFilter object, it set true to "has" variable
-                  has = true;
-                  break;
-               }
-            }
+   if (!isCompiled)
+      CompileFilter();
 
-            if (has)
-               break;
-         }
-      }
-      else
-         has = true;
+   if (observers.empty())
+      return false;
+   if (acceptAllObservers)
+      return true;
+
+   // When a spacecraft in the record matches the observer list, it is found
+   for (UnsignedInt j = 1; j < dataObject->participantIDs.size(); ++j)
+   {
+      if (observerIds.find(dataObject->participantIDs[j]) != observerIds.end())
+         return true;
    }
 
-   return has;
+   return false;
 }
 
 
 bool DataFilter::HasTracker(ObservationData* dataObject)
 {
-   bool has = false;
-   if (!trackers.empty())
-   {
-      if (find(trackers.begin(), trackers.end(), "All") == trackers.end())
-      {
-         for(UnsignedInt i = 0; i < trackerObjects.size(); ++i)
-         {
-            if ((trackerObjects[i]->GetStringParameter("Id") == dataObject->participantIDs[0])||
-                (trackerObjects[i]->GetStringParameter("Id") == dataObject->participantIDs[dataObject->participantIDs.size()-1]))
-            {
-               has = true;
-               break;
-            }
-         }
-      }
-      else
-         has = true;
-   }
+   if (!isCompiled)
+      CompileFilter();
 
-   return has;
+   if (trackers.empty())
+      return false;
+   if (acceptAllTrackers)
+      return true;
+
+   const StringArray &ids = dataObject->participantIDs;
+   if (ids.empty())
+      return false;
+
+   return (trackerIds.find(ids[0]) != trackerIds.end()) ||
+          (trackerIds.find(ids[ids.size()-1]) != trackerIds.end());
 }
 
 
 bool DataFilter::HasDataType(ObservationData* dataObject)
 {
-   bool has = false;
-   if (!dataTypes.empty())
-   {
-      if (find(dataTypes.begin(), dataTypes.end(), "All") == dataTypes.end())
-      {
-         for(UnsignedInt i = 0; i < dataTypes.size(); ++i)
-         {
-            //if (dataTypesMap[dataTypes[i]] == dataObject->typeName)
-            if (dataTypes[i] == dataObject->typeName)
-            {
-               has = true;
-               break;
-            }
-         }
-      }
-      else
-         has = true;
-   }
+   if (!isCompiled)
+      CompileFilter();
 
-   return has;
+   if (dataTypes.empty())
+      return false;
+   if (acceptAllDataTypes)
+      return true;
+
+   return (dataTypeSet.find(dataObject->typeName) != dataTypeSet.end());
 }
 
 
 bool DataFilter::IsInTimeWindow(ObservationData* dataObject)
 {
+   if (!isCompiled)
+      CompileFilter();
+
+   if (isWindowUnbounded)
+      return true;
+
    bool isIn = true;
    
-   GmatEpoch currentEpoch = TimeSystemConverter::Instance()->Convert(dataObject->epoch, dataObject->epochSystem, TimeSystemConverter::A1MJD);
+   GmatEpoch currentEpoch = dataObject->epoch;
+   if (dataObject->epochSystem != TimeSystemConverter::A1MJD)
+      currentEpoch = TimeSystemConverter::Instance()->Convert(dataObject->epoch, dataObject->epochSystem, TimeSystemConverter::A1MJD);
    Real epsilon = 1.0e-12;
    if (((currentEpoch - epochStart)/currentEpoch < - epsilon) || ((currentEpoch - epochEnd)/currentEpoch  > epsilon))
       isIn = false;
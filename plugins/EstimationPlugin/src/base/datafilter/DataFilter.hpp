@@ -27,6 +27,8 @@
 #include "estimation_defs.hpp"
 #include "GmatBase.hpp"
 #include "ObservationData.hpp"
+#include <unordered_set>
+#include <map>
 
 //class GMAT_API DataFilter : public GmatBase
 class ESTIMATION_API DataFilter : public GmatBase
@@ -142,6 +144,23 @@ protected:
    /// Flag indicate that ValidateInput() function was run
    bool isChecked;
 
+   /// Flag indicating that the predicate tables below match the settings
+   bool isCompiled;
+   /// Flags set when a list contains "All"
+   bool acceptAllFiles;
+   bool acceptAllObservers;
+   bool acceptAllTrackers;
+   bool acceptAllDataTypes;
+   /// Ids of the observer and tracker objects
+   std::unordered_set<std::string> observerIds;
+   std::unordered_set<std::string> trackerIds;
+   /// Data type names
+   std::unordered_set<std::string> dataTypeSet;
+   /// File name matches, keyed by the DataFile holding an observation
+   std::map<DataFile*, bool> fileMatches;
+   /// Flag indicating that the time window spans every valid epoch
+   bool isWindowUnbounded;
+
    //std::map<std::string, std::string> dataTypesMap;
 
    /// Class parameter ID enumeration
@@ -188,6 +207,8 @@ protected:
    bool     HasDataType(ObservationData* dataObject);
    /// Check observation data containing measurement epoch in time window
    bool     IsInTimeWindow(ObservationData* dataObject);
+   /// Build the predicate tables used by the Has* checks
+   void     CompileFilter();
 
 private:
    Real    ConvertToRealEpoch(const std::string &theEpoch,
@@ -493,11 +493,12 @@ std::string ErrorModel::GetUnit(const std::string type) const
 //------------------------------------------------------------------------------
 Integer ErrorModel::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < ErrorModelParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               ErrorModelParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatBase::GetParameterID(str);
 }
@@ -33,11 +33,12 @@
 #include "MessageInterface.hpp"
 #include "EstimatorException.hpp"
 #include <sstream>
+#include <algorithm>
 #include "StringUtil.hpp"
 #include "DataWriter.hpp"
 #include "SchurFactorization.hpp"
-#include "CholeskyFactorization.hpp"
 #include "UtilityException.hpp"
+#include "EventSearch.hpp"
 
 //#define DEBUG_ACCUMULATION
 //#define DEBUG_ACCUMULATION_RESULTS
@@ -64,6 +65,10 @@ BatchEstimator::PARAMETER_TEXT[] =
    "UseInnerLoopEditing",
    "ILSEMultiplicativeConstant",
    "ILSEMaximumIterations",
+   "LinearizedIterationThreshold",
+   "ObservationGroupSpan",
+   "ResidualThreads",
+   "UseMultiArcSolution",
 };
 
 const Gmat::ParameterType
@@ -76,6 +81,10 @@ BatchEstimator::PARAMETER_TYPE[] =
    Gmat::BOOLEAN_TYPE,
    Gmat::REAL_TYPE,
    Gmat::INTEGER_TYPE,
+   Gmat::REAL_TYPE,
+   Gmat::REAL_TYPE,
+   Gmat::INTEGER_TYPE,
+   Gmat::BOOLEAN_TYPE,
 };
 
 
@@ -98,7 +107,16 @@ BatchEstimator::BatchEstimator(const std::string &name):
    constMultIL              (3.0),
    maxIterationsIL          (15),
    iterationsTakenIL        (0),
-   estimationStatusIL       (IL_UNKNOWN)
+   estimationStatusIL       (IL_UNKNOWN),
+   linearizedThreshold      (0.0),
+   linearizedIteration      (false),
+   validationPass           (false),
+   linearizationFailed      (false),
+   observationGroupSpan     (0.0),
+   residualThreads          (0),
+   useMultiArc              (false),
+   arcCouplingReported      (false),
+   blockRowCount            (0)
 {
    objectTypes.push_back(GmatType::GetTypeId("BatchEstimator"));
    objectTypeNames.push_back("BatchEstimator");
@@ -137,7 +155,16 @@ BatchEstimator::BatchEstimator(const BatchEstimator& est) :
    constMultIL              (est.constMultIL),
    maxIterationsIL          (est.maxIterationsIL),
    iterationsTakenIL        (est.iterationsTakenIL),
-   estimationStatusIL       (est.estimationStatusIL)
+   estimationStatusIL       (est.estimationStatusIL),
+   linearizedThreshold      (est.linearizedThreshold),
+   linearizedIteration      (false),
+   validationPass           (false),
+   linearizationFailed      (false),
+   observationGroupSpan     (est.observationGroupSpan),
+   residualThreads          (est.residualThreads),
+   useMultiArc              (est.useMultiArc),
+   arcCouplingReported      (false),
+   blockRowCount            (0)
 {
 
 }
@@ -169,6 +196,22 @@ BatchEstimator& BatchEstimator::operator=(const BatchEstimator& est)
       maxIterationsIL    = est.maxIterationsIL;
       iterationsTakenIL  = est.iterationsTakenIL;
       estimationStatusIL = est.estimationStatusIL;
+
+      linearizedThreshold = est.linearizedThreshold;
+      linearizedIteration = false;
+      validationPass      = false;
+      linearizationFailed = false;
+
+      observationGroupSpan = est.observationGroupSpan;
+      residualThreads      = est.residualThreads;
+      useMultiArc          = est.useMultiArc;
+      arcCouplingReported  = false;
+
+      blockPartials.clear();
+      blockWeights.clear();
+      blockResiduals.clear();
+      blockRowCount      = 0;
+      blockInformation.SetSize(0);
    }
 
    return *this;
@@ -253,11 +296,12 @@ std::string BatchEstimator::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer BatchEstimator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = BatchEstimatorBaseParamCount; i < BatchEstimatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BatchEstimatorBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, BatchEstimatorBaseParamCount,
+               BatchEstimatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return BatchEstimatorBase::GetParameterID(str);
 }
@@ -322,6 +366,10 @@ Real BatchEstimator::GetRealParameter(const Integer id) const
       return additiveConst;
    if (id == CONSTANT_MULTIPLIER_ILSE)
       return constMultIL;
+   if (id == LINEARIZED_ITERATION_THRESHOLD)
+      return linearizedThreshold;
+   if (id == OBSERVATION_GROUP_SPAN)
+      return observationGroupSpan;
 
    return BatchEstimatorBase::GetRealParameter(id);
 }
@@ -376,6 +424,25 @@ Real BatchEstimator::SetRealParameter(const Integer id, const Real value)
       return constMultIL;
    }
 
+   if (id == LINEARIZED_ITERATION_THRESHOLD)
+   {
+      if (value >= 0.0)
+         linearizedThreshold = value;
+      else
+         throw EstimatorException("Error: "+ GetName() +"."+ GetParameterText(id) +" parameter is a negative number\n");
+
+      return linearizedThreshold;
+   }
+
+   if (id == OBSERVATION_GROUP_SPAN)
+   {
+      if (value >= 0.0)
+         observationGroupSpan = value;
+      else
+         throw EstimatorException("Error: "+ GetName() +"."+ GetParameterText(id) +" parameter is a negative number\n");
+
+      return observationGroupSpan;
+   }
 
    return BatchEstimatorBase::SetRealParameter(id, value);
 }
@@ -432,6 +499,9 @@ Integer BatchEstimator::GetIntegerParameter(const Integer id) const
    if (id == MAX_ITERATIONS_ILSE)
       return maxIterationsIL;
 
+   if (id == RESIDUAL_THREADS)
+      return residualThreads;
+
    return BatchEstimatorBase::GetIntegerParameter(id);
 }
 
@@ -460,6 +530,18 @@ Integer BatchEstimator::SetIntegerParameter(const Integer id, const Integer valu
             " is not an allowed value. The allowed value is: [Integer > 0].");
       return maxIterationsIL;
    }
+
+   if (id == RESIDUAL_THREADS)
+   {
+      if (value >= 0)
+         residualThreads = value;
+      else
+         throw SolverException(
+            "The value entered for the residual threads on " + instanceName +
+            " is not an allowed value. The allowed value is: [Integer >= 0].");
+      return residualThreads;
+   }
+
    return BatchEstimatorBase::SetIntegerParameter(id, value);
 }
 
@@ -516,6 +598,8 @@ bool BatchEstimator::GetBooleanParameter(const Integer id) const
       return chooseRMSP;
    if (id == ENABLE_ILSE)
       return useInnerLoop;
+   if (id == USE_MULTI_ARC_SOLUTION)
+      return useMultiArc;
 
    return BatchEstimatorBase::GetBooleanParameter(id);
 }
@@ -547,6 +631,12 @@ bool BatchEstimator::SetBooleanParameter(const Integer id, const bool value)
       return true;
    }
 
+   if (id == USE_MULTI_ARC_SOLUTION)
+   {
+      useMultiArc = value;
+      return true;
+   }
+
    return BatchEstimatorBase::SetBooleanParameter(id, value);
 }
 
@@ -571,6 +661,17 @@ void BatchEstimator::CompleteInitialization()
 
    iterationsTakenIL  = 0;
    estimationStatusIL = IL_UNKNOWN;
+
+   linearizedIteration = false;
+   validationPass      = false;
+   linearizationFailed = false;
+   arcCouplingReported = false;
+
+   blockPartials.assign(ACCUMULATION_BLOCK_SIZE * stateSize, 0.0);
+   blockWeights.assign(ACCUMULATION_BLOCK_SIZE, 0.0);
+   blockResiduals.assign(ACCUMULATION_BLOCK_SIZE, 0.0);
+   blockRowCount = 0;
+   blockInformation.SetSize(0);
 }
 
 
@@ -635,6 +736,21 @@ void BatchEstimator::WriteReportFileHeaderPart6()
       ss.str(""); ss << GetIntegerParameter("FreezeIteration"); sa1.push_back("Freeze Editing on Iteration"); sa2.push_back(ss.str());
    }
 
+   if (linearizedThreshold > 0.0)
+   {
+      ss.str(""); ss << linearizedThreshold; sa1.push_back("Linearized Iteration Threshold"); sa2.push_back(ss.str());
+   }
+
+   if (observationGroupSpan > 0.0)
+   {
+      ss.str(""); ss << observationGroupSpan; sa1.push_back("Observation Group Span (sec)"); sa2.push_back(ss.str());
+   }
+
+   if (useMultiArc)
+   {
+      sa1.push_back("Multi-Arc Solution"); sa2.push_back("Yes");
+   }
+
 
    // 3. Write the 3rd column
    GmatTime taiMjdEpoch, utcMjdEpoch;
@@ -673,6 +789,12 @@ void BatchEstimator::WriteReportFileHeaderPart6()
    }
    if (freezeEditing)
       sa3.push_back("");
+   if (linearizedThreshold > 0.0)
+      sa3.push_back("");
+   if (observationGroupSpan > 0.0)
+      sa3.push_back("");
+   if (useMultiArc)
+      sa3.push_back("");
 
    // 4. Write to text file
    Integer nameLen = 0;
@@ -896,7 +1018,7 @@ void BatchEstimator::Accumulate()
 
       #endif
 
-      std::vector<RealArray> hMeas = measStat.hAccum;
+      const std::vector<RealArray> &hMeas = measStat.hAccum;
 
       for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
       {
@@ -907,20 +1029,17 @@ void BatchEstimator::Accumulate()
          // data which is selected for estimation calculation
          if (measStat.editFlag == NORMAL_FLAG)
          {
-            for (UnsignedInt i = 0; i < stateSize; ++i)
-            {
-               for (UnsignedInt j = 0; j < stateSize; ++j)
-                  information(i, j) += hMeas[k][i] * hMeas[k][j] * weight;   // the first term in open-close square bracket of equation 8-57 in GTDS MathSpec
-                                                                              // this is actually hMeas[k][i] * weight * hMeas[k][j],
-                                                                              // but rearranged for numerical precision reasons
-                                                                              // to preserve the symmetry of the information matrix
+            // The information matrix update is deferred to a block of rows;
+            // see AccumulateInformationBlock()
+            BufferPartials(hMeas[k], weight, ocDiff);
 
+            for (UnsignedInt i = 0; i < stateSize; ++i)
                residuals[i] += hMeas[k][i] * weight * ocDiff;               // the first term in open-close parenthesis of equation 8-57 in GTDS MathSpec
-            }
          }
       }
 
       #ifdef DEBUG_ACCUMULATION_RESULTS
+         FoldBlockInformation();
          MessageInterface::ShowMessage("Observed measurement value:\n");
          for (UnsignedInt k = 0; k < measManager.GetObsDataObject()->value.size(); ++k)
             MessageInterface::ShowMessage("   %.12lf", measManager.GetObsDataObject()->value[k]);
@@ -1008,6 +1127,100 @@ void BatchEstimator::Accumulate()
 
 
 
+//------------------------------------------------------------------------------
+// void BufferPartials(const RealArray &hRow, Real weight, Real ocDiff)
+//------------------------------------------------------------------------------
+/**
+ * Stores one row of measurement partials for the information matrix update.
+ *
+ * The rows are added to the information matrix when the block is full, and
+ * when estimation starts.
+ *
+ * @param hRow    The partials of one measurement value w.r.t. the solve-fors
+ * @param weight  The weight of the measurement value
+ * @param ocDiff  The O - C residual of the measurement value
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::BufferPartials(const RealArray &hRow, Real weight,
+      Real ocDiff)
+{
+   if (blockWeights.size() != ACCUMULATION_BLOCK_SIZE ||
+       blockResiduals.size() != ACCUMULATION_BLOCK_SIZE ||
+       blockPartials.size() != ACCUMULATION_BLOCK_SIZE * stateSize)
+   {
+      blockPartials.assign(ACCUMULATION_BLOCK_SIZE * stateSize, 0.0);
+      blockWeights.assign(ACCUMULATION_BLOCK_SIZE, 0.0);
+      blockResiduals.assign(ACCUMULATION_BLOCK_SIZE, 0.0);
+      blockRowCount = 0;
+   }
+
+   Real *row = &blockPartials[blockRowCount * stateSize];
+   for (UnsignedInt i = 0; i < stateSize; ++i)
+      row[i] = hRow[i];
+   blockWeights[blockRowCount] = weight;
+   blockResiduals[blockRowCount] = ocDiff;
+   ++blockRowCount;
+
+   if (blockRowCount == ACCUMULATION_BLOCK_SIZE)
+      AccumulateInformationBlock();
+}
+
+
+//------------------------------------------------------------------------------
+// void AccumulateInformationBlock()
+//------------------------------------------------------------------------------
+/**
+ * Adds the buffered measurement partials to blockInformation.
+ *
+ * This is a symmetric rank-k update of the packed upper triangle.  Each
+ * element still adds its terms hMeas[k][i] * hMeas[k][j] * weight one
+ * measurement at a time, in measurement order, so the matrix is identical to
+ * the one built by adding each measurement separately; it is just built with
+ * half the work and half the memory traffic.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::AccumulateInformationBlock()
+{
+   if (blockRowCount == 0)
+      return;
+
+   if (blockInformation.GetSize() != (Integer)stateSize)
+      blockInformation.SetSize(stateSize);
+
+   // The first term in open-close square bracket of equation 8-57 in GTDS
+   // MathSpec.  This is actually hMeas[k][i] * weight * hMeas[k][j], but
+   // rearranged for numerical precision reasons to preserve the symmetry of
+   // the information matrix
+   blockInformation.AddRankK(&blockPartials[0], &blockWeights[0],
+         blockRowCount);
+
+   blockRowCount = 0;
+}
+
+
+//------------------------------------------------------------------------------
+// void FoldBlockInformation()
+//------------------------------------------------------------------------------
+/**
+ * Adds the buffered measurement partials to the information matrix.
+ *
+ * The partial block is accumulated, and blockInformation is added to both
+ * triangles of information and cleared.  The information matrix is zero when
+ * the accumulation starts, so it ends up with exactly the packed sums.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::FoldBlockInformation()
+{
+   AccumulateInformationBlock();
+
+   if (blockInformation.GetSize() == (Integer)stateSize)
+   {
+      blockInformation.AddTo(information);
+      blockInformation.Zero();
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // void Estimate()
 //------------------------------------------------------------------------------
@@ -1021,6 +1234,14 @@ void BatchEstimator::Estimate()
       MessageInterface::ShowMessage("BatchEstimator state is ESTIMATING\n");
    #endif
 
+   // A linearized iteration builds the normal equations from the stored
+   // measurement partials
+   if (linearizedIteration)
+      PredictResiduals();
+
+   // Add the measurement partials still waiting in the accumulation block
+   FoldBlockInformation();
+
    // Plot all residuals
    if (showAllResiduals)
       PlotResiduals();
@@ -1109,6 +1330,93 @@ void BatchEstimator::Estimate()
 	   return;
    }
 
+   // Solve normal equation
+   ComputeStateChange();
+
+   IntegerArray normalMatrixIndexesSaved = removedNormalMatrixIndexes;  // save indexes which will be overwritten by InnerLoop()
+
+   // Specify previous, current, and the best weighted RMS:
+   // Calculate RMSOLD:
+   if (iterationsTaken > 0)
+      oldResidualRMS = newResidualRMS;                       // old value is only valid from 1st iteration
+   
+   UnsignedIntArray measurementList;
+   for (UnsignedInt ii = 0; ii < measStats.size(); ii++)
+      if (measStats[ii].editFlag == NORMAL_FLAG)
+         measurementList.push_back(ii);
+
+   newResidualRMS = CalculateWRMS(measurementList);
+   predictedRMS = CalculateWRMS(measurementList, dx);
+   
+   // Check Inner Loop if not yet frozen
+   if (!freezeEditing || (freezeEditing && (iterationsTaken < freezeIteration)))
+      InnerLoop();
+
+   // Calculate RMSB:
+   if (iterationsTaken == 0)
+      bestResidualRMS = newResidualRMS;
+   else
+      bestResidualRMS = GmatMathUtil::Min(bestResidualRMS, newResidualRMS);
+
+   for (UnsignedInt i = 0; i < stateSize; ++i)
+      estimationStateS[i] += dx[i];                                // Equation 8-24 GTSD MathSpec
+   //MessageInterface::ShowMessage("dx = [%.12le  %.12le  %.12le  %.12le  %.12le  %.12le]\n", dx[0], dx[1], dx[2], dx[3], dx[4], dx[5]);
+   //MessageInterface::ShowMessage("estimationStateS = [%.12le  %.12le  %.12le  %.12le  %.12le  %.12le]\n", estimationStateS[0], estimationStateS[1], estimationStateS[2], estimationStateS[3], estimationStateS[4], estimationStateS[5]);
+   
+   // Convert estimation state from Keplerian to Cartesian
+   esm.SetEstimationState(estimationStateS);                       // update the value of EstmationManager's estimation state
+   esm.RestoreObjects(&outerLoopBuffer);                           // Restore solver-object initial state
+   esm.MapVectorToObjects();                                       // update objects state to current state
+
+   removedNormalMatrixIndexes = normalMatrixIndexesSaved;          // restore indexes that were overwritten by InnerLoop()
+   
+   // Convert current estimation state from GMAT internal coordinate system to participants' coordinate system
+   currentSolveForState = esm.GetEstimationStateForReport();
+   currentSolveForStateC = esm.GetEstimationCartesianStateForReport();
+   currentSolveForStateK = esm.GetEstimationKeplerianStateForReport("MA");
+   
+   /// Recalculate all conversion derivative matrixes for the new estimation state
+   // Calculate conversion derivative matrix [dX/dS] from Cartesian to Solve-for state
+   cart2SolvMatrix = esm.CartToSolveForStateConversionDerivativeMatrix();
+   // Calculate conversion derivative matrix [dS/dK] from solve-for state to Keplerian
+   solv2KeplMatrix = esm.SolveForStateToKeplConversionDerivativeMatrix();
+
+   #ifdef DEBUG_VERBOSE
+      MessageInterface::ShowMessage("   State vector change (dx):\n      [");
+      for (UnsignedInt i = 0; i < stateSize; ++i)
+         MessageInterface::ShowMessage("  %.12lf  ", dx[i]);
+      MessageInterface::ShowMessage("]\n");
+
+      MessageInterface::ShowMessage("   New estimation state:\n      "
+            "epoch = %.12lf\n      [", estimationState->GetEpoch());
+      for (UnsignedInt i = 0; i < stateSize; ++i)
+         MessageInterface::ShowMessage("  %.12lf  ", (*estimationState)[i]);
+      MessageInterface::ShowMessage("]\n");
+
+      MessageInterface::ShowMessage("   After solving normal equation, estimationStateS = [\n");
+      for (UnsignedInt i = 0; i < estimationStateS.GetSize(); ++i)
+         MessageInterface::ShowMessage(" %.12lf   ", estimationStateS[i]);
+      MessageInterface::ShowMessage("]\n");
+
+   #endif
+
+   // Write to report initial state for current iteration
+   WriteToTextFile(currentState);
+   
+   currentState = CHECKINGRUN;
+}
+
+
+//------------------------------------------------------------------------------
+// void ComputeStateChange()
+//------------------------------------------------------------------------------
+/**
+ * Adds the a priori information and solves the normal equations for the
+ * state change dx and the covariance informationInverse.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::ComputeStateChange()
+{
    if (useApriori)
    {
       Rmatrix Pdx0_inv;
@@ -1146,8 +1454,6 @@ void BatchEstimator::Estimate()
 
    SolveNormalEquations(information, informationInverse);
 
-   IntegerArray normalMatrixIndexesSaved = removedNormalMatrixIndexes;  // save indexes which will be overwritten by InnerLoop()
-
    #ifdef DEBUG_VERBOSE
       MessageInterface::ShowMessage(" residuals: [");
       for (UnsignedInt i = 0; i < stateSize; ++i)
@@ -1181,76 +1487,224 @@ void BatchEstimator::Estimate()
          delta += informationInverse(i, j) * residuals(j);
       dx.push_back(delta);
    }
+}
 
-   // Specify previous, current, and the best weighted RMS:
-   // Calculate RMSOLD:
-   if (iterationsTaken > 0)
-      oldResidualRMS = newResidualRMS;                       // old value is only valid from 1st iteration
-   
-   UnsignedIntArray measurementList;
-   for (UnsignedInt ii = 0; ii < measStats.size(); ii++)
-      if (measStats[ii].editFlag == NORMAL_FLAG)
-         measurementList.push_back(ii);
 
-   newResidualRMS = CalculateWRMS(measurementList);
-   predictedRMS = CalculateWRMS(measurementList, dx);
-   
-   // Check Inner Loop if not yet frozen
-   if (!freezeEditing || (freezeEditing && (iterationsTaken < freezeIteration)))
-      InnerLoop();
+//------------------------------------------------------------------------------
+// void PredictResiduals()
+//------------------------------------------------------------------------------
+/**
+ * Prepares a linearized iteration from the measurement statistics of the last
+ * iteration.
+ *
+ * The measurement partials are those of the last propagated iteration.  The
+ * residuals are moved by the linearized change for the last state correction
+ * dx, the outer loop sigma editor is applied to the predicted residuals, and
+ * the accepted measurements are accumulated into the normal equations.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::PredictResiduals()
+{
+   MessageInterface::ShowMessage("Iteration %d uses the measurement partials "
+         "of the last propagated iteration\n", iterationsTaken);
 
-   // Calculate RMSB:
-   if (iterationsTaken == 0)
-      bestResidualRMS = newResidualRMS;
-   else
-      bestResidualRMS = GmatMathUtil::Min(bestResidualRMS, newResidualRMS);
+   bool editData = WriteEditFlag();
+   Real sigmaVal = (chooseRMSP ? predictedRMS : newResidualRMS);
 
-   for (UnsignedInt i = 0; i < stateSize; ++i)
-      estimationStateS[i] += dx[i];                                // Equation 8-24 GTSD MathSpec
-   //MessageInterface::ShowMessage("dx = [%.12le  %.12le  %.12le  %.12le  %.12le  %.12le]\n", dx[0], dx[1], dx[2], dx[3], dx[4], dx[5]);
-   //MessageInterface::ShowMessage("estimationStateS = [%.12le  %.12le  %.12le  %.12le  %.12le  %.12le]\n", estimationStateS[0], estimationStateS[1], estimationStateS[2], estimationStateS[3], estimationStateS[4], estimationStateS[5]);
-   
-   // Convert estimation state from Keplerian to Cartesian
-   esm.SetEstimationState(estimationStateS);                       // update the value of EstmationManager's estimation state
-   esm.RestoreObjects(&outerLoopBuffer);                           // Restore solver-object initial state
-   esm.MapVectorToObjects();                                       // update objects state to current state
+   numRemovedRecords["IRMS"] = 0;
+   numRemovedRecords["OLSE"] = 0;
+   numRemovedRecords["ILSE"] = 0;
+   numRemovedRecords["N"]    = 0;
 
-   removedNormalMatrixIndexes = normalMatrixIndexesSaved;          // restore indexes that were overwritten by InnerLoop()
-   
-   // Convert current estimation state from GMAT internal coordinate system to participants' coordinate system
-   currentSolveForState = esm.GetEstimationStateForReport();
-   currentSolveForStateC = esm.GetEstimationCartesianStateForReport();
-   currentSolveForStateK = esm.GetEstimationKeplerianStateForReport("MA");
-   
-   /// Recalculate all conversion derivative matrixes for the new estimation state
-   // Calculate conversion derivative matrix [dX/dS] from Cartesian to Solve-for state
-   cart2SolvMatrix = esm.CartToSolveForStateConversionDerivativeMatrix();
-   // Calculate conversion derivative matrix [dS/dK] from solve-for state to Keplerian
-   solv2KeplMatrix = esm.SolveForStateToKeplConversionDerivativeMatrix();
+   // The residuals are predicted and edited record by record, in chunks that
+   // may run on several threads; each record touches only its own data
+   RunResidualChunks(measStats.size(),
+      [&](UnsignedInt chunk, UnsignedInt begin, UnsignedInt end)
+      {
+         for (UnsignedInt ii = begin; ii < end; ++ii)
+         {
+            MeasurementInfoType &measStat = measStats[ii];
+            if (!measStat.isCalculated)
+               continue;
 
-   #ifdef DEBUG_VERBOSE
-      MessageInterface::ShowMessage("   State vector change (dx):\n      [");
-      for (UnsignedInt i = 0; i < stateSize; ++i)
-         MessageInterface::ShowMessage("  %.12lf  ", dx[i]);
-      MessageInterface::ShowMessage("]\n");
+            for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
+            {
+               Real residualChange = CalculateResidualChange(measStat.hAccum[k], dx);
+               measStat.residual[k]  -= residualChange;
+               measStat.measValue[k] += residualChange;
+            }
 
-      MessageInterface::ShowMessage("   New estimation state:\n      "
-            "epoch = %.12lf\n      [", estimationState->GetEpoch());
+            // Only records edited by the sigma editors are edited again
+            Integer flag = editedRecords[measStat.recNum];
+            if (editData &&
+                ((flag == NORMAL_FLAG) || (flag == IRMS_FLAG) || (flag == OLSE_FLAG)))
+            {
+               ObservationData *obsData = measManager.GetObsDataObject(measStat.recNum);
+               obsData->inUsed = true;
+               obsData->removedReason = "N";
+               flag = NORMAL_FLAG;
+
+               for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
+               {
+                  if (sqrt(measStat.weight[k])*GmatMathUtil::Abs(measStat.residual[k]) > (constMult*sigmaVal + additiveConst))
+                  {
+                     obsData->inUsed = false;
+                     obsData->removedReason = "OLSE";
+                     flag = OLSE_FLAG;
+                     break;
+                  }
+               }
+
+               editedRecords[measStat.recNum] = flag;
+               measStat.removedReason = obsData->removedReason;
+            }
+            measStat.editFlag = flag;
+         }
+      });
+
+   // The accepted records are accumulated in record order
+   for (UnsignedInt ii = 0; ii < measStats.size(); ++ii)
+   {
+      const MeasurementInfoType &measStat = measStats[ii];
+      if (!measStat.isCalculated)
+         continue;
+
+      Integer flag = measStat.editFlag;
+      if (flag == NORMAL_FLAG)
+      {
+         ++numRemovedRecords["N"];
+
+         for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
+         {
+            BufferPartials(measStat.hAccum[k], measStat.weight[k], measStat.residual[k]);
+
+            for (UnsignedInt i = 0; i < stateSize; ++i)
+               residuals[i] += measStat.hAccum[k][i] * measStat.weight[k] * measStat.residual[k];
+         }
+      }
+      else if (flag == OLSE_FLAG)
+         ++numRemovedRecords["OLSE"];
+      else if (flag == IRMS_FLAG)
+         ++numRemovedRecords["IRMS"];
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Integer TestForConvergence(std::string &reason)
+//------------------------------------------------------------------------------
+/**
+ * Applies the BatchEstimatorBase convergence test, and holds back a solution
+ * that converged in a linearized iteration until a propagated iteration
+ * confirms it.
+ *
+ * @param reason  The reason for convergence, if any
+ *
+ * @return The estimation status
+ */
+//------------------------------------------------------------------------------
+Integer BatchEstimator::TestForConvergence(std::string &reason)
+{
+   Integer retval = BatchEstimatorBase::TestForConvergence(reason);
+
+   bool converged = ((retval == ABSOLUTETOL_CONVERGED) ||
+                     (retval == RELATIVETOL_CONVERGED) ||
+                     (retval == ABS_AND_REL_TOL_CONVERGED));
+
+   if (linearizedIteration && converged)
+   {
+      MessageInterface::ShowMessage("The linearized solution converged; the "
+            "next iteration propagates the trajectory to validate it\n");
+      validationPass = true;
+      reason = "";
+      retval = CONVERGING;
+   }
+   else if (validationPass)
+   {
+      validationPass = false;
+      if (!converged)
+      {
+         MessageInterface::ShowMessage("The linearized solution was not "
+               "confirmed; the remaining iterations are propagated\n");
+         linearizationFailed = true;
+      }
+   }
+
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// bool UseLinearizedIteration()
+//------------------------------------------------------------------------------
+/**
+ * Checks if the next iteration can be solved from the stored measurement
+ * partials.
+ *
+ * This is the case when LinearizedIterationThreshold is set and every
+ * component of the last state correction is within that many standard
+ * deviations of the solve-for.  Validation passes, and all iterations after a
+ * validation pass failed, are propagated.
+ *
+ * @return true for a linearized iteration, false to propagate
+ */
+//------------------------------------------------------------------------------
+bool BatchEstimator::UseLinearizedIteration()
+{
+   linearizedIteration = false;
+
+   if ((linearizedThreshold > 0.0) && !validationPass && !linearizationFailed &&
+       (currentMode != INITIAL_GUESS) && (dx.size() == stateSize))
+   {
+      linearizedIteration = true;
       for (UnsignedInt i = 0; i < stateSize; ++i)
-         MessageInterface::ShowMessage("  %.12lf  ", (*estimationState)[i]);
-      MessageInterface::ShowMessage("]\n");
+      {
+         Real variance = informationInverse(i, i);
+         if ((variance <= 0.0) ||
+             (GmatMathUtil::Abs(dx[i]) > linearizedThreshold * sqrt(variance)))
+         {
+            linearizedIteration = false;
+            break;
+         }
+      }
+   }
 
-      MessageInterface::ShowMessage("   After solving normal equation, estimationStateS = [\n");
-      for (UnsignedInt i = 0; i < estimationStateS.GetSize(); ++i)
-         MessageInterface::ShowMessage(" %.12lf   ", estimationStateS[i]);
-      MessageInterface::ShowMessage("]\n");
+   // Measurement lines are not written during accumulation when nothing
+   // is accumulated
+   writeMeasurmentsAtEnd = (useInnerLoop || linearizedIteration);
 
-   #endif
+   return linearizedIteration;
+}
 
-   // Write to report initial state for current iteration
-   WriteToTextFile(currentState);
-   
-   currentState = CHECKINGRUN;
+
+//------------------------------------------------------------------------------
+// bool GetObservationGroupEnd(GmatTime &groupEnd)
+//------------------------------------------------------------------------------
+/**
+ * Finds the end of the group of observations served from one propagation step.
+ *
+ * When ObservationGroupSpan is set, the observations that follow in time
+ * order within that many seconds of the current epoch form a group.  The
+ * propagator steps once to the last of them, and the others take their
+ * states from the dense output of that step.
+ *
+ * @param groupEnd Set to the epoch of the last observation in the group
+ *
+ * @return true if the group holds observations beyond the next one
+ */
+//------------------------------------------------------------------------------
+bool BatchEstimator::GetObservationGroupEnd(GmatTime &groupEnd)
+{
+   if (observationGroupSpan <= 0.0)
+      return false;
+
+   groupEnd = measManager.GetObservationGroupEndGT(currentEpochGT,
+         observationGroupSpan);
+   if (groupEnd == 0.0)
+      return false;
+
+   return (GmatMathUtil::Abs((groupEnd - nextMeasurementEpochGT).GetTimeInSec())
+         > ESTTIME_ROUNDOFF);
 }
 
 
@@ -1312,18 +1766,38 @@ Real BatchEstimator::CalculateWRMS(const UnsignedIntArray &measurementList, cons
       count++;
    }
 
-   for (UnsignedInt ii = 0; ii < measurementList.size(); ii++)
-   {
-      MeasurementInfoType measStat = measStats[measurementList[ii]];
-      count += measStat.residual.size();
+   // The measurement terms are summed in chunks, and the chunk sums are added
+   // in order so the value does not depend on the number of threads
+   UnsignedInt chunkCount = GetResidualChunkCount(measurementList.size());
+   RealArray chunkValues(chunkCount, 0.0);
+   UnsignedIntArray chunkCounts(chunkCount, 0);
 
-      for (UnsignedInt jj = 0; jj < measStat.hAccum.size(); jj++)
+   RunResidualChunks(measurementList.size(),
+      [&](UnsignedInt chunk, UnsignedInt begin, UnsignedInt end)
       {
-         Real residualChange = CalculateResidualChange(measStat.hAccum[jj], dx);
+         Real sum = 0.0;
+         UnsignedInt values = 0;
+         for (UnsignedInt ii = begin; ii < end; ii++)
+         {
+            const MeasurementInfoType &measStat = measStats[measurementList[ii]];
+            values += measStat.residual.size();
 
-         // The first term in equation 8-185 in GTDS MathSpec
-         value += (measStat.residual[jj] - residualChange) * (measStat.residual[jj] - residualChange) * measStat.weight[jj];
-      }
+            for (UnsignedInt jj = 0; jj < measStat.hAccum.size(); jj++)
+            {
+               Real residualChange = CalculateResidualChange(measStat.hAccum[jj], dx);
+
+               // The first term in equation 8-185 in GTDS MathSpec
+               sum += (measStat.residual[jj] - residualChange) * (measStat.residual[jj] - residualChange) * measStat.weight[jj];
+            }
+         }
+         chunkValues[chunk] = sum;
+         chunkCounts[chunk] = values;
+      });
+
+   for (UnsignedInt chunk = 0; chunk < chunkCount; ++chunk)
+   {
+      value += chunkValues[chunk];
+      count += chunkCounts[chunk];
    }
 
    // Thake the root of the mean squares
@@ -1356,6 +1830,66 @@ Real BatchEstimator::CalculateResidualChange(const RealArray &hAccum, const Real
 }
 
 
+//------------------------------------------------------------------------------
+//  UnsignedInt GetResidualChunkCount(UnsignedInt recordCount) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of chunks a list of measurement records is split into.
+ *
+ * @param recordCount  Number of records in the list.
+ *
+ * @return The number of chunks of RESIDUAL_CHUNK_SIZE records, the last one
+ *         possibly shorter.
+ */
+//------------------------------------------------------------------------------
+UnsignedInt BatchEstimator::GetResidualChunkCount(UnsignedInt recordCount) const
+{
+   return (recordCount + RESIDUAL_CHUNK_SIZE - 1) / RESIDUAL_CHUNK_SIZE;
+}
+
+
+//------------------------------------------------------------------------------
+//  void RunResidualChunks(UnsignedInt recordCount,
+//        const std::function<void(UnsignedInt chunk, UnsignedInt begin,
+//        UnsignedInt end)> &work) const
+//------------------------------------------------------------------------------
+/**
+ * Runs work over the chunks of a list of measurement records.
+ *
+ * The chunks are run on ResidualThreads threads when there are several of
+ * them, and on the calling thread otherwise.  The work for a chunk may only
+ * write data owned by that chunk; an exception thrown by it is rethrown here.
+ *
+ * @param recordCount  Number of records in the list.
+ * @param work         The work, called with the chunk index and the range
+ *                     [begin, end) of the records in the chunk.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::RunResidualChunks(UnsignedInt recordCount,
+      const std::function<void(UnsignedInt chunk, UnsignedInt begin,
+      UnsignedInt end)> &work) const
+{
+   UnsignedInt chunkCount = GetResidualChunkCount(recordCount);
+
+   if ((chunkCount < 2) || (residualThreads == 1))
+   {
+      for (UnsignedInt chunk = 0; chunk < chunkCount; ++chunk)
+         work(chunk, chunk * RESIDUAL_CHUNK_SIZE,
+               std::min(recordCount, (chunk + 1) * RESIDUAL_CHUNK_SIZE));
+      return;
+   }
+
+   std::vector<EventSearch::Task> tasks;
+   for (UnsignedInt chunk = 0; chunk < chunkCount; ++chunk)
+   {
+      UnsignedInt begin = chunk * RESIDUAL_CHUNK_SIZE;
+      UnsignedInt end = std::min(recordCount, begin + RESIDUAL_CHUNK_SIZE);
+      tasks.push_back([&work, chunk, begin, end]() { work(chunk, begin, end); });
+   }
+   EventSearch::RunTasks(tasks, residualThreads);
+}
+
+
 //------------------------------------------------------------------------------
 //  void InnerLoop()
 //------------------------------------------------------------------------------
@@ -1440,44 +1974,76 @@ void BatchEstimator::InnerLoop()
             residualsIL[ii] = 0.0;
          }
 
-         // Find change in residuals due to dxIL and determine if it should be edited by IL
-         for (UnsignedInt ii = 0; ii < indexUsedRecordsOL.size(); ii++)
-         {
-            MeasurementInfoType measStat = measStats[indexUsedRecordsOL[ii]];
-            bool removed = false;
+         // Find change in residuals due to dxIL and determine if it should be
+         // edited by IL.  The records are tested in chunks; each chunk keeps
+         // its own lists and information sums, which are combined in order.
+         UnsignedInt chunkCount = GetResidualChunkCount(indexUsedRecordsOL.size());
+         std::vector<UnsignedIntArray> chunkEdited(chunkCount), chunkKept(chunkCount);
+         std::vector<SymmetricMatrix> chunkInformation(chunkCount);
+         std::vector<RealArray> chunkResiduals(chunkCount);
 
-            for (UnsignedInt vIndex = 0; vIndex < measStat.hAccum.size(); vIndex++) // Index for each value
+         RunResidualChunks(indexUsedRecordsOL.size(),
+            [&](UnsignedInt chunk, UnsignedInt begin, UnsignedInt end)
             {
-               Real residualChange = CalculateResidualChange(measStat.hAccum[vIndex], dxIL);
+               SymmetricMatrix &infoSum = chunkInformation[chunk];
+               RealArray &residSum = chunkResiduals[chunk];
 
-               if (sqrt(measStat.weight[vIndex])*GmatMathUtil::Abs(measStat.residual[vIndex] - residualChange) > (constMultIL*sigmaVal))
+               for (UnsignedInt ii = begin; ii < end; ii++)
                {
-                  removed = true;
-                  break;
-               }
-            }
+                  const MeasurementInfoType &measStat = measStats[indexUsedRecordsOL[ii]];
+                  bool removed = false;
 
-            if (removed)
-            {
-               editedRecordsIL.push_back(indexUsedRecordsOL[ii]); // List of IL edited measurements
-
-               // Update IL information
-               for (UnsignedInt vIndex = 0; vIndex < measStat.hAccum.size(); vIndex++)
-               {
-                  for (UnsignedInt i = 0; i < stateSize; ++i)
+                  for (UnsignedInt vIndex = 0; vIndex < measStat.hAccum.size(); vIndex++) // Index for each value
                   {
-                     for (UnsignedInt j = 0; j < stateSize; ++j)
-                        informationIL(i, j) += measStat.hAccum[vIndex][i] * measStat.hAccum[vIndex][j] * measStat.weight[vIndex];
+                     Real residualChange = CalculateResidualChange(measStat.hAccum[vIndex], dxIL);
 
-                     residualsIL[i] += measStat.hAccum[vIndex][i] * measStat.weight[vIndex] * measStat.residual[vIndex];
+                     if (sqrt(measStat.weight[vIndex])*GmatMathUtil::Abs(measStat.residual[vIndex] - residualChange) > (constMultIL*sigmaVal))
+                     {
+                        removed = true;
+                        break;
+                     }
+                  }
+
+                  if (removed)
+                  {
+                     chunkEdited[chunk].push_back(indexUsedRecordsOL[ii]); // List of IL edited measurements
+
+                     if (!infoSum.IsSized())
+                     {
+                        infoSum.SetSize(stateSize);
+                        residSum.assign(stateSize, 0.0);
+                     }
+
+                     // Update IL information
+                     for (UnsignedInt vIndex = 0; vIndex < measStat.hAccum.size(); vIndex++)
+                     {
+                        const RealArray &h = measStat.hAccum[vIndex];
+                        Real weight = measStat.weight[vIndex];
+                        infoSum.AddRankOne(&h[0], weight);
+                        for (UnsignedInt i = 0; i < stateSize; ++i)
+                           residSum[i] += h[i] * weight * measStat.residual[vIndex];
+                     }
+                  }
+                  else
+                  {
+                     // Add to list of kept measurements
+                     chunkKept[chunk].push_back(indexUsedRecordsOL[ii]);
                   }
                }
-            }
-            else
-            {
-               // Add to list of kept measurements
-               indexUsedRecords.push_back(indexUsedRecordsOL[ii]);
-            }
+            });
+
+         for (UnsignedInt chunk = 0; chunk < chunkCount; ++chunk)
+         {
+            editedRecordsIL.insert(editedRecordsIL.end(),
+                  chunkEdited[chunk].begin(), chunkEdited[chunk].end());
+            indexUsedRecords.insert(indexUsedRecords.end(),
+                  chunkKept[chunk].begin(), chunkKept[chunk].end());
+
+            if (!chunkInformation[chunk].IsSized())
+               continue;
+            chunkInformation[chunk].AddTo(informationIL);
+            for (UnsignedInt i = 0; i < stateSize; ++i)
+               residualsIL[i] += chunkResiduals[chunk][i];
          }
 
          MessageInterface::ShowMessage("   The Inner Loop edited %d record(s).\n", editedRecordsIL.size());
@@ -1716,16 +2282,21 @@ void BatchEstimator::SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &cov
 
    reducedCovMatrix.SetSize(iSize - numRemoved, iSize - numRemoved);
 
-   if (inversionType == "Schur")
+   std::vector<UnsignedIntArray> arcs;
+   UnsignedIntArray globals;
+   if (useMultiArc && FindArcs(reducedInfMatrix, auxVector, arcs, globals))
+   {
+      SolveArcNormalEquations(reducedInfMatrix, arcs, globals,
+            reducedCovMatrix);
+   }
+   else if (inversionType == "Schur")
    {
       // first use Cholesky to determine if matrix is invertible - Schur will invert poorly conditioned matrices,
       // whereas Cholesky will throw an exception.  If the matrix is poorly conditioned, we want GMAT to stop, rather
       // than to continue processing and give the user a bad result
-      Rmatrix testMatrix;
-      CholeskyFactorization cf;
-      testMatrix = reducedInfMatrix;
+      SymmetricMatrix testMatrix(reducedInfMatrix);
       try {
-         cf.Invert(testMatrix);
+         testMatrix.Invert();
       }
       catch (BaseException &ex) {
          throw EstimatorException("Cholesky algorithm used for error checking only:  " + ex.GetDetails());
@@ -1740,11 +2311,9 @@ void BatchEstimator::SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &cov
    }
    else if (inversionType == "Cholesky")
    {
-      CholeskyFactorization cf;
-
-      reducedCovMatrix = reducedInfMatrix;
-
-      cf.Invert(reducedCovMatrix);
+      SymmetricMatrix packedInverse(reducedInfMatrix);
+      packedInverse.Invert();
+      packedInverse.GetRmatrix(reducedCovMatrix);
    }
    else
    {
@@ -1806,6 +2375,260 @@ void BatchEstimator::SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &cov
 }
 
 
+//------------------------------------------------------------------------------
+// bool FindArcs(const Rmatrix &infMatrix, const IntegerArray &auxVector,
+//       std::vector<UnsignedIntArray> &arcs, UnsignedIntArray &globals)
+//------------------------------------------------------------------------------
+/**
+ * Splits the solve-for elements into arcs for a multi-arc solution
+ *
+ * The elements that belong to a spacecraft are the local parameters of that
+ * spacecraft's arc; the other elements are global.  The split is used only if
+ * there are at least two arcs and the information has no terms between them.
+ *
+ * @param infMatrix The information matrix, with the zero rows and columns
+ *                  removed
+ * @param auxVector The index data from MatrixFactorization::
+ *                  CompressNormalMatrix()
+ * @param arcs      Indexes in infMatrix of the local parameters of each arc
+ * @param globals   Indexes in infMatrix of the global parameters
+ *
+ * @return true if the arcs are independent, false to solve for the full
+ *         matrix
+ */
+//------------------------------------------------------------------------------
+bool BatchEstimator::FindArcs(const Rmatrix &infMatrix,
+      const IntegerArray &auxVector, std::vector<UnsignedIntArray> &arcs,
+      UnsignedIntArray &globals)
+{
+   const std::vector<ListItem*> *map = esm.GetStateMap();
+   ObjectArray owners;
+
+   arcs.clear();
+   globals.clear();
+   for (UnsignedInt i = 0; i < auxVector.size(); ++i)
+   {
+      // Skip the removed rows and columns
+      if (auxVector[i] < 0)
+         continue;
+      UnsignedInt index = i - auxVector[i];
+
+      GmatBase *owner = (*map)[i]->object;
+      if ((owner == NULL) || !owner->IsOfType(Gmat::SPACECRAFT))
+      {
+         globals.push_back(index);
+         continue;
+      }
+
+      UnsignedInt arc = std::find(owners.begin(), owners.end(), owner) -
+            owners.begin();
+      if (arc == owners.size())
+      {
+         owners.push_back(owner);
+         arcs.push_back(UnsignedIntArray());
+      }
+      arcs[arc].push_back(index);
+   }
+
+   if (arcs.size() < 2)
+      return false;
+
+   for (UnsignedInt a = 0; a < arcs.size(); ++a)
+   {
+      for (UnsignedInt b = a + 1; b < arcs.size(); ++b)
+      {
+         for (UnsignedInt i = 0; i < arcs[a].size(); ++i)
+         {
+            for (UnsignedInt j = 0; j < arcs[b].size(); ++j)
+            {
+               if (infMatrix(arcs[a][i], arcs[b][j]) != 0.0)
+               {
+                  if (!arcCouplingReported)
+                  {
+                     MessageInterface::ShowMessage("Warning: The information "
+                        "matrix couples the solve-for states of %s and %s, so "
+                        "the normal equations are solved as a single arc.\n",
+                        owners[a]->GetName().c_str(),
+                        owners[b]->GetName().c_str());
+                     arcCouplingReported = true;
+                  }
+                  return false;
+               }
+            }
+         }
+      }
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void SolveArcNormalEquations(const Rmatrix &infMatrix,
+//       const std::vector<UnsignedIntArray> &arcs,
+//       const UnsignedIntArray &globals, Rmatrix &covMatrix) const
+//------------------------------------------------------------------------------
+/**
+ * Inverts an information matrix whose arcs are independent
+ *
+ * With A the information of an arc's local parameters and B its terms with
+ * the global parameters, each arc is reduced on its own thread to A^-1,
+ * G = A^-1 B and B' G.  The global covariance is the inverse of the global
+ * information less the reductions, summed in arc order, and the rest of the
+ * covariance follows from it:
+ *
+ *    P(global, global) = (N(global, global) - sum(B' G))^-1
+ *    P(arc, global)    = -G P(global, global)
+ *    P(arc1, arc2)     = G1 P(global, global) G2', plus A^-1 when arc1 = arc2
+ *
+ * @param infMatrix The information matrix
+ * @param arcs      Indexes of the local parameters of each arc
+ * @param globals   Indexes of the global parameters
+ * @param covMatrix The covariance matrix, sized and zeroed by the caller
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::SolveArcNormalEquations(const Rmatrix &infMatrix,
+      const std::vector<UnsignedIntArray> &arcs,
+      const UnsignedIntArray &globals, Rmatrix &covMatrix) const
+{
+   UnsignedInt arcCount = arcs.size();
+   UnsignedInt globalCount = globals.size();
+
+   std::vector<Rmatrix> arcInverse(arcCount), arcGain(arcCount),
+         arcReduction(arcCount);
+
+   // 1. Reduce the local parameters of each arc
+   std::vector<EventSearch::Task> tasks;
+   for (UnsignedInt a = 0; a < arcCount; ++a)
+   {
+      tasks.push_back([&, a]()
+      {
+         const UnsignedIntArray &arc = arcs[a];
+         UnsignedInt localCount = arc.size();
+
+         Rmatrix local(localCount, localCount);
+         for (UnsignedInt i = 0; i < localCount; ++i)
+            for (UnsignedInt j = 0; j < localCount; ++j)
+               local(i, j) = infMatrix(arc[i], arc[j]);
+         InvertNormalBlock(local);
+         arcInverse[a] = local;
+
+         if (globalCount > 0)
+         {
+            Rmatrix coupling(localCount, globalCount);
+            for (UnsignedInt i = 0; i < localCount; ++i)
+               for (UnsignedInt k = 0; k < globalCount; ++k)
+                  coupling(i, k) = infMatrix(arc[i], globals[k]);
+            arcGain[a] = local * coupling;
+            arcReduction[a] = TransposeTimesMatrix(coupling, arcGain[a]);
+         }
+      });
+   }
+   EventSearch::RunTasks(tasks, residualThreads);
+
+   // 2. Covariance of the global parameters
+   Rmatrix globalCov;
+   if (globalCount > 0)
+   {
+      globalCov.SetSize(globalCount, globalCount);
+      for (UnsignedInt i = 0; i < globalCount; ++i)
+         for (UnsignedInt k = 0; k < globalCount; ++k)
+            globalCov(i, k) = infMatrix(globals[i], globals[k]);
+      for (UnsignedInt a = 0; a < arcCount; ++a)
+         globalCov -= arcReduction[a];
+      InvertNormalBlock(globalCov);
+
+      for (UnsignedInt i = 0; i < globalCount; ++i)
+         for (UnsignedInt k = 0; k < globalCount; ++k)
+            covMatrix(globals[i], globals[k]) = globalCov(i, k);
+   }
+
+   // 3. Covariance of the local parameters.  Each task fills its arc's rows
+   //    against the globals and the later arcs, and their transposes, so no
+   //    two tasks write the same element.
+   tasks.clear();
+   for (UnsignedInt a = 0; a < arcCount; ++a)
+   {
+      tasks.push_back([&, a]()
+      {
+         const UnsignedIntArray &arc = arcs[a];
+         UnsignedInt localCount = arc.size();
+
+         if (globalCount == 0)
+         {
+            for (UnsignedInt i = 0; i < localCount; ++i)
+               for (UnsignedInt j = 0; j < localCount; ++j)
+                  covMatrix(arc[i], arc[j]) = arcInverse[a](i, j);
+            return;
+         }
+
+         Rmatrix gainCov = arcGain[a] * globalCov;
+         for (UnsignedInt i = 0; i < localCount; ++i)
+         {
+            for (UnsignedInt k = 0; k < globalCount; ++k)
+            {
+               covMatrix(arc[i], globals[k]) = -gainCov(i, k);
+               covMatrix(globals[k], arc[i]) = -gainCov(i, k);
+            }
+         }
+
+         for (UnsignedInt b = a; b < arcCount; ++b)
+         {
+            Rmatrix cross = MatrixTimesTranspose(gainCov, arcGain[b]);
+            if (b == a)
+               cross += arcInverse[a];
+
+            const UnsignedIntArray &other = arcs[b];
+            for (UnsignedInt i = 0; i < localCount; ++i)
+            {
+               for (UnsignedInt j = 0; j < other.size(); ++j)
+               {
+                  covMatrix(arc[i], other[j]) = cross(i, j);
+                  covMatrix(other[j], arc[i]) = cross(i, j);
+               }
+            }
+         }
+      });
+   }
+   EventSearch::RunTasks(tasks, residualThreads);
+}
+
+
+//------------------------------------------------------------------------------
+// void InvertNormalBlock(Rmatrix &block) const
+//------------------------------------------------------------------------------
+/**
+ * Inverts a block of a multi-arc solution in place
+ *
+ * The internal inversion is used when it is selected; otherwise the block is
+ * inverted by Cholesky decomposition, which also rejects a block that is not
+ * positive definite.
+ *
+ * @param block The symmetric block to invert
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::InvertNormalBlock(Rmatrix &block) const
+{
+   if (inversionType == "Internal")
+   {
+      try
+      {
+         block = block.Inverse();
+      }
+      catch (...)
+      {
+         throw EstimatorException("Error: Normal matrix is singular.\n");
+      }
+   }
+   else
+   {
+      SymmetricMatrix packedBlock(block);
+      packedBlock.Invert();
+      packedBlock.GetRmatrix(block);
+   }
+}
+
+
 //-------------------------------------------------------------------------
 // bool DataFilter()
 //-------------------------------------------------------------------------
@@ -35,6 +35,8 @@
 
 
 #include "BatchEstimatorBase.hpp"
+#include "SymmetricMatrix.hpp"
+#include <functional>
 //#include "PropSetup.hpp"
 //#include "MeasurementManager.hpp"
 
@@ -46,6 +48,21 @@
  * Statistical Orbit Determination (2004), chapter 4, as illustrated in the
  * flowchart on pages 196-197.  The normal equations are solved through direct
  * inversion of the information matrix.
+ *
+ * When LinearizedIterationThreshold is set, an iteration whose state
+ * correction is within that many standard deviations of every solve-for is
+ * followed by linearized iterations: the residuals of the stored measurement
+ * partials are predicted for the correction, the data are edited, and the
+ * normal equations are solved again without propagating the trajectory.  A
+ * solution that converges this way is accepted only after one propagated
+ * validation iteration also converges.
+ *
+ * When UseMultiArcSolution is set, the solve-for elements of each spacecraft
+ * are treated as the local parameters of one arc, and the other elements,
+ * such as measurement biases, as global parameters shared by the arcs.  If no
+ * information couples two arcs, the local parameters are reduced arc by arc
+ * with the Schur complement, on separate threads, and the global covariance
+ * is found from the summed reductions.
  */
 class ESTIMATION_API BatchEstimator: public BatchEstimatorBase
 {
@@ -84,6 +101,8 @@ public:
    virtual bool         SetBooleanParameter(const Integer id,
                                             const bool value);
 
+   virtual bool         GetObservationGroupEnd(GmatTime &groupEnd);
+
 protected:
    /// Parameters associated with the BatchEstimators
    enum
@@ -95,6 +114,10 @@ protected:
       ENABLE_ILSE,
       CONSTANT_MULTIPLIER_ILSE,
       MAX_ITERATIONS_ILSE,
+      LINEARIZED_ITERATION_THRESHOLD,
+      OBSERVATION_GROUP_SPAN,
+      RESIDUAL_THREADS,
+      USE_MULTI_ARC_SOLUTION,
       BatchEstimatorParamCount
    };
 
@@ -128,19 +151,83 @@ protected:
 
    InnerLoopStatus estimationStatusIL;
 
+   /// Largest state correction, in standard deviations, that starts
+   /// linearized iterations; 0 turns them off
+   Real linearizedThreshold;
+   /// Flag indicating the iteration in progress is not propagated
+   bool linearizedIteration;
+   /// Flag indicating the iteration in progress validates a linearized solution
+   bool validationPass;
+   /// Flag set when a validation pass fails, so the run continues propagating
+   bool linearizationFailed;
+
+   /// Longest propagation step, in seconds, whose observations are
+   /// interpolated from the step's dense output; 0 turns grouping off
+   Real observationGroupSpan;
+
+   /// Number of threads editing the stored residuals, computing their RMS and
+   /// reducing the arcs of a multi-arc solution; 0 uses one per hardware thread
+   Integer residualThreads;
+   /// Number of measurement records in each chunk of the stored residuals.
+   /// The chunks do not depend on the thread count, and their partial sums
+   /// are added in chunk order, so the results do not either.
+   static const UnsignedInt RESIDUAL_CHUNK_SIZE = 256;
+
+   /// Flag to solve the normal equations arc by arc, one arc per spacecraft
+   bool useMultiArc;
+   /// Flag set once the run has reported arcs coupled in the information
+   bool arcCouplingReported;
+
+   /// Number of measurement rows buffered before updating the information matrix
+   static const UnsignedInt ACCUMULATION_BLOCK_SIZE = 64;
+   /// Buffered measurement partials, one row of stateSize values per measurement
+   RealArray blockPartials;
+   /// Weights of the buffered measurement rows
+   RealArray blockWeights;
+   /// O - C values of the buffered measurement rows
+   RealArray blockResiduals;
+   /// Number of rows currently in the buffer
+   UnsignedInt blockRowCount;
+   /// Information from the buffered blocks, not yet added to information
+   SymmetricMatrix blockInformation;
+
    virtual void            CompleteInitialization();
    virtual void            Accumulate();
    virtual void            Estimate();
    virtual void            InnerLoop();
    virtual void            SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &covMatrix);
+   bool                    FindArcs(const Rmatrix &infMatrix,
+                                    const IntegerArray &auxVector,
+                                    std::vector<UnsignedIntArray> &arcs,
+                                    UnsignedIntArray &globals);
+   void                    SolveArcNormalEquations(const Rmatrix &infMatrix,
+                              const std::vector<UnsignedIntArray> &arcs,
+                              const UnsignedIntArray &globals,
+                              Rmatrix &covMatrix) const;
+   void                    InvertNormalBlock(Rmatrix &block) const;
+   virtual void            ComputeStateChange();
+   virtual void            PredictResiduals();
+
+   virtual Integer         TestForConvergence(std::string &reason);
+   virtual bool            UseLinearizedIteration();
 
    virtual bool            DataFilter();
    virtual void            EstimationPartials(std::vector<RealArray> &hMeas);
 
+   void                    BufferPartials(const RealArray &hRow, Real weight,
+                                          Real ocDiff);
+   virtual void            AccumulateInformationBlock();
+   void                    FoldBlockInformation();
+
    Real                    CalculateWRMS(const UnsignedIntArray &measurementList) const;
    Real                    CalculateWRMS(const UnsignedIntArray &measurementList, const RealArray &dx) const;
    Real                    CalculateResidualChange(const RealArray &hAccum, const RealArray &dx) const;
 
+   UnsignedInt             GetResidualChunkCount(UnsignedInt recordCount) const;
+   void                    RunResidualChunks(UnsignedInt recordCount,
+                              const std::function<void(UnsignedInt chunk,
+                              UnsignedInt begin, UnsignedInt end)> &work) const;
+
    virtual void            WriteReportFileHeaderPart6(); // Contains estimator-specific options
 
    virtual void            WriteReportFileSummaryPart1(Solver::SolverState sState);
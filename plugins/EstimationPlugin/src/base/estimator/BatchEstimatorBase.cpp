@@ -274,11 +274,12 @@ std::string BatchEstimatorBase::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer BatchEstimatorBase::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EstimatorParamCount; i < BatchEstimatorBaseParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - EstimatorParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, EstimatorParamCount,
+               BatchEstimatorBaseParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Estimator::GetParameterID(str);
 }
@@ -1135,6 +1136,14 @@ void BatchEstimatorBase::CompleteInitialization()
 ///// Check for more generic approach
       measManager.LoadRampTables();      
       
+      // The MATLAB buckets get one point per observation on each pass
+      if (writeMatFile && (matWriter != NULL))
+      {
+         UnsignedInt obsCount = measManager.GetObservationDataList()->size();
+         matData.Reserve(obsCount);
+         matObsData.Reserve(obsCount);
+      }
+      
       if (!(fabs((currentEpochGT - estimationEpochGT).GetTimeInSec()) <= ESTTIME_ROUNDOFF))
       {
 		  if (hasInitialized) {
@@ -1498,6 +1507,10 @@ void BatchEstimatorBase::CheckCompletion()
    }
    else
    {
+      // The next iteration is either propagated, or solved from the stored
+      // measurement partials without propagation
+      bool linearized = UseLinearizedIteration();
+
       if (showAllResiduals)
          PlotResiduals();
 
@@ -1544,30 +1557,37 @@ void BatchEstimatorBase::CheckCompletion()
       if ((resetBestRMSFlag) && (estimationStatus == DIVERGING))                             // fix bug GMT-5711
          bestResidualRMS = resetBestResidualRMS;                                             // fix bug GMT-5711
 
-      numRemovedRecords["U"] = 0;
-      numRemovedRecords["R"] = 0;
-      numRemovedRecords["B"] = 0;
-      numRemovedRecords["OLSE"] = 0;
-      numRemovedRecords["ILSE"] = 0;
-      numRemovedRecords["IRMS"] = 0;
-      numRemovedRecords["USER"] = 0;
-      numRemovedRecords["HORP"] = 0;
-      numRemovedRecords["N"]    = 0;
-
-      measStats.clear();
-      stationsList.clear();
-      measTypesList.clear();
-
-
-      // Clear all media correct warning lists
-      ionoWarningList.clear();
-      tropoWarningList.clear();
+      // A linearized iteration reuses the measurement statistics and edit
+      // counts of the last propagated iteration
+      if (!linearized)
+      {
+         numRemovedRecords["U"] = 0;
+         numRemovedRecords["R"] = 0;
+         numRemovedRecords["B"] = 0;
+         numRemovedRecords["OLSE"] = 0;
+         numRemovedRecords["ILSE"] = 0;
+         numRemovedRecords["IRMS"] = 0;
+         numRemovedRecords["USER"] = 0;
+         numRemovedRecords["HORP"] = 0;
+         numRemovedRecords["N"]    = 0;
+
+         measStats.clear();
+         stationsList.clear();
+         measTypesList.clear();
+
+
+         // Clear all media correct warning lists
+         ionoWarningList.clear();
+         tropoWarningList.clear();
+      }
 
       // Get new estimationStateS after it reset all Cr_Epsilon and Cd_Epsilon
       // Note that: All epsilon parameters such as Cr_Epsilon and Cd_Epsilon are 0 at the starting point of the next iteration
       estimationStateS = esm.GetEstimationState();
 
-      if (fabs((currentEpochGT - nextMeasurementEpochGT).GetTimeInSec()) <= ESTTIME_ROUNDOFF)
+      if (linearized)
+         currentState = ESTIMATING;
+      else if (fabs((currentEpochGT - nextMeasurementEpochGT).GetTimeInSec()) <= ESTTIME_ROUNDOFF)
          currentState = CALCULATING;
       else
       {
@@ -1955,6 +1975,23 @@ std::string BatchEstimatorBase::GetProgressString()
 }
 
 
+//------------------------------------------------------------------------------
+// bool UseLinearizedIteration()
+//------------------------------------------------------------------------------
+/**
+ * This method indicates if the next iteration is solved from the measurement
+ * partials and residuals of the last iteration instead of propagating the
+ * trajectory.  Derived classes that support it override this method.
+ *
+ * @return true for a linearized iteration, false to propagate
+ */
+//------------------------------------------------------------------------------
+bool BatchEstimatorBase::UseLinearizedIteration()
+{
+   return false;
+}
+
+
 //------------------------------------------------------------------------------
 // void OverwriteEditFlag(const std::string &editFlag)
 //------------------------------------------------------------------------------
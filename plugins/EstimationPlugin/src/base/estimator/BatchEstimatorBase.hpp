@@ -208,6 +208,7 @@ protected:
    virtual bool            WriteEditFlag();
 
    virtual Integer         TestForConvergence(std::string &reason);
+   virtual bool            UseLinearizedIteration();
 
    // progress string for reporting
    virtual std::string    GetProgressString();
@@ -0,0 +1,354 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             BatchEstimatorSRIF
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Batch least squares estimator using a square root information filter
+ */
+//------------------------------------------------------------------------------
+
+#include "BatchEstimatorSRIF.hpp"
+#include "MessageInterface.hpp"
+#include "EstimatorException.hpp"
+#include "QRFactorization.hpp"
+#include "CholeskyFactorization.hpp"
+#include "UtilityException.hpp"
+
+//#define DEBUG_SRIF
+
+
+//------------------------------------------------------------------------------
+// BatchEstimatorSRIF(const std::string &name)
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ *
+ * @param name Name of the instance being constructed
+ */
+//------------------------------------------------------------------------------
+BatchEstimatorSRIF::BatchEstimatorSRIF(const std::string &name) :
+   BatchEstimator       (name)
+{
+   typeName = "BatchEstimatorSRIF";
+   objectTypes.push_back(GmatType::GetTypeId("BatchEstimatorSRIF"));
+   objectTypeNames.push_back("BatchEstimatorSRIF");
+}
+
+
+//------------------------------------------------------------------------------
+// ~BatchEstimatorSRIF()
+//------------------------------------------------------------------------------
+/**
+ * Class destructor
+ */
+//------------------------------------------------------------------------------
+BatchEstimatorSRIF::~BatchEstimatorSRIF()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// BatchEstimatorSRIF(const BatchEstimatorSRIF& est)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param est The object that is being copied
+ */
+//------------------------------------------------------------------------------
+BatchEstimatorSRIF::BatchEstimatorSRIF(const BatchEstimatorSRIF& est) :
+   BatchEstimator       (est)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// BatchEstimatorSRIF& operator=(const BatchEstimatorSRIF& est)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param est The object providing configuration data for this object
+ *
+ * @return This object, configured to match est
+ */
+//------------------------------------------------------------------------------
+BatchEstimatorSRIF& BatchEstimatorSRIF::operator=(const BatchEstimatorSRIF& est)
+{
+   if (this != &est)
+   {
+      BatchEstimator::operator=(est);
+      srifArray.SetSize(0, 0);
+   }
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Object cloner
+ *
+ * @return Pointer to a new BatchEstimatorSRIF configured to match this one.
+ */
+//------------------------------------------------------------------------------
+GmatBase* BatchEstimatorSRIF::Clone() const
+{
+   return new BatchEstimatorSRIF(*this);
+}
+
+
+//---------------------------------------------------------------------------
+//  void Copy(const GmatBase* orig)
+//---------------------------------------------------------------------------
+/**
+ * Sets this object to match another one.
+ *
+ * @param orig The original that is being copied.
+ */
+//---------------------------------------------------------------------------
+void BatchEstimatorSRIF::Copy(const GmatBase* orig)
+{
+   operator=(*((BatchEstimatorSRIF*)(orig)));
+}
+
+
+//------------------------------------------------------------------------------
+//  void CompleteInitialization()
+//------------------------------------------------------------------------------
+/**
+ * Completes initialization as BatchEstimator does, and sizes the square root
+ * information array for the solve-for state.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimatorSRIF::CompleteInitialization()
+{
+   BatchEstimator::CompleteInitialization();
+   ResetSquareRootInformation();
+}
+
+
+//------------------------------------------------------------------------------
+// void ResetSquareRootInformation()
+//------------------------------------------------------------------------------
+/**
+ * Clears the square root information array for a new iteration.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimatorSRIF::ResetSquareRootInformation()
+{
+   srifArray.SetSize(stateSize + ACCUMULATION_BLOCK_SIZE, stateSize + 1);
+
+   Real *data = (Real*)srifArray.GetDataVector();
+   for (Integer i = 0; i < srifArray.GetNumRows() * srifArray.GetNumColumns();
+        ++i)
+      data[i] = 0.0;
+}
+
+
+//------------------------------------------------------------------------------
+// void AccumulateInformationBlock()
+//------------------------------------------------------------------------------
+/**
+ * Folds the buffered measurement rows into the square root information array.
+ *
+ * Each row h and residual y is whitened by the square root of its weight and
+ * stacked under [R z]; Householder triangularization of the stack gives the
+ * updated [R z].  The measurement rows are then cleared for the next block.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimatorSRIF::AccumulateInformationBlock()
+{
+   if (blockRowCount == 0)
+      return;
+
+   if ((srifArray.GetNumRows() != (Integer)(stateSize + ACCUMULATION_BLOCK_SIZE))
+       || (srifArray.GetNumColumns() != (Integer)(stateSize + 1)))
+      ResetSquareRootInformation();
+
+   Integer cols = stateSize + 1;
+   Real *data = (Real*)srifArray.GetDataVector();
+
+   for (UnsignedInt k = 0; k < blockRowCount; ++k)
+   {
+      Real sqrtWeight = GmatMathUtil::Sqrt(blockWeights[k]);
+      const Real *hk = &blockPartials[k * stateSize];
+      Real *row = data + (stateSize + k) * cols;
+
+      for (UnsignedInt i = 0; i < stateSize; ++i)
+         row[i] = hk[i] * sqrtWeight;
+      row[stateSize] = blockResiduals[k] * sqrtWeight;
+   }
+
+   QRFactorization qr(false);
+   qr.Triangularize(srifArray, stateSize, stateSize + blockRowCount);
+
+   // The triangularization zeroes the partials; clear the residuals left in
+   // the measurement rows
+   for (UnsignedInt k = 0; k < blockRowCount; ++k)
+      data[(stateSize + k) * cols + stateSize] = 0.0;
+
+   blockRowCount = 0;
+}
+
+
+//------------------------------------------------------------------------------
+// void ComputeStateChange()
+//------------------------------------------------------------------------------
+/**
+ * Adds the a priori information and solves for the state change dx and the
+ * covariance informationInverse from the square root information array.
+ *
+ * The information matrix and residual vector used by the data editing and the
+ * reports are rebuilt as R^T R and R^T z.  If a solve-for has no measurement
+ * partials, its column of R is zero, and the normal equations are solved
+ * instead so the matrix reduction is performed and reported as BatchEstimator
+ * does.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimatorSRIF::ComputeStateChange()
+{
+   AccumulateInformationBlock();
+
+   Integer n = stateSize;
+   Integer aprioriRows = (useApriori ? n : 0);
+
+   // The array [R z], with the a priori rows [R0 R0*x0bar] below it
+   Rmatrix sri(n + aprioriRows, n + 1);
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = i; j <= n; ++j)
+         sri(i, j) = srifArray(i, j);
+
+   if (useApriori)
+   {
+      Rmatrix Pdx0_inv;
+      InvertApriori(Pdx0_inv);
+
+      Rmatrix R0(n, n);
+      CholeskyFactorization cf;
+      try
+      {
+         cf.Factor(Pdx0_inv, R0);
+      }
+      catch (UtilityException &ex)
+      {
+         throw EstimatorException("Error: The a priori covariance of " +
+               GetName() + " cannot be factored for the square root "
+               "information filter: " + ex.GetDetails() + "\n");
+      }
+
+      for (Integer i = 0; i < n; ++i)
+      {
+         Real z0 = 0.0;
+         for (Integer j = i; j < n; ++j)
+         {
+            sri(n + i, j) = R0(i, j);
+            z0 += R0(i, j) * x0bar[j];
+         }
+         sri(n + i, n) = z0;
+      }
+
+      QRFactorization qr(false);
+      qr.Triangularize(sri, n);
+   }
+
+   // Information matrix R^T R and residual vector R^T z
+   bool hasZeroColumn = false;
+   for (Integer i = 0; i < n; ++i)
+   {
+      for (Integer j = i; j < n; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k <= i; ++k)
+            sum += sri(k, i) * sri(k, j);
+         information(i, j) = sum;
+         information(j, i) = sum;
+      }
+
+      Real sum = 0.0;
+      for (Integer k = 0; k <= i; ++k)
+         sum += sri(k, i) * sri(k, n);
+      residuals[i] = sum;
+
+      if (information(i, i) <= 1.0e-50)
+         hasZeroColumn = true;
+   }
+
+   #ifdef DEBUG_SRIF
+      MessageInterface::ShowMessage("BatchEstimatorSRIF: R diagonal = [");
+      for (Integer i = 0; i < n; ++i)
+         MessageInterface::ShowMessage(" %.12le ", sri(i, i));
+      MessageInterface::ShowMessage("]%s\n", hasZeroColumn ?
+            "; solving the reduced normal equations" : "");
+   #endif
+
+   dx.assign(n, 0.0);
+
+   if (hasZeroColumn)
+   {
+      SolveNormalEquations(information, informationInverse);
+
+      for (Integer i = 0; i < n; ++i)
+         for (Integer j = 0; j < n; ++j)
+            dx[i] += informationInverse(i, j) * residuals(j);
+   }
+   else
+   {
+      // R^-1 by back substitution, one column at a time
+      Rmatrix Rinv(n, n);
+      for (Integer j = n - 1; j >= 0; --j)
+      {
+         if (sri(j, j) == 0.0)
+            throw EstimatorException("Error: Normal matrix is singular.\n");
+
+         Rinv(j, j) = 1.0 / sri(j, j);
+         for (Integer i = j - 1; i >= 0; --i)
+         {
+            Real sum = 0.0;
+            for (Integer k = i + 1; k <= j; ++k)
+               sum += sri(i, k) * Rinv(k, j);
+            Rinv(i, j) = -sum / sri(i, i);
+         }
+      }
+
+      // Covariance R^-1 R^-T, and dx = R^-1 z
+      informationInverse.SetSize(n, n);
+      for (Integer i = 0; i < n; ++i)
+      {
+         for (Integer j = i; j < n; ++j)
+         {
+            Real sum = 0.0;
+            for (Integer k = j; k < n; ++k)
+               sum += Rinv(i, k) * Rinv(j, k);
+            informationInverse(i, j) = sum;
+            informationInverse(j, i) = sum;
+         }
+
+         for (Integer k = i; k < n; ++k)
+            dx[i] += Rinv(i, k) * sri(k, n);
+      }
+
+      removedNormalMatrixIndexes.clear();
+   }
+
+   // The next iteration accumulates from an empty array
+   ResetSquareRootInformation();
+}
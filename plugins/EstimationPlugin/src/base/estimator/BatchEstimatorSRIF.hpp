@@ -0,0 +1,75 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             BatchEstimatorSRIF
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Batch least squares estimator using a square root information filter
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef BatchEstimatorSRIF_hpp
+#define BatchEstimatorSRIF_hpp
+
+#include "BatchEstimator.hpp"
+
+
+/**
+ * A batch least squares estimator that solves in square root information form.
+ *
+ * Instead of summing the information matrix H^T W H, the estimator keeps the
+ * upper triangular square root information array [R z], with R^T R equal to
+ * the information matrix and R^T z to the weighted residual sum.  Each block
+ * of buffered measurement rows, whitened by the square roots of their weights,
+ * is stacked under [R z] and folded in by Householder triangularization
+ * (Bierman, Factorization Methods for Discrete Sequential Estimation, 1977).
+ * The a priori information enters as the rows of its Cholesky factor.  The
+ * state change solves R dx = z by back substitution and the covariance is
+ * R^-1 R^-T, so the normal equations are never formed or inverted.  The
+ * condition number of R is the square root of that of the information matrix,
+ * which matters for ill-conditioned problems.  The array is (stateSize + block size) by
+ * (stateSize + 1), however many measurements are processed.
+ *
+ * Data editing, the inner loop and the reports are those of BatchEstimator;
+ * the information matrix they read is rebuilt from R once per iteration.
+ */
+class ESTIMATION_API BatchEstimatorSRIF : public BatchEstimator
+{
+public:
+   BatchEstimatorSRIF(const std::string &name);
+   virtual ~BatchEstimatorSRIF();
+   BatchEstimatorSRIF(const BatchEstimatorSRIF& est);
+   BatchEstimatorSRIF& operator=(const BatchEstimatorSRIF& est);
+
+   virtual GmatBase*       Clone() const;
+   virtual void            Copy(const GmatBase*);
+
+protected:
+   /// Square root information array: the first stateSize rows hold [R z], and
+   /// the rows below them take one block of whitened measurement rows
+   Rmatrix                 srifArray;
+
+   virtual void            CompleteInitialization();
+   virtual void            AccumulateInformationBlock();
+   virtual void            ComputeStateChange();
+
+   void                    ResetSquareRootInformation();
+};
+
+#endif /* BatchEstimatorSRIF_hpp */
@@ -4099,7 +4099,7 @@ GmatState EstimationStateManager::GetEstimationStateForReport(std::string anomal
 
 
 //--------------------------------------------------------------------------------------------
-// Rmatrix66 CartesianToKeplerianCoverianceConvertionMatrix(GmatBase* obj, const Rvector6 state)
+// Rmatrix66 CartesianToKeplerianCoverianceConvertionMatrix(GmatBase* obj, const Rvector6 &state)
 //--------------------------------------------------------------------------------------------
 /**
 * This function is use to calculate derivative state conversion matrix for a spacecraft state.
@@ -4111,7 +4111,7 @@ GmatState EstimationStateManager::GetEstimationStateForReport(std::string anomal
 * return          6x6 derivative state conversion matrix [dX/dK]
 */
 //--------------------------------------------------------------------------------------------
-Rmatrix66 EstimationStateManager::CartesianToKeplerianCoverianceConvertionMatrix(GmatBase* obj, const Rvector6 state)
+Rmatrix66 EstimationStateManager::CartesianToKeplerianCoverianceConvertionMatrix(GmatBase* obj, const Rvector6 &state)
 {
    // 1. Get mu value 
    Spacecraft* spacecraft = (Spacecraft*)obj;
@@ -133,7 +133,7 @@ public:
    GmatState                  GetEstimationKeplerianStateForReport(std::string anomalyType = "TA");
 
    
-   Rmatrix66                  CartesianToKeplerianCoverianceConvertionMatrix(GmatBase* obj, const Rvector6 state);
+   Rmatrix66                  CartesianToKeplerianCoverianceConvertionMatrix(GmatBase* obj, const Rvector6 &state);
    Rmatrix                    CartToSolveForStateConversionDerivativeMatrix();
    Rmatrix                    SolveForStateToKeplConversionDerivativeMatrix();
 
@@ -170,7 +170,6 @@ const Real Estimator::COV_INV_TOL = std::numeric_limits<Real>::epsilon();
 //------------------------------------------------------------------------------
 Estimator::Estimator(const std::string &type, const std::string &name) :
    Solver               (type, name),
-   solarSystem          (NULL),
    resetState           (false),
    timeStep             (60.0),
    transientForces      (NULL),
@@ -194,10 +193,12 @@ Estimator::Estimator(const std::string &type, const std::string &name) :
    showSpecificResiduals(false),
    showErrorBars        (false),
    locatingEvent        (false),
+   reportBuffer         (NULL),
    matWriter            (NULL),
    writeMatFile         (false),
+   matFileName          (""),
    dontWriteDataInUpdate(false),
-   matFileName          ("")
+   solarSystem          (NULL)
 {
 
    objectTypeNames.push_back("Estimator");
@@ -277,6 +278,12 @@ Estimator::~Estimator()
    activeEvents.clear();
    numRemovedRecords.clear();
    
+   // The report text is written out before Solver closes the file
+   StopReportBuffering();
+   if (reportBuffer != NULL)
+      delete reportBuffer;
+   reportBuffer = NULL;
+
    //clean up DataWriter *matWriter;
    if (matWriter != NULL)
    {
@@ -312,6 +319,8 @@ Estimator::~Estimator()
          delete dataFilterObjs[i];
    }
    dataFilterObjs.clear();
+   rejectFilterIndices.clear();
+   acceptFilterIndices.clear();
 
    if (matWriter != NULL)
      delete matWriter;
@@ -359,7 +368,6 @@ Estimator::~Estimator()
 //------------------------------------------------------------------------------
 Estimator::Estimator(const Estimator& est) :
    Solver               (est),
-   solarSystem          (est.solarSystem),
    measurementNames     (est.measurementNames),
    modelNames           (est.modelNames),
    solveForStrings      (est.solveForStrings),
@@ -367,8 +375,8 @@ Estimator::Estimator(const Estimator& est) :
    propagatorSatMap     (est.propagatorSatMap),
    resetState           (false),
    timeStep             (est.timeStep),
-   transientForces      (NULL),
    refObjectList        (est.refObjectList),
+   transientForces      (NULL),
    estEpochFormat       (est.estEpochFormat),
    estEpoch             (est.estEpoch),
    estimationEpochGT      (est.estimationEpochGT),
@@ -389,11 +397,13 @@ Estimator::Estimator(const Estimator& est) :
    showSpecificResiduals(est.showSpecificResiduals),
    showErrorBars        (est.showErrorBars),
    locatingEvent        (false),
-   dataFilterStrings    (est.dataFilterStrings),
+   reportBuffer         (NULL),
    matWriter            (NULL),
    writeMatFile         (est.writeMatFile),
+   matFileName          (est.matFileName),
    dontWriteDataInUpdate(est.dontWriteDataInUpdate),
-   matFileName          (est.matFileName)
+   solarSystem          (est.solarSystem),
+   dataFilterStrings    (est.dataFilterStrings)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("Estimator::Estimator() enter: <%p,%s> copy constructor from <%p,%s>\n", this, GetName().c_str(), &est, est.GetName().c_str());  
@@ -731,6 +741,7 @@ bool Estimator::Initialize()
             dataFilterObjs.push_back(obj1);
          }
       }
+      CompileDataFilters();
 
       if (matFileName != "")
       {
@@ -936,6 +947,7 @@ void Estimator::CompleteInitialization()
 //------------------------------------------------------------------------------
 bool Estimator::Finalize()
 {
+   StopReportBuffering();
    bool retval = Solver::Finalize();
 
    // Remove all estimation data filters in finalized stage
@@ -945,6 +957,8 @@ bool Estimator::Finalize()
          delete dataFilterObjs[i];
    }
    dataFilterObjs.clear();
+   rejectFilterIndices.clear();
+   acceptFilterIndices.clear();
 
    // clear all estimation flags
    editedRecords.clear();
@@ -1001,11 +1015,11 @@ std::string Estimator::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer     Estimator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverParamCount; i < EstimatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SolverParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SolverParamCount, EstimatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Solver::GetParameterID(str);
 }
@@ -2592,6 +2606,27 @@ Real Estimator::GetTimeStep()
 }
 
 
+//------------------------------------------------------------------------------
+//  bool GetObservationGroupEnd(GmatTime &groupEnd)
+//------------------------------------------------------------------------------
+/**
+ * Finds the end of a group of observations that can be served from a single
+ * propagation step.
+ *
+ * Estimators that support grouping override this method; by default every
+ * observation is propagated to separately.
+ *
+ * @param groupEnd Set to the epoch of the last observation in the group
+ *
+ * @return true if the group holds observations beyond the next one
+ */
+//------------------------------------------------------------------------------
+bool Estimator::GetObservationGroupEnd(GmatTime &groupEnd)
+{
+   return false;
+}
+
+
 //------------------------------------------------------------------------------
 // bool ResetState()
 //------------------------------------------------------------------------------
@@ -3213,6 +3248,28 @@ void Estimator::SetResultValue(Integer, Real, const std::string&)
 //}
 
 
+//------------------------------------------------------------------------------
+// void CompileDataFilters()
+//------------------------------------------------------------------------------
+/**
+* Sorts the estimation data filters into reject and accept filter lists, so
+* the filter types are checked once rather than for every observation.
+*/
+//------------------------------------------------------------------------------
+void Estimator::CompileDataFilters()
+{
+   rejectFilterIndices.clear();
+   acceptFilterIndices.clear();
+   for (UnsignedInt i = 0; i < dataFilterObjs.size(); ++i)
+   {
+      if (dataFilterObjs[i]->IsOfType("RejectFilter"))
+         rejectFilterIndices.push_back(i);
+      else if (dataFilterObjs[i]->IsOfType("AcceptFilter"))
+         acceptFilterIndices.push_back(i);
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // ObservationData* FilteringData(ObservationData* obsData, Integer obDataId)
 //------------------------------------------------------------------------------
@@ -3241,53 +3298,45 @@ ObservationData* Estimator::FilteringData(ObservationData* dataObject, Integer o
    // Run estimation reject filters
    if (obdata)
    {
-      for (UnsignedInt i = 0; i < dataFilterObjs.size(); ++i)
+      for (UnsignedInt k = 0; k < rejectFilterIndices.size(); ++k)
       {
-         if (dataFilterObjs[i]->IsOfType("RejectFilter"))
-         {
-            rejReason = 0;
-            obdata = ((RejectFilter*)dataFilterObjs[i])->FilteringData(dataObject, rejReason, obDataId);
+         Integer i = rejectFilterIndices[k];
+         rejReason = 0;
+         obdata = ((RejectFilter*)dataFilterObjs[i])->FilteringData(dataObject, rejReason, obDataId);
 
-            // it is rejected when it has been rejected by any reject filter
-            if (obdata == NULL)
-            {
-               filterIndex = i;
-               break;
-            }
+         // it is rejected when it has been rejected by any reject filter
+         if (obdata == NULL)
+         {
+            filterIndex = i;
+            break;
          }
       }
    }
 
-   // Run statistic accept filters when it passes reject filters
-   if (obdata)
+   // Run statistic accept filters when it passes reject filters.  Every
+   // accept filter sees the record, since thinning keeps a count of records
+   if (obdata && !acceptFilterIndices.empty())
    {
       ObservationData* obdata1 = NULL;
       ObservationData* od;
-      bool hasAcceptFilter = false;
-      for (UnsignedInt i = 0; i < dataFilterObjs.size(); ++i)
+      for (UnsignedInt k = 0; k < acceptFilterIndices.size(); ++k)
       {
-         if (dataFilterObjs[i]->IsOfType("AcceptFilter"))
+         Integer i = acceptFilterIndices[k];
+         rejReason = 0;
+         od = ((AcceptFilter*)dataFilterObjs[i])->FilteringData(dataObject, rejReason, obDataId);
+         //MessageInterface::ShowMessage("   od = <%p>   rejReason = %d   \n", od, rejReason);
+         // it is accepted when it has been accepted by any accept filter
+         if (od)
          {
-            hasAcceptFilter = true;
-            rejReason = 0;
-            od = ((AcceptFilter*)dataFilterObjs[i])->FilteringData(dataObject, rejReason, obDataId);
-            //MessageInterface::ShowMessage("   od = <%p>   rejReason = %d   \n", od, rejReason);
-            // it is accepted when it has been accepted by any accept filter
-            if (od)
-            {
-               obdata1 = od;
-            }
-            else
-               filterIndex = i;
+            obdata1 = od;
          }
+         else
+            filterIndex = i;
       }
 
-      if (hasAcceptFilter)
-      {
-         obdata = obdata1;
-         if (obdata1)
-            filterIndex = dataFilterObjs.size();
-      }
+      obdata = obdata1;
+      if (obdata1)
+         filterIndex = dataFilterObjs.size();
    }
 
 #ifdef DEBUG_FILTER
@@ -3297,6 +3346,48 @@ ObservationData* Estimator::FilteringData(ObservationData* dataObject, Integer o
    return obdata;
 }
 
+
+//------------------------------------------------------------------------------
+// Integer FilteringData(std::vector<ObservationData*> &block,
+//       const IntegerArray &obDataIds, IntegerArray &filterIndices)
+//------------------------------------------------------------------------------
+/**
+* Performs second level data editing on a block of observations.
+*
+* The records are filtered in order, as they would be one at a time, and the
+* rejected records are set to NULL in the block.
+*
+* @param block          The observation data records
+* @param obDataIds      Record numbers of the observations; an empty list
+*                       filters every record with record number -1
+* @param filterIndices  Set to the index of the rejecting filter for each
+*                       record, or the number of filters for accepted records
+*
+* @return               The number of accepted records
+*/
+//------------------------------------------------------------------------------
+Integer Estimator::FilteringData(std::vector<ObservationData*> &block,
+      const IntegerArray &obDataIds, IntegerArray &filterIndices)
+{
+   if (!obDataIds.empty() && (obDataIds.size() != block.size()))
+      throw EstimatorException("Error: The number of record numbers passed to "
+            "Estimator::FilteringData() does not match the number of "
+            "observations.\n");
+
+   filterIndices.resize(block.size());
+
+   Integer accepted = 0;
+   for (UnsignedInt k = 0; k < block.size(); ++k)
+   {
+      Integer id = (obDataIds.empty() ? -1 : obDataIds[k]);
+      block[k] = FilteringData(block[k], id, filterIndices[k]);
+      if (block[k])
+         ++accepted;
+   }
+
+   return accepted;
+}
+
 //------------------------------------------------------------------------------
 // void Symmetrize(Rmatrix& mat)
 //------------------------------------------------------------------------------
@@ -3742,10 +3833,15 @@ Real Estimator::GetEpsilonConversion(const UnsignedInt stateIndex)
 //------------------------------------------------------------------------------
 void Estimator::CovarianceEpsilonConversion(Rmatrix& cov)
 {
-   for (UnsignedInt i = 0; i < esm.GetStateSize(); ++i)
+   UnsignedInt size = esm.GetStateSize();
+   for (UnsignedInt i = 0; i < size; ++i)
    {
+      // Only the epsilon elements scale their row and column
       Real conversionValue = GetEpsilonConversion(i);
-      for (UnsignedInt j = 0; j < esm.GetStateSize(); ++j)
+      if (conversionValue == 1.0)
+         continue;
+
+      for (UnsignedInt j = 0; j < size; ++j)
       {
          cov(i, j) *= conversionValue;
          cov(j, i) *= conversionValue;
@@ -3766,10 +3862,14 @@ void Estimator::CovarianceEpsilonConversion(Rmatrix& cov)
  //------------------------------------------------------------------------------
 void Estimator::CovarianceEpsilonConversionReverse(Rmatrix& cov)
 {
-   for (UnsignedInt i = 0; i < esm.GetStateSize(); ++i)
+   UnsignedInt size = esm.GetStateSize();
+   for (UnsignedInt i = 0; i < size; ++i)
    {
       Real conversionValue = GetEpsilonConversion(i);
-      for (UnsignedInt j = 0; j < esm.GetStateSize(); ++j)
+      if (conversionValue == 1.0)
+         continue;
+
+      for (UnsignedInt j = 0; j < size; ++j)
       {
          cov(i, j) /= conversionValue;
          cov(j, i) /= conversionValue;
@@ -3796,8 +3896,6 @@ void Estimator::CartesianCovarianceRotation(Rmatrix& cov, bool allStatesCart)
    GmatState* state = esm.GetState();
    GmatTime epoch = state->GetEpochGT();
 
-   Rmatrix transform = Rmatrix::Identity(esm.GetStateSize());
-
    UnsignedInt i = 0;
    while (i < esm.GetStateSize())
    {
@@ -3824,21 +3922,23 @@ void Estimator::CartesianCovarianceRotation(Rmatrix& cov, bool allStatesCart)
 
             Rmatrix33 rot = cv.GetLastRotationMatrix();
 
+            Rmatrix66 transform(false);
             for (UnsignedInt row = 0U; row < 3U; row++)
             {
                for (UnsignedInt col = 0U; col < 3U; col++)
                {
-                  transform(i + row, i + col) = rot(row, col);
-                  transform(i+3 + row, i+3 + col) = rot(row, col);
+                  transform(row, col) = rot(row, col);
+                  transform(3 + row, 3 + col) = rot(row, col);
                }
             }
+
+            // Only this spacecraft's rows and columns change
+            TransformCovarianceBlock(cov, i, transform);
          }
       }
 
       i += (*map)[i]->length;
    }
-
-   cov = transform * cov * transform.Transpose();
 }
 
 //------------------------------------------------------------------------------
@@ -3854,12 +3954,11 @@ Rmatrix Estimator::GetCovarianceVNB(const Rmatrix& inCov)
    ObjectArray satArray;
    esm.GetStateObjects(satArray, Gmat::SPACECRAFT);
    UnsignedInt satArraySize = satArray.size();
-   UnsignedInt matSize = satArraySize*6;
    Rvector outState(stateSize);
    Rvector inState(stateSize);
    inState.Set(estimationState->GetState(), stateSize);
 
-   Rmatrix transform(matSize, matSize);
+   std::vector<Rmatrix66> transforms; // [d(VNB)/dS] for each spacecraft
    UnsignedIntArray satStartIdxs; // Start index of the S/C Cartesian states in the esm
    const std::vector<ListItem*> *map = esm.GetStateMap();
 
@@ -3880,53 +3979,203 @@ Rmatrix Estimator::GetCovarianceVNB(const Rmatrix& inCov)
       if (satIdx == stateSize)
          continue;
 
-      // Start index for block of data going into transform matrix
-      UnsignedInt offsetIdx = satStartIdxs.size() * 6;
       satStartIdxs.push_back(satIdx);
 
       cc.Convert(currentEpochGT, inState, ((Spacecraft*)satArray[idx])->GetInternalCoordSystem(), outState, vnbFrames[satArray[idx]], true, false);
 
       Rmatrix33 vnbRot = cc.GetLastRotationMatrix();
 
+      Rmatrix66 transform(false);
       for (UnsignedInt ii = 0; ii < 3U; ii++)
       {
          for (UnsignedInt jj = 0; jj < 3U; jj++)
          {
-            transform(offsetIdx + ii, offsetIdx + jj) = vnbRot(ii, jj);
-            transform(offsetIdx + ii + 3, offsetIdx + jj + 3) = vnbRot(ii, jj);
+            transform(ii, jj) = vnbRot(ii, jj);
+            transform(ii + 3, jj + 3) = vnbRot(ii, jj);
          }
       }
+      transforms.push_back(transform);
    }
    esm.MapVectorToObjects();
 
-   // Resize transform matrix if previous loop skipped a spacecraft
    UnsignedInt satSize = satStartIdxs.size();
    UnsignedInt vnbSize = 6 * satSize;
-   if (vnbSize != matSize)
-      transform.SetSize(vnbSize, vnbSize, false);
 
-   Rmatrix dX_dS = esm.CartToSolveForStateConversionDerivativeMatrix();
-   Rmatrix cartCov = dX_dS * inCov * dX_dS.Transpose();
-   Rmatrix cov(vnbSize, vnbSize);
+   // Keplerian solve-for states go through their own [dX/dK] block first;
+   // the other elements of [dX/dS] do not reach the spacecraft blocks
+   GmatState estCartState;
+   bool cartStateSet = false;
+   for (UnsignedInt satIdx = 0; satIdx < satSize; satIdx++)
+   {
+      UnsignedInt start = satStartIdxs[satIdx];
+      if ((*map)[start]->elementName != "KeplerianState")
+         continue;
 
+      if (!cartStateSet)
+      {
+         estCartState = esm.GetEstimationMJ2000EqCartesianState();
+         cartStateSet = true;
+      }
+      Rvector6 cartState(estCartState[start], estCartState[start + 1],
+            estCartState[start + 2], estCartState[start + 3],
+            estCartState[start + 4], estCartState[start + 5]);
+      transforms[satIdx] = transforms[satIdx] *
+            esm.CartesianToKeplerianCoverianceConvertionMatrix(
+            (*map)[start]->object, cartState);
+   }
+
+   // Each 6x6 block is T1 * P12 * T2'; the lower blocks are the transposes
+   Rmatrix covVNB(vnbSize, vnbSize);
+   Rmatrix66 block(false);
    for (UnsignedInt satIdx1 = 0; satIdx1 < satSize; satIdx1++)
    {
       UnsignedInt covIdx1 = satStartIdxs[satIdx1];
-      for (UnsignedInt satIdx2 = 0; satIdx2 < satSize; satIdx2++)
+      for (UnsignedInt satIdx2 = satIdx1; satIdx2 < satSize; satIdx2++)
       {
          UnsignedInt covIdx2 = satStartIdxs[satIdx2];
 
          for (UnsignedInt ii = 0; ii < 6U; ii++)
             for (UnsignedInt jj = 0; jj < 6U; jj++)
-               cov(6 * satIdx1 + ii, 6 * satIdx2 + jj) = cartCov(covIdx1 + ii, covIdx2 + jj);
+               block(ii, jj) = inCov(covIdx1 + ii, covIdx2 + jj);
+
+         block = MatrixTimesTranspose(transforms[satIdx1] * block,
+               transforms[satIdx2]);
+
+         for (UnsignedInt ii = 0; ii < 6U; ii++)
+            for (UnsignedInt jj = 0; jj < 6U; jj++)
+            {
+               covVNB(6 * satIdx1 + ii, 6 * satIdx2 + jj) = block(ii, jj);
+               covVNB(6 * satIdx2 + jj, 6 * satIdx1 + ii) = block(ii, jj);
+            }
       }
    }
 
-   Rmatrix covVNB = transform * cov * transform.Transpose();
    return covVNB;
 }
 
 
+//------------------------------------------------------------------------------
+// void TransformCovarianceBlock(Rmatrix& cov, UnsignedInt start,
+//       const Rmatrix66& transform)
+//------------------------------------------------------------------------------
+/**
+ * Computes T * cov * T' in place, where T is the identity except for a 6x6
+ * block on the diagonal
+ *
+ * Only the six rows and columns of the block change.  The columns outside the
+ * block are copied from the new rows, so cov must be symmetric.
+ *
+ * @param cov The symmetric covariance matrix to transform
+ * @param start Index of the first row of the block
+ * @param transform The 6x6 block of T
+ */
+//------------------------------------------------------------------------------
+void Estimator::TransformCovarianceBlock(Rmatrix& cov, UnsignedInt start,
+      const Rmatrix66& transform)
+{
+   UnsignedInt size = cov.GetNumRows();
+   Real row[6];
+
+   // Rows of the block: T6 * cov(block, :)
+   for (UnsignedInt col = 0; col < size; ++col)
+   {
+      for (UnsignedInt ii = 0; ii < 6U; ++ii)
+      {
+         row[ii] = 0.0;
+         for (UnsignedInt kk = 0; kk < 6U; ++kk)
+            row[ii] += transform(ii, kk) * cov(start + kk, col);
+      }
+      for (UnsignedInt ii = 0; ii < 6U; ++ii)
+         cov(start + ii, col) = row[ii];
+   }
+
+   // Columns of the block outside it, by symmetry
+   for (UnsignedInt col = 0; col < size; ++col)
+   {
+      if ((col >= start) && (col < start + 6))
+         continue;
+      for (UnsignedInt ii = 0; ii < 6U; ++ii)
+         cov(col, start + ii) = cov(start + ii, col);
+   }
+
+   // The block itself: (T6 * cov(block, block)) * T6'
+   for (UnsignedInt ii = 0; ii < 6U; ++ii)
+   {
+      for (UnsignedInt jj = 0; jj < 6U; ++jj)
+      {
+         row[jj] = 0.0;
+         for (UnsignedInt kk = 0; kk < 6U; ++kk)
+            row[jj] += cov(start + ii, start + kk) * transform(jj, kk);
+      }
+      for (UnsignedInt jj = 0; jj < 6U; ++jj)
+         cov(start + ii, start + jj) = row[jj];
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void TransformCovariance(Rmatrix& cov, const Rmatrix& conversion,
+//       bool invert)
+//------------------------------------------------------------------------------
+/**
+ * Computes C * cov * C' in place for a state conversion matrix C, such as
+ * [dX/dS] or [dS/dK], built by the estimation state manager
+ *
+ * C is block diagonal: a 6x6 block for each spacecraft state and a diagonal
+ * entry for each other element.  The blocks that are the identity are
+ * skipped, so only the rows and columns of the converted states change.
+ *
+ * @param cov The symmetric covariance matrix to transform
+ * @param conversion The conversion matrix C
+ * @param invert Flag to use the inverse of C, taken block by block
+ */
+//------------------------------------------------------------------------------
+void Estimator::TransformCovariance(Rmatrix& cov, const Rmatrix& conversion,
+      bool invert)
+{
+   const std::vector<ListItem*> *map = esm.GetStateMap();
+   UnsignedInt size = map->size();
+
+   UnsignedInt i = 0;
+   while (i < size)
+   {
+      if (((*map)[i]->elementName == "CartesianState") ||
+          ((*map)[i]->elementName == "KeplerianState"))
+      {
+         Rmatrix66 transform(false);
+         bool isIdentity = true;
+         for (UnsignedInt row = 0U; row < 6U; ++row)
+         {
+            for (UnsignedInt col = 0U; col < 6U; ++col)
+            {
+               transform(row, col) = conversion(i + row, i + col);
+               if (transform(row, col) != (row == col ? 1.0 : 0.0))
+                  isIdentity = false;
+            }
+         }
+
+         if (!isIdentity)
+            TransformCovarianceBlock(cov, i, invert ? transform.Inverse() :
+                  transform);
+         i += 6;
+      }
+      else
+      {
+         Real factor = (invert ? 1.0 / conversion(i, i) : conversion(i, i));
+         if (factor != 1.0)
+         {
+            for (UnsignedInt j = 0; j < size; ++j)
+            {
+               cov(i, j) *= factor;
+               cov(j, i) *= factor;
+            }
+         }
+         ++i;
+      }
+   }
+}
+
+
 Real Estimator::ObservationDataCorrection(Real cValue, Real oValue, Real moduloConstant)
 {
    Real delta = cValue - oValue;
@@ -4548,6 +4797,45 @@ void Estimator::BuildMeasurementLine(const MeasurementInfoType &measStat)
 }
 
 
+//------------------------------------------------------------------------------
+// void StartReportBuffering()
+//------------------------------------------------------------------------------
+/**
+ * Routes the report file text through the report buffer.
+ *
+ * The report is formatted into memory and written to the file in large
+ * batches on a background thread, so the flushes after each report line and
+ * section do not wait for the file.  StopReportBuffering() must be called
+ * before the file is closed.
+ */
+//------------------------------------------------------------------------------
+void Estimator::StartReportBuffering()
+{
+   if (!textFile.is_open())
+      return;
+
+   if (reportBuffer == NULL)
+      reportBuffer = new AsyncStreamBuffer;
+   if (!reportBuffer->IsAttached())
+      reportBuffer->Attach(textFile);
+}
+
+
+//------------------------------------------------------------------------------
+// void StopReportBuffering()
+//------------------------------------------------------------------------------
+/**
+ * Writes all of the buffered report text to the file and returns the report
+ * file to direct writing.
+ */
+//------------------------------------------------------------------------------
+void Estimator::StopReportBuffering()
+{
+   if (reportBuffer != NULL)
+      reportBuffer->Detach();
+}
+
+
 //------------------------------------------------------------------------------
 // void WriteMeasurementLine(Integer recNum)
 //------------------------------------------------------------------------------
@@ -4611,18 +4899,20 @@ bool Estimator::AddMatData(DataBucket &data, Integer index)
 
       if (!isJagged)
       {
-         // Transpose the array to make it row major
-         RealArray temp(data.realValues[i].size(), 0.0);
-         std::vector<RealArray> transpose;
+         // Transpose the array to make it row major, filling each column in
+         // place; the bucket is cleared below, so the result replaces it
+         std::vector<RealArray> &rows = data.realValues[i];
+         UnsignedInt rowCount = rows.size();
+         UnsignedInt colCount = (rowCount > 0 ? rows[0].size() : 0);
+         std::vector<RealArray> transpose(colCount, RealArray(rowCount));
 
-         for (UnsignedInt j = 0; j < data.realValues[i][0].size(); ++j)
+         for (UnsignedInt k = 0; k < rowCount; ++k)
          {
-            for (UnsignedInt k = 0; k < data.realValues[i].size(); ++k)
-               temp[k] = data.realValues[i][k][j];
-
-            transpose.push_back(temp);
+            const RealArray &row = rows[k];
+            for (UnsignedInt j = 0; j < colCount; ++j)
+               transpose[j][k] = row[j];
          }
-         data.realValues[i] = transpose;
+         rows.swap(transpose);
       }
 
       writerData->AddData(data.realValues[i], isJagged);
@@ -4642,7 +4932,7 @@ bool Estimator::AddMatData(DataBucket &data, Integer index)
                data.stringValues[i][0].c_str());
       #endif
 
-      strData = data.stringValues[i];
+      strData.swap(data.stringValues[i]);
 
       #ifdef DEBUG_MAT_WRITER
          MessageInterface::ShowMessage("   strData has %d entries\n",
@@ -4657,18 +4947,15 @@ bool Estimator::AddMatData(DataBucket &data, Integer index)
 
       if (!isJagged)
       {
-         // Transpose the array to make it row major
-         StringArray temp(strData.size(), "");
-         std::vector<StringArray> transpose;
-
-         for (UnsignedInt j = 0; j < strData[0].size(); ++j)
-         {
-            for (UnsignedInt k = 0; k < strData.size(); ++k)
-               temp[k] = data.stringValues[i][k][j];
+         // Transpose the array to make it row major, moving the strings
+         UnsignedInt rowCount = strData.size();
+         UnsignedInt colCount = (rowCount > 0 ? strData[0].size() : 0);
+         std::vector<StringArray> transpose(colCount, StringArray(rowCount));
 
-            transpose.push_back(temp);
-         }
-         strData = transpose;
+         for (UnsignedInt k = 0; k < rowCount; ++k)
+            for (UnsignedInt j = 0; j < colCount; ++j)
+               transpose[j][k].swap(strData[k][j]);
+         strData.swap(transpose);
       }
 
       writerData->AddData(strData, isJagged);
@@ -4687,11 +4974,7 @@ bool Estimator::AddMatData(DataBucket &data, Integer index)
    for (UnsignedInt i = 0; i < data.string3DNames.size(); ++i)
    {
       writerData = matWriter->GetContainer(Gmat::STRING_TYPE, data.string3DNames[i]);
-      std::vector<std::vector<StringArray>> str3DData;
-
-      str3DData = data.string3DValues[i];
-
-      writerData->AddData(str3DData);
+      writerData->AddData(data.string3DValues[i]);
       containers.push_back(writerData);
    }
 
@@ -4878,14 +5161,15 @@ void Estimator::AddMatlabData(const MeasurementInfoType &measStat,
          matData.realValues[matIndex["MeasNum"]][matMeasIndex][0] = measStat.recNum;
          matData.realValues[matIndex["Resid"]][matMeasIndex] = measStat.residual;
 
-         for (UnsignedInt k = 0; k < measStat.hAccum.size(); k++)
+         std::vector<RealArray> &partials =
+               matData.real3DValues[matIndex["Partials"]][matMeasIndex];
+         partials.assign(measStat.hAccum.begin(), measStat.hAccum.end());
+         for (UnsignedInt k = 0; k < partials.size(); k++)
          {
-            RealArray derivatives = measStat.hAccum[k];
+            RealArray &derivatives = partials[k];
 
             for (UnsignedInt p = 0; p < derivatives.size(); p++)
                derivatives[p] /= GetEpsilonConversion(p);
-
-            matData.real3DValues[matIndex["Partials"]][matMeasIndex].push_back(derivatives);
          }
 
          if (measStat.editFlag == NORMAL_FLAG)
@@ -5032,10 +5316,10 @@ void Estimator::AddMatlabIterationData()
          matData.real2DArrayValues[matIndex["KeplState"]].push_back({ currentSolveForStateK[ii] });
       }
 
-      // GTDS MathSpec Eq 8-45, 8-46a, and 8-46b
-      Rmatrix dX_dS = cart2SolvMatrix;                               // [dX/dS] matrix, where S is solve-for state. It could Cartesian or Keplerian
+      // GTDS MathSpec Eq 8-45, 8-46a, and 8-46b, with [dX/dS] = cart2SolvMatrix, where S is solve-for state. It could Cartesian or Keplerian
       // GTDS MathSpec Eq 8-49
-      Rmatrix finalCovariance = dX_dS * informationInverse * dX_dS.Transpose(); // finalCovariance is in Cartesian state
+      Rmatrix finalCovariance = informationInverse;
+      TransformCovariance(finalCovariance, cart2SolvMatrix);        // finalCovariance is in Cartesian state
 
       // 2.3. Convert covariance matrix for Cr_Epsilon and Cd_Epsilon to covariance matrix for Cr and Cd
       CovarianceEpsilonConversion(finalCovariance);
@@ -5045,11 +5329,12 @@ void Estimator::AddMatlabIterationData()
          for (Integer j = 0; j < finalCovariance.GetNumColumns(); ++j)
             finalCorrelation(i, j) /= sqrt(finalCovariance(i, i)*finalCovariance(j, j));
 
-      Rmatrix convmatrix = solv2KeplMatrix.Inverse();                            // GTDS MathSpec Eq 8-45, 8-46a, and 8-46b
+      // [dK/dS] is the inverse of solv2KeplMatrix                                // GTDS MathSpec Eq 8-45, 8-46a, and 8-46b
 
       // 4. Write final covariance and correlation matrix for Keplerian coordinate system:
       // 4.1. Calculate covariance matrix w.r.t. Cr_Epsilon and Cd_Epsilon
-      Rmatrix finalKeplerCovariance = convmatrix * informationInverse * convmatrix.Transpose();          // Equation 8-49 GTDS MathSpec
+      Rmatrix finalKeplerCovariance = informationInverse;
+      TransformCovariance(finalKeplerCovariance, solv2KeplMatrix, true);          // Equation 8-49 GTDS MathSpec
 
       // 4.2. Convert covariance matrix for Cr_Epsilon and Cd_Epsilon to covariance matrix for Cr and Cd
       CovarianceEpsilonConversion(finalKeplerCovariance);
@@ -5677,6 +5962,7 @@ void Estimator::WriteToTextFile(Solver::SolverState sState)
    
    if (!textFile.is_open())
       OpenSolverTextFile();
+   StartReportBuffering();
    
    Solver::SolverState theState = sState;
    if (sState == Solver::UNDEFINED_STATE)
@@ -10289,8 +10575,9 @@ void Estimator::WriteReportFileSummaryPart3(Solver::SolverState sState)
 
    // covariance matrix w.r.t. Cr_Epsilon and Cd_Epsilon
    // GTDS MatSpec Eq 8-45
-   Rmatrix dX_dS = cart2SolvMatrix;                                      // [dX/dS] matrix where S is solve-for state. X is Cartesian state
-   Rmatrix covar = dX_dS * informationInverse * dX_dS.Transpose();       // GTDS MatSpec Eq 8-49
+   // [dX/dS] = cart2SolvMatrix where S is solve-for state. X is Cartesian state
+   Rmatrix covar = informationInverse;
+   TransformCovariance(covar, cart2SolvMatrix);                          // GTDS MatSpec Eq 8-49
 
    // covariance matrix w.r.t. Cr and Cd
    CovarianceEpsilonConversion(covar);
@@ -10385,13 +10672,14 @@ void Estimator::WriteReportFileSummaryPart3(Solver::SolverState sState)
    
 
    // 8. Calculate matrix [dK/dS]
-   Rmatrix dK_dS = solv2KeplMatrix.Inverse();     // GTDS MathSpec 8-45, 8-46a, and 8-46b
+   // [dK/dS] is the inverse of solv2KeplMatrix   // GTDS MathSpec 8-45, 8-46a, and 8-46b
 
    
    // 9. Write Keplerian state
    // 9.1. Calculate Keplerian covariance matrix
    //Rmatrix keplerianCovar = convmatrix * covar * convmatrix.Transpose();                 // Equation 8-49 GTDS MathSpec
-   Rmatrix keplerianCovar = dK_dS * informationInverse * dK_dS.Transpose();                // Equation 8-49 GTDS MathSpec
+   Rmatrix keplerianCovar = informationInverse;
+   TransformCovariance(keplerianCovar, solv2KeplMatrix, true);                            // Equation 8-49 GTDS MathSpec
 
    // 9.2. Write Keplerian apriori, previous, current states
    std::vector<std::string> nameList;
@@ -10622,10 +10910,9 @@ void Estimator::WriteReportFileSummaryPart4(Solver::SolverState sState)
 
    // 2.2 Get covariance matrix w.r.t. Cr_Epsilon and Cd_Epsilon 
    Rmatrix finalCovariance = informationInverse;                  // Note that: information is in solve-for state
-   // GTDS MathSpec Eq 8-45, 8-46a, and 8-46b
-   Rmatrix dX_dS = cart2SolvMatrix;                               // [dX/dS] matrix, where S is solve-for state. It could Cartesian or Keplerian
+   // GTDS MathSpec Eq 8-45, 8-46a, and 8-46b, with [dX/dS] = cart2SolvMatrix, where S is solve-for state. It could Cartesian or Keplerian
    // GTDS MathSpec Eq 8-49
-   finalCovariance = dX_dS * finalCovariance * dX_dS.Transpose(); // finalCovariance is in Cartesian state
+   TransformCovariance(finalCovariance, cart2SolvMatrix);        // finalCovariance is in Cartesian state
 
    // 2.3. Convert covariance matrix for Cr_Epsilon and Cd_Epsilon to covariance matrix for Cr and Cd
    CovarianceEpsilonConversion(finalCovariance);
@@ -10647,11 +10934,12 @@ void Estimator::WriteReportFileSummaryPart4(Solver::SolverState sState)
 
 
    // 3. Calculate converison derivative matrix [dK/dS] from solve-for state to Keplerian state
-   Rmatrix convmatrix = solv2KeplMatrix.Inverse();                            // GTDS MathSpec Eq 8-45, 8-46a, and 8-46b
+   // [dK/dS] is the inverse of solv2KeplMatrix                                // GTDS MathSpec Eq 8-45, 8-46a, and 8-46b
 
    // 4. Write final covariance and correlation matrix for Keplerian coordinate system:
    // 4.1. Calculate covariance matrix w.r.t. Cr_Epsilon and Cd_Epsilon
-   Rmatrix finalKeplerCovariance = convmatrix * informationInverse * convmatrix.Transpose();          // Equation 8-49 GTDS MathSpec
+   Rmatrix finalKeplerCovariance = informationInverse;
+   TransformCovariance(finalKeplerCovariance, solv2KeplMatrix, true);          // Equation 8-49 GTDS MathSpec
 
    // 4.2. Convert covariance matrix for Cr_Epsilon and Cd_Epsilon to covariance matrix for Cr and Cd
    CovarianceEpsilonConversion(finalKeplerCovariance);
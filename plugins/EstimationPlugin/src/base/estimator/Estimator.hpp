@@ -39,6 +39,7 @@
 #include "PropSetup.hpp"
 #include "DataWriter.hpp"
 #include "DataBucket.hpp"
+#include "AsyncStreamBuffer.hpp"
 #include "TimeSystemConverter.hpp"   // for the TimeSystemConverter singleton
 #include "CholeskyFactorization.hpp"
 #include "QRFactorization.hpp"
@@ -150,6 +151,7 @@ public:
    virtual ObjectArray& GetRefObjectArray(const std::string& typeString);
 
    virtual Real         GetTimeStep();
+   virtual bool         GetObservationGroupEnd(GmatTime &groupEnd);
 
    virtual bool         TakeAction(const std::string &action,
                                    const std::string &actionData = "");
@@ -366,6 +368,10 @@ protected:
    /// particicpants column length. It is used for writing report file
    Integer                 pcolumnLen;
 
+   /// Buffer that collects the report file text and writes it on a
+   /// background thread
+   AsyncStreamBuffer       *reportBuffer;
+
    /// The .mat DataWriter object used to write data for MATLAB
    DataWriter              *matWriter;
    /// Flag indicating is the .mat file should be written
@@ -403,6 +409,9 @@ protected:
    /// List of estimation data filters
    StringArray dataFilterStrings;
    ObjectArray dataFilterObjs;
+   /// Indices of the reject and accept filters in dataFilterObjs
+   IntegerArray rejectFilterIndices;
+   IntegerArray acceptFilterIndices;
    IntegerArray editedRecords;             // flag indicating an observation data record used for calculating estimation
 
    /// Time converter singleton
@@ -513,6 +522,10 @@ protected:
 
    virtual ObservationData*
                            FilteringData(ObservationData* obsData, Integer obDataId, Integer& filterIndex);
+   virtual Integer         FilteringData(std::vector<ObservationData*> &block,
+                                         const IntegerArray &obDataIds,
+                                         IntegerArray &filterIndices);
+   void                    CompileDataFilters();
 
    /// Abstract method that performs the estimation in derived classes
    virtual void            Estimate() = 0;
@@ -528,6 +541,10 @@ protected:
    void                    CovarianceEpsilonConversionReverse(Rmatrix& cov);
    void                    CartesianCovarianceRotation(Rmatrix& cov, bool allStatesCart);
    Rmatrix                 GetCovarianceVNB(const Rmatrix& inCov);
+   void                    TransformCovarianceBlock(Rmatrix& cov, UnsignedInt start,
+                                 const Rmatrix66& transform);
+   void                    TransformCovariance(Rmatrix& cov, const Rmatrix& conversion,
+                                 bool invert = false);
 
    virtual bool           SetNominalValues();
    virtual void           UpdateCovarianceNominalValues(RealArray prevEpsilonConversions);
@@ -561,6 +578,8 @@ protected:
 
    virtual void            WriteToTextFile(Solver::SolverState state =
                                               Solver::UNDEFINED_STATE);
+   void                    StartReportBuffering();
+   void                    StopReportBuffering();
 
    // Report File functions
    virtual void           WriteReportFileHeaderPart1();
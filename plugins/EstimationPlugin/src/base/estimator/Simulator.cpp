@@ -41,7 +41,21 @@
 #include "StringUtil.hpp"
 #include "ODEModel.hpp"
 #include "Propagator.hpp"
+#include "FileManager.hpp"
+#include "RandomNumber.hpp"
 #include <sstream>
+#include <fstream>
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+
+#if !defined(_WIN32)
+   #define SIMULATOR_USE_FORK
+   #include <unistd.h>
+   #include <sys/types.h>
+   #include <sys/wait.h>
+   #include <signal.h>
+#endif
 
 //#define DEBUG_STATE_MACHINE
 //#define DEBUG_SIMULATOR_WRITE
@@ -66,6 +80,7 @@ Simulator::PARAMETER_TEXT[SimulatorParamCount -SolverParamCount] =
    "FinalEpoch",
    "MeasurementTimeStep",
    "AddNoise",
+   "ParallelWorkers",
 };
 
 const Gmat::ParameterType
@@ -78,6 +93,7 @@ Simulator::PARAMETER_TYPE[SimulatorParamCount - SolverParamCount] =
    Gmat::STRING_TYPE,
    Gmat::REAL_TYPE,
    Gmat::ON_OFF_TYPE,
+   Gmat::INTEGER_TYPE,
 };
 
 //------------------------------------------------------------------------------
@@ -109,6 +125,9 @@ Simulator::Simulator(const std::string& name) :
    locatingEvent       (false),
    timeStep            (60.0),
    addNoise            (false),
+   parallelWorkers     (1),
+   workerCount         (1),
+   workerIndex         (0),
    isEpochFormatSet    (false)
 {
    objectTypes.push_back(GmatType::GetTypeId("Simulator"));
@@ -157,6 +176,9 @@ Simulator::Simulator(const Simulator& sim) :
    measManager         (sim.measManager),
    measList            (sim.measList),
    addNoise            (sim.addNoise),
+   parallelWorkers     (sim.parallelWorkers),
+   workerCount         (1),
+   workerIndex         (0),
    isEpochFormatSet    (sim.isEpochFormatSet)
 {
    theTimeConverter = TimeSystemConverter::Instance();
@@ -216,6 +238,11 @@ Simulator& Simulator::operator=(const Simulator& sim)
       measManager         = sim.measManager;
       measList            = sim.measList;
       addNoise            = sim.addNoise;
+      parallelWorkers     = sim.parallelWorkers;
+      workerCount         = 1;
+      workerIndex         = 0;
+      workerProcessIds.clear();
+      workerStreamNames.clear();
       isEpochFormatSet    = sim.isEpochFormatSet;
    }
 
@@ -309,6 +336,10 @@ void Simulator::WriteToTextFile(SolverState stateToUse)
    if (!showProgress)
       return;
 
+   // Only the process running the mission reports progress
+   if (workerIndex > 0)
+      return;
+
    if (!textFile.is_open())
       OpenSolverTextFile();
 
@@ -523,11 +554,11 @@ Integer Simulator::GetParameterID(const std::string &str) const
    if ((str1 == "ShowProgress")||(str1 == "ReportFile")||(str1 == "ReportStyle")||(str1 == "MaximumIterations"))
       throw SolverException("Syntax error: simulator '" + GetName() + "' does not has parameter '" + str1 + "'.\n");
 
-   for (Integer i = SolverParamCount; i < SimulatorParamCount; i++)
-   {
-      if (str1 == PARAMETER_TEXT[i - SolverParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SolverParamCount, SimulatorParamCount);
+   Integer parameterId = parameterIndex.Find(str1);
+   if (parameterId != -1)
+      return parameterId;
 
    return Solver::GetParameterID(str);
 }
@@ -646,6 +677,94 @@ Real Simulator::SetRealParameter(const Integer id, const Real value)
 }
 
 
+//------------------------------------------------------------------------------
+//  Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the Integer parameter value, given the input
+ * parameter ID.
+ *
+ * @param id ID for the requested parameter.
+ *
+ * @return  Integer value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Integer Simulator::GetIntegerParameter(const Integer id) const
+{
+   if (id == PARALLEL_WORKERS)
+      return parallelWorkers;
+
+   return Solver::GetIntegerParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the Integer parameter value, given the input parameter ID.
+ *
+ * @param id         ID for the parameter whose value to change.
+ * @param value      Value for the parameter.
+ *
+ * @return  Integer value of the parameter.
+ */
+//------------------------------------------------------------------------------
+Integer Simulator::SetIntegerParameter(const Integer id, const Integer value)
+{
+   if (id == PARALLEL_WORKERS)
+   {
+      if (value < 1)
+         throw SolverException("The value entered for " + GetName() +
+               ".ParallelWorkers is not an allowed value. The allowed value "
+               "is: [Integer >= 1].");
+
+      parallelWorkers = value;
+      return parallelWorkers;
+   }
+
+   return Solver::SetIntegerParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer GetIntegerParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the Integer parameter value, given the input
+ * parameter label.
+ *
+ * @param label label for the requested parameter.
+ *
+ * @return  Integer value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Integer Simulator::GetIntegerParameter(const std::string &label) const
+{
+   return GetIntegerParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer SetIntegerParameter(const std::string &label, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the Integer parameter value, given the input parameter
+ * label.
+ *
+ * @param label      label for the parameter whose value to change.
+ * @param value      Value for the parameter.
+ *
+ * @return  Integer value of the parameter.
+ */
+//------------------------------------------------------------------------------
+Integer Simulator::SetIntegerParameter(const std::string &label,
+                                       const Integer value)
+{
+   return SetIntegerParameter(GetParameterID(label), value);
+}
+
+
 //------------------------------------------------------------------------------
 //  std::string GetStringParameter(const Integer id) const
 //------------------------------------------------------------------------------
@@ -1859,6 +1978,11 @@ void Simulator::CompleteInitialization()
    // tell the measManager to complete its initialization
    bool measOK = measManager.Initialize();
 
+   // Split the tracking configurations across worker processes if requested.
+   // This has to happen before the data streams are reopened below.
+   if (measOK)
+      StartWorkers();
+
    // Prepare for processing
    measManager.PrepareForProcessing(true);
 
@@ -2103,6 +2227,9 @@ void Simulator::RunComplete()
    // clear media correction warning lists
    ionoWarningList.clear();
    tropoWarningList.clear();
+
+   // Workers exit here; the parent merges their data files
+   FinishWorkers();
 }
 
 
@@ -2377,6 +2504,399 @@ void Simulator::UpdateCurrentEpoch(GmatTime newEpoch)
 }
 
 
+//------------------------------------------------------------------------------
+// bool IsSimulationWorker() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if this simulator is running in a worker process started by a
+ * simulator with ParallelWorkers > 1.
+ *
+ * Worker processes write their own measurement file and nothing else; they
+ * do not publish data and they exit when the simulation is complete.
+ *
+ * @return true in a worker process, false in the process running the mission
+ */
+//------------------------------------------------------------------------------
+bool Simulator::IsSimulationWorker() const
+{
+   return (workerIndex > 0);
+}
+
+
+//------------------------------------------------------------------------------
+// void EndWorkerProcess(bool succeeded)
+//------------------------------------------------------------------------------
+/**
+ * Terminates a worker process.  This method does nothing in the process
+ * running the mission.
+ *
+ * @param succeeded Flag indicating if the worker finished its simulation
+ */
+//------------------------------------------------------------------------------
+void Simulator::EndWorkerProcess(bool succeeded)
+{
+   if (workerIndex == 0)
+      return;
+
+   #ifdef SIMULATOR_USE_FORK
+      std::cout.flush();
+      fflush(NULL);
+      _exit(succeeded ? 0 : 1);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void StartWorkers()
+//------------------------------------------------------------------------------
+/**
+ * Splits the simulation across worker processes.
+ *
+ * The tracking data adapters are divided into ParallelWorkers contiguous
+ * groups.  One worker process is forked for each group after the first; the
+ * process running the mission simulates the first group.  Every process
+ * propagates the participants over the full span, but calculates only its
+ * own measurements, and writes them to its own copy of each data file.
+ * FinishWorkers() merges the copies back into the scripted files in time
+ * order, so the result is laid out as a serial run would write it.
+ *
+ * Workers are only started on systems that support fork(), and only when all
+ * of the data files are GMAT internal (.gmd) files.  Otherwise the simulation
+ * runs in this process.
+ *
+ * Each adapter draws its noise from its own counter based stream.  The stream
+ * seed is drawn here, before any worker starts, so a seeded run gives the
+ * same noise whatever the number of workers, and successive simulations do
+ * not repeat it.
+ */
+//------------------------------------------------------------------------------
+void Simulator::StartWorkers()
+{
+   workerCount = 1;
+   workerIndex = 0;
+   workerProcessIds.clear();
+   workerStreamNames.clear();
+   measManager.SetActiveAdapters(0);
+
+   RandomNumber *rn = RandomNumber::Instance();
+   rn->ResetStreams((unsigned int)(rn->Uniform() * 4294967295.0));
+
+   if (parallelWorkers < 2)
+      return;
+
+   #ifdef SIMULATOR_USE_FORK
+      Integer adapterCount =
+            (Integer)measManager.GetAllTrackingDataAdapters().size();
+      Integer workers = (parallelWorkers < adapterCount ? parallelWorkers :
+                         adapterCount);
+      if (workers < 2)
+         return;
+
+      const std::vector<DataFile*> &streams = measManager.GetStreamObjects();
+      for (UnsignedInt i = 0; i < streams.size(); ++i)
+      {
+         if (streams[i]->GetStringParameter("Format") != "GMATInternal")
+         {
+            MessageInterface::ShowMessage("Warning: %s.ParallelWorkers is "
+                  "ignored because DataFile '%s' does not write a GMAT "
+                  "internal data file\n", instanceName.c_str(),
+                  streams[i]->GetName().c_str());
+            return;
+         }
+      }
+
+      // The streams were opened on the scripted names when the measurement
+      // manager initialized; close them so each process reopens its own file
+      for (UnsignedInt i = 0; i < streams.size(); ++i)
+         streams[i]->CloseStream();
+
+      // Buffered output would otherwise be written by every worker
+      if (textFile.is_open())
+         textFile.flush();
+      std::cout.flush();
+      fflush(NULL);
+
+      for (Integer w = 1; w < workers; ++w)
+      {
+         pid_t pid = fork();
+         if (pid == 0)
+         {
+            workerIndex = w;
+            workerProcessIds.clear();
+            break;
+         }
+
+         if (pid < 0)
+         {
+            // Could not start all of the workers; stop the ones that did
+            // start and simulate everything here
+            for (UnsignedInt i = 0; i < workerProcessIds.size(); ++i)
+            {
+               kill((pid_t)workerProcessIds[i], SIGTERM);
+               waitpid((pid_t)workerProcessIds[i], NULL, 0);
+            }
+            workerProcessIds.clear();
+            MessageInterface::ShowMessage("Warning: %s could not start its "
+                  "worker processes; running the simulation in one process\n",
+                  instanceName.c_str());
+            return;
+         }
+
+         workerProcessIds.push_back((Integer)pid);
+      }
+
+      workerCount = workers;
+
+      Integer first = workerIndex * adapterCount / workers;
+      Integer last  = (workerIndex + 1) * adapterCount / workers;
+      measManager.SetActiveAdapters(first, last - first);
+
+      for (UnsignedInt i = 0; i < streams.size(); ++i)
+      {
+         workerStreamNames.push_back(
+               streams[i]->GetStringParameter("Filename"));
+         streams[i]->SetStringParameter("Filename",
+               GetWorkerStreamName(workerStreamNames[i], workerIndex));
+      }
+
+      if (workerIndex == 0)
+         MessageInterface::ShowMessage("%s is simulating %d tracking "
+               "configurations in %d processes\n", instanceName.c_str(),
+               adapterCount, workers);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void FinishWorkers()
+//------------------------------------------------------------------------------
+/**
+ * Ends a split simulation.
+ *
+ * Worker processes exit here.  The process running the mission waits for its
+ * workers, restores the scripted data file names, and merges the per-worker
+ * files into them.
+ */
+//------------------------------------------------------------------------------
+void Simulator::FinishWorkers()
+{
+   if (workerIndex > 0)
+      EndWorkerProcess(true);
+
+   if (workerCount < 2)
+      return;
+
+   bool workersOK = true;
+   #ifdef SIMULATOR_USE_FORK
+      for (UnsignedInt i = 0; i < workerProcessIds.size(); ++i)
+      {
+         int status = 0;
+         if ((waitpid((pid_t)workerProcessIds[i], &status, 0) < 0) ||
+             !WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+            workersOK = false;
+      }
+   #endif
+   workerProcessIds.clear();
+
+   const std::vector<DataFile*> &streams = measManager.GetStreamObjects();
+   for (UnsignedInt i = 0; i < streams.size(); ++i)
+      streams[i]->SetStringParameter("Filename", workerStreamNames[i]);
+
+   if (!workersOK)
+   {
+      workerCount = 1;
+      throw SolverException("Error: a worker process of simulator " +
+            instanceName + " failed; the partial measurement files were "
+            "not merged\n");
+   }
+
+   StringArray merged;
+   for (UnsignedInt i = 0; i < workerStreamNames.size(); ++i)
+   {
+      if (find(merged.begin(), merged.end(), workerStreamNames[i]) !=
+            merged.end())
+         continue;
+      merged.push_back(workerStreamNames[i]);
+
+      if (!MergeWorkerFiles(workerStreamNames[i]))
+      {
+         workerCount = 1;
+         throw SolverException("Error: simulator " + instanceName +
+               " could not merge the worker files for " +
+               workerStreamNames[i] + "\n");
+      }
+   }
+
+   workerCount = 1;
+}
+
+
+//------------------------------------------------------------------------------
+// bool MergeWorkerFiles(const std::string &streamName)
+//------------------------------------------------------------------------------
+/**
+ * Merges the per-worker copies of a data file into the file.
+ *
+ * The data lines are merged by epoch.  Lines with the same epoch are taken
+ * from the lower numbered worker first, which preserves the serial adapter
+ * order because each worker holds a contiguous group of adapters.  The
+ * header is copied from the first worker's file.  The per-worker files are
+ * removed after the merge.
+ *
+ * @param streamName The scripted file name of the data file
+ *
+ * @return true on success, false if a file could not be opened
+ */
+//------------------------------------------------------------------------------
+bool Simulator::MergeWorkerFiles(const std::string &streamName)
+{
+   std::vector<std::ifstream*> parts;
+   StringArray partPaths, current;
+   std::vector<Real> epochs;
+   std::vector<bool> hasLine;
+   bool retval = true;
+
+   for (Integer w = 0; w < workerCount; ++w)
+   {
+      partPaths.push_back(GetStreamPath(GetWorkerStreamName(streamName, w)));
+      parts.push_back(new std::ifstream(partPaths.back().c_str()));
+      if (!parts.back()->is_open())
+         retval = false;
+   }
+
+   std::ofstream target;
+   if (retval)
+   {
+      target.open(GetStreamPath(streamName).c_str());
+      retval = target.is_open();
+   }
+
+   if (retval)
+   {
+      // Read past the headers, keeping the first worker's
+      for (Integer w = 0; w < workerCount; ++w)
+      {
+         std::string line;
+         bool found = false;
+         while (std::getline(*parts[w], line))
+         {
+            std::string trimmed = GmatStringUtil::Trim(line);
+            if ((trimmed == "") || (trimmed[0] == '%'))
+            {
+               if (w == 0)
+                  target << line << "\n";
+               continue;
+            }
+            found = true;
+            break;
+         }
+         current.push_back(line);
+         epochs.push_back(found ? atof(line.c_str()) : 0.0);
+         hasLine.push_back(found);
+      }
+
+      while (true)
+      {
+         Integer next = -1;
+         for (Integer w = 0; w < workerCount; ++w)
+         {
+            if (hasLine[w] && ((next < 0) || (epochs[w] < epochs[next])))
+               next = w;
+         }
+         if (next < 0)
+            break;
+
+         target << current[next] << "\n";
+         hasLine[next] = false;
+         while (std::getline(*parts[next], current[next]))
+         {
+            if (GmatStringUtil::Trim(current[next]) == "")
+               continue;
+            epochs[next] = atof(current[next].c_str());
+            hasLine[next] = true;
+            break;
+         }
+      }
+
+      target.close();
+   }
+
+   for (Integer w = 0; w < workerCount; ++w)
+   {
+      parts[w]->close();
+      delete parts[w];
+      if (retval)
+         remove(partPaths[w].c_str());
+   }
+
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetWorkerStreamName(const std::string &streamName,
+//                                 Integer worker)
+//------------------------------------------------------------------------------
+/**
+ * Builds the name of a worker's copy of a data file, e.g. Sim_worker2.gmd for
+ * Sim.gmd
+ *
+ * @param streamName The scripted file name
+ * @param worker     The worker index
+ *
+ * @return The worker's file name
+ */
+//------------------------------------------------------------------------------
+std::string Simulator::GetWorkerStreamName(const std::string &streamName,
+                                           Integer worker)
+{
+   std::string suffix = "_worker" + GmatStringUtil::ToString(worker, 1);
+
+   size_t dotLoc = streamName.find_last_of('.');
+   size_t slashLoc = streamName.find_last_of("/\\");
+   if ((dotLoc == std::string::npos) ||
+       ((slashLoc != std::string::npos) && (dotLoc < slashLoc)))
+      return streamName + suffix;
+
+   return streamName.substr(0, dotLoc) + suffix + streamName.substr(dotLoc);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetStreamPath(const std::string &streamName)
+//------------------------------------------------------------------------------
+/**
+ * Resolves a data file name the way GmatObType::Open() does: names without a
+ * path are placed in the measurement directory, and an extension-less name
+ * gets the .gmd extension.
+ *
+ * @param streamName The data file name
+ *
+ * @return The full path of the data file
+ */
+//------------------------------------------------------------------------------
+std::string Simulator::GetStreamPath(const std::string &streamName)
+{
+   std::string fullPath = "";
+
+   if ((streamName.find('/') == std::string::npos) &&
+       (streamName.find('\\') == std::string::npos))
+      fullPath = FileManager::Instance()->GetPathname(
+            FileManager::MEASUREMENT_PATH);
+   fullPath += streamName;
+
+   size_t dotLoc = fullPath.find_last_of('.');
+   size_t slashLoc = fullPath.find_last_of('/');
+   if (slashLoc == std::string::npos)
+      slashLoc = fullPath.find_last_of('\\');
+
+   if ((dotLoc == std::string::npos) || (dotLoc < slashLoc))
+      fullPath += ".gmd";
+
+   return fullPath;
+}
+
+
 //------------------------------------------------------------------------------
 // unused methods
 //------------------------------------------------------------------------------
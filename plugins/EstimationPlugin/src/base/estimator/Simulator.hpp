@@ -85,6 +85,13 @@ public:
    virtual Real         SetRealParameter(const Integer id,
                                          const Real value);
 
+   virtual Integer      GetIntegerParameter(const Integer id) const;
+   virtual Integer      SetIntegerParameter(const Integer id,
+                                            const Integer value);
+   virtual Integer      GetIntegerParameter(const std::string &label) const;
+   virtual Integer      SetIntegerParameter(const std::string &label,
+                                            const Integer value);
+
    virtual std::string  GetStringParameter(const Integer id) const;
    virtual bool         SetStringParameter(const Integer id,
                                            const std::string &value);
@@ -136,6 +143,9 @@ public:
 
    virtual void         UpdateCurrentEpoch(GmatTime newEpoch);
 
+   bool                 IsSimulationWorker() const;
+   void                 EndWorkerProcess(bool succeeded);
+
    virtual bool         HasLocalClones();
    virtual void         UpdateClonedObject(GmatBase *obj);
    virtual void         UpdateClonedObjectParameter(GmatBase *obj,
@@ -152,6 +162,7 @@ protected:
       FINAL_EPOCH,
       MEASUREMENT_TIME_STEP,
       ADD_NOISE,
+      PARALLEL_WORKERS,
       SimulatorParamCount
    };
    /// Script strings associated with the parameters
@@ -219,6 +230,17 @@ protected:
    /// Flag to indicate option to add noise to calculated measurement
    bool                addNoise;
 
+   /// Number of processes the tracking data adapters are split across
+   Integer             parallelWorkers;
+   /// Number of worker processes actually running this simulation
+   Integer             workerCount;
+   /// Index of this process in a split simulation; 0 for the parent process
+   Integer             workerIndex;
+   /// Process IDs of the workers started by the parent process
+   IntegerArray        workerProcessIds;
+   /// Data file names before they were redirected to the per-worker files
+   StringArray         workerStreamNames;
+
    /**
     *  The time step that gets returned for the next propagation
     *
@@ -253,6 +275,12 @@ protected:
    GmatTime               ConvertToGmatTimeEpoch(const std::string &theEpoch,
                                                  const std::string &theFormat);
    void                   FindNextSimulationEpoch();
+   void                   StartWorkers();
+   void                   FinishWorkers();
+   bool                   MergeWorkerFiles(const std::string &streamName);
+   static std::string     GetWorkerStreamName(const std::string &streamName,
+                                              Integer worker);
+   static std::string     GetStreamPath(const std::string &streamName);
    // progress string for reporting
    virtual std::string    GetProgressString();
 
@@ -33,6 +33,7 @@
 #include "EstimationRootFinder.hpp"
 #include "MessageInterface.hpp"
 #include "GmatConstants.hpp"
+#include <algorithm>
 
 
 //#define DEBUG_ROOT_SEARCH
@@ -47,7 +48,9 @@
  */
 //------------------------------------------------------------------------------
 EstimationRootFinder::EstimationRootFinder() :
-   propagator        (NULL)
+   propagator        (NULL),
+   evaluationCount   (0),
+   propagationCount  (0)
 {
 }
 
@@ -94,7 +97,10 @@ void EstimationRootFinder::CleanUp()
  * Copy constructor
  */
 //------------------------------------------------------------------------------
-EstimationRootFinder::EstimationRootFinder(const EstimationRootFinder& rl)
+EstimationRootFinder::EstimationRootFinder(const EstimationRootFinder& rl) :
+   propagator        (NULL),
+   evaluationCount   (0),
+   propagationCount  (0)
 {
 }
 
@@ -115,6 +121,8 @@ EstimationRootFinder& EstimationRootFinder::operator =(const EstimationRootFinde
    if (this != &rl)
    {
       propagator = NULL;
+      evaluationCount = 0;
+      propagationCount = 0;
    }
 
    return *this;
@@ -236,6 +244,138 @@ Real EstimationRootFinder::Locate(ObjectArray &whichOnes)
 }
 
 
+//------------------------------------------------------------------------------
+// Real LocateTogether(ObjectArray &whichOnes)
+//------------------------------------------------------------------------------
+/**
+ * Probes a set of events from one propagation
+ *
+ * The events are ordered by their step to the probe epoch, fixed plus
+ * variable.  The propagator steps from one distinct probe to the next, the
+ * participants are updated once per probe, and each event at that probe is
+ * evaluated from the shared states before the next step.  The next time step
+ * estimate of each event is then computed.  A single event takes the same
+ * step from the starting state that FindRoot() takes.
+ *
+ * @param whichOnes The events to probe
+ *
+ * @return The epoch of the earliest probe, or -1.0 if there were no events
+ */
+//------------------------------------------------------------------------------
+Real EstimationRootFinder::LocateTogether(ObjectArray &whichOnes)
+{
+   #ifdef DEBUG_ROOT_SEARCH
+      MessageInterface::ShowMessage("EstimationRootFinder::LocateTogether "
+            "called with %d events\n", whichOnes.size());
+   #endif
+   Real rootEpoch = -1.0;
+
+   events = (std::vector<Event*>*)(&whichOnes);
+
+   std::vector<std::pair<Real, UnsignedInt> > probes;
+   for (UnsignedInt i = 0; i < events->size(); ++i)
+      probes.push_back(std::make_pair((*events)[i]->GetFixedTimestep() +
+            (*events)[i]->GetVarTimestep(), i));
+   std::stable_sort(probes.begin(), probes.end());
+
+   Real stepTaken = 0.0;
+   Real probeEpoch = -1.0;
+   for (UnsignedInt k = 0; k < probes.size(); ++k)
+   {
+      Event *current = (*events)[probes[k].second];
+
+      if ((k == 0) || (probes[k].first != stepTaken))
+      {
+         propagator->GetPropagator()->Step(probes[k].first - stepTaken);
+         stepTaken = probes[k].first;
+         ++propagationCount;
+
+         probeEpoch = current->GetFixedEpoch() +
+               current->GetVarTimestep() / GmatTimeConstants::SECS_PER_DAY;
+         propagator->GetODEModel()->UpdateSpaceObject(probeEpoch);
+
+         #ifdef DEBUG_ROOT_SEARCH
+            MessageInterface::ShowMessage("   Probe at step %.15lf sec, epoch "
+                  "%.12lf\n", stepTaken, probeEpoch);
+         #endif
+      }
+
+      current->Evaluate();
+      ++evaluationCount;
+      current->EstimateTimestep();
+
+      if (probeEpoch > 0.0)
+         rootEpoch = (rootEpoch == -1.0 ? probeEpoch :
+                      (rootEpoch > probeEpoch ? probeEpoch : rootEpoch));
+   }
+
+   return rootEpoch;
+}
+
+
+//------------------------------------------------------------------------------
+// void EvaluateAll(ObjectArray &whichOnes)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates a set of events from the current participant states
+ *
+ * @param whichOnes The events to evaluate
+ */
+//------------------------------------------------------------------------------
+void EstimationRootFinder::EvaluateAll(ObjectArray &whichOnes)
+{
+   for (UnsignedInt i = 0; i < whichOnes.size(); ++i)
+   {
+      ((Event*)whichOnes[i])->Evaluate();
+      ++evaluationCount;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetEvaluationCount() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of event function evaluations since the last reset
+ *
+ * @return The evaluation count
+ */
+//------------------------------------------------------------------------------
+Integer EstimationRootFinder::GetEvaluationCount() const
+{
+   return evaluationCount;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetPropagationCount() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of propagations to probe epochs since the last reset
+ *
+ * @return The propagation count
+ */
+//------------------------------------------------------------------------------
+Integer EstimationRootFinder::GetPropagationCount() const
+{
+   return propagationCount;
+}
+
+
+//------------------------------------------------------------------------------
+// void ResetCounts()
+//------------------------------------------------------------------------------
+/**
+ * Zeroes the evaluation and propagation counts
+ */
+//------------------------------------------------------------------------------
+void EstimationRootFinder::ResetCounts()
+{
+   evaluationCount = 0;
+   propagationCount = 0;
+}
+
+
 //------------------------------------------------------------------------------
 // Real EstimationRootFinder::FindRoot(Integer whichOne)
 //------------------------------------------------------------------------------
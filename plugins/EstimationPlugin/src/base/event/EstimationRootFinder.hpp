@@ -48,6 +48,12 @@
 
 /**
  * Locates roots in Event objects
+ *
+ * LocateTogether() advances one propagation through the probe epochs of a set
+ * of events, in step order, and evaluates every event whose probe is at the
+ * current step from the same participant states.  The event function
+ * evaluations and probe propagations are counted until ResetCounts() is
+ * called.
  */
 class ESTIMATION_API EstimationRootFinder
 {
@@ -63,6 +69,12 @@ public:
    virtual void SetPropSetup(PropSetup* ps);
    virtual void FixState(Event *thisOne);
    virtual Real Locate(ObjectArray &whichOnes);
+   virtual Real LocateTogether(ObjectArray &whichOnes);
+   virtual void EvaluateAll(ObjectArray &whichOnes);
+
+   Integer GetEvaluationCount() const;
+   Integer GetPropagationCount() const;
+   void ResetCounts();
 
 protected:
    /// The propagator used to locate the root
@@ -78,6 +90,10 @@ protected:
    std::vector<FormationInterface *>     formBuffer;
    /// The current set of events that the EstimationRootFinder is using
    std::vector<Event*> *events;
+   /// Number of event function evaluations since the counts were reset
+   Integer evaluationCount;
+   /// Number of propagations to probe epochs since the counts were reset
+   Integer propagationCount;
 
    virtual Real FindRoot(Integer whichOne);
    virtual void BufferSatelliteStates(bool fillingBuffer);
@@ -210,24 +210,22 @@ void EventManager::ClearObject(GmatBase* obj)
  * Determines if a managed event has been triggered
  *
  * This method is used to detect root crossings or extrema crossings in the
- * EventManager.  The method as provided here is a place holder for the full
- * implementation.  There is no trigger detection code in place yet.
+ * EventManager.  All of the managed events are evaluated from the current
+ * participant states, and each is then checked for a bracketed zero or
+ * extremum.
  *
- * @return true if an event was triggered, false if not.  The current
- *         implementation always returns false.
+ * @return true if an event was triggered, false if not
  */
 //-----------------------------------------------------------------------------
 bool EventManager::CheckForTrigger()
 {
    bool retval = false;
 
+   locater.EvaluateAll(events);
    for (UnsignedInt i = 0; i < events.size(); ++i)
    {
-//      Event *current = (Event*)events[i];
-//      if (current->Evaluate())
-//      {
-//
-//      }
+      if (((Event*)events[i])->CheckZero())
+         retval = true;
    }
 
    return retval;
@@ -317,11 +315,9 @@ Real EventManager::FindRoot(Integer whichOne)
                "current event list\n");
       #endif
 
-      rootTime = locater.Locate(eventList);
-
-      ((Event*)events[whichOne])->Evaluate();
-      // Now calculate the next time step estimate based on propagated states
-      ((Event*)events[whichOne])->EstimateTimestep();
+      // Propagates, evaluates the event function, and calculates the next
+      // time step estimate based on propagated states
+      rootTime = locater.LocateTogether(eventList);
 
       #ifdef DEBUG_EVENTMAN_FINDROOT
          MessageInterface::ShowMessage("   Evaluated event function; status is "
@@ -333,6 +329,76 @@ Real EventManager::FindRoot(Integer whichOne)
 }
 
 
+//-----------------------------------------------------------------------------
+// Real FindRoots()
+//-----------------------------------------------------------------------------
+/**
+ * Takes a root location step for all of the managed events together
+ *
+ * The events that probe the same epoch are evaluated from one propagation
+ * of the participants; see EstimationRootFinder::LocateTogether().
+ *
+ * @return The earliest probe epoch, or -1.0 if there are no events
+ */
+//-----------------------------------------------------------------------------
+Real EventManager::FindRoots()
+{
+   #ifdef DEBUG_EVENTMAN_FINDROOT
+      MessageInterface::ShowMessage("EventManager::FindRoots for %d events\n",
+            events.size());
+   #endif
+
+   if (events.empty())
+      return -1.0;
+
+   return locater.LocateTogether(events);
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer GetEvaluationCount() const
+//-----------------------------------------------------------------------------
+/**
+ * Retrieves the number of event function evaluations since the last reset
+ *
+ * @return The evaluation count
+ */
+//-----------------------------------------------------------------------------
+Integer EventManager::GetEvaluationCount() const
+{
+   return locater.GetEvaluationCount();
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer GetPropagationCount() const
+//-----------------------------------------------------------------------------
+/**
+ * Retrieves the number of propagations to probe epochs since the last reset
+ *
+ * @return The propagation count
+ */
+//-----------------------------------------------------------------------------
+Integer EventManager::GetPropagationCount() const
+{
+   return locater.GetPropagationCount();
+}
+
+
+//-----------------------------------------------------------------------------
+// void ResetEvaluationCount()
+//-----------------------------------------------------------------------------
+/**
+ * Zeroes the evaluation and propagation counts, for example at the start of
+ * the event location for a measurement
+ */
+//-----------------------------------------------------------------------------
+void EventManager::ResetEvaluationCount()
+{
+   locater.ResetCounts();
+}
+
+
 //-----------------------------------------------------------------------------
 // void ProcessResults()
 //-----------------------------------------------------------------------------
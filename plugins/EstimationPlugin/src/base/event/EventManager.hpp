@@ -62,9 +62,14 @@ public:
 
    virtual void SetFixedState(Event *thisOne);
    Real FindRoot(Integer whichOne);
+   Real FindRoots();
    RealArray EvaluateEvent(Integer whichOne);
    const IntegerArray& GetStatus();
 
+   Integer GetEvaluationCount() const;
+   Integer GetPropagationCount() const;
+   void ResetEvaluationCount();
+
 protected:
    /// List of events managed by this manager
    StringArray eventNames;
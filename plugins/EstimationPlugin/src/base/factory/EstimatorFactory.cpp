@@ -36,6 +36,7 @@
 // Here are the supported leaf classes
 #include "Simulator.hpp"
 #include "BatchEstimator.hpp"
+#include "BatchEstimatorSRIF.hpp"
 
 
 //---------------------------------
@@ -103,6 +104,8 @@ Solver* EstimatorFactory::CreateSolver(const std::string &ofType,
       return new Simulator(withName);
    if (ofType == "BatchEstimator")
       return new BatchEstimator(withName);
+   if (ofType == "BatchEstimatorSRIF")
+      return new BatchEstimatorSRIF(withName);
    if (ofType == "BatchEstimatorInv")
    {
       // Write deprecated message once per GMAT session
@@ -166,6 +169,7 @@ EstimatorFactory::EstimatorFactory() :
    {
       creatables.push_back("Simulator");
       creatables.push_back("BatchEstimator");
+      creatables.push_back("BatchEstimatorSRIF");
       creatables.push_back("BatchEstimatorInv"); // DEPRECATED: Renamed to BatchEstimator
 
       //creatables.push_back("BatchLeastSquares");
@@ -188,6 +192,7 @@ EstimatorFactory::EstimatorFactory() :
    }
    GmatType::RegisterType("Simulator");
    GmatType::RegisterType("BatchEstimator");
+   GmatType::RegisterType("BatchEstimatorSRIF");
 }
 
 //------------------------------------------------------------------------------
@@ -204,6 +209,7 @@ EstimatorFactory::EstimatorFactory(StringArray createList) :
 {
    GmatType::RegisterType("Simulator");
    GmatType::RegisterType("BatchEstimator");
+   GmatType::RegisterType("BatchEstimatorSRIF");
 }
 
 
@@ -150,11 +150,11 @@ RFHardware & RFHardware::operator=(const RFHardware & rfh)
 //-----------------------------------------------------------------------------
 Integer RFHardware::GetParameterID(const std::string & str) const
 {
-   for (Integer i = SensorParamCount; i < RFHardwareParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SensorParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SensorParamCount, RFHardwareParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Sensor::GetParameterID(str);
 }
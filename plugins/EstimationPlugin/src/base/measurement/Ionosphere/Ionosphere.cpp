@@ -37,6 +37,8 @@
 #include "FileManager.hpp"
 #include <fstream>
 #include <sstream>
+#include <cmath>
+#include <cstdlib>
 
 //#define DEBUG_IONOSPHERE_ELECT_DENSITY
 //#define DEBUG_IONOSPHERE_TEC
@@ -55,6 +57,14 @@ IonosphereCorrectionModel* IonosphereCorrectionModel::instance = NULL;
 const Real Ionosphere::NUM_OF_INTERVALS = 200;
 const Real Ionosphere::IONOSPHERE_MAX_ALTITUDE = 2000.0;
 
+// Cells of the density profile cache: 10 s, 0.01 degree and 1 km
+const Real Ionosphere::PROFILE_TIME_BUCKET = 10.0;
+const Real Ionosphere::PROFILE_ANGLE_CELL = 0.01;
+const Real Ionosphere::PROFILE_LENGTH_CELL = 1.0;
+const UnsignedInt Ionosphere::MAX_CACHED_PROFILES = 4096;
+
+std::mutex Ionosphere::iriMutex;
+
 //// These arrays are used for Guasian Quadratic algorithm
 //const Real Ionosphere::QUAD_WEIGHTS[20] = { 0.008807003569575835, 0.02030071490019353, 0.03133602416705452, 0.04163837078835238, 0.05096505990862025, 0.05909726598075916, 0.06584431922458829, 0.07104805465919108, 0.07458649323630191, 0.076376693565363, 0.076376693565363, 0.07458649323630191, 0.07104805465919108, 0.06584431922458829, 0.05909726598075916, 0.05096505990862025, 0.04163837078835238, 0.03133602416705452, 0.02030071490019353, 0.008807003569575835 };
 //const Real Ionosphere::QUAD_POINTS[20] = { 0.003435700407452558, 0.0180140363610431, 0.04388278587433703, 0.08044151408889055, 0.1268340467699246, 0.1819731596367425, 0.2445664990245864, 0.3131469556422902, 0.3861070744291775, 0.4617367394332513, 0.5382632605667487, 0.6138929255708225, 0.6868530443577098, 0.7554335009754136, 0.8180268403632576, 0.8731659532300754, 0.9195584859111095, 0.956117214125663, 0.981985963638957, 0.9965642995925474 };
@@ -467,15 +477,60 @@ bool Ionosphere::SetWaveLength(Real lambda)
 bool Ionosphere::SetTime(GmatEpoch ep)
 {
    epoch = ep;
+   GetIRITime(epoch, yyyy, mmdd, hours);
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void GetIRITime(GmatEpoch ep, Integer &year, Integer &monthDay,
+//       Real &hourOfDay)
+//------------------------------------------------------------------------------
+/**
+ * Converts an epoch to the UTC date and time used by IRI2007
+ *
+ * @param ep        The epoch (unit: A1Mjd)
+ * @param year      The year
+ * @param monthDay  The month and day, as mmdd
+ * @param hourOfDay The hours into the day
+ */
+//------------------------------------------------------------------------------
+void Ionosphere::GetIRITime(GmatEpoch ep, Integer &year, Integer &monthDay,
+   Real &hourOfDay)
+{
    Real temp;
    std::string time;
-   TimeSystemConverter::Instance()->Convert("A1ModJulian", epoch, "", "UTCGregorian", temp, time, 2);
-   yyyy = atoi(time.substr(0,4).c_str());
-   mmdd = atoi(time.substr(5,2).c_str())*100 + atoi(time.substr(8,2).c_str());
-   hours = atof(time.substr(11,2).c_str()) + atof(time.substr(14,2).c_str())/60 +
+   TimeSystemConverter::Instance()->Convert("A1ModJulian", ep, "", "UTCGregorian", temp, time, 2);
+   year = atoi(time.substr(0,4).c_str());
+   monthDay = atoi(time.substr(5,2).c_str())*100 + atoi(time.substr(8,2).c_str());
+   hourOfDay = atof(time.substr(11,2).c_str()) + atof(time.substr(14,2).c_str())/60 +
       atof(time.substr(17,2).c_str())/3600 + atof(time.substr(20,3).c_str())/3600000.0;
-   
-   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// SignalPath GetSignalPath() const
+//------------------------------------------------------------------------------
+/**
+ * Collects the signal path set by the Set methods
+ *
+ * @return The signal path
+ */
+//------------------------------------------------------------------------------
+Ionosphere::SignalPath Ionosphere::GetSignalPath() const
+{
+   SignalPath path;
+   path.epoch         = epoch;
+   path.yyyy          = yyyy;
+   path.mmdd          = mmdd;
+   path.hours         = hours;
+   path.stationLoc    = stationLoc;
+   path.spacecraftLoc = spacecraftLoc;
+   path.waveLength    = waveLength;
+   path.earthRadius   = earthRadius;
+
+   return path;
 }
 
 
@@ -525,14 +580,16 @@ bool Ionosphere::SetEarthRadius(Real r)
 
 
 //---------------------------------------------------------------------------
-// float ElectronDensity(Rvector3 pos2, Rvector3 pos1)
+// float ElectronDensity(const Rvector3 &pos1, const SignalPath &path,
+//       Real radius, Real flattening)
 //---------------------------------------------------------------------------
 /**
- * This function is used to calculate average electron density along
- * 2 positions.
+ * This function is used to calculate electron density at a position.
  *
- * @ param pos1 the first position in Earth fixed coordinate system (unit: km)
- * @ param pos2 the second position in Earth fixed coordinate system (unit: km)
+ * @ param pos1       the position in Earth fixed coordinate system (unit: km)
+ * @ param path       the signal path, for the time of the calculation
+ * @ param radius     Earth's equatorial radius (unit: km)
+ * @ param flattening Earth's flattening
  *
  * return value is electron density (unit: number electrons per m3)
  *
@@ -547,12 +604,9 @@ extern "C" int iri_sub__(logical *jf, integer *jmag, real *alati, real *
    along, integer *iyyyy, integer *mmdd, real *dhour, real *heibeg, real
    *heiend, real *heistp, real *outf, real *oarr, integer *ier);
 
-float Ionosphere::ElectronDensity(Rvector3 pos1)
+float Ionosphere::ElectronDensity(const Rvector3 &pos1, const SignalPath &path,
+   Real radius, Real flattening)
 {
-   CelestialBody* earth = solarSystem->GetBody("Earth");
-   Real radius = earth->GetRealParameter(earth->GetParameterID("EquatorialRadius"));
-   Real flattening = earth->GetRealParameter(earth->GetParameterID("Flattening"));
-
    Rvector6 state;
    state[0] = pos1[0]; state[1] = pos1[1]; state[2] = pos1[2];
 
@@ -585,9 +639,9 @@ float Ionosphere::ElectronDensity(Rvector3 pos1)
    
    // iy,md        date as yyyy and mmdd (or -ddd)
    // hour         decimal hours LT (or UT+25)
-   integer iy = (integer)yyyy;
-   integer md = (integer)mmdd;
-   real hour = (real)hours;
+   integer iy = (integer)path.yyyy;
+   integer md = (integer)path.mmdd;
+   real hour = (real)path.hours;
    
    // Upper and lower integration limits
    //real hbeg = (real)(pos1.GetMagnitude() - earthRadius); // 0
@@ -608,7 +662,7 @@ float Ionosphere::ElectronDensity(Rvector3 pos1)
    integer iut = 1;         // 1 for universal time; 0 for local time
 
 # ifdef DEBUG_IONOSPHERE_ELECT_DENSITY
-   MessageInterface::ShowMessage("           .At time = %lf A1Mjd:",epoch);
+   MessageInterface::ShowMessage("           .At time = %lf A1Mjd:",path.epoch);
    MessageInterface::ShowMessage("         year = %d   md = %d   hour = %lf h,   time type = %s,\n", iy, md, hour, (iut?"Universal":"Local"));
    MessageInterface::ShowMessage("              At position (x,y,z) = (%lf,  %lf,  %lf)km in Earth fixed coordinate system: ", pos1[0], pos1[1], pos1[2]);
    MessageInterface::ShowMessage("(latitude = %lf degree,  longitude = %lf degree,  attitude = %lf km,  ", latitude, longitude, hbeg);
@@ -618,7 +672,11 @@ float Ionosphere::ElectronDensity(Rvector3 pos1)
 //   iri_web__(&jmag, &jf[1], &latitude, &longitude, &iy, &md, &iut, &hour, &hbeg, &hbeg, 
 //      &ivar, &hbeg, &hend, &hstp, &outf[21], &oarr[1], &error);
    hour = hour + iut*25.0;
-   iri_sub__(&jf[1], &jmag, &latitude, &longitude, &iy, &md, &hour, &hbeg, &hend, &hstp, &outf[21], &oarr[1], &error);
+   {
+      // IRI keeps its working data in common blocks, so one call at a time
+      std::lock_guard<std::mutex> lock(iriMutex);
+      iri_sub__(&jf[1], &jmag, &latitude, &longitude, &iy, &md, &hour, &hbeg, &hend, &hstp, &outf[21], &oarr[1], &error);
+   }
    if (error != 0)
       throw MeasurementException("Ionosphere data files not found\n");
 
@@ -635,44 +693,36 @@ float Ionosphere::ElectronDensity(Rvector3 pos1)
 
 
 //---------------------------------------------------------------------------
-// Real Ionosphere::TEC()
-// This function is used to calculate number of electron inside a 1 meter 
-// square cross sectioncylinder with its bases on spacecraft and on ground 
-// station.
-//
-//  return value: tec  (unit: number of electrons per 1 meter square)
+// bool FindIonospherePath(const SignalPath &path, Rvector3 &start,
+//       Rvector3 &end) const
 //---------------------------------------------------------------------------
-Real Ionosphere::TEC()
+/**
+ * Finds the part of a signal path that is inside the ionosphere
+ *
+ * @param path  The signal path
+ * @param start The point where the path enters the ionosphere, or the
+ *              station if the station is inside it (unit: km)
+ * @param end   The point where the path leaves the ionosphere, or the
+ *              spacecraft if the spacecraft is inside it (unit: km)
+ *
+ * @return true if the path travels through the ionosphere, false if not
+ */
+//---------------------------------------------------------------------------
+bool Ionosphere::FindIonospherePath(const SignalPath &path, Rvector3 &start,
+   Rvector3 &end) const
 {
-#ifdef DEBUG_IONOSPHERE_TEC
-   MessageInterface::ShowMessage("         It performs calculation electron density along the path\n");
-   MessageInterface::ShowMessage("            from ground station location: (%lf,  %lf,  %lf)km\n", stationLoc[0], stationLoc[1], stationLoc[2]);
-   MessageInterface::ShowMessage("            to spacecraft location:       (%lf,  %lf,  %lf)km\n", spacecraftLoc[0], spacecraftLoc[1], spacecraftLoc[2]);
-   MessageInterface::ShowMessage("         Earth radius : %lf\n", earthRadius);
-#endif
-//   Rvector3 sR;
-//   if (spacecraftLoc.GetMagnitude() - earthRadius > IONOSPHERE_MAX_ATTITUDE)
-//      sR = spacecraftLoc.GetUnitVector() * (IONOSPHERE_MAX_ATTITUDE + earthRadius); 
-//   else
-//      sR = spacecraftLoc;
-
-//   //Rvector3 dR = (spacecraftLoc - stationLoc) / NUM_OF_INTERVALS;
-//   Rvector3 dR = (sR - stationLoc) / NUM_OF_INTERVALS;
-//   Rvector3 p1 = stationLoc;
-
-   // Fix bug to calculate end point
    // Solution to where a line intersects a sphere is a quadratic equation
    Real a, b, c, discriminant;
-   Rvector3 s = spacecraftLoc - stationLoc;
+   Rvector3 s = path.spacecraftLoc - path.stationLoc;
    // Solve for intersection of signal with sphere of IONOSPHERE_MAX_ALTITUDE
    a = s*s;
-   b = 2.0 * stationLoc * s;
-   c = stationLoc*stationLoc - GmatMathUtil::Pow(earthRadius + IONOSPHERE_MAX_ALTITUDE, 2);
+   b = 2.0 * path.stationLoc * s;
+   c = path.stationLoc*path.stationLoc - GmatMathUtil::Pow(path.earthRadius + IONOSPHERE_MAX_ALTITUDE, 2);
 
    discriminant = b*b - 4.0 * a*c;
    if (discriminant <= 0)
    {
-       return 0; // Path does not travel through ionosphere
+       return false; // Path does not travel through ionosphere
    }
 
    Real d1, d2; // Roots of quadratic equation
@@ -682,32 +732,188 @@ Real Ionosphere::TEC()
 
    if ((d1 > 1 && d2 > 1) || (d1 < 0 && d2 < 0))
    {
-       return 0; // Segment between start and end does not travel through ionosphere
+       return false; // Segment between start and end does not travel through ionosphere
    }
 
    d1 = GmatMathUtil::Max(d1, 0); // Truncate segment before start point of signal
    d2 = GmatMathUtil::Min(d2, 1); // Truncate segment after end point of signal
 
+   start = path.stationLoc + d1*s;
+   end   = path.stationLoc + d2*s;
+
+   return true;
+}
+
+
+//---------------------------------------------------------------------------
+// ProfileKey GetProfileKey(const SignalPath &path, const Rvector3 &start,
+//       const Rvector3 &end) const
+//---------------------------------------------------------------------------
+/**
+ * Builds the density profile cache key of a signal path
+ *
+ * Paths from the same station (to the meter) in the same PROFILE_TIME_BUCKET,
+ * whose azimuth and elevation at the station fall in the same
+ * PROFILE_ANGLE_CELL, and whose parts inside the ionosphere have the same
+ * length to PROFILE_LENGTH_CELL, share a density profile.
+ *
+ * @param path  The signal path
+ * @param start The start of the path inside the ionosphere (unit: km)
+ * @param end   The end of the path inside the ionosphere (unit: km)
+ *
+ * @return The key
+ */
+//---------------------------------------------------------------------------
+Ionosphere::ProfileKey Ionosphere::GetProfileKey(const SignalPath &path,
+   const Rvector3 &start, const Rvector3 &end) const
+{
+   ProfileKey key;
+   for (Integer i = 0; i < 3; ++i)
+      key.station[i] = std::llround(path.stationLoc[i] * 1000.0);
+   key.timeBucket = (long long)std::floor(path.epoch *
+         GmatTimeConstants::SECS_PER_DAY / PROFILE_TIME_BUCKET);
+
+   // Azimuth and elevation about the station's geocentric vertical
+   Rvector3 up = path.stationLoc.GetUnitVector();
+   Rvector3 east(-up[1], up[0], 0.0);
+   if (east.GetMagnitude() < 1.0e-12)
+      east.Set(0.0, 1.0, 0.0);
+   east.Normalize();
+   Rvector3 north = Cross(up, east);
+   Rvector3 direction = (path.spacecraftLoc - path.stationLoc).GetUnitVector();
+
+   Real sinElevation = GmatMathUtil::Max(-1.0,
+         GmatMathUtil::Min(1.0, direction*up));
+   Real elevation = GmatMathUtil::ASin(sinElevation) *
+         GmatMathConstants::DEG_PER_RAD;
+   Real azimuth = GmatMathUtil::ATan2(direction*east, direction*north) *
+         GmatMathConstants::DEG_PER_RAD;
+
+   key.azimuthCell   = (Integer)std::floor(azimuth / PROFILE_ANGLE_CELL);
+   key.elevationCell = (Integer)std::floor(elevation / PROFILE_ANGLE_CELL);
+   key.lengthCell    = (Integer)std::floor((end - start).GetMagnitude() /
+         PROFILE_LENGTH_CELL);
+
+   return key;
+}
+
+
+//---------------------------------------------------------------------------
+// void GetDensityProfile(const SignalPath &path, const Rvector3 &start,
+//       const Rvector3 &end, std::vector<float> &profile)
+//---------------------------------------------------------------------------
+/**
+ * Gets the electron densities along the part of a signal path inside the
+ * ionosphere, at the nodes and the midpoints of its NUM_OF_INTERVALS
+ * integration intervals
+ *
+ * The densities do not depend on the signal frequency.  They are taken from
+ * the profile cache when a path in the same cell was calculated before, and
+ * calculated and cached otherwise.
+ *
+ * @param path    The signal path
+ * @param start   The start of the path inside the ionosphere (unit: km)
+ * @param end     The end of the path inside the ionosphere (unit: km)
+ * @param profile The densities, from start to end (unit: electrons / m^3)
+ */
+//---------------------------------------------------------------------------
+void Ionosphere::GetDensityProfile(const SignalPath &path,
+   const Rvector3 &start, const Rvector3 &end, std::vector<float> &profile)
+{
+   ProfileKey key = GetProfileKey(path, start, end);
+   {
+      std::lock_guard<std::mutex> lock(cacheMutex);
+      ProfileCache::const_iterator cached = profileCache.find(key);
+      if (cached != profileCache.end())
+      {
+         profile = cached->second;
+         return;
+      }
+   }
+
+   CelestialBody* earth = solarSystem->GetBody("Earth");
+   Real radius = earth->GetRealParameter(earth->GetParameterID("EquatorialRadius"));
+   Real flattening = earth->GetRealParameter(earth->GetParameterID("Flattening"));
+
+   Integer samples = 2 * (Integer)NUM_OF_INTERVALS;
+   Rvector3 dR = (end - start) / samples;
+   profile.resize(samples + 1);
+   for (Integer i = 0; i <= samples; ++i)
+      profile[i] = ElectronDensity(start + dR * (Real)i, path, radius, flattening);
+
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   if (profileCache.size() >= MAX_CACHED_PROFILES)
+   {
+      // Make room by dropping the profile farthest in time from this one
+      ProfileCache::iterator farthest = profileCache.begin();
+      for (ProfileCache::iterator i = profileCache.begin();
+           i != profileCache.end(); ++i)
+      {
+         if (std::llabs(i->first.timeBucket - key.timeBucket) >
+             std::llabs(farthest->first.timeBucket - key.timeBucket))
+            farthest = i;
+      }
+      profileCache.erase(farthest);
+   }
+   profileCache[key] = profile;
+}
+
+
+//---------------------------------------------------------------------------
+// Real Ionosphere::TEC()
+// This function is used to calculate number of electron inside a 1 meter 
+// square cross sectioncylinder with its bases on spacecraft and on ground 
+// station.
+//
+//  return value: tec  (unit: number of electrons per 1 meter square)
+//---------------------------------------------------------------------------
+Real Ionosphere::TEC()
+{
+#ifdef DEBUG_IONOSPHERE_TEC
+   MessageInterface::ShowMessage("         It performs calculation electron density along the path\n");
+   MessageInterface::ShowMessage("            from ground station location: (%lf,  %lf,  %lf)km\n", stationLoc[0], stationLoc[1], stationLoc[2]);
+   MessageInterface::ShowMessage("            to spacecraft location:       (%lf,  %lf,  %lf)km\n", spacecraftLoc[0], spacecraftLoc[1], spacecraftLoc[2]);
+   MessageInterface::ShowMessage("         Earth radius : %lf\n", earthRadius);
+#endif
+
+   SignalPath path = GetSignalPath();
    Rvector3 start, end;
-   start = stationLoc + d1*s;
-   end   = stationLoc + d2*s;
+   if (!FindIonospherePath(path, start, end))
+      return 0;
+
+   std::vector<float> profile;
+   GetDensityProfile(path, start, end, profile);
+   return TEC(start, end, profile);
+}
 
-   // This is our old algorithm for integration
-   //Rvector3 dR = (spacecraftLoc - stationLoc) / NUM_OF_INTERVALS;
 
+//---------------------------------------------------------------------------
+// Real TEC(const Rvector3 &start, const Rvector3 &end,
+//       const std::vector<float> &profile) const
+//---------------------------------------------------------------------------
+/**
+ * Integrates the electron density along the part of a path inside the
+ * ionosphere, with the midpoint densities of its integration intervals
+ *
+ * @param start   The start of the path inside the ionosphere (unit: km)
+ * @param end     The end of the path inside the ionosphere (unit: km)
+ * @param profile The densities from GetDensityProfile()
+ *
+ * @return tec (unit: number of electrons per 1 meter square)
+ */
+//---------------------------------------------------------------------------
+Real Ionosphere::TEC(const Rvector3 &start, const Rvector3 &end,
+   const std::vector<float> &profile) const
+{
    // Evenly spaced integration points
-   Rvector3 dR = (end - start) / NUM_OF_INTERVALS;
-   Rvector3 p1 = start;
-   Rvector3 p2;
-   Real electdensity, ds;
+   Integer intervals = (Integer)(profile.size() - 1) / 2;
+   Real ds = ((end - start) / intervals).GetMagnitude()*GmatMathConstants::KM_TO_M;   // unit: m
+   Real electdensity;
    Real tec = 0.0;
-   for(int i = 0; i < NUM_OF_INTERVALS; ++i)
+   for(int i = 0; i < intervals; ++i)
    {
-      p2 = p1 + dR;
-      electdensity = ElectronDensity((p1+p2)/2);                // unit: electron / m^3
-      ds = (p2-p1).GetMagnitude()*GmatMathConstants::KM_TO_M;   // unit: m
+      electdensity = profile[2*i + 1];                          // unit: electron / m^3
       tec += electdensity*ds;                                   // unit: electron / m^2
-      p1 = p2;
    }
 
    //// Gaussian Quadrature:
@@ -732,47 +938,46 @@ Real Ionosphere::TEC()
 //---------------------------------------------------------------------------
 Real Ionosphere::BendingAngle()
 {
-   // 1. Calculate end points which speccify path inside ionosphere
-   // Solution to where a line intersects a sphere is a quadratic equation
-   Real a, b, c, discriminant;
-   Rvector3 s = spacecraftLoc - stationLoc;
-   // Solve for intersection of signal with sphere of IONOSPHERE_MAX_ALTITUDE
-   a = s*s;
-   b = 2.0 * stationLoc * s;
-   c = stationLoc*stationLoc - GmatMathUtil::Pow(earthRadius + IONOSPHERE_MAX_ALTITUDE, 2);
-
-   discriminant = b*b - 4.0 * a*c;
-   if (discriminant <= 0)
-   {
-      return 0; // Path does not travel through ionosphere
-   }
-
-   Real d1, d2; // Roots of quadratic equation
-
-   d1 = (-b - GmatMathUtil::Sqrt(b*b - 4.0*a*c)) / (2.0*a);
-   d2 = (-b + GmatMathUtil::Sqrt(b*b - 4.0*a*c)) / (2.0*a);
-
-   if ((d1 > 1 && d2 > 1) || (d1 < 0 && d2 < 0))
-   {
-      return 0; // Segment between start and end does not travel through ionosphere
-   }
+   SignalPath path = GetSignalPath();
+   Rvector3 start, end;
+   if (!FindIonospherePath(path, start, end))
+      return 0;
 
-   d1 = GmatMathUtil::Max(d1, 0); // Truncate segment before start point of signal
-   d2 = GmatMathUtil::Min(d2, 1); // Truncate segment after end point of signal
+   std::vector<float> profile;
+   GetDensityProfile(path, start, end, profile);
+   return BendingAngle(start, end, profile, path.waveLength);
+}
 
-   Rvector3 start, end;
-   start = stationLoc + d1*s;
-   end = stationLoc + d2*s;
 
-   // 2. Calculate angle correction
+//---------------------------------------------------------------------------
+// Real BendingAngle(const Rvector3 &start, const Rvector3 &end,
+//       const std::vector<float> &profile, Real lambda) const
+//---------------------------------------------------------------------------
+/**
+ * Calculates the elevation angle correction along the part of a path inside
+ * the ionosphere, with the node densities of its integration intervals
+ *
+ * @param start   The start of the path inside the ionosphere (unit: km)
+ * @param end     The end of the path inside the ionosphere (unit: km)
+ * @param profile The densities from GetDensityProfile()
+ * @param lambda  The wave length of the signal (unit: m)
+ *
+ * @return The elevation angle correction (unit: radian)
+ */
+//---------------------------------------------------------------------------
+Real Ionosphere::BendingAngle(const Rvector3 &start, const Rvector3 &end,
+   const std::vector<float> &profile, Real lambda) const
+{
+   // Calculate angle correction
+   Integer intervals = (Integer)(profile.size() - 1) / 2;
    Rvector3 rangeVec = end - start;
-   Rvector3 dR = rangeVec / NUM_OF_INTERVALS;
+   Rvector3 dR = rangeVec / intervals;
    Rvector3 r_i1 = end;
    Rvector3 r_i;
    Real n_i, n_i1, density_i, density_i1;
    
    // Frequency of signal
-   Real freq = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM / waveLength;
+   Real freq = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM / lambda;
 
    // Angle of incidence at position r_i1
    Real theta_i1 = GmatMathUtil::ACos(rangeVec.GetUnitVector()*r_i1.GetUnitVector());             // unit: radian
@@ -782,20 +987,20 @@ Real Ionosphere::BendingAngle()
    //MessageInterface::ShowMessage("Elevation angle = %.12lf degree\n", beta_i1*GmatMathConstants::DEG_PER_RAD);
 
    // Electron density at position r_i1
-   density_i1 = ElectronDensity(r_i1);
+   density_i1 = profile[2*intervals];
 
    // Index of refaction at position ri1
    n_i1 = 1 - 40.3*density_i1 / (freq*freq);
 
    // Refaction correction 
    Real dtheta_i1 = 0.0;
-   for (int i = NUM_OF_INTERVALS; i > 0; --i)
+   for (int i = intervals; i > 0; --i)
    {
       // the previous position of r_i
       r_i = r_i1 - dR;
       
       // density at position r_i 
-      density_i = ElectronDensity(r_i);
+      density_i = profile[2*(i - 1)];
       
       // index of refaction at position r_i 
       n_i = 1 - 40.3*density_i/(freq*freq);
@@ -872,15 +1077,42 @@ RealArray Ionosphere::Correction()
 //    . Time correction  (unit: s)
 //---------------------------------------------------------------------------
 RealArray Ionosphere::CalculateIRI2007()
+{
+   return CalculateIRI2007(GetSignalPath());
+}
+
+
+//---------------------------------------------------------------------------
+// RealArray CalculateIRI2007(const SignalPath &path)
+//---------------------------------------------------------------------------
+/**
+ * This function is used to calculate Ionosphere correction for a signal
+ * path.
+ *
+ * It uses no state set by the Set methods, so it can be called from several
+ * threads at once.  The IRI2007 data files are loaded once, by the first
+ * call; after that the threads only wait for each other while IRI2007 itself
+ * runs, which the density profile cache limits to new path geometries.
+ *
+ * @param path The signal path
+ *
+ * @return The range correction (unit: m), the elevation angle correction
+ *         (unit: radian), and the time correction (unit: s)
+ */
+//---------------------------------------------------------------------------
+RealArray Ionosphere::CalculateIRI2007(const SignalPath &path)
 {
 #ifdef DEBUG_IONOSPHERE_CORRECTION
    MessageInterface::ShowMessage("Ionosphere::CalculateIRI() start\n");
 #endif
    // Initialize before doing calculation
-   if (!IsInitialized())
-      Initialize();
+   {
+      std::lock_guard<std::mutex> lock(iriMutex);
+      if (!IsInitialized())
+         Initialize();
+   }
 
-   Integer mjdate = yyyy * 10000 + mmdd;
+   Integer mjdate = path.yyyy * 10000 + path.mmdd;
 
    
    // Verify time having a valid time rage defined in ig_rz.dat
@@ -904,13 +1136,14 @@ RealArray Ionosphere::CalculateIRI2007()
          "/" + GmatStringUtil::Trim(GmatStringUtil::ToString(day)) +
          "/" + GmatStringUtil::Trim(GmatStringUtil::ToString(year));
 
+      std::lock_guard<std::mutex> lock(cacheMutex);
       if (igrz_WarningCount == 0)
       {
          //MessageInterface::ShowMessage("Warning: Epoch is out of time range in ig_rz.dat file from " + dateMin + " to " + dateMax + ".\n");
          MessageInterface::ShowMessage(
             "Warning: The epoch (%.12lf A1MJD) is out of the time range of the ionosphere ig_rz.dat file "
             "(%s to %s). Ionospheric corrections are set to zero.\n", 
-            epoch, dateMin.c_str(), dateMax.c_str());
+            path.epoch, dateMin.c_str(), dateMax.c_str());
 
          ++igrz_WarningCount;
       }
@@ -940,12 +1173,22 @@ RealArray Ionosphere::CalculateIRI2007()
       throw MeasurementException("Error: Epoch is out of range. Time range for Ionosphere calculation is from " + dateMin + " to " + dateMax + ".\n");
    }
 
-   Real freq = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM / waveLength;
-   Real tec = TEC();                  // Equation 6.70 of MONTENBRUCK and GILL      // unit: number of electrons/ m^2
+   Real freq = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM / path.waveLength;
+   Real tec = 0.0;
+   Real dphi = 0.0;
+   Rvector3 start, end;
+   if (FindIonospherePath(path, start, end))
+   {
+      std::vector<float> profile;
+      GetDensityProfile(path, start, end, profile);
+
+      tec = TEC(start, end, profile);                   // Equation 6.70 of MONTENBRUCK and GILL      // unit: number of electrons/ m^2
+
+      // Unit of dphi has to be radian because in all caller functions use correction in radian unit.
+      dphi = BendingAngle(start, end, profile, path.waveLength);                    // unit: radian
+   }
    Real drho = 40.3*tec / (freq*freq);  // Equation 6.69 of MONTENBRUCK and GILL      // unit: meter
 
-   // Unit of dphi has to be radian because in all caller functions use correction in radian unit.
-   Real dphi = BendingAngle();                                                      // unit: radian
    Real dtime = drho / GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM;                  // unit: s
 
 #ifdef DEBUG_IONOSPHERE_CORRECTION
@@ -34,6 +34,10 @@
 
 #include "f2c.h"
 
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #ifdef __linux__
 
 #ifndef integer
@@ -85,9 +89,34 @@ typedef double doublereal;
 
 typedef doublereal (*D_fp)(...), (*E_fp)(...);
 
+/**
+ * Ionosphere media correction from the IRI2007 model or TRK-2-23 files
+ *
+ * IRI2007 electron densities along a path do not depend on the signal
+ * frequency, and change slowly with the path geometry and time, so they are
+ * cached by station, time bucket, and azimuth and elevation cell.
+ * CalculateIRI2007(const SignalPath&) may be called from several threads.
+ */
 class Ionosphere: public MediaCorrection
 {
 public:
+   /// Inputs of an IRI2007 correction for one signal path
+   struct SignalPath
+   {
+      /// Epoch (unit: A1Mjd), and its UTC date and hours of the day
+      GmatEpoch      epoch;
+      Integer        yyyy;
+      Integer        mmdd;
+      Real           hours;
+      /// Positions in the Earth fixed coordinate system (unit: km)
+      Rvector3       stationLoc;
+      Rvector3       spacecraftLoc;
+      /// Wave length of the signal (unit: m)
+      Real           waveLength;
+      /// Earth radius (unit: km)
+      Real           earthRadius;
+   };
+
    Ionosphere(const std::string &nomme);
    virtual ~Ionosphere();
    Ionosphere(const Ionosphere& ions);
@@ -106,6 +135,10 @@ public:
    Real BendingAngle();            // specify the change of elevation angle
    virtual RealArray Correction();
    RealArray CalculateIRI2007();
+   RealArray CalculateIRI2007(const SignalPath &path);
+   SignalPath GetSignalPath() const;
+   static void GetIRITime(GmatEpoch ep, Integer &year, Integer &monthDay,
+                          Real &hourOfDay);
    RealArray CalculateTRK223();
    Real TRK223Solver(const StringArray &TRK223Line, Real epochTime);
    Real GetTRK223Time(const std::string &TRK223TimeLine);
@@ -120,10 +153,44 @@ protected:
    Integer igrz_yyyymmddMax;
 
 private:
+   /// Cell of the electron density profile cache: station, time bucket,
+   /// azimuth and elevation of the path, and length of its ionosphere part
+   struct ProfileKey
+   {
+      long long      station[3];
+      long long      timeBucket;
+      Integer        azimuthCell;
+      Integer        elevationCell;
+      Integer        lengthCell;
+
+      bool operator==(const ProfileKey &key) const;
+   };
+
+   struct ProfileKeyHasher
+   {
+      size_t operator()(const ProfileKey &key) const;
+   };
+
+   /// Electron densities at the nodes and the midpoints of the integration
+   /// intervals along the ionosphere part of a path (unit: electrons / m^3)
+   typedef std::unordered_map<ProfileKey, std::vector<float>, ProfileKeyHasher>
+         ProfileCache;
+
    void GetAPTimeRange();
    void GetIGRZTimeRange();
 
-   float ElectronDensity(Rvector3 pos1);
+   bool FindIonospherePath(const SignalPath &path, Rvector3 &start,
+                           Rvector3 &end) const;
+   ProfileKey GetProfileKey(const SignalPath &path, const Rvector3 &start,
+                            const Rvector3 &end) const;
+   void  GetDensityProfile(const SignalPath &path, const Rvector3 &start,
+                           const Rvector3 &end, std::vector<float> &profile);
+   float ElectronDensity(const Rvector3 &pos1, const SignalPath &path,
+                         Real radius, Real flattening);
+   Real  TEC(const Rvector3 &start, const Rvector3 &end,
+             const std::vector<float> &profile) const;
+   Real  BendingAngle(const Rvector3 &start, const Rvector3 &end,
+                      const std::vector<float> &profile, Real lambda) const;
 
    Real waveLength;          // wave length of the signal
    GmatEpoch epoch;          // time
@@ -138,8 +205,19 @@ private:
    
    Integer igrz_WarningCount;
 
+   /// Density profiles computed for recent paths, by ProfileKey
+   ProfileCache profileCache;
+   /// Guards profileCache and the warning count
+   std::mutex cacheMutex;
+   /// Guards the IRI2007 code, which keeps its state in static data
+   static std::mutex iriMutex;
+
    static const Real NUM_OF_INTERVALS;
    static const Real IONOSPHERE_MAX_ALTITUDE;
+   static const Real PROFILE_TIME_BUCKET;
+   static const Real PROFILE_ANGLE_CELL;
+   static const Real PROFILE_LENGTH_CELL;
+   static const UnsignedInt MAX_CACHED_PROFILES;
    
    //// These arrays are used for Guassian Quadrature algorithm
    //static const Real QUAD_WEIGHTS[20];
@@ -33,6 +33,7 @@
 
 #include "MeasurementData.hpp"
 #include "MessageInterface.hpp"
+#include "MemoryTracker.hpp"
 
 
 //-----------------------------------------------------------------------------
@@ -89,6 +90,8 @@ MeasurementData::MeasurementData() :
    tropoCorrectValue          (0.0),
    ionoCorrectValue           (0.0)
 {
+   if (MemoryTracker::IsCounting())
+      MemoryTracker::CountAllocation(MemoryTracker::MEASUREMENT_DATA);
 }
 
 
@@ -101,6 +104,8 @@ MeasurementData::MeasurementData() :
 //-----------------------------------------------------------------------------
 MeasurementData::~MeasurementData()
 {
+   if (MemoryTracker::IsCounting())
+      MemoryTracker::CountRelease(MemoryTracker::MEASUREMENT_DATA);
 }
 
 void MeasurementData::CleanUp()
@@ -239,6 +244,8 @@ MeasurementData::MeasurementData(const MeasurementData& md) :
    tropoCorrectValue        (md.tropoCorrectValue),
    ionoCorrectValue         (md.ionoCorrectValue)
 {
+   if (MemoryTracker::IsCounting())
+      MemoryTracker::CountAllocation(MemoryTracker::MEASUREMENT_DATA);
 }
 
 
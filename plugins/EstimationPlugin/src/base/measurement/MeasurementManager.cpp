@@ -35,6 +35,8 @@
 #include "MessageInterface.hpp"
 #include "StringUtil.hpp"
 #include "RealUtilities.hpp"
+#include "Profiler.hpp"
+#include "RandomNumber.hpp"
 #include <sstream>            // To build DataStream for a TrackingFileSet
 
 #include "DataFileAdapter.hpp"
@@ -46,7 +48,9 @@
 
 // Temporary to get Adapters hooked up
 #include "GmatObType.hpp"
+#include "GmatBinaryObType.hpp"
 #include "RampTableType.hpp"
+#include "DataFileCache.hpp"
 
 //#define DEBUG_CONSTRUCTION
 //#define DEBUG_INITIALIZATION
@@ -68,6 +72,10 @@
 // Selects between old datafile classes and the classes in the DataFile plugin
 //#define USE_DATAFILE_PLUGINS
 
+// Layout of the ramp tables kept in the DataFileCache
+static const std::string RAMP_CACHE_FORMAT = "RampTable|1";
+static const Integer RAMP_RECORD_SIZE = 12;
+
 
 //------------------------------------------------------------------------------
 // MeasurementManager()
@@ -87,7 +95,9 @@ MeasurementManager::MeasurementManager() :
    eventCount        (0),
    inSimulationMode  (false),
    isForward         (true),
-   transientForces   (NULL)
+   transientForces   (NULL),
+   firstActiveAdapter(0),
+   activeAdapterCount(-1)
 {
 }
 
@@ -198,6 +208,7 @@ void MeasurementManager::CleanUp()
       (*i).second.clear();
    }
    rampTables.clear();
+   rampTableFiles.clear();
 
    //// clean up ObjectArray activeEvents;
    //for (Integer i = 0; i < activeEvents.size(); ++i)
@@ -246,7 +257,9 @@ MeasurementManager::MeasurementManager(const MeasurementManager &mm) :
    adapters          (mm.adapters),
    trackingSets      (mm.trackingSets),
    
-   transientForces   (NULL)
+   transientForces   (NULL),
+   firstActiveAdapter(mm.firstActiveAdapter),
+   activeAdapterCount(mm.activeAdapterCount)
 {
 }
 
@@ -278,6 +291,8 @@ MeasurementManager& MeasurementManager::operator=(const MeasurementManager &mm)
       inSimulationMode = mm.inSimulationMode;
       isForward        = mm.isForward;
       transientForces  = NULL;
+      firstActiveAdapter = mm.firstActiveAdapter;
+      activeAdapterCount = mm.activeAdapterCount;
 
       adapters         = mm.adapters;
       trackingSets     = mm.trackingSets;
@@ -400,8 +415,14 @@ bool MeasurementManager::Initialize()
          newStream->SetStringParameter("Filename", filenames[k]);
 
          // 3.1.2 Create and set a data stream associated with the DataFile object
-         GmatObType *got = new GmatObType();                      // ??? what happen for GMAT_OD and GMAT_ODDoppler???   // In new design, GMATInteral data file contains data records with different measurement type
+         // .gmb files hold binary observation data; all others are text
+         ObType *got;
+         if (GmatBinaryObType::IsBinaryFile(filenames[k]))
+            got = new GmatBinaryObType();
+         else
+            got = new GmatObType();                      // ??? what happen for GMAT_OD and GMAT_ODDoppler???   // In new design, GMATInteral data file contains data records with different measurement type
          newStream->SetStream(got);
+         newStream->SetStringParameter("Format", got->GetTypeName());
          #ifdef DEBUG_INITIALIZATION
             MessageInterface::ShowMessage("   Adding %s DataFile %s <%p>\n",
                   (newStream->IsInitialized() ? "initialized" :
@@ -885,6 +906,7 @@ Integer MeasurementManager::Calculate(const Integer measurementToCalc,
          if (!observations.empty())
             od = &(observations[obsIndex]);
          
+         ProfileScope profile("Measurement", adapters[j]);
          measurements[j] = adapters[j]->CalculateMeasurement(withEvents, od, rt);
 
          if (measurements[j].isFeasible)
@@ -923,8 +945,12 @@ Integer MeasurementManager::Calculate(const Integer measurementToCalc,
                MessageInterface::ShowMessage("****** currentObs: epoch = %.12lf, participants: %s  %s,  meas value = %.12lf\n", currentObs->epoch, currentObs->participantIDs[0].c_str(), currentObs->participantIDs[1].c_str(), currentObs->value[0]);
          #endif
          
-         measurements[measurementToCalc] =
-            adapters[measurementToCalc]->CalculateMeasurement(withEvents, od, rt);
+         {
+            ProfileScope profile("Measurement", adapters[measurementToCalc]);
+            measurements[measurementToCalc] =
+               adapters[measurementToCalc]->CalculateMeasurement(withEvents,
+                     od, rt);
+         }
          
          #ifdef DEBUG_CALCULATE
             MessageInterface::ShowMessage("****** measurements[%d] = <%p>,   "
@@ -1220,6 +1246,9 @@ UnsignedInt MeasurementManager::LoadObservations()
          if (streamList[i]->OpenStream(false) == false)
             throw MeasurementException("Error: Cannot open file '" + streamList[i]->GetName() + "'.\n");
       #endif
+
+      // Streams with a time index skip the records no filter can accept
+      streamList[i]->LimitToTimeWindow();
    }
    
    // Initialize trackingConfigsMap
@@ -1236,6 +1265,16 @@ UnsignedInt MeasurementManager::LoadObservations()
 
    observations.clear();
 
+   // Reserve the observations when every stream knows its record count
+   Integer expectedCount = 0;
+   for (UnsignedInt i = 0; (i < streamList.size()) && (expectedCount >= 0); ++i)
+   {
+      Integer streamCount = streamList[i]->GetRecordCount();
+      expectedCount = (streamCount < 0 ? -1 : expectedCount + streamCount);
+   }
+   if (expectedCount > 0)
+      observations.reserve(expectedCount);
+
    std::vector<UnsignedInt> numRec;                    // numRec[i] is number of records of data file specified by streamList[i] 
    std::vector<UnsignedInt> count;                     // count[i] is number of all accepted records associated with file specified by streamList[i] after applying statistic filters
    std::vector<ObservationData*> dataBuffer;           // dataBuffer[i] contains the current data record read from streamList[i]  
@@ -1981,6 +2020,20 @@ void MeasurementManager::LoadRampTables()
             {
                std::map<std::string, RampTableData> ramp_table_map;
                std::vector<RampTableData> ramp_table;
+
+               // Reuse the table when this file was already parsed, here or
+               // by another run sharing the data cache
+               std::string streamName = rampTableDataStreamList[i]->GetName();
+               std::string rampFile = RampTableType::GetRampFilePath(
+                     rampTableDataStreamList[i]->GetStringParameter("Filename"));
+               std::shared_ptr<const DataFileCache> cached;
+               if (LoadCachedRampTable(rampFile, ramp_table, cached))
+               {
+                  rampTables[streamName] = ramp_table;
+                  rampTableFiles[streamName] = cached;
+                  continue;
+               }
+
                rtd = rampTableDataStreamList[i]->ReadRampTableData();
                while (rtd != NULL)
                {
@@ -1989,15 +2042,7 @@ void MeasurementManager::LoadRampTables()
                   if ((rtd->rampType >= 1)&&(rtd->rampType <= 5))
                   {
                      // Specify keyindex
-                     std::stringstream ss;
-                     ss.precision(21);
-                     for (UnsignedInt p = 0; p < rtd->participantIDs.size(); p++)
-                     {
-                        ss << rtd->participantIDs[p];
-                        ss << " ";          // adding a blank between partcipants
-                     }
-                     ss << rtd->epoch;
-                     rtd->indexkey = ss.str();
+                     rtd->indexkey = BuildRampIndexKey(*rtd);
 
                      // Store data record into ramp table map if it is not in there 
                      if (ramp_table_map.find(rtd->indexkey) == ramp_table_map.end())
@@ -2027,7 +2072,9 @@ void MeasurementManager::LoadRampTables()
                }
 
                // store ramp_table to rampTables
+               AccumulateRampPhases(ramp_table);
                rampTables[rampTableDataStreamList[i]->GetName()] = ramp_table;
+               rampTableFiles[streamName] = ShareRampTable(rampFile, ramp_table);
                #ifdef DEBUG_LOAD_FREQUENCY_RAMP_TABLE
                   MessageInterface::ShowMessage("Ramp Table:\n");
                   for (UnsignedInt j = 0; j < ramp_table.size(); ++j)
@@ -2054,6 +2101,225 @@ void MeasurementManager::LoadRampTables()
 }
 
 
+//-----------------------------------------------------------------------------
+// void AccumulateRampPhases(std::vector<RampTableData> &rampTable)
+//-----------------------------------------------------------------------------
+/**
+ * Fills in the cumulative phase of the records of a ramp table.
+ *
+ * The records of each set of participants are integrated from the first one,
+ * relative to its frequency so that the sums stay small.  The rounding error
+ * of each sum is carried along, so the difference of two cumulative phases
+ * is as accurate as integrating the records between them one at a time.
+ *
+ * @param rampTable The ramp table, sorted by index key
+ */
+//-----------------------------------------------------------------------------
+void MeasurementManager::AccumulateRampPhases(
+      std::vector<RampTableData> &rampTable)
+{
+   UnsignedInt first = 0;
+   for (UnsignedInt i = 0; i < rampTable.size(); ++i)
+   {
+      RampTableData &record = rampTable[i];
+      if ((i == 0) ||
+          (record.participantIDs != rampTable[i-1].participantIDs))
+      {
+         first = i;
+         record.cumulativePhase = 0.0;
+         record.cumulativePhaseError = 0.0;
+         continue;
+      }
+
+      // Integral of the linear ramp from the previous record to this one
+      const RampTableData &previous = rampTable[i-1];
+      Real interval = (record.epochGT - previous.epochGT).GetTimeInSec();
+      Real step = (previous.rampFrequency - rampTable[first].rampFrequency +
+            0.5 * previous.rampRate * interval) * interval;
+
+      // Sum with its exact rounding error (Knuth's two-sum)
+      Real sum = previous.cumulativePhase + step;
+      Real stepPart = sum - previous.cumulativePhase;
+      Real error = (previous.cumulativePhase - (sum - stepPart)) +
+            (step - stepPart);
+
+      record.cumulativePhase = sum;
+      record.cumulativePhaseError = previous.cumulativePhaseError + error;
+   }
+}
+
+
+//-----------------------------------------------------------------------------
+// std::string BuildRampIndexKey(const RampTableData &record)
+//-----------------------------------------------------------------------------
+/**
+ * Builds the key ramp tables are sorted by: the participant IDs, each
+ * followed by a blank, and then the epoch.
+ *
+ * @param record The ramp table record
+ *
+ * @return The index key of the record
+ */
+//-----------------------------------------------------------------------------
+std::string MeasurementManager::BuildRampIndexKey(const RampTableData &record)
+{
+   std::stringstream ss;
+   ss.precision(21);
+   for (UnsignedInt p = 0; p < record.participantIDs.size(); p++)
+   {
+      ss << record.participantIDs[p];
+      ss << " ";          // adding a blank between partcipants
+   }
+   ss << record.epoch;
+   return ss.str();
+}
+
+
+//-----------------------------------------------------------------------------
+// bool LoadCachedRampTable(const std::string &fileName,
+//       std::vector<RampTableData> &rampTable,
+//       std::shared_ptr<const DataFileCache> &cached)
+//-----------------------------------------------------------------------------
+/**
+ * Restores a ramp table from a DataFileCache entry, in place of parsing the
+ * file.
+ *
+ * The entry holds the table as LoadRampTables() leaves it: filtered, sorted
+ * by index key and with the cumulative phases filled in.  Each record takes
+ * RAMP_RECORD_SIZE values of the "Records" table, and its participants are
+ * lines of the "ParticipantIDs" text.
+ *
+ * @param fileName  The full path of the ramp table file
+ * @param rampTable The restored table
+ * @param cached    The cache entry the table came from
+ *
+ * @return true if the table was restored, false if the file must be parsed.
+ */
+//-----------------------------------------------------------------------------
+bool MeasurementManager::LoadCachedRampTable(const std::string &fileName,
+      std::vector<RampTableData> &rampTable,
+      std::shared_ptr<const DataFileCache> &cached)
+{
+   if (fileName == "")
+      return false;
+
+   cached = DataFileCache::Find(StringArray(1, fileName), RAMP_CACHE_FORMAT);
+   if (!cached)
+      return false;
+
+   Integer size = cached->GetTableSize("Records");
+   Integer countSize = cached->GetTableSize("ParticipantCounts");
+   if ((size < 0) || (size % RAMP_RECORD_SIZE != 0) ||
+       (countSize != size / RAMP_RECORD_SIZE))
+   {
+      cached.reset();
+      return false;
+   }
+
+   StringArray ids = GmatStringUtil::SeparateBy(
+         cached->GetText("ParticipantIDs"), "\n");
+   const Real *records = cached->GetTable("Records");
+   const Real *counts = cached->GetTable("ParticipantCounts");
+
+   rampTable.clear();
+   rampTable.resize(countSize);
+   UnsignedInt nextId = 0;
+   for (Integer i = 0; i < countSize; ++i)
+   {
+      const Real *row = records + RAMP_RECORD_SIZE * i;
+      RampTableData &record = rampTable[i];
+      record.epochSystem = (TimeSystemConverter::TimeSystemTypes)(Integer)row[0];
+      record.type = (Gmat::MeasurementType)(Integer)row[1];
+      record.epoch = row[2];
+      record.epochGT.SetDays((long)row[3]);
+      record.epochGT.SetSec((long)row[4]);
+      record.epochGT.SetFracSec(row[5]);
+      record.uplinkBand = (Integer)row[6];
+      record.rampType = (Integer)row[7];
+      record.rampFrequency = row[8];
+      record.rampRate = row[9];
+      record.cumulativePhase = row[10];
+      record.cumulativePhaseError = row[11];
+      record.dataFormat = "GMAT_RampTable";
+
+      Integer idCount = (Integer)counts[i];
+      if (nextId + idCount > ids.size())
+      {
+         rampTable.clear();
+         cached.reset();
+         return false;
+      }
+      record.participantIDs.assign(ids.begin() + nextId,
+                                   ids.begin() + nextId + idCount);
+      nextId += idCount;
+      record.indexkey = BuildRampIndexKey(record);
+   }
+
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// std::shared_ptr<const DataFileCache> ShareRampTable(
+//       const std::string &fileName,
+//       const std::vector<RampTableData> &rampTable)
+//-----------------------------------------------------------------------------
+/**
+ * Stores a loaded ramp table in a DataFileCache entry, so later loads of the
+ * file in this process, and in other processes when DATA_CACHE_PATH is set,
+ * skip the parsing.
+ *
+ * @param fileName  The full path of the ramp table file
+ * @param rampTable The table, as LoadRampTables() built it
+ *
+ * @return The shared entry, or an empty pointer if nothing was shared
+ */
+//-----------------------------------------------------------------------------
+std::shared_ptr<const DataFileCache> MeasurementManager::ShareRampTable(
+      const std::string &fileName, const std::vector<RampTableData> &rampTable)
+{
+   if ((fileName == "") || rampTable.empty())
+      return std::shared_ptr<const DataFileCache>();
+
+   RealArray records(RAMP_RECORD_SIZE * rampTable.size());
+   RealArray counts(rampTable.size());
+   std::string ids;
+   for (UnsignedInt i = 0; i < rampTable.size(); ++i)
+   {
+      const RampTableData &record = rampTable[i];
+      Real *row = &records[RAMP_RECORD_SIZE * i];
+      row[0] = record.epochSystem;
+      row[1] = record.type;
+      row[2] = record.epoch;
+      row[3] = record.epochGT.GetDays();
+      row[4] = record.epochGT.GetSec();
+      row[5] = record.epochGT.GetFracSec();
+      row[6] = record.uplinkBand;
+      row[7] = record.rampType;
+      row[8] = record.rampFrequency;
+      row[9] = record.rampRate;
+      row[10] = record.cumulativePhase;
+      row[11] = record.cumulativePhaseError;
+
+      counts[i] = record.participantIDs.size();
+      for (UnsignedInt p = 0; p < record.participantIDs.size(); ++p)
+      {
+         if (ids != "")
+            ids += "\n";
+         ids += record.participantIDs[p];
+      }
+   }
+
+   DataFileCache *entry = new DataFileCache;
+   entry->AddTable("Records", &records[0], records.size());
+   entry->AddTable("ParticipantCounts", &counts[0], counts.size());
+   entry->SetText("ParticipantIDs", ids);
+
+   return DataFileCache::Share(StringArray(1, fileName), RAMP_CACHE_FORMAT,
+                               entry);
+}
+
+
 //-----------------------------------------------------------------------------
 // GmatTime GetEpoch()
 //-----------------------------------------------------------------------------
@@ -2071,6 +2337,48 @@ GmatTime MeasurementManager::GetEpochGT()
 }
 
 
+//-----------------------------------------------------------------------------
+// GmatTime GetObservationGroupEndGT(const GmatTime &fromEpoch, Real span)
+//-----------------------------------------------------------------------------
+/**
+ * Retrieves the epoch of the last observation in a group starting with the
+ * current observation
+ *
+ * The group holds the observations that follow the current one, in the
+ * direction of propagation, while they stay in time order and within span
+ * seconds of fromEpoch.
+ *
+ * @param fromEpoch The epoch the group is measured from
+ * @param span      The largest time from fromEpoch in the group, in seconds
+ *
+ * @return The (a.1 modified Julian) epoch of the last observation in the
+ *         group, or 0.0 at the end of the observations.
+ */
+//-----------------------------------------------------------------------------
+GmatTime MeasurementManager::GetObservationGroupEndGT(const GmatTime &fromEpoch,
+      Real span)
+{
+   if (obsIndex == observations.size() || obsIndex == -1)
+      return 0.0;
+
+   Integer step = (isForward ? 1 : -1);
+   Integer last = obsIndex;
+   for (Integer i = obsIndex + step;
+        (i >= 0) && (i < (Integer)observations.size()); i += step)
+   {
+      Real fromLast = (observations[i].epochGT -
+            observations[last].epochGT).GetTimeInSec() * step;
+      Real fromStart = (observations[i].epochGT - fromEpoch).GetTimeInSec() *
+            step;
+      if ((fromLast < 0.0) || (fromStart > span))
+         break;
+      last = i;
+   }
+
+   return observations[last].epochGT;
+}
+
+
 //-----------------------------------------------------------------------------
 // GmatTime GetNextEpoch()
 //-----------------------------------------------------------------------------
@@ -2655,6 +2963,14 @@ bool MeasurementManager::CalculateMeasurements(bool forSimulation, bool withEven
       #endif
       for (UnsignedInt i = 0; i < adapters.size(); ++i)
       {
+         // Adapters simulated by another worker process are skipped
+         if (!IsAdapterActive(i))
+         {
+            measurements[i].isFeasible = false;
+            measurements[i].eventCount = 0;
+            continue;
+         }
+
          // Specify ramp table associated with measurement adapters[i]:
          // Note: Only one ramp table is used for a measurement model
          std::vector<RampTableData>* rt = GetRampTableForAdapter(*adapters[i]);
@@ -2668,7 +2984,21 @@ bool MeasurementManager::CalculateMeasurements(bool forSimulation, bool withEven
             else
                MessageInterface::ShowMessage(" Simulation: measurement adapter %s without events\n", adapters[i]->GetName().c_str());
          #endif
-         measurements[i] = adapters[i]->CalculateMeasurement(withEvents, od, rt, forSimulation);
+         // Each adapter draws its noise from its own stream, so the noise
+         // does not depend on which worker process simulates the adapter
+         RandomNumber *rn = RandomNumber::Instance();
+         rn->SelectStream(i);
+         try
+         {
+            measurements[i] = adapters[i]->CalculateMeasurement(withEvents, od, rt, forSimulation);
+         }
+         catch (...)
+         {
+            rn->ReleaseStream();
+            throw;
+         }
+         rn->ReleaseStream();
+
          if (measurements[i].unfeasibleReason == "R")
             throw MeasurementException(adapters[i]->GetErrorMessage());
 
@@ -3044,6 +3374,43 @@ void MeasurementManager::SetStreamObject(DataFile *newStream)
 }
 
 
+//-----------------------------------------------------------------------------
+// const std::vector<DataFile*>& GetStreamObjects() const
+//-----------------------------------------------------------------------------
+/**
+ * Retrieves the measurement data streams set on this MeasurementManager.
+ *
+ * @return The stream objects
+ */
+//-----------------------------------------------------------------------------
+const std::vector<DataFile*>& MeasurementManager::GetStreamObjects() const
+{
+   return streamList;
+}
+
+
+//-----------------------------------------------------------------------------
+// void SetActiveAdapters(Integer first, Integer count)
+//-----------------------------------------------------------------------------
+/**
+ * Limits simulation to a contiguous range of the tracking data adapters.
+ *
+ * This is used when a simulation is split across worker processes: each
+ * worker calculates and writes only its own adapters.  The other adapters
+ * are reported as infeasible.
+ *
+ * @param first The index of the first adapter to simulate
+ * @param count The number of adapters to simulate; -1 selects all adapters
+ *              from first on
+ */
+//-----------------------------------------------------------------------------
+void MeasurementManager::SetActiveAdapters(Integer first, Integer count)
+{
+   firstActiveAdapter = first;
+   activeAdapterCount = count;
+}
+
+
 ///// TBD: Do we want something more generic here?
 //-----------------------------------------------------------------------------
 // void SetRampTableDataStreamObject(DataFile *newStream)
@@ -3332,6 +3699,28 @@ UnsignedInt MeasurementManager::GetCurrentRecordNumber()
    return obsIndex;
 }
 
+//-----------------------------------------------------------------------------
+// bool IsAdapterActive(UnsignedInt index) const
+//-----------------------------------------------------------------------------
+/**
+ * Checks if an adapter is in the range set by SetActiveAdapters()
+ *
+ * @param index The adapter index
+ *
+ * @return true if the adapter is simulated by this MeasurementManager
+ */
+//-----------------------------------------------------------------------------
+bool MeasurementManager::IsAdapterActive(UnsignedInt index) const
+{
+   if ((Integer)index < firstActiveAdapter)
+      return false;
+   if ((activeAdapterCount >= 0) &&
+       ((Integer)index >= firstActiveAdapter + activeAdapterCount))
+      return false;
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // GetRampTableForAdapter(TrackingDataAdapter& adapter)
 //------------------------------------------------------------------------------
@@ -50,6 +50,9 @@
 #include "Event.hpp"
 
 #include "SignalDataCache.hpp"
+#include <memory>
+
+class DataFileCache;
 
 class PropSetup;
 
@@ -97,6 +100,8 @@ public:
    Integer                 GetEventCount(const Integer forMeasurement = -1);
    const StringArray&      GetStreamList();
    void                    SetStreamObject(DataFile *newStream);
+   const std::vector<DataFile*>& GetStreamObjects() const;
+   void                    SetActiveAdapters(Integer first, Integer count = -1);
    bool                    WriteMeasurement(const Integer measurementToWrite);
 
 ///// TBD: Do we want something more generic here?
@@ -121,6 +126,8 @@ public:
    
    GmatTime                GetEpochGT();
    GmatTime                GetNextEpochGT();
+   GmatTime                GetObservationGroupEndGT(const GmatTime &fromEpoch,
+                                                    Real span);
 
    const ObservationData * GetObsData(const Integer observationToGet = -1);
    ObservationData*        GetObsDataObject(const Integer observationToGet = -1);
@@ -196,6 +203,9 @@ protected:
    /// Association between name of DataFile objects and frequency ramp tables
    std::map<std::string,std::vector<RampTableData> >
                                     rampTables;
+   /// Parsed ramp table files by DataFile name, shared with other readers
+   std::map<std::string,std::shared_ptr<const DataFileCache> >
+                                    rampTableFiles;
 
 
    /// Temporary element used to manage events that are ready for processing
@@ -220,6 +230,10 @@ protected:
    bool                             inSimulationMode;
    /// Flag to indicate direction of measurements
    bool                             isForward;
+   /// Index of the first adapter simulated here (see SetActiveAdapters())
+   Integer                          firstActiveAdapter;
+   /// Number of adapters simulated here, or -1 for all of them
+   Integer                          activeAdapterCount;
 
    Integer                          FindModelForObservation();
 
@@ -228,8 +242,17 @@ private:
    std::map<UnsignedInt, StringArray> trackingConfigsMap;
 
    void UpdateObservationContent(ObservationData* odPointer);
+   bool IsAdapterActive(UnsignedInt index) const;
 
    std::vector<RampTableData>* GetRampTableForAdapter(TrackingDataAdapter& adapter);
+   void AccumulateRampPhases(std::vector<RampTableData> &rampTable);
+   std::string BuildRampIndexKey(const RampTableData &record);
+   bool LoadCachedRampTable(const std::string &fileName,
+                            std::vector<RampTableData> &rampTable,
+                            std::shared_ptr<const DataFileCache> &cached);
+   std::shared_ptr<const DataFileCache>
+        ShareRampTable(const std::string &fileName,
+                       const std::vector<RampTableData> &rampTable);
 
 };
 
@@ -209,6 +209,107 @@ RealArray Troposphere::Correction()
    return out;
 }
 
+
+//------------------------------------------------------------------------------
+// void Corrections(const RealArray &epochs, const RealArray &elevations,
+//       const RealArray &ranges, RealArray &rangeCorrections,
+//       RealArray &elevationCorrections, RealArray &timeCorrections)
+//------------------------------------------------------------------------------
+/**
+ * Computes the refraction corrections of a set of signals seen from the
+ * station, weather and wave length set on this object, such as the
+ * observations of a pass or of an accumulation block.
+ *
+ * The HopfieldSaastamoinen and Marini models compute their weather and
+ * station terms once for the whole set (once per month for Marini) and then
+ * run a single loop over the elevation and range arrays.  TRK-2-23 depends on
+ * the epoch of each signal, so it is evaluated signal by signal.  The results
+ * match calls to Correction() for each signal; the object is left set to the
+ * last signal.
+ *
+ * @param epochs               Epochs of the signals (A1 Mjd)
+ * @param elevations           Elevation angles (rad)
+ * @param ranges               Ranges (m)
+ * @param rangeCorrections     Output range corrections (m)
+ * @param elevationCorrections Output elevation angle corrections (rad)
+ * @param timeCorrections      Output time delays (s)
+ */
+//------------------------------------------------------------------------------
+void Troposphere::Corrections(const RealArray &epochs,
+      const RealArray &elevations, const RealArray &ranges,
+      RealArray &rangeCorrections, RealArray &elevationCorrections,
+      RealArray &timeCorrections)
+{
+   UnsignedInt count = elevations.size();
+   if ((ranges.size() != count) || (epochs.size() != count))
+      throw MeasurementException("Troposphere::Corrections: The epoch, "
+            "elevation and range arrays must have the same size\n");
+
+   rangeCorrections.resize(count);
+   elevationCorrections.resize(count);
+   timeCorrections.resize(count);
+   if (count == 0)
+      return;
+
+   if (modelTypeName == "HopfieldSaastamoinen")
+   {
+      CalculateHS(&elevations[0], &ranges[0], count, &rangeCorrections[0],
+            &elevationCorrections[0]);
+   }
+   else if (modelTypeName == "Marini")
+   {
+      // Runs of signals in the same month share the refractivity lookup
+      UnsignedInt start = 0;
+      while (start < count)
+      {
+         SetTime(epochs[start]);
+         Integer runMonth = month;
+         UnsignedInt end = start + 1;
+         while ((end < count) &&
+                (A1Mjd(epochs[end]).ToA1Date().GetMonth() == runMonth))
+            ++end;
+
+         CalculateMarini(&elevations[start], &ranges[start], end - start,
+               &rangeCorrections[start], &elevationCorrections[start]);
+         start = end;
+      }
+      SetTime(epochs[count-1]);
+   }
+   else if (modelTypeName == "TRK-2-23")
+   {
+      // CalculateTRK223() rewrites the station ID to its DSN form
+      std::string stationId = groundStationId;
+      for (UnsignedInt n = 0; n < count; ++n)
+      {
+         groundStationId = stationId;
+         SetTime(epochs[n]);
+         SetElevationAngle(elevations[n]);
+         SetRange(ranges[n]);
+
+         RealArray out = CalculateTRK223();
+         rangeCorrections[n] = out[0];
+         elevationCorrections[n] = out[1];
+      }
+   }
+   else
+   {
+      MessageInterface::ShowMessage("Troposphere::Corrections: Unrecognized Troposphere model " + modelTypeName + " used\n"
+         "Supported models are HopfieldSaastamoinen, Marini, and TRK-2-23\n");
+      throw MeasurementException("Troposphere::Corrections: Unrecognized Troposphere model " + modelTypeName + " used\n"
+         "Supported models are HopfieldSaastamoinen, Marini, and TRK-2-23\n");
+   }
+
+   for (UnsignedInt n = 0; n < count; ++n)
+      timeCorrections[n] = rangeCorrections[n] /
+            GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM;
+
+   if (modelTypeName != "TRK-2-23")
+   {
+      elevationAngle = elevations[count-1];
+      range = ranges[count-1];
+   }
+}
+
 //------------------------------------------------------------------------------
 // 
 // Real Troposphere::FractionalExpander(Real timeComponent, Real aFactor, Real bFactor, Real cFactor)
@@ -321,6 +422,40 @@ Real Troposphere::LinearInterpolator( Real firstEntry, Real secondEntry, Real sc
 */
 //------------------------------------------------------------------------------
 RealArray Troposphere::CalculateHS()
+{
+   Real drho, dE;
+   CalculateHS(&elevationAngle, &range, 1, &drho, &dE);
+
+   RealArray out;
+   out.push_back(drho);
+   out.push_back(dE);
+   out.push_back(drho / GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM);
+
+   return out;
+}
+
+
+//------------------------------------------------------------------------------
+// void CalculateHS(const Real *E, const Real *rho, UnsignedInt count,
+//                  Real *drho, Real *dE)
+//------------------------------------------------------------------------------
+/** Compute HopfieldSaastamoinen refraction corrections for count signals
+*  sharing the weather and wave length set on this object.
+*
+*  The refractivities, troposphere heights and wave length factors are
+*  computed once.  The loop over the signals has no branches or calls other
+*  than sqrt, sin and cos, and evaluates the power series by running
+*  products, so the compiler can vectorize it.
+*
+*  E array of elevation angles in radians
+*  rho array of ranges in m
+*  count number of signals
+*  drho output array of range corrections in m
+*  dE output array of elevation angle corrections in radians
+*/
+//------------------------------------------------------------------------------
+void Troposphere::CalculateHS(const Real *E, const Real *rho,
+      UnsignedInt count, Real *drho, Real *dE)
 {
    // Determine Re value
    if (!solarSystem)
@@ -334,12 +469,12 @@ RealArray Troposphere::CalculateHS()
       MessageInterface::ShowMessage("Troposphere::Correction: Cannot obtain Earth radius\n");
       throw MeasurementException("Troposphere::Correction: Cannot obtain Earth radius\n");
    }
-   Real Re = earth->GetEquatorialRadius()*GmatMathConstants::KM_TO_M;			// get Earth radius in meters
+   const double Re = earth->GetEquatorialRadius()*GmatMathConstants::KM_TO_M;			// get Earth radius in meters
 
 #ifdef DEBUG_TROPOSPHERE_CORRECTION
-   MessageInterface::ShowMessage("Troposphere::Correction(): Using HopfieldSaastamoinen model\n");
+   MessageInterface::ShowMessage("Troposphere::Correction(): Using HopfieldSaastamoinen model for %u signals\n", count);
    MessageInterface::ShowMessage("   temperature = %f K ,  pressure = %f hPa,  humidity = %f\n", temperature, pressure, humidityFraction);
-   MessageInterface::ShowMessage("   range = %lfm ,  elevationAngle = %lf radian,  waveLength = %lfm\n", range, elevationAngle, waveLength);
+   MessageInterface::ShowMessage("   waveLength = %lfm\n", waveLength);
    MessageInterface::ShowMessage("   earth radius = %lf m\n", Re);
 #endif
 
@@ -348,9 +483,9 @@ RealArray Troposphere::CalculateHS()
    double lp2_inv = 1.0 / ((lambda * 1.0E+06)*(lambda * 1.0E+06));
    double denom = (173.3 - lp2_inv);
    double term1 = 170.2649 / denom;
-   double Ce = term1 * term2;
+   const double Ce = term1 * term2;
    double term3 = (173.3 + lp2_inv) / denom;
-   double Crho = Ce * term3;
+   const double Crho = Ce * term3;
 
 #ifdef DEBUG_TROPOSPHERE_CORRECTION
    MessageInterface::ShowMessage("   Ce = %lf ,  Crho = %lf\n", Ce, Crho);
@@ -360,8 +495,6 @@ RealArray Troposphere::CalculateHS()
    double p = pressure;
    double T = temperature;
    double fh = humidityFraction;
-   double E = elevationAngle;
-   double rho = range;
 
    // refractivities
    double N[2];
@@ -382,67 +515,81 @@ RealArray Troposphere::CalculateHS()
    // compute wet troposphere height
    h[1] = 5.0 * 0.002277 * e * (1255.0 / T + 0.05) / (N[1] * 1.0E-06);
 
-   // distances to top of the troposphere
-   double r[2];
-   double alpha[9][2];
-   double beta[7][2];
-   double cosE = cos(E);
-   double cosE2 = cosE * cosE;
-   double sinE = sin(E);
-
+   // Terms of the sums that depend only on the troposphere heights
+   double Rh2[2], hInv[2], bjScale[2], Nrange[2], Nelev[2];
    for (int j = 0; j < 2; j++)
    {
-      r[j] = sqrt((Re + h[j])*(Re + h[j]) - (Re*Re*cosE2)) - Re * sinE;
-      double aj = -1.0 * sinE / h[j];
-      double bj = -1.0 * cosE2 / (2.0 * h[j] * Re);
-      alpha[0][j] = 1.0;
-      alpha[1][j] = 4.0*aj;
-      alpha[2][j] = 6.0*aj*aj + 4.0*bj;
-      alpha[3][j] = 4.0*aj*(aj*aj + 3.0*bj);
-      alpha[4][j] = pow(aj, 4) + 12.0*aj*aj*bj + 6.0*bj*bj;
-      alpha[5][j] = 4.0*aj*bj*(aj*aj + 3.0*bj);
-      alpha[6][j] = bj * bj*(6.0*aj*aj + 4.0*bj);
-      alpha[7][j] = 4.0 * aj * bj*bj*bj;
-      alpha[8][j] = pow(bj, 4);
-      beta[0][j] = 1.0;
-      beta[1][j] = 3.0*aj;
-      beta[2][j] = 3.0*(aj*aj + bj);
-      beta[3][j] = aj * (aj*aj + 6.0*bj);
-      beta[4][j] = 3.0*bj*(aj*aj + bj);
-      beta[5][j] = 3.0 * aj * bj*bj;
-      beta[6][j] = pow(bj, 3);
+      Rh2[j] = (Re + h[j])*(Re + h[j]);
+      hInv[j] = 1.0 / h[j];
+      bjScale[j] = -1.0 / (2.0 * h[j] * Re);
+      Nrange[j] = N[j] * 1.0E-06;
+      Nelev[j] = N[j] * 1.0E-06 / h[j];
    }
+   const double Re2 = Re * Re;
 
-   double drho = 0.0;
-   double dE = 0.0;
-   for (int j = 0; j < 2; j++)
+   for (UnsignedInt n = 0; n < count; ++n)
    {
-      double sum1 = 0.0;
-      for (int i = 0; i < 9; i++)
-      {
-         double ii = (double)i;
-         double temp1 = alpha[i][j] * pow(r[j], (i + 1)) / (ii + 1.0);
-         sum1 = sum1 + temp1;
-      }
-      double sum2 = 0.0;
-      for (int k = 0; k < 7; k++)
+      double cosE = cos(E[n]);
+      double cosE2 = cosE * cosE;
+      double sinE = sin(E[n]);
+
+      double sumRange = 0.0;
+      double sumElevation = 0.0;
+      for (int j = 0; j < 2; j++)
       {
-         double kk = (double)k;
-         double temp2 = beta[k][j] * pow(r[j], (k + 2)) / ((kk + 1.0)*(kk + 2.0)) + beta[k][j] * pow(r[j], (k + 1))*(rho - r[j]) / (kk + 1);
-         sum2 = sum2 + temp2;
-      }
-      drho = drho + N[j] * 1.0E-06 * sum1;
-      dE = dE + N[j] * 1.0E-06 * sum2 / h[j];
-   }
-   drho = Crho * drho;
-   dE = Ce * 4.0 * cosE * dE / rho;                          // unit: radian
+         // distance to top of the troposphere
+         double r = sqrt(Rh2[j] - (Re2*cosE2)) - Re * sinE;
+         double aj = -1.0 * sinE * hInv[j];
+         double bj = cosE2 * bjScale[j];
+         double aj2 = aj * aj;
+         double bj2 = bj * bj;
+
+         double alpha[9];
+         alpha[0] = 1.0;
+         alpha[1] = 4.0*aj;
+         alpha[2] = 6.0*aj2 + 4.0*bj;
+         alpha[3] = 4.0*aj*(aj2 + 3.0*bj);
+         alpha[4] = aj2*aj2 + 12.0*aj2*bj + 6.0*bj2;
+         alpha[5] = 4.0*aj*bj*(aj2 + 3.0*bj);
+         alpha[6] = bj2*(6.0*aj2 + 4.0*bj);
+         alpha[7] = 4.0 * aj * bj2*bj;
+         alpha[8] = bj2*bj2;
+
+         double beta[7];
+         beta[0] = 1.0;
+         beta[1] = 3.0*aj;
+         beta[2] = 3.0*(aj2 + bj);
+         beta[3] = aj * (aj2 + 6.0*bj);
+         beta[4] = 3.0*bj*(aj2 + bj);
+         beta[5] = 3.0 * aj * bj2;
+         beta[6] = bj2*bj;
+
+         // r^(i+1) is carried from one term to the next
+         double sum1 = 0.0;
+         double rPower = r;
+         for (int i = 0; i < 9; i++)
+         {
+            sum1 = sum1 + alpha[i] * rPower / (i + 1.0);
+            rPower *= r;
+         }
 
-   RealArray out;
-   out.push_back(drho);
-   out.push_back(dE);
-   out.push_back(drho / GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM);
+         double sum2 = 0.0;
+         rPower = r;
+         double rhoMinusR = rho[n] - r;
+         for (int k = 0; k < 7; k++)
+         {
+            sum2 = sum2 + beta[k] * rPower * r / ((k + 1.0)*(k + 2.0)) +
+                  beta[k] * rPower * rhoMinusR / (k + 1.0);
+            rPower *= r;
+         }
 
-   return out;
+         sumRange = sumRange + Nrange[j] * sum1;
+         sumElevation = sumElevation + Nelev[j] * sum2;
+      }
+
+      drho[n] = Crho * sumRange;
+      dE[n] = Ce * 4.0 * cosE * sumElevation / rho[n];       // unit: radian
+   }
 }
 
 
@@ -463,11 +610,43 @@ RealArray Troposphere::CalculateHS()
 */
 //------------------------------------------------------------------------------
 RealArray Troposphere::CalculateMarini()
+{
+   Real drho, dE;
+   CalculateMarini(&elevationAngle, &range, 1, &drho, &dE);
+
+   RealArray out;
+   out.push_back(drho);
+   out.push_back(dE);
+   out.push_back(drho / GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM);
+
+   return out;
+}
+
+
+//------------------------------------------------------------------------------
+// void CalculateMarini(const Real *E, const Real *rho, UnsignedInt count,
+//                      Real *drho, Real *dE)
+//------------------------------------------------------------------------------
+/** Compute Marini refraction corrections for count signals sharing the
+*  station location and month set on this object.
+*
+*  The monthly refractivity lookup and the coefficients of the bending
+*  integrals are computed once; only the terms that depend on the elevation
+*  and range are evaluated for each signal.
+*
+*  E array of elevation angles in radians
+*  rho array of ranges in m
+*  count number of signals
+*  drho output array of range corrections in m
+*  dE output array of elevation angle corrections in radians
+*/
+//------------------------------------------------------------------------------
+void Troposphere::CalculateMarini(const Real *E, const Real *rho,
+      UnsignedInt count, Real *drho, Real *dE)
 {
 #ifdef DEBUG_TROPOSPHERE_CORRECTION
-   MessageInterface::ShowMessage("Troposphere::Correction(): Using Marini model\n");
+   MessageInterface::ShowMessage("Troposphere::Correction(): Using Marini model for %u signals\n", count);
    MessageInterface::ShowMessage("   latitude = %f deg ,  longitude = %f deg, month %d\n", latitude*GmatMathConstants::DEG_PER_RAD, longitude*GmatMathConstants::DEG_PER_RAD, month);
-   MessageInterface::ShowMessage("   range = %lf m ,  elevationAngle = %lf radian\n", range, elevationAngle);
 #endif
 
    if (mariniData.size() == 0)
@@ -479,8 +658,6 @@ RealArray Troposphere::CalculateMarini()
    double LATITUDE = latitude;
    double LONGITUDE = longitude;
    Integer MONTH = month - 1; // January = 0
-   double ELEVATION = elevationAngle;
-   double RGN = range;
 
    // Specify intermediate variables:
    Integer NS;
@@ -488,9 +665,6 @@ RealArray Troposphere::CalculateMarini()
    Real RHO, RS, P, Q, SINEA, COSEA, XIO, XI1, XII1, XII2;
    Real XKO, XMO, XM1, XMM1, XMM2, I, L, M;
 
-   // Specify outputs:
-   Real drho, dE;
-
    /*      SUBROUTINE TROPOA
 
    C  PURPOSE:  TO COMPUTE CORRECTIONS DUE TO THE TROPOSPHERE
@@ -502,9 +676,6 @@ RealArray Troposphere::CalculateMarini()
    //C     GET THE MONTHLY MEAN VALUE OF REFRACTIVITY AND SCALE HEIGHT
    TROGET(LATITUDE, LONGITUDE, MONTH, NS, HT);
 
-   //C     SLANT RANGE
-   RHO = RGN;
-
    //C     SOME EQUATORIAL RADIUS
    RS = 6369.96;
 
@@ -516,12 +687,6 @@ RealArray Troposphere::CalculateMarini()
    //Q = 1.0D-6 * NS * RS / HT;
    Q = 1.0E-6 * NS * RS / HT;
 
-   //C     SIN AND COS OF ELEVATION
-   //SINEA = DSIN(ELEVATION);
-   //COSEA = DCOS(ELEVATION);
-   SINEA = GmatMathUtil::Sin(ELEVATION);
-   COSEA = GmatMathUtil::Cos(ELEVATION);
-
    //C     Eq 7-203c p7-85
    //XIO = SQRT(PI) / (1.0 - 0.9206 * Q) ** 0.4468
    XIO = GmatMathUtil::Sqrt(GmatMathConstants::PI) / GmatMathUtil::Pow(1.0 - 0.9206 * Q, 0.4468);
@@ -555,30 +720,35 @@ RealArray Troposphere::CalculateMarini()
    //XMM2 = 0.75 * (1.0 - 25.0 / 24.0 * Q + 11.0 / 36.0 * Q**2);
    XMM2 = 0.75 * (1.0 - 25.0 / 24.0 * Q + 11.0 / 36.0 * Q*Q);
 
-   //C     Eq 7-200a p7-84 WHERE F = Eq 7-201 p7-85
-   I = BendingIntegral(SINEA, XII1, XII2, XIO, XI1, P);
-
-   //C     Eq 7-199 p7-84
-   //L = 1.D0 - I * SINEA + 0.5D-6 * NS * I**2;
-   L = 1.0 - I * SINEA + 0.5E-6 * NS * I*I;
+   for (UnsignedInt n = 0; n < count; ++n)
+   {
+      //C     SLANT RANGE
+      RHO = rho[n];
 
-   //C     Eq 7-200b p7-84 WHERE F = Eq 7-201 p7-85
-   M = BendingIntegral(SINEA, XMM1, XMM2, XMO, XM1, P);
+      //C     SIN AND COS OF ELEVATION
+      //SINEA = DSIN(ELEVATION);
+      //COSEA = DCOS(ELEVATION);
+      SINEA = GmatMathUtil::Sin(E[n]);
+      COSEA = GmatMathUtil::Cos(E[n]);
 
-   //C     Range correction in km  = Eq 7-198a p7-84
-   //DRANGE = 1.D - 6 * NS * HT * (M - 0.5D - 6 * NS * (RS * COSEA * L) ** 2 / (RHO * HT))
-   drho = 1.0E-6 * NS * HT * (M - 0.5E-6 * NS * GmatMathUtil::Pow(RS * COSEA * L, 2) / (RHO * HT));
+      //C     Eq 7-200a p7-84 WHERE F = Eq 7-201 p7-85
+      I = BendingIntegral(SINEA, XII1, XII2, XIO, XI1, P);
 
-   dE = 1.0E-6 * NS * COSEA * (I - RS * L / RHO);         // unit: radian
+      //C     Eq 7-199 p7-84
+      //L = 1.D0 - I * SINEA + 0.5D-6 * NS * I**2;
+      L = 1.0 - I * SINEA + 0.5E-6 * NS * I*I;
 
-   drho *= GmatMathConstants::KM_TO_M;
+      //C     Eq 7-200b p7-84 WHERE F = Eq 7-201 p7-85
+      M = BendingIntegral(SINEA, XMM1, XMM2, XMO, XM1, P);
 
-   RealArray out;
-   out.push_back(drho);
-   out.push_back(dE);
-   out.push_back(drho / GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM);
+      //C     Range correction in km  = Eq 7-198a p7-84
+      //DRANGE = 1.D - 6 * NS * HT * (M - 0.5D - 6 * NS * (RS * COSEA * L) ** 2 / (RHO * HT))
+      Real RCL = RS * COSEA * L;
+      drho[n] = 1.0E-6 * NS * HT * (M - 0.5E-6 * NS * RCL * RCL / (RHO * HT)) *
+            GmatMathConstants::KM_TO_M;
 
-   return out;
+      dE[n] = 1.0E-6 * NS * COSEA * (I - RS * L / RHO);      // unit: radian
+   }
 }
 
 //------------------------------------------------------------------------
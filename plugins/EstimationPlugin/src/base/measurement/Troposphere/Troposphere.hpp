@@ -45,6 +45,10 @@ public:
    bool SetStationHeight(Real height);
 
    virtual RealArray Correction();     // specify the changes of range, angle, and time
+   // Corrections of a set of signals seen from the same station, such as a pass
+   void Corrections(const RealArray &epochs, const RealArray &elevations,
+                    const RealArray &ranges, RealArray &rangeCorrections,
+                    RealArray &elevationCorrections, RealArray &timeCorrections);
 
 private:
 
@@ -52,6 +56,13 @@ private:
    RealArray CalculateMarini(); // Marini model
    RealArray CalculateTRK223(); // TRK223 model
 
+   // Batch forms of the models: the weather and station terms are computed
+   // once, then the range (m) and elevation (rad) corrections of each signal
+   void CalculateHS(const Real *E, const Real *rho, UnsignedInt count,
+                    Real *drho, Real *dE);
+   void CalculateMarini(const Real *E, const Real *rho, UnsignedInt count,
+                        Real *drho, Real *dE);
+
    void TROGET(Real FLATD, Real FLOND, Integer MON, Integer &NS, Real &HT);
    // 'FF1_Tropo' and 'FF2_Tropo' are necessary because FF1 is an OS X Macro and
    // the code will not compile with original argument name 'FF1'
@@ -380,11 +380,11 @@ std::string DataFile::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer DataFile::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < DataFileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount, DataFileParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatBase::GetParameterID(str);
 }
@@ -870,6 +870,79 @@ bool DataFile::IsOpen()
    return false;
 }
 
+//------------------------------------------------------------------------------
+// bool LimitToTimeWindow()
+//------------------------------------------------------------------------------
+/**
+ * Tells the stream the span of epochs the filters can accept, so streams with
+ * a time index read only the records in it.
+ *
+ * The span is the DataFile start and end epochs, narrowed to the hull of the
+ * accept filter time windows when there are accept filters.  The DataFile
+ * span is skipped when data thinning is on, because the thinning counts every
+ * record read.
+ *
+ * @return true if the stream reads only the records in the span
+ */
+//------------------------------------------------------------------------------
+bool DataFile::LimitToTimeWindow()
+{
+   if (theDatastream == NULL)
+      return false;
+
+   GmatEpoch windowStart = DateUtil::EARLIEST_VALID_MJD_VALUE;
+   GmatEpoch windowEnd = DateUtil::LATEST_VALID_MJD_VALUE;
+   if (thinningRatio == 1.0)
+   {
+      windowStart = estimationStart;
+      windowEnd = estimationEnd;
+   }
+
+   bool hasAcceptFilter = false;
+   GmatEpoch acceptStart = 0.0, acceptEnd = 0.0;
+   for (UnsignedInt i = 0; i < filterList.size(); ++i)
+   {
+      if (filterList[i]->IsOfType("AcceptFilter"))
+      {
+         GmatEpoch start = filterList[i]->GetRealParameter("InitialEpoch");
+         GmatEpoch end = filterList[i]->GetRealParameter("FinalEpoch");
+         if (!hasAcceptFilter || (start < acceptStart))
+            acceptStart = start;
+         if (!hasAcceptFilter || (end > acceptEnd))
+            acceptEnd = end;
+         hasAcceptFilter = true;
+      }
+   }
+   if (hasAcceptFilter)
+   {
+      if (acceptStart > windowStart)
+         windowStart = acceptStart;
+      if (acceptEnd < windowEnd)
+         windowEnd = acceptEnd;
+   }
+
+   return theDatastream->SetTimeWindow(windowStart, windowEnd);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetRecordCount()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of observations the open stream will return
+ *
+ * @return The count, or -1 if the stream does not know it before reading
+ */
+//------------------------------------------------------------------------------
+Integer DataFile::GetRecordCount()
+{
+   if (theDatastream)
+      return theDatastream->GetRecordCount();
+
+   return -1;
+}
+
+
 //------------------------------------------------------------------------------
 // void WriteMeasurement(MeasurementData* theMeas)
 //------------------------------------------------------------------------------
@@ -108,6 +108,8 @@ public:
    virtual bool         SetStream(ObType *thisStream);
    virtual bool         OpenStream(bool simulate = false);
    virtual bool         IsOpen();
+   virtual bool         LimitToTimeWindow();
+   virtual Integer      GetRecordCount();
    virtual void         WriteMeasurement(MeasurementData* theMeas);
    virtual ObservationData*
                         ReadObservation();
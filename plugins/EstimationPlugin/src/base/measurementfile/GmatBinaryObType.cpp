@@ -0,0 +1,1235 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             GmatBinaryObType
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * ObType class used for binary GMAT observation data files
+ */
+//------------------------------------------------------------------------------
+
+
+#include "GmatBinaryObType.hpp"
+#include "GmatObType.hpp"
+#include "MessageInterface.hpp"
+#include "GmatConstants.hpp"
+#include "FileManager.hpp"
+#include "MeasurementException.hpp"
+#include "StringUtil.hpp"
+#include "RealUtilities.hpp"
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+
+#if !defined(_WIN32)
+   #define GMATBINARYOBTYPE_USE_MMAP
+   #include <fcntl.h>
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <unistd.h>
+#endif
+
+
+//#define DEBUG_FILE_ACCESS
+//#define DEBUG_FILE_READ
+//#define DEBUG_FILE_WRITE
+
+
+//-----------------------------------------------------------------------------
+// static data
+//-----------------------------------------------------------------------------
+
+const std::string GmatBinaryObType::FILE_EXTENSION = ".gmb";
+
+const char GmatBinaryObType::MAGIC[16] = "GMATBinaryObs";
+
+const Integer GmatBinaryObType::VERSION = 1;
+
+const Integer GmatBinaryObType::BYTE_ORDER_MARK = 0x01020304;
+
+/// Number of columns following the header
+static const Integer COLUMN_COUNT = 7;
+
+/// Margin added to the time window, in days; the data filters make the cut
+static const Real WINDOW_MARGIN = 1.0 / GmatTimeConstants::SECS_PER_DAY;
+
+
+//-----------------------------------------------------------------------------
+// GmatBinaryObType(const std::string withName)
+//-----------------------------------------------------------------------------
+/**
+ * Default constructor
+ *
+ * @param withName The name of the new object
+ */
+//-----------------------------------------------------------------------------
+GmatBinaryObType::GmatBinaryObType(const std::string withName) :
+   ObType               ("GMATBinary", withName),
+   writing              (false),
+   fileData             (NULL),
+   fileSize             (0),
+   isMapped             (false),
+   recordCount          (0),
+   epochColumn          (NULL),
+   recordColumn         (NULL),
+   participantColumn    (NULL),
+   sensorColumn         (NULL),
+   valueColumn          (NULL),
+   firstRecord          (0),
+   endRecord            (0),
+   nextRecord           (0),
+   hasWindow            (false),
+   windowStart          (0.0),
+   windowEnd            (0.0)
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// ~GmatBinaryObType()
+//-----------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//-----------------------------------------------------------------------------
+GmatBinaryObType::~GmatBinaryObType()
+{
+   UnmapFile();
+}
+
+
+//-----------------------------------------------------------------------------
+// GmatBinaryObType(const GmatBinaryObType& ot)
+//-----------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * The copy is not open; it shares the time window of the original.
+ *
+ * @param ot The GmatBinaryObType that gets copied to this one
+ */
+//-----------------------------------------------------------------------------
+GmatBinaryObType::GmatBinaryObType(const GmatBinaryObType& ot) :
+   ObType               (ot),
+   writing              (false),
+   fileData             (NULL),
+   fileSize             (0),
+   isMapped             (false),
+   recordCount          (0),
+   epochColumn          (NULL),
+   recordColumn         (NULL),
+   participantColumn    (NULL),
+   sensorColumn         (NULL),
+   valueColumn          (NULL),
+   firstRecord          (0),
+   endRecord            (0),
+   nextRecord           (0),
+   hasWindow            (ot.hasWindow),
+   windowStart          (ot.windowStart),
+   windowEnd            (ot.windowEnd)
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// GmatBinaryObType& operator=(const GmatBinaryObType& ot)
+//-----------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param ot The GmatBinaryObType that gets copied to this one
+ *
+ * @return This GmatBinaryObType, configured to match ot
+ */
+//-----------------------------------------------------------------------------
+GmatBinaryObType& GmatBinaryObType::operator=(const GmatBinaryObType& ot)
+{
+   if (this != &ot)
+   {
+      hasWindow   = ot.hasWindow;
+      windowStart = ot.windowStart;
+      windowEnd   = ot.windowEnd;
+   }
+
+   return *this;
+}
+
+
+//-----------------------------------------------------------------------------
+// GmatBase* Clone() const
+//-----------------------------------------------------------------------------
+/**
+ * Cloning method used to create a GmatBinaryObType from a GmatBase pointer
+ *
+ * @return A new GmatBinaryObType object matching this one
+ */
+//-----------------------------------------------------------------------------
+GmatBase* GmatBinaryObType::Clone() const
+{
+   return new GmatBinaryObType(*this);
+}
+
+
+//-----------------------------------------------------------------------------
+// bool Initialize()
+//-----------------------------------------------------------------------------
+/**
+ * Prepares this GmatBinaryObType for use
+ *
+ * @return true on success, false on failure
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::Initialize()
+{
+   ObType::Initialize();
+
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool Open(bool forRead, bool forWrite, bool append)
+//-----------------------------------------------------------------------------
+/**
+ * Opens a GmatBinaryObType stream for processing
+ *
+ * Files opened for reading are mapped and checked.  Files opened for writing
+ * are written when the stream is closed.
+ *
+ * @param forRead True to open for reading, false otherwise
+ * @param forWrite True to open for writing, false otherwise
+ * @param append True if data being written should be appended, which binary
+ *               files do not support
+ *
+ * @return true if the the stream was opened; failures throw
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::Open(bool forRead, bool forWrite, bool append)
+{
+   if (IsOpen())
+      return true;
+
+   if (append || (forRead && forWrite))
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " can only be opened to read or to write, and cannot be "
+            "appended to\n");
+
+   filePath = GetFullPath(streamName);
+
+   #ifdef DEBUG_FILE_ACCESS
+      MessageInterface::ShowMessage("GmatBinaryObType::Open(%s, %s) for %s\n",
+            (forRead ? "true" : "false"), (forWrite ? "true" : "false"),
+            filePath.c_str());
+   #endif
+
+   if (forWrite)
+   {
+      // Fail now rather than after the simulation if the file is not writable
+      std::ofstream probe(filePath.c_str(), std::ios::binary);
+      if (!probe.is_open())
+         throw MeasurementException("GMATBinary Data File " + streamName +
+               " could not be opened\n");
+      probe.close();
+
+      writing = true;
+      writeEpochs.clear();
+      writeRecords.clear();
+      writeParticipants.clear();
+      writeSensors.clear();
+      writeValues.clear();
+      strings.clear();
+      stringIndex.clear();
+      return true;
+   }
+
+   if (!MapFile())
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " could not be opened\n");
+
+   ApplyWindow();
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool IsOpen()
+//-----------------------------------------------------------------------------
+/**
+ * Tests to see if the GmatBinaryObType data file has been opened
+ *
+ * @return true if the file is open, false if not.
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::IsOpen()
+{
+   return writing || (fileData != NULL);
+}
+
+
+//-----------------------------------------------------------------------------
+// bool AddMeasurement(MeasurementData *md)
+//-----------------------------------------------------------------------------
+/**
+ * Adds a new measurement to the data file
+ *
+ * The record holds the fields GmatObType writes for the measurement type, in
+ * the form its reader returns them.
+ *
+ * @param md The measurement data containing the observation.
+ *
+ * @return true on success, false if the stream is not open for writing
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::AddMeasurement(MeasurementData *md)
+{
+   ObservationData od;
+   od.Clear();
+   od.epochSystem = TimeSystemConverter::TAIMJD;
+
+   if (md->epochGT.GetMjd() <= 0.0)
+   {
+      od.epoch = (md->epochSystem == TimeSystemConverter::TAIMJD ? md->epoch :
+         theTimeConverter->ConvertToTaiMjd(md->epochSystem, md->epoch,
+         GmatTimeConstants::JD_NOV_17_1858));
+      od.epochGT = od.epoch;
+   }
+   else
+   {
+      od.epochGT = (md->epochSystem == TimeSystemConverter::TAIMJD ? md->epochGT :
+         theTimeConverter->ConvertToTaiMjd(md->epochSystem, md->epochGT,
+         GmatTimeConstants::JD_NOV_17_1858));
+      od.epoch = od.epochGT.GetMjd();
+   }
+
+   od.typeName = md->typeName;
+   od.type = md->type;
+
+   // Participants as GmatObType reads back what it writes
+   if (md->type < 9000)
+      od.participantIDs = md->participantIDs;
+   else if (md->participantIDs.size() == 0)
+      throw MeasurementException("Error: No participant is set to "
+            "measurement data with type " + md->typeName + ".\n");
+   else if (md->participantIDs.size() == 1)
+   {
+      od.participantIDs.push_back(md->sensorIDs[0]);
+      od.sensorIDs.push_back(md->sensorIDs[0]);
+   }
+   else
+   {
+      od.participantIDs = md->participantIDs;
+      od.sensorIDs.assign(od.participantIDs.size(), "");
+   }
+
+   for (UnsignedInt k = 0; k < md->value.size(); ++k)
+   {
+      Real value = md->value[k];
+      if (md->typeName == "DSN_SeqRange")
+         value = GmatMathUtil::Mod(value, md->rangeModulo);
+      od.value.push_back(value);
+      od.value_orig.push_back(value);
+   }
+
+   if ((md->typeName == "DSN_TCP") || (md->typeName == "RangeRate"))
+   {
+      od.uplinkBand           = md->uplinkBand;
+      od.dopplerCountInterval = md->dopplerCountInterval;
+   }
+   else if ((md->typeName == "SN_Doppler") ||
+            (md->typeName == "SN_Doppler_Rtn") ||
+            (md->typeName == "BRTS_Doppler") ||
+            (md->typeName == "SN_DOWD"))
+   {
+      od.tdrsNode4Freq        = md->tdrsNode4Freq;
+      od.tdrsNode4Band        = md->tdrsNode4Band;
+      od.tdrsServiceID        = md->tdrsServiceID;
+      od.tdrsDataFlag         = md->tdrsDataFlag;
+      od.tdrsSMARID           = md->tdrsSMARID;
+      od.dopplerCountInterval = md->dopplerCountInterval;
+
+      if (md->typeName == "SN_DOWD")
+      {
+         od.tdrsNode4FreqTDRSRef        = md->tdrsNode4FreqTDRSRef;
+         od.tdrsNode4BandTDRSRef        = md->tdrsNode4BandTDRSRef;
+         od.tdrsServiceIDTDRSRef        = md->tdrsServiceIDTDRSRef;
+         od.tdrsDataFlagTDRSRef         = md->tdrsDataFlagTDRSRef;
+         od.tdrsSMARIDTDRSRef           = md->tdrsSMARIDTDRSRef;
+         od.dopplerCountIntervalTDRSRef = md->dopplerCountIntervalTDRSRef;
+      }
+   }
+   else if (md->typeName == "DSN_SeqRange")
+   {
+      od.uplinkBand        = md->uplinkBand;
+      od.uplinkFreqAtRecei = md->uplinkFreqAtRecei;
+      od.rangeModulo       = md->rangeModulo;
+   }
+
+   // The units GmatObType assigns on reading
+   if ((od.typeName == "Range") || (od.typeName == "SN_Range") ||
+       (od.typeName == "BRTS_Range") || (od.typeName == "GPS_PosVec") ||
+       (od.typeName == "Range_Skin"))
+      od.unit = "km";
+   else if (od.typeName == "RangeRate")
+      od.unit = "km/s";
+   else if ((od.typeName == "DSN_TCP") || (od.typeName == "SN_Doppler") ||
+            (od.typeName == "SN_Doppler_Rtn") ||
+            (od.typeName == "BRTS_Doppler") || (od.typeName == "SN_DOWD"))
+      od.unit = "Hz";
+   else if ((od.typeName == "Azimuth") || (od.typeName == "Elevation") ||
+            (od.typeName == "XEast") || (od.typeName == "YNorth") ||
+            (od.typeName == "XSouth") || (od.typeName == "YEast") ||
+            (od.typeName == "RightAscension") ||
+            (od.typeName == "Declination"))
+      od.unit = "deg";
+   else if (od.typeName == "DSN_SeqRange")
+      od.unit = "RU";
+
+   return AddObservation(od);
+}
+
+
+//-----------------------------------------------------------------------------
+// bool AddObservation(const ObservationData &od)
+//-----------------------------------------------------------------------------
+/**
+ * Adds an observation record to the file being written
+ *
+ * @param od The observation; its epoch may be in any time system
+ *
+ * @return true on success, false if the stream is not open for writing
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::AddObservation(const ObservationData &od)
+{
+   if (!writing)
+      return false;
+
+   GmatTime taiEpochGT = (od.epochSystem == TimeSystemConverter::TAIMJD ?
+         od.epochGT : theTimeConverter->ConvertToTaiMjd(od.epochSystem,
+         od.epochGT, GmatTimeConstants::JD_NOV_17_1858));
+   GmatEpoch taiEpoch = (od.epochSystem == TimeSystemConverter::TAIMJD ?
+         od.epoch : theTimeConverter->ConvertToTaiMjd(od.epochSystem,
+         od.epoch, GmatTimeConstants::JD_NOV_17_1858));
+
+   Record rec;
+   memset(&rec, 0, sizeof(Record));
+   rec.taiDays    = (Integer)taiEpochGT.GetDays();
+   rec.taiSec     = (Integer)taiEpochGT.GetSec();
+   rec.taiFracSec = taiEpochGT.GetFracSec();
+   rec.type       = od.type;
+   rec.typeName   = GetStringIndex(od.typeName);
+   rec.unit       = GetStringIndex(od.unit);
+
+   rec.firstParticipant = (Integer)writeParticipants.size();
+   rec.participantCount = (Integer)od.participantIDs.size();
+   for (UnsignedInt i = 0; i < od.participantIDs.size(); ++i)
+      writeParticipants.push_back(GetStringIndex(od.participantIDs[i]));
+   rec.firstSensor = (Integer)writeSensors.size();
+   rec.sensorCount = (Integer)od.sensorIDs.size();
+   for (UnsignedInt i = 0; i < od.sensorIDs.size(); ++i)
+      writeSensors.push_back(GetStringIndex(od.sensorIDs[i]));
+   rec.firstValue = (Integer)writeValues.size();
+   rec.valueCount = (Integer)od.value.size();
+   writeValues.insert(writeValues.end(), od.value.begin(), od.value.end());
+
+   rec.uplinkBand                  = od.uplinkBand;
+   rec.uplinkFreqAtRecei           = od.uplinkFreqAtRecei;
+   rec.rangeModulo                 = od.rangeModulo;
+   rec.dopplerCountInterval        = od.dopplerCountInterval;
+   rec.tdrsNode4Freq               = od.tdrsNode4Freq;
+   rec.tdrsNode4Band               = od.tdrsNode4Band;
+   rec.tdrsServiceID               = GetStringIndex(od.tdrsServiceID);
+   rec.tdrsDataFlag                = od.tdrsDataFlag;
+   rec.tdrsSMARID                  = od.tdrsSMARID;
+   rec.dopplerCountIntervalTDRSRef = od.dopplerCountIntervalTDRSRef;
+   rec.tdrsNode4FreqTDRSRef        = od.tdrsNode4FreqTDRSRef;
+   rec.tdrsNode4BandTDRSRef        = od.tdrsNode4BandTDRSRef;
+   rec.tdrsServiceIDTDRSRef        = GetStringIndex(od.tdrsServiceIDTDRSRef);
+   rec.tdrsDataFlagTDRSRef         = od.tdrsDataFlagTDRSRef;
+   rec.tdrsSMARIDTDRSRef           = od.tdrsSMARIDTDRSRef;
+
+   writeEpochs.push_back(taiEpoch);
+   writeRecords.push_back(rec);
+
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// ObservationData* ReadObservation()
+//-----------------------------------------------------------------------------
+/**
+ * Retrieves the next observation record in the time window
+ *
+ * @return The observation data from the stream.  If there is no more data in
+ * the window, a NULL pointer is returned.
+ */
+//-----------------------------------------------------------------------------
+ObservationData* GmatBinaryObType::ReadObservation()
+{
+   if ((fileData == NULL) || (nextRecord >= endRecord))
+      return NULL;
+
+   return GetObservation(nextRecord++);
+}
+
+
+//-----------------------------------------------------------------------------
+// bool Close()
+//-----------------------------------------------------------------------------
+/**
+ * Closes the data stream, writing the file if it was open for writing
+ *
+ * @return true on success, false on failure
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::Close()
+{
+   bool retval = false;
+
+   if (writing)
+   {
+      retval = WriteFile();
+      writing = false;
+      writeEpochs.clear();
+      writeRecords.clear();
+      writeParticipants.clear();
+      writeSensors.clear();
+      writeValues.clear();
+      stringIndex.clear();
+      strings.clear();
+   }
+   else if (fileData != NULL)
+   {
+      UnmapFile();
+      retval = true;
+   }
+
+   return retval;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool Finalize()
+//-----------------------------------------------------------------------------
+/**
+ * Completes operations on this GmatBinaryObType.
+ *
+ * @return true always -- there is no specific finalization needed.
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::Finalize()
+{
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool SetTimeWindow(GmatEpoch startA1Mjd, GmatEpoch endA1Mjd)
+//-----------------------------------------------------------------------------
+/**
+ * Limits the records read to a span of epochs, and restarts reading at the
+ * first record of the span.
+ *
+ * @param startA1Mjd The A.1 modified Julian epoch of the start of the span
+ * @param endA1Mjd   The A.1 modified Julian epoch of the end of the span
+ *
+ * @return true
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::SetTimeWindow(GmatEpoch startA1Mjd, GmatEpoch endA1Mjd)
+{
+   hasWindow = true;
+   windowStart = theTimeConverter->Convert(startA1Mjd,
+         TimeSystemConverter::A1MJD, TimeSystemConverter::TAIMJD) -
+         WINDOW_MARGIN;
+   windowEnd = theTimeConverter->Convert(endA1Mjd,
+         TimeSystemConverter::A1MJD, TimeSystemConverter::TAIMJD) +
+         WINDOW_MARGIN;
+
+   ApplyWindow();
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer GetRecordCount()
+//-----------------------------------------------------------------------------
+/**
+ * Returns the number of records in the time window of the open file
+ *
+ * @return The count, or -1 if the file is not open for reading
+ */
+//-----------------------------------------------------------------------------
+Integer GmatBinaryObType::GetRecordCount()
+{
+   if (fileData == NULL)
+      return -1;
+   return endRecord - firstRecord;
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer GetFileRecordCount() const
+//-----------------------------------------------------------------------------
+/**
+ * Returns the number of records in the open file, ignoring the time window
+ *
+ * @return The count
+ */
+//-----------------------------------------------------------------------------
+Integer GmatBinaryObType::GetFileRecordCount() const
+{
+   return recordCount;
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer FindRecord(GmatEpoch taiMjd) const
+//-----------------------------------------------------------------------------
+/**
+ * Finds the first record at or after an epoch
+ *
+ * @param taiMjd The TAI modified Julian epoch
+ *
+ * @return The record index, GetFileRecordCount() if all records are earlier
+ */
+//-----------------------------------------------------------------------------
+Integer GmatBinaryObType::FindRecord(GmatEpoch taiMjd) const
+{
+   if (epochColumn == NULL)
+      return 0;
+   return (Integer)(std::lower_bound(epochColumn, epochColumn + recordCount,
+                                     taiMjd) - epochColumn);
+}
+
+
+//-----------------------------------------------------------------------------
+// const Real* GetEpochs() const
+//-----------------------------------------------------------------------------
+/**
+ * Returns the epoch column of the open file
+ *
+ * @return The TAI modified Julian epochs, in ascending order, or NULL
+ */
+//-----------------------------------------------------------------------------
+const Real* GmatBinaryObType::GetEpochs() const
+{
+   return epochColumn;
+}
+
+
+//-----------------------------------------------------------------------------
+// const GmatBinaryObType::Record* GetRecords() const
+//-----------------------------------------------------------------------------
+/**
+ * Returns the record column of the open file
+ *
+ * @return The records, or NULL
+ */
+//-----------------------------------------------------------------------------
+const GmatBinaryObType::Record* GmatBinaryObType::GetRecords() const
+{
+   return recordColumn;
+}
+
+
+//-----------------------------------------------------------------------------
+// const Integer* GetParticipantIDs() const
+//-----------------------------------------------------------------------------
+/**
+ * Returns the participant column of the open file
+ *
+ * @return The string table indices of the participant IDs, or NULL
+ */
+//-----------------------------------------------------------------------------
+const Integer* GmatBinaryObType::GetParticipantIDs() const
+{
+   return participantColumn;
+}
+
+
+//-----------------------------------------------------------------------------
+// const Integer* GetSensorIDs() const
+//-----------------------------------------------------------------------------
+/**
+ * Returns the sensor column of the open file
+ *
+ * @return The string table indices of the sensor IDs, or NULL
+ */
+//-----------------------------------------------------------------------------
+const Integer* GmatBinaryObType::GetSensorIDs() const
+{
+   return sensorColumn;
+}
+
+
+//-----------------------------------------------------------------------------
+// const Real* GetValues() const
+//-----------------------------------------------------------------------------
+/**
+ * Returns the measurement value column of the open file
+ *
+ * @return The values, or NULL
+ */
+//-----------------------------------------------------------------------------
+const Real* GmatBinaryObType::GetValues() const
+{
+   return valueColumn;
+}
+
+
+//-----------------------------------------------------------------------------
+// const std::string& GetString(Integer index) const
+//-----------------------------------------------------------------------------
+/**
+ * Returns an entry of the string table
+ *
+ * @param index The string table index
+ *
+ * @return The string
+ */
+//-----------------------------------------------------------------------------
+const std::string& GmatBinaryObType::GetString(Integer index) const
+{
+   if ((index < 0) || (index >= (Integer)strings.size()))
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " refers to a missing string\n");
+   return strings[index];
+}
+
+
+//-----------------------------------------------------------------------------
+// ObservationData* GetObservation(Integer index)
+//-----------------------------------------------------------------------------
+/**
+ * Fills the observation data for a record of the open file
+ *
+ * @param index The record index
+ *
+ * @return The observation data, which is reused by the next call
+ */
+//-----------------------------------------------------------------------------
+ObservationData* GmatBinaryObType::GetObservation(Integer index)
+{
+   if ((index < 0) || (index >= recordCount))
+      return NULL;
+
+   const Record &rec = recordColumn[index];
+   if ((rec.firstParticipant < 0) || (rec.participantCount < 0) ||
+       (rec.firstParticipant + rec.participantCount > fileHeader.participantCount) ||
+       (rec.firstSensor < 0) || (rec.sensorCount < 0) ||
+       (rec.firstSensor + rec.sensorCount > fileHeader.sensorCount) ||
+       (rec.firstValue < 0) || (rec.valueCount < 0) ||
+       (rec.firstValue + rec.valueCount > fileHeader.valueCount))
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " has a corrupt record\n");
+
+   currentObs.Clear();
+   currentObs.dataFormat = "GMATBinary";
+
+   GmatTime taiEpochGT(0.0);
+   taiEpochGT.SetDays(rec.taiDays);
+   taiEpochGT.SetSec(rec.taiSec);
+   taiEpochGT.SetFracSec(rec.taiFracSec);
+   currentObs.epochGT = (currentObs.epochSystem == TimeSystemConverter::TAIMJD ?
+         taiEpochGT :
+         theTimeConverter->ConvertFromTaiMjd(currentObs.epochSystem, taiEpochGT,
+         GmatTimeConstants::JD_NOV_17_1858));
+   currentObs.epoch = (currentObs.epochSystem == TimeSystemConverter::TAIMJD ?
+         epochColumn[index] :
+         theTimeConverter->ConvertFromTaiMjd(currentObs.epochSystem,
+         epochColumn[index], GmatTimeConstants::JD_NOV_17_1858));
+
+   currentObs.typeName = GetString(rec.typeName);
+   currentObs.type = rec.type;
+
+   // Verify measurement type once per type name
+   if (!typeChecked[rec.typeName])
+   {
+      StringArray typeList = currentObs.GetAvailableMeasurementTypes();
+      if (find(typeList.begin(), typeList.end(), currentObs.typeName) ==
+            typeList.end())
+         throw MeasurementException("Error: GMAT cannot handle observation "
+               "data with type '" + currentObs.typeName + "'.\n");
+      typeChecked[rec.typeName] = true;
+   }
+
+   for (Integer i = 0; i < rec.participantCount; ++i)
+      currentObs.participantIDs.push_back(
+            GetString(participantColumn[rec.firstParticipant + i]));
+   for (Integer i = 0; i < rec.sensorCount; ++i)
+      currentObs.sensorIDs.push_back(
+            GetString(sensorColumn[rec.firstSensor + i]));
+   currentObs.value.assign(valueColumn + rec.firstValue,
+                           valueColumn + rec.firstValue + rec.valueCount);
+   currentObs.value_orig = currentObs.value;
+   currentObs.unit = GetString(rec.unit);
+
+   currentObs.uplinkBand                  = rec.uplinkBand;
+   currentObs.uplinkFreqAtRecei           = rec.uplinkFreqAtRecei;
+   currentObs.rangeModulo                 = rec.rangeModulo;
+   currentObs.dopplerCountInterval        = rec.dopplerCountInterval;
+   currentObs.tdrsNode4Freq               = rec.tdrsNode4Freq;
+   currentObs.tdrsNode4Band               = rec.tdrsNode4Band;
+   currentObs.tdrsServiceID               = GetString(rec.tdrsServiceID);
+   currentObs.tdrsDataFlag                = rec.tdrsDataFlag;
+   currentObs.tdrsSMARID                  = rec.tdrsSMARID;
+   currentObs.dopplerCountIntervalTDRSRef = rec.dopplerCountIntervalTDRSRef;
+   currentObs.tdrsNode4FreqTDRSRef        = rec.tdrsNode4FreqTDRSRef;
+   currentObs.tdrsNode4BandTDRSRef        = rec.tdrsNode4BandTDRSRef;
+   currentObs.tdrsServiceIDTDRSRef        = GetString(rec.tdrsServiceIDTDRSRef);
+   currentObs.tdrsDataFlagTDRSRef         = rec.tdrsDataFlagTDRSRef;
+   currentObs.tdrsSMARIDTDRSRef           = rec.tdrsSMARIDTDRSRef;
+
+   #ifdef DEBUG_FILE_READ
+      MessageInterface::ShowMessage("GmatBinaryObType record %d: %.12lf %s %d\n",
+            index, currentObs.epoch, currentObs.typeName.c_str(),
+            currentObs.type);
+   #endif
+
+   return &currentObs;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool IsBinaryFile(const std::string &fileName)
+//-----------------------------------------------------------------------------
+/**
+ * Checks if a data file name has the binary data file extension
+ *
+ * @param fileName The file name
+ *
+ * @return true for a .gmb file
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::IsBinaryFile(const std::string &fileName)
+{
+   size_t dotLoc = fileName.find_last_of('.');
+   if (dotLoc == std::string::npos)
+      return false;
+   return GmatStringUtil::ToLower(fileName.substr(dotLoc)) == FILE_EXTENSION;
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer ConvertFromText(const std::string &textFile,
+//                         const std::string &binaryFile)
+//-----------------------------------------------------------------------------
+/**
+ * Converts a GMATInternal text data file to a binary data file
+ *
+ * The records are read with GmatObType, so the binary file returns the same
+ * observations, sorted by epoch.
+ *
+ * @param textFile   The .gmd file name
+ * @param binaryFile The .gmb file name
+ *
+ * @return The number of records converted
+ */
+//-----------------------------------------------------------------------------
+Integer GmatBinaryObType::ConvertFromText(const std::string &textFile,
+                                          const std::string &binaryFile)
+{
+   GmatObType reader;
+   reader.SetStreamName(textFile);
+   reader.Open(true, false);
+
+   GmatBinaryObType writer;
+   writer.SetStreamName(binaryFile);
+   writer.Open(false, true);
+
+   Integer count = 0;
+   ObservationData *od;
+   while ((od = reader.ReadObservation()) != NULL)
+   {
+      writer.AddObservation(*od);
+      ++count;
+   }
+   reader.Close();
+
+   if (!writer.Close())
+      throw MeasurementException("GMATBinary Data File " + binaryFile +
+            " could not be written\n");
+
+   return count;
+}
+
+
+//-----------------------------------------------------------------------------
+// std::string GetFullPath(const std::string &name) const
+//-----------------------------------------------------------------------------
+/**
+ * Resolves a file name: names without a path are placed in the measurement
+ * directory, and an extension-less name gets the .gmb extension.
+ *
+ * @param name The stream name
+ *
+ * @return The full path of the file
+ */
+//-----------------------------------------------------------------------------
+std::string GmatBinaryObType::GetFullPath(const std::string &name) const
+{
+   std::string fullPath = "";
+
+   if ((name.find('/') == std::string::npos) &&
+       (name.find('\\') == std::string::npos))
+      fullPath = FileManager::Instance()->GetPathname(
+            FileManager::MEASUREMENT_PATH);
+   fullPath += name;
+
+   size_t dotLoc = fullPath.find_last_of('.');
+   size_t slashLoc = fullPath.find_last_of('/');
+   if (slashLoc == std::string::npos)
+      slashLoc = fullPath.find_last_of('\\');
+
+   if ((dotLoc == std::string::npos) || (dotLoc < slashLoc))
+      fullPath += FILE_EXTENSION;
+
+   return fullPath;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool MapFile()
+//-----------------------------------------------------------------------------
+/**
+ * Maps the file and sets up the column pointers and the string table
+ *
+ * @return true on success, false if the file cannot be read; a file that is
+ *         not a valid binary data file throws
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::MapFile()
+{
+   UnmapFile();
+
+   #ifdef GMATBINARYOBTYPE_USE_MMAP
+      int fd = open(filePath.c_str(), O_RDONLY);
+      if (fd < 0)
+         return false;
+
+      struct stat info;
+      if ((fstat(fd, &info) == 0) && (info.st_size > 0))
+      {
+         void *addr = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+         if (addr != MAP_FAILED)
+         {
+            fileData = (const char*)addr;
+            fileSize = info.st_size;
+            isMapped = true;
+         }
+      }
+      close(fd);
+   #endif
+
+   if (fileData == NULL)
+   {
+      std::ifstream in(filePath.c_str(), std::ios::binary | std::ios::ate);
+      if (!in.is_open())
+         return false;
+      std::streamoff size = in.tellg();
+      if (size > 0)
+      {
+         loadedData.resize((size_t)size);
+         in.seekg(0);
+         in.read(&loadedData[0], size);
+         if (!in)
+            return false;
+         fileData = &loadedData[0];
+      }
+      fileSize = (size_t)size;
+   }
+
+   FileHeader hdr;
+   size_t offsets[COLUMN_COUNT];
+   bool valid = (fileData != NULL) && (fileSize >= sizeof(FileHeader));
+   if (valid)
+   {
+      memcpy(&hdr, fileData, sizeof(FileHeader));
+      valid = (memcmp(hdr.magic, MAGIC, sizeof(MAGIC)) == 0) &&
+              (hdr.version == VERSION) &&
+              (hdr.recordCount >= 0) && (hdr.participantCount >= 0) &&
+              (hdr.sensorCount >= 0) && (hdr.valueCount >= 0) &&
+              (hdr.stringCount >= 0) && (hdr.stringBytes >= 0);
+   }
+   if (valid && (hdr.byteOrder != BYTE_ORDER_MARK))
+   {
+      UnmapFile();
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " was written on a computer with a different byte order\n");
+   }
+   if (valid)
+      valid = (GetColumnOffsets(hdr, offsets) == fileSize);
+   if (!valid)
+   {
+      UnmapFile();
+      throw MeasurementException("GMATBinary Data File " + streamName +
+            " is not a valid binary observation data file\n");
+   }
+
+   fileHeader        = hdr;
+   recordCount       = hdr.recordCount;
+   epochColumn       = (const Real*)(fileData + offsets[0]);
+   recordColumn      = (const Record*)(fileData + offsets[1]);
+   participantColumn = (const Integer*)(fileData + offsets[2]);
+   sensorColumn      = (const Integer*)(fileData + offsets[3]);
+   valueColumn       = (const Real*)(fileData + offsets[4]);
+
+   const Integer *stringStarts = (const Integer*)(fileData + offsets[5]);
+   const char *chars = fileData + offsets[6];
+   strings.clear();
+   for (Integer i = 0; i < hdr.stringCount; ++i)
+   {
+      if ((stringStarts[i] < 0) || (stringStarts[i] > stringStarts[i+1]) ||
+          (stringStarts[i+1] > hdr.stringBytes))
+      {
+         UnmapFile();
+         throw MeasurementException("GMATBinary Data File " + streamName +
+               " has a corrupt string table\n");
+      }
+      strings.push_back(std::string(chars + stringStarts[i],
+                                    stringStarts[i+1] - stringStarts[i]));
+   }
+   typeChecked.assign(strings.size(), false);
+
+   #ifdef DEBUG_FILE_ACCESS
+      MessageInterface::ShowMessage("GmatBinaryObType mapped %d records and "
+            "%d strings of %s\n", recordCount, hdr.stringCount,
+            filePath.c_str());
+   #endif
+
+   return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// void UnmapFile()
+//-----------------------------------------------------------------------------
+/**
+ * Releases the file opened for reading
+ */
+//-----------------------------------------------------------------------------
+void GmatBinaryObType::UnmapFile()
+{
+   #ifdef GMATBINARYOBTYPE_USE_MMAP
+      if (isMapped && (fileData != NULL))
+         munmap((void*)fileData, fileSize);
+   #endif
+
+   fileData = NULL;
+   fileSize = 0;
+   isMapped = false;
+   loadedData.clear();
+
+   recordCount       = 0;
+   epochColumn       = NULL;
+   recordColumn      = NULL;
+   participantColumn = NULL;
+   sensorColumn      = NULL;
+   valueColumn       = NULL;
+   firstRecord = endRecord = nextRecord = 0;
+   if (!writing)
+      strings.clear();
+}
+
+
+//-----------------------------------------------------------------------------
+// void ApplyWindow()
+//-----------------------------------------------------------------------------
+/**
+ * Locates the records of the time window and rewinds to its first record
+ */
+//-----------------------------------------------------------------------------
+void GmatBinaryObType::ApplyWindow()
+{
+   if (fileData == NULL)
+      return;
+
+   firstRecord = 0;
+   endRecord = recordCount;
+   if (hasWindow)
+   {
+      firstRecord = FindRecord(windowStart);
+      endRecord = (Integer)(std::upper_bound(epochColumn,
+            epochColumn + recordCount, windowEnd) - epochColumn);
+      if (endRecord < firstRecord)
+         endRecord = firstRecord;
+   }
+   nextRecord = firstRecord;
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer GetStringIndex(const std::string &str)
+//-----------------------------------------------------------------------------
+/**
+ * Finds or adds a string table entry of the file being written
+ *
+ * @param str The string
+ *
+ * @return The string table index
+ */
+//-----------------------------------------------------------------------------
+Integer GmatBinaryObType::GetStringIndex(const std::string &str)
+{
+   std::map<std::string, Integer>::iterator entry = stringIndex.find(str);
+   if (entry != stringIndex.end())
+      return entry->second;
+
+   Integer index = (Integer)strings.size();
+   strings.push_back(str);
+   stringIndex[str] = index;
+   return index;
+}
+
+
+//-----------------------------------------------------------------------------
+// bool WriteFile()
+//-----------------------------------------------------------------------------
+/**
+ * Writes the collected records, sorted by epoch
+ *
+ * Records with equal epochs keep the order they were added in.
+ *
+ * @return true on success, false if the file could not be written
+ */
+//-----------------------------------------------------------------------------
+bool GmatBinaryObType::WriteFile()
+{
+   Integer count = (Integer)writeRecords.size();
+
+   std::vector<Integer> order(count);
+   for (Integer i = 0; i < count; ++i)
+      order[i] = i;
+   bool sorted = true;
+   for (Integer i = 1; (i < count) && sorted; ++i)
+      sorted = !(writeEpochs[i] < writeEpochs[i-1]);
+   if (!sorted)
+   {
+      const RealArray &epochs = writeEpochs;
+      std::stable_sort(order.begin(), order.end(),
+            [&epochs](Integer a, Integer b) { return epochs[a] < epochs[b]; });
+   }
+
+   FileHeader hdr;
+   memset(&hdr, 0, sizeof(FileHeader));
+   memcpy(hdr.magic, MAGIC, sizeof(MAGIC));
+   hdr.version          = VERSION;
+   hdr.byteOrder        = BYTE_ORDER_MARK;
+   hdr.recordCount      = count;
+   hdr.participantCount = (Integer)writeParticipants.size();
+   hdr.sensorCount      = (Integer)writeSensors.size();
+   hdr.valueCount       = (Integer)writeValues.size();
+   hdr.stringCount      = (Integer)strings.size();
+
+   IntegerArray stringStarts(strings.size() + 1, 0);
+   for (UnsignedInt i = 0; i < strings.size(); ++i)
+      stringStarts[i+1] = stringStarts[i] + (Integer)strings[i].size();
+   hdr.stringBytes = stringStarts.back();
+
+   size_t offsets[COLUMN_COUNT];
+   size_t total = GetColumnOffsets(hdr, offsets);
+
+   std::ofstream out(filePath.c_str(), std::ios::binary | std::ios::trunc);
+   if (!out.is_open())
+      return false;
+
+   // Each column is padded to its offset before it is written
+   const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+   size_t written = 0;
+   auto writeColumn = [&](Integer column, const void *data, size_t bytes)
+   {
+      out.write(padding, offsets[column] - written);
+      if (bytes > 0)
+         out.write((const char*)data, bytes);
+      written = offsets[column] + bytes;
+   };
+
+   out.write((const char*)&hdr, sizeof(FileHeader));
+   written = sizeof(FileHeader);
+
+   RealArray epochs(count);
+   for (Integer i = 0; i < count; ++i)
+      epochs[i] = writeEpochs[order[i]];
+   writeColumn(0, epochs.data(), count * sizeof(Real));
+
+   // Records are reordered; their participant and value spans stay valid
+   std::vector<Record> records(count);
+   for (Integer i = 0; i < count; ++i)
+      records[i] = writeRecords[order[i]];
+   writeColumn(1, records.data(), count * sizeof(Record));
+
+   writeColumn(2, writeParticipants.data(),
+               writeParticipants.size() * sizeof(Integer));
+   writeColumn(3, writeSensors.data(), writeSensors.size() * sizeof(Integer));
+   writeColumn(4, writeValues.data(), writeValues.size() * sizeof(Real));
+   writeColumn(5, stringStarts.data(), stringStarts.size() * sizeof(Integer));
+
+   writeColumn(6, NULL, 0);
+   for (UnsignedInt i = 0; i < strings.size(); ++i)
+      out.write(strings[i].data(), strings[i].size());
+   written += hdr.stringBytes;
+   out.write(padding, total - written);
+
+   out.close();
+
+   #ifdef DEBUG_FILE_WRITE
+      MessageInterface::ShowMessage("GmatBinaryObType wrote %d records to "
+            "%s\n", count, filePath.c_str());
+   #endif
+
+   return !out.fail();
+}
+
+
+//-----------------------------------------------------------------------------
+// size_t GetColumnOffsets(const FileHeader &hdr, size_t *offsets)
+//-----------------------------------------------------------------------------
+/**
+ * Computes the file offsets of the columns
+ *
+ * @param hdr     The file header
+ * @param offsets The offsets of the COLUMN_COUNT columns
+ *
+ * @return The file size
+ */
+//-----------------------------------------------------------------------------
+size_t GmatBinaryObType::GetColumnOffsets(const FileHeader &hdr,
+                                          size_t *offsets)
+{
+   size_t bytes[COLUMN_COUNT] =
+   {
+      (size_t)hdr.recordCount * sizeof(Real),
+      (size_t)hdr.recordCount * sizeof(Record),
+      (size_t)hdr.participantCount * sizeof(Integer),
+      (size_t)hdr.sensorCount * sizeof(Integer),
+      (size_t)hdr.valueCount * sizeof(Real),
+      ((size_t)hdr.stringCount + 1) * sizeof(Integer),
+      (size_t)hdr.stringBytes
+   };
+
+   size_t position = sizeof(FileHeader);
+   for (Integer i = 0; i < COLUMN_COUNT; ++i)
+   {
+      position = (position + 7) & ~(size_t)7;
+      offsets[i] = position;
+      position += bytes[i];
+   }
+   return (position + 7) & ~(size_t)7;
+}
@@ -0,0 +1,219 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             GmatBinaryObType
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * ObType class used for binary GMAT observation data files
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef GmatBinaryObType_hpp
+#define GmatBinaryObType_hpp
+
+#include "estimation_defs.hpp"
+#include "ObType.hpp"
+#include <map>
+
+/**
+ * GmatBinaryObType reads and writes observation data in a columnar binary
+ * file, the binary counterpart of the GMATInternal (.gmd) text file.
+ *
+ * The file holds a header followed by fixed-layout columns, each starting on
+ * an 8 byte boundary:
+ *
+ *    TAI modified Julian epochs       Real[records], in ascending order
+ *    Records                          Record[records]
+ *    Participant and sensor IDs       Integer[participants], Integer[sensors]
+ *    Measurement values               Real[values]
+ *    String table                     Integer[strings + 1] offsets, then chars
+ *
+ * IDs, type names, units and TDRS service IDs are stored as string table
+ * indices.  The records hold the fields the text reader fills, so a record
+ * read here matches the one GmatObType reads from the same data.  Columns are
+ * in native byte order, which the header records.
+ *
+ * Files are read through a memory map where the platform provides one.  The
+ * epoch column is the time index: SetTimeWindow() finds the first and last
+ * records of a span by binary search, and only those records are read.
+ * Written records are kept in memory and saved, sorted by epoch, on Close().
+ */
+class ESTIMATION_API GmatBinaryObType : public ObType
+{
+public:
+   /// Fixed layout of the per-record fields in the file
+   struct Record
+   {
+      /// Fraction of the second of the TAI epoch
+      Real           taiFracSec;
+      Real           uplinkFreqAtRecei;
+      Real           rangeModulo;
+      Real           dopplerCountInterval;
+      Real           tdrsNode4Freq;
+      Real           dopplerCountIntervalTDRSRef;
+      Real           tdrsNode4FreqTDRSRef;
+      /// Days of the TAI modified Julian epoch, and whole seconds into the day
+      Integer        taiDays;
+      Integer        taiSec;
+      Integer        type;
+      /// String table indices of the type name and unit
+      Integer        typeName;
+      Integer        unit;
+      /// Spans of the participant, sensor and value columns
+      Integer        firstParticipant;
+      Integer        participantCount;
+      Integer        firstSensor;
+      Integer        sensorCount;
+      Integer        firstValue;
+      Integer        valueCount;
+      Integer        uplinkBand;
+      Integer        tdrsNode4Band;
+      /// String table index of the TDRS service ID
+      Integer        tdrsServiceID;
+      Integer        tdrsDataFlag;
+      Integer        tdrsSMARID;
+      Integer        tdrsNode4BandTDRSRef;
+      Integer        tdrsServiceIDTDRSRef;
+      Integer        tdrsDataFlagTDRSRef;
+      Integer        tdrsSMARIDTDRSRef;
+   };
+
+   GmatBinaryObType(const std::string withName = "");
+   virtual ~GmatBinaryObType();
+   GmatBinaryObType(const GmatBinaryObType& ot);
+   GmatBinaryObType& operator=(const GmatBinaryObType& ot);
+
+   GmatBase*         Clone() const;
+
+   virtual bool      Initialize();
+   virtual bool      Open(bool forRead = true, bool forWrite= false,
+                          bool append = false);
+   virtual bool      IsOpen();
+   virtual bool      AddMeasurement(MeasurementData *md);
+   virtual ObservationData *
+                     ReadObservation();
+
+   /// GmatBinaryObType does not use ReadRampTableData() function
+   virtual RampTableData *
+                     ReadRampTableData(){return NULL;};
+
+   virtual bool      Close();
+   virtual bool      Finalize();
+
+   virtual bool      SetTimeWindow(GmatEpoch startA1Mjd, GmatEpoch endA1Mjd);
+   virtual Integer   GetRecordCount();
+
+   bool              AddObservation(const ObservationData &od);
+
+   // Access to the records of the open file, without copies
+   Integer           GetFileRecordCount() const;
+   Integer           FindRecord(GmatEpoch taiMjd) const;
+   const Real*       GetEpochs() const;
+   const Record*     GetRecords() const;
+   const Integer*    GetParticipantIDs() const;
+   const Integer*    GetSensorIDs() const;
+   const Real*       GetValues() const;
+   const std::string&
+                     GetString(Integer index) const;
+   ObservationData*  GetObservation(Integer index);
+
+   static bool       IsBinaryFile(const std::string &fileName);
+   static Integer    ConvertFromText(const std::string &textFile,
+                                     const std::string &binaryFile);
+
+   /// Extension given to binary data files named without one
+   static const std::string   FILE_EXTENSION;
+
+private:
+   /// File header; the columns follow it
+   struct FileHeader
+   {
+      char           magic[16];
+      Integer        version;
+      Integer        byteOrder;
+      Integer        recordCount;
+      Integer        participantCount;
+      Integer        sensorCount;
+      Integer        valueCount;
+      Integer        stringCount;
+      Integer        stringBytes;
+   };
+
+   /// Full path of the file
+   std::string       filePath;
+   /// Header of the open file
+   FileHeader        fileHeader;
+   /// True while records are being collected for writing
+   bool              writing;
+   /// The most recently accessed observation data set
+   ObservationData   currentObs;
+
+   /// The mapped (or loaded) file, and its size in bytes
+   const char        *fileData;
+   size_t            fileSize;
+   /// True if fileData is a memory map rather than loadedData
+   bool              isMapped;
+   /// File contents when no memory map is available
+   std::vector<char> loadedData;
+
+   /// Columns of the open file
+   Integer           recordCount;
+   const Real        *epochColumn;
+   const Record      *recordColumn;
+   const Integer     *participantColumn;
+   const Integer     *sensorColumn;
+   const Real        *valueColumn;
+   /// String table of the open file, or of the file being written
+   StringArray       strings;
+   /// Flags for the type names verified against the supported types
+   std::vector<bool> typeChecked;
+
+   /// Records in the time window, and the next one to read
+   Integer           firstRecord;
+   Integer           endRecord;
+   Integer           nextRecord;
+   /// Time window, as TAI modified Julian epochs
+   bool              hasWindow;
+   GmatEpoch         windowStart;
+   GmatEpoch         windowEnd;
+
+   /// Columns collected for writing
+   RealArray         writeEpochs;
+   std::vector<Record>
+                     writeRecords;
+   IntegerArray      writeParticipants;
+   IntegerArray      writeSensors;
+   RealArray         writeValues;
+   std::map<std::string, Integer>
+                     stringIndex;
+
+   static const char    MAGIC[16];
+   static const Integer VERSION;
+   static const Integer BYTE_ORDER_MARK;
+
+   std::string       GetFullPath(const std::string &name) const;
+   bool              MapFile();
+   void              UnmapFile();
+   void              ApplyWindow();
+   Integer           GetStringIndex(const std::string &str);
+   bool              WriteFile();
+   static size_t     GetColumnOffsets(const FileHeader &hdr, size_t *offsets);
+};
+
+#endif /* GmatBinaryObType_hpp */
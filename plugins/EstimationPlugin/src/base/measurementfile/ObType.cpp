@@ -243,3 +243,39 @@ bool ObType::Finalize()
 {
    return false;
 }
+
+
+//-----------------------------------------------------------------------------
+// bool SetTimeWindow(GmatEpoch startA1Mjd, GmatEpoch endA1Mjd)
+//-----------------------------------------------------------------------------
+/**
+ * Limits the observations read to a span of epochs.
+ *
+ * Streams that cannot seek by epoch ignore the window and read every record;
+ * the data filters still reject the records outside of it.
+ *
+ * @param startA1Mjd The A.1 modified Julian epoch of the start of the span
+ * @param endA1Mjd   The A.1 modified Julian epoch of the end of the span
+ *
+ * @return true if the stream reads only the records in the window
+ */
+//-----------------------------------------------------------------------------
+bool ObType::SetTimeWindow(GmatEpoch startA1Mjd, GmatEpoch endA1Mjd)
+{
+   return false;
+}
+
+
+//-----------------------------------------------------------------------------
+// Integer GetRecordCount()
+//-----------------------------------------------------------------------------
+/**
+ * Returns the number of observations the open stream will return.
+ *
+ * @return The count, or -1 if the stream does not know it before reading
+ */
+//-----------------------------------------------------------------------------
+Integer ObType::GetRecordCount()
+{
+   return -1;
+}
@@ -64,6 +64,9 @@ public:
    virtual bool      Close();
    virtual bool      Finalize();
 
+   virtual bool      SetTimeWindow(GmatEpoch startA1Mjd, GmatEpoch endA1Mjd);
+   virtual Integer   GetRecordCount();
+
    void              SetStreamName(std::string name);
    std::string       GetStreamName();
 
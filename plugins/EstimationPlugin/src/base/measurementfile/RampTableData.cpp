@@ -44,7 +44,10 @@ RampTableData::RampTableData() :
    rampType          (1),
    rampFrequency     (0.0),
    rampRate          (0.0),
-   indexkey          ("")
+   indexkey          (""),
+   cumulativePhase   (0.0),
+   cumulativePhaseError
+                     (0.0)
 {
 	dataFormat = "GMAT_RampTable"; 
 }
@@ -82,7 +85,9 @@ RampTableData::RampTableData(const RampTableData& rtd):
    rampType                (rtd.rampType),
    rampFrequency           (rtd.rampFrequency),
    rampRate                (rtd.rampRate),
-   indexkey                (rtd.indexkey)
+   indexkey                (rtd.indexkey),
+   cumulativePhase         (rtd.cumulativePhase),
+   cumulativePhaseError    (rtd.cumulativePhaseError)
 {
    dataFormat = rtd.dataFormat;
 }
@@ -115,6 +120,8 @@ RampTableData& RampTableData::operator=(const RampTableData& rtd)
       rampFrequency           = rtd.rampFrequency;
       rampRate                = rtd.rampRate;
       indexkey                = rtd.indexkey;
+      cumulativePhase         = rtd.cumulativePhase;
+      cumulativePhaseError    = rtd.cumulativePhaseError;
    }
 
    return *this;
@@ -142,4 +149,6 @@ void RampTableData::Clear()
    rampFrequency           = 0.0;
    rampRate                = 0.0;
    indexkey                = ""; 
+   cumulativePhase         = 0.0;
+   cumulativePhaseError    = 0.0;
 }
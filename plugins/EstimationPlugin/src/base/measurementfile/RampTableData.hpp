@@ -73,6 +73,13 @@ public:
    /// Index key used for sorting records contains participantIDs and epoch
    std::string       indexkey;
 
+   /// Integral of the frequency offset from the first record of the same
+   /// participants, up to this epoch (unit: cycles).  The offset is taken
+   /// from the frequency of that first record.
+   Real              cumulativePhase;
+   /// Rounding error of cumulativePhase, carried separately
+   Real              cumulativePhaseError;
+
 };
 
 #endif /* RampTableData_hpp */
@@ -207,37 +207,9 @@ bool RampTableType::Open(bool forRead, bool forWrite, bool append)
             streamName.c_str(), mode);
    #endif
 
-   std::string fullPath = "";
+   std::string fullPath = GetRampFilePath(streamName);
    if (streamName != "")
    {
-      // If no path designation slash character is found, add the default path
-      if ((streamName.find('/') == std::string::npos) &&
-          (streamName.find('\\') == std::string::npos))
-      {
-         FileManager *fm = FileManager::Instance();
-         fullPath = fm->GetPathname(FileManager::MEASUREMENT_PATH);
-      }
-      fullPath += streamName;
-
-      // Add the .gmd extension if there is no extension in the file
-      size_t dotLoc = fullPath.find_last_of('.');                         // change from std::string::size_type to size_t in order to compatible with C++98 and C++11
-      size_t slashLoc = fullPath.find_last_of('/');                       // change from std::string::size_type to size_t in order to compatible with C++98 and C++11
-      if (slashLoc == std::string::npos)
-         slashLoc = fullPath.find_last_of('\\');
-
-      if ((dotLoc == std::string::npos) ||
-          (dotLoc < slashLoc))
-      {
-         fullPath += ".rmp";
-      }
-
-      // Change '\' to '/' in fullPath
-      for (Integer i = 0; i < fullPath.size(); ++i)
-      {
-         if (fullPath.at(i) == '\\')
-            fullPath.at(i) = '/';
-      }
-
       #ifdef DEBUG_FILE_ACCESS
          MessageInterface::ShowMessage("   Full path <%s>, mode = %d\n", 
                fullPath.c_str(), mode);
@@ -406,6 +378,58 @@ RampTableData* RampTableType::ReadRampTableData()
 }
 
 
+//-----------------------------------------------------------------------------
+// std::string GetRampFilePath(const std::string &streamName)
+//-----------------------------------------------------------------------------
+/**
+ * Builds the path of the file a ramp table stream reads
+ *
+ * Names without a path are looked up in the measurement path, and names
+ * without an extension get ".rmp".
+ *
+ * @param streamName The stream name set on the DataFile
+ *
+ * @return The full path of the file, or "" for an empty stream name
+ */
+//-----------------------------------------------------------------------------
+std::string RampTableType::GetRampFilePath(const std::string &streamName)
+{
+   std::string fullPath = "";
+   if (streamName != "")
+   {
+      // If no path designation slash character is found, add the default path
+      if ((streamName.find('/') == std::string::npos) &&
+          (streamName.find('\\') == std::string::npos))
+      {
+         FileManager *fm = FileManager::Instance();
+         fullPath = fm->GetPathname(FileManager::MEASUREMENT_PATH);
+      }
+      fullPath += streamName;
+
+      // Add the .gmd extension if there is no extension in the file
+      size_t dotLoc = fullPath.find_last_of('.');                         // change from std::string::size_type to size_t in order to compatible with C++98 and C++11
+      size_t slashLoc = fullPath.find_last_of('/');                       // change from std::string::size_type to size_t in order to compatible with C++98 and C++11
+      if (slashLoc == std::string::npos)
+         slashLoc = fullPath.find_last_of('\\');
+
+      if ((dotLoc == std::string::npos) ||
+          (dotLoc < slashLoc))
+      {
+         fullPath += ".rmp";
+      }
+
+      // Change '\' to '/' in fullPath
+      for (Integer i = 0; i < fullPath.size(); ++i)
+      {
+         if (fullPath.at(i) == '\\')
+            fullPath.at(i) = '/';
+      }
+   }
+
+   return fullPath;
+}
+
+
 //RampTableData* RampTableType::ReadRampTableData()
 //{
 //#ifdef DEBUG_FILE_READ
@@ -56,6 +56,9 @@ public:
    virtual bool      Close();
    virtual bool      Finalize();
 
+   static std::string
+                     GetRampFilePath(const std::string &streamName);
+
 private:
    /// File stream that provides access to the observation data
    std::fstream      theStream;
@@ -76,7 +76,8 @@
  */
 //------------------------------------------------------------------------------
 GPSPointMeasureModel::GPSPointMeasureModel(const std::string &name) :
-   MeasureModel (name)
+   MeasureModel (name),
+   stmStartIndex (-1)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("GPSPointMeasureModel default constructor  <%p>\n", this);
@@ -110,7 +111,8 @@ GPSPointMeasureModel::~GPSPointMeasureModel()
  */
 //------------------------------------------------------------------------------
 GPSPointMeasureModel::GPSPointMeasureModel(const GPSPointMeasureModel& mm) :
-   MeasureModel          (mm)
+   MeasureModel          (mm),
+   stmStartIndex         (-1)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("GPSPointMeasureModel copy constructor  from <%p> to <%p>\n", &mm, this);
@@ -138,6 +140,7 @@ GPSPointMeasureModel& GPSPointMeasureModel::operator=(const GPSPointMeasureModel
    if (this != &mm)
    {
       MeasureModel::operator=(mm);
+      stmStartIndex = -1;
    }
    return *this;
 }
@@ -625,19 +628,20 @@ bool GPSPointMeasureModel::CalculateMeasurement(bool withEvents, bool withMediaC
       {
          // this spacecraft's state presents in MJ2000Eq with origin at ForceModel.CentralBody
 
-         if (propMap[sdObj->rNode] == NULL)
+         PropSetup *rNodeProp = propMap[sdObj->rNode];
+         if (rNodeProp == NULL)
             throw MeasurementException("GPSPointMeasureModel::CalculateMeasurement(): "
                "The propagator for " + sdObj->rNode->GetName() + " is not defined");
 
          const Real* propState =
-            propMap[sdObj->rNode]->GetPropagator()->AccessOutState();
+            rNodeProp->GetPropagator()->AccessOutState();
          Rvector6 state(propState);
 
          // This step is used to convert spacecraft's state to Spacecraft.CoordinateSystem                                                                          // fix bug GMT-5364
          SpacePoint* spacecraftOrigin = ((Spacecraft*)(sdObj->rNode))->GetOrigin();                 // the origin of the receive spacecraft's cooridinate system    // fix bug GMT-5364
 
          /// @note: If this model is used with an ephem propagator, this code need updating
-         SpacePoint* forcemodelOrigin = propMap[sdObj->rNode]->GetODEModel()->GetForceOrigin();     // the origin of the coordinate system used in forcemodel       // fix bug GMT-5364
+         SpacePoint* forcemodelOrigin = rNodeProp->GetODEModel()->GetForceOrigin();                 // the origin of the coordinate system used in forcemodel       // fix bug GMT-5364
          state = state + (forcemodelOrigin->GetMJ2000PrecState(sdObj->rPrecTime) - spacecraftOrigin->GetMJ2000PrecState(sdObj->rPrecTime));                         // fix bug GMT-5364
          sdObj->rLoc = state.GetR();
          sdObj->rVel = state.GetV();
@@ -648,15 +652,21 @@ bool GPSPointMeasureModel::CalculateMeasurement(bool withEvents, bool withMediaC
          if ((sdObj->rSTMtm.GetNumRows() != stmRowCount) || (sdObj->rSTMtm.GetNumColumns() != stmRowCount))
             sdObj->rSTMtm.ChangeSize(stmRowCount, stmRowCount, true);
 
-         // Get start index of STM
-         const std::vector<ListItem*>* stateMap = propMap[sdObj->rNode]->GetPropStateManager()->GetStateMap();
-         UnsignedInt stmStartIndex = -1;
-         for (UnsignedInt index = 0; index < stateMap->size(); ++index)
+         // Get start index of STM; the index found for the previous fix is
+         // used while the state map still has the STM there
+         const std::vector<ListItem*>* stateMap = rNodeProp->GetPropStateManager()->GetStateMap();
+         if ((stmStartIndex < 0) || (stmStartIndex >= (Integer)stateMap->size()) ||
+             ((*stateMap)[stmStartIndex]->object != sdObj->rNode) ||
+             ((*stateMap)[stmStartIndex]->elementName != "STM"))
          {
-            if (((*stateMap)[index]->object == sdObj->rNode) && ((*stateMap)[index]->elementName == "STM"))
+            stmStartIndex = -1;
+            for (UnsignedInt index = 0; index < stateMap->size(); ++index)
             {
-               stmStartIndex = index;
-               break;
+               if (((*stateMap)[index]->object == sdObj->rNode) && ((*stateMap)[index]->elementName == "STM"))
+               {
+                  stmStartIndex = index;
+                  break;
+               }
             }
          }
 
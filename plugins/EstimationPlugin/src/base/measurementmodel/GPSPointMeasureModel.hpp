@@ -95,6 +95,9 @@ protected:
    //                                                MeasurementParamCount];
 
 private:
+   /// Index of the receiver STM in the propagation state map, or -1
+   Integer      stmStartIndex;
+
    bool         InitializePointModel();
 
 //   void         PointMeasurementDerivatives(std::vector<RealArray>& derivative, GmatBase *obj, Integer id, Integer forStrand = -1);
@@ -359,11 +359,12 @@ std::string MeasureModel::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer MeasureModel::GetParameterID(const std::string& str) const
 {
-   for (Integer i = GmatBaseParamCount; i < MeasurementParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               MeasurementParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return GmatBase::GetParameterID(str);
 }
 
@@ -2344,6 +2345,24 @@ void MeasureModel::UseIonosphereCache(SignalDataCache::SimpleSignalDataCache* ca
    }
 }
 
+//------------------------------------------------------------------------------
+// void UseLightTimeCache(SignalDataCache::LightTimeCache* cache)
+//------------------------------------------------------------------------------
+/**
+ * Passes the light time cache to the signal path
+ *
+ * @param cache The light time cache
+ *
+ */
+ //------------------------------------------------------------------------------
+void MeasureModel::UseLightTimeCache(SignalDataCache::LightTimeCache* cache)
+{
+   for (UnsignedInt i = 0; i < signalPaths.size(); ++i)
+   {
+      signalPaths[i]->SetLightTimeCache(cache);
+   }
+}
+
 //------------------------------------------------------------------------------
 // void SetCorrection(const std::string correctionName,
 //       const std::string correctionType)
@@ -192,6 +192,8 @@ public:
 
    /// Uses ionosphere cache
    virtual void         UseIonosphereCache(SignalDataCache::SimpleSignalDataCache* cache);
+   /// Uses light time cache
+   virtual void         UseLightTimeCache(SignalDataCache::LightTimeCache* cache);
 
    Integer measParticipantIndex;
 
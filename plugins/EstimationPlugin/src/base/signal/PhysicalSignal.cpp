@@ -37,6 +37,7 @@
 #include "RealUtilities.hpp"
 
 #include <sstream>                  // For stringstream
+#include <algorithm>                // For lower_bound and upper_bound
 
 
 //#define DEBUG_EXECUTION
@@ -1764,6 +1765,11 @@ const std::vector<RealArray>& PhysicalSignal::ModelSignalDerivative(
 /**
  * Iterates propagation to generate a light time solution
  *
+ * The iteration starts from the light time estimated from the solutions of
+ * the same leg at nearby epochs, found in the light time cache (or in this
+ * signal's own history when no cache is set), and from the geometric range
+ * at the fixed epoch otherwise.  Converged solutions are added to the cache.
+ *
  * @param atEpoch Epoch for the fixed point state
  * @param epochAtReceive Flag indicating that the receiver is held fixed
  *
@@ -1806,6 +1812,21 @@ bool PhysicalSignal::GenerateLightTimeData(const GmatTime atEpoch,
          "distance %.3lf km = %le\n", deltaR, deltaT);
 #endif
 
+      // Warm start from the solutions of this leg at nearby epochs
+      SignalDataCache::LightTimeHistory &history = (lightTimeCache != NULL ?
+         (*lightTimeCache)[SignalDataCache::LegToHash(
+            theData.transmitParticipant, theData.receiveParticipant,
+            epochAtReceive)] : lightTimeHistory);
+      Real estimatedT;
+      if (history.Estimate(atEpoch, estimatedT))
+      {
+         deltaT = estimatedT;
+#ifdef DEBUG_LIGHTTIME
+         MessageInterface::ShowMessage("   DeltaT estimated from nearby "
+            "solutions = %le\n", deltaT);
+#endif
+      }
+
       // Here we go; iterating for a light time solution
       Integer loopCount = 0;
 
@@ -1862,6 +1883,9 @@ bool PhysicalSignal::GenerateLightTimeData(const GmatTime atEpoch,
 #endif
          ++loopCount;
       }
+
+      if (GmatMathUtil::Abs(deltaE - deltaT) <= timeTolerance)
+         history.Add(atEpoch, deltaT);
    }
 
    // Temporary check on data flow
@@ -3167,28 +3191,24 @@ void PhysicalSignal::SpecifyBeginEndIndexesOfRampTable()
    else if ((*rampTable).size() == 0)
       throw MeasurementException("Error: Ramp table has no data records.\n");
 
-   beginIndex = 0;
-   for (; beginIndex < (*rampTable).size(); ++beginIndex)
+   // The table is sorted by index key, so the records of one pair of
+   // participants form a single run located by binary search
+   FindRampTableRange(searchkey, beginIndex, endIndex);
+
+   // For space to space links take whichever direction comes first
+   if (isSpaceToSpace)
    {
-      if (searchkey == (*rampTable)[beginIndex].indexkey.substr(0, searchkey.size()))
-         break;
-      if (isSpaceToSpace && searchKeySpacetoSpace == (*rampTable)[beginIndex].indexkey.substr(0, searchkey.size()))
+      UnsignedInt swappedBegin, swappedEnd;
+      FindRampTableRange(searchKeySpacetoSpace, swappedBegin, swappedEnd);
+      if ((swappedEnd > swappedBegin) &&
+          ((endIndex == beginIndex) || (swappedBegin < beginIndex)))
       {
-         searchkey = searchKeySpacetoSpace;
-         break;
+         beginIndex = swappedBegin;
+         endIndex = swappedEnd;
       }
    }
 
-   // 3. Search for the ending index
-   endIndex = beginIndex;
-   for (; endIndex < (*rampTable).size(); ++endIndex)
-   {
-
-      if (searchkey != (*rampTable)[endIndex].indexkey.substr(0, searchkey.size()))
-         break;
-   }
-
-   // 4. Verify number of data records
+   // 3. Verify number of data records
    if ((endIndex - beginIndex) == 0)
    {
       std::stringstream ss;
@@ -3199,6 +3219,71 @@ void PhysicalSignal::SpecifyBeginEndIndexesOfRampTable()
 
 
 
+//------------------------------------------------------------------------------
+// void FindRampTableRange(const std::string &prefix, UnsignedInt &first,
+//       UnsignedInt &last)
+//------------------------------------------------------------------------------
+/**
+ * Locates the ramp table records whose index key starts with a prefix
+ *
+ * @param prefix The participant part of the index key, ending with a blank
+ * @param first  Index of the first matching record
+ * @param last   Index one past the last matching record
+ */
+//------------------------------------------------------------------------------
+void PhysicalSignal::FindRampTableRange(const std::string &prefix,
+      UnsignedInt &first, UnsignedInt &last)
+{
+   // Keys with the prefix sort between the prefix itself and the prefix with
+   // its trailing blank bumped to the next character
+   std::string upper = prefix;
+   ++upper[upper.size() - 1];
+
+   std::vector<RampTableData>::const_iterator begin = rampTable->begin();
+   std::vector<RampTableData>::const_iterator end = rampTable->end();
+   std::vector<RampTableData>::const_iterator lo =
+         std::lower_bound(begin, end, prefix,
+               [](const RampTableData &rec, const std::string &key)
+               { return rec.indexkey < key; });
+   std::vector<RampTableData>::const_iterator hi =
+         std::lower_bound(lo, end, upper,
+               [](const RampTableData &rec, const std::string &key)
+               { return rec.indexkey < key; });
+
+   first = lo - begin;
+   last = hi - begin;
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt FindRampInterval(Real t,
+//       const std::vector<RampTableData> &rampTB)
+//------------------------------------------------------------------------------
+/**
+ * Finds the ramp table record in effect at an epoch
+ *
+ * @param t      Epoch (in A1Mjd)
+ * @param rampTB The ramp table beginIndex and endIndex refer to
+ *
+ * @return Index of the last record at or before t in [beginIndex, endIndex),
+ *         or beginIndex if t precedes them all
+ */
+//------------------------------------------------------------------------------
+UnsignedInt PhysicalSignal::FindRampInterval(Real t,
+      const std::vector<RampTableData> &rampTB)
+{
+   std::vector<RampTableData>::const_iterator first =
+         rampTB.begin() + beginIndex;
+   std::vector<RampTableData>::const_iterator next =
+         std::upper_bound(first, rampTB.begin() + endIndex, t,
+               [](Real epoch, const RampTableData &rec)
+               { return epoch < rec.epoch; });
+
+   if (next == first)
+      return beginIndex;
+   return (next - rampTB.begin()) - 1;
+}
+
 
 //------------------------------------------------------------------------------------------------
 // Real PhysicalSignal::GetFrequencyFromRampTable(Real t, std::vector<RampTableData>* rampTB)
@@ -3231,16 +3316,8 @@ Real PhysicalSignal::GetFrequencyFromRampTable(Real t, std::vector<RampTableData
    //   else if (t >= (*rampTB)[endIndex-1].epoch)
    //	   return (*rampTB)[endIndex-1].rampFrequency;
 
-      // search for interval which contains time t:
-   UnsignedInt interval_index = beginIndex;
-   for (UnsignedInt i = beginIndex; i < endIndex; ++i)
-   {
-      if (t >= (*rampTB)[i].epoch)
-         interval_index = i;
-      else
-         break;
-   }
-
+   // search for interval which contains time t:
+   UnsignedInt interval_index = FindRampInterval(t, *rampTB);
 
    // specify frequency at time t:
    Real t_start = (*rampTB)[interval_index].epoch;
@@ -3285,16 +3362,7 @@ Integer PhysicalSignal::GetFrequencyBandFromRampTable(Real t, std::vector<RampTa
       return (*rampTB)[endIndex - 1].uplinkBand;
 
    // search for interval which contains time t:
-   Integer upBand = 0;
-   for (UnsignedInt i = beginIndex; i < endIndex; ++i)
-   {
-      if (t >= (*rampTB)[i].epoch)
-         upBand = (*rampTB)[i].uplinkBand;
-      else
-         break;
-   }
-
-   return upBand;
+   return (*rampTB)[FindRampInterval(t, *rampTB)].uplinkBand;
 }
 
 
@@ -117,7 +117,14 @@ private:
    UnsignedInt beginIndex;
    UnsignedInt endIndex;
 
+   /// Light time solutions of this signal, used when no light time cache is set
+   SignalDataCache::LightTimeHistory lightTimeHistory;
+
    void           SpecifyBeginEndIndexesOfRampTable();
+   void           FindRampTableRange(const std::string &prefix,
+                                     UnsignedInt &first, UnsignedInt &last);
+   UnsignedInt    FindRampInterval(Real t,
+                                   const std::vector<RampTableData> &rampTB);
    bool           TestSignalBlockedBetweenTwoParticipants(Integer selection = SELECT_ALL_BODIES);
    bool           TestSignalBlockedByBody(CelestialBody* body, Rvector3 tRSSB, Rvector3 rRSSB, GmatTime tTime, GmatTime rTime);
    bool           TestHeightOfRayPath(CelestialBody* body, Rvector3 r1SSB,
@@ -89,7 +89,8 @@ SignalBase::SignalBase(const std::string &typeStr, const std::string &name) :
    solarSystem          (NULL),
    navLog               (NULL),
    logLevel             (1),
-   ionosphereCache      (NULL)
+   ionosphereCache      (NULL),
+   lightTimeCache       (NULL)
 {
 #ifdef DEBUG_API
    if (!apisbFileOpen)
@@ -192,7 +193,8 @@ SignalBase::SignalBase(const SignalBase& sb) :
    solarSystem          (sb.solarSystem),
    navLog               (sb.navLog),
    logLevel             (sb.logLevel),
-   ionosphereCache      (NULL)
+   ionosphereCache      (NULL),
+   lightTimeCache       (NULL)
 {
    // Clone the list
    if (sb.next)
@@ -2281,6 +2283,25 @@ void SignalBase::SetIonosphereCache(SignalDataCache::SimpleSignalDataCache * cac
 }
 
 
+//------------------------------------------------------------------------------
+// void SetLightTimeCache(SignalDataCache::LightTimeCache* cache)
+//------------------------------------------------------------------------------
+/**
+ * Sets the light time cache for the signal
+ *
+ * @param cache The light time cache
+ */
+ //------------------------------------------------------------------------------
+void SignalBase::SetLightTimeCache(SignalDataCache::LightTimeCache * cache)
+{
+   // Set it to all signals in the path
+   lightTimeCache = cache;
+
+   if (next)
+      next->SetLightTimeCache(cache);
+}
+
+
 //------------------------------------------------------------------------------
 // void SetStrandId(unsigned long id)
 //------------------------------------------------------------------------------
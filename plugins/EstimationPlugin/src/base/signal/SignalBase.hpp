@@ -114,6 +114,7 @@ public:
                                           bool moveAll = true);
 
    void                SetIonosphereCache(SignalDataCache::SimpleSignalDataCache* cache);
+   void                SetLightTimeCache(SignalDataCache::LightTimeCache* cache);
 
    void                SetStrandId(unsigned long id);
 
@@ -212,8 +213,10 @@ protected:
    /// The current logging level for signals
    UnsignedInt                logLevel;
 
-   /// The light time cache 
+   /// The ionosphere cache
    SignalDataCache::SimpleSignalDataCache *ionosphereCache;
+   /// The light time cache, shared with the signals modeling the same legs
+   SignalDataCache::LightTimeCache *lightTimeCache;
 
    /// The strandID
    unsigned long strandId;
@@ -20,6 +20,12 @@
 
 #include "SignalDataCache.hpp"
 #include "SignalData.hpp"
+#include "RealUtilities.hpp"
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const Real SignalDataCache::LIGHT_TIME_WINDOW = 60.0;
 
 //------------------------------------------------------------------------------
 // CacheKey::CacheKey(unsigned long strandId, Real aFreq, Real time1, Real time2)
@@ -120,3 +126,131 @@ unsigned long SignalDataCache::StrandToHash(const StringArray* participants)
    }
    return hash;
 }
+
+//------------------------------------------------------------------------------
+// LegToHash(const std::string &transmitter, const std::string &receiver,
+//           bool epochAtReceive)
+//------------------------------------------------------------------------------
+/**
+ * Helper method to generate a unique Hash for a signal leg
+ *
+ * @param transmitter    The transmitting participant of the leg
+ * @param receiver       The receiving participant of the leg
+ * @param epochAtReceive true if the receive epoch of the leg is fixed, false
+ *                       if the transmit epoch is
+ */
+ //------------------------------------------------------------------------------
+unsigned long SignalDataCache::LegToHash(const std::string &transmitter,
+   const std::string &receiver, bool epochAtReceive)
+{
+   unsigned long hash = 17;
+   hash = (hash * 31) + (std::hash<std::string>()(transmitter));
+   hash = (hash * 31) + (std::hash<std::string>()(receiver));
+   return (hash * 31) + (epochAtReceive ? 1 : 0);
+}
+
+//------------------------------------------------------------------------------
+// LightTimeHistory::Estimate(const GmatTime &fixedEpoch, Real &lightTime) const
+//------------------------------------------------------------------------------
+/**
+ * Estimates the light time of the leg at an epoch from the stored solutions
+ *
+ * A solution at the epoch is returned as is.  Otherwise the light time is
+ * interpolated between the solutions on either side of the epoch, or
+ * extrapolated from the two nearest ones on one side, or taken from the
+ * single nearest solution within LIGHT_TIME_WINDOW.  The estimate is meant
+ * as the starting point of a light time iteration.
+ *
+ * @param fixedEpoch The epoch of the fixed end of the leg
+ * @param lightTime  The estimated light time, signed as a transmit epoch
+ *                   minus a receive epoch would be (unit: second)
+ *
+ * @return true if an estimate was made, false if no solution is close enough
+ */
+ //------------------------------------------------------------------------------
+bool SignalDataCache::LightTimeHistory::Estimate(const GmatTime &fixedEpoch,
+   Real &lightTime) const
+{
+   std::map<GmatTime, Real>::const_iterator after =
+         solutions.lower_bound(fixedEpoch);
+   std::map<GmatTime, Real>::const_iterator before = after;
+   bool hasBefore = false, hasAfter = false;
+   Real dtBefore = 0.0, dtAfter = 0.0;
+
+   if (after != solutions.end())
+   {
+      dtAfter = (after->first - fixedEpoch).GetTimeInSec();
+      if (dtAfter < 1.0e-9)
+      {
+         lightTime = after->second;
+         return true;
+      }
+      hasAfter = (dtAfter <= LIGHT_TIME_WINDOW);
+   }
+   if (before != solutions.begin())
+   {
+      --before;
+      dtBefore = (fixedEpoch - before->first).GetTimeInSec();
+      hasBefore = (dtBefore <= LIGHT_TIME_WINDOW);
+   }
+
+   if (hasBefore && hasAfter)
+   {
+      lightTime = before->second + (after->second - before->second) *
+            dtBefore / (dtBefore + dtAfter);
+      return true;
+   }
+
+   // Extrapolate from the two solutions nearest the epoch on one side
+   std::map<GmatTime, Real>::const_iterator nearest, second;
+   if (hasBefore)
+   {
+      nearest = second = before;
+      if (second != solutions.begin())
+         --second;
+   }
+   else if (hasAfter)
+   {
+      nearest = second = after;
+      ++second;
+      if (second == solutions.end())
+         second = nearest;
+   }
+   else
+      return false;
+
+   lightTime = nearest->second;
+   if (second != nearest)
+   {
+      Real span = (nearest->first - second->first).GetTimeInSec();
+      if ((span != 0.0) && (GmatMathUtil::Abs(span) <= LIGHT_TIME_WINDOW))
+         lightTime += (nearest->second - second->second) *
+               (fixedEpoch - nearest->first).GetTimeInSec() / span;
+   }
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// LightTimeHistory::Add(const GmatTime &fixedEpoch, Real lightTime)
+//------------------------------------------------------------------------------
+/**
+ * Stores a light time solution, and drops the ones that are more than
+ * LIGHT_TIME_WINDOW away from it
+ *
+ * @param fixedEpoch The epoch of the fixed end of the leg
+ * @param lightTime  The light time solution (unit: second)
+ */
+ //------------------------------------------------------------------------------
+void SignalDataCache::LightTimeHistory::Add(const GmatTime &fixedEpoch,
+   Real lightTime)
+{
+   solutions[fixedEpoch] = lightTime;
+
+   GmatTime windowStart = fixedEpoch;
+   windowStart.SubtractSeconds(LIGHT_TIME_WINDOW);
+   GmatTime windowEnd = fixedEpoch;
+   windowEnd.AddSeconds(LIGHT_TIME_WINDOW);
+
+   solutions.erase(solutions.begin(), solutions.lower_bound(windowStart));
+   solutions.erase(solutions.upper_bound(windowEnd), solutions.end());
+}
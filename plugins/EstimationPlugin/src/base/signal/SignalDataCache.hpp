@@ -28,6 +28,7 @@
 #include "GmatTime.hpp"
 
 #include <unordered_map>
+#include <map>
 
 // Forward references
 class SignalData;
@@ -83,6 +84,27 @@ public:
 
    typedef std::unordered_map<SignalDataCache::CacheKey, SignalDataCache::CacheValue, SignalDataCache::CacheKeyHasher>::iterator SimpleSignalDataCacheIter;
 
+   /// Helper signal leg hasher, for the light time cache
+   static unsigned long LegToHash(const std::string &transmitter,
+                                  const std::string &receiver,
+                                  bool epochAtReceive);
+
+   /// Light time solutions of a signal leg, indexed by the epoch of its
+   /// fixed end.  Only solutions within LIGHT_TIME_WINDOW of the latest one
+   /// are kept.
+   struct ESTIMATION_API LightTimeHistory {
+      std::map<GmatTime, Real> solutions;
+
+      bool Estimate(const GmatTime &fixedEpoch, Real &lightTime) const;
+      void Add(const GmatTime &fixedEpoch, Real lightTime);
+   };
+
+   /// Light time solutions shared by the signals modeling the same legs
+   typedef std::unordered_map<unsigned long, LightTimeHistory> LightTimeCache;
+
+   /// Span of the light time solutions kept for each leg (unit: second)
+   static const Real LIGHT_TIME_WINDOW;
+
 };
 
 #endif /* SignalDataCache_hpp */
\ No newline at end of file
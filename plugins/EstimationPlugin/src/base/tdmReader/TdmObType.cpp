@@ -149,9 +149,9 @@ bool TdmObType::Initialize()
 // bool Open()
 //------------------------------------------------------------------------------
 /**
- * Opens XML file and validates it.
+ * Opens the TDM file.
  *
- * This method opens the TDM XML file and validates against the Schema.
+ * This method opens the TDM file, in XML or KVN form, for reading.
  * 
  * @param forRead True to open for reading, false otherwise
  * @param forWrite True to open for writing, false otherwise
@@ -293,24 +293,24 @@ bool TdmObType::Finalize()
 /**
  * Retrieves an observation record
  *
- * This method reads an observation data set from a TDM XML file and
+ * This method reads an observation data set from a TDM file and
  * returns the data to the caller.
  *
  * @param none.
  *
- * @return The observation data from the XML content in memory.  
+ * @return The observation data read from the file.  
  * If there is no more data, a NULL pointer is returned.
  */
 //------------------------------------------------------------------------------
 //ObsData *TdmObType::ReadObservation()
 ObservationData *TdmObType::ReadObservation()
 {
-   // Is it the first time XML open?
+   // Is it the first time the file is read?
    if (isFirstRead)
    {
       isFirstRead = false;
 
-      // open the XML file to validate and set the Body element.
+      // open the TDM file and read its header.
       Open();
       theReadWriter->SetBody();
       // Read in the Metadata from the first Segment in Body element
@@ -49,7 +49,7 @@ public:
    virtual RampTableData *ReadRampTableData();
 
 protected:
-   /// used for low level call to Xerces libraries
+   /// used for low level access to the TDM file
    TdmReadWriter *theReadWriter;
    /// An ObservationData framework pointer,  
    /// used to hold the framework information needed for the ObservationData, 
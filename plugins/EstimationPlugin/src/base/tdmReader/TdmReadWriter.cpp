@@ -21,9 +21,17 @@
 
 #include "TdmReadWriter.hpp"
 #include "MessageInterface.hpp"
-#include "xercesc/framework/LocalFileInputSource.hpp"
 #include "MeasurementException.hpp"
-#include "DateUtil.hpp"
+#include "EventSearch.hpp"
+#include <sstream>
+#include <thread>
+
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+
+const std::streamoff TdmReadWriter::PARALLEL_BATCH_BYTES = 64 * 1024 * 1024;
 
 
 //------------------------------------------------------------------------------
@@ -39,15 +47,12 @@
 //------------------------------------------------------------------------------
 TdmReadWriter::TdmReadWriter()
 {
-   theErrorHandler = new TdmErrorHandler();
-   theDOMParser = NULL;
-  
-   theBody = NULL;
-   theSegment = NULL;
-   theData = NULL;
-   theObservation = NULL;
-   xercesInitialized = false;
+   threadCount = 0;
+   nextSegment = 0;
+   currentSegment = NULL;
+   currentIndex = 0;
    observationIndex = 0;
+   hasPending = false;
    
    // Fill in the map
    mapTransmitBand["S"] = 1.0;
@@ -63,15 +68,19 @@ TdmReadWriter::TdmReadWriter()
 //------------------------------------------------------------------------------
 /**
  * Copy Constructor
+ *
+ * The settings are copied; the copy has no file open.
  */
 //------------------------------------------------------------------------------
 TdmReadWriter::TdmReadWriter(const TdmReadWriter &trw)
 {
-   theErrorHandler = NULL;
-   theDOMParser = NULL;
-   mapTransmitBand.insert(trw.mapTransmitBand.begin(), trw.mapTransmitBand.end());
-
-   *this = trw;
+   threadCount = trw.threadCount;
+   nextSegment = 0;
+   currentSegment = NULL;
+   currentIndex = 0;
+   observationIndex = 0;
+   hasPending = false;
+   mapTransmitBand = trw.mapTransmitBand;
 }
 
 
@@ -80,28 +89,17 @@ TdmReadWriter::TdmReadWriter(const TdmReadWriter &trw)
 //------------------------------------------------------------------------------
 /**
  * Assignment operator
+ *
+ * The settings are copied, and any file open here is closed.
  */
 //------------------------------------------------------------------------------
 TdmReadWriter& TdmReadWriter::operator=(const TdmReadWriter &trw)
 {
    if (this != &trw)
    {
-      TdmErrorHandler *newErrorHandler = trw.theErrorHandler; 
-      if (theErrorHandler)
-      {
-         delete theErrorHandler;
-         theErrorHandler = NULL;
-      }
-
-      theErrorHandler = newErrorHandler;
-      theDOMParser = trw.theDOMParser;;
-      theBody = trw.theBody;
-      theSegment = trw.theSegment;
-      theData = trw.theData;
-      theObservation = trw.theObservation;
-      xercesInitialized = trw.xercesInitialized;
-      observationIndex = trw.observationIndex;
-      mapTransmitBand.insert(trw.mapTransmitBand.begin(), trw.mapTransmitBand.end());
+      Finalize();
+      threadCount = trw.threadCount;
+      mapTransmitBand = trw.mapTransmitBand;
    }
    
    return *this;
@@ -117,8 +115,7 @@ TdmReadWriter& TdmReadWriter::operator=(const TdmReadWriter &trw)
 //------------------------------------------------------------------------------
 TdmReadWriter::~TdmReadWriter()
 {
-   if(xercesInitialized)
-      Finalize();
+   Finalize();
 }
 
 
@@ -128,8 +125,8 @@ TdmReadWriter::~TdmReadWriter()
 /**
  * Initializes TdmReadWriter.
  *
- * This method will initialize the DOM Parser, and configure it for error handling
- * and Schema validation.
+ * The files are read without an external parser, so there is nothing to set
+ * up.
  *
  * @param none
  *
@@ -138,30 +135,7 @@ TdmReadWriter::~TdmReadWriter()
 //------------------------------------------------------------------------------
 bool TdmReadWriter::Initialize()
 {
-   if (!xercesInitialized)
-   {
-      try
-      {
-         XMLPlatformUtils::Initialize();
-         theDOMParser = new XercesDOMParser();
-
-         theDOMParser->setErrorHandler(theErrorHandler);
-	      theDOMParser->setValidationScheme(XercesDOMParser::Val_Auto);
-	      theDOMParser->setDoNamespaces(true);
-	      theDOMParser->setDoSchema(true);
-	      theDOMParser->setValidationConstraintFatal(true);
-
-         xercesInitialized = true;
-      }
-      catch(const XMLException &xe)
-      {
-         std::string errMsg ("Xerces failed to initialize: ");
-         errMsg.push_back(*XMLString::transcode(xe.getMessage()));
-         throw MeasurementException(errMsg);
-      }
-   }
-
-   return xercesInitialized;
+   return true;
 }
 
 
@@ -177,147 +151,120 @@ bool TdmReadWriter::Initialize()
  *
  * @param none
  *
- * @return ObsData pointer
+ * @return ObservationData pointer, or NULL when there are no more segments
  */
 //------------------------------------------------------------------------------
-//ObsData *TdmReadWriter::ProcessMetadata()
 ObservationData *TdmReadWriter::ProcessMetadata()
 {
-   if (theSegment != NULL)
+   TdmStreamReader::Metadata metadata;
+   if (!StartSegment(metadata))
+      return NULL;
+
+   // Clear observation Data if it has been filled in with data.
+   theTemplate.Clear();
+
+   for (UnsignedInt i = 0; i < metadata.size(); i++)
    {
-      // Clear observation Data if it has been filled in with data.
-      theTemplate.Clear();
-
-      DOMElement *pMetaData = theSegment->getFirstElementChild();
-      DOMNodeList *pChilds = pMetaData->getChildNodes();
-					
-		for (UnsignedInt i = 0; i < pChilds->getLength(); i++)
-		{
-			DOMElement *pChild = (DOMElement *)pChilds->item(i);
-			if (pChild->getNodeType() == DOMNode::ELEMENT_NODE)
+      const std::string &nodeName = metadata[i].first;
+      const std::string &strT = metadata[i].second;
+
+      //Fill in the observation data theTemplate for each
+      // attributes.
+      switch(HashIt(nodeName))
+      {
+         case TIME_SYSTEM:
+         {
+            if ( strT == "UTC")
+               theTemplate.epochSystem = TimeSystemConverter::UTCMJD;
+            break;
+         }
+         case PARTICIPANT_1:
+         case PARTICIPANT_2:
+         case PARTICIPANT_3:
+         case PARTICIPANT_4:
+         case PARTICIPANT_5:
          {
-            //Fill in the observation data theTemplate for each
-            // attributes.
-            switch(HashIt(pChild->getNodeName()))
+            theTemplate.participantIDs.push_back(strT);
+            break;
+         }
+         case MODE:
+            break;
+         case PATH:
+         {
+            StringArray IDs;
+            std::istringstream path(strT);
+            std::string tok;
+
+            while (std::getline(path, tok, ','))
             {
-               case TIME_SYSTEM:
-               {
-                  std::string strT(XMLString::transcode(pChild->getTextContent()));
-                  if ( strT == "UTC")
-                     theTemplate.epochSystem = TimeSystemConverter::UTCMJD;
-                  break;
-               }
-               case PARTICIPANT_1:
-               case PARTICIPANT_2:
-               case PARTICIPANT_3:
-               case PARTICIPANT_4:
-               case PARTICIPANT_5:
-               {
-                  theTemplate.participantIDs.push_back(XMLString::transcode(pChild->getTextContent()));
-                  break;
-               }
-               case MODE:
-                  break;
-               case PATH:
-               {
-                  StringArray IDs;
-                  char *pPath = XMLString::transcode(pChild->getTextContent());
-                  char *pTok;
-                  pTok = strtok(pPath, ",");
-                  
-                  while (pTok != NULL)
-                  {
-                     IDs.push_back(theTemplate.participantIDs.at(atoi(pTok)-1));
-                     pTok = strtok(NULL, ","); 
-                  }
-
-                  theTemplate.strands.push_back(IDs);
-                  XMLString::release(&pPath);
-                  break;
-               }
-               case PATH_1:
-                  break;
-               case PATH_2:
-                  break;
-               case TRANSMIT_BAND:
-               {
-                  std::string strT(XMLString::transcode(pChild->getTextContent()));
-
-                  std::map<std::string, Real>::iterator it;
-                  it = mapTransmitBand.find(strT);
-                  
-                  if (it != mapTransmitBand.end())
-                     theTemplate.value.push_back(it->second);
-                  else
-                     theTemplate.value.push_back(0.0);
-
-                  theTemplate.dataMap.push_back(XMLString::transcode(pChild->getNodeName()));
-
-                  break;
-               }
-               case RECEIVE_BAND:
-                  break;
-               case TIMETAG_REF:
-               {
-                  std::string strT(XMLString::transcode(pChild->getTextContent()));
-                  if (strT.compare("RECEIVE") == 0 || strT.compare("receive") == 0)
-                     theTemplate.epochAtEnd = true;
-                  else if (strT.compare("TRANSMIT") || strT.compare("transmit") == 0)
-                     theTemplate.epochAtEnd = false;
-                  
-                  break;
-               }
-//               case INTEGRATION_INTERVAL:
-//                  {
-//                     theTemplate.data.push_back(atof(XMLString::transcode(pChild->getTextContent())));
-//                     theTemplate.dataMap.push_back(XMLString::transcode(pChild->getNodeName()));
-//                  }
-//                  break;
-               case INTEGRATION_REF:
-                  {
-                     std::string strT(XMLString::transcode(pChild->getTextContent()));
-                     if (strT.compare("END") == 0 || strT.compare("end") == 0)
-                        theTemplate.epochAtIntegrationEnd = true;
-                     else if (strT.compare("START") || strT.compare("start") == 0)
-                        theTemplate.epochAtIntegrationEnd = false;
-                  }
-                  break;
-               case RANGE_MODE:
-                  break;
-               case RANGE_MODULUS:
-               case FREQ_OFFSET:
-               case INTEGRATION_INTERVAL:
-               {
-                  theTemplate.value.push_back(atof(XMLString::transcode(pChild->getTextContent())));
-                  theTemplate.dataMap.push_back(XMLString::transcode(pChild->getNodeName()));
-                  break;
-               }
-               case RANGE_UNITS:
-               {
-                  theTemplate.unit = std::string(XMLString::transcode(pChild->getTextContent()));
-                  break;
-               }
-               default:
-                  break;
+               if (tok != "")
+                  IDs.push_back(theTemplate.participantIDs.at(atoi(tok.c_str())-1));
             }
-			}
-      }
 
-      theData = theSegment->getLastElementChild();
-      DOMNodeList *pObsChilds = theData->getChildNodes();
-      int i = 0;
-      while ( ((DOMElement *)pObsChilds->item(i))->getNodeType() != DOMNode::ELEMENT_NODE)
-      {
-        i++;
-      }
-      
-      //first observation data
-      theObservation = (DOMElement *)pObsChilds->item(i);
+            theTemplate.strands.push_back(IDs);
+            break;
+         }
+         case PATH_1:
+            break;
+         case PATH_2:
+            break;
+         case TRANSMIT_BAND:
+         {
+            std::map<std::string, Real>::iterator it;
+            it = mapTransmitBand.find(strT);
+
+            if (it != mapTransmitBand.end())
+               theTemplate.value.push_back(it->second);
+            else
+               theTemplate.value.push_back(0.0);
+
+            theTemplate.dataMap.push_back(nodeName);
 
-      return &theTemplate;
+            break;
+         }
+         case RECEIVE_BAND:
+            break;
+         case TIMETAG_REF:
+         {
+            if (strT.compare("RECEIVE") == 0 || strT.compare("receive") == 0)
+               theTemplate.epochAtEnd = true;
+            else if (strT.compare("TRANSMIT") || strT.compare("transmit") == 0)
+               theTemplate.epochAtEnd = false;
+
+            break;
+         }
+         case INTEGRATION_REF:
+            {
+               if (strT.compare("END") == 0 || strT.compare("end") == 0)
+                  theTemplate.epochAtIntegrationEnd = true;
+               else if (strT.compare("START") || strT.compare("start") == 0)
+                  theTemplate.epochAtIntegrationEnd = false;
+            }
+            break;
+         case RANGE_MODE:
+            break;
+         case RANGE_MODULUS:
+         case FREQ_OFFSET:
+         case INTEGRATION_INTERVAL:
+         {
+            theTemplate.value.push_back(atof(strT.c_str()));
+            theTemplate.dataMap.push_back(nodeName);
+            break;
+         }
+         case RANGE_UNITS:
+         {
+            theTemplate.unit = strT;
+            break;
+         }
+         default:
+            break;
+      }
    }
-   
-   return NULL;
+
+   //first observation data
+   hasPending = NextObservation(pending);
+
+   return &theTemplate;
 }
 
 
@@ -325,62 +272,42 @@ ObservationData *TdmReadWriter::ProcessMetadata()
 // bool LoadRecord()
 //------------------------------------------------------------------------------
 /**
- * Loads Data section of XML file.
+ * Loads Data section of the TDM file.
  *
  * This method retrieves the observation data and fills in the relevant fields in
  * the ObservationData record that is passed to it, by pushing the observation data
  * to the data member and the associated field tags to the dataMap in the input 
- * ObservationData record.
+ * ObservationData record.  Consecutive observations sharing an epoch make up
+ * one record.
  *
- * @param ObsData *
+ * @param ObservationData *
  *
- * @return ObsData
+ * @return The template of the observations that follow, or NULL at the end of
+ *         the file
  */
 //------------------------------------------------------------------------------
-//ObsData *TdmReadWriter::LoadRecord(ObsData *newData)
 ObservationData *TdmReadWriter::LoadRecord(ObservationData *newData)
 {
-   std::string strPrevEpoch;
-   std::string strCurrEpoch;
-   std::string strObs;
-   std::string strNodeName;
-
-   strPrevEpoch = std::string(XMLString::transcode(theObservation->getFirstElementChild()->getTextContent()));
-  
-   for (UnsignedInt i = observationIndex; i < theData->getChildNodes()->getLength(); i++)
+   if (hasPending)
    {
-      theObservation = (DOMElement *) theData->getChildNodes()->item(i);
-      if (theObservation->getNodeType() == DOMNode::ELEMENT_NODE)
-		{
-			strCurrEpoch = std::string(XMLString::transcode(theObservation->getFirstElementChild()->getTextContent()));
-         strObs = std::string(XMLString::transcode(theObservation->getLastElementChild()->getTextContent())); 
-         strNodeName = std::string(XMLString::transcode(theObservation->getLastElementChild()->getNodeName()));
-
-         if (theTemplate.typeName == "")
-            theTemplate.typeName = newData->typeName = strNodeName;
-         
-         if (strPrevEpoch != strCurrEpoch)
-         {
-            //set the index for next call
-            observationIndex = i;
+      if (theTemplate.typeName == "")
+         theTemplate.typeName = newData->typeName = pending.keyword;
 
-            return &theTemplate;
-         }
-         else
-         {
-            // push data into newData     
-            newData->epoch = ParseEpoch(strPrevEpoch);  
-            newData->value.push_back(atof(strObs.c_str()));
-            newData->dataMap.push_back(strNodeName);
-         }
-           
-         strPrevEpoch = strCurrEpoch;
+      std::string strPrevEpoch = pending.epoch;
+      while (hasPending && (pending.epoch == strPrevEpoch))
+      {
+         // push data into newData
+         newData->epoch = pending.epochMjd;
+         newData->value.push_back(pending.value);
+         newData->dataMap.push_back(pending.keyword);
+
+         hasPending = NextObservation(pending);
       }
+
+      if (hasPending)
+         return &theTemplate;
    }
-   
-   theSegment = theSegment->getNextElementSibling();
-   // reset the index back to zero
-   observationIndex = 0;
+
    return (ProcessMetadata());
 }
 
@@ -389,48 +316,27 @@ ObservationData *TdmReadWriter::LoadRecord(ObservationData *newData)
 // bool Validate()
 //------------------------------------------------------------------------------
 /**
- * Validates the XML file.
+ * Opens the TDM file.
  *
- * This method called when a new TDM file is loaded for the first data read, it uses 
- * Xerces to validate the data file against the TDM schema.
+ * The file structure is checked as the file is read, and a malformed file
+ * throws then.  The file is not validated against the CCSDS TDM schema, as
+ * it was when the file was parsed with Xerces, so that is reported here.
  *
- * @param TDM XML filename
+ * @param TDM filename
  *
  * @return bool
  */
 //------------------------------------------------------------------------------
 bool TdmReadWriter::Validate(const std::string &tdmFileName)
 {
-   LocalFileInputSource *xmlFile;
-
-   // Load the TDM XML file
-   try
-   {
-      xmlFile = new LocalFileInputSource(XMLString::transcode(tdmFileName.c_str()));
-   }
-   catch(const XMLException &xe)
-   {
-      std::string errMsg ("Xerces failed to load the file: ");
-      errMsg.push_back(*XMLString::transcode(xe.getMessage()));
-      throw MeasurementException(errMsg);
-   }
+   Finalize();
 
-   // Parse the TDM XML 
-   if(theDOMParser != NULL)
-   {
-      theDOMParser->parse(*xmlFile);
+   this->tdmFileName = tdmFileName;
+   theReader.Open(tdmFileName);
 
-      // Check to see if the Schema Validation passed
-      if (theDOMParser->getErrorCount() == 0)
-      {
-         MessageInterface::ShowMessage("XML file is validated against the Schema file successfully.\n");
-      }
-	   else
-      {
-		   std::string errMsg ("Xerces failed validation: XML file does not conform to Schema: ");
-         throw MeasurementException(errMsg);
-      }  
-   }
+   MessageInterface::ShowMessage("The TDM file %s is checked for the TDM "
+         "structure as it is read; it is not validated against the schema.\n",
+         tdmFileName.c_str());
 
    return true;
 }
@@ -442,8 +348,7 @@ bool TdmReadWriter::Validate(const std::string &tdmFileName)
 /**
  * Finalizes the TdmReadWriter object.
  *
- * This method cleans up the TDM file and Xerces interface if needed, and
- * any other artifacts still in memory.
+ * This method closes the TDM file and releases any segments parsed ahead.
  *
  * @param none
  *
@@ -452,21 +357,14 @@ bool TdmReadWriter::Validate(const std::string &tdmFileName)
 //------------------------------------------------------------------------------
 bool TdmReadWriter::Finalize()
 {
-   if (theDOMParser)
-   {
-      delete theDOMParser;
-      theDOMParser = NULL;
-   }
-   if (theErrorHandler)
-   {
-      delete theErrorHandler;
-      theErrorHandler = NULL;
-   }
-   xercesInitialized = false;
-
-   XMLPlatformUtils::Terminate();
+   theReader.Close();
+   segmentOffsets.clear();
+   parsedSegments.clear();
+   currentSegment = NULL;
+   nextSegment = 0;
+   hasPending = false;
 
-   return xercesInitialized;
+   return true;
 }
 
 
@@ -474,11 +372,10 @@ bool TdmReadWriter::Finalize()
 // bool SetBody()
 //------------------------------------------------------------------------------
 /**
- * Reads Header section of XML file (for checking the version number),
- * set the Body element and first Segment node.
+ * Reads Header section of the TDM file (for checking the version number),
+ * and prepares to read the first Segment.
  *
- * This method reads the header in XML file, and set the Body element.
- * 
+ * When several threads are used, the segment starts are located here.
  *
  * @param none
  *
@@ -487,48 +384,61 @@ bool TdmReadWriter::Finalize()
 //------------------------------------------------------------------------------
 bool TdmReadWriter::SetBody()
 {
-   DOMDocument *pDoc = theDOMParser->getDocument();
-	DOMElement *pTdm = pDoc->getDocumentElement();
-
-	if (pTdm->hasAttributes())
-	{
-		DOMAttr *pAttrId = pTdm->getAttributeNode(XMLString::transcode("id"));
-		if (!XMLString::equals(XMLString::transcode("CCSDS_TDM_VERS"),pAttrId->getValue()))
-		{
-			std::string errMsg = " CCSDS_TDM_VERS id is not correct";
+   std::string id, version;
+   theReader.ReadHeader(id, version);
+
+   if (id != "" || version != "")
+   {
+      if (id != "CCSDS_TDM_VERS")
+      {
+         std::string errMsg = " CCSDS_TDM_VERS id is not correct";
          throw MeasurementException(errMsg);
-		}
+      }
 
-		DOMAttr *pAttrVer = pTdm->getAttributeNode(XMLString::transcode("version"));
-		if (!XMLString::equals(XMLString::transcode("1.0"),pAttrVer->getValue()))
-		{
-			std::string errMsg = "The TDM VERSION is not correct.\n";
-			throw MeasurementException(errMsg);
+      if (version != "1.0")
+      {
+         std::string errMsg = "The TDM VERSION is not correct.\n";
+         throw MeasurementException(errMsg);
       }
-	}
-
-   //header
-   /********** No NEED to parse these.*********** /
-	DOMElement *pHeader = pTdm->getFirstElementChild();
-	DOMElement *pComments = pHeader->getFirstElementChild();
-
-	while (pComments != NULL && XMLString::equals(XMLString::transcode("COMMENT"), pComments->getTagName()))  //comments
-	{
-		pComments = pComments->getNextElementSibling();	
-	}
-	
-	//whether or not there are comments or not, we get here.
-	DOMElement * pDate = (DOMElement *)pHeader->getElementsByTagName(XMLString::transcode("CREATION_DATE"))->item(0);
-	DOMElement * pOrig = (DOMElement *)pHeader->getElementsByTagName(XMLString::transcode("ORIGINATOR"))->item(0);
-   **********************************************/
-
-   theBody = pTdm->getLastElementChild();
-   theSegment = theBody->getFirstElementChild();
+   }
+
+   segmentOffsets.clear();
+   parsedSegments.clear();
+   currentSegment = NULL;
+   nextSegment = 0;
+   hasPending = false;
+
+   if (GetThreadCount() > 1)
+   {
+      theReader.FindSegments(segmentOffsets);
+      if (segmentOffsets.size() < 2)
+         segmentOffsets.clear();
+   }
 
    return true;
 }
 
 
+//------------------------------------------------------------------------------
+// void SetThreadCount(Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of threads used to parse the segments of a file.
+ *
+ * @param count The thread count; 1 reads the file in sequence, and 0 uses
+ *              one thread per hardware thread
+ */
+//------------------------------------------------------------------------------
+void TdmReadWriter::SetThreadCount(Integer count)
+{
+   threadCount = count;
+}
+
+
+//------------------------------------------------------------------------------
+// Private Methods
+//------------------------------------------------------------------------------
+
 //------------------------------------------------------------------------------
 // MetaData HashIt()
 //------------------------------------------------------------------------------
@@ -539,15 +449,13 @@ bool TdmReadWriter::SetBody()
  * This method hashes a string to a number.
  * 
  *
- * @param char * pointing to node name
+ * @param node name
  *
  * @return an enumeration value
  */
 //------------------------------------------------------------------------------
-TdmReadWriter::MetaData TdmReadWriter::HashIt(const XMLCh *xmlNodeName)
+TdmReadWriter::MetaData TdmReadWriter::HashIt(const std::string &strN)
 {
-   std::string strN(XMLString::transcode(xmlNodeName));
-
    if (strN == "TIME_SYSTEM")
       return TIME_SYSTEM;
    if (strN == "PARTICIPANT_1")
@@ -592,94 +500,138 @@ TdmReadWriter::MetaData TdmReadWriter::HashIt(const XMLCh *xmlNodeName)
 
 
 //------------------------------------------------------------------------------
-// GmatEpoch ParseEpoch()
+// bool StartSegment(TdmStreamReader::Metadata &metadata)
 //------------------------------------------------------------------------------
 /**
- * Parse and Convert Epoch datetime string.
- * 
- *
- * This method parses and converts the Epoch datetime string
- * passed in to the GmatEpoch that will be used in ObsData structure.
- * 
- * Two datetime formats :
- * 1.) YYYY-MM-DDThh:mm:ss[d->d][Z]
- * 2.) YYYY-DDDThh:mm:ss[d->d][Z]
- * [d->d] is an optional fraction seconds; 'Z" is an optional time code terminator.
- * refer to CCSDS503.0-B-1_TDM.pdf document page 52. 
- * 
+ * Moves to the next segment and retrieves its metadata.
  *
- * @param const std::string
+ * @param metadata The metadata of the segment
  *
- * @return GmatEpoch
+ * @return true if there is a segment, false at the end of the file
  */
 //------------------------------------------------------------------------------
-GmatEpoch TdmReadWriter::ParseEpoch(const std::string strEpoch)
-{  
-   Integer year = -1, doy = -1, month = -1, day = -1, hour = -1, minute = -1 ;
-   Real sec = -1;
-   GmatEpoch mjd;
-
-   // c_str() returns a const char *
-   char *epoch = (char *)strEpoch.c_str();
-   char *pch, *date, *time;
-   Byte i = 0;
-
-   // Start Parsing....
-   // break the string into date and time parts :
-   // using delimiter "T". 
-   pch = strtok(epoch, "T");
-   while (pch != NULL)
+bool TdmReadWriter::StartSegment(TdmStreamReader::Metadata &metadata)
+{
+   if (currentSegment != NULL)
    {
-      if (i == 0)
-         date = pch;
-      else
-         time = pch;
-      i++;
-      pch = strtok(NULL, "T");
+      parsedSegments.erase(currentIndex);
+      currentSegment = NULL;
    }
 
-   // parse the date part
-   i = 0;
-   pch = strtok(date, "-");
-   while (pch != NULL)
-   { 
-      if (i == 0)
-         year = atoi(pch);
-      else if (i == 1)
-         doy = atoi(pch);
-      else if (i == 2)
-      {
-         month = doy;
-         day = atoi(pch);
-         // reset it back to -1 to distinguish between two formats
-         doy = -1; 
-      }
-      i++;
-      pch = strtok(NULL, "-");
+   if (segmentOffsets.empty())
+      return theReader.NextSegment(metadata);
+
+   if (nextSegment >= segmentOffsets.size())
+      return false;
+
+   UnsignedInt index = nextSegment++;
+   if (parsedSegments.find(index) == parsedSegments.end())
+      ParseAhead(index);
+
+   std::map<UnsignedInt, ParsedSegment>::iterator it =
+         parsedSegments.find(index);
+   if (it == parsedSegments.end())
+   {
+      // Too large to parse ahead
+      theReader.Seek(segmentOffsets[index]);
+      return theReader.NextSegment(metadata);
    }
 
-   // parse the time part
-   i = 0;
-   pch = strtok(time, ":");
-   while (pch != NULL)
+   currentSegment = &it->second;
+   currentIndex = index;
+   observationIndex = 0;
+   metadata.swap(currentSegment->metadata);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool NextObservation(TdmStreamReader::Observation &obs)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the next observation of the current segment.
+ *
+ * @param obs The observation
+ *
+ * @return true if there is one, false at the end of the segment
+ */
+//------------------------------------------------------------------------------
+bool TdmReadWriter::NextObservation(TdmStreamReader::Observation &obs)
+{
+   if (currentSegment == NULL)
+      return theReader.NextObservation(obs);
+
+   if (observationIndex >= currentSegment->observations.size())
+      return false;
+
+   std::swap(obs, currentSegment->observations[observationIndex++]);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void ParseAhead(UnsignedInt first)
+//------------------------------------------------------------------------------
+/**
+ * Parses a batch of segments on several threads.
+ *
+ * The batch starts at a segment and takes the ones that follow, one per
+ * thread, while they span no more than PARALLEL_BATCH_BYTES.  Nothing is
+ * parsed if the first segment alone is larger than that.
+ *
+ * @param first Index of the first segment of the batch
+ */
+//------------------------------------------------------------------------------
+void TdmReadWriter::ParseAhead(UnsignedInt first)
+{
+   Integer threads = GetThreadCount();
+   std::streamoff fileSize = theReader.GetFileSize();
+   std::streamoff batchBytes = 0;
+   std::vector<EventSearch::Task> tasks;
+
+   for (UnsignedInt i = first; (i < segmentOffsets.size()) &&
+        ((Integer)tasks.size() < threads); ++i)
    {
-      if (i == 0)
-         hour = atoi(pch);
-      else if (i == 1)
-         minute = atoi(pch);
-      else if (i == 2)
-         sec = atof(pch);
-      i++;
-      pch = strtok(NULL, ":");
+      std::streamoff end = (i + 1 < segmentOffsets.size() ?
+            segmentOffsets[i+1] : fileSize);
+      batchBytes += end - segmentOffsets[i];
+      if (batchBytes > PARALLEL_BATCH_BYTES)
+         break;
+
+      ParsedSegment *segment = &parsedSegments[i];
+      std::streamoff offset = segmentOffsets[i];
+      const std::string &fileName = tdmFileName;
+      tasks.push_back([segment, offset, &fileName]()
+      {
+         TdmStreamReader reader;
+         reader.Open(fileName);
+         reader.Seek(offset);
+         reader.NextSegment(segment->metadata);
+
+         TdmStreamReader::Observation obs;
+         while (reader.NextObservation(obs))
+            segment->observations.push_back(obs);
+      });
    }
-   // Done Parsing ....
-  
-   // Start Conversion ....
-   
-   if (doy != -1)  // Handle the second format
-      ToMonthDayFromYearDOY(year, doy, month, day);
-   
-   mjd = ModifiedJulianDate(year, month, day, hour, minute, sec); 
-  
-   return mjd;
+
+   EventSearch::RunTasks(tasks, threads);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetThreadCount() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of threads used for the segments.
+ *
+ * @return The thread count, at least 1
+ */
+//------------------------------------------------------------------------------
+Integer TdmReadWriter::GetThreadCount() const
+{
+   Integer threads = threadCount;
+   if (threads <= 0)
+      threads = (Integer)std::thread::hardware_concurrency();
+   return (threads > 1 ? threads : 1);
 }
@@ -22,19 +22,22 @@
 #ifndef TdmReadWriter_hpp
 #define TdmReadWriter_hpp
 
-#include "TdmErrorHandler.hpp"
 #include "ObservationData.hpp"
-#include "xercesc/parsers/XercesDOMParser.hpp"
-#include "xercesc/dom/DOM.hpp"
+#include "TdmStreamReader.hpp"
+#include <map>
 
 /**
-* Class that implements the XML parsing details
+* Class that implements the TDM parsing details
 * 
-* This class provides the interface into the Xerces
-* library, used to handle the XML parsing necessary to
-* work with the TDM files.
+* This class reads the TDM files, in XML or KVN form, through a
+* TdmStreamReader, so a file is never held in memory.
 * TdmObType class will be using this class to access the
 * observation data records.
+*
+* The segments of a file with several of them are parsed on several threads:
+* batches of consecutive segments spanning at most PARALLEL_BATCH_BYTES are
+* parsed together, and a larger segment is streamed on its own.  The records
+* are returned in file order either way.
 */
 class  ESTIMATION_API TdmReadWriter
 {
@@ -47,33 +50,46 @@ public:
 
    bool Initialize();
    bool Validate(const std::string &tdmFileName);
-//   ObsData *ProcessMetadata();
-//   ObsData *LoadRecord(ObsData *newData);
    ObservationData *ProcessMetadata();
    ObservationData *LoadRecord(ObservationData *newData);
    bool Finalize();
    bool SetBody();
+   void SetThreadCount(Integer count);
+
+   /// Largest span of a file, in bytes, parsed ahead by one batch of threads
+   static const std::streamoff PARALLEL_BATCH_BYTES;
 
 private:
+   /// A segment parsed ahead of its use
+   struct ParsedSegment
+   {
+      TdmStreamReader::Metadata                 metadata;
+      std::vector<TdmStreamReader::Observation> observations;
+   };
+
    /// An ObservationData object used to capture metadata
    ObservationData theTemplate;
-//   ObsData theTemplate;
-   /// Error Handler that Xerces DOM parser uses to pass errors/warnings to GMAT
-   TdmErrorHandler *theErrorHandler;
-   /// Xerces DOM Parser
-   XercesDOMParser *theDOMParser;
-   /// Is the Xerces initialized
-   bool xercesInitialized;
-   /// XML file consists of header and body
-   DOMElement *theBody;
-   /// XML file has "Segment" node(s)
-   DOMElement *theSegment;
-   /// XML file has "Data" node
-   DOMElement *theData;
-   /// XML file has "Observation" node (s)
-   DOMElement *theObservation;
-   /// Observation node Index where we left
-   int observationIndex;
+   /// Reader used for the header and for the segments read in sequence
+   TdmStreamReader theReader;
+   /// Name of the TDM file
+   std::string tdmFileName;
+   /// Number of threads for the segments; 0 uses one per hardware thread
+   Integer threadCount;
+   /// Segment start offsets, if the segments are parsed in parallel
+   std::vector<std::streamoff> segmentOffsets;
+   /// Index of the next segment to start
+   UnsignedInt nextSegment;
+   /// Segments parsed ahead, by index
+   std::map<UnsignedInt, ParsedSegment> parsedSegments;
+   /// The parsed segment being read and its index, or NULL if the segment
+   /// is read through theReader
+   ParsedSegment *currentSegment;
+   UnsignedInt currentIndex;
+   /// Index of the next observation of currentSegment
+   UnsignedInt observationIndex;
+   /// The first observation not yet loaded into a record
+   TdmStreamReader::Observation pending;
+   bool hasPending;
    /// map Transmit Band to a real number
    std::map<std::string, Real> mapTransmitBand;
 
@@ -103,11 +119,12 @@ private:
    };
 
    /// Hash the Node name to corresponding enum value
-   MetaData HashIt(const XMLCh *xmlNodeName);
+   MetaData HashIt(const std::string &nodeName);
 
-   /// Convert Epoch data to date and time utility values
-   GmatEpoch ParseEpoch(const std::string strEpoch);
-   
+   bool StartSegment(TdmStreamReader::Metadata &metadata);
+   bool NextObservation(TdmStreamReader::Observation &obs);
+   void ParseAhead(UnsignedInt first);
+   Integer GetThreadCount() const;
 };
 
 #endif   //TdmReadWriter_hpp
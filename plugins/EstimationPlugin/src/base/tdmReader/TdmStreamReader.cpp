@@ -0,0 +1,972 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TdmStreamReader
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the streaming TDM reader used by TdmReadWriter.
+ */
+//------------------------------------------------------------------------------
+
+#include "TdmStreamReader.hpp"
+#include "MeasurementException.hpp"
+#include "StringUtil.hpp"
+#include "DateUtil.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+
+/// End of file marker of the stream buffer
+static const int END_OF_STREAM = std::char_traits<char>::eof();
+
+
+//------------------------------------------------------------------------------
+// void SplitTokens(const std::string &str, char delimiter, StringArray &tokens)
+//------------------------------------------------------------------------------
+/**
+ * Splits a string at a delimiter, dropping empty tokens as strtok() does.
+ *
+ * @param str       The string
+ * @param delimiter The delimiter
+ * @param tokens    The tokens found
+ */
+//------------------------------------------------------------------------------
+static void SplitTokens(const std::string &str, char delimiter,
+                        StringArray &tokens)
+{
+   tokens.clear();
+   std::string::size_type start = 0;
+   while (start < str.size())
+   {
+      std::string::size_type end = str.find(delimiter, start);
+      if (end == std::string::npos)
+         end = str.size();
+      if (end > start)
+         tokens.push_back(str.substr(start, end - start));
+      start = end + 1;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Public Methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// TdmStreamReader()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+TdmStreamReader::TdmStreamReader() :
+   buffer         (NULL),
+   position       (0),
+   tagStart       (0),
+   fileSize       (0),
+   isXml          (true),
+   inData         (false),
+   epochParsed    (false),
+   lastEpochMjd   (0.0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~TdmStreamReader()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+TdmStreamReader::~TdmStreamReader()
+{
+   Close();
+}
+
+
+//------------------------------------------------------------------------------
+// void Open(const std::string &tdmFileName)
+//------------------------------------------------------------------------------
+/**
+ * Opens a TDM file and detects its form.
+ *
+ * A file whose first character, past a byte order mark and white space, is
+ * '<' is read as XML; any other file is read as KVN.
+ *
+ * @param tdmFileName The file
+ */
+//------------------------------------------------------------------------------
+void TdmStreamReader::Open(const std::string &tdmFileName)
+{
+   Close();
+
+   fileName = tdmFileName;
+   tdmFile.open(fileName.c_str(), std::ios::in | std::ios::binary);
+   if (!tdmFile.is_open())
+      throw MeasurementException("The TDM file " + fileName +
+            " could not be opened");
+
+   buffer = tdmFile.rdbuf();
+   fileSize = buffer->pubseekoff(0, std::ios::end, std::ios::in);
+   Seek(0);
+
+   if (Peek() == 0xEF)
+   {
+      Get();
+      Get();
+      Get();
+   }
+   while ((Peek() != END_OF_STREAM) && isspace(Peek()))
+      Get();
+   isXml = (Peek() == '<');
+}
+
+
+//------------------------------------------------------------------------------
+// void Close()
+//------------------------------------------------------------------------------
+/**
+ * Closes the file.
+ */
+//------------------------------------------------------------------------------
+void TdmStreamReader::Close()
+{
+   if (tdmFile.is_open())
+      tdmFile.close();
+   tdmFile.clear();
+   buffer = NULL;
+   position = 0;
+   inData = false;
+   epochParsed = false;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsOpen() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if a file is open.
+ *
+ * @return true if a file is open
+ */
+//------------------------------------------------------------------------------
+bool TdmStreamReader::IsOpen() const
+{
+   return (buffer != NULL);
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsXml() const
+//------------------------------------------------------------------------------
+/**
+ * Checks the form of the open file.
+ *
+ * @return true for an XML file, false for a KVN file
+ */
+//------------------------------------------------------------------------------
+bool TdmStreamReader::IsXml() const
+{
+   return isXml;
+}
+
+
+//------------------------------------------------------------------------------
+// std::streamoff GetFileSize() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the size of the open file.
+ *
+ * @return The size in bytes
+ */
+//------------------------------------------------------------------------------
+std::streamoff TdmStreamReader::GetFileSize() const
+{
+   return fileSize;
+}
+
+
+//------------------------------------------------------------------------------
+// void ReadHeader(std::string &id, std::string &version)
+//------------------------------------------------------------------------------
+/**
+ * Reads the file up to its header.
+ *
+ * For XML this is the tdm start tag, whose id and version attributes are
+ * returned; for KVN it is the first line, which holds the version.
+ *
+ * @param id      Set to the version keyword, or empty if the XML root has no
+ *                id attribute
+ * @param version Set to the TDM version, or empty if none is given
+ */
+//------------------------------------------------------------------------------
+void TdmStreamReader::ReadHeader(std::string &id, std::string &version)
+{
+   id = "";
+   version = "";
+
+   if (isXml)
+   {
+      std::string name, attributes;
+      TagType type = NextTag(name, NULL, &attributes);
+      if ((type == END_OF_FILE) || (type == END_TAG) || (name != "tdm"))
+         Fail("the root element is not tdm");
+      id = GetAttribute(attributes, "id");
+      version = GetAttribute(attributes, "version");
+   }
+   else
+   {
+      std::string keyword, value;
+      if (!NextLine(keyword, value) || (keyword != "CCSDS_TDM_VERS"))
+         Fail("the file does not start with CCSDS_TDM_VERS");
+      id = keyword;
+      version = value;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool NextSegment(Metadata &metadata)
+//------------------------------------------------------------------------------
+/**
+ * Reads the metadata of the next segment, leaving the file at its data.
+ *
+ * Anything left of the current segment is skipped.
+ *
+ * @param metadata The keywords and values of the metadata section
+ *
+ * @return true if a segment was read, false at the end of the file
+ */
+//------------------------------------------------------------------------------
+bool TdmStreamReader::NextSegment(Metadata &metadata)
+{
+   metadata.clear();
+   inData = false;
+
+   if (isXml)
+   {
+      std::string name;
+      TagType type;
+      do
+      {
+         type = NextTag(name);
+         if ((type == END_OF_FILE) || ((type == END_TAG) && (name == "tdm")))
+            return false;
+      } while ((type != START_TAG) || (name != "segment"));
+
+      SkipTo(START_TAG, "metadata");
+      while (true)
+      {
+         type = NextTag(name);
+         if (type == START_TAG)
+         {
+            metadata.push_back(std::make_pair(name, std::string()));
+            ReadElementText(metadata.back().second);
+         }
+         else if (type == EMPTY_TAG)
+            metadata.push_back(std::make_pair(name, std::string()));
+         else if (type == END_TAG)
+            break;
+         else
+            Fail("a metadata section is not terminated");
+      }
+
+      while (true)
+      {
+         type = NextTag(name);
+         if ((type == START_TAG) && (name == "data"))
+         {
+            inData = true;
+            break;
+         }
+         if (((type == EMPTY_TAG) && (name == "data")) ||
+             ((type == END_TAG) && (name == "segment")))
+            break;
+         if (type == END_OF_FILE)
+            Fail("a segment is not terminated");
+      }
+   }
+   else
+   {
+      std::string keyword, value;
+      do
+      {
+         if (!NextLine(keyword, value))
+            return false;
+      } while (keyword != "META_START");
+
+      while (true)
+      {
+         if (!NextLine(keyword, value))
+            Fail("a metadata section is not terminated");
+         if (keyword == "META_STOP")
+            break;
+         metadata.push_back(std::make_pair(keyword, value));
+      }
+
+      if (!NextLine(keyword, value) || (keyword != "DATA_START"))
+         Fail("DATA_START does not follow META_STOP");
+      inData = true;
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool NextObservation(Observation &obs)
+//------------------------------------------------------------------------------
+/**
+ * Reads the next observation of the current data section.
+ *
+ * @param obs The observation
+ *
+ * @return true if an observation was read, false at the end of the section
+ */
+//------------------------------------------------------------------------------
+bool TdmStreamReader::NextObservation(Observation &obs)
+{
+   if (!inData)
+      return false;
+
+   if (isXml)
+   {
+      std::string name, text;
+      while (true)
+      {
+         TagType type = NextTag(name);
+         if ((type == END_TAG) || (type == END_OF_FILE))
+         {
+            if ((type == END_OF_FILE) || (name != "data"))
+               Fail("a data section is not terminated");
+            inData = false;
+            return false;
+         }
+         if (type == EMPTY_TAG)
+            continue;
+         if (name != "observation")
+         {
+            // Comments and other elements of the data section
+            ReadElementText(text);
+            text.clear();
+            continue;
+         }
+
+         // The first element is the epoch; the last one is the measurement
+         bool hasEpoch = false;
+         obs.keyword.clear();
+         while ((type = NextTag(name)) != END_TAG)
+         {
+            if (type == END_OF_FILE)
+               Fail("an observation is not terminated");
+            text.clear();
+            if (type == START_TAG)
+               ReadElementText(text);
+            if (!hasEpoch)
+            {
+               obs.epoch = text;
+               hasEpoch = true;
+            }
+            else
+            {
+               obs.keyword = name;
+               obs.value = atof(text.c_str());
+            }
+         }
+         if (obs.keyword.empty())
+            Fail("an observation has no measurement");
+         SetEpoch(obs);
+         return true;
+      }
+   }
+
+   std::string value;
+   if (!NextLine(obs.keyword, value))
+      Fail("a data section is not terminated");
+   if (obs.keyword == "DATA_STOP")
+   {
+      inData = false;
+      return false;
+   }
+
+   std::string::size_type split = value.find_first_of(" \t");
+   if (split == std::string::npos)
+      Fail("the data line for " + obs.keyword + " has no value");
+   obs.epoch = value.substr(0, split);
+   obs.value = atof(value.c_str() + split);
+   SetEpoch(obs);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void FindSegments(std::vector<std::streamoff> &offsets)
+//------------------------------------------------------------------------------
+/**
+ * Finds the start of each segment past the current position.
+ *
+ * The markup is scanned without collecting any text, and the file is
+ * returned to the current position afterwards.
+ *
+ * @param offsets The file offsets of the segment starts, for Seek()
+ */
+//------------------------------------------------------------------------------
+void TdmStreamReader::FindSegments(std::vector<std::streamoff> &offsets)
+{
+   std::streamoff resume = position;
+   offsets.clear();
+
+   if (isXml)
+   {
+      std::string name;
+      TagType type;
+      while ((type = NextTag(name)) != END_OF_FILE)
+      {
+         if ((type == START_TAG) && (name == "segment"))
+            offsets.push_back(tagStart);
+         else if ((type == END_TAG) && (name == "tdm"))
+            break;
+      }
+   }
+   else
+   {
+      std::string keyword, value;
+      std::streamoff lineStart;
+      while (NextLine(keyword, value, &lineStart))
+         if (keyword == "META_START")
+            offsets.push_back(lineStart);
+   }
+
+   Seek(resume);
+}
+
+
+//------------------------------------------------------------------------------
+// void Seek(std::streamoff offset)
+//------------------------------------------------------------------------------
+/**
+ * Moves to an offset in the file, such as a segment start.
+ *
+ * @param offset The offset
+ */
+//------------------------------------------------------------------------------
+void TdmStreamReader::Seek(std::streamoff offset)
+{
+   if (buffer->pubseekpos(offset, std::ios::in) != std::streampos(offset))
+      Fail("the file cannot be positioned");
+   position = offset;
+   inData = false;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatEpoch ParseEpoch(const std::string &strEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Parse and Convert Epoch datetime string.
+ *
+ * Two datetime formats :
+ * 1.) YYYY-MM-DDThh:mm:ss[d->d][Z]
+ * 2.) YYYY-DDDThh:mm:ss[d->d][Z]
+ * [d->d] is an optional fraction seconds; 'Z" is an optional time code
+ * terminator.  refer to CCSDS503.0-B-1_TDM.pdf document page 52.
+ *
+ * The string is not modified, so this can be called from several threads.
+ *
+ * @param strEpoch The epoch string
+ *
+ * @return The epoch as a modified Julian date
+ */
+//------------------------------------------------------------------------------
+GmatEpoch TdmStreamReader::ParseEpoch(const std::string &strEpoch)
+{
+   Integer year = -1, doy = -1, month = -1, day = -1, hour = -1, minute = -1;
+   Real sec = -1;
+   StringArray parts, tokens;
+
+   // break the string into date and time parts, using delimiter "T"
+   SplitTokens(strEpoch, 'T', parts);
+
+   // parse the date part
+   if (!parts.empty())
+   {
+      SplitTokens(parts[0], '-', tokens);
+      if (tokens.size() > 0)
+         year = atoi(tokens[0].c_str());
+      if (tokens.size() > 1)
+         doy = atoi(tokens[1].c_str());
+      if (tokens.size() > 2)
+      {
+         month = doy;
+         day = atoi(tokens[2].c_str());
+         // reset it back to -1 to distinguish between two formats
+         doy = -1;
+      }
+   }
+
+   // parse the time part
+   if (parts.size() > 1)
+   {
+      SplitTokens(parts.back(), ':', tokens);
+      if (tokens.size() > 0)
+         hour = atoi(tokens[0].c_str());
+      if (tokens.size() > 1)
+         minute = atoi(tokens[1].c_str());
+      if (tokens.size() > 2)
+         sec = atof(tokens[2].c_str());
+   }
+
+   if (doy != -1)  // Handle the second format
+      ToMonthDayFromYearDOY(year, doy, month, day);
+
+   return ModifiedJulianDate(year, month, day, hour, minute, sec);
+}
+
+
+//------------------------------------------------------------------------------
+// Private Methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// int Get()
+//------------------------------------------------------------------------------
+/**
+ * Reads the next character.
+ *
+ * @return The character, or END_OF_STREAM
+ */
+//------------------------------------------------------------------------------
+int TdmStreamReader::Get()
+{
+   int c = buffer->sbumpc();
+   if (c != END_OF_STREAM)
+      ++position;
+   return c;
+}
+
+
+//------------------------------------------------------------------------------
+// int Peek()
+//------------------------------------------------------------------------------
+/**
+ * Looks at the next character without reading it.
+ *
+ * @return The character, or END_OF_STREAM
+ */
+//------------------------------------------------------------------------------
+int TdmStreamReader::Peek()
+{
+   return buffer->sgetc();
+}
+
+
+//------------------------------------------------------------------------------
+// bool SkipPast(const char *terminator, std::string *text)
+//------------------------------------------------------------------------------
+/**
+ * Reads through the next occurrence of a terminator.
+ *
+ * @param terminator The terminator, such as "-->"
+ * @param text       If not NULL, receives the characters before the
+ *                   terminator, carriage returns excepted
+ *
+ * @return true if the terminator was found, false at the end of the file
+ */
+//------------------------------------------------------------------------------
+bool TdmStreamReader::SkipPast(const char *terminator, std::string *text)
+{
+   size_t length = strlen(terminator);
+   std::string local;
+   std::string &read = (text ? *text : local);
+   size_t start = read.size();
+   int c;
+
+   while ((c = Get()) != END_OF_STREAM)
+   {
+      if (c == '\r')
+         continue;
+      read.push_back((char)c);
+      if ((read.size() - start >= length) &&
+          (read.compare(read.size() - length, length, terminator) == 0))
+      {
+         read.erase(read.size() - length);
+         return true;
+      }
+      // Only the last characters can start the terminator
+      if (!text && (read.size() > length))
+         read.erase(0, read.size() - length);
+   }
+
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void Append(std::string *text, int c)
+//------------------------------------------------------------------------------
+/**
+ * Adds a character of element content to a text, decoding entity references.
+ *
+ * Carriage returns are dropped, as XML line end handling does.
+ *
+ * @param text The text, or NULL if the content is not needed
+ * @param c    The character
+ */
+//------------------------------------------------------------------------------
+void TdmStreamReader::Append(std::string *text, int c)
+{
+   if ((text == NULL) || (c == '\r'))
+      return;
+
+   if (c != '&')
+   {
+      text->push_back((char)c);
+      return;
+   }
+
+   std::string entity;
+   while (((c = Get()) != END_OF_STREAM) && (c != ';') && (entity.size() < 10))
+      entity.push_back((char)c);
+
+   if (entity == "amp")
+      text->push_back('&');
+   else if (entity == "lt")
+      text->push_back('<');
+   else if (entity == "gt")
+      text->push_back('>');
+   else if (entity == "quot")
+      text->push_back('"');
+   else if (entity == "apos")
+      text->push_back('\'');
+   else if ((entity.size() > 1) && (entity[0] == '#'))
+   {
+      long code = (entity[1] == 'x' ? strtol(entity.c_str() + 2, NULL, 16) :
+                   strtol(entity.c_str() + 1, NULL, 10));
+      if (code < 0x80)
+         text->push_back((char)code);
+      else
+         text->append("&" + entity + ";");
+   }
+   else
+      text->append("&" + entity + ";");
+}
+
+
+//------------------------------------------------------------------------------
+// TagType NextTag(std::string &name, std::string *text,
+//                 std::string *attributes)
+//------------------------------------------------------------------------------
+/**
+ * Reads up to and through the next element tag.
+ *
+ * Comments, processing instructions and declarations are skipped.  Namespace
+ * prefixes are removed from the element names.
+ *
+ * @param name       The name of the element
+ * @param text       If not NULL, receives the character data and CDATA
+ *                   sections read before the tag
+ * @param attributes If not NULL, receives the attribute text of a start tag
+ *
+ * @return The type of the tag
+ */
+//------------------------------------------------------------------------------
+TdmStreamReader::TagType TdmStreamReader::NextTag(std::string &name,
+      std::string *text, std::string *attributes)
+{
+   int c;
+   while (true)
+   {
+      while (((c = Get()) != END_OF_STREAM) && (c != '<'))
+         Append(text, c);
+      if (c == END_OF_STREAM)
+         return END_OF_FILE;
+      tagStart = position - 1;
+
+      c = Peek();
+      if (c == '?')
+      {
+         if (!SkipPast("?>"))
+            Fail("a processing instruction is not terminated");
+         continue;
+      }
+      if (c == '!')
+      {
+         Get();
+         if (Peek() == '-')
+         {
+            if (!SkipPast("--") || !SkipPast("-->"))
+               Fail("a comment is not terminated");
+         }
+         else if (Peek() == '[')
+         {
+            if (!SkipPast("[CDATA[") || !SkipPast("]]>", text))
+               Fail("a CDATA section is not terminated");
+         }
+         else
+         {
+            // DOCTYPE and other declarations, with any internal subset
+            Integer depth = 0;
+            while (((c = Get()) != END_OF_STREAM) &&
+                   ((c != '>') || (depth > 0)))
+            {
+               if (c == '[')
+                  ++depth;
+               else if (c == ']')
+                  --depth;
+            }
+         }
+         continue;
+      }
+      break;
+   }
+
+   bool isEnd = (c == '/');
+   if (isEnd)
+      Get();
+
+   name.clear();
+   while (((c = Get()) != END_OF_STREAM) && (c != '>') && (c != '/') &&
+          !isspace(c))
+      name.push_back((char)c);
+   std::string::size_type colon = name.find(':');
+   if (colon != std::string::npos)
+      name.erase(0, colon + 1);
+
+   if (attributes)
+      attributes->clear();
+   bool isEmpty = false;
+   int quote = 0;
+   while (c != '>')
+   {
+      if (c == END_OF_STREAM)
+         Fail("the tag of element " + name + " is not terminated");
+      if (quote != 0)
+      {
+         if (c == quote)
+            quote = 0;
+      }
+      else if ((c == '"') || (c == '\''))
+         quote = c;
+      else if ((c == '/') && (Peek() == '>'))
+         isEmpty = true;
+      if (attributes)
+         attributes->push_back((char)c);
+      c = Get();
+   }
+
+   if (isEnd)
+      return END_TAG;
+   return (isEmpty ? EMPTY_TAG : START_TAG);
+}
+
+
+//------------------------------------------------------------------------------
+// void ReadElementText(std::string &text)
+//------------------------------------------------------------------------------
+/**
+ * Reads the content of an element through its end tag.
+ *
+ * The text of nested elements is included, as DOM text content is.
+ *
+ * @param text Receives the text
+ */
+//------------------------------------------------------------------------------
+void TdmStreamReader::ReadElementText(std::string &text)
+{
+   std::string name;
+   Integer depth = 0;
+   while (true)
+   {
+      TagType type = NextTag(name, &text);
+      if (type == START_TAG)
+         ++depth;
+      else if (type == END_TAG)
+      {
+         if (depth == 0)
+            return;
+         --depth;
+      }
+      else if (type == END_OF_FILE)
+         Fail("the element " + name + " is not terminated");
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SkipTo(TagType type, const std::string &name)
+//------------------------------------------------------------------------------
+/**
+ * Reads through the next tag of a type and element name.
+ *
+ * @param type The tag type
+ * @param name The element name
+ */
+//------------------------------------------------------------------------------
+void TdmStreamReader::SkipTo(TagType type, const std::string &name)
+{
+   std::string found;
+   TagType foundType;
+   do
+   {
+      foundType = NextTag(found);
+      if (foundType == END_OF_FILE)
+         Fail("the element " + name + " was not found");
+   } while ((foundType != type) || (found != name));
+}
+
+
+//------------------------------------------------------------------------------
+// bool NextLine(std::string &keyword, std::string &value,
+//               std::streamoff *lineStart)
+//------------------------------------------------------------------------------
+/**
+ * Reads the next KVN line that is neither blank nor a comment.
+ *
+ * @param keyword   The text before the first '=', or the whole line if it
+ *                  has none
+ * @param value     The text after the first '=', trimmed
+ * @param lineStart If not NULL, receives the offset of the line
+ *
+ * @return true if a line was read, false at the end of the file
+ */
+//------------------------------------------------------------------------------
+bool TdmStreamReader::NextLine(std::string &keyword, std::string &value,
+                               std::streamoff *lineStart)
+{
+   std::string line;
+   while (true)
+   {
+      std::streamoff start = position;
+      line.clear();
+      int c;
+      while (((c = Get()) != END_OF_STREAM) && (c != '\n'))
+         if (c != '\r')
+            line.push_back((char)c);
+      if ((c == END_OF_STREAM) && line.empty())
+         return false;
+
+      line = GmatStringUtil::Trim(line);
+      if (line.empty() || (line.compare(0, 7, "COMMENT") == 0))
+         continue;
+
+      std::string::size_type equals = line.find('=');
+      if (equals == std::string::npos)
+      {
+         keyword = line;
+         value = "";
+      }
+      else
+      {
+         keyword = GmatStringUtil::Trim(line.substr(0, equals));
+         value = GmatStringUtil::Trim(line.substr(equals + 1));
+      }
+      if (lineStart)
+         *lineStart = start;
+      return true;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SetEpoch(Observation &obs)
+//------------------------------------------------------------------------------
+/**
+ * Sets the parsed epoch of an observation from its epoch text.
+ *
+ * Observations grouped at one epoch repeat its text, so the last result is
+ * reused when the text matches.
+ *
+ * @param obs The observation
+ */
+//------------------------------------------------------------------------------
+void TdmStreamReader::SetEpoch(Observation &obs)
+{
+   if (!epochParsed || (obs.epoch != lastEpoch))
+   {
+      lastEpoch = obs.epoch;
+      lastEpochMjd = ParseEpoch(obs.epoch);
+      epochParsed = true;
+   }
+   obs.epochMjd = lastEpochMjd;
+}
+
+
+//------------------------------------------------------------------------------
+// void Fail(const std::string &reason)
+//------------------------------------------------------------------------------
+/**
+ * Reports a malformed file.
+ *
+ * @param reason The problem found
+ */
+//------------------------------------------------------------------------------
+void TdmStreamReader::Fail(const std::string &reason)
+{
+   throw MeasurementException("The TDM file " + fileName +
+         " cannot be read: " + reason);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetAttribute(const std::string &attributes,
+//                          const std::string &name)
+//------------------------------------------------------------------------------
+/**
+ * Finds the value of an attribute in the attribute text of a tag.
+ *
+ * @param attributes The attribute text
+ * @param name       The attribute name
+ *
+ * @return The value, or an empty string if the attribute is not set
+ */
+//------------------------------------------------------------------------------
+std::string TdmStreamReader::GetAttribute(const std::string &attributes,
+                                          const std::string &name)
+{
+   std::string::size_type i = 0, count = attributes.size();
+   while (i < count)
+   {
+      while ((i < count) && (isspace(attributes[i]) || (attributes[i] == '/')))
+         ++i;
+      std::string::size_type start = i;
+      while ((i < count) && (attributes[i] != '=') && !isspace(attributes[i]))
+         ++i;
+      std::string attribute = attributes.substr(start, i - start);
+
+      while ((i < count) && (isspace(attributes[i]) || (attributes[i] == '=')))
+         ++i;
+      if (i >= count)
+         break;
+      char quote = attributes[i];
+      std::string::size_type end = attributes.find(quote, i + 1);
+      if (end == std::string::npos)
+         break;
+      if (attribute == name)
+         return attributes.substr(i + 1, end - i - 1);
+      i = end + 1;
+   }
+
+   return "";
+}
@@ -0,0 +1,136 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TdmStreamReader
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Streaming reader for CCSDS TDM files in XML or KVN form.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef TdmStreamReader_hpp
+#define TdmStreamReader_hpp
+
+#include "estimation_defs.hpp"
+#include "gmatdefs.hpp"
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * Pull reader for the segments and observations of a TDM file
+ *
+ * The file is read sequentially, one segment and one observation at a time,
+ * so memory use does not depend on the file size.  The XML form is scanned
+ * directly for the TDM elements: element text is collected the way a DOM
+ * reports it (entities decoded, CDATA included, surrounding white space
+ * kept), and comments, processing instructions and the DOCTYPE are skipped.
+ * No schema validation is performed.
+ *
+ * Segment start offsets found by FindSegments() can be passed to Seek() on
+ * other readers of the same file, so independent segments can be read on
+ * separate threads.
+ */
+class ESTIMATION_API TdmStreamReader
+{
+public:
+   /// One observation of a data section
+   struct Observation
+   {
+      /// Epoch text, as it appears in the file
+      std::string    epoch;
+      /// Keyword (element name) of the measurement
+      std::string    keyword;
+      /// The epoch as a modified Julian date, from ParseEpoch()
+      GmatEpoch      epochMjd;
+      /// The measurement value
+      Real           value;
+   };
+
+   /// Keyword and value pairs of a metadata section, in file order
+   typedef std::vector<std::pair<std::string, std::string> > Metadata;
+
+   TdmStreamReader();
+   ~TdmStreamReader();
+
+   void              Open(const std::string &tdmFileName);
+   void              Close();
+   bool              IsOpen() const;
+   bool              IsXml() const;
+   std::streamoff    GetFileSize() const;
+
+   void              ReadHeader(std::string &id, std::string &version);
+   bool              NextSegment(Metadata &metadata);
+   bool              NextObservation(Observation &obs);
+
+   void              FindSegments(std::vector<std::streamoff> &offsets);
+   void              Seek(std::streamoff offset);
+
+   static GmatEpoch  ParseEpoch(const std::string &strEpoch);
+
+private:
+   /// XML markup returned by NextTag()
+   enum TagType
+   {
+      START_TAG,
+      END_TAG,
+      EMPTY_TAG,
+      END_OF_FILE
+   };
+
+   /// The file
+   std::ifstream     tdmFile;
+   /// Name of the file, for messages
+   std::string       fileName;
+   /// Buffer of the file, read one character at a time
+   std::streambuf    *buffer;
+   /// Offset of the next character in the file
+   std::streamoff    position;
+   /// Offset of the '<' of the last tag read
+   std::streamoff    tagStart;
+   /// Size of the file in bytes
+   std::streamoff    fileSize;
+   /// True for the XML form, false for KVN
+   bool              isXml;
+   /// True between the start and the end of a data section
+   bool              inData;
+   /// Last epoch parsed, reused by observations sharing its text
+   bool              epochParsed;
+   std::string       lastEpoch;
+   GmatEpoch         lastEpochMjd;
+
+   int               Get();
+   int               Peek();
+   bool              SkipPast(const char *terminator,
+                              std::string *text = NULL);
+   void              Append(std::string *text, int c);
+   TagType           NextTag(std::string &name, std::string *text = NULL,
+                             std::string *attributes = NULL);
+   void              ReadElementText(std::string &text);
+   void              SkipTo(TagType type, const std::string &name);
+   bool              NextLine(std::string &keyword, std::string &value,
+                              std::streamoff *lineStart = NULL);
+   void              SetEpoch(Observation &obs);
+   void              Fail(const std::string &reason);
+
+   static std::string
+                     GetAttribute(const std::string &attributes,
+                                  const std::string &name);
+};
+
+#endif   //TdmStreamReader_hpp
@@ -238,6 +238,7 @@ TrackingFileSet::~TrackingFileSet()
    references.clear();
 
    ionosphereCache.clear();
+   lightTimeCache.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -502,11 +503,12 @@ std::string TrackingFileSet::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer TrackingFileSet::GetParameterID(const std::string& str) const
 {
-   for (Integer i = MeasurementModelBaseParamCount; i < TrackingFileSetParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - MeasurementModelBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, MeasurementModelBaseParamCount,
+               TrackingFileSetParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return MeasurementModelBase::GetParameterID(str);
 }
@@ -3441,6 +3443,7 @@ TrackingDataAdapter* TrackingFileSet::BuildAdapter(const StringArray& strand, co
       Real multiplier = mn->GetMNMultiplier(magicNumber);
       retval->SetModelTypeID(magicNumber, type, multiplier);
       retval->SetIonosphereCache(&ionosphereCache);
+      retval->SetLightTimeCache(&lightTimeCache);
 
       // Pass in the signal paths
       std::string theStrand;
@@ -328,6 +328,8 @@ private:
 
    /// Cache for ionosphere corrections
    SignalDataCache::SimpleSignalDataCache ionosphereCache;
+   /// Light time solutions shared by the adapters, by signal leg
+   SignalDataCache::LightTimeCache lightTimeCache;
 
    /// Warning messages
    StringArray mesg;
@@ -48,6 +48,8 @@
 #include "SpiceInterface.hpp"
 #include "Moderator.hpp"
 #include "PlanetographicRegion.hpp"
+#include "CoordinateConverter.hpp"
+#include "RealUtilities.hpp"
 #include <iomanip>
 
 //#define DEBUG_SET
@@ -70,6 +72,8 @@ const std::string ContactLocator::PARAMETER_TEXT[
    "ReportFormat",
    "IntervalStepSize",
    "ReportTimeFormat",
+   "AdaptiveStep",
+   "MinimumPassDuration",
 };
 
 const Gmat::ParameterType ContactLocator::PARAMETER_TYPE[
@@ -82,6 +86,8 @@ const Gmat::ParameterType ContactLocator::PARAMETER_TYPE[
    Gmat::STRING_TYPE, // REPORT_TEMPLATE_FORMAT
    Gmat::REAL_TYPE,
    Gmat::STRING_TYPE, // REPORT_TIME_FORMAT
+   Gmat::BOOLEAN_TYPE, // ADAPTIVE_STEP
+   Gmat::REAL_TYPE,    // MINIMUM_PASS_DURATION
 };
 
 const std::string ContactLocator::LT_DIRECTIONS[2] =
@@ -176,6 +182,8 @@ ContactLocator::ContactLocator(const ContactLocator &cl) :
    intervalStep            (cl.intervalStep),
    reportTimeFormat        (cl.reportTimeFormat),
    reportTemplateFormat    (cl.reportTemplateFormat),
+   adaptiveStep            (cl.adaptiveStep),
+   minimumPassDuration     (cl.minimumPassDuration),
    spice(NULL)
 {
    // Observers
@@ -229,6 +237,8 @@ ContactLocator& ContactLocator::operator=(const ContactLocator &c)
      intervalStep = c.intervalStep;
      reportTimeFormat = c.reportTimeFormat;
      reportTemplateFormat = c.reportTemplateFormat;
+     adaptiveStep = c.adaptiveStep;
+     minimumPassDuration = c.minimumPassDuration;
 
       // Observers
       observerNames.clear();
@@ -322,11 +332,12 @@ std::string ContactLocator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ContactLocator::GetParameterID(const std::string & str) const
 {
-   for (Integer i = EventLocatorParamCount; i < ContactLocatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - EventLocatorParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, EventLocatorParamCount,
+               ContactLocatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    if (str == "Target")
       return SATNAME;
    else if (str == "Spacecraft")
@@ -484,6 +495,8 @@ Real ContactLocator::GetRealParameter(const Integer id) const
       return reportPrecision;
    if (id == INTERVAL_STEP)
       return intervalStep;
+   if (id == MINIMUM_PASS_DURATION)
+      return minimumPassDuration;
 
    return EventLocator::GetRealParameter(id);
 }
@@ -522,6 +535,20 @@ Real ContactLocator::SetRealParameter(const Integer id, const Real value)
       }
       return intervalStep;
    }
+   if (id == MINIMUM_PASS_DURATION)
+   {
+      if (value <= 0)
+      {
+         std::string errmsg = "*** Error *** The value " +
+            GmatStringUtil::ToString(value) + " for field MinimumPassDuration "
+            "on object \"" + instanceName + "\" is not an allowed value. "
+            "Allowed values are greater than 0.";
+         throw EventException(errmsg);
+      }
+
+      minimumPassDuration = value;
+      return minimumPassDuration;
+   }
 
    return EventLocator::SetRealParameter(id, value);
 }
@@ -560,6 +587,20 @@ Real ContactLocator::SetRealParameter(const Integer id, const Integer value)
       }
       return intervalStep;
    }
+   if (id == MINIMUM_PASS_DURATION)
+   {
+      if (value <= 0)
+      {
+         std::string errmsg = "*** Error *** The value " +
+            GmatStringUtil::ToString(value) + " for field MinimumPassDuration "
+            "on object \"" + instanceName + "\" is not an allowed value. "
+            "Allowed values are greater than 0.";
+         throw EventException(errmsg);
+      }
+
+      minimumPassDuration = value;
+      return minimumPassDuration;
+   }
 
    return EventLocator::SetRealParameter(id, value);
 }
@@ -947,6 +988,8 @@ bool ContactLocator::GetBooleanParameter(const Integer id) const
 {
    if (id == LEFT_JUSTIFIED)
       return leftJustified;
+   if (id == ADAPTIVE_STEP)
+      return adaptiveStep;
 
    return EventLocator::GetBooleanParameter(id);
 }
@@ -971,6 +1014,11 @@ bool ContactLocator::SetBooleanParameter(const Integer id, const bool value)
       leftJustified = value;
       return true;
    }
+   if (id == ADAPTIVE_STEP)
+   {
+      adaptiveStep = value;
+      return true;
+   }
 
    return EventLocator::SetBooleanParameter(id, value);
 }
@@ -2331,6 +2379,14 @@ void ContactLocator::FindEvents()
 
    if (!targetIsRegion)
    {
+      // The native search finds the intervals of all stations up front
+      bool native = UseNativeSearch();
+      std::vector<RealArray> nativeStarts, nativeEnds, nativeMaxTimes;
+      if (native)
+         FindNativeContacts(nativeStarts, nativeEnds, nativeMaxTimes);
+      else
+         nativeStations.clear();
+
       for (Integer j = 0; j < directObservers.size(); j++)
       {
          bool isImagerObserver = false;
@@ -2418,9 +2474,17 @@ void ContactLocator::FindEvents()
          MessageInterface::ShowMessage("   stepSize          = %12.10f\n", stepSize);
 #endif
          bool transmit = (GmatStringUtil::ToUpper(lightTimeDirection) == "TRANSMIT");
-         em->GetContactIntervals(theObsrvr, minElAngle, obsFrame, bodiesToUse, theAbCorr,
-            initialEp, finalEp, useEntireInterval, useLightTimeDelay, transmit, stepSize, numContacts,
-            starts, ends, isImagerObserver, imagerNAIFId, maxElevationTimes);
+         if (native)
+         {
+            starts = nativeStarts.at(j);
+            ends = nativeEnds.at(j);
+            maxElevationTimes = nativeMaxTimes.at(j);
+            numContacts = (Integer) starts.size();
+         }
+         else
+            em->GetContactIntervals(theObsrvr, minElAngle, obsFrame, bodiesToUse, theAbCorr,
+               initialEp, finalEp, useEntireInterval, useLightTimeDelay, transmit, stepSize, numContacts,
+               starts, ends, isImagerObserver, imagerNAIFId, maxElevationTimes);
 #ifdef DEBUG_CONTACT_EVENTS
          MessageInterface::ShowMessage("After GetContactIntervals: \n");
          MessageInterface::ShowMessage("   numContacts       = %d\n", numContacts);
@@ -2435,12 +2499,6 @@ void ContactLocator::FindEvents()
                Real maxElevationTime = maxElevationTimes.at(kk);
                ContactEvent *newEvent = new ContactEvent(s1, e1, reportColumnsInOrder, leftJustified);
 
-               SpiceInt target = this->sat->GetIntegerParameter("NAIFId");
-               SpiceInt obs = obsNaifId;
-
-               ConstSpiceChar *obsFrameConstSpiceChar = obsFrame.c_str();
-               ConstSpiceChar *theAbCorrConstSpiceChar = theAbCorr.c_str();
-
                SpiceDouble azimuthEpoch, elevationEpoch, radiusEpoch;
                SpiceDouble maxAzimuthEpoch, maxElevationEpoch, maxRadiusEpoch;
 
@@ -2449,37 +2507,16 @@ void ContactLocator::FindEvents()
 
                if (reportColumnsInOrder.size() > 0)
                {
-                  SpiceDouble startPos[3];
-                  em->GetTargetPosition(target,
-                     s1,
-                     obsFrameConstSpiceChar,
-                     theAbCorrConstSpiceChar,
-                     obs,
-                     startPos);
-
-                  // Move this to Ephem Manager
-                  reclat_c(startPos, &radiusEpoch, &azimuthEpoch, &elevationEpoch);
-
-                  azimuthEpoch = -azimuthEpoch;
-                  if (azimuthEpoch < 0)
-                  {
-                     azimuthEpoch = 2 * GmatMathConstants::PI + azimuthEpoch;
-                  }
+                  GetRangeAzEl(j, s1, obsNaifId, obsFrame, theAbCorr,
+                     radiusEpoch, azimuthEpoch, elevationEpoch);
 
                   newEvent->eventRanges.push_back(radiusEpoch);
                   newEvent->eventAzimuths.push_back(azimuthEpoch * GmatMathConstants::DEG_PER_RAD);
                   newEvent->eventElevations.push_back(elevationEpoch * GmatMathConstants::DEG_PER_RAD);
 
-                  SpiceDouble maxElPos[3];
-                  em->GetTargetPosition(target,
-                     maxElevationTime,
-                     obsFrameConstSpiceChar,
-                     theAbCorrConstSpiceChar,
-                     obs,
-                     maxElPos);
-
-                  // Move this to Ephem Manager
-                  reclat_c(maxElPos, &maxRadiusEpoch, &maxAzimuthEpoch, &maxElevationEpoch);
+                  GetRangeAzEl(j, maxElevationTime, obsNaifId, obsFrame,
+                     theAbCorr, maxRadiusEpoch, maxAzimuthEpoch,
+                     maxElevationEpoch);
 
                   newEvent->eventMaxElevation = maxElevationEpoch * GmatMathConstants::DEG_PER_RAD;
                   newEvent->eventMaxElevationEpoch = maxElevationTime;
@@ -2492,21 +2529,9 @@ void ContactLocator::FindEvents()
                      for (int i = 0; i <= numToReport - 1; i++)
                      {
                         Real epochMod = s1 + (intervalStep / 86400.0) * (i + 1);
-                        SpiceDouble epochPos[3];
-                        em->GetTargetPosition(target,
-                           epochMod,
-                           obsFrameConstSpiceChar,
-                           theAbCorrConstSpiceChar,
-                           obs,
-                           epochPos);
-
-                        reclat_c(epochPos, &radiusEpoch, &azimuthEpoch, &elevationEpoch);
-
-                        azimuthEpoch = -azimuthEpoch;
-                        if (azimuthEpoch < 0)
-                        {
-                           azimuthEpoch = 2 * GmatMathConstants::PI + azimuthEpoch;
-                        }
+                        GetRangeAzEl(j, epochMod, obsNaifId, obsFrame,
+                           theAbCorr, radiusEpoch, azimuthEpoch,
+                           elevationEpoch);
 
                         newEvent->eventTimes.insert(newEvent->eventTimes.end() - 1, s1 + (i + 1)*(intervalStep / 86400.0));
                         newEvent->eventRanges.push_back(radiusEpoch);
@@ -2514,21 +2539,8 @@ void ContactLocator::FindEvents()
                         newEvent->eventElevations.push_back(elevationEpoch * GmatMathConstants::DEG_PER_RAD);
                      }
                   }
-                  SpiceDouble endPos[3];
-                  em->GetTargetPosition(target,
-                     e1,
-                     obsFrameConstSpiceChar,
-                     theAbCorrConstSpiceChar,
-                     obs,
-                     endPos);
-
-                  reclat_c(endPos, &radiusEpoch, &azimuthEpoch, &elevationEpoch);
-
-                  azimuthEpoch = -azimuthEpoch;
-                  if (azimuthEpoch < 0)
-                  {
-                     azimuthEpoch = 2 * GmatMathConstants::PI + azimuthEpoch;
-                  }
+                  GetRangeAzEl(j, e1, obsNaifId, obsFrame, theAbCorr,
+                     radiusEpoch, azimuthEpoch, elevationEpoch);
 
                   newEvent->eventRanges.push_back(radiusEpoch);
                   newEvent->eventAzimuths.push_back(azimuthEpoch * GmatMathConstants::DEG_PER_RAD);
@@ -2637,61 +2649,79 @@ void ContactLocator::FindEvents()
          theAbCorrConstSpiceChar = abcorrString.c_str();
 
 
-         Integer numberLoops = (Integer)((findStop - findStart) * GmatTimeConstants::SECS_PER_DAY / stepSize);
-         for (int count = 0; count <= numberLoops; ++count)
+         Real rateBound = (adaptiveStep ? GetRegionRateBound() : 0.0);
+         if (rateBound > 0.0)
+         {
+            // The distance to the region boundary, negative outside of it
+            Integer used = EventSearch::FindBoundedIntervals([this](Real epoch)
+                  {
+                     Rvector3 latLongHeight;
+                     Real distance;
+                     IsSatWithinRegion(epoch, latLongHeight, distance);
+                     return -distance;
+                  }, rateBound, findStart, findStop, minimumPassDuration,
+                  starts, ends, 0.0005);
+            ReportSamplesSaved(used, (Integer)((findStop - findStart) *
+                  GmatTimeConstants::SECS_PER_DAY / stepSize) + 1);
+         }
+         else
          {
-            Rvector3 latLongHeight;
-            Real distance;
-            Rvector3 cartesian;
-            Real m = (Real)count / numberLoops; // 0.0 <= m <= 1.0 
-            Real currentTime = findStart + m * (findStop - findStart);
-            if (count == numberLoops)
+            Integer numberLoops = (Integer)((findStop - findStart) * GmatTimeConstants::SECS_PER_DAY / stepSize);
+            for (int count = 0; count <= numberLoops; ++count)
             {
-               currentTime = findStop;
-            }
+               Rvector3 latLongHeight;
+               Real distance;
+               Rvector3 cartesian;
+               Real m = (Real)count / numberLoops; // 0.0 <= m <= 1.0 
+               Real currentTime = findStart + m * (findStop - findStart);
+               if (count == numberLoops)
+               {
+                  currentTime = findStop;
+               }
 
-            isWithinRegion = IsSatWithinRegion(currentTime, latLongHeight, distance);
+               isWithinRegion = IsSatWithinRegion(currentTime, latLongHeight, distance);
 
-            //Handles a change of state either in or out of the region
-            if (isWithinRegion != wasWithinRegion)
-            {
-               Real crossingTime = findStart;
-               if (count > 0)
+               //Handles a change of state either in or out of the region
+               if (isWithinRegion != wasWithinRegion)
                {
-                  crossingTime = InterpolateRegionCrossing(previousTime, currentTime,
-                     isWithinRegion, tolerance, latLongHeight);
-               }
+                  Real crossingTime = findStart;
+                  if (count > 0)
+                  {
+                     crossingTime = InterpolateRegionCrossing(previousTime, currentTime,
+                        isWithinRegion, tolerance, latLongHeight);
+                  }
 
 #ifdef DEBUG_CONTACT_EVENTS
-               // debugging.
-               Real latitude = latLongHeight[0] * GmatMathConstants::DEG_PER_RAD;
-               Real longitude = latLongHeight[1] * GmatMathConstants::DEG_PER_RAD;
-               Real height = latLongHeight[2];
+                  // debugging.
+                  Real latitude = latLongHeight[0] * GmatMathConstants::DEG_PER_RAD;
+                  Real longitude = latLongHeight[1] * GmatMathConstants::DEG_PER_RAD;
+                  Real height = latLongHeight[2];
 
-               if (longitude > 180.0)
-                  longitude -= 360.0;
+                  if (longitude > 180.0)
+                     longitude -= 360.0;
 #endif
-               if (isWithinRegion)
-               {
-                  starts.push_back(crossingTime);
+                  if (isWithinRegion)
+                  {
+                     starts.push_back(crossingTime);
 #ifdef DEBUG_CONTACT_EVENTS
-                  entryLatitudes.push_back(latitude);
-                  entryLongitudes.push_back(longitude);
-                  entryHeights.push_back(height);
+                     entryLatitudes.push_back(latitude);
+                     entryLongitudes.push_back(longitude);
+                     entryHeights.push_back(height);
 #endif
-               }
-               else
-               {
-                  ends.push_back(crossingTime);
+                  }
+                  else
+                  {
+                     ends.push_back(crossingTime);
 #ifdef DEBUG_CONTACT_EVENTS
-                  exitLatitudes.push_back(latitude);
-                  exitLongitudes.push_back(longitude);
-                  exitHeights.push_back(height);
+                     exitLatitudes.push_back(latitude);
+                     exitLongitudes.push_back(longitude);
+                     exitHeights.push_back(height);
 #endif
+                  }
+                  wasWithinRegion = isWithinRegion;
                }
-               wasWithinRegion = isWithinRegion;
+               previousTime = currentTime;
             }
-            previousTime = currentTime;
          }
 
          // Ended within the region
@@ -2842,6 +2872,464 @@ bool ContactLocator::IsSatWithinRegion(Real epoch, Rvector3 & latLongHeight, Rea
    return isWithinRegion;
 }
 
+//------------------------------------------------------------------------------
+// bool CanSearchNatively()
+//------------------------------------------------------------------------------
+/**
+ * Determines if the contacts can be found by EventSearch.  Regions and imager
+ * fields of view are only located through SPICE, so only ground station
+ * observers are searched natively.
+ *
+ * @return true if the native search can be used
+ */
+//------------------------------------------------------------------------------
+bool ContactLocator::CanSearchNatively()
+{
+   if (targetIsRegion)
+      return false;
+   for (UnsignedInt ii = 0; ii < observers.size(); ii++)
+      if (!observers.at(ii) ||
+          (observers.at(ii)->GetType() != Gmat::GROUND_STATION))
+         return false;
+   return EventLocator::CanSearchNatively();
+}
+
+//------------------------------------------------------------------------------
+// void PrepareNativeStations()
+//------------------------------------------------------------------------------
+/**
+ * Samples the stations, the occulting bodies and the Sun over the search
+ * interval, so the searches of the stations only read TrajectoryStores.
+ *
+ * The station axes form the topocentric north-west-up frame of the geodetic
+ * vertical, which is the frame BodyFixedPoint writes to the station FK kernel.
+ */
+//------------------------------------------------------------------------------
+void ContactLocator::PrepareNativeStations()
+{
+   nativeCorrection = EventSearch::ParseCorrection(GetAbcorrString());
+   PrepareTargetTrack(findStart, findStop);
+
+   SampleBodyTrack(solarSys->GetBody(GmatSolarSystemDefaults::SUN_NAME),
+                   findStart, findStop, false, nativeSunTrack);
+
+   Integer numBodies = (Integer) occultingBodies.size();
+   nativeBodyTracks.assign(numBodies, TrajectoryStore());
+   nativeBodyRadii.assign(numBodies, 0.0);
+   for (Integer ii = 0; ii < numBodies; ii++)
+   {
+      SampleBodyTrack(occultingBodies.at(ii), findStart, findStop,
+                      nativeCorrection.lightTime, nativeBodyTracks.at(ii));
+      nativeBodyRadii.at(ii) = occultingBodies.at(ii)->GetEquatorialRadius();
+   }
+
+   CoordinateSystem *mj2000 = em->GetCoordinateSystem();
+   CoordinateConverter converter;
+   Real margin = TRACK_STEP / GmatTimeConstants::SECS_PER_DAY;
+
+   nativeStations.assign(directObservers.size(), NativeStation());
+   for (UnsignedInt jj = 0; jj < directObservers.size(); jj++)
+   {
+      BodyFixedPoint *station = (BodyFixedPoint*) directObservers.at(jj);
+      CelestialBody *central = (CelestialBody*) station->GetCentralBody();
+      NativeStation &data = nativeStations.at(jj);
+
+      data.minElevation = station->GetRealParameter("MinimumElevationAngle") *
+                          GmatMathConstants::RAD_PER_DEG;
+      // The station's central body does not occult it
+      for (Integer ii = 0; ii < numBodies; ii++)
+         if (occultingBodies.at(ii)->GetName() != central->GetName())
+            data.bodies.push_back(ii);
+
+      SampleBodyTrack(station, findStart, findStop, false, data.location);
+
+      Rvector3 latLongHeight = PlanetographicRegion::CartesianToEllipsoid(
+            station->GetBodyFixedLocation(A1Mjd(findStart)),
+            central->GetFlattening(), central->GetEquatorialRadius());
+      Real sinLat = GmatMathUtil::Sin(latLongHeight[0]);
+      Real cosLat = GmatMathUtil::Cos(latLongHeight[0]);
+      Real sinLon = GmatMathUtil::Sin(latLongHeight[1]);
+      Real cosLon = GmatMathUtil::Cos(latLongHeight[1]);
+      Real bfAxes[3][3] =
+      {
+         {-sinLat * cosLon, -sinLat * sinLon, cosLat},     // north
+         { sinLon,          -cosLon,          0.0   },     // west
+         { cosLat * cosLon,  cosLat * sinLon, sinLat}      // up
+      };
+
+      CoordinateSystem *bodyFixed = station->GetBodyFixedCoordinateSystem();
+      for (Integer aa = 0; aa < 3; aa++)
+      {
+         const Real *axis = bfAxes[aa];
+         EventSearch::SampleTrack([&](Real epoch, Real *state)
+         {
+            Real bfState[6] = {axis[0], axis[1], axis[2], 0.0, 0.0, 0.0};
+            converter.Convert(A1Mjd(epoch), bfState, bodyFixed, state, mj2000,
+                              false, true);
+         }, findStart - margin, findStop + margin, TRACK_STEP, data.axes[aa]);
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void FindNativeContacts(std::vector<RealArray> &starts,
+//       std::vector<RealArray> &ends, std::vector<RealArray> &maxElevationTimes)
+//------------------------------------------------------------------------------
+/**
+ * Finds the contact intervals of each station with EventSearch, searching the
+ * stations on separate threads.
+ *
+ * @param starts            The start epochs, per direct observer
+ * @param ends              The end epochs, per direct observer
+ * @param maxElevationTimes The epochs of the highest elevation of each contact
+ */
+//------------------------------------------------------------------------------
+void ContactLocator::FindNativeContacts(std::vector<RealArray> &starts,
+      std::vector<RealArray> &ends, std::vector<RealArray> &maxElevationTimes)
+{
+   PrepareNativeStations();
+
+   Integer numStations = (Integer) nativeStations.size();
+   starts.assign(numStations, RealArray());
+   ends.assign(numStations, RealArray());
+   maxElevationTimes.assign(numStations, RealArray());
+
+   const TrajectoryStore *store = em->GetTrajectoryStore();
+   std::vector<EventSearch::Task> tasks;
+   IntegerArray samples(numStations, 0), fixedSamples(numStations, 0);
+   for (Integer jj = 0; jj < numStations; jj++)
+   {
+      // Keep the light time corrected spacecraft epochs on the recorded span
+      Real first = findStart, last = findStop;
+      if (nativeCorrection.lightTime)
+      {
+         Real edge = (nativeCorrection.transmit ? last : first);
+         Real observer[6], scState[6];
+         nativeStations.at(jj).location.GetState(edge, observer);
+         GetTargetState(edge, scState);
+         Real range = GmatMathUtil::Sqrt(
+               (scState[0] - observer[0]) * (scState[0] - observer[0]) +
+               (scState[1] - observer[1]) * (scState[1] - observer[1]) +
+               (scState[2] - observer[2]) * (scState[2] - observer[2]));
+         Real lightTime = range /
+               (GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM * 0.001) /
+               GmatTimeConstants::SECS_PER_DAY;
+         if (nativeCorrection.transmit)
+         {
+            if (last + lightTime > store->GetEndEpoch())
+               last = store->GetEndEpoch() - lightTime;
+         }
+         else if (first - lightTime < store->GetStartEpoch())
+            first = store->GetStartEpoch() + lightTime;
+      }
+      if (first >= last)
+         continue;
+
+      Real span = (last - first) * GmatTimeConstants::SECS_PER_DAY;
+      fixedSamples.at(jj) = (Integer) GmatMathUtil::Ceiling(span / stepSize) + 1;
+      Real rateBound = (adaptiveStep ? GetElevationRateBound(jj) : 0.0);
+
+      tasks.push_back([this, jj, first, last, rateBound, &starts, &ends,
+                       &maxElevationTimes, &samples, &fixedSamples]()
+      {
+         if (rateBound <= 0.0)
+         {
+            EventSearch::FindIntervals(
+                  [this, jj](Real epoch) { return IsNativeVisible(jj, epoch); },
+                  first, last, stepSize, starts.at(jj), ends.at(jj));
+            samples.at(jj) = fixedSamples.at(jj);
+         }
+         else
+         {
+            // Above the horizon intervals first, then the occultations in them
+            RealArray aboveStarts, aboveEnds;
+            Real minElevation = nativeStations.at(jj).minElevation;
+            samples.at(jj) = EventSearch::FindBoundedIntervals(
+                  [this, jj, minElevation](Real epoch)
+                  { return GetNativeElevation(jj, epoch) - minElevation; },
+                  rateBound, first, last, minimumPassDuration, aboveStarts,
+                  aboveEnds);
+            for (UnsignedInt kk = 0; kk < aboveStarts.size(); kk++)
+            {
+               if (nativeStations.at(jj).bodies.empty())
+               {
+                  starts.at(jj).push_back(aboveStarts.at(kk));
+                  ends.at(jj).push_back(aboveEnds.at(kk));
+                  continue;
+               }
+               EventSearch::FindIntervals(
+                     [this, jj](Real epoch) { return IsNativeVisible(jj, epoch); },
+                     aboveStarts.at(kk), aboveEnds.at(kk), stepSize,
+                     starts.at(jj), ends.at(jj));
+               samples.at(jj) += (Integer) GmatMathUtil::Ceiling(
+                     (aboveEnds.at(kk) - aboveStarts.at(kk)) *
+                     GmatTimeConstants::SECS_PER_DAY / stepSize) + 1;
+            }
+         }
+         for (UnsignedInt kk = 0; kk < starts.at(jj).size(); kk++)
+            maxElevationTimes.at(jj).push_back(EventSearch::FindMaximum(
+                  [this, jj](Real epoch) { return GetNativeElevation(jj, epoch); },
+                  starts.at(jj).at(kk), ends.at(jj).at(kk), stepSize));
+      });
+   }
+   EventSearch::RunTasks(tasks);
+
+   if (adaptiveStep)
+   {
+      Integer used = 0, fixed = 0;
+      for (Integer jj = 0; jj < numStations; jj++)
+      {
+         used  += samples.at(jj);
+         fixed += fixedSamples.at(jj);
+      }
+      ReportSamplesSaved(used, fixed);
+   }
+}
+
+//------------------------------------------------------------------------------
+// Real GetElevationRateBound(Integer index)
+//------------------------------------------------------------------------------
+/**
+ * Bounds the rate of the elevation of the spacecraft from a station.
+ *
+ * The line of sight turns no faster than the relative velocity over the
+ * range, and the topocentric frame turns with the body.  The spacecraft
+ * speed and distance from the station's central body are bounded from the
+ * recorded states by GetMotionBounds().
+ *
+ * @param index The direct observer index of the station
+ *
+ * @return The bound, in radians per second, or 0 if the spacecraft may come
+ *         down to the station's distance from the body center
+ */
+//------------------------------------------------------------------------------
+Real ContactLocator::GetElevationRateBound(Integer index)
+{
+   BodyFixedPoint *station = (BodyFixedPoint*) directObservers.at(index);
+   CelestialBody *central = (CelestialBody*) station->GetCentralBody();
+
+   Real minRadius, maxSpeed;
+   if (!GetMotionBounds(central, findStart, findStop, minRadius, maxSpeed))
+      return 0.0;
+
+   Real stationRadius =
+         station->GetBodyFixedLocation(A1Mjd(findStart)).GetMagnitude();
+   Real spin = central->GetAngularVelocity().GetMagnitude();
+   if (minRadius <= stationRadius)
+      return 0.0;
+
+   return (maxSpeed + spin * stationRadius) / (minRadius - stationRadius) +
+          spin;
+}
+
+//------------------------------------------------------------------------------
+// Real GetRegionRateBound()
+//------------------------------------------------------------------------------
+/**
+ * Bounds the speed of the sub-satellite point over the region's central body,
+ * which bounds the rate of the distance to the region boundary.
+ *
+ * @return The bound, in km/s, or 0 if there are no recorded states
+ */
+//------------------------------------------------------------------------------
+Real ContactLocator::GetRegionRateBound()
+{
+   CelestialBody *central = (CelestialBody*) region->GetCentralBody();
+
+   Real minRadius, maxSpeed;
+   if (!GetMotionBounds(central, findStart, findStop, minRadius, maxSpeed))
+      return 0.0;
+
+   Real spin = central->GetAngularVelocity().GetMagnitude();
+   return central->GetEquatorialRadius() * (maxSpeed / minRadius + spin);
+}
+
+//------------------------------------------------------------------------------
+// void ReportSamplesSaved(Integer used, Integer fixed)
+//------------------------------------------------------------------------------
+/**
+ * Writes the number of evaluations of the event functions the adaptive step
+ * saved over fixed steps of StepSize.
+ *
+ * @param used  The evaluations made, not counting the bisection
+ * @param fixed The evaluations fixed steps would have made
+ */
+//------------------------------------------------------------------------------
+void ContactLocator::ReportSamplesSaved(Integer used, Integer fixed)
+{
+   MessageInterface::ShowMessage("%s: the adaptive search made %d evaluations "
+         "where the fixed step would make %d, saving %d\n",
+         instanceName.c_str(), used, fixed, fixed - used);
+}
+
+//------------------------------------------------------------------------------
+// void GetNativeObservation(Integer index, Real epoch, Real *observer,
+//                           Real *velocity, Real *lineOfSight) const
+//------------------------------------------------------------------------------
+/**
+ * Computes the apparent position of the spacecraft from a station.
+ *
+ * @param index       The direct observer index of the station
+ * @param epoch       The epoch of the observation
+ * @param observer    The MJ2000Eq state of the station
+ * @param velocity    The velocity of the station relative to the Sun
+ * @param lineOfSight The apparent position of the spacecraft
+ */
+//------------------------------------------------------------------------------
+void ContactLocator::GetNativeObservation(Integer index, Real epoch,
+      Real *observer, Real *velocity, Real *lineOfSight) const
+{
+   Real sunState[6];
+   nativeStations.at(index).location.GetState(epoch, observer);
+   nativeSunTrack.GetState(epoch, sunState);
+   for (Integer kk = 0; kk < 3; kk++)
+      velocity[kk] = observer[kk+3] - sunState[kk+3];
+
+   EventSearch::GetApparentPosition(
+         [this](Real ep, Real *state) { GetTargetState(ep, state); },
+         epoch, observer, velocity, nativeCorrection, lineOfSight);
+}
+
+//------------------------------------------------------------------------------
+// void GetNativeTopocentric(Integer index, Real epoch,
+//                           const Real *lineOfSight, Real *topocentric) const
+//------------------------------------------------------------------------------
+/**
+ * Rotates a MJ2000Eq vector into the north-west-up frame of a station.
+ *
+ * @param index       The direct observer index of the station
+ * @param epoch       The epoch of the vector
+ * @param lineOfSight The MJ2000Eq vector
+ * @param topocentric The topocentric vector
+ */
+//------------------------------------------------------------------------------
+void ContactLocator::GetNativeTopocentric(Integer index, Real epoch,
+      const Real *lineOfSight, Real *topocentric) const
+{
+   Real axis[6];
+   for (Integer aa = 0; aa < 3; aa++)
+   {
+      nativeStations.at(index).axes[aa].GetState(epoch, axis);
+      topocentric[aa] = axis[0] * lineOfSight[0] + axis[1] * lineOfSight[1] +
+                        axis[2] * lineOfSight[2];
+   }
+}
+
+//------------------------------------------------------------------------------
+// bool IsNativeVisible(Integer index, Real epoch) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the spacecraft is above the minimum elevation of a station, and
+ * not occulted by any of the bodies that can block it.
+ *
+ * @param index The direct observer index of the station
+ * @param epoch The epoch checked
+ *
+ * @return true while the station is in contact
+ */
+//------------------------------------------------------------------------------
+bool ContactLocator::IsNativeVisible(Integer index, Real epoch) const
+{
+   const NativeStation &station = nativeStations.at(index);
+   Real observer[6], velocity[3], lineOfSight[3], topocentric[3];
+   GetNativeObservation(index, epoch, observer, velocity, lineOfSight);
+   GetNativeTopocentric(index, epoch, lineOfSight, topocentric);
+
+   Real range = GmatMathUtil::Sqrt(topocentric[0] * topocentric[0] +
+         topocentric[1] * topocentric[1] + topocentric[2] * topocentric[2]);
+   if ((range == 0.0) ||
+       (GmatMathUtil::ASin(topocentric[2] / range) <= station.minElevation))
+      return false;
+
+   for (UnsignedInt ii = 0; ii < station.bodies.size(); ii++)
+   {
+      Integer body = station.bodies.at(ii);
+      const TrajectoryStore &track = nativeBodyTracks.at(body);
+      Real front[3];
+      EventSearch::GetApparentPosition(
+            [&track](Real ep, Real *state) { track.GetState(ep, state); },
+            epoch, observer, velocity, nativeCorrection, front);
+      if (EventSearch::IsOcculted(front, nativeBodyRadii.at(body),
+                                  lineOfSight))
+         return false;
+   }
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Real GetNativeElevation(Integer index, Real epoch) const
+//------------------------------------------------------------------------------
+/**
+ * Computes the elevation of the spacecraft from a station.
+ *
+ * @param index The direct observer index of the station
+ * @param epoch The epoch of the observation
+ *
+ * @return The elevation, in radians
+ */
+//------------------------------------------------------------------------------
+Real ContactLocator::GetNativeElevation(Integer index, Real epoch) const
+{
+   Real observer[6], velocity[3], lineOfSight[3], topocentric[3];
+   GetNativeObservation(index, epoch, observer, velocity, lineOfSight);
+   GetNativeTopocentric(index, epoch, lineOfSight, topocentric);
+   return GmatMathUtil::ATan(topocentric[2], GmatMathUtil::Sqrt(
+         topocentric[0] * topocentric[0] + topocentric[1] * topocentric[1]));
+}
+
+//------------------------------------------------------------------------------
+// void GetRangeAzEl(Integer index, Real epoch, Integer obsNaifId,
+//                   const std::string &obsFrame, const std::string &abcorr,
+//                   Real &range, Real &azimuth, Real &elevation)
+//------------------------------------------------------------------------------
+/**
+ * Computes the range, azimuth and elevation of the spacecraft from a station,
+ * from the native search data when it was used, or else through CSPICE.
+ *
+ * @param index     The direct observer index of the station
+ * @param epoch     The epoch of the observation
+ * @param obsNaifId The NAIF ID of the station
+ * @param obsFrame  The SPICE frame of the station
+ * @param abcorr    The aberration correction
+ * @param range     The range (km)
+ * @param azimuth   The azimuth, in [0, 2 pi) radians
+ * @param elevation The elevation, in radians
+ */
+//------------------------------------------------------------------------------
+void ContactLocator::GetRangeAzEl(Integer index, Real epoch, Integer obsNaifId,
+                                  const std::string &obsFrame,
+                                  const std::string &abcorr, Real &range,
+                                  Real &azimuth, Real &elevation)
+{
+   if (!nativeStations.empty())
+   {
+      Real observer[6], velocity[3], lineOfSight[3], topo[3];
+      GetNativeObservation(index, epoch, observer, velocity, lineOfSight);
+      GetNativeTopocentric(index, epoch, lineOfSight, topo);
+      Real horizontal = GmatMathUtil::Sqrt(topo[0] * topo[0] +
+                                           topo[1] * topo[1]);
+      range     = GmatMathUtil::Sqrt(horizontal * horizontal +
+                                     topo[2] * topo[2]);
+      azimuth   = GmatMathUtil::ATan(topo[1], topo[0]);
+      elevation = GmatMathUtil::ATan(topo[2], horizontal);
+   }
+   else
+   {
+      SpiceDouble position[3];
+      em->GetTargetPosition(sat->GetIntegerParameter("NAIFId"), epoch,
+                            obsFrame.c_str(), abcorr.c_str(), obsNaifId,
+                            position);
+      // Move this to Ephem Manager
+      reclat_c(position, &range, &azimuth, &elevation);
+   }
+
+   azimuth = -azimuth;
+   if (azimuth < 0)
+   {
+      azimuth = 2 * GmatMathConstants::PI + azimuth;
+   }
+}
+
 //------------------------------------------------------------------------------
 // std::string GetAbcorrString()
 //------------------------------------------------------------------------------
@@ -40,6 +40,7 @@
 #include "EventLocatorDefs.hpp"
 #include "ContactResult.hpp"
 #include "Imager.hpp"
+#include "EventSearch.hpp"
 
 
 /**
@@ -190,9 +191,36 @@ protected:
    std::string reportTimeFormat = "UTCGregorian";
    /// The report format template
    std::string reportTemplateFormat = "Legacy";
+   /// Step by a bound on the rate of the event function instead of StepSize
+   bool adaptiveStep = false;
+   /// The shortest pass the adaptive search is sure to find, in seconds
+   Real minimumPassDuration = 60.0;
    // The stored results
    std::vector<ContactResult*> contactResults;
 
+   /// The samples of a ground station used by the native search
+   struct NativeStation
+   {
+      /// MJ2000Eq state of the station
+      TrajectoryStore         location;
+      /// The topocentric north, west and up axes, with their rates
+      TrajectoryStore         axes[3];
+      /// Minimum elevation angle, in radians
+      Real                    minElevation;
+      /// Indices of the occulting bodies that can block the station
+      IntegerArray            bodies;
+   };
+   /// The stations of the native search, one per direct observer
+   std::vector<NativeStation>   nativeStations;
+   /// MJ2000Eq states of the occulting bodies for the native search
+   std::vector<TrajectoryStore> nativeBodyTracks;
+   /// Radii of the occulting bodies for the native search
+   RealArray                    nativeBodyRadii;
+   /// MJ2000Eq state of the Sun, for the stellar aberration
+   TrajectoryStore              nativeSunTrack;
+   /// Corrections applied by the native search
+   EventSearch::Correction      nativeCorrection;
+
 
    ////From Intrusion Locator
 
@@ -218,6 +246,8 @@ protected:
       REPORT_TEMPLATE_FORMAT,
       INTERVAL_STEP,
       REPORT_TIME_FORMAT,
+      ADAPTIVE_STEP,
+      MINIMUM_PASS_DURATION,
       ContactLocatorParamCount
     };
 
@@ -231,6 +261,27 @@ protected:
     static const std::string LT_DIRECTIONS[2];
 
     virtual void         FindEvents();
+    virtual bool         CanSearchNatively();
+
+    void         PrepareNativeStations();
+    void         FindNativeContacts(std::vector<RealArray> &starts,
+                                    std::vector<RealArray> &ends,
+                                    std::vector<RealArray> &maxElevationTimes);
+    void         GetNativeObservation(Integer index, Real epoch,
+                                      Real *observer, Real *velocity,
+                                      Real *lineOfSight) const;
+    void         GetNativeTopocentric(Integer index, Real epoch,
+                                      const Real *lineOfSight,
+                                      Real *topocentric) const;
+    bool         IsNativeVisible(Integer index, Real epoch) const;
+    Real         GetNativeElevation(Integer index, Real epoch) const;
+    Real         GetElevationRateBound(Integer index);
+    Real         GetRegionRateBound();
+    void         ReportSamplesSaved(Integer used, Integer fixed);
+    void         GetRangeAzEl(Integer index, Real epoch, Integer obsNaifId,
+                              const std::string &obsFrame,
+                              const std::string &abcorr, Real &range,
+                              Real &azimuth, Real &elevation);
 
     Real         InterpolateRegionCrossing(Real low, Real high, bool isWithin, Real tolerance, Rvector3 & latLongHeight);
 
@@ -42,6 +42,7 @@
 #include "EphemManager.hpp"
 #include "EclipseEvent.hpp"
 #include "StringUtil.hpp"
+#include "EventSearch.hpp"
 
 
 //#define DEBUG_TYPELIST
@@ -254,11 +255,12 @@ std::string EclipseLocator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer EclipseLocator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EventLocatorParamCount; i < EclipseLocatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - EventLocatorParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, EventLocatorParamCount,
+               EclipseLocatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return EventLocator::GetParameterID(str);
 }
@@ -897,39 +899,44 @@ void EclipseLocator::FindEvents()
    #ifdef DEBUG_TIME_SPENT
    t = clock();
    #endif
-   for (Integer ii = 0; ii < occultingBodies.size(); ii++)
+   if (UseNativeSearch())
+      FindNativeEvents(rawList);
+   else
    {
-      CelestialBody *body = (CelestialBody*) occultingBodies.at(ii);
-      Integer bodyNaifId  = body->GetIntegerParameter(body->GetParameterID(
-                                                      "NAIFId"));
-      theFront  = GmatStringUtil::Trim(GmatStringUtil::ToString(bodyNaifId));
-      bodyName  = body->GetName();
-      theFFrame = body->GetStringParameter(
-                        body->GetParameterID("SpiceFrameId"));
-
-      for (Integer jj = 0; jj < eclipseTypes.size(); jj++)
+      for (Integer ii = 0; ii < occultingBodies.size(); ii++)
       {
-         starts.clear();
-         ends.clear();
-
-         em->GetOccultationIntervals(eclipseTypes.at(jj), theFront, theFShape,
-                                     theFFrame, theBack, theBShape, theBFrame,
-                                     theAbCorr, initialEp, finalEp,
-                                     useEntireInterval, stepSize,
-                                     numEclipse, starts, ends);
-
-         #ifdef DEBUG_ECLIPSE_FIND_EVENTS
-//            MessageInterface::ShowMessage("After gfoclt_c:\n");
-//            MessageInterface::ShowMessage("  numEclipse = %d\n", numEclipse);
-         #endif
-         // Create an event from the result
-         for (Integer kk = 0; kk < numEclipse; kk++)
+         CelestialBody *body = (CelestialBody*) occultingBodies.at(ii);
+         Integer bodyNaifId  = body->GetIntegerParameter(body->GetParameterID(
+                                                         "NAIFId"));
+         theFront  = GmatStringUtil::Trim(GmatStringUtil::ToString(bodyNaifId));
+         bodyName  = body->GetName();
+         theFFrame = body->GetStringParameter(
+                           body->GetParameterID("SpiceFrameId"));
+
+         for (Integer jj = 0; jj < eclipseTypes.size(); jj++)
          {
-            Real s1 = starts.at(kk);
-            Real e1 = ends.at(kk);
-            EclipseEvent *newEvent = new EclipseEvent(s1, e1,
-                                         eclipseTypes.at(jj), bodyName);
-            rawList->AddEvent(newEvent);
+            starts.clear();
+            ends.clear();
+
+            em->GetOccultationIntervals(eclipseTypes.at(jj), theFront, theFShape,
+                                        theFFrame, theBack, theBShape, theBFrame,
+                                        theAbCorr, initialEp, finalEp,
+                                        useEntireInterval, stepSize,
+                                        numEclipse, starts, ends);
+
+            #ifdef DEBUG_ECLIPSE_FIND_EVENTS
+//               MessageInterface::ShowMessage("After gfoclt_c:\n");
+//               MessageInterface::ShowMessage("  numEclipse = %d\n", numEclipse);
+            #endif
+            // Create an event from the result
+            for (Integer kk = 0; kk < numEclipse; kk++)
+            {
+               Real s1 = starts.at(kk);
+               Real e1 = ends.at(kk);
+               EclipseEvent *newEvent = new EclipseEvent(s1, e1,
+                                            eclipseTypes.at(jj), bodyName);
+               rawList->AddEvent(newEvent);
+            }
          }
       }
    }
@@ -1111,6 +1118,97 @@ void EclipseLocator::FindEvents()
 //   delete rawList;
 }
 
+//------------------------------------------------------------------------------
+// void FindNativeEvents(EclipseTotalEvent *rawList)
+//------------------------------------------------------------------------------
+/**
+ * Finds the eclipse intervals with EventSearch on the in-memory trajectory.
+ *
+ * The Sun and the occulting bodies are sampled first; the search of each
+ * body and eclipse type then runs as a separate task, and the events are
+ * added in the order of the SPICE search.
+ *
+ * @param rawList The list receiving the unsorted events
+ */
+//------------------------------------------------------------------------------
+void EclipseLocator::FindNativeEvents(EclipseTotalEvent *rawList)
+{
+   PrepareTargetTrack(findStart, findStop);
+   EventSearch::Correction correction =
+         EventSearch::ParseCorrection(GetAbcorrString());
+
+   TrajectoryStore sunTrack;
+   SampleBodyTrack(sun, findStart, findStop, correction.lightTime, sunTrack);
+   Real sunRadius = sun->GetEquatorialRadius();
+
+   Integer numBodies = (Integer) occultingBodies.size();
+   Integer numTypes  = (Integer) eclipseTypes.size();
+   std::vector<TrajectoryStore> bodyTracks(numBodies);
+   RealArray radii(numBodies);
+   for (Integer ii = 0; ii < numBodies; ii++)
+   {
+      SampleBodyTrack(occultingBodies.at(ii), findStart, findStop,
+                      correction.lightTime, bodyTracks.at(ii));
+      radii.at(ii) = occultingBodies.at(ii)->GetEquatorialRadius();
+   }
+
+   std::vector<RealArray> starts(numBodies * numTypes);
+   std::vector<RealArray> ends(numBodies * numTypes);
+   std::vector<EventSearch::Task> tasks;
+   for (Integer ii = 0; ii < numBodies; ii++)
+   {
+      for (Integer jj = 0; jj < numTypes; jj++)
+      {
+         EventSearch::OccultationType wanted = EventSearch::ANNULAR_OCCULTATION;
+         if (eclipseTypes.at(jj) == "Umbra")
+            wanted = EventSearch::FULL_OCCULTATION;
+         else if (eclipseTypes.at(jj) == "Penumbra")
+            wanted = EventSearch::PARTIAL_OCCULTATION;
+
+         const TrajectoryStore *bodyTrack = &bodyTracks.at(ii);
+         Real    radius = radii.at(ii);
+         Integer slot   = ii * numTypes + jj;
+         tasks.push_back([=, &sunTrack, &starts, &ends]()
+         {
+            EventSearch::StateSource bodySource =
+                  [bodyTrack](Real epoch, Real *state)
+                  { bodyTrack->GetState(epoch, state); };
+            EventSearch::StateSource sunSource =
+                  [&sunTrack](Real epoch, Real *state)
+                  { sunTrack.GetState(epoch, state); };
+
+            EventSearch::FindIntervals([&](Real epoch)
+            {
+               Real scState[6], sunState[6], velocity[3], front[3], back[3];
+               GetTargetState(epoch, scState);
+               sunTrack.GetState(epoch, sunState);
+               for (Integer kk = 0; kk < 3; kk++)
+                  velocity[kk] = scState[kk+3] - sunState[kk+3];
+               EventSearch::GetApparentPosition(bodySource, epoch, scState,
+                                                velocity, correction, front);
+               EventSearch::GetApparentPosition(sunSource, epoch, scState,
+                                                velocity, correction, back);
+               return (EventSearch::GetOccultation(front, radius, back,
+                                                   sunRadius) == wanted);
+            }, findStart, findStop, stepSize, starts.at(slot), ends.at(slot));
+         });
+      }
+   }
+   EventSearch::RunTasks(tasks);
+
+   for (Integer ii = 0; ii < numBodies; ii++)
+   {
+      std::string bodyName = occultingBodies.at(ii)->GetName();
+      for (Integer jj = 0; jj < numTypes; jj++)
+      {
+         Integer slot = ii * numTypes + jj;
+         for (UnsignedInt kk = 0; kk < starts.at(slot).size(); kk++)
+            rawList->AddEvent(new EclipseEvent(starts.at(slot).at(kk),
+                  ends.at(slot).at(kk), eclipseTypes.at(jj), bodyName));
+      }
+   }
+}
+
 //------------------------------------------------------------------------------
 // std::vector<EclipseTotalEvent*> GetNestedEvents(Integer idx,
 //                                                 EclipseTotalEvent *inEvent)
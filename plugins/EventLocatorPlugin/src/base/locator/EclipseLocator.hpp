@@ -130,6 +130,7 @@ protected:
     PARAMETER_TYPE[EclipseLocatorParamCount - EventLocatorParamCount];
 
    virtual void FindEvents();
+   void         FindNativeEvents(EclipseTotalEvent *rawList);
    virtual std::vector<EclipseTotalEvent*> GetNestedEvents(Integer idx,
                                            EclipseTotalEvent *inEvent);
 
@@ -317,11 +317,12 @@ std::string IntrusionLocator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer IntrusionLocator::GetParameterID(const std::string & str) const
 {
-   for (Integer i = EventLocatorParamCount; i < IntrusionLocatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - EventLocatorParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, EventLocatorParamCount,
+               IntrusionLocatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return EventLocator::GetParameterID(str);
 }
@@ -1617,6 +1618,8 @@ bool IntrusionLocator::ReportEventData(const std::string &reportNotice)
 //------------------------------------------------------------------------------
 void IntrusionLocator::FindEvents()
 {
+   SpiceInterface::AccessLock spiceLock;
+
    // Clear old events
    TakeAction("Clear", "Events");
 
@@ -1786,6 +1789,8 @@ void IntrusionLocator::WriteFixedGridSPK(const std::string &sensorName,
    const std::string &frameName, const Integer centerID, const Integer gridId,
    const RealArray gridPosition)
 {
+   SpiceInterface::AccessLock spiceLock;
+
    // Get the time (seconds since January 1, 1970), to make the temporary file name unique
    std::string now = GmatTimeUtil::FormatCurrentTime(4);
    std::string kernelBaseName = GmatFileUtil::GetTemporaryDirectory() + "tmp_" + sensorName;
@@ -1898,3 +1903,18 @@ void IntrusionLocator::WriteFixedGridSPK(const std::string &sensorName,
 
    delete[] stateArray;
 }
+
+//------------------------------------------------------------------------------
+// bool CanSearchNatively()
+//------------------------------------------------------------------------------
+/**
+ * Intrusions are only located through SPICE, which reads the recorded orbit
+ * from an SPK kernel.
+ *
+ * @return false
+ */
+//------------------------------------------------------------------------------
+bool IntrusionLocator::CanSearchNatively()
+{
+   return false;
+}
@@ -189,6 +189,7 @@ protected:
       PARAMETER_TYPE[IntrusionLocatorParamCount - EventLocatorParamCount];
 
    virtual void         FindEvents();
+   virtual bool         CanSearchNatively();
 };
 
 #endif /* IntrusionLocator_hpp */
@@ -180,6 +180,7 @@ void ExtendedKalmanFilter::CompleteInitialization()
    I = Rmatrix::Identity(stateSize);
 
    sqrtPupdate.SetSize(stateSize, stateSize);
+   SizeUpdateArrays(measSize);
    if (!sqrtP.IsSized())
    {
       sqrtP.SetSize(stateSize, stateSize);
@@ -195,8 +196,8 @@ void ExtendedKalmanFilter::CompleteInitialization()
 
    Rmatrix outSqrtCov = sqrtP;
    SqrtCovarianceEpsilonConversion(outSqrtCov);
-   updateStats[0].sqrtCov.SetSize(outSqrtCov.GetNumRows(), outSqrtCov.GetNumColumns());
-   updateStats[0].sqrtCov = outSqrtCov;
+   updateStats.back().sqrtCov.SetSize(outSqrtCov.GetNumRows(), outSqrtCov.GetNumColumns());
+   updateStats.back().sqrtCov = outSqrtCov;
 
    prevUpdateEpochGT = currentEpochGT;
 }
@@ -365,6 +366,7 @@ void ExtendedKalmanFilter::FilterUpdate()
          if (!(isPredicting && !hasAnchorEpoch))
          {
             WriteDataFile();
+            WriteCheckpoint();
             AddMatlabFilterData(updateStat);
             updateStats.push_back(updateStat);
          }
@@ -419,7 +421,10 @@ void ExtendedKalmanFilter::TimeUpdate()
    Rmatrix dX_dS = cart2SolvMatrixPrev;
    Rmatrix dS_dX = cart2SolvMatrix.Inverse();
 
-   Rmatrix Q_S = dS_dX * Q * dS_dX.Transpose();
+   // Q_S = dS_dX * Q * dS_dX^T, taken block by block: only the noise of the
+   // converted states changes
+   Rmatrix Q_S = Q;
+   TransformCovariance(Q_S, cart2SolvMatrix, true);
 
 
 #ifdef DEBUG_ESTIMATION_COVARIACE_PROP
@@ -636,6 +641,7 @@ void ExtendedKalmanFilter::SetupMeas()
       H.SetSize(measSize, stateSize);
       yi.SetSize(measSize);
       kalman.SetSize(stateSize, measSize);
+      SizeUpdateArrays(measSize);
    }
 
    /// Calculate conversion derivative matrixes
@@ -646,6 +652,29 @@ void ExtendedKalmanFilter::SetupMeas()
 }
 
 
+//------------------------------------------------------------------------------
+// void SizeUpdateArrays(UnsignedInt size)
+//------------------------------------------------------------------------------
+/**
+ * Sizes the work arrays used in the measurement update
+ *
+ * The arrays are only reallocated when the measurement or state size changes,
+ * so consecutive measurements of the same type reuse them.
+ *
+ * @param size The number of elements in the measurement
+ */
+//------------------------------------------------------------------------------
+void ExtendedKalmanFilter::SizeUpdateArrays(UnsignedInt size)
+{
+   Integer arraySize = size + stateSize;
+
+   if ((sqrtRT.GetNumRows() != (Integer)size) || !sqrtRT.IsSized())
+      sqrtRT.SetSize(size, size);
+   if ((updateArray.GetNumRows() != arraySize) || !updateArray.IsSized())
+      updateArray.SetSize(arraySize, arraySize);
+}
+
+
 //------------------------------------------------------------------------------
 // void ComputeObs(UpdateInfoType &updateStat)
 //------------------------------------------------------------------------------
@@ -692,9 +721,9 @@ void ExtendedKalmanFilter::ComputeObs(UpdateInfoType &updateStat)
       // measStat.scaledResid = GmatMathUtil::Sqrt(yi * (H * pBar * H.Transpose() + R).Inverse() * yi);
 
       // The element-by-element scaled residual calculation:
+      Rmatrix Rbar = H * pBar * H.Transpose() + R;
       for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
       {
-         Rmatrix Rbar = H * pBar * H.Transpose() + R;
          Real sigmaVal = GmatMathUtil::Sqrt(Rbar(k, k));
          Real scaledResid = measStat.residual[k] / sigmaVal;
          measStat.scaledResid.push_back(scaledResid);
@@ -780,24 +809,58 @@ void ExtendedKalmanFilter::ComputeGain(UpdateInfoType &updateStat)
             updateStat.measStat.recNum, updateStat.measStat.type.c_str(), utcEpoch.c_str(), posCovTraceSqrt);
       }
 
-      // Perform thinQR decomposition to calculate K and P
+      // Triangularize the square root update array to calculate K and P
       Rmatrix R = *(GetMeasurementCovariance()->GetCovariance());
       Integer measSize = R.GetNumRows();
+      Integer arraySize = measSize + stateSize;
+
+      SizeUpdateArrays(measSize);
+      cf.Factor(R, sqrtRT);
+
+      // Fill the transpose of the pre-array
+      //
+      //    [ Sr  sqrtScale H Spbar ]
+      //    [ 0               Spbar ]
+      //
+      // so that its upper triangular form is the transposed post-array
+      const Real *h = H.GetDataVector();
+      const Real *s = sqrtP.GetDataVector();
+      Real *a = (Real*)updateArray.GetDataVector();
+
+      for (Integer i = 0; i < arraySize * arraySize; ++i)
+         a[i] = 0.0;
 
-      Rmatrix sqrtR_T(measSize, measSize);
-      cf.Factor(R, sqrtR_T);
+      for (Integer i = 0; i < measSize; ++i)
+         for (Integer j = i; j < measSize; ++j)
+            a[i * arraySize + j] = sqrtRT(i, j);
 
-      Rmatrix Spbar = sqrtP;
-      Rmatrix Sr = sqrtR_T.Transpose();
-      Rmatrix Sw = thinQR(sqrtScale*H*Spbar, Sr);
+      for (UnsignedInt r = 0; r < stateSize; ++r)
+      {
+         Real *row = a + (measSize + r) * arraySize;
+
+         // Spbar is lower triangular, so only rows k >= r contribute
+         for (Integer j = 0; j < measSize; ++j)
+         {
+            Real sum = 0.0;
+            for (UnsignedInt k = r; k < stateSize; ++k)
+               sum += h[j * stateSize + k] * s[k * stateSize + r];
+            row[j] = sqrtScale * sum;
+         }
+
+         for (UnsignedInt c = r; c < stateSize; ++c)
+            row[measSize + c] = s[c * stateSize + r];
+      }
+
+      qr.Triangularize(updateArray);
 
       #ifdef DEBUG_ESTIMATION
          MessageInterface::ShowMessage("Sw = \n");
-         for (UnsignedInt i = 0; i < Sw.GetNumRows(); ++i)
+         for (Integer i = 0; i < measSize; ++i)
          {
-           for (UnsignedInt j = 0; j < Sw.GetNumColumns(); ++j)
+           for (Integer j = 0; j < measSize; ++j)
            {
-             MessageInterface::ShowMessage("  %.12le", Sw(i,j));
+             MessageInterface::ShowMessage("  %.12le",
+                   (j <= i ? updateArray(j, i) : 0.0));
            }
            MessageInterface::ShowMessage("\n");
          }
@@ -807,8 +870,34 @@ void ExtendedKalmanFilter::ComputeGain(UpdateInfoType &updateStat)
          MessageInterface::ShowMessage("Calculating the Kalman gain\n");
       #endif
 
-      kalman = Spbar * Spbar.Transpose() * H.Transpose() * (Sw*Sw.Transpose()).Inverse();
-      sqrtPupdate = thinQR((I - kalman * H) * Spbar, kalman*Sr);
+      // The post-array is [Sw 0; Kbar Sp], with Sw(i,j) = U(j,i) and
+      // Kbar(r,j) = U(j, m+r).  Solve K Sw = Kbar / sqrtScale for all of the
+      // measurement elements at once, by back substitution on Sw.
+      for (UnsignedInt r = 0; r < stateSize; ++r)
+      {
+         for (Integer j = measSize - 1; j >= 0; --j)
+         {
+            Real sum = a[j * arraySize + measSize + r] / sqrtScale;
+            for (Integer i = j + 1; i < measSize; ++i)
+               sum -= kalman(r, i) * a[j * arraySize + i];
+            kalman(r, j) = sum / a[j * arraySize + j];
+         }
+      }
+
+      if (sqrtScale == 1.0)
+      {
+         // The optimal gain was used, so Sp(r,c) = U(m+c, m+r) is the update
+         for (UnsignedInt r = 0; r < stateSize; ++r)
+            for (UnsignedInt c = 0; c < stateSize; ++c)
+               sqrtPupdate(r, c) = (c <= r ?
+                     a[(measSize + c) * arraySize + measSize + r] : 0.0);
+      }
+      else
+      {
+         // The underweighted gain is not optimal; use the Bucy-Joseph form
+         Rmatrix Sr = sqrtRT.Transpose();
+         sqrtPupdate = thinQR((I - kalman * H) * sqrtP, kalman*Sr);
+      }
 
       updateStat.measStat.kalmanGain.SetSize(kalman.GetNumRows(), kalman.GetNumColumns());
       updateStat.measStat.kalmanGain = kalman;
@@ -1062,13 +1151,16 @@ std::string ExtendedKalmanFilter::DataFileCovHeader() const
 
 
 //------------------------------------------------------------------------------
-// void WriteCovarianceToDataFile()
+// void GetCovarianceRecord(RealArray &record)
 //----------------------------------------------------------------------
 /**
- * Writes the covariance to the data file in factorized form
+ * Appends the covariance columns of a data record in factorized form
+ *
+ * @param record The record the lower triangle of the Cartesian square root
+ *               covariance is appended to
  */
  //------------------------------------------------------------------------------
-void ExtendedKalmanFilter::WriteCovarianceToDataFile()
+void ExtendedKalmanFilter::GetCovarianceRecord(RealArray &record)
 {
    if (!sqrtP.IsSized())
    {
@@ -1110,24 +1202,20 @@ void ExtendedKalmanFilter::WriteCovarianceToDataFile()
       sqrtPOut = sqrtPOut.Transpose();
    }
 
-   // Write covariance lower triangle
+   // Covariance lower triangle
    for (UnsignedInt ii = 0; ii < stateSize; ii++)
    {
       Real conv = GetEpsilonConversion(ii);
       for (UnsignedInt jj = 0; jj <= ii; jj++)
-      {
-         Real value = sqrtPOut(ii, jj) * conv;
-
-         std::string valueStr = GmatStringUtil::RealToString(value, false, true, true);
-         dataFile << "," << valueStr;
-      }
+         record.push_back(sqrtPOut(ii, jj) * conv);
    }
 }
 
 
 //------------------------------------------------------------------------------
-// void ReadCovarianceFromDataFile(StringArray header, StringArray restartData,
-//                                 UnsignedInt firstStateIndex, IntegerArray stateColumnNum)
+// void ReadCovarianceFromDataFile(const StringArray &header,
+//       const RealArray &restartData, UnsignedInt firstStateIndex,
+//       IntegerArray stateColumnNum)
 //----------------------------------------------------------------------
 /**
  * Reads the covariance from the data file
@@ -1138,7 +1226,7 @@ void ExtendedKalmanFilter::WriteCovarianceToDataFile()
  * @param stateColumnNum The maping of the solve for states to the restart file states.
  */
  //------------------------------------------------------------------------------
-void ExtendedKalmanFilter::ReadCovarianceFromDataFile(StringArray header, StringArray restartData,
+void ExtendedKalmanFilter::ReadCovarianceFromDataFile(const StringArray &header, const RealArray &restartData,
                                                       UnsignedInt firstStateIndex, IntegerArray stateColumnNum)
 {
    // Find column of first covariance element
@@ -1181,10 +1269,7 @@ void ExtendedKalmanFilter::ReadCovarianceFromDataFile(StringArray header, String
    {
       for (UnsignedInt jj = 0; jj <= ii; jj++)
       {
-         Real value;
-         GmatStringUtil::ToReal(restartData[index], value);
-         fileCov(ii, jj) = value;
-
+         fileCov(ii, jj) = restartData[index];
          index++;
       }
    }
@@ -53,8 +53,19 @@
  *    P = (I - K Htilde) Pbar
  *
  * or using the form derived by Bucy and Joseph (equation 4.7.19 on page 205).
- * This choice is made at compile time in the UpdateElements() method.  The
- * current default selection is the Bucy-Joseph update.
+ * This choice is made at compile time in the UpdateElements() method.
+ *
+ * 3.  By default the covariance is carried as its square root.  The
+ * measurement update triangularizes the array
+ *
+ *    [ Sr  H Spbar ]                [ Sw    0  ]
+ *    [ 0     Spbar ]   Q   =        [ Kbar  Sp ]
+ *
+ * in place, which gives the square root of the innovation covariance, the
+ * gain K = Kbar Sw^-1 (by back substitution, with no inverse) and the updated
+ * square root covariance Sp together, for every element of the measurement.
+ * When Lear's underweighting is applied the gain is not optimal, and the
+ * square root of the Bucy-Joseph form is used for the covariance instead.
  */
 class KALMAN_API ExtendedKalmanFilter : public SeqEstimator
 {
@@ -76,6 +87,10 @@ protected:
    // Factorization variables
    Rmatrix                 sqrtP;
    Rmatrix                 sqrtPupdate;
+   /// Upper triangular Cholesky factor of the measurement covariance
+   Rmatrix                 sqrtRT;
+   /// Transposed pre-array of the square root measurement update
+   Rmatrix                 updateArray;
 
    virtual void            CompleteInitialization();
    virtual void            Estimate();
@@ -85,8 +100,8 @@ protected:
    virtual void            TimeUpdate();
 
    virtual std::string     DataFileCovHeader() const;
-   virtual void            WriteCovarianceToDataFile();
-   virtual void            ReadCovarianceFromDataFile(StringArray header, StringArray restartData,
+   virtual void            GetCovarianceRecord(RealArray &record);
+   virtual void            ReadCovarianceFromDataFile(const StringArray &header, const RealArray &restartData,
                                                       UnsignedInt firstStateIndex, IntegerArray stateColumnNum);
    virtual void            UpdateCovarianceNominalValues(RealArray prevEpsilonConversions);
 
@@ -100,6 +115,7 @@ private:
    void                    ComputeObs(UpdateInfoType &updateStat);
    void                    ComputeGain(UpdateInfoType &updateStat);
    void                    UpdateElements(UpdateInfoType &updateStat);
+   void                    SizeUpdateArrays(UnsignedInt size);
    void                    AdvanceEpoch();
 
    void                    UpdateCovarianceSimple();
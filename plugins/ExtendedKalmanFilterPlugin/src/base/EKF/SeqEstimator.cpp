@@ -47,16 +47,21 @@
 #include "StringUtil.hpp"
 #include "Rmatrix66.hpp"
 #include "StateConversionUtil.hpp"
+#include "TimeTypes.hpp"
 
 #include <algorithm>
 #include <sstream>
 #include <iostream>
 #include <string>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
 // End EKF mod
 
 //#define DEBUG_INITIALIZATION
 //#define DEBUG_EXECUTION
 //#define DEBUG_REPORTS
+//#define DEBUG_UPDATE_STORE
 
 // Macros for debugging of the state machine
 //#define WALK_STATE_MACHINE
@@ -91,6 +96,8 @@ SeqEstimator::PARAMETER_TEXT[] =
    "WarmStartEpochFormat",          // The epoch format used by WarmStartEpoch
    "WarmStartEpoch",                // The epoch to initialize the SeqEstimator from based on the InputWarmStartFile
    "OutputWarmStartFile",           // The file to write SeqEstimator data to
+   "CheckpointFile",                // The binary file to resume from and checkpoint to
+   "CheckpointInterval",            // The filter time between checkpoints, in seconds
 };
 
 const Gmat::ParameterType
@@ -105,6 +112,8 @@ SeqEstimator::PARAMETER_TYPE[] =
    Gmat::STRING_TYPE,
    Gmat::STRING_TYPE,
    Gmat::STRING_TYPE,
+   Gmat::STRING_TYPE,
+   Gmat::REAL_TYPE,
 };
 // End EKF mod
 
@@ -134,7 +143,12 @@ SeqEstimator::SeqEstimator(const std::string &type,
    inputDataFile           (""),
    restartEpochFormat      ("TAIModJulian"),
    restartEpoch            ("FirstMeasurement"),
-   outputDataFile          ("")
+   outputDataFile          (""),
+   checkpointFile          (""),
+   checkpointInterval      (3600.0),
+   lastCheckpointEpochGT   (-1.0),
+   hasCheckpoint           (false),
+   checkpointRestart       (false)
 
 // End EKF mod
 {
@@ -184,7 +198,12 @@ SeqEstimator::SeqEstimator(const SeqEstimator & se) :
    inputDataFile           (se.inputDataFile),
    restartEpochFormat      (se.restartEpochFormat),
    restartEpoch            (se.restartEpoch),
-   outputDataFile          (se.outputDataFile)
+   outputDataFile          (se.outputDataFile),
+   checkpointFile          (se.checkpointFile),
+   checkpointInterval      (se.checkpointInterval),
+   lastCheckpointEpochGT   (-1.0),
+   hasCheckpoint           (false),
+   checkpointRestart       (false)
 // End EKF mod
 {
    hiLowData.push_back(&sigma);
@@ -220,6 +239,10 @@ SeqEstimator& SeqEstimator::operator=(
       restartEpochFormat = se.restartEpochFormat;
       restartEpoch = se.restartEpoch;
       outputDataFile = se.outputDataFile;
+      checkpointFile = se.checkpointFile;
+      checkpointInterval = se.checkpointInterval;
+      hasCheckpoint = false;
+      checkpointRestart = false;
    }
    return *this;
 }
@@ -278,11 +301,12 @@ Integer SeqEstimator::GetParameterID(const std::string &str) const
    if (str == "MaximumIterations")
       throw SolverException("Syntax error: Sequential Estimator '" + GetName() + "' does not has parameter '" + str + "'.\n");
 
-   for (Integer i = EstimatorParamCount; i < SeqEstimatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - EstimatorParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, EstimatorParamCount,
+               SeqEstimatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Estimator::GetParameterID(str);
 }
@@ -404,6 +428,9 @@ Real SeqEstimator::GetRealParameter(const Integer id) const
    if (id == MEAS_DEWEIGHT_COEFF)
       return deweightCoeff;
 
+   if (id == CHECKPOINT_INTERVAL)
+      return checkpointInterval;
+
    return Estimator::GetRealParameter(id);
 }
 
@@ -474,6 +501,16 @@ Real SeqEstimator::SetRealParameter(const Integer id, const Real value)
       return deweightCoeff;
    }
 
+   if (id == CHECKPOINT_INTERVAL)
+   {
+      if (value >= 0.0)
+         checkpointInterval = value;
+      else
+         throw EstimatorException("Error: " + GetName() + "." + GetParameterText(id) + " cannot be negative\n");
+
+      return checkpointInterval;
+   }
+
    return Estimator::SetRealParameter(id, value);
 }
 
@@ -539,6 +576,9 @@ std::string SeqEstimator::GetStringParameter(const Integer id) const
    if (id == OUTPUT_DATA_FILE)
       return outputDataFile;
 
+   if (id == CHECKPOINT_FILE)
+      return checkpointFile;
+
    return Estimator::GetStringParameter(id);
 }
 
@@ -617,6 +657,20 @@ bool SeqEstimator::SetStringParameter(const Integer id, const std::string &value
       return true;
    }
 
+   if (id == CHECKPOINT_FILE)
+   {
+      // verify a valid file name
+      if (value != "")
+      {
+         Integer error;
+         if (!GmatStringUtil::IsValidFullFileName(value, error))
+            throw EstimatorException("Error: '" + value + "' set to " + GetName() + ".CheckpointFile is an invalid file name.\n");
+      }
+
+      checkpointFile = value;
+      return true;
+   }
+
    return Estimator::SetStringParameter(id, value);
 }
 
@@ -942,15 +996,15 @@ bool SeqEstimator::IsFinalPass()
 
 
 //------------------------------------------------------------------------------
-// std::vector<SeqEstimator::UpdateInfoType> GetUpdateStats()
+// const UpdateInfoStore& GetUpdateStats()
 //------------------------------------------------------------------------------
 /**
- * This returns the vector of UpdateInfoType
+ * This returns the store of UpdateInfoType records
  *
- * @return the vector of UpdateInfoType
+ * @return the store of UpdateInfoType records
  */
  //------------------------------------------------------------------------------
-std::vector<SeqEstimator::UpdateInfoType> SeqEstimator::GetUpdateStats()
+const SeqEstimator::UpdateInfoStore& SeqEstimator::GetUpdateStats()
 {
    return updateStats;
 }
@@ -1034,9 +1088,15 @@ void SeqEstimator::SetCovariance(const Rmatrix& cov)
 bool SeqEstimator::UpdateInitialConditions()
 {
    bool retval = false;
+   hasCheckpoint = false;
+   checkpointRestart = false;
+
+   // Resume from the last checkpoint of an earlier run, if there is one
+   if (checkpointFile != "")
+      checkpointRestart = RestartFromCheckpoint();
 
    // Warm restart
-   if (inputDataFile != "")
+   if (!checkpointRestart && (inputDataFile != ""))
    {
       GmatTime restartEpochGT, temp;
       bool onlyPriorEpochs;
@@ -1195,7 +1255,9 @@ void SeqEstimator::CompleteInitialization()
 
    if (measManager.IsForward())
    {
-      UnsignedInt numObsRemoved = TrimObsByEpoch(estimationEpochGT, inputDataFile != "");
+      // Checkpoints are written before the measurements at their epoch
+      UnsignedInt numObsRemoved = TrimObsByEpoch(estimationEpochGT,
+            (inputDataFile != "") && !checkpointRestart);
 
       if (numObsRemoved > 0U)
       {
@@ -1633,7 +1695,10 @@ void SeqEstimator::TimeUpdate()
    Rmatrix dX_dS = cart2SolvMatrixPrev;
    Rmatrix dS_dX = cart2SolvMatrix.Inverse();
 
-   Rmatrix Q_S = dS_dX * Q * dS_dX.Transpose();
+   // Q_S = dS_dX * Q * dS_dX^T, taken block by block: only the noise of the
+   // converted states changes
+   Rmatrix Q_S = Q;
+   TransformCovariance(Q_S, cart2SolvMatrix, true);
    Rmatrix stm_S = dS_dX * (*stm) * dX_dS;
 
    // Update offset from reference trajectory
@@ -1902,6 +1967,7 @@ void SeqEstimator::FilterUpdate()
       if (!(isPredicting && !hasAnchorEpoch))
       {
          WriteDataFile();
+         WriteCheckpoint();
          AddMatlabFilterData(updateStat);
          updateStats.push_back(updateStat);
       }
@@ -2778,19 +2844,43 @@ void SeqEstimator::OpenDataFile()
    // Write the data file header
    dataFile << "Epoch.UTCGregorian";
 
-   const std::vector<ListItem*> *stateMap = esm.GetStateMap();
+   StringArray header;
+   GetDataFileHeader(header);
+   for (UnsignedInt ii = 0; ii < header.size(); ii++)
+      dataFile << "," << header[ii];
+
+   dataFile << "\n";
+}
 
-   // Write state names
+
+//------------------------------------------------------------------------------
+// void GetDataFileHeader(StringArray &header)
+//------------------------------------------------------------------------------
+/**
+ * Builds the names of the state and covariance columns of a data record
+ *
+ * @param header The names, returned in column order
+ */
+ //------------------------------------------------------------------------------
+void SeqEstimator::GetDataFileHeader(StringArray &header)
+{
+   header.clear();
+
+   // State names
    for (UnsignedInt ii = 0; ii < stateSize; ii++)
-      dataFile << "," << DataFileStateHeader(ii);
+      header.push_back(DataFileStateHeader(ii));
 
-   // Write covariance names
+   // Covariance names
    std::string covHeaderName = DataFileCovHeader();
    for (UnsignedInt ii = 0; ii < stateSize; ii++)
+   {
       for (UnsignedInt jj = 0; jj <= ii; jj++)
-         dataFile << "," << covHeaderName << "_" << ii+1 << "_" << jj+1;
-
-   dataFile << "\n";
+      {
+         std::stringstream name;
+         name << covHeaderName << "_" << ii+1 << "_" << jj+1;
+         header.push_back(name.str());
+      }
+   }
 }
 
 
@@ -2925,6 +3015,30 @@ void SeqEstimator::WriteDataFile()
  */
  //------------------------------------------------------------------------------
 void SeqEstimator::WriteCovarianceToDataFile()
+{
+   RealArray record;
+   GetCovarianceRecord(record);
+
+   for (UnsignedInt ii = 0; ii < record.size(); ii++)
+   {
+      std::string valueStr = GmatStringUtil::RealToString(record[ii], false, true, true);
+      dataFile << "," << valueStr;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void GetCovarianceRecord(RealArray &record)
+//----------------------------------------------------------------------
+/**
+ * Appends the covariance columns of a data record, in the order of
+ * DataFileCovHeader() names
+ *
+ * @param record The record the lower triangle of the Cartesian covariance
+ *               is appended to
+ */
+ //------------------------------------------------------------------------------
+void SeqEstimator::GetCovarianceRecord(RealArray &record)
 {
    // Calculate conversion derivative matrix [dX/dS] from Cartesian to Solve-for state
    Rmatrix dX_dS = esm.CartToSolveForStateConversionDerivativeMatrix();
@@ -2932,16 +3046,14 @@ void SeqEstimator::WriteCovarianceToDataFile()
    Rmatrix cov = *(stateCovariance->GetCovariance());
    cov = dX_dS * cov * dX_dS.Transpose();
 
-   // Write covariance lower triangle
+   // Covariance lower triangle
    for (UnsignedInt ii = 0; ii < stateSize; ii++)
    {
       Real iiConv = GetEpsilonConversion(ii);
       for (UnsignedInt jj = 0; jj <= ii; jj++)
       {
          Real jjConv = GetEpsilonConversion(jj);
-         Real value = cov(ii, jj) * iiConv * jjConv;
-         std::string valueStr = GmatStringUtil::RealToString(value, false, true, true);
-         dataFile << "," << valueStr;
+         record.push_back(cov(ii, jj) * iiConv * jjConv);
       }
    }
 }
@@ -3063,7 +3175,41 @@ bool SeqEstimator::RestartFromDataFile(const GmatTime &epoch, bool onlyPriorEpoc
    if (header.size() != restartData.size())
       throw EstimatorException("Error reading InputWarmStartFile, header row and data row have a different number of elements.");
 
+   // Only the state and covariance columns are used; others read as zero
+   RealArray restartValues(restartData.size(), 0.0);
+   for (UnsignedInt ii = epochIndex + 1U; ii < restartData.size(); ii++)
+   {
+      Real value;
+      if (GmatStringUtil::ToReal(restartData[ii], value))
+         restartValues[ii] = value;
+   }
+
+   return RestartFromRecord(header, restartValues, epochIndex + 1U, bestEpoch,
+         "InputWarmStartFile");
+}
+
 
+//------------------------------------------------------------------------------
+// bool RestartFromRecord(const StringArray &header,
+//       const RealArray &restartData, UnsignedInt firstStateIndex,
+//       const GmatTime &epoch, const std::string &source)
+//------------------------------------------------------------------------------
+/**
+ * Sets the epoch, state and covariance from a data record
+ *
+ * @param header The names of the record columns.
+ * @param restartData The values of the record columns.
+ * @param firstStateIndex The column index of the first state element.
+ * @param epoch The epoch of the record.
+ * @param source The name of the record source, used in messages.
+ *
+ * @return true if data was loaded from the record
+ */
+ //------------------------------------------------------------------------------
+bool SeqEstimator::RestartFromRecord(const StringArray &header,
+      const RealArray &restartData, UnsignedInt firstStateIndex,
+      const GmatTime &epoch, const std::string &source)
+{
    // Map file columns to states
    IntegerArray stateColumnNum(esm.GetStateSize(), -1);
    for (UnsignedInt ii = 0; ii < esm.GetStateSize(); ii++)
@@ -3080,30 +3226,25 @@ bool SeqEstimator::RestartFromDataFile(const GmatTime &epoch, bool onlyPriorEpoc
       }
    }
 
-   UnsignedInt firstStateIndex = epochIndex + 1U;
-
    // Set epoch
    esm.MapObjectsToVector();
    GmatState estimationCartState = esm.GetEstimationMJ2000EqCartesianStateForReport();
    estimationCartState.SetPrecisionTimeFlag(true);
-   estimationCartState.SetEpoch(bestEpoch.GetMjd());
-   estimationCartState.SetEpochGT(bestEpoch);
+   estimationCartState.SetEpoch(epoch.GetMjd());
+   estimationCartState.SetEpochGT(epoch);
 
    // Set state
    for (UnsignedInt ii = 0; ii < esm.GetStateSize(); ii++)
    {
       if (stateColumnNum[ii] >= 0)
-      {
-         Real value;
-         GmatStringUtil::ToReal(restartData[stateColumnNum[ii]], value);
-         estimationCartState[ii] = value;
-      }
+         estimationCartState[ii] = restartData[stateColumnNum[ii]];
    }
    esm.SetEstimationMJ2000EqCartesianStateParticipant(estimationCartState);
 
    ReadCovarianceFromDataFile(header, restartData, firstStateIndex, stateColumnNum);
 
-   MessageInterface::ShowMessage("The following states were loaded from the InputWarmStartFile:\n");
+   MessageInterface::ShowMessage("The following states were loaded from the %s:\n",
+         source.c_str());
    for (UnsignedInt ii = 0U; ii < stateColumnNum.size(); ii++)
    {
       if (stateColumnNum[ii] != -1)
@@ -3120,8 +3261,9 @@ bool SeqEstimator::RestartFromDataFile(const GmatTime &epoch, bool onlyPriorEpoc
 
 
 //------------------------------------------------------------------------------
-// void ReadCovarianceFromDataFile(StringArray header, StringArray restartData,
-//                                 UnsignedInt firstStateIndex, IntegerArray stateColumnNum)
+// void ReadCovarianceFromDataFile(const StringArray &header,
+//       const RealArray &restartData, UnsignedInt firstStateIndex,
+//       IntegerArray stateColumnNum)
 //----------------------------------------------------------------------
 /**
  * Reads the covariance from the data file
@@ -3132,7 +3274,7 @@ bool SeqEstimator::RestartFromDataFile(const GmatTime &epoch, bool onlyPriorEpoc
  * @param stateColumnNum The maping of the solve for states to the restart file states.
  */
  //------------------------------------------------------------------------------
-void SeqEstimator::ReadCovarianceFromDataFile(StringArray header, StringArray restartData,
+void SeqEstimator::ReadCovarianceFromDataFile(const StringArray &header, const RealArray &restartData,
                                               UnsignedInt firstStateIndex, IntegerArray stateColumnNum)
 {
    // Find column of first covariance element
@@ -3149,7 +3291,7 @@ void SeqEstimator::ReadCovarianceFromDataFile(StringArray header, StringArray re
    }
 
    if (!covFound)
-      throw EstimatorException("Error reading InputWarmStartFile, no covariance was found.");
+      throw EstimatorException("Error reading warm start data, no covariance was found.");
 
    UnsignedInt fileStateSize = firstCovIndex - firstStateIndex;
 
@@ -3165,10 +3307,7 @@ void SeqEstimator::ReadCovarianceFromDataFile(StringArray header, StringArray re
    {
       for (UnsignedInt jj = 0; jj <= ii; jj++)
       {
-         Real value;
-         GmatStringUtil::ToReal(restartData[index], value);
-         fileCov(ii, jj) = value;
-
+         fileCov(ii, jj) = restartData[index];
          index++;
       }
    }
@@ -3209,6 +3348,163 @@ void SeqEstimator::ReadCovarianceFromDataFile(StringArray header, StringArray re
 }
 
 
+//------------------------------------------------------------------------------
+// std::string GetCheckpointPath()
+//------------------------------------------------------------------------------
+/**
+ * Builds the full path of the checkpoint file
+ *
+ * @return The path
+ */
+ //------------------------------------------------------------------------------
+std::string SeqEstimator::GetCheckpointPath()
+{
+   std::string fnNoPath;
+   return GetFullPathFileName(fnNoPath, GetName(), checkpointFile, "OUTPUT_PATH",
+         false, "chk", false, true);
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteCheckpoint()
+//------------------------------------------------------------------------------
+/**
+ * Writes the filter data to the binary checkpoint file
+ *
+ * A checkpoint is written when CheckpointInterval seconds of filter time have
+ * passed since the last one.  It holds the epoch and the data file record
+ * (names and values of the state and covariance columns) at full precision,
+ * and is written before the measurements at its epoch are processed.  The
+ * file is written under a temporary name and then renamed, so a crash while
+ * writing leaves the previous checkpoint in place.
+ */
+ //------------------------------------------------------------------------------
+void SeqEstimator::WriteCheckpoint()
+{
+   if ((checkpointFile == "") || isPredicting || isSmoothing ||
+       !measManager.IsForward() || esm.HasStateOffset())
+      return;
+
+   if (hasCheckpoint && (GmatMathUtil::Abs((currentEpochGT -
+         lastCheckpointEpochGT).GetTimeInSec()) < checkpointInterval))
+      return;
+
+   StringArray header;
+   GetDataFileHeader(header);
+
+   GmatState outState = esm.GetEstimationMJ2000EqCartesianStateForReport();
+   RealArray record;
+   for (UnsignedInt ii = 0; ii < stateSize; ii++)
+      record.push_back(outState[ii]);
+   GetCovarianceRecord(record);
+
+   std::string path = GetCheckpointPath();
+   std::string tempPath = path + ".tmp";
+   std::ofstream chk(tempPath.c_str(), std::ios::out | std::ios::binary);
+   if (!chk.is_open())
+      throw EstimatorException("Error opening checkpoint file " + tempPath);
+
+   const char magic[8] = {'G', 'M', 'A', 'T', 'C', 'H', 'K', '1'};
+   chk.write(magic, 8);
+
+   long days = currentEpochGT.GetDays();
+   long sec = currentEpochGT.GetSec();
+   Real fracSec = currentEpochGT.GetFracSec();
+   chk.write((const char*)&days, sizeof(long));
+   chk.write((const char*)&sec, sizeof(long));
+   chk.write((const char*)&fracSec, sizeof(Real));
+
+   UnsignedInt count = header.size();
+   chk.write((const char*)&count, sizeof(UnsignedInt));
+   for (UnsignedInt ii = 0; ii < count; ii++)
+   {
+      UnsignedInt length = header[ii].size();
+      chk.write((const char*)&length, sizeof(UnsignedInt));
+      chk.write(header[ii].data(), length);
+   }
+   chk.write((const char*)&record[0], count * sizeof(Real));
+   chk.close();
+
+   if (chk.fail())
+      throw EstimatorException("Error writing checkpoint file " + tempPath);
+
+   std::remove(path.c_str());
+   if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+      throw EstimatorException("Error replacing checkpoint file " + path);
+
+   lastCheckpointEpochGT = currentEpochGT;
+   hasCheckpoint = true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool RestartFromCheckpoint()
+//------------------------------------------------------------------------------
+/**
+ * Sets the epoch, state and covariance from the checkpoint file
+ *
+ * @return true if data was loaded from the file, false if there is no file
+ */
+ //------------------------------------------------------------------------------
+bool SeqEstimator::RestartFromCheckpoint()
+{
+   std::string path = GetCheckpointPath();
+   std::ifstream chk(path.c_str(), std::ios::in | std::ios::binary);
+
+   // No checkpoint yet; start as configured
+   if (!chk.is_open())
+      return false;
+
+   char magic[8];
+   chk.read(magic, 8);
+   if (!chk || (std::strncmp(magic, "GMATCHK1", 8) != 0))
+      throw EstimatorException("Error reading checkpoint file " + path +
+            ", the file is not a filter checkpoint");
+
+   long days, sec;
+   Real fracSec;
+   chk.read((char*)&days, sizeof(long));
+   chk.read((char*)&sec, sizeof(long));
+   chk.read((char*)&fracSec, sizeof(Real));
+
+   GmatTime epoch;
+   epoch.SetDays(days);
+   epoch.SetSec(sec);
+   epoch.SetFracSec(fracSec);
+
+   UnsignedInt count = 0;
+   chk.read((char*)&count, sizeof(UnsignedInt));
+
+   StringArray header;
+   for (UnsignedInt ii = 0; chk && (ii < count); ii++)
+   {
+      UnsignedInt length = 0;
+      chk.read((char*)&length, sizeof(UnsignedInt));
+      std::string name(length, ' ');
+      if (length > 0)
+         chk.read(&name[0], length);
+      header.push_back(name);
+   }
+
+   RealArray record(count, 0.0);
+   if (chk && (count > 0))
+      chk.read((char*)&record[0], count * sizeof(Real));
+
+   if (!chk)
+      throw EstimatorException("Error reading checkpoint file " + path +
+            ", the file is incomplete");
+   chk.close();
+
+   MessageInterface::ShowMessage("Resuming from the checkpoint at %s A1ModJulian\n",
+         epoch.ToString().c_str());
+
+   lastCheckpointEpochGT = epoch;
+   hasCheckpoint = true;
+
+   return RestartFromRecord(header, record, 0U, epoch, "CheckpointFile");
+}
+
+
 //------------------------------------------------------------------------------
 // bool WriteMatData()
 //------------------------------------------------------------------------------
@@ -3460,13 +3756,13 @@ bool SeqEstimator::VerifySmoothTimeStep()
 	{
 		index = low + (high - low) / 2;
 
-		if (GmatMathUtil::IsEqual(currentEpochGT, forwardFilterInfo->at(index).epoch, ESTTIME_ROUNDOFF))
+		if (GmatMathUtil::IsEqual(currentEpochGT, forwardFilterInfo->GetEpoch(index), ESTTIME_ROUNDOFF))
 		{
 			found = true;
 			break;
 		}
 
-		if (forwardFilterInfo->at(index).epoch > currentEpochGT)
+		if (forwardFilterInfo->GetEpoch(index) > currentEpochGT)
 			high = index - 1;
 		else
 			low = index + 1;
@@ -3496,19 +3792,19 @@ Real SeqEstimator::MatchSmoothTimeStep()
 	int low = 0;
 	int index = 0;
 
-	GmatTime lastBackEpoch = updateStats[updateStats.size() - 1].epoch;
+	GmatTime lastBackEpoch = updateStats.GetEpoch(updateStats.size() - 1);
 
 	while (high >= low)
 	{
 		index = low + (high - low) / 2;
 
-		if (GmatMathUtil::IsEqual(lastBackEpoch, forwardFilterInfo->at(index).epoch, ESTTIME_ROUNDOFF))
+		if (GmatMathUtil::IsEqual(lastBackEpoch, forwardFilterInfo->GetEpoch(index), ESTTIME_ROUNDOFF))
 		{
 			found = true;
 			break;
 		}
 
-		if (forwardFilterInfo->at(index).epoch > lastBackEpoch)
+		if (forwardFilterInfo->GetEpoch(index) > lastBackEpoch)
 			high = index - 1;
 		else
 			low = index + 1;
@@ -3521,7 +3817,7 @@ Real SeqEstimator::MatchSmoothTimeStep()
    {
       if (index > 0)
       {
-         if (GmatMathUtil::IsEqual(forwardFilterInfo->at(index - 1).epoch, forwardFilterInfo->at(index).epoch, ESTTIME_ROUNDOFF))
+         if (GmatMathUtil::IsEqual(forwardFilterInfo->GetEpoch(index - 1), forwardFilterInfo->GetEpoch(index), ESTTIME_ROUNDOFF))
             index--;
          else
             break;
@@ -3529,6 +3825,783 @@ Real SeqEstimator::MatchSmoothTimeStep()
       else
          break;
    }
-	return (forwardFilterInfo->at(index - 1).epoch - currentEpochGT).GetTimeInSec();
+	return (forwardFilterInfo->GetEpoch(index - 1) - currentEpochGT).GetTimeInSec();
+
+}
+
+
+//------------------------------------------------------------------------------
+// UpdateInfoStore
+//------------------------------------------------------------------------------
+
+/// Number of records read from the scratch file at a time
+const UnsignedInt SeqEstimator::UpdateInfoStore::BLOCK_SIZE = 64;
+/// Megabytes of records held in memory before the scratch file is used
+const Real SeqEstimator::UpdateInfoStore::DEFAULT_MEMORY_LIMIT = 256.0;
+
+/**
+ * The scratch file of an UpdateInfoStore
+ *
+ * Records are only appended, so copies of a store can share the file.  The
+ * lock serializes the read-ahead thread with the appends.
+ */
+struct SeqEstimator::UpdateInfoStore::ScratchFile
+{
+   std::string    name;
+   std::fstream   stream;
+   std::streamoff end;
+   std::mutex     lock;
+
+   ScratchFile() : end(0) {}
+   ~ScratchFile()
+   {
+      if (stream.is_open())
+         stream.close();
+      remove(name.c_str());
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// Record serialization for the scratch file
+//------------------------------------------------------------------------------
+template <class T>
+static void PutValue(std::vector<char> &buffer, const T &value)
+{
+   const char *bytes = (const char*)&value;
+   buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
 
+static void PutReals(std::vector<char> &buffer, const Real *values,
+      Integer count)
+{
+   const char *bytes = (const char*)values;
+   buffer.insert(buffer.end(), bytes, bytes + count * sizeof(Real));
+}
+
+static void PutTime(std::vector<char> &buffer, const GmatTime &epoch)
+{
+   PutValue(buffer, (Integer)epoch.GetDays());
+   PutValue(buffer, (Integer)epoch.GetSec());
+   PutValue(buffer, epoch.GetFracSec());
+}
+
+static void PutString(std::vector<char> &buffer, const std::string &str)
+{
+   PutValue(buffer, (Integer)str.length());
+   buffer.insert(buffer.end(), str.begin(), str.end());
+}
+
+static void PutArray(std::vector<char> &buffer, const RealArray &values)
+{
+   PutValue(buffer, (Integer)values.size());
+   if (!values.empty())
+      PutReals(buffer, &values[0], values.size());
+}
+
+static void PutMatrix(std::vector<char> &buffer, const Rmatrix &mat)
+{
+   Integer rows = mat.GetNumRows(), cols = mat.GetNumColumns();
+   PutValue(buffer, rows);
+   PutValue(buffer, cols);
+   if (rows * cols > 0)
+      PutReals(buffer, mat.GetDataVector(), rows * cols);
+}
+
+/// Reads the values written by the Put functions, checking the record length
+class UpdateInfoReader
+{
+public:
+   UpdateInfoReader(const char *data, std::streamoff length) :
+      next(data), end(data + length)
+   {
+   }
+
+   template <class T>
+   void Get(T &value)
+   {
+      Take(&value, sizeof(T));
+   }
+
+   void GetTime(GmatTime &epoch)
+   {
+      Integer days, sec;
+      Real fracSec;
+      Get(days);
+      Get(sec);
+      Get(fracSec);
+      epoch.SetDays(days);
+      epoch.SetSec(sec);
+      epoch.SetFracSec(fracSec);
+   }
+
+   void GetString(std::string &str)
+   {
+      Integer length;
+      Get(length);
+      Check(length);
+      str.assign(next, length);
+      next += length;
+   }
+
+   void GetArray(RealArray &values)
+   {
+      Integer count;
+      Get(count);
+      Check(count * sizeof(Real));
+      values.resize(count);
+      if (count > 0)
+         Take(&values[0], count * sizeof(Real));
+   }
+
+   void GetMatrix(Rmatrix &mat)
+   {
+      Integer rows, cols;
+      Get(rows);
+      Get(cols);
+      Check(rows * cols * sizeof(Real));
+      mat.SetSize(rows, cols);
+      if (rows * cols > 0)
+         Take((Real*)mat.GetDataVector(), rows * cols * sizeof(Real));
+   }
+
+private:
+   const char *next;
+   const char *end;
+
+   void Check(std::streamoff bytes)
+   {
+      if ((bytes < 0) || (bytes > end - next))
+         throw EstimatorException("The filter data scratch file is corrupt");
+   }
+
+   void Take(void *to, std::streamoff bytes)
+   {
+      Check(bytes);
+      memcpy(to, next, bytes);
+      next += bytes;
+   }
+};
+
+static void WriteUpdateInfo(std::vector<char> &buffer,
+      const SeqEstimator::UpdateInfoType &info)
+{
+   const SeqEstimator::FilterMeasurementInfoType &meas = info.measStat;
+
+   PutTime(buffer, info.epoch);
+   PutValue(buffer, (char)info.isObs);
+
+   PutTime(buffer, meas.epoch);
+   PutValue(buffer, meas.recNum);
+   PutValue(buffer, meas.modelSize);
+   PutValue(buffer, meas.editFlag);
+   PutValue(buffer, (char)meas.isCalculated);
+   PutString(buffer, meas.removedReason);
+   PutString(buffer, meas.station);
+   PutString(buffer, meas.type);
+   PutValue(buffer, meas.uniqueID);
+   PutValue(buffer, meas.frequency);
+   PutValue(buffer, meas.feasibilityValue);
+   PutArray(buffer, meas.measValue);
+   PutArray(buffer, meas.residual);
+   PutArray(buffer, meas.weight);
+   PutValue(buffer, (Integer)meas.hAccum.size());
+   for (UnsignedInt ii = 0U; ii < meas.hAccum.size(); ++ii)
+      PutArray(buffer, meas.hAccum[ii]);
+   PutValue(buffer, meas.tropoCorrectValue);
+   PutValue(buffer, meas.ionoCorrectValue);
+   PutValue(buffer, meas.horpHeight);
+   PutValue(buffer, meas.horpAngle);
+   PutArray(buffer, meas.state);
+   PutMatrix(buffer, meas.cov);
+   PutMatrix(buffer, meas.sqrtCov);
+   PutMatrix(buffer, meas.covVNB);
+   PutArray(buffer, meas.scaledResid);
+   PutMatrix(buffer, meas.kalmanGain);
+
+   PutArray(buffer, info.state);
+   PutMatrix(buffer, info.cov);
+   PutMatrix(buffer, info.sqrtCov);
+   PutMatrix(buffer, info.covVNB);
+   PutMatrix(buffer, info.processNoise);
+   PutMatrix(buffer, info.stm);
+}
+
+static void ReadUpdateInfo(UpdateInfoReader &reader,
+      SeqEstimator::UpdateInfoType &info)
+{
+   SeqEstimator::FilterMeasurementInfoType &meas = info.measStat;
+   char flag;
+   Integer count;
+
+   reader.GetTime(info.epoch);
+   reader.Get(flag);
+   info.isObs = (flag != 0);
+
+   reader.GetTime(meas.epoch);
+   reader.Get(meas.recNum);
+   reader.Get(meas.modelSize);
+   reader.Get(meas.editFlag);
+   reader.Get(flag);
+   meas.isCalculated = (flag != 0);
+   reader.GetString(meas.removedReason);
+   reader.GetString(meas.station);
+   reader.GetString(meas.type);
+   reader.Get(meas.uniqueID);
+   reader.Get(meas.frequency);
+   reader.Get(meas.feasibilityValue);
+   reader.GetArray(meas.measValue);
+   reader.GetArray(meas.residual);
+   reader.GetArray(meas.weight);
+   reader.Get(count);
+   if (count < 0)
+      throw EstimatorException("The filter data scratch file is corrupt");
+   meas.hAccum.resize(count);
+   for (Integer ii = 0; ii < count; ++ii)
+      reader.GetArray(meas.hAccum[ii]);
+   reader.Get(meas.tropoCorrectValue);
+   reader.Get(meas.ionoCorrectValue);
+   reader.Get(meas.horpHeight);
+   reader.Get(meas.horpAngle);
+   reader.GetArray(meas.state);
+   reader.GetMatrix(meas.cov);
+   reader.GetMatrix(meas.sqrtCov);
+   reader.GetMatrix(meas.covVNB);
+   reader.GetArray(meas.scaledResid);
+   reader.GetMatrix(meas.kalmanGain);
+
+   reader.GetArray(info.state);
+   reader.GetMatrix(info.cov);
+   reader.GetMatrix(info.sqrtCov);
+   reader.GetMatrix(info.covVNB);
+   reader.GetMatrix(info.processNoise);
+   reader.GetMatrix(info.stm);
+}
+
+static std::streamoff MatrixBytes(const Rmatrix &mat)
+{
+   return mat.GetNumRows() * mat.GetNumColumns() * sizeof(Real);
+}
+
+static std::streamoff UpdateInfoBytes(const SeqEstimator::UpdateInfoType &info)
+{
+   const SeqEstimator::FilterMeasurementInfoType &meas = info.measStat;
+
+   std::streamoff bytes = sizeof(SeqEstimator::UpdateInfoType) +
+         (info.state.size() + meas.state.size() + meas.measValue.size() +
+          meas.residual.size() + meas.weight.size() +
+          meas.scaledResid.size()) * sizeof(Real) +
+         MatrixBytes(info.cov) + MatrixBytes(info.sqrtCov) +
+         MatrixBytes(info.covVNB) + MatrixBytes(info.processNoise) +
+         MatrixBytes(info.stm) + MatrixBytes(meas.cov) +
+         MatrixBytes(meas.sqrtCov) + MatrixBytes(meas.covVNB) +
+         MatrixBytes(meas.kalmanGain);
+   for (UnsignedInt ii = 0U; ii < meas.hAccum.size(); ++ii)
+      bytes += meas.hAccum[ii].size() * sizeof(Real);
+
+   return bytes;
+}
+
+
+//------------------------------------------------------------------------------
+// UpdateInfoStore()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+SeqEstimator::UpdateInfoStore::UpdateInfoStore() :
+   memoryUsed     (0),
+   memoryLimit    ((std::streamoff)(DEFAULT_MEMORY_LIMIT * 1048576.0)),
+   blockStart     (0U),
+   prefetchStart  (0U),
+   prefetchCount  (0U)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~UpdateInfoStore()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+SeqEstimator::UpdateInfoStore::~UpdateInfoStore()
+{
+   WaitForPrefetch();
+}
+
+
+//------------------------------------------------------------------------------
+// UpdateInfoStore(const UpdateInfoStore &store)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * Records on the scratch file are shared with the original, not copied.
+ *
+ * @param store The store copied
+ */
+//------------------------------------------------------------------------------
+SeqEstimator::UpdateInfoStore::UpdateInfoStore(const UpdateInfoStore &store) :
+   records        (store.records),
+   keys           (store.keys),
+   file           (store.file),
+   memoryUsed     (store.memoryUsed),
+   memoryLimit    (store.memoryLimit),
+   blockStart     (0U),
+   prefetchStart  (0U),
+   prefetchCount  (0U)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// UpdateInfoStore& operator=(const UpdateInfoStore &store)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param store The store copied
+ *
+ * @return This store
+ */
+//------------------------------------------------------------------------------
+SeqEstimator::UpdateInfoStore& SeqEstimator::UpdateInfoStore::operator=(
+      const UpdateInfoStore &store)
+{
+   if (this != &store)
+   {
+      // Clear first: the Rmatrix members are copy constructed, not assigned
+      clear();
+      records     = store.records;
+      keys        = store.keys;
+      file        = store.file;
+      memoryUsed  = store.memoryUsed;
+      memoryLimit = store.memoryLimit;
+   }
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// void push_back(const UpdateInfoType &info)
+//------------------------------------------------------------------------------
+/**
+ * Adds a record at the end of the store
+ *
+ * @param info The record added
+ */
+//------------------------------------------------------------------------------
+void SeqEstimator::UpdateInfoStore::push_back(const UpdateInfoType &info)
+{
+   if (file)
+   {
+      WriteRecord(records.back());
+      records.clear();
+      records.push_back(info);
+   }
+   else
+   {
+      records.push_back(info);
+      memoryUsed += UpdateInfoBytes(info);
+      if ((memoryUsed > memoryLimit) && (records.size() > 1))
+         MoveToFile();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all records, releasing the scratch file
+ */
+//------------------------------------------------------------------------------
+void SeqEstimator::UpdateInfoStore::clear()
+{
+   WaitForPrefetch();
+
+   records.clear();
+   keys.clear();
+   file.reset();
+   memoryUsed = 0;
+
+   block.clear();
+   blockStart = 0U;
+   prefetchCount = 0U;
+   prefetchData.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt size() const
+//------------------------------------------------------------------------------
+/**
+ * @return The number of records in the store
+ */
+//------------------------------------------------------------------------------
+UnsignedInt SeqEstimator::UpdateInfoStore::size() const
+{
+   return keys.size() + records.size();
+}
+
+
+//------------------------------------------------------------------------------
+// bool empty() const
+//------------------------------------------------------------------------------
+/**
+ * @return true if the store has no records
+ */
+//------------------------------------------------------------------------------
+bool SeqEstimator::UpdateInfoStore::empty() const
+{
+   return (size() == 0U);
+}
+
+
+//------------------------------------------------------------------------------
+// const UpdateInfoType& operator[](UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * Accesses a record, reading its block from the scratch file if needed
+ *
+ * @param index The index of the record
+ *
+ * @return The record
+ */
+//------------------------------------------------------------------------------
+const SeqEstimator::UpdateInfoType&
+      SeqEstimator::UpdateInfoStore::operator[](UnsignedInt index) const
+{
+   if (index >= size())
+      throw EstimatorException("Filter data was requested past the end of "
+            "the filter records");
+
+   if (index >= keys.size())
+      return records[index - keys.size()];
+
+   if (block.empty() || (index < blockStart) ||
+       (index >= blockStart + block.size()))
+      ReadBlock(index);
+
+   return block[index - blockStart];
+}
+
+
+//------------------------------------------------------------------------------
+// UpdateInfoType& back()
+//------------------------------------------------------------------------------
+/**
+ * Accesses the most recent record, which is always held in memory
+ *
+ * @return The record
+ */
+//------------------------------------------------------------------------------
+SeqEstimator::UpdateInfoType& SeqEstimator::UpdateInfoStore::back()
+{
+   if (records.empty())
+      throw EstimatorException("Filter data was requested from an empty set "
+            "of filter records");
+
+   return records.back();
+}
+
+
+//------------------------------------------------------------------------------
+// const GmatTime& GetEpoch(UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * @param index The index of a record
+ *
+ * @return The epoch of the record, without reading it from the file
+ */
+//------------------------------------------------------------------------------
+const GmatTime& SeqEstimator::UpdateInfoStore::GetEpoch(UnsignedInt index) const
+{
+   if (index < keys.size())
+      return keys[index].epoch;
+   return (*this)[index].epoch;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsObs(UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * @param index The index of a record
+ *
+ * @return The observation flag of the record, without reading it from the file
+ */
+//------------------------------------------------------------------------------
+bool SeqEstimator::UpdateInfoStore::IsObs(UnsignedInt index) const
+{
+   if (index < keys.size())
+      return keys[index].isObs;
+   return (*this)[index].isObs;
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetRecNum(UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * @param index The index of a record
+ *
+ * @return The measurement record number of the record, without reading it
+ *         from the file
+ */
+//------------------------------------------------------------------------------
+UnsignedInt SeqEstimator::UpdateInfoStore::GetRecNum(UnsignedInt index) const
+{
+   if (index < keys.size())
+      return keys[index].recNum;
+   return (*this)[index].measStat.recNum;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetMemoryLimit(Real megabytes)
+//------------------------------------------------------------------------------
+/**
+ * Sets the size of the records held in memory before the scratch file is used
+ *
+ * @param megabytes The limit; 0 writes every record but the latest to the file
+ */
+//------------------------------------------------------------------------------
+void SeqEstimator::UpdateInfoStore::SetMemoryLimit(Real megabytes)
+{
+   memoryLimit = (std::streamoff)(megabytes * 1048576.0);
+   if (!file && (memoryUsed > memoryLimit) && (records.size() > 1))
+      MoveToFile();
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsOnFile() const
+//------------------------------------------------------------------------------
+/**
+ * @return true if the records are held on the scratch file
+ */
+//------------------------------------------------------------------------------
+bool SeqEstimator::UpdateInfoStore::IsOnFile() const
+{
+   return (file != NULL);
+}
+
+
+//------------------------------------------------------------------------------
+// void MoveToFile()
+//------------------------------------------------------------------------------
+/**
+ * Opens the scratch file and moves all records but the latest to it
+ */
+//------------------------------------------------------------------------------
+void SeqEstimator::UpdateInfoStore::MoveToFile()
+{
+   static UnsignedInt fileCount = 0U;
+
+   std::stringstream name;
+   name << GmatFileUtil::GetTemporaryDirectory() << "tmp_FilterData_"
+        << GmatTimeUtil::FormatCurrentTime(4) << "_" << this << "_"
+        << fileCount++ << ".bin";
+
+   std::shared_ptr<ScratchFile> scratch(new ScratchFile);
+   scratch->name = name.str();
+   scratch->stream.open(scratch->name.c_str(), std::ios::in | std::ios::out |
+         std::ios::binary | std::ios::trunc);
+   if (!scratch->stream.is_open())
+      throw EstimatorException("Unable to open the filter data scratch file " +
+            scratch->name);
+
+   #ifdef DEBUG_UPDATE_STORE
+      MessageInterface::ShowMessage("Moving %d filter records to %s\n",
+            records.size() - 1, scratch->name.c_str());
+   #endif
+
+   file = scratch;
+   for (UnsignedInt ii = 0U; ii + 1 < records.size(); ++ii)
+      WriteRecord(records[ii]);
+
+   UpdateInfoType last = records.back();
+   records.clear();
+   records.push_back(last);
+   memoryUsed = 0;
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteRecord(const UpdateInfoType &info)
+//------------------------------------------------------------------------------
+/**
+ * Appends a record to the scratch file and indexes it
+ *
+ * @param info The record
+ */
+//------------------------------------------------------------------------------
+void SeqEstimator::UpdateInfoStore::WriteRecord(const UpdateInfoType &info)
+{
+   std::vector<char> buffer;
+   WriteUpdateInfo(buffer, info);
+
+   RecordKey key;
+   key.epoch  = info.epoch;
+   key.isObs  = info.isObs;
+   key.recNum = info.measStat.recNum;
+   key.length = buffer.size();
+
+   {
+      std::lock_guard<std::mutex> guard(file->lock);
+      key.offset = file->end;
+      file->stream.seekp(key.offset);
+      file->stream.write(&buffer[0], buffer.size());
+      if (!file->stream)
+         throw EstimatorException("Unable to write to the filter data "
+               "scratch file " + file->name);
+      file->end += key.length;
+   }
+
+   keys.push_back(key);
+}
+
+
+//------------------------------------------------------------------------------
+// void ReadBlock(UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * Reads the block of file records holding a record, and reads ahead
+ *
+ * The block runs forward from the record when it follows the current block,
+ * and backward from it otherwise.  The next block in the same direction is
+ * then read on the prefetch thread.
+ *
+ * @param index The index of the record needed
+ */
+//------------------------------------------------------------------------------
+void SeqEstimator::UpdateInfoStore::ReadBlock(UnsignedInt index) const
+{
+   UnsignedInt fileRecords = keys.size();
+   bool forward = block.empty() || (index >= blockStart);
+
+   UnsignedInt start, count;
+   if (forward)
+   {
+      start = index;
+      count = (fileRecords - index < BLOCK_SIZE ? fileRecords - index :
+            BLOCK_SIZE);
+   }
+   else
+   {
+      start = (index + 1 > BLOCK_SIZE ? index + 1 - BLOCK_SIZE : 0U);
+      count = index + 1 - start;
+   }
+
+   WaitForPrefetch();
+
+   std::vector<char> data;
+   if ((prefetchCount > 0U) && (index >= prefetchStart) &&
+       (index < prefetchStart + prefetchCount) && !prefetchData.empty())
+   {
+      start = prefetchStart;
+      count = prefetchCount;
+      data.swap(prefetchData);
+   }
+   else
+   {
+      const RecordKey &last = keys[start + count - 1];
+      if (!ReadBytes(keys[start].offset,
+            last.offset + last.length - keys[start].offset, data))
+         throw EstimatorException("Unable to read the filter data scratch "
+               "file " + file->name);
+   }
+   prefetchCount = 0U;
+
+   block.resize(count);
+   for (UnsignedInt ii = 0U; ii < count; ++ii)
+   {
+      const RecordKey &key = keys[start + ii];
+      UpdateInfoReader reader(&data[key.offset - keys[start].offset], key.length);
+      ReadUpdateInfo(reader, block[ii]);
+   }
+   blockStart = start;
+
+   // Read the next block in the direction of travel ahead of time
+   UnsignedInt nextStart = 0U, nextCount = 0U;
+   if (forward && (start + count < fileRecords))
+   {
+      nextStart = start + count;
+      nextCount = (fileRecords - nextStart < BLOCK_SIZE ?
+            fileRecords - nextStart : BLOCK_SIZE);
+   }
+   else if (!forward && (start > 0U))
+   {
+      nextStart = (start > BLOCK_SIZE ? start - BLOCK_SIZE : 0U);
+      nextCount = start - nextStart;
+   }
+
+   if (nextCount > 0U)
+   {
+      const RecordKey &last = keys[nextStart + nextCount - 1];
+      std::streamoff offset = keys[nextStart].offset;
+      std::streamoff length = last.offset + last.length - offset;
+
+      prefetchStart = nextStart;
+      prefetchCount = nextCount;
+      prefetcher = std::thread([this, offset, length]()
+            {
+               if (!ReadBytes(offset, length, prefetchData))
+                  prefetchData.clear();
+            });
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool ReadBytes(std::streamoff offset, std::streamoff length,
+//       std::vector<char> &data) const
+//------------------------------------------------------------------------------
+/**
+ * Reads a span of the scratch file
+ *
+ * This method runs on the prefetch thread, so it reports failure rather than
+ * throwing.
+ *
+ * @param offset The start of the span
+ * @param length The number of bytes read
+ * @param data   The bytes read
+ *
+ * @return true if the span was read
+ */
+//------------------------------------------------------------------------------
+bool SeqEstimator::UpdateInfoStore::ReadBytes(std::streamoff offset,
+      std::streamoff length, std::vector<char> &data) const
+{
+   std::lock_guard<std::mutex> guard(file->lock);
+
+   data.resize(length);
+   file->stream.seekg(offset);
+   file->stream.read(&data[0], length);
+   if (!file->stream)
+   {
+      file->stream.clear();
+      return false;
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void WaitForPrefetch() const
+//------------------------------------------------------------------------------
+/**
+ * Waits for the read-ahead thread to finish
+ */
+//------------------------------------------------------------------------------
+void SeqEstimator::UpdateInfoStore::WaitForPrefetch() const
+{
+   if (prefetcher.joinable())
+      prefetcher.join();
 }
@@ -36,6 +36,8 @@
 #include "kalman_defs.hpp"
 #include "Estimator.hpp"
 #include "ProcessNoiseModel.hpp"
+#include <memory>
+#include <thread>
 
 /**
  * Provides core functionality used in sequential estimation.
@@ -157,8 +159,95 @@ public:
       // See FilterMeasurementInfoType above for an example.
    };
 
+   /**
+    * Storage for the UpdateInfoType records of a filter pass
+    *
+    * Records are held in memory until their size passes a limit.  They are
+    * then moved to a binary scratch file in the temporary directory, and
+    * later records are appended to it, so memory use does not grow with the
+    * length of the arc.  The most recent record stays in memory, and can be
+    * changed through back().  The epoch, observation flag and record number
+    * of every record are kept in memory for searches.
+    *
+    * Records on the file are read a block at a time in the direction of
+    * travel, and the next block is read ahead on a separate thread, so
+    * forward and backward sweeps do not wait on the disk.  A reference
+    * returned by operator[] is valid until a record outside its block is
+    * read.  Copies share the scratch file, whose records do not change once
+    * written; the file is removed when the last copy is cleared.
+    */
+   class KALMAN_API UpdateInfoStore
+   {
+   public:
+      UpdateInfoStore();
+      ~UpdateInfoStore();
+      UpdateInfoStore(const UpdateInfoStore &store);
+      UpdateInfoStore&  operator=(const UpdateInfoStore &store);
+
+      void              push_back(const UpdateInfoType &info);
+      void              clear();
+      UnsignedInt       size() const;
+      bool              empty() const;
+      const UpdateInfoType&
+                        operator[](UnsignedInt index) const;
+      UpdateInfoType&   back();
+
+      const GmatTime&   GetEpoch(UnsignedInt index) const;
+      bool              IsObs(UnsignedInt index) const;
+      UnsignedInt       GetRecNum(UnsignedInt index) const;
+
+      void              SetMemoryLimit(Real megabytes);
+      bool              IsOnFile() const;
+
+   private:
+      /// Scratch file shared by copies of a store
+      struct ScratchFile;
+
+      /// Searchable fields and file location of a record on the file
+      struct RecordKey
+      {
+         GmatTime       epoch;
+         bool           isObs;
+         UnsignedInt    recNum;
+         std::streamoff offset;
+         std::streamoff length;
+      };
+
+      /// All records, or only the most recent one once the file is in use
+      std::vector<UpdateInfoType>   records;
+      /// Keys of the records on the file
+      std::vector<RecordKey>        keys;
+      /// The scratch file, or NULL while the records are in memory
+      std::shared_ptr<ScratchFile>  file;
+      /// Bytes of records held in memory, and the limit for moving to the file
+      std::streamoff                memoryUsed;
+      std::streamoff                memoryLimit;
+
+      /// The block of file records last read, and its first index
+      mutable std::vector<UpdateInfoType> block;
+      mutable UnsignedInt           blockStart;
+      /// Read-ahead of the next block: thread, records covered, and bytes
+      mutable std::thread           prefetcher;
+      mutable UnsignedInt           prefetchStart;
+      mutable UnsignedInt           prefetchCount;
+      mutable std::vector<char>     prefetchData;
+
+      /// Number of records read from the file at a time
+      static const UnsignedInt      BLOCK_SIZE;
+      /// Default limit on the bytes of records held in memory
+      static const Real             DEFAULT_MEMORY_LIMIT;
+
+      void              MoveToFile();
+      void              WriteRecord(const UpdateInfoType &info);
+      void              ReadBlock(UnsignedInt index) const;
+      bool              ReadBytes(std::streamoff offset, std::streamoff length,
+                                  std::vector<char> &data) const;
+      void              WaitForPrefetch() const;
+   };
+
    // Functions added for smoothing
-   virtual std::vector<UpdateInfoType> GetUpdateStats();
+   virtual const UpdateInfoStore&
+                        GetUpdateStats();
    virtual void         GetObjectBuffer(ObjectArray &buffer);
    virtual void         SetAnchorEpoch(const GmatTime& epoch, bool noiseBetween);
    virtual void         SetCovariance(const Rmatrix& cov);
@@ -205,6 +294,16 @@ protected:
    std::string outputDataFile;
    /// The output data file
    std::ofstream dataFile;
+   /// The binary checkpoint file, read to resume and written during the run
+   std::string checkpointFile;
+   /// The filter time between checkpoints, in seconds
+   Real        checkpointInterval;
+   /// The epoch of the last checkpoint written
+   GmatTime    lastCheckpointEpochGT;
+   /// Flag set once a checkpoint has been written in this run
+   bool        hasCheckpoint;
+   /// Flag set when the run resumed from the checkpoint file
+   bool        checkpointRestart;
 
    /// Changes in the state vector
    Rvector                 dx;
@@ -245,7 +344,7 @@ protected:
    // Is true when TakeAction("RunBackwards") is called, false when TakeAction("RunForwards") is called
    bool					   isSmoothing;
    // The forward pass data from a smoother run. Used when smoothing to ensure forward and back smoother epochs match
-   std::vector<SeqEstimator::UpdateInfoType>* forwardFilterInfo;
+   UpdateInfoStore*        forwardFilterInfo;
    /// Parameter IDs for the BatchEstimators
    enum
    {
@@ -258,6 +357,8 @@ protected:
       RESTART_EPOCH_FORMAT,
       RESTART_EPOCH,
       OUTPUT_DATA_FILE,
+      CHECKPOINT_FILE,
+      CHECKPOINT_INTERVAL,
 
       SeqEstimatorParamCount
    };
@@ -314,7 +415,7 @@ protected:
 
    virtual void           WriteCovariancePageHeader();
 
-   std::vector<UpdateInfoType> updateStats;
+   UpdateInfoStore        updateStats;
 
    virtual void           FillUpdateInfo(UpdateInfoType &updateStat);
    virtual void           BuildCovarianceLine(const UpdateInfoType &updateStat);
@@ -326,13 +427,21 @@ protected:
    virtual std::string    GetHeaderName();
 
    void                   OpenDataFile();
+   void                   GetDataFileHeader(StringArray &header);
    virtual std::string    DataFileStateHeader(Integer index);
    virtual std::string    DataFileCovHeader() const;
    virtual void           WriteDataFile();
    virtual bool           RestartFromDataFile(const GmatTime &epoch, bool onlyPriorEpochs);
+   virtual bool           RestartFromRecord(const StringArray &header, const RealArray &restartData,
+                                            UnsignedInt firstStateIndex, const GmatTime &epoch,
+                                            const std::string &source);
    virtual void           WriteCovarianceToDataFile();
-   virtual void           ReadCovarianceFromDataFile(StringArray header, StringArray restartData,
+   virtual void           GetCovarianceRecord(RealArray &record);
+   virtual void           ReadCovarianceFromDataFile(const StringArray &header, const RealArray &restartData,
                                                      UnsignedInt firstStateIndex, IntegerArray stateColumnNum);
+   std::string            GetCheckpointPath();
+   virtual void           WriteCheckpoint();
+   virtual bool           RestartFromCheckpoint();
 
    virtual bool           WriteMatData();
    virtual void           AddMatlabData(const FilterMeasurementInfoType &measStat);
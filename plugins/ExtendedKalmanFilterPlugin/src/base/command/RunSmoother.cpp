@@ -145,12 +145,11 @@ bool RunSmoother::Initialize()
 
             if (obj && obj->IsOfType("SeqEstimator"))
             {
-               std::vector<SeqEstimator::UpdateInfoType> forwardFilterInfo;
                ObjectArray buffer;
 
                // Get the filter statistics from this instance.
-               forwardFilterInfo = ((SeqEstimator*) obj)->GetUpdateStats();
-               ((Smoother*) theEstimator)->SetForwardFilterInfo(forwardFilterInfo);
+               ((Smoother*) theEstimator)->SetForwardFilterInfo(
+                     ((SeqEstimator*) obj)->GetUpdateStats());
 
                // Get the buffered objects from this instance.
                ((SeqEstimator*)obj)->GetObjectBuffer(buffer);
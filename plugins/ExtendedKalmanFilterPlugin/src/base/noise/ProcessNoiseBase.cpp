@@ -242,25 +242,14 @@ void ProcessNoiseBase::ConvertMatrix(Rmatrix &mat, const GmatTime &epoch)
    cc.Convert(epoch, inState, coordinateSystem, outState, j2k, true, false);
    Rmatrix33 vnbRot = cc.GetLastRotationMatrix();
 
-   Rmatrix transform = Rmatrix::Identity(stateSize);
-
-   for (UnsignedInt ii = 0; ii < 3U; ii++)
-   {
-      for (UnsignedInt jj = 0; jj < 3U; jj++)
-      {
-         transform(ii, jj) = vnbRot(ii, jj);
-         transform(ii+3, jj+3) = vnbRot(ii, jj);
-      }
-   }
-
    #ifdef DEBUG_CONVERSION
-      MessageInterface::ShowMessage("   Transformation matrix:\n");
-      for (UnsignedInt ii = 0U; ii < transform.GetNumRows(); ii++)
-         MessageInterface::ShowMessage("   [ %s ]\n", transform.ToRowString(ii, 6).c_str());
+      MessageInterface::ShowMessage("   Rotation matrix:\n");
+      for (UnsignedInt ii = 0U; ii < 3U; ii++)
+         MessageInterface::ShowMessage("   [ %s ]\n", vnbRot.ToRowString(ii, 6).c_str());
       MessageInterface::ShowMessage("\n");
    #endif
 
-   mat = transform*mat*transform.Transpose();
+   RotateMatrix(mat, vnbRot);
 
    #ifdef DEBUG_CONVERSION
       MessageInterface::ShowMessage("   Output matrix:\n");
@@ -272,6 +261,53 @@ void ProcessNoiseBase::ConvertMatrix(Rmatrix &mat, const GmatTime &epoch)
 
 
 
+//------------------------------------------------------------------------------
+// void RotateMatrix(Rmatrix &mat, const Rmatrix33 &rot)
+//------------------------------------------------------------------------------
+/**
+ * Computes T * mat * T' in place, where T applies the rotation to the
+ * position and velocity elements and leaves the rest unchanged
+ *
+ * Only the first six rows and columns are changed, three elements at a time,
+ * so no state sized transformation matrix is built.
+ *
+ * @param mat The matrix to rotate
+ * @param rot The rotation matrix
+ */
+//------------------------------------------------------------------------------
+void ProcessNoiseBase::RotateMatrix(Rmatrix &mat, const Rmatrix33 &rot)
+{
+   UnsignedInt size = mat.GetNumRows();
+   Real v[3];
+
+   // Rows: R times each 3 element piece of a column
+   for (UnsignedInt jj = 0U; jj < size; jj++)
+   {
+      for (UnsignedInt start = 0U; start < 6U; start += 3U)
+      {
+         for (UnsignedInt kk = 0U; kk < 3U; kk++)
+            v[kk] = mat(start + kk, jj);
+         for (UnsignedInt ii = 0U; ii < 3U; ii++)
+            mat(start + ii, jj) = rot(ii, 0) * v[0] + rot(ii, 1) * v[1] +
+                  rot(ii, 2) * v[2];
+      }
+   }
+
+   // Columns: each 3 element piece of a row times R'
+   for (UnsignedInt ii = 0U; ii < size; ii++)
+   {
+      for (UnsignedInt start = 0U; start < 6U; start += 3U)
+      {
+         for (UnsignedInt kk = 0U; kk < 3U; kk++)
+            v[kk] = mat(ii, start + kk);
+         for (UnsignedInt jj = 0U; jj < 3U; jj++)
+            mat(ii, start + jj) = v[0] * rot(jj, 0) + v[1] * rot(jj, 1) +
+                  v[2] * rot(jj, 2);
+      }
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // void ConvertMatrix(Rmatrix &mat, const Real &epoch)
 //------------------------------------------------------------------------------
@@ -314,25 +350,14 @@ void ProcessNoiseBase::ConvertMatrix(Rmatrix &mat, const Real &epoch)
    cc.Convert(epoch, inState, coordinateSystem, outState, j2k, true, false);
    Rmatrix33 vnbRot = cc.GetLastRotationMatrix();
 
-   Rmatrix transform = Rmatrix::Identity(stateSize);
-
-   for (UnsignedInt ii = 0; ii < 3U; ii++)
-   {
-      for (UnsignedInt jj = 0; jj < 3U; jj++)
-      {
-         transform(ii, jj) = vnbRot(ii, jj);
-         transform(ii+3, jj+3) = vnbRot(ii, jj);
-      }
-   }
-
    #ifdef DEBUG_CONVERSION
-      MessageInterface::ShowMessage("   Transformation matrix:\n");
-      for (UnsignedInt ii = 0U; ii < transform.GetNumRows(); ii++)
-         MessageInterface::ShowMessage("   [ %s ]\n", transform.ToRowString(ii, 6).c_str());
+      MessageInterface::ShowMessage("   Rotation matrix:\n");
+      for (UnsignedInt ii = 0U; ii < 3U; ii++)
+         MessageInterface::ShowMessage("   [ %s ]\n", vnbRot.ToRowString(ii, 6).c_str());
       MessageInterface::ShowMessage("\n");
    #endif
 
-   mat = transform*mat*transform.Transpose();
+   RotateMatrix(mat, vnbRot);
 
    #ifdef DEBUG_CONVERSION
       MessageInterface::ShowMessage("   Output matrix:\n");
@@ -34,6 +34,7 @@
 #include "kalman_defs.hpp"
 #include "GmatBase.hpp"
 #include "Rmatrix66.hpp"
+#include "Rmatrix33.hpp"
 #include "CoordinateSystem.hpp"
 
 /**
@@ -105,6 +106,7 @@ protected:
 
    virtual void         ConvertMatrix(Rmatrix &mat, const GmatTime &epoch);
    virtual void         ConvertMatrix(Rmatrix &mat, const Real &epoch);
+   void                 RotateMatrix(Rmatrix &mat, const Rmatrix33 &rot);
 
    /// Parameter IDs for the ProcessNoiseBase
    enum
@@ -316,15 +316,15 @@ void Smoother::SmoothCovState(const Rmatrix &Ra, const Rmatrix &Rb, const Rvecto
 
 
 //------------------------------------------------------------------------------
-// UnsignedInt FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
-//                       std::vector<SeqEstimator::UpdateInfoType> &filterInfoVector)
+// UnsignedInt FindIndex(const SeqEstimator::UpdateInfoType &filterInfo,
+//                       const SeqEstimator::UpdateInfoStore &filterInfoVector)
 //------------------------------------------------------------------------------
 /**
  * Find the index of a filter info struct that matches the provied struct
  */
  //------------------------------------------------------------------------------
-UnsignedInt Smoother::FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
-                                std::vector<SeqEstimator::UpdateInfoType> &filterInfoVector)
+UnsignedInt Smoother::FindIndex(const SeqEstimator::UpdateInfoType &filterInfo,
+                                const SeqEstimator::UpdateInfoStore &filterInfoVector)
 {
    bool found = false;
    UnsignedInt searchIndex = 0;
@@ -338,13 +338,13 @@ UnsignedInt Smoother::FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
    {
 	   index = low + (high - low) / 2;
 
-	   if (GmatMathUtil::IsEqual(filterInfo.epoch, filterInfoVector[index].epoch, ESTTIME_ROUNDOFF))
+	   if (GmatMathUtil::IsEqual(filterInfo.epoch, filterInfoVector.GetEpoch(index), ESTTIME_ROUNDOFF))
 	   {
 		   if (ObsMatch(filterInfo, filterInfoVector[index]))
 			   return index;
 	   }
 
-	   if (filterInfoVector[index].epoch < filterInfo.epoch)
+	   if (filterInfoVector.GetEpoch(index) < filterInfo.epoch)
 		   high = index - 1;
 	   else
 		   low = index + 1; 
@@ -354,7 +354,7 @@ UnsignedInt Smoother::FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
 
    for (UnsignedInt ii = 0U; ii < filterInfoVector.size(); ii++)
    {
-      if (GmatMathUtil::IsEqual(filterInfo.epoch, filterInfoVector[ii].epoch, ESTTIME_ROUNDOFF))
+      if (GmatMathUtil::IsEqual(filterInfo.epoch, filterInfoVector.GetEpoch(ii), ESTTIME_ROUNDOFF))
       {
          found = true;
          searchIndex = ii;
@@ -373,15 +373,15 @@ UnsignedInt Smoother::FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
 
 
 //------------------------------------------------------------------------------
-// bool ObsMatch(SeqEstimator::UpdateInfoType &filterInfo1,
-//               SeqEstimator::UpdateInfoType &filterInfo2)
+// bool ObsMatch(const SeqEstimator::UpdateInfoType &filterInfo1,
+//               const SeqEstimator::UpdateInfoType &filterInfo2)
 //------------------------------------------------------------------------------
 /**
  * Find if the two filter info struct correspond to the same measurement(s)
  */
  //------------------------------------------------------------------------------
-bool Smoother::ObsMatch(SeqEstimator::UpdateInfoType &filterInfo1,
-                               SeqEstimator::UpdateInfoType &filterInfo2)
+bool Smoother::ObsMatch(const SeqEstimator::UpdateInfoType &filterInfo1,
+                               const SeqEstimator::UpdateInfoType &filterInfo2)
 {
    // See if one has a measurement while the other doesn't
    if (filterInfo1.isObs != filterInfo2.isObs)
@@ -52,10 +52,10 @@ public:
 
 protected:
    virtual void           SmoothState(SmootherInfoType &smootherStat, bool includeUpdate);
-   virtual UnsignedInt    FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
-                                    std::vector<SeqEstimator::UpdateInfoType> &filterInfoVector);
-   virtual bool           ObsMatch(SeqEstimator::UpdateInfoType &filterInfo1,
-                                   SeqEstimator::UpdateInfoType &filterInfo2);
+   virtual UnsignedInt    FindIndex(const SeqEstimator::UpdateInfoType &filterInfo,
+                                    const SeqEstimator::UpdateInfoStore &filterInfoVector);
+   virtual bool           ObsMatch(const SeqEstimator::UpdateInfoType &filterInfo1,
+                                   const SeqEstimator::UpdateInfoType &filterInfo2);
 
    virtual bool           WriteAdditionalMatData();
 
@@ -231,11 +231,12 @@ Integer SmootherBase::GetParameterID(const std::string &str) const
    if (str == "MaximumIterations")
       throw SolverException("Syntax error: '" + GetName() + "' does not has parameter '" + str + "'.\n");
 
-   for (Integer i = EstimatorParamCount; i < SmootherBaseParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - EstimatorParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, EstimatorParamCount,
+               SmootherBaseParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Estimator::GetParameterID(str);
 }
@@ -844,7 +845,7 @@ void SmootherBase::StateCleanUp()
          BeginPredicting(predictTimeSpan);
          filter->TakeAction("RunForwards");
          filter->UpdateCurrentEpoch(currentEpochGT);
-         filter->SetAnchorEpoch(forwardFilterInfo[0].epoch, false);
+         filter->SetAnchorEpoch(forwardFilterInfo.GetEpoch(0), false);
          filter->BeginPredicting(predictTimeSpan);
          currentState = PROPAGATING;
          smootherState = PREDICTING;
@@ -986,7 +987,7 @@ void SmootherBase::PrepareFilter()
 
 
 //------------------------------------------------------------------------------
-//  void SetForwardFilterInfo(std::vector<SeqEstimator::UpdateInfoType> filterInfo)
+//  void SetForwardFilterInfo(const SeqEstimator::UpdateInfoStore &filterInfo)
 //------------------------------------------------------------------------------
 /**
  * Passes the filter info from the forward filter pass to the smoother
@@ -994,7 +995,7 @@ void SmootherBase::PrepareFilter()
  * @param filterInfo The filter info to set
  */
  //------------------------------------------------------------------------------
-void SmootherBase::SetForwardFilterInfo(std::vector<SeqEstimator::UpdateInfoType> filterInfo)
+void SmootherBase::SetForwardFilterInfo(const SeqEstimator::UpdateInfoStore &filterInfo)
 {
    forwardFilterInfo = filterInfo;
    filter->forwardFilterInfo = &forwardFilterInfo;
@@ -1511,7 +1512,7 @@ void SmootherBase::CompleteInitialization()
 
    while (atFirstEpoch)
    {
-      obsAtFirstEpoch = obsAtFirstEpoch || forwardFilterInfo[ii].isObs;
+      obsAtFirstEpoch = obsAtFirstEpoch || forwardFilterInfo.IsObs(ii);
 
       if (obsAtFirstEpoch)
          break; // Don't need to keep checking
@@ -1521,10 +1522,10 @@ void SmootherBase::CompleteInitialization()
       if (ii == forwardFilterInfo.size())
          break; // Exit, we've reached the end of the vector
 
-      atFirstEpoch = GmatMathUtil::IsEqual(forwardFilterInfo[0].epoch, forwardFilterInfo[ii].epoch, ESTTIME_ROUNDOFF);
+      atFirstEpoch = GmatMathUtil::IsEqual(forwardFilterInfo.GetEpoch(0), forwardFilterInfo.GetEpoch(ii), ESTTIME_ROUNDOFF);
    }
 
-   TrimObsByEpoch(forwardFilterInfo[0].epoch, !obsAtFirstEpoch);
+   TrimObsByEpoch(forwardFilterInfo.GetEpoch(0), !obsAtFirstEpoch);
 
    // Restore the objects from the buffer
    if (esmObjBuffer.size() > 0U)
@@ -1566,12 +1567,12 @@ void SmootherBase::CompleteInitialization()
    // Use edit flags from forward filter for backward filter and smoother
    for (UnsignedInt ii = 0U; ii < forwardFilterInfo.size(); ii++)
    {
-      if (forwardFilterInfo[ii].isObs)
+      if (forwardFilterInfo.IsObs(ii))
       {
          if (!isTrimmed)
          {
-            filter->TrimObsByEpoch(forwardFilterInfo[ii].epoch, false);
-            TrimObsByEpoch(forwardFilterInfo[ii].epoch, false);
+            filter->TrimObsByEpoch(forwardFilterInfo.GetEpoch(ii), false);
+            TrimObsByEpoch(forwardFilterInfo.GetEpoch(ii), false);
             isTrimmed = true;
          }
 
@@ -1589,8 +1590,8 @@ void SmootherBase::CompleteInitialization()
 
    // Complete initialization of backwards filter
    filter->CompleteInitialization();
-   filter->SetAnchorEpoch(forwardFilterInfo[0].epoch, true);
-   filter->TrimObsByEpoch(forwardFilterInfo[0].epoch, false);
+   filter->SetAnchorEpoch(forwardFilterInfo.GetEpoch(0), true);
+   filter->TrimObsByEpoch(forwardFilterInfo.GetEpoch(0), false);
    filter->StateCleanUp();
    currentState = filter->GetState();
 }
@@ -1665,23 +1666,23 @@ void SmootherBase::FindTimeStep()
          return;
       }
 
-      if (currentEpochGT == forwardFilterInfo[filterIndex].epoch)
+      if (currentEpochGT == forwardFilterInfo.GetEpoch(filterIndex))
       {
          timeStep = 0;
 
-         if (forwardFilterInfo[filterIndex].isObs)
+         if (forwardFilterInfo.IsObs(filterIndex))
             currentState = CALCULATING;
          else
          {
             SmootherUpdate();
             filterIndex++;
-            timeStep = (forwardFilterInfo[filterIndex].epoch - currentEpochGT).GetTimeInSec();
+            timeStep = (forwardFilterInfo.GetEpoch(filterIndex) - currentEpochGT).GetTimeInSec();
             currentState = PROPAGATING;
          }
       }
       else
       {
-         timeStep = (forwardFilterInfo[filterIndex].epoch - currentEpochGT).GetTimeInSec();
+         timeStep = (forwardFilterInfo.GetEpoch(filterIndex) - currentEpochGT).GetTimeInSec();
          currentState = PROPAGATING;
       }
    }
@@ -1886,7 +1887,7 @@ void SmootherBase::CheckCompletion()
 
          backwardFilterInfo = filter->GetUpdateStats();
 
-         estimationEpochGT = forwardFilterInfo[0].epoch;
+         estimationEpochGT = forwardFilterInfo.GetEpoch(0);
          filterIndex = 0;
          MoveToNext(false);
 
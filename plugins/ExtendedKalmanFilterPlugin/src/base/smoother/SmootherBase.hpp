@@ -122,7 +122,7 @@ public:
 
    SeqEstimator*        GetFilter();
    void                 PrepareFilter();
-   void                 SetForwardFilterInfo(std::vector<SeqEstimator::UpdateInfoType> filterInfo);
+   void                 SetForwardFilterInfo(const SeqEstimator::UpdateInfoStore &filterInfo);
    void                 SetObjectBuffer(const ObjectArray &buffer);
 
    virtual bool         ResetState();
@@ -143,8 +143,8 @@ protected:
    std::string  filterName;
 
    // Filter info
-   std::vector<SeqEstimator::UpdateInfoType> forwardFilterInfo;
-   std::vector<SeqEstimator::UpdateInfoType> backwardFilterInfo;
+   SeqEstimator::UpdateInfoStore forwardFilterInfo;
+   SeqEstimator::UpdateInfoStore backwardFilterInfo;
 
    // Filter info index
    UnsignedInt filterIndex;
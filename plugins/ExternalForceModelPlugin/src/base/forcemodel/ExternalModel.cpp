@@ -32,6 +32,7 @@
 #include "PropagationStateManager.hpp"
 #include "InterfaceException.hpp"
 #include "FileManager.hpp"
+#include "DynamicLibrary.hpp"
 
 //#define DEBUG_INITIALIZATION
 //#define DEBUG_REGISTRATION
@@ -48,6 +49,7 @@ ExternalModel::PARAMETER_TEXT[ExternalParamCount - PhysicalModelParamCount] =
     "ExcludeOtherForces",
     "EntryPoint", 
 	"TorqueEntryPoint",
+    "LibraryName",
 };
 
 const Gmat::ParameterType
@@ -58,6 +60,7 @@ ExternalModel::PARAMETER_TYPE[ExternalParamCount - PhysicalModelParamCount] =
    Gmat::BOOLEAN_TYPE,
    Gmat::STRING_TYPE,  
    Gmat::STRING_TYPE,
+   Gmat::FILENAME_TYPE,
 };
            
 //---------------------------------
@@ -81,7 +84,14 @@ ExternalModel::ExternalModel(const std::string &name) :
    entryPoint               ("GetForces"),
    torqueEntryPoint         (""),
    pythonIf                 (NULL),
-   satCount                 (0)
+   satCount                 (0),
+   derivFunction            (NULL),
+   torqueFunction           (NULL),
+   libraryName              (""),
+   forceLibrary             (NULL),
+   nativeEvaluate           (NULL),
+   nativeLastError          (NULL),
+   nativeJacobian           (false)
 {
    parameterCount = ExternalParamCount;
    derivativeIds.push_back(Gmat::CARTESIAN_STATE);
@@ -109,7 +119,14 @@ ExternalModel::ExternalModel(const ExternalModel &external) :
 	entryPoint              (external.entryPoint),
 	torqueEntryPoint        (external.torqueEntryPoint),
 	pythonIf                (external.pythonIf),
-	satCount                (external.satCount)
+	satCount                (external.satCount),
+	derivFunction           (NULL),
+	torqueFunction          (NULL),
+	libraryName             (external.libraryName),
+	forceLibrary            (NULL),
+	nativeEvaluate          (NULL),
+	nativeLastError         (NULL),
+	nativeJacobian          (false)
 {
    parameterCount = ExternalParamCount;
 
@@ -139,6 +156,15 @@ ExternalModel& ExternalModel::operator=(const ExternalModel &external)
 	  torqueEntryPoint = external.torqueEntryPoint;
       pythonIf = external.pythonIf;
       satCount = external.satCount;
+      derivFunction = NULL;
+      torqueFunction = NULL;
+      libraryName = external.libraryName;
+      // The library is opened again when this model is initialized
+      delete forceLibrary;
+      forceLibrary = NULL;
+      nativeEvaluate = NULL;
+      nativeLastError = NULL;
+      nativeJacobian = false;
 	  
       isInitialized = false;
    }
@@ -155,7 +181,8 @@ ExternalModel& ExternalModel::operator=(const ExternalModel &external)
 //------------------------------------------------------------------------------
 ExternalModel::~ExternalModel()
 { 
-    
+   if (forceLibrary != NULL)
+      delete forceLibrary;
 }
 
 //------------------------------------------------------------------------------
@@ -300,6 +327,7 @@ std::string ExternalModel::GetStringParameter(const Integer id) const
 	else if (id == SCRIPT_FULLPATH) return scriptFilenameFullPath;
 	else if (id == ENTRY_POINT) return entryPoint;
 	else if (id == TORQUE_ENTRY_POINT) return torqueEntryPoint;
+	else if (id == LIBRARY_NAME) return libraryName;
 	return PhysicalModel::GetStringParameter(id);
 }
 
@@ -320,17 +348,31 @@ bool ExternalModel::SetStringParameter(const Integer id,
 	{
 		scriptFilename = value;
 		scriptFilenameFullPath = "placeholder/" + value;
+		derivFunction = NULL;
+		torqueFunction = NULL;
 
 		return true;
 	}
 	if (id == ENTRY_POINT)
 	{
 		entryPoint = value;
+		derivFunction = NULL;
 		return true;
 	}
 	if (id == TORQUE_ENTRY_POINT)
 	{
 		torqueEntryPoint = value;
+		torqueFunction = NULL;
+		return true;
+	}
+	if (id == LIBRARY_NAME)
+	{
+		libraryName = value;
+		delete forceLibrary;
+		forceLibrary = NULL;
+		nativeEvaluate = NULL;
+		nativeLastError = NULL;
+		nativeJacobian = false;
 		return true;
 	}
 	return PhysicalModel::SetStringParameter(id, value);
@@ -384,6 +426,14 @@ bool ExternalModel::Initialize()
       return false; 
       
    isInitialized = true;   
+
+   // A compiled library replaces the script, so Python is not started
+   if (libraryName != "")
+   {
+	   LoadForceLibrary();
+	   return isInitialized;
+   }
+
    try
    {
 	   pythonIf = PythonInterface::PyInstance();
@@ -401,7 +451,20 @@ bool ExternalModel::Initialize()
 	   MessageInterface::ShowMessage("  Adding %d python paths\n", paths.size());
 #endif
 	   pythonIf->PyAddModulePath(paths);
+
+	   // Look the entry points up once; the calls during propagation reuse
+	   // the function objects
+	   derivFunction = pythonIf->PyGetFunction(scriptFilename, entryPoint);
+	   torqueFunction = NULL;
+	   if (torqueEntryPoint != "")
+		   torqueFunction = pythonIf->PyGetFunction(scriptFilename,
+			   torqueEntryPoint);
    }   
+   catch (BaseException &ex)
+   {
+	   throw InterfaceException("The external force model could not load "
+		   "its Python functions:\n" + ex.GetFullMessage());
+   }
    catch (...)
    {
 	   throw InterfaceException("An unhandled Python exception was thrown during "
@@ -429,35 +492,90 @@ bool ExternalModel::GetDerivatives(Real *state, Real dt, Integer order,
 
 	Real now = epoch + (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
 
+	if (nativeEvaluate != NULL)
+	{
+		// One call covers every spacecraft, and the Jacobian when needed
+		Real *jacobian = NULL;
+		if (fillSTM || fillAMatrix)
+		{
+			if (!nativeJacobian)
+				throw ODEModelException("The external force library " +
+					libraryName + " does not provide the Jacobian needed to "
+					"propagate the STM or the A-matrix");
+			if ((Integer)nativeJacobianBuffer.size() < satCount * 36)
+				nativeJacobianBuffer.resize(satCount * 36);
+			jacobian = &nativeJacobianBuffer[0];
+		}
+
+		Real *dv = deriv + cartesianStart;
+		if (!fillCartesian)
+		{
+			if ((Integer)nativeDerivBuffer.size() < satCount * 6)
+				nativeDerivBuffer.resize(satCount * 6);
+			dv = &nativeDerivBuffer[0];
+		}
+		NativeDerivatives(state + cartesianStart, now, dv, order, satCount,
+			jacobian);
+
+		if (fillSTM || fillAMatrix)
+		{
+			Integer aiCount = (fillSTM ? stmCount : aMatrixCount);
+			Integer s6 = stmStart;
+			Integer a6 = aMatrixStart;
+
+			for (Integer i = 0; i < aiCount; ++i)
+			{
+				// The spacecraft whose Cartesian state goes with this matrix
+				Integer associate = theState->GetAssociateIndex(fillSTM ? s6 : a6);
+				const Real *jac = jacobian + 6 * (associate - cartesianStart);
+
+				Spacecraft *sc = (Spacecraft*)scObjs[i];
+				stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");
+				Integer stmSize = stmRowCount * stmRowCount;
+				if ((Integer)aTildeBuffer.size() < stmSize)
+					aTildeBuffer.resize(stmSize);
+				Real *aTilde = &aTildeBuffer[0];
+				for (Integer j = 0; j < stmSize; ++j)
+					aTilde[j] = 0.0;
+
+				// Acceleration rows only; the ODEModel fills the velocity rows
+				for (Integer j = 3; j < 6; ++j)
+					for (Integer k = 0; k < 6; ++k)
+						aTilde[j * stmRowCount + k] = jac[j * 6 + k];
+
+				for (Integer j = 0; j < stmSize; ++j)
+				{
+					if (fillSTM)
+						deriv[s6 + j] = aTilde[j];
+					if (fillAMatrix)
+						deriv[a6 + j] = aTilde[j];
+				}
+
+				if (fillSTM)
+					s6 = s6 + stmSize;
+				if (fillAMatrix)
+					a6 = a6 + stmSize;
+			}
+		}
+
+		return true;
+	}
+
 	if (fillCartesian)
 	{
+		// Each spacecraft's state is viewed, not copied, by the script, and
+		// the returned derivative is written straight into deriv
 		for (Integer i = 0; i < satCount; i++)
 		{
 			i6 = cartesianStart + i * 6;
-			Real * st = new Real[dimension];
-			Real * dv = new Real[dimension];
-
-			st[0] = state[i6];
-			st[1] = state[i6 + 1];
-			st[2] = state[i6 + 2];
-			st[3] = state[i6 + 3];
-			st[4] = state[i6 + 4];
-			st[5] = state[i6 + 5];
-
-			dv = PythonDerivatives(st, now, order);
-
-			deriv[i6] = dv[0];
-			deriv[i6 + 1] = dv[1];
-			deriv[i6 + 2] = dv[2];
-			deriv[i6 + 3] = dv[3];
-			deriv[i6 + 4] = dv[4];
-			deriv[i6 + 5] = dv[5];
+			PythonDerivatives(state + i6, now, deriv + i6, order);
 		}
 	}
 
 	if (fillSTM || fillAMatrix)
 	{
-		throw ODEModelException("fillSTM and fillAMatric are currently not supported");
+		throw ODEModelException("fillSTM and fillAMatric are currently only "
+			"supported by external force libraries");
 		return false;
 	}
 
@@ -465,28 +583,27 @@ bool ExternalModel::GetDerivatives(Real *state, Real dt, Integer order,
 }
 
 //------------------------------------------------------------------------------
-// bool ExternalModel::PythonDerivatives()(Real * state, Real dt, Integer order)
+// void ExternalModel::PythonDerivatives(const Real *state, Real now,
+//       Real *deriv, Integer order)
 //------------------------------------------------------------------------------
 /**
- * Calls the python function 
+ * Calls the python function for one spacecraft
  *
- * @param state  The current state vector
+ * @param state  The 6 element Cartesian state of the spacecraft
  * @param now    The time to calculate at
- * @param ep     Entry Point for the python file 
+ * @param deriv  The 6 element buffer receiving the derivative vector
  * @param order  Order of the derivative being calculated
- *
- * @return The derivative vector
  */
  //------------------------------------------------------------------------------
-Real* ExternalModel::PythonDerivatives(Real *state, Real now, Integer order,
-	const Integer id) {
-
-	PyObject* pyRet;
-	Real * div = new Real[dimension];
+void ExternalModel::PythonDerivatives(const Real *state, Real now, Real *deriv,
+	Integer order) {
 
 	try
 	{
-		pyRet = pythonIf->PyExternalFunctionWrapper(scriptFilename, entryPoint, state, now, order, 3);
+		if (derivFunction == NULL)
+			derivFunction = pythonIf->PyGetFunction(scriptFilename, entryPoint);
+		pythonIf->PyStateFunctionWrapper(derivFunction, state, 6, now, order,
+			deriv, 6);
 	}	
 	catch (BaseException &ex)
 	{
@@ -497,16 +614,137 @@ Real* ExternalModel::PythonDerivatives(Real *state, Real now, Integer order,
 	{
 		throw InterfaceException("An unhandled Python exception was thrown during execution");
 	}
+}
+
+
+//------------------------------------------------------------------------------
+// void NativeDerivatives(const Real *state, Real now, Real *deriv,
+//       Integer order, Integer count, Real *jacobian)
+//------------------------------------------------------------------------------
+/**
+ * Calls the compiled force library
+ *
+ * @param state    The Cartesian states, 6 elements per spacecraft
+ * @param now      The time to calculate at
+ * @param deriv    Buffer receiving the derivative vectors, 6 per spacecraft
+ * @param order    Order of the derivative being calculated
+ * @param count    The number of spacecraft
+ * @param jacobian NULL, or the buffer receiving a 6x6 Jacobian per spacecraft
+ */
+//------------------------------------------------------------------------------
+void ExternalModel::NativeDerivatives(const Real *state, Real now, Real *deriv,
+	Integer order, Integer count, Real *jacobian)
+{
+	if (nativeEvaluate == NULL)
+		LoadForceLibrary();
+
+	if (nativeEvaluate(now, order, count, state, deriv, jacobian) != 0)
+	{
+		std::string reason;
+		if (nativeLastError != NULL)
+		{
+			const char *msg = nativeLastError();
+			if (msg != NULL)
+				reason = msg;
+		}
+		throw ODEModelException("The external force library " + libraryName +
+			" failed to evaluate the derivatives" +
+			(reason == "" ? std::string("") : ": " + reason));
+	}
+}
+
+
+//------------------------------------------------------------------------------
+// void LoadForceLibrary()
+//------------------------------------------------------------------------------
+/**
+ * Opens the compiled force library and finds its functions
+ *
+ * LibraryName is a file name, with or without a path and extension, that is
+ * located the way GMAT locates plugin libraries.
+ */
+//------------------------------------------------------------------------------
+void ExternalModel::LoadForceLibrary()
+{
+	if (nativeEvaluate != NULL)
+		return;
+
+	std::string libPath = "./";
+	std::string libName = libraryName;
+	std::string::size_type loc = libName.find_last_of("/\\");
+	if (loc != std::string::npos)
+	{
+		libPath = libName.substr(0, loc + 1);
+		libName = libName.substr(loc + 1);
+	}
+	// DynamicLibrary adds the extension for the platform
+	loc = libName.find_last_of('.');
+	if (loc != std::string::npos)
+	{
+		std::string ext = libName.substr(loc);
+		if ((ext == ".so") || (ext == ".dylib") || (ext == ".dll"))
+			libName = libName.substr(0, loc);
+	}
+
+	delete forceLibrary;
+	forceLibrary = new DynamicLibrary(libName, libPath);
+	if (!forceLibrary->LoadDynamicLibrary())
+	{
+		delete forceLibrary;
+		forceLibrary = NULL;
+		throw ODEModelException("The external force library " + libraryName +
+			" could not be loaded");
+	}
 
-	if (pyRet) {
-		for (Integer i = 0; i < dimension; ++i)
+	try
+	{
+		GmatExternalForceAbiVersionFunction abiVersion =
+			(GmatExternalForceAbiVersionFunction)
+			forceLibrary->GetFunction("GmatExternalForceAbiVersion");
+		if (abiVersion() != GMAT_EXTERNAL_FORCE_ABI_VERSION)
 		{
-			PyObject* pyItem = PyList_GetItem(pyRet, i);
-			div[i] = PyFloat_AsDouble(pyItem);
+			std::stringstream msg;
+			msg << "The external force library " << libraryName
+				<< " was built for interface version " << abiVersion()
+				<< "; this GMAT uses version " << GMAT_EXTERNAL_FORCE_ABI_VERSION;
+			throw ODEModelException(msg.str());
 		}
+		nativeEvaluate = (GmatExternalForceEvaluateFunction)
+			forceLibrary->GetFunction("GmatExternalForceEvaluate");
+	}
+	catch (GmatBaseException &ex)
+	{
+		delete forceLibrary;
+		forceLibrary = NULL;
+		throw ODEModelException(ex.GetFullMessage());
+	}
+
+	// The remaining functions are optional
+	try
+	{
+		GmatExternalForceHasJacobianFunction hasJacobian =
+			(GmatExternalForceHasJacobianFunction)
+			forceLibrary->GetFunction("GmatExternalForceHasJacobian");
+		nativeJacobian = (hasJacobian() != 0);
+	}
+	catch (GmatBaseException &)
+	{
+		nativeJacobian = false;
+	}
+	try
+	{
+		nativeLastError = (GmatExternalForceLastErrorFunction)
+			forceLibrary->GetFunction("GmatExternalForceLastError");
+	}
+	catch (GmatBaseException &)
+	{
+		nativeLastError = NULL;
 	}
 
-	return div;
+	#ifdef DEBUG_INITIALIZATION
+		MessageInterface::ShowMessage("ExternalModel loaded %s; Jacobian %s\n",
+			libraryName.c_str(), (nativeJacobian ? "provided" : "not provided"));
+	#endif
 }
 
 
@@ -523,7 +761,7 @@ Real* ExternalModel::PythonDerivatives(Real *state, Real now, Integer order,
 //------------------------------------------------------------------------------
 Rvector6 ExternalModel::GetDerivativesForSpacecraft(Spacecraft *sc)
 {   
-	Rvector6 dv;
+	Real dv[6];
 	Real *j2kState = sc->GetState().GetState();
 	Real state[6];
 	Real now = sc->GetEpoch();
@@ -532,15 +770,17 @@ Rvector6 ExternalModel::GetDerivativesForSpacecraft(Spacecraft *sc)
 	if (hasPrecisionTime)
 	{
 		BuildModelStateGT(nowgt, state, j2kState);
-		dv = PythonDerivatives(state, nowgt.GetMjd());
+		now = nowgt.GetMjd();
 	}
 	else
-	{
 		BuildModelState(now, state, j2kState);
-		dv = PythonDerivatives(state, now);
-	}	
 
-   return dv;
+	if (nativeEvaluate != NULL)
+		NativeDerivatives(state, now, dv);
+	else
+		PythonDerivatives(state, now, dv);
+
+   return Rvector6(dv[0], dv[1], dv[2], dv[3], dv[4], dv[5]);
 }
 
 
@@ -583,11 +823,12 @@ bool ExternalModel::SupportsDerivative(Gmat::StateElementId id)
    if (id == Gmat::CARTESIAN_STATE)
       return true;
    
+   // Only a compiled library can supply the Jacobian
    if (id == Gmat::ORBIT_STATE_TRANSITION_MATRIX)
-      return false;
+      return (libraryName != "");
    
    if (id == Gmat::ORBIT_A_MATRIX)
-      return false;
+      return (libraryName != "");
 
    return PhysicalModel::SupportsDerivative(id);
 }
@@ -636,7 +877,7 @@ bool ExternalModel::SetStart(Gmat::StateElementId id, Integer index,
          stmStart = index;
          fillSTM = true;
          totalSTMSize = totalSize;
-         retval = false;
+         retval = (libraryName != "");
          break;
          
       case Gmat::ORBIT_A_MATRIX:
@@ -644,7 +885,7 @@ bool ExternalModel::SetStart(Gmat::StateElementId id, Integer index,
          aMatrixStart = index;
          fillAMatrix = true;
          totalSTMSize = totalSize;
-         retval = false;
+         retval = (libraryName != "");
          break;
 
       default:
@@ -667,28 +908,32 @@ Rvector3 ExternalModel::GetTorquesForSpacecraft(Spacecraft *sc)
 {
    //Work in Progress
    Rvector3 torque; 
-   if (torqueEntryPoint == "")
+   // Torques come only from the script; libraries supply forces
+   if ((torqueEntryPoint == "") || (libraryName != ""))
 	   return torque;
 
    Real *j2kState = sc->GetState().GetState();
    Real state[6];
    Real now = sc->GetEpoch();
    GmatTime nowgt = sc->GetEpochGT();
-   PyObject* pyRet;  
+   Real values[3];
 
    try
    {
+	   if (torqueFunction == NULL)
+		   torqueFunction = pythonIf->PyGetFunction(scriptFilename,
+			   torqueEntryPoint);
+
 	   if (hasPrecisionTime)
 	   {
 		   BuildModelStateGT(nowgt, state, j2kState);
-		   pyRet = pythonIf->PyExternalFunctionWrapper(scriptFilename, torqueEntryPoint, state, nowgt.GetMjd(), 1, 3);
+		   now = nowgt.GetMjd();
 	   }
 	   else
-	   {
 		   BuildModelState(now, state, j2kState);
-		   pyRet = pythonIf->PyExternalFunctionWrapper(scriptFilename, torqueEntryPoint, state, now, 1, 3);
-	   }
-	  
+
+	   pythonIf->PyStateFunctionWrapper(torqueFunction, state, 6, now, 1,
+		   values, 3);
    }
    catch (BaseException &ex)
    {
@@ -700,13 +945,7 @@ Rvector3 ExternalModel::GetTorquesForSpacecraft(Spacecraft *sc)
 	   throw InterfaceException("An unhandled Python exception was thrown during Torque execution");
    }
 
-   if (pyRet) {
-	   for (Integer i = 0; i < 3; ++i)
-	   {
-		   PyObject* pyItem = PyList_GetItem(pyRet, i);
-		   torque[i] = PyFloat_AsDouble(pyItem);
-	   }
-   }
+   torque.Set(values[0], values[1], values[2]);
 
    return torque;
 }
\ No newline at end of file
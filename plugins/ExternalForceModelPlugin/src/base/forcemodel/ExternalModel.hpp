@@ -33,6 +33,9 @@
 #include "Rvector6.hpp"
 #include "gmatdefs.hpp"
 #include "PythonInterface.hpp"
+#include "ExternalForceFunctions.h"
+
+class DynamicLibrary;
 
 
 class EXTERNALMODEL_API ExternalModel : public PhysicalModel
@@ -48,8 +51,10 @@ public:
    virtual bool Initialize();
    virtual bool GetDerivatives(Real *state, Real dt = 0.0, Integer order = 1, 
                                const Integer id = -1);
-   virtual Real* PythonDerivatives(Real *state, Real now, Integer order = 1,
-	   const Integer id = -1);
+   virtual void PythonDerivatives(const Real *state, Real now, Real *deriv,
+	   Integer order = 1);
+   virtual void NativeDerivatives(const Real *state, Real now, Real *deriv,
+	   Integer order = 1, Integer count = 1, Real *jacobian = NULL);
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
 
    // inherited from GmatBase
@@ -103,6 +108,30 @@ protected:
    PythonInterface *pythonIf;
    /// Number of spacecraft in the state vector that use CartesianState
    Integer          satCount;
+   /// The entry point function, owned by the PythonInterface function cache
+   PyObject         *derivFunction;
+   /// The torque entry point function, owned by the same cache
+   PyObject         *torqueFunction;
+   /// Compiled force library used in place of the script, if set
+   std::string      libraryName;
+   /// The loaded force library
+   DynamicLibrary   *forceLibrary;
+   /// The library's evaluation function
+   GmatExternalForceEvaluateFunction
+                    nativeEvaluate;
+   /// The library's error reporting function, if it has one
+   GmatExternalForceLastErrorFunction
+                    nativeLastError;
+   /// Flag indicating that the library fills the Jacobian
+   bool             nativeJacobian;
+   /// Derivatives from the library when the Cartesian state is not filled
+   RealArray        nativeDerivBuffer;
+   /// Jacobians from the library, 36 values per spacecraft
+   RealArray        nativeJacobianBuffer;
+   /// A-tilde matrix for the STM and A-matrix rows
+   RealArray        aTildeBuffer;
+
+   void             LoadForceLibrary();
 
 
 
@@ -116,6 +145,7 @@ private:
       EXCLUDE_OTHER_FORCES,
       ENTRY_POINT,  
 	  TORQUE_ENTRY_POINT,
+      LIBRARY_NAME,
       ExternalParamCount  // Count of the parameters for this class
    };
    
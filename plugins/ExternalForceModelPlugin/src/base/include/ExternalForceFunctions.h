@@ -0,0 +1,92 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           ExternalForceFunctions
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Note: Since this is pure C code, the file header excludes the Doxygen comment
+//       tag usually part of GMAT file prefaces.
+/* *
+ * Functions a compiled force library exports for the ExternalModel
+ *
+ * An ExternalModel with LibraryName set loads the library at initialization
+ * and calls it in place of the Python script.  This header is the whole
+ * interface; a library includes it and needs nothing else from GMAT.
+ *
+ * Required functions:
+ *
+ *    int GmatExternalForceAbiVersion(void);
+ *       Returns GMAT_EXTERNAL_FORCE_ABI_VERSION as the library was built.
+ *
+ *    int GmatExternalForceEvaluate(double epoch, int order, int satCount,
+ *                                  const double *state, double *deriv,
+ *                                  double *jacobian);
+ *       epoch    A.1 modified Julian date (days from 05-JAN-1941 12:00:00)
+ *       order    Order of the derivative requested by the integrator
+ *       satCount Number of spacecraft
+ *       state    satCount Cartesian states, 6 values each (km, km/s), in
+ *                the force model's coordinate system
+ *       deriv    Receives satCount derivative vectors, 6 values each,
+ *                laid out as the Python entry point's return value
+ *       jacobian NULL, or receives satCount row major 6x6 matrices of the
+ *                partials of deriv with respect to state.  Only rows 3 to 5,
+ *                the acceleration partials, are used; GMAT supplies the
+ *                velocity rows itself.
+ *       Returns 0 on success, and any other value on failure.
+ *
+ * Optional functions:
+ *
+ *    int GmatExternalForceHasJacobian(void);
+ *       Returns nonzero if Evaluate fills the jacobian.  Without it the
+ *       model cannot be used when propagating the STM or the A-matrix.
+ *
+ *    const char *GmatExternalForceLastError(void);
+ *       Returns a description of the last failure, reported by GMAT when
+ *       Evaluate returns nonzero.
+ *
+ * The buffers belong to GMAT and are only valid during the call.  GMAT makes
+ * the calls from one thread at a time for each ExternalModel.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef ExternalForceFunctions_h
+#define ExternalForceFunctions_h
+
+/// Version of this interface; changes whenever a signature changes
+#define GMAT_EXTERNAL_FORCE_ABI_VERSION 1
+
+#ifdef _WIN32
+   #define GMAT_EXTERNAL_FORCE_EXPORT __declspec(dllexport)
+#else
+   #define GMAT_EXTERNAL_FORCE_EXPORT __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int (*GmatExternalForceAbiVersionFunction)(void);
+typedef int (*GmatExternalForceEvaluateFunction)(double epoch, int order,
+      int satCount, const double *state, double *deriv, double *jacobian);
+typedef int (*GmatExternalForceHasJacobianFunction)(void);
+typedef const char *(*GmatExternalForceLastErrorFunction)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ExternalForceFunctions_h */
@@ -22,6 +22,9 @@
 #include "gmatdefs.hpp"
 #include "ExtraPropagatorFactory.hpp"
 #include "BulirschStoer.hpp"
+#include "GaussJackson8.hpp"
+#include "TaylorSeries.hpp"
+#include "Symplectic.hpp"
 
 #include "MessageInterface.hpp"
 
@@ -61,6 +64,12 @@ Propagator* ExtraPropagatorFactory::CreatePropagator(const std::string &ofType,
 {
    if (ofType == "BulirschStoer")
       return new BulirschStoer(withName);
+   if (ofType == "GaussJackson8")
+      return new GaussJackson8(withName);
+   if (ofType == "TaylorSeries")
+      return new TaylorSeries(withName);
+   if (ofType == "Symplectic")
+      return new Symplectic(withName);
    return NULL;
 }
 
@@ -79,6 +88,9 @@ ExtraPropagatorFactory::ExtraPropagatorFactory() :
    if (creatables.empty())
    {
       creatables.push_back("BulirschStoer");
+      creatables.push_back("GaussJackson8");
+      creatables.push_back("TaylorSeries");
+      creatables.push_back("Symplectic");
    }
 }
 
@@ -113,6 +125,9 @@ ExtraPropagatorFactory::ExtraPropagatorFactory(const ExtraPropagatorFactory& fac
    if (creatables.empty())
    {
       creatables.push_back("BulirschStoer");
+      creatables.push_back("GaussJackson8");
+      creatables.push_back("TaylorSeries");
+      creatables.push_back("Symplectic");
    }
 }
 
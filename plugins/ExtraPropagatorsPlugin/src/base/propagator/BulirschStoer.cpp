@@ -103,6 +103,8 @@ BulirschStoer::BulirschStoer(const std::string &nomme) :
    estimates                       (NULL),
    mstate                          (NULL),
    nstate                          (NULL),
+   startDerivatives                (NULL),
+   startDerivativesSet             (false),
    estimatedState                  (NULL),
    subinterval                     (NULL),
 //   mintolerance                    (1.0e-12),
@@ -159,6 +161,9 @@ BulirschStoer::~BulirschStoer()
 
    if (nstate)
       delete [] nstate;
+
+   if (startDerivatives)
+      delete [] startDerivatives;
 }
 
 //------------------------------------------------------------------------------
@@ -182,6 +187,8 @@ BulirschStoer::BulirschStoer(const BulirschStoer& bs) :
    estimates                       (NULL),
    mstate                          (NULL),
    nstate                          (NULL),
+   startDerivatives                (NULL),
+   startDerivativesSet             (false),
    estimatedState                  (NULL),
    subinterval                     (NULL),
 //   mintolerance                    (bs.mintolerance),
@@ -224,6 +231,8 @@ BulirschStoer& BulirschStoer::operator=(const BulirschStoer& bs)
    estimates          = NULL;
    mstate             = NULL;
    nstate             = NULL;
+   startDerivatives   = NULL;
+   startDerivativesSet = false;
    estimatedState     = NULL;
    subinterval        = NULL;
 //   mintolerance       = bs.mintolerance;
@@ -347,6 +356,12 @@ bool BulirschStoer::Initialize()
          nstate = NULL;
       }
 
+      if (startDerivatives)
+      {
+         delete [] startDerivatives;
+         startDerivatives = NULL;
+      }
+
       // Now rebuild the data structures
       errorEstimates = new Real[dimension];
       if (!errorEstimates)
@@ -398,6 +413,22 @@ bool BulirschStoer::Initialize()
          return isInitialized;
       }
 
+      startDerivatives = new Real[dimension];
+      if (!startDerivatives)
+      {
+         delete [] nstate;
+         nstate = NULL;
+         delete [] mstate;
+         mstate = NULL;
+         delete [] estimatedState;
+         estimatedState = NULL;
+         delete [] errorEstimates;
+         errorEstimates = NULL;
+         delete [] coeffC;
+         coeffC = NULL;
+         return isInitialized;
+      }
+
       // Now do the 2-dimensional arrays
       for (i = 0; i < depth; ++i)
       {
@@ -768,6 +799,9 @@ bool BulirschStoer::Step(void)
     Real tnew = 0.0; // waw: 06/28/04 Initialized
     Real eEstimate = 0.0; // waw: 06/28/04 Initialized
 
+    // The start state is the same for every level and every retry
+    startDerivativesSet = false;
+
     do
         {
         tnew = stepSize;
@@ -789,6 +823,12 @@ bool BulirschStoer::Step(void)
                     return false;
                 break;
             }
+
+            // Reject the step as soon as it cannot converge in the expected
+            // column, rather than filling in the rest of the tableau
+            if ((kused > 1) && ((kused >= kopt - 1) || first) &&
+                IsConvergenceUnlikely(eEstimate))
+                break;
         }
 
         if (!converged)
@@ -890,10 +930,15 @@ bool BulirschStoer::MidpointMethod(Integer substeps)
 
     memcpy(mstate, inState, dimension * sizeof(Real));
 
-    if (!physicalModel->GetDerivatives(mstate))
-        return false;
+    if (!startDerivativesSet)
+    {
+        if (!physicalModel->GetDerivatives(mstate))
+            return false;
+        memcpy(startDerivatives, ddt, dimension * sizeof(Real));
+        startDerivativesSet = true;
+    }
     for (j = 0; j < dimension; ++j)
-        nstate[j] = mstate[j] + substepsize * ddt[j];
+        nstate[j] = mstate[j] + substepsize * startDerivatives[j];
 
     for (i = 1; i < substeps; ++i)
         {
@@ -1143,6 +1188,36 @@ bool BulirschStoer::AdaptStep(Real maxerror)
     return true;
 }
 
+//------------------------------------------------------------------------------
+//  IsConvergenceUnlikely(Real maxerror)
+//------------------------------------------------------------------------------
+/**
+ * Order window test for the Bulirsch-Stoer Integrator.
+ * Checks, at the current level, whether the step can still be expected to
+ * converge within the optimal column found on earlier steps.  The step is
+ * abandoned when the level is already past that column, or when it is at the
+ * column and the error is too large to be removed by one more level.  In
+ * either case AdaptStep() then reduces the step using the same factors it
+ * applies after a full pass through the tableau.
+ *
+ * @param maxerror  The largest relative error estimate at the current level
+ * @return true if the step should be rejected now
+ */
+//------------------------------------------------------------------------------
+bool BulirschStoer::IsConvergenceUnlikely(Real maxerror)
+{
+    if (kused == kopt+1)
+        return true;
+
+    if (kused == kopt)
+    {
+        Real errkm = pow(maxerror/(bs_safety1 * tolerance), 1.0 / (2*kused+1));
+        return (alpha[kopt-1][kopt] < errkm);
+    }
+
+    return false;
+}
+
 //------------------------------------------------------------------------------
 // std::string GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
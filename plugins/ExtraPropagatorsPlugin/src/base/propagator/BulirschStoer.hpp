@@ -91,6 +91,7 @@ public:
    virtual bool PolyExtrapolate(void);
    Real EstimateError(void);
    bool AdaptStep(Real maxerror);
+   bool IsConvergenceUnlikely(Real maxerror);
 
    // Parameter accessor methods -- overridden from GmatBase
    virtual std::string         GetParameterText(const Integer id) const;
@@ -141,6 +142,10 @@ private:
    Real *mstate;
    /// Working states for the midpoint method
    Real *nstate;
+   /// Derivatives at the start of the step, shared by every level and retry
+   Real *startDerivatives;
+   /// Flag indicating that startDerivatives holds data for the current step
+   bool startDerivativesSet;
    /// The estimated state
    Real *estimatedState;
    /// Array containing number of subintervals at each level
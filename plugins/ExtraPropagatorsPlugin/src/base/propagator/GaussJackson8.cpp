@@ -0,0 +1,1118 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               GaussJackson8
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the fixed step, eighth order Gauss-Jackson integrator.
+ */
+//------------------------------------------------------------------------------
+
+#include "GaussJackson8.hpp"
+#include "RungeKutta89.hpp"
+#include "ODEModel.hpp"
+#include "PropagationStateManager.hpp"
+#include "MessageInterface.hpp"
+#include <string.h>
+#include <math.h>
+
+//#define DEBUG_PROPAGATION
+
+
+//---------------------------------
+// static data
+//---------------------------------
+
+/**
+ * Series coefficients, in powers of the derivative operator, of the difference
+ * between the integral and the first sum: -B(2n)/(2n)!
+ */
+const Real GaussJackson8::FIRST_SUM_TERMS[4] =
+{
+   -1.0 / 12.0, 1.0 / 720.0, -1.0 / 30240.0, 1.0 / 1209600.0
+};
+
+/**
+ * Series coefficients, in powers of the derivative operator, of the difference
+ * between the double integral and the second sum: (2n-1) B(2n)/(2n)!
+ */
+const Real GaussJackson8::SECOND_SUM_TERMS[5] =
+{
+   1.0 / 12.0, -1.0 / 240.0, 1.0 / 6048.0, -1.0 / 172800.0, 1.0 / 5322240.0
+};
+
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// GaussJackson8(const std::string &nomme)
+//------------------------------------------------------------------------------
+/**
+ * The constructor
+ *
+ * @param nomme The name of the new propagator
+ */
+//------------------------------------------------------------------------------
+GaussJackson8::GaussJackson8(const std::string &nomme) :
+   Integrator              ("GaussJackson8", nomme),
+   starter                 (NULL),
+   history                 (NULL),
+   firstSum                (NULL),
+   secondSum               (NULL),
+   nextSecondSum           (NULL),
+   predicted               (NULL),
+   corrected               (NULL),
+   midState                (NULL),
+   lastState               (NULL),
+   velocityIndex           (NULL),
+   pointCount              (0),
+   gridStep                (0.0),
+   restartPending          (false),
+   lastTime                (0.0),
+   maxError                (0.0),
+   historySaved            (false),
+   savedTime               (0.0),
+   savedHistory            (NULL),
+   savedFirstSum           (NULL),
+   savedSecondSum          (NULL),
+   savedMidState           (NULL),
+   savedState              (NULL),
+   savedPointCount         (0),
+   savedGridStep           (0.0)
+{
+   BuildCoefficients();
+}
+
+
+//------------------------------------------------------------------------------
+// ~GaussJackson8()
+//------------------------------------------------------------------------------
+/**
+ * The destructor
+ */
+//------------------------------------------------------------------------------
+GaussJackson8::~GaussJackson8()
+{
+   FreeArrays();
+   if (starter)
+      delete starter;
+}
+
+
+//------------------------------------------------------------------------------
+// GaussJackson8(const GaussJackson8& gj)
+//------------------------------------------------------------------------------
+/**
+ * The copy constructor
+ *
+ * The back points are not copied; the copy starts itself when it is
+ * initialized.
+ *
+ * @param gj The propagator that supplies data for this one
+ */
+//------------------------------------------------------------------------------
+GaussJackson8::GaussJackson8(const GaussJackson8& gj) :
+   Integrator              (gj),
+   starter                 (NULL),
+   history                 (NULL),
+   firstSum                (NULL),
+   secondSum               (NULL),
+   nextSecondSum           (NULL),
+   predicted               (NULL),
+   corrected               (NULL),
+   midState                (NULL),
+   lastState               (NULL),
+   velocityIndex           (NULL),
+   pointCount              (0),
+   gridStep                (0.0),
+   restartPending          (false),
+   lastTime                (0.0),
+   maxError                (0.0),
+   historySaved            (false),
+   savedTime               (0.0),
+   savedHistory            (NULL),
+   savedFirstSum           (NULL),
+   savedSecondSum          (NULL),
+   savedMidState           (NULL),
+   savedState              (NULL),
+   savedPointCount         (0),
+   savedGridStep           (0.0)
+{
+   BuildCoefficients();
+}
+
+
+//------------------------------------------------------------------------------
+// GaussJackson8& operator=(const GaussJackson8& gj)
+//------------------------------------------------------------------------------
+/**
+ * The assignment operator
+ *
+ * @param gj The propagator that supplies data for this one
+ *
+ * @return This propagator, configured to match gj
+ */
+//------------------------------------------------------------------------------
+GaussJackson8& GaussJackson8::operator=(const GaussJackson8& gj)
+{
+   if (this == &gj)
+      return *this;
+
+   FreeArrays();
+   if (starter)
+      delete starter;
+   starter = NULL;
+
+   Integrator::operator=(gj);
+
+   pointCount     = 0;
+   restartPending = false;
+   maxError       = 0.0;
+   isInitialized  = false;
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Method used to create a copy of the object
+ *
+ * @return A clone of this instance
+ */
+//------------------------------------------------------------------------------
+GmatBase* GaussJackson8::Clone() const
+{
+   return new GaussJackson8(*this);
+}
+
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Sets up the integrator and its starter for propagation
+ *
+ * The arrays are sized for the physical model, and the back points are
+ * cleared so that the next step starts the integrator.
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson8::Initialize()
+{
+   Propagator::Initialize();
+
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("Initializing %s\n", typeName.c_str());
+   #endif
+
+   if (physicalModel == NULL)
+   {
+      isInitialized = false;
+      return isInitialized;
+   }
+
+   dimension = physicalModel->GetDimension();
+   if (!AllocateArrays())
+   {
+      isInitialized = false;
+      return isInitialized;
+   }
+
+   ddt = physicalModel->GetDerivativeArray();
+
+   if (starter == NULL)
+      starter = new RungeKutta89;
+
+   starter->SetPhysicalModel(physicalModel);
+   starter->SetRealParameter("InitialStepSize", stepSize);
+   starter->SetBooleanParameter(STOP_IF_ACCURACY_VIOLATED,
+         stopIfAccuracyViolated);
+   starter->SetRealParameter(ACCURACY, tolerance);
+   starter->SetRealParameter(MIN_STEP, minimumStep);
+   starter->SetRealParameter(MAX_STEP, maximumStep);
+   starter->TakeAction("ChangeTypeSourceString", "Starter for Gauss-Jackson");
+   starter->Initialize();
+
+   inState  = physicalModel->GetState();
+   outState = physicalModel->GetState();
+
+   pointCount     = 0;
+   restartPending = false;
+   historySaved   = false;
+   accuracyWarningTriggered = false;
+
+   return isInitialized;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step()
+//------------------------------------------------------------------------------
+/**
+ * Advances the state by one step
+ *
+ * The step is the fixed step size of the integrator, limited by the maximum
+ * step settings.  The integrator starts again after a step that the force
+ * model cut short.
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson8::Step()
+{
+   if (!isInitialized)
+      return false;
+
+   if (stepSize == 0.0)
+      return false;
+
+   PrepareHistory(stepSize);
+
+   Real h = stepSize;
+   if (fabs(h) > maximumStep)
+      h = (h > 0.0 ? maximumStep : -maximumStep);
+
+   Real forceMaxStep = physicalModel->GetForceMaxStep(h > 0.0);
+   if ((fabs(h) > fabs(forceMaxStep)) && (forceMaxStep != 0.0))
+      return TakePartialStep(forceMaxStep);
+
+   return TakeStep(h);
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step(Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Advances the state across a specified interval
+ *
+ * The interval is covered with fixed steps; any remainder shorter than the
+ * step is taken as a partial step at the end of the interval.
+ *
+ * @param dt The interval
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson8::Step(Real dt)
+{
+   if (!isInitialized)
+      return false;
+
+   if (dt == 0.0)
+   {
+      stepTaken = 0.0;
+      return true;
+   }
+
+   PrepareHistory(dt);
+
+   Real h = fabs(stepSize);
+   if (h > maximumStep)
+      h = maximumStep;
+   if (h == 0.0)
+      h = fabs(dt);
+   if (dt < 0.0)
+      h = -h;
+
+   timeleft = dt;
+   while (fabs(timeleft) > smallestTime)
+   {
+      Real forceMaxStep = physicalModel->GetForceMaxStep(h > 0.0);
+      bool retval;
+
+      if ((forceMaxStep != 0.0) && (fabs(forceMaxStep) < fabs(h)) &&
+          (fabs(forceMaxStep) < fabs(timeleft)))
+         retval = TakePartialStep(forceMaxStep);
+      else if (fabs(timeleft) >= fabs(h) - smallestTime)
+         retval = TakeStep(h);
+      else
+         retval = TakePartialStep(timeleft);
+
+      if (!retval)
+         return false;
+      timeleft -= stepTaken;
+   }
+
+   stepTaken = dt;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool RawStep()
+//------------------------------------------------------------------------------
+/**
+ * Uncontrolled steps are not supported by the multistep integrator.
+ *
+ * @return false always
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson8::RawStep()
+{
+   return false;
+}
+
+
+//---------------------------------
+// protected
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// Real EstimateError()
+//------------------------------------------------------------------------------
+/**
+ * Returns the difference between the corrected and predicted states on the
+ * last step, measured with the physical model's error norm.
+ *
+ * @return The error estimate of the last step
+ */
+//------------------------------------------------------------------------------
+Real GaussJackson8::EstimateError()
+{
+   return maxError;
+}
+
+
+//------------------------------------------------------------------------------
+// bool AdaptStep(Real maxerror)
+//------------------------------------------------------------------------------
+/**
+ * The step of the Gauss-Jackson integrator is fixed.
+ *
+ * @param maxerror The error estimate for the last step (unused)
+ *
+ * @return true always
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson8::AdaptStep(Real maxerror)
+{
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool AllocateArrays()
+//------------------------------------------------------------------------------
+/**
+ * Allocates the history and work arrays for the current dimension.
+ *
+ * @return true on success, false if memory could not be allocated
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson8::AllocateArrays()
+{
+   FreeArrays();
+
+   if (dimension <= 0)
+      return false;
+
+   history        = new Real[POINTS * dimension];
+   firstSum       = new Real[dimension];
+   secondSum      = new Real[dimension];
+   nextSecondSum  = new Real[dimension];
+   predicted      = new Real[dimension];
+   corrected      = new Real[dimension];
+   midState       = new Real[dimension];
+   lastState      = new Real[dimension];
+   velocityIndex  = new Integer[dimension];
+   savedHistory   = new Real[POINTS * dimension];
+   savedFirstSum  = new Real[dimension];
+   savedSecondSum = new Real[dimension];
+   savedMidState  = new Real[dimension];
+   savedState     = new Real[dimension];
+   errorEstimates = new Real[dimension];
+
+   memset(firstSum, 0, dimension * sizeof(Real));
+   memset(secondSum, 0, dimension * sizeof(Real));
+   for (Integer j = 0; j < dimension; ++j)
+      velocityIndex[j] = -1;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void FreeArrays()
+//------------------------------------------------------------------------------
+/**
+ * Releases the history and work arrays.
+ */
+//------------------------------------------------------------------------------
+void GaussJackson8::FreeArrays()
+{
+   if (history)
+      delete [] history;
+   history = NULL;
+   if (firstSum)
+      delete [] firstSum;
+   firstSum = NULL;
+   if (secondSum)
+      delete [] secondSum;
+   secondSum = NULL;
+   if (nextSecondSum)
+      delete [] nextSecondSum;
+   nextSecondSum = NULL;
+   if (predicted)
+      delete [] predicted;
+   predicted = NULL;
+   if (corrected)
+      delete [] corrected;
+   corrected = NULL;
+   if (midState)
+      delete [] midState;
+   midState = NULL;
+   if (lastState)
+      delete [] lastState;
+   lastState = NULL;
+   if (velocityIndex)
+      delete [] velocityIndex;
+   velocityIndex = NULL;
+   if (savedHistory)
+      delete [] savedHistory;
+   savedHistory = NULL;
+   if (savedFirstSum)
+      delete [] savedFirstSum;
+   savedFirstSum = NULL;
+   if (savedSecondSum)
+      delete [] savedSecondSum;
+   savedSecondSum = NULL;
+   if (savedMidState)
+      delete [] savedMidState;
+   savedMidState = NULL;
+   if (savedState)
+      delete [] savedState;
+   savedState = NULL;
+   if (errorEstimates)
+      delete [] errorEstimates;
+   errorEstimates = NULL;
+
+   pointCount = 0;
+   historySaved = false;
+}
+
+
+//------------------------------------------------------------------------------
+// void BuildCoefficients()
+//------------------------------------------------------------------------------
+/**
+ * Builds the ordinate coefficients of the summed formulas.
+ *
+ * The back points sit at -8, ..., 0 in units of the step.  With s the first
+ * sum and S the second sum of the derivatives a, the formulas are
+ *
+ *    y / h   = s + sum_n FIRST_SUM_TERMS[n] a^(2n+1)
+ *    r / h^2 = S + sum_n SECOND_SUM_TERMS[n] a^(2n)
+ *
+ * with the derivatives of a taken from the interpolating polynomial through
+ * the back points, so the ordinates are those derivatives evaluated at the
+ * point of interest: the next point for the predictor, the last point for the
+ * corrector, and the middle point for the start of the sums.  The first sum is
+ * not known at the next point until its derivative is, so the predictor uses
+ * the extrapolated derivative there.
+ */
+//------------------------------------------------------------------------------
+void GaussJackson8::BuildCoefficients()
+{
+   Real nodes[POINTS], coeffs[POINTS];
+   for (Integer k = 0; k < POINTS; ++k)
+      nodes[k] = k - (POINTS - 1);
+
+   for (Integer k = 0; k < POINTS; ++k)
+   {
+      BasisPolynomial(nodes, k, coeffs);
+
+      firstPredictor[k]  = 0.5 * PolynomialDerivative(coeffs, 0, 1.0);
+      firstCorrector[k]  = 0.0;
+      firstMidpoint[k]   = 0.0;
+      for (Integer n = 0; n < 4; ++n)
+      {
+         firstPredictor[k] += FIRST_SUM_TERMS[n] *
+               PolynomialDerivative(coeffs, 2*n+1, 1.0);
+         firstCorrector[k] += FIRST_SUM_TERMS[n] *
+               PolynomialDerivative(coeffs, 2*n+1, 0.0);
+         firstMidpoint[k]  += FIRST_SUM_TERMS[n] *
+               PolynomialDerivative(coeffs, 2*n+1, -4.0);
+      }
+
+      secondPredictor[k] = 0.0;
+      secondCorrector[k] = 0.0;
+      secondMidpoint[k]  = 0.0;
+      for (Integer n = 0; n < 5; ++n)
+      {
+         secondPredictor[k] += SECOND_SUM_TERMS[n] *
+               PolynomialDerivative(coeffs, 2*n, 1.0);
+         secondCorrector[k] += SECOND_SUM_TERMS[n] *
+               PolynomialDerivative(coeffs, 2*n, 0.0);
+         secondMidpoint[k]  += SECOND_SUM_TERMS[n] *
+               PolynomialDerivative(coeffs, 2*n, -4.0);
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void FindVelocityElements()
+//------------------------------------------------------------------------------
+/**
+ * Pairs the position elements of the state with their velocity elements.
+ *
+ * Cartesian position components are paired with the velocity components of
+ * the same object, and the position rows of an orbit STM with the velocity
+ * rows in the same column.  Elements that are not paired are integrated as
+ * first order equations.  When the physical model has no propagation state
+ * manager, its component map is used instead.
+ */
+//------------------------------------------------------------------------------
+void GaussJackson8::FindVelocityElements()
+{
+   for (Integer j = 0; j < dimension; ++j)
+      velocityIndex[j] = -1;
+
+   const std::vector<ListItem*> *stateMap = NULL;
+   if (physicalModel->IsOfType(Gmat::ODE_MODEL))
+   {
+      PropagationStateManager *psm =
+            ((ODEModel*)physicalModel)->GetPropStateManager();
+      if (psm != NULL)
+         stateMap = psm->GetStateMap();
+   }
+
+   if ((stateMap == NULL) || ((Integer)stateMap->size() != dimension))
+   {
+      if (!physicalModel->GetComponentMap(velocityIndex, 1))
+         for (Integer j = 0; j < dimension; ++j)
+            velocityIndex[j] = -1;
+      return;
+   }
+
+   for (Integer j = 0; j < dimension; ++j)
+   {
+      ListItem *pos = (*stateMap)[j];
+      bool isCartesian = (pos->elementID == Gmat::CARTESIAN_STATE) &&
+                         (pos->subelement >= 1) && (pos->subelement <= 3);
+      bool isStm = (pos->elementID == Gmat::ORBIT_STATE_TRANSITION_MATRIX) &&
+                   (pos->rowIndex < 3) && (pos->rowLength >= 6);
+      if (!isCartesian && !isStm)
+         continue;
+
+      for (Integer i = 0; i < dimension; ++i)
+      {
+         ListItem *vel = (*stateMap)[i];
+         if ((vel->object != pos->object) || (vel->elementID != pos->elementID))
+            continue;
+
+         if ((isCartesian && (vel->subelement == pos->subelement + 3)) ||
+             (isStm && (vel->rowIndex == pos->rowIndex + 3) &&
+                       (vel->colIndex == pos->colIndex)))
+         {
+            velocityIndex[j] = i;
+            break;
+         }
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void PrepareHistory(Real direction)
+//------------------------------------------------------------------------------
+/**
+ * Checks that the back points match the state before a call steps it.
+ *
+ * The back points carry on if the state is the one produced by the last
+ * step.  If the state was moved back to the start of the previous call, the
+ * history saved then is restored.  Otherwise, or if the direction of
+ * propagation changed, the integrator starts again.  The history is then
+ * saved so that this call can be reverted in turn.
+ *
+ * @param direction A value whose sign is the direction of the call
+ */
+//------------------------------------------------------------------------------
+void GaussJackson8::PrepareHistory(Real direction)
+{
+   if (inState != physicalModel->GetState())
+      memcpy(inState, physicalModel->GetState(), sizeof(Real) * dimension);
+
+   if ((pointCount > 0) && !restartPending && (gridStep * direction > 0.0) &&
+       MatchesState(lastState, lastTime))
+   {
+      // The history continues from the last step
+   }
+   else if (historySaved && (savedGridStep * direction > 0.0) &&
+            MatchesState(savedState, savedTime))
+   {
+      #ifdef DEBUG_PROPAGATION
+         MessageInterface::ShowMessage("%s restoring the history from the "
+               "start of the last call\n", instanceName.c_str());
+      #endif
+
+      memcpy(history, savedHistory, POINTS * dimension * sizeof(Real));
+      memcpy(firstSum, savedFirstSum, dimension * sizeof(Real));
+      memcpy(secondSum, savedSecondSum, dimension * sizeof(Real));
+      memcpy(midState, savedMidState, dimension * sizeof(Real));
+      memcpy(lastState, savedState, dimension * sizeof(Real));
+      lastTime       = savedTime;
+      pointCount     = savedPointCount;
+      gridStep       = savedGridStep;
+      restartPending = false;
+   }
+   else
+   {
+      #ifdef DEBUG_PROPAGATION
+         MessageInterface::ShowMessage("%s restarting\n",
+               instanceName.c_str());
+      #endif
+
+      pointCount     = 0;
+      restartPending = false;
+   }
+
+   historySaved = (pointCount > 0);
+   if (historySaved)
+   {
+      memcpy(savedHistory, history, POINTS * dimension * sizeof(Real));
+      memcpy(savedFirstSum, firstSum, dimension * sizeof(Real));
+      memcpy(savedSecondSum, secondSum, dimension * sizeof(Real));
+      memcpy(savedMidState, midState, dimension * sizeof(Real));
+      memcpy(savedState, inState, dimension * sizeof(Real));
+      savedTime       = physicalModel->GetTime();
+      savedPointCount = pointCount;
+      savedGridStep   = gridStep;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool MatchesState(const Real *ref, Real refTime)
+//------------------------------------------------------------------------------
+/**
+ * Checks the propagation state and time against a reference.
+ *
+ * The state is rebuilt from the propagated objects between steps, so a small
+ * relative difference is allowed for round off.
+ *
+ * @param ref     The reference state
+ * @param refTime The reference model time
+ *
+ * @return true if the propagation state matches the reference
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson8::MatchesState(const Real *ref, Real refTime)
+{
+   if (fabs(physicalModel->GetTime() - refTime) > smallestTime)
+      return false;
+
+   for (Integer j = 0; j < dimension; ++j)
+      if (fabs(inState[j] - ref[j]) > 1.0e-12 * (fabs(ref[j]) + 1.0))
+         return false;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void StartSums()
+//------------------------------------------------------------------------------
+/**
+ * Starts the first and second sums once the back points are complete.
+ *
+ * The sums are set from the state at the middle back point, where the
+ * interpolating polynomial is most accurate, and then summed forward to the
+ * last back point.
+ */
+//------------------------------------------------------------------------------
+void GaussJackson8::StartSums()
+{
+   Real h = gridStep;
+   Integer j, k, m, v;
+
+   for (j = 0; j < dimension; ++j)
+   {
+      v = velocityIndex[j];
+      if (v < 0)
+      {
+         firstSum[j] = midState[j] / h;
+         for (k = 0; k < POINTS; ++k)
+            firstSum[j] -= firstMidpoint[k] * history[k*dimension + j];
+      }
+      else
+      {
+         secondSum[j] = midState[j] / (h * h);
+         for (k = 0; k < POINTS; ++k)
+            secondSum[j] -= secondMidpoint[k] * history[k*dimension + v];
+      }
+   }
+
+   for (m = POINTS / 2 + 1; m < POINTS; ++m)
+   {
+      const Real *last = history + (m-1) * dimension;
+      const Real *next = history + m * dimension;
+
+      // The second sums use the first sums at the earlier point
+      for (j = 0; j < dimension; ++j)
+      {
+         v = velocityIndex[j];
+         if (v >= 0)
+            secondSum[j] += firstSum[v] + 0.5 * last[v];
+      }
+      for (j = 0; j < dimension; ++j)
+         if (velocityIndex[j] < 0)
+            firstSum[j] += 0.5 * (last[j] + next[j]);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool TakeStep(Real h)
+//------------------------------------------------------------------------------
+/**
+ * Takes one fixed step.
+ *
+ * Until the back points are complete the step is taken by the starter.  After
+ * that, the state is predicted from the sums, the derivatives are evaluated
+ * at the predicted state, and the state is corrected with the new back point.
+ * The derivatives at the predicted state are kept as the new back point, so
+ * the step costs one derivative evaluation.
+ *
+ * @param h The step
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson8::TakeStep(Real h)
+{
+   Integer j, k, v;
+
+   physicalModel->SetDirection(h > 0.0 ? 1.0 : -1.0);
+
+   if ((pointCount > 0) && (fabs(h - gridStep) > smallestTime))
+      pointCount = 0;
+
+   if (pointCount == 0)
+   {
+      FindVelocityElements();
+      if (!physicalModel->GetDerivatives(inState))
+         return false;
+      memcpy(history, ddt, dimension * sizeof(Real));
+      gridStep = h;
+      pointCount = 1;
+   }
+
+   if (pointCount < POINTS)
+   {
+      if (!TakeStarterStep(h))
+         return false;
+      if (!physicalModel->GetDerivatives(inState))
+         return false;
+      memcpy(history + pointCount * dimension, ddt, dimension * sizeof(Real));
+      if (pointCount == POINTS / 2)
+         memcpy(midState, inState, dimension * sizeof(Real));
+      ++pointCount;
+      if (pointCount == POINTS)
+         StartSums();
+
+      // The error from the starter is not included
+      maxError = 0.0;
+      memcpy(lastState, outState, dimension * sizeof(Real));
+      lastTime = physicalModel->GetTime();
+      return true;
+   }
+
+   Real h2 = h * h;
+   Real *newest = history + (POINTS - 1) * dimension;
+
+   for (j = 0; j < dimension; ++j)
+   {
+      v = velocityIndex[j];
+      if (v >= 0)
+      {
+         nextSecondSum[j] = secondSum[j] + firstSum[v] + 0.5 * newest[v];
+         Real sum = nextSecondSum[j];
+         for (k = 0; k < POINTS; ++k)
+            sum += secondPredictor[k] * history[k*dimension + v];
+         predicted[j] = h2 * sum;
+      }
+      else
+      {
+         Real sum = firstSum[j] + 0.5 * newest[j];
+         for (k = 0; k < POINTS; ++k)
+            sum += firstPredictor[k] * history[k*dimension + j];
+         predicted[j] = h * sum;
+      }
+   }
+
+   if (!physicalModel->GetDerivatives(predicted, h))
+      return false;
+
+   for (j = 0; j < dimension; ++j)
+      if (velocityIndex[j] < 0)
+         firstSum[j] += 0.5 * (newest[j] + ddt[j]);
+
+   memmove(history, history + dimension,
+         (POINTS - 1) * dimension * sizeof(Real));
+   memcpy(newest, ddt, dimension * sizeof(Real));
+
+   for (j = 0; j < dimension; ++j)
+   {
+      v = velocityIndex[j];
+      if (v >= 0)
+      {
+         Real sum = nextSecondSum[j];
+         for (k = 0; k < POINTS; ++k)
+            sum += secondCorrector[k] * history[k*dimension + v];
+         corrected[j] = h2 * sum;
+         secondSum[j] = nextSecondSum[j];
+      }
+      else
+      {
+         Real sum = firstSum[j];
+         for (k = 0; k < POINTS; ++k)
+            sum += firstCorrector[k] * history[k*dimension + j];
+         corrected[j] = h * sum;
+      }
+      errorEstimates[j] = corrected[j] - predicted[j];
+   }
+
+   maxError = physicalModel->EstimateError(errorEstimates, corrected);
+   if ((maxError > tolerance) && !accuracyWarningTriggered)
+   {
+      accuracyWarningTriggered = true;
+      MessageInterface::ShowMessage("**** Warning **** %s: Accuracy "
+            "settings will be violated with current step size "
+            "values.\n", typeSource.c_str());
+   }
+
+   memcpy(outState, corrected, dimension * sizeof(Real));
+   physicalModel->IncrementTime(h);
+   stepTaken = h;
+
+   memcpy(lastState, outState, dimension * sizeof(Real));
+   lastTime = physicalModel->GetTime();
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool TakePartialStep(Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Takes a step shorter than the fixed step.
+ *
+ * The state is integrated from the last back point with the polynomial through
+ * the back points, evaluated at the end of the step, and corrected with the
+ * polynomial through the last eight back points and that evaluation.  The
+ * partial step leaves the state off of the grid of back points, so the next
+ * step starts the integrator again unless the state is moved back to the
+ * start of the call.
+ *
+ * @param dt The step
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson8::TakePartialStep(Real dt)
+{
+   Integer i, j, k, v;
+
+   physicalModel->SetDirection(dt > 0.0 ? 1.0 : -1.0);
+
+   if ((pointCount < POINTS) || (gridStep * dt <= 0.0))
+   {
+      if (!TakeStarterStep(dt))
+         return false;
+   }
+   else
+   {
+      Real h = gridStep;
+      Real theta = dt / h;
+      Real nodes[POINTS], coeffs[POINTS], first[POINTS], second[POINTS];
+      const Real *points[POINTS];
+
+      for (Integer pass = 0; pass < 2; ++pass)
+      {
+         // Predict with the back points, then correct with the evaluation
+         for (k = 0; k < POINTS; ++k)
+         {
+            if ((pass == 0) || (k < POINTS - 1))
+            {
+               nodes[k] = k + pass - (POINTS - 1);
+               points[k] = history + (k + pass) * dimension;
+            }
+            else
+            {
+               nodes[k] = theta;
+               points[k] = ddt;
+            }
+         }
+
+         for (k = 0; k < POINTS; ++k)
+         {
+            BasisPolynomial(nodes, k, coeffs);
+            // Integrals from 0 to theta of the polynomial, and of the
+            // polynomial times (theta - t)
+            first[k] = second[k] = 0.0;
+            Real power = 1.0;
+            for (i = 0; i < POINTS; ++i)
+            {
+               power *= theta;
+               first[k] += coeffs[i] * power / (i + 1);
+               second[k] += coeffs[i] * power * theta / ((i + 1) * (i + 2));
+            }
+         }
+
+         Real *target = (pass == 0 ? predicted : corrected);
+         for (j = 0; j < dimension; ++j)
+         {
+            v = velocityIndex[j];
+            Real sum = 0.0;
+            if (v >= 0)
+            {
+               for (k = 0; k < POINTS; ++k)
+                  sum += second[k] * points[k][v];
+               target[j] = inState[j] + dt * inState[v] + h * h * sum;
+            }
+            else
+            {
+               for (k = 0; k < POINTS; ++k)
+                  sum += first[k] * points[k][j];
+               target[j] = inState[j] + h * sum;
+            }
+         }
+
+         if (pass == 0)
+            if (!physicalModel->GetDerivatives(predicted, dt))
+               return false;
+      }
+
+      for (j = 0; j < dimension; ++j)
+         errorEstimates[j] = corrected[j] - predicted[j];
+      maxError = physicalModel->EstimateError(errorEstimates, corrected);
+
+      memcpy(outState, corrected, dimension * sizeof(Real));
+      physicalModel->IncrementTime(dt);
+      stepTaken = dt;
+   }
+
+   restartPending = true;
+   memcpy(lastState, outState, dimension * sizeof(Real));
+   lastTime = physicalModel->GetTime();
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool TakeStarterStep(Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Steps the state with the starter.
+ *
+ * @param dt The step
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson8::TakeStarterStep(Real dt)
+{
+   if (!starter->Step(dt))
+      return false;
+
+   if (inState != physicalModel->GetState())
+      memcpy(inState, physicalModel->GetState(), sizeof(Real) * dimension);
+
+   stepTaken = dt;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void BasisPolynomial(const Real *nodes, Integer k, Real *coeffs)
+//------------------------------------------------------------------------------
+/**
+ * Builds the power series coefficients of a Lagrange basis polynomial.
+ *
+ * @param nodes  The POINTS interpolation nodes
+ * @param k      The node at which the polynomial is 1
+ * @param coeffs The coefficients, lowest power first
+ */
+//------------------------------------------------------------------------------
+void GaussJackson8::BasisPolynomial(const Real *nodes, Integer k,
+      Real *coeffs)
+{
+   Integer degree = 0;
+   Real denominator = 1.0;
+
+   coeffs[0] = 1.0;
+   for (Integer i = 1; i < POINTS; ++i)
+      coeffs[i] = 0.0;
+
+   for (Integer j = 0; j < POINTS; ++j)
+   {
+      if (j == k)
+         continue;
+
+      // Multiply by (t - nodes[j])
+      ++degree;
+      for (Integer i = degree; i > 0; --i)
+         coeffs[i] = coeffs[i-1] - nodes[j] * coeffs[i];
+      coeffs[0] *= -nodes[j];
+      denominator *= nodes[k] - nodes[j];
+   }
+
+   for (Integer i = 0; i < POINTS; ++i)
+      coeffs[i] /= denominator;
+}
+
+
+//------------------------------------------------------------------------------
+// Real PolynomialDerivative(const Real *coeffs, Integer order, Real t)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates a derivative of a polynomial of degree POINTS - 1.
+ *
+ * @param coeffs The coefficients, lowest power first
+ * @param order  The order of the derivative; 0 evaluates the polynomial
+ * @param t      The point of evaluation
+ *
+ * @return The derivative at t
+ */
+//------------------------------------------------------------------------------
+Real GaussJackson8::PolynomialDerivative(const Real *coeffs, Integer order,
+      Real t)
+{
+   Real value = 0.0, power = 1.0;
+
+   for (Integer i = order; i < POINTS; ++i)
+   {
+      Real factor = 1.0;
+      for (Integer m = 0; m < order; ++m)
+         factor *= i - m;
+      value += factor * coeffs[i] * power;
+      power *= t;
+   }
+
+   return value;
+}
@@ -0,0 +1,162 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               GaussJackson8
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the fixed step, eighth order Gauss-Jackson integrator.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef GaussJackson8_hpp
+#define GaussJackson8_hpp
+
+#include "ExtraPropagatorDefs.hpp"
+#include "Integrator.hpp"
+
+/**
+ * Fixed step, eighth order Gauss-Jackson (summed Stormer-Cowell) integrator
+ *
+ * This integrator implements the Gauss-Jackson method as described by M. M.
+ * Berry and L. M. Healy, "Implementation of Gauss-Jackson Integration for
+ * Orbit Propagation", J. Astronaut. Sci. 52(3), 2004.  Positions are
+ * integrated from the second sums of the accelerations, and velocities from
+ * the first sums, using nine back points.  Each step is a PEC step, so it
+ * costs one derivative evaluation.
+ *
+ * The integrator works with the first order derivative interface of the
+ * physical model.  The position-velocity pairs of the Cartesian states and of
+ * the orbit state transition matrix rows are found from the propagation state
+ * manager (or, without one, from the physical model's component map); the
+ * position members of each pair are integrated as second order equations,
+ * using the derivatives of the velocity members.  All other elements of the
+ * state, such as mass, are integrated with the summed Adams formulas.
+ *
+ * The step is the InitialStepSize setting.  The first eight steps are taken
+ * with a Runge-Kutta 8(9) starter, using the Accuracy setting, to build the
+ * back points.  As for the other multistep integrators, the history is kept
+ * across calls as long as the state is the one produced by the last step, or
+ * the state at the start of the last call; otherwise the integrator starts
+ * again.  Intervals that are not a whole number of steps end with a shorter
+ * step interpolated from the back points, after which the next call starts
+ * the integrator again.
+ */
+class PROPAGATOR_API GaussJackson8 : public Integrator
+{
+public:
+   GaussJackson8(const std::string &nomme = "");
+   virtual ~GaussJackson8();
+   GaussJackson8(const GaussJackson8& gj);
+   GaussJackson8& operator=(const GaussJackson8& gj);
+
+   virtual GmatBase*       Clone() const;
+
+   virtual bool            Initialize();
+   virtual bool            Step();
+   virtual bool            Step(Real dt);
+   virtual bool            RawStep();
+
+protected:
+   /// Number of back points used by the eighth order formulas
+   static const Integer    POINTS = 9;
+   /// Coefficients of the odd derivatives in the first sum corrections
+   static const Real       FIRST_SUM_TERMS[4];
+   /// Coefficients of the even derivatives in the second sum corrections
+   static const Real       SECOND_SUM_TERMS[5];
+
+   /// Integrator used to build the back points
+   Propagator              *starter;
+
+   /// First sum predictor ordinates
+   Real                    firstPredictor[POINTS];
+   /// Second sum predictor ordinates
+   Real                    secondPredictor[POINTS];
+   /// First sum corrector ordinates
+   Real                    firstCorrector[POINTS];
+   /// Second sum corrector ordinates
+   Real                    secondCorrector[POINTS];
+   /// First sum ordinates at the middle back point, used to start the sums
+   Real                    firstMidpoint[POINTS];
+   /// Second sum ordinates at the middle back point, used to start the sums
+   Real                    secondMidpoint[POINTS];
+
+   /// Derivatives at the back points, oldest first
+   Real                    *history;
+   /// First sums of the derivatives at the last back point
+   Real                    *firstSum;
+   /// Second sums of the accelerations at the last back point
+   Real                    *secondSum;
+   /// Second sums for the point being stepped to
+   Real                    *nextSecondSum;
+   /// Predicted state
+   Real                    *predicted;
+   /// Corrected state
+   Real                    *corrected;
+   /// State at the middle back point, while the back points are built
+   Real                    *midState;
+   /// State at the end of the last step
+   Real                    *lastState;
+   /// For each element, the index of its velocity element if it is a
+   /// position, or -1 for first order elements
+   Integer                 *velocityIndex;
+
+   /// Number of back points collected
+   Integer                 pointCount;
+   /// Step used for the back points
+   Real                    gridStep;
+   /// Flag indicating that the next step must start the integrator again
+   bool                    restartPending;
+   /// Model time at the end of the last step
+   Real                    lastTime;
+   /// Predictor-corrector difference on the last step
+   Real                    maxError;
+
+   /// Flag indicating that the history at the start of the call was saved
+   bool                    historySaved;
+   /// Model time at the start of the current call
+   Real                    savedTime;
+   // History at the start of the current call
+   Real                    *savedHistory;
+   Real                    *savedFirstSum;
+   Real                    *savedSecondSum;
+   Real                    *savedMidState;
+   Real                    *savedState;
+   Integer                 savedPointCount;
+   Real                    savedGridStep;
+
+   virtual Real            EstimateError();
+   virtual bool            AdaptStep(Real maxerror);
+
+   bool                    AllocateArrays();
+   void                    FreeArrays();
+   void                    BuildCoefficients();
+   void                    FindVelocityElements();
+   void                    PrepareHistory(Real direction);
+   bool                    MatchesState(const Real *ref, Real refTime);
+   void                    StartSums();
+   bool                    TakeStep(Real h);
+   bool                    TakePartialStep(Real dt);
+   bool                    TakeStarterStep(Real dt);
+
+   static void             BasisPolynomial(const Real *nodes, Integer k,
+                                           Real *coeffs);
+   static Real             PolynomialDerivative(const Real *coeffs,
+                                                Integer order, Real t);
+};
+
+#endif // GaussJackson8_hpp
@@ -0,0 +1,746 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                Symplectic
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the fixed step symplectic (composed leapfrog) integrator.
+ */
+//------------------------------------------------------------------------------
+
+#include "Symplectic.hpp"
+#include "ODEModel.hpp"
+#include "PropagationStateManager.hpp"
+#include "PropagatorException.hpp"
+#include "MessageInterface.hpp"
+#include <math.h>
+#include <string.h>
+#include <sstream>
+
+//#define DEBUG_PROPAGATION
+
+
+//---------------------------------
+// static data
+//---------------------------------
+const std::string
+Symplectic::PARAMETER_TEXT[SymplecticParamCount - IntegratorParamCount] =
+{
+   "Order",
+};
+
+const Gmat::ParameterType
+Symplectic::PARAMETER_TYPE[SymplecticParamCount - IntegratorParamCount] =
+{
+   Gmat::INTEGER_TYPE,
+};
+
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// Symplectic(const std::string &nomme)
+//------------------------------------------------------------------------------
+/**
+ * The constructor
+ *
+ * @param nomme The name of the new propagator
+ */
+//------------------------------------------------------------------------------
+Symplectic::Symplectic(const std::string &nomme) :
+   Integrator              ("Symplectic", nomme),
+   order                   (4),
+   derivativeSaved         (false),
+   lastTime                (0.0),
+   lastForceCount          (0)
+{
+   parameterCount = SymplecticParamCount;
+}
+
+
+//------------------------------------------------------------------------------
+// ~Symplectic()
+//------------------------------------------------------------------------------
+/**
+ * The destructor
+ */
+//------------------------------------------------------------------------------
+Symplectic::~Symplectic()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// Symplectic(const Symplectic& sym)
+//------------------------------------------------------------------------------
+/**
+ * The copy constructor
+ *
+ * The work arrays are not copied; the copy sizes them when it is initialized.
+ *
+ * @param sym The propagator that supplies data for this one
+ */
+//------------------------------------------------------------------------------
+Symplectic::Symplectic(const Symplectic& sym) :
+   Integrator              (sym),
+   order                   (sym.order),
+   derivativeSaved         (false),
+   lastTime                (0.0),
+   lastForceCount          (0)
+{
+   parameterCount = SymplecticParamCount;
+   isInitialized  = false;
+}
+
+
+//------------------------------------------------------------------------------
+// Symplectic& operator=(const Symplectic& sym)
+//------------------------------------------------------------------------------
+/**
+ * The assignment operator
+ *
+ * @param sym The propagator that supplies data for this one
+ *
+ * @return This propagator, configured to match sym
+ */
+//------------------------------------------------------------------------------
+Symplectic& Symplectic::operator=(const Symplectic& sym)
+{
+   if (this == &sym)
+      return *this;
+
+   Integrator::operator=(sym);
+
+   order           = sym.order;
+   weights.clear();
+   velocityIndex.clear();
+   derivativeSaved = false;
+   lastTime        = 0.0;
+   lastForceCount  = 0;
+
+   isInitialized = false;
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Method used to create a copy of the object
+ *
+ * @return A clone of this instance
+ */
+//------------------------------------------------------------------------------
+GmatBase* Symplectic::Clone() const
+{
+   return new Symplectic(*this);
+}
+
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Sets up the integrator for propagation
+ *
+ * The composition weights are set for the order and the work arrays are
+ * sized for the physical model.
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool Symplectic::Initialize()
+{
+   Propagator::Initialize();
+
+   if (physicalModel == NULL)
+   {
+      isInitialized = false;
+      return isInitialized;
+   }
+
+   dimension = physicalModel->GetDimension();
+   if (dimension <= 0)
+   {
+      isInitialized = false;
+      return isInitialized;
+   }
+
+   SetWeights();
+
+   velocityIndex.assign(dimension, -1);
+   workState.assign(dimension, 0.0);
+   halfState.assign(dimension, 0.0);
+   stageState.assign(dimension, 0.0);
+   startDerivative.assign(dimension, 0.0);
+   lastState.assign(dimension, 0.0);
+
+   ddt = physicalModel->GetDerivativeArray();
+
+   inState  = physicalModel->GetState();
+   outState = physicalModel->GetState();
+
+   derivativeSaved = false;
+   accuracyWarningTriggered = false;
+
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("Initialized %s: order %d, %d stages, "
+            "dimension %d\n", typeName.c_str(), order, (Integer)weights.size(),
+            dimension);
+   #endif
+
+   return isInitialized;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step()
+//------------------------------------------------------------------------------
+/**
+ * Advances the state by one step
+ *
+ * The step is the fixed step size of the integrator, limited by the maximum
+ * step and by the force model.
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool Symplectic::Step()
+{
+   if (!isInitialized)
+      return false;
+
+   if (stepSize == 0.0)
+      return false;
+
+   Real h = stepSize;
+   if (fabs(h) > maximumStep)
+      h = (h > 0.0 ? maximumStep : -maximumStep);
+
+   Real forceMaxStep = physicalModel->GetForceMaxStep(h > 0.0);
+   if ((forceMaxStep != 0.0) && (fabs(forceMaxStep) < fabs(h)))
+      h = forceMaxStep;
+
+   return TakeStep(h);
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step(Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Advances the state across a specified interval
+ *
+ * The interval is covered with fixed steps; any remainder shorter than the
+ * step is taken as a shorter step at the end of the interval.
+ *
+ * @param dt The interval
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool Symplectic::Step(Real dt)
+{
+   if (!isInitialized)
+      return false;
+
+   if (dt == 0.0)
+   {
+      stepTaken = 0.0;
+      return true;
+   }
+
+   Real h = fabs(stepSize);
+   if (h > maximumStep)
+      h = maximumStep;
+   if (h == 0.0)
+      h = fabs(dt);
+   if (dt < 0.0)
+      h = -h;
+
+   timeleft = dt;
+   while (fabs(timeleft) > smallestTime)
+   {
+      Real step = h;
+      Real forceMaxStep = physicalModel->GetForceMaxStep(h > 0.0);
+      if ((forceMaxStep != 0.0) && (fabs(forceMaxStep) < fabs(step)))
+         step = forceMaxStep;
+      if (fabs(timeleft) < fabs(step))
+         step = timeleft;
+
+      if (!TakeStep(step))
+         return false;
+      timeleft -= stepTaken;
+   }
+
+   stepTaken = dt;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool RawStep()
+//------------------------------------------------------------------------------
+/**
+ * Takes a step without error control
+ *
+ * The symplectic integrator has no error control, so this method just calls
+ * Step().
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool Symplectic::RawStep()
+{
+   return Step();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterText(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+std::string Symplectic::GetParameterText(const Integer id) const
+{
+   if (id >= IntegratorParamCount && id < SymplecticParamCount)
+      return PARAMETER_TEXT[id - IntegratorParamCount];
+
+   return Integrator::GetParameterText(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetParameterID(const std::string &str) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer Symplectic::GetParameterID(const std::string &str) const
+{
+   for (Integer i = IntegratorParamCount; i < SymplecticParamCount; ++i)
+   {
+      if (str == PARAMETER_TEXT[i - IntegratorParamCount])
+         return i;
+   }
+
+   return Integrator::GetParameterID(str);
+}
+
+
+//------------------------------------------------------------------------------
+// Gmat::ParameterType GetParameterType(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Gmat::ParameterType Symplectic::GetParameterType(const Integer id) const
+{
+   if (id >= IntegratorParamCount && id < SymplecticParamCount)
+      return PARAMETER_TYPE[id - IntegratorParamCount];
+
+   return Integrator::GetParameterType(id);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterTypeString(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+std::string Symplectic::GetParameterTypeString(const Integer id) const
+{
+   if (id >= IntegratorParamCount && id < SymplecticParamCount)
+      return GmatBase::PARAM_TYPE_STRING[GetParameterType(id)];
+
+   return Integrator::GetParameterTypeString(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer Symplectic::GetIntegerParameter(const Integer id) const
+{
+   if (id == ORDER)
+      return order;
+
+   return Integrator::GetIntegerParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer Symplectic::GetIntegerParameter(const std::string &label) const
+{
+   return GetIntegerParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Sets the order of the composition
+ *
+ * Orders 2, 4 and 6 are accepted.
+ *
+ * @param id    ID for the parameter being set
+ * @param value New value for the parameter
+ *
+ * @return The parameter value
+ */
+//------------------------------------------------------------------------------
+Integer Symplectic::SetIntegerParameter(const Integer id, const Integer value)
+{
+   if (id == ORDER)
+   {
+      if ((value != 2) && (value != 4) && (value != 6))
+      {
+         std::stringstream buffer;
+         buffer << value;
+         throw PropagatorException(
+            "The value of \"" + buffer.str() + "\" for field \"Order\""
+            " on object \"" + instanceName + "\" is not an allowed value.\n"
+            "The allowed values are: [ 2, 4, 6 ]. ");
+      }
+      order = value;
+      isInitialized = false;
+      return order;
+   }
+
+   return Integrator::SetIntegerParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const std::string &label, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer Symplectic::SetIntegerParameter(const std::string &label,
+                                        const Integer value)
+{
+   return SetIntegerParameter(GetParameterID(label), value);
+}
+
+
+//---------------------------------
+// protected
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// Real EstimateError()
+//------------------------------------------------------------------------------
+/**
+ * The symplectic integrator does not estimate its error.
+ *
+ * @return 0.0 always
+ */
+//------------------------------------------------------------------------------
+Real Symplectic::EstimateError()
+{
+   return 0.0;
+}
+
+
+//------------------------------------------------------------------------------
+// bool AdaptStep(Real maxerror)
+//------------------------------------------------------------------------------
+/**
+ * The step of the symplectic integrator is fixed.
+ *
+ * @param maxerror The error estimate for the last step (unused)
+ *
+ * @return true always
+ */
+//------------------------------------------------------------------------------
+bool Symplectic::AdaptStep(Real maxerror)
+{
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetWeights()
+//------------------------------------------------------------------------------
+/**
+ * Sets the leapfrog substep weights of the composition for the order.
+ *
+ * The weights of each composition sum to one and are symmetric, so the
+ * composed method stays time reversible.
+ */
+//------------------------------------------------------------------------------
+void Symplectic::SetWeights()
+{
+   weights.clear();
+
+   if (order == 2)
+   {
+      weights.push_back(1.0);
+   }
+   else if (order == 4)
+   {
+      // Triple jump
+      Real cubeRoot = pow(2.0, 1.0 / 3.0);
+      Real x1 = 1.0 / (2.0 - cubeRoot);
+      Real x0 = -cubeRoot / (2.0 - cubeRoot);
+      weights.push_back(x1);
+      weights.push_back(x0);
+      weights.push_back(x1);
+   }
+   else
+   {
+      // Yoshida's solution A
+      Real w1 = -1.17767998417887;
+      Real w2 =  0.235573213359357;
+      Real w3 =  0.784513610477560;
+      Real w0 = 1.0 - 2.0 * (w1 + w2 + w3);
+      weights.push_back(w3);
+      weights.push_back(w2);
+      weights.push_back(w1);
+      weights.push_back(w0);
+      weights.push_back(w1);
+      weights.push_back(w2);
+      weights.push_back(w3);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void FindVelocityElements()
+//------------------------------------------------------------------------------
+/**
+ * Pairs the position elements of the state with their velocity elements.
+ *
+ * The pairing matches GaussJackson8: Cartesian position components with the
+ * velocity components of the same object, and the position rows of an orbit
+ * STM with the velocity rows in the same column.  Without a propagation state
+ * manager, the physical model's component map is used instead.
+ */
+//------------------------------------------------------------------------------
+void Symplectic::FindVelocityElements()
+{
+   velocityIndex.assign(dimension, -1);
+
+   const std::vector<ListItem*> *stateMap = NULL;
+   if (physicalModel->IsOfType(Gmat::ODE_MODEL))
+   {
+      PropagationStateManager *psm =
+            ((ODEModel*)physicalModel)->GetPropStateManager();
+      if (psm != NULL)
+         stateMap = psm->GetStateMap();
+   }
+
+   if ((stateMap == NULL) || ((Integer)stateMap->size() != dimension))
+   {
+      if (!physicalModel->GetComponentMap(&velocityIndex[0], 1))
+         velocityIndex.assign(dimension, -1);
+      return;
+   }
+
+   for (Integer j = 0; j < dimension; ++j)
+   {
+      ListItem *pos = (*stateMap)[j];
+      bool isCartesian = (pos->elementID == Gmat::CARTESIAN_STATE) &&
+                         (pos->subelement >= 1) && (pos->subelement <= 3);
+      bool isStm = (pos->elementID == Gmat::ORBIT_STATE_TRANSITION_MATRIX) &&
+                   (pos->rowIndex < 3) && (pos->rowLength >= 6);
+      if (!isCartesian && !isStm)
+         continue;
+
+      for (Integer i = 0; i < dimension; ++i)
+      {
+         ListItem *vel = (*stateMap)[i];
+         if ((vel->object != pos->object) || (vel->elementID != pos->elementID))
+            continue;
+
+         if ((isCartesian && (vel->subelement == pos->subelement + 3)) ||
+             (isStm && (vel->rowIndex == pos->rowIndex + 3) &&
+                       (vel->colIndex == pos->colIndex)))
+         {
+            velocityIndex[j] = i;
+            break;
+         }
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetForceCount()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of forces in the force model.
+ *
+ * Finite burns and other transient forces are added and removed during the
+ * run; a change in the count means the saved derivatives are out of date.
+ *
+ * @return The number of forces, or 0 for other physical models
+ */
+//------------------------------------------------------------------------------
+Integer Symplectic::GetForceCount()
+{
+   if (physicalModel->IsOfType(Gmat::ODE_MODEL))
+      return ((ODEModel*)physicalModel)->GetNumForces();
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// bool MatchesLastState()
+//------------------------------------------------------------------------------
+/**
+ * Checks that the state and time are the ones left by the last step.
+ *
+ * The state is rebuilt from the propagated objects between steps, so a small
+ * relative difference is allowed for round off.
+ *
+ * @return true if the saved derivatives can be used for the next step
+ */
+//------------------------------------------------------------------------------
+bool Symplectic::MatchesLastState()
+{
+   if (GetForceCount() != lastForceCount)
+      return false;
+
+   if (fabs(physicalModel->GetTime() - lastTime) > smallestTime)
+      return false;
+
+   for (Integer j = 0; j < dimension; ++j)
+      if (fabs(inState[j] - lastState[j]) >
+            1.0e-12 * (fabs(lastState[j]) + 1.0))
+         return false;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool TakeStep(Real h)
+//------------------------------------------------------------------------------
+/**
+ * Takes one step of the composition.
+ *
+ * Each leapfrog of weight w kicks the kicked elements across half of the
+ * substep w h with the derivatives at its start, drifts the positions across
+ * the substep with the half kicked velocities, and then kicks again with the
+ * derivatives at its end.  Those derivatives are evaluated with the kicked
+ * elements predicted from the first kick, and are carried to the next
+ * leapfrog as its starting derivatives.
+ *
+ * @param h The step
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool Symplectic::TakeStep(Real h)
+{
+   Integer j, v;
+
+   physicalModel->SetDirection(h > 0.0 ? 1.0 : -1.0);
+
+   if (inState != physicalModel->GetState())
+      memcpy(inState, physicalModel->GetState(), sizeof(Real) * dimension);
+
+   if (!derivativeSaved || !MatchesLastState())
+   {
+      FindVelocityElements();
+      if (!physicalModel->GetDerivatives(inState))
+         return false;
+      memcpy(&startDerivative[0], ddt, dimension * sizeof(Real));
+   }
+
+   memcpy(&workState[0], inState, dimension * sizeof(Real));
+
+   Real elapsed = 0.0;
+   for (UnsignedInt s = 0; s < weights.size(); ++s)
+   {
+      Real tau = weights[s] * h;
+      Real halfTau = 0.5 * tau;
+
+      for (j = 0; j < dimension; ++j)
+      {
+         if (velocityIndex[j] < 0)
+         {
+            halfState[j]  = workState[j] + halfTau * startDerivative[j];
+            stageState[j] = halfState[j] + halfTau * startDerivative[j];
+         }
+      }
+
+      for (j = 0; j < dimension; ++j)
+      {
+         v = velocityIndex[j];
+         if (v >= 0)
+         {
+            workState[j] += tau * halfState[v];
+            stageState[j] = workState[j];
+         }
+      }
+
+      elapsed += tau;
+      if (!physicalModel->GetDerivatives(&stageState[0], elapsed))
+      {
+         derivativeSaved = false;
+         return false;
+      }
+
+      for (j = 0; j < dimension; ++j)
+         if (velocityIndex[j] < 0)
+            workState[j] = halfState[j] + halfTau * ddt[j];
+
+      memcpy(&startDerivative[0], ddt, dimension * sizeof(Real));
+   }
+
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("%s step of %.12lf sec with %d stages\n",
+            instanceName.c_str(), h, (Integer)weights.size());
+   #endif
+
+   memcpy(outState, &workState[0], dimension * sizeof(Real));
+   physicalModel->IncrementTime(h);
+   stepTaken = h;
+
+   memcpy(&lastState[0], outState, dimension * sizeof(Real));
+   lastTime        = physicalModel->GetTime();
+   lastForceCount  = GetForceCount();
+   derivativeSaved = true;
+
+   return true;
+}
@@ -0,0 +1,135 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                Symplectic
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the fixed step symplectic (composed leapfrog) integrator.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef Symplectic_hpp
+#define Symplectic_hpp
+
+#include "ExtraPropagatorDefs.hpp"
+#include "Integrator.hpp"
+
+/**
+ * Fixed step symplectic integrator built from compositions of the leapfrog
+ *
+ * The base method is the kick-drift-kick leapfrog (Stormer-Verlet), which is
+ * symplectic and time reversible for accelerations that depend only on
+ * position.  Orders 4 and 6 are the symmetric compositions of H. Yoshida,
+ * "Construction of higher order symplectic integrators", Phys. Lett. A
+ * 150(5-7), 1990: the triple jump for order 4 and solution A of the seven
+ * stage composition for order 6.  The last kick of each leapfrog shares its
+ * derivative evaluation with the first kick of the next, so a step costs one
+ * evaluation for each stage, and the evaluation at the end of a step is
+ * reused by the next step while the state is unchanged.
+ *
+ * The integrator uses the first order derivative interface of the physical
+ * model, with the position-velocity pairs found as for GaussJackson8.
+ * Positions and the position rows of the orbit STM are drifted with their
+ * velocity elements; every other element, such as the velocities and mass, is
+ * kicked with its derivative.  Forces that depend on velocity, like drag,
+ * are evaluated with velocities predicted across the leapfrog, so they are
+ * integrated to second order and break the symplectic property only by their
+ * own small size.
+ *
+ * The step is the InitialStepSize setting and is shared by every spacecraft
+ * in the force model, so each stage makes a single derivative call for the
+ * whole state.  There is no error control; intervals that are not a whole
+ * number of steps end with a shorter step.
+ */
+class PROPAGATOR_API Symplectic : public Integrator
+{
+public:
+   Symplectic(const std::string &nomme = "");
+   virtual ~Symplectic();
+   Symplectic(const Symplectic& sym);
+   Symplectic& operator=(const Symplectic& sym);
+
+   virtual GmatBase*       Clone() const;
+
+   virtual bool            Initialize();
+   virtual bool            Step();
+   virtual bool            Step(Real dt);
+   virtual bool            RawStep();
+
+   // Parameter accessor methods -- overridden from GmatBase
+   virtual std::string     GetParameterText(const Integer id) const;
+   virtual Integer         GetParameterID(const std::string &str) const;
+   virtual Gmat::ParameterType
+                           GetParameterType(const Integer id) const;
+   virtual std::string     GetParameterTypeString(const Integer id) const;
+
+   virtual Integer         GetIntegerParameter(const Integer id) const;
+   virtual Integer         GetIntegerParameter(const std::string &label) const;
+   virtual Integer         SetIntegerParameter(const Integer id,
+                                               const Integer value);
+   virtual Integer         SetIntegerParameter(const std::string &label,
+                                               const Integer value);
+
+protected:
+   enum
+   {
+      ORDER = IntegratorParamCount,
+      SymplecticParamCount  /// Count of the parameters for this class
+   };
+   static const std::string
+         PARAMETER_TEXT[SymplecticParamCount - IntegratorParamCount];
+   static const Gmat::ParameterType
+         PARAMETER_TYPE[SymplecticParamCount - IntegratorParamCount];
+
+   /// Order of the composition: 2, 4 or 6
+   Integer                 order;
+   /// Leapfrog substep weights of the composition
+   RealArray               weights;
+
+   /// For each element, the index of its velocity element if it is a
+   /// position, or -1 for elements that are kicked
+   IntegerArray            velocityIndex;
+   /// State across the step
+   RealArray               workState;
+   /// State at the middle of the current leapfrog
+   RealArray               halfState;
+   /// State used for the next derivative evaluation
+   RealArray               stageState;
+   /// Derivatives at the start of the current leapfrog
+   RealArray               startDerivative;
+
+   /// Flag indicating that startDerivative holds the derivatives of lastState
+   bool                    derivativeSaved;
+   /// State at the end of the last step
+   RealArray               lastState;
+   /// Model time at the end of the last step
+   Real                    lastTime;
+   /// Number of forces in the force model at the end of the last step
+   Integer                 lastForceCount;
+
+   virtual Real            EstimateError();
+   virtual bool            AdaptStep(Real maxerror);
+
+   void                    SetWeights();
+   void                    FindVelocityElements();
+   Integer                 GetForceCount();
+   bool                    MatchesLastState();
+   bool                    TakeStep(Real h);
+};
+
+#endif // Symplectic_hpp
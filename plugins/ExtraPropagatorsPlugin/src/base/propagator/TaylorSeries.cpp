@@ -0,0 +1,1155 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TaylorSeries
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the variable step, high order Taylor series integrator.
+ */
+//------------------------------------------------------------------------------
+
+#include "TaylorSeries.hpp"
+#include "ODEModel.hpp"
+#include "PropagationStateManager.hpp"
+#include "PropagatorException.hpp"
+#include "CelestialBody.hpp"
+#include "GmatConstants.hpp"
+#include "MessageInterface.hpp"
+#include <math.h>
+#include <algorithm>
+#include <sstream>
+
+//#define DEBUG_PROPAGATION
+//#define DEBUG_EPHEMERIS_FIT
+
+
+//---------------------------------
+// static data
+//---------------------------------
+const std::string
+TaylorSeries::PARAMETER_TEXT[TaylorSeriesParamCount - IntegratorParamCount] =
+{
+   "Order",
+};
+
+const Gmat::ParameterType
+TaylorSeries::PARAMETER_TYPE[TaylorSeriesParamCount - IntegratorParamCount] =
+{
+   Gmat::INTEGER_TYPE,
+};
+
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// TaylorSeries(const std::string &nomme)
+//------------------------------------------------------------------------------
+/**
+ * The constructor
+ *
+ * @param nomme The name of the new propagator
+ */
+//------------------------------------------------------------------------------
+TaylorSeries::TaylorSeries(const std::string &nomme) :
+   Integrator              ("TaylorSeries", nomme),
+   order                   (0),
+   seriesOrder             (0),
+   satCount                (0),
+   origin                  (NULL),
+   centralMu               (0.0),
+   relativity              (NULL),
+   forceCount              (0),
+   fitSpan                 (0.0),
+   lastError               (0.0)
+{
+   parameterCount = TaylorSeriesParamCount;
+}
+
+
+//------------------------------------------------------------------------------
+// ~TaylorSeries()
+//------------------------------------------------------------------------------
+/**
+ * The destructor
+ */
+//------------------------------------------------------------------------------
+TaylorSeries::~TaylorSeries()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// TaylorSeries(const TaylorSeries& ts)
+//------------------------------------------------------------------------------
+/**
+ * The copy constructor
+ *
+ * The force data is not copied; the copy finds it when it is initialized.
+ *
+ * @param ts The propagator that supplies data for this one
+ */
+//------------------------------------------------------------------------------
+TaylorSeries::TaylorSeries(const TaylorSeries& ts) :
+   Integrator              (ts),
+   order                   (ts.order),
+   seriesOrder             (0),
+   satCount                (0),
+   origin                  (NULL),
+   centralMu               (0.0),
+   relativity              (NULL),
+   forceCount              (0),
+   fitSpan                 (0.0),
+   lastError               (0.0)
+{
+   parameterCount = TaylorSeriesParamCount;
+   isInitialized  = false;
+}
+
+
+//------------------------------------------------------------------------------
+// TaylorSeries& operator=(const TaylorSeries& ts)
+//------------------------------------------------------------------------------
+/**
+ * The assignment operator
+ *
+ * @param ts The propagator that supplies data for this one
+ *
+ * @return This propagator, configured to match ts
+ */
+//------------------------------------------------------------------------------
+TaylorSeries& TaylorSeries::operator=(const TaylorSeries& ts)
+{
+   if (this == &ts)
+      return *this;
+
+   Integrator::operator=(ts);
+
+   order       = ts.order;
+   seriesOrder = 0;
+   satCount    = 0;
+   cartesianIndex.clear();
+   origin      = NULL;
+   centralMu   = 0.0;
+   thirdBodies.clear();
+   thirdBodyMu.clear();
+   relativity  = NULL;
+   forceCount  = 0;
+   fitSpan     = 0.0;
+   lastError   = 0.0;
+
+   isInitialized = false;
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Method used to create a copy of the object
+ *
+ * @return A clone of this instance
+ */
+//------------------------------------------------------------------------------
+GmatBase* TaylorSeries::Clone() const
+{
+   return new TaylorSeries(*this);
+}
+
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Sets up the integrator for propagation
+ *
+ * The state elements and forces are checked, the order of the series is set,
+ * and the series arrays are sized.
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool TaylorSeries::Initialize()
+{
+   Real stepSign = (stepSizeBuffer >= 0.0 ? 1.0 : -1.0);
+   if (fabs(stepSizeBuffer) < minimumStep)
+      stepSizeBuffer = minimumStep * stepSign;
+   if (fabs(stepSizeBuffer) > maximumStep)
+      stepSizeBuffer = maximumStep * stepSign;
+
+   Propagator::Initialize();
+
+   if (physicalModel == NULL)
+   {
+      isInitialized = false;
+      return isInitialized;
+   }
+
+   if (!physicalModel->IsOfType(Gmat::ODE_MODEL))
+      throw PropagatorException("The TaylorSeries integrator " + instanceName +
+            " propagates with a force model; it cannot be used with the " +
+            physicalModel->GetTypeName() + " model " +
+            physicalModel->GetName());
+
+   dimension = physicalModel->GetDimension();
+
+   FindCartesianElements();
+   SetSeriesOrder();
+   CheckForces();
+
+   inState  = physicalModel->GetState();
+   outState = physicalModel->GetState();
+
+   fitSpan   = 0.0;
+   lastError = 0.0;
+   accuracyWarningTriggered = false;
+
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("Initialized %s: order %d, %d spacecraft, "
+            "central mu %.12le, %d third bodies, relativity %s\n",
+            typeName.c_str(), seriesOrder, satCount, centralMu,
+            (Integer)thirdBodies.size(), (relativity ? "on" : "off"));
+   #endif
+
+   return isInitialized;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step()
+//------------------------------------------------------------------------------
+/**
+ * Advances the state by one step
+ *
+ * The step is no larger than the current step size, which is set from the
+ * series of the previous step, and the maximum step setting.
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool TaylorSeries::Step()
+{
+   if (!isInitialized)
+      return false;
+
+   if (stepSize == 0.0)
+      return false;
+
+   // Finite burns and other transient forces are added during the run
+   if (((ODEModel*)physicalModel)->GetNumForces() != forceCount)
+      CheckForces();
+
+   Real h = stepSize;
+   if (fabs(h) > maximumStep)
+      h = (h > 0.0 ? maximumStep : -maximumStep);
+
+   return TakeStep(h);
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step(Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Advances the state across a specified interval
+ *
+ * The interval is covered with as many steps as the accuracy needs, the last
+ * ending on the end of the interval.  The step size set from the series of
+ * the last step is kept for the next call.
+ *
+ * @param dt The interval
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool TaylorSeries::Step(Real dt)
+{
+   if (!isInitialized)
+      return false;
+
+   if (dt == 0.0)
+   {
+      stepTaken = 0.0;
+      return true;
+   }
+
+   Real total = 0.0;
+
+   timeleft = dt;
+   while (fabs(timeleft) > smallestTime)
+   {
+      Real h = fabs(stepSize);
+      if ((h == 0.0) || (h > fabs(timeleft)))
+         h = fabs(timeleft);
+      stepSize = (dt > 0.0 ? h : -h);
+
+      if (!Step())
+         return false;
+
+      total += stepTaken;
+      timeleft = dt - total;
+   }
+
+   stepTaken = total;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool RawStep()
+//------------------------------------------------------------------------------
+/**
+ * Takes a step without error control
+ *
+ * The step size of a Taylor method comes from the series itself, so there is
+ * nothing to control afterwards; this method just calls Step().
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool TaylorSeries::RawStep()
+{
+   return Step();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterText(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+std::string TaylorSeries::GetParameterText(const Integer id) const
+{
+   if (id >= IntegratorParamCount && id < TaylorSeriesParamCount)
+      return PARAMETER_TEXT[id - IntegratorParamCount];
+
+   return Integrator::GetParameterText(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetParameterID(const std::string &str) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer TaylorSeries::GetParameterID(const std::string &str) const
+{
+   for (Integer i = IntegratorParamCount; i < TaylorSeriesParamCount; ++i)
+   {
+      if (str == PARAMETER_TEXT[i - IntegratorParamCount])
+         return i;
+   }
+
+   return Integrator::GetParameterID(str);
+}
+
+
+//------------------------------------------------------------------------------
+// Gmat::ParameterType GetParameterType(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Gmat::ParameterType TaylorSeries::GetParameterType(const Integer id) const
+{
+   if (id >= IntegratorParamCount && id < TaylorSeriesParamCount)
+      return PARAMETER_TYPE[id - IntegratorParamCount];
+
+   return Integrator::GetParameterType(id);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterTypeString(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+std::string TaylorSeries::GetParameterTypeString(const Integer id) const
+{
+   if (id >= IntegratorParamCount && id < TaylorSeriesParamCount)
+      return GmatBase::PARAM_TYPE_STRING[GetParameterType(id)];
+
+   return Integrator::GetParameterTypeString(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer TaylorSeries::GetIntegerParameter(const Integer id) const
+{
+   if (id == ORDER)
+      return order;
+
+   return Integrator::GetIntegerParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer TaylorSeries::GetIntegerParameter(const std::string &label) const
+{
+   return GetIntegerParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Sets the order of the series
+ *
+ * Orders from 2 to 40 are accepted; 0 selects the order from the Accuracy
+ * setting.
+ *
+ * @param id    ID for the parameter being set
+ * @param value New value for the parameter
+ *
+ * @return The parameter value
+ */
+//------------------------------------------------------------------------------
+Integer TaylorSeries::SetIntegerParameter(const Integer id, const Integer value)
+{
+   if (id == ORDER)
+   {
+      if ((value != 0) && ((value < 2) || (value > MAX_ORDER)))
+      {
+         std::stringstream buffer;
+         buffer << value;
+         throw PropagatorException(
+            "The value of \"" + buffer.str() + "\" for field \"Order\""
+            " on object \"" + instanceName + "\" is not an allowed value.\n"
+            "The allowed values are: [ 0 or 2 <= Integer <= 40 ]. ");
+      }
+      order = value;
+      isInitialized = false;
+      return order;
+   }
+
+   return Integrator::SetIntegerParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const std::string &label, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer TaylorSeries::SetIntegerParameter(const std::string &label,
+                                          const Integer value)
+{
+   return SetIntegerParameter(GetParameterID(label), value);
+}
+
+
+//---------------------------------
+// protected
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// Real EstimateError()
+//------------------------------------------------------------------------------
+/**
+ * Estimates the truncation error of the last step
+ *
+ * The error is the size of the last two terms of the series across the step,
+ * relative to the position or velocity they belong to.
+ *
+ * @return The largest relative error estimate
+ */
+//------------------------------------------------------------------------------
+Real TaylorSeries::EstimateError()
+{
+   Integer p1 = seriesOrder + 1;
+   Real h = fabs(stepTaken);
+   Real hLast = pow(h, seriesOrder - 1);
+   Real maxError = 0.0;
+
+   for (Integer i = 0; i < 2 * satCount; ++i)
+   {
+      Real size = 0.0, truncation = 0.0;
+      for (Integer c = 0; c < 3; ++c)
+      {
+         const Real *x = &stateSeries[cartesianIndex[3*i + c] * p1];
+         size = GmatMathUtil::Max(size, fabs(x[0]));
+         truncation = GmatMathUtil::Max(truncation, fabs(x[seriesOrder-1]) *
+               hLast + fabs(x[seriesOrder]) * hLast * h);
+      }
+      Real error = truncation / GmatMathUtil::Max(1.0, size);
+      maxError = GmatMathUtil::Max(maxError, error);
+   }
+
+   return maxError;
+}
+
+
+//------------------------------------------------------------------------------
+// bool AdaptStep(Real maxerror)
+//------------------------------------------------------------------------------
+/**
+ * Sets the step size for the next step
+ *
+ * The next step is the optimal step found for the series of the last step,
+ * kept within the step size limits.
+ *
+ * @param maxerror The error estimate for the last step (not used)
+ *
+ * @return true
+ */
+//------------------------------------------------------------------------------
+bool TaylorSeries::AdaptStep(Real maxerror)
+{
+   Real sign = (stepTaken >= 0.0 ? 1.0 : -1.0);
+   Real next = GetOptimalStep();
+
+   next = (next > minimumStep ? next : minimumStep);
+   next = (next < maximumStep ? next : maximumStep);
+   stepSize = sign * next;
+
+   if (fixedStep)
+      stepSize = (fabs(stepSize) < fabs(fixedStepsize) ?
+                  stepSize : fixedStepsize);
+
+   stepAttempts = 0;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void FindCartesianElements()
+//------------------------------------------------------------------------------
+/**
+ * Finds the Cartesian position and velocity elements of each spacecraft
+ *
+ * The elements are found from the propagation state manager, or, without
+ * one, the state is taken as a set of six element Cartesian states.  Other
+ * state elements, such as mass or the state transition matrix, have no
+ * series and are refused.
+ */
+//------------------------------------------------------------------------------
+void TaylorSeries::FindCartesianElements()
+{
+   cartesianIndex.clear();
+   satCount = 0;
+
+   const std::vector<ListItem*> *stateMap = NULL;
+   PropagationStateManager *psm =
+         ((ODEModel*)physicalModel)->GetPropStateManager();
+   if (psm != NULL)
+      stateMap = psm->GetStateMap();
+
+   if ((stateMap == NULL) || ((Integer)stateMap->size() != dimension))
+   {
+      if (dimension % 6 != 0)
+         throw PropagatorException("The TaylorSeries integrator " +
+               instanceName + " propagates Cartesian states only");
+      satCount = dimension / 6;
+      for (Integer j = 0; j < dimension; ++j)
+         cartesianIndex.push_back(j);
+      return;
+   }
+
+   std::vector<GmatBase*> objects;
+   for (Integer j = 0; j < dimension; ++j)
+   {
+      ListItem *item = (*stateMap)[j];
+      if ((item->elementID != Gmat::CARTESIAN_STATE) ||
+          (item->subelement < 1) || (item->subelement > 6))
+         throw PropagatorException("The TaylorSeries integrator " +
+               instanceName + " propagates Cartesian states only; it cannot "
+               "propagate " + item->objectName + "." + item->elementName);
+
+      Integer sat = (Integer)(find(objects.begin(), objects.end(),
+            item->object) - objects.begin());
+      if (sat == (Integer)objects.size())
+      {
+         objects.push_back(item->object);
+         cartesianIndex.resize(6 * objects.size(), -1);
+      }
+      cartesianIndex[6*sat + item->subelement - 1] = j;
+   }
+
+   satCount = (Integer)objects.size();
+   for (UnsignedInt i = 0; i < cartesianIndex.size(); ++i)
+      if (cartesianIndex[i] < 0)
+         throw PropagatorException("The TaylorSeries integrator " +
+               instanceName + " needs complete Cartesian states");
+}
+
+
+//------------------------------------------------------------------------------
+// void SetSeriesOrder()
+//------------------------------------------------------------------------------
+/**
+ * Sets the order of the series
+ *
+ * Unless an order is scripted, Jorba and Zou's estimate of the optimal order
+ * for the Accuracy setting, -ln(tolerance)/2 + 1, is used.
+ */
+//------------------------------------------------------------------------------
+void TaylorSeries::SetSeriesOrder()
+{
+   if (order > 0)
+      seriesOrder = order;
+   else
+   {
+      Real eps = GmatMathUtil::Max(tolerance, 1.0e-18);
+      seriesOrder = (Integer)ceil(-0.5 * log(eps) + 1.0);
+   }
+
+   seriesOrder = (seriesOrder < 2 ? 2 : seriesOrder);
+   seriesOrder = (seriesOrder > MAX_ORDER ? MAX_ORDER : seriesOrder);
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckForces()
+//------------------------------------------------------------------------------
+/**
+ * Collects the point mass and relativistic forces of the force model
+ *
+ * Forces that have no series recurrences in this integrator are refused.
+ * The series arrays are sized for the forces found.
+ */
+//------------------------------------------------------------------------------
+void TaylorSeries::CheckForces()
+{
+   ODEModel *ode = (ODEModel*)physicalModel;
+
+   origin = ode->GetForceOrigin();
+   if (origin == NULL)
+      throw PropagatorException("The TaylorSeries integrator " + instanceName +
+            " cannot find the origin of the force model " + ode->GetName());
+
+   centralMu = 0.0;
+   thirdBodies.clear();
+   thirdBodyMu.clear();
+   relativity = NULL;
+
+   forceCount = ode->GetNumForces();
+   for (Integer i = 0; i < forceCount; ++i)
+   {
+      PhysicalModel *force = ode->GetForce(i);
+      if (force->IsOfType("PointMassForce"))
+      {
+         CelestialBody *body = force->GetBody();
+         Real mu = force->GetRealParameter("GravConst");
+         if ((body == origin) || (body->GetName() == origin->GetName()))
+            centralMu = mu;
+         else
+         {
+            thirdBodies.push_back(body);
+            thirdBodyMu.push_back(mu);
+         }
+      }
+      else if (force->IsOfType("RelativisticCorrection"))
+         relativity = force;
+      else
+         throw PropagatorException("The TaylorSeries integrator " +
+               instanceName + " supports point mass forces and the "
+               "relativistic correction only; the force model " +
+               ode->GetName() + " includes a " + force->GetTypeName() +
+               " force");
+   }
+
+   if ((relativity != NULL) && (centralMu == 0.0))
+      throw PropagatorException("The TaylorSeries integrator " + instanceName +
+            " needs a point mass force for the central body " +
+            origin->GetName() + " with the relativistic correction");
+
+   Integer p1 = seriesOrder + 1;
+   Integer bodyCount = (Integer)thirdBodies.size();
+   bodySeries.assign(3 * bodyCount * p1, 0.0);
+   indirectSeries.assign(3 * bodyCount * p1, 0.0);
+   relativityAcceleration.assign(3 * satCount, 0.0);
+   stateSeries.assign(dimension * p1, 0.0);
+   // Central: rho, r^-3, r^-1, v.v, r.v, beta, 3 term series; third bodies:
+   // 3 relative positions, rho and r^-3 each
+   work.assign((9 + 5 * bodyCount) * p1, 0.0);
+
+   fitSpan = 0.0;
+}
+
+
+//------------------------------------------------------------------------------
+// bool FitEphemerides(Real epoch, Real span)
+//------------------------------------------------------------------------------
+/**
+ * Builds the position series of the third bodies across a step
+ *
+ * A polynomial is fit to the position of each third body, relative to the
+ * origin, at Chebyshev nodes across the span.  The fit is checked halfway
+ * between the nodes and at the ends of the span.
+ *
+ * @param epoch The A.1 epoch at the start of the step
+ * @param span  The time span of the fit, in seconds
+ *
+ * @return true if the fit met the Accuracy setting, false if not
+ */
+//------------------------------------------------------------------------------
+bool TaylorSeries::FitEphemerides(Real epoch, Real span)
+{
+   Integer p1 = seriesOrder + 1;
+   Integer degree = (seriesOrder < FIT_DEGREE ? seriesOrder : FIT_DEGREE);
+   Integer nodeCount = degree + 1;
+   Integer bodyCount = (Integer)thirdBodies.size();
+
+   Real nodes[FIT_DEGREE + 1], coeffs[FIT_DEGREE + 1], poly[FIT_DEGREE + 1];
+   for (Integer i = 0; i < nodeCount; ++i)
+      nodes[i] = 0.5 * (1.0 - cos(GmatMathConstants::PI * (i + 0.5) /
+            nodeCount));
+
+   bodySeries.assign(bodySeries.size(), 0.0);
+
+   for (Integer b = 0; b < bodyCount; ++b)
+   {
+      Real samples[3][FIT_DEGREE + 1];
+      for (Integer i = 0; i < nodeCount; ++i)
+      {
+         A1Mjd when(epoch + nodes[i] * span / GmatTimeConstants::SECS_PER_DAY);
+         Rvector6 bodyState = thirdBodies[b]->GetState(when);
+         Rvector6 originState = origin->GetState(when);
+         for (Integer c = 0; c < 3; ++c)
+            samples[c][i] = bodyState[c] - originState[c];
+      }
+
+      for (Integer c = 0; c < 3; ++c)
+      {
+         // Newton divided differences, then the monomial form in the
+         // normalized time tau = t / span
+         for (Integer i = 0; i < nodeCount; ++i)
+            coeffs[i] = samples[c][i];
+         for (Integer j = 1; j < nodeCount; ++j)
+            for (Integer i = nodeCount - 1; i >= j; --i)
+               coeffs[i] = (coeffs[i] - coeffs[i-1]) / (nodes[i] - nodes[i-j]);
+
+         for (Integer k = 0; k < nodeCount; ++k)
+            poly[k] = 0.0;
+         poly[0] = coeffs[nodeCount - 1];
+         for (Integer i = nodeCount - 2; i >= 0; --i)
+         {
+            for (Integer k = nodeCount - 1; k > 0; --k)
+               poly[k] = poly[k-1] - nodes[i] * poly[k];
+            poly[0] = coeffs[i] - nodes[i] * poly[0];
+         }
+
+         Real *s = &bodySeries[(3 * b + c) * p1];
+         Real scale = 1.0;
+         for (Integer k = 0; k < nodeCount; ++k)
+         {
+            s[k] = poly[k] / scale;
+            scale *= span;
+         }
+      }
+
+      // Check the fit between the nodes
+      for (Integer i = 0; i <= nodeCount; ++i)
+      {
+         Real tau = (i == 0 ? 0.0 : (i == nodeCount ? 1.0 :
+                     0.5 * (nodes[i-1] + nodes[i])));
+         Real t = tau * span;
+
+         A1Mjd when(epoch + t / GmatTimeConstants::SECS_PER_DAY);
+         Rvector6 bodyState = thirdBodies[b]->GetState(when);
+         Rvector6 originState = origin->GetState(when);
+
+         Real size = 0.0, miss = 0.0;
+         for (Integer c = 0; c < 3; ++c)
+         {
+            const Real *s = &bodySeries[(3 * b + c) * p1];
+            Real fit = 0.0;
+            for (Integer k = degree; k >= 0; --k)
+               fit = fit * t + s[k];
+            Real actual = bodyState[c] - originState[c];
+            size += actual * actual;
+            miss = GmatMathUtil::Max(miss, fabs(fit - actual));
+         }
+
+         if (miss > tolerance * GmatMathUtil::Max(1.0, sqrt(size)))
+         {
+            #ifdef DEBUG_EPHEMERIS_FIT
+               MessageInterface::ShowMessage("TaylorSeries: the %s fit misses "
+                     "by %le km over %lf sec\n",
+                     thirdBodies[b]->GetName().c_str(), miss, span);
+            #endif
+            return false;
+         }
+      }
+   }
+
+   fitSpan = span;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void BuildSeries(Real epoch)
+//------------------------------------------------------------------------------
+/**
+ * Builds the Taylor series of the state at the start of a step
+ *
+ * The third body position series must be built first, by FitEphemerides().
+ *
+ * @param epoch The A.1 epoch at the start of the step
+ */
+//------------------------------------------------------------------------------
+void TaylorSeries::BuildSeries(Real epoch)
+{
+   Integer p1 = seriesOrder + 1;
+   Integer bodyCount = (Integer)thirdBodies.size();
+
+   // The indirect accelerations, s / |s|^3, are the same for all spacecraft
+   Real *rho = &work[0];
+   Real *w   = &work[p1];
+   for (Integer b = 0; b < bodyCount; ++b)
+   {
+      const Real *s[3];
+      Real *indirect[3];
+      for (Integer c = 0; c < 3; ++c)
+      {
+         s[c] = &bodySeries[(3 * b + c) * p1];
+         indirect[c] = &indirectSeries[(3 * b + c) * p1];
+      }
+
+      for (Integer k = 0; k < seriesOrder; ++k)
+      {
+         rho[k] = Product(s[0], s[0], k) + Product(s[1], s[1], k) +
+                  Product(s[2], s[2], k);
+         w[k] = (k == 0 ? pow(rho[0], -1.5) : Power(rho, w, k, -1.5));
+         for (Integer c = 0; c < 3; ++c)
+            indirect[c][k] = Product(s[c], w, k);
+      }
+   }
+
+   // The relativistic correction is used as is at the start of the step
+   if (relativity != NULL)
+   {
+      physicalModel->GetDerivatives(inState, 0.0, 1);
+      const Real *accel = relativity->GetDerivativeArray();
+      for (Integer i = 0; i < satCount; ++i)
+         for (Integer c = 0; c < 3; ++c)
+            relativityAcceleration[3*i + c] = accel[cartesianIndex[6*i + c + 3]];
+   }
+
+   for (Integer i = 0; i < satCount; ++i)
+      BuildSatelliteSeries(i);
+}
+
+
+//------------------------------------------------------------------------------
+// void BuildSatelliteSeries(Integer sat)
+//------------------------------------------------------------------------------
+/**
+ * Builds the Taylor series of one spacecraft's state
+ *
+ * Given the coefficients of order k of the position and velocity, the
+ * coefficients of order k of the acceleration follow from the power series
+ * recurrences of the force terms; the coefficients of order k+1 of the
+ * position and velocity are then the velocity and acceleration coefficients
+ * divided by k+1.
+ *
+ * @param sat Index of the spacecraft
+ */
+//------------------------------------------------------------------------------
+void TaylorSeries::BuildSatelliteSeries(Integer sat)
+{
+   Integer p1 = seriesOrder + 1;
+   Integer bodyCount = (Integer)thirdBodies.size();
+   const Integer *index = &cartesianIndex[6 * sat];
+
+   Real *r[3], *v[3];
+   for (Integer c = 0; c < 3; ++c)
+   {
+      r[c] = &stateSeries[index[c] * p1];
+      v[c] = &stateSeries[index[c+3] * p1];
+      r[c][0] = inState[index[c]];
+      v[c][0] = inState[index[c+3]];
+   }
+
+   Real *rho   = &work[0];
+   Real *w     = &work[p1];
+   Real *q     = &work[2 * p1];
+   Real *sigma = &work[3 * p1];
+   Real *tau   = &work[4 * p1];
+   Real *beta  = &work[5 * p1];
+   Real *term[3] = { &work[6 * p1], &work[7 * p1], &work[8 * p1] };
+
+   Real lightSpeed = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM *
+                     GmatMathConstants::M_TO_KM;
+   Real relativityScale = centralMu / (lightSpeed * lightSpeed);
+
+   for (Integer k = 0; k < seriesOrder; ++k)
+   {
+      Real accel[3] = { 0.0, 0.0, 0.0 };
+
+      if (centralMu != 0.0)
+      {
+         rho[k] = Product(r[0], r[0], k) + Product(r[1], r[1], k) +
+                  Product(r[2], r[2], k);
+         w[k] = (k == 0 ? pow(rho[0], -1.5) : Power(rho, w, k, -1.5));
+         for (Integer j = 0; j < 3; ++j)
+            accel[j] -= centralMu * Product(r[j], w, k);
+      }
+
+      for (Integer b = 0; b < bodyCount; ++b)
+      {
+         Real *base = &work[(9 + 5 * b) * p1];
+         Real *d[3] = { base, base + p1, base + 2 * p1 };
+         Real *rhoB = base + 3 * p1;
+         Real *wB   = base + 4 * p1;
+
+         for (Integer j = 0; j < 3; ++j)
+            d[j][k] = r[j][k] - bodySeries[(3 * b + j) * p1 + k];
+         rhoB[k] = Product(d[0], d[0], k) + Product(d[1], d[1], k) +
+                   Product(d[2], d[2], k);
+         wB[k] = (k == 0 ? pow(rhoB[0], -1.5) : Power(rhoB, wB, k, -1.5));
+
+         for (Integer j = 0; j < 3; ++j)
+            accel[j] -= thirdBodyMu[b] * (Product(d[j], wB, k) +
+                  indirectSeries[(3 * b + j) * p1 + k]);
+      }
+
+      if (relativity != NULL)
+      {
+         // Schwarzschild term:
+         //    mu / (c^2 r^3) [(4 mu / r - v.v) r + 4 (r.v) v]
+         q[k] = (k == 0 ? pow(rho[0], -0.5) : Power(rho, q, k, -0.5));
+         sigma[k] = Product(v[0], v[0], k) + Product(v[1], v[1], k) +
+                    Product(v[2], v[2], k);
+         tau[k] = Product(r[0], v[0], k) + Product(r[1], v[1], k) +
+                  Product(r[2], v[2], k);
+         beta[k] = 4.0 * centralMu * q[k] - sigma[k];
+         for (Integer j = 0; j < 3; ++j)
+            term[j][k] = Product(beta, r[j], k) + 4.0 * Product(tau, v[j], k);
+
+         for (Integer j = 0; j < 3; ++j)
+         {
+            if (k == 0)
+               accel[j] += relativityAcceleration[3*sat + j];
+            else
+               accel[j] += relativityScale * Product(w, term[j], k);
+         }
+      }
+
+      for (Integer j = 0; j < 3; ++j)
+      {
+         r[j][k+1] = v[j][k] / (k + 1);
+         v[j][k+1] = accel[j] / (k + 1);
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetOptimalStep() const
+//------------------------------------------------------------------------------
+/**
+ * Finds the step size for the current series
+ *
+ * The step follows Jorba and Zou: for each position and velocity, the step
+ * that makes the last two terms of the series as large as the tolerance,
+ * scaled by a safety factor.
+ *
+ * @return The step size magnitude
+ */
+//------------------------------------------------------------------------------
+Real TaylorSeries::GetOptimalStep() const
+{
+   Integer p1 = seriesOrder + 1;
+   Real step = GmatRealConstants::REAL_MAX;
+
+   for (Integer i = 0; i < 2 * satCount; ++i)
+   {
+      Real size = 0.0, last = 0.0, nextToLast = 0.0;
+      for (Integer c = 0; c < 3; ++c)
+      {
+         const Real *x = &stateSeries[cartesianIndex[3*i + c] * p1];
+         size = GmatMathUtil::Max(size, fabs(x[0]));
+         nextToLast = GmatMathUtil::Max(nextToLast, fabs(x[seriesOrder-1]));
+         last = GmatMathUtil::Max(last, fabs(x[seriesOrder]));
+      }
+
+      Real eps = tolerance * GmatMathUtil::Max(1.0, size);
+      if (nextToLast > 0.0)
+         step = GmatMathUtil::Min(step,
+               pow(eps / nextToLast, 1.0 / (seriesOrder - 1)));
+      if (last > 0.0)
+         step = GmatMathUtil::Min(step, pow(eps / last, 1.0 / seriesOrder));
+   }
+
+   if (step == GmatRealConstants::REAL_MAX)
+      return step;
+
+   return step * exp(-0.7 / (seriesOrder - 1));
+}
+
+
+//------------------------------------------------------------------------------
+// bool TakeStep(Real h)
+//------------------------------------------------------------------------------
+/**
+ * Takes a step of no more than h
+ *
+ * The third body ephemerides are fit across the step, cutting it back until
+ * the fit is good enough.  The series of the state is then built, and the
+ * step is the smaller of the fit span and the optimal step for the series.
+ *
+ * @param h The largest step allowed
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool TaylorSeries::TakeStep(Real h)
+{
+   Real epoch = physicalModel->GetRealParameter("Epoch") +
+                physicalModel->GetTime() / GmatTimeConstants::SECS_PER_DAY;
+   Real span = h;
+
+   if (!thirdBodies.empty())
+   {
+      stepAttempts = 0;
+      while (!FitEphemerides(epoch, span))
+      {
+         span *= 0.5;
+         ++stepAttempts;
+         if ((fabs(span) < minimumStep) || (stepAttempts >= maxStepAttempts))
+         {
+            MessageInterface::ShowMessage("TaylorSeries: the ephemerides could "
+                  "not be fit to the Accuracy setting in %d attempts\n",
+                  stepAttempts);
+            return false;
+         }
+      }
+   }
+
+   BuildSeries(epoch);
+
+   Real step = GetOptimalStep();
+   if (step < minimumStep)
+   {
+      if (stopIfAccuracyViolated)
+         throw PropagatorException("TaylorSeries: Accuracy settings will be "
+               "violated with current step size values.\n");
+
+      if (!accuracyWarningTriggered)
+      {
+         accuracyWarningTriggered = true;
+         MessageInterface::PopupMessage(Gmat::WARNING_, "TaylorSeries: "
+               "Accuracy settings will be violated with current step size "
+               "values.\n");
+      }
+      step = minimumStep;
+   }
+   step = GmatMathUtil::Min(step, fabs(span));
+   stepTaken = (h > 0.0 ? step : -step);
+
+   // Sum the series across the step
+   Integer p1 = seriesOrder + 1;
+   for (Integer j = 0; j < dimension; ++j)
+   {
+      const Real *x = &stateSeries[j * p1];
+      Real value = 0.0;
+      for (Integer k = seriesOrder; k >= 0; --k)
+         value = value * stepTaken + x[k];
+      outState[j] = value;
+   }
+
+   lastError = EstimateError();
+   AdaptStep(lastError);
+
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("TaylorSeries step of %.12lf sec; error "
+            "estimate %le, next step %.12lf sec\n", stepTaken, lastError,
+            stepSize);
+   #endif
+
+   physicalModel->IncrementTime(stepTaken);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Product(const Real *a, const Real *b, Integer k)
+//------------------------------------------------------------------------------
+/**
+ * Returns coefficient k of the product of two series
+ *
+ * @param a The first series
+ * @param b The second series
+ * @param k The order of the coefficient
+ *
+ * @return The sum of a[j] b[k-j] for j = 0 to k
+ */
+//------------------------------------------------------------------------------
+Real TaylorSeries::Product(const Real *a, const Real *b, Integer k)
+{
+   Real sum = 0.0;
+   for (Integer j = 0; j <= k; ++j)
+      sum += a[j] * b[k-j];
+   return sum;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Power(const Real *u, const Real *w, Integer k, Real alpha)
+//------------------------------------------------------------------------------
+/**
+ * Returns coefficient k, k > 0, of the series w = u^alpha
+ *
+ * The recurrence follows from u w' = alpha u' w:
+ *
+ *    w[k] = sum over j < k of (k alpha - j (alpha + 1)) u[k-j] w[j] / (k u[0])
+ *
+ * @param u     The series raised to the power
+ * @param w     The series of the power, filled to order k-1
+ * @param k     The order of the coefficient
+ * @param alpha The exponent
+ *
+ * @return Coefficient k of the power
+ */
+//------------------------------------------------------------------------------
+Real TaylorSeries::Power(const Real *u, const Real *w, Integer k, Real alpha)
+{
+   Real sum = 0.0;
+   for (Integer j = 0; j < k; ++j)
+      sum += (k * alpha - j * (alpha + 1.0)) * u[k-j] * w[j];
+   return sum / (k * u[0]);
+}
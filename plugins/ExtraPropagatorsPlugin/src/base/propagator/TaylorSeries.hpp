@@ -0,0 +1,158 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TaylorSeries
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the variable step, high order Taylor series integrator.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef TaylorSeries_hpp
+#define TaylorSeries_hpp
+
+#include "ExtraPropagatorDefs.hpp"
+#include "Integrator.hpp"
+
+class CelestialBody;
+
+/**
+ * Variable step, high order Taylor series integrator for point mass dynamics
+ *
+ * Each step expands the state in a Taylor series about the start of the step.
+ * The series coefficients are built exactly, to the order of the method, by
+ * the power series (automatic differentiation) recurrences of the point mass
+ * accelerations, following A. Jorba and M. Zou, "A Software Package for the
+ * Numerical Integration of ODEs by Means of High-Order Taylor Methods",
+ * Experimental Mathematics 14(1), 2005.  The step size is set from the last
+ * two coefficients of the series, so steps are never rejected, and the order
+ * is chosen from the Accuracy setting unless one is scripted.
+ *
+ * The integrator handles force models made only of point mass forces, with
+ * an optional RelativisticCorrection, acting on Cartesian states.  The
+ * Schwarzschild part of the relativistic correction is expanded with the
+ * point mass terms; its smaller geodesic and Lense-Thirring parts are taken
+ * at the start of each step and held over the step.  The positions of the
+ * third bodies are expanded from polynomials fit to the ephemerides across
+ * each step, and a step is cut back when the fit does not reach the Accuracy
+ * setting.
+ */
+class PROPAGATOR_API TaylorSeries : public Integrator
+{
+public:
+   TaylorSeries(const std::string &nomme = "");
+   virtual ~TaylorSeries();
+   TaylorSeries(const TaylorSeries& ts);
+   TaylorSeries& operator=(const TaylorSeries& ts);
+
+   virtual GmatBase*       Clone() const;
+
+   virtual bool            Initialize();
+   virtual bool            Step();
+   virtual bool            Step(Real dt);
+   virtual bool            RawStep();
+
+   // Parameter accessor methods -- overridden from GmatBase
+   virtual std::string     GetParameterText(const Integer id) const;
+   virtual Integer         GetParameterID(const std::string &str) const;
+   virtual Gmat::ParameterType
+                           GetParameterType(const Integer id) const;
+   virtual std::string     GetParameterTypeString(const Integer id) const;
+
+   virtual Integer         GetIntegerParameter(const Integer id) const;
+   virtual Integer         GetIntegerParameter(const std::string &label) const;
+   virtual Integer         SetIntegerParameter(const Integer id,
+                                               const Integer value);
+   virtual Integer         SetIntegerParameter(const std::string &label,
+                                               const Integer value);
+
+protected:
+   enum
+   {
+      ORDER = IntegratorParamCount,
+      TaylorSeriesParamCount  /// Count of the parameters for this class
+   };
+   static const std::string
+         PARAMETER_TEXT[TaylorSeriesParamCount - IntegratorParamCount];
+   static const Gmat::ParameterType
+         PARAMETER_TYPE[TaylorSeriesParamCount - IntegratorParamCount];
+
+   /// Highest order allowed for the series
+   static const Integer    MAX_ORDER = 40;
+   /// Degree of the polynomials fit to the third body ephemerides
+   static const Integer    FIT_DEGREE = 12;
+
+   /// Scripted order of the series; 0 selects it from the Accuracy setting
+   Integer                 order;
+   /// Order used for the series
+   Integer                 seriesOrder;
+
+   /// Number of spacecraft Cartesian states in the state vector
+   Integer                 satCount;
+   /// State vector index of x, y, z, vx, vy and vz for each spacecraft
+   IntegerArray            cartesianIndex;
+
+   /// Origin of the force model
+   CelestialBody           *origin;
+   /// Gravitational parameter of the origin, or 0.0 without a point mass
+   /// force for it
+   Real                    centralMu;
+   /// Third bodies of the force model
+   std::vector<CelestialBody*>
+                           thirdBodies;
+   /// Gravitational parameters of the third bodies
+   RealArray               thirdBodyMu;
+   /// The relativistic correction, or NULL if the force model has none
+   PhysicalModel           *relativity;
+   /// Number of forces in the force model when they were checked
+   Integer                 forceCount;
+
+   /// Series of the third body positions: body, component, coefficient
+   RealArray               bodySeries;
+   /// Series of the indirect (origin) accelerations of the third bodies
+   RealArray               indirectSeries;
+   /// Relativistic accelerations at the start of the step
+   RealArray               relativityAcceleration;
+   /// Series of the state, for each element of the state vector
+   RealArray               stateSeries;
+   /// Work series for the recurrences
+   RealArray               work;
+
+   /// Time span of the last ephemeris fit
+   Real                    fitSpan;
+   /// Error estimate for the last step
+   Real                    lastError;
+
+   virtual Real            EstimateError();
+   virtual bool            AdaptStep(Real maxerror);
+
+   void                    FindCartesianElements();
+   void                    SetSeriesOrder();
+   void                    CheckForces();
+   bool                    FitEphemerides(Real epoch, Real span);
+   void                    BuildSeries(Real epoch);
+   void                    BuildSatelliteSeries(Integer sat);
+   Real                    GetOptimalStep() const;
+   bool                    TakeStep(Real h);
+
+   static Real             Product(const Real *a, const Real *b, Integer k);
+   static Real             Power(const Real *u, const Real *w, Integer k,
+                                 Real alpha);
+};
+
+#endif // TaylorSeries_hpp
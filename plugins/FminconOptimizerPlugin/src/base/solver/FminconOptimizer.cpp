@@ -73,7 +73,7 @@ FminconOptimizer::PARAMETER_TYPE[
 // made to the Optimize command (where it is adding single quotes to
 // string options) and to the IsAllowedValue method; the
 // NUM_MATLAB_OPTIONS parameter may also need to be changed
-const std::string FminconOptimizer::ALLOWED_OPTIONS[6] =
+const std::string FminconOptimizer::ALLOWED_OPTIONS[8] =
 {
    "DiffMaxChange",
    "DiffMinChange",
@@ -81,9 +81,11 @@ const std::string FminconOptimizer::ALLOWED_OPTIONS[6] =
    "TolX",
    "TolFun",
    "TolCon",
+   "GradObj",
+   "GradConstr",
 };
 
-const std::string FminconOptimizer::DEFAULT_OPTION_VALUES[6] =
+const std::string FminconOptimizer::DEFAULT_OPTION_VALUES[8] =
 {
    "0.1000",
    "1.0000e-08",
@@ -91,9 +93,11 @@ const std::string FminconOptimizer::DEFAULT_OPTION_VALUES[6] =
    "1.0000e-04",
    "1.0000e-04",
    "1.0000e-04",
+   "off",
+   "off",
 };
 
-const Integer FminconOptimizer::NUM_MATLAB_OPTIONS    = 6;
+const Integer FminconOptimizer::NUM_MATLAB_OPTIONS    = 8;
 const Integer FminconOptimizer::MATLAB_OPTIONS_OFFSET = 1000;
 
 //------------------------------------------------------------------------------
@@ -105,7 +109,9 @@ const Integer FminconOptimizer::MATLAB_OPTIONS_OFFSET = 1000;
 //------------------------------------------------------------------------------
 FminconOptimizer::FminconOptimizer(const std::string &name) :
    ExternalOptimizer       ("FminconOptimizer", name),
-   fminconExitFlag         (-999)
+   fminconExitFlag         (-999),
+   nominalCost             (0.0),
+   pertStep                (0.0)
  {
    objectTypeNames.push_back("FminconOptimizer");
    parameterCount = FminconOptimizerParamCount;
@@ -160,7 +166,9 @@ FminconOptimizer::~FminconOptimizer()
 //------------------------------------------------------------------------------
 FminconOptimizer::FminconOptimizer(const FminconOptimizer &opt) :
    ExternalOptimizer       (opt),
-   fminconExitFlag         (-999)
+   fminconExitFlag         (-999),
+   nominalCost             (0.0),
+   pertStep                (0.0)
 {
    #ifdef DEBUG_FMINCON_OPTIONS // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
       MessageInterface::ShowMessage(
@@ -319,73 +327,40 @@ StringArray FminconOptimizer::AdvanceNestedState(std::vector<Real> vars)
          "now building return string array\n");
       #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
       CalculateParameters();
-      std::stringstream outS;
-      outS.precision(18);
-      std::string       oneResult;
-
-      // F
-      //outS.str();
-      outS.str("");
-      outS << cost;
-      oneResult = "F = " + outS.str() + ";";
-      #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
-         MessageInterface::ShowMessage(
-         "   adding %s to string array\n", oneResult.c_str());
-      #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
-      results.push_back(oneResult);
-
-      // GradF
-      outS.str("");
-      for (Integer i=0; i<(Integer) gradient.size(); i++)
-         outS << gradient.at(i) << ";";
-      oneResult = "GradF = [" + outS.str() + "];";
-      #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
-         MessageInterface::ShowMessage(
-         "   adding %s to string array\n", oneResult.c_str());
-      #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
-      results.push_back(oneResult);
-
-      // equality constraints
-      outS.str("");
-      for (Integer i=0; i<(Integer) eqConstraintValues.size(); i++)
-         outS << eqConstraintValues.at(i) << ";";
-      oneResult = "NonLinearEqCon = [" + outS.str() + "];";
-      #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
-         MessageInterface::ShowMessage(
-         "   adding %s to string array\n", oneResult.c_str());
-      #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
-      results.push_back(oneResult);
-
-      // inequality constraints
-      outS.str("");
-      for (Integer i=0; i<(Integer) ineqConstraintValues.size(); i++)
-         outS << ineqConstraintValues.at(i) << ";";
-      oneResult = "NonLinearIneqCon = [" + outS.str() + "];";
-      #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
-         MessageInterface::ShowMessage(
-         "   adding %s to string array\n", oneResult.c_str());
-      #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
-      results.push_back(oneResult);
 
-      // Jacobian in the future ---------------------- <future> ----------------
-      oneResult = "JacNonLinearEqCon = [];";
-      #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
-         MessageInterface::ShowMessage(
-         "   adding %s to string array\n", oneResult.c_str());
-      #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
-      results.push_back(oneResult);
-      oneResult = "JacNonLinearIneqCon = [];";
-      #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
-         MessageInterface::ShowMessage(
-         "   adding %s to string array\n", oneResult.c_str());
-      #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
-      results.push_back(oneResult);
-
-      // Jacobian in the future ---------------------- <future> ----------------
+      // When fmincon takes its derivatives from GMAT, run one perturbation
+      // pass per variable before answering
+      if (UsesGmatDerivatives() && (variableCount > 0))
+      {
+         StoreNominalResults();
+         pertNumber = 0;
+         RunPerturbation();
+         nestedState = PERTURBING;
+         return results;
+      }
 
+      results = BuildCallbackResults();
       WriteToTextFile(nestedState);
       nestedState = NOMINAL;
    }
+   else if (nestedState == PERTURBING)
+   {
+      AccumulatePerturbation();
+      ++pertNumber;
+      if (pertNumber < variableCount)
+      {
+         RunPerturbation();
+         return results;
+      }
+
+      // Report the nominal pass, now with its derivatives
+      cost = nominalCost;
+      eqConstraintValues = nominalEqValues;
+      ineqConstraintValues = nominalIneqValues;
+      results = BuildCallbackResults();
+      WriteToTextFile(CALCULATING);
+      nestedState = NOMINAL;
+   }
    return results;
 }
 
@@ -446,9 +421,9 @@ bool FminconOptimizer::Optimize()
          allEmpty = false;
          if (i != 0) optS << ",";
          optS << "\'" << options.at(i)      << "\',";
-         /// @todo do this in a better way, not using 7->11, etc.
-         if ((7 <= i) && (i <= 11)) // put single quotes around strings
-            optS << "\'" << optionValues.at(i) << "\'";
+         Real numericValue;
+         if (!GmatStringUtil::ToReal(optionValues.at(i), numericValue))
+            optS << "\'" << optionValues.at(i) << "\'";  // quote strings
          else
             optS << optionValues.at(i);         }
    }
@@ -464,46 +439,25 @@ bool FminconOptimizer::Optimize()
    else
       EvalMatlabString(optionsStr);
 
-   std::string inParm;
-   std::ostringstream mlS;
-   // pass to MATLAB the X0 array (needs to be a column vector)
-   mlS.str("");
-   mlS.precision(18);
-
-   for (Integer i=0;i<(Integer)variable.size();i++)
-      mlS << variable.at(i) << ";";
-   inParm = "X0 = [" + mlS.str() + "];";
+   // pass to MATLAB the X0, Lower and Upper column vectors as arrays, so
+   // no precision is lost to formatting
+   Integer n = (Integer)variable.size();
    if (debugMatlabIF) // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
    {
       MessageInterface::ShowMessage(
-      "In Optimize method, parameter string is: %s ....\n", inParm.c_str());
+      "In Optimize method, passing X0, Lower and Upper with %d rows ....\n",
+      n);
    } // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
-   EvalMatlabString(inParm);
-
-   // pass to MATLAB the Lower column vector
-   mlS.str("");
-   for (Integer i=0;i<(Integer)variableMinimum.size();i++)
-      mlS << variableMinimum.at(i) << ";";
-   inParm = "Lower = [" + mlS.str() + "];";
-   if (debugMatlabIF) // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
+   if (n > 0)
    {
-      MessageInterface::ShowMessage(
-      "In Optimize method, parameter string is: %s ....\n", inParm.c_str());
-   } // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
-   EvalMatlabString(inParm);
-
-   // pass to MATLAB the Upper column vector
-   mlS.str("");
-   for (Integer i=0;i<(Integer)variableMaximum.size();i++)
-      mlS << variableMaximum.at(i) << ";";
-
-   inParm = "Upper = [" + mlS.str() + "];";
-   if (debugMatlabIF) // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
+      matlabIf->PutRealArray("X0", n, 1, &variable[0]);
+      matlabIf->PutRealArray("Lower", n, 1, &variableMinimum[0]);
+      matlabIf->PutRealArray("Upper", n, 1, &variableMaximum[0]);
+   }
+   else
    {
-      MessageInterface::ShowMessage(
-      "In Optimize method, parameter string is: %s ....\n", inParm.c_str());
-   } // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
-   EvalMatlabString(inParm);
+      EvalMatlabString("X0 = []; Lower = []; Upper = [];");
+   }
 
    // clear last errormsg
    matlabIf->EvalString("clear errormsg");
@@ -604,18 +558,18 @@ Integer FminconOptimizer::GetParameterID(const std::string &str) const
 {
    // part 1: this part will be removed in future build // made a change here
    if ((str == "DerivativeCheck")||(str == "Diagnostics")||
-       (str == "Display")||(str == "GradObj")||
-       (str == "GradConstr")||(str == "MaxIter"))
+       (str == "Display")||(str == "MaxIter"))
    {
       return Gmat::PARAMETER_REMOVED; // return the id of the fields no longer in use
    }
 
    // part 2:
-   for (Integer i = ExternalOptimizerParamCount; i < FminconOptimizerParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - ExternalOptimizerParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ExternalOptimizerParamCount,
+               FminconOptimizerParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    for (Integer j =0; j < NUM_MATLAB_OPTIONS; j++)
       if (str == ALLOWED_OPTIONS[j])
          return (MATLAB_OPTIONS_OFFSET + j);
@@ -954,6 +908,190 @@ void FminconOptimizer::CalculateParameters()
 }
 
 
+//------------------------------------------------------------------------------
+// void RunPerturbation()
+//------------------------------------------------------------------------------
+/**
+ * Perturbs the variable for the next perturbation pass.
+ *
+ * The step is the variable's scripted Perturbation, reversed when the
+ * perturbed value would pass the variable's upper bound.
+ */
+//------------------------------------------------------------------------------
+void FminconOptimizer::RunPerturbation()
+{
+   pertStep = perturbation.at(pertNumber);
+   if (variable.at(pertNumber) + pertStep > variableMaximum.at(pertNumber))
+      pertStep = -pertStep;
+   variable.at(pertNumber) += pertStep;
+}
+
+
+//------------------------------------------------------------------------------
+// bool UsesGmatDerivatives()
+//------------------------------------------------------------------------------
+/**
+ * Checks if fmincon has been told to take its gradients from GMAT.
+ *
+ * @return true if GradObj or GradConstr is on
+ */
+//------------------------------------------------------------------------------
+bool FminconOptimizer::UsesGmatDerivatives()
+{
+   for (UnsignedInt i = 0; i < options.size(); ++i)
+      if (((options[i] == "GradObj") || (options[i] == "GradConstr")) &&
+          (optionValues[i] == "on"))
+         return true;
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void StoreNominalResults()
+//------------------------------------------------------------------------------
+/**
+ * Saves the results of the nominal pass and sizes the derivative buffers
+ * before the perturbation passes run.
+ */
+//------------------------------------------------------------------------------
+void FminconOptimizer::StoreNominalResults()
+{
+   nominalCost = cost;
+   nominalEqValues = eqConstraintValues;
+   nominalIneqValues = ineqConstraintValues;
+
+   gradient.assign(variableCount, 0.0);
+   eqJacobian.assign(variableCount * eqConstraintCount, 0.0);
+   ineqJacobian.assign(variableCount * ineqConstraintCount, 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// void AccumulatePerturbation()
+//------------------------------------------------------------------------------
+/**
+ * Fills in the derivatives with respect to the variable that was perturbed,
+ * using forward differences against the nominal pass, and restores the
+ * variable.
+ */
+//------------------------------------------------------------------------------
+void FminconOptimizer::AccumulatePerturbation()
+{
+   gradient.at(pertNumber) = (cost - nominalCost) / pertStep;
+   for (Integer j = 0; j < eqConstraintCount; ++j)
+      eqJacobian.at(pertNumber * eqConstraintCount + j) =
+            (eqConstraintValues.at(j) - nominalEqValues.at(j)) / pertStep;
+   for (Integer j = 0; j < ineqConstraintCount; ++j)
+      ineqJacobian.at(pertNumber * ineqConstraintCount + j) =
+            (ineqConstraintValues.at(j) - nominalIneqValues.at(j)) / pertStep;
+
+   variable.at(pertNumber) -= pertStep;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string FormatJacobian(const std::vector<Real> &jac, Integer cols)
+//------------------------------------------------------------------------------
+/**
+ * Writes a Jacobian as the body of a MATLAB matrix literal.
+ *
+ * @param jac  The Jacobian, one row of cols values per variable
+ * @param cols The number of constraints
+ *
+ * @return The rows, separated by semicolons; empty if there is no Jacobian
+ */
+//------------------------------------------------------------------------------
+static std::string FormatJacobian(const std::vector<Real> &jac, Integer cols)
+{
+   std::stringstream outS;
+   outS.precision(18);
+   if ((cols > 0) && ((Integer)jac.size() >= cols))
+   {
+      for (UnsignedInt k = 0; k < jac.size(); ++k)
+         outS << jac[k] << (((Integer)(k + 1) % cols == 0) ? ";" : " ");
+   }
+   return outS.str();
+}
+
+//------------------------------------------------------------------------------
+// StringArray BuildCallbackResults()
+//------------------------------------------------------------------------------
+/**
+ * Builds the MATLAB statements that return the results of a pass to fmincon.
+ *
+ * @return The statements, one per returned quantity
+ */
+//------------------------------------------------------------------------------
+StringArray FminconOptimizer::BuildCallbackResults()
+{
+   StringArray results;
+   std::stringstream outS;
+   outS.precision(18);
+   std::string       oneResult;
+
+   // F
+   //outS.str();
+   outS.str("");
+   outS << cost;
+   oneResult = "F = " + outS.str() + ";";
+   #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
+      MessageInterface::ShowMessage(
+      "   adding %s to string array\n", oneResult.c_str());
+   #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
+   results.push_back(oneResult);
+
+   // GradF
+   outS.str("");
+   for (Integer i=0; i<(Integer) gradient.size(); i++)
+      outS << gradient.at(i) << ";";
+   oneResult = "GradF = [" + outS.str() + "];";
+   #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
+      MessageInterface::ShowMessage(
+      "   adding %s to string array\n", oneResult.c_str());
+   #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
+   results.push_back(oneResult);
+
+   // equality constraints
+   outS.str("");
+   for (Integer i=0; i<(Integer) eqConstraintValues.size(); i++)
+      outS << eqConstraintValues.at(i) << ";";
+   oneResult = "NonLinearEqCon = [" + outS.str() + "];";
+   #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
+      MessageInterface::ShowMessage(
+      "   adding %s to string array\n", oneResult.c_str());
+   #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
+   results.push_back(oneResult);
+
+   // inequality constraints
+   outS.str("");
+   for (Integer i=0; i<(Integer) ineqConstraintValues.size(); i++)
+      outS << ineqConstraintValues.at(i) << ";";
+   oneResult = "NonLinearIneqCon = [" + outS.str() + "];";
+   #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
+      MessageInterface::ShowMessage(
+      "   adding %s to string array\n", oneResult.c_str());
+   #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
+   results.push_back(oneResult);
+
+   // Jacobians, one row per variable
+   oneResult = "JacNonLinearEqCon = [" +
+         FormatJacobian(eqJacobian, eqConstraintCount) + "];";
+   #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
+      MessageInterface::ShowMessage(
+      "   adding %s to string array\n", oneResult.c_str());
+   #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
+   results.push_back(oneResult);
+   oneResult = "JacNonLinearIneqCon = [" +
+         FormatJacobian(ineqJacobian, ineqConstraintCount) + "];";
+   #ifdef DEBUG_OPTIMIZER_DATA // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ debug ~~~~
+      MessageInterface::ShowMessage(
+      "   adding %s to string array\n", oneResult.c_str());
+   #endif // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ end debug ~~~~
+   results.push_back(oneResult);
+
+   return results;
+}
+
 //------------------------------------------------------------------------------
 // void RunComplete()
 //------------------------------------------------------------------------------
@@ -1758,6 +1896,12 @@ void FminconOptimizer::WriteParameters(Gmat::WriteMode mode, std::string &prefix
                // Handle options list
                for (Integer ii = 0; ii < NUM_MATLAB_OPTIONS; ii++)
                {
+                  // The gradient switches are only written when turned on
+                  if (((options[ii] == "GradObj") ||
+                       (options[ii] == "GradConstr")) &&
+                      (optionValues[ii] == "off"))
+                     continue;
+
                   value.str("");
                   WriteParameterValue((ii + MATLAB_OPTIONS_OFFSET), value);
                   if (value.str() != "")
@@ -1828,6 +1972,11 @@ bool FminconOptimizer::IsAllowedValue(const std::string &opt,
       if (atoi(val.c_str()) > 0) return true;
       return false;
    }
+   else if ((opt == ALLOWED_OPTIONS[6]) ||
+            (opt == ALLOWED_OPTIONS[7]))
+   {
+      return ((val == "on") || (val == "off"));
+   }
 
    return false;
 }
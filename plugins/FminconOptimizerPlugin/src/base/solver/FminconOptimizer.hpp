@@ -106,11 +106,24 @@ protected:
    Integer      fminconExitFlag;
    /// The interface ised to exchange data with fmincon running in MATLAB
    MatlabInterface *matlabIf;
+
+   /// Cost of the nominal pass, kept while the perturbation passes run
+   Real         nominalCost;
+   /// Equality constraint values of the nominal pass
+   std::vector<Real> nominalEqValues;
+   /// Inequality constraint values of the nominal pass
+   std::vector<Real> nominalIneqValues;
+   /// Jacobian of the equality constraints, one row per variable
+   std::vector<Real> eqJacobian;
+   /// Jacobian of the inequality constraints, one row per variable
+   std::vector<Real> ineqJacobian;
+   /// Step applied to the variable in the current perturbation pass
+   Real         pertStep;
    
    /// Table of options supported, excluding options inherited from base classes
-   static const std::string    ALLOWED_OPTIONS[6];
+   static const std::string    ALLOWED_OPTIONS[8];
    /// Default values for the supported options
-   static const std::string    DEFAULT_OPTION_VALUES[6];
+   static const std::string    DEFAULT_OPTION_VALUES[8];
    /// Option count
    static const Integer        NUM_MATLAB_OPTIONS;
    /// Option strting index, for use in the parameter access methods
@@ -120,6 +133,7 @@ protected:
    virtual void         CompleteInitialization();
    virtual void         RunExternal();
    virtual void         RunNominal();
+   virtual void         RunPerturbation();
    virtual void         CalculateParameters();
    virtual void         RunComplete();
    
@@ -138,6 +152,11 @@ protected:
    void                 WriteSearchPath(const std::string &msg);
    void                 EvalMatlabString(const std::string &evalString);
    
+   bool                 UsesGmatDerivatives();
+   void                 StoreNominalResults();
+   void                 AccumulatePerturbation();
+   StringArray          BuildCallbackResults();
+   
 public:
    // Parameter IDs
    enum
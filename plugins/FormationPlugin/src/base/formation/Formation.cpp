@@ -422,11 +422,12 @@ std::string Formation::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Formation::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SpaceObjectParamCount; i < FormationParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpaceObjectParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SpaceObjectParamCount,
+               FormationParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return FormationInterface::GetParameterID(str);
 }
@@ -210,13 +210,6 @@ bool GeometricRange::Evaluate(bool withEvents)
       
    if (!initialized) InitializeMeasurement();
 
-   // Get minimum elevation angle for ground station
-   Real minAngle;
-   if (participants[0]->IsOfType(Gmat::SPACECRAFT) == false)
-      minAngle = ((GroundstationInterface*)participants[0])->GetRealParameter("MinimumElevationAngle");
-   else if (participants[1]->IsOfType(Gmat::SPACECRAFT) == false)
-      minAngle = ((GroundstationInterface*)participants[1])->GetRealParameter("MinimumElevationAngle");
-
    CalculateRangeVectorInertial();
 //   currentMeasurement.feasibilityValue = rangeVecInertial * p1Loc;
    UpdateRotationMatrix(currentMeasurement.epoch, "All");
@@ -233,6 +226,14 @@ bool GeometricRange::Evaluate(bool withEvents)
    }
    else
    {
+      // Get minimum elevation angle for ground station; it is only needed
+      // when the feasibility is checked
+      Real minAngle;
+      if (participants[0]->IsOfType(Gmat::SPACECRAFT) == false)
+         minAngle = ((GroundstationInterface*)participants[0])->GetRealParameter("MinimumElevationAngle");
+      else if (participants[1]->IsOfType(Gmat::SPACECRAFT) == false)
+         minAngle = ((GroundstationInterface*)participants[1])->GetRealParameter("MinimumElevationAngle");
+
 	  if (currentMeasurement.feasibilityValue > minAngle)
 	  {
          currentMeasurement.isFeasible = true;
@@ -692,6 +692,15 @@ bool GmatFunction::Execute(ObjectInitializer *objInit, bool reinitialize)
    if (reinitialize)
       objectsInitialized = false;
    
+   // A reused call frame keeps its initialized objects; other calls since may
+   // have pointed the Validator elsewhere, and it creates the output wrappers
+   if (frameReused)
+   {
+      validator->SetFunction(this);
+      validator->SetSolarSystem(solarSys);
+      validator->SetObjectMap(&validatorStore);
+   }
+   
    #ifdef DEBUG_FUNCTION_EXEC
    MessageInterface::ShowMessage("   objectsInitialized = %d\n", objectsInitialized);
    #endif
@@ -702,7 +711,7 @@ bool GmatFunction::Execute(ObjectInitializer *objInit, bool reinitialize)
    // Reinitialize CalculatedPoints (LOJ:2015.01.08)
    // Reinitialize CoordinateSystems to fix bug 1599 (LOJ: 2009.11.05)
    // Reinitialize Parameters to fix bug 1519 (LOJ: 2009.09.16)
-   if (objectsInitialized)
+   if (objectsInitialized && !frameReused)
    {
       #ifdef DEBUG_FUNCTION_EXEC
       MessageInterface::ShowMessage
@@ -1278,11 +1278,12 @@ int MatlabInterface::CloseSingleEngine(const std::string &name)
 //------------------------------------------------------------------------------
 Integer MatlabInterface::GetParameterID(const std::string &str) const
 {
-   for (Integer i = InterfaceParamCount; i < MatlabInterfaceParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - InterfaceParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, InterfaceParamCount,
+               MatlabInterfaceParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Interface::GetParameterID(str);
 }
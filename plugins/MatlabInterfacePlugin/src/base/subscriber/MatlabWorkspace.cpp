@@ -277,11 +277,12 @@ std::string MatlabWorkspace::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer MatlabWorkspace::GetParameterID(const std::string &str) const
 {
-    for (Integer i = SubscriberParamCount; i < MatlabWorkspaceParamCount; i++)
-    {
-        if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-            return i;
-    }
+    static const ParameterIndex
+          parameterIndex(PARAMETER_TEXT, SubscriberParamCount,
+                MatlabWorkspaceParamCount);
+    Integer parameterId = parameterIndex.Find(str);
+    if (parameterId != -1)
+       return parameterId;
 
     return Subscriber::GetParameterID(str);
 }
@@ -9,6 +9,8 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <algorithm>
+#include <thread>
 #include "UtilityException.hpp"
 #include "StringUtil.hpp"
 #include "Rvector3.hpp"
@@ -26,13 +28,27 @@ using namespace GmatStringUtil;
 //#define DEBUG_READ_DATAFILE
 //#define DEBUG_INCENTERS_CALCULATION
 //#define DEBUG_FACENORMALS_CALCULATION
+//#define DEBUG_FIELD_DATA
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+
+/// Number of values summed by SumRange(): the edge vector and matrix, the face
+/// vector and matrix, and the solid angle
+static const Integer SUM_SIZE = 25;
+/// Fewest faces a thread sums; smaller bodies are summed on one thread
+static const Integer MIN_FACES_PER_THREAD = 4096;
 
 //------------------------------------------------------------------------------
 // public methods
 //------------------------------------------------------------------------------
 
 PolyhedronBody::PolyhedronBody(const std::string &filename):
-   isLoad       (false)
+   isLoad           (false),
+   isFieldDataBuilt (false),
+   volume           (0.0),
+   boundingRadius   (0.0)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("PolyhedronBody default construction <%p>\n", this);
@@ -62,17 +78,17 @@ PolyhedronBody::~PolyhedronBody()
    attachmentA.clear();
    attachmentB.clear();
 
-   edgeMap.clear();
-   attachmentAMap.clear();
-   attachmentBMap.clear();
-
+   edgeIndex.clear();
 }
 
 
 PolyhedronBody::PolyhedronBody(const PolyhedronBody& polybody):
    verticesList  (polybody.verticesList),
    facesList 	  (polybody.facesList),
-   isLoad        (polybody.isLoad)
+   isLoad        (polybody.isLoad),
+   isFieldDataBuilt (false),
+   volume        (0.0),
+   boundingRadius (0.0)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("PolyhedronBody copy construction <%p>\n", this);
@@ -91,6 +107,7 @@ PolyhedronBody& PolyhedronBody::operator= (const PolyhedronBody& polybody)
    verticesList = polybody.verticesList;
    facesList 	 = polybody.facesList;
    isLoad       = polybody.isLoad;
+   isFieldDataBuilt = false;
 
    return *this;
 }
@@ -403,22 +420,14 @@ bool PolyhedronBody::IsInEdgesList(Edge& edge, bool& isAttachmentB)
 {
    isAttachmentB = false;
 
-   // Specify edge's indexKey 
-   Integer indexKey = (Integer)Min((Real)edge.vertex1,(Real)edge.vertex2)*100000 +
-                      (Integer)Max((Real)edge.vertex1,(Real)edge.vertex2);
+   EdgeIndexMap::iterator entry =
+         edgeIndex.find(MakeEdgeKey(edge.vertex1, edge.vertex2));
+   if (entry == edgeIndex.end())
+      return false;
 
-   for (std::map<Integer, Edge>::iterator i = edgeMap.begin(); i != edgeMap.end(); ++i)
-	{ 
-      if ((*i).first == indexKey)
-      {
-         Edge e = (*i).second;
-
-         if (edge.vertex1 == e.vertex2)
-            isAttachmentB = true;
-         return true;
-      }
-	}
-	return false;
+   if (edge.vertex1 == E[entry->second].vertex2)
+      isAttachmentB = true;
+   return true;
 }
 
 
@@ -427,94 +436,77 @@ bool PolyhedronBody::IsInEdgesList(Edge& edge, bool& isAttachmentB)
 //-------------------------------------------------------------------------------
 /*
  * This function is used to create edges list and 2 attachment faces to each edge
+ *
+ * Each edge is looked up in a hash table as the faces are scanned, so the
+ * build is linear in the number of faces apart from the final sort, which
+ * orders the edges by their vertex indices as the edge list always was.
 */
 //-------------------------------------------------------------------------------
 bool PolyhedronBody::Edges()
 {
-   bool isAttachmentB;
-   Integer indexKey;
-
    PolygonFace face;
-   Edge e1, e2, e3;
+   Edge edge;
+   EdgeKey key;
 
-   edgeMap.clear();
-   attachmentAMap.clear();
-   attachmentBMap.clear();
+   edgeIndex.clear();
    E.clear();
    attachmentA.clear();
    attachmentB.clear();
 
+   // Edges and their attached faces, in the order the edges are found
+   std::vector<EdgeKey> foundKeys;
+   EdgesList foundEdges;
+   FaceIndexList foundA, foundB;
+
+   edgeIndex.reserve(facesList.size() * 3 / 2 + 1);
    for(unsigned int i=0; i < facesList.size(); ++i)
    {
       face = facesList[i];
 
-      // For a triangular face <face[0], face[1], face[2]>, it has 3 edges e1, e2, and e3
-      e1.vertex1 = face[0]; e1.vertex2 = face[1];
-      e2.vertex1 = face[1]; e2.vertex2 = face[2];
-      e3.vertex1 = face[2]; e3.vertex2 = face[0];
-
-	   // Add e1 to edges list if it has not existed in edges list:
-      indexKey = (Integer)Min((Real)e1.vertex1,(Real)e1.vertex2)*100000 +
-                 (Integer)Max((Real)e1.vertex1,(Real)e1.vertex2);
-      if (!IsInEdgesList(e1, isAttachmentB))
-      {
-         edgeMap[indexKey] = e1;
-         attachmentAMap[indexKey] = i;                      // add atachment face A
-         attachmentBMap[indexKey] = -1;                     // add null value to attachmentB list
-      }
-      else
-      {
-         if (isAttachmentB)
-            attachmentBMap[indexKey] = i;                   // add attachment to face B
-      }
-
-      // Add e2 to edges list if it has not existed in edges list:
-      indexKey = (Integer)Min((Real)e2.vertex1,(Real)e2.vertex2)*100000 +
-                 (Integer)Max((Real)e2.vertex1,(Real)e2.vertex2);
-      if (!IsInEdgesList(e2, isAttachmentB))
-      {
-         edgeMap[indexKey] = e2;
-         attachmentAMap[indexKey] = i;                      // add atachment face A
-         attachmentBMap[indexKey] = -1;                     // add null value to attachmentB list
-      }
-      else
-      {
-         if (isAttachmentB)
-            attachmentBMap[indexKey] = i;                   // add attachment to face B
-      }
-
-      // Add e3 to edges list if it has not existed in edges list:
-      indexKey = (Integer)Min((Real)e3.vertex1,(Real)e3.vertex2)*100000 +
-                 (Integer)Max((Real)e3.vertex1,(Real)e3.vertex2);
-      if (!IsInEdgesList(e3, isAttachmentB))
-      {
-         edgeMap[indexKey] = e3;
-         attachmentAMap[indexKey] = i;                      // add atachment face A
-         attachmentBMap[indexKey] = -1;                     // add null value to attachmentB list
-      }
-      else
+      // For a triangular face <face[0], face[1], face[2]>, it has 3 edges
+      // <face[0], face[1]>, <face[1], face[2]>, and <face[2], face[0]>
+      for (Integer j = 0; j < 3; ++j)
       {
-         if (isAttachmentB)
-            attachmentBMap[indexKey] = i;                   // add attachment to face B
+         edge.vertex1 = face[j];
+         edge.vertex2 = face[(j + 1) % 3];
+         key = MakeEdgeKey(edge.vertex1, edge.vertex2);
+
+         EdgeIndexMap::iterator entry = edgeIndex.find(key);
+         if (entry == edgeIndex.end())
+         {
+            // Add the edge with its attachment face A; face B is not known yet
+            edgeIndex[key] = (Integer)foundEdges.size();
+            foundKeys.push_back(key);
+            foundEdges.push_back(edge);
+            foundA.push_back(i);
+            foundB.push_back(-1);
+         }
+         else if (edge.vertex1 == foundEdges[entry->second].vertex2)
+            foundB[entry->second] = i;             // add attachment to face B
       }
    }
 
-   for (std::map<Integer, Edge>::iterator i = edgeMap.begin(); i != edgeMap.end(); ++i)
+   // Order the edges by key
+   IntegerArray order(foundEdges.size());
+   for (UnsignedInt i = 0; i < order.size(); ++i)
+      order[i] = i;
+   std::sort(order.begin(), order.end(),
+         [&foundKeys](Integer a, Integer b)
+         {
+            return foundKeys[a] < foundKeys[b];
+         });
+
+   E.reserve(order.size());
+   attachmentA.reserve(order.size());
+   attachmentB.reserve(order.size());
+   for (UnsignedInt i = 0; i < order.size(); ++i)
    {
-      E.push_back((*i).second);
+      E.push_back(foundEdges[order[i]]);
+      attachmentA.push_back(foundA[order[i]]);
+      attachmentB.push_back(foundB[order[i]]);
+      edgeIndex[foundKeys[order[i]]] = i;
    }
 
-   for (std::map<Integer, Integer>::iterator i = attachmentAMap.begin(); i != attachmentAMap.end(); ++i)
-   {
-      attachmentA.push_back((*i).second);
-   }
-
-   for (std::map<Integer, Integer>::iterator i = attachmentBMap.begin(); i != attachmentBMap.end(); ++i)
-   {
-      attachmentB.push_back((*i).second);
-   }
-   
-
 #ifdef DEBUG_CALCULATION
    MessageInterface::ShowMessage(" Edges list and face attachment A and B:\n");
    for(UnsignedInt i=0; i < E.size(); ++i)
@@ -547,3 +539,529 @@ bool PolyhedronBody::EdgeAttachments(Integer edgeindex, Integer& faceA_index, In
 }
 
 
+
+
+//------------------------------------------------------------------------------
+// bool BuildFieldData()
+//------------------------------------------------------------------------------
+/*
+ * Builds the data the field sums use, once for the loaded shape
+ *
+ * The vertices, the edge and face vertex indices, the edge dyads Ee and the
+ * face dyads Ff are stored in flat arrays.  None of them depend on the field
+ * point, so FieldSum() only computes the terms that do.  The volume moments
+ * used by FarFieldSum() are computed here as well.
+ *
+ *  return true on success
+*/
+//------------------------------------------------------------------------------
+bool PolyhedronBody::BuildFieldData()
+{
+   if (isFieldDataBuilt)
+      return true;
+
+   LoadBodyShape();
+   if (!FaceNormals())
+      throw UtilityException("Error: the body shape file \'" +
+            bodyShapeFilename + "\' contains a face with no area");
+   Incenters();
+   Edges();
+
+   vertexData.resize(verticesList.size() * 3);
+   for (UnsignedInt i = 0; i < verticesList.size(); ++i)
+      for (Integer j = 0; j < 3; ++j)
+         vertexData[i*3 + j] = verticesList[i][j];
+
+   faceVertices.resize(facesList.size() * 3);
+   faceDyads.resize(facesList.size() * 9);
+   for (UnsignedInt i = 0; i < facesList.size(); ++i)
+   {
+      // Ff = (fn(i,:)')*(fn(i,:)')';
+      const Rvector3 &n = fn[i];
+      for (Integer j = 0; j < 3; ++j)
+      {
+         faceVertices[i*3 + j] = facesList[i][j];
+         for (Integer k = 0; k < 3; ++k)
+            faceDyads[i*9 + j*3 + k] = n(j) * n(k);
+      }
+   }
+
+   Rvector3 P1, P2, P1P2, n12, n21, na, nb, na12, nb21, a2v, b2v;
+   Integer face1, face2;
+
+   edgeVertices.resize(E.size() * 2);
+   edgeDyads.resize(E.size() * 9);
+   edgeLengths.resize(E.size());
+   for (UnsignedInt i = 0; i < E.size(); ++i)
+   {
+      edgeVertices[i*2]     = E[i].vertex1;
+      edgeVertices[i*2 + 1] = E[i].vertex2;
+
+      // Define edge unit vectors:
+      P1 = verticesList[E[i].vertex1];
+      P2 = verticesList[E[i].vertex2];
+      P1P2 = P2 - P1;
+      n12 = P1P2; n12 = n12.Normalize();
+      n21 = -n12;
+
+      // Outward facing normals of the attached faces:
+      EdgeAttachments(i, face1, face2);
+      if ((face1 < 0) || (face2 < 0))
+         throw UtilityException("Error: the body shape in file \'" +
+               bodyShapeFilename + "\' is not closed");
+      na = fn[face1];
+      nb = fn[face2];
+
+      // Edge normal vectors n12 x na and n21 x nb:
+      na12.Set(-n12(2)*na(1) + n12(1)*na(2),
+                n12(2)*na(0) - n12(0)*na(2),
+               -n12(1)*na(0) + n12(0)*na(1));
+      nb21.Set(-n21(2)*nb(1) + n21(1)*nb(2),
+                n21(2)*nb(0) - n21(0)*nb(2),
+               -n21(1)*nb(0) + n21(0)*nb(1));
+
+      // Ensure outward-pointing edge normals:
+      a2v = P1 - ic[face1];
+      if (a2v*na12 < 0.0)
+         na12 = -na12;
+      b2v = P1 - ic[face2];
+      if (b2v*nb21 < 0.0)
+         nb21 = -nb21;
+
+      // Ee = na*(na12') + nb*(nb21');
+      for (Integer j = 0; j < 3; ++j)
+         for (Integer k = 0; k < 3; ++k)
+            edgeDyads[i*9 + j*3 + k] = na(j)*na12(k) + nb(j)*nb21(k);
+
+      edgeLengths[i] = P1P2.Norm();
+   }
+
+   ComputeMoments();
+   isFieldDataBuilt = true;
+
+   #ifdef DEBUG_FIELD_DATA
+      MessageInterface::ShowMessage("PolyhedronBody field data: %d vertices, "
+            "%d edges, %d faces; volume = %.12le, center = [%.12le %.12le "
+            "%.12le], bounding radius = %.12le\n", verticesList.size(),
+            E.size(), facesList.size(), volume, center[0], center[1],
+            center[2], boundingRadius);
+   #endif
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void FieldSum(const Real *r, Real *accel, Real *gradient, Real &solidAngle,
+//               Integer threadCount) const
+//------------------------------------------------------------------------------
+/*
+ * Sums the edge and face terms of the polyhedron field at a point
+ *
+ * The results are per unit G*density: the acceleration is
+ * sumFace - sumEdge, its gradient is sumEdgeA - sumFaceA.  With more than one
+ * thread the edges and faces are split into contiguous ranges, summed on
+ * separate threads, and the partial sums are added in range order, so the
+ * result does not depend on the timing of the threads.  BuildFieldData()
+ * must be called first.
+ *
+ *  @param r            field point in the body fixed frame, 3 elements
+ *  @param accel        output acceleration, 3 elements
+ *  @param gradient     output acceleration gradient, 9 elements in row order
+ *  @param solidAngle   output sum of the face solid angles; 4 pi inside the
+ *                      body and 0 outside
+ *  @param threadCount  number of threads; 0 uses one per hardware thread
+*/
+//------------------------------------------------------------------------------
+void PolyhedronBody::FieldSum(const Real *r, Real *accel, Real *gradient,
+                              Real &solidAngle, Integer threadCount) const
+{
+   Integer edgeCount = (Integer)edgeLengths.size();
+   Integer faceCount = (Integer)(faceVertices.size() / 3);
+
+   if (threadCount <= 0)
+      threadCount = (Integer)std::thread::hardware_concurrency();
+   Integer maxThreads = faceCount / MIN_FACES_PER_THREAD;
+   if (threadCount > maxThreads)
+      threadCount = maxThreads;
+   if (threadCount < 1)
+      threadCount = 1;
+
+   RealArray sums(threadCount * SUM_SIZE, 0.0);
+   auto sumPart = [&](Integer part)
+   {
+      SumRange(r, (Integer)((long long)edgeCount * part / threadCount),
+            (Integer)((long long)edgeCount * (part + 1) / threadCount),
+            (Integer)((long long)faceCount * part / threadCount),
+            (Integer)((long long)faceCount * (part + 1) / threadCount),
+            &sums[part * SUM_SIZE]);
+   };
+
+   std::vector<std::thread> threads;
+   for (Integer i = 1; i < threadCount; ++i)
+      threads.push_back(std::thread(sumPart, i));
+   sumPart(0);
+   for (UnsignedInt i = 0; i < threads.size(); ++i)
+      threads[i].join();
+
+   for (Integer i = 1; i < threadCount; ++i)
+      for (Integer j = 0; j < SUM_SIZE; ++j)
+         sums[j] += sums[i * SUM_SIZE + j];
+
+   // sums holds sumEdge, sumEdgeA, sumFace, sumFaceA, and sumWf
+   for (Integer j = 0; j < 3; ++j)
+      accel[j] = sums[12 + j] - sums[j];
+   for (Integer j = 0; j < 9; ++j)
+      gradient[j] = sums[3 + j] - sums[15 + j];
+   solidAngle = sums[24];
+}
+
+
+//------------------------------------------------------------------------------
+// void FieldSumBatch(Integer count, const Real *r, Real *accel,
+//                    Real *gradient, Real *solidAngle,
+//                    Integer threadCount) const
+//------------------------------------------------------------------------------
+/*
+ * Sums the polyhedron field at a set of points
+ *
+ * For ensembles the points, rather than the faces of one point, are shared
+ * out between the threads: each thread takes a contiguous range of points
+ * and sums every face for each of them, so the threads synchronize once per
+ * call instead of once per point.  Each point is summed on one thread in the
+ * same order as FieldSum() with one thread, and gets the same result.  When
+ * there are fewer points than threads the faces are split as in FieldSum().
+ * BuildFieldData() must be called first.
+ *
+ *  @param count        number of field points
+ *  @param r            field points in the body fixed frame, 3 per point
+ *  @param accel        output accelerations, 3 per point
+ *  @param gradient     output gradients, 9 per point in row order
+ *  @param solidAngle   output solid angle sums, 1 per point
+ *  @param threadCount  number of threads; 0 uses one per hardware thread
+*/
+//------------------------------------------------------------------------------
+void PolyhedronBody::FieldSumBatch(Integer count, const Real *r, Real *accel,
+                                   Real *gradient, Real *solidAngle,
+                                   Integer threadCount) const
+{
+   Integer faceCount = (Integer)(faceVertices.size() / 3);
+
+   if (threadCount <= 0)
+      threadCount = (Integer)std::thread::hardware_concurrency();
+   Integer maxThreads = (Integer)((long long)count * faceCount /
+         MIN_FACES_PER_THREAD);
+   if (threadCount > maxThreads)
+      threadCount = maxThreads;
+
+   if ((threadCount <= 1) || (count < threadCount))
+   {
+      for (Integer k = 0; k < count; ++k)
+         FieldSum(r + 3*k, accel + 3*k, gradient + 9*k, solidAngle[k],
+               count < threadCount ? threadCount : 1);
+      return;
+   }
+
+   auto sumPart = [&](Integer part)
+   {
+      Integer last = (Integer)((long long)count * (part + 1) / threadCount);
+      for (Integer k = (Integer)((long long)count * part / threadCount);
+           k < last; ++k)
+         FieldSum(r + 3*k, accel + 3*k, gradient + 9*k, solidAngle[k], 1);
+   };
+
+   std::vector<std::thread> threads;
+   for (Integer i = 1; i < threadCount; ++i)
+      threads.push_back(std::thread(sumPart, i));
+   sumPart(0);
+   for (UnsignedInt i = 0; i < threads.size(); ++i)
+      threads[i].join();
+}
+
+
+//------------------------------------------------------------------------------
+// void FarFieldSum(const Real *r, Real *accel, Real *gradient) const
+//------------------------------------------------------------------------------
+/*
+ * Approximates the polyhedron field far from the body
+ *
+ * The field is expanded about the center of volume to degree 2: the point
+ * mass term plus the quadrupole term of the body's second volume moments,
+ * which are exact for the polyhedron.  The degree 1 term is zero about the
+ * center.  The neglected terms fall off as (R/|r|)^3 relative to the point
+ * mass term, with R the bounding radius.  The results are per unit
+ * G*density, as for FieldSum().  BuildFieldData() must be called first.
+ *
+ *  @param r         field point in the body fixed frame, 3 elements
+ *  @param accel     output acceleration, 3 elements
+ *  @param gradient  output acceleration gradient, 9 elements in row order
+*/
+//------------------------------------------------------------------------------
+void PolyhedronBody::FarFieldSum(const Real *r, Real *accel,
+                                 Real *gradient) const
+{
+   // Potential: V/rho + 1/2 rho'*Q*rho / rho^5
+   Real rho[3], qrho[3];
+   for (Integer j = 0; j < 3; ++j)
+      rho[j] = r[j] - center[j];
+   for (Integer j = 0; j < 3; ++j)
+      qrho[j] = quadrupole[j*3]*rho[0] + quadrupole[j*3 + 1]*rho[1] +
+                quadrupole[j*3 + 2]*rho[2];
+
+   Real rho2 = rho[0]*rho[0] + rho[1]*rho[1] + rho[2]*rho[2];
+   Real rhoMag = Sqrt(rho2);
+   Real inv3 = 1.0 / (rho2 * rhoMag);
+   Real inv5 = inv3 / rho2;
+   Real inv7 = inv5 / rho2;
+   Real inv9 = inv7 / rho2;
+   Real s = rho[0]*qrho[0] + rho[1]*qrho[1] + rho[2]*qrho[2];
+
+   for (Integer j = 0; j < 3; ++j)
+      accel[j] = -volume * rho[j] * inv3 + qrho[j] * inv5 -
+                 2.5 * s * rho[j] * inv7;
+
+   for (Integer j = 0; j < 3; ++j)
+   {
+      for (Integer k = 0; k < 3; ++k)
+      {
+         Real delta = (j == k ? 1.0 : 0.0);
+         gradient[j*3 + k] =
+               volume * (3.0 * rho[j] * rho[k] * inv5 - delta * inv3) +
+               quadrupole[j*3 + k] * inv5 -
+               5.0 * (qrho[j] * rho[k] + rho[j] * qrho[k]) * inv7 -
+               2.5 * s * delta * inv7 +
+               17.5 * s * rho[j] * rho[k] * inv9;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetVolume() const
+//------------------------------------------------------------------------------
+/*
+ * Returns the volume of the body, once BuildFieldData() has run
+*/
+//------------------------------------------------------------------------------
+Real PolyhedronBody::GetVolume() const
+{
+   return volume;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetBoundingRadius() const
+//------------------------------------------------------------------------------
+/*
+ * Returns the distance from the center of volume to the farthest vertex, once
+ * BuildFieldData() has run
+*/
+//------------------------------------------------------------------------------
+Real PolyhedronBody::GetBoundingRadius() const
+{
+   return boundingRadius;
+}
+
+
+//------------------------------------------------------------------------------
+// private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// EdgeKey MakeEdgeKey(Integer vertex1, Integer vertex2)
+//------------------------------------------------------------------------------
+/*
+ * Builds the key of an edge, the same for both directions of the edge
+*/
+//------------------------------------------------------------------------------
+EdgeKey PolyhedronBody::MakeEdgeKey(Integer vertex1, Integer vertex2)
+{
+   if (vertex1 > vertex2)
+      std::swap(vertex1, vertex2);
+   return ((EdgeKey)(UnsignedInt)vertex1 << 32) | (EdgeKey)(UnsignedInt)vertex2;
+}
+
+
+//------------------------------------------------------------------------------
+// void SumRange(const Real *r, Integer firstEdge, Integer lastEdge,
+//               Integer firstFace, Integer lastFace, Real *sums) const
+//------------------------------------------------------------------------------
+/*
+ * Adds the field terms of a range of edges and faces
+ *
+ *  @param r          field point in the body fixed frame
+ *  @param firstEdge  first edge of the range
+ *  @param lastEdge   end of the edge range (not included)
+ *  @param firstFace  first face of the range
+ *  @param lastFace   end of the face range (not included)
+ *  @param sums       SUM_SIZE values the terms are added to: sumEdge,
+ *                    sumEdgeA, sumFace, sumFaceA, and sumWf
+*/
+//------------------------------------------------------------------------------
+void PolyhedronBody::SumRange(const Real *r, Integer firstEdge,
+      Integer lastEdge, Integer firstFace, Integer lastFace, Real *sums) const
+{
+   const Real *V = vertexData.data();
+   Real *sumEdge  = sums;
+   Real *sumEdgeA = sums + 3;
+   Real *sumFace  = sums + 12;
+   Real *sumFaceA = sums + 15;
+   Real sumWf = 0.0;
+
+   // Sum the gravitational contributions of each edge:
+   for (Integer i = lastEdge - 1; i >= firstEdge; --i)
+   {
+      const Real *P1 = V + edgeVertices[i*2] * 3;
+      const Real *P2 = V + edgeVertices[i*2 + 1] * 3;
+      const Real *Ee = &edgeDyads[i*9];
+
+      // Vectors from the field point to the edge endpoints; re = R1
+      Real R1[3] = {P1[0] - r[0], P1[1] - r[1], P1[2] - r[2]};
+      Real R2[3] = {P2[0] - r[0], P2[1] - r[1], P2[2] - r[2]};
+      Real r1 = Sqrt(R1[0]*R1[0] + R1[1]*R1[1] + R1[2]*R1[2]);
+      Real r2 = Sqrt(R2[0]*R2[0] + R2[1]*R2[1] + R2[2]*R2[2]);
+      Real e = edgeLengths[i];
+
+      // Calculate the logarithm expression, Le:
+      Real Le = Ln((r1+r2+e)/(r1+r2-e));
+
+      // Sum the edge gravity contributions and variational terms:
+      for (Integer j = 0; j < 3; ++j)
+         sumEdge[j] += (Ee[j*3]*R1[0] + Ee[j*3 + 1]*R1[1] +
+                        Ee[j*3 + 2]*R1[2]) * Le;
+      for (Integer j = 0; j < 9; ++j)
+         sumEdgeA[j] += Ee[j] * Le;
+   }
+
+   for (Integer i = lastFace - 1; i >= firstFace; --i)
+   {
+      const Real *A = V + faceVertices[i*3] * 3;
+      const Real *B = V + faceVertices[i*3 + 1] * 3;
+      const Real *C = V + faceVertices[i*3 + 2] * 3;
+      const Real *Ff = &faceDyads[i*9];
+
+      // Calculate vectors from field point to face vertices:
+      Real R1[3] = {A[0] - r[0], A[1] - r[1], A[2] - r[2]};
+      Real R2[3] = {B[0] - r[0], B[1] - r[1], B[2] - r[2]};
+      Real R3[3] = {C[0] - r[0], C[1] - r[1], C[2] - r[2]};
+      Real r1 = Sqrt(R1[0]*R1[0] + R1[1]*R1[1] + R1[2]*R1[2]);
+      Real r2 = Sqrt(R2[0]*R2[0] + R2[1]*R2[1] + R2[2]*R2[2]);
+      Real r3 = Sqrt(R3[0]*R3[0] + R3[1]*R3[1] + R3[2]*R3[2]);
+
+      Real cR23[3] = {-R2[2]*R3[1] + R2[1]*R3[2],
+                       R2[2]*R3[0] - R2[0]*R3[2],
+                      -R2[1]*R3[0] + R2[0]*R3[1]};
+      Real R2R3 = R2[0]*R3[0] + R2[1]*R3[1] + R2[2]*R3[2];
+      Real R3R1 = R3[0]*R1[0] + R3[1]*R1[1] + R3[2]*R1[2];
+      Real R1R2 = R1[0]*R2[0] + R1[1]*R2[1] + R1[2]*R2[2];
+
+      // Calculate the solid angle term, wf:
+      Real wf = 2*atan2(R1[0]*cR23[0] + R1[1]*cR23[1] + R1[2]*cR23[2],
+            r1*r2*r3 + r1*R2R3 + r2*R3R1 + r3*R1R2);
+
+      // Sum the face gravity contributions and variational terms:
+      for (Integer j = 0; j < 3; ++j)
+         sumFace[j] += (Ff[j*3]*R1[0] + Ff[j*3 + 1]*R1[1] +
+                        Ff[j*3 + 2]*R1[2]) * wf;
+      for (Integer j = 0; j < 9; ++j)
+         sumFaceA[j] += Ff[j] * wf;
+      sumWf += wf;
+   }
+
+   sums[24] += sumWf;
+}
+
+
+//------------------------------------------------------------------------------
+// void ComputeMoments()
+//------------------------------------------------------------------------------
+/*
+ * Computes the volume, center of volume, and quadrupole tensor of the body
+ *
+ * Each face forms a tetrahedron with a reference point; the signed volumes
+ * and moments of the tetrahedra add up to those of the body.  The second
+ * moments S are taken about the center, found in a first pass, and the
+ * quadrupole tensor is Q = 3*S - trace(S)*I.
+*/
+//------------------------------------------------------------------------------
+void PolyhedronBody::ComputeMoments()
+{
+   Real origin[3] = {0.0, 0.0, 0.0};
+   Real first[3] = {0.0, 0.0, 0.0};
+   Real second[9] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+   for (Integer pass = 0; pass < 2; ++pass)
+   {
+      volume = 0.0;
+      for (Integer j = 0; j < 3; ++j)
+         first[j] = 0.0;
+      for (Integer j = 0; j < 9; ++j)
+         second[j] = 0.0;
+
+      for (UnsignedInt i = 0; i < faceVertices.size() / 3; ++i)
+      {
+         Real v[3][3];
+         for (Integer k = 0; k < 3; ++k)
+            for (Integer j = 0; j < 3; ++j)
+               v[k][j] = vertexData[faceVertices[i*3 + k]*3 + j] - origin[j];
+
+         Real tetVolume = (v[0][0] * (v[1][1]*v[2][2] - v[1][2]*v[2][1]) +
+                           v[0][1] * (v[1][2]*v[2][0] - v[1][0]*v[2][2]) +
+                           v[0][2] * (v[1][0]*v[2][1] - v[1][1]*v[2][0])) / 6.0;
+         volume += tetVolume;
+
+         Real sum[3];
+         for (Integer j = 0; j < 3; ++j)
+         {
+            sum[j] = v[0][j] + v[1][j] + v[2][j];
+            first[j] += tetVolume * sum[j] / 4.0;
+         }
+         for (Integer j = 0; j < 3; ++j)
+            for (Integer k = 0; k < 3; ++k)
+               second[j*3 + k] += tetVolume / 20.0 *
+                     (v[0][j]*v[0][k] + v[1][j]*v[1][k] + v[2][j]*v[2][k] +
+                      sum[j]*sum[k]);
+      }
+
+      // Faces wound inward give a negative volume
+      if (volume < 0.0)
+      {
+         volume = -volume;
+         for (Integer j = 0; j < 3; ++j)
+            first[j] = -first[j];
+         for (Integer j = 0; j < 9; ++j)
+            second[j] = -second[j];
+      }
+
+      if (volume == 0.0)
+         break;
+      if (pass == 0)
+         for (Integer j = 0; j < 3; ++j)
+            origin[j] += first[j] / volume;
+   }
+
+   // Remove what is left of the first moment after the shift to the center
+   for (Integer j = 0; j < 3; ++j)
+      center[j] = origin[j] + (volume == 0.0 ? 0.0 : first[j] / volume);
+   for (Integer j = 0; j < 3; ++j)
+      for (Integer k = 0; k < 3; ++k)
+         second[j*3 + k] -= (volume == 0.0 ? 0.0 :
+               first[j] * first[k] / volume);
+
+   Real trace = second[0] + second[4] + second[8];
+   for (Integer j = 0; j < 3; ++j)
+      for (Integer k = 0; k < 3; ++k)
+         quadrupole[j*3 + k] = 3.0 * second[j*3 + k] - (j == k ? trace : 0.0);
+
+   boundingRadius = 0.0;
+   for (UnsignedInt i = 0; i < vertexData.size() / 3; ++i)
+   {
+      Real d2 = 0.0;
+      for (Integer j = 0; j < 3; ++j)
+         d2 += (vertexData[i*3 + j] - center[j]) *
+               (vertexData[i*3 + j] - center[j]);
+      if (d2 > boundingRadius)
+         boundingRadius = d2;
+   }
+   boundingRadius = Sqrt(boundingRadius);
+}
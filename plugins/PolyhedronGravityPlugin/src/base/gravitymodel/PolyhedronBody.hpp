@@ -9,6 +9,7 @@
 #define PolyhedronBody_hpp
 
 #include "Rmatrix66.hpp"
+#include <unordered_map>
 
 struct Edge
 {
@@ -20,8 +21,10 @@ typedef PointsList        			    Vectors3List;
 typedef std::vector<PolygonFace>           FacesList;
 typedef std::vector<Edge>                  EdgesList;
 typedef std::vector<Integer>		          FaceIndexList;
-typedef std::map<Integer, Edge>            EdgesMap;
-typedef std::map<Integer, Integer>		    FaceIndexMap;
+/// Key for an edge: the lower vertex index in the high word, the higher one
+/// in the low word
+typedef unsigned long long                 EdgeKey;
+typedef std::unordered_map<EdgeKey, Integer> EdgeIndexMap;
 
 class PolyhedronBody
 {
@@ -47,7 +50,15 @@ public:
    bool Edges();
    bool EdgeAttachments(Integer edgeindex, Integer& faceA_index, Integer& faceB_index);
 
-   bool Calculation(Rvector6 x, Rvector6& xdot, Rmatrix66& A);		// calculate gravity
+   bool BuildFieldData();
+   void FieldSum(const Real *r, Real *accel, Real *gradient, Real &solidAngle,
+                 Integer threadCount = 1) const;
+   void FieldSumBatch(Integer count, const Real *r, Real *accel,
+                      Real *gradient, Real *solidAngle,
+                      Integer threadCount = 1) const;
+   void FarFieldSum(const Real *r, Real *accel, Real *gradient) const;
+   Real GetVolume() const;
+   Real GetBoundingRadius() const;
 
 
    std::string bodyShapeFilename;
@@ -60,12 +71,40 @@ public:
    FaceIndexList attachmentA;
    FaceIndexList attachmentB;
 
-   EdgesMap	    edgeMap;
-   FaceIndexMap attachmentAMap;
-   FaceIndexMap attachmentBMap;
+   /// Index in E of each edge, by EdgeKey
+   EdgeIndexMap  edgeIndex;
 
 private:
    bool isLoad;
+
+   /// True when the field data below match the vertices and faces
+   bool          isFieldDataBuilt;
+   /// Vertex coordinates, 3 per vertex
+   RealArray     vertexData;
+   /// Vertex indices of each edge, 2 per edge
+   IntegerArray  edgeVertices;
+   /// Edge dyads Ee = na*na12' + nb*nb21', 9 per edge in row order
+   RealArray     edgeDyads;
+   /// Length of each edge
+   RealArray     edgeLengths;
+   /// Vertex indices of each face, 3 per face
+   IntegerArray  faceVertices;
+   /// Face dyads Ff = n*n', 9 per face in row order
+   RealArray     faceDyads;
+
+   /// Volume of the body
+   Real          volume;
+   /// Center of volume of the body
+   Real          center[3];
+   /// Quadrupole tensor of the body about its center, per unit density
+   Real          quadrupole[9];
+   /// Distance from the center to the farthest vertex
+   Real          boundingRadius;
+
+   static EdgeKey MakeEdgeKey(Integer vertex1, Integer vertex2);
+   void SumRange(const Real *r, Integer firstEdge, Integer lastEdge,
+                 Integer firstFace, Integer lastFace, Real *sums) const;
+   void ComputeMoments();
 };
 
 
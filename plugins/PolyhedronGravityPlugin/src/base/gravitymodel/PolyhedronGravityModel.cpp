@@ -42,6 +42,8 @@ PolyhedronGravityModel::PARAMETER_TEXT[PolyhedronGravityModelParamCount - Gravit
    "CreateForceBody",
    "ShapeFileName",
    "BodyDensity",
+   "FarFieldRadius",
+   "ThreadCount",
 };
 
 const Gmat::ParameterType
@@ -50,6 +52,8 @@ PolyhedronGravityModel::PARAMETER_TYPE[PolyhedronGravityModelParamCount - Gravit
    Gmat::STRING_TYPE,
    Gmat::STRING_TYPE,
    Gmat::REAL_TYPE,
+   Gmat::REAL_TYPE,
+   Gmat::INTEGER_TYPE,
 };
 
 // const Real 	PolyhedronGravityModel::UniverisalGravityConstant = 6.67300e-20;    // unit: Km^3 / (Kg x s^2)
@@ -60,12 +64,13 @@ PolyhedronGravityModel::PARAMETER_TYPE[PolyhedronGravityModelParamCount - Gravit
 
 PolyhedronGravityModel::PolyhedronGravityModel(const std::string &name):
    GravityBase           	 ("PolyhedronGravityModel", name),
-   firstcalculation         (true),
    createForceBodyName      (""),
    createForceBody          (NULL),
    bodyDensity				    (1000.0),
    bodyShapeFilename        (""),
    polybody                 (NULL),
+   farFieldRadius           (0.0),
+   threadCount              (1),
    sumWf                    (0.0),
    isPHGMInitialized        (false),
    isShapeLoaded            (false)
@@ -93,12 +98,13 @@ PolyhedronGravityModel::~PolyhedronGravityModel()
 
 PolyhedronGravityModel::PolyhedronGravityModel(const PolyhedronGravityModel& polgm):
    GravityBase			   (polgm),
-   firstcalculation     (true),
    createForceBodyName  (polgm.createForceBodyName),
    createForceBody      (polgm.createForceBody),
    bodyDensity				(polgm.bodyDensity),
    bodyShapeFilename    (polgm.bodyShapeFilename),
    polybody					(NULL),
+   farFieldRadius       (polgm.farFieldRadius),
+   threadCount          (polgm.threadCount),
    sumWf                (0.0),
    isPHGMInitialized    (false),
    isShapeLoaded        (false)
@@ -124,11 +130,12 @@ PolyhedronGravityModel& PolyhedronGravityModel::operator= (const PolyhedronGravi
       return *this;
 
    GravityBase::operator=(polgm);
-   firstcalculation     = true;
    createForceBodyName	= polgm.createForceBodyName;
    createForceBody		= polgm.createForceBody;
    bodyDensity			   = polgm.bodyDensity;
    bodyShapeFilename	   = polgm.bodyShapeFilename;
+   farFieldRadius       = polgm.farFieldRadius;
+   threadCount          = polgm.threadCount;
    isPHGMInitialized    = false;
    isShapeLoaded        = false;
    sumWf                = 0.0;
@@ -178,7 +185,6 @@ bool PolyhedronGravityModel::Initialize()
 			      // create a PolyhedronBody object for the asteroid in order to calculate gravity at spacecrafts' locations:
                polybody = new PolyhedronBody(bodyShapeFilename);
                retval = polybody->Initialize();								// initialize() will load body shape information from data file
-               firstcalculation = true;
             }
             isPHGMInitialized = true;
          }
@@ -417,23 +423,8 @@ bool PolyhedronGravityModel::Calculation(Rvector6 x, Rvector6& xdot, Rmatrix66&
    MessageInterface::ShowMessage("v = (%.15lf   %.15lf   %.15lf) km/s\n", v(0), v(1), v(2));
 #endif
 
-   // Define variables:
-   Rvector3 sumEdge(0.0, 0.0, 0.0);
-   Rvector3 sumFace(0.0, 0.0, 0.0);
-   Rmatrix33 sumEdgeA(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
-   Rmatrix33 sumFaceA(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
-   sumWf = 0.0;
-
-   // Calculate face normals, edges, and vertices
-   polybody->LoadBodyShape();
-   if (firstcalculation)
-   {
-      //MessageInterface::ShowMessage(" Compute face normals, incenters, and edges\n");
-      polybody->FaceNormals();
-      polybody->Incenters();
-      polybody->Edges();
-	   firstcalculation = false;
-   }
+   // Build face normals, edges, and the field data on first use
+   polybody->BuildFieldData();
 
 #ifdef DEBUG_CALCULATION
    MessageInterface::ShowMessage("edge size = %d     face size = %d\n", polybody->E.size(), polybody->facesList.size());
@@ -452,192 +443,27 @@ bool PolyhedronGravityModel::Calculation(Rvector6 x, Rvector6& xdot, Rmatrix66&
    MessageInterface::ShowMessage("v = Rdot*r + R*v = (%.15lf   %.15lf   %.15lf)km/s \n", v1(0), v1(1), v1(2));
 #endif
 
-   // Sum the gravitational contributions of each edge:
-   Rvector3 P1, P2, P1P2, n12, n21;
-   Edge edge;
-   Integer face1, face2;
-   Rvector3 na, nb;
-   Rvector3 na12, nb21;
-   //Rvector3 a2b;
-   Rmatrix33 Ee;
-   Rvector3 re, R1, R2;
-   Real e, r1, r2;
-   Real Le;
-
-   Rvector3 a2v, b2v;
-
-   for (Integer i = polybody->E.size()-1; i >= 0; --i)
+   // Sum the gravitational contributions of the edges and faces, or use the
+   // degree 2 expansion far from the body:
+   Real field[3], gradient[9];
+   if ((farFieldRadius > 0.0) && (r.GetMagnitude() > farFieldRadius))
    {
-      edge.vertex1 = polybody->E[i].vertex1;
-      edge.vertex2 = polybody->E[i].vertex2;
-      //MessageInterface::ShowMessage("Edge: %d   %d:  %d   %d   ", min(edge.vertex1,edge.vertex2), max(edge.vertex1,edge.vertex2), edge.vertex1, edge.vertex2);
-
-      // Define edge unit vectors:
-	   P1 = polybody->verticesList[edge.vertex1];					// the first vertex of edge e
-	   P2 = polybody->verticesList[edge.vertex2];					// the second vertex of edge e
-	   P1P2 = P2-P1;
-	   n12 = P1P2; n12 = n12.Normalize();
-	   n21 = -n12;
-      //MessageInterface::ShowMessage("Normal vector n12: (%.15lf   %.15lf   %.15lf):   ", n12[0], n12[1], n12[2]); 
-
-	  // Specify the attached faces:
-	  // EdgeAttachments1(edge, face1, face2);
-	  polybody->EdgeAttachments(i, face1, face2);
-     //MessageInterface::ShowMessage("attachment face: %d   %d:   ", face1, face2); 
-	  // Specify outward facing normals:
-	  na = polybody->fn[face1];
-	  nb = polybody->fn[face2];
-     //MessageInterface::ShowMessage("na: (%.15lf  %.15lf  %.15lf)   ", na[0], na[1], na[2]);
-     //MessageInterface::ShowMessage("nb: (%.15lf  %.15lf  %.15lf)   ", nb[0], nb[1], nb[2]);
-
-	  // Calculate edge normal vectors:
-//    na12 = [0 -n12(3) n12(2); n12(3) 0 -n12(1); -n12(2) n12(1) 0]*na;
-//    nb21 = [0 -n21(3) n21(2); n21(3) 0 -n21(1); -n21(2) n21(1) 0]*nb;
-      na12.Set(-n12(2)*na(1) + n12(1)*na(2),
-    		    n12(2)*na(0) - n12(0)*na(2),
-    		   -n12(1)*na(0) + n12(0)*na(1));
-      nb21.Set(-n21(2)*nb(1) + n21(1)*nb(2),
-    		    n21(2)*nb(0) - n21(0)*nb(2),
-    		   -n21(1)*nb(0) + n21(0)*nb(1));
-//	  MessageInterface::ShowMessage("face1 = %d: na12 = n12 x na = (%le,  %le,  %le)\n", face1, na12(0), na12(1), na12(2));
-//	  MessageInterface::ShowMessage("face2 = %d: nb21 = n21 x nb = (%le,  %le,  %le)\n", face2, nb21(0), nb21(1), nb21(2));
-
-	  // Ensure outward-pointing edge normals:
-//      a2b = ici(2,:)-ici(1,:);                           // old MatLab code
-     // a2b = polybody->ic[face2] - polybody->ic[face1];
-
-     // if (a2b*na12<0.0)
-     //     na12 = -na12;
-
-     // if (-a2b*nb21<0.0)
-     //     nb21 = -nb21;
-
-      // New normal check
-      // a2v = V(E(i,1),:)-ici(1,:);      // MatLab code
-      a2v = P1 - polybody->ic[face1];
-      if (a2v*na12<0.0)
-         na12 = -na12;
-
-      // b2v = V(E(i,1),:)-ici(2,:);     // MatLab code
-      b2v = P1 - polybody->ic[face2];
-      if (b2v*nb21<0.0)
-           nb21 = -nb21;
-
-//      MessageInterface::ShowMessage("After adjustment:\n");
-//	  MessageInterface::ShowMessage("face1 = %d: na12 = n12 x na = (%le,  %le,  %le)\n", face1, na12(0), na12(1), na12(2));
-//	  MessageInterface::ShowMessage("face2 = %d: nb21 = n21 x nb = (%le,  %le,  %le)\n", face2, nb21(0), nb21(1), nb21(2));
-
-//      Ee = na*(na12') + nb*(nb21');
-      Ee.Set(na(0)*na12(0)+nb(0)*nb21(0), na(0)*na12(1)+nb(0)*nb21(1), na(0)*na12(2)+nb(0)*nb21(2),
-    		 na(1)*na12(0)+nb(1)*nb21(0), na(1)*na12(1)+nb(1)*nb21(1), na(1)*na12(2)+nb(1)*nb21(2),
-    		 na(2)*na12(0)+nb(2)*nb21(0), na(2)*na12(1)+nb(2)*nb21(1), na(2)*na12(2)+nb(2)*nb21(2));
-//	  MessageInterface::ShowMessage("Ee = (%le,  %le,  %le,\n", Ee(0,0), Ee(0,1), Ee(0,2));
-//	  MessageInterface::ShowMessage("      %le,  %le,  %le,\n", Ee(1,0), Ee(1,1), Ee(1,2));
-//	  MessageInterface::ShowMessage("      %le,  %le,  %le)\n", Ee(2,0), Ee(2,1), Ee(2,2));
-
-	  // Vector from the field point to the edge:
-//    re = V(E(i,1),:)'-r;
-      re = polybody->verticesList[edge.vertex1] - r;
-//      MessageInterface::ShowMessage("re = (%le,  %le,  %le)\n", re(0), re(1), re(2));
-
-	  // Edge length:
-      e = P1P2.Norm();
-//      MessageInterface::ShowMessage("Edge length P1P2 = %le\n", e);
-
-	  // Vectors from the field point to the edge endpoints:
-//      R1 = V(E(i,1),:)'-r;
-//      R2 = V(E(i,2),:)'-r;
-      R1 = polybody->verticesList[edge.vertex1] - r;
-      R2 = polybody->verticesList[edge.vertex2] - r;
-      r1 = R1.Norm();
-      r2 = R2.Norm();
-
-	  // Calculate the logarithm expression, Le:
-      Le = GmatMathUtil::Ln((r1+r2+e)/(r1+r2-e));
-//      MessageInterface::ShowMessage("Le = %le\n", Le);
-
-	  // Sum the edge gravity contributions:
-      sumEdge = sumEdge + Ee*re*Le;
-      //Rvector3 res = Ee*re*Le;
-      //MessageInterface::ShowMessage("EdgeGravity: (%.15le   %.15le   %.15le)  ", res[0], res[1], res[2]);
-      //MessageInterface::ShowMessage("SumEdgeGravity: (%.15le   %.15le   %.15le)\n", sumEdge[0], sumEdge[1], sumEdge[2]);
-
-	  // Calculate variational terms (if requested):
-//      if nargout > 1
-          sumEdgeA = sumEdgeA + Ee*Le;
-//      end
-
+      polybody->FarFieldSum(r.GetDataVector(), field, gradient);
+      sumWf = 0.0;
    }
+   else
+      polybody->FieldSum(r.GetDataVector(), field, gradient, sumWf,
+            threadCount);
 
 #ifdef DEBUG_CALCULATION
-   MessageInterface::ShowMessage("sumEdge = [ %.15le  %.15le  %.15le ]\n", sumEdge(0), sumEdge(1), sumEdge(2));
-   MessageInterface::ShowMessage("sumEdgeA = [\n");
-   for (int i = 0; i < 3; ++i)
-   {
-	  MessageInterface::ShowMessage("        ");
-      for (int j = 0; j < 3; ++j)
-      {
-    	  MessageInterface::ShowMessage("%le  ",sumEdgeA(i,j));
-      }
-      MessageInterface::ShowMessage("\n");
-   }
-   MessageInterface::ShowMessage("          ]\n");
-#endif
-
-   Rmatrix33 Ff;
-   Rvector3 A, B, C, R3, cR23, n;
-   Real r3, wf;
-
-   for (Integer i = polybody->facesList.size()-1; i >= 0; --i)
-   {
-	  // Ff = (fn(i,:)')*(fn(i,:)')';
-	  n = polybody->fn[i];
-	  Ff.Set(n(0)*n(0), n(0)*n(1), n(0)*n(2),
-			 n(1)*n(0), n(1)*n(1), n(1)*n(2),
-			 n(2)*n(0), n(2)*n(1), n(2)*n(2));
-
-	  // face vertices:
-	  PolygonFace face = polybody->facesList[i];
-	  A = polybody->verticesList[face[0]];
-	  B = polybody->verticesList[face[1]];
-	  C = polybody->verticesList[face[2]];
-
-	  // Calculate vectors from field point to face vertices:
-	  R1 = A-r;
-	  R2 = B-r;
-	  R3 = C-r;
-
-	  r1 = R1.Norm();
-	  r2 = R2.Norm();
-	  r3 = R3.Norm();
-
-	  cR23.Set(-R2(2)*R3(1) + R2(1)*R3(2),
-			    R2(2)*R3(0) - R2(0)*R3(2),
-			   -R2(1)*R3(0) + R2(0)*R3(1));
-
-	  // Calculate the solid angle term, wf:
-	  wf = 2*atan2(R1*cR23,
-	        (r1*r2*r3+r1*R2*R3+r2*R3*R1+r3*R1*R2));
-
-	  // Sum the face gravity contributions
-	  sumFace = sumFace + Ff*R1*wf;
-	  sumWf = sumWf + wf;
-
-	  // Calculate variational terms (if requested)
-//	    if nargout > 1
-	  sumFaceA = sumFaceA + Ff*wf;
-//	    end
-
-   }
-#ifdef DEBUG_CALCULATION
-   MessageInterface::ShowMessage("sumFace = [ %.15le  %.15le  %.15le ]\n", sumFace(0), sumFace(1), sumFace(2));
-   MessageInterface::ShowMessage("sumFaceA = [\n");
+   MessageInterface::ShowMessage("sumFace - sumEdge = [ %.15le  %.15le  %.15le ]\n", field[0], field[1], field[2]);
+   MessageInterface::ShowMessage("sumEdgeA - sumFaceA = [\n");
    for (int i = 0; i < 3; ++i)
    {
 	  MessageInterface::ShowMessage("        ");
       for (int j = 0; j < 3; ++j)
       {
-    	  MessageInterface::ShowMessage("%le  ",sumFaceA(i,j));
+    	  MessageInterface::ShowMessage("%le  ",gradient[i*3+j]);
       }
       MessageInterface::ShowMessage("\n");
    }
@@ -653,7 +479,7 @@ bool PolyhedronGravityModel::Calculation(Rvector6 x, Rvector6& xdot, Rmatrix66&
    // bodyDensity's unit: kg/(m^3)     
    // Universal gravity constant's unit: km^3 / (kg x s^2)
    // if body shape is measured in km, then unit of a is km/s^2 
-   Rvector3 a = (GmatPhysicalConstants::UNIVERSAL_GRAVITATIONAL_CONSTANT * 1.0e9 * bodyDensity) * (-sumEdge + sumFace);   // gravity vector in asteroid's BodyFixed coordinate system
+   Rvector3 a = (GmatPhysicalConstants::UNIVERSAL_GRAVITATIONAL_CONSTANT * 1.0e9 * bodyDensity) * Rvector3(field[0], field[1], field[2]);   // gravity vector in asteroid's BodyFixed coordinate system
 #ifdef DEBUG_CALCULATION
    MessageInterface::ShowMessage("gravity vector in asteroid's BodyFixed coordinate system: g = (%.15le  %.15le  %.15le) km/s^2\n", a[0], a[1], a[2]); 
 #endif
@@ -669,13 +495,16 @@ bool PolyhedronGravityModel::Calculation(Rvector6 x, Rvector6& xdot, Rmatrix66&
    // Variational terms:
 //   A = [zeros(3,3) eye(3,3);
 //            D'*G*rho*(sumEdgeA - sumFaceA)*D zeros(3,3)];
-   Rmatrix33 m1 = D.Transpose() * (GmatPhysicalConstants::UNIVERSAL_GRAVITATIONAL_CONSTANT * 1.0e9 *bodyDensity) * (sumEdgeA - sumFaceA)*D;
+   Rmatrix33 gradientMatrix(gradient[0], gradient[1], gradient[2],
+                            gradient[3], gradient[4], gradient[5],
+                            gradient[6], gradient[7], gradient[8]);
+   Rmatrix33 m1 = D.Transpose() * (GmatPhysicalConstants::UNIVERSAL_GRAVITATIONAL_CONSTANT * 1.0e9 *bodyDensity) * gradientMatrix*D;
 
    for (int i = 0; i < 6; ++i)
 	   for (int j = 0; j < 6; ++j)
 		   M(i,j) = 0.0;
    M(0,3) = 1.0; M(1,4) = 1.0; M(2,5) = 1.0;
-   for (int i = 1; i < 3; ++i)
+   for (int i = 0; i < 3; ++i)
 	   for (int j = 0; j < 3; ++j)
 		   M(i+3,j) = m1(i,j);
 
@@ -683,6 +512,79 @@ bool PolyhedronGravityModel::Calculation(Rvector6 x, Rvector6& xdot, Rmatrix66&
 }
 
 
+//-------------------------------------------------------------------------------
+// void CalculateBatch(const Real *state, Real *derivs)
+//-------------------------------------------------------------------------------
+/*
+ * Calculates the gravity derivatives of every spacecraft in the state
+ *
+ * All of the spacecraft see the body at the same epoch, so the transformation
+ * to the body fixed frame is computed once.  Spacecraft beyond the far field
+ * radius use the degree 2 expansion; the others are summed together by
+ * PolyhedronBody::FieldSumBatch, which shares them out between the threads.
+ *
+ * @param state   The propagation state, in the body MJ2000Eq frame
+ * @param derivs  The derivative vector filled for the Cartesian states
+*/
+//-------------------------------------------------------------------------------
+void PolyhedronGravityModel::CalculateBatch(const Real *state, Real *derivs)
+{
+   polybody->BuildFieldData();
+
+   std::vector<Rmatrix33> transform = CalculateTransformationMatrix();
+   const Rmatrix33 &D = transform[0];
+   Rmatrix33 Dt = D.Transpose();
+   Real scale = GmatPhysicalConstants::UNIVERSAL_GRAVITATIONAL_CONSTANT *
+         1.0e9 * bodyDensity;
+
+   batchPoints.clear();
+   batchIndex.clear();
+   batchField.assign(cartesianCount * 3, 0.0);
+   Real gradient[9];
+   for (Integer k = 0; k < cartesianCount; ++k)
+   {
+      const Real *x = state + cartesianStart + k * 6;
+      Rvector3 r = D * Rvector3(x[0], x[1], x[2]);
+      if ((farFieldRadius > 0.0) && (r.GetMagnitude() > farFieldRadius))
+         polybody->FarFieldSum(r.GetDataVector(), &batchField[k * 3],
+               gradient);
+      else
+      {
+         batchIndex.push_back(k);
+         batchPoints.insert(batchPoints.end(), r.GetDataVector(),
+               r.GetDataVector() + 3);
+      }
+   }
+
+   sumWf = 0.0;
+   Integer nearCount = (Integer)batchIndex.size();
+   if (nearCount > 0)
+   {
+      RealArray nearField(nearCount * 3);
+      batchGradient.resize(nearCount * 9);
+      batchAngle.resize(nearCount);
+      polybody->FieldSumBatch(nearCount, &batchPoints[0], &nearField[0],
+            &batchGradient[0], &batchAngle[0], threadCount);
+      for (Integer i = 0; i < nearCount; ++i)
+         for (Integer j = 0; j < 3; ++j)
+            batchField[batchIndex[i] * 3 + j] = nearField[i * 3 + j];
+      if (batchIndex[0] == 0)
+         sumWf = batchAngle[0];
+   }
+
+   for (Integer k = 0; k < cartesianCount; ++k)
+   {
+      const Real *x = state + cartesianStart + k * 6;
+      Real *xdot = derivs + cartesianStart + k * 6;
+      Rvector3 a = Dt * (scale * Rvector3(batchField[k * 3],
+            batchField[k * 3 + 1], batchField[k * 3 + 2]));
+      for (Integer j = 0; j < 3; ++j)
+      {
+         xdot[j] = x[j + 3];
+         xdot[j + 3] = a[j];
+      }
+   }
+}
 
 
 //------------------------------------------------------------------------------
@@ -834,6 +736,7 @@ bool PolyhedronGravityModel::SetStringParameter(const std::string &label,
 Real PolyhedronGravityModel::GetRealParameter(const Integer id) const
 {
    if (id == BODY_DENSITY)   return bodyDensity;                // unit: kg/m^3
+   if (id == FAR_FIELD_RADIUS)  return farFieldRadius;          // unit: km
 
    return GravityBase::GetRealParameter(id);
 }
@@ -852,6 +755,13 @@ Real PolyhedronGravityModel::SetRealParameter(const Integer id,
                                            const Real value)
 {
    if (id == BODY_DENSITY)       return (bodyDensity = value);      // unit: kg/m^3
+   if (id == FAR_FIELD_RADIUS)
+   {
+      if (value < 0.0)
+         throw ODEModelException("Error: the value of FarFieldRadius on \"" +
+               instanceName + "\" must be 0 or greater");
+      return (farFieldRadius = value);                               // unit: km
+   }
 
    return GravityBase::SetRealParameter(id, value);
 }
@@ -890,6 +800,77 @@ Real PolyhedronGravityModel::SetRealParameter(const std::string &label,
 }
 
 
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to obtain a parameter value
+ *
+ * @param id    Integer ID for the requested parameter
+ */
+//------------------------------------------------------------------------------
+Integer PolyhedronGravityModel::GetIntegerParameter(const Integer id) const
+{
+   if (id == THREAD_COUNT)   return threadCount;
+
+   return GravityBase::GetIntegerParameter(id);
+}
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to set a parameter value
+ *
+ * @param    id  Integer ID for the parameter
+ * @param    value The new value for the parameter
+ */
+//------------------------------------------------------------------------------
+Integer PolyhedronGravityModel::SetIntegerParameter(const Integer id,
+                                           const Integer value)
+{
+   if (id == THREAD_COUNT)
+   {
+      if (value < 0)
+         throw ODEModelException("Error: the value of ThreadCount on \"" +
+               instanceName + "\" must be 0 or greater");
+      return (threadCount = value);
+   }
+
+   return GravityBase::SetIntegerParameter(id, value);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to obtain a parameter value
+ *
+ * @param label    string ID for the requested parameter
+ */
+//------------------------------------------------------------------------------
+Integer PolyhedronGravityModel::GetIntegerParameter(const std::string &label) const
+{
+   return GetIntegerParameter(GetParameterID(label));
+}
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const std::string &label, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to set a parameter value
+ *
+ * @param    label    string ID for the requested parameter
+ * @param    value    The new value for the parameter
+ */
+//------------------------------------------------------------------------------
+Integer PolyhedronGravityModel::SetIntegerParameter(const std::string &label,
+                                           const Integer value)
+{
+   return SetIntegerParameter(GetParameterID(label), value);
+}
+
+
 //------------------------------------------------------------------------------
 // bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order)
 //------------------------------------------------------------------------------
@@ -949,6 +930,13 @@ bool PolyhedronGravityModel::GetDerivatives(Real * state, Real dt, Integer order
       #endif 
 
 	   initialtime = createForceBody->GetRealParameter(createForceBody->GetParameterID("OrientationEpoch"));
+
+      // Ensembles are evaluated together, sharing the body orientation
+      if (cartesianCount > 1)
+      {
+         CalculateBatch(state, deriv);
+         return true;
+      }
    
 	  // state of spacecraft in the body (asteroid) MJ2000Eq coordinate system:
 	  Rvector6 x(state);					// notice that the input spacecraft state is the spacecarft state w/r/t the body				// spacecraftState - bodyState;
@@ -77,6 +77,13 @@ public:
    virtual Real        SetRealParameter(const std::string &label,
                                         const Real value);
 
+   virtual Integer     GetIntegerParameter(const Integer id) const;
+   virtual Integer     SetIntegerParameter(const Integer id,
+                                           const Integer value);
+   virtual Integer     GetIntegerParameter(const std::string &label) const;
+   virtual Integer     SetIntegerParameter(const std::string &label,
+                                           const Integer value);
+
 
    // Methods used by the ODEModel to set the state indexes, etc
    virtual bool SupportsDerivative(Gmat::StateElementId id);
@@ -93,6 +100,10 @@ public:
 	  /// File containing data specifying shape of the body
 	  BODY_DENSITY,
 	  /// Desity of the body
+	  FAR_FIELD_RADIUS,
+	  /// Distance beyond which the field is taken from the degree 2 expansion
+	  THREAD_COUNT,
+	  /// Number of threads summing the field of large bodies or ensembles
 	  //FORCE_APPLIED_ONOBJECTS,
 	  /// list of spacecrafts need to specify gravity acceleration
       PolyhedronGravityModelParamCount
@@ -109,7 +120,7 @@ private:
    Rmatrix33            CalculateTransformationMatrix_UsingIAUSimplified() const;
    const std::vector<Rmatrix33> CalculateTransformationMatrix() const;
    bool					   Calculation(Rvector6 x, Rvector6& xdot, Rmatrix66& A);		// calculate gravity
-   bool                 firstcalculation;
+   void                 CalculateBatch(const Real *state, Real *derivs);
 
    std::string          createForceBodyName;		// name of the body generating gravity field
    CelestialBody*       createForceBody;			// the body generating gravity field
@@ -118,6 +129,19 @@ private:
    PolyhedronBody* 		polybody;					// object defining shape of the body
    Rvector6             bodyOrientation;			// orientation of the body
    Rvector6             bodyState;					// state of the body
+   /// Distance (km) beyond which the degree 2 expansion replaces the
+   /// polyhedron sums; 0 always uses the polyhedron
+   Real                 farFieldRadius;
+   /// Number of threads summing the field; 0 uses one per hardware thread
+   Integer              threadCount;
+   /// Body fixed positions of the spacecraft summed by CalculateBatch
+   RealArray            batchPoints;
+   /// Fields, gradients and solid angles of the summed spacecraft
+   RealArray            batchField;
+   RealArray            batchGradient;
+   RealArray            batchAngle;
+   /// Index in the propagation state of each summed spacecraft
+   IntegerArray         batchIndex;
 
    Real					   now;                    // current time
    Real                 initialtime;				// initial time
@@ -29,6 +29,104 @@
 
 #include "gmatdefs.hpp"
 #include "PrinceDormand853.hpp"
+#include "PhysicalModel.hpp"
+
+//---------------------------------
+// static data
+//---------------------------------
+
+/// Number of stages used by the dense output, including those of the step
+static const Integer DENSE_STAGES = 16;
+/// Number of coefficients in the dense output polynomial
+static const Integer DENSE_COEFFICIENTS = 8;
+
+/// Step fractions for the three dense output stages (DOP853 c14 - c16)
+static const Real denseAi[3] =
+{
+   0.1, 0.2, 0.777777777777777777777777777778
+};
+
+/// Stage coefficients for the three dense output stages (DOP853 a14 - a16)
+static const Real denseBij[3][15] =
+{
+   {  5.61675022830479523392909219681e-2, 0.0, 0.0, 0.0, 0.0, 0.0,
+      2.53500210216624811088794765333e-1,
+     -2.46239037470802489917441475441e-1,
+     -1.24191423263816360469010140626e-1,
+      1.5329179827876569731206322685e-1,
+      8.20105229563468988491666602057e-3,
+      7.56789766054569976138603589584e-3,
+     -8.298e-3, 0.0, 0.0 },
+   {  3.18346481635021405060768473261e-2, 0.0, 0.0, 0.0, 0.0,
+      2.83009096723667755288322961402e-2,
+      5.35419883074385676223797384372e-2,
+     -5.49237485713909884646569340306e-2, 0.0, 0.0,
+     -1.08347328697249322858509316994e-4,
+      3.82571090835658412954920192323e-4,
+     -3.40465008687404560802977114492e-4,
+      1.41312443674632500278074618366e-1, 0.0 },
+   { -4.28896301583791923408573538692e-1, 0.0, 0.0, 0.0, 0.0,
+     -4.69762141536116384314449447206,
+      7.68342119606259904184240953878,
+      4.06898981839711007970213554331,
+      3.56727187455281109270669543021e-1, 0.0, 0.0, 0.0,
+     -1.39902416515901462129418009734e-3,
+      2.9475147891527723389556272149,
+     -9.15095847217987001081870187138 }
+};
+
+/// Weights of the 16 stages in the high order polynomial terms (DOP853 d4-d7)
+static const Real denseDij[4][16] =
+{
+   { -0.84289382761090128651353491142e+01, 0.0, 0.0, 0.0, 0.0,
+      0.56671495351937776962531783590e+00,
+     -0.30689499459498916912797304727e+01,
+      0.23846676565120698287728149680e+01,
+      0.21170345824450282767155149946e+01,
+     -0.87139158377797299206789907490e+00,
+      0.22404374302607882758541771650e+01,
+      0.63157877876946881815570249290e+00,
+     -0.88990336451333310820698117400e-01,
+      0.18148505520854727256656404962e+02,
+     -0.91946323924783554000451984436e+01,
+     -0.44360363875948939664310572000e+01 },
+   {  0.10427508642579134603413151009e+02, 0.0, 0.0, 0.0, 0.0,
+      0.24228349177525818288430175319e+03,
+      0.16520045171727028198505394887e+03,
+     -0.37454675472269020279518312152e+03,
+     -0.22113666853125306036270938578e+02,
+      0.77334326684722638389603898808e+01,
+     -0.30674084731089398182061213626e+02,
+     -0.93321305264302278729567221706e+01,
+      0.15697238121770843886131091075e+02,
+     -0.31139403219565177677282850411e+02,
+     -0.93529243588444783865713862664e+01,
+      0.35816841486394083752465898540e+02 },
+   {  0.19985053242002433820987653617e+02, 0.0, 0.0, 0.0, 0.0,
+     -0.38703730874935176555105901742e+03,
+     -0.18917813819516756882830838328e+03,
+      0.52780815920542364900561016686e+03,
+     -0.11573902539959630126141871134e+02,
+      0.68812326946963000169666922661e+01,
+     -0.10006050966910838403183860980e+01,
+      0.77771377980534432092869265740e+00,
+     -0.27782057523535084065932004339e+01,
+     -0.60196695231264120758267380846e+02,
+      0.84320405506677161018159903784e+02,
+      0.11992291136182789328035130030e+02 },
+   { -0.25693933462703749003312586129e+02, 0.0, 0.0, 0.0, 0.0,
+     -0.15418974869023643374053993627e+03,
+     -0.23152937917604549567536039109e+03,
+      0.35763911791061412378285349910e+03,
+      0.93405324183624310003907691704e+02,
+     -0.37458323136451633156875139351e+02,
+      0.10409964950896230045147246184e+03,
+      0.29840293426660503123344363579e+02,
+     -0.43533456590011143754432175058e+02,
+      0.96324553959188282948394950600e+02,
+     -0.39177261675615439165231486172e+02,
+     -0.14972683625798562581422125276e+03 }
+};
 
 //---------------------------------
 // public
@@ -43,7 +141,8 @@
 //------------------------------------------------------------------------------
 PrinceDormand853::PrinceDormand853(const std::string &nomme) :
 //   RungeKutta      (16, 8, "PrinceDormand853", nomme)
-   RungeKutta      (12, 8, "PrinceDormand853", nomme)
+   RungeKutta      (12, 8, "PrinceDormand853", nomme),
+   denseCoefficientsValid (false)
 {
 }
 
@@ -67,7 +166,8 @@ PrinceDormand853::~PrinceDormand853()
  */
 //------------------------------------------------------------------------------
 PrinceDormand853::PrinceDormand853(const PrinceDormand853& rk) :
-    RungeKutta      (rk)
+    RungeKutta      (rk),
+    denseCoefficientsValid (false)
 {
 }
 
@@ -85,6 +185,9 @@ PrinceDormand853 & PrinceDormand853::operator=(const PrinceDormand853& rk)
         return *this;
 
     RungeKutta::operator=(rk);
+    denseStages.clear();
+    denseCoefficients.clear();
+    denseCoefficientsValid = false;
 
     return *this;
 }
@@ -102,6 +205,96 @@ Propagator* PrinceDormand853::Clone() const
     return new PrinceDormand853(*this);
 }
 
+
+//------------------------------------------------------------------------------
+// bool Step()
+//------------------------------------------------------------------------------
+/**
+ * Takes a step, keeping the stages of the step for the dense output
+ *
+ * The stages are copied because later step attempts overwrite them; the
+ * extra dense output stages are not evaluated until they are requested.
+ *
+ * @return true if the step was taken
+ */
+//------------------------------------------------------------------------------
+bool PrinceDormand853::Step()
+{
+   bool retval = RungeKutta::Step();
+
+   if (denseValid)
+   {
+      if ((denseStages.size() != (UnsignedInt)DENSE_STAGES) ||
+          (denseStages[0].size() != (UnsignedInt)dimension))
+      {
+         denseStages.assign(DENSE_STAGES, RealArray(dimension, 0.0));
+         denseCoefficients.assign(DENSE_COEFFICIENTS,
+               RealArray(dimension, 0.0));
+      }
+
+      for (Integer i = 0; i < stages; ++i)
+         memcpy(&denseStages[i][0], ki[i], dimension*sizeof(Real));
+      denseCoefficientsValid = false;
+   }
+
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step(Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Steps a fixed time; the individual steps are taken by Step()
+ *
+ * @param dt    The time interval to step
+ *
+ * @return true if the interval was stepped
+ */
+//------------------------------------------------------------------------------
+bool PrinceDormand853::Step(Real dt)
+{
+   return RungeKutta::Step(dt);
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetDenseState(Real dt, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the state across the last accepted step.
+ *
+ * This override replaces the cubic Hermite interpolant with the seventh order
+ * DOP853 continuous extension, so the interpolated states keep the accuracy
+ * of the steps themselves.
+ *
+ * @param dt    The time from the start of the last step, in seconds
+ * @param state The array that receives the interpolated state
+ *
+ * @return true if the state was filled in
+ */
+//------------------------------------------------------------------------------
+bool PrinceDormand853::GetDenseState(Real dt, Real *state)
+{
+   if (!denseValid || (denseStep == 0.0) || denseStages.empty())
+      return false;
+
+   if (!denseCoefficientsValid)
+      if (!BuildDenseCoefficients())
+         return false;
+
+   Real s  = dt / denseStep;
+   Real s1 = 1.0 - s;
+
+   for (Integer j = 0; j < dimension; ++j)
+      state[j] = denseCoefficients[0][j] + s * (denseCoefficients[1][j] +
+                 s1 * (denseCoefficients[2][j] + s * (denseCoefficients[3][j] +
+                 s1 * (denseCoefficients[4][j] + s * (denseCoefficients[5][j] +
+                 s1 * (denseCoefficients[6][j] + s * denseCoefficients[7][j]))))));
+
+   return true;
+}
+
 //---------------------------------
 // protected
 //---------------------------------
@@ -321,3 +514,72 @@ void PrinceDormand853::SetCoefficients()
        ee[12] = ee[13] = ee[14] = ee[15] = 0.0;
     }
 }
+
+
+//------------------------------------------------------------------------------
+// bool BuildDenseCoefficients()
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the dense output stages and the interpolating polynomial
+ *
+ * The derivative at the end of the step and the three DOP853 dense output
+ * stages are evaluated here, followed by the polynomial coefficients in the
+ * form used by Hairer's dop853 code.
+ *
+ * @return true if the coefficients were built
+ */
+//------------------------------------------------------------------------------
+bool PrinceDormand853::BuildDenseCoefficients()
+{
+   Integer i, j, k;
+
+   // ddt is evaluated at the model's elapsed time plus the offset passed in
+   Real baseOffset = denseStartTime - physicalModel->GetTime();
+   physicalModel->SetDirection(denseStep > 0.0 ? 1.0 : -1.0);
+
+   // Stage 13 is the derivative at the end of the step
+   if (!physicalModel->GetDerivatives(denseEndState, baseOffset + denseStep))
+      return false;
+   for (j = 0; j < dimension; ++j)
+      denseStages[12][j] = denseStep * ddt[j];
+
+   for (i = 13; i < DENSE_STAGES; ++i)
+   {
+      memcpy(stageState, denseStartState, dimension*sizeof(Real));
+      for (k = 0; k < i; ++k)
+      {
+         Real b = denseBij[i-13][k];
+         if (b != 0.0)
+            for (j = 0; j < dimension; ++j)
+               stageState[j] += b * denseStages[k][j];
+      }
+
+      if (!physicalModel->GetDerivatives(stageState,
+            baseOffset + denseAi[i-13] * denseStep))
+         return false;
+      for (j = 0; j < dimension; ++j)
+         denseStages[i][j] = denseStep * ddt[j];
+   }
+
+   for (j = 0; j < dimension; ++j)
+   {
+      Real ydiff = denseEndState[j] - denseStartState[j];
+      Real bspl  = denseStages[0][j] - ydiff;
+
+      denseCoefficients[0][j] = denseStartState[j];
+      denseCoefficients[1][j] = ydiff;
+      denseCoefficients[2][j] = bspl;
+      denseCoefficients[3][j] = ydiff - denseStages[12][j] - bspl;
+
+      for (i = 0; i < 4; ++i)
+      {
+         Real sum = 0.0;
+         for (k = 0; k < DENSE_STAGES; ++k)
+            sum += denseDij[i][k] * denseStages[k][j];
+         denseCoefficients[4+i][j] = sum;
+      }
+   }
+
+   denseCoefficientsValid = true;
+   return true;
+}
@@ -35,6 +35,10 @@
  * This class implements a Runge-Kutta integrator using the coefficients derived 
  * by Prince and Dormand.  This particular set of coefficients implements the
  * eighth order integrator with seventh order error control.  
+ *
+ * Interpolation inside an accepted step uses the seventh order continuous
+ * extension of Hairer, Norsett and Wanner's DOP853, which costs four extra
+ * derivative evaluations per step and is only built when it is requested.
  */
 class PRODUCTIONPROPAGATOR_API PrinceDormand853 :
     public RungeKutta
@@ -48,9 +52,21 @@ public:
     PrinceDormand853 & operator=(const PrinceDormand853&);
 
     virtual Propagator* Clone() const;
+
+    virtual bool Step();
+    virtual bool Step(Real dt);
+    virtual bool GetDenseState(Real dt, Real *state);
+
 protected:
-    void                        SetCoefficients();
+    /// Stages of the last accepted step followed by the dense output stages
+    std::vector<RealArray>      denseStages;
+    /// Coefficients of the 7th order dense output polynomial
+    std::vector<RealArray>      denseCoefficients;
+    /// Flag indicating that denseCoefficients describe the last accepted step
+    bool                        denseCoefficientsValid;
 
+    void                        SetCoefficients();
+    bool                        BuildDenseCoefficients();
 };
 
 #endif // PrinceDormand853_hpp
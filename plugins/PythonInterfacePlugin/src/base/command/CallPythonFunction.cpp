@@ -77,7 +77,8 @@ CallPythonFunction::CallPythonFunction() :
    inCol             (1),
    outRow            (1),
    outCol            (1),
-   pythonIf          (NULL)
+   pythonIf          (NULL),
+   pyFunction        (NULL)
 {
 #ifdef DEBUG_CONSTRUCTOR
    MessageInterface::ShowMessage("CallPythonFunction default constructor.\n");
@@ -103,7 +104,8 @@ CallPythonFunction::CallPythonFunction(const CallPythonFunction& cpf) :
    inCol             (cpf.inCol),
    outRow            (cpf.outRow),
    outCol            (cpf.outCol),
-   pythonIf          (cpf.pythonIf)
+   pythonIf          (cpf.pythonIf),
+   pyFunction        (NULL)
 {
 #ifdef DEBUG_CONSTRUCTOR
    MessageInterface::ShowMessage("CallPythonFunction copy constructor from <%p>.\n", cpf);
@@ -139,6 +141,8 @@ CallPythonFunction& CallPythonFunction::operator=(const CallPythonFunction& cpf)
       outRow = cpf.outRow;
       outCol = cpf.outCol;
       pythonIf = cpf.pythonIf;
+      pyFunction = NULL;
+      arrayInputs.clear();
    }
 
    return *this;
@@ -190,10 +194,12 @@ std::string CallPythonFunction::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer CallPythonFunction::GetParameterID(const std::string& str) const
 {
-   for (Integer i = CallFunctionParamCount; i < PythonFunctionParamCount; ++i)
-      if (str == PARAMETER_TEXT[i - CallFunctionParamCount])
-         return i;
-
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, CallFunctionParamCount,
+               PythonFunctionParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return CallFunction::GetParameterID(str);
 }
 
@@ -438,6 +444,9 @@ bool CallPythonFunction::Initialize()
       #endif
 
 	   pythonIf->PyAddModulePath(paths);
+
+      // Look the function up once here rather than on every execution
+      pyFunction = pythonIf->PyGetFunction(moduleName, functionName);
    }
    catch (BaseException &ex)
    {
@@ -501,8 +510,10 @@ bool CallPythonFunction::Execute()
   // Next, call Python function Wrapper
    try
    {
-      pyRet = pythonIf->PyFunctionWrapper(moduleName, functionName, argIn,
-            paramType, inRow, inCol, mInputList.size());
+      if (pyFunction == NULL)
+         pyFunction = pythonIf->PyGetFunction(moduleName, functionName);
+      pyRet = pythonIf->PyFunctionWrapper(pyFunction, argIn, paramType,
+            mInputList.size());
    }
    catch (BaseException &ex)
    {
@@ -588,9 +599,14 @@ bool CallPythonFunction::Execute()
       // Fill in the output parameters
       GetOutParams();
 
-      // clean up the argIns.
-      for (Integer i = 0; i < argIn.size(); ++i)
-         delete argIn.at(i);
+      // clean up the argIns; the array data belongs to the command
+      for (UnsignedInt i = 0; i < argIn.size(); ++i)
+      {
+         if (paramType[i] == Gmat::REAL_TYPE)
+            delete (Real*)argIn.at(i);
+         else if (paramType[i] == Gmat::STRING_TYPE)
+            delete (std::string*)argIn.at(i);
+      }
    }
    else   // when return value is NULL and no exception is caught/handled.
    {
@@ -832,6 +848,7 @@ void CallPythonFunction::RunComplete()
       {
          pythonIf->PyFinalize();
          pythonIf = NULL;
+         pyFunction = NULL;
       }
       catch (BaseException &ex)
       {
@@ -947,6 +964,8 @@ Integer CallPythonFunction::FillOutputList()
 //------------------------------------------------------------------------------
 void CallPythonFunction::SendInParam(std::vector<void *> &argIn, std::vector<Gmat::ParameterType> &paramType)
 {
+   arrayInputs.resize(mInputList.size());
+
    for (unsigned int i = 0; i < mInputList.size(); i++)
    {
       Parameter *param = mInputList[i];
@@ -1004,15 +1023,11 @@ void CallPythonFunction::SendInParam(std::vector<void *> &argIn, std::vector<Gma
                                  "interface does not support input arrays with "
                                  "more than one dimension.");
 
-                  for (int i = 0; i < inRow; ++i)
-                  {
-                     for (int j = 0; j < inCol; ++j)
-                     {
-                        Real *ret = new Real;
-                        *ret = arr->GetRealParameter(std::string("SingleValue"), i, j);
-                        argIn.push_back(ret);
-                     }
-                  }
+                  // Copy the elements into storage reused across calls
+                  RealArray &elements = arrayInputs[i];
+                  const Real *data = arr->GetRmatrix().GetDataVector();
+                  elements.assign(data, data + inRow * inCol);
+                  argIn.push_back(&elements);
 
                   paramType.push_back(Gmat::RMATRIX_TYPE);
                }
@@ -106,6 +106,10 @@ protected:
    UnsignedInt outCol;
 	/// Python Interface singleton
 	PythonInterface *pythonIf;
+   /// The Python function; the reference is owned by the interface's cache
+   PyObject *pyFunction;
+   /// Elements of the array inputs, shared with Python through memoryviews
+   std::vector<RealArray> arrayInputs;
 
 	/// Holder for return data from Python, for translation to GMAT objects
 	struct PyReturnValue
@@ -35,6 +35,8 @@
 #include "InterfaceException.hpp"
 #include "Array.hpp"
 #include <iostream>
+#include <sstream>
+#include <cstring>             // For memcpy()
 
 //#define DEBUG_INITIALIZATION
 //#define DEBUG_EXECUTION
@@ -258,6 +260,8 @@ bool PythonInterface::PyFinalize()
    // close and finalize Python.
    if (--numPyCommands == 0)
    {
+      // Drop the function handles so the next run picks up module edits
+      PyClearFunctionCache();
 //	   Py_Finalize();
 
       #ifdef DEBUG_EXECUTION
@@ -365,38 +369,33 @@ void PythonInterface::PyAddModulePath(const StringArray& path)
 
 
 //------------------------------------------------------------------------------
-// PyObject* PyFunctionWrapper(const std::string &modName, 
-//    const std::string &funcName, const std::vector<void *> &argIn,
-//    std::vector<Gmat::ParameterType> paramType, UnsignedInt row, 
-//    UnsignedInt col, UnsignedInt argSz)
+// PyObject* PyGetFunction(const std::string &modName,
+//       const std::string &funcName)
 //------------------------------------------------------------------------------
 /**
- * Method that calls the scripted Python function
+ * Retrieves a Python function, importing its module on the first request
  *
- * @param modName The name of teh Python file being called
+ * The function objects are cached, so repeated calls skip the import and the
+ * attribute lookup.  The cache is emptied when the last Python command
+ * finalizes, so the next run sees edits to the modules.
+ *
+ * @param modName The name of the Python module
  * @param funcName The Python function in the module
- * @param argIn The input parameters
- * @param paramType The type associated with each input
- * @param row The number of rows in the input (is this used?)
- * @param col The number of columns in the input (is this used?)
- * @param argSz The number of input arguments
  *
- * @return The PyObject containing the returned data
+ * @return The function object; the reference is owned by the cache
  */
 //------------------------------------------------------------------------------
-PyObject* PythonInterface::PyFunctionWrapper(const std::string &modName, 
-                                             const std::string &funcName,
-                                             const std::vector<void *> &argIn, 
-                                             std::vector<Gmat::ParameterType> paramType, 
-                                             UnsignedInt row, UnsignedInt col, 
-                                             UnsignedInt argSz)
+PyObject* PythonInterface::PyGetFunction(const std::string &modName,
+                                         const std::string &funcName)
 {
+   std::string key = modName + "." + funcName;
+   std::map<std::string, PyObject*>::iterator cached = functionCache.find(key);
+   if (cached != functionCache.end())
+      return cached->second;
+
    PyObject* pyModule = NULL;
    PyObject* pyPluginModule = NULL;
    PyObject* pyFuncAttr = NULL;
-   PyObject* pyArgs = NULL;
-   PyObject* pyFunc = NULL;
-   PyObject* pyTupleObj = NULL;
 
    //error messages
    PyObject* pType = NULL;
@@ -405,12 +404,6 @@ PyObject* PythonInterface::PyFunctionWrapper(const std::string &modName,
 
    std::string msg;
 
-   // Build the Python Tuple object based on the format string
-   pyTupleObj = PyTuple_New(argSz);
-   // index to add elements to Tuple
-   int i = 0; 
-   int n = 0;
-
 #ifdef IS_PY3K
    // create a python Unicode object from an UTF-8 encoded null terminated char buffer
    pyModule = PyUnicode_FromString(modName.c_str() );
@@ -444,6 +437,104 @@ PyObject* PythonInterface::PyFunctionWrapper(const std::string &modName,
       throw InterfaceException(" Python Exception: " + msg + "\n");
    }
 
+   #ifdef DEBUG_INITIALIZATION
+      MessageInterface::ShowMessage("Caching the Python function %s\n",
+            key.c_str());
+   #endif
+
+   functionCache[key] = pyFuncAttr;
+   return pyFuncAttr;
+}
+
+
+//------------------------------------------------------------------------------
+// void PyClearFunctionCache()
+//------------------------------------------------------------------------------
+/**
+ * Releases the cached Python function objects
+ */
+//------------------------------------------------------------------------------
+void PythonInterface::PyClearFunctionCache()
+{
+   std::map<std::string, PyObject*>::iterator it;
+   for (it = functionCache.begin(); it != functionCache.end(); ++it)
+      Py_XDECREF(it->second);
+   functionCache.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// PyObject* PyFunctionWrapper(const std::string &modName, 
+//    const std::string &funcName, const std::vector<void *> &argIn,
+//    std::vector<Gmat::ParameterType> paramType, UnsignedInt argSz)
+//------------------------------------------------------------------------------
+/**
+ * Method that calls the scripted Python function
+ *
+ * @param modName The name of teh Python file being called
+ * @param funcName The Python function in the module
+ * @param argIn The input parameters
+ * @param paramType The type associated with each input
+ * @param argSz The number of input arguments
+ *
+ * @return The PyObject containing the returned data
+ */
+//------------------------------------------------------------------------------
+PyObject* PythonInterface::PyFunctionWrapper(const std::string &modName, 
+                                             const std::string &funcName,
+                                             const std::vector<void *> &argIn, 
+                                             std::vector<Gmat::ParameterType> paramType, 
+                                             UnsignedInt argSz)
+{
+   return PyFunctionWrapper(PyGetFunction(modName, funcName), argIn, paramType,
+         argSz);
+}
+
+
+//------------------------------------------------------------------------------
+// PyObject* PyFunctionWrapper(PyObject *pyFunction,
+//    const std::vector<void *> &argIn,
+//    std::vector<Gmat::ParameterType> paramType, UnsignedInt argSz)
+//------------------------------------------------------------------------------
+/**
+ * Method that calls a Python function retrieved by PyGetFunction()
+ *
+ * Each input has one entry in argIn: a Real* for REAL_TYPE, a std::string*
+ * for STRING_TYPE, and a RealArray* holding the elements for RMATRIX_TYPE.
+ *
+ * @param pyFunction The Python function
+ * @param argIn The input parameters
+ * @param paramType The type associated with each input
+ * @param argSz The number of input arguments
+ *
+ * @return The PyObject containing the returned data
+ */
+//------------------------------------------------------------------------------
+PyObject* PythonInterface::PyFunctionWrapper(PyObject *pyFunction,
+                                             const std::vector<void *> &argIn, 
+                                             std::vector<Gmat::ParameterType> paramType, 
+                                             UnsignedInt argSz)
+{
+   PyObject* pyFunc = NULL;
+   PyObject* pyTupleObj = NULL;
+
+   //error messages
+   PyObject* pType = NULL;
+   PyObject* pValue = NULL;
+   PyObject* pTraceback = NULL;
+
+   std::string msg;
+
+   if (pyFunction == NULL)
+      throw InterfaceException("No Python function was provided for the call");
+
+   // Build the Python Tuple object based on the format string
+   pyTupleObj = PyTuple_New(argSz);
+   // index to add elements to Tuple
+   int i = 0; 
+   // Array views handed to Python, released after the call
+   std::vector<PyObject*> views;
+
    /*
     * GMAT supports passing data to Python using the following rules:
     *
@@ -467,94 +558,34 @@ PyObject* PythonInterface::PyFunctionWrapper(const std::string &modName,
 
       if (parType == Gmat::RMATRIX_TYPE)
       {
-         Py_buffer *pybuffer = (Py_buffer *)malloc(sizeof(Py_buffer));
-         Real *v = new Real[row*col];
-         
-         for (UnsignedInt m = 0; m < row; ++m)
+         // The view shares the caller's buffer rather than copying it.  It is
+         // released after the call, so Python code that keeps it around gets
+         // an error instead of a dangling view.
+         RealArray *data = (RealArray*)argIn.at(index);
+         PyObject *bytes = PyMemoryView_FromMemory((char*)data->data(),
+               data->size() * sizeof(Real), PyBUF_WRITE);
+         PyObject *pyobj = NULL;
+         if (bytes)
          {
-            for (UnsignedInt k = 0; k < col; ++k)
-            {
-               v[m*col+k] = *(Real*)argIn.at(m*col + k +n);
-
-               #ifdef DEBUG_INITIALIZATION
-                  MessageInterface::ShowMessage("v[] is %lf\n", v[m*col+k]);
-               #endif
-            }
+            pyobj = PyObject_CallMethod(bytes, "cast", "s", "d");
+            Py_DECREF(bytes);
          }
-            
-         n += col;
-
-         pybuffer->obj = NULL;
-         char fmt[2];
-         std::sprintf(fmt, "d");
-         pybuffer->format = fmt;
-         pybuffer->ndim = (row != 1 && col != 1) ? 2 : 1;
-         pybuffer->shape = (Py_ssize_t *)malloc(
-                            sizeof(Py_ssize_t)* pybuffer->ndim);
-         pybuffer->readonly = 0;
-         pybuffer->suboffsets = 0;
-         pybuffer->buf = v;
-
-         pybuffer->strides = (Py_ssize_t *)malloc(
-                              sizeof(Py_ssize_t)* pybuffer->ndim);
-         for (UnsignedInt m = 0; m < row; ++m)
-            pybuffer->shape[m] = col;
-
-         PyBuffer_FillContiguousStrides(pybuffer->ndim, pybuffer->shape, 
-                                        pybuffer->strides, sizeof(Real), 'C');
-
-         pybuffer->itemsize = sizeof(Real);
-         pybuffer->len = (pybuffer->ndim == 1 ?
-            pybuffer->shape[0] * pybuffer->itemsize :
-            pybuffer->shape[0] * pybuffer->shape[1] * pybuffer->itemsize);
 
-         #ifdef DEBUG_INITIALIZATION
-            MessageInterface::ShowMessage("length, shape, strides, itemsize "
-                  "values:  %d, %d, %d, %d\n",
-                  pybuffer->len, pybuffer->shape[0], pybuffer->strides[0], 
-                  pybuffer->itemsize);
-         #endif
-
-         int c = PyBuffer_IsContiguous(pybuffer, 'C');
-         Py_buffer *view = (Py_buffer *)malloc(sizeof(Py_buffer));
-
-         if (c == 1)
+         if (!pyobj)
          {
-            PyObject *pyobj = NULL;
-
-            #ifdef DEBUG_INITIALIZATION
-               MessageInterface::ShowMessage("Calling PyMemoryView_"
-                     "FromBuffer()\n");
-            #endif
-
-            pyobj = PyMemoryView_FromBuffer(pybuffer);
-
-            //check the memoryview object and read back the buffer
-            int l = 0;
-            l = PyMemoryView_Check(pyobj);
-            if (l == 1)
-            {
-               int ret = PyBuffer_FillInfo(view, pyobj, v, pybuffer->len, 0, 
-                                           PyBUF_CONTIG);
-               
-               if (ret == -1)
-               {
-                  PyErrorMsg(pType, pValue, pTraceback, msg);
-                  throw InterfaceException(" Python Exception: " + msg + "\n");
-               }
-            }
-
-            PyTuple_SetItem(pyTupleObj, i, pyobj);
-            i++;
+            Py_DECREF(pyTupleObj);
+            PyErrorMsg(pType, pValue, pTraceback, msg);
+            throw InterfaceException(" Python Exception: " + msg + "\n");
          }
 
-         // free memory
-         /// @todo: Check to see if this leaks
-   //      delete[] v;
-   //      free(view);
-   //      free(pybuffer->shape);
-   //      free(pybuffer->strides);
-   //      free(pybuffer);
+         #ifdef DEBUG_INITIALIZATION
+            MessageInterface::ShowMessage("Passing a %d element memoryview\n",
+                  data->size());
+         #endif
+
+         views.push_back(pyobj);
+         PyTuple_SetItem(pyTupleObj, i, pyobj);
+         i++;
       }
       else if (parType == Gmat::STRING_TYPE)
       {
@@ -563,50 +594,60 @@ PyObject* PythonInterface::PyFunctionWrapper(const std::string &modName,
          #endif
 
          /// @todo: Both python versions need to be implemented.
-         PyObject * pyStr = PyUnicode_FromString(((std::string *)argIn.at(n))->c_str());
+         PyObject * pyStr = PyUnicode_FromString(((std::string *)argIn.at(index))->c_str());
 
          PyTuple_SetItem(pyTupleObj, i, pyStr);
          i++;
-         n++;
       }
       else if (parType == Gmat::REAL_TYPE)
       {
          #ifdef DEBUG_INITIALIZATION
-            MessageInterface::ShowMessage("Reading floats %lf\n", *(Real*)argIn.at(n));
+            MessageInterface::ShowMessage("Reading floats %lf\n", *(Real*)argIn.at(index));
          #endif
-         PyObject* pyFloatObj = PyFloat_FromDouble(*(Real*)argIn.at(n));
+         PyObject* pyFloatObj = PyFloat_FromDouble(*(Real*)argIn.at(index));
          PyTuple_SetItem(pyTupleObj, i, pyFloatObj);
             
          i++;
-         n++;
       }
       else
+      {
+         Py_DECREF(pyTupleObj);
          throw InterfaceException("The input parameter  is not a supported input type for GMAT's Python interface");
+      }
    }
 
-   /// @todo: Check to see if this leaks
-   // delete[] v;
-   
    #ifdef DEBUG_EXECUTION
-      MessageInterface::ShowMessage("Executing the function\n", *(Real*)argIn.at(n));
+      MessageInterface::ShowMessage("Executing the function\n");
    #endif
 
    // Call the python function   
-   pyFunc = PyObject_CallObject(pyFuncAttr, pyTupleObj);
+   pyFunc = PyObject_CallObject(pyFunction, pyTupleObj);
 
    #ifdef DEBUG_EXECUTION
-      MessageInterface::ShowMessage("Function executed\n", *(Real*)argIn.at(n));
+      MessageInterface::ShowMessage("Function executed\n");
    #endif
-  
-   Py_DECREF(pyFuncAttr);
-   Py_DECREF(pyTupleObj);
 
    if (!pyFunc)
    {
       PyErrorMsg(pType, pValue, pTraceback, msg);
-      throw InterfaceException("Python Exception: " + msg + "\n");
+      PyErr_Clear();
+   }
+
+   for (UnsignedInt v = 0; v < views.size(); ++v)
+   {
+      PyObject *released = PyObject_CallMethod(views[v], "release", NULL);
+      if (released)
+         Py_DECREF(released);
+      else
+         // The view is still exported, e.g. to a NumPy array
+         PyErr_Clear();
    }
 
+   Py_DECREF(pyTupleObj);
+
+   if (!pyFunc)
+      throw InterfaceException("Python Exception: " + msg + "\n");
+
    return pyFunc;
 }
 
@@ -634,8 +675,6 @@ PyObject* PythonInterface::PyExternalFunctionWrapper(const std::string &modName,
 	Real *state, Real now, Integer order,
 	UnsignedInt argSz)
 {
-	PyObject* pyModule = NULL;
-	PyObject* pyPluginModule = NULL;
 	PyObject* pyFuncAttr = NULL;
 	PyObject* pyArgs = NULL;
 	PyObject* pyFunc = NULL;
@@ -655,38 +694,8 @@ PyObject* PythonInterface::PyExternalFunctionWrapper(const std::string &modName,
 	// index to add elements to Tuple
 	int i = 0;
 
-#ifdef IS_PY3K
-	// create a python Unicode object from an UTF-8 encoded null terminated char buffer
-	pyModule = PyUnicode_FromString(modName.c_str());
-#else
-	pyModule = PyBytes_FromString(modName.c_str());
-#endif
-
-	if (!pyModule)
-	{
-		PyErrorMsg(pType, pValue, pTraceback, msg);
-		throw InterfaceException(" Python Exception: " + msg + "\n");
-	}
-
-	// import the python module
-	pyPluginModule = PyImport_Import(pyModule);
-	Py_DECREF(pyModule);
-
-	if (!pyPluginModule)
-	{
-		PyErrorMsg(pType, pValue, pTraceback, msg);
-		throw InterfaceException(" Python Exception: " + msg + "\n");
-	}
-
-	// retrieve an attribute named 'funcName' from the python module
-	pyFuncAttr = PyObject_GetAttrString(pyPluginModule, funcName.c_str());
-	Py_DECREF(pyPluginModule);
-
-	if (!pyFuncAttr)
-	{
-		PyErrorMsg(pType, pValue, pTraceback, msg);
-		throw InterfaceException(" Python Exception: " + msg + "\n");
-	}	
+	// The module and function are looked up once, then cached
+	pyFuncAttr = PyGetFunction(modName, funcName);
 
 	PyObject* pyList = PyList_New(6);
 
@@ -709,7 +718,6 @@ PyObject* PythonInterface::PyExternalFunctionWrapper(const std::string &modName,
 	// Call the python function   
 	pyFunc = PyObject_CallObject(pyFuncAttr, pyTupleObj);
 	
-	Py_DECREF(pyFuncAttr);
 	Py_DECREF(pyTupleObj);
 
 	if (!pyFunc)
@@ -721,6 +729,185 @@ PyObject* PythonInterface::PyExternalFunctionWrapper(const std::string &modName,
 	return pyFunc;
 }
 
+//------------------------------------------------------------------------------
+// void PyStateFunctionWrapper(PyObject *pyFunction, const Real *state,
+//       UnsignedInt stateSize, Real now, Integer order, Real *result,
+//       UnsignedInt resultSize)
+//------------------------------------------------------------------------------
+/**
+ * Calls a Python function retrieved by PyGetFunction() as f(state, now, order)
+ * and writes the values it returns into the caller's buffer
+ *
+ * The state is passed as a read-only 'd' memoryview of the caller's buffer,
+ * so it is not copied and NumPy can wrap it with numpy.asarray().  The view
+ * is released after the call.  The function may return a list, a tuple, or
+ * any object exporting a contiguous buffer of doubles, such as a float64
+ * NumPy array, which is copied in one block.
+ *
+ * @param pyFunction The Python function
+ * @param state The state passed to the function
+ * @param stateSize The number of elements in state
+ * @param now The epoch passed to the function
+ * @param order The derivative order passed to the function
+ * @param result Buffer receiving the returned values
+ * @param resultSize The number of values the function must return
+ */
+//------------------------------------------------------------------------------
+void PythonInterface::PyStateFunctionWrapper(PyObject *pyFunction,
+      const Real *state, UnsignedInt stateSize, Real now, Integer order,
+      Real *result, UnsignedInt resultSize)
+{
+   //error messages
+   PyObject* pType = NULL;
+   PyObject* pValue = NULL;
+   PyObject* pTraceback = NULL;
+
+   std::string msg;
+
+   if (pyFunction == NULL)
+      throw InterfaceException("No Python function was provided for the call");
+
+   // A typed view straight onto the caller's buffer; memoryview copies the
+   // shape, so a local is enough
+   Py_ssize_t shape = stateSize;
+   Py_buffer buffer;
+   buffer.buf        = (void*)state;
+   buffer.obj        = NULL;
+   buffer.len        = stateSize * sizeof(Real);
+   buffer.itemsize   = sizeof(Real);
+   buffer.readonly   = 1;
+   buffer.ndim       = 1;
+   buffer.format     = (char*)"d";
+   buffer.shape      = &shape;
+   buffer.strides    = &buffer.itemsize;
+   buffer.suboffsets = NULL;
+   buffer.internal   = NULL;
+
+   PyObject *view = PyMemoryView_FromBuffer(&buffer);
+   if (!view)
+   {
+      PyErrorMsg(pType, pValue, pTraceback, msg);
+      PyErr_Clear();
+      throw InterfaceException("Python Exception: " + msg + "\n");
+   }
+
+   PyObject *pyArgs = Py_BuildValue("(Odd)", view, now, (Real)order);
+   PyObject *pyRet = NULL;
+   if (pyArgs)
+   {
+      pyRet = PyObject_CallObject(pyFunction, pyArgs);
+      Py_DECREF(pyArgs);
+   }
+   if (!pyRet)
+   {
+      PyErrorMsg(pType, pValue, pTraceback, msg);
+      PyErr_Clear();
+   }
+
+   PyObject *released = PyObject_CallMethod(view, "release", NULL);
+   if (released)
+      Py_DECREF(released);
+   else
+      // The view is still exported, e.g. to a NumPy array
+      PyErr_Clear();
+   Py_DECREF(view);
+
+   if (!pyRet)
+      throw InterfaceException("Python Exception: " + msg + "\n");
+
+   try
+   {
+      PyReadReals(pyRet, result, resultSize);
+   }
+   catch (...)
+   {
+      Py_DECREF(pyRet);
+      throw;
+   }
+   Py_DECREF(pyRet);
+}
+
+
+//------------------------------------------------------------------------------
+// void PyReadReals(PyObject *pyResult, Real *values, UnsignedInt count)
+//------------------------------------------------------------------------------
+/**
+ * Copies count numbers returned from Python into values
+ *
+ * A contiguous buffer of doubles is copied in one block; any other sequence
+ * is read element by element.
+ *
+ * @param pyResult The object returned by the Python function
+ * @param values Buffer receiving the numbers
+ * @param count The number of numbers expected
+ */
+//------------------------------------------------------------------------------
+void PythonInterface::PyReadReals(PyObject *pyResult, Real *values,
+                                  UnsignedInt count)
+{
+   //error messages
+   PyObject* pType = NULL;
+   PyObject* pValue = NULL;
+   PyObject* pTraceback = NULL;
+
+   std::string msg;
+   std::stringstream sizeMsg;
+
+   if (PyObject_CheckBuffer(pyResult))
+   {
+      Py_buffer view;
+      if (PyObject_GetBuffer(pyResult, &view,
+                             PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0)
+      {
+         std::string format = (view.format ? view.format : "B");
+         bool isReal = (view.itemsize == sizeof(Real)) &&
+               ((format == "d") || (format == "=d") || (format == "@d"));
+         if (isReal && (view.len == (Py_ssize_t)(count * sizeof(Real))))
+         {
+            memcpy(values, view.buf, count * sizeof(Real));
+            PyBuffer_Release(&view);
+            return;
+         }
+         PyBuffer_Release(&view);
+      }
+      else
+         PyErr_Clear();
+   }
+
+   PyObject *sequence = PySequence_Fast(pyResult,
+         "The Python function did not return a sequence of numbers");
+   if (!sequence)
+   {
+      PyErrorMsg(pType, pValue, pTraceback, msg);
+      PyErr_Clear();
+      throw InterfaceException("Python Exception: " + msg + "\n");
+   }
+
+   Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+   if (size != (Py_ssize_t)count)
+   {
+      Py_DECREF(sequence);
+      sizeMsg << "The Python function returned " << size
+              << " values; " << count << " were expected\n";
+      throw InterfaceException(sizeMsg.str());
+   }
+
+   PyObject **items = PySequence_Fast_ITEMS(sequence);
+   for (UnsignedInt k = 0; k < count; ++k)
+   {
+      values[k] = PyFloat_AsDouble(items[k]);
+      if ((values[k] == -1.0) && PyErr_Occurred())
+      {
+         Py_DECREF(sequence);
+         PyErrorMsg(pType, pValue, pTraceback, msg);
+         PyErr_Clear();
+         throw InterfaceException("Python Exception: " + msg + "\n");
+      }
+   }
+   Py_DECREF(sequence);
+}
+
+
 //------------------------------------------------------------------------------
 // void PyErrorMsg(PyObject* pType, PyObject* pValue, PyObject* pTraceback, 
 //       std::string &msg)
@@ -32,6 +32,7 @@
 #define PYTHONINTERFACE_HPP
 
 #include <Python.h>
+#include <map>
 #include "pythoninterface_defs.hpp"
 #include "Interface.hpp"
 #include "CommandException.hpp"
@@ -47,17 +48,29 @@ public:
    bool                    PyInitialize();
    bool                    PyFinalize();
    void                    PyAddModulePath(const StringArray& path);
+   PyObject*               PyGetFunction(const std::string &modName,
+                                         const std::string &funcName);
+   void                    PyClearFunctionCache();
    PyObject*               PyFunctionWrapper(const std::string &modName, 
                                              const std::string &funcName,
                                              const std::vector<void *> &argIn, 
                                              std::vector<Gmat::ParameterType> paramType, 
-                                             UnsignedInt row, UnsignedInt col, 
+                                             UnsignedInt argSz);
+   PyObject*               PyFunctionWrapper(PyObject *pyFunction,
+                                             const std::vector<void *> &argIn, 
+                                             std::vector<Gmat::ParameterType> paramType, 
                                              UnsignedInt argSz);
 
    PyObject*               PyExternalFunctionWrapper(const std::string &modName,
 													 const std::string &funcName,
 													 Real *state, Real dt, Integer order,
 													 UnsignedInt argSz);
+   void                    PyStateFunctionWrapper(PyObject *pyFunction,
+                                                  const Real *state,
+                                                  UnsignedInt stateSize,
+                                                  Real now, Integer order,
+                                                  Real *result,
+                                                  UnsignedInt resultSize);
 	
    DEFAULT_TO_NO_CLONES
    DEFAULT_TO_NO_REFOBJECTS
@@ -71,6 +84,8 @@ private:
    Integer                    numPyCommands;
    /// Path separator for the platform
    std::string                plF;
+   /// Function objects, keyed by "module.function"; the map owns a reference
+   std::map<std::string, PyObject*>  functionCache;
 
    PythonInterface(const std::string &name);
    ~PythonInterface();
@@ -83,6 +98,8 @@ private:
    void                 PyPathSep();
    void                 PyErrorMsg(PyObject* pType, PyObject* pValue, 
                                    PyObject* pTraceback, std::string &msg);
+   void                 PyReadReals(PyObject *pyResult, Real *values,
+                                    UnsignedInt count);
 };
 
 #endif
@@ -0,0 +1,154 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                 RestoreState
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Class implementation for the RestoreState command
+ */
+//------------------------------------------------------------------------------
+
+#include "RestoreState.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_RESTORESTATE_EXEC
+
+
+//------------------------------------------------------------------------------
+// RestoreState()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor.
+ */
+//------------------------------------------------------------------------------
+RestoreState::RestoreState() :
+   SnapshotCommand   ("RestoreState")
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~RestoreState()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ */
+//------------------------------------------------------------------------------
+RestoreState::~RestoreState()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// RestoreState(const RestoreState& cmd)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param cmd The instance that is copied.
+ */
+//------------------------------------------------------------------------------
+RestoreState::RestoreState(const RestoreState& cmd) :
+   SnapshotCommand   (cmd)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// RestoreState& operator=(const RestoreState& cmd)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator.
+ *
+ * @param cmd The instance that is copied.
+ *
+ * @return this instance, with internal data set to match the input command.
+ */
+//------------------------------------------------------------------------------
+RestoreState& RestoreState::operator=(const RestoreState& cmd)
+{
+   if (this != &cmd)
+      SnapshotCommand::operator=(cmd);
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Execute()
+//------------------------------------------------------------------------------
+/**
+ * Reads the snapshot file and sets the values of the objects.
+ *
+ * @return true if the Command runs to completion, false if an error
+ *         occurs.
+ */
+//------------------------------------------------------------------------------
+bool RestoreState::Execute()
+{
+   snapshot.Read(fullFileName);
+
+   bool restoreAll = objNameArray.empty();
+   StringArray names = (restoreAll ? snapshot.GetObjectNames() : objNameArray);
+
+   for (UnsignedInt i = 0; i < names.size(); ++i)
+   {
+      GmatBase *obj = FindObject(names[i]);
+      if (obj == NULL)
+      {
+         // Objects the restoring script does not use are skipped
+         if (restoreAll)
+         {
+            MessageInterface::ShowMessage("*** WARNING *** The state snapshot "
+                  "\"%s\" has values for \"%s\", which is not in this run\n",
+                  fileName.c_str(), names[i].c_str());
+            continue;
+         }
+         throw CommandException("RestoreState command cannot find object \"" +
+               names[i] + "\"");
+      }
+
+      #ifdef DEBUG_RESTORESTATE_EXEC
+      MessageInterface::ShowMessage("RestoreState::Execute() restoring %s\n",
+            names[i].c_str());
+      #endif
+
+      if (!snapshot.Restore(obj))
+         throw CommandException("The state snapshot \"" + fileName +
+               "\" has no values for \"" + names[i] + "\"");
+   }
+
+   BuildCommandSummary(true);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+//  GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * This method returns a clone of the RestoreState.
+ *
+ * @return clone of the RestoreState.
+ */
+//------------------------------------------------------------------------------
+GmatBase* RestoreState::Clone() const
+{
+   return (new RestoreState(*this));
+}
@@ -0,0 +1,54 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                 RestoreState
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Class definition for the RestoreState command
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef RestoreState_hpp
+#define RestoreState_hpp
+
+#include "SnapshotCommand.hpp"
+
+/**
+ * Command that sets mission objects to the values in a snapshot written by
+ * SaveState
+ *
+ * Without an object list, every object in the snapshot that also exists in
+ * the run is restored.
+ */
+class SAVECOMMAND_API RestoreState : public SnapshotCommand
+{
+public:
+   RestoreState();
+   virtual ~RestoreState();
+   RestoreState(const RestoreState& cmd);
+   RestoreState&        operator=(const RestoreState& cmd);
+
+   // inherited from GmatCommand
+   virtual bool         Execute();
+
+   // inherited from GmatBase
+   virtual GmatBase*    Clone() const;
+};
+
+#endif // RestoreState_hpp
@@ -154,11 +154,11 @@ std::string Save::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Save::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatCommandParamCount; i<SaveParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount, SaveParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatCommand::GetParameterID(str);
 }
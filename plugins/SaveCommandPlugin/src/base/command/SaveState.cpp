@@ -0,0 +1,165 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  SaveState
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Class implementation for the SaveState command
+ */
+//------------------------------------------------------------------------------
+
+#include "SaveState.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_SAVESTATE_EXEC
+
+
+//------------------------------------------------------------------------------
+// SaveState()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor.
+ */
+//------------------------------------------------------------------------------
+SaveState::SaveState() :
+   SnapshotCommand   ("SaveState")
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~SaveState()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ */
+//------------------------------------------------------------------------------
+SaveState::~SaveState()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// SaveState(const SaveState& cmd)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param cmd The instance that is copied.
+ */
+//------------------------------------------------------------------------------
+SaveState::SaveState(const SaveState& cmd) :
+   SnapshotCommand   (cmd)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// SaveState& operator=(const SaveState& cmd)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator.
+ *
+ * @param cmd The instance that is copied.
+ *
+ * @return this instance, with internal data set to match the input command.
+ */
+//------------------------------------------------------------------------------
+SaveState& SaveState::operator=(const SaveState& cmd)
+{
+   if (this != &cmd)
+      SnapshotCommand::operator=(cmd);
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Execute()
+//------------------------------------------------------------------------------
+/**
+ * Writes the snapshot of the objects to the snapshot file.
+ *
+ * @return true if the Command runs to completion, false if an error
+ *         occurs.
+ */
+//------------------------------------------------------------------------------
+bool SaveState::Execute()
+{
+   snapshot.Clear();
+
+   if (objNameArray.empty())
+   {
+      // Save every object that holds run state
+      ObjectMap *maps[2] = { objectMap, globalObjectMap };
+      for (Integer m = 0; m < 2; ++m)
+      {
+         if (maps[m] == NULL)
+            continue;
+         for (ObjectMap::iterator i = maps[m]->begin(); i != maps[m]->end(); ++i)
+         {
+            GmatBase *obj = i->second;
+            if ((obj == NULL) || (m == 1 && objectMap != NULL &&
+                 objectMap->find(i->first) != objectMap->end()))
+               continue;
+
+            std::string typeName = obj->GetTypeName();
+            if (obj->IsOfType(Gmat::SPACECRAFT) || (typeName == "Variable") ||
+                (typeName == "Array") || (typeName == "String"))
+               snapshot.Capture(obj);
+         }
+      }
+   }
+   else
+   {
+      for (UnsignedInt i = 0; i < objNameArray.size(); ++i)
+      {
+         GmatBase *obj = FindObject(objNameArray[i]);
+         if (obj == NULL)
+            throw CommandException("SaveState command cannot find object \"" +
+                  objNameArray[i] + "\"");
+         snapshot.Capture(obj);
+      }
+   }
+
+   #ifdef DEBUG_SAVESTATE_EXEC
+   MessageInterface::ShowMessage("SaveState::Execute() writing %d objects to "
+         "%s\n", snapshot.GetObjectNames().size(), fullFileName.c_str());
+   #endif
+
+   snapshot.Write(fullFileName);
+
+   BuildCommandSummary(true);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+//  GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * This method returns a clone of the SaveState.
+ *
+ * @return clone of the SaveState.
+ */
+//------------------------------------------------------------------------------
+GmatBase* SaveState::Clone() const
+{
+   return (new SaveState(*this));
+}
@@ -0,0 +1,53 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  SaveState
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Class definition for the SaveState command
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef SaveState_hpp
+#define SaveState_hpp
+
+#include "SnapshotCommand.hpp"
+
+/**
+ * Command that writes a binary snapshot of mission objects
+ *
+ * Without an object list, every Spacecraft, Variable, Array and String in the
+ * run is saved.  A later run restores the snapshot with RestoreState.
+ */
+class SAVECOMMAND_API SaveState : public SnapshotCommand
+{
+public:
+   SaveState();
+   virtual ~SaveState();
+   SaveState(const SaveState& cmd);
+   SaveState&           operator=(const SaveState& cmd);
+
+   // inherited from GmatCommand
+   virtual bool         Execute();
+
+   // inherited from GmatBase
+   virtual GmatBase*    Clone() const;
+};
+
+#endif // SaveState_hpp
@@ -0,0 +1,369 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              SnapshotCommand
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Base class implementation for the commands that save and restore state
+ * snapshots
+ */
+//------------------------------------------------------------------------------
+
+#include "SnapshotCommand.hpp"
+#include "FileManager.hpp"      // for GetAbsPathname()
+#include "FileUtil.hpp"         // for IsPathAbsolute()
+#include "StringUtil.hpp"
+#include "MessageInterface.hpp"
+#include <algorithm>
+
+//#define DEBUG_SNAPSHOT_INIT
+
+//---------------------------------
+//  static data
+//---------------------------------
+const std::string
+SnapshotCommand::PARAMETER_TEXT[SnapshotCommandParamCount - GmatCommandParamCount] =
+{
+   "FileName",
+   "ObjectNames",
+};
+
+const Gmat::ParameterType
+SnapshotCommand::PARAMETER_TYPE[SnapshotCommandParamCount - GmatCommandParamCount] =
+{
+   Gmat::FILENAME_TYPE,      // "FileName",
+   Gmat::STRINGARRAY_TYPE,   // "ObjectNames",
+};
+
+
+//------------------------------------------------------------------------------
+// SnapshotCommand(const std::string &typeStr)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param typeStr The command type
+ */
+//------------------------------------------------------------------------------
+SnapshotCommand::SnapshotCommand(const std::string &typeStr) :
+   GmatCommand   (typeStr)
+{
+   objectTypeNames.push_back("SnapshotCommand");
+}
+
+
+//------------------------------------------------------------------------------
+// ~SnapshotCommand()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+SnapshotCommand::~SnapshotCommand()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// SnapshotCommand(const SnapshotCommand& sc)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param sc The instance that is copied
+ */
+//------------------------------------------------------------------------------
+SnapshotCommand::SnapshotCommand(const SnapshotCommand& sc) :
+   GmatCommand   (sc),
+   fileName      (sc.fileName),
+   objNameArray  (sc.objNameArray)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// SnapshotCommand& operator=(const SnapshotCommand& sc)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param sc The instance that is copied
+ *
+ * @return this instance, with internal data set to match the input command
+ */
+//------------------------------------------------------------------------------
+SnapshotCommand& SnapshotCommand::operator=(const SnapshotCommand& sc)
+{
+   if (this != &sc)
+   {
+      GmatCommand::operator=(sc);
+      fileName     = sc.fileName;
+      fullFileName = "";
+      objNameArray = sc.objNameArray;
+      snapshot.Clear();
+   }
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// bool InterpretAction()
+//------------------------------------------------------------------------------
+/**
+ * Parses the snapshot file and the object list from the script line
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool SnapshotCommand::InterpretAction()
+{
+   StringArray chunks = InterpretPreface();
+   if (chunks.size() < 2)
+      throw CommandException("The " + typeName + " command needs the name of "
+            "a snapshot file, as in \"" + typeName + " 'Name.snapshot'\"");
+
+   std::string args = GmatStringUtil::Trim(chunks[1], GmatStringUtil::BOTH, true, true);
+   StringArray parts = GmatStringUtil::SeparateBy(args, " ,");
+   if (parts.empty())
+      throw CommandException("The " + typeName + " command needs the name of "
+            "a snapshot file");
+
+   fileName = GmatStringUtil::RemoveEnclosingString(parts[0], "'");
+   objNameArray.clear();
+   for (UnsignedInt i = 1; i < parts.size(); ++i)
+      SetStringParameter(OBJECT_NAMES, parts[i]);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Sets the path of the snapshot file and checks the listed objects
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool SnapshotCommand::Initialize()
+{
+   bool retval = GmatCommand::Initialize();
+
+   fullFileName = fileName;
+   if (!GmatFileUtil::IsPathAbsolute(fileName))
+      fullFileName = FileManager::Instance()->
+            GetAbsPathname(FileManager::OUTPUT_PATH) + fileName;
+
+   for (UnsignedInt i = 0; i < objNameArray.size(); ++i)
+      if (FindObject(objNameArray[i]) == NULL)
+         throw CommandException(typeName + " command cannot find object \"" +
+               objNameArray[i] + "\"");
+
+   #ifdef DEBUG_SNAPSHOT_INIT
+   MessageInterface::ShowMessage("%s::Initialize() file = %s, %d objects\n",
+         typeName.c_str(), fullFileName.c_str(), objNameArray.size());
+   #endif
+
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterText(const Integer id) const
+//------------------------------------------------------------------------------
+std::string SnapshotCommand::GetParameterText(const Integer id) const
+{
+   if (id >= GmatCommandParamCount && id < SnapshotCommandParamCount)
+      return PARAMETER_TEXT[id - GmatCommandParamCount];
+   else
+      return GmatCommand::GetParameterText(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetParameterID(const std::string &str) const
+//------------------------------------------------------------------------------
+Integer SnapshotCommand::GetParameterID(const std::string &str) const
+{
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+                        SnapshotCommandParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
+
+   return GmatCommand::GetParameterID(str);
+}
+
+
+//------------------------------------------------------------------------------
+// Gmat::ParameterType GetParameterType(const Integer id) const
+//------------------------------------------------------------------------------
+Gmat::ParameterType SnapshotCommand::GetParameterType(const Integer id) const
+{
+   if (id >= GmatCommandParamCount && id < SnapshotCommandParamCount)
+      return PARAMETER_TYPE[id - GmatCommandParamCount];
+   else
+      return GmatCommand::GetParameterType(id);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterTypeString(const Integer id) const
+//------------------------------------------------------------------------------
+std::string SnapshotCommand::GetParameterTypeString(const Integer id) const
+{
+   if (id >= GmatCommandParamCount && id < SnapshotCommandParamCount)
+      return GmatBase::PARAM_TYPE_STRING[GetParameterType(id)];
+   else
+      return GmatCommand::GetParameterTypeString(id);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetStringParameter(const Integer id) const
+//------------------------------------------------------------------------------
+std::string SnapshotCommand::GetStringParameter(const Integer id) const
+{
+   if (id == SNAPSHOT_FILE)
+      return fileName;
+
+   return GmatCommand::GetStringParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetStringParameter(const Integer id, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets the snapshot file, or adds an object to the list
+ *
+ * @param id    ID for the parameter
+ * @param value The file name or object name
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool SnapshotCommand::SetStringParameter(const Integer id,
+                                         const std::string &value)
+{
+   if (id == SNAPSHOT_FILE)
+   {
+      fileName = value;
+      return true;
+   }
+
+   if (id == OBJECT_NAMES)
+   {
+      if (find(objNameArray.begin(), objNameArray.end(), value) !=
+          objNameArray.end())
+         throw CommandException("Attempting to add \"" + value + "\" more "
+               "than once to list of objects.\n");
+
+      objNameArray.push_back(value);
+      return true;
+   }
+
+   return GmatCommand::SetStringParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetStringParameter(const Integer id, const Integer index) const
+//------------------------------------------------------------------------------
+std::string SnapshotCommand::GetStringParameter(const Integer id,
+                                                const Integer index) const
+{
+   if (id == OBJECT_NAMES)
+   {
+      if ((index < 0) || (index >= ((Integer) objNameArray.size())))
+         throw CommandException
+            ("Index out of bounds when attempting to return object name\n");
+      return objNameArray.at(index);
+   }
+
+   return GmatCommand::GetStringParameter(id, index);
+}
+
+
+//------------------------------------------------------------------------------
+// const StringArray& GetStringArrayParameter(const Integer id) const
+//------------------------------------------------------------------------------
+const StringArray& SnapshotCommand::GetStringArrayParameter(const Integer id) const
+{
+   if (id == OBJECT_NAMES)
+      return objNameArray;
+
+   return GmatCommand::GetStringArrayParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetGeneratingString(Gmat::WriteMode mode,
+//       const std::string &prefix, const std::string &useName)
+//------------------------------------------------------------------------------
+/**
+ * Builds the script line for the command
+ *
+ * @param mode    Specifies the type of serialization requested.
+ * @param prefix  Optional prefix appended to the object's name.
+ * @param useName Name that replaces the object's name.
+ *
+ * @return The script line
+ */
+//------------------------------------------------------------------------------
+const std::string& SnapshotCommand::GetGeneratingString(Gmat::WriteMode mode,
+      const std::string &prefix, const std::string &useName)
+{
+   generatingString = prefix + typeName + " '" + fileName + "'";
+   for (StringArray::iterator i = objNameArray.begin(); i != objNameArray.end(); ++i)
+      generatingString += " " + *i;
+   generatingString += ";";
+
+   return GmatCommand::GetGeneratingString(mode, prefix, useName);
+}
+
+
+//------------------------------------------------------------------------------
+// bool RenameRefObject(const UnsignedInt type, const std::string &oldName,
+//       const std::string &newName)
+//------------------------------------------------------------------------------
+/**
+ * Updates object names when the user changes them
+ *
+ * @param type Type of object that is renamed.
+ * @param oldName Old name for the object.
+ * @param newName New name for the object.
+ *
+ * @return true on success.
+ */
+//------------------------------------------------------------------------------
+bool SnapshotCommand::RenameRefObject(const UnsignedInt type,
+                                      const std::string &oldName,
+                                      const std::string &newName)
+{
+   for (UnsignedInt i = 0; i < objNameArray.size(); ++i)
+   {
+      if (objNameArray[i] == oldName)
+         objNameArray[i] = newName;
+   }
+
+   return true;
+}
@@ -0,0 +1,105 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              SnapshotCommand
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Base class for the commands that save and restore state snapshots
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef SnapshotCommand_hpp
+#define SnapshotCommand_hpp
+
+#include "SaveCommandDefs.hpp"
+#include "GmatCommand.hpp"
+#include "MissionSnapshot.hpp"
+
+/**
+ * Shared scripting of the SaveState and RestoreState commands
+ *
+ * Both commands take a snapshot file and an optional list of objects:
+ *
+ *    SaveState 'WarmUp.snapshot' Sat1 Sat2 DeltaV
+ *    RestoreState 'WarmUp.snapshot'
+ *
+ * A relative file name is taken from the output directory.
+ */
+class SAVECOMMAND_API SnapshotCommand : public GmatCommand
+{
+public:
+   SnapshotCommand(const std::string &typeStr);
+   virtual ~SnapshotCommand();
+   SnapshotCommand(const SnapshotCommand& sc);
+   SnapshotCommand&     operator=(const SnapshotCommand& sc);
+
+   // inherited from GmatCommand
+   virtual bool         InterpretAction();
+   virtual bool         Initialize();
+
+   // inherited from GmatBase
+   virtual std::string  GetParameterText(const Integer id) const;
+   virtual Integer      GetParameterID(const std::string &str) const;
+   virtual Gmat::ParameterType
+                        GetParameterType(const Integer id) const;
+   virtual std::string  GetParameterTypeString(const Integer id) const;
+
+   virtual std::string  GetStringParameter(const Integer id) const;
+   virtual bool         SetStringParameter(const Integer id,
+                                           const std::string &value);
+   virtual std::string  GetStringParameter(const Integer id,
+                                           const Integer index) const;
+   virtual const StringArray&
+                        GetStringArrayParameter(const Integer id) const;
+   virtual const std::string&
+                        GetGeneratingString(Gmat::WriteMode mode,
+                                            const std::string &prefix,
+                                            const std::string &useName);
+
+   virtual bool         RenameRefObject(const UnsignedInt type,
+                                        const std::string &oldName,
+                                        const std::string &newName);
+
+   DEFAULT_TO_NO_CLONES
+
+protected:
+   // Parameter IDs
+   enum
+   {
+      SNAPSHOT_FILE = GmatCommandParamCount,
+      OBJECT_NAMES,
+      SnapshotCommandParamCount
+   };
+
+   /// Snapshot file as scripted
+   std::string          fileName;
+   /// Snapshot file with its path, set in Initialize()
+   std::string          fullFileName;
+   /// Objects saved or restored; empty for all
+   StringArray          objNameArray;
+   /// The snapshot
+   MissionSnapshot      snapshot;
+
+   static const std::string
+      PARAMETER_TEXT[SnapshotCommandParamCount - GmatCommandParamCount];
+   static const Gmat::ParameterType
+      PARAMETER_TYPE[SnapshotCommandParamCount - GmatCommandParamCount];
+};
+
+#endif // SnapshotCommand_hpp
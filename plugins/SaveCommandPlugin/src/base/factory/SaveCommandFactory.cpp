@@ -21,6 +21,8 @@
 
 #include "SaveCommandFactory.hpp"
 #include "Save.hpp"
+#include "SaveState.hpp"
+#include "RestoreState.hpp"
 
 //------------------------------------------------------------------------------
 // SaveCommandFactory()
@@ -38,6 +40,8 @@ SaveCommandFactory::SaveCommandFactory() :
    if (creatables.empty())
    {
       creatables.push_back("Save");
+      creatables.push_back("SaveState");
+      creatables.push_back("RestoreState");
    }
 }
 
@@ -69,6 +73,8 @@ SaveCommandFactory::SaveCommandFactory(const SaveCommandFactory& elf) :
    if (creatables.empty())
    {
       creatables.push_back("Save");
+      creatables.push_back("SaveState");
+      creatables.push_back("RestoreState");
    }
 }
 
@@ -96,6 +102,8 @@ SaveCommandFactory& SaveCommandFactory::operator=(
          // Replace the SampleClass string here with your class name.  For multiple 
          // classes of the same type, push back multiple names here
          creatables.push_back("Save");
+         creatables.push_back("SaveState");
+         creatables.push_back("RestoreState");
       }
    }
 
@@ -122,6 +130,10 @@ GmatCommand* SaveCommandFactory::CreateCommand(const std::string &ofType,
 {
    if (ofType == "Save")
       return new Save();
+   if (ofType == "SaveState")
+      return new SaveState();
+   if (ofType == "RestoreState")
+      return new RestoreState();
    // add more here .......
 
    return NULL;   // doesn't match any type of Command known by this factory
@@ -0,0 +1,653 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              MissionSnapshot
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Binary snapshot of the run time state of mission objects
+ */
+//------------------------------------------------------------------------------
+
+#include "MissionSnapshot.hpp"
+#include "SpaceObject.hpp"
+#include "Parameter.hpp"
+#include "Covariance.hpp"
+#include "CommandException.hpp"
+#include "MessageInterface.hpp"
+#include <fstream>
+#include <cstring>
+
+//#define DEBUG_SNAPSHOT
+
+//---------------------------------
+//  static data
+//---------------------------------
+const char    MissionSnapshot::MAGIC[16] = "GMAT snapshot";
+const Integer MissionSnapshot::VERSION = 1;
+const Integer MissionSnapshot::BYTE_ORDER_MARK = 0x01020304;
+
+namespace
+{
+   /// Spacecraft fields that a run can change, besides the state
+   const char *SPACECRAFT_FIELDS[] =
+   {
+      "DryMass", "Cd", "Cr", "DragArea", "SRPArea"
+   };
+   /// Spacecraft matrices carried in a snapshot
+   const char *SPACECRAFT_MATRICES[] =
+   {
+      "FullSTM", "FullAMatrix", "OrbitErrorCovariance"
+   };
+
+   //---------------------------------------------------------------------------
+   // Binary stream helpers
+   //---------------------------------------------------------------------------
+   void WriteInteger(std::ofstream &out, Integer value)
+   {
+      out.write((const char*)&value, sizeof(Integer));
+   }
+
+   void WriteString(std::ofstream &out, const std::string &value)
+   {
+      WriteInteger(out, (Integer)value.size());
+      out.write(value.c_str(), value.size());
+   }
+
+   Integer ReadInteger(std::ifstream &in)
+   {
+      Integer value = 0;
+      in.read((char*)&value, sizeof(Integer));
+      return value;
+   }
+
+   std::string ReadString(std::ifstream &in)
+   {
+      Integer size = ReadInteger(in);
+      if (!in || (size < 0))
+         return "";
+      std::string value(size, '\0');
+      if (size > 0)
+         in.read(&value[0], size);
+      return value;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// MissionSnapshot()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+MissionSnapshot::MissionSnapshot()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~MissionSnapshot()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+MissionSnapshot::~MissionSnapshot()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// MissionSnapshot(const MissionSnapshot &ms)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param ms The snapshot copied here
+ */
+//------------------------------------------------------------------------------
+MissionSnapshot::MissionSnapshot(const MissionSnapshot &ms) :
+   entries        (ms.entries)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// MissionSnapshot& operator=(const MissionSnapshot &ms)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param ms The snapshot copied here
+ *
+ * @return This snapshot, set to match ms
+ */
+//------------------------------------------------------------------------------
+MissionSnapshot& MissionSnapshot::operator=(const MissionSnapshot &ms)
+{
+   if (this != &ms)
+      entries = ms.entries;
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all objects from the snapshot
+ */
+//------------------------------------------------------------------------------
+void MissionSnapshot::Clear()
+{
+   entries.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// void Capture(GmatBase *obj)
+//------------------------------------------------------------------------------
+/**
+ * Stores the current values of an object
+ *
+ * @param obj The object
+ */
+//------------------------------------------------------------------------------
+void MissionSnapshot::Capture(GmatBase *obj)
+{
+   entries.push_back(Entry());
+   Entry &entry = entries.back();
+   entry.name = obj->GetName();
+   entry.typeName = obj->GetTypeName();
+
+   if (obj->IsOfType(Gmat::SPACECRAFT))
+   {
+      SpaceObject *so = (SpaceObject*)obj;
+
+      // The epoch is kept in its GmatTime parts, so nothing is lost
+      GmatTime epoch = so->GetEpochGT();
+      Real epochParts[3] = { (Real)epoch.GetDays(), (Real)epoch.GetSec(),
+                             epoch.GetFracSec() };
+      AddRecord(entry, EPOCH_RECORD, "Epoch", 1, 3, epochParts);
+
+      GmatState &state = so->GetState();
+      AddRecord(entry, STATE_RECORD, "State", 1, state.GetSize(),
+                state.GetState());
+
+      for (UnsignedInt i = 0; i < sizeof(SPACECRAFT_FIELDS) / sizeof(char*); ++i)
+      {
+         Integer id = obj->GetParameterID(SPACECRAFT_FIELDS[i]);
+         Real value = obj->GetRealParameter(id);
+         AddRecord(entry, REAL_RECORD, SPACECRAFT_FIELDS[i], 1, 1, &value);
+      }
+
+      for (UnsignedInt i = 0; i < sizeof(SPACECRAFT_MATRICES) / sizeof(char*); ++i)
+         AddMatrix(entry, obj, SPACECRAFT_MATRICES[i]);
+
+      Covariance *covariance = obj->GetCovariance();
+      if ((covariance != NULL) && (covariance->GetDimension() > 0))
+      {
+         Rmatrix *cov = covariance->GetCovariance();
+         AddRecord(entry, COVARIANCE_RECORD, "Covariance", cov->GetNumRows(),
+                   cov->GetNumColumns(), cov->GetDataVector());
+      }
+
+      ObjectArray &tanks = obj->GetRefObjectArray(Gmat::FUEL_TANK);
+      for (UnsignedInt i = 0; i < tanks.size(); ++i)
+         AddFields(entry, tanks[i], tanks[i]->GetName() + ".");
+   }
+   else if (obj->IsOfType(Gmat::PARAMETER))
+   {
+      Parameter *param = (Parameter*)obj;
+      if (entry.typeName == "Variable")
+      {
+         Real value = param->GetReal();
+         AddRecord(entry, VARIABLE_RECORD, "Value", 1, 1, &value);
+      }
+      else if (entry.typeName == "Array")
+      {
+         const Rmatrix &mat = param->GetRmatrix();
+         AddRecord(entry, ARRAY_RECORD, "Value", mat.GetNumRows(),
+                   mat.GetNumColumns(), mat.GetDataVector());
+      }
+      else if (entry.typeName == "String")
+         AddRecord(entry, STRING_RECORD, "Value", 0, 0, NULL,
+                   param->GetString());
+      else
+      {
+         entries.pop_back();
+         throw CommandException("The Parameter \"" + obj->GetName() +
+               "\" cannot be saved in a state snapshot; only Variables, "
+               "Arrays and Strings hold values that can be restored");
+      }
+   }
+   else
+      AddFields(entry, obj, "");
+
+   #ifdef DEBUG_SNAPSHOT
+      MessageInterface::ShowMessage("MissionSnapshot::Capture() stored %d "
+            "values of %s <%s>\n", entries.back().records.size(),
+            entry.name.c_str(), entry.typeName.c_str());
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// bool Restore(GmatBase *obj) const
+//------------------------------------------------------------------------------
+/**
+ * Sets the stored values on an object
+ *
+ * @param obj The object; the snapshot entry with its name is used
+ *
+ * @return true if the snapshot holds the object, false if it does not
+ */
+//------------------------------------------------------------------------------
+bool MissionSnapshot::Restore(GmatBase *obj) const
+{
+   const Entry *entry = NULL;
+   for (UnsignedInt i = 0; i < entries.size(); ++i)
+   {
+      if (entries[i].name == obj->GetName())
+      {
+         entry = &entries[i];
+         break;
+      }
+   }
+
+   if (entry == NULL)
+      return false;
+
+   if (entry->typeName != obj->GetTypeName())
+      throw CommandException("The state snapshot of \"" + entry->name +
+            "\" is for a " + entry->typeName + ", but the object in this run "
+            "is a " + obj->GetTypeName());
+
+   for (UnsignedInt i = 0; i < entry->records.size(); ++i)
+      RestoreRecord(obj, entry->records[i]);
+
+   if (obj->IsOfType(Gmat::SPACEOBJECT))
+      ((SpaceObject*)obj)->ParametersHaveChanged(true);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// StringArray GetObjectNames() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the names of the objects in the snapshot
+ */
+//------------------------------------------------------------------------------
+StringArray MissionSnapshot::GetObjectNames() const
+{
+   StringArray names;
+   for (UnsignedInt i = 0; i < entries.size(); ++i)
+      names.push_back(entries[i].name);
+   return names;
+}
+
+
+//------------------------------------------------------------------------------
+// void Write(const std::string &fileName) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the snapshot to a file
+ *
+ * @param fileName The full path of the file
+ */
+//------------------------------------------------------------------------------
+void MissionSnapshot::Write(const std::string &fileName) const
+{
+   std::ofstream out(fileName.c_str(), std::ios::out | std::ios::binary);
+   if (!out)
+      throw CommandException("Cannot open the state snapshot file \"" +
+            fileName + "\" for writing");
+
+   out.write(MAGIC, sizeof(MAGIC));
+   WriteInteger(out, VERSION);
+   WriteInteger(out, BYTE_ORDER_MARK);
+   WriteInteger(out, (Integer)entries.size());
+
+   for (UnsignedInt i = 0; i < entries.size(); ++i)
+   {
+      const Entry &entry = entries[i];
+      WriteString(out, entry.name);
+      WriteString(out, entry.typeName);
+      WriteInteger(out, (Integer)entry.records.size());
+      for (UnsignedInt j = 0; j < entry.records.size(); ++j)
+      {
+         const Record &rec = entry.records[j];
+         WriteInteger(out, rec.kind);
+         WriteString(out, rec.label);
+         WriteInteger(out, rec.rows);
+         WriteInteger(out, rec.columns);
+         if (!rec.values.empty())
+            out.write((const char*)&rec.values[0],
+                      rec.values.size() * sizeof(Real));
+         WriteString(out, rec.text);
+      }
+   }
+
+   if (!out)
+      throw CommandException("Writing the state snapshot file \"" + fileName +
+            "\" failed");
+}
+
+
+//------------------------------------------------------------------------------
+// void Read(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Replaces the contents of the snapshot with those of a file
+ *
+ * @param fileName The full path of the file
+ */
+//------------------------------------------------------------------------------
+void MissionSnapshot::Read(const std::string &fileName)
+{
+   std::ifstream in(fileName.c_str(), std::ios::in | std::ios::binary);
+   if (!in)
+      throw CommandException("Cannot open the state snapshot file \"" +
+            fileName + "\"");
+
+   char magic[sizeof(MAGIC)];
+   in.read(magic, sizeof(magic));
+   if (!in || (memcmp(magic, MAGIC, sizeof(MAGIC)) != 0))
+      throw CommandException("The file \"" + fileName + "\" is not a GMAT "
+            "state snapshot");
+   if (ReadInteger(in) != VERSION)
+      throw CommandException("The state snapshot file \"" + fileName +
+            "\" was written by a different version of GMAT");
+   if (ReadInteger(in) != BYTE_ORDER_MARK)
+      throw CommandException("The state snapshot file \"" + fileName +
+            "\" was written on a machine with a different byte order");
+
+   std::vector<Entry> readEntries;
+   Integer entryCount = ReadInteger(in);
+   for (Integer i = 0; (i < entryCount) && in; ++i)
+   {
+      readEntries.push_back(Entry());
+      Entry &entry = readEntries.back();
+      entry.name = ReadString(in);
+      entry.typeName = ReadString(in);
+      Integer recordCount = ReadInteger(in);
+      for (Integer j = 0; (j < recordCount) && in; ++j)
+      {
+         entry.records.push_back(Record());
+         Record &rec = entry.records.back();
+         rec.kind = ReadInteger(in);
+         rec.label = ReadString(in);
+         rec.rows = ReadInteger(in);
+         rec.columns = ReadInteger(in);
+         if ((rec.rows < 0) || (rec.columns < 0))
+            break;
+         rec.values.resize(rec.rows * rec.columns);
+         if (!rec.values.empty())
+            in.read((char*)&rec.values[0], rec.values.size() * sizeof(Real));
+         rec.text = ReadString(in);
+      }
+   }
+
+   if (!in)
+      throw CommandException("The state snapshot file \"" + fileName +
+            "\" is incomplete");
+
+   entries.swap(readEntries);
+}
+
+
+//------------------------------------------------------------------------------
+// void AddRecord(Entry &entry, Integer kind, const std::string &label,
+//       Integer rows, Integer columns, const Real *values,
+//       const std::string &text)
+//------------------------------------------------------------------------------
+/**
+ * Adds a value to an object's entry
+ *
+ * @param entry   The entry
+ * @param kind    The RecordKind of the value
+ * @param label   The field the value belongs to
+ * @param rows    Row count of the Real values
+ * @param columns Column count of the Real values
+ * @param values  The Real values, row by row
+ * @param text    The text of a String value
+ */
+//------------------------------------------------------------------------------
+void MissionSnapshot::AddRecord(Entry &entry, Integer kind,
+      const std::string &label, Integer rows, Integer columns,
+      const Real *values, const std::string &text)
+{
+   entry.records.push_back(Record());
+   Record &rec = entry.records.back();
+   rec.kind = kind;
+   rec.label = label;
+   rec.rows = rows;
+   rec.columns = columns;
+   if (rows * columns > 0)
+      rec.values.assign(values, values + rows * columns);
+   rec.text = text;
+}
+
+
+//------------------------------------------------------------------------------
+// void AddFields(Entry &entry, GmatBase *obj, const std::string &prefix)
+//------------------------------------------------------------------------------
+/**
+ * Adds the writable Real and Integer fields of an object to an entry
+ *
+ * @param entry  The entry
+ * @param obj    The object with the fields
+ * @param prefix Prefix of the labels; the owned object's name and a dot
+ */
+//------------------------------------------------------------------------------
+void MissionSnapshot::AddFields(Entry &entry, GmatBase *obj,
+      const std::string &prefix)
+{
+   for (Integer id = 0; id < obj->GetParameterCount(); ++id)
+   {
+      if (obj->IsParameterReadOnly(id))
+         continue;
+
+      Gmat::ParameterType type = obj->GetParameterType(id);
+      if ((type != Gmat::REAL_TYPE) && (type != Gmat::INTEGER_TYPE))
+         continue;
+
+      Real value;
+      try
+      {
+         if (type == Gmat::REAL_TYPE)
+            value = obj->GetRealParameter(id);
+         else
+            value = obj->GetIntegerParameter(id);
+      }
+      catch (BaseException &)
+      {
+         // Fields without a value in this object are not stored
+         continue;
+      }
+
+      AddRecord(entry, (type == Gmat::REAL_TYPE ? REAL_RECORD : INTEGER_RECORD),
+                prefix + obj->GetParameterText(id), 1, 1, &value);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void AddMatrix(Entry &entry, GmatBase *obj, const std::string &label)
+//------------------------------------------------------------------------------
+/**
+ * Adds an Rmatrix field of an object to an entry
+ *
+ * @param entry The entry
+ * @param obj   The object with the field
+ * @param label The field
+ */
+//------------------------------------------------------------------------------
+void MissionSnapshot::AddMatrix(Entry &entry, GmatBase *obj,
+      const std::string &label)
+{
+   const Rmatrix &mat = obj->GetRmatrixParameter(obj->GetParameterID(label));
+   if (mat.IsSized())
+      AddRecord(entry, MATRIX_RECORD, label, mat.GetNumRows(),
+                mat.GetNumColumns(), mat.GetDataVector());
+}
+
+
+//------------------------------------------------------------------------------
+// void RestoreRecord(GmatBase *obj, const Record &rec) const
+//------------------------------------------------------------------------------
+/**
+ * Sets one stored value on an object
+ *
+ * @param obj The object
+ * @param rec The value
+ */
+//------------------------------------------------------------------------------
+void MissionSnapshot::RestoreRecord(GmatBase *obj, const Record &rec) const
+{
+   #ifdef DEBUG_SNAPSHOT
+      MessageInterface::ShowMessage("MissionSnapshot::RestoreRecord() "
+            "setting %s.%s\n", obj->GetName().c_str(), rec.label.c_str());
+   #endif
+
+   switch (rec.kind)
+   {
+      case EPOCH_RECORD:
+         {
+            GmatTime epoch;
+            epoch.SetDays((long)rec.values[0]);
+            epoch.SetSec((long)rec.values[1]);
+            epoch.SetFracSec(rec.values[2]);
+            ((SpaceObject*)obj)->SetEpochGT(epoch);
+         }
+         break;
+
+      case STATE_RECORD:
+         {
+            GmatState &state = ((SpaceObject*)obj)->GetState();
+            if (state.GetSize() != rec.columns)
+               throw CommandException("The state snapshot of \"" +
+                     obj->GetName() + "\" has a state vector of a different "
+                     "size than the object in this run");
+            for (Integer i = 0; i < rec.columns; ++i)
+               state[i] = rec.values[i];
+         }
+         break;
+
+      case REAL_RECORD:
+      case INTEGER_RECORD:
+         {
+            std::string field = rec.label;
+            GmatBase *target = obj;
+            if (rec.label.find('.') != std::string::npos)
+               target = FindTank(obj, rec.label, field);
+            Integer id = target->GetParameterID(field);
+            if (rec.kind == REAL_RECORD)
+               target->SetRealParameter(id, rec.values[0]);
+            else
+               target->SetIntegerParameter(id, (Integer)rec.values[0]);
+         }
+         break;
+
+      case MATRIX_RECORD:
+         {
+            Integer id = obj->GetParameterID(rec.label);
+            const Rmatrix &mat = obj->GetRmatrixParameter(id);
+            if ((mat.GetNumRows() != rec.rows) ||
+                (mat.GetNumColumns() != rec.columns))
+               throw CommandException("The state snapshot of \"" +
+                     obj->GetName() + "\" has a " + rec.label + " of a "
+                     "different size than the object in this run");
+            for (Integer r = 0; r < rec.rows; ++r)
+               for (Integer c = 0; c < rec.columns; ++c)
+                  obj->SetRealParameter(id, rec.values[r * rec.columns + c],
+                                        r, c);
+         }
+         break;
+
+      case COVARIANCE_RECORD:
+         {
+            Covariance *covariance = obj->GetCovariance();
+            if ((covariance == NULL) ||
+                (covariance->GetDimension() != rec.rows))
+               throw CommandException("The state snapshot of \"" +
+                     obj->GetName() + "\" has a covariance of a different "
+                     "size than the object in this run");
+            for (Integer r = 0; r < rec.rows; ++r)
+               for (Integer c = 0; c < rec.columns; ++c)
+                  (*covariance)(r, c) = rec.values[r * rec.columns + c];
+         }
+         break;
+
+      case VARIABLE_RECORD:
+         ((Parameter*)obj)->SetReal(rec.values[0]);
+         break;
+
+      case ARRAY_RECORD:
+         {
+            Rmatrix mat(rec.rows, rec.columns);
+            for (Integer r = 0; r < rec.rows; ++r)
+               for (Integer c = 0; c < rec.columns; ++c)
+                  mat(r, c) = rec.values[r * rec.columns + c];
+            ((Parameter*)obj)->SetRmatrix(mat);
+         }
+         break;
+
+      case STRING_RECORD:
+         ((Parameter*)obj)->SetString(rec.text);
+         break;
+
+      default:
+         throw CommandException("The state snapshot of \"" + obj->GetName() +
+               "\" holds a value of an unknown kind");
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// GmatBase* FindTank(GmatBase *obj, const std::string &label,
+//       std::string &field) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the tank a "<TankName>.<Field>" label refers to
+ *
+ * @param obj   The spacecraft that owns the tank
+ * @param label The label
+ * @param field Set to the field part of the label
+ *
+ * @return The tank
+ */
+//------------------------------------------------------------------------------
+GmatBase* MissionSnapshot::FindTank(GmatBase *obj, const std::string &label,
+      std::string &field) const
+{
+   std::string::size_type dot = label.find('.');
+   std::string tankName = label.substr(0, dot);
+   field = label.substr(dot + 1);
+
+   ObjectArray &tanks = obj->GetRefObjectArray(Gmat::FUEL_TANK);
+   for (UnsignedInt i = 0; i < tanks.size(); ++i)
+      if (tanks[i]->GetName() == tankName)
+         return tanks[i];
+
+   throw CommandException("The state snapshot of \"" + obj->GetName() +
+         "\" has values for the tank \"" + tankName + "\", which is not "
+         "attached to the spacecraft in this run");
+}
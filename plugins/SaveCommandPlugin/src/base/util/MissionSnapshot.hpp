@@ -0,0 +1,120 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              MissionSnapshot
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Binary snapshot of the run time state of mission objects
+ */
+//------------------------------------------------------------------------------
+
+#ifndef MissionSnapshot_hpp
+#define MissionSnapshot_hpp
+
+#include "SaveCommandDefs.hpp"
+#include "GmatBase.hpp"
+#include <vector>
+
+/**
+ * The values of mission objects at one point in a run, as stored by the
+ * SaveState command and applied by RestoreState
+ *
+ * A snapshot holds, for each object, the values a run changes; it does not
+ * hold the object configuration, which the restoring script supplies:
+ *
+ * - Spacecraft: the epoch and state vector at full precision, the STM and
+ *   A-matrix, the error covariances, the dry mass and the drag and SRP
+ *   coefficients and areas, and the writable Real and Integer fields of
+ *   each tank.
+ * - Variables, Arrays and Strings: their values.
+ * - Other objects: their writable Real and Integer fields.
+ *
+ * Values are stored in the native byte order and are restored to objects
+ * with the same name and type.
+ */
+class SAVECOMMAND_API MissionSnapshot
+{
+public:
+   MissionSnapshot();
+   ~MissionSnapshot();
+   MissionSnapshot(const MissionSnapshot &ms);
+   MissionSnapshot&     operator=(const MissionSnapshot &ms);
+
+   void                 Clear();
+   void                 Capture(GmatBase *obj);
+   bool                 Restore(GmatBase *obj) const;
+   StringArray          GetObjectNames() const;
+
+   void                 Write(const std::string &fileName) const;
+   void                 Read(const std::string &fileName);
+
+private:
+   /// Kinds of stored values
+   enum RecordKind
+   {
+      EPOCH_RECORD = 1,
+      STATE_RECORD,
+      REAL_RECORD,
+      INTEGER_RECORD,
+      MATRIX_RECORD,
+      COVARIANCE_RECORD,
+      VARIABLE_RECORD,
+      ARRAY_RECORD,
+      STRING_RECORD
+   };
+
+   /// One stored value; tank fields use the label "<TankName>.<Field>"
+   struct Record
+   {
+      Integer        kind;
+      std::string    label;
+      Integer        rows;
+      Integer        columns;
+      RealArray      values;
+      std::string    text;
+   };
+
+   /// The stored values of one object
+   struct Entry
+   {
+      std::string          name;
+      std::string          typeName;
+      std::vector<Record>  records;
+   };
+
+   /// Objects in the snapshot, in capture order
+   std::vector<Entry>   entries;
+
+   void                 AddRecord(Entry &entry, Integer kind,
+                                  const std::string &label, Integer rows,
+                                  Integer columns, const Real *values,
+                                  const std::string &text = "");
+   void                 AddFields(Entry &entry, GmatBase *obj,
+                                  const std::string &prefix);
+   void                 AddMatrix(Entry &entry, GmatBase *obj,
+                                  const std::string &label);
+   void                 RestoreRecord(GmatBase *obj, const Record &rec) const;
+   GmatBase*            FindTank(GmatBase *obj, const std::string &label,
+                                 std::string &field) const;
+
+   static const char    MAGIC[16];
+   static const Integer VERSION;
+   static const Integer BYTE_ORDER_MARK;
+};
+
+#endif // MissionSnapshot_hpp
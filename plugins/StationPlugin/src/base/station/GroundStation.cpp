@@ -303,11 +303,12 @@ GmatBase* GroundStation::Clone() const
 //------------------------------------------------------------------------------
 Integer GroundStation::GetParameterID(const std::string & str) const
 {
-   for (Integer i = BodyFixedPointParamCount; i < GroundStationParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BodyFixedPointParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, BodyFixedPointParamCount,
+               GroundStationParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GroundstationInterface::GetParameterID(str);
 }
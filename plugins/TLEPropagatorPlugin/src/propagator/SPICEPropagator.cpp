@@ -61,6 +61,7 @@ extern "C"
    #include "SpiceUsr.h"    // for CSPICE routines
    #include "SpiceZfc.h"    // for spke10
 }
+#include "SpiceInterface.hpp"   // for the CSPICE access lock
 
 const std::string
 SPICEPropagator::PARAMETER_TEXT[SPICEPropParamCount - PropagatorParamCount] =
@@ -175,6 +176,8 @@ SPICEPropagator::PropObject& SPICEPropagator::PropObject::operator=(const PropOb
  */
 bool SPICEPropagator::PropObject::Initialize(const GmatEpoch toTime, double *params)
 {
+   SpiceInterface::AccessLock spiceLock;
+
    bool retval = false;
 
    if (theSat)
@@ -459,12 +462,12 @@ Integer SPICEPropagator::GetParameterID(const std::string &str) const
       return retval;
    }
 
-   for (Integer i = PropagatorParamCount;
-         i < SPICEPropParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - PropagatorParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, PropagatorParamCount,
+               SPICEPropParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Propagator::GetParameterID(str);
 }
@@ -893,6 +896,8 @@ void SPICEPropagator::SetPropStateManager(PropagationStateManager *sm)
 
 bool SPICEPropagator::Initialize()
 {
+   SpiceInterface::AccessLock spiceLock;
+
    bool retval = false;
    cconverter.Initialize();
 
@@ -1053,6 +1058,8 @@ bool SPICEPropagator::Step(Real dt)
  */
 bool SPICEPropagator::Step()
 {
+   SpiceInterface::AccessLock spiceLock;
+
    bool retval = false;
 //   static Real timeFromEpoch = 0.0;  // With this, the state does advance
    timeFromEpoch += stepSize;
@@ -1246,6 +1253,8 @@ void SPICEPropagator::BufferState()
 //------------------------------------------------------------------------------
 void SPICEPropagator::UpdateState()
 {
+   SpiceInterface::AccessLock spiceLock;
+
    #ifdef DEBUG_EXE
       MessageInterface::ShowMessage("Updating state to epoch %.12lf\n",
             currentEpoch);
@@ -0,0 +1,476 @@
+//------------------------------------------------------------------------------
+//                         TLECatalog.cpp
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ *  Implementation code for the TLECatalog class.
+ */
+
+
+#include "TLECatalog.hpp"
+
+#include <cmath>
+#include <cstring>
+#include "MessageInterface.hpp"
+#include "PropagatorException.hpp"
+#include "TLEReader.hpp"
+#include "TimeSystemConverter.hpp"
+#include "GmatConstants.hpp"
+#include "EventSearch.hpp"
+#include "SolarSystem.hpp"
+#include "StringUtil.hpp"
+
+//#define DEBUG_TLE_CATALOG
+
+
+//------------------------------------------------------------------------------
+// TLECatalog()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+TLECatalog::TLECatalog() :
+   threadCount    (0),
+   outputCS       (NULL),
+   todCS          (NULL),
+   modCS          (NULL)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~TLECatalog()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+TLECatalog::~TLECatalog()
+{
+   SetCoordinateSystem(NULL);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer LoadCatalog(const std::string &tleFile)
+//------------------------------------------------------------------------------
+/**
+ * Adds the element sets of a TLE file to the catalog
+ *
+ * Element sets that SGP4 cannot initialize are reported and skipped.
+ *
+ * @param tleFile The TLE file
+ *
+ * @return The number of element sets added
+ */
+//------------------------------------------------------------------------------
+Integer TLECatalog::LoadCatalog(const std::string &tleFile)
+{
+   TLEReader reader(tleFile);
+   std::vector<TLEData> sets;
+   reader.GetAllTLEData(sets);
+
+   if (sets.empty())
+      throw PropagatorException("No two-line element sets were found in the "
+            "TLE file \"" + tleFile + "\"");
+
+   records.reserve(records.size() + sets.size());
+   Integer added = 0;
+   for (UnsignedInt i = 0; i < sets.size(); ++i)
+   {
+      if (AddElementSet(sets[i]))
+         ++added;
+      else
+         MessageInterface::ShowMessage("TLE WARNING: The element set \"%s\" "
+               "in the TLE file \"%s\" could not be initialized and was "
+               "skipped\n", sets[i].tleLines[1].substr(0, 24).c_str(),
+               tleFile.c_str());
+   }
+
+   #ifdef DEBUG_TLE_CATALOG
+      MessageInterface::ShowMessage("TLECatalog: %d of %d element sets loaded "
+            "from %s\n", added, (Integer)sets.size(), tleFile.c_str());
+   #endif
+
+   return added;
+}
+
+
+//------------------------------------------------------------------------------
+// bool AddElementSet(const TLEData &tle)
+//------------------------------------------------------------------------------
+/**
+ * Adds an element set to the catalog
+ *
+ * The set is initialized for SGP4 with the WGS-72 constants and the AFSPC
+ * operation mode.
+ *
+ * @param tle The element set; tleLines[1] and tleLines[2] hold the data lines
+ *
+ * @return true if the set was added, false if SGP4 rejected it
+ */
+//------------------------------------------------------------------------------
+bool TLECatalog::AddElementSet(const TLEData &tle)
+{
+   if (tle.tleLines[1].size() < 69 || tle.tleLines[2].size() < 69)
+      return false;
+
+   // twoline2rv edits the lines in place
+   char line1[130], line2[130];
+   memset(line1, 0, sizeof(line1));
+   memset(line2, 0, sizeof(line2));
+   strncpy(line1, tle.tleLines[1].c_str(), 129);
+   strncpy(line2, tle.tleLines[2].c_str(), 129);
+
+   elsetrec record;
+   memset(&record, 0, sizeof(record));
+   Real startMfe, stopMfe, deltaMin;
+   SGP4Funcs::twoline2rv(line1, line2, 'c', 'e', 'a', wgs72, startMfe,
+         stopMfe, deltaMin, record);
+   if (record.error != 0)
+      return false;
+
+   Real utcEpoch = record.jdsatepoch - GmatTimeConstants::JD_JAN_5_1941 +
+         record.jdsatepochF;
+   TimeSystemConverter *tcv = TimeSystemConverter::Instance();
+
+   records.push_back(record);
+   names.push_back(GmatStringUtil::Trim(tle.tleLines[0]));
+   catalogNumbers.push_back((Integer)record.satnum);
+   utcEpochs.push_back(utcEpoch);
+   a1Epochs.push_back(tcv->Convert(utcEpoch, TimeSystemConverter::UTCMJD,
+         TimeSystemConverter::A1MJD));
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all of the objects from the catalog
+ */
+//------------------------------------------------------------------------------
+void TLECatalog::Clear()
+{
+   records.clear();
+   names.clear();
+   catalogNumbers.clear();
+   utcEpochs.clear();
+   a1Epochs.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetObjectCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of objects in the catalog
+ */
+//------------------------------------------------------------------------------
+Integer TLECatalog::GetObjectCount() const
+{
+   return (Integer)records.size();
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetObjectName(Integer index) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the name of an object, from its TLE name line
+ *
+ * @param index The index of the object
+ *
+ * @return The name; empty for element sets without a name line
+ */
+//------------------------------------------------------------------------------
+const std::string& TLECatalog::GetObjectName(Integer index) const
+{
+   return names.at(index);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetCatalogNumber(Integer index) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the NORAD catalog number of an object
+ *
+ * @param index The index of the object
+ *
+ * @return The catalog number
+ */
+//------------------------------------------------------------------------------
+Integer TLECatalog::GetCatalogNumber(Integer index) const
+{
+   return catalogNumbers.at(index);
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetEpoch(Integer index) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the epoch of an object's element set
+ *
+ * @param index The index of the object
+ *
+ * @return The epoch, as an A.1 modified Julian date
+ */
+//------------------------------------------------------------------------------
+Real TLECatalog::GetEpoch(Integer index) const
+{
+   return a1Epochs.at(index);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetThreadCount(Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of threads Propagate() uses
+ *
+ * @param count The number of threads; 0 uses one per hardware thread
+ */
+//------------------------------------------------------------------------------
+void TLECatalog::SetThreadCount(Integer count)
+{
+   threadCount = (count < 0 ? 0 : count);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetCoordinateSystem(CoordinateSystem *cs)
+//------------------------------------------------------------------------------
+/**
+ * Sets the coordinate system of the states Propagate() returns
+ *
+ * @param cs The coordinate system, which must have its solar system set; NULL
+ *           returns TEME states
+ */
+//------------------------------------------------------------------------------
+void TLECatalog::SetCoordinateSystem(CoordinateSystem *cs)
+{
+   if (todCS != NULL)
+   {
+      delete todCS;
+      todCS = NULL;
+   }
+   if (modCS != NULL)
+   {
+      delete modCS;
+      modCS = NULL;
+   }
+   outputCS = cs;
+
+   if (outputCS != NULL)
+   {
+      SolarSystem *solarSystem = outputCS->GetSolarSystem();
+      SpacePoint *earth = (solarSystem == NULL ? NULL :
+            solarSystem->GetBody(GmatSolarSystemDefaults::EARTH_NAME));
+      if (earth == NULL)
+      {
+         outputCS = NULL;
+         throw PropagatorException("The TLE catalog cannot convert states to "
+               "the coordinate system \"" + cs->GetName() + "\" because its "
+               "solar system is not set");
+      }
+
+      todCS = CoordinateSystem::CreateLocalCoordinateSystem("TLECatalogTOD",
+            "TODEq", earth, NULL, NULL, earth, solarSystem);
+      modCS = CoordinateSystem::CreateLocalCoordinateSystem("TLECatalogMOD",
+            "MODEq", earth, NULL, NULL, earth, solarSystem);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void Propagate(const RealArray &epochs, RealArray &states,
+//                IntegerArray *errors)
+//------------------------------------------------------------------------------
+/**
+ * Propagates every object in the catalog to a list of epochs
+ *
+ * The states are stored epoch by epoch, with the six elements of each object
+ * in catalog order: the state of object i at epoch k starts at element
+ * 6 * (k * GetObjectCount() + i).  Positions are in km and velocities in
+ * km/s.  A state SGP4 cannot compute (a decayed orbit, for example) is left
+ * at zero, and its SGP4 error code is reported in errors.
+ *
+ * @param epochs The epochs, as A.1 modified Julian dates
+ * @param states The states
+ * @param errors When not NULL, the SGP4 error codes, stored like the states
+ *               with one entry per object and epoch; 0 for success
+ */
+//------------------------------------------------------------------------------
+void TLECatalog::Propagate(const RealArray &epochs, RealArray &states,
+      IntegerArray *errors)
+{
+   Integer count = (Integer)records.size();
+   Integer epochCount = (Integer)epochs.size();
+
+   states.assign((size_t)epochCount * count * 6, 0.0);
+   if (errors != NULL)
+      errors->assign((size_t)epochCount * count, 0);
+   if ((count == 0) || (epochCount == 0))
+      return;
+
+   // Epoch terms shared by all of the objects: the UTC epochs SGP4 times are
+   // measured in, and the TEME to output transformations
+   TimeSystemConverter *tcv = TimeSystemConverter::Instance();
+   RealArray utcTimes(epochCount);
+   for (Integer k = 0; k < epochCount; ++k)
+      utcTimes[k] = tcv->Convert(epochs[k], TimeSystemConverter::A1MJD,
+            TimeSystemConverter::UTCMJD);
+
+   RealArray transforms;
+   if (outputCS != NULL)
+   {
+      // Rotation, rotation rate and origin offset for each epoch
+      transforms.resize(epochCount * 24);
+      for (Integer k = 0; k < epochCount; ++k)
+      {
+         Real *xf = &transforms[k * 24];
+         GetTemeTransformation(epochs[k], xf, xf + 9, xf + 18);
+      }
+   }
+
+   std::vector<EventSearch::Task> tasks;
+   for (Integer first = 0; first < count; first += BLOCK_SIZE)
+   {
+      Integer end = (first + BLOCK_SIZE < count ? first + BLOCK_SIZE : count);
+      tasks.push_back([this, first, end, count, epochCount, &utcTimes,
+                       &transforms, &states, errors]()
+      {
+         Real r[3], v[3];
+         for (Integer i = first; i < end; ++i)
+         {
+            // sgp4 updates the deep space integrator state in the record,
+            // so each run starts from the record as initialized
+            elsetrec record = records[i];
+            for (Integer k = 0; k < epochCount; ++k)
+            {
+               Real tsince = (utcTimes[k] - utcEpochs[i]) *
+                     GmatTimeConstants::SECS_PER_DAY /
+                     GmatTimeConstants::SECS_PER_MINUTE;
+               size_t index = (size_t)k * count + i;
+
+               if (!SGP4Funcs::sgp4(record, tsince, r, v) ||
+                   (record.error != 0))
+               {
+                  if (errors != NULL)
+                     (*errors)[index] = (record.error != 0 ? record.error : -1);
+                  continue;
+               }
+
+               Real *state = &states[index * 6];
+               if (transforms.empty())
+               {
+                  state[0] = r[0];
+                  state[1] = r[1];
+                  state[2] = r[2];
+                  state[3] = v[0];
+                  state[4] = v[1];
+                  state[5] = v[2];
+               }
+               else
+               {
+                  const Real *rot = &transforms[k * 24];
+                  const Real *rotDot = rot + 9;
+                  const Real *offset = rot + 18;
+                  for (Integer j = 0; j < 3; ++j)
+                  {
+                     const Real *row = rot + 3 * j;
+                     const Real *rowDot = rotDot + 3 * j;
+                     state[j] = row[0] * r[0] + row[1] * r[1] +
+                           row[2] * r[2] + offset[j];
+                     state[j+3] = row[0] * v[0] + row[1] * v[1] +
+                           row[2] * v[2] + rowDot[0] * r[0] +
+                           rowDot[1] * r[1] + rowDot[2] * r[2] + offset[j+3];
+                  }
+               }
+            }
+         }
+      });
+   }
+
+   EventSearch::RunTasks(tasks, threadCount);
+}
+
+
+//------------------------------------------------------------------------------
+// void GetTemeTransformation(Real a1Epoch, Real *rotation, Real *rotationDot,
+//                            Real *offset)
+//------------------------------------------------------------------------------
+/**
+ * Builds the TEME to output coordinate system transformation at an epoch
+ *
+ * TEME shares the true equator of date, with its x axis along the mean
+ * equinox, so it is the true of date system turned by the equation of the
+ * equinoxes: r_TOD = R3(-eqeq) r_TEME.  The equation of the equinoxes is
+ * dPsi cos(epsBar), the x-y entry of the true of date to mean of date
+ * rotation to first order in the (arcsecond sized) nutation angles.
+ *
+ * The output state is then rotation * r + offset for the position and
+ * rotation * v + rotationDot * r + offset for the velocity.
+ *
+ * @param a1Epoch     The epoch, as an A.1 modified Julian date
+ * @param rotation    The 3x3 rotation, row major
+ * @param rotationDot The 3x3 rotation rate, row major
+ * @param offset      The output state of the TEME origin
+ */
+//------------------------------------------------------------------------------
+void TLECatalog::GetTemeTransformation(Real a1Epoch, Real *rotation,
+      Real *rotationDot, Real *offset)
+{
+   Real zero[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+   Real mod[6];
+
+   converter.Convert(a1Epoch, zero, todCS, mod, modCS);
+   Rmatrix33 todToMod = converter.GetLastRotationMatrix();
+   Real eqeq = -todToMod(1, 0);
+
+   converter.Convert(a1Epoch, zero, todCS, offset, outputCS);
+   Rmatrix33 todToOut = converter.GetLastRotationMatrix();
+   Rmatrix33 todToOutDot = converter.GetLastRotationDotMatrix();
+
+   Real c = std::cos(eqeq), s = std::sin(eqeq);
+   Rmatrix33 temeToTod(c,  -s,   0.0,
+                       s,   c,   0.0,
+                       0.0, 0.0, 1.0);
+
+   Rmatrix33 rot = todToOut * temeToTod;
+   Rmatrix33 rotDot = todToOutDot * temeToTod;
+   for (Integer i = 0; i < 3; ++i)
+      for (Integer j = 0; j < 3; ++j)
+      {
+         rotation[3 * i + j] = rot(i, j);
+         rotationDot[3 * i + j] = rotDot(i, j);
+      }
+
+   #ifdef DEBUG_TLE_CATALOG
+      MessageInterface::ShowMessage("TLECatalog: epoch %.12lf, equation of "
+            "the equinoxes %.6lf arcsec\n", a1Epoch,
+            eqeq * GmatMathConstants::DEG_PER_RAD * 3600.0);
+   #endif
+}
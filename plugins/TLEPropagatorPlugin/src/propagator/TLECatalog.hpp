@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+//                         TLECatalog.hpp
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ *  Declaration code for the TLECatalog class.
+ */
+
+
+#ifndef TLECatalog_hpp
+#define TLECatalog_hpp
+
+#include "tleprop_defs.hpp"
+#include "CoordinateSystem.hpp"
+#include "CoordinateConverter.hpp"
+#include "TLEData.hpp"
+#include "SGP4.h"
+#include <vector>
+
+/**
+   SGP4 propagation of a whole TLE catalog to a common list of epochs
+
+   The element sets of a TLE file are read with TLEReader and initialized once
+   into SGP4 records held in arrays, one entry per object, alongside the
+   epoch, name and catalog number arrays.  No Spacecraft or Propagator objects
+   are built, so a 30,000 object catalog costs a few tens of megabytes.
+
+   Propagate() evaluates every object at every epoch of a list.  The objects
+   are split into blocks run on a set of threads; each block evaluates all of
+   the epochs for its objects, so the SGP4 record of an object stays in cache
+   while it is used.  The SGP4 evaluation is Vallado's 2006 code, which keeps
+   all of its state in the per object records, so the blocks run safely in
+   parallel (the CSPICE routines used by SPICEPropagator are not reentrant).
+
+   The states are returned in the TEME frame the SGP4 theory produces, or in a
+   GMAT coordinate system set with SetCoordinateSystem().  For the latter the
+   TEME to output transformation is built once per epoch, through the true of
+   date system and the equation of the equinoxes, and applied to all of the
+   objects.
+ */
+class TLE_PROPAGATOR_API TLECatalog
+{
+public:
+   TLECatalog();
+   ~TLECatalog();
+
+   Integer              LoadCatalog(const std::string &tleFile);
+   bool                 AddElementSet(const TLEData &tle);
+   void                 Clear();
+
+   Integer              GetObjectCount() const;
+   const std::string&   GetObjectName(Integer index) const;
+   Integer              GetCatalogNumber(Integer index) const;
+   Real                 GetEpoch(Integer index) const;
+
+   void                 SetThreadCount(Integer count);
+   void                 SetCoordinateSystem(CoordinateSystem *cs);
+
+   void                 Propagate(const RealArray &epochs, RealArray &states,
+                                  IntegerArray *errors = NULL);
+
+   /// Number of objects propagated by each task of Propagate()
+   static const Integer BLOCK_SIZE = 256;
+
+private:
+   /// The SGP4 records of the objects
+   std::vector<elsetrec>
+                        records;
+   /// Object names, from the TLE name lines
+   StringArray          names;
+   /// NORAD catalog numbers
+   IntegerArray         catalogNumbers;
+   /// UTC epochs of the element sets, as modified Julian dates
+   RealArray            utcEpochs;
+   /// A.1 epochs of the element sets, as modified Julian dates
+   RealArray            a1Epochs;
+
+   /// Number of threads used by Propagate(); 0 uses one per hardware thread
+   Integer              threadCount;
+   /// Coordinate system of the output states; NULL for TEME
+   CoordinateSystem     *outputCS;
+   /// Earth true of date and mean of date systems used to reach outputCS
+   CoordinateSystem     *todCS;
+   CoordinateSystem     *modCS;
+   /// Converter for the TEME transformations
+   CoordinateConverter  converter;
+
+   TLECatalog(const TLECatalog &cat);
+   TLECatalog&          operator=(const TLECatalog &cat);
+
+   void                 GetTemeTransformation(Real a1Epoch, Real *rotation,
+                                              Real *rotationDot, Real *offset);
+};
+
+#endif // TLECatalog_hpp
@@ -20,8 +20,10 @@
 //   -Allow user to use TLE NORAD ID in addition to spacecraft name in Spacecraft.Id
 
 #include "TLEReader.hpp"
+#include <algorithm>
 #include <fstream>
 #include <cstring>
+#include <cstdlib>
 #include <sstream>
 
 #include <iostream>
@@ -30,6 +32,12 @@ extern "C"
 {
    #include "SpiceUsr.h"    // for CSPICE routines
 }
+#include "SpiceInterface.hpp"   // for the CSPICE access lock
+
+
+std::map<std::string, std::shared_ptr<const TLEReader::TLEIndex> >
+      TLEReader::indexes;
+std::mutex TLEReader::indexMutex;
 
 
 TLEReader::TLEReader(const std::string &tleFile) :
@@ -43,105 +51,170 @@ TLEReader::~TLEReader()
 }
 
 
+/**
+ * Finds the element set of a satellite
+ *
+ * The first line of the file that starts with the identifier is taken as the
+ * name line of the set, or, if the identifier starts at the third character,
+ * as its first data line (this matches a catalog number).  The identifier
+ * "SatId" selects the first set in the file.
+ *
+ * @param forSatellite The satellite name or catalog number
+ *
+ * @return The element set; the data lines are empty if it was not found
+ */
 TLEData TLEReader::GetTLEData(const std::string &forSatellite)
 {
    TLEData theData;
-   std::string line;
 
-   if (filename != "")
+   if (filename == "")
+      return theData;
+
+   const TLEIndex &idx = GetIndex();
+   int at = FindFirstMatch(idx, forSatellite);
+   if (at < 0)
+      return theData;
+
+   const std::vector<std::string> &lines = idx.lines;
+   int count = (int)lines.size();
+   std::string line = lines[at];
+   std::string prev = (at > 0 ? lines[at - 1] : "");
+
+   if (line.find(forSatellite) == 0)
    {
-      std::string prev = "";
-      std::ifstream infile(filename);
-      while (std::getline(infile, line))
+      theData.tleLines[0] = line;
+      line = (at + 1 < count ? lines[at + 1] : "");
+      if (line.find('\r') != std::string::npos)
+         line = line.substr(0, line.find('\r'));
+      theData.tleLines[1] = line;
+      line = (at + 2 < count ? lines[at + 2] : "");
+      if (line.find('\r') != std::string::npos)
+         line = line.substr(0, line.find('\r'));
+      theData.tleLines[2] = line;
+   }
+   else
+   {
+      if (prev.length() > 65)
+         prev = "GMAT TLE Sat";
+      else if (prev.find('\r') != std::string::npos)
+         prev = prev.substr(0, prev.find('\r'));
+      theData.tleLines[0] = prev;
+      if (line.find('\r') != std::string::npos)
+         line = line.substr(0, line.find('\r'));
+
+      std::string line2 = (at + 1 < count ? lines[at + 1] : "");
+      bool isSatId = (line.find(forSatellite) != 2);
+      // For "SatId" the set is used only if the next line is its line 2
+      if (!isSatId || (line2.find("2 ") == 0 && line2.size() > 68 &&
+                       line2.size() < 72))
       {
-         if (line.find(forSatellite) == 0)
-         {
-            theData.tleLines[0] = line;
-            std::getline(infile, line);
-            if (line.find('\r'))
-            {
-               int end = line.find('\r');
-               line = line.substr(0, end);
-            }
-            theData.tleLines[1] = line;
-            std::getline(infile, line);
-            if (line.find('\r'))
-            {
-               int end = line.find('\r');
-               line = line.substr(0, end);
-            }
-            theData.tleLines[2] = line;
+         if (line2.find('\r') != std::string::npos)
+            line2 = line2.substr(0, line2.find('\r'));
+         theData.tleLines[1] = line;
+         theData.tleLines[2] = line2;
+      }
+   }
+
+   return theData;
+}
+
+
+/**
+ * Finds all of the element sets of a satellite, in epoch order
+ *
+ * The satellite is found as in GetTLEData(); the history is every set in the
+ * file with the catalog number of that set, so files that hold several epochs
+ * of an object can be read in one call.
+ *
+ * @param forSatellite The satellite name or catalog number
+ * @param sets         The element sets, in increasing epoch order
+ */
+void TLEReader::GetTLEHistory(const std::string &forSatellite,
+      std::vector<TLEData> &sets)
+{
+   sets.clear();
+
+   TLEData first = GetTLEData(forSatellite);
+   if (first.tleLines[1] == "")
+      return;
+
+   const TLEIndex &idx = GetIndex();
+   std::map<std::string, std::vector<int> >::const_iterator entry =
+         idx.setsByNumber.find(CatalogNumber(first.tleLines[1]));
+   if (entry == idx.setsByNumber.end())
+   {
+      sets.push_back(first);
+      return;
+   }
+
+   const std::vector<std::string> &lines = idx.lines;
+   for (UnsignedInt i = 0; i < entry->second.size(); ++i)
+   {
+      int at = entry->second[i];
+      TLEData theData;
+      theData.tleLines[0] = first.tleLines[0];
+      theData.tleLines[1] = lines[at];
+      theData.tleLines[2] = lines[at + 1];
+      for (int j = 1; j < 3; ++j)
+         if (theData.tleLines[j].find('\r') != std::string::npos)
+            theData.tleLines[j] = theData.tleLines[j].substr(0,
+                  theData.tleLines[j].find('\r'));
+      sets.push_back(theData);
+   }
+}
+
+
+/**
+ * Reads every element set in the file
+ *
+ * Element sets are the "1 " and "2 " data line pairs; the line before a pair
+ * is taken as its name line unless it is itself a data line.
+ *
+ * @param sets The element sets, in file order
+ */
+void TLEReader::GetAllTLEData(std::vector<TLEData> &sets)
+{
+   sets.clear();
+   if (filename == "")
+      return;
+
+   const std::vector<std::string> &lines = GetIndex().lines;
+   std::string prev = "", line;
+   for (UnsignedInt i = 0; i < lines.size(); ++i)
+   {
+      line = lines[i];
+      if (line.find('\r') != std::string::npos)
+         line = line.substr(0, line.find('\r'));
 
+      if (line.find("1 ") == 0 && line.size() >= 69)
+      {
+         if (++i == lines.size())
             break;
-         }
-         else if (line.find(forSatellite) == 2)
+         std::string line2 = lines[i];
+         if (line2.find('\r') != std::string::npos)
+            line2 = line2.substr(0, line2.find('\r'));
+
+         if (line2.find("2 ") == 0 && line2.size() >= 69)
          {
-            if (prev.length() > 65)
-            {
-               prev = "GMAT TLE Sat";
-            }
-            else if (prev.find('\r'))
-            {
-               int end = prev.find('\r');
-               prev = prev.substr(0, end);
-            }
-            theData.tleLines[0] = prev;
-            if (line.find('\r'))
-            {
-               int end = line.find('\r');
-               line = line.substr(0, end);
-            }
+            TLEData theData;
+            if (prev.find("1 ") != 0 && prev.find("2 ") != 0)
+               theData.tleLines[0] = prev;
             theData.tleLines[1] = line;
-            std::getline(infile, line);
-            if (line.find('\r'))
-            {
-               int end = line.find('\r');
-               line = line.substr(0, end);
-            }
-            theData.tleLines[2] = line;
-            break;
+            theData.tleLines[2] = line2;
+            sets.push_back(theData);
          }
-         else if (forSatellite =="SatId" && line.find("1 ") == 0 && line.size() > 68 && line.size() < 72)
-         {
-            if (prev.length() > 65)
-            {
-               prev = "GMAT TLE Sat";
-            }
-            else if (prev.find('\r'))
-            {
-               int end = prev.find('\r');
-               prev = prev.substr(0, end);
-            }
-            theData.tleLines[0] = prev;
-            if (line.find('\r'))
-            {
-               int end = line.find('\r');
-               line = line.substr(0, end);
-            }
-            prev = line;
-            std::getline(infile, line);
-            if (line.find("2 ") == 0 && line.size() > 68 && line.size() < 72)
-            {
-               if (line.find('\r'))
-               {
-                  int end = line.find('\r');
-                  line = line.substr(0, end);
-               }
-               theData.tleLines[1] = prev;
-               theData.tleLines[2] = line;
-            }
-            break;
-         }
-         prev = line;
+         prev = line2;
+         continue;
       }
+      prev = line;
    }
-
-   return theData;
 }
 
 
 void TLEReader::ParseForSpice(TLEData &theData)
 {
+   SpiceInterface::AccessLock spiceLock;
+
    int linelen = theData.tleLines[1].length() + 1;
    char lines[180];
    strcpy(lines, theData.tleLines[1].c_str());
@@ -149,3 +222,191 @@ void TLEReader::ParseForSpice(TLEData &theData)
 
    getelm_c(2000, linelen, lines, &(theData.secFromJ2k), theData.elements);
 }
+
+
+/**
+ * Returns the index of the file, loading it on first use
+ *
+ * @return The index
+ */
+const TLEReader::TLEIndex& TLEReader::GetIndex()
+{
+   if (!index)
+      index = LoadIndex(filename);
+   return *index;
+}
+
+
+/**
+ * Finds the first line of the file that identifies a satellite
+ *
+ * This is the line a line by line scan of the file would stop at: the first
+ * line that starts with the identifier, or that has it first at the third
+ * character, or, for "SatId", the first line 1 of an element set.  The
+ * candidates come from the ordered indexes, so only the lines that start
+ * with the identifier are examined.
+ *
+ * @param idx          The index of the file
+ * @param forSatellite The satellite name or catalog number
+ *
+ * @return The line number, or -1 if no line identifies the satellite
+ */
+int TLEReader::FindFirstMatch(const TLEIndex &idx,
+      const std::string &forSatellite)
+{
+   int found = -1;
+
+   std::map<std::string, int>::const_iterator start =
+         idx.byStart.lower_bound(forSatellite);
+   for (; start != idx.byStart.end() &&
+          start->first.compare(0, forSatellite.size(), forSatellite) == 0;
+        ++start)
+   {
+      if (found < 0 || start->second < found)
+         found = start->second;
+   }
+
+   std::map<std::string, std::vector<int> >::const_iterator offset =
+         idx.byOffset.lower_bound(forSatellite);
+   for (; offset != idx.byOffset.end() &&
+          offset->first.compare(0, forSatellite.size(), forSatellite) == 0;
+        ++offset)
+   {
+      for (UnsignedInt i = 0; i < offset->second.size(); ++i)
+      {
+         int at = offset->second[i];
+         if (found >= 0 && at >= found)
+            break;
+         if (idx.lines[at].find(forSatellite) == 2)
+         {
+            found = at;
+            break;
+         }
+      }
+   }
+
+   if (forSatellite == "SatId" && idx.firstDataLine >= 0 &&
+       (found < 0 || idx.firstDataLine < found))
+      found = idx.firstDataLine;
+
+   return found;
+}
+
+
+/**
+ * Reads and indexes a TLE file, or returns the index shared in the process
+ *
+ * @param tleFile The TLE file
+ *
+ * @return The index; its line list is empty if the file cannot be read
+ */
+std::shared_ptr<const TLEReader::TLEIndex> TLEReader::LoadIndex(
+      const std::string &tleFile)
+{
+   StringArray files(1, tleFile);
+   std::shared_ptr<const DataFileCache> source =
+         DataFileCache::Find(files, "TLE");
+
+   std::lock_guard<std::mutex> lock(indexMutex);
+   std::map<std::string, std::shared_ptr<const TLEIndex> >::iterator known =
+         indexes.find(tleFile);
+   if (source && known != indexes.end() && known->second->source == source)
+      return known->second;
+
+   std::shared_ptr<TLEIndex> idx(new TLEIndex);
+   idx->firstDataLine = -1;
+   std::vector<std::string> &lines = idx->lines;
+
+   if (source)
+   {
+      // Lines are stored newline terminated
+      std::string text = source->GetText("lines");
+      std::string::size_type from = 0, to;
+      while ((to = text.find('\n', from)) != std::string::npos)
+      {
+         lines.push_back(text.substr(from, to - from));
+         from = to + 1;
+      }
+   }
+   else
+   {
+      std::ifstream infile(tleFile);
+      std::string line, text;
+      while (std::getline(infile, line))
+      {
+         lines.push_back(line);
+         text += line;
+         text += '\n';
+      }
+
+      DataFileCache *entry = new DataFileCache;
+      entry->SetText("lines", text);
+      source = DataFileCache::Share(files, "TLE", entry);
+   }
+   idx->source = source;
+
+   std::map<std::string, std::vector<std::pair<double, int> > > sets;
+   for (int i = 0; i < (int)lines.size(); ++i)
+   {
+      const std::string &line = lines[i];
+      idx->byStart.insert(std::make_pair(line, i));
+      if (line.size() > 2)
+         idx->byOffset[line.substr(2)].push_back(i);
+
+      if (line.find("1 ") == 0 && line.size() > 68)
+      {
+         if (idx->firstDataLine < 0 && line.size() < 72)
+            idx->firstDataLine = i;
+         if (i + 1 < (int)lines.size() && lines[i + 1].find("2 ") == 0 &&
+             lines[i + 1].size() > 68)
+            sets[CatalogNumber(line)].push_back(
+                  std::make_pair(ElementSetEpoch(line), i));
+      }
+   }
+
+   for (std::map<std::string, std::vector<std::pair<double, int> > >::iterator
+        i = sets.begin(); i != sets.end(); ++i)
+   {
+      std::stable_sort(i->second.begin(), i->second.end(),
+            [](const std::pair<double, int> &a, const std::pair<double, int> &b)
+            { return a.first < b.first; });
+      std::vector<int> &ordered = idx->setsByNumber[i->first];
+      for (UnsignedInt j = 0; j < i->second.size(); ++j)
+         ordered.push_back(i->second[j].second);
+   }
+
+   indexes[tleFile] = idx;
+   return idx;
+}
+
+
+/**
+ * Returns the catalog number field of a line 1, without blanks
+ *
+ * @param line1 Line 1 of an element set
+ *
+ * @return The catalog number
+ */
+std::string TLEReader::CatalogNumber(const std::string &line1)
+{
+   std::string number = (line1.size() > 7 ? line1.substr(2, 5) : "");
+   std::string::size_type first = number.find_first_not_of(' ');
+   if (first == std::string::npos)
+      return "";
+   return number.substr(first, number.find_last_not_of(' ') - first + 1);
+}
+
+
+/**
+ * Returns the epoch of a line 1 as a sortable number, year * 1000 + day
+ *
+ * @param line1 Line 1 of an element set
+ *
+ * @return The epoch
+ */
+double TLEReader::ElementSetEpoch(const std::string &line1)
+{
+   int year = atoi(line1.substr(18, 2).c_str());
+   year += (year < 57 ? 2000 : 1900);
+   return year * 1000.0 + atof(line1.substr(20, 12).c_str());
+}
@@ -20,8 +20,23 @@
 #define TLEReader_hpp
 
 #include "TLEData.hpp"
+#include "DataFileCache.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
+/**
+ * Reader for the element sets of a TLE file
+ *
+ * The lines of a file are read once and indexed; the index is shared by every
+ * reader of the file in the process (the SGP4 and SPICE propagators of each
+ * spacecraft, and TLECatalog), so loading many spacecraft from one large
+ * catalog reads the file a single time.  The lines are also kept in the shared
+ * DataFileCache, which writes them to a binary cache file for later runs when
+ * the startup file sets DATA_CACHE_PATH.  An edited file is read again.
+ */
 class TLEReader
 {
 public:
@@ -29,10 +44,55 @@ public:
    ~TLEReader();
 
    TLEData GetTLEData(const std::string &forSatellite);
+   void    GetTLEHistory(const std::string &forSatellite,
+                         std::vector<TLEData> &sets);
+   void    GetAllTLEData(std::vector<TLEData> &sets);
    void    ParseForSpice(TLEData &theData);
 
 private:
+   /// The indexed lines of a TLE file
+   struct TLEIndex
+   {
+      /// The cache entry holding the lines; identifies the file version
+      std::shared_ptr<const DataFileCache>
+                                    source;
+      /// The lines of the file, as read by std::getline
+      std::vector<std::string>      lines;
+      /// First line with each content, for the name (line start) search
+      std::map<std::string, int>    byStart;
+      /// Lines by their content after the first two characters, for the
+      /// catalog number search
+      std::map<std::string, std::vector<int> >
+                                    byOffset;
+      /// First line 1 of an element set, or -1
+      int                           firstDataLine;
+      /// Line 1 of each element set by catalog number, in epoch order
+      std::map<std::string, std::vector<int> >
+                                    setsByNumber;
+   };
+
    std::string filename;
+   /// Index of the file, loaded on first use
+   std::shared_ptr<const TLEIndex>
+               index;
+
+   const TLEIndex& GetIndex();
+   int         FindFirstMatch(const TLEIndex &idx,
+                              const std::string &forSatellite);
+
+   static std::shared_ptr<const TLEIndex>
+               LoadIndex(const std::string &tleFile);
+   static std::string
+               CatalogNumber(const std::string &line1);
+   static double
+               ElementSetEpoch(const std::string &line1);
+
+   /// Indexes of the files read in the process, by file name
+   static std::map<std::string, std::shared_ptr<const TLEIndex> >
+               indexes;
+   /// Mutex guarding indexes
+   static std::mutex
+               indexMutex;
 };
 
 
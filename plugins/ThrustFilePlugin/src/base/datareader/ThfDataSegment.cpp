@@ -19,6 +19,7 @@
 //------------------------------------------------------------------------------
 
 #include "ThfDataSegment.hpp"
+#include "NotAKnotInterpolator.hpp"
 
 
 
@@ -49,7 +50,9 @@ ThfDataSegment::ThfDataSegment() :
    isActive                      (false),
    thrustScaleFactor             (1.0),
    massFlowScaleFactor           (1.0),
-   includeThrustFactorInMassFlow (false)
+   includeThrustFactorInMassFlow (false),
+   timesIncrease                 (false),
+   lastInterval                  (-1)
 {
 }
 
@@ -94,7 +97,11 @@ ThfDataSegment::ThfDataSegment(const ThfDataSegment& ds) :
    thrustScaleFactor             (ds.thrustScaleFactor),
    massFlowScaleFactor           (ds.massFlowScaleFactor),
    includeThrustFactorInMassFlow (ds.includeThrustFactorInMassFlow),
-   tanks                         (ds.tanks)
+   tanks                         (ds.tanks),
+   timesIncrease                 (ds.timesIncrease),
+   lastInterval                  (ds.lastInterval),
+   splineData                    (ds.splineData),
+   splineValid                   (ds.splineValid)
 {
    for (UnsignedInt i = 0; i < ds.profile.size(); ++i)
    {
@@ -140,6 +147,10 @@ ThfDataSegment& ThfDataSegment::operator =(const ThfDataSegment& ds)
       includeThrustFactorInMassFlow
                                   =  ds.includeThrustFactorInMassFlow;
       tanks                       =  ds.tanks;
+      timesIncrease               =  ds.timesIncrease;
+      lastInterval                =  ds.lastInterval;
+      splineData                  =  ds.splineData;
+      splineValid                 =  ds.splineValid;
 
       profile.clear();
       for (UnsignedInt i = 0; i < ds.profile.size(); ++i)
@@ -188,6 +199,116 @@ bool ThfDataSegment::HasPrecisionTime()
    return hasPrecisionTime;
 }
 
+//------------------------------------------------------------------------------
+// void BuildInterpolationData()
+//------------------------------------------------------------------------------
+/**
+ * Builds the lookup data for the profile once it is loaded
+ *
+ * The profile times are checked so that the interval containing an epoch can
+ * be found by bisection.  When the segment uses spline interpolation, the
+ * splines are built here for every window of 5 points used by the
+ * interpolation, so that evaluation does not rebuild them on each call.  The
+ * splines are built by the NotAKnotInterpolator, so evaluation matches
+ * building the interpolator on the same points.
+ */
+//------------------------------------------------------------------------------
+void ThfDataSegment::BuildInterpolationData()
+{
+   timesIncrease = true;
+   for (UnsignedInt i = 1; i < profile.size(); ++i)
+   {
+      if (profile[i].time < profile[i-1].time)
+      {
+         timesIncrease = false;
+         break;
+      }
+   }
+   lastInterval = -1;
+
+   splineData.clear();
+   splineValid.clear();
+
+   if (((accelIntType != SPLINE) && (massIntType != SPLINE)) ||
+       (profile.size() < 5))
+      return;
+
+   // Window w is built from points w-1 through w+3, for w in [1, size-4]
+   Integer windowCount = profile.size() - 4;
+   splineData.assign((windowCount + 1) * SPLINE_WINDOW_SIZE, 0.0);
+   splineValid.assign(windowCount + 1, false);
+
+   NotAKnotInterpolator spliner("SplineInterpolator", 4);
+   spliner.SetExtrapolation(true);
+   Real data[4];
+
+   for (Integer w = 1; w <= windowCount; ++w)
+   {
+      spliner.Clear();
+      for (Integer i = w - 1; i <= w + 3; ++i)
+      {
+         data[0] = profile[i].vector[0];
+         data[1] = profile[i].vector[1];
+         data[2] = profile[i].vector[2];
+         data[3] = profile[i].mdot;
+         spliner.AddPoint(profile[i].time, data);
+      }
+
+      Real *window = &splineData[w * SPLINE_WINDOW_SIZE];
+      splineValid[w] = spliner.GetSplineCoefficients(window, window + 5);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool EvaluateSpline(Integer window, Real offset, Real *values) const
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the splines built for a window of the profile
+ *
+ * The spline covering the offset is selected the way the NotAKnotInterpolator
+ * selects it, including the extrapolation off of the first spline.
+ *
+ * @param window Index of the first interior point of the window; the window
+ *               contains points window-1 through window+3
+ * @param offset The offset from the start epoch of the requested data
+ * @param values Array receiving the 3 thrust components and the mass flow
+ *
+ * @return true if the window has splines, false if they were not built or
+ *         could not be built for its points
+ */
+//------------------------------------------------------------------------------
+bool ThfDataSegment::EvaluateSpline(Integer window, Real offset,
+      Real *values) const
+{
+   if ((window < 1) || (window >= (Integer)splineValid.size()) ||
+       !splineValid[window])
+      return false;
+
+   const Real *x = &splineData[window * SPLINE_WINDOW_SIZE];
+   const Real *coefficients = x + 5;
+   bool increases = (x[0] < x[4]);
+
+   Integer kl = 0;
+   for (Integer i = 0; i < 4; ++i)
+   {
+      if ((increases && (x[i] <= offset) && (x[i+1] >= offset)) ||
+          (!increases && (x[i] >= offset) && (x[i+1] <= offset)))
+      {
+         kl = i;
+         break;
+      }
+   }
+
+   Real dx = offset - x[kl];
+   const Real *a = coefficients + 16 * kl;
+   for (Integer i = 0; i < 4; ++i)
+      values[i] = a[i] * (dx*dx*dx) + a[4+i] * (dx*dx) + a[8+i] * dx + a[12+i];
+
+   return true;
+}
+
+
 // Convenience methods for the thrust profile data structure
 
 //------------------------------------------------------------------------------
@@ -44,6 +44,9 @@ public:
    bool SetPrecisionTimeFlag(bool onOff = true);
    bool HasPrecisionTime();
 
+   void BuildInterpolationData();
+   bool EvaluateSpline(Integer window, Real offset, Real *values) const;
+
    /// Structure for the thrust profile data points
    struct ThrustPoint
    {
@@ -123,6 +126,23 @@ public:
    bool includeThrustFactorInMassFlow;
    /// List of tanks that are used for mass flow
    StringArray tanks;
+
+   //-------------------------------------------------
+   // Lookup data built when the profile is loaded
+   //-------------------------------------------------
+   /// Flag indicating that the profile times never decrease
+   bool timesIncrease;
+   /// Index of the profile interval found on the last lookup
+   Integer lastInterval;
+
+   /// Number of Reals stored for each spline window
+   static const Integer SPLINE_WINDOW_SIZE = 69;
+
+private:
+   /// Knots and coefficients of the splines, by window of 5 profile points
+   RealArray splineData;
+   /// Flags indicating the windows that have valid splines
+   std::vector<bool> splineValid;
 };
 
 #endif /* ThfDataSegment_hpp */
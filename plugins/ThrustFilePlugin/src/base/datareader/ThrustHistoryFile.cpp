@@ -1476,6 +1476,7 @@ void ThrustHistoryFile::ValidateSegment(ThfDataSegment& theSegment)
       }
    }
 
+   theSegment.BuildInterpolationData();
    theSegment.isDataLoaded = true;
 
    #ifdef DEBUG_FILE_READ
@@ -67,8 +67,8 @@ FileThrust::FileThrust(const std::string &name) :
    depleteMass             (false),
    coordSystem             (NULL),
    liner                   (NULL),
-   spliner                 (NULL),
    warnTooFewPoints        (true),
+   segmentHint             (-1),
    estimatingTSF           (false),
    tsfEpsilonID            (-1),
    tsfEpsilonRow           (-1),
@@ -93,8 +93,6 @@ FileThrust::~FileThrust()
 {
    if (liner != NULL)
       delete liner;
-   if (spliner != NULL)
-      delete spliner;
 }
 
 //------------------------------------------------------------------------------
@@ -123,8 +121,8 @@ FileThrust::FileThrust(const FileThrust& ft) :
    csNames                 (ft.csNames),
    coordSystem             (NULL),
    liner                   (NULL),
-   spliner                 (NULL),
    warnTooFewPoints        (true),
+   segmentHint             (-1),
    estimatingTSF           (ft.estimatingTSF),
    tsfEpsilonID            (ft.tsfEpsilonID),
    tsfEpsilonRow           (ft.tsfEpsilonRow),
@@ -181,14 +179,10 @@ FileThrust& FileThrust::operator=(const FileThrust& ft)
          delete liner;
          liner = NULL;
       }
-      if (spliner != NULL)
-      {
-         delete spliner;
-         spliner = NULL;
-      }
 
       massFlowWarningNeeded = true;
       warnTooFewPoints      = true;
+      segmentHint           = -1;
 
       estimatingAngles[0] = ft.estimatingAngles[0];
       estimatingAngles[1] = ft.estimatingAngles[1];
@@ -995,6 +989,7 @@ void FileThrust::SetSegmentList(std::vector<ThrustSegment> *segs, std::vector<Th
 {
    segments = segs;
    scriptSegments = scriptSegs;
+   segmentHint = -1;
 
    depleteMass = false;
 
@@ -1131,6 +1126,7 @@ bool FileThrust::Initialize()
          massFlowWarningNeeded = true;
          warnTooFewPoints      = true;
          indexPair[0]          = -1;
+         segmentHint           = -1;
          retval                = true;
       }
       else
@@ -1775,13 +1771,23 @@ Integer FileThrust::ComputeAccelerationMassFlow(const GmatEpoch segEpoch, const
    // Find the segment with data covering the input epoch.  Note that if
    // segments overlap, we use the data in the first segment covering the epoch
    Integer index = -1;
-   for (UnsignedInt i = 0; i < segments->size(); ++i)
+   UnsignedInt firstSegment = 0;
+   // Loaded segments do not overlap, so when the epoch is inside the segment
+   // found last time, no other segment covers it and the search starts there
+   if ((segmentHint >= 0) && (segmentHint < (Integer)segments->size()) &&
+       (*segments)[segmentHint].segData.isActive &&
+       ((*segments)[segmentHint].segData.startEpoch < segEpoch) &&
+       (segEpoch < (*segments)[segmentHint].segData.endEpoch))
+      firstSegment = segmentHint;
+
+   for (UnsignedInt i = firstSegment; i < segments->size(); ++i)
    {
       if ((*segments)[i].segData.isActive &&
             InSegmentInterval((*segments)[i].segData.startEpoch,
             (*segments)[i].segData.endEpoch, segEpoch))
       {
          index = i;
+         segmentHint = i;
          // Factor used to convert m/s^2 to km/s^2, and to divide out mass if
          // modeling thrust
          dataIsThrust = (*segments)[i].segData.modelThrust;
@@ -1925,13 +1931,23 @@ Integer FileThrust::ComputeAccelerationMassFlow(const GmatTime &segEpoch, const
    // Find the segment with data covering the input epoch.  Note that if
    // segments overlap, we use the data in the first segment covering the epoch
    Integer index = -1;
-   for (UnsignedInt i = 0; i < segments->size(); ++i)
+   UnsignedInt firstSegment = 0;
+   // Loaded segments do not overlap, so when the epoch is inside the segment
+   // found last time, no other segment covers it and the search starts there
+   if ((segmentHint >= 0) && (segmentHint < (Integer)segments->size()) &&
+       (*segments)[segmentHint].segData.isActive &&
+       ((*segments)[segmentHint].segData.startEpochGT < segEpoch) &&
+       (segEpoch < (*segments)[segmentHint].segData.endEpochGT))
+      firstSegment = segmentHint;
+
+   for (UnsignedInt i = firstSegment; i < segments->size(); ++i)
    {
       if ((*segments)[i].segData.isActive &&
             InSegmentInterval((*segments)[i].segData.startEpochGT,
             (*segments)[i].segData.endEpochGT, segEpoch))
       {
          index = i;
+         segmentHint = i;
          // Factor used to convert m/s^2 to km/s^2, and to divide out mass if
          // modeling thrust
          dataIsThrust = (*segments)[i].segData.modelThrust;
@@ -2061,6 +2077,11 @@ Integer FileThrust::ComputeAccelerationMassFlow(const GmatTime &segEpoch, const
  * Retrieves the index of the ThrustPoint vector element for the segment
  * containing the input epoch
  *
+ * The interval found on the previous call for the segment is tried first, and
+ * when the profile times increase the interval is otherwise found by
+ * bisection.  Either way, the interval returned is the first one containing
+ * the offset, as found by a scan of the profile.
+ *
  * @param atIndex Index of the segment containing the data
  * @param offset The offset from the start epoch of the requested segment
  *
@@ -2074,17 +2095,56 @@ Integer FileThrust::GetSegmentData(Integer atIndex, Real offset)
             atIndex, offset);
    #endif
 
+   ThfDataSegment &segData = (*segments)[atIndex].segData;
+   const std::vector<ThfDataSegment::ThrustPoint> &profile = segData.profile;
+   Integer intervalCount = profile.size() - 1;
    Integer profileIndex = -1;
-   for (UnsignedInt i = 0; i < (*segments)[atIndex].segData.profile.size()-1; ++i)
+
+   if (!segData.timesIncrease)
+   {
+      for (Integer i = 0; i < intervalCount; ++i)
+      {
+         if (InSegmentInterval(profile[i].time, profile[i + 1].time, offset))
+         {
+            profileIndex = i;
+            break;
+         }
+      }
+      return profileIndex;
+   }
+
+   // An interval starting before the offset is the first one containing it
+   Integer hint = segData.lastInterval;
+   if ((hint >= 0) && (hint < intervalCount) && (profile[hint].time < offset) &&
+       InSegmentInterval(profile[hint].time, profile[hint + 1].time, offset))
+      return hint;
+
+   // Intervals before the one ending at the first time not less than the
+   // offset do not contain it; after it, only intervals starting at the offset
+   Integer lo = 0, hi = profile.size(), mid;
+   while (lo < hi)
    {
-      if (InSegmentInterval((*segments)[atIndex].segData.profile[i].time,
-            (*segments)[atIndex].segData.profile[i + 1].time, offset))
+      mid = (lo + hi) / 2;
+      if (profile[mid].time < offset)
+         lo = mid + 1;
+      else
+         hi = mid;
+   }
+
+   for (Integer i = (lo > 0 ? lo - 1 : 0); i < intervalCount; ++i)
+   {
+      if ((i >= lo) && (profile[i].time != offset))
+         break;
+      if (InSegmentInterval(profile[i].time, profile[i + 1].time, offset))
       {
          profileIndex = i;
          break;
       }
    }
 
+   if (profileIndex >= 0)
+      segData.lastInterval = profileIndex;
+
    return profileIndex;
 }
 
@@ -2238,32 +2298,25 @@ void FileThrust::LinearInterpolate(Integer atIndex, Integer profileIndex, Real o
 //------------------------------------------------------------------------------
 void FileThrust::SplineInterpolate(Integer atIndex, Integer profileIndex, Real offset)
 {
+   const ThfDataSegment &segData = (*segments)[atIndex].segData;
+
    // Handle case of too few points by falling back to linear interpolation
-   if ((*segments)[atIndex].segData.profile.size() < 5)
+   if (segData.profile.size() < 5)
    {
       if (warnTooFewPoints)
       {
          MessageInterface::ShowMessage("Cannot perform spline interpolation: "
                "the thrust history data segment contains %d points, but spline "
                "interpolation requires at least 5.  Linear interpolation will "
-               "be applied instead.\n",
-               (*segments)[atIndex].segData.profile.size());
+               "be applied instead.\n", segData.profile.size());
          warnTooFewPoints = false;
       }
       LinearInterpolate(atIndex, profileIndex, offset);
+      return;
    }
 
-   if (spliner == NULL)
-   {
-      spliner = new NotAKnotInterpolator("SplineInterpolator", 4);
-      spliner->SetExtrapolation(true); // Allow extrapolation for RK89
-   }
-
-   if (spliner == NULL)
-      throw ODEModelException("The cubic spline interpolator failed to build");
-
    Real data[4];
-   Integer profileSize = (*segments)[atIndex].segData.profile.size();
+   Integer profileSize = segData.profile.size();
    Integer interpIndex = profileIndex;
 
    // Want to make sure interpolatorData has valid indicies
@@ -2278,20 +2331,19 @@ void FileThrust::SplineInterpolate(Integer atIndex, Integer profileIndex, Real o
    interpolatorData[3] = interpIndex + 2;
    interpolatorData[4] = interpIndex + 3;
 
-   // Reload the interpolator.  For now, this is done at each call.
-   spliner->Clear();
-   for (UnsignedInt i = 0; i < 5; ++i)
+   // The splines are built when the segment is loaded; a window without them
+   // has coincident times, and gets the data of its last point, as it did
+   // when the interpolator was loaded on each call
+   if (!segData.EvaluateSpline(interpIndex, offset, data))
    {
-      data[0] = (*segments)[atIndex].segData.profile[interpolatorData[i]].vector[0];
-      data[1] = (*segments)[atIndex].segData.profile[interpolatorData[i]].vector[1];
-      data[2] = (*segments)[atIndex].segData.profile[interpolatorData[i]].vector[2];
-      data[3] = (*segments)[atIndex].segData.profile[interpolatorData[i]].mdot;
-
-      spliner->AddPoint((*segments)[atIndex].segData.profile[interpolatorData[i]].time, data);
+      const ThfDataSegment::ThrustPoint &last =
+            segData.profile[interpolatorData[4]];
+      data[0] = last.vector[0];
+      data[1] = last.vector[1];
+      data[2] = last.vector[2];
+      data[3] = last.mdot;
    }
 
-   spliner->Interpolate(offset, data);
-
    if (dataBlock[5] == ThfDataSegment::SPLINE)
    {
       dataBlock[0] = data[0];
@@ -24,7 +24,6 @@
 #include "PhysicalModel.hpp"
 #include "ThrustSegment.hpp"
 #include "LinearInterpolator.hpp"
-#include "NotAKnotInterpolator.hpp"
 
 /**
  * Physical model used to apply derivative data from a thrust history file
@@ -197,14 +196,14 @@ protected:
 
    /// Linear interpolator object (currently not used
    LinearInterpolator            *liner;
-   /// Not a knot interpolator, used for spline interpolation
-   NotAKnotInterpolator          *spliner;
    /// Flag used to mark when the "too few points" warning has been written
    bool                          warnTooFewPoints;
    /// Indices into the profile data that is loaded into the interpolator
    Integer                       interpolatorData[5];
    /// Last used index pair
    Integer                       indexPair[2];
+   /// Index of the segment found on the last data request
+   Integer                       segmentHint;
   
    // Thrust Scale Factor Solve For data
    /// Spacecraft thrust scale factor
@@ -77,6 +77,7 @@
 #include "MinQP.hpp"
 #include <iostream>
 #include <iomanip>
+#include <utility>            // for std::move
 
 //#define WRITE_DEBUG
 
@@ -625,12 +626,15 @@ void MinQP::Optimize(Rvector &dV, Real &costVal, Rvector &lagMult,
                lu.SolveSystem(-U, x, py);
                Rmatrix L2(Z.GetNumColumns(), Z.GetNumColumns());
                Rmatrix U2(Z.GetNumColumns(), Z.GetNumColumns());
-               Rmatrix ZTransTimesHessian = multiMatrix(ZTrans, hessianMat);
-               lu.Factor(multiMatrix(ZTransTimesHessian, Z), L2, U2);
+               // Form Z'*(G*Z) rather than (Z'*G)*Z: the product with the
+               // Hessian then skips its zeros, and the dense product is
+               // only as wide as the null space
+               Rmatrix hessianTimesZ = multiMatrix(hessianMat, Z);
+               lu.Factor(multiMatrix(ZTrans, hessianTimesZ), L2, U2);
                x.SetSize(Z.GetNumColumns());
-               lu.SolveSystem(L2, multiMatrixToColumn(ZTransTimesHessian,
-                  multiMatrixToColumn(Y, py)) +
-                  multiMatrixToColumn(ZTrans, g), x);
+               lu.SolveSystem(L2, multiMatrixToColumn(ZTrans,
+                  multiMatrixToColumn(hessianMat,
+                  multiMatrixToColumn(Y, py)) + g), x);
                Rvector pz(x.GetSize());
                lu.SolveSystem(-U2, x, pz);
                p = multiMatrixToColumn(Y, py) + multiMatrixToColumn(Z, pz);
@@ -931,8 +935,8 @@ void MinQP::Optimize(Rvector &dV, Real &costVal, Rvector &lagMult,
                }
 
 
-               Rmatrix QCopy = Q;
-               Rmatrix RCopy = R;
+               Rmatrix QCopy(std::move(Q));
+               Rmatrix RCopy(std::move(R));
                qr.RemoveFromQR(RCopy, QCopy, "col", eqIdxs.GetSize() + j, R, Q);
             }
             
@@ -1112,8 +1116,8 @@ void MinQP::Optimize(Rvector &dV, Real &costVal, Rvector &lagMult,
 
             if (R.GetNumColumns() != 0 && R.GetNumRows() != 0)
             {
-               Rmatrix QCopy = Q;
-               Rmatrix RCopy = R;
+               Rmatrix QCopy(std::move(Q));
+               Rmatrix RCopy(std::move(R));
                qr.AddToQR(RCopy, QCopy, "col", partA.GetNumRows() - 1, newColumn, R, Q);
             }
 
@@ -2143,7 +2147,8 @@ Real MinQP::InfNorm(Rvector inputVector)
 }
 
 //------------------------------------------------------------------------------
-// Rvector multiMatrixToColumn(Rmatrix inputMatrix, Rvector inputVector)
+// Rvector multiMatrixToColumn(const Rmatrix &inputMatrix,
+//                             const Rvector &inputVector)
 //------------------------------------------------------------------------------
 /**
 * Method to multiply an Rmatrix to an Rvector when the Rvector is considered
@@ -2155,12 +2160,13 @@ Real MinQP::InfNorm(Rvector inputVector)
 * @return product The product of the matrix and column vector
 */
 //------------------------------------------------------------------------------
-Rvector MinQP::multiMatrixToColumn(Rmatrix inputMatrix, Rvector inputVector)
+Rvector MinQP::multiMatrixToColumn(const Rmatrix &inputMatrix,
+                                   const Rvector &inputVector)
 {
    Rvector product(inputMatrix.GetNumRows());
    Real* productData = (Real*)product.GetDataVector();
-   Real* inputMatrixData = (Real*)inputMatrix.GetDataVector();
-   Real* inputVectorData = (Real*)inputVector.GetDataVector();
+   const Real* inputMatrixData = inputMatrix.GetDataVector();
+   const Real* inputVectorData = inputVector.GetDataVector();
 
    Integer rowCount = inputMatrix.GetNumRows();
    Integer colCount = inputMatrix.GetNumColumns();
@@ -2179,7 +2185,8 @@ Rvector MinQP::multiMatrixToColumn(Rmatrix inputMatrix, Rvector inputVector)
 }
 
 //------------------------------------------------------------------------------
-// Rvector multiRowToMatrix(Rmatrix inputMatrix, Rvector inputVector)
+// Rvector multiRowToMatrix(const Rmatrix &inputMatrix,
+//                          const Rvector &inputVector)
 //------------------------------------------------------------------------------
 /**
 * Method to multiply an Rvector to an Rmatrix when the Rvector is considered
@@ -2191,12 +2198,13 @@ Rvector MinQP::multiMatrixToColumn(Rmatrix inputMatrix, Rvector inputVector)
 * @return product The product of the row vector and matrix
 */
 //------------------------------------------------------------------------------
-Rvector MinQP::multiRowToMatrix(Rmatrix inputMatrix, Rvector inputVector)
+Rvector MinQP::multiRowToMatrix(const Rmatrix &inputMatrix,
+                                const Rvector &inputVector)
 {
    Rvector product(inputVector.GetSize());
    Real* productData = (Real*)product.GetDataVector();
-   Real* inputMatrixData = (Real*)inputMatrix.GetDataVector();
-   Real* inputVectorData = (Real*)inputVector.GetDataVector();
+   const Real* inputMatrixData = inputMatrix.GetDataVector();
+   const Real* inputVectorData = inputVector.GetDataVector();
    
    Integer rowCount = inputMatrix.GetNumRows();
    Integer colCount = inputMatrix.GetNumColumns();
@@ -2215,42 +2223,45 @@ Rvector MinQP::multiRowToMatrix(Rmatrix inputMatrix, Rvector inputVector)
 }
 
 //------------------------------------------------------------------------------
-// Rmatrix multiMatrix(Rmatrix matrix1, Rmatrix matrix2)
+// Rmatrix multiMatrix(const Rmatrix &matrix1, const Rmatrix &matrix2)
 //------------------------------------------------------------------------------
 /**
 * Method to multiply an Rmatrix to an Rmatrix using data vectors
 *
+* Each row of the product is accumulated from rows of matrix2, so the data is
+* read in storage order, and zero elements of matrix1 are skipped.  Products
+* with a sparse first matrix, such as the constraint Jacobian or a diagonal
+* Hessian, cost in proportion to its nonzero elements.
+*
 * @param matrix1 The first matrix being multiplied
 * @param matrix2 The second matrix being multiplied 
 *
 * @return product The product of the two matrices
 */
 //------------------------------------------------------------------------------
-Rmatrix MinQP::multiMatrix(Rmatrix matrix1, Rmatrix matrix2)
+Rmatrix MinQP::multiMatrix(const Rmatrix &matrix1, const Rmatrix &matrix2)
 {
    Rmatrix product(matrix1.GetNumRows(), matrix2.GetNumColumns());
    Real* productData = (Real*)product.GetDataVector();
-   Real* matrix1Data = (Real*)matrix1.GetDataVector(); 
-   Real* matrix2Data = (Real*)matrix2.GetDataVector();
+   const Real* matrix1Data = matrix1.GetDataVector();
+   const Real* matrix2Data = matrix2.GetDataVector();
 
    Integer rowCount = product.GetNumRows();
    Integer colCount = product.GetNumColumns();
    Integer matrix1ColCount = matrix1.GetNumColumns();
    Integer matrix2ColCount = matrix2.GetNumColumns();
-   Integer rowStartElem1;
-   Integer rowStartElem2;
    for (Integer rowIdx = 0; rowIdx < rowCount; ++rowIdx)
    {
-      rowStartElem1 = rowIdx * colCount;
-      rowStartElem2 = rowIdx * matrix1ColCount;
-      for (Integer colIdx = 0; colIdx < colCount; ++colIdx)
+      Real* productRow = productData + rowIdx * colCount;
+      const Real* matrix1Row = matrix1Data + rowIdx * matrix1ColCount;
+      for (Integer multIdx = 0; multIdx < matrix1ColCount; ++multIdx)
       {
-         for (Integer multIdx = 0; multIdx < matrix1ColCount; ++multIdx)
-         {
-            productData[rowStartElem1 + colIdx] +=
-               matrix1Data[rowStartElem2 + multIdx] *
-               matrix2Data[multIdx * matrix2ColCount + colIdx];
-         }
+         Real factor = matrix1Row[multIdx];
+         if (factor == 0.0)
+            continue;
+         const Real* matrix2Row = matrix2Data + multIdx * matrix2ColCount;
+         for (Integer colIdx = 0; colIdx < colCount; ++colIdx)
+            productRow[colIdx] += factor * matrix2Row[colIdx];
       }
    }
 
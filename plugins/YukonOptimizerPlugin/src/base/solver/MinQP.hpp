@@ -134,9 +134,11 @@ private:
    Real GetMax(Rvector inputVector);
    Real GetMin(Rvector inputVector);
    Real InfNorm(Rvector inputVector);
-   Rvector multiMatrixToColumn(Rmatrix inputMatrix, Rvector inputVector);
-   Rvector multiRowToMatrix(Rmatrix inputMatrix, Rvector inputVector);
-   Rmatrix multiMatrix(Rmatrix matrix1, Rmatrix matrix2);
+   Rvector multiMatrixToColumn(const Rmatrix &inputMatrix,
+                               const Rvector &inputVector);
+   Rvector multiRowToMatrix(const Rmatrix &inputMatrix,
+                            const Rvector &inputVector);
+   Rmatrix multiMatrix(const Rmatrix &matrix1, const Rmatrix &matrix2);
    Rmatrix TransposeMatrix(Rmatrix inputMatrix);
 
    /// Real Vector. Guess for optimization variables. numDecisionVars x 1
@@ -342,11 +342,12 @@ std::string Yukonad::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Yukonad::GetParameterID(const std::string &str) const
 {
-   for (Integer i = InternalOptimizerParamCount; i < YukonadParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - InternalOptimizerParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, InternalOptimizerParamCount,
+               YukonadParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return InternalOptimizer::GetParameterID(str);
 }
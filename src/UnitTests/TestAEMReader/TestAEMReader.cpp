@@ -0,0 +1,226 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestAEMReader
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the segment and data lookup of CCSDSAEMReader.
+ *
+ * A two segment quaternion AEM file describing a constant rate spin about the
+ * z axis is written to the test directory.  Attitudes are read back at data
+ * epochs, between data epochs, and in forward, backward and alternating
+ * order across the segment boundary, and the segment found for the shared
+ * boundary epoch is checked.  The time per lookup is reported.
+ *
+ * The leap second file is passed as the first argument, or read from the
+ * test directory.
+ *
+ * Output file:
+ * TestAEMReaderOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "CCSDSAEMReader.hpp"
+#include "UtcDate.hpp"
+#include "TimeSystemConverter.hpp"
+#include "LeapSecsFileReader.hpp"
+#include "RealUtilities.hpp"
+#include "GmatConstants.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const std::string AEM_NAME     = "TestAEMReader.aem";
+   /// Spin rate about z, in degrees per second
+   const Real        SPIN_RATE    = 0.1;
+   /// Data spacing, in seconds
+   const Integer     STEP         = 10;
+   /// Data points per segment, the last shared with the next segment
+   const Integer     POINTS       = 501;
+   /// Data points between checked epochs
+   const Integer     CHECK_STRIDE = 25;
+   const Integer     LOOKUP_COUNT = 100000;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string UtcString(Integer seconds)
+//------------------------------------------------------------------------------
+/**
+ * Returns the AEM epoch string seconds after 2020-01-01T00:00:00 UTC.
+ */
+//------------------------------------------------------------------------------
+std::string UtcString(Integer seconds)
+{
+   std::ostringstream str;
+   str << "2020-01-01T" << setfill('0') << setw(2) << seconds / 3600 << ":"
+       << setw(2) << (seconds / 60) % 60 << ":" << setw(2) << seconds % 60
+       << ".000";
+   return str.str();
+}
+
+
+//------------------------------------------------------------------------------
+// Real A1Epoch(Real seconds)
+//------------------------------------------------------------------------------
+Real A1Epoch(Real seconds)
+{
+   return UtcDate(2020, 1, 1, 0, 0, 0.0).ToA1Mjd() +
+         seconds / GmatTimeConstants::SECS_PER_DAY;
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteSegment(std::ofstream &aem, Integer first)
+//------------------------------------------------------------------------------
+void WriteSegment(std::ofstream &aem, Integer first)
+{
+   Integer last = first + (POINTS - 1) * STEP;
+   aem << "META_START\n"
+       << "OBJECT_NAME = TestSat\n"
+       << "OBJECT_ID = 2020-001A\n"
+       << "CENTER_NAME = Earth\n"
+       << "REF_FRAME_A = EME2000\n"
+       << "REF_FRAME_B = SC_BODY_1\n"
+       << "ATTITUDE_DIR = A2B\n"
+       << "TIME_SYSTEM = UTC\n"
+       << "START_TIME = " << UtcString(first) << "\n"
+       << "STOP_TIME = " << UtcString(last) << "\n"
+       << "ATTITUDE_TYPE = QUATERNION\n"
+       << "QUATERNION_TYPE = LAST\n"
+       << "INTERPOLATION_METHOD = LINEAR\n"
+       << "INTERPOLATION_DEGREE = 1\n"
+       << "META_STOP\n\n"
+       << "DATA_START\n";
+   aem.precision(16);
+   for (Integer t = first; t <= last; t += STEP)
+   {
+      Real half = 0.5 * SPIN_RATE * t * GmatMathConstants::RAD_PER_DEG;
+      aem << UtcString(t) << " 0.0 0.0 " << GmatMathUtil::Sin(half) << " "
+          << GmatMathUtil::Cos(half) << "\n";
+   }
+   aem << "DATA_STOP\n\n";
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckAttitude(TestOutput &out, CCSDSAEMReader &reader, Real seconds)
+//------------------------------------------------------------------------------
+/**
+ * Checks the inertial to body matrix seconds into the file against the spin.
+ */
+//------------------------------------------------------------------------------
+void CheckAttitude(TestOutput &out, CCSDSAEMReader &reader, Real seconds)
+{
+   Real angle = SPIN_RATE * seconds * GmatMathConstants::RAD_PER_DEG;
+   Rmatrix33 dcm = reader.GetState(A1Epoch(seconds));
+   out.Validate(dcm(0,0), GmatMathUtil::Cos(angle), 1.0e-8);
+   out.Validate(GmatMathUtil::Abs(dcm(0,1)),
+         GmatMathUtil::Abs(GmatMathUtil::Sin(angle)), 1.0e-8);
+   out.Validate(dcm(2,2), 1.0, 1.0e-8);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out, const std::string &outPath)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out, const std::string &outPath)
+{
+   Integer boundary = (POINTS - 1) * STEP;
+   std::string aemFile = outPath + AEM_NAME;
+   std::ofstream aem(aemFile.c_str());
+   aem << "CCSDS_AEM_VERS = 1.0\n"
+       << "CREATION_DATE = 2020-01-01T00:00:00\n"
+       << "ORIGINATOR = GMAT\n\n";
+   WriteSegment(aem, 0);
+   WriteSegment(aem, boundary);
+   aem.close();
+
+   CCSDSAEMReader reader;
+   reader.SetFile(aemFile);
+   reader.Initialize();
+   out.Validate(reader.GetNumberOfSegments(), 2);
+
+   out.Put("======================================== Test data epochs");
+   for (Integer t = 0; t <= 2 * boundary; t += CHECK_STRIDE * STEP)
+      CheckAttitude(out, reader, t);
+
+   out.Put("======================================== Test interpolated epochs");
+   for (Real t = 2 * boundary - 3.5; t > 0.0; t -= (CHECK_STRIDE + 0.5) * STEP)
+      CheckAttitude(out, reader, t);
+
+   out.Put("======================================== Test segment boundary");
+   out.Validate(reader.GetSegmentNumber(A1Epoch(boundary + 30.0)), 1);
+   out.Validate(reader.GetSegmentNumber(A1Epoch(boundary)), 0);
+   out.Validate(reader.GetSegmentNumber(A1Epoch(boundary + 30.0)), 1);
+   out.Validate(reader.GetSegmentNumber(A1Epoch(boundary - 30.0)), 0);
+   out.Validate(reader.GetSegmentNumber(A1Epoch(3.0 * boundary)), -1);
+   out.Validate(reader.GetSegmentNumber(A1Epoch(boundary + 30.0)), 1);
+   CheckAttitude(out, reader, boundary);
+   CheckAttitude(out, reader, boundary + 4.5);
+   CheckAttitude(out, reader, boundary - 4.5);
+
+   out.Put("======================================== Benchmark lookup");
+   Real start = A1Epoch(0.0);
+   Real span  = 2.0 * boundary / GmatTimeConstants::SECS_PER_DAY;
+   Real sum   = 0.0;
+   std::chrono::steady_clock::time_point begin =
+         std::chrono::steady_clock::now();
+   for (Integer k = 0; k < LOOKUP_COUNT; ++k)
+      sum += reader.GetState(start + span * k / LOOKUP_COUNT)(0,0);
+   Real elapsed = std::chrono::duration<Real>(
+         std::chrono::steady_clock::now() - begin).count();
+   out.Put("mean cos(angle) = ", sum / LOOKUP_COUNT);
+   out.Put("microseconds per GetState = ", elapsed / LOOKUP_COUNT * 1.0e6);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestAEMReader/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestAEMReaderOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      std::string leapFile = (argc > 1 ? argv[1] : outPath + "tai-utc.dat");
+      LeapSecsFileReader *leapSecs = new LeapSecsFileReader(leapFile);
+      leapSecs->Initialize();
+      TimeSystemConverter::Instance()->SetLeapSecsFileReader(leapSecs);
+
+      RunTest(out, outPath);
+      out.Put("\nSuccessfully ran unit testing of CCSDSAEMReader!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
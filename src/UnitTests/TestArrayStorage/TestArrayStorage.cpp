@@ -0,0 +1,212 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestArrayStorage
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver and micro-benchmark for the Rvector/Rmatrix storage: the
+ * inline buffers used for vectors of up to 6 elements and matrices of up to
+ * 6x6, and the move operations.
+ *
+ * The copy, move and resize operations are validated for inline and heap
+ * backed objects.  The same expression mix (products, transposes and vector
+ * arithmetic) is then timed at 6x6, which stays in the inline buffers, and at
+ * 7x7, which goes to the heap as every size did before.  In builds that define
+ * DEBUG_ARRAY_ALLOCATIONS the heap allocations per pass are written out as
+ * well.
+ *
+ * Output file:
+ * TestArrayStorageOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <ctime>
+#include <utility>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "Rvector.hpp"
+#include "Rvector6.hpp"
+#include "Rmatrix.hpp"
+#include "Rmatrix66.hpp"
+#include "ArrayAllocationCounter.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------------------
+// Rmatrix TestMatrix(Integer size, Real seed)
+//------------------------------------------------------------------------------
+Rmatrix TestMatrix(Integer size, Real seed)
+{
+   Rmatrix m(size, size);
+   for (Integer i = 0; i < size; ++i)
+      for (Integer j = 0; j < size; ++j)
+         m(i, j) = (i == j ? 4.0 : 0.0) + 0.1 * sin(seed + 1.3 * i + 0.7 * j);
+   return m;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Pass(const Rmatrix &a, const Rmatrix &b, Rvector &v)
+//------------------------------------------------------------------------------
+/**
+ * One pass of the expression mix; returns a value so it is not optimized out
+ */
+//------------------------------------------------------------------------------
+Real Pass(const Rmatrix &a, const Rmatrix &b, Rvector &v)
+{
+   Rmatrix p = a * b.Transpose();
+   Rmatrix q = p * a - b * 0.5;
+   Rvector w = q * v;
+   v = w / w.GetMagnitude();
+   return q(0, 0) + v[0];
+}
+
+
+//------------------------------------------------------------------------------
+// void RunSize(Integer size, Integer passes, TestOutput &out)
+//------------------------------------------------------------------------------
+void RunSize(Integer size, Integer passes, TestOutput &out)
+{
+   Rmatrix a = TestMatrix(size, 0.3);
+   Rmatrix b = TestMatrix(size, 1.1);
+   Rvector v(size);
+   for (Integer i = 0; i < size; ++i)
+      v[i] = 1.0;
+
+   Integer allocations = GmatArrayAllocation::GetCount();
+   Real sum = Pass(a, b, v);
+   allocations = GmatArrayAllocation::GetCount() - allocations;
+
+   clock_t start = clock();
+   for (Integer k = 0; k < passes; ++k)
+      sum += Pass(a, b, v);
+   Real elapsed = Real(clock() - start) / CLOCKS_PER_SEC;
+
+   out.Put("size = ", size);
+   if (GmatArrayAllocation::IsCounting())
+      out.Put("heap allocations per pass = ", allocations);
+   out.Put("passes/sec = ", (elapsed > 0.0 ? passes / elapsed : 0.0));
+   out.Put("checksum = ", sum);
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckStorage(Integer size, TestOutput &out)
+//------------------------------------------------------------------------------
+void CheckStorage(Integer size, TestOutput &out)
+{
+   out.Put("----- size = ", size);
+   Rmatrix m = TestMatrix(size, 0.5);
+   Rmatrix copy(m);
+   out.Validate(copy == m, true);
+
+   // Moving leaves the source unsized and the target with the values
+   Rmatrix moved(std::move(copy));
+   out.Validate(moved == m, true);
+   out.Validate(copy.IsSized(), false);
+
+   Rmatrix assigned;
+   assigned = std::move(moved);
+   out.Validate(assigned == m, true);
+   out.Validate(moved.IsSized(), false);
+
+   // Same size moves into a sized matrix; other sizes still throw
+   Rmatrix target(size, size);
+   target = TestMatrix(size, 0.5);
+   out.Validate(target == m, true);
+   bool threw = false;
+   try
+   {
+      target = TestMatrix(size + 1, 0.5);
+   }
+   catch (TableTemplateExceptions::DimensionError &)
+   {
+      threw = true;
+   }
+   out.Validate(threw, true);
+
+   // Resizing between inline and heap storage keeps the values
+   Rmatrix grown(m);
+   grown.ChangeSize(size + 2, size + 2, false);
+   grown.ChangeSize(size, size, false);
+   out.Validate(grown == m, true);
+
+   Rvector v(size);
+   for (Integer i = 0; i < size; ++i)
+      v[i] = i + 0.25;
+   Rvector vMoved(std::move(v));
+   out.Validate(v.IsSized(), false);
+   out.Validate(vMoved[size - 1] == size - 0.75, true);
+   v = std::move(vMoved);
+   out.Validate(v[0] == 0.25, true);
+   v.Resize(size + 4);
+   out.Validate(v[size - 1] == size - 0.75, true);
+
+   // Containers move and copy their elements correctly
+   std::vector<Rmatrix> mats;
+   for (Integer i = 0; i < 10; ++i)
+      mats.push_back(TestMatrix(size, 0.5));
+   out.Validate(mats[9] == m, true);
+}
+
+
+//------------------------------------------------------------------------------
+//int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("========================= Test inline and heap storage");
+   CheckStorage(3, out);
+   CheckStorage(6, out);
+   CheckStorage(7, out);
+   CheckStorage(12, out);
+
+   Rmatrix66 m66;
+   Rvector6 v6(1.0, 2.0, 3.0, 4.0, 5.0, 6.0);
+   Rvector6 w6 = m66 * v6;
+   out.Validate(w6[5] == 6.0, true);
+
+   out.Put("========================= Benchmark expression mix");
+   RunSize(6, 200000, out);
+   RunSize(7, 200000, out);
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestArrayStorage/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestArrayStorageOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of Rvector/Rmatrix storage!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
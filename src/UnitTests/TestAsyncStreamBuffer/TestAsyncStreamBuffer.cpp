@@ -0,0 +1,158 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TestAsyncStreamBuffer
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for AsyncStreamBuffer.
+ *
+ * Formatted report lines are written to a file stream, flushing after each
+ * line as the estimator report does, once directly and once through the
+ * buffer.  The files are read back and compared with the same text built in
+ * memory, after a Flush() part way through and after Detach().  The time per
+ * line is reported for both.
+ *
+ * Output file:
+ * TestAsyncStreamBufferOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "AsyncStreamBuffer.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Integer LINE_COUNT = 200000;
+
+   void WriteLine(std::ostream &os, Integer i)
+   {
+      os << " " << i << "  DSN_TCP  " << 21545.0 + i / 86400.0 << "  "
+         << i * 0.125 << "  -" << i % 7 << "\n";
+   }
+
+   std::string ReadFile(const std::string &fileName)
+   {
+      std::ifstream file(fileName.c_str());
+      return std::string((std::istreambuf_iterator<char>(file)),
+            std::istreambuf_iterator<char>());
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out, const std::string &outPath)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out, const std::string &outPath)
+{
+   std::stringstream expected;
+   expected.precision(16);
+   expected.setf(std::ios::fixed, std::ios::floatfield);
+   for (Integer i = 0; i < LINE_COUNT; ++i)
+      WriteLine(expected, i);
+
+   out.Put("======================================== Test direct writing");
+   std::string directName = outPath + "DirectReport.txt";
+   std::ofstream direct(directName.c_str());
+   direct.precision(16);
+   direct.setf(std::ios::fixed, std::ios::floatfield);
+
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   for (Integer i = 0; i < LINE_COUNT; ++i)
+   {
+      WriteLine(direct, i);
+      direct.flush();
+   }
+   direct.close();
+   Real directTime = std::chrono::duration<Real>(
+         std::chrono::steady_clock::now() - start).count();
+   out.Validate(ReadFile(directName) == expected.str(), true);
+
+   out.Put("======================================== Test buffered writing");
+   std::string bufferedName = outPath + "BufferedReport.txt";
+   std::ofstream buffered(bufferedName.c_str());
+   buffered.precision(16);
+   buffered.setf(std::ios::fixed, std::ios::floatfield);
+
+   AsyncStreamBuffer reportBuffer;
+   reportBuffer.Attach(buffered);
+   out.Validate(reportBuffer.IsAttached(), true);
+
+   start = std::chrono::steady_clock::now();
+   for (Integer i = 0; i < LINE_COUNT; ++i)
+   {
+      WriteLine(buffered, i);
+      buffered.flush();
+
+      // All of the text so far is in the file after a Flush()
+      if (i == LINE_COUNT / 2)
+      {
+         reportBuffer.Flush();
+         std::string partial = ReadFile(bufferedName);
+         out.Validate(partial == expected.str().substr(0, partial.size()),
+               true);
+         out.Validate(partial.size() > 0, true);
+      }
+   }
+   reportBuffer.Detach();
+   Real bufferedTime = std::chrono::duration<Real>(
+         std::chrono::steady_clock::now() - start).count();
+
+   out.Validate(reportBuffer.IsAttached(), false);
+   out.Validate(buffered.good(), true);
+
+   // The stream writes its own file again once detached
+   buffered << "last\n";
+   buffered.close();
+   out.Validate(ReadFile(bufferedName) == expected.str() + "last\n", true);
+
+   out.Put("direct   microseconds per line = ",
+         directTime * 1.0e6 / LINE_COUNT);
+   out.Put("buffered microseconds per line = ",
+         bufferedTime * 1.0e6 / LINE_COUNT);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestAsyncStreamBuffer/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestAsyncStreamBufferOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out, outPath);
+      out.Put("\nSuccessfully ran unit testing of AsyncStreamBuffer!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,154 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TestBufferedLogWriter
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the threaded message pipeline and BufferedLogWriter.
+ *
+ * Several threads log numbered lines through MessageInterface at once.  The
+ * log file is flushed and read back to check that every line is there, whole
+ * and in order for each thread, and that a message longer than the initial
+ * format buffer is not truncated.  The time per logged message is reported.
+ *
+ * Output file:
+ * TestBufferedLogWriterOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "BufferedLogWriter.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Integer THREAD_COUNT = 4;
+   const Integer LINE_COUNT   = 20000;
+}
+
+
+//------------------------------------------------------------------------------
+// void LogLines(Integer thread)
+//------------------------------------------------------------------------------
+void LogLines(Integer thread)
+{
+   for (Integer i = 0; i < LINE_COUNT; ++i)
+      MessageInterface::LogMessage("thread %d line %d value %.6f\n", thread, i,
+            i * 0.5);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out, const std::string &outPath)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out, const std::string &outPath)
+{
+   std::string logName = outPath + "ThreadedLog.txt";
+   MessageInterface::ToggleConsolePrinting(false);
+   MessageInterface::SetLogEnable(true);
+   MessageInterface::SetLogFile(logName);
+
+   out.Put("======================================== Test threaded logging");
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   std::vector<std::thread> threads;
+   for (Integer t = 0; t < THREAD_COUNT; ++t)
+      threads.push_back(std::thread(LogLines, t));
+   for (Integer t = 0; t < THREAD_COUNT; ++t)
+      threads[t].join();
+   MessageInterface::FlushLog();
+   Real elapsed = std::chrono::duration<Real>(std::chrono::steady_clock::now()
+         - start).count();
+
+   std::string longMsg(MessageInterface::MAX_MESSAGE_LENGTH + 5000, 'x');
+   MessageInterface::LogMessage("%s\n", longMsg.c_str());
+   MessageInterface::FlushLog();
+
+   std::ifstream log(logName.c_str());
+   std::string line;
+   std::vector<Integer> nextLine(THREAD_COUNT, 0);
+   Integer badLines = 0, longLines = 0;
+   while (std::getline(log, line))
+   {
+      Integer thread, index;
+      double value;
+      if (sscanf(line.c_str(), "thread %d line %d value %lf", &thread, &index,
+            &value) == 3)
+      {
+         if ((thread < 0) || (thread >= THREAD_COUNT) ||
+             (index != nextLine[thread]) || (value != index * 0.5))
+            ++badLines;
+         else
+            ++nextLine[thread];
+      }
+      else if (line == longMsg)
+         ++longLines;
+   }
+
+   for (Integer t = 0; t < THREAD_COUNT; ++t)
+      out.Validate(nextLine[t], LINE_COUNT);
+   out.Validate(badLines, 0);
+   out.Validate(longLines, 1);
+
+   out.Put("microseconds per logged message = ",
+         elapsed * 1.0e6 / (THREAD_COUNT * LINE_COUNT));
+
+   out.Put("======================================== Test BufferedLogWriter");
+   std::string directName = outPath + "DirectLog.txt";
+   BufferedLogWriter writer;
+   out.Validate(writer.Open(directName), true);
+   writer.Write("first\n");
+   writer.Write("second\n");
+   writer.Close();
+   out.Validate(writer.IsOpen(), false);
+
+   std::ifstream direct(directName.c_str());
+   std::string text((std::istreambuf_iterator<char>(direct)),
+         std::istreambuf_iterator<char>());
+   out.Validate(text, std::string("first\nsecond\n"));
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestBufferedLogWriter/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestBufferedLogWriterOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out, outPath);
+      out.Put("\nSuccessfully ran unit testing of BufferedLogWriter!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,200 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TestChebyshevEphemeris
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver and benchmark for the ChebyshevEphemeris fit.
+ *
+ * The source is a Keplerian orbit, so the fit can be checked against the exact
+ * states anywhere: a lunar orbit, fitted with the default span, and a Phobos
+ * like orbit, which forces the span to be halved.  For each orbit the driver
+ * writes the largest position and velocity errors over a month of epochs that
+ * are not nodes, the span reached, the number of source samples per query, and
+ * the query rate of the fit next to the rate of the source.  The SPK readers
+ * cost about 1 to 3 microseconds per state, so the source rate here is an
+ * upper bound of the speedup, not a measure of it.
+ *
+ * Output file:
+ * TestChebyshevEphemerisOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <ctime>
+#include "gmatdefs.hpp"
+#include "ChebyshevEphemeris.hpp"
+#include "UtilityException.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------------------
+// class KeplerEphemeris
+//------------------------------------------------------------------------------
+/**
+ * Fit of an elliptic orbit in its plane, tilted about the x axis
+ */
+//------------------------------------------------------------------------------
+class KeplerEphemeris : public ChebyshevEphemeris
+{
+public:
+   KeplerEphemeris(Real sma, Real ecc, Real periodDays, Real posTol,
+                   Real velTol) :
+      ChebyshevEphemeris(posTol, velTol),
+      a     (sma),
+      e     (ecc),
+      n     (2.0 * GmatMathConstants::PI / (periodDays * 86400.0))
+   {
+   }
+
+   void Exact(Real a1Mjd, Real *state)
+   {
+      Real m = n * (a1Mjd - 21545.0) * 86400.0;
+      Real ea = m;
+      for (Integer i = 0; i < 30; ++i)
+         ea -= (ea - e * sin(ea) - m) / (1.0 - e * cos(ea));
+      Real b = a * sqrt(1.0 - e * e);
+      Real eaDot = n / (1.0 - e * cos(ea));
+      Real x = a * (cos(ea) - e), y = b * sin(ea);
+      Real vx = -a * sin(ea) * eaDot, vy = b * cos(ea) * eaDot;
+      // 28.5 degree tilt
+      Real c = cos(0.497), s = sin(0.497);
+      state[0] = x;   state[1] = c * y;   state[2] = s * y;
+      state[3] = vx;  state[4] = c * vy;  state[5] = s * vy;
+   }
+
+protected:
+   Real a, e, n;
+
+   virtual bool SampleState(Real a1Mjd, Real *state)
+   {
+      Exact(a1Mjd, state);
+      return true;
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// void RunOrbit(const std::string &label, KeplerEphemeris &fit, Real step,
+//               TestOutput &out)
+//------------------------------------------------------------------------------
+void RunOrbit(const std::string &label, KeplerEphemeris &fit, Real step,
+              TestOutput &out)
+{
+   out.Put("----- " + label);
+   const Real t0 = 25000.123456789;
+   Integer queries = (Integer)(30.0 / step);
+   Real fitState[6], exact[6], maxDr = 0.0, maxDv = 0.0;
+
+   for (Integer i = 0; i < queries; ++i)
+   {
+      Real t = t0 + i * step;
+      if (!fit.GetState(t, fitState))
+         throw UtilityException("The fit gave up on a segment");
+      fit.Exact(t, exact);
+      Real dr = 0.0, dv = 0.0;
+      for (Integer c = 0; c < 3; ++c)
+      {
+         dr += (fitState[c] - exact[c]) * (fitState[c] - exact[c]);
+         dv += (fitState[c+3] - exact[c+3]) * (fitState[c+3] - exact[c+3]);
+      }
+      maxDr = (sqrt(dr) > maxDr ? sqrt(dr) : maxDr);
+      maxDv = (sqrt(dv) > maxDv ? sqrt(dv) : maxDv);
+   }
+
+   out.Put("max position error (km)   = ", maxDr);
+   out.Put("max velocity error (km/s) = ", maxDv);
+   out.Put("segment span (days)       = ", fit.GetSpan());
+   out.Put("samples per query         = ",
+           Real(fit.GetSampleCount()) / queries);
+   out.Validate(maxDr < 1.0e-6, true);
+   out.Validate(maxDv < 1.0e-9, true);
+
+   Integer passes = 20;
+   Real sum = 0.0;
+   clock_t start = clock();
+   for (Integer k = 0; k < passes; ++k)
+      for (Integer i = 0; i < queries; ++i)
+      {
+         fit.GetState(t0 + i * step, fitState);
+         sum += fitState[0];
+      }
+   Real fitTime = Real(clock() - start) / CLOCKS_PER_SEC;
+
+   start = clock();
+   for (Integer k = 0; k < passes; ++k)
+      for (Integer i = 0; i < queries; ++i)
+      {
+         fit.Exact(t0 + i * step, exact);
+         sum += exact[0];
+      }
+   Real sourceTime = Real(clock() - start) / CLOCKS_PER_SEC;
+
+   Real count = Real(passes) * queries;
+   out.Put("fit ns per query          = ", 1.0e9 * fitTime / count);
+   out.Put("source ns per query       = ", 1.0e9 * sourceTime / count);
+   out.Put("checksum                  = ", sum);
+}
+
+
+//------------------------------------------------------------------------------
+//int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("========================= Test Chebyshev fit of Keplerian orbits");
+
+   // 1 mm and 1 micrometer/s, the scale CelestialBody uses
+   KeplerEphemeris moon(384400.0, 0.055, 27.32, 1.0e-6, 1.0e-9);
+   RunOrbit("Moon, 60 s queries", moon, 60.0 / 86400.0, out);
+
+   KeplerEphemeris phobos(9376.0, 0.0151, 0.319, 1.0e-6, 1.0e-9);
+   RunOrbit("Phobos, 10 s queries", phobos, 10.0 / 86400.0, out);
+   out.Validate(phobos.GetSpan() < ChebyshevEphemeris::DEFAULT_SPAN, true);
+
+   // Clearing keeps the span and refits on demand
+   phobos.Clear();
+   out.Validate(phobos.GetSegmentCount(), 0);
+   Real state[6];
+   out.Validate(phobos.GetState(25001.0, state), true);
+   out.Validate(phobos.GetSegmentCount(), 1);
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestChebyshevEphemeris/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestChebyshevEphemerisOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of ChebyshevEphemeris!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
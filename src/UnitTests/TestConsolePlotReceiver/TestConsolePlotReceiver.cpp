@@ -0,0 +1,158 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           TestConsolePlotReceiver
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the Console plot receiver and its raster.
+ *
+ * Lines drawn on a PlotRaster are checked pixel by pixel, and the size of the
+ * PNG file written for it is checked against the uncompressed layout.  An XY
+ * plot and an orbit plot are then fed through the PlotInterface, with frame
+ * images requested, and the time spent in the update calls is reported.
+ *
+ * Output file:
+ * TestConsolePlotReceiverOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "ConsolePlotReceiver.hpp"
+#include "PlotInterface.hpp"
+#include "PlotRaster.hpp"
+#include "Rvector.hpp"
+#include "RealUtilities.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// Integer FileSize(const std::string &fileName)
+//------------------------------------------------------------------------------
+Integer FileSize(const std::string &fileName)
+{
+   std::ifstream in(fileName.c_str(), std::ios::binary | std::ios::ate);
+   if (!in)
+      return -1;
+   return (Integer)in.tellg();
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out, const std::string &outPath)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out, const std::string &outPath)
+{
+   out.Put("======================================== Test PlotRaster");
+   PlotRaster raster(20, 10);
+   raster.DrawLine(0, 0, 19, 9, 0xFF0000);
+   raster.DrawLine(-5, 5, 30, 5, 0x00FF00);
+   out.Validate(raster.GetPixel(0, 0) == 0xFF0000, true);
+   out.Validate(raster.GetPixel(19, 9) == 0xFF0000, true);
+   out.Validate(raster.GetPixel(0, 5) == 0x00FF00, true);
+   out.Validate(raster.GetPixel(19, 5) == 0x00FF00, true);
+   out.Validate(raster.GetPixel(19, 0) == 0xFFFFFF, true);
+
+   // Signature, IHDR, IDAT with one stored block, IEND
+   std::string png = outPath + "TestRaster.png";
+   out.Validate(raster.WritePng(png), true);
+   Integer rawSize = (20 * 3 + 1) * 10;
+   out.Validate(FileSize(png), 8 + 25 + (12 + 2 + 5 + rawSize + 4) + 12);
+
+   out.Put("======================================== Test XY plot");
+   ConsolePlotReceiver *plots = ConsolePlotReceiver::Instance();
+   plots->SetOutputPath(outPath);
+   plots->SetFrameInterval(25000);
+   PlotInterface::SetPlotReceiver(plots);
+
+   PlotInterface::CreateXyPlotWindow("TestXY", "", 0, 0, 0, 0, false,
+         "Test XY", "Time", "Value", true);
+   PlotInterface::AddXyPlotCurve("TestXY", 0, "Sine", 0xFF0000);
+   PlotInterface::AddXyPlotCurve("TestXY", 1, "Cosine", 0x0000FF);
+
+   const Integer points = 100000;
+   Rvector yvals(2);
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   for (Integer i = 0; i < points; ++i)
+   {
+      if (i == points / 2)
+         PlotInterface::XyPlotPenUp("TestXY");
+      if (i == points / 2 + 100)
+         PlotInterface::XyPlotPenDown("TestXY");
+      yvals[0] = GmatMathUtil::Sin(i * 1.0e-4);
+      yvals[1] = GmatMathUtil::Cos(i * 1.0e-4);
+      PlotInterface::UpdateXyPlot("TestXY", "", i, yvals, "", "", "", 0, true,
+            true);
+   }
+   Real updateTime = std::chrono::duration<Real>(
+         std::chrono::steady_clock::now() - start).count();
+   PlotInterface::RefreshXyPlot("TestXY");
+
+   out.Put("======================================== Test orbit plot");
+   PlotInterface::CreateGlPlotWindow("TestOrbit", "", 0, 0, 0, 0, false, 0);
+   StringArray scNames(1, "Sat");
+   RealArray x(1), y(1), z(1, 0.0), v(1, 0.0);
+   ColorMap colors;
+   colors["Sat"] = 0x00A000;
+   for (Integer i = 0; i <= 360; ++i)
+   {
+      x[0] = 7000.0 * GmatMathUtil::Cos(i * GmatMathConstants::RAD_PER_DEG);
+      y[0] = 7000.0 * GmatMathUtil::Sin(i * GmatMathConstants::RAD_PER_DEG);
+      PlotInterface::UpdateGlPlot("TestOrbit", "", scNames, i, x, y, z, v,
+            v, v, colors, colors, false, 0, true, true, false);
+   }
+   PlotInterface::SetGlEndOfRun("TestOrbit");
+
+   plots->Flush();
+
+   out.Put("microseconds per XY update = ", updateTime / points * 1.0e6);
+   out.Validate(FileSize(outPath + "TestXY.png") > 0, true);
+   out.Validate(FileSize(outPath + "TestXY_0000.png") > 0, true);
+   out.Validate(FileSize(outPath + "TestXY_0002.png") > 0, true);
+   out.Validate(FileSize(outPath + "TestXY_0003.png"), -1);
+   out.Validate(FileSize(outPath + "TestOrbit.png") > 0, true);
+
+   PlotInterface::SetPlotReceiver(NULL);
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestConsolePlotReceiver/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestConsolePlotReceiverOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out, outPath);
+      out.Put("\nSuccessfully ran unit testing of ConsolePlotReceiver!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
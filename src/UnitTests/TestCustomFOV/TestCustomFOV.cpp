@@ -0,0 +1,180 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestCustomFOV
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the point and region visibility checks of CustomFOV.
+ *
+ * A star shaped field of view, with tips at 32 degrees and notches at 20
+ * degrees, is checked at points well inside, well outside, and next to the
+ * tips and notches, and with regions inside and straddling the edge.  A
+ * copy of the FOV is checked to give the same answers.  The time per point
+ * check is reported.
+ *
+ * Output file:
+ * TestCustomFOVOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "CustomFOV.hpp"
+#include "RealUtilities.hpp"
+#include "GmatConstants.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Integer STAR_POINTS  = 40;
+   /// Cone angles of the star tips and notches, in degrees
+   const Real    TIP_CONE     = 32.0;
+   const Real    NOTCH_CONE   = 20.0;
+   const Integer LOOKUP_COUNT = 200000;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Visible(CustomFOV &fov, Real coneDeg, Real clockDeg)
+//------------------------------------------------------------------------------
+bool Visible(CustomFOV &fov, Real coneDeg, Real clockDeg)
+{
+   return fov.CheckTargetVisibility(coneDeg * GmatMathConstants::RAD_PER_DEG,
+                                    clockDeg * GmatMathConstants::RAD_PER_DEG);
+}
+
+
+//------------------------------------------------------------------------------
+// bool RegionVisible(CustomFOV &fov, Real coneDeg, Real clockDeg,
+//                    Real radiusDeg)
+//------------------------------------------------------------------------------
+/**
+ * Checks an octagon of the given radius centered at the cone and clock angle.
+ */
+//------------------------------------------------------------------------------
+bool RegionVisible(CustomFOV &fov, Real coneDeg, Real clockDeg, Real radiusDeg)
+{
+   Rvector cone(8), clock(8);
+   for (Integer j = 0; j < 8; ++j)
+   {
+      Real angle = GmatMathConstants::TWO_PI * j / 8.0;
+      cone[j]  = (coneDeg + radiusDeg * GmatMathUtil::Cos(angle)) *
+                 GmatMathConstants::RAD_PER_DEG;
+      clock[j] = (clockDeg + radiusDeg * GmatMathUtil::Sin(angle)) *
+                 GmatMathConstants::RAD_PER_DEG;
+   }
+   return fov.CheckRegionVisibility(cone, clock);
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckFOV(TestOutput &out, CustomFOV &fov)
+//------------------------------------------------------------------------------
+void CheckFOV(TestOutput &out, CustomFOV &fov)
+{
+   Real tipClock   = 720.0 / STAR_POINTS;
+   Real notchClock = 360.0 / STAR_POINTS;
+
+   out.Put("======================================== Test interior and exterior");
+   for (Real clock = 0.0; clock < 360.0; clock += 7.25)
+   {
+      out.Validate(Visible(fov, 5.0, clock), true);
+      out.Validate(Visible(fov, NOTCH_CONE - 2.0, clock), true);
+      out.Validate(Visible(fov, TIP_CONE + 2.0, clock), false);
+      out.Validate(Visible(fov, 60.0, clock), false);
+   }
+
+   out.Put("======================================== Test tips and notches");
+   out.Validate(Visible(fov, TIP_CONE - 0.5, tipClock), true);
+   out.Validate(Visible(fov, TIP_CONE + 0.5, tipClock), false);
+   out.Validate(Visible(fov, NOTCH_CONE - 0.5, notchClock), true);
+   out.Validate(Visible(fov, NOTCH_CONE + 0.5, notchClock), false);
+   out.Validate(Visible(fov, TIP_CONE - 0.5, notchClock), false);
+
+   out.Put("======================================== Test regions");
+   out.Validate(RegionVisible(fov, 5.0, 45.0, 2.0), true);
+   out.Validate(RegionVisible(fov, TIP_CONE, tipClock, 2.0), false);
+   out.Validate(RegionVisible(fov, NOTCH_CONE, notchClock, 2.0), false);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   Rvector cone(STAR_POINTS), clock(STAR_POINTS);
+   for (Integer i = 0; i < STAR_POINTS; ++i)
+   {
+      clock[i] = 360.0 * i / STAR_POINTS;
+      cone[i]  = (i % 2 == 0 ? TIP_CONE : NOTCH_CONE);
+   }
+
+   CustomFOV fov("StarFOV");
+   fov.SetRvectorParameter("ConeAngles", cone);
+   fov.SetRvectorParameter("ClockAngles", clock);
+   fov.Initialize();
+   CheckFOV(out, fov);
+
+   out.Put("======================================== Test copy");
+   CustomFOV copy(fov);
+   CheckFOV(out, copy);
+
+   out.Put("======================================== Benchmark point check");
+   Integer visible = 0;
+   std::chrono::steady_clock::time_point begin =
+         std::chrono::steady_clock::now();
+   for (Integer k = 0; k < LOOKUP_COUNT; ++k)
+   {
+      Real coneDeg  = 40.0 * ((k * 7919) % LOOKUP_COUNT) / LOOKUP_COUNT;
+      Real clockDeg = 360.0 * k / LOOKUP_COUNT;
+      if (Visible(fov, coneDeg, clockDeg))
+         ++visible;
+   }
+   Real elapsed = std::chrono::duration<Real>(
+         std::chrono::steady_clock::now() - begin).count();
+   out.Put("visible fraction = ", Real(visible) / LOOKUP_COUNT);
+   out.Put("microseconds per CheckTargetVisibility = ",
+           elapsed / LOOKUP_COUNT * 1.0e6);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestCustomFOV/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestCustomFOVOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of CustomFOV!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,205 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestDataFileCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for DataFileCache.
+ *
+ * An entry is built for a scratch data file and shared, then found again
+ * while it is in use, mapped from its cache file once it is released, and
+ * rejected after the data file changes.  An EOP file, given as the first
+ * argument with its leap second file as the second, is first read with and
+ * without the cache and the offsets compared.
+ *
+ * Output file:
+ * TestDataFileCacheOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "DataFileCache.hpp"
+#include "EopFile.hpp"
+#include "LeapSecsFileReader.hpp"
+#include "TimeSystemConverter.hpp"
+#include "FileManager.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Integer VALUE_COUNT = 10;
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckEntry(TestOutput &out, const DataFileCache &entry)
+//------------------------------------------------------------------------------
+void CheckEntry(TestOutput &out, const DataFileCache &entry)
+{
+   out.Validate(entry.GetTableSize("Values"), VALUE_COUNT);
+   out.Validate(entry.GetTableSize("Empty"), 0);
+   out.Validate(entry.GetTableSize("Scale"), 1);
+   out.Validate(entry.GetTableSize("Missing"), -1);
+   out.Validate(entry.GetTable("Missing") == NULL, true);
+
+   for (Integer i = 0; i < VALUE_COUNT; ++i)
+      out.Validate(entry.GetTable("Values")[i], 0.5 * i - 1.0);
+   out.Validate(entry.GetTable("Scale")[0], 6378.1363);
+
+   out.Validate(entry.GetText("ModelName"), "Scratch model");
+   out.Validate(entry.GetText("Empty"), "");
+   out.Validate(entry.GetText("Missing"), "");
+}
+
+
+//------------------------------------------------------------------------------
+// void RunEntryTest(TestOutput &out, const std::string &outPath)
+//------------------------------------------------------------------------------
+void RunEntryTest(TestOutput &out, const std::string &outPath)
+{
+   std::string dataFile = outPath + "TestDataFileCacheData.txt";
+   {
+      std::ofstream data(dataFile.c_str());
+      data << "Scratch data file for TestDataFileCache\n";
+   }
+   StringArray files(1, dataFile);
+   FileManager::Instance()->AddFileType("DATA_CACHE_PATH", outPath);
+
+   DataFileCache *built = new DataFileCache;
+   Real values[VALUE_COUNT];
+   for (Integer i = 0; i < VALUE_COUNT; ++i)
+      values[i] = 0.5 * i - 1.0;
+   Real scale = 6378.1363;
+   built->AddTable("Values", values, VALUE_COUNT);
+   built->AddTable("Empty", NULL, 0);
+   built->AddTable("Scale", &scale, 1);
+   built->SetText("ModelName", "Scratch model");
+   built->SetText("Empty", "");
+
+   out.Put("======================================== shared entry");
+   std::shared_ptr<const DataFileCache> shared =
+         DataFileCache::Share(files, "Test", built);
+   CheckEntry(out, *shared);
+   out.Validate(DataFileCache::Find(files, "Test") == shared, true);
+   out.Validate(!DataFileCache::Find(files, "Other"), true);
+
+   out.Put("======================================== entry from the cache file");
+   shared.reset();
+   std::shared_ptr<const DataFileCache> mapped =
+         DataFileCache::Find(files, "Test");
+   out.Validate(!mapped, false);
+   if (mapped)
+   {
+      out.Validate(mapped->IsMapped(), true);
+      CheckEntry(out, *mapped);
+   }
+
+   out.Put("======================================== changed data file");
+   mapped.reset();
+   {
+      std::ofstream data(dataFile.c_str(), std::ios::app);
+      data << "A second line changes the file size\n";
+   }
+   out.Validate(!DataFileCache::Find(files, "Test"), true);
+}
+
+
+//------------------------------------------------------------------------------
+// Real ReadEop(const std::string &eopFile, RealArray &offsets)
+//------------------------------------------------------------------------------
+Real ReadEop(const std::string &eopFile, RealArray &offsets)
+{
+   std::chrono::steady_clock::time_point begin =
+         std::chrono::steady_clock::now();
+   EopFile eop(eopFile);
+   eop.Initialize();
+   Real elapsed = std::chrono::duration<Real>(
+         std::chrono::steady_clock::now() - begin).count();
+
+   Real timeMin, timeMax;
+   eop.GetTimeRange(timeMin, timeMax);
+   offsets.clear();
+   for (Real t = timeMin + 0.25; t < timeMax; t += 97.3)
+   {
+      Real x, y, lod;
+      offsets.push_back(eop.GetUt1UtcOffset(t));
+      eop.GetPolarMotionAndLod(GmatTime(t + GmatTimeConstants::JD_JAN_5_1941 -
+            GmatTimeConstants::JD_NOV_17_1858), x, y, lod);
+      offsets.push_back(x);
+      offsets.push_back(y);
+      offsets.push_back(lod);
+   }
+   return elapsed;
+}
+
+
+//------------------------------------------------------------------------------
+// void RunEopTest(TestOutput &out, const std::string &outPath,
+//                 const std::string &eopFile, const std::string &leapFile)
+//------------------------------------------------------------------------------
+void RunEopTest(TestOutput &out, const std::string &outPath,
+                const std::string &eopFile, const std::string &leapFile)
+{
+   LeapSecsFileReader *leapSecs = new LeapSecsFileReader(leapFile);
+   leapSecs->Initialize();
+   TimeSystemConverter::Instance()->SetLeapSecsFileReader(leapSecs);
+
+   out.Put("======================================== EOP file cache");
+   RealArray parsed, written, restored;
+   Real parseTime = ReadEop(eopFile, parsed);
+
+   FileManager::Instance()->AddFileType("DATA_CACHE_PATH", outPath);
+   ReadEop(eopFile, written);
+   Real mappedTime = ReadEop(eopFile, restored);
+
+   out.Validate(written.size() == parsed.size(), true);
+   out.Validate(restored.size() == parsed.size(), true);
+   bool same = (written == parsed) && (restored == parsed);
+   out.Validate(same, true);
+   out.Put("milliseconds to parse = ", parseTime * 1.0e3);
+   out.Put("milliseconds to map = ", mappedTime * 1.0e3);
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestDataFileCache/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestDataFileCacheOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      // The EOP file is parsed first, before the cache directory is set
+      if (argc > 2)
+         RunEopTest(out, outPath, argv[1], argv[2]);
+      RunEntryTest(out, outPath);
+      out.Put("\nSuccessfully ran unit testing of DataFileCache!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
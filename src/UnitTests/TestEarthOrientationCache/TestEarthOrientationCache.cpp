@@ -0,0 +1,132 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TestEarthOrientationCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Regression test for the X, Y, s values of EarthOrientationCache.
+ *
+ * The IAU-2000/2006 X, Y and s values the ITRF axes take from the cache are
+ * compared with the direct ninth order interpolation of the data file, at
+ * epochs off the grid nodes over twenty years.  The largest differences are
+ * held to XYS_TOLERANCE.  Epochs near the ends of the file, where the cache
+ * sends the caller back to the file, are counted but not compared.
+ *
+ * The IAU file is found through the startup file.
+ *
+ * Output file:
+ * TestEarthOrientationCacheOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "IAUFile.hpp"
+#include "EarthOrientationCache.hpp"
+#include "FileManager.hpp"
+#include "GmatBaseException.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   /// Largest difference allowed between the cached and the direct X, Y and s,
+   /// in arcsec (0.3 mm at the Earth's surface)
+   const Real XYS_TOLERANCE = 1.0e-5;
+   /// First epoch compared, TT Julian date (J2000)
+   const Real FIRST_JD = 2451545.0;
+   /// Span compared, days
+   const Real SPAN     = 20.0 * 365.25;
+   /// Step between the epochs; not a multiple of the node spacing
+   const Real STEP     = 0.1234567;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   IAUFile *iauFile = IAUFile::Instance();
+   iauFile->Initialize();
+
+   EarthOrientationCache *cache = EarthOrientationCache::Instance();
+   cache->Clear();
+
+   Real maxDiff[3] = {0.0, 0.0, 0.0};
+   Integer compared = 0, fromFile = 0;
+   Real cached[3], direct[3];
+
+   for (Real jd = FIRST_JD; jd < FIRST_JD + SPAN; jd += STEP)
+   {
+      if (!iauFile->Covers(jd))
+         continue;
+      if (!cache->GetIAUData(iauFile, jd, cached))
+      {
+         ++fromFile;
+         continue;
+      }
+      iauFile->GetIAUData(jd, direct, 3, 9);
+      for (Integer i = 0; i < 3; ++i)
+         maxDiff[i] = max(maxDiff[i], fabs(cached[i] - direct[i]));
+      ++compared;
+   }
+
+   out.Put("======================================== epochs compared");
+   out.Put("Compared: ", compared);
+   out.Put("Taken from the file near its ends: ", fromFile);
+   out.Validate(compared > 0, true);
+   out.Validate(compared > 100 * fromFile, true);
+
+   out.Put("======================================== largest differences, arcsec");
+   out.Put("X");
+   out.Validate(maxDiff[0], 0.0, XYS_TOLERANCE);
+   out.Put("Y");
+   out.Validate(maxDiff[1], 0.0, XYS_TOLERANCE);
+   out.Put("s");
+   out.Validate(maxDiff[2], 0.0, XYS_TOLERANCE);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   std::string startupFile = "gmat_startup_file.txt";
+   FileManager *fm = FileManager::Instance();
+   fm->ReadStartupFile(startupFile);
+
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestEarthOrientationCache/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestEarthOrientationCacheOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of EarthOrientationCache!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,157 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestEnckeReference
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for EnckeReference.
+ *
+ * The universal variable Kepler solution is checked on elliptic, parabolic
+ * and hyperbolic orbits: energy and angular momentum are conserved, a
+ * propagation forward and back returns the starting state, and an elliptic
+ * orbit returns to its start after one period.  The reference times are then
+ * checked to combine epochs and offsets consistently.
+ *
+ * Output file:
+ * TestEnckeReferenceOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include "gmatdefs.hpp"
+#include "EnckeReference.hpp"
+#include "GmatConstants.hpp"
+#include "RealUtilities.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Real MU = 398600.4415;
+
+   Real Energy(const Real *s)
+   {
+      Real r = GmatMathUtil::Sqrt(s[0]*s[0] + s[1]*s[1] + s[2]*s[2]);
+      return 0.5 * (s[3]*s[3] + s[4]*s[4] + s[5]*s[5]) - MU / r;
+   }
+
+   Real Difference(const Real *a, const Real *b, Integer start)
+   {
+      Real sum = 0.0;
+      for (Integer i = start; i < start + 3; ++i)
+         sum += (a[i] - b[i]) * (a[i] - b[i]);
+      return GmatMathUtil::Sqrt(sum);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("======================================== Test conic types");
+   Real starts[3][6] =
+   {
+      {7000.0, 0.0, 0.0, 0.0, 7.5, 1.0},                    // Elliptic
+      {7000.0, 0.0, 0.0, 0.0, 10.671730901, 0.0},           // Parabolic
+      {7000.0, 100.0, 0.0, 0.1, 12.0, 0.5}                  // Hyperbolic
+   };
+   Real spans[4] = {10.0, -3000.0, 20000.0, 86400.0};
+
+   for (Integer c = 0; c < 3; ++c)
+   {
+      const Real *s0 = starts[c];
+      Real h0[3] = {s0[1]*s0[5] - s0[2]*s0[4], s0[2]*s0[3] - s0[0]*s0[5],
+                    s0[0]*s0[4] - s0[1]*s0[3]};
+      for (Integer k = 0; k < 4; ++k)
+      {
+         Real s1[6], s2[6], chi = 0.0;
+         out.Validate(EnckeReference::SolveKepler(s0, MU, spans[k], s1, chi),
+               true);
+         Real h1[3] = {s1[1]*s1[5] - s1[2]*s1[4], s1[2]*s1[3] - s1[0]*s1[5],
+                       s1[0]*s1[4] - s1[1]*s1[3]};
+         out.Validate(GmatMathUtil::Abs(Energy(s1) - Energy(s0)) < 1.0e-9,
+               true);
+         out.Validate(Difference(h0, h1, 0) < 1.0e-6, true);
+
+         chi = 0.0;
+         out.Validate(EnckeReference::SolveKepler(s1, MU, -spans[k], s2, chi),
+               true);
+         out.Validate(Difference(s0, s2, 0) < 1.0e-6, true);
+         out.Validate(Difference(s0, s2, 3) < 1.0e-9, true);
+      }
+   }
+
+   Real chi = 0.0, s1[6];
+   const Real *s0 = starts[0];
+   Real a = -0.5 * MU / Energy(s0);
+   Real period = GmatMathConstants::TWO_PI * GmatMathUtil::Sqrt(a * a * a / MU);
+   EnckeReference::SolveKepler(s0, MU, period, s1, chi);
+   out.Put("Position error after one period, km:");
+   out.Put(Difference(s0, s1, 0));
+   out.Validate(Difference(s0, s1, 0) < 1.0e-6, true);
+
+   out.Put("======================================== Test reference times");
+   EnckeReference reference;
+   reference.SetMu(MU);
+   reference.SetSize(2);
+   reference.Rectify(0, s0, 25000.0, 0.0);
+   reference.Rectify(1, s0, 25000.0, 600.0);
+
+   Real state[6], accel[3], other[6];
+   reference.GetState(0, 25000.0, 0.0, state, accel);
+   out.Validate(Difference(s0, state, 0), 0.0);
+   out.Validate(accel[0], -MU / (7000.0 * 7000.0));
+
+   // 1200 seconds after the first reference is 600 after the second
+   reference.GetState(0, 25000.0, 1200.0, state, NULL);
+   reference.GetState(1, 25000.0, 1200.0, other, NULL);
+   chi = 0.0;
+   EnckeReference::SolveKepler(s0, MU, 600.0, s1, chi);
+   out.Validate(Difference(other, s1, 0) < 1.0e-9, true);
+   out.Validate(Difference(state, other, 0) > 1.0, true);
+
+   // An epoch one day on, expressed with a negative offset
+   reference.GetState(0, 25001.0, -86400.0 + 1200.0, other, NULL);
+   out.Validate(Difference(state, other, 0) < 1.0e-6, true);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestEnckeReference/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestEnckeReferenceOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of EnckeReference!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
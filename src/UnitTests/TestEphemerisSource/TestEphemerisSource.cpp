@@ -0,0 +1,148 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestEphemerisSource
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for EphemerisSource.
+ *
+ * A source is built for a scratch ephemeris file and shared, then found again
+ * while it is in use, mapped from its cache file once it is released, and
+ * rejected after the ephemeris file changes.
+ *
+ * Output file:
+ * TestEphemerisSourceOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include "gmatdefs.hpp"
+#include "EphemerisSource.hpp"
+#include "FileManager.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Integer POINT_COUNT = 10;
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckSource(TestOutput &out, const EphemerisSource &source)
+//------------------------------------------------------------------------------
+void CheckSource(TestOutput &out, const EphemerisSource &source)
+{
+   out.Validate(source.GetSegmentCount(), 2);
+   out.Validate(source.GetTotalPointCount(), POINT_COUNT);
+   out.Validate(source.GetPointCount(0), 4);
+   out.Validate(source.GetPointCount(1), 6);
+   out.Validate(source.GetSegmentStart(1), 21545.0 + 3.0 / 24.0);
+   out.Validate(source.GetSegmentEnd(1), 21545.0 + 9.0 / 24.0);
+
+   for (Integer i = 0; i < POINT_COUNT; ++i)
+   {
+      Integer seg = (i < 4 ? 0 : 1);
+      Integer pt = (i < 4 ? i : i - 4);
+      out.Validate(source.GetEpochs(seg)[pt], 21545.0 + i / 24.0);
+      out.Validate(source.GetState(seg, pt)[0], 7000.0 + i);
+      out.Validate(source.GetState(seg, pt)[5], -i / 10.0);
+   }
+
+   out.Validate(source.GetMetadata("CENTER_NAME", 1), "EARTH");
+   out.Validate(source.GetMetadata("Comment"), "file level value");
+   out.Validate(source.GetMetadata("CENTER_NAME"), "");
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out, const std::string &outPath)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out, const std::string &outPath)
+{
+   std::string ephemFile = outPath + "TestEphemerisSourceData.txt";
+   {
+      std::ofstream data(ephemFile.c_str());
+      data << "Scratch ephemeris for TestEphemerisSource\n";
+   }
+   FileManager::Instance()->AddFileType("EPHEM_CACHE_PATH", outPath);
+
+   EphemerisSource *built = new EphemerisSource;
+   Real state[6];
+   for (Integer i = 0; i < POINT_COUNT; ++i)
+   {
+      if ((i == 0) || (i == 4))
+         built->AddSegment(21545.0 + (i == 0 ? 0.0 : 3.0 / 24.0));
+      for (Integer j = 0; j < 6; ++j)
+         state[j] = (j == 5 ? -i / 10.0 : 7000.0 + i + j);
+      built->AddPoint(21545.0 + i / 24.0, state);
+   }
+   built->SetMetadata("CENTER_NAME", "EARTH", 1);
+   built->SetMetadata("Comment", "file level value");
+
+   out.Put("======================================== shared source");
+   std::shared_ptr<const EphemerisSource> shared =
+         EphemerisSource::Share(ephemFile, "Test", built);
+   CheckSource(out, *shared);
+   out.Validate(EphemerisSource::Find(ephemFile, "Test") == shared, true);
+   out.Validate(!EphemerisSource::Find(ephemFile, "Other"), true);
+
+   out.Put("======================================== source from the cache file");
+   shared.reset();
+   std::shared_ptr<const EphemerisSource> mapped =
+         EphemerisSource::Find(ephemFile, "Test");
+   out.Validate(!mapped, false);
+   if (mapped)
+   {
+      out.Validate(mapped->IsMapped(), true);
+      CheckSource(out, *mapped);
+   }
+
+   out.Put("======================================== changed ephemeris file");
+   mapped.reset();
+   {
+      std::ofstream data(ephemFile.c_str(), std::ios::app);
+      data << "A second line changes the file size\n";
+   }
+   out.Validate(!EphemerisSource::Find(ephemFile, "Test"), true);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestEphemerisSource/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestEphemerisSourceOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out, outPath);
+      out.Put("\nSuccessfully ran unit testing of EphemerisSource!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
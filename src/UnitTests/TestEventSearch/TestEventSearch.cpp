@@ -0,0 +1,263 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestEventSearch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for TrajectoryStore and the EventSearch root finding.
+ *
+ * A circular orbit sampled every 60 s checks the Hermite interpolation between
+ * and past the samples, and an arc break checks that the windows do not cross
+ * it.  The interval search is run on the shadow of a sphere along the same
+ * orbit, where the exact entry and exit are known, through RunTasks() on
+ * several threads and by the rate bounded search.  The maximum search and the
+ * occultation geometry are checked against closed form cases.
+ *
+ * Output file:
+ * TestEventSearchOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TrajectoryStore.hpp"
+#include "EventSearch.hpp"
+#include "GmatConstants.hpp"
+#include "UtilityException.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+static const Real RADIUS = 7000.0;
+static const Real PERIOD = 5828.5;    // seconds
+static const Real T0     = 25000.0;
+
+//------------------------------------------------------------------------------
+// void Circular(Real a1Mjd, Real *state)
+//------------------------------------------------------------------------------
+void Circular(Real a1Mjd, Real *state)
+{
+   Real n = GmatMathConstants::TWO_PI / PERIOD;
+   Real theta = n * (a1Mjd - T0) * GmatTimeConstants::SECS_PER_DAY;
+   state[0] =  RADIUS * cos(theta);
+   state[1] =  RADIUS * sin(theta);
+   state[2] =  0.0;
+   state[3] = -RADIUS * n * sin(theta);
+   state[4] =  RADIUS * n * cos(theta);
+   state[5] =  0.0;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("========================= Test TrajectoryStore interpolation");
+
+   TrajectoryStore store;
+   Real state[6], exact[6];
+   Real step = 60.0 / GmatTimeConstants::SECS_PER_DAY;
+   for (Integer i = 0; i <= 200; ++i)
+   {
+      Circular(T0 + i * step, state);
+      store.AddState(T0 + i * step, state);
+   }
+   out.Validate(store.GetCount(), 201);
+   out.Validate(store.AddState(T0, state), false);
+
+   Real maxDr = 0.0, maxDv = 0.0;
+   for (Integer i = 0; i < 1990; ++i)
+   {
+      Real t = T0 + (i + 0.37) * step / 10.0;
+      store.GetState(t, state);
+      Circular(t, exact);
+      for (Integer c = 0; c < 3; ++c)
+      {
+         maxDr = max(maxDr, fabs(state[c] - exact[c]));
+         maxDv = max(maxDv, fabs(state[c+3] - exact[c+3]));
+      }
+   }
+   out.Put("max position error (km)   = ", maxDr);
+   out.Put("max velocity error (km/s) = ", maxDv);
+   out.Validate(maxDr < 1.0e-6, true);
+   out.Validate(maxDv < 1.0e-8, true);
+
+   // Ten seconds past the end is extrapolated from the last window
+   Real tEnd = store.GetEndEpoch() + 10.0 / GmatTimeConstants::SECS_PER_DAY;
+   store.GetState(tEnd, state);
+   Circular(tEnd, exact);
+   out.Validate(fabs(state[0] - exact[0]) < 1.0e-4, true);
+
+   // A repeated epoch starts an arc; the velocity change is kept
+   TrajectoryStore burn;
+   for (Integer i = 0; i <= 10; ++i)
+   {
+      Circular(T0 + i * step, state);
+      burn.AddState(T0 + i * step, state);
+   }
+   Real last = T0 + 10 * step;
+   for (Integer i = 0; i <= 10; ++i)
+   {
+      Circular(last + i * step, state);
+      state[4] += 0.1;
+      state[1] += 0.1 * i * 60.0;
+      burn.AddState(last + i * step, state);
+   }
+   burn.GetState(last - step / 2.0, state);
+   Circular(last - step / 2.0, exact);
+   out.Validate(fabs(state[4] - exact[4]) < 1.0e-8, true);
+   burn.GetState(last + step / 2.0, state);
+   Circular(last + step / 2.0, exact);
+   out.Validate(fabs(state[4] - exact[4] - 0.1) < 1.0e-8, true);
+
+   out.Put("========================= Test EventSearch intervals");
+
+   // Shadow of a sphere of radius 6378 km lit along +x: the orbit is dark
+   // while x < 0 and |y| < 6378
+   EventSearch::Condition inShadow = [&store](Real epoch)
+   {
+      Real st[6];
+      store.GetState(epoch, st);
+      return (st[0] < 0.0) && (fabs(st[1]) < 6378.0);
+   };
+   Real halfAngle = asin(6378.0 / RADIUS);
+   Real entry = T0 + (GmatMathConstants::PI - halfAngle) / GmatMathConstants::TWO_PI *
+                PERIOD / GmatTimeConstants::SECS_PER_DAY;
+   Real exit  = T0 + (GmatMathConstants::PI + halfAngle) / GmatMathConstants::TWO_PI *
+                PERIOD / GmatTimeConstants::SECS_PER_DAY;
+
+   std::vector<RealArray> starts(4), ends(4);
+   std::vector<EventSearch::Task> tasks;
+   for (Integer k = 0; k < 4; ++k)
+      tasks.push_back([&, k]()
+      {
+         EventSearch::FindIntervals(inShadow, store.GetStartEpoch(),
+               store.GetEndEpoch(), 10.0 * (k + 1), starts[k], ends[k]);
+      });
+   EventSearch::RunTasks(tasks, 3);
+
+   for (Integer k = 0; k < 4; ++k)
+   {
+      out.Validate((Integer)starts[k].size(), 2);
+      out.Validate((Integer)ends[k].size(), 2);
+      Real dStart = fabs(starts[k][0] - entry) * GmatTimeConstants::SECS_PER_DAY;
+      Real dEnd   = fabs(ends[k][0] - exit) * GmatTimeConstants::SECS_PER_DAY;
+      out.Put("entry error (s) = ", dStart);
+      out.Put("exit error (s)  = ", dEnd);
+      out.Validate(dStart < 1.0e-4, true);
+      out.Validate(dEnd < 1.0e-4, true);
+   }
+
+   // The same shadow from the bounded search: -x exceeds R cos(halfAngle)
+   // in it, and changes no faster than the orbital speed
+   Real speed = RADIUS * GmatMathConstants::TWO_PI / PERIOD;
+   RealArray boundedStarts, boundedEnds;
+   Integer samples = EventSearch::FindBoundedIntervals(
+         [&store, halfAngle](Real epoch)
+         {
+            Real st[6];
+            store.GetState(epoch, st);
+            return -st[0] - RADIUS * cos(halfAngle);
+         }, speed, store.GetStartEpoch(), store.GetEndEpoch(), 60.0,
+         boundedStarts, boundedEnds);
+   out.Validate((Integer)boundedStarts.size(), 2);
+   out.Validate((Integer)boundedEnds.size(), 2);
+   out.Validate(fabs(boundedStarts[0] - entry) * GmatTimeConstants::SECS_PER_DAY <
+                1.0e-4, true);
+   out.Validate(fabs(boundedEnds[0] - exit) * GmatTimeConstants::SECS_PER_DAY <
+                1.0e-4, true);
+   out.Put("bounded search samples = ", (Real)samples);
+   out.Validate(samples < 12000 / 60, true);
+
+   // Exceptions thrown by a task reach the caller
+   tasks.clear();
+   tasks.push_back([]() { throw UtilityException("task failure"); });
+   bool caught = false;
+   try
+   {
+      EventSearch::RunTasks(tasks, 2);
+   }
+   catch (BaseException &)
+   {
+      caught = true;
+   }
+   out.Validate(caught, true);
+
+   out.Put("========================= Test EventSearch maximum and geometry");
+
+   Real peak = T0 + 0.3;
+   Real found = EventSearch::FindMaximum([peak](Real t)
+         { return -(t - peak) * (t - peak); }, T0, T0 + 1.0, 600.0);
+   out.Validate(fabs(found - peak) * GmatTimeConstants::SECS_PER_DAY < 1.0e-3,
+                true);
+   found = EventSearch::FindMaximum([](Real t) { return t; }, T0, T0 + 1.0,
+                                    600.0);
+   out.Validate(fabs(found - (T0 + 1.0)) * GmatTimeConstants::SECS_PER_DAY <
+                1.0e-3, true);
+
+   Real sun[3] = {1.496e8, 0.0, 0.0};
+   Real body[3] = {300000.0, 0.0, 0.0};
+   out.Validate((Integer)EventSearch::GetOccultation(body, 1737.4, sun, 695700.0),
+                (Integer)EventSearch::FULL_OCCULTATION);
+   Real farBody[3] = {420000.0, 0.0, 0.0};
+   out.Validate((Integer)EventSearch::GetOccultation(farBody, 1737.4, sun, 695700.0),
+                (Integer)EventSearch::ANNULAR_OCCULTATION);
+   Real offset[3] = {384400.0, 3000.0, 0.0};
+   out.Validate((Integer)EventSearch::GetOccultation(offset, 1737.4, sun, 695700.0),
+                (Integer)EventSearch::PARTIAL_OCCULTATION);
+   Real behind[3] = {-384400.0, 0.0, 0.0};
+   out.Validate((Integer)EventSearch::GetOccultation(behind, 1737.4, sun, 695700.0),
+                (Integer)EventSearch::NO_OCCULTATION);
+
+   Real target[3] = {20000.0, 0.0, 0.0};
+   Real front[3]  = {10000.0, 100.0, 0.0};
+   Real clear[3]  = {10000.0, 3000.0, 0.0};
+   out.Validate(EventSearch::IsOcculted(front, 1000.0, target), true);
+   out.Validate(EventSearch::IsOcculted(clear, 1000.0, target), false);
+
+   EventSearch::Correction corr = EventSearch::ParseCorrection("XCN+S");
+   out.Validate(corr.transmit && corr.converged && corr.lightTime &&
+                corr.stellar, true);
+   corr = EventSearch::ParseCorrection("NONE");
+   out.Validate(corr.lightTime || corr.stellar, false);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestEventSearch/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestEventSearchOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of EventSearch!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
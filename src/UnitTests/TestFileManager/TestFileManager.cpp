@@ -27,6 +27,8 @@
 #include "ConsoleMessageReceiver.hpp"
 
 #include <iostream>
+#include <fstream>
+#include <cstdio>
 
 using namespace std;
 
@@ -248,8 +250,8 @@ int RunTest(TestOutput &out)
    dir = fm->GetGmatWorkingDirectory();
    out.Put("GMAT working directory = " + dir);
    
-   out.Put("\n------------------------- test GetWorkingDirectory()");
-   dir = fm->GetWorkingDirectory();
+   out.Put("\n------------------------- test GetCurrentWorkingDirectory()");
+   dir = fm->GetCurrentWorkingDirectory();
    out.Put("current directory = " + dir);
    
    out.Put("\n------------------------- test FindPath(AbsPath) - Exist");
@@ -304,6 +306,29 @@ int RunTest(TestOutput &out)
    result = fm->GetFullPathname("SPLASH_FILE");
    out.Put(result);
    
+   out.Put("\n------------------------- test existence cache");
+   std::string probeFile = "../../TestFileManager/CacheProbe.txt";
+   remove(probeFile.c_str());
+   out.Validate(fm->DoesFileExist(probeFile), false);
+   std::ofstream probe(probeFile.c_str());
+   probe << "probe" << std::endl;
+   probe.close();
+   // Missing files are not cached, so the new file is found
+   out.Validate(fm->DoesFileExist(probeFile), true);
+   remove(probeFile.c_str());
+   // A file found is remembered until the cache is cleared
+   out.Validate(fm->DoesFileExist(probeFile), true);
+   fm->ClearPathCache();
+   out.Validate(fm->DoesFileExist(probeFile), false);
+   probe.open(probeFile.c_str());
+   probe << "probe" << std::endl;
+   probe.close();
+   out.Validate(fm->DoesFileExist(probeFile), true);
+   remove(probeFile.c_str());
+   // Resolving the file for output drops its cached result
+   result = fm->FindPath(probeFile, "OUTPUT_PATH", false);
+   out.Validate(fm->DoesFileExist(probeFile), false);
+   
    out.Put("\n------------------------- test OutOfBounds exception");
    try
    {
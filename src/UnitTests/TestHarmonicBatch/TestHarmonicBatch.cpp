@@ -0,0 +1,275 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestHarmonicBatch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver and throughput benchmark for Harmonic::CalculateFieldBatch.
+ *
+ * A synthetic field (no coefficient file needed) is evaluated at a ring of
+ * positions, once through the per-position CalculateField loop used by
+ * GravityField today and once through the batched structure-of-arrays path.
+ * The accelerations are validated against each other and the evaluation
+ * rates are written out for degrees 20, 70 and 120.  The batch is also run
+ * with four threads, which must reproduce the single thread results exactly.
+ *
+ * A 32 member cluster is then evaluated through CalculateFieldDifferential,
+ * which linearizes the field about the first member, and checked against the
+ * exact batch results.
+ *
+ * Output file:
+ * TestHarmonicBatchOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <ctime>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "Harmonic.hpp"
+#include "Rmatrix33.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------------------
+// Harmonic with deterministic, decaying pseudo-coefficients
+//------------------------------------------------------------------------------
+class SyntheticHarmonic : public Harmonic
+{
+public:
+   SyntheticHarmonic(Integer degree)
+   {
+      NN = MM = degree;
+      FieldRadius = 6378.1363;
+      Factor = -398600.4415;
+      Allocate();
+      for (Integer n = 2; n <= NN; ++n)
+         for (Integer m = 0; m <= n; ++m)
+         {
+            C[n][m] = 1.0e-6 * sin(1.0 + n * 0.37 + m * 0.11) / (n * n);
+            S[n][m] = (m == 0 ? 0.0 :
+                       1.0e-6 * cos(2.0 + n * 0.23 + m * 0.19) / (n * n));
+         }
+      C[2][0] = -4.84165e-4;
+   }
+
+   virtual Real Cnm(const Real& jday, const Integer& n, const Integer& m) const
+   {
+      return C[n][m];
+   }
+
+   virtual Real Snm(const Real& jday, const Integer& n, const Integer& m) const
+   {
+      return S[n][m];
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// void RunDegree(Integer degree, Integer count, Integer reps, TestOutput &out)
+//------------------------------------------------------------------------------
+void RunDegree(Integer degree, Integer count, Integer reps, TestOutput &out)
+{
+   SyntheticHarmonic field(degree);
+   HarmonicWorkspace ws;
+   Rmatrix33 grad;
+
+   vector<Real> px(count), py(count), pz(count);
+   vector<Real> ax(count), ay(count), az(count);
+   for (Integer k = 0; k < count; ++k)
+   {
+      Real lon = 2.0 * M_PI * k / count;
+      Real lat = 1.2 * sin(3.0 * lon);
+      Real r   = 6778.0 + 500.0 * cos(lon);
+      px[k] = r * cos(lat) * cos(lon);
+      py[k] = r * cos(lat) * sin(lon);
+      pz[k] = r * sin(lat);
+   }
+
+   // Validate batch results against the per-position path
+   Real maxErr = 0.0;
+   field.CalculateFieldBatch(0.0, count, &px[0], &py[0], &pz[0], degree,
+         degree, &ax[0], &ay[0], &az[0], ws);
+   for (Integer k = 0; k < count; ++k)
+   {
+      Real pos[3] = {px[k], py[k], pz[k]}, acc[3];
+      field.CalculateField(0.0, pos, degree, degree, false, 0, acc, grad, ws);
+      Real err = (fabs(acc[0] - ax[k]) + fabs(acc[1] - ay[k]) +
+                  fabs(acc[2] - az[k])) /
+                 (fabs(acc[0]) + fabs(acc[1]) + fabs(acc[2]));
+      if (err > maxErr)
+         maxErr = err;
+   }
+   out.Put("degree = ", degree);
+   out.Put("max relative difference = ", maxErr);
+   out.Validate(maxErr < 1.0e-12, true);
+
+   // Threaded batches share the blocks out, but evaluate each one the same way
+   HarmonicWorkspace threaded;
+   threaded.BatchThreads = 4;
+   vector<Real> tx(count), ty(count), tz(count);
+   field.CalculateFieldBatch(0.0, count, &px[0], &py[0], &pz[0], degree,
+         degree, &tx[0], &ty[0], &tz[0], threaded);
+   bool same = true;
+   for (Integer k = 0; k < count; ++k)
+      if ((tx[k] != ax[k]) || (ty[k] != ay[k]) || (tz[k] != az[k]))
+         same = false;
+   out.Put("threaded batch matches = ", same);
+   out.Validate(same, true);
+
+   // Throughput
+   clock_t start = clock();
+   for (Integer rep = 0; rep < reps; ++rep)
+      for (Integer k = 0; k < count; ++k)
+      {
+         Real pos[3] = {px[k], py[k], pz[k]}, acc[3];
+         field.CalculateField(0.0, pos, degree, degree, false, 0, acc, grad,
+               ws);
+      }
+   Real single = Real(clock() - start) / CLOCKS_PER_SEC;
+
+   start = clock();
+   for (Integer rep = 0; rep < reps; ++rep)
+      field.CalculateFieldBatch(0.0, count, &px[0], &py[0], &pz[0], degree,
+            degree, &ax[0], &ay[0], &az[0], ws);
+   Real batch = Real(clock() - start) / CLOCKS_PER_SEC;
+
+   // clock() adds up the time of every thread, so use the wall clock here
+   std::chrono::steady_clock::time_point wallStart =
+         std::chrono::steady_clock::now();
+   for (Integer rep = 0; rep < reps; ++rep)
+      field.CalculateFieldBatch(0.0, count, &px[0], &py[0], &pz[0], degree,
+            degree, &tx[0], &ty[0], &tz[0], threaded);
+   std::chrono::duration<Real> wall =
+         std::chrono::steady_clock::now() - wallStart;
+
+   Real evals = Real(count) * reps;
+   out.Put("per-position accelerations/sec = ", evals / single);
+   out.Put("batched      accelerations/sec = ", evals / batch);
+   out.Put("4 thread     accelerations/sec = ", evals / wall.count());
+}
+
+
+//------------------------------------------------------------------------------
+// void RunCluster(Integer degree, Real size, Integer reps, TestOutput &out)
+//------------------------------------------------------------------------------
+void RunCluster(Integer degree, Real size, Integer reps, TestOutput &out)
+{
+   const Integer count = 32;
+   SyntheticHarmonic field(degree);
+   HarmonicWorkspace ws;
+
+   // Members spread over a box of the given size about a chief at 6778 km
+   vector<Real> px(count), py(count), pz(count);
+   vector<Real> ax(count), ay(count), az(count);
+   vector<Real> dx(count), dy(count), dz(count);
+   for (Integer k = 0; k < count; ++k)
+   {
+      Real s = (k == 0 ? 0.0 : size);
+      px[k] = 4123.0 + s * sin(1.3 * k);
+      py[k] = 5021.0 + s * cos(0.7 * k);
+      pz[k] = 1842.0 + s * sin(2.9 * k + 0.5);
+   }
+
+   field.CalculateFieldBatch(0.0, count, &px[0], &py[0], &pz[0], degree,
+         degree, &ax[0], &ay[0], &az[0], ws);
+   field.CalculateFieldDifferential(0.0, count, &px[0], &py[0], &pz[0],
+         degree, degree, 2.0 * size, &dx[0], &dy[0], &dz[0], ws);
+
+   Real maxErr = 0.0;
+   for (Integer k = 0; k < count; ++k)
+   {
+      Real err = (fabs(dx[k] - ax[k]) + fabs(dy[k] - ay[k]) +
+                  fabs(dz[k] - az[k])) /
+                 (fabs(ax[k]) + fabs(ay[k]) + fabs(az[k]));
+      if (err > maxErr)
+         maxErr = err;
+   }
+   out.Put("degree = ", degree);
+   out.Put("cluster size (km) = ", size);
+   out.Put("max relative perturbation difference = ", maxErr);
+   out.Validate(maxErr < 1.0e-3, true);
+
+   // Members outside the radius are evaluated in full
+   field.CalculateFieldDifferential(0.0, count, &px[0], &py[0], &pz[0],
+         degree, degree, 0.0, &dx[0], &dy[0], &dz[0], ws);
+   maxErr = 0.0;
+   for (Integer k = 0; k < count; ++k)
+      maxErr = max(maxErr, fabs(dx[k] - ax[k]) + fabs(dy[k] - ay[k]) +
+            fabs(dz[k] - az[k]));
+   out.Validate(maxErr < 1.0e-18, true);
+
+   // Throughput
+   clock_t start = clock();
+   for (Integer rep = 0; rep < reps; ++rep)
+      field.CalculateFieldBatch(0.0, count, &px[0], &py[0], &pz[0], degree,
+            degree, &ax[0], &ay[0], &az[0], ws);
+   Real batch = Real(clock() - start) / CLOCKS_PER_SEC;
+
+   start = clock();
+   for (Integer rep = 0; rep < reps; ++rep)
+      field.CalculateFieldDifferential(0.0, count, &px[0], &py[0], &pz[0],
+            degree, degree, 2.0 * size, &dx[0], &dy[0], &dz[0], ws);
+   Real differential = Real(clock() - start) / CLOCKS_PER_SEC;
+
+   Real evals = Real(count) * reps;
+   out.Put("batched      accelerations/sec = ", evals / batch);
+   out.Put("differential accelerations/sec = ", evals / differential);
+}
+
+
+//------------------------------------------------------------------------------
+//int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("========================= Test CalculateFieldBatch()");
+   RunDegree(20,  200, 200, out);
+   RunDegree(70,  200,  20, out);
+   RunDegree(120, 200,   5, out);
+
+   out.Put("========================= Test CalculateFieldDifferential()");
+   RunCluster(20,  10.0, 200, out);
+   RunCluster(70,  10.0,  20, out);
+   RunCluster(120,  1.0,   5, out);
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestHarmonicBatch/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestHarmonicBatchOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of Harmonic batch evaluation!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,175 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestHarmonicKernel
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver and micro-benchmark for the packed-triangular Legendre kernel
+ * (HarmonicKernel) used by Harmonic::CalculateField.
+ *
+ * A synthetic field is evaluated at degree and order 20, 70 and 360 with the
+ * packed kernel and with the Real** recursion.  The accelerations are
+ * validated against each other and the accelerations/second of both paths
+ * are written out, along with the instruction set picked at run time.
+ *
+ * Output file:
+ * TestHarmonicKernelOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <ctime>
+#include "gmatdefs.hpp"
+#include "Harmonic.hpp"
+#include "HarmonicKernel.hpp"
+#include "Rmatrix33.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------------------
+// Harmonic with deterministic, decaying pseudo-coefficients
+//------------------------------------------------------------------------------
+class SyntheticHarmonic : public Harmonic
+{
+public:
+   SyntheticHarmonic(Integer degree)
+   {
+      NN = MM = degree;
+      FieldRadius = 1738.0;
+      Factor = -4902.8001;
+      Allocate();
+      for (Integer n = 2; n <= NN; ++n)
+         for (Integer m = 0; m <= n; ++m)
+         {
+            C[n][m] = 1.0e-5 * sin(1.0 + n * 0.37 + m * 0.11) / (n * n);
+            S[n][m] = (m == 0 ? 0.0 :
+                       1.0e-5 * cos(2.0 + n * 0.23 + m * 0.19) / (n * n));
+         }
+      C[2][0] = -9.09e-5;
+      PackCoefficients();
+   }
+
+   virtual Real Cnm(const Real& jday, const Integer& n, const Integer& m) const
+   {
+      return C[n][m];
+   }
+
+   virtual Real Snm(const Real& jday, const Integer& n, const Integer& m) const
+   {
+      return S[n][m];
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// Real Rate(SyntheticHarmonic &field, Integer degree, Integer evals,
+//           bool usePacked)
+//------------------------------------------------------------------------------
+Real Rate(SyntheticHarmonic &field, Integer degree, Integer evals,
+          bool usePacked)
+{
+   HarmonicWorkspace ws;
+   ws.UsePackedKernel = usePacked;
+   Rmatrix33 grad;
+   Real acc[3];
+   clock_t start = clock();
+   for (Integer k = 0; k < evals; ++k)
+   {
+      Real lon = 0.01 * k;
+      Real pos[3] = {1900.0 * cos(lon), 1900.0 * sin(lon), 300.0 * sin(3*lon)};
+      field.CalculateField(0.0, pos, degree, degree, false, 0, acc, grad, ws);
+   }
+   Real elapsed = Real(clock() - start) / CLOCKS_PER_SEC;
+   return (elapsed > 0.0 ? evals / elapsed : 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// void RunDegree(Integer degree, Integer evals, TestOutput &out)
+//------------------------------------------------------------------------------
+void RunDegree(Integer degree, Integer evals, TestOutput &out)
+{
+   SyntheticHarmonic field(degree);
+   HarmonicWorkspace ws;
+   Rmatrix33 grad;
+
+   // The packed kernel is opt-in; the default evaluation is unchanged
+   out.Validate(ws.UsePackedKernel, false);
+
+   Real maxErr = 0.0;
+   for (Integer k = 0; k < 50; ++k)
+   {
+      Real pos[3] = {1800.0 * cos(0.1*k), 1800.0 * sin(0.17*k),
+                     600.0 * sin(0.3*k) + 10.0};
+      Real packed[3], rows[3];
+      ws.UsePackedKernel = true;
+      field.CalculateField(0.0, pos, degree, degree, false, 0, packed, grad, ws);
+      ws.UsePackedKernel = false;
+      field.CalculateField(0.0, pos, degree, degree, false, 0, rows, grad, ws);
+      Real err = (fabs(packed[0] - rows[0]) + fabs(packed[1] - rows[1]) +
+                  fabs(packed[2] - rows[2])) /
+                 (fabs(rows[0]) + fabs(rows[1]) + fabs(rows[2]));
+      if (err > maxErr)
+         maxErr = err;
+   }
+   out.Put("degree = ", degree);
+   out.Put("max relative difference = ", maxErr);
+   out.Validate(maxErr < 1.0e-12, true);
+
+   out.Put("Real** recursion accelerations/sec = ",
+           Rate(field, degree, evals, false));
+   out.Put("packed kernel    accelerations/sec = ",
+           Rate(field, degree, evals, true));
+}
+
+
+//------------------------------------------------------------------------------
+//int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("========================= Test packed Legendre kernel");
+   out.Put("instruction set = ", HarmonicKernel::GetInstructionSet());
+   RunDegree(20,  200000, out);
+   RunDegree(70,   20000, out);
+   RunDegree(360,   1000, out);
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestHarmonicKernel/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestHarmonicKernelOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of HarmonicKernel!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,208 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestHarmonicZonal
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver and throughput benchmark for Harmonic::CalculateZonalField.
+ *
+ * A synthetic zonal field (no coefficient file needed) is evaluated at a set
+ * of positions through the closed form zonal kernel and through the order 0
+ * CalculateField recursion.  The accelerations and gradients are validated
+ * against each other, and the kernel is then checked to give the same field
+ * in a rotated frame given only the pole.  The evaluation rates are written
+ * out for degrees 4 and 20.
+ *
+ * Output file:
+ * TestHarmonicZonalOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <ctime>
+#include "gmatdefs.hpp"
+#include "Harmonic.hpp"
+#include "Rmatrix33.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------------------
+// Harmonic with Earth-like zonal coefficients and no tesseral terms
+//------------------------------------------------------------------------------
+class SyntheticZonal : public Harmonic
+{
+public:
+   SyntheticZonal(Integer degree)
+   {
+      NN = degree;
+      MM = 0;
+      FieldRadius = 6378.1363;
+      Factor = -398600.4415;
+      Allocate();
+      for (Integer n = 2; n <= NN; ++n)
+         C[n][0] = 1.0e-6 * sin(1.0 + n * 0.37) / (n * n);
+      C[2][0] = -4.84165371736e-4;
+      C[3][0] =  9.57254173792e-7;
+      C[4][0] =  5.39873863789e-7;
+   }
+
+   virtual Real Cnm(const Real& jday, const Integer& n, const Integer& m) const
+   {
+      return C[n][m];
+   }
+
+   virtual Real Snm(const Real& jday, const Integer& n, const Integer& m) const
+   {
+      return S[n][m];
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// void RunDegree(Integer degree, Integer count, Integer reps, TestOutput &out)
+//------------------------------------------------------------------------------
+void RunDegree(Integer degree, Integer count, Integer reps, TestOutput &out)
+{
+   SyntheticZonal field(degree);
+   HarmonicWorkspace ws;
+   Rmatrix33 grad, zonalGrad;
+   const Real pole[3] = {0.0, 0.0, 1.0};
+
+   vector<Real> px(count), py(count), pz(count);
+   for (Integer k = 0; k < count; ++k)
+   {
+      Real lon = 2.0 * M_PI * k / count;
+      Real lat = 1.4 * sin(3.0 * lon);
+      Real r   = 6778.0 + 3000.0 * cos(lon);
+      px[k] = r * cos(lat) * cos(lon);
+      py[k] = r * cos(lat) * sin(lon);
+      pz[k] = r * sin(lat);
+   }
+
+   // Validate the kernel against the order 0 recursion
+   Real maxErr = 0.0, maxGradErr = 0.0;
+   for (Integer k = 0; k < count; ++k)
+   {
+      Real pos[3] = {px[k], py[k], pz[k]}, acc[3], zonal[3];
+      field.CalculateField(0.0, pos, degree, 0, true, degree, acc, grad, ws);
+      field.CalculateZonalField(0.0, pos, pole, degree, true, degree, zonal,
+            zonalGrad);
+      Real err = (fabs(acc[0] - zonal[0]) + fabs(acc[1] - zonal[1]) +
+                  fabs(acc[2] - zonal[2])) /
+                 (fabs(acc[0]) + fabs(acc[1]) + fabs(acc[2]));
+      maxErr = max(maxErr, err);
+
+      Real size = 0.0, diff = 0.0;
+      for (Integer i = 0; i < 3; ++i)
+         for (Integer j = 0; j < 3; ++j)
+         {
+            size = max(size, fabs(grad(i,j)));
+            diff = max(diff, fabs(grad(i,j) - zonalGrad(i,j)));
+         }
+      maxGradErr = max(maxGradErr, diff / size);
+   }
+   out.Put("degree = ", degree);
+   out.Put("max relative acceleration difference = ", maxErr);
+   out.Put("max relative gradient difference = ", maxGradErr);
+   out.Validate(maxErr < 1.0e-12, true);
+   out.Validate(maxGradErr < 1.0e-10, true);
+
+   // The kernel in a frame rotated about x by 0.4 rad, given only the pole
+   Real c = cos(0.4), s = sin(0.4);
+   const Real tilted[3] = {0.0, -s, c};
+   maxErr = 0.0;
+   for (Integer k = 0; k < count; ++k)
+   {
+      Real pos[3] = {px[k], py[k], pz[k]}, acc[3], rotated[3], racc[3];
+      field.CalculateZonalField(0.0, pos, pole, degree, false, 0, acc,
+            zonalGrad);
+      rotated[0] = pos[0];
+      rotated[1] = c * pos[1] - s * pos[2];
+      rotated[2] = s * pos[1] + c * pos[2];
+      field.CalculateZonalField(0.0, rotated, tilted, degree, false, 0, racc,
+            zonalGrad);
+      Real back[3] = {racc[0], c * racc[1] + s * racc[2],
+                      -s * racc[1] + c * racc[2]};
+      Real err = (fabs(acc[0] - back[0]) + fabs(acc[1] - back[1]) +
+                  fabs(acc[2] - back[2])) /
+                 (fabs(acc[0]) + fabs(acc[1]) + fabs(acc[2]));
+      maxErr = max(maxErr, err);
+   }
+   out.Put("max relative difference in the rotated frame = ", maxErr);
+   out.Validate(maxErr < 1.0e-12, true);
+
+   // Throughput
+   clock_t start = clock();
+   for (Integer rep = 0; rep < reps; ++rep)
+      for (Integer k = 0; k < count; ++k)
+      {
+         Real pos[3] = {px[k], py[k], pz[k]}, acc[3];
+         field.CalculateField(0.0, pos, degree, 0, false, 0, acc, grad, ws);
+      }
+   Real recursion = Real(clock() - start) / CLOCKS_PER_SEC;
+
+   start = clock();
+   for (Integer rep = 0; rep < reps; ++rep)
+      for (Integer k = 0; k < count; ++k)
+      {
+         Real pos[3] = {px[k], py[k], pz[k]}, acc[3];
+         field.CalculateZonalField(0.0, pos, pole, degree, false, 0, acc,
+               zonalGrad);
+      }
+   Real zonal = Real(clock() - start) / CLOCKS_PER_SEC;
+
+   Real evals = Real(count) * reps;
+   out.Put("recursion    accelerations/sec = ", evals / recursion);
+   out.Put("zonal kernel accelerations/sec = ", evals / zonal);
+}
+
+
+//------------------------------------------------------------------------------
+//int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("========================= Test CalculateZonalField()");
+   RunDegree(4,  200, 2000, out);
+   RunDegree(20, 200,  500, out);
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestHarmonicZonal/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestHarmonicZonalOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the Harmonic zonal kernel!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
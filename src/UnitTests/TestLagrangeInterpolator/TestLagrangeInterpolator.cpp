@@ -30,6 +30,7 @@
  *   + Test interpolate for points less than buffer size.
  *   + Test interpolate for points more than buffer size.
  *   + Test with some realistic data
+ *   + Test batch interpolation against single point interpolation
  *
  * Validation method:
  *   The test driver code knows expected results and throws an exception if the
@@ -238,6 +239,19 @@ int RunTest(TestOutput &out)
          out.Put("Interpolated value of ", xi[i], " are ", fi[0], fi[1], fi[2]);
          out.Validate(fi[0], fi[1], fi[2], fe[i][0], fe[i][1], fe[i][2]);
       }
+      
+      //------  Interpolate all points in one call
+      out.Put("");
+      out.Put("========================= Test batch interpolation");
+      Real fb[3][3];
+      bool batchOk = lagrangeInterp.Interpolate(xi, 3, &fb[0][0]);
+      out.Validate(batchOk, true);
+      for (int i = 0; i < 3; i++)
+      {
+         lagrangeInterp.Interpolate(xi[i], fi);
+         out.Put("Batch value of ", xi[i], " are ", fb[i][0], fb[i][1], fb[i][2]);
+         out.Validate(fb[i][0], fb[i][1], fb[i][2], fi[0], fi[1], fi[2]);
+      }
    }
    catch (BaseException &e)
    {
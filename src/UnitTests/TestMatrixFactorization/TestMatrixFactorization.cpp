@@ -0,0 +1,217 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TestMatrixFactorization
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver and benchmark for the in place LU and Cholesky factorizations.
+ *
+ * For sizes 6 to 500, systems are solved from LUFactorization::FactorInPlace
+ * and SolveInPlace and through SolveSystem and Invert, and the residuals are
+ * validated.  CholeskyFactorization::FactorInPlace is compared with Factor.
+ * Determinant signs are checked on row swapped matrices.  The time per
+ * factorization is written out next to the copying Factor methods.
+ *
+ * Output file:
+ * TestMatrixFactorizationOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "Rmatrix.hpp"
+#include "Rvector.hpp"
+#include "LUFactorization.hpp"
+#include "CholeskyFactorization.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   //---------------------------------------------------------------------------
+   // Real TestElement(Integer i, Integer j)
+   //---------------------------------------------------------------------------
+   Real TestElement(Integer i, Integer j)
+   {
+      // Scattered values in [-0.5, 0.5), like a random matrix
+      Real x = sin(12.9898 * i + 78.233 * j + 0.5) * 43758.5453;
+      return x - floor(x) - 0.5;
+   }
+
+   //---------------------------------------------------------------------------
+   // Real Seconds(chrono::steady_clock::time_point start)
+   //---------------------------------------------------------------------------
+   Real Seconds(chrono::steady_clock::time_point start)
+   {
+      return chrono::duration<Real>(chrono::steady_clock::now() - start).count();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void RunSize(Integer n, Integer reps, TestOutput &out)
+//------------------------------------------------------------------------------
+void RunSize(Integer n, Integer reps, TestOutput &out)
+{
+   out.Put("size = ", n);
+
+   // A general matrix that needs pivoting, and a positive definite one
+   Rmatrix A(n, n), S(n, n);
+   Rvector b(n);
+   for (Integer i = 0; i < n; ++i)
+   {
+      b[i] = cos(0.3 * i);
+      for (Integer j = 0; j < n; ++j)
+         A(i, j) = TestElement(i, j);
+   }
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+      {
+         Real sum = (i == j ? n : 0.0);
+         for (Integer k = 0; k < n; ++k)
+            sum += A(k, i) * A(k, j);
+         S(i, j) = sum;
+      }
+
+   // In place LU solve
+   LUFactorization lu(true);
+   Rmatrix factors = A;
+   IntegerArray pivots;
+   lu.FactorInPlace(factors, pivots);
+   Rvector x = b;
+   lu.SolveInPlace(factors, pivots, x);
+   Real residual = (A * x - b).GetMagnitude() / b.GetMagnitude();
+   out.Put("in place LU relative residual = ", residual);
+   out.Validate(residual < 1.0e-10, true);
+
+   Rvector x2(n);
+   lu.SolveSystem(A, b, x2);
+   out.Validate((x2 - x).GetMagnitude() < 1.0e-10 * x.GetMagnitude(), true);
+
+   // Inverse from the multiple right hand side solve
+   Rmatrix inverse = A;
+   lu.Invert(inverse);
+   Rmatrix product = A * inverse;
+   Real maxError = 0.0;
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         maxError = max(maxError, fabs(product(i, j) - (i == j ? 1.0 : 0.0)));
+   out.Put("max |A inv(A) - I| = ", maxError);
+   out.Validate(maxError < 1.0e-9, true);
+
+   // In place Cholesky against the packed Factor()
+   CholeskyFactorization chol;
+   Rmatrix R(n, n), Rin = S;
+   chol.Factor(S, R);
+   chol.FactorInPlace(Rin);
+   Real maxDiff = 0.0, scale = 0.0;
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = i; j < n; ++j)
+      {
+         maxDiff = max(maxDiff, fabs(R(i, j) - Rin(i, j)));
+         scale = max(scale, fabs(R(i, j)));
+      }
+   out.Put("max Cholesky factor difference = ", maxDiff / scale);
+   out.Validate(maxDiff / scale < 1.0e-12, true);
+
+   // Timing
+   chrono::steady_clock::time_point start = chrono::steady_clock::now();
+   Rmatrix L(n, n), U(n, n);
+   for (Integer r = 0; r < reps; ++r)
+      lu.Factor(A, L, U);
+   Real copying = Seconds(start);
+
+   start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+   {
+      factors = A;
+      lu.FactorInPlace(factors, pivots);
+   }
+   Real inPlace = Seconds(start);
+   out.Put("LU Factor         microseconds = ", copying * 1.0e6 / reps);
+   out.Put("LU FactorInPlace  microseconds = ", inPlace * 1.0e6 / reps);
+
+   start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+      chol.Factor(S, R);
+   copying = Seconds(start);
+
+   start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+   {
+      Rin = S;
+      chol.FactorInPlace(Rin);
+   }
+   inPlace = Seconds(start);
+   out.Put("Cholesky Factor        microseconds = ", copying * 1.0e6 / reps);
+   out.Put("Cholesky FactorInPlace microseconds = ", inPlace * 1.0e6 / reps);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("======================================== Test determinant signs");
+   LUFactorization lu(true);
+   Rmatrix P(6, 6);
+   for (Integer i = 0; i < 6; ++i)
+      P(i, i) = 2.0;
+   P(0, 0) = P(1, 1) = 0.0;
+   P(0, 1) = P(1, 0) = 2.0;
+   out.Validate(lu.Determinant(P), -64.0);
+
+   Rmatrix I12 = Rmatrix::Identity(12);
+   out.Validate(I12.Determinant(), 1.0);
+   I12(3, 3) = I12(7, 7) = 0.0;
+   I12(3, 7) = I12(7, 3) = 1.0;
+   out.Validate(I12.Determinant(), -1.0);
+
+   out.Put("======================================== Test sizes 6 to 500");
+   RunSize(6,   20000, out);
+   RunSize(20,  2000,  out);
+   RunSize(100, 50,    out);
+   RunSize(500, 2,     out);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestMatrixFactorization/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestMatrixFactorizationOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the matrix factorizations!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,169 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestMemoryTelemetry
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the allocation telemetry of MemoryTracker.
+ *
+ * Array buffers are built and released with counting off and on, and the
+ * subsystem counts and per command sums are checked.  The cost of a counting
+ * site is reported with the mode off and on.
+ *
+ * Output file:
+ * TestMemoryTelemetryOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "MemoryTracker.hpp"
+#include "Rvector.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Integer SITE_COUNT = 10000000;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Seconds(std::chrono::steady_clock::time_point start)
+//------------------------------------------------------------------------------
+Real Seconds(std::chrono::steady_clock::time_point start)
+{
+   return std::chrono::duration<Real>(std::chrono::steady_clock::now() -
+         start).count();
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   MemoryTracker *tracker = MemoryTracker::Instance();
+
+   out.Put("======================================== Test counting off");
+   {
+      Rvector unseen(100);
+   }
+   MemoryTracker::AllocationCounts counts =
+         MemoryTracker::GetCounts(MemoryTracker::ARRAY_BUFFER);
+   out.Validate((Integer)counts.allocations, 0);
+   out.Validate(tracker->GetTelemetrySummary() == "", true);
+
+   out.Put("======================================== Test array buffers");
+   MemoryTracker::SetCounting(true);
+   {
+      Rvector first(100);
+      Rvector second(50);
+      counts = MemoryTracker::GetCounts(MemoryTracker::ARRAY_BUFFER);
+      out.Validate((Integer)counts.liveBytes, (Integer)(150 * sizeof(Real)));
+   }
+   counts = MemoryTracker::GetCounts(MemoryTracker::ARRAY_BUFFER);
+   out.Validate((Integer)counts.allocations, 2);
+   out.Validate((Integer)counts.releases, 2);
+   out.Validate((Integer)counts.liveBytes, 0);
+   out.Validate((Integer)counts.peakLive, 2);
+   out.Validate((Integer)counts.peakBytes, (Integer)(150 * sizeof(Real)));
+
+   out.Put("======================================== Test command counts");
+   int command = 0, nested = 0;
+   tracker->ResetCommandCounts();
+   Rvector *kept = NULL;
+   for (Integer i = 0; i < 3; ++i)
+   {
+      tracker->StartCommandCount(&command);
+      {
+         Rvector temporary(10);
+      }
+      tracker->StartCommandCount(&nested);
+      MemoryTracker::CountAllocation(MemoryTracker::FORCE_MODEL);
+      tracker->EndCommandCount(&nested);
+      if (kept == NULL)
+         kept = new Rvector(20);
+      tracker->EndCommandCount(&command);
+   }
+   delete kept;
+
+   std::string summary = tracker->GetCommandSummary(&command);
+   out.Put(summary);
+   out.Validate(summary.find("7 in 3 executions, 3 releases") != std::string::npos, true);
+   out.Validate(summary.find("+160 buffer bytes") != std::string::npos, true);
+   summary = tracker->GetCommandSummary(&nested);
+   out.Validate(summary.find("3 in 3 executions") != std::string::npos, true);
+   out.Validate(tracker->GetCommandSummary(&counts) == "", true);
+
+   out.Validate(MemoryTracker::GetResidentMemory(false) > 0.0, true);
+   out.Validate(MemoryTracker::GetResidentMemory(true) >=
+         MemoryTracker::GetResidentMemory(false) * 0.5, true);
+   out.Put(tracker->GetTelemetrySummary());
+
+   out.Put("======================================== Benchmark counting sites");
+   MemoryTracker::SetCounting(false);
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   for (Integer k = 0; k < SITE_COUNT; ++k)
+   {
+      if (MemoryTracker::IsCounting())
+         MemoryTracker::CountAllocation(MemoryTracker::SANDBOX_CLONE, 8);
+   }
+   Real offTime = Seconds(start) / SITE_COUNT;
+
+   MemoryTracker::SetCounting(true);
+   start = std::chrono::steady_clock::now();
+   for (Integer k = 0; k < SITE_COUNT; ++k)
+   {
+      if (MemoryTracker::IsCounting())
+         MemoryTracker::CountAllocation(MemoryTracker::SANDBOX_CLONE, 8);
+   }
+   Real onTime = Seconds(start) / SITE_COUNT;
+   counts = MemoryTracker::GetCounts(MemoryTracker::SANDBOX_CLONE);
+   out.Validate((Integer)counts.allocations, SITE_COUNT);
+   MemoryTracker::SetCounting(false);
+
+   out.Put("nanoseconds per counting site, telemetry off = ", offTime * 1.0e9);
+   out.Put("nanoseconds per counting site, telemetry on = ", onTime * 1.0e9);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestMemoryTelemetry/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestMemoryTelemetryOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of MemoryTracker telemetry!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
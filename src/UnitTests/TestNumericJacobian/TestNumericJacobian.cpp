@@ -0,0 +1,393 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TestNumericJacobian
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the callback driven NumericJacobian::ComputeJacobian().
+ *
+ * The Jacobian of a banded test function is computed through the state
+ * machine and through ComputeJacobian(), on one and on several threads, and
+ * checked to be bit for bit the same.  The column grouping of a banded
+ * sparsity pattern and the complex-step Jacobian are checked against the
+ * analytic Jacobian.  The time per Jacobian of an expensive function is
+ * written out for one thread and for several.
+ *
+ * Output file:
+ * TestNumericJacobianOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "Rmatrix.hpp"
+#include "Rvector.hpp"
+#include "NumericJacobian.hpp"
+#include "UtilityException.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   //---------------------------------------------------------------------------
+   // Banded test function
+   //
+   // F_i = offset + y_i^2 + sin(y_(i-1)) + exp(0.1 y_(i+1)), repeated work
+   // times so the evaluations can be made expensive.  A large offset drowns
+   // the differences in roundoff, so that the columns get refined.
+   //---------------------------------------------------------------------------
+   class BandedFunction : public NumericJacobian::Function
+   {
+   public:
+      BandedFunction(Integer work = 1, bool complexOk = true) :
+         work(work), complexOk(complexOk), failAt(-1), offset(0.0)
+      {
+      }
+
+      template <class T>
+      void Compute(const vector<T> &y, vector<T> &F)
+      {
+         Integer n = (Integer)y.size();
+         F.assign(n, T(0.0));
+         for (Integer w = 0; w < work; ++w)
+         {
+            for (Integer i = 0; i < n; ++i)
+            {
+               T value = offset + y[i] * y[i];
+               if (i > 0)
+                  value += sin(y[i-1]);
+               if (i < n - 1)
+                  value += exp(0.1 * y[i+1]);
+               F[i] = value;
+            }
+         }
+      }
+
+      Rvector Evaluate(const Rvector &vars)
+      {
+         if ((failAt >= 0) && (vars(failAt) != base(failAt)))
+            throw UtilityException("Test function failure");
+         Integer n = vars.GetSize();
+         vector<Real> y(n), F;
+         for (Integer i = 0; i < n; ++i)
+            y[i] = vars(i);
+         Compute(y, F);
+         Rvector values(n);
+         for (Integer i = 0; i < n; ++i)
+            values(i) = F[i];
+         return values;
+      }
+
+      bool SupportsComplexStep()
+      {
+         return complexOk;
+      }
+
+      void EvaluateComplex(const NumericJacobian::ComplexArray &vars,
+                           NumericJacobian::ComplexArray &values)
+      {
+         Compute(vars, values);
+      }
+
+      Integer work;
+      bool    complexOk;
+      Integer failAt;
+      Rvector base;
+      Real    offset;
+   };
+
+   //---------------------------------------------------------------------------
+   // Rmatrix AnalyticJacobian(const Rvector &y)
+   //---------------------------------------------------------------------------
+   Rmatrix AnalyticJacobian(const Rvector &y)
+   {
+      Integer n = y.GetSize();
+      Rmatrix J(n, n);
+      for (Integer i = 0; i < n; ++i)
+      {
+         J(i, i) = 2.0 * y(i);
+         if (i > 0)
+            J(i, i-1) = cos(y(i-1));
+         if (i < n - 1)
+            J(i, i+1) = 0.1 * exp(0.1 * y(i+1));
+      }
+      return J;
+   }
+
+   //---------------------------------------------------------------------------
+   // Real MaxRelativeError(const Rmatrix &J, const Rmatrix &expected)
+   //---------------------------------------------------------------------------
+   Real MaxRelativeError(const Rmatrix &J, const Rmatrix &expected)
+   {
+      Real maxError = 0.0, scale = 0.0;
+      for (Integer i = 0; i < J.GetNumRows(); ++i)
+         for (Integer j = 0; j < J.GetNumColumns(); ++j)
+         {
+            maxError = max(maxError, fabs(J(i, j) - expected(i, j)));
+            scale = max(scale, fabs(expected(i, j)));
+         }
+      return maxError / scale;
+   }
+
+   //---------------------------------------------------------------------------
+   // Rvector TestState(Integer n)
+   //---------------------------------------------------------------------------
+   Rvector TestState(Integer n)
+   {
+      Rvector y(n);
+      for (Integer i = 0; i < n; ++i)
+         y(i) = 0.3 + 0.7 * sin(1.3 * i) + (i % 3 == 0 ? 1.0e-9 : 0.0);
+      return y;
+   }
+
+   //---------------------------------------------------------------------------
+   // Rmatrix Threshold(Integer n)
+   //---------------------------------------------------------------------------
+   Rmatrix Threshold(Integer n)
+   {
+      Rmatrix thresh(1, n);
+      for (Integer i = 0; i < n; ++i)
+         thresh(0, i) = 1.0e-6;
+      return thresh;
+   }
+
+   //---------------------------------------------------------------------------
+   // Real Seconds(chrono::steady_clock::time_point start)
+   //---------------------------------------------------------------------------
+   Real Seconds(chrono::steady_clock::time_point start)
+   {
+      return chrono::duration<Real>(chrono::steady_clock::now() - start).count();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   const Integer n = 24;
+   Rvector y = TestState(n);
+   BandedFunction f;
+   Rvector Fty = f.Evaluate(y);
+   Rvector noStorage;
+   noStorage.SetSize(0);
+
+   out.Put("======================================== Test state machine match");
+   NumericJacobian machine;
+   NumericJacobian::JacState state = machine.GetState();
+   machine.SetInitialValues(y, Fty, Threshold(n), noStorage);
+   Integer machineEvals = 0;
+   while (state != NumericJacobian::FINISHED)
+   {
+      if (state == NumericJacobian::PERTURBING ||
+          state == NumericJacobian::REFINING)
+      {
+         machine.SetDerivs(f.Evaluate(machine.GetCurrentVars()));
+         ++machineEvals;
+      }
+      state = machine.AdvanceState();
+   }
+
+   vector<NumericJacobian::Function*> serial(1, &f);
+   NumericJacobian direct;
+   direct.SetInitialValues(y, Fty, Threshold(n), noStorage);
+   direct.ComputeJacobian(serial, 1);
+   out.Validate(direct.GetState() == NumericJacobian::FINISHED, true);
+   out.Validate(direct.GetJacobian() == machine.GetJacobian(), true);
+   out.Validate(direct.GetWorkingStorage() == machine.GetWorkingStorage(),
+                true);
+   out.Put("state machine evaluations = ", machineEvals);
+   out.Put("ComputeJacobian evaluations = ", direct.GetFunctionEvaluations());
+   out.Put("max finite difference error = ",
+           MaxRelativeError(direct.GetJacobian(), AnalyticJacobian(y)));
+
+   out.Put("======================================== Test refinement");
+   BandedFunction shifted;
+   shifted.offset = 1.0e9;
+   Rvector shiftedFty = shifted.Evaluate(y);
+   NumericJacobian refined;
+   state = refined.GetState();
+   refined.SetInitialValues(y, shiftedFty, Threshold(n), noStorage);
+   machineEvals = 0;
+   while (state != NumericJacobian::FINISHED)
+   {
+      if (state == NumericJacobian::PERTURBING ||
+          state == NumericJacobian::REFINING)
+      {
+         refined.SetDerivs(shifted.Evaluate(refined.GetCurrentVars()));
+         ++machineEvals;
+      }
+      state = refined.AdvanceState();
+   }
+
+   vector<BandedFunction> shiftedClones(4);
+   vector<NumericJacobian::Function*> shiftedFunctions;
+   for (Integer i = 0; i < 4; ++i)
+   {
+      shiftedClones[i].offset = shifted.offset;
+      shiftedFunctions.push_back(&shiftedClones[i]);
+   }
+   NumericJacobian refinedDirect;
+   refinedDirect.SetInitialValues(y, shiftedFty, Threshold(n), noStorage);
+   refinedDirect.ComputeJacobian(shiftedFunctions, 4);
+   out.Validate(refinedDirect.GetJacobian() == refined.GetJacobian(), true);
+   out.Validate(refinedDirect.GetWorkingStorage() ==
+                refined.GetWorkingStorage(), true);
+   out.Validate(refinedDirect.GetFunctionEvaluations() > n, true);
+   out.Put("state machine calls with refinement = ", machineEvals);
+   out.Put("ComputeJacobian evaluations with refinement = ",
+           refinedDirect.GetFunctionEvaluations());
+
+   out.Put("======================================== Test threads");
+   vector<BandedFunction> clones(4);
+   vector<NumericJacobian::Function*> functions;
+   for (Integer i = 0; i < 4; ++i)
+      functions.push_back(&clones[i]);
+   NumericJacobian threaded;
+   threaded.SetInitialValues(y, Fty, Threshold(n), noStorage);
+   threaded.ComputeJacobian(functions, 4);
+   out.Validate(threaded.GetJacobian() == direct.GetJacobian(), true);
+   out.Validate(threaded.GetWorkingStorage() == direct.GetWorkingStorage(),
+                true);
+
+   // The working storage from one call is used for the next
+   NumericJacobian again;
+   again.SetInitialValues(y, Fty, Threshold(n), direct.GetWorkingStorage());
+   again.ComputeJacobian(functions, 4);
+   out.Validate(MaxRelativeError(again.GetJacobian(), AnalyticJacobian(y)) <
+                1.0e-5, true);
+
+   out.Put("======================================== Test sparsity grouping");
+   Rmatrix pattern(n, n);
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = max(0, i - 1); j <= min(n - 1, i + 1); ++j)
+         pattern(i, j) = 1.0;
+   NumericJacobian sparse;
+   sparse.SetSparsity(pattern);
+   sparse.SetInitialValues(y, Fty, Threshold(n), noStorage);
+   sparse.ComputeJacobian(functions, 4);
+   out.Validate(sparse.GetNumColumnGroups(), 3);
+   Real sparseError =
+         MaxRelativeError(sparse.GetJacobian(), AnalyticJacobian(y));
+   out.Put("sparse evaluations = ", sparse.GetFunctionEvaluations());
+   out.Put("max sparse finite difference error = ", sparseError);
+   out.Validate(sparseError < 1.0e-5, true);
+   bool zeros = true;
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         if (pattern(i, j) == 0.0)
+            zeros = zeros && (sparse.GetJacobian()(i, j) == 0.0);
+   out.Validate(zeros, true);
+
+   out.Put("======================================== Test complex step");
+   NumericJacobian complexJac;
+   complexJac.SetSparsity(pattern);
+   complexJac.UseComplexStep(true);
+   complexJac.SetInitialValues(y, Fty, Threshold(n), noStorage);
+   complexJac.ComputeJacobian(functions, 4);
+   Real complexError =
+         MaxRelativeError(complexJac.GetJacobian(), AnalyticJacobian(y));
+   out.Put("max complex step error = ", complexError);
+   out.Validate(complexError < 1.0e-14, true);
+   out.Validate(complexJac.GetFunctionEvaluations(), 3);
+
+   // A function without complex support falls back to differences
+   BandedFunction realOnly(1, false);
+   vector<NumericJacobian::Function*> mixed = functions;
+   mixed[2] = &realOnly;
+   NumericJacobian fallback;
+   fallback.UseComplexStep(true);
+   fallback.SetInitialValues(y, Fty, Threshold(n), noStorage);
+   fallback.ComputeJacobian(mixed, 4);
+   out.Validate(fallback.GetJacobian() == direct.GetJacobian(), true);
+
+   out.Put("======================================== Test exceptions");
+   for (Integer i = 0; i < 4; ++i)
+   {
+      clones[i].failAt = 7;
+      clones[i].base = y;
+   }
+   bool threw = false;
+   try
+   {
+      NumericJacobian failing;
+      failing.SetInitialValues(y, Fty, Threshold(n), noStorage);
+      failing.ComputeJacobian(functions, 4);
+   }
+   catch (BaseException &)
+   {
+      threw = true;
+   }
+   out.Validate(threw, true);
+   for (Integer i = 0; i < 4; ++i)
+      clones[i].failAt = -1;
+
+   out.Put("======================================== Test timing");
+   const Integer reps = 20;
+   for (Integer i = 0; i < 4; ++i)
+      clones[i].work = 2000;
+   vector<NumericJacobian::Function*> one(1, functions[0]);
+   chrono::steady_clock::time_point start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+   {
+      NumericJacobian timed;
+      timed.SetInitialValues(y, Fty, Threshold(n), noStorage);
+      timed.ComputeJacobian(one, 1);
+   }
+   Real serialTime = Seconds(start);
+
+   start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+   {
+      NumericJacobian timed;
+      timed.SetInitialValues(y, Fty, Threshold(n), noStorage);
+      timed.ComputeJacobian(functions, 4);
+   }
+   Real threadedTime = Seconds(start);
+   out.Put("1 thread  milliseconds per Jacobian = ",
+           serialTime * 1.0e3 / reps);
+   out.Put("4 threads milliseconds per Jacobian = ",
+           threadedTime * 1.0e3 / reps);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestNumericJacobian/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestNumericJacobianOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of NumericJacobian!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
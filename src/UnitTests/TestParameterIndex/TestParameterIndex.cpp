@@ -0,0 +1,118 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestParameterIndex
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for ParameterIndex.
+ *
+ * Every label of a parameter table is looked up through the index and
+ * compared with the ID the linear search of GetParameterID() used to find.
+ *
+ * Output file:
+ * TestParameterIndexOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include "gmatdefs.hpp"
+#include "ParameterIndex.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Integer FIRST_ID = 12;
+   const Integer LABEL_COUNT = 6;
+   // "Epoch" appears twice; the linear search returned the first one
+   const std::string LABELS[LABEL_COUNT] =
+   {
+      "DateFormat",
+      "Epoch",
+      "CoordinateSystem",
+      "Epoch",
+      "DisplayStateType",
+      "",
+   };
+}
+
+
+//------------------------------------------------------------------------------
+// Integer LinearSearch(const std::string &str)
+//------------------------------------------------------------------------------
+Integer LinearSearch(const std::string &str)
+{
+   for (Integer i = FIRST_ID; i < FIRST_ID + LABEL_COUNT; ++i)
+   {
+      if (str == LABELS[i - FIRST_ID])
+         return i;
+   }
+   return -1;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   ParameterIndex index(LABELS, FIRST_ID, FIRST_ID + LABEL_COUNT);
+
+   out.Put("======================================== labels in the table");
+   for (Integer i = 0; i < LABEL_COUNT; ++i)
+   {
+      out.Put("Label \"" + LABELS[i] + "\"");
+      out.Validate(index.Find(LABELS[i]), LinearSearch(LABELS[i]));
+   }
+
+   out.Put("======================================== duplicate label");
+   out.Validate(index.Find("Epoch"), FIRST_ID + 1);
+
+   out.Put("======================================== labels not in the table");
+   out.Validate(index.Find("epoch"), -1);
+   out.Validate(index.Find("Epoch "), -1);
+   out.Validate(index.Find("X"), -1);
+
+   out.Put("======================================== empty table");
+   ParameterIndex empty(LABELS, FIRST_ID, FIRST_ID);
+   out.Validate(empty.Find("DateFormat"), -1);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestParameterIndex/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestParameterIndexOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of ParameterIndex!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
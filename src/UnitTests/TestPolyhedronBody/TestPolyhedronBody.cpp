@@ -0,0 +1,181 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestPolyhedronBody
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the PolyhedronBody field data.
+ *
+ * A box is written to a scratch shape file and loaded.  The edge list, the
+ * volume moments, the solid angle inside and outside of the box, the far
+ * field expansion against the polyhedron sums, and the threaded batch sums
+ * against the single point sums are checked.
+ *
+ * Output file:
+ * TestPolyhedronBodyOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include "gmatdefs.hpp"
+#include "PolyhedronBody.hpp"
+#include "RealUtilities.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+using namespace GmatMathUtil;
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out, const std::string &outPath)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out, const std::string &outPath)
+{
+   // A 4 x 2 x 2 box centered at (1, 0, 0), with outward wound faces
+   std::string shapeFile = outPath + "TestPolyhedronBodyShape.txt";
+   {
+      std::ofstream shape(shapeFile.c_str());
+      shape << "8\n";
+      for (Integer i = 0; i < 8; ++i)
+         shape << i + 1 << " " << (i & 1 ? 3.0 : -1.0) << " "
+               << (i & 2 ? 1.0 : -1.0) << " " << (i & 4 ? 1.0 : -1.0) << "\n";
+      Integer faces[12][3] = {{0,2,3}, {0,3,1}, {4,5,7}, {4,7,6},
+                              {0,1,5}, {0,5,4}, {2,6,7}, {2,7,3},
+                              {0,4,6}, {0,6,2}, {1,3,7}, {1,7,5}};
+      shape << "12\n";
+      for (Integer i = 0; i < 12; ++i)
+         shape << i + 1 << " " << faces[i][0] + 1 << " " << faces[i][1] + 1
+               << " " << faces[i][2] + 1 << "\n";
+      shape << "\n";
+   }
+
+   PolyhedronBody body(shapeFile);
+   out.Validate(body.BuildFieldData(), true);
+
+   out.Put("======================================== edges");
+   out.Validate((Integer)body.E.size(), 18);
+   bool attached = true;
+   for (UnsignedInt i = 0; i < body.E.size(); ++i)
+   {
+      if ((body.attachmentA[i] < 0) || (body.attachmentB[i] < 0))
+         attached = false;
+      if ((i > 0) && (Min(body.E[i-1].vertex1, body.E[i-1].vertex2) >
+                      Min(body.E[i].vertex1, body.E[i].vertex2)))
+         attached = false;
+   }
+   out.Validate(attached, true);
+
+   Edge edge;
+   bool isAttachmentB;
+   edge.vertex1 = 3; edge.vertex2 = 0;
+   out.Validate(body.IsInEdgesList(edge, isAttachmentB), true);
+   edge.vertex1 = 0; edge.vertex2 = 7;
+   out.Validate(body.IsInEdgesList(edge, isAttachmentB), false);
+
+   out.Put("======================================== volume moments");
+   out.Validate(body.GetVolume(), 16.0);
+   out.Validate(body.GetBoundingRadius(), Sqrt(6.0));
+
+   out.Put("======================================== solid angle");
+   Real accel[3], gradient[9], solidAngle;
+   Real inside[3] = {1.2, 0.1, -0.3};
+   body.FieldSum(inside, accel, gradient, solidAngle);
+   out.Validate(solidAngle, 4.0 * GmatMathConstants::PI);
+   // The Laplacian is -4 pi inside of the body
+   out.Validate(gradient[0] + gradient[4] + gradient[8],
+                -4.0 * GmatMathConstants::PI);
+
+   Real outside[3] = {40.0, 30.0, 20.0};
+   body.FieldSum(outside, accel, gradient, solidAngle);
+   out.Validate(solidAngle, 0.0);
+
+   out.Put("======================================== far field");
+   Real farAccel[3], farGradient[9];
+   body.FarFieldSum(outside, farAccel, farGradient);
+
+   Real accelMag = Sqrt(accel[0]*accel[0] + accel[1]*accel[1] +
+                        accel[2]*accel[2]);
+   Real gradientMag = 0.0;
+   for (Integer i = 0; i < 9; ++i)
+      gradientMag = Max(gradientMag, Abs(gradient[i]));
+
+   Real accelError = 0.0, gradientError = 0.0;
+   for (Integer i = 0; i < 3; ++i)
+      accelError = Max(accelError, Abs(farAccel[i] - accel[i]) / accelMag);
+   for (Integer i = 0; i < 9; ++i)
+      gradientError = Max(gradientError,
+            Abs(farGradient[i] - gradient[i]) / gradientMag);
+   out.Put("Relative far field acceleration error: ", accelError);
+   out.Put("Relative far field gradient error:     ", gradientError);
+   out.Validate(accelError < 1.0e-5, true);
+   out.Validate(gradientError < 1.0e-4, true);
+   out.Validate(farGradient[0] + farGradient[4] + farGradient[8], 0.0);
+
+   out.Put("======================================== batch");
+   // Enough points for the batch to be shared out between threads
+   const Integer count = 1000;
+   RealArray points(count * 3), batchAccel(count * 3),
+             batchGradient(count * 9), batchAngle(count);
+   for (Integer k = 0; k < count; ++k)
+   {
+      points[k*3]     = 1.0 + 6.0 * Sin(0.37 * k);
+      points[k*3 + 1] = 5.0 * Cos(0.23 * k);
+      points[k*3 + 2] = 4.0 * Sin(0.11 * k + 1.0);
+   }
+   body.FieldSumBatch(count, &points[0], &batchAccel[0], &batchGradient[0],
+         &batchAngle[0], 4);
+
+   bool same = true;
+   for (Integer k = 0; k < count; ++k)
+   {
+      body.FieldSum(&points[k*3], accel, gradient, solidAngle);
+      for (Integer i = 0; i < 3; ++i)
+         if (accel[i] != batchAccel[k*3 + i])
+            same = false;
+      for (Integer i = 0; i < 9; ++i)
+         if (gradient[i] != batchGradient[k*9 + i])
+            same = false;
+      if (solidAngle != batchAngle[k])
+         same = false;
+   }
+   out.Validate(same, true);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestPolyhedronBody/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestPolyhedronBodyOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out, outPath);
+      out.Put("\nSuccessfully ran unit testing of PolyhedronBody!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,138 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestPrecisionEpoch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for PrecisionEpoch.
+ *
+ * Sums, differences and comparisons are checked against GmatTime, along with
+ * the carries between the parts of the fixed point value and the conversions
+ * to and from GmatTime.
+ *
+ * Output file:
+ * TestPrecisionEpochOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include "gmatdefs.hpp"
+#include "PrecisionEpoch.hpp"
+#include "GmatTime.hpp"
+#include "RealUtilities.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   // The arithmetic can be evaluated at compile time
+   constexpr PrecisionEpoch START(25000, PrecisionEpoch::NS_PER_DAY - 1, 0.75);
+   constexpr PrecisionEpoch STEP = PrecisionEpoch::FromNanoseconds(2);
+   constexpr PrecisionEpoch SUM = START + STEP;
+   static_assert(SUM.GetDays() == 25001, "Day carry failed");
+   static_assert(SUM.GetNanoseconds() == 1, "Nanosecond carry failed");
+   static_assert(SUM - STEP == START, "Difference failed");
+   static_assert(START < SUM, "Comparison failed");
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("======================================== Test carries");
+   PrecisionEpoch a(100, 5, 0.5);
+   PrecisionEpoch b(0, 3, 0.75);
+   PrecisionEpoch c = a + b;
+   out.Validate((Integer)c.GetDays(), 100);
+   out.Validate((Integer)c.GetNanoseconds(), 9);
+   out.Validate(c.GetFraction(), 0.25);
+
+   c = b - a;
+   out.Validate((Integer)c.GetDays(), -101);
+   out.Validate(c.GetNanoseconds() == PrecisionEpoch::NS_PER_DAY - 2, true);
+   out.Validate(c.GetFraction(), 0.25);
+   out.Validate(c + a == b, true);
+
+   PrecisionEpoch span = PrecisionEpoch::FromNanoseconds(-1);
+   out.Validate((Integer)span.GetDays(), -1);
+   out.Validate(span.GetNanoseconds() == PrecisionEpoch::NS_PER_DAY - 1, true);
+   out.Validate(span.GetTimeInSec(), -1.0e-9);
+
+   out.Put("======================================== Test seconds");
+   span = PrecisionEpoch::FromSeconds(-90000.25);
+   out.Validate((Integer)span.GetDays(), -2);
+   out.Validate(span.GetNanoseconds() == 82799750000000LL, true);
+   out.Validate(span.GetTimeInSec(), -90000.25);
+
+   PrecisionEpoch epoch = PrecisionEpoch::FromMjd(21545.5);
+   epoch.AddSeconds(43200.0);
+   out.Validate(epoch.GetMjd(), 21546.0);
+
+   out.Put("======================================== Test GmatTime agreement");
+   GmatTime gtEpoch(28000.123456789);
+   PrecisionEpoch peEpoch(gtEpoch);
+   out.Validate(peEpoch.ToGmatTime() == gtEpoch, true);
+   out.Validate(peEpoch.GetMjd(), gtEpoch.GetMjd());
+
+   Real maxError = 0.0;
+   Integer orderErrors = 0;
+   for (Integer i = 0; i < 1000; ++i)
+   {
+      GmatTime gtStep;
+      gtStep.SetTimeInSec((i - 500) * 3.7 + i * 1.0e-7);
+      PrecisionEpoch peStep(gtStep);
+
+      GmatTime gtSum = gtEpoch + gtStep;
+      PrecisionEpoch peSum = peEpoch + peStep;
+      Real error = (peSum - PrecisionEpoch(gtSum)).GetTimeInSec();
+      maxError = GmatMathUtil::Max(maxError, GmatMathUtil::Abs(error));
+
+      if ((peSum < peEpoch) != (gtSum < gtEpoch))
+         ++orderErrors;
+   }
+   out.Put("Largest difference from GmatTime, in seconds:");
+   out.Put(maxError);
+   out.Validate(maxError < 1.0e-15, true);
+   out.Validate(orderErrors, 0);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestPrecisionEpoch/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestPrecisionEpochOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of PrecisionEpoch!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,169 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                TestProfiler
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the Profiler.
+ *
+ * A command scope containing step and force scopes is run while profiling is
+ * on, and the call counts in the report and the folded stack file are checked.
+ * The cost of a scope is reported with profiling off and on.
+ *
+ * Output file:
+ * TestProfilerOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "Profiler.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Integer STEP_COUNT  = 1000;
+   const Integer SCOPE_COUNT = 1000000;
+
+   /// Stands in for an instrumented object
+   class ProfiledObject
+   {
+   public:
+      ProfiledObject(const std::string &type, const std::string &name) :
+         typeName (type),
+         instanceName (name)
+      {
+      }
+
+      std::string GetTypeName() const { return typeName; }
+      std::string GetName() const { return instanceName; }
+
+   private:
+      std::string typeName;
+      std::string instanceName;
+   };
+}
+
+
+//------------------------------------------------------------------------------
+// Real TimeScopes()
+//------------------------------------------------------------------------------
+Real TimeScopes(const ProfiledObject &object)
+{
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   for (Integer i = 0; i < SCOPE_COUNT; ++i)
+      ProfileScope profile("Force", &object);
+   return std::chrono::duration<Real>(std::chrono::steady_clock::now() -
+         start).count() / SCOPE_COUNT;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string ReadFile(const std::string &fileName)
+//------------------------------------------------------------------------------
+std::string ReadFile(const std::string &fileName)
+{
+   std::ifstream file(fileName.c_str());
+   return std::string((std::istreambuf_iterator<char>(file)),
+         std::istreambuf_iterator<char>());
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out, const std::string &outPath)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out, const std::string &outPath)
+{
+   ProfiledObject command("Propagate", "");
+   ProfiledObject stepper("RungeKutta89", "");
+   ProfiledObject gravity("GravityField", "Earth");
+   ProfiledObject moon("PointMassForce", "Luna");
+
+   out.Put("======================================== Test call tree");
+   Profiler::SetEnabled(true);
+   Profiler::Reset();
+   {
+      ProfileScope outer("Command", &command);
+      for (Integer i = 0; i < STEP_COUNT; ++i)
+      {
+         ProfileScope step("Step", &stepper);
+         for (Integer stage = 0; stage < 13; ++stage)
+         {
+            ProfileScope earth("Force", &gravity);
+            ProfileScope luna("Force", &moon);
+         }
+      }
+   }
+   Profiler::SetEnabled(false);
+
+   std::string reportName = outPath + "TestProfile.txt";
+   out.Validate(Profiler::WriteReport(reportName), true);
+
+   std::string report = ReadFile(reportName);
+   out.Validate(report.find("Command: Propagate") != std::string::npos, true);
+   out.Validate(report.find("  Force: GravityField Earth") !=
+         std::string::npos, true);
+
+   // The totals list each force with its evaluation count
+   std::string::size_type totals = report.find("Totals by scope");
+   std::string::size_type row = report.find("Force", totals);
+   Integer calls = 0;
+   sscanf(report.c_str() + row, "Force %d", &calls);
+   out.Validate(calls, STEP_COUNT * 13);
+
+   std::string folded = ReadFile(outPath + "TestProfile.folded");
+   out.Validate(folded.find("GMAT;Command: Propagate;Step: RungeKutta89;"
+         "Force: GravityField Earth;Force: PointMassForce Luna ") !=
+         std::string::npos, true);
+
+   out.Put("======================================== Benchmark scope cost");
+   Real offTime = TimeScopes(gravity);
+   Profiler::SetEnabled(true);
+   Real onTime = TimeScopes(gravity);
+   Profiler::SetEnabled(false);
+   out.Put("nanoseconds per scope, profiling off = ", offTime * 1.0e9);
+   out.Put("nanoseconds per scope, profiling on  = ", onTime * 1.0e9);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestProfiler/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestProfilerOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out, outPath);
+      out.Put("\nSuccessfully ran unit testing of Profiler!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
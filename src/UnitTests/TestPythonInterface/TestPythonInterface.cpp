@@ -0,0 +1,171 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestPythonInterface
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver and call overhead benchmark for the PythonInterface.
+ *
+ * A small module is written to the test directory and its function is called
+ * through PyFunctionWrapper() with a real and a 6 element array input.  The
+ * results are checked, and the time per call is reported for the cached
+ * function handle and for an import, lookup and list build on every call.
+ *
+ * Output file:
+ * TestPythonInterfaceOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "PythonInterface.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const std::string MODULE_NAME   = "TestPythonCallModule";
+   const std::string FUNCTION_NAME = "WeightedSum";
+   const Integer     CALL_COUNT    = 10000;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Seconds(std::chrono::steady_clock::time_point start)
+//------------------------------------------------------------------------------
+Real Seconds(std::chrono::steady_clock::time_point start)
+{
+   return std::chrono::duration<Real>(std::chrono::steady_clock::now() -
+         start).count();
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out, const std::string &outPath)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out, const std::string &outPath)
+{
+   std::ofstream module((outPath + MODULE_NAME + ".py").c_str());
+   module << "def " << FUNCTION_NAME << "(scale, values):\n"
+          << "   return scale * sum(values)\n";
+   module.close();
+
+   PythonInterface *pyIf = PythonInterface::PyInstance();
+   pyIf->PyInitialize();
+   pyIf->PyAddModulePath(StringArray(1, outPath));
+
+   Real scale = 0.5;
+   RealArray values;
+   for (Integer i = 1; i <= 6; ++i)
+      values.push_back(i);
+
+   std::vector<void*> argIn;
+   argIn.push_back(&scale);
+   argIn.push_back(&values);
+   std::vector<Gmat::ParameterType> paramType;
+   paramType.push_back(Gmat::REAL_TYPE);
+   paramType.push_back(Gmat::RMATRIX_TYPE);
+
+   out.Put("======================================== Test call results");
+   PyObject *pyRet = pyIf->PyFunctionWrapper(MODULE_NAME, FUNCTION_NAME,
+         argIn, paramType, 2);
+   out.Validate(PyFloat_AsDouble(pyRet), 10.5);
+   Py_DECREF(pyRet);
+
+   // The handle is cached, and the array view sees the current values
+   PyObject *pyFunction = pyIf->PyGetFunction(MODULE_NAME, FUNCTION_NAME);
+   out.Validate(pyFunction == pyIf->PyGetFunction(MODULE_NAME, FUNCTION_NAME),
+         true);
+   values[5] = 16.0;
+   pyRet = pyIf->PyFunctionWrapper(pyFunction, argIn, paramType, 2);
+   out.Validate(PyFloat_AsDouble(pyRet), 15.5);
+   Py_DECREF(pyRet);
+
+   out.Put("======================================== Benchmark call overhead");
+   Real sum = 0.0;
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   for (Integer k = 0; k < CALL_COUNT; ++k)
+   {
+      pyRet = pyIf->PyFunctionWrapper(pyFunction, argIn, paramType, 2);
+      sum += PyFloat_AsDouble(pyRet);
+      Py_DECREF(pyRet);
+   }
+   Real cachedTime = Seconds(start) / CALL_COUNT;
+   out.Validate(sum, 15.5 * CALL_COUNT);
+
+   // The per call import, lookup and list build the handle cache replaces
+   sum = 0.0;
+   start = std::chrono::steady_clock::now();
+   for (Integer k = 0; k < CALL_COUNT; ++k)
+   {
+      PyObject *name = PyUnicode_FromString(MODULE_NAME.c_str());
+      PyObject *mod = PyImport_Import(name);
+      Py_DECREF(name);
+      PyObject *func = PyObject_GetAttrString(mod, FUNCTION_NAME.c_str());
+      Py_DECREF(mod);
+
+      PyObject *list = PyList_New(values.size());
+      for (UnsignedInt i = 0; i < values.size(); ++i)
+         PyList_SetItem(list, i, PyFloat_FromDouble(values[i]));
+      PyObject *args = PyTuple_New(2);
+      PyTuple_SetItem(args, 0, PyFloat_FromDouble(scale));
+      PyTuple_SetItem(args, 1, list);
+
+      pyRet = PyObject_CallObject(func, args);
+      sum += PyFloat_AsDouble(pyRet);
+      Py_DECREF(pyRet);
+      Py_DECREF(args);
+      Py_DECREF(func);
+   }
+   Real uncachedTime = Seconds(start) / CALL_COUNT;
+   out.Validate(sum, 15.5 * CALL_COUNT);
+
+   out.Put("microseconds per call, cached handle and memoryview = ",
+         cachedTime * 1.0e6);
+   out.Put("microseconds per call, import, lookup and list = ",
+         uncachedTime * 1.0e6);
+
+   pyIf->PyFinalize();
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestPythonInterface/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestPythonInterfaceOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out, outPath);
+      out.Put("\nSuccessfully ran unit testing of PythonInterface!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,190 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestQRTriangularize
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for QRFactorization::Triangularize.
+ *
+ * A weighted least squares problem is solved by folding its rows into a
+ * square root information array [R z] one block at a time, as
+ * BatchEstimatorSRIF does, and compared with the same problem triangularized
+ * in one piece and with the normal equation solution.
+ *
+ * Output file:
+ * TestQRTriangularizeOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "Rmatrix.hpp"
+#include "Rvector.hpp"
+#include "QRFactorization.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// Real Partial(Integer row, Integer col)
+//------------------------------------------------------------------------------
+Real Partial(Integer row, Integer col)
+{
+   Real t = row * 0.01;
+   // Polynomial columns make the problem poorly conditioned; some entries
+   // are zero, like the partials of a bias that a measurement does not see
+   if ((col % 4 == 3) && (row % 3 != 0))
+      return 0.0;
+   return pow(t, col) + 0.1 * sin(1.0 + row * 0.7 + col * 1.3);
+}
+
+
+//------------------------------------------------------------------------------
+//int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   const Integer n = 8, rows = 300, block = 64;
+   QRFactorization qr(false);
+
+   Rvector truth(n);
+   for (Integer j = 0; j < n; ++j)
+      truth[j] = 1.0 + 0.5 * j;
+
+   // One piece: whitened [H y]
+   Rmatrix whole(rows, n + 1);
+   for (Integer i = 0; i < rows; ++i)
+   {
+      Real sqrtWeight = 1.0 + 0.5 * cos(i * 0.1);
+      Real y = 1.0e-6 * sin(i * 0.37);
+      for (Integer j = 0; j < n; ++j)
+      {
+         whole(i, j) = Partial(i, j) * sqrtWeight;
+         y += Partial(i, j) * truth[j];
+      }
+      whole(i, n) = y * sqrtWeight;
+   }
+
+   Rmatrix info(n, n);
+   Rvector rhs(n);
+   for (Integer i = 0; i < n; ++i)
+   {
+      for (Integer j = 0; j < n; ++j)
+         for (Integer k = 0; k < rows; ++k)
+            info(i, j) += whole(k, i) * whole(k, j);
+      for (Integer k = 0; k < rows; ++k)
+         rhs[i] += whole(k, i) * whole(k, n);
+   }
+
+   Rmatrix oneShot = whole;
+   qr.Triangularize(oneShot, n);
+
+   // Blocks of rows stacked under [R z]
+   Rmatrix sri(n + block, n + 1);
+   for (Integer start = 0; start < rows; start += block)
+   {
+      Integer count = (rows - start < block ? rows - start : block);
+      for (Integer k = 0; k < count; ++k)
+         for (Integer j = 0; j <= n; ++j)
+            sri(n + k, j) = whole(start + k, j);
+      qr.Triangularize(sri, n, n + count);
+      for (Integer k = 0; k < count; ++k)
+         sri(n + k, n) = 0.0;
+   }
+
+   out.Put("========================= Test Triangularize()");
+
+   // The triangle is upper, with a nonnegative diagonal, and R^T R = H^T W H
+   Real lower = 0.0, infoErr = 0.0, rhsErr = 0.0, blockErr = 0.0;
+   bool positive = true;
+   for (Integer i = 0; i < n; ++i)
+   {
+      if (sri(i, i) < 0.0)
+         positive = false;
+      for (Integer j = 0; j < i; ++j)
+         lower = GmatMathUtil::Max(lower, fabs(sri(i, j)));
+      for (Integer j = 0; j < n; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k < n; ++k)
+            sum += sri(k, i) * sri(k, j);
+         infoErr = GmatMathUtil::Max(infoErr,
+               fabs(sum - info(i, j)) / fabs(info(i, i)));
+      }
+      Real sum = 0.0;
+      for (Integer k = 0; k < n; ++k)
+         sum += sri(k, i) * sri(k, n);
+      rhsErr = GmatMathUtil::Max(rhsErr, fabs(sum - rhs[i]) / fabs(rhs[i]));
+      for (Integer j = i; j <= n; ++j)
+         blockErr = GmatMathUtil::Max(blockErr,
+               fabs(sri(i, j) - oneShot(i, j)) / fabs(oneShot(i, i)));
+   }
+
+   out.Put("largest element below the diagonal = ", lower);
+   out.Validate(lower == 0.0, true);
+   out.Validate(positive, true);
+   out.Put("relative error of R^T R = ", infoErr);
+   out.Validate(infoErr < 1.0e-12, true);
+   out.Put("relative error of R^T z = ", rhsErr);
+   out.Validate(rhsErr < 1.0e-12, true);
+   out.Put("blocked vs one-piece triangle = ", blockErr);
+   out.Validate(blockErr < 1.0e-10, true);
+
+   // Back substitution recovers the solution of the normal equations
+   Rvector x(n);
+   for (Integer i = n - 1; i >= 0; --i)
+   {
+      Real sum = sri(i, n);
+      for (Integer k = i + 1; k < n; ++k)
+         sum -= sri(i, k) * x[k];
+      x[i] = sum / sri(i, i);
+   }
+   Rvector xNormal = info.Inverse() * rhs;
+
+   Real solErr = 0.0;
+   for (Integer i = 0; i < n; ++i)
+      solErr = GmatMathUtil::Max(solErr, fabs(x[i] - xNormal[i]) /
+            fabs(truth[i]));
+   out.Put("SRIF vs normal equation solution = ", solErr);
+   out.Validate(solErr < 1.0e-6, true);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestQRTriangularize/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestQRTriangularizeOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of QR triangularization!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,224 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestRandomStream
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for RandomStream and the RandomNumber streams.
+ *
+ * The Philox4x32-10 block function is checked against the published known
+ * answers.  Streams are then checked to give the same deviates from scalar
+ * and array calls, to be filled identically by one thread or by several, and
+ * to have the expected sample moments.  The RandomNumber stream selection is
+ * checked to continue each stream where it left off.  The bulk Gaussian rate
+ * is written out next to the std::mt19937 based RandomNumber rate.
+ *
+ * Output file:
+ * TestRandomStreamOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cmath>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "RandomStream.hpp"
+#include "RandomNumber.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Integer TRIAL_COUNT = 16;
+   const Integer TRIAL_SIZE  = 10001;
+
+   //---------------------------------------------------------------------------
+   // bool CheckPhilox(const uint32_t ctr[4], const uint32_t key[2],
+   //                  const uint32_t expected[4])
+   //---------------------------------------------------------------------------
+   bool CheckPhilox(const std::uint32_t ctr[4], const std::uint32_t key[2],
+                    const std::uint32_t expected[4])
+   {
+      std::uint32_t out[4];
+      RandomStream::Philox(ctr, key, out);
+      return (out[0] == expected[0]) && (out[1] == expected[1]) &&
+             (out[2] == expected[2]) && (out[3] == expected[3]);
+   }
+
+   //---------------------------------------------------------------------------
+   // void RunTrials(Integer first, Integer step, vector<vector<Real> > &data)
+   //---------------------------------------------------------------------------
+   void RunTrials(Integer first, Integer step, vector<vector<Real> > &data)
+   {
+      for (Integer t = first; t < TRIAL_COUNT; t += step)
+      {
+         RandomStream rs(20240601, t);
+         rs.GaussianArray(&data[t][0], TRIAL_SIZE, 1.0, 0.5);
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("======================================== Test Philox4x32-10");
+   const std::uint32_t zeroCtr[4] = {0, 0, 0, 0};
+   const std::uint32_t zeroKey[2] = {0, 0};
+   const std::uint32_t zeroOut[4] =
+         {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8};
+   out.Validate(CheckPhilox(zeroCtr, zeroKey, zeroOut), true);
+
+   const std::uint32_t onesCtr[4] =
+         {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+   const std::uint32_t onesKey[2] = {0xffffffff, 0xffffffff};
+   const std::uint32_t onesOut[4] =
+         {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd};
+   out.Validate(CheckPhilox(onesCtr, onesKey, onesOut), true);
+
+   const std::uint32_t piCtr[4] =
+         {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+   const std::uint32_t piKey[2] = {0xa4093822, 0x299f31d0};
+   const std::uint32_t piOut[4] =
+         {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1};
+   out.Validate(CheckPhilox(piCtr, piKey, piOut), true);
+
+   out.Put("======================================== Test scalar and array calls");
+   RandomStream scalar(42, 7), bulk(42, 7);
+   vector<Real> values(TRIAL_SIZE);
+   // A scalar first draw leaves a spare deviate for the array call to use
+   values[0] = bulk.Gaussian();
+   bulk.GaussianArray(&values[1], TRIAL_SIZE - 1);
+   bool same = true;
+   for (Integer i = 0; i < TRIAL_SIZE; ++i)
+      same = same && (scalar.Gaussian() == values[i]);
+   out.Validate(same, true);
+
+   RandomStream uniform(42, 7);
+   uniform.UniformArray(&values[0], TRIAL_SIZE);
+   uniform.SetPosition(TRIAL_SIZE / 2);
+   out.Validate(uniform.Uniform() == values[TRIAL_SIZE / 2 * 2], true);
+
+   Real lowest = 1.0, highest = 0.0;
+   for (Integer i = 0; i < TRIAL_SIZE; ++i)
+   {
+      lowest = min(lowest, values[i]);
+      highest = max(highest, values[i]);
+   }
+   out.Validate((lowest >= 0.0) && (highest < 1.0), true);
+
+   out.Put("======================================== Test serial and threaded trials");
+   vector<vector<Real> > serial(TRIAL_COUNT, vector<Real>(TRIAL_SIZE));
+   vector<vector<Real> > threaded(TRIAL_COUNT, vector<Real>(TRIAL_SIZE));
+   RunTrials(0, 1, serial);
+
+   vector<thread> workers;
+   for (Integer w = 0; w < 4; ++w)
+      workers.push_back(thread(RunTrials, w, 4, std::ref(threaded)));
+   for (UnsignedInt w = 0; w < workers.size(); ++w)
+      workers[w].join();
+   out.Validate(serial == threaded, true);
+   out.Validate(serial[0] == serial[1], false);
+
+   Real mean = 0.0, var = 0.0;
+   Integer count = TRIAL_COUNT * TRIAL_SIZE;
+   for (Integer t = 0; t < TRIAL_COUNT; ++t)
+      for (Integer i = 0; i < TRIAL_SIZE; ++i)
+         mean += serial[t][i];
+   mean /= count;
+   for (Integer t = 0; t < TRIAL_COUNT; ++t)
+      for (Integer i = 0; i < TRIAL_SIZE; ++i)
+         var += (serial[t][i] - mean) * (serial[t][i] - mean);
+   var /= (count - 1);
+   out.Put("sample mean = ", mean);
+   out.Put("sample standard deviation = ", sqrt(var));
+   out.Validate(fabs(mean - 1.0) < 0.005, true);
+   out.Validate(fabs(sqrt(var) - 0.5) < 0.005, true);
+
+   out.Put("======================================== Test RandomNumber streams");
+   RandomNumber *rn = RandomNumber::Instance();
+   rn->SetSeed(1234);
+   RandomStream reference = rn->GetStream(3);
+   Real first = reference.Gaussian();
+   Real second = reference.Gaussian();
+   Real third = reference.Gaussian();
+
+   rn->SelectStream(3);
+   out.Validate(rn->Gaussian() == first, true);
+   rn->ReleaseStream();
+   rn->Gaussian();
+   rn->SelectStream(5);
+   rn->Gaussian();
+   rn->SelectStream(3);
+   out.Validate(rn->Gaussian() == second, true);
+   out.Validate(rn->Gaussian(0.0, 1.0) == third, true);
+   rn->ReleaseStream();
+
+   // Reseeding starts the streams over
+   rn->SetSeed(1234);
+   rn->SelectStream(3);
+   out.Validate(rn->Gaussian() == first, true);
+   rn->ReleaseStream();
+
+   out.Put("======================================== Bulk Gaussian rate");
+   const Integer reps = 200;
+   RandomStream timed(99, 0);
+   chrono::steady_clock::time_point start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+      timed.GaussianArray(&values[0], TRIAL_SIZE);
+   Real streamTime =
+         chrono::duration<Real>(chrono::steady_clock::now() - start).count();
+
+   start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+      rn->GaussianArray(&values[0], TRIAL_SIZE);
+   Real generatorTime =
+         chrono::duration<Real>(chrono::steady_clock::now() - start).count();
+
+   Real draws = Real(reps) * TRIAL_SIZE;
+   out.Put("RandomStream deviates/sec = ", draws / streamTime);
+   out.Put("RandomNumber deviates/sec = ", draws / generatorTime);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestRandomStream/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestRandomStreamOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of RandomStream!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
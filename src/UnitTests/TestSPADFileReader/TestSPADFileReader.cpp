@@ -0,0 +1,157 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestSPADFileReader
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the bilinear and bicubic lookup of SPADFileReader.
+ *
+ * The SphericalModel SPAD file describes a sphere, so the area vector in any
+ * direction is the sphere's cross section along that direction.  Areas are
+ * read at grid points, between grid points, and across the azimuth wrap, and
+ * compared with that vector.  The time per lookup is reported.
+ *
+ * The SPAD file is passed as the first argument, or read from the test
+ * directory.
+ *
+ * Output file:
+ * TestSPADFileReaderOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "SPADFileReader.hpp"
+#include "RealUtilities.hpp"
+#include "GmatConstants.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   /// Cross section of the SphericalModel sphere, in m^2
+   const Real    SPHERE_AREA  = 8.945;
+   const Integer LOOKUP_COUNT = 100000;
+}
+
+
+//------------------------------------------------------------------------------
+// Rvector3 Direction(Real az, Real el)
+//------------------------------------------------------------------------------
+Rvector3 Direction(Real az, Real el)
+{
+   Real azRad = az * GmatMathConstants::RAD_PER_DEG;
+   Real elRad = el * GmatMathConstants::RAD_PER_DEG;
+   return Rvector3(GmatMathUtil::Cos(elRad) * GmatMathUtil::Cos(azRad),
+                   GmatMathUtil::Cos(elRad) * GmatMathUtil::Sin(azRad),
+                   GmatMathUtil::Sin(elRad));
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckArea(TestOutput &out, SPADFileReader &reader, Real az, Real el,
+//                Real tol)
+//------------------------------------------------------------------------------
+void CheckArea(TestOutput &out, SPADFileReader &reader, Real az, Real el,
+               Real tol)
+{
+   bool scaled;
+   Rvector3 dir   = Direction(az, el);
+   Rvector3 area  = reader.GetSRPArea(dir, scaled);
+   Rvector3 drag  = reader.GetDragArea(dir, scaled);
+   Rvector3 expct = dir * SPHERE_AREA;
+   out.Validate(area[0], area[1], area[2], expct[0], expct[1], expct[2], tol);
+   out.Validate(drag[0], drag[1], drag[2], area[0], area[1], area[2]);
+   out.Validate(scaled, false);
+}
+
+
+//------------------------------------------------------------------------------
+// void RunReader(TestOutput &out, const std::string &spadFile,
+//                const std::string &interp, Real tol)
+//------------------------------------------------------------------------------
+void RunReader(TestOutput &out, const std::string &spadFile,
+               const std::string &interp, Real tol)
+{
+   SPADFileReader reader;
+   reader.SetFile(spadFile);
+   reader.SetInterpolator(interp);
+   reader.Initialize();
+
+   out.Put("======================================== " + interp + " grid points");
+   CheckArea(out, reader, 0.0, 0.0, 1.0e-10);
+   CheckArea(out, reader, 45.0, 30.0, 1.0e-10);
+   CheckArea(out, reader, -120.0, 60.0, 1.0e-10);
+
+   out.Put("======================================== " + interp + " between grid points");
+   for (Real az = -177.5; az < 180.0; az += 12.25)
+      for (Real el = -62.5; el < 89.0; el += 11.125)
+         CheckArea(out, reader, az, el, tol);
+
+   out.Put("======================================== " + interp + " azimuth wrap");
+   CheckArea(out, reader, 179.0, 10.0, tol);
+   CheckArea(out, reader, -179.0, 10.0, tol);
+
+   out.Put("======================================== " + interp + " copy");
+   SPADFileReader copy(reader);
+   bool scaled;
+   Rvector3 dir = Direction(33.3, -22.2);
+   Rvector3 a1  = reader.GetSRPArea(dir, scaled);
+   Rvector3 a2  = copy.GetSRPArea(dir, scaled);
+   out.Validate(a2[0], a2[1], a2[2], a1[0], a1[1], a1[2]);
+
+   out.Put("======================================== " + interp + " benchmark");
+   Real sum = 0.0;
+   std::chrono::steady_clock::time_point begin =
+         std::chrono::steady_clock::now();
+   for (Integer k = 0; k < LOOKUP_COUNT; ++k)
+   {
+      Real az = -179.0 + 358.0 * k / LOOKUP_COUNT;
+      Real el = -60.0 + 149.0 * ((k * 7919) % LOOKUP_COUNT) / LOOKUP_COUNT;
+      sum += reader.GetSRPArea(Direction(az, el), scaled)[2];
+   }
+   Real elapsed = std::chrono::duration<Real>(
+         std::chrono::steady_clock::now() - begin).count();
+   out.Put("mean z area = ", sum / LOOKUP_COUNT);
+   out.Put("microseconds per GetSRPArea = ", elapsed / LOOKUP_COUNT * 1.0e6);
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestSPADFileReader/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestSPADFileReaderOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      std::string spadFile = (argc > 1 ? argv[1] : outPath + "SphericalModel.spo");
+      RunReader(out, spadFile, "Bilinear", 2.0e-2);
+      RunReader(out, spadFile, "Bicubic", 1.0e-3);
+      out.Put("\nSuccessfully ran unit testing of SPADFileReader!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,248 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestStateBatch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the StateConversionUtil batch conversions.
+ *
+ * A set of orbits mixing elliptic, hyperbolic, circular and equatorial states
+ * is converted by the batch methods and one state at a time, and the results
+ * are compared.  The mean anomaly solver is checked against
+ * MeanToTrueAnomaly(), and the conversion rates are written out.
+ *
+ * Output file:
+ * TestStateBatchOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <ctime>
+#include "gmatdefs.hpp"
+#include "StateConversionUtil.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+static const Real MU = 398600.4415;
+
+//------------------------------------------------------------------------------
+// void MakeStates(Integer count, RealArray &keplerian)
+//------------------------------------------------------------------------------
+void MakeStates(Integer count, RealArray &keplerian)
+{
+   keplerian.assign(6 * count, 0.0);
+   for (Integer i = 0; i < count; ++i)
+   {
+      Real ecc = 0.9 * fmod(i * 0.618034, 1.0);
+      Real sma = 6800.0 + 30000.0 * fmod(i * 0.414214, 1.0);
+      Real inc = 180.0 * fmod(i * 0.302776, 1.0);
+      if (i % 17 == 0)
+      {
+         ecc = 1.5;                 // hyperbolic
+         sma = -20000.0;
+      }
+      else if (i % 19 == 0)
+         ecc = 0.0;                 // circular
+      if (i % 23 == 0)
+         inc = 0.0;                 // equatorial
+      keplerian[i]           = sma;
+      keplerian[count + i]   = ecc;
+      keplerian[2*count + i] = inc;
+      keplerian[3*count + i] = 360.0 * fmod(i * 0.7548777, 1.0);
+      keplerian[4*count + i] = 360.0 * fmod(i * 0.5698403, 1.0);
+      keplerian[5*count + i] = (ecc > 1.0 ? 40.0 : 360.0 * fmod(i * 0.2360680, 1.0));
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real MaxDifference(Integer count, const RealArray &batch,
+//                    const std::vector<Rvector6> &single, bool angles)
+//------------------------------------------------------------------------------
+Real MaxDifference(Integer count, const RealArray &batch,
+                   const std::vector<Rvector6> &single, bool angles)
+{
+   Real maxDiff = 0.0;
+   for (Integer i = 0; i < count; ++i)
+      for (Integer j = 0; j < 6; ++j)
+      {
+         Real diff = fabs(batch[j*count + i] - single[i][j]);
+         if (angles && (j >= 2))
+            diff = fmin(diff, fabs(diff - 360.0));
+         else
+            diff /= fmax(1.0, fabs(single[i][j]));
+         maxDiff = fmax(maxDiff, diff);
+      }
+   return maxDiff;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   const Integer count = 1000;
+   RealArray keplerian;
+   MakeStates(count, keplerian);
+
+   out.Put("========================= Test KeplerianToCartesianBatch");
+
+   std::vector<Rvector6> single(count);
+   RealArray cartesian(6 * count);
+   for (Integer i = 0; i < count; ++i)
+      single[i] = StateConversionUtil::KeplerianToCartesian(MU,
+            Rvector6(keplerian[i], keplerian[count+i], keplerian[2*count+i],
+                     keplerian[3*count+i], keplerian[4*count+i],
+                     keplerian[5*count+i]), StateConversionUtil::TA);
+   StateConversionUtil::KeplerianToCartesianBatch(MU, count, &keplerian[0],
+         &cartesian[0], StateConversionUtil::TA);
+   Real diff = MaxDifference(count, cartesian, single, false);
+   out.Put("TA: max relative difference = ", diff);
+   out.Validate(diff < 1.0e-14, true);
+
+   RealArray fromMean(6 * count);
+   for (Integer i = 0; i < count; ++i)
+      single[i] = StateConversionUtil::KeplerianToCartesian(MU,
+            Rvector6(keplerian[i], keplerian[count+i], keplerian[2*count+i],
+                     keplerian[3*count+i], keplerian[4*count+i],
+                     keplerian[5*count+i]), StateConversionUtil::MA);
+   StateConversionUtil::KeplerianToCartesianBatch(MU, count, &keplerian[0],
+         &fromMean[0], StateConversionUtil::MA);
+   diff = MaxDifference(count, fromMean, single, false);
+   out.Put("MA: max relative difference = ", diff);
+   out.Validate(diff < 1.0e-14, true);
+
+   out.Put("========================= Test CartesianToKeplerianBatch");
+
+   RealArray elements(6 * count);
+   StateConversionUtil::AnomalyType types[2] =
+      { StateConversionUtil::TA, StateConversionUtil::MA };
+   for (Integer t = 0; t < 2; ++t)
+   {
+      for (Integer i = 0; i < count; ++i)
+         single[i] = StateConversionUtil::CartesianToKeplerian(MU,
+               Rvector6(cartesian[i], cartesian[count+i], cartesian[2*count+i],
+                        cartesian[3*count+i], cartesian[4*count+i],
+                        cartesian[5*count+i]), types[t]);
+      StateConversionUtil::CartesianToKeplerianBatch(MU, count, &cartesian[0],
+            &elements[0], types[t]);
+      diff = MaxDifference(count, elements, single, true);
+      out.Put("max difference (relative, or deg) = ", diff);
+      out.Validate(diff < 1.0e-10, true);
+   }
+
+   out.Put("========================= Test MeanToTrueAnomalyBatch");
+
+   RealArray ma(count), ecc(count), ta(count);
+   for (Integer i = 0; i < count; ++i)
+   {
+      ma[i] = GmatMathConstants::TWO_PI * fmod(i * 0.381966, 1.0);
+      ecc[i] = (i % 50 == 0 ? 2.0 : 0.99 * fmod(i * 0.618034, 1.0));
+   }
+   StateConversionUtil::MeanToTrueAnomalyBatch(count, &ma[0], &ecc[0], &ta[0]);
+   Real maxDiff = 0.0;
+   for (Integer i = 0; i < count; ++i)
+      maxDiff = fmax(maxDiff, fabs(ta[i] -
+                     StateConversionUtil::MeanToTrueAnomaly(ma[i], ecc[i])));
+   out.Put("max difference (rad) = ", maxDiff);
+   out.Validate(maxDiff < 1.0e-14, true);
+
+   out.Put("========================= Test ConvertBatch");
+
+   RealArray converted = StateConversionUtil::ConvertBatch(keplerian,
+         "Keplerian", "Cartesian", MU);
+   out.Validate(converted == cartesian, true);
+
+   // Other pairs are converted one state at a time
+   RealArray one(6);
+   for (Integer j = 0; j < 6; ++j)
+      one[j] = cartesian[j*count + 5];
+   RealArray equinoctial = StateConversionUtil::ConvertBatch(one,
+         "Cartesian", "Equinoctial", MU);
+   Rvector6 eq = StateConversionUtil::Convert(Rvector6(one[0], one[1], one[2],
+         one[3], one[4], one[5]), "Cartesian", "Equinoctial", MU);
+   bool same = true;
+   for (Integer j = 0; j < 6; ++j)
+      same = same && (equinoctial[j] == eq[j]);
+   out.Validate(same, true);
+
+   bool caught = false;
+   try
+   {
+      StateConversionUtil::ConvertBatch(RealArray(7, 1.0), "Cartesian",
+                                        "Keplerian", MU);
+   }
+   catch (BaseException &)
+   {
+      caught = true;
+   }
+   out.Validate(caught, true);
+
+   out.Put("========================= Conversion rates");
+
+   MakeStates(count, keplerian);
+   for (Integer i = 0; i < count; ++i)
+   {
+      keplerian[count + i] = 0.5 * keplerian[count + i];
+      keplerian[i] = fabs(keplerian[i]);
+   }
+   const Integer repeats = 200;
+   clock_t begin = clock();
+   for (Integer r = 0; r < repeats; ++r)
+      for (Integer i = 0; i < count; ++i)
+         single[i] = StateConversionUtil::KeplerianToCartesian(MU,
+               Rvector6(keplerian[i], keplerian[count+i], keplerian[2*count+i],
+                        keplerian[3*count+i], keplerian[4*count+i],
+                        keplerian[5*count+i]), StateConversionUtil::MA);
+   Real scalarTime = (Real)(clock() - begin) / CLOCKS_PER_SEC;
+   begin = clock();
+   for (Integer r = 0; r < repeats; ++r)
+      StateConversionUtil::KeplerianToCartesianBatch(MU, count, &keplerian[0],
+            &cartesian[0], StateConversionUtil::MA);
+   Real batchTime = (Real)(clock() - begin) / CLOCKS_PER_SEC;
+   out.Put("MA to Cartesian, states per second, one at a time = ",
+           count * repeats / fmax(scalarTime, 1.0e-6));
+   out.Put("MA to Cartesian, states per second, batch         = ",
+           count * repeats / fmax(batchTime, 1.0e-6));
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestStateBatch/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestStateBatchOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the batch state conversions!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,312 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestStationNetwork
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the batched range, azimuth and elevation of StationNetwork.
+ *
+ * An 80 station network on the Earth ellipsoid is evaluated against targets
+ * at several body orientations and compared with a per station SEZ
+ * conversion built from each station's geodetic latitude and longitude.
+ * Targets placed at known azimuths and elevations check the angle
+ * conventions, the minimum elevation and the interpolated horizon mask.  The
+ * time per station and target is reported for both paths.
+ *
+ * Output file:
+ * TestStationNetworkOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "StationNetwork.hpp"
+#include "RealUtilities.hpp"
+#include "GmatConstants.hpp"
+#include "GmatDefaults.hpp"
+#include "StringUtil.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   const Real    EARTH_RADIUS  =
+         GmatSolarSystemDefaults::PLANET_EQUATORIAL_RADIUS[GmatSolarSystemDefaults::EARTH];
+   const Real    EARTH_FLAT    =
+         GmatSolarSystemDefaults::PLANET_FLATTENING[GmatSolarSystemDefaults::EARTH];
+   const Integer STATION_COUNT = 80;
+   const Integer TARGET_COUNT  = 100;
+   const Integer REPEAT_COUNT  = 200;
+}
+
+
+//------------------------------------------------------------------------------
+// Rvector3 GeodeticToBodyFixed(Real latDeg, Real lonDeg, Real height)
+//------------------------------------------------------------------------------
+Rvector3 GeodeticToBodyFixed(Real latDeg, Real lonDeg, Real height)
+{
+   Real lat = latDeg * GmatMathConstants::RAD_PER_DEG;
+   Real lon = lonDeg * GmatMathConstants::RAD_PER_DEG;
+   Real e2  = 2.0 * EARTH_FLAT - EARTH_FLAT * EARTH_FLAT;
+   Real N   = EARTH_RADIUS / GmatMathUtil::Sqrt(1.0 - e2 * GmatMathUtil::Sin(lat) *
+                                                GmatMathUtil::Sin(lat));
+   return Rvector3((N + height) * GmatMathUtil::Cos(lat) * GmatMathUtil::Cos(lon),
+                   (N + height) * GmatMathUtil::Cos(lat) * GmatMathUtil::Sin(lon),
+                   (N * (1.0 - e2) + height) * GmatMathUtil::Sin(lat));
+}
+
+
+//------------------------------------------------------------------------------
+// Rmatrix33 TopocentricToBodyFixed(Real latDeg, Real lonDeg)
+//------------------------------------------------------------------------------
+/**
+ * Returns the matrix with the south, east and zenith axes as its columns.
+ */
+//------------------------------------------------------------------------------
+Rmatrix33 TopocentricToBodyFixed(Real latDeg, Real lonDeg)
+{
+   Real lat = latDeg * GmatMathConstants::RAD_PER_DEG;
+   Real lon = lonDeg * GmatMathConstants::RAD_PER_DEG;
+   Real sLat = GmatMathUtil::Sin(lat), cLat = GmatMathUtil::Cos(lat);
+   Real sLon = GmatMathUtil::Sin(lon), cLon = GmatMathUtil::Cos(lon);
+   return Rmatrix33(sLat * cLon, -sLon, cLat * cLon,
+                    sLat * sLon,  cLon, cLat * sLon,
+                    -cLat,        0.0,  sLat);
+}
+
+
+//------------------------------------------------------------------------------
+// Rmatrix33 BodyToInertial(Real angleDeg)
+//------------------------------------------------------------------------------
+Rmatrix33 BodyToInertial(Real angleDeg)
+{
+   Real a = angleDeg * GmatMathConstants::RAD_PER_DEG;
+   return Rmatrix33(GmatMathUtil::Cos(a), -GmatMathUtil::Sin(a), 0.0,
+                    GmatMathUtil::Sin(a),  GmatMathUtil::Cos(a), 0.0,
+                    0.0,                   0.0,                  1.0);
+}
+
+
+//------------------------------------------------------------------------------
+// Rvector3 TargetAt(Real latDeg, Real lonDeg, Real azDeg, Real elDeg,
+//                   Real range, const Rmatrix33 &bfToInertial)
+//------------------------------------------------------------------------------
+/**
+ * Returns the inertial position seen at an azimuth, elevation and range from
+ * a station on the surface.
+ */
+//------------------------------------------------------------------------------
+Rvector3 TargetAt(Real latDeg, Real lonDeg, Real azDeg, Real elDeg, Real range,
+                  const Rmatrix33 &bfToInertial)
+{
+   Real az = azDeg * GmatMathConstants::RAD_PER_DEG;
+   Real el = elDeg * GmatMathConstants::RAD_PER_DEG;
+   Rvector3 sez(-range * GmatMathUtil::Cos(el) * GmatMathUtil::Cos(az),
+                range * GmatMathUtil::Cos(el) * GmatMathUtil::Sin(az),
+                range * GmatMathUtil::Sin(el));
+   Rvector3 bf = GeodeticToBodyFixed(latDeg, lonDeg, 0.0) +
+                 TopocentricToBodyFixed(latDeg, lonDeg) * sez;
+   return bfToInertial * bf;
+}
+
+
+//------------------------------------------------------------------------------
+// void ReferenceRangeAzEl(Real latDeg, Real lonDeg, Real height,
+//       const Rmatrix33 &bfToInertial, const Rvector3 &target,
+//       Real &range, Real &az, Real &el)
+//------------------------------------------------------------------------------
+/**
+ * Per station SEZ conversion, rebuilding the station frame for each call.
+ */
+//------------------------------------------------------------------------------
+void ReferenceRangeAzEl(Real latDeg, Real lonDeg, Real height,
+      const Rmatrix33 &bfToInertial, const Rvector3 &target,
+      Real &range, Real &az, Real &el)
+{
+   Rmatrix33 RFT = TopocentricToBodyFixed(latDeg, lonDeg);
+   Rvector3 rho = bfToInertial.Transpose() * target -
+                  GeodeticToBodyFixed(latDeg, lonDeg, height);
+   Rvector3 sez = RFT.Transpose() * rho;
+   range = sez.GetMagnitude();
+   el    = GmatMathUtil::ASin(sez[2] / range) * GmatMathConstants::DEG_PER_RAD;
+   az    = GmatMathUtil::ATan(sez[1], -sez[0]) * GmatMathConstants::DEG_PER_RAD;
+   if (az < 0.0)
+      az += 360.0;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   StationNetwork network;
+   RealArray lats, lons, heights;
+   for (Integer i = 0; i < STATION_COUNT; ++i)
+   {
+      lats.push_back(-70.0 + 140.0 * i / (STATION_COUNT - 1));
+      lons.push_back(-180.0 + 137.5 * i - 360.0 * (Integer)((137.5 * i) / 360.0));
+      heights.push_back(0.001 * (i % 5));
+      out.Validate(network.AddStation("Station" + GmatStringUtil::ToString(i, 1),
+            GeodeticToBodyFixed(lats[i], lons[i], heights[i])), i);
+   }
+   out.Validate(network.GetStationCount(), STATION_COUNT);
+
+   std::vector<Rvector3> targets;
+   for (Integer t = 0; t < TARGET_COUNT; ++t)
+   {
+      Real r   = 6800.0 + 36000.0 * ((t * 37) % TARGET_COUNT) / TARGET_COUNT;
+      Real ra  = 360.0 * t / TARGET_COUNT * GmatMathConstants::RAD_PER_DEG;
+      Real dec = (-60.0 + 120.0 * ((t * 61) % TARGET_COUNT) / TARGET_COUNT) *
+                 GmatMathConstants::RAD_PER_DEG;
+      targets.push_back(Rvector3(r * GmatMathUtil::Cos(dec) * GmatMathUtil::Cos(ra),
+                                 r * GmatMathUtil::Cos(dec) * GmatMathUtil::Sin(ra),
+                                 r * GmatMathUtil::Sin(dec)));
+   }
+
+   out.Put("======================================== Test against per station SEZ");
+   Real maxRangeErr = 0.0, maxAngleErr = 0.0;
+   for (Real angle = 0.0; angle < 360.0; angle += 73.0)
+   {
+      Rmatrix33 R = BodyToInertial(angle);
+      network.Evaluate(R, targets);
+      out.Validate(network.GetTargetCount(), TARGET_COUNT);
+      for (Integer t = 0; t < TARGET_COUNT; ++t)
+      {
+         for (Integer s = 0; s < STATION_COUNT; ++s)
+         {
+            Real range, az, el;
+            ReferenceRangeAzEl(lats[s], lons[s], heights[s], R, targets[t],
+                               range, az, el);
+            Real dAz = GmatMathUtil::Abs(network.GetAzimuth(s, t) - az);
+            if (dAz > 180.0)
+               dAz = 360.0 - dAz;
+            maxRangeErr = GmatMathUtil::Max(maxRangeErr,
+                  GmatMathUtil::Abs(network.GetRange(s, t) - range));
+            maxAngleErr = GmatMathUtil::Max(maxAngleErr, dAz);
+            maxAngleErr = GmatMathUtil::Max(maxAngleErr,
+                  GmatMathUtil::Abs(network.GetElevation(s, t) - el));
+            if (network.IsVisible(s, t) != (el > 0.0))
+               out.Validate(network.IsVisible(s, t), el > 0.0);
+         }
+      }
+   }
+   out.Validate(maxRangeErr, 0.0, 1.0e-8);
+   out.Validate(maxAngleErr, 0.0, 1.0e-8);
+
+   out.Put("======================================== Test angle conventions");
+   StationNetwork single;
+   single.AddStation("Single", GeodeticToBodyFixed(40.0, -75.0, 0.0), 10.0);
+   Rmatrix33 R = BodyToInertial(31.0);
+   std::vector<Rvector3> known;
+   known.push_back(TargetAt(40.0, -75.0,   0.0, 20.0, 1000.0, R));
+   known.push_back(TargetAt(40.0, -75.0,  90.0, 20.0, 1000.0, R));
+   known.push_back(TargetAt(40.0, -75.0, 200.0, 60.0, 2000.0, R));
+   known.push_back(TargetAt(40.0, -75.0, 300.0,  5.0, 1500.0, R));
+   single.Evaluate(R, known);
+   out.Validate(single.GetAzimuth(0, 0), 0.0, 1.0e-8);
+   out.Validate(single.GetAzimuth(0, 1), 90.0, 1.0e-8);
+   out.Validate(single.GetAzimuth(0, 2), 200.0, 1.0e-8);
+   out.Validate(single.GetElevation(0, 2), 60.0, 1.0e-8);
+   out.Validate(single.GetRange(0, 3), 1500.0, 1.0e-8);
+   out.Validate(single.IsVisible(0, 0), true);
+   out.Validate(single.IsVisible(0, 3), false);
+
+   out.Put("======================================== Test horizon mask");
+   RealArray maskAz, maskEl;
+   maskAz.push_back(90.0);   maskEl.push_back(30.0);
+   maskAz.push_back(0.0);    maskEl.push_back(10.0);
+   maskAz.push_back(270.0);  maskEl.push_back(5.0);
+   single.SetHorizonMask(0, maskAz, maskEl);
+   known.clear();
+   known.push_back(TargetAt(40.0, -75.0,  45.0, 19.0, 1000.0, R));
+   known.push_back(TargetAt(40.0, -75.0,  45.0, 21.0, 1000.0, R));
+   known.push_back(TargetAt(40.0, -75.0, 315.0, 12.0, 1000.0, R));
+   known.push_back(TargetAt(40.0, -75.0, 180.0, 19.0, 1000.0, R));
+   known.push_back(TargetAt(40.0, -75.0, 180.0, 18.0, 1000.0, R));
+   single.Evaluate(R, known);
+   out.Validate(single.IsVisible(0, 0), false);
+   out.Validate(single.IsVisible(0, 1), true);
+   // The mask is 7.5 deg at 315 deg, so the minimum elevation governs
+   out.Validate(single.IsVisible(0, 2), true);
+   // The mask is 17.5 deg at 180 deg
+   out.Validate(single.IsVisible(0, 3), true);
+   out.Validate(single.IsVisible(0, 4), true);
+   known.clear();
+   known.push_back(TargetAt(40.0, -75.0, 180.0, 17.0, 1000.0, R));
+   single.Evaluate(R, known);
+   out.Validate(single.IsVisible(0, 0), false);
+
+   out.Put("======================================== Benchmark");
+   Real sum = 0.0;
+   std::chrono::steady_clock::time_point begin =
+         std::chrono::steady_clock::now();
+   for (Integer k = 0; k < REPEAT_COUNT; ++k)
+   {
+      network.Evaluate(BodyToInertial(0.25 * k), targets);
+      sum += network.GetElevation(k % STATION_COUNT, k % TARGET_COUNT);
+   }
+   Real batched = std::chrono::duration<Real>(
+         std::chrono::steady_clock::now() - begin).count();
+
+   begin = std::chrono::steady_clock::now();
+   for (Integer k = 0; k < REPEAT_COUNT; ++k)
+   {
+      Rmatrix33 Rk = BodyToInertial(0.25 * k);
+      for (Integer t = 0; t < TARGET_COUNT; ++t)
+         for (Integer s = 0; s < STATION_COUNT; ++s)
+         {
+            Real range, az, el;
+            ReferenceRangeAzEl(lats[s], lons[s], heights[s], Rk, targets[t],
+                               range, az, el);
+            sum += el;
+         }
+   }
+   Real perStation = std::chrono::duration<Real>(
+         std::chrono::steady_clock::now() - begin).count();
+
+   Real pairs = (Real)REPEAT_COUNT * STATION_COUNT * TARGET_COUNT;
+   out.Put("checksum = ", sum);
+   out.Put("microseconds per pair, batched    = ", batched / pairs * 1.0e6);
+   out.Put("microseconds per pair, per station = ", perStation / pairs * 1.0e6);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestStationNetwork/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestStationNetworkOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of StationNetwork!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,214 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           TestStopCondAllocation
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for the steady state memory use of StopCondition.
+ *
+ * A stopping condition on a ramped parameter is evaluated, and its ring buffer
+ * filled, for 10000 steps each while the global operator new counts the heap
+ * allocations made.  After Initialize() and the first point, neither loop
+ * should allocate, including the interpolation of the stop epoch, which is
+ * checked against the ramp.
+ *
+ * Output file:
+ * TestStopCondAllocationOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <new>
+#include "gmatdefs.hpp"
+#include "StopCondition.hpp"
+#include "RealVar.hpp"
+#include "NotAKnotInterpolator.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   bool    countAllocations = false;
+   Integer allocationCount  = 0;
+}
+
+//------------------------------------------------------------------------------
+// Counting replacements for the global allocation functions
+//------------------------------------------------------------------------------
+void* operator new(std::size_t size)
+{
+   if (countAllocations)
+      ++allocationCount;
+   void *mem = malloc(size == 0 ? 1 : size);
+   if (mem == NULL)
+      throw std::bad_alloc();
+   return mem;
+}
+
+void* operator new[](std::size_t size)
+{
+   return operator new(size);
+}
+
+void operator delete(void *mem) noexcept
+{
+   free(mem);
+}
+
+void operator delete[](void *mem) noexcept
+{
+   free(mem);
+}
+
+void operator delete(void *mem, std::size_t) noexcept
+{
+   free(mem);
+}
+
+void operator delete[](void *mem, std::size_t) noexcept
+{
+   free(mem);
+}
+
+
+//------------------------------------------------------------------------------
+// System parameter whose value is set directly by the test
+//------------------------------------------------------------------------------
+class RampParameter : public RealVar
+{
+public:
+   RampParameter(const std::string &name) :
+      RealVar(name, "", "Ramp", GmatParam::SYSTEM_PARAM)
+   {
+   }
+
+   virtual Real EvaluateReal()
+   {
+      return GetReal();
+   }
+
+   virtual GmatBase* Clone() const
+   {
+      return new RampParameter(*this);
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   const Integer steps = 10000;
+   const Real    t0 = 21545.0, dt = 60.0 / 86400.0;
+
+   RampParameter epoch("RampEpoch");
+   RampParameter ramp("Ramp");
+
+   out.Put("======================================== Test Evaluate()");
+   // The goal is never reached, so every step takes the full path
+   StopCondition stop("RampStop", "", &epoch, &ramp, 1.0e9);
+   stop.Initialize();
+   out.Put("buffer size = ", stop.GetBufferSize());
+
+   epoch.SetReal(t0);
+   ramp.SetReal(0.0);
+   stop.Evaluate();
+
+   allocationCount = 0;
+   countAllocations = true;
+   Integer met = 0;
+   for (Integer k = 1; k <= steps; ++k)
+   {
+      epoch.SetReal(t0 + k * dt);
+      ramp.SetReal(k);
+      if (stop.Evaluate())
+         ++met;
+   }
+   countAllocations = false;
+   out.Put("allocations in 10000 evaluations = ", allocationCount);
+   out.Validate(met, 0);
+   out.Validate(allocationCount, 0);
+
+   out.Put("======================================== Test AddToBuffer()");
+   // The goal lies past the last step, so the buffer keeps rolling
+   const Real goal = steps + 0.5;
+
+   // The interpolator builds its arrays on first use, as it does on the
+   // first stop of a run
+   Interpolator *interp = new NotAKnotInterpolator("RampInterpolator");
+   Real point = 0.0;
+   interp->AddPoint(0.0, &point);
+   interp->Clear();
+
+   StopCondition buffered("BufferedStop", "", &epoch, &ramp, goal,
+         StopCondition::STOP_COND_TOL, 1, interp);
+   buffered.Initialize();
+
+   epoch.SetReal(t0);
+   ramp.SetReal(0.0);
+   buffered.Evaluate();
+   buffered.AddToBuffer(true);
+
+   allocationCount = 0;
+   countAllocations = true;
+   for (Integer k = 1; k <= steps; ++k)
+   {
+      epoch.SetReal(t0 + k * dt);
+      ramp.SetReal(k);
+      buffered.AddToBuffer(false);
+   }
+
+   // And one step past the goal brackets it
+   epoch.SetReal(t0 + (steps + 1) * dt);
+   ramp.SetReal(steps + 1);
+   bool found = buffered.AddToBuffer(false);
+   countAllocations = false;
+
+   out.Put("allocations in 10000 buffered points = ", allocationCount);
+   out.Validate(allocationCount, 0);
+   out.Validate(found, true);
+   out.Put("stop epoch = ", buffered.GetStopEpoch());
+   out.Validate(buffered.GetStopEpoch(), t0 + goal * dt);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestStopCondAllocation/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestStopCondAllocationOut.txt";
+   TestOutput out(outFile);
+   out.SetPrecision(16);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of StopCondition allocation!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
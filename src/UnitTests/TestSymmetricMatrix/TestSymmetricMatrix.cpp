@@ -0,0 +1,266 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TestSymmetricMatrix
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for SymmetricMatrix.
+ *
+ * Normal matrices are accumulated from weighted rows of partials with
+ * AddRankK(), and checked to be bit for bit the dense upper triangle sums.
+ * The packed Cholesky factor is compared with CholeskyFactorization::Factor,
+ * and the packed inverse with CholeskyFactorization::Invert.  The time per
+ * accumulation and inversion is written out next to the dense versions.
+ *
+ * Output file:
+ * TestSymmetricMatrixOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "Rmatrix.hpp"
+#include "SymmetricMatrix.hpp"
+#include "CholeskyFactorization.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   //---------------------------------------------------------------------------
+   // Real TestElement(Integer i, Integer j)
+   //---------------------------------------------------------------------------
+   Real TestElement(Integer i, Integer j)
+   {
+      // Scattered values in [-0.5, 0.5), like random partials
+      Real x = sin(12.9898 * i + 78.233 * j + 0.5) * 43758.5453;
+      return x - floor(x) - 0.5;
+   }
+
+   //---------------------------------------------------------------------------
+   // Real Seconds(chrono::steady_clock::time_point start)
+   //---------------------------------------------------------------------------
+   Real Seconds(chrono::steady_clock::time_point start)
+   {
+      return chrono::duration<Real>(chrono::steady_clock::now() - start).count();
+   }
+
+   //---------------------------------------------------------------------------
+   // void DenseUpdate(Rmatrix &info, const RealArray &rows,
+   //                  const RealArray &weights, Integer n, Integer count)
+   //---------------------------------------------------------------------------
+   void DenseUpdate(Rmatrix &info, const RealArray &rows,
+                    const RealArray &weights, Integer n, Integer count)
+   {
+      for (Integer i = 0; i < n; ++i)
+         for (Integer j = i; j < n; ++j)
+         {
+            Real sum = info(i, j);
+            for (Integer k = 0; k < count; ++k)
+               sum += rows[k * n + i] * rows[k * n + j] * weights[k];
+            info(i, j) = sum;
+            info(j, i) = sum;
+         }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void RunSize(Integer n, Integer reps, TestOutput &out)
+//------------------------------------------------------------------------------
+void RunSize(Integer n, Integer reps, TestOutput &out)
+{
+   out.Put("size = ", n);
+
+   // Two blocks of measurement rows, more rows than parameters
+   const Integer count = 2 * n + 8;
+   RealArray rows(count * n), weights(count);
+   for (Integer k = 0; k < count; ++k)
+   {
+      weights[k] = 1.0 + 0.25 * (k % 5);
+      for (Integer i = 0; i < n; ++i)
+         rows[k * n + i] = TestElement(k, i);
+   }
+
+   Rmatrix dense(n, n);
+   DenseUpdate(dense, rows, weights, n, count / 2);
+   DenseUpdate(dense, RealArray(rows.begin() + (count / 2) * n, rows.end()),
+         RealArray(weights.begin() + count / 2, weights.end()), n,
+         count - count / 2);
+
+   SymmetricMatrix packed(n);
+   packed.AddRankK(&rows[0], &weights[0], count / 2);
+   packed.AddRankK(&rows[(count / 2) * n], &weights[count / 2],
+         count - count / 2);
+
+   bool same = true;
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         same = same && (packed(i, j) == dense(i, j));
+   out.Validate(same, true);
+   out.Validate(packed.ToRmatrix() == dense, true);
+
+   SymmetricMatrix single(n);
+   for (Integer k = 0; k < count; ++k)
+      single.AddRankOne(&rows[k * n], weights[k]);
+   same = true;
+   for (Integer i = 0; i < packed.GetElementCount(); ++i)
+      same = same && (single.GetDataVector()[i] == packed.GetDataVector()[i]);
+   out.Validate(same, true);
+
+   // Packed Cholesky factor against the dense Factor()
+   CholeskyFactorization chol;
+   Rmatrix R(n, n);
+   chol.Factor(dense, R);
+   SymmetricMatrix factor = packed;
+   factor.CholeskyFactor();
+   Real maxDiff = 0.0, scale = 0.0;
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = i; j < n; ++j)
+      {
+         maxDiff = max(maxDiff, fabs(R(i, j) - factor(i, j)));
+         scale = max(scale, fabs(R(i, j)));
+      }
+   out.Put("max Cholesky factor difference = ", maxDiff / scale);
+   out.Validate(maxDiff / scale < 1.0e-12, true);
+
+   // Packed inverse against the dense Invert()
+   Rmatrix inverse = dense;
+   chol.Invert(inverse);
+   SymmetricMatrix packedInverse = packed;
+   packedInverse.Invert();
+   same = true;
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         same = same && (packedInverse(i, j) == inverse(i, j));
+   out.Validate(same, true);
+
+   Rmatrix product = dense * packedInverse.ToRmatrix();
+   Real maxError = 0.0;
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         maxError = max(maxError, fabs(product(i, j) - (i == j ? 1.0 : 0.0)));
+   out.Put("max |A inv(A) - I| = ", maxError);
+   out.Validate(maxError < 1.0e-8, true);
+
+   // Timing
+   chrono::steady_clock::time_point start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+      DenseUpdate(dense, rows, weights, n, count);
+   Real denseTime = Seconds(start);
+
+   start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+      packed.AddRankK(&rows[0], &weights[0], count);
+   Real packedTime = Seconds(start);
+   out.Put("dense update  microseconds = ", denseTime * 1.0e6 / reps);
+   out.Put("AddRankK      microseconds = ", packedTime * 1.0e6 / reps);
+
+   start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+   {
+      inverse = dense;
+      chol.Invert(inverse);
+   }
+   denseTime = Seconds(start);
+
+   start = chrono::steady_clock::now();
+   for (Integer r = 0; r < reps; ++r)
+   {
+      packedInverse = packed;
+      packedInverse.Invert();
+   }
+   packedTime = Seconds(start);
+   out.Put("dense Invert  microseconds = ", denseTime * 1.0e6 / reps);
+   out.Put("packed Invert microseconds = ", packedTime * 1.0e6 / reps);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   out.Put("======================================== Test element access");
+   SymmetricMatrix sm(4);
+   out.Validate(sm.GetElementCount(), 10);
+   sm(1, 3) = 2.5;
+   out.Validate(sm(3, 1), 2.5);
+   sm(3, 1) += 1.0;
+   out.Validate(sm(1, 3), 3.5);
+
+   Rmatrix upper(3, 3);
+   upper(0, 1) = 4.0;
+   upper(1, 0) = -1.0;     // The lower triangle is not read
+   upper(2, 2) = 9.0;
+   SymmetricMatrix fromDense(upper);
+   out.Validate(fromDense(1, 0), 4.0);
+   out.Validate(fromDense(2, 2), 9.0);
+
+   Rmatrix sum = Rmatrix::Identity(3);
+   fromDense.AddTo(sum);
+   out.Validate(sum(1, 0), 4.0);
+   out.Validate(sum(2, 2), 10.0);
+
+   out.Put("======================================== Test not positive definite");
+   SymmetricMatrix indefinite(2);
+   indefinite(0, 0) = 1.0;
+   indefinite(0, 1) = 2.0;
+   indefinite(1, 1) = 1.0;
+   bool threw = false;
+   try
+   {
+      indefinite.Invert();
+   }
+   catch (BaseException &)
+   {
+      threw = true;
+   }
+   out.Validate(threw, true);
+
+   out.Put("======================================== Test sizes 6 to 300");
+   RunSize(6,   20000, out);
+   RunSize(40,  500,   out);
+   RunSize(300, 3,     out);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestSymmetricMatrix/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestSymmetricMatrixOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of SymmetricMatrix!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -0,0 +1,428 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestTdmReader
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+/**
+ * Test driver for TdmReadWriter and TdmStreamReader.
+ *
+ * The same three segments are written as an XML TDM and as a KVN TDM.  The
+ * XML file uses a namespace prefix on every element, and its text holds
+ * comments, CDATA sections and entity references.  Each file is read on one
+ * thread and on several, so the segments are also parsed ahead through
+ * ParseAhead(), and the ObservationData records returned are checked one by
+ * one against the expected sequence.  Malformed XML and KVN files are then
+ * checked to throw from both paths.
+ *
+ * Output file:
+ * TestTdmReaderOut.txt in test driver directory
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include "gmatdefs.hpp"
+#include "TdmReadWriter.hpp"
+#include "ObservationData.hpp"
+#include "MeasurementException.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "ConsoleMessageReceiver.hpp"
+
+using namespace std;
+
+namespace
+{
+   /// Three segments: range, Doppler and range again
+   const char *XML_TDM =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      "<!-- Scratch TDM for TestTdmReader -->\n"
+      "<ndm:tdm xmlns:ndm=\"urn:ccsds:recommendation:navigation:schema:ndmxml\"\n"
+      "         id=\"CCSDS_TDM_VERS\" version=\"1.0\">\n"
+      "  <ndm:header>\n"
+      "    <ndm:COMMENT>Header comment</ndm:COMMENT>\n"
+      "    <ndm:CREATION_DATE>2020-001T00:00:00</ndm:CREATION_DATE>\n"
+      "    <ndm:ORIGINATOR>GMAT</ndm:ORIGINATOR>\n"
+      "  </ndm:header>\n"
+      "  <ndm:body>\n"
+      "    <ndm:segment>\n"
+      "      <ndm:metadata>\n"
+      "        <ndm:COMMENT>Range &amp; range rate</ndm:COMMENT>\n"
+      "        <ndm:TIME_SYSTEM>UTC</ndm:TIME_SYSTEM>\n"
+      "        <ndm:PARTICIPANT_1>GDS&#45;24</ndm:PARTICIPANT_1>\n"
+      "        <ndm:PARTICIPANT_2><![CDATA[SAT<1>]]></ndm:PARTICIPANT_2>\n"
+      "        <ndm:MODE>SEQUENTIAL</ndm:MODE>\n"
+      "        <ndm:PATH>1,2,1</ndm:PATH>\n"
+      "        <ndm:TRANSMIT_BAND>X</ndm:TRANSMIT_BAND>\n"
+      "        <ndm:RECEIVE_BAND>X</ndm:RECEIVE_BAND>\n"
+      "        <ndm:TIMETAG_REF>RECEIVE</ndm:TIMETAG_REF>\n"
+      "        <ndm:INTEGRATION_INTERVAL>10.0</ndm:INTEGRATION_INTERVAL>\n"
+      "        <ndm:INTEGRATION_REF>END</ndm:INTEGRATION_REF>\n"
+      "        <ndm:RANGE_MODE>COHERENT</ndm:RANGE_MODE>\n"
+      "        <ndm:RANGE_MODULUS>2.0e+23</ndm:RANGE_MODULUS>\n"
+      "        <ndm:RANGE_UNITS>km</ndm:RANGE_UNITS>\n"
+      "      </ndm:metadata>\n"
+      "      <ndm:data>\n"
+      "        <ndm:COMMENT>First pass</ndm:COMMENT>\n"
+      "        <ndm:observation>\n"
+      "          <ndm:EPOCH>2020-01-01T00:00:00</ndm:EPOCH>\n"
+      "          <ndm:RANGE>7000.5</ndm:RANGE>\n"
+      "        </ndm:observation>\n"
+      "        <!-- <ndm:observation> in a comment is skipped -->\n"
+      "        <ndm:observation>\n"
+      "          <ndm:EPOCH>2020-01-01T00:00:00</ndm:EPOCH>\n"
+      "          <ndm:RANGE>7000.75</ndm:RANGE>\n"
+      "        </ndm:observation>\n"
+      "        <ndm:observation>\n"
+      "          <ndm:EPOCH>2020-001T00:01:00</ndm:EPOCH>\n"
+      "          <ndm:RANGE><![CDATA[7001.25]]></ndm:RANGE>\n"
+      "        </ndm:observation>\n"
+      "      </ndm:data>\n"
+      "    </ndm:segment>\n"
+      "    <ndm:segment>\n"
+      "      <ndm:metadata>\n"
+      "        <ndm:TIME_SYSTEM>UTC</ndm:TIME_SYSTEM>\n"
+      "        <ndm:PARTICIPANT_1>GDS-24</ndm:PARTICIPANT_1>\n"
+      "        <ndm:PARTICIPANT_2>SAT&lt;1&gt;</ndm:PARTICIPANT_2>\n"
+      "        <ndm:PARTICIPANT_3>GDS-34</ndm:PARTICIPANT_3>\n"
+      "        <ndm:PATH>1,2,3</ndm:PATH>\n"
+      "        <ndm:TRANSMIT_BAND>S</ndm:TRANSMIT_BAND>\n"
+      "        <ndm:INTEGRATION_INTERVAL>1.0</ndm:INTEGRATION_INTERVAL>\n"
+      "      </ndm:metadata>\n"
+      "      <ndm:data>\n"
+      "        <ndm:observation>\n"
+      "          <ndm:EPOCH>2020-01-01T00:02:00.5</ndm:EPOCH>\n"
+      "          <ndm:DOPPLER_INTEGRATED>-0.25</ndm:DOPPLER_INTEGRATED>\n"
+      "        </ndm:observation>\n"
+      "        <ndm:observation>\n"
+      "          <ndm:EPOCH>2020-01-01T00:03:00Z</ndm:EPOCH>\n"
+      "          <ndm:DOPPLER_INTEGRATED>&#48;.125</ndm:DOPPLER_INTEGRATED>\n"
+      "        </ndm:observation>\n"
+      "      </ndm:data>\n"
+      "    </ndm:segment>\n"
+      "    <ndm:segment>\n"
+      "      <ndm:metadata>\n"
+      "        <ndm:TIME_SYSTEM>UTC</ndm:TIME_SYSTEM>\n"
+      "        <ndm:PARTICIPANT_1>GDS-34</ndm:PARTICIPANT_1>\n"
+      "        <ndm:PARTICIPANT_2>SAT&lt;1&gt;</ndm:PARTICIPANT_2>\n"
+      "        <ndm:PATH>1,2,1</ndm:PATH>\n"
+      "        <ndm:RANGE_UNITS>RU</ndm:RANGE_UNITS>\n"
+      "      </ndm:metadata>\n"
+      "      <ndm:data>\n"
+      "        <ndm:observation>\n"
+      "          <ndm:EPOCH>2020-002T00:00:00</ndm:EPOCH>\n"
+      "          <ndm:RANGE>123456</ndm:RANGE>\n"
+      "        </ndm:observation>\n"
+      "      </ndm:data>\n"
+      "    </ndm:segment>\n"
+      "  </ndm:body>\n"
+      "</ndm:tdm>\n";
+
+   /// The segments of XML_TDM in KVN form
+   const char *KVN_TDM =
+      "CCSDS_TDM_VERS = 1.0\n"
+      "COMMENT Scratch TDM for TestTdmReader\n"
+      "CREATION_DATE = 2020-001T00:00:00\n"
+      "ORIGINATOR = GMAT\n"
+      "\n"
+      "META_START\n"
+      "COMMENT Range & range rate\n"
+      "TIME_SYSTEM = UTC\n"
+      "PARTICIPANT_1 = GDS-24\n"
+      "PARTICIPANT_2 = SAT<1>\n"
+      "MODE = SEQUENTIAL\n"
+      "PATH = 1,2,1\n"
+      "TRANSMIT_BAND = X\n"
+      "RECEIVE_BAND = X\n"
+      "TIMETAG_REF = RECEIVE\n"
+      "INTEGRATION_INTERVAL = 10.0\n"
+      "INTEGRATION_REF = END\n"
+      "RANGE_MODE = COHERENT\n"
+      "RANGE_MODULUS = 2.0e+23\n"
+      "RANGE_UNITS = km\n"
+      "META_STOP\n"
+      "DATA_START\n"
+      "COMMENT First pass\n"
+      "RANGE = 2020-01-01T00:00:00 7000.5\n"
+      "RANGE = 2020-01-01T00:00:00 7000.75\n"
+      "RANGE = 2020-001T00:01:00 7001.25\n"
+      "DATA_STOP\n"
+      "\r\n"
+      "META_START\r\n"
+      "TIME_SYSTEM = UTC\r\n"
+      "PARTICIPANT_1 = GDS-24\r\n"
+      "PARTICIPANT_2 = SAT<1>\r\n"
+      "PARTICIPANT_3 = GDS-34\r\n"
+      "PATH = 1,2,3\r\n"
+      "TRANSMIT_BAND = S\r\n"
+      "INTEGRATION_INTERVAL = 1.0\r\n"
+      "META_STOP\r\n"
+      "DATA_START\r\n"
+      "DOPPLER_INTEGRATED = 2020-01-01T00:02:00.5 -0.25\r\n"
+      "DOPPLER_INTEGRATED = 2020-01-01T00:03:00Z 0.125\r\n"
+      "DATA_STOP\r\n"
+      "META_START\n"
+      "TIME_SYSTEM = UTC\n"
+      "PARTICIPANT_1 = GDS-34\n"
+      "PARTICIPANT_2 = SAT<1>\n"
+      "PATH = 1,2,1\n"
+      "RANGE_UNITS = RU\n"
+      "META_STOP\n"
+      "DATA_START\n"
+      "RANGE = 2020-002T00:00:00 123456\n"
+      "DATA_STOP\n";
+
+   /// The records of both files, as Describe() writes them.  The metadata
+   /// not given in a segment is kept from the one before, as the template is
+   /// only cleared of its participants, strands and values.
+   const char *EXPECTED[] =
+   {
+      "RANGE 28849.50000000 [GDS-24 SAT<1>] [GDS-24>SAT<1>>GDS-24] "
+         "TRANSMIT_BAND=2 INTEGRATION_INTERVAL=10 RANGE_MODULUS=2e+23 "
+         "RANGE=7000.5 RANGE=7000.75 unit=km atEnd=1 atIntegrationEnd=1",
+      "RANGE 28849.50069444 [GDS-24 SAT<1>] [GDS-24>SAT<1>>GDS-24] "
+         "TRANSMIT_BAND=2 INTEGRATION_INTERVAL=10 RANGE_MODULUS=2e+23 "
+         "RANGE=7001.25 unit=km atEnd=1 atIntegrationEnd=1",
+      "DOPPLER_INTEGRATED 28849.50139468 [GDS-24 SAT<1> GDS-34] "
+         "[GDS-24>SAT<1>>GDS-34] TRANSMIT_BAND=1 INTEGRATION_INTERVAL=1 "
+         "DOPPLER_INTEGRATED=-0.25 unit=km atEnd=1 atIntegrationEnd=1",
+      "DOPPLER_INTEGRATED 28849.50208333 [GDS-24 SAT<1> GDS-34] "
+         "[GDS-24>SAT<1>>GDS-34] TRANSMIT_BAND=1 INTEGRATION_INTERVAL=1 "
+         "DOPPLER_INTEGRATED=0.125 unit=km atEnd=1 atIntegrationEnd=1",
+      "RANGE 28850.50000000 [GDS-34 SAT<1>] [GDS-34>SAT<1>>GDS-34] "
+         "RANGE=123456 unit=RU atEnd=1 atIntegrationEnd=1"
+   };
+   const Integer EXPECTED_COUNT = 5;
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteFile(const std::string &fileName, const std::string &contents)
+//------------------------------------------------------------------------------
+void WriteFile(const std::string &fileName, const std::string &contents)
+{
+   std::ofstream file(fileName.c_str(), std::ios::binary);
+   file << contents;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string Describe(const ObservationData &od)
+//------------------------------------------------------------------------------
+/**
+ * Writes the fields of a record filled by TdmReadWriter on one line.
+ */
+//------------------------------------------------------------------------------
+std::string Describe(const ObservationData &od)
+{
+   std::stringstream text;
+   text.precision(12);
+   char epoch[32];
+   sprintf(epoch, "%.8f", od.epoch);
+   text << od.typeName << " " << epoch << " [";
+   for (UnsignedInt i = 0; i < od.participantIDs.size(); ++i)
+      text << (i == 0 ? "" : " ") << od.participantIDs[i];
+   text << "] [";
+   for (UnsignedInt i = 0; i < od.strands.size(); ++i)
+      for (UnsignedInt j = 0; j < od.strands[i].size(); ++j)
+         text << (j == 0 ? (i == 0 ? "" : " ") : ">") << od.strands[i][j];
+   text << "]";
+   for (UnsignedInt i = 0; i < od.value.size(); ++i)
+      text << " " << od.dataMap.at(i) << "=" << od.value[i];
+   text << " unit=" << od.unit << " atEnd=" << od.epochAtEnd
+        << " atIntegrationEnd=" << od.epochAtIntegrationEnd;
+   return text.str();
+}
+
+
+//------------------------------------------------------------------------------
+// void ReadRecords(const std::string &fileName, Integer threads,
+//                  StringArray &records)
+//------------------------------------------------------------------------------
+/**
+ * Reads every record of a file the way TdmObType::ReadObservation() does.
+ *
+ * The record filled by the LoadRecord() call that returns NULL is kept here;
+ * TdmObType drops it, as it did with the DOM reader.
+ */
+//------------------------------------------------------------------------------
+void ReadRecords(const std::string &fileName, Integer threads,
+                 StringArray &records)
+{
+   records.clear();
+   TdmReadWriter reader;
+   reader.SetThreadCount(threads);
+   reader.Initialize();
+   reader.Validate(fileName);
+   reader.SetBody();
+
+   ObservationData *theTemplate = reader.ProcessMetadata();
+   while (theTemplate != NULL)
+   {
+      ObservationData newData(*theTemplate);
+      theTemplate = reader.LoadRecord(&newData);
+      records.push_back(Describe(newData));
+   }
+   reader.Finalize();
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckFile(TestOutput &out, const std::string &fileName)
+//------------------------------------------------------------------------------
+void CheckFile(TestOutput &out, const std::string &fileName)
+{
+   StringArray records;
+   const Integer threadCounts[] = {1, 3};
+   for (Integer t = 0; t < 2; ++t)
+   {
+      out.Put("---------- threads = ", threadCounts[t]);
+      ReadRecords(fileName, threadCounts[t], records);
+      out.Validate((Integer)records.size(), EXPECTED_COUNT);
+      for (UnsignedInt i = 0; (i < records.size()) &&
+           ((Integer)i < EXPECTED_COUNT); ++i)
+         out.Validate(records[i], EXPECTED[i]);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckMalformed(TestOutput &out, const std::string &fileName,
+//                     Integer serialRecords)
+//------------------------------------------------------------------------------
+/**
+ * Checks that a malformed file throws on both paths.
+ *
+ * Read in sequence, the records before the problem are returned first, except
+ * the one whose LoadRecord() call moves on to the bad segment; read ahead,
+ * the problem is found when the batch holding it is parsed.
+ */
+//------------------------------------------------------------------------------
+void CheckMalformed(TestOutput &out, const std::string &fileName,
+                    Integer serialRecords)
+{
+   const Integer threadCounts[] = {1, 3};
+   for (Integer t = 0; t < 2; ++t)
+   {
+      out.Put("---------- threads = ", threadCounts[t]);
+      StringArray records;
+      bool thrown = false;
+      try
+      {
+         TdmReadWriter reader;
+         reader.SetThreadCount(threadCounts[t]);
+         reader.Validate(fileName);
+         reader.SetBody();
+         ObservationData *theTemplate = reader.ProcessMetadata();
+         while (theTemplate != NULL)
+         {
+            ObservationData newData(*theTemplate);
+            theTemplate = reader.LoadRecord(&newData);
+            records.push_back(Describe(newData));
+         }
+      }
+      catch (MeasurementException &me)
+      {
+         out.Put(me.GetFullMessage());
+         thrown = (me.GetFullMessage().find("cannot be read") !=
+                   std::string::npos);
+      }
+      out.Validate(thrown, true);
+      out.Validate((Integer)records.size(),
+                   (threadCounts[t] == 1 ? serialRecords : 0));
+      for (UnsignedInt i = 0; i < records.size(); ++i)
+         out.Validate(records[i], EXPECTED[i]);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out, const std::string &outPath)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out, const std::string &outPath)
+{
+   std::string xml = XML_TDM, kvn = KVN_TDM;
+   std::string xmlFile = outPath + "TestTdmReader.xml";
+   std::string kvnFile = outPath + "TestTdmReader.tdm";
+   WriteFile(xmlFile, xml);
+   WriteFile(kvnFile, kvn);
+
+   out.Put("======================================== XML TDM");
+   CheckFile(out, xmlFile);
+
+   out.Put("======================================== KVN TDM");
+   CheckFile(out, kvnFile);
+
+   // The second segment of each ends before its data section does
+   out.Put("======================================== truncated XML TDM");
+   std::string badFile = outPath + "TestTdmReaderBad.xml";
+   WriteFile(badFile, xml.substr(0, xml.find("<ndm:DOPPLER_INTEGRATED>-0.25")));
+   CheckMalformed(out, badFile, 1);
+
+   out.Put("======================================== KVN TDM without DATA_START");
+   badFile = outPath + "TestTdmReaderBad.tdm";
+   std::string::size_type second = kvn.find("META_STOP\r\nDATA_START\r\n");
+   WriteFile(badFile, kvn.substr(0, second) + "META_STOP\r\n" +
+             kvn.substr(second + 23));
+   CheckMalformed(out, badFile, 1);
+
+   out.Put("======================================== root element is not tdm");
+   WriteFile(badFile, "<?xml version=\"1.0\"?>\n<ndm:odm id=\"CCSDS_TDM_VERS\" "
+             "version=\"1.0\"></ndm:odm>\n");
+   bool thrown = false;
+   try
+   {
+      TdmReadWriter reader;
+      reader.Validate(badFile);
+      reader.SetBody();
+   }
+   catch (MeasurementException &me)
+   {
+      out.Put(me.GetFullMessage());
+      thrown = true;
+   }
+   out.Validate(thrown, true);
+
+   remove(xmlFile.c_str());
+   remove(kvnFile.c_str());
+   remove(badFile.c_str());
+   remove((outPath + "TestTdmReaderBad.xml").c_str());
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+   std::string outPath = "../../TestTdmReader/";
+   MessageInterface::SetLogFile(outPath + "GmatLog.txt");
+   std::string outFile = outPath + "TestTdmReaderOut.txt";
+   TestOutput out(outFile);
+
+   try
+   {
+      RunTest(out, outPath);
+      out.Put("\nSuccessfully ran unit testing of TdmReadWriter!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+   cout << "Hit enter to end" << endl;
+   cin.get();
+}
@@ -13,7 +13,9 @@
 //------------------------------------------------------------------------------
 
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <cstdlib>
 #include "gmatdefs.hpp"
 #include "GmatGlobal.hpp"
 #include "StringUtil.hpp"
@@ -234,6 +236,198 @@ void WriteString(TestOutput &out, Real rval, int testCase)
 }
 
 
+//------------------------------------------------------------------------------
+// std::string StreamToString(Real rval, bool scientific, bool showPoint,
+//                            Integer precision, Integer width)
+//------------------------------------------------------------------------------
+/**
+ * Formats a Real value with a stringstream, the way ToString() used to.
+ */
+//------------------------------------------------------------------------------
+std::string StreamToString(Real rval, bool scientific, bool showPoint,
+                           Integer precision, Integer width)
+{
+   std::stringstream ss("");
+   ss.width(width);
+   ss.precision(precision);
+   ss.setf(std::ios::left);
+   if (showPoint)
+      ss.setf(std::ios::showpoint);
+   if (scientific)
+      ss.setf(std::ios::scientific);
+   ss << rval;
+   
+   std::string sval = ss.str();
+   if ((sval.find("e-0") != sval.npos) && (sval.size() - sval.find("e-0")) == 5)
+      sval = GmatStringUtil::Replace(sval, "e-0", "e-");
+   if ((sval.find("e+0") != sval.npos) && (sval.size() - sval.find("e+0")) == 5)
+      sval = GmatStringUtil::Replace(sval, "e+0", "e+");
+   if (sval.size() == width-1)
+      sval = " " + sval;
+   return sval;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string StreamToFixedString(Real rval, bool scientific, bool showPoint,
+//                                 Integer precision, Integer width)
+//------------------------------------------------------------------------------
+/**
+ * Formats a Real value with a stringstream, the way RealToString() used to.
+ */
+//------------------------------------------------------------------------------
+std::string StreamToFixedString(Real rval, bool scientific, bool showPoint,
+                                Integer precision, Integer width)
+{
+   std::stringstream ss("");
+   ss.width(width);
+   ss.precision(precision);
+   ss.setf(std::ios::left);
+   if (showPoint)
+      ss << std::showpoint;
+   else
+      ss << std::noshowpoint;
+   if (scientific)
+      ss << std::scientific;
+   else
+      ss << std::fixed;
+   ss << rval;
+   
+   std::string sval = GmatStringUtil::Trim(ss.str());
+   if ((sval.find("e-0") != sval.npos) && (sval.size() - sval.find("e-0")) == 5)
+      sval = GmatStringUtil::Replace(sval, "e-0", "e-");
+   else if ((sval.find("e+0") != sval.npos) && (sval.size() - sval.find("e+0")) == 5)
+      sval = GmatStringUtil::Replace(sval, "e+0", "e+");
+   
+   if (!showPoint)
+   {
+      std::string::size_type pos = sval.find('e');
+      std::string exp = ((pos == sval.npos) ? "" : sval.substr(pos));
+      sval = ((pos == sval.npos) ? sval : sval.substr(0, pos));
+      
+      if (sval.find_last_of(".") != sval.npos)
+      {
+         std::string::size_type i = sval.size() - 1;
+         for (; sval.at(i) == '0'; --i);
+         if (sval.at(i) == '.')
+            --i;
+         sval = sval.substr(0, i + 1);
+      }
+      sval = sval + exp;
+   }
+   return sval;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string StreamToString(Integer ival, Integer width)
+//------------------------------------------------------------------------------
+/**
+ * Formats an Integer value with a stringstream, the way ToString() used to.
+ */
+//------------------------------------------------------------------------------
+std::string StreamToString(Integer ival, Integer width)
+{
+   std::stringstream ss("");
+   ss.width(width);
+   ss << ival;
+   return ss.str();
+}
+
+
+//------------------------------------------------------------------------------
+// void CompareWithStream(TestOutput &out)
+//------------------------------------------------------------------------------
+/**
+ * Checks that ToString() and RealToString() match stream formatting.
+ *
+ * The timing of the formatting is in the GmatBenchmark suite.
+ */
+//------------------------------------------------------------------------------
+void CompareWithStream(TestOutput &out)
+{
+   out.Put("============================== compare ToString() with streams");
+   
+   const Integer precisions[] = {1, 6, 16, 25};
+   const Integer widths[] = {1, 20, 30};
+   Integer mismatches = 0;
+   Real rval = 1.0;
+   
+   for (Integer i = 0; i < 10000; ++i)
+   {
+      rval = -rval * 1.0731641 + 1.0e-3 * i;
+      for (Integer sci = 0; sci < 2; ++sci)
+         for (Integer point = 0; point < 2; ++point)
+            for (Integer p = 0; p < 4; ++p)
+               for (Integer w = 0; w < 3; ++w)
+               {
+                  std::string expect =
+                     StreamToString(rval, sci == 1, point == 1, precisions[p],
+                                    widths[w]);
+                  std::string actual =
+                     GmatStringUtil::ToString(rval, false, sci == 1,
+                                              point == 1, precisions[p],
+                                              widths[w]);
+                  if (actual != expect)
+                     ++mismatches;
+               }
+   }
+   out.Validate(mismatches, 0);
+   
+   out.Put("---------- RealToString() fixed and scientific");
+   mismatches = 0;
+   rval = 1.0;
+   for (Integer i = 0; i < 2000; ++i)
+   {
+      // The magnitude reaches 1e301, so wide fixed values are covered
+      rval = -rval * 1.4142136 + 1.0e-3 * i;
+      for (Integer sci = 0; sci < 2; ++sci)
+         for (Integer point = 0; point < 2; ++point)
+            for (Integer p = 0; p < 4; ++p)
+               for (Integer w = 0; w < 3; ++w)
+               {
+                  std::string expect =
+                     StreamToFixedString(rval, sci == 1, point == 1,
+                                         precisions[p], widths[w]);
+                  std::string actual =
+                     GmatStringUtil::RealToString(rval, false, sci == 1,
+                                                  point == 1, precisions[p],
+                                                  widths[w]);
+                  if (actual != expect)
+                     ++mismatches;
+               }
+   }
+   out.Validate(mismatches, 0);
+   out.Validate(GmatStringUtil::RealToString(0.5, false, false, false, 6, 1),
+                "0.5");
+   out.Validate(GmatStringUtil::RealToString(-2.0, false, false, true, 3, 1),
+                "-2.000");
+   
+   out.Put("---------- Integer ToString() padding");
+   const Integer ivals[] = {0, 7, -7, 1234, -98765, 2147483647, -2147483647-1};
+   const Integer iwidths[] = {-3, 0, 1, 4, 5, 11, 12, 20};
+   mismatches = 0;
+   for (Integer i = 0; i < 7; ++i)
+      for (Integer w = 0; w < 8; ++w)
+      {
+         if (GmatStringUtil::ToString(ivals[i], false, iwidths[w]) !=
+             StreamToString(ivals[i], iwidths[w]))
+            ++mismatches;
+         if (GmatStringUtil::ToString(ivals[i], iwidths[w]) !=
+             StreamToString(ivals[i], iwidths[w]))
+            ++mismatches;
+      }
+   out.Validate(mismatches, 0);
+   out.Validate(GmatStringUtil::ToString(-12, false, 6), "   -12");
+   
+   out.Put("---------- shortest round trip");
+   out.Validate(GmatStringUtil::ToShortestString(0.1), "0.1");
+   out.Validate(GmatStringUtil::ToShortestString(1.0/3.0), "0.3333333333333333");
+   std::string str = GmatStringUtil::ToShortestString(123456789.123456789012);
+   out.Validate(atof(str.c_str()) == 123456789.123456789012, true);
+}
+
+
 //------------------------------------------------------------------------------
 //int RunTest(TestOutput &out)
 //------------------------------------------------------------------------------
@@ -277,6 +471,8 @@ int RunTest(TestOutput &out)
    Rvector3 r1(rval1, rval2, rval3);
    global->SetPrefix("   ");
    out.Put("rval3 =\n", r1.ToString());
+   
+   CompareWithStream(out);
 }
 
 
@@ -34,9 +34,13 @@
 #include "APIException.hpp"
 #include "FileManager.hpp"
 #include "MessageInterface.hpp"
+#include "MemoryTracker.hpp"
 #include "APIMessageReceiver.hpp"
 #include "Validator.hpp"
 #include "FileUtil.hpp"
+#include "StringUtil.hpp"
+#include "RealUtilities.hpp"
+#include "GmatConstants.hpp"
 
 //------------------------------------------------------------------------------
 // std::string Help(std::string forItem)
@@ -658,11 +662,16 @@ std::string  GetRunSummary()
       if (current->GetTypeName() != "NoOp")
       {
          theMsg += current->GetStringParameter("Summary");
+         if (MemoryTracker::IsCounting())
+            theMsg += MemoryTracker::Instance()->GetCommandSummary(current);
          theMsg += "\n-----------------------------------\n";
       }
       current = current->GetNext();
    }
 
+   if (MemoryTracker::IsCounting())
+      theMsg += MemoryTracker::Instance()->GetTelemetrySummary();
+
    return theMsg;
 
 }
@@ -943,6 +952,269 @@ void        EchoLogFile(bool echo)
 }
 
 
+//------------------------------------------------------------------------------
+// Rvector GetRealFields(GmatBase *theObject, const StringArray &fields)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves several real fields of an object in one call
+ *
+ * @param theObject The object
+ * @param fields    The names of the fields
+ *
+ * @return The field values, in the order of the names
+ */
+//------------------------------------------------------------------------------
+Rvector GetRealFields(GmatBase *theObject, const StringArray &fields)
+{
+   if (theObject == nullptr)
+      throw APIException("GetRealFields() requires an object");
+   if (fields.empty())
+      throw APIException("GetRealFields() requires at least one field name");
+
+   Rvector values((Integer)fields.size());
+   for (UnsignedInt i = 0; i < fields.size(); ++i)
+      values[i] = theObject->GetRealParameter(
+            theObject->GetParameterID(fields[i]));
+
+   return values;
+}
+
+
+//------------------------------------------------------------------------------
+// Rmatrix PropagateSteps(PropSetup *thePropagator, Integer steps,
+//       Real stepSize)
+//------------------------------------------------------------------------------
+/**
+ * Takes a series of propagation steps and collects the states along the way
+ *
+ * The propagator must have been prepared (PrepareInternals()) before the
+ * call.  The space objects are updated to the final state.
+ *
+ * @param thePropagator The propagator
+ * @param steps         The number of steps to take
+ * @param stepSize      The size of each step, in seconds
+ *
+ * @return A matrix with a row for the initial state and for each step,
+ *         holding the elapsed time in seconds followed by the state vector
+ */
+//------------------------------------------------------------------------------
+Rmatrix PropagateSteps(PropSetup *thePropagator, Integer steps, Real stepSize)
+{
+   if (thePropagator == nullptr)
+      throw APIException("PropagateSteps() requires a propagator");
+
+   Propagator *gator = thePropagator->GetPropagator();
+   if (gator == nullptr)
+      throw APIException("The propagator " + thePropagator->GetName() +
+            " has no integrator set");
+   if (steps < 0)
+      throw APIException("PropagateSteps() requires a non-negative number "
+            "of steps");
+
+   Integer dim = gator->GetDimension();
+   Real *state = gator->GetState();
+   if ((dim <= 0) || (state == nullptr))
+      throw APIException("The propagator " + thePropagator->GetName() +
+            " has no state to propagate; call PrepareInternals() first");
+
+   Rmatrix results(steps + 1, dim + 1);
+   results(0, 0) = gator->GetTime();
+   for (Integer j = 0; j < dim; ++j)
+      results(0, j + 1) = state[j];
+
+   for (Integer i = 1; i <= steps; ++i)
+   {
+      if (!gator->Step(stepSize))
+         throw APIException("The propagator " + thePropagator->GetName() +
+               " failed to take step " + std::to_string(i));
+
+      state = gator->GetState();
+      results(i, 0) = gator->GetTime();
+      for (Integer j = 0; j < dim; ++j)
+         results(i, j + 1) = state[j];
+   }
+
+   gator->UpdateSpaceObject();
+
+   return results;
+}
+
+
+//------------------------------------------------------------------------------
+// Rmatrix GetDerivativesBatch(ODEModel *theODEModel, const Rmatrix &states,
+//       Real dt, Integer order)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the derivatives of an ODE model for several states in one call
+ *
+ * @param theODEModel The ODE model, already set up for propagation
+ * @param states      The states, one per row, each the size of the model
+ *                    state
+ * @param dt          The time offset from the model epoch, in seconds
+ * @param order       The order of the derivatives
+ *
+ * @return The derivatives, one row per state
+ */
+//------------------------------------------------------------------------------
+Rmatrix GetDerivativesBatch(ODEModel *theODEModel, const Rmatrix &states,
+      Real dt, Integer order)
+{
+   if (theODEModel == nullptr)
+      throw APIException("GetDerivativesBatch() requires an ODE model");
+
+   Integer dim = theODEModel->GetDimension();
+   Integer rows, cols;
+   states.GetSize(rows, cols);
+   if ((rows <= 0) || (cols != dim))
+      throw APIException("GetDerivativesBatch() requires states with " +
+            std::to_string(dim) + " columns for the ODE model " +
+            theODEModel->GetName());
+
+   Rmatrix derivatives(rows, dim);
+   RealArray state(dim);
+   for (Integer i = 0; i < rows; ++i)
+   {
+      for (Integer j = 0; j < dim; ++j)
+         state[j] = states(i, j);
+
+      if (!theODEModel->GetDerivatives(&state[0], dt, order))
+         throw APIException("The ODE model " + theODEModel->GetName() +
+               " failed to evaluate the derivatives of state " +
+               std::to_string(i));
+
+      const Real *deriv = theODEModel->GetDerivativeArray();
+      for (Integer j = 0; j < dim; ++j)
+         derivatives(i, j) = deriv[j];
+   }
+
+   return derivatives;
+}
+
+
+//------------------------------------------------------------------------------
+// Rmatrix PropagateToEpochs(PropSetup *thePropagator, const RealArray &epochs)
+//------------------------------------------------------------------------------
+/**
+ * Propagates through a set of epochs, collecting the state at each one
+ *
+ * The stepping loop runs here rather than through per step calls from the
+ * caller.  Integrators that provide dense output take their own steps and
+ * interpolate the requested epochs inside each step; the others have each
+ * step cut short at the next requested epoch.  The last step always ends on
+ * the last epoch, where the space objects are updated.
+ *
+ * The propagator must have been prepared (PrepareInternals()) before the
+ * call.  The returned states are the full propagation vectors, so they carry
+ * the STM when it is propagated.
+ *
+ * @param thePropagator The propagator
+ * @param epochs        The A.1 modified Julian epochs, ordered in the
+ *                      direction of propagation from the current epoch
+ *
+ * @return A matrix with a row per epoch, holding the epoch followed by the
+ *         state vector
+ */
+//------------------------------------------------------------------------------
+Rmatrix PropagateToEpochs(PropSetup *thePropagator, const RealArray &epochs)
+{
+   if (thePropagator == nullptr)
+      throw APIException("PropagateToEpochs() requires a propagator");
+   if (epochs.empty())
+      throw APIException("PropagateToEpochs() requires at least one epoch");
+
+   Propagator *gator = thePropagator->GetPropagator();
+   ODEModel *ode = thePropagator->GetODEModel();
+   if ((gator == nullptr) || (ode == nullptr))
+      throw APIException("PropagateToEpochs() requires the propagator " +
+            thePropagator->GetName() + " to have an integrator and an ODE "
+            "model");
+
+   Integer dim = gator->GetDimension();
+   if ((dim <= 0) || (gator->GetState() == nullptr))
+      throw APIException("The propagator " + thePropagator->GetName() +
+            " has no state to propagate; call PrepareInternals() first");
+
+   // Requested epochs as elapsed seconds on the ODE model clock
+   Real baseEpoch = ode->GetRealParameter(ode->GetParameterID("Epoch"));
+   Real elapsed = gator->GetTime();
+   Integer count = (Integer)epochs.size();
+   RealArray targets(count);
+   for (Integer k = 0; k < count; ++k)
+      targets[k] = (epochs[k] - baseEpoch) * GmatTimeConstants::SECS_PER_DAY;
+
+   const Real timeTolerance = 1.0e-9;
+   Real direction = (targets[count-1] < elapsed) ? -1.0 : 1.0;
+   Real previous = elapsed;
+   for (Integer k = 0; k < count; ++k)
+   {
+      if ((targets[k] - previous) * direction < -timeTolerance)
+         throw APIException("PropagateToEpochs() requires epochs ordered in "
+               "the direction of propagation from the current epoch");
+      previous = targets[k];
+   }
+
+   Rmatrix results(count, dim + 1);
+   RealArray interpolated(dim);
+   Integer next = 0;
+   bool dense = false, denseChecked = false;
+
+   while (next < count)
+   {
+      // Epochs at the current time take the current state
+      Real *state = gator->GetState();
+      while ((next < count) &&
+             (GmatMathUtil::Abs(targets[next] - elapsed) <= timeTolerance))
+      {
+         results(next, 0) = epochs[next];
+         for (Integer j = 0; j < dim; ++j)
+            results(next, j + 1) = state[j];
+         ++next;
+      }
+      if (next == count)
+         break;
+
+      Real stepEnd = (dense ? targets[count-1] : targets[next]);
+      Real step = direction * GmatMathUtil::Abs(gator->GetStepSize());
+      if ((step == 0.0) || ((elapsed + step - stepEnd) * direction > 0.0))
+         step = stepEnd - elapsed;
+
+      Real stepStart = elapsed;
+      if (!gator->Step(step))
+         throw APIException("The propagator " + thePropagator->GetName() +
+               " failed to step toward epoch " +
+               GmatStringUtil::ToString(epochs[next], 16));
+      elapsed = gator->GetTime();
+
+      // Interpolate the epochs passed in the step
+      while ((next < count) &&
+             ((elapsed - targets[next]) * direction > timeTolerance))
+      {
+         if (!gator->GetDenseState(targets[next] - stepStart,
+               &interpolated[0]))
+            throw APIException("The propagator " + thePropagator->GetName() +
+                  " stepped past epoch " +
+                  GmatStringUtil::ToString(epochs[next], 16) +
+                  " without dense output");
+         results(next, 0) = epochs[next];
+         for (Integer j = 0; j < dim; ++j)
+            results(next, j + 1) = interpolated[j];
+         ++next;
+      }
+
+      // Once a step is taken, find out if the integrator interpolates
+      if (!denseChecked)
+      {
+         dense = gator->GetDenseState(elapsed - stepStart, &interpolated[0]);
+         denseChecked = true;
+      }
+   }
+
+   gator->UpdateSpaceObject();
+
+   return results;
+}
+
+
 //------------------------------------------------------------------------------
 // ******                                                                 ******
 // ******   Functions used by the API but not intended for external use   ******
@@ -39,6 +39,8 @@
 #include "Moderator.hpp"
 #include "TimeSystemConverter.hpp"
 #include "GmatBase.hpp"
+#include "Rvector.hpp"
+#include "Rmatrix.hpp"
 
 // API specific functions
 GMAT_API std::string    Help(std::string forItem = "");
@@ -77,6 +79,16 @@ GMAT_API std::string    Clear(std::string forObject = "");
 GMAT_API void           UseLogFile(std::string logFile = "GmatAPILog.txt");
 GMAT_API void           EchoLogFile(bool echo = true);
 
+// Batch functions that move blocks of data across the API in one call
+GMAT_API Rvector        GetRealFields(GmatBase *theObject,
+      const StringArray &fields);
+GMAT_API Rmatrix        PropagateSteps(PropSetup *thePropagator, Integer steps,
+      Real stepSize);
+GMAT_API Rmatrix        GetDerivativesBatch(ODEModel *theODEModel,
+      const Rmatrix &states, Real dt = 0.0, Integer order = 1);
+GMAT_API Rmatrix        PropagateToEpochs(PropSetup *thePropagator,
+      const RealArray &epochs);
+
 
 // Internal functions - not (yet) exported on Windows, so no GMAT_API macro
 void ProcessParameters(GmatBase *theObject, const std::string &extraData1,
@@ -559,11 +559,12 @@ Integer BodyFixedPoint::GetParameterID(const std::string &str) const
    if (str == locationLabels[2])
       return LOCATION_3;
 
-   for (Integer i = SpacePointParamCount; i < BodyFixedPointParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpacePointParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SpacePointParamCount,
+               BodyFixedPointParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return SpacePoint::GetParameterID(str);
 }
@@ -1676,6 +1677,10 @@ void BodyFixedPoint::UpdateBodyFixedLocation()
 
 bool BodyFixedPoint::WriteSPK(bool deleteFile)
 {
+   #ifdef __USE_SPICE__
+      SpiceInterface::AccessLock spiceLock;
+   #endif
+
    deleteSPK = deleteFile; // false is temporary - for testing only!!
 
    // Get the time (seconds since January 1, 1970), to make the temporary file name unique
@@ -1856,6 +1861,10 @@ bool BodyFixedPoint::WriteFK(bool deleteFile)
 Rvector3 BodyFixedPoint::GetTopocentricConversion(
                          const std::string &centralNaifId)
 {
+   #ifdef __USE_SPICE__
+      SpiceInterface::AccessLock spiceLock;
+   #endif
+
    // x_F, y_F, z_F : position w.r.t. the body-fixed frame (e.g. ECEF)
    // R : equatorial radius of the referenced body
    // f : flattening of the referenced body
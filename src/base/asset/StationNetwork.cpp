@@ -0,0 +1,572 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              StationNetwork
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the StationNetwork class.
+ */
+//------------------------------------------------------------------------------
+
+#include "StationNetwork.hpp"
+#include "BodyFixedPoint.hpp"
+#include "CelestialBody.hpp"
+#include "CoordinateSystem.hpp"
+#include "AssetException.hpp"
+#include "RealUtilities.hpp"
+#include "GmatConstants.hpp"
+#include "GmatDefaults.hpp"
+#include "MessageInterface.hpp"
+#include <algorithm>
+#include <utility>
+
+//#define DEBUG_STATION_NETWORK
+
+
+//------------------------------------------------------------------------------
+// StationNetwork()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor; the body shape defaults to the Earth's.
+ */
+//------------------------------------------------------------------------------
+StationNetwork::StationNetwork() :
+   bfcs           (NULL),
+   radius         (GmatSolarSystemDefaults::PLANET_EQUATORIAL_RADIUS[GmatSolarSystemDefaults::EARTH]),
+   flattening     (GmatSolarSystemDefaults::PLANET_FLATTENING[GmatSolarSystemDefaults::EARTH]),
+   targetCount    (0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// StationNetwork(const StationNetwork &net)
+//------------------------------------------------------------------------------
+StationNetwork::StationNetwork(const StationNetwork &net) :
+   names          (net.names),
+   bfcs           (net.bfcs),
+   radius         (net.radius),
+   flattening     (net.flattening),
+   locX           (net.locX),
+   locY           (net.locY),
+   locZ           (net.locZ),
+   southX         (net.southX),
+   southY         (net.southY),
+   southZ         (net.southZ),
+   eastX          (net.eastX),
+   eastY          (net.eastY),
+   eastZ          (net.eastZ),
+   zenithX        (net.zenithX),
+   zenithY        (net.zenithY),
+   zenithZ        (net.zenithZ),
+   minElevation   (net.minElevation),
+   maskAzimuths   (net.maskAzimuths),
+   maskElevations (net.maskElevations),
+   targetCount    (0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// StationNetwork& operator=(const StationNetwork &net)
+//------------------------------------------------------------------------------
+StationNetwork& StationNetwork::operator=(const StationNetwork &net)
+{
+   if (this != &net)
+   {
+      names          = net.names;
+      bfcs           = net.bfcs;
+      radius         = net.radius;
+      flattening     = net.flattening;
+      locX           = net.locX;
+      locY           = net.locY;
+      locZ           = net.locZ;
+      southX         = net.southX;
+      southY         = net.southY;
+      southZ         = net.southZ;
+      eastX          = net.eastX;
+      eastY          = net.eastY;
+      eastZ          = net.eastZ;
+      zenithX        = net.zenithX;
+      zenithY        = net.zenithY;
+      zenithZ        = net.zenithZ;
+      minElevation   = net.minElevation;
+      maskAzimuths   = net.maskAzimuths;
+      maskElevations = net.maskElevations;
+      targetCount    = 0;
+      ranges.clear();
+      azimuths.clear();
+      elevations.clear();
+      visible.clear();
+   }
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// ~StationNetwork()
+//------------------------------------------------------------------------------
+StationNetwork::~StationNetwork()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void SetBodyShape(Real eqRadius, Real flat)
+//------------------------------------------------------------------------------
+/**
+ * Sets the shape of the central body used to find each station's zenith.
+ *
+ * Stations added after the call use the new shape.
+ *
+ * @param eqRadius Equatorial radius of the body, in km
+ * @param flat     Flattening of the body
+ */
+//------------------------------------------------------------------------------
+void StationNetwork::SetBodyShape(Real eqRadius, Real flat)
+{
+   radius     = eqRadius;
+   flattening = flat;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer AddStation(BodyFixedPoint *station)
+//------------------------------------------------------------------------------
+/**
+ * Adds a station using its body-fixed location and central body.
+ *
+ * The body shape and body-fixed coordinate system are taken from the first
+ * station added; later stations must share its body-fixed system.  Ground
+ * stations contribute their MinimumElevationAngle.
+ *
+ * @param station The initialized station
+ *
+ * @return The index of the station in the network
+ */
+//------------------------------------------------------------------------------
+Integer StationNetwork::AddStation(BodyFixedPoint *station)
+{
+   if (station == NULL)
+      throw AssetException("A NULL station cannot be added to a station "
+            "network");
+
+   CoordinateSystem *stationCS = station->GetBodyFixedCoordinateSystem();
+   if (names.empty())
+   {
+      bfcs = stationCS;
+      SpacePoint *body = station->GetCentralBody();
+      if ((body != NULL) && body->IsOfType("CelestialBody"))
+         SetBodyShape(((CelestialBody*)body)->GetEquatorialRadius(),
+                      ((CelestialBody*)body)->GetFlattening());
+   }
+   else if (stationCS != bfcs)
+      throw AssetException("The station " + station->GetName() + " is not "
+            "on the body-fixed coordinate system shared by the stations in its "
+            "network");
+
+   Real minEl = 0.0;
+   if (station->IsOfType(Gmat::GROUND_STATION))
+      minEl = station->GetRealParameter("MinimumElevationAngle");
+
+   return AddStation(station->GetName(),
+         station->GetBodyFixedLocation(A1Mjd(0.0)), minEl);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer AddStation(const std::string &name, const Rvector3 &bfLoc,
+//                    Real minEl)
+//------------------------------------------------------------------------------
+/**
+ * Adds a station at a body-fixed location.
+ *
+ * The SEZ axes are built as TopocentricAxes builds them, with the zenith
+ * along the geodetic normal of the body shape.
+ *
+ * @param name         Name of the station
+ * @param bfLoc        Body-fixed location of the station, in km
+ * @param minEl        Minimum elevation for visibility, in degrees
+ *
+ * @return The index of the station in the network
+ */
+//------------------------------------------------------------------------------
+Integer StationNetwork::AddStation(const std::string &name,
+      const Rvector3 &bfLoc, Real minEl)
+{
+   Real x = bfLoc[0], y = bfLoc[1], z = bfLoc[2];
+   Real rxy = GmatMathUtil::Sqrt(x*x + y*y);
+   if (rxy < 1.0e-3)
+      throw AssetException("The topocentric frame of station " + name +
+            " is undefined due to numerical singularity at the poles");
+
+   // Iterate for the geodetic latitude from the geocentric latitude
+   Real eSquared = 2.0 * flattening - flattening * flattening;
+   Real phigd    = GmatMathUtil::ATan(z, rxy);
+   Real delta    = 1.0;
+   while (delta > 1.0e-11)
+   {
+      Real phiPrime = phigd;
+      Real sinPhi   = GmatMathUtil::Sin(phiPrime);
+      Real C        = radius / GmatMathUtil::Sqrt(1.0 - eSquared * sinPhi * sinPhi);
+      phigd         = GmatMathUtil::ATan((z + C * eSquared * sinPhi) / rxy);
+      delta         = GmatMathUtil::Abs(phigd - phiPrime);
+   }
+   Real lon = GmatMathUtil::ATan(y, x);
+
+   Real cosLat = GmatMathUtil::Cos(phigd), sinLat = GmatMathUtil::Sin(phigd);
+   Real cosLon = GmatMathUtil::Cos(lon),   sinLon = GmatMathUtil::Sin(lon);
+
+   names.push_back(name);
+   locX.push_back(x);
+   locY.push_back(y);
+   locZ.push_back(z);
+   zenithX.push_back(cosLat * cosLon);
+   zenithY.push_back(cosLat * sinLon);
+   zenithZ.push_back(sinLat);
+   // East is k x zenith, normalized; south is east x zenith
+   eastX.push_back(-sinLon);
+   eastY.push_back(cosLon);
+   eastZ.push_back(0.0);
+   southX.push_back(sinLat * cosLon);
+   southY.push_back(sinLat * sinLon);
+   southZ.push_back(-cosLat);
+   minElevation.push_back(minEl);
+   maskAzimuths.push_back(RealArray());
+   maskElevations.push_back(RealArray());
+
+   #ifdef DEBUG_STATION_NETWORK
+      MessageInterface::ShowMessage("StationNetwork: added %s at lat %.8lf, "
+            "lon %.8lf deg\n", name.c_str(),
+            phigd * GmatMathConstants::DEG_PER_RAD,
+            lon * GmatMathConstants::DEG_PER_RAD);
+   #endif
+
+   targetCount = 0;
+   return (Integer)names.size() - 1;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetHorizonMask(Integer station, const RealArray &azimuths,
+//                     const RealArray &elevations)
+//------------------------------------------------------------------------------
+/**
+ * Sets a station's horizon mask.
+ *
+ * The mask elevation is linearly interpolated in azimuth, wrapping through
+ * north.  Empty arrays remove the mask.
+ *
+ * @param station    Index of the station
+ * @param azimuths   Azimuths of the mask points, in degrees
+ * @param elevations Mask elevations at those azimuths, in degrees
+ */
+//------------------------------------------------------------------------------
+void StationNetwork::SetHorizonMask(Integer station, const RealArray &azimuths,
+      const RealArray &elevations)
+{
+   if ((station < 0) || (station >= (Integer)names.size()))
+      throw AssetException("Horizon mask set for an unknown station in a "
+            "station network");
+   if (azimuths.size() != elevations.size())
+      throw AssetException("The horizon mask of station " + names[station] +
+            " has different numbers of azimuths and elevations");
+
+   std::vector<std::pair<Real,Real> > points;
+   for (UnsignedInt i = 0; i < azimuths.size(); ++i)
+   {
+      Real az = GmatMathUtil::Mod(azimuths[i], 360.0);
+      if (az < 0.0)
+         az += 360.0;
+      points.push_back(std::make_pair(az, elevations[i]));
+   }
+   std::sort(points.begin(), points.end());
+
+   maskAzimuths[station].clear();
+   maskElevations[station].clear();
+   for (UnsignedInt i = 0; i < points.size(); ++i)
+   {
+      maskAzimuths[station].push_back(points[i].first);
+      maskElevations[station].push_back(points[i].second);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all stations and results.
+ */
+//------------------------------------------------------------------------------
+void StationNetwork::Clear()
+{
+   names.clear();
+   bfcs = NULL;
+   locX.clear();
+   locY.clear();
+   locZ.clear();
+   southX.clear();
+   southY.clear();
+   southZ.clear();
+   eastX.clear();
+   eastY.clear();
+   eastZ.clear();
+   zenithX.clear();
+   zenithY.clear();
+   zenithZ.clear();
+   minElevation.clear();
+   maskAzimuths.clear();
+   maskElevations.clear();
+   targetCount = 0;
+   ranges.clear();
+   azimuths.clear();
+   elevations.clear();
+   visible.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetStationCount() const
+//------------------------------------------------------------------------------
+Integer StationNetwork::GetStationCount() const
+{
+   return (Integer)names.size();
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetStationName(Integer station) const
+//------------------------------------------------------------------------------
+const std::string& StationNetwork::GetStationName(Integer station) const
+{
+   return names.at(station);
+}
+
+
+//------------------------------------------------------------------------------
+// void Evaluate(const A1Mjd &atEpoch, const std::vector<Rvector3> &targets)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates every station against the targets at an epoch.
+ *
+ * The body-fixed to inertial rotation is taken once from the body-fixed
+ * coordinate system of the stations.
+ *
+ * @param atEpoch The epoch of the target positions
+ * @param targets Target positions relative to the central body, in the
+ *                MJ2000Eq axes, in km
+ */
+//------------------------------------------------------------------------------
+void StationNetwork::Evaluate(const A1Mjd &atEpoch,
+      const std::vector<Rvector3> &targets)
+{
+   if (bfcs == NULL)
+      throw AssetException("A station network needs the body-fixed coordinate "
+            "system of its stations to be evaluated at an epoch");
+
+   Rvector bogusIn(6, 7000.0, 1000.0, 6000.0, 0.0, 0.0, 0.0);
+   bfcs->ToBaseSystem(atEpoch, bogusIn);
+   Evaluate(bfcs->GetLastRotationMatrix(), targets);
+}
+
+
+//------------------------------------------------------------------------------
+// void Evaluate(const Rmatrix33 &bfToInertial,
+//               const std::vector<Rvector3> &targets)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates every station against the targets for a body orientation.
+ *
+ * @param bfToInertial The body-fixed to inertial rotation
+ * @param targets      Target positions relative to the central body, in the
+ *                     inertial axes, in km
+ */
+//------------------------------------------------------------------------------
+void StationNetwork::Evaluate(const Rmatrix33 &bfToInertial,
+      const std::vector<Rvector3> &targets)
+{
+   Integer stationCount = (Integer)names.size();
+   targetCount = (Integer)targets.size();
+   UnsignedInt resultCount = stationCount * targetCount;
+   ranges.resize(resultCount);
+   azimuths.resize(resultCount);
+   elevations.resize(resultCount);
+   visible.resize(resultCount);
+
+   for (Integer t = 0; t < targetCount; ++t)
+   {
+      // Rotate the target into the body-fixed frame once for all stations
+      const Rvector3 &target = targets[t];
+      Real bx = bfToInertial(0,0) * target[0] + bfToInertial(1,0) * target[1] +
+                bfToInertial(2,0) * target[2];
+      Real by = bfToInertial(0,1) * target[0] + bfToInertial(1,1) * target[1] +
+                bfToInertial(2,1) * target[2];
+      Real bz = bfToInertial(0,2) * target[0] + bfToInertial(1,2) * target[1] +
+                bfToInertial(2,2) * target[2];
+
+      Real *range = &ranges[t * stationCount];
+      Real *az    = &azimuths[t * stationCount];
+      Real *el    = &elevations[t * stationCount];
+      for (Integer s = 0; s < stationCount; ++s)
+      {
+         Real rx = bx - locX[s];
+         Real ry = by - locY[s];
+         Real rz = bz - locZ[s];
+         Real south  = southX[s]  * rx + southY[s]  * ry + southZ[s]  * rz;
+         Real east   = eastX[s]   * rx + eastY[s]   * ry + eastZ[s]   * rz;
+         Real zenith = zenithX[s] * rx + zenithY[s] * ry + zenithZ[s] * rz;
+         range[s] = GmatMathUtil::Sqrt(rx*rx + ry*ry + rz*rz);
+         el[s]    = GmatMathUtil::ASin(zenith / range[s]) *
+                    GmatMathConstants::DEG_PER_RAD;
+         az[s]    = GmatMathUtil::ATan(east, -south) *
+                    GmatMathConstants::DEG_PER_RAD;
+         if (az[s] < 0.0)
+            az[s] += 360.0;
+      }
+
+      for (Integer s = 0; s < stationCount; ++s)
+      {
+         Integer i = t * stationCount + s;
+         bool isVisible = (elevations[i] > minElevation[s]);
+         if (isVisible && !maskAzimuths[s].empty())
+            isVisible = (elevations[i] > GetMaskElevation(s, azimuths[i]));
+         visible[i] = isVisible;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetTargetCount() const
+//------------------------------------------------------------------------------
+Integer StationNetwork::GetTargetCount() const
+{
+   return targetCount;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetRange(Integer station, Integer target) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the range, in km, from a station to a target in the last
+ * evaluation.
+ */
+//------------------------------------------------------------------------------
+Real StationNetwork::GetRange(Integer station, Integer target) const
+{
+   return ranges[GetResultIndex(station, target)];
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetAzimuth(Integer station, Integer target) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the azimuth, in degrees, of a target from a station in the last
+ * evaluation.
+ */
+//------------------------------------------------------------------------------
+Real StationNetwork::GetAzimuth(Integer station, Integer target) const
+{
+   return azimuths[GetResultIndex(station, target)];
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetElevation(Integer station, Integer target) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the elevation, in degrees, of a target from a station in the last
+ * evaluation.
+ */
+//------------------------------------------------------------------------------
+Real StationNetwork::GetElevation(Integer station, Integer target) const
+{
+   return elevations[GetResultIndex(station, target)];
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsVisible(Integer station, Integer target) const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if a target cleared a station's minimum elevation and horizon
+ * mask in the last evaluation.
+ */
+//------------------------------------------------------------------------------
+bool StationNetwork::IsVisible(Integer station, Integer target) const
+{
+   return visible[GetResultIndex(station, target)];
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetMaskElevation(Integer station, Real azimuth) const
+//------------------------------------------------------------------------------
+/**
+ * Interpolates a station's horizon mask at an azimuth in [0, 360) degrees.
+ */
+//------------------------------------------------------------------------------
+Real StationNetwork::GetMaskElevation(Integer station, Real azimuth) const
+{
+   const RealArray &az = maskAzimuths[station];
+   const RealArray &el = maskElevations[station];
+   UnsignedInt count = az.size();
+   if (count == 1)
+      return el[0];
+
+   // Find the mask points on either side, wrapping through north
+   UnsignedInt upper = std::upper_bound(az.begin(), az.end(), azimuth) -
+                       az.begin();
+   Real az0, az1, el0, el1;
+   if ((upper == 0) || (upper == count))
+   {
+      az0 = az[count - 1];
+      el0 = el[count - 1];
+      az1 = az[0] + 360.0;
+      el1 = el[0];
+      if (upper == 0)
+         azimuth += 360.0;
+   }
+   else
+   {
+      az0 = az[upper - 1];
+      el0 = el[upper - 1];
+      az1 = az[upper];
+      el1 = el[upper];
+   }
+
+   if (az1 - az0 <= 0.0)
+      return (el0 > el1 ? el0 : el1);
+   return el0 + (el1 - el0) * (azimuth - az0) / (az1 - az0);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetResultIndex(Integer station, Integer target) const
+//------------------------------------------------------------------------------
+Integer StationNetwork::GetResultIndex(Integer station, Integer target) const
+{
+   if ((station < 0) || (station >= (Integer)names.size()) ||
+       (target < 0) || (target >= targetCount))
+      throw AssetException("A station network result was requested for an "
+            "unknown station or target");
+   return target * (Integer)names.size() + station;
+}
@@ -0,0 +1,128 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              StationNetwork
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Batched topocentric range, azimuth and elevation for a set of stations.
+ */
+//------------------------------------------------------------------------------
+#ifndef StationNetwork_hpp
+#define StationNetwork_hpp
+
+#include "gmatdefs.hpp"
+#include "Rvector3.hpp"
+#include "Rmatrix33.hpp"
+#include "A1Mjd.hpp"
+
+class BodyFixedPoint;
+class CoordinateSystem;
+
+/**
+ * StationNetwork evaluates the topocentric range, azimuth and elevation of
+ * one or more targets from every station of a network in one call.
+ *
+ * All stations sit on the same central body.  Their body-fixed locations and
+ * body-fixed to SEZ rotations are computed once, when the station is added,
+ * and kept in contiguous arrays.  At each evaluation the body-fixed to
+ * inertial rotation is found once for the epoch, each target is rotated into
+ * the body-fixed frame once, and the loop over stations works on the packed
+ * arrays.  Each station is treated as BodyFixedPoint and TopocentricAxes
+ * treat it, so the results match a per station SEZ conversion.
+ *
+ * A target is visible from a station when its elevation is above the
+ * station's minimum elevation and above the station's horizon mask, if one
+ * is set, at the target's azimuth.
+ *
+ * Azimuth is measured from north toward east, in [0, 360) degrees.  Angles
+ * passed in and returned are in degrees, distances in km.
+ */
+class GMAT_API StationNetwork
+{
+public:
+   StationNetwork();
+   StationNetwork(const StationNetwork &net);
+   StationNetwork& operator=(const StationNetwork &net);
+   ~StationNetwork();
+
+   void           SetBodyShape(Real eqRadius, Real flat);
+   Integer        AddStation(BodyFixedPoint *station);
+   Integer        AddStation(const std::string &name, const Rvector3 &bfLoc,
+                             Real minEl = 0.0);
+   void           SetHorizonMask(Integer station, const RealArray &azimuths,
+                                 const RealArray &elevations);
+   void           Clear();
+
+   Integer        GetStationCount() const;
+   const std::string&
+                  GetStationName(Integer station) const;
+
+   void           Evaluate(const A1Mjd &atEpoch,
+                           const std::vector<Rvector3> &targets);
+   void           Evaluate(const Rmatrix33 &bfToInertial,
+                           const std::vector<Rvector3> &targets);
+
+   Integer        GetTargetCount() const;
+   Real           GetRange(Integer station, Integer target) const;
+   Real           GetAzimuth(Integer station, Integer target) const;
+   Real           GetElevation(Integer station, Integer target) const;
+   bool           IsVisible(Integer station, Integer target) const;
+
+private:
+   /// Names of the stations, in the order they were added
+   StringArray             names;
+   /// The body-fixed coordinate system shared by the stations
+   CoordinateSystem        *bfcs;
+   /// Equatorial radius of the central body
+   Real                    radius;
+   /// Flattening of the central body
+   Real                    flattening;
+
+   /// Body-fixed station locations
+   RealArray               locX;
+   RealArray               locY;
+   RealArray               locZ;
+   /// Body-fixed unit vectors of each station's south, east and zenith axes
+   RealArray               southX;
+   RealArray               southY;
+   RealArray               southZ;
+   RealArray               eastX;
+   RealArray               eastY;
+   RealArray               eastZ;
+   RealArray               zenithX;
+   RealArray               zenithY;
+   RealArray               zenithZ;
+   /// Minimum elevation of each station, in degrees
+   RealArray               minElevation;
+   /// Horizon masks, as azimuths sorted ascending and matching elevations
+   std::vector<RealArray>  maskAzimuths;
+   std::vector<RealArray>  maskElevations;
+
+   /// Number of targets in the last evaluation
+   Integer                 targetCount;
+   /// Results of the last evaluation, indexed target * stations + station
+   RealArray               ranges;
+   RealArray               azimuths;
+   RealArray               elevations;
+   std::vector<bool>       visible;
+
+   Real           GetMaskElevation(Integer station, Real azimuth) const;
+   Integer        GetResultIndex(Integer station, Integer target) const;
+};
+
+#endif // StationNetwork_hpp
@@ -52,6 +52,7 @@
 #include "GmatConstants.hpp"
 #include "AttitudeConversionUtility.hpp"
 #include "CoordinateConverter.hpp"
+#include "SpaceObject.hpp"
 
 
 //#define DEBUG_REF_SETTING
@@ -369,6 +370,7 @@ Attitude::Attitude(const std::string &typeStr, const std::string &itsName) :
    dcm                     (Rmatrix33(true)),
    attitudeTime            (0.0),
    attitudeTimeGT          (0.0),
+   attitudeCacheValid      (false),
    quaternion              (Rvector(4,0.0,0.0,0.0,1.0)),
    attitudeModelName       (""),
    modifyCoordSysAllowed   (true),
@@ -456,6 +458,7 @@ Attitude::Attitude(const Attitude& att) :
    angVel                  (att.angVel),
    attitudeTime            (att.attitudeTime),
    attitudeTimeGT          (att.attitudeTimeGT),
+   attitudeCacheValid      (false),
    quaternion              (att.quaternion),
    mrps                    (att.mrps),		   // Dunn Added
    eulerAngles             (att.eulerAngles),
@@ -534,6 +537,7 @@ Attitude& Attitude::operator=(const Attitude& att)
    angVel                  = att.angVel;
    attitudeTime            = att.attitudeTime;
    attitudeTimeGT          = att.attitudeTimeGT;
+   attitudeCacheValid      = false;
    quaternion              = att.quaternion;
    mrps                    = att.mrps;			// Dunn Added
    eulerAngles             = att.eulerAngles;
@@ -668,6 +672,7 @@ bool Attitude::Initialize()
    
    if (isInitialized && !needsReinit) return true;
    GmatBase::Initialize();
+   InvalidateAttitudeCache();
    if (modifyCoordSysAllowed && (!refCS))
    {
       std::string attEx  = "Reference coordinate system ";
@@ -780,6 +785,7 @@ void Attitude::SetEpoch(Real toEpoch)
 {
    epoch         = toEpoch; // need to reinitialize
    needsReinit   = true;
+   InvalidateAttitudeCache();
 }
 
 
@@ -787,6 +793,7 @@ void Attitude::SetEpochGT(GmatTime toEpoch)
 {
    epochGT = toEpoch; // need to reinitialize
    needsReinit = true;
+   InvalidateAttitudeCache();
 }
 
 //---------------------------------------------------------------------------
@@ -801,12 +808,16 @@ void Attitude::SetEpochGT(GmatTime toEpoch)
 void Attitude::NeedsReinitialization()
 {
    needsReinit = true;
+   InvalidateAttitudeCache();
 }
 
 void Attitude::SetOwningSpacecraft(GmatBase *theSC)
 {
    if (theSC->IsOfType("Spacecraft"))
+   {
       owningSC = theSC;
+      InvalidateAttitudeCache();
+   }
    else
    {
       throw AttitudeException(
@@ -864,11 +875,7 @@ const StringArray& Attitude::GetEulerSequenceList() const
 const Rvector&   Attitude::GetQuaternion(Real atTime)
 {
    if (!isInitialized || needsReinit) Initialize();
-//   if (GmatMathUtil::Abs(atTime - attitudeTime) > ATTITUDE_TIME_TOLERANCE)
-//   {
-      ComputeCosineMatrixAndAngularVelocity(atTime);
-      attitudeTime = atTime;
-//   }
+   UpdateAttitude(atTime);
    quaternion       = AttitudeConversionUtility::ToQuaternion(dcm);
    return quaternion;
 }
@@ -902,12 +909,7 @@ const Rvector3&  Attitude::GetEulerAngles(Real atTime)
    }
    #endif
 
-//   if (GmatMathUtil::Abs(atTime - attitudeTime) >
-//       ATTITUDE_TIME_TOLERANCE)
-//   {
-      ComputeCosineMatrixAndAngularVelocity(atTime);
-      attitudeTime = atTime;
-//   }
+   UpdateAttitude(atTime);
 
    eulerAngles = AttitudeConversionUtility::ToEulerAngles(dcm,
                            (Integer) eulerSequenceArray.at(0),
@@ -940,12 +942,7 @@ const Rvector3&  Attitude::GetEulerAngles(Real atTime,  Integer seq1,
                                           Integer seq2, Integer seq3)
 {
    if (!isInitialized || needsReinit) Initialize();
-//   if (GmatMathUtil::Abs(atTime - attitudeTime) >
-//       ATTITUDE_TIME_TOLERANCE)
-//   {
-      ComputeCosineMatrixAndAngularVelocity(atTime);
-      attitudeTime = atTime;
-//   }
+   UpdateAttitude(atTime);
    eulerAngles = AttitudeConversionUtility::ToEulerAngles(dcm, seq1, seq2, seq3);
    return eulerAngles;
 }
@@ -978,12 +975,7 @@ const Rmatrix33& Attitude::GetCosineMatrix(Real atTime)
       #endif
       Initialize();
    }
-//   if (GmatMathUtil::Abs(atTime - attitudeTime) >
-//       ATTITUDE_TIME_TOLERANCE)
-//   {
-      ComputeCosineMatrixAndAngularVelocity(atTime);
-      attitudeTime = atTime;
-//   }
+   UpdateAttitude(atTime);
    #ifdef DEBUG_ATTITUDE_GET_COSMAT
       MessageInterface::ShowMessage(" ... returning cosine matrix: %s\n",
             (dcm.ToString()).c_str());
@@ -1021,12 +1013,7 @@ const Rvector3& Attitude::GetAngularVelocity(Real atTime)
       throw AttitudeException(errMsg);
    }
    if (!isInitialized || needsReinit) Initialize();
-//   if (GmatMathUtil::Abs(atTime - attitudeTime) >
-//       ATTITUDE_TIME_TOLERANCE)
-//   {
-      ComputeCosineMatrixAndAngularVelocity(atTime);
-      attitudeTime = atTime;
-//   }
+   UpdateAttitude(atTime);
    return angVel;
 }
 
@@ -1062,12 +1049,7 @@ const Rvector3& Attitude::GetEulerAngleRates(Real atTime)
    }
 
    if (!isInitialized || needsReinit) Initialize();
-//   if (GmatMathUtil::Abs(atTime - attitudeTime) >
-//       ATTITUDE_TIME_TOLERANCE)
-//   {
-      ComputeCosineMatrixAndAngularVelocity(atTime);
-      attitudeTime = atTime;
-//   }
+   UpdateAttitude(atTime);
    eulerAngles       = GetEulerAngles(atTime);
    eulerAngleRates = AttitudeConversionUtility::ToEulerAngleRates(angVel,
                                eulerAngles,
@@ -1332,6 +1314,7 @@ bool Attitude::SetRefObject(GmatBase *obj,
    if (obj == NULL)
       return false;
    
+   InvalidateAttitudeCache();
    if (obj->IsOfType("CoordinateSystem"))
    {
       if (name == refCSName)
@@ -1447,17 +1430,17 @@ std::string Attitude::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Attitude::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < AttitudeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount, AttitudeParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    // otherwise, check for other reps
-   for (Integer i = OTHER_REPS_OFFSET; i < EndOtherReps; i++)
-   {
-      if (str == OTHER_REP_TEXT[i - OTHER_REPS_OFFSET])
-         return i;
-   }
+   static const ParameterIndex
+         otherRepIndex(OTHER_REP_TEXT, OTHER_REPS_OFFSET, EndOtherReps);
+   parameterId = otherRepIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatBase::GetParameterID(str);
 }
@@ -1733,6 +1716,7 @@ GmatTime Attitude::GetGmatTimeParameter(const Integer id) const
 
 GmatTime Attitude::SetGmatTimeParameter(const Integer id, const GmatTime value)
 {
+   InvalidateAttitudeCache();
    if (id == EPOCH)  // this should be an A1Mjd time
    {
       if (epochGT != value)
@@ -1947,6 +1931,7 @@ Real Attitude::SetRealParameter(const Integer id,
    "ENTERING Att::SetReal with id = %d (%s) and value = %.12f\n", id,
    GetParameterText(id).c_str(), value);
    #endif
+   InvalidateAttitudeCache();
    if ((!setInitialAttitudeAllowed) && IsInitialAttitudeParameter(id,"Real"))
    {
       if (!warnNoAttitudeWritten)
@@ -2438,6 +2423,7 @@ Real Attitude::SetRealParameter(const Integer id, const Real value,
       MessageInterface::ShowMessage("Entering SetReal with id = %d (%s), value = %12.10f, index= %d\n",
             id, GetParameterText(id).c_str(), value, index);
    #endif
+   InvalidateAttitudeCache();
    if ((!setInitialAttitudeAllowed) && IsInitialAttitudeParameter(id,"Rvector"))
    {
       if (!warnNoAttitudeWritten)
@@ -2704,6 +2690,7 @@ const Rvector& Attitude::SetRvectorParameter(const Integer id,
       MessageInterface::ShowMessage("  and Euler sequence is %d %d %d\n", eulerSequenceArray.at(0),
             eulerSequenceArray.at(1), eulerSequenceArray.at(2));
    #endif
+   InvalidateAttitudeCache();
    Integer sz = value.GetSize();
    Integer i;
    
@@ -2922,6 +2909,7 @@ const Rmatrix& Attitude::GetRmatrixParameter(const std::string &label) const
 const Rmatrix& Attitude::SetRmatrixParameter(const Integer id,
                                              const Rmatrix &value)
 {
+   InvalidateAttitudeCache();
    if ((!setInitialAttitudeAllowed) && IsInitialAttitudeParameter(id,"Rmatrix"))
    {
       if (!warnNoAttitudeWritten)
@@ -3062,6 +3050,7 @@ bool Attitude::SetStringParameter(const Integer     id,
    "ENTERING Att::SetString with id = %d (%s) and value = %s\n", id,
    GetParameterText(id).c_str(), value.c_str());
    #endif
+   InvalidateAttitudeCache();
    if (id == ATTITUDE_DISPLAY_STATE_TYPE)
    {
       if ((value != "Quaternion") && (value != "DirectionCosineMatrix") &&
@@ -3262,6 +3251,7 @@ bool Attitude::SetStringParameter(const Integer     id,
                                   const std::string &value,
                                   const Integer     index)
 {
+   InvalidateAttitudeCache();
    return GmatBase::SetStringParameter(id, value, index);
 }
 
@@ -3369,6 +3359,91 @@ const std::string& Attitude::GetGeneratingString(Gmat::WriteMode   mode,
 // protected methods
 //------------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------
+//  bool DependsOnOrbitState() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the attitude at a given time depends on the orbit state of
+ * the owning spacecraft.
+ *
+ * Models that only need the epoch, such as the kinematic spinners and the
+ * file based models, override this to return false so that repeated queries
+ * at one epoch skip the orbit state check.
+ *
+ * @return true if the attitude depends on the owning spacecraft state
+ */
+//------------------------------------------------------------------------------
+bool Attitude::DependsOnOrbitState() const
+{
+   return true;
+}
+
+//------------------------------------------------------------------------------
+//  void UpdateAttitude(Real atTime)
+//------------------------------------------------------------------------------
+/**
+ * Makes dcm and angVel current at atTime.
+ *
+ * The attitude is only recomputed when the time differs from the last
+ * computation, the cache was invalidated by a setting change, or, for models
+ * that depend on it, the state of the owning spacecraft changed.  This lets
+ * the SRP, drag, field of view and plot code query the same epoch without
+ * repeating the computation.
+ *
+ * @param atTime  A1Mjd time at which the attitude is needed
+ */
+//------------------------------------------------------------------------------
+void Attitude::UpdateAttitude(Real atTime)
+{
+   bool checkOrbit = (owningSC != NULL) && DependsOnOrbitState() &&
+                     owningSC->IsOfType(Gmat::SPACEOBJECT);
+   GmatState *orbit = NULL;
+   if (checkOrbit)
+      orbit = &(((SpaceObject*)owningSC)->GetState());
+
+   if (attitudeCacheValid && (atTime == attitudeTime))
+   {
+      if (!checkOrbit)
+         return;
+
+      Integer count  = (orbit->GetSize() < 6 ? orbit->GetSize() : 6);
+      bool unchanged = ((Integer)cachedOrbitState.size() == count + 1) &&
+                       (cachedOrbitState[0] == orbit->GetEpoch());
+      Real *data     = orbit->GetState();
+      for (Integer i = 0; unchanged && (i < count); ++i)
+         if (cachedOrbitState[i+1] != data[i])
+            unchanged = false;
+      if (unchanged)
+         return;
+   }
+
+   ComputeCosineMatrixAndAngularVelocity(atTime);
+   attitudeTime = atTime;
+
+   cachedOrbitState.clear();
+   if (checkOrbit)
+   {
+      Integer count = (orbit->GetSize() < 6 ? orbit->GetSize() : 6);
+      Real *data    = orbit->GetState();
+      cachedOrbitState.push_back(orbit->GetEpoch());
+      for (Integer i = 0; i < count; ++i)
+         cachedOrbitState.push_back(data[i]);
+   }
+   attitudeCacheValid = true;
+}
+
+//------------------------------------------------------------------------------
+//  void InvalidateAttitudeCache()
+//------------------------------------------------------------------------------
+/**
+ * Forces the next attitude query to recompute the attitude.
+ */
+//------------------------------------------------------------------------------
+void Attitude::InvalidateAttitudeCache()
+{
+   attitudeCacheValid = false;
+}
+
 
 //------------------------------------------------------------------------------
 //  bool  ValidateCosineMatrix(const Rmatrix33 &mat)
@@ -4056,7 +4131,7 @@ bool Attitude::IsInitialAttitudeParameter(Integer id, std::string ofType) const
 Rmatrix33 Attitude::GetRotationMatrix(const GmatTime &epochGT)
 {
    // Compute dcm matrix and angles' velocity w.r.t. MJ2000Eq
-   ComputeCosineMatrixAndAngularVelocity(epochGT.GetMjd());
+   UpdateAttitude(epochGT.GetMjd());
 
    // dcm.Transpose() is rotation matrix from spacecraft's attitude frame (B-frame) to inertial frame (I-frame)
    Rmatrix33 MT = dcm.Transpose();
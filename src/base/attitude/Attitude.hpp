@@ -391,6 +391,10 @@ protected:
    /// were computed                     
    Real                  attitudeTime;
    GmatTime              attitudeTimeGT;
+   /// true when dcm and angVel hold the attitude at attitudeTime
+   bool                  attitudeCacheValid;
+   /// owning spacecraft epoch and state when dcm and angVel were computed
+   RealArray             cachedOrbitState;
 
    /// the last computed quaternion
    Rvector               quaternion;
@@ -463,6 +467,10 @@ protected:
    virtual void ComputeCosineMatrixAndAngularVelocity(Real atTime) = 0;
    virtual void ComputeCosineMatrixAndAngularVelocity(GmatTime &atTime) = 0;
 
+   virtual bool DependsOnOrbitState() const;
+   void         UpdateAttitude(Real atTime);
+   void         InvalidateAttitudeCache();
+
 private:
    // default constructor - not implemented
    Attitude();
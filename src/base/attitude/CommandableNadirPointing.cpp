@@ -259,6 +259,7 @@ const Rmatrix33& CommandableNadirPointing::GetCosineMatrix(Real atTime)
 Real CommandableNadirPointing::SetRealParameter(const Integer id,
                                 const Real    value)
 {
+   InvalidateAttitudeCache();
    if (id == BODY_ALIGNMENT_VECTOR_X)
    {
       bodyAlignmentVector(0) = value;
@@ -326,6 +327,7 @@ Real CommandableNadirPointing::SetRealParameter(const std::string &label,
 bool CommandableNadirPointing::SetStringParameter(const Integer     id,
                                   const std::string &value)
 {
+   InvalidateAttitudeCache();
    if (id == ATTITUDE_REFERENCE_BODY)
    {
       refBodyName = value;
@@ -391,6 +393,7 @@ const Rvector& CommandableNadirPointing::SetRvectorParameter(const Integer id,
       "Entering SetRvectorParameter() in CommandableNadirPointing\n");
 #endif
    
+   InvalidateAttitudeCache();
    if (id == QUATERNION)
    {
 #ifdef DEBUG_CNP
@@ -439,6 +442,7 @@ const Rvector& CommandableNadirPointing::SetRvectorParameter(const Integer id,
 const Rmatrix& CommandableNadirPointing::SetRmatrixParameter(
                                              const Integer id, const Rmatrix &value)
 {
+   InvalidateAttitudeCache();
    if (id == DIRECTION_COSINE_MATRIX)
    {
       Integer r,c;
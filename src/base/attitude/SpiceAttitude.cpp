@@ -346,8 +346,7 @@ void SpiceAttitude::SetObjectID(const std::string &objName, Integer objNaifId,
 //---------------------------------------------------------------------------
 const Rvector&   SpiceAttitude::GetQuaternion(Real atTime)
 {
-   ComputeCosineMatrixAndAngularVelocity(atTime);
-   attitudeTime     = atTime;
+   UpdateAttitude(atTime);
    quaternion       = AttitudeConversionUtility::ToQuaternion(dcm);
    return quaternion;
 }
@@ -367,8 +366,7 @@ const Rvector&   SpiceAttitude::GetQuaternion(Real atTime)
 //---------------------------------------------------------------------------
 const Rvector3&  SpiceAttitude::GetEulerAngles(Real atTime)
 {
-   ComputeCosineMatrixAndAngularVelocity(atTime);
-   attitudeTime   = atTime;
+   UpdateAttitude(atTime);
    eulerAngles    = AttitudeConversionUtility::ToEulerAngles(dcm,
                               (Integer) eulerSequenceArray.at(0),
                               (Integer) eulerSequenceArray.at(1),
@@ -399,8 +397,7 @@ const Rvector3&  SpiceAttitude::GetEulerAngles(Real atTime)
 const Rvector3&  SpiceAttitude::GetEulerAngles(Real atTime,  Integer seq1,
                                                Integer seq2, Integer seq3)
 {
-   ComputeCosineMatrixAndAngularVelocity(atTime);
-   attitudeTime   = atTime;
+   UpdateAttitude(atTime);
    eulerAngles    = AttitudeConversionUtility::ToEulerAngles(dcm, seq1, seq2, seq3);
    return eulerAngles;
 }
@@ -419,8 +416,7 @@ const Rvector3&  SpiceAttitude::GetEulerAngles(Real atTime,  Integer seq1,
 //---------------------------------------------------------------------------
 const Rmatrix33& SpiceAttitude::GetCosineMatrix(Real atTime)
 {
-   ComputeCosineMatrixAndAngularVelocity(atTime);
-   attitudeTime = atTime;
+   UpdateAttitude(atTime);
 
    return dcm;
 }
@@ -439,8 +435,7 @@ const Rmatrix33& SpiceAttitude::GetCosineMatrix(Real atTime)
 //---------------------------------------------------------------------------
 const Rvector3& SpiceAttitude::GetAngularVelocity(Real atTime)
 {
-   ComputeCosineMatrixAndAngularVelocity(atTime);
-   attitudeTime = atTime;
+   UpdateAttitude(atTime);
    return angVel;
 }
 
@@ -459,8 +454,7 @@ const Rvector3& SpiceAttitude::GetAngularVelocity(Real atTime)
 //---------------------------------------------------------------------------
 const Rvector3& SpiceAttitude::GetEulerAngleRates(Real atTime)
 {
-   ComputeCosineMatrixAndAngularVelocity(atTime);
-   attitudeTime        = atTime;
+   UpdateAttitude(atTime);
    eulerAngles         = GetEulerAngles(atTime);
    eulerAngleRates     = AttitudeConversionUtility::ToEulerAngleRates(angVel,
                          eulerAngles,
@@ -504,11 +498,12 @@ std::string SpiceAttitude::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SpiceAttitude::GetParameterID(const std::string &str) const
 {
-   for (Integer i = AttitudeParamCount; i < SpiceAttitudeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - AttitudeParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, AttitudeParamCount,
+               SpiceAttitudeParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Attitude::GetParameterID(str);
 }
@@ -632,6 +627,7 @@ bool SpiceAttitude::SetStringParameter(const Integer id,
             "\nEntering SetStringParameter with id = %d, value = \"%s\", index = %d\n",
             id, value.c_str(), index);
    #endif
+   InvalidateAttitudeCache();
    // Changed to save full path kernel names (LOJ: 2014.06.27)
    // We may need to show full path in the GUI as a hint in a future
    if (id == ATTITUDE_KERNEL_NAME)
@@ -147,6 +147,8 @@ protected:
 
    virtual void ComputeCosineMatrixAndAngularVelocity(Real atTime);
    virtual void ComputeCosineMatrixAndAngularVelocity(GmatTime &atTime);
+   /// The attitude depends only on the epoch
+   virtual bool DependsOnOrbitState() const { return false; };
 
 private:
    // Default constructor - not implemented
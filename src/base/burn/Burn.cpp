@@ -373,6 +373,25 @@ Real Burn::GetEpochAtLastFire()
    return epochAtLastFire;
 }
 
+//------------------------------------------------------------------------------
+// Rmatrix33 GetFrameBasis()
+//------------------------------------------------------------------------------
+/**
+ * Returns the rotation from the burn axes to the inertial axes
+ *
+ * Column i of the matrix is the inertial direction of Element(i+1), as set by
+ * the most recent conversion of the burn to inertial components.
+ *
+ * @return The rotation matrix
+ */
+//------------------------------------------------------------------------------
+Rmatrix33 Burn::GetFrameBasis()
+{
+   return Rmatrix33(frameBasis[0][0], frameBasis[0][1], frameBasis[0][2],
+                    frameBasis[1][0], frameBasis[1][1], frameBasis[1][2],
+                    frameBasis[2][0], frameBasis[2][1], frameBasis[2][2]);
+}
+
 
 //------------------------------------------------------------------------------
 //  std::string GetParameterText(const Integer id) const
@@ -1225,11 +1244,14 @@ void Burn::ConvertDeltaVToInertial(Real *dv, Real *dvInertial, Real epoch)
       // set coincident to true
       coordSystem->ToBaseSystem(A1Mjd(epoch), inDeltaV, outDeltaV, true);  // @todo - need ToMJ2000Eq here?
       
-      #ifdef DEBUG_BURN_CONVERT_ROTMAT
       Rmatrix33 rotMat = coordSystem->GetLastRotationMatrix();
+      #ifdef DEBUG_BURN_CONVERT_ROTMAT
       MessageInterface::ShowMessage
          ("rotMat=\n%s\n", rotMat.ToString(16, 20).c_str());
       #endif
+      for (Integer i=0; i<3; i++)
+         for (Integer j=0; j<3; j++)
+            frameBasis[i][j] = rotMat(i,j);
       
       dvInertial[0] = outDeltaV[0];
       dvInertial[1] = outDeltaV[1];
@@ -1243,6 +1265,9 @@ void Burn::ConvertDeltaVToInertial(Real *dv, Real *dvInertial, Real epoch)
          dvInertial[0] = dv[0];
          dvInertial[1] = dv[1];
          dvInertial[2] = dv[2];
+         for (Integer i=0; i<3; i++)
+            for (Integer j=0; j<3; j++)
+               frameBasis[i][j] = (i == j ? 1.0 : 0.0);
       }
       else if (isSpacecraftBodyAxes)
       {
@@ -1260,6 +1285,10 @@ void Burn::ConvertDeltaVToInertial(Real *dv, Real *dvInertial, Real epoch)
          outDeltaV = inDeltaV * rotMat;
          for (Integer i=0; i<3; i++)
             dvInertial[i] = outDeltaV[i];
+         // The row vector product applies the transpose
+         for (Integer i=0; i<3; i++)
+            for (Integer j=0; j<3; j++)
+               frameBasis[i][j] = rotMat(j,i);
       }
       else
       {         
@@ -1271,6 +1300,11 @@ void Burn::ConvertDeltaVToInertial(Real *dv, Real *dvInertial, Real epoch)
          dvInertial[0] = outDeltaV[0];
          dvInertial[1] = outDeltaV[1];
          dvInertial[2] = outDeltaV[2];
+
+         Rmatrix33 rotMat = localCoordSystem->GetLastRotationMatrix();
+         for (Integer i=0; i<3; i++)
+            for (Integer j=0; j<3; j++)
+               frameBasis[i][j] = rotMat(i,j);
       }
    }
    
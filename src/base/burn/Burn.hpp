@@ -58,6 +58,7 @@ public:
    Real*                GetTotalAcceleration();
    Real*                GetTotalThrust();
    Real                 GetEpochAtLastFire();
+   Rmatrix33            GetFrameBasis();
    
    // Inherited (GmatBase) methods
    // for parameters
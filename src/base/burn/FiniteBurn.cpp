@@ -98,7 +98,11 @@ FiniteBurn::FiniteBurn(const std::string &nomme) :
    burnEpoch                (-1),
    burnState                (nullptr),
    burnMass                 (-1.0),
-   burnOrigin               (nullptr)
+   burnOrigin               (nullptr),
+   thrusterSpacecraft       (nullptr),
+   powerCached              (false),
+   powerEpoch               (-1.0),
+   thrustPower              (0.0)
 {
    objectTypes.push_back(Gmat::FINITE_BURN);
    objectTypeNames.push_back("FiniteBurn");
@@ -137,7 +141,11 @@ FiniteBurn::FiniteBurn(const FiniteBurn& fb) :
    burnEpoch              (-1),           // Always reset these
    burnState              (nullptr),
    burnMass               (-1.0),
-   burnOrigin             (nullptr)
+   burnOrigin             (nullptr),
+   thrusterSpacecraft     (nullptr),
+   powerCached            (false),
+   powerEpoch             (-1.0),
+   thrustPower            (0.0)
 {
    parameterCount = fb.parameterCount;
 }
@@ -168,6 +176,7 @@ FiniteBurn& FiniteBurn::operator=(const FiniteBurn& fb)
    burnState              = nullptr;
    burnMass               = -1.0;
    burnOrigin             = nullptr;
+   ClearBurnThrusters();
    
    return *this;
 }
@@ -197,16 +206,7 @@ void FiniteBurn::SetSpacecraftToManeuver(Spacecraft *sat)
    if (sat == NULL)
       return;
    
-   // FiniteBurn does not require CoordinateSystem conversion
-   // so we don't need Burn::SetSpacecraftToManeuver(sat);
-   // The thruster will handle CoordinateSystem conversion
-   
-   // If spacecraft changed, re-associate tank of the spacecraft
-   if (spacecraft != sat)
-   {
-      spacecraft = sat;
-      SetThrustersFromSpacecraft();
-   }
+   SetManeuveringSpacecraft(sat);
 
    // Load starting data into the data buffer
    Real epoch = sat->GetEpoch();
@@ -219,6 +219,36 @@ void FiniteBurn::SetSpacecraftToManeuver(Spacecraft *sat)
    #endif
 }
 
+//------------------------------------------------------------------------------
+//  void SetManeuveringSpacecraft(Spacecraft *sat)
+//------------------------------------------------------------------------------
+/**
+ * Sets the spacecraft used by the burn without evaluating the thrusters.
+ *
+ * Callers that follow this call with their own Fire() (the FiniteThrust force
+ * model, for example) use this method to avoid a redundant evaluation at the
+ * spacecraft epoch.
+ *
+ * @param sat the Spacecraft
+ */
+//------------------------------------------------------------------------------
+void FiniteBurn::SetManeuveringSpacecraft(Spacecraft *sat)
+{
+   if (sat == NULL)
+      return;
+   
+   // FiniteBurn does not require CoordinateSystem conversion
+   // so we don't need Burn::SetSpacecraftToManeuver(sat);
+   // The thruster will handle CoordinateSystem conversion
+   
+   // If spacecraft changed, re-associate tank of the spacecraft
+   if (spacecraft != sat)
+   {
+      spacecraft = sat;
+      SetThrustersFromSpacecraft();
+   }
+}
+
 /**
  * Method to set additional data needed for position and mass based computations
  *
@@ -300,34 +330,30 @@ bool FiniteBurn::Fire(Real *burnData, Real epoch, bool /*backwards*/)
        frameBasis[2][0], frameBasis[2][1], frameBasis[2][2]);
    #endif
    
+   // Resolve the burn thrusters (cached until the thruster set changes)
+   ValidateBurnThrusters();
+
    // If this FiniteBurn uses electric thrusters, we must compute the throttle
    // logic based on the total power available to the thrusters
    if (isElectricBurn)
    {
-      Real availablePower = spacecraft->GetThrustPower();
+      Real availablePower = GetAvailableThrustPower();
       ComputeThrottleLogic(availablePower);
    }
 
-   for (StringArray::iterator i = thrusterNames.begin(); 
-        i != thrusterNames.end(); ++i)
+   for (UnsignedInt index = 0; index < burnThrusters.size(); ++index)
    {
-      #ifdef DEBUG_FINITE_BURN
-         MessageInterface::ShowMessage
-            ("   Accessing thruster '%s' from spacecraft <%p>'%s'\n", (*i).c_str(),
-             spacecraft, spacecraft->GetName().c_str());
-      #endif
-      
-      current = (Thruster *)spacecraft->GetRefObject(Gmat::THRUSTER, *i);
-      if (!current)
-         throw BurnException("FiniteBurn::Fire requires thruster named \"" +
-            (*i) + "\" on spacecraft " + spacecraft->GetName());
-      
-      // Save current thruster so that GetRefObject() can return it (LOJ: 2009.08.28)
-      thrusterMap[current->GetName()] = current;
+      current = burnThrusters[index];
       
       // FiniteBurn class is friend of Thruster class, so we can access
-      // member data directly
-      current->ComputeInertialDirection(epoch);
+      // member data directly.  Thrusters sharing a frame with an earlier
+      // thruster reuse that thruster's rotation.
+      Integer source = frameSources[index];
+      if ((source < 0) ||
+          !current->SharesFrameWith(*burnThrusters[source]))
+         current->ComputeInertialDirection(epoch);
+      else
+         current->ComputeInertialDirection(*burnThrusters[source]);
       dir = current->inertialDirection;
       norm = sqrt(dir[0]*dir[0] + dir[1]*dir[1] + dir[2]*dir[2]);
       
@@ -338,7 +364,7 @@ bool FiniteBurn::Fire(Real *burnData, Real epoch, bool /*backwards*/)
       #endif
          
       if (norm == 0.0)
-         throw BurnException("FiniteBurn::Fire thruster " + (*i) +
+         throw BurnException("FiniteBurn::Fire thruster " + thrusterNames[index] +
                              " on spacecraft " + spacecraft->GetName() +
                              " has no direction.");
       
@@ -367,7 +393,7 @@ bool FiniteBurn::Fire(Real *burnData, Real epoch, bool /*backwards*/)
       
       #ifdef DEBUG_FINITEBURN_FIRE
          MessageInterface::ShowMessage("   Thruster %s = %s details:\n", 
-            (*i).c_str(), current->GetName().c_str());
+            thrusterNames[index].c_str(), current->GetName().c_str());
          MessageInterface::ShowMessage(
             "          thrust = %.15f\n"
             "appliedThrustMag = %.15f\n"
@@ -452,32 +478,24 @@ bool FiniteBurn::IsFiring()
    
    Thruster *current = NULL;
    int firingCount = 0;
-   for (StringArray::iterator i = thrusterNames.begin(); i != thrusterNames.end(); ++i)
+   ValidateBurnThrusters();
+   for (UnsignedInt index = 0; index < burnThrusters.size(); ++index)
    {
-      #ifdef DEBUG_IS_FIRING
-      MessageInterface::ShowMessage
-         ("   Accessing thruster '%s' from spacecraft <%p>'%s'\n", (*i).c_str(),
-          spacecraft, spacecraft->GetName().c_str());
-      #endif
-      
-      current = (Thruster *)spacecraft->GetRefObject(Gmat::THRUSTER, *i);
-      if (!current)
-         throw BurnException("FiniteBurn::Fire requires thruster named \"" +
-            (*i) + "\" on spacecraft " + spacecraft->GetName());
+      current = burnThrusters[index];
       
       // FiniteBurn class is friend of Thruster class, so we can access
       // member data directly
       if (current->thrusterFiring)
       {
          #ifdef DEBUG_IS_FIRING
-         MessageInterface::ShowMessage("   Thruster '%s' is firing\n", (*i).c_str());
+         MessageInterface::ShowMessage("   Thruster '%s' is firing\n", thrusterNames[index].c_str());
          #endif
          firingCount++;
       }
       else
       {
          #ifdef DEBUG_IS_FIRING
-         MessageInterface::ShowMessage("   Thruster '%s' is not firing\n", (*i).c_str());
+         MessageInterface::ShowMessage("   Thruster '%s' is not firing\n", thrusterNames[index].c_str());
          #endif
       }
    }
@@ -567,11 +585,11 @@ Integer FiniteBurn::GetParameterID(const std::string &str) const
       return BURNAXES;
    }
    
-   for (Integer i = BurnParamCount; i < FiniteBurnParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BurnParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, BurnParamCount, FiniteBurnParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Burn::GetParameterID(str);
 }
@@ -1070,13 +1088,16 @@ bool FiniteBurn::DepletesMass()
 {
    bool retval = false;
 
-   ObjectArray thrusterArray = spacecraft->GetRefObjectArray(Gmat::THRUSTER);
+   const ObjectArray &thrusterArray =
+         spacecraft->GetRefObjectArray(Gmat::THRUSTER);
 
    // Check each the thruster
-   for (ObjectArray::iterator th = thrusterArray.begin();
+   for (ObjectArray::const_iterator th = thrusterArray.begin();
         th != thrusterArray.end(); ++th)
    {
-      if ((*th)->GetBooleanParameter("DecrementMass"))
+      // FiniteBurn class is friend of Thruster class, so we can access
+      // member data directly
+      if (((Thruster*)(*th))->decrementMass)
       {
          retval = true;
          #ifdef DEBUG_MASS_FLOW
@@ -1140,6 +1161,8 @@ bool FiniteBurn::TakeAction(const std::string& action,
    }
    else if (action == "SetData")
    {
+      // A new burn starts; resolve thrusters and power afresh
+      ClearBurnThrusters();
       if (spacecraft)
       {
          // Load starting data into the data buffer
@@ -1202,6 +1225,8 @@ bool FiniteBurn::SetThrustersFromSpacecraft()
    MessageInterface::ShowMessage("   thrusterNames.size()=%d\n", thrusterNames.size());
    #endif
    
+   ClearBurnThrusters();
+   
    // Get thrusters and tanks associated to spacecraft
    ObjectArray thrusterArray = spacecraft->GetRefObjectArray(Gmat::THRUSTER);
    ObjectArray tankArray     = spacecraft->GetRefObjectArray(Gmat::FUEL_TANK);
@@ -1280,10 +1305,138 @@ bool FiniteBurn::SetThrustersFromSpacecraft()
 }
 
 
+//------------------------------------------------------------------------------
+// bool ValidateBurnThrusters()
+//------------------------------------------------------------------------------
+/**
+ * Makes sure the resolved thruster list matches the current spacecraft.
+ *
+ * The thrusters named by the burn are looked up once, and the lookup is reused
+ * until the spacecraft, its thruster list, or the burn's thruster names change.
+ * Parameters of the thrusters themselves are still read live on every Fire(),
+ * so changes made to thrust coefficients during a burn take effect.
+ *
+ * @return true if the existing list was valid, false if it was rebuilt.
+ */
+//------------------------------------------------------------------------------
+bool FiniteBurn::ValidateBurnThrusters()
+{
+   const ObjectArray &thrusterArray =
+         spacecraft->GetRefObjectArray(Gmat::THRUSTER);
+
+   if ((thrusterSpacecraft == spacecraft) &&
+       (burnThrusterSource == thrusterArray) &&
+       (burnThrusterNames == thrusterNames))
+      return true;
+
+   ClearBurnThrusters();
+
+   Thruster *current;
+   for (UnsignedInt index = 0; index < thrusterNames.size(); ++index)
+   {
+      #ifdef DEBUG_FINITE_BURN
+         MessageInterface::ShowMessage
+            ("   Accessing thruster '%s' from spacecraft <%p>'%s'\n",
+             thrusterNames[index].c_str(), spacecraft,
+             spacecraft->GetName().c_str());
+      #endif
+
+      current = (Thruster *)spacecraft->GetRefObject(Gmat::THRUSTER,
+            thrusterNames[index]);
+      if (!current)
+      {
+         ClearBurnThrusters();
+         throw BurnException("FiniteBurn::Fire requires thruster named \"" +
+            thrusterNames[index] + "\" on spacecraft " + spacecraft->GetName());
+      }
+
+      // Save current thruster so that GetRefObject() can return it (LOJ: 2009.08.28)
+      thrusterMap[current->GetName()] = current;
+      burnThrusters.push_back(current);
+
+      // Thrusters projected through the same frame share one rotation
+      Integer source = -1;
+      for (UnsignedInt j = 0; j < index; ++j)
+      {
+         if ((frameSources[j] < 0) && current->SharesFrameWith(*burnThrusters[j]))
+         {
+            source = (Integer)j;
+            break;
+         }
+      }
+      frameSources.push_back(source);
+
+      if (isElectricBurn)
+         minPowerIds.push_back(current->GetParameterID("MinimumUsablePower"));
+   }
+
+   burnThrusterSource = thrusterArray;
+   burnThrusterNames  = thrusterNames;
+   thrusterSpacecraft = spacecraft;
+
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearBurnThrusters()
+//------------------------------------------------------------------------------
+/**
+ * Discards the resolved thruster list and the cached thrust power.
+ */
+//------------------------------------------------------------------------------
+void FiniteBurn::ClearBurnThrusters()
+{
+   burnThrusters.clear();
+   frameSources.clear();
+   minPowerIds.clear();
+   burnThrusterSource.clear();
+   burnThrusterNames.clear();
+   thrusterSpacecraft = nullptr;
+   powerCached        = false;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetAvailableThrustPower()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the power available to the thrusters.
+ *
+ * The power system model depends on the spacecraft epoch and position, so the
+ * last value is reused while both are unchanged.  This happens when the same
+ * spacecraft state is evaluated again, e.g. by the finite thrust force at the
+ * start of a step and by parameters reported from the burn.
+ *
+ * @return The thrust power
+ */
+//------------------------------------------------------------------------------
+Real FiniteBurn::GetAvailableThrustPower()
+{
+   Real scEpoch = spacecraft->GetEpoch();
+   const Real *position = spacecraft->GetState().GetState();
+
+   if (powerCached && (scEpoch == powerEpoch) &&
+       (position[0] == powerPosition[0]) &&
+       (position[1] == powerPosition[1]) &&
+       (position[2] == powerPosition[2]))
+      return thrustPower;
+
+   thrustPower      = spacecraft->GetThrustPower();
+   powerEpoch       = scEpoch;
+   powerPosition[0] = position[0];
+   powerPosition[1] = position[1];
+   powerPosition[2] = position[2];
+   powerCached      = true;
+
+   return thrustPower;
+}
+
+
 bool FiniteBurn::ComputeThrottleLogic(Real powerAvailable)
 {
    ElectricThruster *current         = NULL;
-   Integer          numThrusters     = (Integer) thrusterNames.size();
+   Integer          numThrusters     = (Integer) burnThrusters.size();
    Real             powerPerThruster = 0.0;
    #ifdef DEBUG_FINITE_BURN_POWER
       MessageInterface::ShowMessage
@@ -1312,13 +1465,10 @@ bool FiniteBurn::ComputeThrottleLogic(Real powerAvailable)
                 spacecraft, spacecraft->GetName().c_str());
          #endif
 
-         // Check to make sure there is not an error accessing this thruster
-         current = (ElectricThruster *)spacecraft->GetRefObject(Gmat::THRUSTER, thrusterNames.at(ii));
-         if (!current)
-            throw BurnException("FiniteBurn::Fire requires thruster named \"" +
-                  thrusterNames.at(ii) + "\" on spacecraft " + spacecraft->GetName());
+         // The thrusters were resolved (and checked) in ValidateBurnThrusters
+         current = (ElectricThruster *)burnThrusters.at(ii);
          electricThrusters.push_back(current);
-         minPower = current->GetRealParameter(current->GetParameterID("MinimumUsablePower"));
+         minPower = current->GetRealParameter(minPowerIds.at(ii));
          minUsablePowerPerThruster.push_back(minPower);
          #ifdef DEBUG_FINITE_BURN_POWER
             MessageInterface::ShowMessage
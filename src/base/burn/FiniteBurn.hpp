@@ -35,6 +35,8 @@
 
 #include "Burn.hpp"
 
+class Thruster;
+
 
 /**
  * Class used to configure finite burns.
@@ -49,6 +51,7 @@ public:
    
    // inherited methods from Burn
    virtual void         SetSpacecraftToManeuver(Spacecraft *sat);
+   void                 SetManeuveringSpacecraft(Spacecraft *sat);
    virtual void         SetManeuverEpochAndState(Real epoch,
                               Real* state, Real mass = -1.0,
                               CelestialBody *origin = nullptr);
@@ -128,8 +131,32 @@ protected:
    Real                    burnMass;
    /// Central body for the state data; nullptr to default to Earth
    CelestialBody           *burnOrigin;
+
+   /// Thrusters resolved for the current spacecraft, in thrusterNames order
+   std::vector<Thruster*>  burnThrusters;
+   /// Index of an earlier burn thruster whose frame rotation is reused, or -1
+   IntegerArray            frameSources;
+   /// Parameter ID of MinimumUsablePower on each electric burn thruster
+   IntegerArray            minPowerIds;
+   /// Spacecraft thruster list used to resolve burnThrusters
+   ObjectArray             burnThrusterSource;
+   /// Thruster names used to resolve burnThrusters
+   StringArray             burnThrusterNames;
+   /// Spacecraft used to resolve burnThrusters
+   Spacecraft              *thrusterSpacecraft;
+   /// Flag indicating that thrustPower holds the power for the key below
+   bool                    powerCached;
+   /// Spacecraft epoch at which thrustPower was evaluated
+   Real                    powerEpoch;
+   /// Spacecraft position at which thrustPower was evaluated
+   Real                    powerPosition[3];
+   /// Thrust power available at the cached epoch and position
+   Real                    thrustPower;
    
    bool SetThrustersFromSpacecraft();
+   bool ValidateBurnThrusters();
+   void ClearBurnThrusters();
+   Real GetAvailableThrustPower();
    
    /// Published parameters for thrusters
    enum
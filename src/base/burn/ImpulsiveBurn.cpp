@@ -621,11 +621,12 @@ std::string ImpulsiveBurn::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ImpulsiveBurn::GetParameterID(const std::string &str) const
 {
-   for (Integer i = BurnParamCount; i < ImpulsiveBurnParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BurnParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, BurnParamCount,
+               ImpulsiveBurnParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Burn::GetParameterID(str);
 }
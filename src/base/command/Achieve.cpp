@@ -33,7 +33,12 @@
 #include "Achieve.hpp"
 #include "StringUtil.hpp"  // for ToReal()
 #include <sstream>
+#include <map>
 #include "MessageInterface.hpp"
+#include "Spacecraft.hpp"
+#include "Burn.hpp"
+#include "StopCondition.hpp"
+#include "RealUtilities.hpp"
 
 //#define DEBUG_ACHIEVE_PARSE
 //#define DEBUG_ACHIEVE_PARAMS
@@ -324,11 +329,12 @@ std::string Achieve::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Achieve::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverSequenceCommandParamCount; i < AchieveParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SolverSequenceCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SolverSequenceCommandParamCount,
+               AchieveParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return SolverSequenceCommand::GetParameterID(str);
 }
@@ -1019,6 +1025,10 @@ bool Achieve::Execute()
       ("   Setting goal = %f to targeter<%p>\n", val, targeter);
    #endif
    targeter->SetResultValue(goalId, val);
+
+   if (targeter->UsesStateTransitionDerivatives() &&
+       (targeter->GetState() == Solver::NOMINAL))
+      SetStateDerivatives();
    
    // Evaluate tolerance pass it to the targeter
    val = tolerance->EvaluateReal();
@@ -1122,3 +1132,152 @@ void Achieve::SetTolerance(Real value)
    MessageInterface::ShowMessage("Achieve::SetTolerance() leaving\n");
    #endif
 }
+
+
+//------------------------------------------------------------------------------
+// void SetStateDerivatives()
+//------------------------------------------------------------------------------
+/**
+ * Passes the derivatives of the goal, built from STMs, to the targeter.
+ *
+ * The derivative of the goal with respect to each variable is the gradient of
+ * the goal with respect to the current spacecraft state, found by central
+ * differences on the state without propagating, times the STM column of the
+ * state element that the Vary command sets.  Burn components use the STM
+ * velocity columns rotated by the burn axes.  The STM maps state changes
+ * between fixed epochs, so propagation in the loop must stop on time
+ * conditions; when this or any other requirement is not met, the targeter
+ * falls back to finite differences.
+ */
+//------------------------------------------------------------------------------
+void Achieve::SetStateDerivatives()
+{
+   // Relative perturbation used for the goal gradient
+   const Real statePerturbation = 1.0e-6;
+   // Epochs closer than this (in days) are treated as the same epoch
+   const Real epochTolerance = 1.0e-9;
+
+   // Stopping conditions that are not times move the end epoch
+   for (GmatCommand *cmd = previous; (cmd != NULL) &&
+         !cmd->IsOfType("SolverBranchCommand"); cmd = cmd->GetPrevious())
+   {
+      if (cmd->GetTypeName() != "Propagate")
+         continue;
+
+      ObjectArray stops = cmd->GetRefObjectArray(Gmat::STOP_CONDITION);
+      for (UnsignedInt i = 0; i < stops.size(); ++i)
+      {
+         if (!((StopCondition*)stops[i])->IsTimeCondition())
+         {
+            targeter->RejectStateTransitionDerivatives("the stopping "
+                  "condition " + stops[i]->GetName() + " is not a time "
+                  "condition");
+            return;
+         }
+      }
+   }
+
+   const StringArray &vars = targeter->GetStringArrayParameter(
+         targeter->GetParameterID("Variables"));
+   RealArray derivatives(vars.size(), 0.0);
+   std::map<GmatBase*, Rvector6> gradients;
+   std::map<GmatBase*, Real> resetEpochs;
+
+   for (UnsignedInt i = 0; i < vars.size(); ++i)
+   {
+      Solver::StateSensitivity sensitivity;
+      if (!targeter->GetVariableSensitivity(i, sensitivity))
+      {
+         targeter->RejectStateTransitionDerivatives("the variable " +
+               vars[i] + " was not set on the nominal run");
+         return;
+      }
+
+      Spacecraft *sat = (Spacecraft*)sensitivity.spacecraft;
+      const Rmatrix &stm = sat->GetRmatrixParameter("OrbitSTM");
+
+      if (resetEpochs.find(sat) == resetEpochs.end())
+      {
+         resetEpochs[sat] = sensitivity.epoch;
+
+         // An identity STM after a propagation was not propagated
+         bool isIdentity = true;
+         for (Integer j = 0; j < 6; ++j)
+            for (Integer k = 0; k < 6; ++k)
+               if (stm(j,k) != (j == k ? 1.0 : 0.0))
+                  isIdentity = false;
+         if (isIdentity && (GmatMathUtil::Abs(sat->GetEpoch() -
+               sensitivity.epoch) > epochTolerance))
+         {
+            targeter->RejectStateTransitionDerivatives("the STM of " +
+                  sat->GetName() + " is not propagated");
+            return;
+         }
+
+         // Gradient of the goal with respect to the current state
+         Real *state = sat->GetState().GetState();
+         Rvector6 gradient;
+         for (Integer j = 0; j < 6; ++j)
+         {
+            Real nominalValue = state[j];
+            Real step = statePerturbation *
+                  (1.0 + GmatMathUtil::Abs(nominalValue));
+            state[j] = nominalValue + step;
+            Real plus = goal->EvaluateReal();
+            state[j] = nominalValue - step;
+            Real minus = goal->EvaluateReal();
+            state[j] = nominalValue;
+            gradient[j] = (plus - minus) / (2.0 * step);
+         }
+         gradients[sat] = gradient;
+      }
+      else if (GmatMathUtil::Abs(resetEpochs[sat] - sensitivity.epoch) >
+               epochTolerance)
+      {
+         targeter->RejectStateTransitionDerivatives("the variables of " +
+               sat->GetName() + " are set at different epochs");
+         return;
+      }
+
+      // STM column of the varied element
+      Real column[6];
+      if (sensitivity.owner == sensitivity.spacecraft)
+      {
+         for (Integer j = 0; j < 6; ++j)
+            column[j] = stm(j, sensitivity.element);
+      }
+      else
+      {
+         Burn *burn = (Burn*)sensitivity.owner;
+         if (!burn->HasFired() || (GmatMathUtil::Abs(
+               burn->GetEpochAtLastFire() - sensitivity.epoch) >
+               epochTolerance))
+         {
+            targeter->RejectStateTransitionDerivatives("the burn " +
+                  burn->GetName() + " is not applied at the epoch of its "
+                  "Vary command");
+            return;
+         }
+
+         Rmatrix33 basis = burn->GetFrameBasis();
+         for (Integer j = 0; j < 6; ++j)
+         {
+            column[j] = 0.0;
+            for (Integer k = 0; k < 3; ++k)
+               column[j] += stm(j, 3 + k) * basis(k, sensitivity.element);
+         }
+      }
+
+      const Rvector6 &gradient = gradients[sat];
+      for (Integer j = 0; j < 6; ++j)
+         derivatives[i] += gradient[j] * column[j];
+      derivatives[i] *= sensitivity.scale;
+   }
+
+   #ifdef DEBUG_ACHIEVE_EXEC
+   MessageInterface::ShowMessage
+      ("   Setting %d STM derivatives of goal %d to targeter<%p>\n",
+       derivatives.size(), goalId, targeter);
+   #endif
+   targeter->SetResultDerivatives(goalId, derivatives);
+}
@@ -123,6 +123,7 @@ protected:
    bool                targeterDataFinalized;
    
    void SetTolerance(Real value);
+   void SetStateDerivatives();
    
    // Parameter IDs
    enum {
@@ -102,7 +102,8 @@ Assignment::Assignment  () :
    rhsWrapper                    (NULL),
    rhsEquation                   (NULL),
    lhsOwner                      (NULL),
-   lhsOwnerID                    (-1)
+   lhsOwnerID                    (-1),
+   cloneHoldersFound             (false)
 {
    objectTypeNames.push_back("GMAT");
    objectTypeNames.push_back("Assignment");
@@ -144,7 +145,8 @@ Assignment::Assignment  (const Assignment& a) :
    rhsWrapper                    (NULL),
    rhsEquation                   (a.rhsEquation),  // Should be NULL
    lhsOwner                      (NULL),
-   lhsOwnerID                    (a.lhsOwnerID)
+   lhsOwnerID                    (a.lhsOwnerID),
+   cloneHoldersFound             (false)
 {
 }
 
@@ -174,6 +176,8 @@ Assignment& Assignment::operator=(const Assignment& a)
    rhsEquation                 = a.rhsEquation;  // Should be deleted and set NULL
    lhsOwner                    = NULL;
    lhsOwnerID                  = a.lhsOwnerID;
+   cloneHolders.clear();
+   cloneHoldersFound           = false;
    
    return *this;
 }
@@ -961,6 +965,8 @@ bool Assignment::Initialize()
    lhsOwner = lhsWrapper->GetRefObject();
    if (lhsWrapper->GetWrapperType() == Gmat::OBJECT_PROPERTY_WT)
       lhsOwnerID = ((ObjectPropertyWrapper*)(lhsWrapper))->GetPropertyId();
+   cloneHolders.clear();
+   cloneHoldersFound = false;
 
    #ifdef DEBUG_ASSIGNMENT_INIT
    MessageInterface::ShowMessage("Assignment::Initialize() returning true\n");
@@ -1236,6 +1242,9 @@ void Assignment::RunComplete()
       rhsEquation->Finalize();
    }
    
+   cloneHolders.clear();
+   cloneHoldersFound = false;
+   
    GmatCommand::RunComplete();
 }
 
@@ -2390,15 +2399,49 @@ void Assignment::PassToClones()
    if (lhsOwner == NULL)
       return;
 
-   GmatCommand *current = GetNext();
+   // The downstream walk only needs to happen once per run; afterwards the
+   // commands that hold clones of the LHS owner are visited directly, so
+   // assignments inside loops do not traverse the rest of the sequence
+   if (!cloneHoldersFound)
+   {
+      cloneHolders.clear();
+      GmatCommand *current = GetNext();
+
+      while ((current != NULL) && (current != this))
+      {
+         #ifdef DEBUG_CLONE_UPDATES
+            MessageInterface::ShowMessage("%s: %d clones\n",
+                  current->GetTypeName().c_str(), current->GetCloneCount());
+         #endif
+         Integer count = current->GetCloneCount();
+         for (Integer i = 0; i < count; ++i)
+         {
+            GmatBase *theClone = current->GetClone(i);
+            if ((theClone != NULL) &&
+                (theClone->GetName() == lhsOwner->GetName()))
+            {
+               cloneHolders.push_back(current);
+               break;
+            }
+         }
+
+         // Prevent infinite looping!
+         if (current == current->GetNext())
+            break;
+
+         current = current->GetNext();
+         #ifdef DEBUG_CLONE_UPDATES
+            MessageInterface::ShowMessage("current: %p this: %p\n", current, this);
+         #endif
+      }
+      cloneHoldersFound = true;
+   }
 
-   while ((current != NULL) && (current != this))
+   for (UnsignedInt j = 0; j < cloneHolders.size(); ++j)
    {
-      #ifdef DEBUG_CLONE_UPDATES
-         MessageInterface::ShowMessage("%s: %d clones\n",
-               current->GetTypeName().c_str(), current->GetCloneCount());
-      #endif
-      for (Integer i = 0; i < current->GetCloneCount(); ++i)
+      GmatCommand *current = cloneHolders[j];
+      Integer count = current->GetCloneCount();
+      for (Integer i = 0; i < count; ++i)
       {
          GmatBase *theClone = current->GetClone(i);
          #ifdef DEBUG_CLONE_UPDATES
@@ -2430,24 +2473,7 @@ void Assignment::PassToClones()
                MatchAttribute(lhsOwnerID, lhsOwner, theClone);
             }
          }
-         #ifdef DEBUG_CLONE_UPDATES
-            else
-            {
-               MessageInterface::ShowMessage("Clone \"%s\" has a different "
-                     "name from owner \"%s\"\n", theClone->GetName().c_str(),
-                     lhsOwner->GetName().c_str());
-            }
-         #endif
       }
-
-      // Prevent infinite looping!
-      if (current == current->GetNext())
-         break;
-
-      current = current->GetNext();
-      #ifdef DEBUG_CLONE_UPDATES
-         MessageInterface::ShowMessage("current: %p this: %p\n", current, this);
-      #endif
    }
 }
 
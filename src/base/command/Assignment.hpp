@@ -133,6 +133,10 @@ protected:
    GmatBase             *lhsOwner;
    /// Object parameter ID if lhs is an attribute
    Integer              lhsOwnerID;
+   /// Commands downstream of this one holding clones of lhsOwner
+   std::vector<GmatCommand*> cloneHolders;
+   /// Flag indicating that cloneHolders has been built for this run
+   bool                 cloneHoldersFound;
    
    // methods
    bool ValidateArrayElement(ElementWrapper *lhsWrapper, ElementWrapper *rhsWrapper);
@@ -36,6 +36,8 @@
 #include "CallFunction.hpp"
 #include "Assignment.hpp"
 #include "CommandUtil.hpp"      // for GetCommandSeqString()
+#include "Profiler.hpp"         // for ProfileScope
+#include "MemoryTracker.hpp"
 #include <sstream>              // for stringstream
 
 //#define DEBUG_BRANCHCOMMAND_DEALLOCATION
@@ -54,9 +56,6 @@
 //#define DEBUG_MEMORY
 //#endif
 
-#ifdef DEBUG_MEMORY
-#include "MemoryTracker.hpp"
-#endif
 
 //------------------------------------------------------------------------------
 // public methods
@@ -1282,8 +1281,15 @@ bool BranchCommand::ExecuteBranch(Integer which)
          // Save current command and set it after current command finished executing
          // in case for calling GmatFunction.
          GmatCommand *curcmd = current;
-         if (current->Execute() == false)
-            retval = false;
+         {
+            ProfileScope profile("Command", current);
+            if (MemoryTracker::IsCounting())
+               MemoryTracker::Instance()->StartCommandCount(current);
+            if (current->Execute() == false)
+               retval = false;
+            if (MemoryTracker::IsCounting())
+               MemoryTracker::Instance()->EndCommandCount(current);
+         }
          
          current = curcmd;
          // check for user interruption here
@@ -0,0 +1,554 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                BranchMission
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation for the BranchMission command
+ */
+//------------------------------------------------------------------------------
+
+#include "BranchMission.hpp"
+#include "Parameter.hpp"
+#include "Subscriber.hpp"
+#include "StringUtil.hpp"
+#include "MessageInterface.hpp"
+#include <iostream>
+#include <cstdio>
+#include <algorithm>
+
+#if !defined(_WIN32)
+   #define BRANCHMISSION_USE_FORK
+   #include <unistd.h>
+   #include <sys/types.h>
+   #include <sys/wait.h>
+#endif
+
+//#define DEBUG_BRANCHMISSION
+
+//---------------------------------
+//  static data
+//---------------------------------
+const std::string
+BranchMission::PARAMETER_TEXT[BranchMissionParamCount - GmatCommandParamCount] =
+{
+   "Branches",
+   "BranchVariable",
+};
+
+const Gmat::ParameterType
+BranchMission::PARAMETER_TYPE[BranchMissionParamCount - GmatCommandParamCount] =
+{
+   Gmat::INTEGER_TYPE,       // "Branches",
+   Gmat::OBJECT_TYPE,        // "BranchVariable",
+};
+
+
+//------------------------------------------------------------------------------
+// BranchMission()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+BranchMission::BranchMission() :
+   GmatCommand    ("BranchMission"),
+   branchCount    (1),
+   branchVariable (NULL),
+   branchNumber   (1),
+   branched       (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~BranchMission()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+BranchMission::~BranchMission()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// BranchMission(const BranchMission& bm)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param bm The command that is copied
+ */
+//------------------------------------------------------------------------------
+BranchMission::BranchMission(const BranchMission& bm) :
+   GmatCommand    (bm),
+   branchCount    (bm.branchCount),
+   variableName   (bm.variableName),
+   branchVariable (NULL),
+   branchNumber   (1),
+   branched       (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// BranchMission& operator=(const BranchMission &bm)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param bm The command that is copied
+ *
+ * @return this instance, with internal data set to match the input command
+ */
+//------------------------------------------------------------------------------
+BranchMission& BranchMission::operator=(const BranchMission &bm)
+{
+   if (this != &bm)
+   {
+      GmatCommand::operator=(bm);
+      branchCount    = bm.branchCount;
+      variableName   = bm.variableName;
+      branchVariable = NULL;
+      branchNumber   = 1;
+      branched       = false;
+      branchProcessIds.clear();
+   }
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// bool InterpretAction()
+//------------------------------------------------------------------------------
+/**
+ * Parses the branch count and the branch Variable from the script line
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool BranchMission::InterpretAction()
+{
+   StringArray chunks = InterpretPreface();
+   StringArray parts;
+   if (chunks.size() > 1)
+      parts = GmatStringUtil::SeparateBy(
+            GmatStringUtil::Trim(chunks[1], GmatStringUtil::BOTH, true, true),
+            " ,");
+
+   Integer count;
+   if ((parts.size() != 2) || !GmatStringUtil::ToInteger(parts[0], count))
+      throw CommandException("The BranchMission command needs a branch count "
+            "and a Variable, as in \"BranchMission 3 Plan\"");
+
+   SetIntegerParameter(BRANCH_COUNT, count);
+   variableName = parts[1];
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Finds the branch Variable
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool BranchMission::Initialize()
+{
+   bool retval = GmatCommand::Initialize();
+
+   GmatBase *obj = FindObject(variableName);
+   if ((obj == NULL) || (obj->GetTypeName() != "Variable"))
+      throw CommandException("The BranchMission command cannot find the "
+            "Variable \"" + variableName + "\"");
+   branchVariable = (Parameter*)obj;
+
+   branchNumber = 1;
+   branched = false;
+   branchProcessIds.clear();
+
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Execute()
+//------------------------------------------------------------------------------
+/**
+ * Starts the branches the first time it runs, and sets the branch Variable
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool BranchMission::Execute()
+{
+   if (!branched)
+   {
+      branched = true;
+      StartBranches();
+   }
+
+   branchVariable->SetReal(branchNumber);
+
+   BuildCommandSummary(true);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void RunComplete()
+//------------------------------------------------------------------------------
+/**
+ * Ends the branch processes, and waits for them in branch 1
+ */
+//------------------------------------------------------------------------------
+void BranchMission::RunComplete()
+{
+   if (branched)
+      FinishBranches();
+   branched = false;
+
+   GmatCommand::RunComplete();
+}
+
+
+//------------------------------------------------------------------------------
+// GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * This method returns a clone of the BranchMission.
+ *
+ * @return clone of the BranchMission.
+ */
+//------------------------------------------------------------------------------
+GmatBase* BranchMission::Clone() const
+{
+   return (new BranchMission(*this));
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterText(const Integer id) const
+//------------------------------------------------------------------------------
+std::string BranchMission::GetParameterText(const Integer id) const
+{
+   if (id >= GmatCommandParamCount && id < BranchMissionParamCount)
+      return PARAMETER_TEXT[id - GmatCommandParamCount];
+   return GmatCommand::GetParameterText(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetParameterID(const std::string &str) const
+//------------------------------------------------------------------------------
+Integer BranchMission::GetParameterID(const std::string &str) const
+{
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+                        BranchMissionParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
+
+   return GmatCommand::GetParameterID(str);
+}
+
+
+//------------------------------------------------------------------------------
+// Gmat::ParameterType GetParameterType(const Integer id) const
+//------------------------------------------------------------------------------
+Gmat::ParameterType BranchMission::GetParameterType(const Integer id) const
+{
+   if (id >= GmatCommandParamCount && id < BranchMissionParamCount)
+      return PARAMETER_TYPE[id - GmatCommandParamCount];
+   return GmatCommand::GetParameterType(id);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterTypeString(const Integer id) const
+//------------------------------------------------------------------------------
+std::string BranchMission::GetParameterTypeString(const Integer id) const
+{
+   if (id >= GmatCommandParamCount && id < BranchMissionParamCount)
+      return GmatBase::PARAM_TYPE_STRING[GetParameterType(id)];
+   return GmatCommand::GetParameterTypeString(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+Integer BranchMission::GetIntegerParameter(const Integer id) const
+{
+   if (id == BRANCH_COUNT)
+      return branchCount;
+   return GmatCommand::GetIntegerParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+Integer BranchMission::SetIntegerParameter(const Integer id, const Integer value)
+{
+   if (id == BRANCH_COUNT)
+   {
+      if (value < 1)
+         throw CommandException("The branch count of the BranchMission "
+               "command must be an Integer >= 1, but it is " +
+               GmatStringUtil::ToString(value, 1));
+      branchCount = value;
+      return branchCount;
+   }
+   return GmatCommand::SetIntegerParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetStringParameter(const Integer id) const
+//------------------------------------------------------------------------------
+std::string BranchMission::GetStringParameter(const Integer id) const
+{
+   if (id == BRANCH_VARIABLE)
+      return variableName;
+   return GmatCommand::GetStringParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetStringParameter(const Integer id, const std::string &value)
+//------------------------------------------------------------------------------
+bool BranchMission::SetStringParameter(const Integer id,
+                                       const std::string &value)
+{
+   if (id == BRANCH_VARIABLE)
+   {
+      variableName = value;
+      return true;
+   }
+   return GmatCommand::SetStringParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetGeneratingString(Gmat::WriteMode mode,
+//       const std::string &prefix, const std::string &useName)
+//------------------------------------------------------------------------------
+/**
+ * Builds the script line for the command
+ *
+ * @param mode    Specifies the type of serialization requested.
+ * @param prefix  Optional prefix appended to the object's name.
+ * @param useName Name that replaces the object's name.
+ *
+ * @return The script line
+ */
+//------------------------------------------------------------------------------
+const std::string& BranchMission::GetGeneratingString(Gmat::WriteMode mode,
+      const std::string &prefix, const std::string &useName)
+{
+   generatingString = prefix + "BranchMission " +
+         GmatStringUtil::ToString(branchCount, 1) + " " + variableName + ";";
+   return GmatCommand::GetGeneratingString(mode, prefix, useName);
+}
+
+
+//------------------------------------------------------------------------------
+// bool RenameRefObject(const UnsignedInt type, const std::string &oldName,
+//       const std::string &newName)
+//------------------------------------------------------------------------------
+bool BranchMission::RenameRefObject(const UnsignedInt type,
+                                    const std::string &oldName,
+                                    const std::string &newName)
+{
+   if (variableName == oldName)
+      variableName = newName;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void StartBranches()
+//------------------------------------------------------------------------------
+/**
+ * Starts a process for each branch after the first
+ *
+ * Every subscriber writes out what it buffered first, so the data of the
+ * shared part of the mission is written once.  The new processes then move
+ * their report files to branch file names, and turn their other subscribers
+ * off so the files of branch 1 are left alone.
+ */
+//------------------------------------------------------------------------------
+void BranchMission::StartBranches()
+{
+   if (branchCount < 2)
+      return;
+
+   #ifdef BRANCHMISSION_USE_FORK
+      ObjectArray subscribers = GetSubscribers();
+      for (UnsignedInt i = 0; i < subscribers.size(); ++i)
+         subscribers[i]->TakeAction("Flush");
+      std::cout.flush();
+      fflush(NULL);
+
+      for (Integer b = 2; b <= branchCount; ++b)
+      {
+         pid_t pid = fork();
+         if (pid == 0)
+         {
+            branchNumber = b;
+            branchProcessIds.clear();
+            break;
+         }
+
+         if (pid < 0)
+         {
+            MessageInterface::ShowMessage("*** WARNING *** BranchMission "
+                  "could only start %d of %d branches\n", b - 1, branchCount);
+            break;
+         }
+
+         branchProcessIds.push_back((Integer)pid);
+      }
+
+      if (branchNumber > 1)
+      {
+         for (UnsignedInt i = 0; i < subscribers.size(); ++i)
+         {
+            Subscriber *sub = (Subscriber*)subscribers[i];
+            if (sub->IsOfType("ReportFile"))
+               sub->SetStringParameter("Filename", GetBranchFileName(
+                     sub->GetStringParameter("Filename")));
+            else
+               sub->Activate(false);
+         }
+      }
+      else
+         MessageInterface::ShowMessage("BranchMission started %d branches\n",
+               branchProcessIds.size() + 1);
+
+      #ifdef DEBUG_BRANCHMISSION
+         MessageInterface::ShowMessage("BranchMission: process %d runs "
+               "branch %d\n", (Integer)getpid(), branchNumber);
+      #endif
+   #else
+      MessageInterface::ShowMessage("*** WARNING *** BranchMission cannot "
+            "start processes on this system, so only branch 1 of %d runs\n",
+            branchCount);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void FinishBranches()
+//------------------------------------------------------------------------------
+/**
+ * Ends a branch process, or waits for the branches in branch 1
+ *
+ * A branch process closes its report files and exits here, so it does not go
+ * on to whatever the program would do after the run.
+ */
+//------------------------------------------------------------------------------
+void BranchMission::FinishBranches()
+{
+   #ifdef BRANCHMISSION_USE_FORK
+      if (branchNumber > 1)
+      {
+         ObjectArray subscribers = GetSubscribers();
+         for (UnsignedInt i = 0; i < subscribers.size(); ++i)
+            subscribers[i]->TakeAction("Finalize");
+         std::cout.flush();
+         fflush(NULL);
+         _exit(0);
+      }
+
+      for (UnsignedInt i = 0; i < branchProcessIds.size(); ++i)
+      {
+         int status = 0;
+         if ((waitpid((pid_t)branchProcessIds[i], &status, 0) < 0) ||
+             !WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+            MessageInterface::ShowMessage("*** WARNING *** Branch %d of the "
+                  "mission did not finish\n", i + 2);
+         else
+            MessageInterface::ShowMessage("Branch %d of the mission "
+                  "finished\n", i + 2);
+      }
+   #endif
+
+   branchProcessIds.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// ObjectArray GetSubscribers()
+//------------------------------------------------------------------------------
+/**
+ * Returns the subscribers of the run
+ */
+//------------------------------------------------------------------------------
+ObjectArray BranchMission::GetSubscribers()
+{
+   ObjectArray subscribers;
+   ObjectMap *maps[2] = { objectMap, globalObjectMap };
+   for (Integer m = 0; m < 2; ++m)
+   {
+      if (maps[m] == NULL)
+         continue;
+      for (ObjectMap::iterator i = maps[m]->begin(); i != maps[m]->end(); ++i)
+      {
+         if ((i->second != NULL) && i->second->IsOfType(Gmat::SUBSCRIBER) &&
+             (find(subscribers.begin(), subscribers.end(), i->second) ==
+              subscribers.end()))
+            subscribers.push_back(i->second);
+      }
+   }
+   return subscribers;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetBranchFileName(const std::string &fileName) const
+//------------------------------------------------------------------------------
+/**
+ * Inserts the branch suffix before the extension of a file name
+ *
+ * @param fileName The scripted file name
+ *
+ * @return The file name of this branch
+ */
+//------------------------------------------------------------------------------
+std::string BranchMission::GetBranchFileName(const std::string &fileName) const
+{
+   std::string suffix = "_branch" + GmatStringUtil::ToString(branchNumber, 1);
+
+   size_t dotLoc = fileName.find_last_of('.');
+   size_t slashLoc = fileName.find_last_of("/\\");
+   if ((dotLoc == std::string::npos) ||
+       ((slashLoc != std::string::npos) && (dotLoc < slashLoc)))
+      return fileName + suffix;
+
+   return fileName.substr(0, dotLoc) + suffix + fileName.substr(dotLoc);
+}
@@ -0,0 +1,125 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                BranchMission
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition for the BranchMission command, which splits a run into
+ * concurrent what-if branches
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef BranchMission_hpp
+#define BranchMission_hpp
+
+#include "GmatCommand.hpp"
+
+class Parameter;
+
+/**
+ * Splits the rest of a run into branches that run at the same time
+ *
+ *    BranchMission 3 Plan
+ *
+ * The first time the command runs, it starts one process for each branch
+ * after the first.  Each process continues the mission from the current state
+ * with the Variable (here Plan) set to its branch number, 1 to 3, so the
+ * commands that follow can choose the branch's maneuvers.  The shared part of
+ * the mission is computed only once, and the processes share its memory
+ * until they change it.
+ *
+ * The run that executed the command is branch 1 and keeps the scripted
+ * output files.  Each other branch writes its report files with a
+ * "_branch<N>" suffix, and its other subscribers are turned off.  At the end
+ * of the run, branch 1 waits for the others and reports how each finished.
+ *
+ * Branches need fork(), so on Windows only branch 1 runs.  The command is
+ * meant for console runs.
+ */
+class GMAT_API BranchMission : public GmatCommand
+{
+public:
+   BranchMission();
+   virtual ~BranchMission();
+   BranchMission(const BranchMission& bm);
+   BranchMission&       operator=(const BranchMission &bm);
+
+   // inherited from GmatCommand
+   virtual bool         InterpretAction();
+   virtual bool         Initialize();
+   virtual bool         Execute();
+   virtual void         RunComplete();
+
+   // inherited from GmatBase
+   virtual GmatBase*    Clone() const;
+   virtual std::string  GetParameterText(const Integer id) const;
+   virtual Integer      GetParameterID(const std::string &str) const;
+   virtual Gmat::ParameterType
+                        GetParameterType(const Integer id) const;
+   virtual std::string  GetParameterTypeString(const Integer id) const;
+   virtual Integer      GetIntegerParameter(const Integer id) const;
+   virtual Integer      SetIntegerParameter(const Integer id,
+                                            const Integer value);
+   virtual std::string  GetStringParameter(const Integer id) const;
+   virtual bool         SetStringParameter(const Integer id,
+                                           const std::string &value);
+   virtual const std::string&
+                        GetGeneratingString(Gmat::WriteMode mode = Gmat::SCRIPTING,
+                                            const std::string &prefix = "",
+                                            const std::string &useName = "");
+   virtual bool         RenameRefObject(const UnsignedInt type,
+                                        const std::string &oldName,
+                                        const std::string &newName);
+
+   DEFAULT_TO_NO_CLONES
+
+protected:
+   // Parameter IDs
+   enum
+   {
+      BRANCH_COUNT = GmatCommandParamCount,
+      BRANCH_VARIABLE,
+      BranchMissionParamCount
+   };
+
+   /// Number of branches
+   Integer              branchCount;
+   /// Name of the Variable set to the branch number
+   std::string          variableName;
+   /// The Variable set to the branch number
+   Parameter            *branchVariable;
+   /// Branch run by this process, starting at 1
+   Integer              branchNumber;
+   /// True once the branches were started in this run
+   bool                 branched;
+   /// Process IDs of the other branches, in branch 1
+   IntegerArray         branchProcessIds;
+
+   void                 StartBranches();
+   void                 FinishBranches();
+   ObjectArray          GetSubscribers();
+   std::string          GetBranchFileName(const std::string &fileName) const;
+
+   static const std::string
+      PARAMETER_TEXT[BranchMissionParamCount - GmatCommandParamCount];
+   static const Gmat::ParameterType
+      PARAMETER_TYPE[BranchMissionParamCount - GmatCommandParamCount];
+};
+
+#endif // BranchMission_hpp
@@ -780,11 +780,12 @@ std::string ConditionalBranch::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ConditionalBranch::GetParameterID(const std::string &str) const
 {
-   for (Integer i = BranchCommandParamCount; i < ConditionalBranchParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BranchCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, BranchCommandParamCount,
+               ConditionalBranchParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return BranchCommand::GetParameterID(str);
 }
@@ -167,11 +167,12 @@ std::string Create::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Create::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ManageObjectParamCount; i < CreateParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ManageObjectParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ManageObjectParamCount,
+               CreateParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return ManageObject::GetParameterID(str);
 }
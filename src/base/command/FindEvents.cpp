@@ -182,11 +182,12 @@ std::string FindEvents::GetParameterText(const Integer id) const
 //---------------------------------------------------------------------------
 Integer FindEvents::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < FindEventsParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+               FindEventsParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatCommand::GetParameterID(str);
 }
@@ -644,11 +644,11 @@ std::string For::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer For::GetParameterID(const std::string &str) const
 {
-   for (Integer i = BranchCommandParamCount; i < ForParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BranchCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, BranchCommandParamCount, ForParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return BranchCommand::GetParameterID(str);
 }
@@ -130,6 +130,7 @@ Integer GmatCommand::satDryMassID;
 Integer GmatCommand::satTotalMassID;
 Integer GmatCommand::satSPADDragScaleFactorID;
 Integer GmatCommand::satSPADSRPScaleFactorID;
+Integer GmatCommand::tankFuelMassID = -1;
 
 //---------------------------------
 //  public methods
@@ -1216,11 +1217,12 @@ std::string GmatCommand::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer GmatCommand::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < GmatCommandParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               GmatCommandParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatBase::GetParameterID(str);
 }
@@ -2489,7 +2491,7 @@ void GmatCommand::BuildCommandSummary(bool commandCompleted)
       // Save parameter and fuel tank data
       i9 = i * 9;
 
-      StringArray tanks = satVector[i]->GetStringArrayParameter(satTankID);
+      const StringArray &tanks = satVector[i]->GetStringArrayParameter(satTankID);
       parmData[i9] = satVector[i]->GetRealParameter(satCdID);
       parmData[i9 + 1] = satVector[i]->GetRealParameter(satDragAreaID);
       parmData[i9 + 2] = satVector[i]->GetRealParameter(satCrID);
@@ -2502,8 +2504,19 @@ void GmatCommand::BuildCommandSummary(bool commandCompleted)
 
       for (Integer ii = 0; ii < parmData[i9 + 8]; ii++)
       {
-         tankNames.at(MAX_NUM_TANKS*i + ii) = tanks.at(ii);
-         fuelMassData[MAX_NUM_TANKS*i + ii] = satVector[i]->GetRefObject(Gmat::HARDWARE, tanks.at(ii))->GetRealParameter("FuelMass");
+         if (tankNames.at(MAX_NUM_TANKS*i + ii) != tanks.at(ii))
+            tankNames.at(MAX_NUM_TANKS*i + ii) = tanks.at(ii);
+         GmatBase *tank = satVector[i]->GetRefObject(Gmat::HARDWARE, tanks.at(ii));
+         // Tanks derived from FuelTank share the FuelMass ID, so look it up
+         // once rather than by name on every command execution
+         if (tank->IsOfType(Gmat::FUEL_TANK))
+         {
+            if (tankFuelMassID == -1)
+               tankFuelMassID = tank->GetParameterID("FuelMass");
+            fuelMassData[MAX_NUM_TANKS*i + ii] = tank->GetRealParameter(tankFuelMassID);
+         }
+         else
+            fuelMassData[MAX_NUM_TANKS*i + ii] = tank->GetRealParameter("FuelMass");
       }
    }
 }
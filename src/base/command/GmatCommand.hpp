@@ -353,6 +353,7 @@ protected:
    static Integer       satTotalMassID;
    static Integer       satSPADDragScaleFactorID;
    static Integer       satSPADSRPScaleFactorID;
+   static Integer       tankFuelMassID;
 
 
    // Command summary data buffers
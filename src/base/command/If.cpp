@@ -291,11 +291,12 @@ std::string If::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer If::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ConditionalBranchParamCount; i < IfParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ConditionalBranchParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ConditionalBranchParamCount,
+               IfParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return ConditionalBranch::GetParameterID(str);
 }
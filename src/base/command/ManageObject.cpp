@@ -132,11 +132,12 @@ std::string ManageObject::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ManageObject::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < ManageObjectParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+               ManageObjectParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatCommand::GetParameterID(str);
 }
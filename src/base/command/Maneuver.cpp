@@ -33,6 +33,7 @@
 #include "Maneuver.hpp"
 #include "MessageInterface.hpp"
 #include <sstream>                 // for <<
+#include <algorithm>               // for find()
 #include "StringUtil.hpp"
 
 //#define DEBUG_MANEUVER 1
@@ -126,6 +127,7 @@ Maneuver::Maneuver(const Maneuver& m) :
    burn                 (NULL),
    satName              (m.satName),
    sat                  (NULL),
+   satNames             (m.satNames),
    firedOnce            (false),
    localCS              (m.localCS),
    scNameM              (m.scNameM),
@@ -162,6 +164,8 @@ Maneuver& Maneuver::operator=(const Maneuver& m)
    burn      = NULL;
    satName   = m.satName;
    sat       = NULL;
+   satNames  = m.satNames;
+   sats.clear();
    firedOnce = false;
 
    localCS            = m.localCS;
@@ -262,7 +266,12 @@ const std::string& Maneuver::GetGeneratingString(Gmat::WriteMode mode,
    generatingString = prefix + "Maneuver ";
    if (maneuverBackwards)
       generatingString += "BackProp ";
-   generatingString += burnName + "(" + satName + ");";
+   generatingString += burnName + "(";
+   if (satNames.empty())
+      generatingString += satName;
+   for (UnsignedInt i = 0; i < satNames.size(); ++i)
+      generatingString += (i == 0 ? "" : ", ") + satNames[i];
+   generatingString += ");";
    
    return GmatCommand::GetGeneratingString(mode, prefix, useName);
 }
@@ -294,6 +303,9 @@ bool Maneuver::RenameRefObject(const UnsignedInt type,
 
    if (type == Gmat::SPACECRAFT)
    {
+      for (UnsignedInt i = 0; i < satNames.size(); ++i)
+         if (satNames[i] == oldName)
+            satNames[i] = newName;
       if (satName == oldName)
       {
          satName = newName;
@@ -362,7 +374,11 @@ const StringArray& Maneuver::GetRefObjectNameArray(const UnsignedInt type)
    if (type == Gmat::UNKNOWN_OBJECT ||
        type == Gmat::SPACECRAFT)
    {
-      refObjectNames.push_back(satName);
+      if (satNames.empty())
+         refObjectNames.push_back(satName);
+      else
+         refObjectNames.insert(refObjectNames.end(), satNames.begin(),
+               satNames.end());
    }
 
    #ifdef DEBUG_MANEUVER_REFOBJ
@@ -407,11 +423,12 @@ std::string Maneuver::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Maneuver::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < ManeuverCommandParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+               ManeuverCommandParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatCommand::GetParameterID(str);
 }
@@ -501,7 +518,12 @@ bool Maneuver::SetStringParameter(const Integer id, const std::string &value)
 
    if (id == satNameID)
    {
+      // The parameter names the first (usually only) maneuvered spacecraft
       satName = value;
+      if (satNames.size() <= 1)
+         satNames.assign(1, value);
+      else
+         satNames[0] = value;
       return true;
    }
 
@@ -574,16 +596,18 @@ bool Maneuver::InterpretAction()
          MessageInterface::ShowMessage("   %s\n", subchunks[i].c_str());
    #endif
 
+   // Spaces and commas split the spacecraft list too, so only the leading
+   // BackProp keyword and text after the closing parenthesis are checked here
    std::string burnChunk = chunks[1];
-   if (subchunks.size() == 2)
+   if ((subchunks.size() > 1) && (subchunks[0] == "BackProp"))
    {
-      if (subchunks[0] == "BackProp")
-      {
-         maneuverBackwards = true;
-         burnChunk = subchunks[1];
-      }
+      maneuverBackwards = true;
+      burnChunk = GmatStringUtil::Trim(burnChunk.substr(burnChunk.find("BackProp") +
+            8));
    }
-   else if (subchunks.size() != 1)
+   std::string::size_type closeParen = burnChunk.find_last_of(")");
+   if ((subchunks.size() > 1) && ((closeParen == std::string::npos) ||
+       (GmatStringUtil::Trim(burnChunk.substr(closeParen + 1)) != "")))
       throw CommandException("Maneuver command is malformed; expecting "
                              "\"Maneuver ImpulsiveBurnName(SpacecraftName)\" or"
                              " \"Maneuver BackProp ImpulsiveBurnName"
@@ -613,15 +637,21 @@ bool Maneuver::InterpretAction()
       for (unsigned int ii=0; ii<currentChunks.size(); ii++)
          MessageInterface::ShowMessage("    %s\n",currentChunks.at(ii).c_str());
    #endif
-   if (currentChunks.size() > 1)
-      throw CommandException("Unexpected text after spacecraft name in "
-            "Maneuver command\n");
-
    if (currentChunks.size() == 0)
       throw CommandException("The Spacecraft name is missing in the Maneuver "
                "command\n");
 
+   // A list of spacecraft applies the burn to each of them in one pass
+   satNames.clear();
    SetStringParameter(satNameID, currentChunks[0]);
+   for (UnsignedInt i = 1; i < currentChunks.size(); ++i)
+   {
+      if (find(satNames.begin(), satNames.end(), currentChunks[i]) !=
+          satNames.end())
+         throw CommandException("The Spacecraft " + currentChunks[i] +
+               " is listed more than once in the Maneuver command\n");
+      satNames.push_back(currentChunks[i]);
+   }
 
    return true;
 }
@@ -658,14 +688,22 @@ bool Maneuver::Initialize()
          throw CommandException("The object " + burnName + " is not a burn, and "
                "cannot be used in as such in a Maneuver command");
    
-      if ((mapObj = FindObject(satName)) == NULL)
-         throw CommandException("Maneuver command cannot find the Spacecraft " +
-               satName);
-      if (mapObj->IsOfType(Gmat::SPACECRAFT))
-         sat = (Spacecraft *)mapObj;
-      else
-         throw CommandException("The object " + satName + " is not a spacecraft, "
-               "and cannot be used in as such in a Maneuver command");
+      if (satNames.empty())
+         satNames.assign(1, satName);
+      sats.clear();
+      for (UnsignedInt i = 0; i < satNames.size(); ++i)
+      {
+         if ((mapObj = FindObject(satNames[i])) == NULL)
+            throw CommandException("Maneuver command cannot find the "
+                  "Spacecraft " + satNames[i]);
+         if (mapObj->IsOfType(Gmat::SPACECRAFT))
+            sats.push_back((Spacecraft *)mapObj);
+         else
+            throw CommandException("The object " + satNames[i] + " is not a "
+                  "spacecraft, and cannot be used in as such in a Maneuver "
+                  "command");
+      }
+      sat = sats[0];
 
       #ifdef DEBUG_MANEUVER_INIT
       MessageInterface::ShowMessage("   streamID=%d\n", streamID);
@@ -718,15 +756,36 @@ bool Maneuver::Execute()
                state.ToString().c_str());
    #endif
    
-   burn->SetSpacecraftToManeuver(sat);
-   
-   // Set maneuvering to Publisher so that any subscriber can do its own action
-   publisher->SetManeuvering(this, true, epoch, satName, "ImpulsiveBurn");
-   
-   bool retval = burn->Fire(NULL, epoch, maneuverBackwards);
-   
-   // Reset maneuvering to Publisher so that any subscriber can do its action
-   publisher->SetManeuvering(this, false, epoch, satName, "ImpulsiveBurn");
+   bool retval;
+   if (sats.size() <= 1)
+   {
+      burn->SetSpacecraftToManeuver(sat);
+      
+      // Set maneuvering to Publisher so that any subscriber can do its own action
+      publisher->SetManeuvering(this, true, epoch, satName, "ImpulsiveBurn");
+      
+      retval = burn->Fire(NULL, epoch, maneuverBackwards);
+      
+      // Reset maneuvering to Publisher so that any subscriber can do its action
+      publisher->SetManeuvering(this, false, epoch, satName, "ImpulsiveBurn");
+   }
+   else
+   {
+      // Subscribers are notified once for the whole set of spacecraft, and
+      // each spacecraft is maneuvered at its own epoch
+      publisher->SetManeuvering(this, true, epoch, satNames, "ImpulsiveBurn");
+      
+      retval = true;
+      for (UnsignedInt i = 0; i < sats.size(); ++i)
+      {
+         burn->SetSpacecraftToManeuver(sats[i]);
+         if (!burn->Fire(NULL, sats[i]->GetRealParameter("A1Epoch"),
+               maneuverBackwards))
+            retval = false;
+      }
+      
+      publisher->SetManeuvering(this, false, epoch, satNames, "ImpulsiveBurn");
+   }
    
    #ifdef DEBUG_MANEUVER_EXEC
       state = sat->GetState(0); // Get Cartesian state
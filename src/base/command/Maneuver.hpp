@@ -50,6 +50,11 @@
  *     burn.Element1 = 0.125;         % km/s
  *     ...
  *     Maneuver burn(Sat1);
+ *
+ * The same burn can be applied to several spacecraft at one epoch, e.g. after
+ * a synchronized propagation of a constellation:
+ *
+ *     Maneuver burn(Sat1, Sat2, Sat3);
  */
 class GMAT_API Maneuver : public GmatCommand
 {
@@ -121,6 +126,10 @@ protected:
    std::string             satName;
    /// The spacecraft
    Spacecraft              *sat;
+   /// Names of all of the maneuvered spacecraft; satName is the first
+   StringArray             satNames;
+   /// All of the maneuvered spacecraft, in satNames order
+   std::vector<Spacecraft*> sats;
    /// Flag used to tell if the summary can be built yet
    bool                    firedOnce;
 
@@ -327,11 +327,12 @@ std::string Minimize::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Minimize::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverSequenceCommandParamCount; i < MinimizeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SolverSequenceCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SolverSequenceCommandParamCount,
+               MinimizeParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return SolverSequenceCommand::GetParameterID(str);
 }
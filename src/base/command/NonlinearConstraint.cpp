@@ -339,11 +339,12 @@ std::string NonlinearConstraint::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer NonlinearConstraint::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverSequenceCommandParamCount; i < NonlinearConstraintParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SolverSequenceCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SolverSequenceCommandParamCount,
+               NonlinearConstraintParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return SolverSequenceCommand::GetParameterID(str);
 }
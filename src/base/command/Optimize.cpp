@@ -32,6 +32,7 @@
 #include <sstream>
 #include "Optimize.hpp"
 #include "MessageInterface.hpp"
+#include "Profiler.hpp"
 
 //Added __USE_EXTERNAL_OPTIMIZER__ so that header will not be compiled
 #ifdef __USE_EXTERNAL_OPTIMIZER__
@@ -277,11 +278,12 @@ std::string Optimize::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Optimize::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverBranchCommandParamCount; i < OptimizeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SolverBranchCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SolverBranchCommandParamCount,
+               OptimizeParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
     
    return SolverBranchCommand::GetParameterID(str);
 }
@@ -637,7 +639,10 @@ bool Optimize::Execute()
 
       if ((theSolver->IsSolverInternal()) || (startMode == RUN_AND_SOLVE))
       { 
-         theSolver->AdvanceState();
+         {
+            ProfileScope profile("Solver", theSolver);
+            theSolver->AdvanceState();
+         }
          theSolver->ReportProgress(listeners, Solver::UNDEFINED_STATE);
       }
 
@@ -862,6 +867,21 @@ bool Optimize::ExecuteCallback()
                ii, vars.at(ii));
    #endif
    callbackResults = theSolver->AdvanceNestedState(vars); 
+
+   // Solvers that supply derivatives to the external optimizer run a
+   // perturbation pass per variable before returning the results
+   while (theSolver->GetNestedState() == Solver::PERTURBING)
+   {
+      ResetLoopData();
+      branchExecuting = true;
+      while (branchExecuting) 
+      {
+         if (!ExecuteBranch())
+            throw CommandException("Optimize: ERROR executing branch");
+      }
+      callbackResults = theSolver->AdvanceNestedState(vars);
+   }
+
    #ifdef DEBUG_CALLBACK
       MessageInterface::ShowMessage("after CALCULATING, data from callback are: \n");
       for (Integer ii = 0; ii < (Integer) callbackResults.size(); ii++)
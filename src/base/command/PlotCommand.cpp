@@ -241,11 +241,12 @@ std::string PlotCommand::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PlotCommand::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < PlotCommandParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+               PlotCommandParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatCommand::GetParameterID(str);
 }
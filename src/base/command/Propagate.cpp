@@ -41,6 +41,7 @@
 #include "AngleUtil.hpp"        // for PutAngleInDegRange()
 #include "ColorTypes.hpp"       // for GmatColor::
 #include "MessageInterface.hpp"
+#include "Profiler.hpp"           // for ProfileScope
 #include "RgbColor.hpp"         // for ToIntColor()
 #include <sstream>
 #include <cmath>
@@ -1012,11 +1013,12 @@ std::string Propagate::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Propagate::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < PropagateCommandParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+               PropagateCommandParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return PropagationEnabledCommand::GetParameterID(str);
 }
@@ -3756,6 +3758,9 @@ bool Propagate::Initialize()
       commandSummary += " Command\nSummary not available in single step mode\n";
    }
 
+   // Size the trigger list up front so that stopping does not allocate
+   triggers.reserve(stopWhen.size());
+
    #ifdef DUMP_PLANET_DATA
       if (body[0] == NULL)
          body[0] = solarSys->GetBody("Earth");
@@ -4453,6 +4458,8 @@ void Propagate::PrepareStoppingConditions()
             }
          }
       }
+
+      GroupStopParameters();
    }
    catch (BaseException &ex)
    {
@@ -4466,6 +4473,46 @@ void Propagate::PrepareStoppingConditions()
    }
 }
 
+
+//------------------------------------------------------------------------------
+// void GroupStopParameters()
+//------------------------------------------------------------------------------
+/**
+ * Collects the distinct stop parameters used by the stopping conditions.
+ *
+ * Stopping conditions on the same parameter, like Sat.TA = 90 and Sat.TA = 270,
+ * share one Parameter object.  CheckStopConditions evaluates each distinct
+ * parameter once per step and passes the value to every condition using it.
+ * Conditions without a stop parameter yet are left to evaluate themselves.
+ */
+//------------------------------------------------------------------------------
+void Propagate::GroupStopParameters()
+{
+   stopParams.clear();
+   stopParamIndex.assign(stopWhen.size(), -1);
+
+   for (UnsignedInt i = 0; i < stopWhen.size(); ++i)
+   {
+      Parameter *param = stopWhen[i]->GetStopParameter();
+      if (param == NULL)
+         continue;
+
+      UnsignedInt j = 0;
+      while ((j < stopParams.size()) && (stopParams[j] != param))
+         ++j;
+      if (j == stopParams.size())
+         stopParams.push_back(param);
+      stopParamIndex[i] = j;
+   }
+
+   stopParamValues.resize(stopParams.size());
+
+   #ifdef DEBUG_STOPPING_CONDITIONS
+      MessageInterface::ShowMessage("%d stopping conditions use %d distinct "
+            "stop parameters\n", stopWhen.size(), stopParams.size());
+   #endif
+}
+
 //------------------------------------------------------------------------------
 // bool Execute()
 //------------------------------------------------------------------------------
@@ -4942,6 +4989,9 @@ bool Propagate::TakeAStep(Real propStep)
    bool retval = false;
    Real stepToTake;
 
+   // Label the step with the first propagator, which sets its size
+   ProfileScope profile("Step", p[0]);
+
    #ifdef DEBUG_FIXED_STEP
       std::vector<ODEModel *>::iterator fmod = fm.begin();
    #endif
@@ -5158,6 +5208,12 @@ void Propagate::CheckStopConditions(Integer epochID)
       try {
    #endif
 
+      // Evaluate each distinct stop parameter once for this step
+      if (stopParamIndex.size() != stopWhen.size())
+         GroupStopParameters();
+      for (UnsignedInt j = 0; j < stopParams.size(); ++j)
+         stopParamValues[j] = stopParams[j]->EvaluateReal();
+
       for (UnsignedInt i = 0; i < stopWhen.size(); i++)
       {
          // StopCondition need epoch for the Interpolator
@@ -5169,7 +5225,10 @@ void Propagate::CheckStopConditions(Integer epochID)
                   "condition\n", stopWhen[i]->GetName().c_str());
          #endif
 
-         if (stopWhen[i]->Evaluate())
+         bool goalMet = (stopParamIndex[i] >= 0 ?
+               stopWhen[i]->Evaluate(stopParamValues[stopParamIndex[i]]) :
+               stopWhen[i]->Evaluate());
+         if (goalMet)
          {
             #ifdef DEBUG_STOPPING_CONDITIONS
                MessageInterface::ShowMessage("\"%s\" evaluates true!\n",
@@ -5842,6 +5901,31 @@ Real Propagate::InterpolateToStop(StopCondition *sc)
    #endif
    // Now fill in the ring buffer
    Real ringStep = stopInterval / 4.0;
+
+   // Interpolate across the step that crossed the stop when the propagators
+   // provide dense output, rather than integrating the step again
+   if (SampleStepFromDenseOutput(sc, ringStep))
+   {
+      stopEpoch = sc->GetStopEpoch();
+
+      // Restore the spacecraft and force models; no time was stepped
+      BufferSatelliteStates(false);
+      for (UnsignedInt i = 0; i < fm.size(); ++i)
+      {
+         if (fm[i])
+            fm[i]->UpdateFromSpaceObject();
+         else
+            p[i]->UpdateFromSpaceObject();
+      }
+
+      #ifdef DEBUG_STOPPING_CONDITIONS
+         MessageInterface::ShowMessage("   Dense output stop epoch = %.12lf\n",
+               stopEpoch);
+      #endif
+
+      return stopEpoch;
+   }
+
    Integer ringStepsTaken = 0;
    bool firstRingStep = true;
    bool stopIsBracketed = false;
@@ -5941,6 +6025,87 @@ Real Propagate::InterpolateToStop(StopCondition *sc)
 }
 
 
+//------------------------------------------------------------------------------
+// bool SampleStepFromDenseOutput(StopCondition *sc, Real ringStep)
+//------------------------------------------------------------------------------
+/**
+ * Fills the stopping condition ring buffer by interpolating across the step
+ * that crossed the stopping condition.
+ *
+ * The sample points match the ones InterpolateToStop() integrates to, but the
+ * states come from the propagators' dense output, so no propagation steps are
+ * taken.  The stop epoch found here is only the starting guess; the secant
+ * refinement that follows still integrates to the stop.
+ *
+ * @param <sc>       The stopping condition that is used for the interpolation.
+ * @param <ringStep> The spacing of the samples
+ *
+ * @return true if the ring buffer brackets the stop, false if dense output is
+ *         not available or the stop was not bracketed; in that case the
+ *         spacecraft and force models are restored to the start of the step.
+ */
+//------------------------------------------------------------------------------
+bool Propagate::SampleStepFromDenseOutput(StopCondition *sc, Real ringStep)
+{
+   for (UnsignedInt i = 0; i < p.size(); ++i)
+   {
+      if ((fm[i] == NULL) || !p[i]->HasDenseOutput(stopInterval))
+         return false;
+   }
+
+   bool firstRingStep = true;
+   bool stopIsBracketed = false;
+   bool interpolated = true;
+
+   for (Integer ringStepsTaken = 1; (ringStepsTaken <= 4) &&
+        !stopIsBracketed && interpolated; ++ringStepsTaken)
+   {
+      Real elapsedSeconds = ringStepsTaken * ringStep;
+
+      for (UnsignedInt i = 0; i < fm.size(); ++i)
+      {
+         if (!p[i]->GetDenseState(elapsedSeconds, fm[i]->GetState()))
+         {
+            interpolated = false;
+            break;
+         }
+
+         if (fm[i]->HasPrecisionTime())
+         {
+            GmatTime gt = baseEpochGT[i];
+            gt.AddSeconds(fm[i]->GetTime() + elapsedSeconds);
+            fm[i]->UpdateSpaceObjectGT(gt);
+         }
+         else
+            fm[i]->UpdateSpaceObject(baseEpoch[i] + (fm[i]->GetTime() +
+                  elapsedSeconds) / GmatTimeConstants::SECS_PER_DAY);
+      }
+
+      if (interpolated)
+      {
+         sc->SetRealParameter(stopCondEpochID, elapsedSeconds);
+         stopIsBracketed = sc->AddToBuffer(firstRingStep);
+         firstRingStep = false;
+
+         #ifdef DEBUG_STOPPING_CONDITIONS
+            MessageInterface::ShowMessage("   dense step = %.12lf, value = "
+                  "%.12lf\n", elapsedSeconds, sc->GetStopValue());
+         #endif
+      }
+   }
+
+   if (!stopIsBracketed || !interpolated)
+   {
+      BufferSatelliteStates(false);
+      for (UnsignedInt i = 0; i < fm.size(); ++i)
+         fm[i]->UpdateFromSpaceObject();
+      return false;
+   }
+
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // Real RefineFinalStep(Real secsToStep, StopCondition *stopper)
 //------------------------------------------------------------------------------
@@ -221,6 +221,12 @@ protected:
    
    /// The spacecraft used by the stopping conditions
    std::vector<SpaceObject *>   stopSats;
+   /// Distinct stop parameters, each evaluated once per step
+   std::vector<Parameter *>     stopParams;
+   /// Values of the distinct stop parameters on the current step
+   RealArray                    stopParamValues;
+   /// Index into stopParams for each stopping condition
+   std::vector<Integer>         stopParamIndex;
    /// The object array used in GetRefObjectArray()
    ObjectArray                  objectArray;
    
@@ -350,6 +356,7 @@ protected:
                               const StringArray *extras = NULL);
    virtual void            PrepareToPropagate();
    virtual void            PrepareStoppingConditions();
+   void                    GroupStopParameters();
    virtual void            CheckStopConditions(Integer EpochID);
    virtual void            TakeFinalStep(Integer EpochID, Integer trigger);
    
@@ -366,6 +373,8 @@ protected:
    bool                    CheckFirstStepStop(Integer i);
    
    Real                    InterpolateToStop(StopCondition *sc);
+   bool                    SampleStepFromDenseOutput(StopCondition *sc,
+                                                     Real ringStep);
    Real                    RefineFinalStep(Real secsToStep, 
                                            StopCondition *stopper);
    Real                    BisectFinalStep(StopCondition *stopper);
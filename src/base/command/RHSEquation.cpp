@@ -670,7 +670,7 @@ ElementWrapper* RHSEquation::RunMathTree(ElementWrapper *lhsWrapper)
             #endif
 
             Real rval = -9999.9999;
-            rval = topNode->Evaluate();
+            rval = mathTree->Evaluate();
 
             #ifdef DEBUG_RUN_MATH_TREE
             MessageInterface::ShowMessage("   Returned %f (%s)\n",
@@ -170,11 +170,12 @@ Report& Report::operator=(const Report &rep)
 //------------------------------------------------------------------------------
 Integer Report::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < ReportParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+               ReportParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatCommand::GetParameterID(str);
 }
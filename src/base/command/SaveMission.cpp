@@ -263,11 +263,12 @@ std::string SaveMission::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SaveMission::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatCommandParamCount; i<SaveMissionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+               SaveMissionParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatCommand::GetParameterID(str);
 }
@@ -262,42 +262,7 @@ void SolverBranchCommand::StoreLoopData()
       
       // Save copies of all of the spacecraft
       if (obj->GetType() == Gmat::SPACECRAFT)
-      {
-         Spacecraft *orig = (Spacecraft*)(obj);
-         Spacecraft *sc = NULL;
-
-         // Only add if not already buffered
-         Integer bufferLoc = -1;
-         for (UnsignedInt i = 0; i < localStore.size(); ++i)
-            if (localStore[i]->GetName() == orig->GetName())
-               bufferLoc = i;
-
-         if (bufferLoc == -1)
-         {
-            sc = (Spacecraft*)orig->Clone();
-            #ifdef DEBUG_MEMORY
-            MemoryTracker::Instance()->Add
-               ((GmatBase*)sc, "cloned local sc", "SolverBranchCommand::StoreLoopData()",
-                "Spacecraft *sc = new Spacecraft(*orig)");
-            #endif
-            // Handle CoordinateSystems
-            if (orig->GetInternalCoordSystem() == NULL)
-               MessageInterface::ShowMessage(
-                  "Internal CS is NULL on spacecraft %s prior to optimizer cloning\n",
-                  orig->GetName().c_str());
-            if (orig->GetRefObject(Gmat::COORDINATE_SYSTEM, "") == NULL)
-               MessageInterface::ShowMessage(
-                  "Coordinate system is NULL on spacecraft %s prior to optimizer cloning\n",
-                  orig->GetName().c_str());
-            sc->SetInternalCoordSystem(orig->GetInternalCoordSystem());
-            sc->SetRefObject(orig->GetRefObject(Gmat::COORDINATE_SYSTEM, ""),
-               Gmat::COORDINATE_SYSTEM, "");
-            localStore.push_back(sc);
-         }
-         else
-            // Call assignment operator
-            (*localStore[bufferLoc]) = (*obj);
-      }
+         StoreSpacecraft((Spacecraft*)(obj));
       if (obj->GetType() == Gmat::FORMATION)
       {
          FormationInterface *orig = (FormationInterface*)(obj);
@@ -321,30 +286,7 @@ void SolverBranchCommand::StoreLoopData()
       obj = (*globalPair).second;
       // Save copies of all of the spacecraft
       if (obj->GetType() == Gmat::SPACECRAFT)
-      {
-         Spacecraft *orig = (Spacecraft*)(obj);
-         Spacecraft *sc = new Spacecraft(*orig);
-         #ifdef DEBUG_MEMORY
-         MemoryTracker::Instance()->Add
-            ((GmatBase*)sc, "cloned local sc",
-             "SolverBranchCommand::StoreLoopData()",
-             "Spacecraft *sc = new Spacecraft(*orig)");
-         #endif
-         // Handle CoordinateSystems
-         if (orig->GetInternalCoordSystem() == NULL)
-            MessageInterface::ShowMessage(
-               "Internal CS is NULL on spacecraft %s prior to optimizer cloning\n",
-               orig->GetName().c_str());
-         if (orig->GetRefObject(Gmat::COORDINATE_SYSTEM, "") == NULL)
-            MessageInterface::ShowMessage(
-               "Coordinate system is NULL on spacecraft %s prior to optimizer cloning\n",
-               orig->GetName().c_str());
-         sc->SetInternalCoordSystem(orig->GetInternalCoordSystem());
-         sc->SetRefObject(orig->GetRefObject(Gmat::COORDINATE_SYSTEM, ""),
-            Gmat::COORDINATE_SYSTEM, "");
-         
-         localStore.push_back(sc);
-      }
+         StoreSpacecraft((Spacecraft*)(obj));
       if (obj->GetType() == Gmat::FORMATION)
       {
          FormationInterface *orig = (FormationInterface*)(obj);
@@ -362,6 +304,60 @@ void SolverBranchCommand::StoreLoopData()
 }
 
 
+//------------------------------------------------------------------------------
+// void StoreSpacecraft(Spacecraft *orig)
+//------------------------------------------------------------------------------
+/**
+ * Saves the starting point of a spacecraft for the solver loop
+ *
+ * The spacecraft is cloned the first time it is stored, and the clone is
+ * refreshed only when the hardware layout or force model settings changed.
+ * The runtime data (epoch, state, STMs, masses) is saved each time, and is
+ * restored in place by ResetLoopData().
+ *
+ * @param orig The spacecraft
+ */
+//------------------------------------------------------------------------------
+void SolverBranchCommand::StoreSpacecraft(Spacecraft *orig)
+{
+   // Only add if not already buffered
+   Integer bufferLoc = -1;
+   for (UnsignedInt i = 0; i < localStore.size(); ++i)
+      if (localStore[i]->GetName() == orig->GetName())
+         bufferLoc = i;
+
+   Spacecraft::LoopState &saved = loopStates[orig->GetName()];
+
+   if (bufferLoc == -1)
+   {
+      Spacecraft *sc = (Spacecraft*)orig->Clone();
+      #ifdef DEBUG_MEMORY
+      MemoryTracker::Instance()->Add
+         ((GmatBase*)sc, "cloned local sc", "SolverBranchCommand::StoreLoopData()",
+          "Spacecraft *sc = new Spacecraft(*orig)");
+      #endif
+      // Handle CoordinateSystems
+      if (orig->GetInternalCoordSystem() == NULL)
+         MessageInterface::ShowMessage(
+            "Internal CS is NULL on spacecraft %s prior to optimizer cloning\n",
+            orig->GetName().c_str());
+      if (orig->GetRefObject(Gmat::COORDINATE_SYSTEM, "") == NULL)
+         MessageInterface::ShowMessage(
+            "Coordinate system is NULL on spacecraft %s prior to optimizer cloning\n",
+            orig->GetName().c_str());
+      sc->SetInternalCoordSystem(orig->GetInternalCoordSystem());
+      sc->SetRefObject(orig->GetRefObject(Gmat::COORDINATE_SYSTEM, ""),
+         Gmat::COORDINATE_SYSTEM, "");
+      localStore.push_back(sc);
+   }
+   else if (!orig->MatchesLoopState(saved))
+      // Call assignment operator
+      (*localStore[bufferLoc]) = (*orig);
+
+   orig->SaveLoopState(saved);
+}
+
+
 //------------------------------------------------------------------------------
 // void ResetLoopData()
 //------------------------------------------------------------------------------
@@ -387,7 +383,18 @@ void SolverBranchCommand::ResetLoopData()
          if (gb->GetType() == Gmat::SPACECRAFT)
          {
             sc = (Spacecraft*)gb;
-            *sc = *((Spacecraft*)(*i));
+
+            // Copy the whole spacecraft only when its layout changed
+            std::map<std::string, Spacecraft::LoopState>::iterator saved =
+                  loopStates.find(name);
+            if (saved == loopStates.end())
+               *sc = *((Spacecraft*)(*i));
+            else
+            {
+               if (!sc->MatchesLoopState(saved->second))
+                  *sc = *((Spacecraft*)(*i));
+               sc->RestoreLoopState(saved->second);
+            }
          }
          else if (gb->GetType() == Gmat::FORMATION)
          {
@@ -440,6 +447,7 @@ void SolverBranchCommand::FreeLoopData()
       delete obj;
    }
    localStore.clear();
+   loopStates.clear();
 }
 
 
@@ -37,6 +37,7 @@
 #include "BranchCommand.hpp"
 #include "Solver.hpp"
 #include "ISolverListener.hpp"
+#include "Spacecraft.hpp"
 
 class Subscriber;
 
@@ -138,6 +139,9 @@ protected:
 
    /// Local store of the objects that we'll need to reset
    ObjectArray         localStore;
+   /// Spacecraft runtime data restored in place when the layout is unchanged
+   std::map<std::string, Spacecraft::LoopState>
+                       loopStates;
 
    /// Active subscribers (only XY plots for now) so the penups can be managed
    std::vector<Subscriber*> activeSubscribers;
@@ -151,6 +155,7 @@ protected:
    virtual void        StoreLoopData();
    virtual void        ResetLoopData();
    virtual void        FreeLoopData();
+   void                StoreSpacecraft(Spacecraft *orig);
    
    virtual void        ApplySolution();
    
@@ -181,12 +181,12 @@ std::string SolverSequenceCommand::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SolverSequenceCommand::GetParameterID(const std::string& str) const
 {
-   for (Integer i = GmatCommandParamCount;
-         i < SolverSequenceCommandParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+               SolverSequenceCommandParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatCommand::GetParameterID(str);
 }
@@ -32,6 +32,7 @@
  
 #include "Target.hpp"
 #include "MessageInterface.hpp"
+#include "Profiler.hpp"
 
 //#define DEBUG_TARGETER_PARSING
 //#define DEBUG_TARGETER
@@ -867,7 +868,10 @@ bool Target::Execute()
    
    if (!branchExecuting)
    {
-      theSolver->AdvanceState();
+      {
+         ProfileScope profile("Solver", theSolver);
+         theSolver->AdvanceState();
+      }
       theSolver->ReportProgress(listeners, Solver::UNDEFINED_STATE);
 
       if (theSolver->GetState() == Solver::FINISHED)
@@ -255,11 +255,12 @@ const StringArray& UpdateDynamicData::GetRefObjectNameArray(const UnsignedInt ty
 //------------------------------------------------------------------------------
 Integer UpdateDynamicData::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < UpdateDynamicDataParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount,
+               UpdateDynamicDataParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatCommand::GetParameterID(str);
 }
@@ -540,3 +541,18 @@ bool UpdateDynamicData::Execute()
 {
    return dynamicData->UpdateData(dataToUpdate);
 }
+
+//------------------------------------------------------------------------------
+// void RunComplete()
+//------------------------------------------------------------------------------
+/**
+* Sends any values held back by the display update rate to the display
+*/
+//------------------------------------------------------------------------------
+void UpdateDynamicData::RunComplete()
+{
+   if (dynamicData != NULL)
+      dynamicData->FlushUpdates();
+
+   GmatCommand::RunComplete();
+}
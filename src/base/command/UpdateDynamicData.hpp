@@ -72,6 +72,7 @@ public:
    virtual bool InterpretAction();
    virtual bool Initialize();
    virtual bool Execute();
+   virtual void RunComplete();
 
    DEFAULT_TO_NO_CLONES
 
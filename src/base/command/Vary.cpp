@@ -34,6 +34,7 @@
 #include "ParameterException.hpp"
 #include "DifferentialCorrector.hpp"
 #include "Parameter.hpp"
+#include "CoordinateSystem.hpp"
 #include "StringUtil.hpp"  // for Replace()
 #include "MessageInterface.hpp"
 #include "TextParser.hpp"
@@ -546,11 +547,12 @@ std::string Vary::GetParameterText(const Integer id) const
 //---------------------------------------------------------------------------
 Integer Vary::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverSequenceCommandParamCount; i < VaryParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - SolverSequenceCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SolverSequenceCommandParamCount,
+               VaryParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return SolverSequenceCommand::GetParameterID(str);
 }
@@ -1438,6 +1440,10 @@ bool Vary::Execute()
             "this time in line:\n" + GetGeneratingString(Gmat::NO_COMMENTS));
    }
    solver->SetUnscaledVariable(variableID, var);
+
+   if (solver->UsesStateTransitionDerivatives() &&
+       (solver->GetState() == Solver::NOMINAL))
+      SetStateSensitivity();
    
    BuildCommandSummary(true);
    #ifdef DEBUG_VARY_EXECUTE
@@ -1651,3 +1657,107 @@ void Vary::RefreshData()
 
    solver->RefreshSolverVariables(varData, variableName);
 }
+
+
+//------------------------------------------------------------------------------
+// void SetStateSensitivity()
+//------------------------------------------------------------------------------
+/**
+ * Passes the spacecraft state element set by the variable to the solver.
+ *
+ * Solvers that build their Jacobians from state transition matrices need to
+ * know which element of which spacecraft state the variable sets.  Cartesian
+ * state elements of spacecraft whose coordinate system has MJ2000Eq axes and
+ * the components of impulsive burns are supported; for burns, the maneuvered
+ * spacecraft is taken from the first Maneuver command following this one in
+ * the solver loop.  The STM of the spacecraft is reset to identity here, so
+ * that the goals are differentiated from the epoch of the variable.  Other
+ * variables make the solver fall back to finite differences.
+ */
+//------------------------------------------------------------------------------
+void Vary::SetStateSensitivity()
+{
+   static const std::string stateElements[6] =
+      {"X", "Y", "Z", "VX", "VY", "VZ"};
+
+   Solver::StateSensitivity sensitivity;
+   sensitivity.owner      = NULL;
+   sensitivity.spacecraft = NULL;
+   sensitivity.element    = -1;
+   sensitivity.scale      = 1.0 / multiplicativeScaleFactor->EvaluateReal();
+   sensitivity.epoch      = 0.0;
+
+   StringArray parts = GmatStringUtil::SeparateDots(variableName);
+   std::string element = parts.back();
+   GmatBase *obj = variable->GetRefObject();
+
+   // Sat.X may be wrapped as a Parameter; Sat.CS.X is not supported
+   if ((obj != NULL) && obj->IsOfType("Parameter"))
+      obj = (parts.size() == 2 ? ((Parameter*)obj)->GetOwner() : NULL);
+
+   if ((obj != NULL) && obj->IsOfType(Gmat::SPACECRAFT))
+   {
+      for (Integer i = 0; i < 6; ++i)
+         if (element == stateElements[i])
+            sensitivity.element = i;
+
+      CoordinateSystem *cs = (CoordinateSystem*)
+            obj->GetRefObject(Gmat::COORDINATE_SYSTEM, "");
+      if ((cs == NULL) || !cs->AreAxesOfType("MJ2000EqAxes"))
+      {
+         solver->RejectStateTransitionDerivatives("the coordinate system of " +
+               obj->GetName() + " does not use MJ2000Eq axes");
+         return;
+      }
+      sensitivity.owner      = obj;
+      sensitivity.spacecraft = obj;
+   }
+   else if ((obj != NULL) && obj->IsOfType("ImpulsiveBurn"))
+   {
+      for (Integer i = 0; i < 3; ++i)
+         if (element == "Element" + GmatStringUtil::ToString(i + 1, 1))
+            sensitivity.element = i;
+
+      // Find the spacecraft that the burn maneuvers
+      for (GmatCommand *cmd = next; (cmd != NULL) &&
+            !cmd->IsOfType("BranchEnd"); cmd = cmd->GetNext())
+      {
+         if ((cmd->GetTypeName() == "Maneuver") &&
+             (cmd->GetStringParameter("Burn") == obj->GetName()))
+         {
+            // A burn applied to several spacecraft has no single owner state
+            if (cmd->GetRefObjectNameArray(Gmat::SPACECRAFT).size() > 1)
+            {
+               solver->RejectStateTransitionDerivatives("the Maneuver "
+                     "command applying " + obj->GetName() + " maneuvers "
+                     "more than one spacecraft");
+               return;
+            }
+            sensitivity.spacecraft =
+                  FindObject(cmd->GetStringParameter("Spacecraft"));
+            break;
+         }
+      }
+      if ((sensitivity.spacecraft == NULL) ||
+          !sensitivity.spacecraft->IsOfType(Gmat::SPACECRAFT))
+      {
+         solver->RejectStateTransitionDerivatives("no Maneuver command "
+               "applying " + obj->GetName() + " follows the Vary command "
+               "in the solver loop");
+         return;
+      }
+      sensitivity.owner = obj;
+   }
+
+   if (sensitivity.element < 0)
+   {
+      solver->RejectStateTransitionDerivatives("the variable " +
+            variableName + " is not a Cartesian spacecraft state element or "
+            "an impulsive burn component");
+      return;
+   }
+
+   sensitivity.spacecraft->TakeAction("ResetSTM");
+   sensitivity.epoch = sensitivity.spacecraft->GetRealParameter("A1Epoch");
+   solver->SetVariableSensitivity(variableID, sensitivity);
+}
@@ -206,6 +206,8 @@ protected:
    bool IsThereSameWrapperName(int param, const std::string &wrapperName);
    /// Method to refresh values of data from variables
    void RefreshData();
+   /// Method to pass the varied state element to solvers using STMs
+   void SetStateSensitivity();
 };
 
 
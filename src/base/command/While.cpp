@@ -427,11 +427,12 @@ std::string While::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer While::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ConditionalBranchParamCount; i < WhileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ConditionalBranchParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ConditionalBranchParamCount,
+               WhileParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return ConditionalBranch::GetParameterID(str);
 }
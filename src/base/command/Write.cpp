@@ -801,11 +801,11 @@ GmatBase* Write::Clone() const
 //------------------------------------------------------------------------------
 Integer Write::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < WriteParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatCommandParamCount, WriteParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatCommand::GetParameterID(str);
 }
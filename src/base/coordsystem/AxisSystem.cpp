@@ -44,6 +44,9 @@
 #include "MessageInterface.hpp"
 #include "CoordinateSystemException.hpp"
 #include "SolarSystem.hpp"
+#include "Planet.hpp"
+#include "EarthOrientationCache.hpp"
+#include "StringUtil.hpp"
 
 #include <iostream>
 
@@ -130,6 +133,7 @@ usesPrimary      (GmatCoordinate::NOT_USED),
 usesSecondary    (GmatCoordinate::NOT_USED),
 baseSystem       ("FK5"),
 eop              (NULL),
+eopIndexHint     (0),
 itrf             (NULL),
 epochFormat      ("A1ModJulian"),
 needsCBOrigin    (false),
@@ -138,6 +142,7 @@ updateInterval   (60.0),
 updateIntervalToUse    (60.0), 
 overrideOriginInterval (false),
 lastDPsi         (0.0),
+nutationSeriesKey(""),
 nutationSrc      (GmatItrf::NUTATION_1980),
 planetarySrc     (GmatItrf::PLANETARY_1980),
 aVals            (NULL), 
@@ -191,6 +196,7 @@ usesPrimary       (axisSys.usesPrimary),
 usesSecondary     (axisSys.usesSecondary),
 baseSystem        (axisSys.baseSystem),
 eop               (axisSys.eop),
+eopIndexHint      (axisSys.eopIndexHint),
 itrf              (axisSys.itrf),
 epochFormat       (axisSys.epochFormat),
 needsCBOrigin     (axisSys.needsCBOrigin),
@@ -199,6 +205,7 @@ updateInterval    (axisSys.updateInterval),
 updateIntervalToUse    (axisSys.updateIntervalToUse),
 overrideOriginInterval (axisSys.overrideOriginInterval),
 lastDPsi          (0.0),
+nutationSeriesKey (""),
 nutationSrc       (GmatItrf::NUTATION_1980),
 planetarySrc      (GmatItrf::PLANETARY_1980),
 aVals            (NULL), 
@@ -250,6 +257,7 @@ const AxisSystem& AxisSystem::operator=(const AxisSystem &axisSys)
    usesSecondary     = axisSys.usesSecondary;
    baseSystem        = axisSys.baseSystem;
    eop               = axisSys.eop;
+   eopIndexHint      = axisSys.eopIndexHint;
    itrf              = axisSys.itrf;
    epochFormat       = axisSys.epochFormat;
    needsCBOrigin     = axisSys.needsCBOrigin;
@@ -268,6 +276,7 @@ const AxisSystem& AxisSystem::operator=(const AxisSystem &axisSys)
    lastDPsi          = axisSys.lastDPsi;
    nutationSrc       = axisSys.nutationSrc;
    planetarySrc      = axisSys.planetarySrc;
+   nutationSeriesKey = "";
    
    aVals             = NULL; 
    apVals            = NULL;
@@ -1804,11 +1813,12 @@ std::string AxisSystem::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer AxisSystem::GetParameterID(const std::string &str) const
 {
-   for (Integer i = CoordinateBaseParamCount; i < AxisSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CoordinateBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, CoordinateBaseParamCount,
+               AxisSystemParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return CoordinateBase::GetParameterID(str);
 }
@@ -2090,6 +2100,10 @@ void AxisSystem::InitializeFK5()
 
    nutationSrc    = itrf->GetNutationTermsSource();
    planetarySrc   = itrf->GetPlanetaryTermsSource();
+   // Axis systems reading the same coefficients share the cached nutation
+   nutationSeriesKey = itrf->GetNutationFileName() + "|" +
+         itrf->GetPlanetaryFileName() + "|" +
+         GmatStringUtil::ToString((Integer)nutationSrc);
    Integer numNut = itrf->GetNumberOfNutationTerms();
    A.SetSize(numNut);   A.MakeZeroVector();
    #ifdef DEBUG_ITRF_UPDATES
@@ -2267,42 +2281,41 @@ void AxisSystem::ComputePrecessionMatrix(const Real tTDB, A1Mjd atEpoch)
 }
 
 //------------------------------------------------------------------------------
-//  void ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
-//                             Real &dPsi,
-//                             Real &longAscNodeLunar,
-//                             Real &cosEpsbar,
-//                             bool forceComputation)
+//  bool UseOrientationCache() const
 //------------------------------------------------------------------------------
 /**
- * This method will compute the Nutation rotation matrix.
+ * This method determines if the Earth orientation terms are interpolated from
+ * the EarthOrientationCache, as selected by the UseOrientationCache field of
+ * the Earth.
  *
- * @param tTDB              TDB time
- * @param forEpoch          epoch at which to compute the rotation matrix
- * @param longAscNodeLunar  lunar longitude of the ascending node
- * @param cosEpsbar         computed quantity
- * @param forceComputation  force matrix computation?
+ * @return true if the cache is used
+ */
+//------------------------------------------------------------------------------
+bool AxisSystem::UseOrientationCache() const
+{
+   CelestialBody *earth = NULL;
+   if (originName == GmatSolarSystemDefaults::EARTH_NAME)
+      earth = (CelestialBody*) origin;
+   else if (solar != NULL)
+      earth = solar->GetBody(GmatSolarSystemDefaults::EARTH_NAME);
+   return (earth != NULL) && ((Planet*) earth)->GetUseOrientationCache();
+}
+
+//------------------------------------------------------------------------------
+//  void ComputeFundamentalArguments(const Real tTDB, Real *args)
+//------------------------------------------------------------------------------
+/**
+ * This method computes the fundamental arguments of the nutation theory.
  *
+ * @param tTDB  TDB time
+ * @param args  the mean anomalies of the Moon and the Sun, the argument of
+ *              latitude of the Moon, the mean elongation of the Moon from the
+ *              Sun, and the longitude of the ascending node of the Moon
+ *              (radians)
  */
 //------------------------------------------------------------------------------
-void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
-                                            Real &dPsi,
-                                            Real &longAscNodeLunar,
-                                            Real &cosEpsbar,
-                                            bool forceComputation)
+void AxisSystem::ComputeFundamentalArguments(const Real tTDB, Real *args)
 {
-   #ifdef DEBUG_FIRST_CALL
-      if (!firstCallFired)
-      {
-         MessageInterface::ShowMessage("firstCallFired set to TRUE!!!!\n");
-         MessageInterface::ShowMessage(
-            "   AxisSystem::ComputeNutationMatrix(%.12lf, %.12lf, %.12lf, "
-            "%.12lf, %.12lf)\n", tTDB, atEpoch.Get(), dPsi, longAscNodeLunar, 
-            cosEpsbar);
-      }
-      else
-         MessageInterface::ShowMessage("firstCallFired set to TRUE!!!!\n");
-   #endif
-   
    // Updated coefficients for GMT-4295.  Vallado's text is incorrect 
    // and updated based on Supplement to the Astronomical Almanac. - TDN 
    Real const125, const134, const357, const93, const297;
@@ -2340,12 +2353,6 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
    Real tTDB2   = tTDB  * tTDB;
    Real tTDB3   = tTDB2 * tTDB;
    Real tTDB4   = tTDB3 * tTDB;
-   // Compute nutation - NOTE: this algorithm is based on the IERS 1996
-   // Theory of Precession and Nutation. This can also be used with the 
-   // 1980 Theory - the E and F terms are zero, and will fall out on the 
-   // floor, roll around and under the door, down the stairs and into
-   // the neighbor's yard.  It can also be used, but is not tested, 
-   // with the 2000 Theory.
    #ifdef DEBUG_UPDATE
       if (nutationSrc == GmatItrf::NUTATION_1980)
          MessageInterface::ShowMessage("NUTATION_1980\n");
@@ -2361,7 +2368,7 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
       MessageInterface::ShowMessage("  tTDB4 = %.15lf\n", tTDB4);
    #endif
 
-   // Compute values to be passed out first ... 
+   Real longAscNodeLunar = 0.0;
    // Updated coefficients for GMT-4295.  Vallado's text is incorrect 
    // and updated based on Supplement to the Astronomical Almanac. - TDN 
    if (nutationSrc == GmatItrf::NUTATION_1980)
@@ -2375,42 +2382,6 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
 
    longAscNodeLunar = longAscNodeLunar - ((int)(longAscNodeLunar/(2*GmatMathConstants::PI)))*2*GmatMathConstants::PI;	
    
-   Real Epsbar       = (84381.448 - 46.8150*tTDB - 0.00059*tTDB2 
-                        + 0.001813*tTDB3) * RAD_PER_ARCSEC;
-   cosEpsbar         = cos(Epsbar);
-   
-   // if not enough time has passed, just return the last value
-   Real dt = fabs(atEpoch.Subtract(lastNUTEpoch)) * SECS_PER_DAY;
-   #ifdef DEBUG_UPDATE
-      MessageInterface::ShowMessage("ENTERED ComputeNutation .....\n");
-      MessageInterface::ShowMessage("  longAscNodeLunar = %.15lf\n", longAscNodeLunar);
-      MessageInterface::ShowMessage("  Epsbar = %.15lf\n", Epsbar);
-      MessageInterface::ShowMessage("  cosEpsbar = %.15lf\n", cosEpsbar);
-   #endif
-   if (( dt < updateIntervalToUse) && (!forceComputation))
-   {
-      #ifdef DEBUG_UPDATE
-         MessageInterface::ShowMessage(">>> In ComputeNutationMatrix, using previously saved values ......\n");
-      #endif
-      dPsi = lastDPsi;
-
-      #ifdef DEBUG_FIRST_CALL
-         if (!firstCallFired)
-            MessageInterface::ShowMessage(
-               "   Using buffered nutation data: %.13lf = %.12f*(%.12lf - %.12lf)\n",
-               dt, SECS_PER_DAY, atEpoch.Get(), lastNUTEpoch.Get());
-      #endif
-      
-      return;
-   }
-
-   #ifdef DEBUG_UPDATE
-      MessageInterface::ShowMessage("----> Computing NEW NUT matrix at time %12.10f\n",
-         atEpoch.Get());
-   #endif
-   // otherwise, need to recompute all the nutation data
-   dPsi      = 0.0;
-   Real dEps = 0.0;
    // First, compute useful angles (Vallado Eq. 3-54)
    // NOTE - taken from Steve Queen's code - he has apparently converted
    // the values in degrees (from Vallado Eq. 3-54) to arcsec before
@@ -2443,7 +2414,180 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
    meanAnomalyMoon = meanAnomalyMoon - ((int)(meanAnomalyMoon/(2*GmatMathConstants::PI)))*2*GmatMathConstants::PI; 
    meanAnomalySun = meanAnomalySun - ((int)(meanAnomalySun/(2*GmatMathConstants::PI)))*2*GmatMathConstants::PI; 
    argLatitudeMoon = argLatitudeMoon - ((int)(argLatitudeMoon/(2*GmatMathConstants::PI)))*2*GmatMathConstants::PI; 
-   meanElongationSun = meanElongationSun - ((int)(meanElongationSun/(2*GmatMathConstants::PI)))*2*GmatMathConstants::PI; 
+   meanElongationSun = meanElongationSun - ((int)(meanElongationSun/(2*GmatMathConstants::PI)))*2*GmatMathConstants::PI;
+
+   args[0] = meanAnomalyMoon;
+   args[1] = meanAnomalySun;
+   args[2] = argLatitudeMoon;
+   args[3] = meanElongationSun;
+   args[4] = longAscNodeLunar;
+}
+
+//------------------------------------------------------------------------------
+//  void ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
+//                             Real &dPsi,
+//                             Real &longAscNodeLunar,
+//                             Real &cosEpsbar,
+//                             bool forceComputation)
+//------------------------------------------------------------------------------
+/**
+ * This method will compute the Nutation rotation matrix.
+ *
+ * @param tTDB              TDB time
+ * @param forEpoch          epoch at which to compute the rotation matrix
+ * @param longAscNodeLunar  lunar longitude of the ascending node
+ * @param cosEpsbar         computed quantity
+ * @param forceComputation  force matrix computation?
+ *
+ */
+//------------------------------------------------------------------------------
+void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
+                                            Real &dPsi,
+                                            Real &longAscNodeLunar,
+                                            Real &cosEpsbar,
+                                            bool forceComputation)
+{
+   #ifdef DEBUG_FIRST_CALL
+      if (!firstCallFired)
+      {
+         MessageInterface::ShowMessage("firstCallFired set to TRUE!!!!\n");
+         MessageInterface::ShowMessage(
+            "   AxisSystem::ComputeNutationMatrix(%.12lf, %.12lf, %.12lf, "
+            "%.12lf, %.12lf)\n", tTDB, atEpoch.Get(), dPsi, longAscNodeLunar, 
+            cosEpsbar);
+      }
+      else
+         MessageInterface::ShowMessage("firstCallFired set to TRUE!!!!\n");
+   #endif
+   
+   Real args[5];
+   ComputeFundamentalArguments(tTDB, args);
+   longAscNodeLunar = args[4];
+
+   Real tTDB2   = tTDB  * tTDB;
+   Real tTDB3   = tTDB2 * tTDB;
+   Real Epsbar       = (84381.448 - 46.8150*tTDB - 0.00059*tTDB2 
+                        + 0.001813*tTDB3) * RAD_PER_ARCSEC;
+   cosEpsbar         = cos(Epsbar);
+   
+   #ifdef DEBUG_UPDATE
+      MessageInterface::ShowMessage("ENTERED ComputeNutation .....\n");
+      MessageInterface::ShowMessage("  longAscNodeLunar = %.15lf\n", longAscNodeLunar);
+      MessageInterface::ShowMessage("  Epsbar = %.15lf\n", Epsbar);
+      MessageInterface::ShowMessage("  cosEpsbar = %.15lf\n", cosEpsbar);
+   #endif
+
+   bool useCache = (nutationSeriesKey != "") && UseOrientationCache();
+   if (!useCache)
+   {
+      // if not enough time has passed, just return the last value
+      Real dt = fabs(atEpoch.Subtract(lastNUTEpoch)) * SECS_PER_DAY;
+      if (( dt < updateIntervalToUse) && (!forceComputation))
+      {
+         #ifdef DEBUG_UPDATE
+            MessageInterface::ShowMessage(">>> In ComputeNutationMatrix, using previously saved values ......\n");
+         #endif
+         dPsi = lastDPsi;
+
+         #ifdef DEBUG_FIRST_CALL
+            if (!firstCallFired)
+               MessageInterface::ShowMessage(
+                  "   Using buffered nutation data: %.13lf = %.12f*(%.12lf - %.12lf)\n",
+                  dt, SECS_PER_DAY, atEpoch.Get(), lastNUTEpoch.Get());
+         #endif
+
+         return;
+      }
+   }
+
+   // When the Earth's UseOrientationCache is set, the nutation angles are
+   // interpolated from the shared cache unless the update interval is zero or
+   // the computation is forced; see EarthOrientationCache for the accuracy of
+   // the interpolation
+   dPsi      = 0.0;
+   Real dEps = 0.0;
+   if (!useCache || (updateIntervalToUse <= 0.0) || forceComputation ||
+       (!EarthOrientationCache::Instance()->GetNutationAngles(this,
+             nutationSeriesKey, tTDB, dPsi, dEps)))
+   {
+      #ifdef DEBUG_UPDATE
+         MessageInterface::ShowMessage("----> Computing NEW NUT matrix at time %12.10f\n",
+            atEpoch.Get());
+      #endif
+      EvaluateNutationSeries(tTDB, dPsi, dEps);
+   }
+    
+   // Compute obliquity of the ecliptic (Vallado Eq. 3-52 & Eq. 3-63)
+   Real TrueOoE = Epsbar + dEps;
+   
+   // Compute useful trigonometric quantities
+   Real cosdPsi   = cos(dPsi);
+   Real cosTEoE   = cos(TrueOoE);
+   Real sindPsi   = sin(dPsi);
+   Real sinEpsbar = sin(Epsbar);
+   Real sinTEoE   = sin(TrueOoE);   
+   
+   // Compute Rotation matrix for transformations from MOD to TOD
+   // (Vallado Eq. 3-64)
+   NUT.Set( cosdPsi,
+           -sindPsi*cosEpsbar,
+           -sindPsi*sinEpsbar,
+            sindPsi*cosTEoE, 
+            cosTEoE*cosdPsi*cosEpsbar + sinTEoE*sinEpsbar,
+            sinEpsbar*cosTEoE*cosdPsi - sinTEoE*cosEpsbar,
+            sinTEoE*sindPsi,
+            sinTEoE*cosdPsi*cosEpsbar - sinEpsbar*cosTEoE,
+            sinTEoE*sinEpsbar*cosdPsi + cosTEoE*cosEpsbar);
+   
+   lastNUTEpoch = atEpoch;
+   lastNUT      = NUT;
+   lastDPsi     = dPsi; 
+   
+   #ifdef DEBUG_ROT_MATRIX
+      MessageInterface::ShowMessage("At end of ComputeNutationmatrix ...\n");
+      MessageInterface::ShowMessage("   atEpoch   = %.15lf\n", atEpoch.Get());
+      MessageInterface::ShowMessage("   longAscNodeLunar   = %.15lf\n", longAscNodeLunar);
+      MessageInterface::ShowMessage("   cosEpsbar   = %.15lf\n", cosEpsbar);
+      MessageInterface::ShowMessage("   dPsi   = %.15lf\n", dPsi);
+	  MessageInterface::ShowMessage("   dEps   = %.15lf\n", dEps);
+	  MessageInterface::ShowMessage("   TrueOoE   = %.15lf\n", TrueOoE);
+   #endif
+//   return NUT;
+}
+
+
+//------------------------------------------------------------------------------
+//  void EvaluateNutationSeries(const Real tTDB, Real &dPsi, Real &dEps)
+//------------------------------------------------------------------------------
+/**
+ * This method sums the nutation series, with the planetary terms for the 1996
+ * theory.
+ *
+ * @param tTDB  TDB time
+ * @param dPsi  nutation in longitude (radians)
+ * @param dEps  nutation in obliquity (radians)
+ */
+//------------------------------------------------------------------------------
+void AxisSystem::EvaluateNutationSeries(const Real tTDB, Real &dPsi, Real &dEps)
+{
+   Real args[5];
+   ComputeFundamentalArguments(tTDB, args);
+   Real meanAnomalyMoon   = args[0];
+   Real meanAnomalySun    = args[1];
+   Real argLatitudeMoon   = args[2];
+   Real meanElongationSun = args[3];
+   Real longAscNodeLunar  = args[4];
+   Real tTDB2             = tTDB * tTDB;
+
+   dPsi = 0.0;
+   dEps = 0.0;
+
+   // Compute nutation - NOTE: this algorithm is based on the IERS 1996
+   // Theory of Precession and Nutation. This can also be used with the 
+   // 1980 Theory - the E and F terms are zero, and will fall out on the 
+   // floor, roll around and under the door, down the stairs and into
+   // the neighbor's yard.  It can also be used, but is not tested, 
+   // with the 2000 Theory.
 
    // Now, sum using nutation coefficients  (Vallado Eq. 3-60)
    Integer i  = 0;
@@ -2466,14 +2610,10 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
             "      argLatitudeMoon   = %.13lf\n"
             "      meanElongationSun = %.13lf\n"
             "      longAscNodeLunar  = %.13lf\n"
-            "      cosEpsbar         = %.13lf\n"
             "      tTDB              = %.13le\n"
-            "      tTDB2             = %.13le\n"
-            "      tTDB3             = %.13le\n"
-            "      tTDB4             = %.13le\n",
+            "      tTDB2             = %.13le\n",
             nut, meanAnomalyMoon, meanAnomalySun, argLatitudeMoon,
-            meanElongationSun, longAscNodeLunar, cosEpsbar, tTDB, tTDB2, tTDB3,
-            tTDB4);
+            meanElongationSun, longAscNodeLunar, tTDB, tTDB2);
 
       if (!firstCallFired) 
       {
@@ -2692,43 +2832,6 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
             "      dEps(1)           = %.13lf\n",
             dPsi, dEps);
    #endif
-    
-   // Compute obliquity of the ecliptic (Vallado Eq. 3-52 & Eq. 3-63)
-   Real TrueOoE = Epsbar + dEps;
-   
-   // Compute useful trigonometric quantities
-   Real cosdPsi   = cos(dPsi);
-   Real cosTEoE   = cos(TrueOoE);
-   Real sindPsi   = sin(dPsi);
-   Real sinEpsbar = sin(Epsbar);
-   Real sinTEoE   = sin(TrueOoE);   
-   
-   // Compute Rotation matrix for transformations from MOD to TOD
-   // (Vallado Eq. 3-64)
-   NUT.Set( cosdPsi,
-           -sindPsi*cosEpsbar,
-           -sindPsi*sinEpsbar,
-            sindPsi*cosTEoE, 
-            cosTEoE*cosdPsi*cosEpsbar + sinTEoE*sinEpsbar,
-            sinEpsbar*cosTEoE*cosdPsi - sinTEoE*cosEpsbar,
-            sinTEoE*sindPsi,
-            sinTEoE*cosdPsi*cosEpsbar - sinEpsbar*cosTEoE,
-            sinTEoE*sinEpsbar*cosdPsi + cosTEoE*cosEpsbar);
-   
-   lastNUTEpoch = atEpoch;
-   lastNUT      = NUT;
-   lastDPsi     = dPsi; 
-   
-   #ifdef DEBUG_ROT_MATRIX
-      MessageInterface::ShowMessage("At end of ComputeNutationmatrix ...\n");
-      MessageInterface::ShowMessage("   atEpoch   = %.15lf\n", atEpoch.Get());
-      MessageInterface::ShowMessage("   longAscNodeLunar   = %.15lf\n", longAscNodeLunar);
-      MessageInterface::ShowMessage("   cosEpsbar   = %.15lf\n", cosEpsbar);
-      MessageInterface::ShowMessage("   dPsi   = %.15lf\n", dPsi);
-	  MessageInterface::ShowMessage("   dEps   = %.15lf\n", dEps);
-	  MessageInterface::ShowMessage("   TrueOoE   = %.15lf\n", TrueOoE);
-   #endif
-//   return NUT;
 }
 
 //------------------------------------------------------------------------------
@@ -2870,7 +2973,7 @@ void AxisSystem::ComputeSiderealTimeDotRotation(const GmatTime &mjdUTC,
    // Get the polar motion and lod data
    Real lod = 0.0;
    Real x, y;
-   eop->GetPolarMotionAndLod(mjdUTC,x,y,lod);
+   eop->GetPolarMotionAndLod(mjdUTC,x,y,lod,eopIndexHint);
    #ifdef DEBUG_AXIS_SYSTEM_EOP
       MessageInterface::ShowMessage("in STderiv calc, mjdUtc     = %12.10f\n", mjdUTC.GetMjd());
       MessageInterface::ShowMessage("                 atEpoch    = %12.10f\n", atEpoch.GetMjd());
@@ -2926,7 +3029,7 @@ void AxisSystem::ComputePolarMotionRotation(const Real mjdUTC, A1Mjd atEpoch,
    // Get the polar motion and lod data
    Real lod = 0.0;
    Real x, y;
-   eop->GetPolarMotionAndLod(mjdUTC,x,y,lod);
+   eop->GetPolarMotionAndLod(mjdUTC,x,y,lod,eopIndexHint);
    #ifdef DEBUG_AXIS_SYSTEM_EOP
       MessageInterface::ShowMessage("in PM calc,      mjdUtc     = %12.10f\n", mjdUTC);
       MessageInterface::ShowMessage("                 atEpoch    = %12.10f\n", atEpoch.Get());
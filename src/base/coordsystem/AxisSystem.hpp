@@ -172,6 +172,10 @@ public:
 
 	bool                    SetCalculateRotMatrixDeriv(bool turnOn);
 
+   // sums the FK5 nutation series; used to build the shared nutation cache
+   void                    EvaluateNutationSeries(const Real tTDB, Real &dPsi,
+                                                  Real &dEps);
+
    // currently, no access to RotMatrix and RotDotMatrix allowed
 
    DEFAULT_TO_NO_CLONES
@@ -252,6 +256,8 @@ protected:
    static const Real  DETERMINANT_TOLERANCE;
 
    EopFile                   *eop;
+   /// This axis system's table index hint for EOP lookups
+   Integer                   eopIndexHint;
    ItrfCoefficientsFile      *itrf;
    
    std::string               epochFormat;
@@ -272,6 +278,8 @@ protected:
    Rmatrix33                 lastPM;
       
    Real                      lastDPsi; 
+   /// Identifies the nutation series in the EarthOrientationCache
+   std::string               nutationSeriesKey;
    
    GmatItrf::NutationTerms   nutationSrc;
    GmatItrf::PlanetaryTerms  planetarySrc; 
@@ -317,6 +325,8 @@ protected:
    virtual void      InitializeFK5();
 
    virtual void ComputePrecessionMatrix(const Real tTDB, A1Mjd atEpoch);
+   void         ComputeFundamentalArguments(const Real tTDB, Real *args);
+   bool         UseOrientationCache() const;
    virtual void ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch, 
                                            Real &dPsi,
                                            Real &longAscNodeLunar,
@@ -536,11 +536,12 @@ std::string CoordinateBase::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer CoordinateBase::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < CoordinateBaseParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               CoordinateBaseParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatBase::GetParameterID(str);
 }
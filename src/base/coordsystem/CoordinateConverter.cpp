@@ -60,7 +60,7 @@
 //---------------------------------
 // static data
 //---------------------------------
-// none at this time
+std::atomic<Integer> CoordinateConverter::cacheGeneration(0);
 
 //------------------------------------------------------------------------------
 // public methods
@@ -75,7 +75,8 @@
  */
 //---------------------------------------------------------------------------
 CoordinateConverter::CoordinateConverter():
-	specifyRotMatrixDeriv (false)
+	specifyRotMatrixDeriv (false),
+   cacheCheckedGeneration(cacheGeneration)
 {
 }
 
@@ -91,7 +92,8 @@ CoordinateConverter::CoordinateConverter():
  */
 //---------------------------------------------------------------------------
 CoordinateConverter::CoordinateConverter(const CoordinateConverter &coordCvt):
-   specifyRotMatrixDeriv  (coordCvt.specifyRotMatrixDeriv)
+   specifyRotMatrixDeriv  (coordCvt.specifyRotMatrixDeriv),
+   cacheCheckedGeneration (cacheGeneration)
 {
 }
 
@@ -113,6 +115,7 @@ const CoordinateConverter& CoordinateConverter::operator=(
       return *this;
 
 	specifyRotMatrixDeriv = coordCvt.specifyRotMatrixDeriv;
+   ClearTransformCache();
    return *this;
 }
 //---------------------------------------------------------------------------
@@ -141,6 +144,7 @@ void CoordinateConverter::Initialize()
    #ifdef DEBUG_FIRST_CALL
       firstCallFired = false;
    #endif
+   ClearTransformCache();
 }
 
 
@@ -293,6 +297,25 @@ bool CoordinateConverter::Convert(const A1Mjd &epoch, const Real *inState,
       return true;
    }
    
+   // Reuse the conversion composed for this pair at this epoch, if any
+   bool useCache = CanCacheTransform(inCoord, outCoord, forceComputation);
+   Real cacheInState[6];
+   if (useCache)
+   {
+      const ComposedTransform *composed = FindTransform(GmatTime(epoch.Get()),
+            false, inCoord, outCoord, omitTranslation);
+      if (composed)
+      {
+         ApplyTransform(*composed, inState, outState);
+         inCoord->SetCalculateRotMatrixDeriv(inCoordPrevFlag);
+         outCoord->SetCalculateRotMatrixDeriv(outCoordPrevFlag);
+         return true;
+      }
+      // kept in case outState is the input buffer
+      for (Integer i = 0; i < 6; ++i)
+         cacheInState[i] = inState[i];
+   }
+   
    #ifdef DEBUG_FIRST_CALL
       if ((firstCallFired == false) || (epoch.Get() == GmatTimeConstants::MJD_OF_J2000))
       {
@@ -472,6 +495,10 @@ bool CoordinateConverter::Convert(const A1Mjd &epoch, const Real *inState,
 		}
 	}
 
+   if (useCache)
+      StoreTransform(GmatTime(epoch.Get()), false, inCoord, outCoord,
+            omitTranslation, coincident, cacheInState, outState);
+
 	inCoord->SetCalculateRotMatrixDeriv(inCoordPrevFlag);
 	outCoord->SetCalculateRotMatrixDeriv(outCoordPrevFlag);
 
@@ -523,6 +550,25 @@ bool CoordinateConverter::Convert(const GmatTime &epoch, const Real *inState,
       return true;
    }
 
+   // Reuse the conversion composed for this pair at this epoch, if any
+   bool useCache = CanCacheTransform(inCoord, outCoord, forceComputation);
+   Real cacheInState[6];
+   if (useCache)
+   {
+      const ComposedTransform *composed = FindTransform(epoch, true, inCoord,
+            outCoord, omitTranslation);
+      if (composed)
+      {
+         ApplyTransform(*composed, inState, outState);
+         inCoord->SetCalculateRotMatrixDeriv(inCoordPrevFlag);
+         outCoord->SetCalculateRotMatrixDeriv(outCoordPrevFlag);
+         return true;
+      }
+      // kept in case outState is the input buffer
+      for (Integer i = 0; i < 6; ++i)
+         cacheInState[i] = inState[i];
+   }
+
 #ifdef DEBUG_FIRST_CALL
    if ((firstCallFired == false) || (epoch == GmatTimeConstants::MJD_OF_J2000))
    {
@@ -703,6 +749,10 @@ bool CoordinateConverter::Convert(const GmatTime &epoch, const Real *inState,
 		}
 	}
 
+   if (useCache)
+      StoreTransform(epoch, true, inCoord, outCoord, omitTranslation,
+            coincident, cacheInState, outState);
+
 	inCoord->SetCalculateRotMatrixDeriv(inCoordPrevFlag);
 	outCoord->SetCalculateRotMatrixDeriv(outCoordPrevFlag);
 
@@ -725,6 +775,128 @@ bool CoordinateConverter::Convert(const GmatTime &epoch, const Real *inState,
 }
 
 
+//------------------------------------------------------------------------------
+// bool Convert(const A1Mjd &epoch, const Integer count,
+//              const Real *inStates, CoordinateSystem *inCoord,
+//              Real *outStates, CoordinateSystem *outCoord,
+//              bool forceComputation, bool omitTranslation)
+//------------------------------------------------------------------------------
+/**
+ * This method converts count states from the inCoord CoordinateSystem to the
+ * outCoord CoordinateSystem, all at the input epoch.  The first state is
+ * converted as a single state is; the conversion composed for it is then
+ * applied to the others.
+ *
+ * @param epoch            time for which to do the conversion.
+ * @param count            number of states to convert.
+ * @param inStates         input states (in inCoord system), 6 elements each.
+ * @param inCoord          pointer to the input CoordinateSystem.
+ * @param outStates        resulting states, in the outCoord system.
+ * @param outCoord         pointer to the output CoordinateSystem.
+ * @param forceComputation force the computation whether it's time to do
+ *                         it or not (default is false)
+ * @param omitTranslation  omit the translation whether coincident or not
+ *                         (default is false)
+ *
+ * @return true if successful; false otherwise.
+ */
+//------------------------------------------------------------------------------
+bool CoordinateConverter::Convert(const A1Mjd &epoch, const Integer count,
+                          const Real *inStates, CoordinateSystem *inCoord,
+                          Real *outStates, CoordinateSystem *outCoord,
+                          bool forceComputation, bool omitTranslation)
+{
+   if (count < 1)
+      return true;
+   if (!Convert(epoch, inStates, inCoord, outStates, outCoord,
+                forceComputation, omitTranslation))
+      return false;
+   
+   const ComposedTransform *composed = NULL;
+   if (CanCacheTransform(inCoord, outCoord, forceComputation))
+      composed = FindTransform(GmatTime(epoch.Get()), false, inCoord,
+            outCoord, omitTranslation);
+   
+   for (Integer i = 1; i < count; ++i)
+   {
+      if (composed)
+         ApplyTransform(*composed, inStates + 6*i, outStates + 6*i);
+      else if (!Convert(epoch, inStates + 6*i, inCoord, outStates + 6*i,
+                        outCoord, forceComputation, omitTranslation))
+         return false;
+   }
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Convert(const GmatTime &epoch, const Integer count,
+//              const Real *inStates, CoordinateSystem *inCoord,
+//              Real *outStates, CoordinateSystem *outCoord,
+//              bool forceComputation, bool omitTranslation)
+//------------------------------------------------------------------------------
+/**
+ * GmatTime form of the batch conversion; see the A1Mjd form.
+ */
+//------------------------------------------------------------------------------
+bool CoordinateConverter::Convert(const GmatTime &epoch, const Integer count,
+                          const Real *inStates, CoordinateSystem *inCoord,
+                          Real *outStates, CoordinateSystem *outCoord,
+                          bool forceComputation, bool omitTranslation)
+{
+   if (count < 1)
+      return true;
+   if (!Convert(epoch, inStates, inCoord, outStates, outCoord,
+                forceComputation, omitTranslation))
+      return false;
+   
+   const ComposedTransform *composed = NULL;
+   if (CanCacheTransform(inCoord, outCoord, forceComputation))
+      composed = FindTransform(epoch, true, inCoord, outCoord,
+            omitTranslation);
+   
+   for (Integer i = 1; i < count; ++i)
+   {
+      if (composed)
+         ApplyTransform(*composed, inStates + 6*i, outStates + 6*i);
+      else if (!Convert(epoch, inStates + 6*i, inCoord, outStates + 6*i,
+                        outCoord, forceComputation, omitTranslation))
+         return false;
+   }
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearTransformCache()
+//------------------------------------------------------------------------------
+/**
+ * Discards the conversions composed by this converter.
+ */
+//------------------------------------------------------------------------------
+void CoordinateConverter::ClearTransformCache()
+{
+   transformCache.clear();
+   cacheCheckedGeneration = cacheGeneration;
+}
+
+
+//------------------------------------------------------------------------------
+// void InvalidateTransformCaches()
+//------------------------------------------------------------------------------
+/**
+ * Marks the conversions composed by every converter as out of date.  Called
+ * when a coordinate system is initialized, as its origin, axes or reference
+ * objects may have changed; each converter clears its cache on its next
+ * conversion.
+ */
+//------------------------------------------------------------------------------
+void CoordinateConverter::InvalidateTransformCaches()
+{
+   ++cacheGeneration;
+}
+
+
 //------------------------------------------------------------------------------
 // Rmatrix33 CoordinateConverter::GetLastRotationMatrix() const
 //------------------------------------------------------------------------------
@@ -1060,3 +1232,221 @@ void CoordinateConverter::RotationMatrixFromICRFToFK5(const A1Mjd &atEpoch)
 }
 
 
+//------------------------------------------------------------------------------
+// bool TransformKey::operator<(const TransformKey &key) const
+//------------------------------------------------------------------------------
+/**
+ * Orders the keys of the transform cache.
+ */
+//------------------------------------------------------------------------------
+bool CoordinateConverter::TransformKey::operator<(const TransformKey &key) const
+{
+   if (inCoord != key.inCoord)
+      return inCoord < key.inCoord;
+   if (outCoord != key.outCoord)
+      return outCoord < key.outCoord;
+   if (omitTranslation != key.omitTranslation)
+      return omitTranslation < key.omitTranslation;
+   return precise < key.precise;
+}
+
+
+//------------------------------------------------------------------------------
+// bool CanCacheTransform(CoordinateSystem *inCoord,
+//                        CoordinateSystem *outCoord,
+//                        bool forceComputation) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if a conversion between the systems depends only on the epoch, so
+ * it can be composed once per epoch.  It can not if either system uses a
+ * spacecraft, whose state changes without the epoch changing (in targeting,
+ * for example), or when the computation is forced or the derivative of the
+ * rotation matrix is needed.
+ *
+ * @param inCoord          the input CoordinateSystem.
+ * @param outCoord         the output CoordinateSystem.
+ * @param forceComputation the force computation flag of the conversion
+ *
+ * @return true if the conversion can come from the cache.
+ */
+//------------------------------------------------------------------------------
+bool CoordinateConverter::CanCacheTransform(CoordinateSystem *inCoord,
+                                            CoordinateSystem *outCoord,
+                                            bool forceComputation) const
+{
+   if (forceComputation || specifyRotMatrixDeriv)
+      return false;
+   return !inCoord->UsesSpacecraft() && !outCoord->UsesSpacecraft();
+}
+
+
+//------------------------------------------------------------------------------
+// const ComposedTransform* FindTransform(const GmatTime &epoch, bool precise,
+//       CoordinateSystem *inCoord, CoordinateSystem *outCoord,
+//       bool omitTranslation)
+//------------------------------------------------------------------------------
+/**
+ * Returns the conversion composed for the systems, if it is valid at the
+ * epoch and the systems still have the origins and axes it was composed for.
+ *
+ * @param epoch            time of the conversion.
+ * @param precise          true if the epoch came in as a GmatTime.
+ * @param inCoord          the input CoordinateSystem.
+ * @param outCoord         the output CoordinateSystem.
+ * @param omitTranslation  the omit translation flag of the conversion
+ *
+ * @return the composed conversion, or NULL if there is none.
+ */
+//------------------------------------------------------------------------------
+const CoordinateConverter::ComposedTransform* CoordinateConverter::FindTransform(
+      const GmatTime &epoch, bool precise, CoordinateSystem *inCoord,
+      CoordinateSystem *outCoord, bool omitTranslation)
+{
+   if (cacheCheckedGeneration != cacheGeneration)
+      ClearTransformCache();
+   
+   TransformKey key = {inCoord, outCoord, omitTranslation, precise};
+   std::map<TransformKey, ComposedTransform>::const_iterator found =
+         transformCache.find(key);
+   if (found == transformCache.end())
+      return NULL;
+   
+   const ComposedTransform &composed = found->second;
+   if ((composed.inOrigin != inCoord->GetOrigin()) ||
+       (composed.outOrigin != outCoord->GetOrigin()) ||
+       (composed.inAxes != inCoord->GetAxisSystem()) ||
+       (composed.outAxes != outCoord->GetAxisSystem()))
+      return NULL;
+   if (!composed.fixed && (composed.epoch != epoch))
+      return NULL;
+   
+   #ifdef DEBUG_TRANSFORM_CACHE
+      MessageInterface::ShowMessage("Cached %s conversion used, %s to %s\n",
+            (composed.fixed ? "fixed" : "epoch"), inCoord->GetName().c_str(),
+            outCoord->GetName().c_str());
+   #endif
+   return &composed;
+}
+
+
+//------------------------------------------------------------------------------
+// void StoreTransform(const GmatTime &epoch, bool precise,
+//       CoordinateSystem *inCoord, CoordinateSystem *outCoord,
+//       bool omitTranslation, bool coincident,
+//       const Real *inState, const Real *outState)
+//------------------------------------------------------------------------------
+/**
+ * Composes the 6x6 conversion just performed and stores it for the pair.
+ *
+ * The conversion rotates by R = R2T * B * R1, where R1 and R2 rotate the
+ * input and output systems to their base systems and B rotates between the
+ * base systems, and turns positions into velocities by
+ * R2dotT * B * R1 + R2T * B * R1dot.  The translation is the part of the
+ * output state that the matrix does not account for; it is zero when the
+ * systems are coincident.
+ *
+ * When the systems are coincident, share a base system and both have
+ * inertial axes, none of the parts depend on the epoch, and the transform
+ * is kept for every epoch.
+ *
+ * @param epoch            time of the conversion.
+ * @param precise          true if the epoch came in as a GmatTime.
+ * @param inCoord          the input CoordinateSystem.
+ * @param outCoord         the output CoordinateSystem.
+ * @param omitTranslation  the omit translation flag of the conversion
+ * @param coincident       true if the conversion had no translation
+ * @param inState          the state converted.
+ * @param outState         the result of the conversion.
+ */
+//------------------------------------------------------------------------------
+void CoordinateConverter::StoreTransform(const GmatTime &epoch, bool precise,
+      CoordinateSystem *inCoord, CoordinateSystem *outCoord,
+      bool omitTranslation, bool coincident, const Real *inState,
+      const Real *outState)
+{
+   if (cacheCheckedGeneration != cacheGeneration)
+      ClearTransformCache();
+   
+   std::string inBase  = inCoord->GetBaseSystem();
+   std::string outBase = outCoord->GetBaseSystem();
+   Rmatrix33 baseRot(true);
+   if ((inBase == "ICRF") && (outBase == "FK5"))
+      baseRot = icrfToFK5;
+   else if ((inBase == "FK5") && (outBase == "ICRF"))
+      baseRot = icrfToFK5.Transpose();
+   
+   Rmatrix33 r1    = inCoord->GetLastRotationMatrix();
+   Rmatrix33 r1dot = inCoord->GetLastRotationDotMatrix();
+   Rmatrix33 r2T   = outCoord->GetLastRotationMatrix().Transpose();
+   Rmatrix33 r2dotT = outCoord->GetLastRotationDotMatrix().Transpose();
+   Rmatrix33 rot    = r2T * baseRot * r1;
+   Rmatrix33 rotDot = r2dotT * baseRot * r1 + r2T * baseRot * r1dot;
+   
+   TransformKey key = {inCoord, outCoord, omitTranslation, precise};
+   ComposedTransform &composed = transformCache[key];
+   composed.inOrigin  = inCoord->GetOrigin();
+   composed.outOrigin = outCoord->GetOrigin();
+   composed.inAxes    = inCoord->GetAxisSystem();
+   composed.outAxes   = outCoord->GetAxisSystem();
+   composed.fixed     = coincident && (inBase == outBase) &&
+         ((composed.inAxes == NULL) || composed.inAxes->IsOfType("InertialAxes")) &&
+         ((composed.outAxes == NULL) || composed.outAxes->IsOfType("InertialAxes"));
+   composed.epoch     = epoch;
+   
+   Real *m = composed.transform;
+   for (Integer i = 0; i < 3; ++i)
+   {
+      for (Integer j = 0; j < 3; ++j)
+      {
+         m[6*i + j]           = rot(i,j);
+         m[6*i + j + 3]       = 0.0;
+         m[6*(i+3) + j]       = rotDot(i,j);
+         m[6*(i+3) + j + 3]   = rot(i,j);
+      }
+   }
+   for (Integer i = 0; i < 6; ++i)
+   {
+      composed.offset[i] = 0.0;
+      if (!coincident)
+      {
+         Real rotated = 0.0;
+         for (Integer j = 0; j < 6; ++j)
+            rotated += m[6*i + j] * inState[j];
+         composed.offset[i] = outState[i] - rotated;
+      }
+   }
+   composed.rotMatrix    = lastRotMatrix;
+   composed.rotDotMatrix = lastRotDotMatrix;
+}
+
+
+//------------------------------------------------------------------------------
+// void ApplyTransform(const ComposedTransform &composed,
+//                     const Real *inState, Real *outState)
+//------------------------------------------------------------------------------
+/**
+ * Converts a state with a composed conversion, and sets the last rotation
+ * matrices as the full conversion would.
+ *
+ * @param composed  the composed conversion.
+ * @param inState   the state to convert.
+ * @param outState  the converted state; may be inState.
+ */
+//------------------------------------------------------------------------------
+void CoordinateConverter::ApplyTransform(const ComposedTransform &composed,
+                                         const Real *inState, Real *outState)
+{
+   const Real *m = composed.transform;
+   Real in[6];
+   for (Integer i = 0; i < 6; ++i)
+      in[i] = inState[i];
+   for (Integer i = 0; i < 6; ++i)
+   {
+      Real sum = composed.offset[i];
+      for (Integer j = 0; j < 6; ++j)
+         sum += m[6*i + j] * in[j];
+      outState[i] = sum;
+   }
+   lastRotMatrix    = composed.rotMatrix;
+   lastRotDotMatrix = composed.rotDotMatrix;
+}
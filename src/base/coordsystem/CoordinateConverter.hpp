@@ -39,6 +39,9 @@
 #include "CoordinateSystem.hpp"
 #include "Rvector.hpp"
 #include "SolarSystem.hpp"
+#include "GmatTime.hpp"
+#include <atomic>
+#include <map>
 
 class GMAT_API CoordinateConverter
 {
@@ -99,6 +102,19 @@ public:
       CoordinateSystem *outCoord,
       bool forceNutationComputation = false, bool omitTranslation = false);
 
+   // batch conversion of count 6-element states, packed one after another
+   bool Convert(const A1Mjd &epoch, const Integer count,
+                const Real *inStates, CoordinateSystem *inCoord,
+                Real *outStates, CoordinateSystem *outCoord,
+                bool forceNutationComputation = false, bool omitTranslation = false);
+   bool Convert(const GmatTime &epoch, const Integer count,
+                const Real *inStates, CoordinateSystem *inCoord,
+                Real *outStates, CoordinateSystem *outCoord,
+                bool forceNutationComputation = false, bool omitTranslation = false);
+
+   void         ClearTransformCache();
+   static void  InvalidateTransformCaches();
+
    // method to return the rotation matrix used to do the last conversion
    Rmatrix33    GetLastRotationMatrix() const;
    Rmatrix33    GetLastRotationDotMatrix() const;
@@ -130,9 +146,64 @@ protected:
                                       const std::string &inBase, const std::string &outBase,
                                       const Real *inBaseState, Real *outBaseState);
 private:
+   /// Identifies a cached conversion: the systems, the translation option,
+   /// and whether the epoch came in as a GmatTime
+   struct TransformKey
+   {
+      CoordinateSystem *inCoord;
+      CoordinateSystem *outCoord;
+      bool             omitTranslation;
+      bool             precise;
+
+      bool operator<(const TransformKey &key) const;
+   };
+
+   /// The conversion between two systems at one epoch, as the 6x6 matrix
+   /// and offset with out = transform * in + offset
+   struct ComposedTransform
+   {
+      /// Origins and axes the transform was composed for
+      SpacePoint       *inOrigin;
+      SpacePoint       *outOrigin;
+      AxisSystem       *inAxes;
+      AxisSystem       *outAxes;
+      /// True when the transform holds at every epoch
+      bool             fixed;
+      GmatTime         epoch;
+      Real             transform[36];
+      Real             offset[6];
+      /// The matrices reported by GetLastRotationMatrix and
+      /// GetLastRotationDotMatrix for this conversion
+      Rmatrix33        rotMatrix;
+      Rmatrix33        rotDotMatrix;
+   };
+
    void         RotationMatrixFromICRFToFK5(const A1Mjd &atEpoch);
    Rmatrix33 icrfToFK5;
    Rmatrix33 icrfToFK5Dot;
 
+   /// Conversions composed at their last epoch, by system pair
+   std::map<TransformKey, ComposedTransform> transformCache;
+   /// Value of cacheGeneration when transformCache was last checked
+   Integer      cacheCheckedGeneration;
+   /// Advanced whenever a coordinate system is initialized
+   static std::atomic<Integer> cacheGeneration;
+
+   bool         CanCacheTransform(CoordinateSystem *inCoord,
+                                  CoordinateSystem *outCoord,
+                                  bool forceComputation) const;
+   const ComposedTransform*
+                FindTransform(const GmatTime &epoch, bool precise,
+                              CoordinateSystem *inCoord,
+                              CoordinateSystem *outCoord,
+                              bool omitTranslation);
+   void         StoreTransform(const GmatTime &epoch, bool precise,
+                               CoordinateSystem *inCoord,
+                               CoordinateSystem *outCoord,
+                               bool omitTranslation, bool coincident,
+                               const Real *inState, const Real *outState);
+   void         ApplyTransform(const ComposedTransform &composed,
+                               const Real *inState, Real *outState);
+
 };
 #endif // CoordinateConverter_hpp
@@ -1081,6 +1081,9 @@ bool CoordinateSystem::Initialize()
    
    CoordinateBase::Initialize();
    
+   // Conversions composed with the previous setup are out of date
+   CoordinateConverter::InvalidateTransformCaches();
+   
    if (axes)
    {
       #if DEBUG_CS_INIT
@@ -1798,11 +1801,12 @@ std::string CoordinateSystem::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer CoordinateSystem::GetParameterID(const std::string &str) const
 {
-   for (Integer i = CoordinateBaseParamCount; i < CoordinateSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CoordinateBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, CoordinateBaseParamCount,
+               CoordinateSystemParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return CoordinateBase::GetParameterID(str);
 }
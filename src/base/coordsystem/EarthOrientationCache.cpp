@@ -0,0 +1,327 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            EarthOrientationCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the EarthOrientationCache class.
+ */
+//------------------------------------------------------------------------------
+
+#include <cmath>
+#include "EarthOrientationCache.hpp"
+#include "AxisSystem.hpp"
+#include "IAUFile.hpp"
+#include "GmatConstants.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_EOC_BLOCKS
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const Real EarthOrientationCache::NODE_SPACING = 0.125;
+const std::string EarthOrientationCache::IAU_SERIES_KEY = "IAU-2000/2006 XYs";
+
+EarthOrientationCache* EarthOrientationCache::instance = NULL;
+
+
+//------------------------------------------------------------------------------
+//  public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// EarthOrientationCache* Instance()
+//------------------------------------------------------------------------------
+/**
+ * Returns a pointer to the instance of the singleton.
+ *
+ * @return pointer to the instance
+ */
+//------------------------------------------------------------------------------
+EarthOrientationCache* EarthOrientationCache::Instance()
+{
+   if (instance == NULL)
+      instance = new EarthOrientationCache();
+
+   return instance;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetNutationAngles(AxisSystem *forAxes, const std::string &seriesKey,
+//                        Real tTDB, Real &dPsi, Real &dEps)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the FK5 nutation in longitude and in obliquity.
+ *
+ * @param forAxes   The axis system requesting the angles; it evaluates the
+ *                  series at the nodes that are not yet built
+ * @param seriesKey Key identifying the nutation series (coefficients and
+ *                  theory) used by forAxes
+ * @param tTDB      Julian centuries of TDB from J2000
+ * @param dPsi      The nutation in longitude, in radians
+ * @param dEps      The nutation in obliquity, in radians
+ *
+ * @return true if the angles were interpolated, false if the caller needs to
+ *         evaluate the series
+ */
+//------------------------------------------------------------------------------
+bool EarthOrientationCache::GetNutationAngles(AxisSystem *forAxes,
+      const std::string &seriesKey, Real tTDB, Real &dPsi, Real &dEps)
+{
+   NodeTable &table = GetTable(seriesKey, 2,
+         NODE_SPACING / GmatTimeConstants::DAYS_PER_JULIAN_CENTURY);
+
+   Real angles[2];
+   if (!Interpolate(table, tTDB, angles, forAxes, NULL))
+      return false;
+
+   dPsi = angles[0];
+   dEps = angles[1];
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetIAUData(IAUFile *iauFile, Real jdTT, Real *xys)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the IAU-2000/2006 X, Y and s values.
+ *
+ * @param iauFile The (initialized) IAU data file
+ * @param jdTT    TT Julian date
+ * @param xys     The X, Y and s values, in the units of the data file
+ *
+ * @return true if the values were interpolated, false if the caller needs to
+ *         use the data file (near the ends of the file's span)
+ */
+//------------------------------------------------------------------------------
+bool EarthOrientationCache::GetIAUData(IAUFile *iauFile, Real jdTT, Real *xys)
+{
+   NodeTable &table = GetTable(IAU_SERIES_KEY, 3, NODE_SPACING);
+   return Interpolate(table, jdTT, xys, NULL, iauFile);
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all of the nodes, so they are built again from the current data.
+ */
+//------------------------------------------------------------------------------
+void EarthOrientationCache::Clear()
+{
+   tables.clear();
+}
+
+
+//------------------------------------------------------------------------------
+//  protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// NodeTable& GetTable(const std::string &key, Integer dimension, Real spacing)
+//------------------------------------------------------------------------------
+/**
+ * Finds the nodes of a series, creating an empty table on first use.
+ *
+ * @param key       The series key
+ * @param dimension Number of values at each node
+ * @param spacing   Node spacing, in the units of the independent variable
+ *
+ * @return The table
+ */
+//------------------------------------------------------------------------------
+EarthOrientationCache::NodeTable& EarthOrientationCache::GetTable(
+      const std::string &key, Integer dimension, Real spacing)
+{
+   std::map<std::string, NodeTable>::iterator i = tables.find(key);
+   if (i != tables.end())
+      return i->second;
+
+   NodeTable &table = tables[key];
+   table.dimension = dimension;
+   table.spacing   = spacing;
+   table.lastBlock = NULL;
+   table.lastIndex = 0;
+   return table;
+}
+
+
+//------------------------------------------------------------------------------
+// NodeBlock* GetBlock(NodeTable &table, Integer index, AxisSystem *forAxes,
+//                     IAUFile *iauFile)
+//------------------------------------------------------------------------------
+/**
+ * Finds a block of nodes, building it if needed.
+ *
+ * Block index covers the grid intervals index * BLOCK_NODES to
+ * (index + 1) * BLOCK_NODES - 1, and holds the STENCIL_SIZE / 2 - 1 nodes
+ * before and the STENCIL_SIZE / 2 nodes after them, so that every stencil
+ * in the block is found in it.
+ *
+ * @param table   The series
+ * @param index   The block index
+ * @param forAxes Axis system used to evaluate nutation nodes
+ * @param iauFile Data file used to evaluate X, Y, s nodes
+ *
+ * @return The block
+ */
+//------------------------------------------------------------------------------
+EarthOrientationCache::NodeBlock* EarthOrientationCache::GetBlock(
+      NodeTable &table, Integer index, AxisSystem *forAxes, IAUFile *iauFile)
+{
+   if ((table.lastBlock != NULL) && (table.lastIndex == index))
+      return table.lastBlock;
+
+   std::map<Integer, NodeBlock>::iterator i = table.blocks.find(index);
+   if (i == table.blocks.end())
+   {
+      NodeBlock &block = table.blocks[index];
+      Integer count = BLOCK_NODES + STENCIL_SIZE - 1;
+      Integer first = index * BLOCK_NODES - (STENCIL_SIZE / 2 - 1);
+      block.valid = true;
+      block.values.assign(count * table.dimension, 0.0);
+
+      #ifdef DEBUG_EOC_BLOCKS
+         MessageInterface::ShowMessage("EarthOrientationCache: building block "
+               "%d, nodes %.10lf to %.10lf\n", index, first * table.spacing,
+               (first + count - 1) * table.spacing);
+      #endif
+
+      for (Integer n = 0; n < count; ++n)
+      {
+         Real t = (first + n) * table.spacing;
+         Real *node = &block.values[n * table.dimension];
+         if (forAxes != NULL)
+            forAxes->EvaluateNutationSeries(t, node[0], node[1]);
+         else if (iauFile->Covers(t))
+            iauFile->GetIAUData(t, node, table.dimension, 9);
+         else
+         {
+            block.valid = false;
+            break;
+         }
+      }
+      table.lastBlock = &block;
+   }
+   else
+      table.lastBlock = &(i->second);
+
+   table.lastIndex = index;
+   return table.lastBlock;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Interpolate(NodeTable &table, Real t, Real *values,
+//                  AxisSystem *forAxes, IAUFile *iauFile)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates a series with the eight point Lagrange formula.
+ *
+ * @param table   The series
+ * @param t       The value of the independent variable
+ * @param values  The interpolated values
+ * @param forAxes Axis system used to evaluate nutation nodes
+ * @param iauFile Data file used to evaluate X, Y, s nodes
+ *
+ * @return true on success, false if the nodes could not be built
+ */
+//------------------------------------------------------------------------------
+bool EarthOrientationCache::Interpolate(NodeTable &table, Real t, Real *values,
+      AxisSystem *forAxes, IAUFile *iauFile)
+{
+   Real x = t / table.spacing;
+   Real interval = floor(x);
+   Real u = x - interval;
+   Integer k = (Integer)interval;
+
+   // Floor division, so that epochs before the grid origin work as well
+   Integer index = (k >= 0 ? k / BLOCK_NODES : -((-k - 1) / BLOCK_NODES) - 1);
+   NodeBlock *block = GetBlock(table, index, forAxes, iauFile);
+   if (!block->valid)
+      return false;
+
+   // Weights from the distances to the stencil nodes k-3 ... k+4
+   Real d[STENCIL_SIZE], w[STENCIL_SIZE];
+   for (Integer i = 0; i < STENCIL_SIZE; ++i)
+      d[i] = u - (i - (STENCIL_SIZE / 2 - 1));
+
+   Real product = 1.0;
+   for (Integer i = 0; i < STENCIL_SIZE; ++i)
+   {
+      w[i] = product;
+      product *= d[i];
+   }
+   product = 1.0;
+   for (Integer i = STENCIL_SIZE - 1; i >= 0; --i)
+   {
+      w[i] *= product * weightScale[i];
+      product *= d[i];
+   }
+
+   Integer dim = table.dimension;
+   const Real *node = &block->values[(k - index * BLOCK_NODES) * dim];
+   for (Integer j = 0; j < dim; ++j)
+   {
+      values[j] = 0.0;
+      for (Integer i = 0; i < STENCIL_SIZE; ++i)
+         values[j] += w[i] * node[i * dim + j];
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+//  private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// EarthOrientationCache()
+//------------------------------------------------------------------------------
+/**
+ * Constructor; builds the weight denominators of the interpolation formula.
+ */
+//------------------------------------------------------------------------------
+EarthOrientationCache::EarthOrientationCache()
+{
+   for (Integer i = 0; i < STENCIL_SIZE; ++i)
+   {
+      Real denominator = 1.0;
+      for (Integer m = 0; m < STENCIL_SIZE; ++m)
+         if (m != i)
+            denominator *= (i - m);
+      weightScale[i] = 1.0 / denominator;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// ~EarthOrientationCache()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+EarthOrientationCache::~EarthOrientationCache()
+{
+}
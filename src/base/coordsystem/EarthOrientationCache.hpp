@@ -0,0 +1,129 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            EarthOrientationCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the EarthOrientationCache class, a shared table of the slowly
+ * varying Earth orientation terms.  It is a singleton.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef EarthOrientationCache_hpp
+#define EarthOrientationCache_hpp
+
+#include "gmatdefs.hpp"
+#include <map>
+
+class AxisSystem;
+class IAUFile;
+
+/**
+ * Time indexed cache of the nutation angles and of the IAU-2000/2006 X, Y and s
+ * values
+ *
+ * The FK5 nutation series and the interpolation of the IAU X, Y, s data file
+ * dominate the cost of the Earth fixed rotations.  Both vary slowly, so this
+ * class evaluates them once on a uniform grid, in blocks of nodes built as the
+ * epochs are requested, and interpolates the nodes with an eight point
+ * Lagrange formula.  The grid is shared by all of the axis systems that use
+ * the same coefficients, so a block is built once for a run however many
+ * coordinate systems, forces and measurements use it.  The precession, the
+ * Earth rotation angle, and the polar motion are not cached; they are
+ * evaluated at each epoch by the axis systems.
+ *
+ * The nodes are NODE_SPACING days apart.  For a term of amplitude A and period
+ * P, the interpolation error is at most 1.07e-3 * A * (2 pi h / P)^8, with h
+ * the node spacing.  The shortest period in the nutation series is 4.7 days
+ * and the amplitudes of each angle sum to less than 20 arcsec, so the
+ * interpolated angles are within 2e-8 arcsec of the series (under a
+ * micrometer at the Earth's surface).  The X, Y, s nodes carry the error of
+ * the daily data file interpolation, as the direct evaluation does.
+ */
+class GMAT_API EarthOrientationCache
+{
+public:
+   // Returns the instance of this singleton
+   static EarthOrientationCache* Instance();
+
+   bool GetNutationAngles(AxisSystem *forAxes, const std::string &seriesKey,
+                          Real tTDB, Real &dPsi, Real &dEps);
+   bool GetIAUData(IAUFile *iauFile, Real jdTT, Real *xys);
+   void Clear();
+
+   /// Spacing of the nodes, in days
+   static const Real    NODE_SPACING;
+   /// Number of grid intervals served by each block of nodes
+   static const Integer BLOCK_NODES = 64;
+   /// Number of nodes used by the interpolation
+   static const Integer STENCIL_SIZE = 8;
+
+protected:
+   /// Key of the X, Y, s table
+   static const std::string IAU_SERIES_KEY;
+
+   /// Nodes of one block: the block's nodes and the stencil nodes around them
+   struct NodeBlock
+   {
+      /// false if a node of the block could not be evaluated
+      bool              valid;
+      /// Node values, dimension values per node
+      RealArray         values;
+   };
+
+   /// The nodes of one series
+   struct NodeTable
+   {
+      /// Values per node
+      Integer           dimension;
+      /// Spacing of the nodes, in the units of the independent variable
+      Real              spacing;
+      /// The blocks, indexed by the first grid interval / BLOCK_NODES
+      std::map<Integer, NodeBlock>
+                        blocks;
+      /// Block used for the last request, and its index
+      NodeBlock         *lastBlock;
+      Integer           lastIndex;
+   };
+
+   /// The tables, by series
+   std::map<std::string, NodeTable>
+                        tables;
+
+   /// Weight denominators of the eight point formula
+   Real                 weightScale[STENCIL_SIZE];
+
+   NodeTable&           GetTable(const std::string &key, Integer dimension,
+                                 Real spacing);
+   NodeBlock*           GetBlock(NodeTable &table, Integer index,
+                                 AxisSystem *forAxes, IAUFile *iauFile);
+   bool                 Interpolate(NodeTable &table, Real t, Real *values,
+                                    AxisSystem *forAxes, IAUFile *iauFile);
+
+private:
+   EarthOrientationCache();
+   virtual ~EarthOrientationCache();
+   // copy constructor - NOT IMPLEMENTED
+   EarthOrientationCache(const EarthOrientationCache &eoc);
+   // operator = - NOT IMPLEMENTED
+   const EarthOrientationCache& operator=(const EarthOrientationCache &eoc);
+
+   static EarthOrientationCache *instance;
+};
+
+#endif // EarthOrientationCache_hpp
@@ -193,6 +193,15 @@ bool IAUFile::GetIAUData(Real ind, Real* iau_data, Integer dim, Integer order)
 		}
 	}
 
+   // Frames evaluated at the same epoch ask again within a step; reuse the
+   // last result for them
+   if ((ind == lastEpoch) && (dim == lastDim) && (order == lastOrder))
+   {
+      for (Integer i = 0; i < dim; ++i)
+         iau_data[i] = lastResult[i];
+      return true;
+   }
+
 	// Specify beginning index and ending index in order to run interpolation:
 	Real stepsize = 1.0;
     Integer midpoint = (ind-independence[0])/(Integer)GmatMathUtil::NearestInt(stepsize);
@@ -200,22 +209,27 @@ bool IAUFile::GetIAUData(Real ind, Real* iau_data, Integer dim, Integer order)
 	Integer endIndex = ((pointsCount-1) < (beginIndex+order))? (pointsCount-1):(beginIndex+order);
 	beginIndex = (0 > (endIndex-order))? 0:(endIndex-order);
 
-	// Run interpolation:
-	// create an interpolator:
-	LagrangeInterpolator* interpolator = new LagrangeInterpolator("", dim, order);
-
-	// add data points in order to run interpolator:
-	for (Integer i= beginIndex; i <= endIndex; ++i)
-	{
-		interpolator->AddPoint(independence[i], dependences[i]);
-	}
-
-	// run interpolator and get the result of dependent variables:
-	interpolator->SetForceInterpolation(true);
-	bool returnval = interpolator->Interpolate(ind, iau_data);
-	delete interpolator;
+	// Run interpolation on the window; the interpolator keeps the points
+	// and weights of the last window, so nearby epochs reuse them
+	return InterpolateWindow(ind, iau_data, dim, order, beginIndex, endIndex);
+}
 
-	return returnval;
+//------------------------------------------------------------------------------
+// bool Covers(Real ind) const
+//------------------------------------------------------------------------------
+/*
+ * Checks that a value of the independent variable is in the span of the data
+ * read from the file, so that GetIAUData can be called for it.
+ *
+ * @param ind          TT Julian date
+ *
+ * @return true if the data covers the date
+ */
+//------------------------------------------------------------------------------
+bool IAUFile::Covers(Real ind) const
+{
+   return ((independence != NULL) && (pointsCount > 0) &&
+           (ind >= independence[0]) && (ind <= independence[pointsCount-1]));
 }
 
 //------------------------------------------------------------------------------
@@ -250,6 +264,8 @@ void IAUFile::AllocateArrays()
 //------------------------------------------------------------------------------
 void IAUFile::CleanupArrays()
 {
+   ResetLookupCache();
+
    if (independence != NULL)
    {
 	  // clean up the array of independent variable
@@ -269,6 +285,70 @@ void IAUFile::CleanupArrays()
    }
 }
 
+//------------------------------------------------------------------------------
+//  bool InterpolateWindow(Real ind, Real *result, Integer dim, Integer order,
+//                         Integer beginIndex, Integer endIndex)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the table points beginIndex to endIndex at ind.
+ *
+ * The interpolator is rebuilt only when dim or order change, and reloaded only
+ * when the window moves.  A successful result is kept for the next lookup.
+ */
+//------------------------------------------------------------------------------
+bool IAUFile::InterpolateWindow(Real ind, Real *result, Integer dim,
+                                Integer order, Integer beginIndex,
+                                Integer endIndex)
+{
+   if ((interpolator == NULL) || (dim != interpDim) || (order != interpOrder))
+   {
+      delete interpolator;
+      interpolator = new LagrangeInterpolator("", dim, order);
+      interpolator->SetForceInterpolation(true);
+      interpDim   = dim;
+      interpOrder = order;
+      interpBegin = -1;
+      interpEnd   = -1;
+   }
+
+   if ((beginIndex != interpBegin) || (endIndex != interpEnd))
+   {
+      interpolator->Clear();
+      for (Integer i = beginIndex; i <= endIndex; ++i)
+         interpolator->AddPoint(independence[i], dependences[i]);
+      interpBegin = beginIndex;
+      interpEnd   = endIndex;
+   }
+
+   lastDim = -1;
+   bool returnval = interpolator->Interpolate(ind, result);
+   if (returnval)
+   {
+      lastEpoch = ind;
+      lastDim   = dim;
+      lastOrder = order;
+      lastResult.assign(result, result + dim);
+   }
+
+   return returnval;
+}
+
+//------------------------------------------------------------------------------
+//  void ResetLookupCache()
+//------------------------------------------------------------------------------
+/**
+ * Drops the interpolator and the last result, e.g. when the table is freed.
+ */
+//------------------------------------------------------------------------------
+void IAUFile::ResetLookupCache()
+{
+   delete interpolator;
+   interpolator = NULL;
+   interpBegin  = -1;
+   interpEnd    = -1;
+   lastDim      = -1;
+}
+
 //------------------------------------------------------------------------------
 //  private methods
 //------------------------------------------------------------------------------
@@ -292,7 +372,15 @@ IAUFile::IAUFile(const std::string &fileName, Integer dim) :
    dimension      (dim),
    tableSz        (MAX_TABLE_SIZE),
    pointsCount    (0),
-   isInitialized  (false)
+   isInitialized  (false),
+   interpolator   (NULL),
+   interpDim      (-1),
+   interpOrder    (-1),
+   interpBegin    (-1),
+   interpEnd      (-1),
+   lastEpoch      (0.0),
+   lastDim        (-1),
+   lastOrder      (-1)
 {
 }
 
@@ -36,6 +36,8 @@
 
 #include "gmatdefs.hpp"
 
+class LagrangeInterpolator;
+
 class GMAT_API IAUFile
 {
 public:
@@ -48,6 +50,8 @@ public:
 
    // Get IAU2000 data for a given epoch
    bool GetIAUData(Real epoch, Real* iau, Integer dim, Integer order);
+   // Checks that an epoch is in the span of the data
+   bool Covers(Real epoch) const;
 
 protected:
 
@@ -71,8 +75,26 @@ protected:
    /// specify whether the object is initialized or not
    bool isInitialized;
 
+   /// Interpolator reused across lookups, loaded with the last window
+   LagrangeInterpolator *interpolator;
+   /// Dimension and order the interpolator was built for
+   Integer              interpDim;
+   Integer              interpOrder;
+   /// Table indices of the points loaded into the interpolator
+   Integer              interpBegin;
+   Integer              interpEnd;
+   /// Epoch, dimension and order of the last lookup; lastDim is -1 if unset
+   Real                 lastEpoch;
+   Integer              lastDim;
+   Integer              lastOrder;
+   /// Result of the last lookup
+   RealArray            lastResult;
+
    void AllocateArrays();
    void CleanupArrays();
+   bool InterpolateWindow(Real ind, Real *result, Integer dim, Integer order,
+                          Integer beginIndex, Integer endIndex);
+   void ResetLookupCache();
 
 private:
    // default constructor
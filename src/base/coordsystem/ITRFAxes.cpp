@@ -37,6 +37,8 @@
 #include "DynamicAxes.hpp"
 #include "SolarSystem.hpp"
 #include "CelestialBody.hpp"
+#include "Planet.hpp"
+#include "EarthOrientationCache.hpp"
 #include "RealUtilities.hpp"
 #include "Linear.hpp"
 #include "GmatConstants.hpp"
@@ -459,7 +461,7 @@ void ITRFAxes::CalculateRotationMatrix(const A1Mjd &atEpoch,
       Real dUT1;
       dUT1 = eop->GetUt1UtcOffset(utcMJD +  offset);
    #endif
-   eop->GetPolarMotionAndLod(utcMJD +  offset, xp, yp, LOD);
+   eop->GetPolarMotionAndLod(utcMJD +  offset, xp, yp, LOD, eopIndexHint);
 
    xp = xp*sec2rad;
    yp = yp*sec2rad;
@@ -494,7 +496,16 @@ void ITRFAxes::CalculateRotationMatrix(const A1Mjd &atEpoch,
    {
       throw CoordinateSystemException("Error: IAUFile object is NULL. GMAT cannot get IAU data.\n");
    }
-   iauFile->GetIAUData(jdTT,data,3,9);
+   // The X, Y, s values are interpolated from the shared cache when the
+   // Earth's UseOrientationCache is set, unless the nutation update interval
+   // is zero or the computation is forced
+   if (originName == GmatSolarSystemDefaults::EARTH_NAME)
+      updateIntervalToUse = (overrideOriginInterval ? updateInterval :
+            ((Planet*) origin)->GetNutationUpdateInterval());
+   if ((updateIntervalToUse <= 0.0) || forceComputation ||
+       !UseOrientationCache() ||
+       (!EarthOrientationCache::Instance()->GetIAUData(iauFile, jdTT, data)))
+      iauFile->GetIAUData(jdTT,data,3,9);
    Real X = data[0]*sec2rad;
    Real Y = data[1]*sec2rad;
    Real s = data[2]*sec2rad;
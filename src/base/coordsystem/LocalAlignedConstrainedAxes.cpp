@@ -408,12 +408,12 @@ std::string LocalAlignedConstrainedAxes::GetParameterText(const Integer id) cons
 //------------------------------------------------------------------------------
 Integer LocalAlignedConstrainedAxes::GetParameterID(const std::string &str) const
 {
-   for (Integer i = DynamicAxesParamCount;
-        i < LocalAlignedConstrainedAxesParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - DynamicAxesParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, DynamicAxesParamCount,
+               LocalAlignedConstrainedAxesParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return DynamicAxes::GetParameterID(str);
 }
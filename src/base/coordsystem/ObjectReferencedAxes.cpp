@@ -567,11 +567,12 @@ std::string ObjectReferencedAxes::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ObjectReferencedAxes::GetParameterID(const std::string &str) const
 {
-   for (Integer i = DynamicAxesParamCount; i < ObjectReferencedAxesParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - DynamicAxesParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, DynamicAxesParamCount,
+               ObjectReferencedAxesParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return DynamicAxes::GetParameterID(str);
 }
@@ -79,7 +79,8 @@ TopocentricAxes::TopocentricAxes(const std::string &itsName) :
    itsBodyName      (""),
    horizonReference ("Sphere"),
    flattening       (-999.99),
-   radius           (GmatSolarSystemDefaults::PLANET_EQUATORIAL_RADIUS[GmatSolarSystemDefaults::EARTH])
+   radius           (GmatSolarSystemDefaults::PLANET_EQUATORIAL_RADIUS[GmatSolarSystemDefaults::EARTH]),
+   bodyDataSet      (false)
 {
    objectTypeNames.push_back("TopocentricAxes");
    parameterCount = TopocentricAxesParamCount;
@@ -106,7 +107,8 @@ TopocentricAxes::TopocentricAxes(const TopocentricAxes &tAxes) :
    flattening        (tAxes.flattening),
    radius            (tAxes.radius),
    RFT               (tAxes.RFT),
-   bfLocation        (tAxes.bfLocation)
+   bfLocation        (tAxes.bfLocation),
+   bodyDataSet       (false)
 {
 }
 
@@ -135,6 +137,7 @@ const TopocentricAxes& TopocentricAxes::operator=(const TopocentricAxes &tAxes)
    radius           = tAxes.radius;
    RFT              = tAxes.RFT;
    bfLocation       = tAxes.bfLocation;
+   bodyDataSet      = false;
 
    return *this;
 }
@@ -175,6 +178,7 @@ bool TopocentricAxes::Initialize()
       throw CoordinateSystemException(errMsg);
    }
    bfPoint = (BodyFixedPoint*) origin; 
+   bodyDataSet = false;
    
    return true;
 }
@@ -221,38 +225,6 @@ GmatBase* TopocentricAxes::Clone() const
 void TopocentricAxes::CalculateRotationMatrix(const A1Mjd &atEpoch,
                                               bool forceComputation) 
 {   
-   // Check to make sure that the central body is a celestial body
-   itsBodyName       = bfPoint->GetStringParameter("CentralBody");
-   #ifdef DEBUG_TOPOCENTRIC_AXES
-      MessageInterface::ShowMessage("Origin's central body is %s\n",
-            itsBodyName.c_str());
-   #endif
-   GmatBase *bodyPtr = bfPoint->GetRefObject(Gmat::CELESTIAL_BODY, itsBodyName);
-   if (!bodyPtr)
-   {
-      std::string errMsg = "Central Body for a BodyFixedPoint used in a ";
-      errMsg += " Topocentric Coordinate System is NULL";
-      throw CoordinateSystemException(errMsg);
-   }
-   if (!(bodyPtr->IsOfType("CelestialBody")))
-   {
-      std::string errMsg = "Central Body for a BodyFixedPoint used in a ";
-      errMsg += " Topocentric Coordinate System must be a Celestial Body";
-      throw CoordinateSystemException(errMsg);
-   }
-   centralBody      = (CelestialBody*) bodyPtr;
-   flattening       = centralBody->GetFlattening();
-   radius           = centralBody->GetEquatorialRadius();
-   bfcs             = bfPoint->GetBodyFixedCoordinateSystem();
-   horizonReference = bfPoint->GetStringParameter("HorizonReference");
-   if ((horizonReference != "Sphere") && (horizonReference != "Ellipsoid"))
-   {
-      std::string errMsg = "Unexpected horizon reference \"";
-      errMsg += horizonReference + "\" received from BodyFixedPoint \"";
-      errMsg += bfPoint->GetName() + "\"";
-      throw CoordinateSystemException(errMsg);
-   }
-
    // compute rotMatrix and rotDotMatrix
    // First, calculate the Rft matrix, if the position has changed
    Rvector3 newLoc  = bfPoint->GetBodyFixedLocation(atEpoch);
@@ -273,19 +245,30 @@ void TopocentricAxes::CalculateRotationMatrix(const A1Mjd &atEpoch,
       MessageInterface::ShowMessage("%12.17f\n", newLoc[1]);
       MessageInterface::ShowMessage("%12.17f\n", newLoc[2]);
    #endif
-   if (newLoc != bfLocation)
+   // The central body data and RFT are constant for a fixed station, so they
+   // are only refreshed when the location changes
+   if (!bodyDataSet || (newLoc != bfLocation))
+   {
+      ResolveBodyData();
       CalculateRFT(atEpoch, newLoc);
+      bodyDataSet = true;
+   }
    // save the location
    bfLocation  = newLoc;
+   bfcs        = bfPoint->GetBodyFixedCoordinateSystem();
    #ifdef DEBUG_TOPOCENTRIC_AXES
       MessageInterface::ShowMessage("Now bfLocation is set to:\n");
       MessageInterface::ShowMessage("%12.17f\n", bfLocation[0]);
       MessageInterface::ShowMessage("%12.17f\n", bfLocation[1]);
       MessageInterface::ShowMessage("%12.17f\n", bfLocation[2]);
    #endif
-   // Determine rotation matrix from body-fixed to inertial
-   Rvector bogusIn(6,7000.0,1000.0,6000.0, 0.0, 0.0, 0.0);
-   Rvector bogusOut = bfcs->ToBaseSystem(atEpoch, bogusIn); // @todo - need ToMJ2000Eq here?
+   // Determine rotation matrix from body-fixed to inertial.  Only the
+   // rotation is needed, so the conversion is done as coincident to skip the
+   // origin translation; the body-fixed axes reuse their rotation for an
+   // epoch they have already computed.
+   Real bogusIn[6] = {7000.0, 1000.0, 6000.0, 0.0, 0.0, 0.0};
+   Real bogusOut[6];
+   bfcs->ToBaseSystem(atEpoch, bogusIn, bogusOut, true); // @todo - need ToMJ2000Eq here?
    #ifdef DEBUG_TOPOCENTRIC_AXES
       MessageInterface::ShowMessage("bogusIn:\n");
       MessageInterface::ShowMessage("%12.17f\n", bogusIn[0]);
@@ -343,6 +326,49 @@ void TopocentricAxes::CalculateRotationMatrix(const A1Mjd &atEpoch,
 }
 
 
+//------------------------------------------------------------------------------
+//  void ResolveBodyData()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the central body, its shape and the horizon reference from the
+ * BodyFixedPoint origin.
+ */
+//------------------------------------------------------------------------------
+void TopocentricAxes::ResolveBodyData()
+{
+   // Check to make sure that the central body is a celestial body
+   itsBodyName       = bfPoint->GetStringParameter("CentralBody");
+   #ifdef DEBUG_TOPOCENTRIC_AXES
+      MessageInterface::ShowMessage("Origin's central body is %s\n",
+            itsBodyName.c_str());
+   #endif
+   GmatBase *bodyPtr = bfPoint->GetRefObject(Gmat::CELESTIAL_BODY, itsBodyName);
+   if (!bodyPtr)
+   {
+      std::string errMsg = "Central Body for a BodyFixedPoint used in a ";
+      errMsg += " Topocentric Coordinate System is NULL";
+      throw CoordinateSystemException(errMsg);
+   }
+   if (!(bodyPtr->IsOfType("CelestialBody")))
+   {
+      std::string errMsg = "Central Body for a BodyFixedPoint used in a ";
+      errMsg += " Topocentric Coordinate System must be a Celestial Body";
+      throw CoordinateSystemException(errMsg);
+   }
+   centralBody      = (CelestialBody*) bodyPtr;
+   flattening       = centralBody->GetFlattening();
+   radius           = centralBody->GetEquatorialRadius();
+   horizonReference = bfPoint->GetStringParameter("HorizonReference");
+   if ((horizonReference != "Sphere") && (horizonReference != "Ellipsoid"))
+   {
+      std::string errMsg = "Unexpected horizon reference \"";
+      errMsg += horizonReference + "\" received from BodyFixedPoint \"";
+      errMsg += bfPoint->GetName() + "\"";
+      throw CoordinateSystemException(errMsg);
+   }
+}
+
+
 //------------------------------------------------------------------------------
 //  void CalculateRFT(const A1Mjd &atEpoch, const Rvector3 newLocation)
 //------------------------------------------------------------------------------
@@ -82,7 +82,10 @@ protected:
    Real             radius;
    Rmatrix33        RFT;
    Rvector3         bfLocation;
+   /// Flag indicating that the central body data and RFT are set
+   bool             bodyDataSet;
    
+   void         ResolveBodyData();
    virtual void CalculateRotationMatrix(const A1Mjd &atEpoch,
                                         bool forceComputation = false);
    virtual void CalculateRFT(const A1Mjd &atEpoch, const Rvector3 newLocation);
@@ -44,6 +44,8 @@
 #include "MessageInterface.hpp"
 #include "RealUtilities.hpp"
 #include "EphemManager.hpp"
+#include "EventSearch.hpp"
+#include "CoordinateSystem.hpp"
 
 
 //#define DEBUG_DUMPEVENTDATA
@@ -82,6 +84,7 @@ EventLocator::PARAMETER_TEXT[EventLocatorParamCount - GmatBaseParamCount] =
    "WriteReport",          // WRITE_REPORT
    "RunMode",              // RUN_MODE
    "UseEntireInterval",    // USE_ENTIRE_INTERVAL
+   "SearchMethod",         // SEARCH_METHOD
 };
 
 const Gmat::ParameterType
@@ -99,6 +102,7 @@ EventLocator::PARAMETER_TYPE[EventLocatorParamCount - GmatBaseParamCount] =
    Gmat::BOOLEAN_TYPE,     // WRITE_REPORT
    Gmat::ENUMERATION_TYPE, // RUN_MODE
    Gmat::BOOLEAN_TYPE,     // USE_ENTIRE_INTERVAL
+   Gmat::ENUMERATION_TYPE, // SEARCH_METHOD
 };
 
 const std::string EventLocator::RUN_MODES[3] =
@@ -110,6 +114,14 @@ const std::string EventLocator::RUN_MODES[3] =
 
 const Integer EventLocator::numModes = 3;
 
+const std::string EventLocator::SEARCH_METHODS[2] =
+{
+      "SPICE",
+      "Native",
+};
+
+const Integer EventLocator::numSearchMethods = 2;
+
 const std::string EventLocator::defaultFormat        = "TAIModJulian";
 const Real        EventLocator::defaultInitialEpoch  = 21545;
 const Real        EventLocator::defaultFinalEpoch    = 21545.138;
@@ -117,6 +129,10 @@ const Real        EventLocator::defaultFinalEpoch    = 21545.138;
 // Used for light-time calculations
 const Real EventLocator::STEP_MULTIPLE = 0.5;
 
+// Sample spacing of the body and station tracks of the native search
+const Real EventLocator::TRACK_STEP = 300.0;
+const Real EventLocator::BOUND_MARGIN = 1.1;
+
 //------------------------------------------------------------------------------
 // Public Methods
 //------------------------------------------------------------------------------
@@ -143,6 +159,7 @@ EventLocator::EventLocator(const std::string &typeStr,
    locatingString          (""),
    runMode                 ("Automatic"),
    useEntireInterval       (true),
+   searchMethod            ("SPICE"),
    appendReport            (false),
    epochFormat             ("TAIModJulian"),
    initialEpoch            ("21545"),        // MUST match initialEp
@@ -162,7 +179,8 @@ EventLocator::EventLocator(const std::string &typeStr,
    solarSys                (NULL),
    em                      (NULL),
    initialEpochSet         (false),
-   finalEpochSet           (false)
+   finalEpochSet           (false),
+   targetOriginOffset      (false)
 {
    objectTypes.push_back(Gmat::EVENT_LOCATOR);
    objectTypeNames.push_back("EventLocator");
@@ -221,6 +239,7 @@ EventLocator::EventLocator(const EventLocator& el) :
    runMode                 (el.runMode),
    locatingString          (el.locatingString),
    useEntireInterval       (el.useEntireInterval),
+   searchMethod            (el.searchMethod),
    appendReport            (el.appendReport),
    epochFormat             (el.epochFormat),
    initialEpoch            (el.initialEpoch),
@@ -240,7 +259,8 @@ EventLocator::EventLocator(const EventLocator& el) :
    solarSys                (el.solarSys),
    em                      (NULL),
    initialEpochSet         (el.initialEpochSet),
-   finalEpochSet           (el.finalEpochSet)
+   finalEpochSet           (el.finalEpochSet),
+   targetOriginOffset      (false)
 {
    occultingBodyNames.clear();
    occultingBodies.clear();
@@ -286,6 +306,7 @@ EventLocator& EventLocator::operator=(const EventLocator& el)
       runMode              = el.runMode;
       locatingString       = el.locatingString;
       useEntireInterval    = el.useEntireInterval;
+      searchMethod         = el.searchMethod;
       appendReport         = el.appendReport;
       epochFormat          = el.epochFormat;
       initialEpoch         = el.initialEpoch;
@@ -369,11 +390,12 @@ std::string EventLocator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer EventLocator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < EventLocatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               EventLocatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatBase::GetParameterID(str);
 }
@@ -593,6 +615,8 @@ std::string EventLocator::GetStringParameter(const Integer id) const
    }
    if (id == RUN_MODE)
       return runMode;
+   if (id == SEARCH_METHOD)
+      return searchMethod;
 
    return GmatBase::GetStringParameter(id);
 }
@@ -675,6 +699,29 @@ bool EventLocator::SetStringParameter(const Integer id,
             "RunMode", allowed.c_str());
       throw ee;
    }
+   if (id == SEARCH_METHOD)
+   {
+      for (Integer jj = 0; jj < numSearchMethods; jj++)
+      {
+         if (GmatStringUtil::ToUpper(value) ==
+             GmatStringUtil::ToUpper(SEARCH_METHODS[jj]))
+         {
+            searchMethod = SEARCH_METHODS[jj];
+            return true;
+         }
+      }
+      EventException ee("");
+      std::string allowed = "One of ";
+      for (Integer jj = 0; jj < numSearchMethods; jj++)
+      {
+         allowed += SEARCH_METHODS[jj];
+         if (jj != (numSearchMethods -1))
+            allowed += ", ";
+      }
+      ee.SetDetails(errorMessageFormat.c_str(), value.c_str(),
+            "SearchMethod", allowed.c_str());
+      throw ee;
+   }
    if (id == OCCULTING_BODIES)
    {
       #ifdef DEBUG_EVENTLOCATOR_SET
@@ -1138,6 +1185,12 @@ const StringArray& EventLocator::GetPropertyEnumStrings(const Integer id) const
       for (Integer ii = 0; ii < numModes; ii++)
          enumStrings.push_back(RUN_MODES[ii]);
 
+      return enumStrings;
+   case SEARCH_METHOD:
+      enumStrings.clear();
+      for (Integer ii = 0; ii < numSearchMethods; ii++)
+         enumStrings.push_back(SEARCH_METHODS[ii]);
+
       return enumStrings;
    default:
       return GmatBase::GetPropertyEnumStrings(id);
@@ -1728,6 +1781,12 @@ bool EventLocator::Initialize()
    {
       // Tell the spacecraft to start recording its data
       sat->RecordEphemerisData();
+
+      // The recorded orbit is kept in memory; the SPICE searches also need it
+      // in an SPK kernel
+      em = sat->GetEphemManager();
+      if (em && !CanSearchNatively())
+         em->RequireKernel();
    }
 
    fileWasWritten = false;
@@ -1816,8 +1875,11 @@ void EventLocator::LocateEvents(const std::string &reportNotice)
       Real coverageBegin;
       Real coverageEnd;
       scNow = sat->GetEpoch();
-      em->GetCoverage(initialEp, finalEp, useEntireInterval, true,
-                      findStart, findStop, coverageBegin, coverageEnd);
+      if (UseNativeSearch())
+         GetNativeCoverage(findStart, findStop, coverageBegin, coverageEnd);
+      else
+         em->GetCoverage(initialEp, finalEp, useEntireInterval, true,
+                         findStart, findStop, coverageBegin, coverageEnd);
       #ifdef DEBUG_TIME_SPENT
       Real timeSpent = (Real) (clock() - t);
       MessageInterface::ShowMessage(" --- time spent in GetCoverage = %12.10f (sec)\n",
@@ -2178,3 +2240,263 @@ void EventLocator::SetLocatingString(const std::string &forType)
    locatingString += "Celestial body properties are provided by SPICE kernels.\n";
 }
 
+
+//------------------------------------------------------------------------------
+// bool CanSearchNatively()
+//------------------------------------------------------------------------------
+/**
+ * Determines if the events can be found by EventSearch on the in-memory
+ * trajectory.  The SPICE search is used when it is not selected, or when the
+ * recorded states cannot be used: when they are not in MJ2000Eq axes, or when
+ * the spacecraft also reads input SPK kernels.  The SPICE search needs the
+ * recorded states in an SPK kernel, which is only written when some locator
+ * cannot search natively.
+ *
+ * @return true if the native search can be used
+ */
+//------------------------------------------------------------------------------
+bool EventLocator::CanSearchNatively()
+{
+   if ((searchMethod != "Native") || !em)
+      return false;
+
+   CoordinateSystem *cs = em->GetCoordinateSystem();
+   if (!cs || !cs->AreAxesOfType("MJ2000EqAxes"))
+      return false;
+   if (!sat->GetStringArrayParameter("OrbitSpiceKernelName").empty())
+      return false;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool UseNativeSearch()
+//------------------------------------------------------------------------------
+/**
+ * Determines if the events are found by EventSearch: when it can be used and
+ * states have been recorded.
+ *
+ * @return true to use the native search
+ */
+//------------------------------------------------------------------------------
+bool EventLocator::UseNativeSearch()
+{
+   if (!CanSearchNatively())
+      return false;
+
+   return (em->GetTrajectoryStore()->GetCount() > 1);
+}
+
+//------------------------------------------------------------------------------
+// void GetNativeCoverage(Real &intvlStart, Real &intvlStop,
+//                        Real &cvrStart, Real &cvrStop)
+//------------------------------------------------------------------------------
+/**
+ * Returns the search and coverage intervals of the in-memory trajectory, as
+ * EphemManager::GetCoverage does for the SPK files.
+ *
+ * @param intvlStart The start of the search interval
+ * @param intvlStop  The end of the search interval
+ * @param cvrStart   The first recorded epoch
+ * @param cvrStop    The last recorded epoch
+ */
+//------------------------------------------------------------------------------
+void EventLocator::GetNativeCoverage(Real &intvlStart, Real &intvlStop,
+                                     Real &cvrStart, Real &cvrStop)
+{
+   const TrajectoryStore *store = em->GetTrajectoryStore();
+   cvrStart   = store->GetStartEpoch();
+   cvrStop    = store->GetEndEpoch();
+   intvlStart = cvrStart;
+   intvlStop  = cvrStop;
+
+   if (!useEntireInterval)
+   {
+      intvlStart = (initialEp > cvrStart ? initialEp : cvrStart);
+      intvlStop  = (finalEp   < cvrStop  ? finalEp   : cvrStop);
+      if (intvlStart >= intvlStop)
+      {
+         intvlStart = 0.0;
+         intvlStop  = 0.0;
+      }
+   }
+
+   #ifdef DEBUG_LOCATE_EVENTS
+      MessageInterface::ShowMessage("Native coverage %12.10f to %12.10f, "
+            "searching %12.10f to %12.10f\n", cvrStart, cvrStop, intvlStart,
+            intvlStop);
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// void PrepareTargetTrack(Real start, Real end)
+//------------------------------------------------------------------------------
+/**
+ * Samples the origin of the recorded states when it is not the J2000 body,
+ * so GetTargetState() can return the spacecraft state in MJ2000Eq axes about
+ * the J2000 body, the frame of CelestialBody::GetMJ2000State().
+ *
+ * @param start The first epoch needed
+ * @param end   The last epoch needed
+ */
+//------------------------------------------------------------------------------
+void EventLocator::PrepareTargetTrack(Real start, Real end)
+{
+   SpacePoint *origin = em->GetCoordinateSystem()->GetOrigin();
+   targetOriginTrack.Clear();
+   targetOriginOffset = (origin->GetName() != origin->GetJ2000BodyName());
+   if (targetOriginOffset)
+      SampleBodyTrack(origin, start, end, false, targetOriginTrack);
+}
+
+//------------------------------------------------------------------------------
+// void GetTargetState(Real epoch, Real *state) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the recorded spacecraft state about the J2000 body.
+ *
+ * PrepareTargetTrack() must be called first.  The method only reads stores,
+ * so the native searches call it from their threads.
+ *
+ * @param epoch The A.1 modified Julian epoch
+ * @param state The position (km) and velocity (km/s)
+ */
+//------------------------------------------------------------------------------
+void EventLocator::GetTargetState(Real epoch, Real *state) const
+{
+   em->GetTrajectoryStore()->GetState(epoch, state);
+   if (targetOriginOffset)
+   {
+      Real offset[6];
+      targetOriginTrack.GetState(epoch, offset);
+      for (Integer ii = 0; ii < 6; ii++)
+         state[ii] += offset[ii];
+   }
+}
+
+//------------------------------------------------------------------------------
+// void SampleBodyTrack(SpacePoint *body, Real start, Real end,
+//                      bool withLightTime, TrajectoryStore &track)
+//------------------------------------------------------------------------------
+/**
+ * Samples the MJ2000Eq state of a body every TRACK_STEP seconds.
+ *
+ * The samples extend a step past the interval, and, for light time corrected
+ * lookups, past one and a half times the light time from the spacecraft at
+ * either end, which PrepareTargetTrack() must then have set up.
+ *
+ * @param body          The body sampled
+ * @param start         The first epoch needed
+ * @param end           The last epoch needed
+ * @param withLightTime Extend the samples by the light time
+ * @param track         The samples
+ */
+//------------------------------------------------------------------------------
+void EventLocator::SampleBodyTrack(SpacePoint *body, Real start, Real end,
+                                   bool withLightTime, TrajectoryStore &track)
+{
+   Real margin = TRACK_STEP;
+   if (withLightTime)
+   {
+      Real ends[2] = {start, end};
+      Real scState[6];
+      Real farthest = 0.0;
+      for (Integer ii = 0; ii < 2; ii++)
+      {
+         GetTargetState(ends[ii], scState);
+         Rvector3 pos = body->GetMJ2000Position(A1Mjd(ends[ii]));
+         Real dist = GmatMathUtil::Sqrt(
+               (pos[0] - scState[0]) * (pos[0] - scState[0]) +
+               (pos[1] - scState[1]) * (pos[1] - scState[1]) +
+               (pos[2] - scState[2]) * (pos[2] - scState[2]));
+         if (dist > farthest)
+            farthest = dist;
+      }
+      margin += 1.5 * farthest /
+            (GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM * 0.001);
+   }
+   margin /= GmatTimeConstants::SECS_PER_DAY;
+
+   EventSearch::SampleTrack(
+         [body](Real epoch, Real *state)
+         {
+            Rvector6 st = body->GetMJ2000State(A1Mjd(epoch));
+            for (Integer ii = 0; ii < 6; ii++)
+               state[ii] = st[ii];
+         },
+         start - margin, end + margin, TRACK_STEP, track);
+}
+
+//------------------------------------------------------------------------------
+// bool GetMotionBounds(SpacePoint *center, Real start, Real end,
+//                      Real &minRadius, Real &maxSpeed)
+//------------------------------------------------------------------------------
+/**
+ * Bounds the motion of the spacecraft about a body over an interval, from the
+ * recorded states in it and on either side of it.  The bounds are widened by
+ * BOUND_MARGIN to cover the states between the records.
+ *
+ * @param center    The body
+ * @param start     The start of the interval
+ * @param end       The end of the interval
+ * @param minRadius The smallest distance from the body (km)
+ * @param maxSpeed  The largest speed relative to the body (km/s)
+ *
+ * @return false if there are no recorded states
+ */
+//------------------------------------------------------------------------------
+bool EventLocator::GetMotionBounds(SpacePoint *center, Real start, Real end,
+                                   Real &minRadius, Real &maxSpeed)
+{
+   const TrajectoryStore *store = em->GetTrajectoryStore();
+   Integer count = store->GetCount();
+   if (count < 2)
+      return false;
+
+   PrepareTargetTrack(start, end);
+   TrajectoryStore centerTrack;
+   SampleBodyTrack(center, start, end, false, centerTrack);
+
+   minRadius = GmatRealConstants::REAL_MAX;
+   maxSpeed  = 0.0;
+   Real epoch, next, record[6], offset[6], centerState[6];
+   for (Integer ii = 0; ii < count; ii++)
+   {
+      store->GetRecord(ii, epoch, record);
+      if (ii + 1 < count)
+      {
+         store->GetRecord(ii + 1, next, offset);
+         if (next < start)
+            continue;
+      }
+      if (epoch > end)
+         break;
+
+      if (targetOriginOffset)
+      {
+         targetOriginTrack.GetState(epoch, offset);
+         for (Integer jj = 0; jj < 6; jj++)
+            record[jj] += offset[jj];
+      }
+      centerTrack.GetState(epoch, centerState);
+      Real r2 = 0.0, v2 = 0.0;
+      for (Integer jj = 0; jj < 3; jj++)
+      {
+         r2 += (record[jj] - centerState[jj]) * (record[jj] - centerState[jj]);
+         v2 += (record[jj+3] - centerState[jj+3]) *
+               (record[jj+3] - centerState[jj+3]);
+      }
+      if (GmatMathUtil::Sqrt(r2) < minRadius)
+         minRadius = GmatMathUtil::Sqrt(r2);
+      if (GmatMathUtil::Sqrt(v2) > maxSpeed)
+         maxSpeed = GmatMathUtil::Sqrt(v2);
+
+      // The first record after the interval closes it
+      if (epoch >= end)
+         break;
+   }
+
+   minRadius /= BOUND_MARGIN;
+   maxSpeed  *= BOUND_MARGIN;
+   return true;
+}
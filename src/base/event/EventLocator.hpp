@@ -40,6 +40,7 @@
 #include "CelestialBody.hpp"
 #include "LocatedEvent.hpp"
 #include "PlanetographicRegion.hpp"
+#include "TrajectoryStore.hpp"
 //#include "EphemManager.hpp"
 #include "TimeSystemConverter.hpp"   // for the TimeSystemConverter singleton
 
@@ -181,6 +182,9 @@ protected:
    /// Use the entire time interval (true  - use the entire interval; false,
    /// use the input start and stop epochs)
    bool                        useEntireInterval;
+   /// Search with the CSPICE geometry finder ("SPICE") or with EventSearch
+   /// on the in-memory trajectory ("Native")
+   std::string                 searchMethod;
    /// Append to the report or not (appends if true; creates new report,
    /// renaming existing report, if false)
    bool                        appendReport;
@@ -245,6 +249,11 @@ protected:
    /// Time converter singleton
    TimeSystemConverter *theTimeConverter;
 
+   /// State of the origin of the recorded states, for the native search
+   TrajectoryStore             targetOriginTrack;
+   /// Is the origin of the recorded states away from the J2000 body?
+   bool                        targetOriginOffset;
+
    /// Published parameters for event locators
     enum
     {
@@ -261,6 +270,7 @@ protected:
        WRITE_REPORT,
        RUN_MODE,
        USE_ENTIRE_INTERVAL,
+       SEARCH_METHOD,
        EventLocatorParamCount
     };
 
@@ -272,11 +282,17 @@ protected:
        PARAMETER_TYPE[EventLocatorParamCount - GmatBaseParamCount];
     static const std::string RUN_MODES[3];
     static const Integer numModes;
+    static const std::string SEARCH_METHODS[2];
+    static const Integer numSearchMethods;
     static const std::string defaultFormat;
     static const Real        defaultInitialEpoch;
     static const Real        defaultFinalEpoch;
 
     static const Real STEP_MULTIPLE;
+    /// Spacing of the body and station samples of the native search (s)
+    static const Real TRACK_STEP;
+    /// Factor widening the motion bounds between the recorded states
+    static const Real BOUND_MARGIN;
 
     Real                   EpochToReal(const std::string &ep);
     bool                   OpenReportFile(bool renameOld = true);
@@ -285,6 +301,19 @@ protected:
     virtual std::string    GetNoEventsString(const std::string &forType);
     virtual void           SetLocatingString(const std::string &forType);
     virtual void           FindEvents() = 0;
+
+    virtual bool           CanSearchNatively();
+    bool                   UseNativeSearch();
+    void                   GetNativeCoverage(Real &intvlStart, Real &intvlStop,
+                                             Real &cvrStart, Real &cvrStop);
+    void                   PrepareTargetTrack(Real start, Real end);
+    void                   GetTargetState(Real epoch, Real *state) const;
+    void                   SampleBodyTrack(SpacePoint *body, Real start,
+                                           Real end, bool withLightTime,
+                                           TrajectoryStore &track);
+    bool                   GetMotionBounds(SpacePoint *center, Real start,
+                                           Real end, Real &minRadius,
+                                           Real &maxSpeed);
 };
 
 #endif /* EventLocator_hpp */
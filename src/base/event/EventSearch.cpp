@@ -0,0 +1,557 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                EventSearch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the EventSearch class.
+ */
+//------------------------------------------------------------------------------
+
+#include "EventSearch.hpp"
+#include "GmatConstants.hpp"
+#include "StringUtil.hpp"
+#include <cmath>
+#include <atomic>
+#include <thread>
+#include <exception>
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const Real EventSearch::DEFAULT_TOLERANCE = 1.0e-6;
+
+namespace
+{
+   /// Speed of light, in km/s
+   const Real C_KM_PER_SEC =
+         GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM * 0.001;
+
+   inline Real Dot(const Real *a, const Real *b)
+   {
+      return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+   }
+
+   inline Real Norm(const Real *a)
+   {
+      return std::sqrt(Dot(a, a));
+   }
+
+   inline Real AngleBetween(const Real *a, const Real *b)
+   {
+      Real cross[3] = {a[1] * b[2] - a[2] * b[1],
+                       a[2] * b[0] - a[0] * b[2],
+                       a[0] * b[1] - a[1] * b[0]};
+      // atan2 keeps the precision at small separations
+      return std::atan2(Norm(cross), Dot(a, b));
+   }
+
+   inline Real AngularRadius(Real radius, Real distance)
+   {
+      return (radius >= distance ? GmatMathConstants::PI_OVER_TWO :
+                                   std::asin(radius / distance));
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void FindIntervals(const Condition &isOn, Real start, Real end,
+//       Real stepInSecs, RealArray &starts, RealArray &ends,
+//       Real toleranceInSecs)
+//------------------------------------------------------------------------------
+/**
+ * Finds the intervals in which a condition holds.
+ *
+ * @param isOn            The condition
+ * @param start           Start of the search, A.1 modified Julian
+ * @param end             End of the search, A.1 modified Julian
+ * @param stepInSecs      Sampling step of the condition
+ * @param starts          The starts of the intervals found (appended)
+ * @param ends            The ends of the intervals found (appended)
+ * @param toleranceInSecs Convergence tolerance of the interval ends
+ */
+//------------------------------------------------------------------------------
+void EventSearch::FindIntervals(const Condition &isOn, Real start, Real end,
+                                Real stepInSecs, RealArray &starts,
+                                RealArray &ends, Real toleranceInSecs)
+{
+   if (end <= start)
+      return;
+
+   Real span = (end - start) * GmatTimeConstants::SECS_PER_DAY;
+   Integer steps = (Integer)std::ceil(span / stepInSecs);
+   if (steps < 1)
+      steps = 1;
+   Real tolerance = toleranceInSecs / GmatTimeConstants::SECS_PER_DAY;
+
+   Real previous = start;
+   bool wasOn = isOn(start);
+   if (wasOn)
+      starts.push_back(start);
+
+   for (Integer k = 1; k <= steps; ++k)
+   {
+      Real current = (k == steps ? end :
+                      start + (end - start) * (Real)k / (Real)steps);
+      bool on = isOn(current);
+      if (on != wasOn)
+      {
+         // Bisect, keeping the condition of the earlier end at lo
+         Real lo = previous, hi = current;
+         while (hi - lo > tolerance)
+         {
+            Real mid = 0.5 * (lo + hi);
+            if (isOn(mid) == wasOn)
+               lo = mid;
+            else
+               hi = mid;
+         }
+         if (on)
+            starts.push_back(0.5 * (lo + hi));
+         else
+            ends.push_back(0.5 * (lo + hi));
+         wasOn = on;
+      }
+      previous = current;
+   }
+
+   if (wasOn)
+      ends.push_back(end);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FindBoundedIntervals(const Function &g, Real rateBound, Real start,
+//       Real end, Real minStepInSecs, RealArray &starts, RealArray &ends,
+//       Real toleranceInSecs)
+//------------------------------------------------------------------------------
+/**
+ * Finds the intervals in which a function is positive, stepping by a bound on
+ * its rate of change.
+ *
+ * The function cannot change sign within |g| / rateBound seconds of a sample,
+ * so each step takes that long, but at least minStepInSecs.  No interval, or
+ * gap between intervals, lasting minStepInSecs or more is missed.  The sign
+ * changes are refined by bisection as in FindIntervals().
+ *
+ * @param g               The function, positive while the event is on
+ * @param rateBound       Upper bound of |dg/dt|, per second; 0 steps by
+ *                        minStepInSecs
+ * @param start           Start of the search, A.1 modified Julian
+ * @param end             End of the search, A.1 modified Julian
+ * @param minStepInSecs   Shortest step, the shortest event guaranteed found
+ * @param starts          The starts of the intervals found (appended)
+ * @param ends            The ends of the intervals found (appended)
+ * @param toleranceInSecs Convergence tolerance of the interval ends
+ *
+ * @return The number of samples taken, not counting the bisection
+ */
+//------------------------------------------------------------------------------
+Integer EventSearch::FindBoundedIntervals(const Function &g, Real rateBound,
+      Real start, Real end, Real minStepInSecs, RealArray &starts,
+      RealArray &ends, Real toleranceInSecs)
+{
+   if (end <= start)
+      return 0;
+
+   Real tolerance = toleranceInSecs / GmatTimeConstants::SECS_PER_DAY;
+   Real minStep = minStepInSecs / GmatTimeConstants::SECS_PER_DAY;
+
+   Real previous = start;
+   Real value = g(start);
+   Integer samples = 1;
+   bool wasOn = (value > 0.0);
+   if (wasOn)
+      starts.push_back(start);
+
+   while (previous < end)
+   {
+      Real step = (rateBound > 0.0 ? std::fabs(value) / rateBound /
+                   GmatTimeConstants::SECS_PER_DAY : minStep);
+      if (step < minStep)
+         step = minStep;
+      Real current = (previous + step < end ? previous + step : end);
+      value = g(current);
+      ++samples;
+      bool on = (value > 0.0);
+      if (on != wasOn)
+      {
+         Real lo = previous, hi = current;
+         while (hi - lo > tolerance)
+         {
+            Real mid = 0.5 * (lo + hi);
+            if ((g(mid) > 0.0) == wasOn)
+               lo = mid;
+            else
+               hi = mid;
+         }
+         if (on)
+            starts.push_back(0.5 * (lo + hi));
+         else
+            ends.push_back(0.5 * (lo + hi));
+         wasOn = on;
+      }
+      previous = current;
+   }
+
+   if (wasOn)
+      ends.push_back(end);
+   return samples;
+}
+
+
+//------------------------------------------------------------------------------
+// Real FindMaximum(const Function &f, Real start, Real end, Real stepInSecs,
+//                  Real toleranceInSecs)
+//------------------------------------------------------------------------------
+/**
+ * Finds the epoch of the largest value of a function in an interval,
+ * including its ends.
+ *
+ * The function is sampled at the step, and the best sample is refined by a
+ * golden section search between its neighbours.
+ *
+ * @param f               The function
+ * @param start           Start of the interval, A.1 modified Julian
+ * @param end             End of the interval, A.1 modified Julian
+ * @param stepInSecs      Sampling step of the function
+ * @param toleranceInSecs Convergence tolerance of the epoch
+ *
+ * @return The epoch of the maximum
+ */
+//------------------------------------------------------------------------------
+Real EventSearch::FindMaximum(const Function &f, Real start, Real end,
+                              Real stepInSecs, Real toleranceInSecs)
+{
+   if (end <= start)
+      return start;
+
+   Real span = (end - start) * GmatTimeConstants::SECS_PER_DAY;
+   Integer steps = (Integer)std::ceil(span / stepInSecs);
+   if (steps < 2)
+      steps = 2;
+   Real h = (end - start) / steps;
+
+   Integer best = 0;
+   Real bestValue = f(start);
+   for (Integer k = 1; k <= steps; ++k)
+   {
+      Real value = f(k == steps ? end : start + k * h);
+      if (value > bestValue)
+      {
+         best = k;
+         bestValue = value;
+      }
+   }
+
+   Real lo = (best == 0 ? start : start + (best - 1) * h);
+   Real hi = (best == steps ? end : start + (best + 1) * h);
+   Real bestEpoch = (best == steps ? end : start + best * h);
+
+   const Real ratio = 0.5 * (std::sqrt(5.0) - 1.0);
+   Real tolerance = toleranceInSecs / GmatTimeConstants::SECS_PER_DAY;
+   Real x1 = hi - ratio * (hi - lo), x2 = lo + ratio * (hi - lo);
+   Real f1 = f(x1), f2 = f(x2);
+   while (hi - lo > tolerance)
+   {
+      if (f1 < f2)
+      {
+         lo = x1;
+         x1 = x2;
+         f1 = f2;
+         x2 = lo + ratio * (hi - lo);
+         f2 = f(x2);
+      }
+      else
+      {
+         hi = x2;
+         x2 = x1;
+         f2 = f1;
+         x1 = hi - ratio * (hi - lo);
+         f1 = f(x1);
+      }
+   }
+
+   Real refined = 0.5 * (lo + hi);
+   return (f(refined) > bestValue ? refined : bestEpoch);
+}
+
+
+//------------------------------------------------------------------------------
+// void RunTasks(const std::vector<Task> &tasks, Integer threadCount)
+//------------------------------------------------------------------------------
+/**
+ * Runs independent tasks on a set of threads, the calling one included.
+ *
+ * An exception thrown by a task is rethrown on the calling thread once all of
+ * the tasks are done; when several tasks throw, the exception of the first
+ * one in the list is rethrown.
+ *
+ * @param tasks       The tasks
+ * @param threadCount Number of threads to use; 0 uses one per hardware thread
+ */
+//------------------------------------------------------------------------------
+void EventSearch::RunTasks(const std::vector<Task> &tasks, Integer threadCount)
+{
+   Integer count = (Integer)tasks.size();
+   if (threadCount <= 0)
+      threadCount = (Integer)std::thread::hardware_concurrency();
+   if (threadCount > count)
+      threadCount = count;
+
+   std::vector<std::exception_ptr> errors(count);
+   std::atomic<Integer> next(0);
+   auto worker = [&]()
+   {
+      for (Integer i = next++; i < count; i = next++)
+      {
+         try
+         {
+            tasks[i]();
+         }
+         catch (...)
+         {
+            errors[i] = std::current_exception();
+         }
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (Integer i = 1; i < threadCount; ++i)
+      threads.push_back(std::thread(worker));
+   worker();
+   for (UnsignedInt i = 0; i < threads.size(); ++i)
+      threads[i].join();
+
+   for (Integer i = 0; i < count; ++i)
+      if (errors[i])
+         std::rethrow_exception(errors[i]);
+}
+
+
+//------------------------------------------------------------------------------
+// void SampleTrack(const StateSource &source, Real start, Real end,
+//                  Real stepInSecs, TrajectoryStore &track)
+//------------------------------------------------------------------------------
+/**
+ * Fills a store with the states of a source at evenly spaced epochs, both
+ * ends included.
+ *
+ * @param source     The source of the states
+ * @param start      First epoch, A.1 modified Julian
+ * @param end        Last epoch, A.1 modified Julian
+ * @param stepInSecs Largest spacing of the samples
+ * @param track      The store filled; it is cleared first
+ */
+//------------------------------------------------------------------------------
+void EventSearch::SampleTrack(const StateSource &source, Real start, Real end,
+                              Real stepInSecs, TrajectoryStore &track)
+{
+   track.Clear();
+   Real span = (end - start) * GmatTimeConstants::SECS_PER_DAY;
+   Integer steps = (Integer)std::ceil(span / stepInSecs);
+   if (steps < 1)
+      steps = 1;
+
+   Real state[6];
+   for (Integer k = 0; k <= steps; ++k)
+   {
+      Real epoch = (k == steps ? end :
+                    start + (end - start) * (Real)k / (Real)steps);
+      source(epoch, state);
+      track.AddState(epoch, state);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Correction ParseCorrection(const std::string &abcorr)
+//------------------------------------------------------------------------------
+/**
+ * Decodes a SPICE aberration correction string ("NONE", "LT", "CN", "XCN+S",
+ * ...).
+ *
+ * @param abcorr The correction string
+ *
+ * @return The corrections
+ */
+//------------------------------------------------------------------------------
+EventSearch::Correction EventSearch::ParseCorrection(const std::string &abcorr)
+{
+   std::string flags = GmatStringUtil::ToUpper(GmatStringUtil::Trim(abcorr));
+   Correction correction;
+   correction.transmit  = (!flags.empty() && (flags[0] == 'X'));
+   if (correction.transmit)
+      flags = flags.substr(1);
+   correction.lightTime = ((flags.find("LT") == 0) || (flags.find("CN") == 0));
+   correction.converged = (flags.find("CN") == 0);
+   correction.stellar   = correction.lightTime &&
+                          (flags.find("+S") != std::string::npos);
+   return correction;
+}
+
+
+//------------------------------------------------------------------------------
+// void GetApparentPosition(const StateSource &target, Real epoch,
+//       const Real *observer, const Real *observerVelocity,
+//       const Correction &correction, Real *position)
+//------------------------------------------------------------------------------
+/**
+ * Computes the position of a target relative to an observer, with the
+ * requested corrections.
+ *
+ * @param target           Source of the target states
+ * @param epoch            The observation epoch, A.1 modified Julian
+ * @param observer         Position of the observer at the epoch
+ * @param observerVelocity Velocity of the observer relative to the solar
+ *                         system, used for the stellar aberration
+ * @param correction       The corrections
+ * @param position         The apparent position of the target
+ */
+//------------------------------------------------------------------------------
+void EventSearch::GetApparentPosition(const StateSource &target, Real epoch,
+                                      const Real *observer,
+                                      const Real *observerVelocity,
+                                      const Correction &correction,
+                                      Real *position)
+{
+   Real state[6];
+   target(epoch, state);
+   for (Integer i = 0; i < 3; ++i)
+      position[i] = state[i] - observer[i];
+
+   if (!correction.lightTime)
+      return;
+
+   Real sign = (correction.transmit ? 1.0 : -1.0);
+   Real lightTime = Norm(position) / C_KM_PER_SEC;
+   Integer iterations = (correction.converged ? MAX_LIGHT_TIME_ITERATIONS : 1);
+   for (Integer k = 0; k < iterations; ++k)
+   {
+      target(epoch + sign * lightTime / GmatTimeConstants::SECS_PER_DAY,
+             state);
+      for (Integer i = 0; i < 3; ++i)
+         position[i] = state[i] - observer[i];
+      Real previous = lightTime;
+      lightTime = Norm(position) / C_KM_PER_SEC;
+      if (std::fabs(lightTime - previous) < 1.0e-12)
+         break;
+   }
+
+   if (!correction.stellar)
+      return;
+
+   // Rotate the position toward the observer velocity (away from it when
+   // transmitting) by the aberration angle, as stelab_c does
+   Real distance = Norm(position);
+   if (distance == 0.0)
+      return;
+   Real u[3], v[3], h[3];
+   for (Integer i = 0; i < 3; ++i)
+   {
+      u[i] = position[i] / distance;
+      v[i] = -sign * observerVelocity[i] / C_KM_PER_SEC;
+   }
+   h[0] = u[1] * v[2] - u[2] * v[1];
+   h[1] = u[2] * v[0] - u[0] * v[2];
+   h[2] = u[0] * v[1] - u[1] * v[0];
+   Real sinPhi = Norm(h);
+   if (sinPhi == 0.0)
+      return;
+   Real phi = std::asin(sinPhi < 1.0 ? sinPhi : 1.0);
+   Real k[3] = {h[0] / sinPhi, h[1] / sinPhi, h[2] / sinPhi};
+   Real kCrossP[3] = {k[1] * position[2] - k[2] * position[1],
+                      k[2] * position[0] - k[0] * position[2],
+                      k[0] * position[1] - k[1] * position[0]};
+   Real c = std::cos(phi), s = std::sin(phi);
+   for (Integer i = 0; i < 3; ++i)
+      position[i] = position[i] * c + kCrossP[i] * s;
+}
+
+
+//------------------------------------------------------------------------------
+// OccultationType GetOccultation(const Real *front, Real frontRadius,
+//                                const Real *back, Real backRadius)
+//------------------------------------------------------------------------------
+/**
+ * Classifies the occultation of one sphere by another, as seen by the
+ * observer.
+ *
+ * @param front       Position of the front body relative to the observer
+ * @param frontRadius Radius of the front body
+ * @param back        Position of the back body relative to the observer
+ * @param backRadius  Radius of the back body
+ *
+ * @return The occultation type
+ */
+//------------------------------------------------------------------------------
+EventSearch::OccultationType EventSearch::GetOccultation(const Real *front,
+      Real frontRadius, const Real *back, Real backRadius)
+{
+   Real frontDistance = Norm(front);
+   Real backDistance  = Norm(back);
+   if (frontDistance >= backDistance)
+      return NO_OCCULTATION;
+
+   Real frontSize  = AngularRadius(frontRadius, frontDistance);
+   Real backSize   = AngularRadius(backRadius, backDistance);
+   Real separation = AngleBetween(front, back);
+
+   if (separation >= frontSize + backSize)
+      return NO_OCCULTATION;
+   if (separation + backSize <= frontSize)
+      return FULL_OCCULTATION;
+   if (separation + frontSize <= backSize)
+      return ANNULAR_OCCULTATION;
+   return PARTIAL_OCCULTATION;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsOcculted(const Real *front, Real frontRadius, const Real *target)
+//------------------------------------------------------------------------------
+/**
+ * Checks if a point target is hidden by a sphere, as seen by the observer.
+ *
+ * @param front       Position of the front body relative to the observer
+ * @param frontRadius Radius of the front body
+ * @param target      Position of the target relative to the observer
+ *
+ * @return true if the line of sight to the target crosses the sphere
+ */
+//------------------------------------------------------------------------------
+bool EventSearch::IsOcculted(const Real *front, Real frontRadius,
+                             const Real *target)
+{
+   Real targetDistance = Norm(target);
+   if (targetDistance == 0.0)
+      return false;
+
+   // Closest approach of the line of sight segment to the body center
+   Real along = Dot(front, target) / targetDistance;
+   if (along <= 0.0)
+      return (Norm(front) < frontRadius);
+   if (along >= targetDistance)
+   {
+      Real d[3] = {front[0] - target[0], front[1] - target[1],
+                   front[2] - target[2]};
+      return (Norm(d) < frontRadius);
+   }
+   Real missSquared = Dot(front, front) - along * along;
+   return (missSquared < frontRadius * frontRadius);
+}
@@ -0,0 +1,125 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                EventSearch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the EventSearch class, the native event search used by the
+ * event locators in place of the CSPICE geometry finder.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef EventSearch_hpp
+#define EventSearch_hpp
+
+#include "gmatdefs.hpp"
+#include "TrajectoryStore.hpp"
+#include <functional>
+
+/**
+ * Root finding and geometry for the native event search
+ *
+ * The search follows the CSPICE geometry finder: a condition is sampled at the
+ * locator step, which bounds the shortest event found, and each change of the
+ * condition is refined by bisection to DEFAULT_TOLERANCE.
+ * FindBoundedIntervals() instead steps a continuous event function by a bound
+ * on its rate, which takes long steps far from the events.  The geometry
+ * treats the bodies as spheres of their equatorial radii, and applies the
+ * light time and stellar aberration corrections named by the SPICE
+ * aberration correction strings, so the locators can ask for the corrections
+ * they pass to CSPICE.
+ *
+ * The methods are static and use only their arguments, so the searches of
+ * separate observer and target pairs can run on separate threads through
+ * RunTasks() once the trajectories they read are in TrajectoryStore objects.
+ * The ephemerides of the bodies and the coordinate systems are not safe to
+ * use from several threads; SampleTrack() reads them on the calling thread.
+ */
+class GMAT_API EventSearch
+{
+public:
+   /// A condition of an epoch, true while the event is in progress
+   typedef std::function<bool(Real)>               Condition;
+   /// A function of an epoch
+   typedef std::function<Real(Real)>               Function;
+   /// A state of an epoch, in the frame of the search
+   typedef std::function<void(Real, Real*)>        StateSource;
+   /// A unit of work for RunTasks()
+   typedef std::function<void()>                   Task;
+
+   /// The corrections named by a SPICE aberration correction string
+   struct Correction
+   {
+      /// Use the light time to the target
+      bool        lightTime;
+      /// Iterate the light time to convergence ("CN") instead of once ("LT")
+      bool        converged;
+      /// Transmission case ("X" prefix): the target at the epoch plus the
+      /// light time
+      bool        transmit;
+      /// Correct for the stellar aberration ("+S")
+      bool        stellar;
+   };
+
+   /// The result of an occultation test, named as in gfoclt_c
+   enum OccultationType
+   {
+      NO_OCCULTATION,
+      FULL_OCCULTATION,
+      ANNULAR_OCCULTATION,
+      PARTIAL_OCCULTATION
+   };
+
+   static void       FindIntervals(const Condition &isOn, Real start, Real end,
+                                   Real stepInSecs, RealArray &starts,
+                                   RealArray &ends,
+                                   Real toleranceInSecs = DEFAULT_TOLERANCE);
+   static Integer    FindBoundedIntervals(const Function &g, Real rateBound,
+                                          Real start, Real end,
+                                          Real minStepInSecs,
+                                          RealArray &starts, RealArray &ends,
+                                          Real toleranceInSecs =
+                                                DEFAULT_TOLERANCE);
+   static Real       FindMaximum(const Function &f, Real start, Real end,
+                                 Real stepInSecs,
+                                 Real toleranceInSecs = DEFAULT_TOLERANCE);
+   static void       RunTasks(const std::vector<Task> &tasks,
+                              Integer threadCount = 0);
+
+   static void       SampleTrack(const StateSource &source, Real start,
+                                 Real end, Real stepInSecs,
+                                 TrajectoryStore &track);
+   static Correction ParseCorrection(const std::string &abcorr);
+   static void       GetApparentPosition(const StateSource &target, Real epoch,
+                                         const Real *observer,
+                                         const Real *observerVelocity,
+                                         const Correction &correction,
+                                         Real *position);
+   static OccultationType
+                     GetOccultation(const Real *front, Real frontRadius,
+                                    const Real *back, Real backRadius);
+   static bool       IsOcculted(const Real *front, Real frontRadius,
+                                const Real *target);
+
+   /// Convergence tolerance of the event epochs, in seconds, as in CSPICE
+   static const Real DEFAULT_TOLERANCE;
+   /// Most light time iterations for the converged correction
+   static const Integer MAX_LIGHT_TIME_ITERATIONS = 5;
+};
+
+#endif // EventSearch_hpp
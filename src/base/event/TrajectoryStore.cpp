@@ -0,0 +1,309 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TrajectoryStore
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the TrajectoryStore class.
+ */
+//------------------------------------------------------------------------------
+
+#include "TrajectoryStore.hpp"
+#include "GmatConstants.hpp"
+#include <algorithm>
+
+
+//------------------------------------------------------------------------------
+//  public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// TrajectoryStore()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore::TrajectoryStore()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~TrajectoryStore()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore::~TrajectoryStore()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// TrajectoryStore(const TrajectoryStore &ts)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param ts The store copied
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore::TrajectoryStore(const TrajectoryStore &ts) :
+   epochs      (ts.epochs),
+   states      (ts.states),
+   arcStarts   (ts.arcStarts)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// TrajectoryStore& operator=(const TrajectoryStore &ts)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param ts The store copied
+ *
+ * @return This store
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore& TrajectoryStore::operator=(const TrajectoryStore &ts)
+{
+   if (this != &ts)
+   {
+      epochs    = ts.epochs;
+      states    = ts.states;
+      arcStarts = ts.arcStarts;
+   }
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// bool AddState(Real epoch, const Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Appends a state.
+ *
+ * @param epoch The A.1 modified Julian epoch of the state
+ * @param state The position (km) and velocity (km/s)
+ *
+ * @return false if the epoch is before the last one, and the state was
+ *         ignored
+ */
+//------------------------------------------------------------------------------
+bool TrajectoryStore::AddState(Real epoch, const Real *state)
+{
+   if (!epochs.empty() && (epoch < epochs.back()))
+      return false;
+
+   if (epochs.empty() || (epoch == epochs.back()))
+      arcStarts.push_back((Integer)epochs.size());
+   epochs.push_back(epoch);
+   states.insert(states.end(), state, state + 6);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetState(Real epoch, Real *state) const
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the state at an epoch.
+ *
+ * @param epoch The A.1 modified Julian epoch
+ * @param state The interpolated position (km) and velocity (km/s)
+ *
+ * @return false if the store is empty
+ */
+//------------------------------------------------------------------------------
+bool TrajectoryStore::GetState(Real epoch, Real *state) const
+{
+   if (epochs.empty())
+      return false;
+
+   Integer size;
+   Integer first = FindWindow(epoch, size);
+
+   // Hermite divided differences on doubled nodes, in seconds from the epoch
+   // of the first state of the window
+   Real z[2 * WINDOW_SIZE], d[2 * WINDOW_SIZE];
+   Integer n = 2 * size;
+   Real t0 = epochs[first];
+   for (Integer k = 0; k < size; ++k)
+      z[2*k] = z[2*k+1] = (epochs[first + k] - t0) *
+                          GmatTimeConstants::SECS_PER_DAY;
+   Real x = (epoch - t0) * GmatTimeConstants::SECS_PER_DAY;
+
+   for (Integer c = 0; c < 3; ++c)
+   {
+      for (Integer k = 0; k < size; ++k)
+         d[2*k] = d[2*k+1] = states[6 * (first + k) + c];
+
+      // First differences use the velocities at the doubled nodes
+      for (Integer i = n - 1; i > 0; --i)
+      {
+         if (i % 2 == 1)
+            d[i] = states[6 * (first + i / 2) + c + 3];
+         else
+            d[i] = (d[i] - d[i-1]) / (z[i] - z[i-1]);
+      }
+      for (Integer j = 2; j < n; ++j)
+         for (Integer i = n - 1; i >= j; --i)
+            d[i] = (d[i] - d[i-1]) / (z[i] - z[i-j]);
+
+      // Newton form and its derivative
+      Real p = d[n-1], dp = 0.0;
+      for (Integer j = n - 2; j >= 0; --j)
+      {
+         dp = dp * (x - z[j]) + p;
+         p  = p * (x - z[j]) + d[j];
+      }
+      state[c]   = p;
+      state[c+3] = dp;
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes the states.
+ */
+//------------------------------------------------------------------------------
+void TrajectoryStore::Clear()
+{
+   epochs.clear();
+   states.clear();
+   arcStarts.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of states held.
+ *
+ * @return The count
+ */
+//------------------------------------------------------------------------------
+Integer TrajectoryStore::GetCount() const
+{
+   return (Integer)epochs.size();
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetRecord(Integer index, Real &epoch, Real *state) const
+//------------------------------------------------------------------------------
+/**
+ * Returns a stored state as it was added.
+ *
+ * @param index The index of the state, from 0 to GetCount() - 1
+ * @param epoch The A.1 modified Julian epoch of the state
+ * @param state The position (km) and velocity (km/s)
+ *
+ * @return false if the index is out of range
+ */
+//------------------------------------------------------------------------------
+bool TrajectoryStore::GetRecord(Integer index, Real &epoch, Real *state) const
+{
+   if ((index < 0) || (index >= (Integer)epochs.size()))
+      return false;
+
+   epoch = epochs[index];
+   std::copy(states.begin() + 6 * index, states.begin() + 6 * index + 6, state);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetStartEpoch() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the epoch of the first state.
+ *
+ * @return The epoch, or 0.0 if the store is empty
+ */
+//------------------------------------------------------------------------------
+Real TrajectoryStore::GetStartEpoch() const
+{
+   return (epochs.empty() ? 0.0 : epochs.front());
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetEndEpoch() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the epoch of the last state.
+ *
+ * @return The epoch, or 0.0 if the store is empty
+ */
+//------------------------------------------------------------------------------
+Real TrajectoryStore::GetEndEpoch() const
+{
+   return (epochs.empty() ? 0.0 : epochs.back());
+}
+
+
+//------------------------------------------------------------------------------
+//  protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Integer FindWindow(Real epoch, Integer &size) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the interpolation window, which centers the interval holding the
+ * epoch when the arc allows it.
+ *
+ * @param epoch The A.1 modified Julian epoch
+ * @param size  The number of states in the window
+ *
+ * @return The index of the first state of the window
+ */
+//------------------------------------------------------------------------------
+Integer TrajectoryStore::FindWindow(Real epoch, Integer &size) const
+{
+   // Index of the first epoch after the requested one
+   Integer upper = (Integer)(std::upper_bound(epochs.begin(), epochs.end(),
+                                              epoch) - epochs.begin());
+
+   // The arc holding the last epoch not after the requested one
+   Integer last = (upper > 0 ? upper - 1 : 0);
+   Integer arc = (Integer)(std::upper_bound(arcStarts.begin(), arcStarts.end(),
+                                            last) - arcStarts.begin()) - 1;
+   Integer arcStart = arcStarts[arc];
+   Integer arcEnd = (arc + 1 < (Integer)arcStarts.size() ?
+                     arcStarts[arc + 1] : (Integer)epochs.size());
+
+   size = std::min(WINDOW_SIZE, arcEnd - arcStart);
+   Integer first = upper - size / 2;
+   if (first > arcEnd - size)
+      first = arcEnd - size;
+   if (first < arcStart)
+      first = arcStart;
+   return first;
+}
@@ -0,0 +1,81 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TrajectoryStore
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the TrajectoryStore class, an in-memory ephemeris used by the
+ * native event search.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef TrajectoryStore_hpp
+#define TrajectoryStore_hpp
+
+#include "gmatdefs.hpp"
+
+/**
+ * Time ordered Cartesian states held in memory
+ *
+ * The states are interpolated the way the SPK files written for event
+ * location are: a Hermite polynomial through the positions and velocities of
+ * the WINDOW_SIZE states around the requested epoch, which is of degree 7 when
+ * the arc holds at least four states.  Epochs before the first state or
+ * after the last one are extrapolated from the end window, which keeps the
+ * light time corrected lookups at the ends of the data usable.
+ *
+ * A state at the epoch of the last one starts a new arc, as the states after
+ * an impulsive maneuver do; the windows never cross the start of an arc, so
+ * the velocity change is not smoothed over the neighbouring states.
+ *
+ * The store is filled while the mission runs and read when events are
+ * located.  Reads do not change the object, so any number of threads can read
+ * a store that is not being filled.
+ */
+class GMAT_API TrajectoryStore
+{
+public:
+   TrajectoryStore();
+   virtual ~TrajectoryStore();
+   TrajectoryStore(const TrajectoryStore &ts);
+   TrajectoryStore& operator=(const TrajectoryStore &ts);
+
+   bool           AddState(Real epoch, const Real *state);
+   bool           GetState(Real epoch, Real *state) const;
+   void           Clear();
+
+   Integer        GetCount() const;
+   bool           GetRecord(Integer index, Real &epoch, Real *state) const;
+   Real           GetStartEpoch() const;
+   Real           GetEndEpoch() const;
+
+   /// Number of states the interpolating polynomial passes through
+   static const Integer WINDOW_SIZE = 4;
+
+protected:
+   /// The A.1 modified Julian epochs, equal only at the start of an arc
+   RealArray      epochs;
+   /// The states, 6 per epoch
+   RealArray      states;
+   /// Index of the first state of each arc
+   IntegerArray   arcStarts;
+
+   Integer        FindWindow(Real epoch, Integer &size) const;
+};
+
+#endif // TrajectoryStore_hpp
@@ -61,6 +61,7 @@
 #include "CalculatedPointFactory.hpp"
 #include "MathFactory.hpp"
 #include "PlanetographicRegionFactory.hpp"
+#include "DeferredFactory.hpp"
 //#include "SpaceMeshFactory.hpp"
 #include "Interface.hpp"
 #include "XyPlot.hpp"
@@ -78,6 +79,8 @@
 #include "ObjectReferencedAxes.hpp"
 #include "ParameterInfo.hpp"        // for ParameterInfo
 #include "MessageInterface.hpp"
+#include "Profiler.hpp"             // for WriteReport()
+#include "MemoryTracker.hpp"         // for GetTelemetrySummary()
 #include "CommandUtil.hpp"          // for GetCommandSeq()
 #include "StringTokenizer.hpp"      // for StringTokenizer
 #include "StringUtil.hpp"           // for GmatStringUtil::
@@ -86,6 +89,8 @@
 #include <algorithm>                // for sort(), set_difference()
 #include <ctime>                    // for clock()
 #include <errno.h>                 
+#include <fstream>                  // for ifstream
+#include <functional>               // for hash
 
 #include <chrono>
 
@@ -93,9 +98,7 @@
    #include <iostream>              // to detect GUI plugins
 #endif
 
-#ifdef CREATE_OUTPUT_FOLDER
-#include <sys/stat.h>               // for mkdir
-#endif
+#include <sys/stat.h>               // for mkdir, stat
 
 //#define DEBUG_ONLY_FOR_SCRIPT
 //#define DEBUG_ONLY_FOR_FUNCTION
@@ -159,9 +162,6 @@
 //#define DEBUG_MEMORY
 //#endif
 
-#ifdef DEBUG_MEMORY
-#include "MemoryTracker.hpp"
-#endif
 
 // @note If this is enabled, Bug1430-Func_GFuncInsideCFlow.script leaves
 // no memory tracks but AssigningWholeObjects.script crashes when exiting
@@ -561,6 +561,16 @@ void Moderator::Finalize()
          delete userResources[i];
       userResources.clear();
 
+      // Delete the factories of deferred plug-ins that were never claimed
+      std::map<std::string, std::vector<Factory*> >::iterator df;
+      for (df = deferredPluginFactories.begin();
+           df != deferredPluginFactories.end(); ++df)
+      {
+         for (UnsignedInt j = 0; j < df->second.size(); ++j)
+            delete df->second[j];
+      }
+      deferredPluginFactories.clear();
+      
       // Close out the plug-in libraries
       std::map<std::string, DynamicLibrary*>::iterator i;
       for (i = userLibraries.begin(); i != userLibraries.end(); ++i)
@@ -840,6 +850,12 @@ bool Moderator::CloseMatlabEngine()
  * The GMAT startup file may list one or more plug-in libraries by name.  This 
  * method retrieves the list of libraries, and loads them into GMAT.
  * 
+ * When LAZY_PLUGIN_LOADING is on in the startup file, libraries recorded in
+ * the plug-in manifest with only factories in them are not loaded here.
+ * Stand-in factories report their types, and load the library when the first
+ * object of one of those types is created.  Libraries that are new or have
+ * changed since the manifest was written are loaded and recorded.
+ *
  * @note The current code looks for exactly one library -- the VF13ad library --
  *       and loads it into GMAT if found.  The generic updates for any user 
  *       library will be added in a later build.
@@ -848,11 +864,18 @@ bool Moderator::CloseMatlabEngine()
 void Moderator::LoadPlugins()
 {
    StringArray pluginList = theFileManager->GetPluginList();
+   bool loadOnFirstUse = GmatGlobal::Instance()->IsLazyPluginLoading();
+   
+   if (loadOnFirstUse)
+      ReadPluginManifest();
 
    // This is done for all plugins in the startup file
    for (StringArray::const_iterator i = pluginList.begin(); 
          i != pluginList.end(); ++i)
    {
+      // Plug-ins in the manifest are loaded when their types are first used
+      if (loadOnFirstUse && RegisterDeferredPlugin(*i))
+         continue;
 
       #ifndef __WIN32__
    
@@ -873,6 +896,9 @@ void Moderator::LoadPlugins()
       #endif
    }
    
+   if (loadOnFirstUse && pluginManifestChanged)
+      WritePluginManifest();
+   
    if (theUiInterpreter != NULL)
       theUiInterpreter->BuildCreatableObjectMaps();
    if (theScriptInterpreter)
@@ -936,6 +962,8 @@ void Moderator::LoadAPlugin(std::string pluginName)
             {
                MessageInterface::ShowMessage("Skipping \"%s\": GUI plugins are "
                      "skipped in console mode\n", pluginName.c_str());
+               if (GmatGlobal::Instance()->IsLazyPluginLoading())
+                  RecordPlugin(pluginName, NULL, std::vector<Factory*>(), true);
                return;
             }
          }
@@ -947,6 +975,7 @@ void Moderator::LoadAPlugin(std::string pluginName)
    if (theLib != NULL)
    {
       Integer fc = theLib->GetFactoryCount();
+      std::vector<Factory*> registeredFactories;
 
       if (fc > 0)
       {
@@ -970,6 +999,7 @@ void Moderator::LoadAPlugin(std::string pluginName)
                         "Factory Manager.\n", i, pluginName.c_str());
                else
                {
+                  registeredFactories.push_back(newFactory);
                   #ifdef DEBUG_PLUGIN_REGISTRATION
                      MessageInterface::ShowMessage(
                         "Factory %d in library %s is now registered with the "
@@ -1052,6 +1082,9 @@ void Moderator::LoadAPlugin(std::string pluginName)
          GuiFactory *guiFact = theLib->GetGuiFactory(i);
          pluginGuiFactories.push_back(guiFact);
       }
+      
+      if (GmatGlobal::Instance()->IsLazyPluginLoading())
+         RecordPlugin(pluginName, theLib, registeredFactories, false);
    }
    else
    {
@@ -1105,6 +1138,363 @@ void Moderator::LoadAPlugin(std::string pluginName)
    }
 }
 
+//------------------------------------------------------------------------------
+// Factory* LoadDeferredFactory(const std::string &pluginName, Integer index)
+//------------------------------------------------------------------------------
+/**
+ * Loads a plug-in library registered from the manifest, and returns one of
+ * its factories.
+ *
+ * This is the loader of the DeferredFactory stand-ins.  The library is loaded
+ * by the first stand-in that needs it; its factories wait here until the
+ * stand-in for each claims it.
+ *
+ * @param pluginName The plug-in library name, as listed in the startup file
+ * @param index      The index of the factory in the library
+ *
+ * @return The factory, now owned by the caller, or NULL if it is not available
+ */
+//------------------------------------------------------------------------------
+Factory* Moderator::LoadDeferredFactory(const std::string &pluginName,
+                                        Integer index)
+{
+   Moderator *theModerator = Moderator::Instance();
+   std::map<std::string, std::vector<Factory*> >::iterator entry =
+      theModerator->deferredPluginFactories.find(pluginName);
+   
+   if (entry == theModerator->deferredPluginFactories.end())
+   {
+      MessageInterface::ShowMessage("Loading \"%s\" for its first object\n",
+                                    pluginName.c_str());
+      
+      std::vector<Factory*> factories;
+      DynamicLibrary *theLib = theModerator->LoadLibrary(pluginName);
+      if (theLib != NULL)
+      {
+         Integer fc = theLib->GetFactoryCount();
+         for (Integer i = 0; i < fc; ++i)
+            factories.push_back(theLib->GetGmatFactory(i));
+      }
+      entry = theModerator->deferredPluginFactories.insert(
+            std::make_pair(pluginName, factories)).first;
+   }
+   
+   Factory *theFactory = NULL;
+   if ((index >= 0) && (index < (Integer)entry->second.size()))
+   {
+      theFactory = entry->second[index];
+      entry->second[index] = NULL;
+   }
+   
+   return theFactory;
+}
+
+
+//------------------------------------------------------------------------------
+// bool RegisterDeferredPlugin(const std::string &pluginName)
+//------------------------------------------------------------------------------
+/**
+ * Registers stand-in factories for a plug-in library recorded in the manifest.
+ *
+ * @param pluginName The plug-in library name, as listed in the startup file
+ *
+ * @return true if the library needs no loading now, false if it has to be
+ *         loaded with LoadAPlugin()
+ */
+//------------------------------------------------------------------------------
+bool Moderator::RegisterDeferredPlugin(const std::string &pluginName)
+{
+   std::map<std::string, PluginManifestEntry>::iterator entry =
+      pluginManifest.find(pluginName);
+   if (entry == pluginManifest.end())
+      return false;
+   
+   const PluginManifestEntry &plugin = entry->second;
+   if ((plugin.fileStamp == "") ||
+       (plugin.fileStamp != GetPluginFileStamp(pluginName)))
+   {
+      #ifdef DEBUG_PLUGIN_REGISTRATION
+         MessageInterface::ShowMessage("Plug-in \"%s\" changed since the "
+               "manifest was written\n", pluginName.c_str());
+      #endif
+      pluginManifest.erase(entry);
+      pluginManifestChanged = true;
+      return false;
+   }
+   
+   if (plugin.isGuiPlugin)
+   {
+      if (isFromGui)
+         return false;
+      MessageInterface::ShowMessage("Skipping \"%s\": GUI plugins are "
+            "skipped in console mode\n", pluginName.c_str());
+      return true;
+   }
+   
+   if (!plugin.canDefer)
+      return false;
+   
+   for (UnsignedInt i = 0; i < plugin.factories.size(); ++i)
+   {
+      const PluginFactoryEntry &fact = plugin.factories[i];
+      theFactoryManager->RegisterFactory(new DeferredFactory(fact.factoryType,
+            fact.creatables, fact.unviewables, fact.sequenceStarters,
+            fact.isCaseSensitive, pluginName, i, LoadDeferredFactory));
+   }
+   
+   #ifdef DEBUG_PLUGIN_REGISTRATION
+      MessageInterface::ShowMessage("Plug-in \"%s\" will load on first use; "
+            "%d stand-in factories registered\n", pluginName.c_str(),
+            plugin.factories.size());
+   #endif
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void RecordPlugin(const std::string &pluginName, DynamicLibrary *theLib,
+//       const std::vector<Factory*> &factories, bool isGui)
+//------------------------------------------------------------------------------
+/**
+ * Records a loaded plug-in library in the manifest.
+ *
+ * Libraries can wait for their first use if they only provide factories.
+ * Libraries with trigger managers, GUI components or Parameters, which
+ * register their Parameters when built, are loaded on startup.
+ *
+ * @param pluginName The plug-in library name, as listed in the startup file
+ * @param theLib     The loaded library, or NULL for a skipped GUI library
+ * @param factories  The factories registered from the library
+ * @param isGui      True for libraries of GUI components
+ */
+//------------------------------------------------------------------------------
+void Moderator::RecordPlugin(const std::string &pluginName,
+                             DynamicLibrary *theLib,
+                             const std::vector<Factory*> &factories,
+                             bool isGui)
+{
+   PluginManifestEntry plugin;
+   plugin.fileStamp = GetPluginFileStamp(pluginName);
+   if (plugin.fileStamp == "")
+      return;
+   
+   // Entries left by RegisterDeferredPlugin() are current
+   std::map<std::string, PluginManifestEntry>::iterator entry =
+      pluginManifest.find(pluginName);
+   if ((entry != pluginManifest.end()) &&
+       (entry->second.fileStamp == plugin.fileStamp))
+      return;
+   
+   plugin.isGuiPlugin = isGui;
+   plugin.canDefer = false;
+   if (theLib != NULL)
+   {
+      plugin.canDefer = !factories.empty() &&
+            ((Integer)factories.size() == theLib->GetFactoryCount()) &&
+            (theLib->GetTriggerManagerCount() == 0) &&
+            (theLib->GetMenuEntryCount() == 0) &&
+            (theLib->GetGuiFactoryCount() == 0);
+      
+      for (UnsignedInt i = 0; i < factories.size(); ++i)
+      {
+         PluginFactoryEntry fact;
+         fact.factoryType = factories[i]->GetFactoryType();
+         fact.isCaseSensitive = factories[i]->IsTypeCaseSensitive();
+         fact.creatables = factories[i]->GetListOfCreatableObjects();
+         fact.unviewables = factories[i]->GetListOfUnviewableObjects();
+         fact.sequenceStarters =
+               factories[i]->GetListOfCreatableObjects("SequenceStarters");
+         if (fact.factoryType == Gmat::PARAMETER)
+            plugin.canDefer = false;
+         plugin.factories.push_back(fact);
+      }
+   }
+   
+   pluginManifest[pluginName] = plugin;
+   pluginManifestChanged = true;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetPluginFileStamp(const std::string &pluginName)
+//------------------------------------------------------------------------------
+/**
+ * Returns the size and modification time of a plug-in library file, or an
+ * empty string if the file is not found at the startup file path.
+ */
+//------------------------------------------------------------------------------
+std::string Moderator::GetPluginFileStamp(const std::string &pluginName)
+{
+   #if defined(_WIN32)
+      std::string fileName = pluginName + ".dll";
+   #elif defined(__APPLE__)
+      std::string fileName = pluginName + ".dylib";
+   #else
+      std::string fileName = pluginName + ".so";
+   #endif
+   
+   struct stat fileStatus;
+   if (stat(fileName.c_str(), &fileStatus) != 0)
+      return "";
+   
+   std::stringstream stamp;
+   stamp << (long long)fileStatus.st_size << " "
+         << (long long)fileStatus.st_mtime;
+   return stamp.str();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetPluginManifestFileName()
+//------------------------------------------------------------------------------
+/**
+ * Returns the name of the plug-in manifest file, in the output directory.
+ */
+//------------------------------------------------------------------------------
+std::string Moderator::GetPluginManifestFileName()
+{
+   return theFileManager->GetAbsPathname("OUTPUT_PATH") +
+         "gmat_plugin_manifest.txt";
+}
+
+
+//------------------------------------------------------------------------------
+// void ReadPluginManifest()
+//------------------------------------------------------------------------------
+/**
+ * Reads the plug-in manifest file, if there is one.
+ *
+ * The file has a block of lines for each library:
+ *
+ *    PLUGIN <name from the startup file>
+ *    STAMP <file size> <modification time>
+ *    FLAGS <can defer 0|1> <GUI plug-in 0|1>
+ *
+ * followed by a block for each of its factories:
+ *
+ *    FACTORY <factory type> <case sensitive 0|1>
+ *    CREATABLES <type names>
+ *    UNVIEWABLES <type names>
+ *    STARTERS <type names>
+ */
+//------------------------------------------------------------------------------
+void Moderator::ReadPluginManifest()
+{
+   pluginManifest.clear();
+   pluginManifestChanged = false;
+   
+   std::ifstream manifest(GetPluginManifestFileName().c_str());
+   if (!manifest)
+   {
+      pluginManifestChanged = true;
+      return;
+   }
+   
+   PluginManifestEntry *plugin = NULL;
+   PluginFactoryEntry *fact = NULL;
+   std::string line, keyword;
+   while (std::getline(manifest, line))
+   {
+      std::istringstream items(line);
+      if (!(items >> keyword) || (keyword[0] == '#'))
+         continue;
+      
+      if (keyword == "PLUGIN")
+      {
+         std::string name = GmatStringUtil::Trim(line.substr(6));
+         plugin = &pluginManifest[name];
+         plugin->canDefer = false;
+         plugin->isGuiPlugin = false;
+         plugin->factories.clear();
+         fact = NULL;
+      }
+      else if (plugin == NULL)
+         continue;
+      else if (keyword == "STAMP")
+         plugin->fileStamp = GmatStringUtil::Trim(line.substr(5));
+      else if (keyword == "FLAGS")
+         items >> plugin->canDefer >> plugin->isGuiPlugin;
+      else if (keyword == "FACTORY")
+      {
+         plugin->factories.push_back(PluginFactoryEntry());
+         fact = &plugin->factories.back();
+         fact->factoryType = Gmat::UNKNOWN_OBJECT;
+         fact->isCaseSensitive = true;
+         items >> fact->factoryType >> fact->isCaseSensitive;
+      }
+      else if (fact != NULL)
+      {
+         StringArray *names = NULL;
+         if (keyword == "CREATABLES")
+            names = &fact->creatables;
+         else if (keyword == "UNVIEWABLES")
+            names = &fact->unviewables;
+         else if (keyword == "STARTERS")
+            names = &fact->sequenceStarters;
+         
+         std::string name;
+         while ((names != NULL) && (items >> name))
+            names->push_back(name);
+      }
+   }
+   
+   #ifdef DEBUG_PLUGIN_REGISTRATION
+      MessageInterface::ShowMessage("Read %d plug-ins from the manifest\n",
+            pluginManifest.size());
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void WritePluginManifest()
+//------------------------------------------------------------------------------
+/**
+ * Writes the plug-in manifest file described in ReadPluginManifest().
+ */
+//------------------------------------------------------------------------------
+void Moderator::WritePluginManifest()
+{
+   std::string fileName = GetPluginManifestFileName();
+   std::ofstream manifest(fileName.c_str());
+   if (!manifest)
+   {
+      MessageInterface::ShowMessage("*** Unable to write the plug-in manifest "
+            "file \"%s\"\n", fileName.c_str());
+      return;
+   }
+   
+   manifest << "# GMAT plug-in manifest; rebuilt when a plug-in changes\n";
+   std::map<std::string, PluginManifestEntry>::const_iterator i;
+   for (i = pluginManifest.begin(); i != pluginManifest.end(); ++i)
+   {
+      const PluginManifestEntry &plugin = i->second;
+      manifest << "PLUGIN " << i->first << "\n"
+               << "STAMP " << plugin.fileStamp << "\n"
+               << "FLAGS " << plugin.canDefer << " " << plugin.isGuiPlugin
+               << "\n";
+      
+      for (UnsignedInt j = 0; j < plugin.factories.size(); ++j)
+      {
+         const PluginFactoryEntry &fact = plugin.factories[j];
+         manifest << "FACTORY " << fact.factoryType << " "
+                  << fact.isCaseSensitive << "\nCREATABLES";
+         for (UnsignedInt k = 0; k < fact.creatables.size(); ++k)
+            manifest << " " << fact.creatables[k];
+         manifest << "\nUNVIEWABLES";
+         for (UnsignedInt k = 0; k < fact.unviewables.size(); ++k)
+            manifest << " " << fact.unviewables[k];
+         manifest << "\nSTARTERS";
+         for (UnsignedInt k = 0; k < fact.sequenceStarters.size(); ++k)
+            manifest << " " << fact.sequenceStarters[k];
+         manifest << "\n";
+      }
+   }
+   
+   pluginManifestChanged = false;
+}
+
+
 //------------------------------------------------------------------------------
 // Dynamic library specific code
 //------------------------------------------------------------------------------
@@ -7252,6 +7642,11 @@ Integer Moderator::RunMission(Integer sandboxNum)
    long int millis1 =
          std::chrono::duration_cast<std::chrono::milliseconds>
          (time1.time_since_epoch()).count();
+   
+   if (Profiler::IsEnabled())
+      Profiler::Reset();
+   if (MemoryTracker::IsCounting())
+      MemoryTracker::Instance()->ResetCommandCounts();
 
    #ifdef DEBUG_TIME_SYSTEM
       // What is the epoch time?
@@ -7454,6 +7849,24 @@ Integer Moderator::RunMission(Integer sandboxNum)
    
    MessageInterface::ShowMessage
       ("===> Total Run Time: %.3lf seconds\n", (ms/1000));
+   
+   if (Profiler::IsEnabled())
+   {
+      std::string profileFile = Profiler::GetReportFile();
+      if (GmatFileUtil::ParsePathName(profileFile) == "")
+         profileFile = theFileManager->GetFullPathname(FileManager::OUTPUT_PATH)
+               + profileFile;
+      if (Profiler::WriteReport(profileFile))
+         MessageInterface::ShowMessage("===> Profile written to %s\n",
+               profileFile.c_str());
+      else
+         MessageInterface::ShowMessage("*** WARNING *** Unable to write the "
+               "profile to %s\n", profileFile.c_str());
+   }
+   
+   if (MemoryTracker::IsCounting())
+      MessageInterface::ShowMessage("%s",
+            MemoryTracker::Instance()->GetTelemetrySummary().c_str());
 
    #ifdef DEBUG_MEMORY
    StringArray tracks = MemoryTracker::Instance()->GetTracks(false, false);
@@ -7672,6 +8085,19 @@ bool Moderator::InterpretScript(const std::string &filename, bool readBack,
    endOfInterpreter = false;
    runState = Gmat::IDLE;
    
+   // The configuration read last time can run again if nothing changed since
+   if (reuseUnchangedScript && !readBack && IsScriptUnchanged(filename))
+   {
+      MessageInterface::ShowMessage
+         ("\nReusing the interpreted scripts; the file is unchanged.\n"
+          "***** file: " + filename + "\n");
+      isRunReady = true;
+      endOfInterpreter = true;
+      return true;
+   }
+   interpretedScriptFiles.clear();
+   interpretedScriptHashes.clear();
+   
    // If the log file is from a previously-read script in this session,
    // reset the log file to the one specified in the startup file
    GmatGlobal *gg    = GmatGlobal::Instance();
@@ -7858,6 +8284,9 @@ bool Moderator::InterpretScript(const std::string &filename, bool readBack,
 
    }
    
+   if (isGoodScript && reuseUnchangedScript && !readBack)
+      SaveScriptFileHashes();
+   
    #if DEBUG_INTERPRET
    MessageInterface::ShowMessage
       ("Moderator::InterpretScript() returning isGoodScript=%d\n", isGoodScript);
@@ -7866,6 +8295,27 @@ bool Moderator::InterpretScript(const std::string &filename, bool readBack,
    return isGoodScript;
 }
 
+
+//------------------------------------------------------------------------------
+// void SetReuseUnchangedScript(bool reuse)
+//------------------------------------------------------------------------------
+/**
+ * Sets whether InterpretScript() keeps the configuration when asked to read
+ * the script it read last, and neither that script, its include files nor the
+ * configuration have changed since.
+ *
+ * A run leaves the configured objects and command sequence as they were
+ * interpreted, so the kept configuration runs as a freshly read one would.
+ * This spares batch runs of the same script from reinterpreting it.
+ */
+//------------------------------------------------------------------------------
+void Moderator::SetReuseUnchangedScript(bool reuse)
+{
+   reuseUnchangedScript = reuse;
+   interpretedScriptFiles.clear();
+   interpretedScriptHashes.clear();
+}
+
 //------------------------------------------------------------------------------
 // void ClearScript()
 //------------------------------------------------------------------------------
@@ -8155,6 +8605,75 @@ void Moderator::CreateTimeFile()
 
 
 // prepare next script reading
+//------------------------------------------------------------------------------
+// bool IsScriptUnchanged(const std::string &filename)
+//------------------------------------------------------------------------------
+/**
+ * Checks if the script is the one interpreted last, with the same contents in
+ * it and its include files, and the configuration has not changed since.
+ */
+//------------------------------------------------------------------------------
+bool Moderator::IsScriptUnchanged(const std::string &filename)
+{
+   if (interpretedScriptFiles.empty() || filename != interpretedScriptFiles[0])
+      return false;
+   
+   if (HasConfigurationChanged())
+      return false;
+   
+   for (UnsignedInt i = 0; i < interpretedScriptFiles.size(); ++i)
+   {
+      if (GetFileHash(interpretedScriptFiles[i]) != interpretedScriptHashes[i])
+      {
+         #if DEBUG_INTERPRET
+         MessageInterface::ShowMessage
+            ("Moderator::IsScriptUnchanged() '%s' changed\n",
+             interpretedScriptFiles[i].c_str());
+         #endif
+         return false;
+      }
+   }
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void SaveScriptFileHashes()
+//------------------------------------------------------------------------------
+/**
+ * Saves the names and content hashes of the files of the script just
+ * interpreted, for IsScriptUnchanged().
+ */
+//------------------------------------------------------------------------------
+void Moderator::SaveScriptFileHashes()
+{
+   interpretedScriptFiles = theScriptInterpreter->GetScriptFilesRead();
+   interpretedScriptHashes.clear();
+   for (UnsignedInt i = 0; i < interpretedScriptFiles.size(); ++i)
+      interpretedScriptHashes.push_back(GetFileHash(interpretedScriptFiles[i]));
+}
+
+
+//------------------------------------------------------------------------------
+// std::size_t GetFileHash(const std::string &filename)
+//------------------------------------------------------------------------------
+/**
+ * Returns a hash of the file contents, or 0 if the file cannot be read.
+ */
+//------------------------------------------------------------------------------
+std::size_t Moderator::GetFileHash(const std::string &filename)
+{
+   std::ifstream file(filename.c_str(), std::ios::binary);
+   if (!file)
+      return 0;
+   
+   std::stringstream contents;
+   contents << file.rdbuf();
+   return std::hash<std::string>()(contents.str());
+}
+
+
 //------------------------------------------------------------------------------
 // void PrepareNextScriptReading(bool clearObjs = true)
 //------------------------------------------------------------------------------
@@ -11079,6 +11598,8 @@ Moderator::Moderator()
    objectManageOption = 1;
    currentSandboxNumber = 1;
    mainScriptFileName = "";
+   reuseUnchangedScript = false;
+   pluginManifestChanged = false;
    theMatlabInterface = NULL;
    
    // The motivation of adding this data member was due to Parameter creation
@@ -445,6 +445,7 @@ public:
    bool InterpretScript(const std::string &filename, bool readBack = false,
                         const std::string &newPath = "");
    bool InterpretScript(std::istringstream *ss, bool clearObjs);
+   void SetReuseUnchangedScript(bool reuse);
    bool SaveScript(const std::string &filename,
                    Gmat::WriteMode mode = Gmat::SCRIPTING);
    std::string GetScript(Gmat::WriteMode mode = Gmat::SCRIPTING);
@@ -472,6 +473,43 @@ private:
    // Preparing next script reading
    void PrepareNextScriptReading(bool clearObjs = true);
    
+   // Plug-in manifest, for plug-ins loaded on first use
+   /// The factories of a plug-in library, as recorded in the manifest
+   struct PluginFactoryEntry
+   {
+      UnsignedInt factoryType;
+      bool        isCaseSensitive;
+      StringArray creatables;
+      StringArray unviewables;
+      StringArray sequenceStarters;
+   };
+   /// A plug-in library, as recorded in the manifest
+   struct PluginManifestEntry
+   {
+      /// Size and modification time of the library file
+      std::string fileStamp;
+      /// True if the library only provides factories, so it can wait
+      bool        canDefer;
+      /// True for libraries of GUI components
+      bool        isGuiPlugin;
+      std::vector<PluginFactoryEntry> factories;
+   };
+   
+   static Factory* LoadDeferredFactory(const std::string &pluginName,
+                                       Integer index);
+   bool RegisterDeferredPlugin(const std::string &pluginName);
+   void RecordPlugin(const std::string &pluginName, DynamicLibrary *theLib,
+                     const std::vector<Factory*> &factories, bool isGui);
+   std::string GetPluginFileStamp(const std::string &pluginName);
+   std::string GetPluginManifestFileName();
+   void ReadPluginManifest();
+   void WritePluginManifest();
+   
+   // Reusing an interpreted script
+   bool IsScriptUnchanged(const std::string &filename);
+   void SaveScriptFileHashes();
+   std::size_t GetFileHash(const std::string &filename);
+   
    // Minimum resource
    void CreateMinimumResource();
    
@@ -550,6 +588,11 @@ private:
    Integer currentSandboxNumber;
    Integer exitCode;
    std::string mainScriptFileName;
+   /// Reuse the configuration when the same unchanged script is read again
+   bool reuseUnchangedScript;
+   /// Files of the last interpreted script, and hashes of their contents
+   StringArray interpretedScriptFiles;
+   std::vector<std::size_t> interpretedScriptHashes;
    std::vector<Sandbox*> sandboxes;
    std::vector<TriggerManager*> triggerManagers;
    std::vector<GmatCommand*> commands;
@@ -585,6 +628,12 @@ private:
    std::map<std::string, DynamicLibrary*>   userLibraries;
    std::vector<Gmat::PluginResource*>  userResources;
    std::vector<GuiFactory*> pluginGuiFactories;
+   /// Plug-in libraries recorded in the plug-in manifest
+   std::map<std::string, PluginManifestEntry> pluginManifest;
+   /// True when the manifest needs to be written
+   bool pluginManifestChanged;
+   /// Factories of plug-ins loaded on first use, until claimed
+   std::map<std::string, std::vector<Factory*> > deferredPluginFactories;
 
    // Plugin creator callback method
    GuiWidgetCreatorCallback pCreateWidget;
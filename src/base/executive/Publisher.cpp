@@ -76,7 +76,9 @@ Publisher::Publisher() :
    maneuvering         (false),
    internalCoordSystem (NULL),
    dataCoordSystem     (NULL),
-   dataMJ2000EqOrigin  (NULL) //,
+   dataMJ2000EqOrigin  (NULL),
+   streamBuffer        (NULL),
+   streamBufferSize    (0) //,
    // Buffers used to avoid publishing repeated data
    //   dataBuffer          (NULL),
    //   countBuffer         (0)
@@ -107,6 +109,9 @@ Publisher::~Publisher()
       }
       iter++;
    }
+   if (streamBuffer)
+      delete [] streamBuffer;
+
    // Buffers used to avoid publishing repeated data
    //   if (dataBuffer)
    //      delete [] dataBuffer;
@@ -327,27 +332,25 @@ bool Publisher::Publish(GmatBase *provider, Integer id, Real *data, Integer coun
 
       // Convert the data into a string for distribution
       Integer length = count*25 + 1;
-      char *stream = new char[length];
+      char *stream = GetStreamBuffer(length);
    
       #ifdef DEBUG_PUBLISHER_BUFFERS
-         MessageInterface::ShowMessage("Allocated %d chars at %p\n", length,
+         MessageInterface::ShowMessage("Using %d chars at %p\n", length,
                stream);
       #endif
    
       stream[0] = '\0';    // Init to empty string
 
+      Integer used = 0;
       for (Integer i = 0; i < count; ++i)
       {
          #ifdef DEBUG_PUBLISHER_BUFFERS
             MessageInterface::ShowMessage("   %d: %12lf\n", i, data[i]);
          #endif
-         sprintf(stream, "%s%16le", stream, data[i]);
-         if (i < count - 1)
-            strcat(stream, ", ");
-         else
-            strcat(stream, "\n");
+         used += sprintf(stream + used, "%16le", data[i]);
+         used += AppendSeparator(stream + used, (i < count - 1));
          #ifdef DEBUG_PUBLISHER_BUFFERS
-               MessageInterface::ShowMessage("   used %d\n", strlen(stream));
+               MessageInterface::ShowMessage("   used %d\n", used);
          #endif
       }
    
@@ -415,10 +418,6 @@ bool Publisher::Publish(GmatBase *provider, Integer id, Real *data, Integer coun
          current++;
       }
 
-      #ifdef DEBUG_PUBLISHER_BUFFERS
-         MessageInterface::ShowMessage("   Cleaning up\n");
-      #endif
-      delete [] stream;
       //   }  End of the repeated data check block
 
    #if DBGLVL_PUBLISHER_PUBLISH
@@ -455,27 +454,20 @@ bool Publisher::Publish(Integer id, char *data, Integer count)
       UpdateProviderId(id);
    }
    
-   // Convert the data into a string for distribution
+   // Convert the data into a string for distribution; the extra two chars
+   // hold the trailing newline and terminator
    Integer length;
    if (count)
-        length = count + 1;
+        length = count;
    else
-        length = strlen(data) + 1;
+        length = strlen(data);
         
-   char *stream = new char[length];
+   char *stream = GetStreamBuffer(length + 2);
 
-   if (count)
-   {
-      for (i = 0; i < count; ++i)
-         stream[i] = data[i];
-      stream[i] = '\0';
-   }
-   else
-   {
-      strcpy(stream, data);
-   }
-   
-   strcat(stream, "\n");
+   for (i = 0; i < length; ++i)
+      stream[i] = data[i];
+   stream[length] = '\n';
+   stream[length+1] = '\0';
 
    std::list<Subscriber*>::iterator current = subscriberList.begin();
    while (current != subscriberList.end())
@@ -485,7 +477,6 @@ bool Publisher::Publish(Integer id, char *data, Integer count)
       current++;
    }
 
-   delete [] stream;
    return true;
 }
 
@@ -513,16 +504,14 @@ bool Publisher::Publish(Integer id, Integer *data, Integer count)
    }
    
    // Convert the data into a string for distribution
-   char *stream = new char[count*25 + 1];
+   char *stream = GetStreamBuffer(count*25 + 1);
    stream[0] = '\0';
    
+   Integer used = 0;
    for(Integer i = 0; i < count; ++i)
    {
-      sprintf(stream, "%s%d", stream, data[i]);
-      if (i < count - 1)
-         strcat(stream, ", ");
-      else
-         strcat(stream, "\n");
+      used += sprintf(stream + used, "%d", data[i]);
+      used += AppendSeparator(stream + used, (i < count - 1));
    }
    
    std::list<Subscriber*>::iterator current = subscriberList.begin();
@@ -533,7 +522,6 @@ bool Publisher::Publish(Integer id, Integer *data, Integer count)
       current++;
    }
 
-   delete [] stream;
    return true;
 }
 
@@ -1217,6 +1205,63 @@ void Publisher::UpdateProviderId(Integer newId)
 }
 
 
+//------------------------------------------------------------------------------
+// char* GetStreamBuffer(Integer length)
+//------------------------------------------------------------------------------
+/**
+ * Returns the buffer used to build the data string sent to the subscribers.
+ *
+ * The buffer is kept between calls and only grows, so publishing at every
+ * propagation step does not allocate.  Subscribers only hold the string until
+ * the next Publish() call, as they did when it was freed after each call.
+ *
+ * @param length The number of chars needed, including the terminator
+ *
+ * @return The buffer
+ */
+//------------------------------------------------------------------------------
+char* Publisher::GetStreamBuffer(Integer length)
+{
+   if (length > streamBufferSize)
+   {
+      if (streamBuffer)
+         delete [] streamBuffer;
+      streamBuffer = new char[length];
+      streamBufferSize = length;
+   }
+   return streamBuffer;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer AppendSeparator(char *end, bool more)
+//------------------------------------------------------------------------------
+/**
+ * Writes the separator following a value in the data string: ", " between
+ * values and a newline after the last one.
+ *
+ * @param end  The current end of the string
+ * @param more true if more values follow
+ *
+ * @return The number of chars written, not counting the terminator
+ */
+//------------------------------------------------------------------------------
+Integer Publisher::AppendSeparator(char *end, bool more)
+{
+   if (more)
+   {
+      end[0] = ',';
+      end[1] = ' ';
+      end[2] = '\0';
+      return 2;
+   }
+
+   end[0] = '\n';
+   end[1] = '\0';
+   return 1;
+}
+
+
 //------------------------------------------------------------------------------
 // void ShowSubscribers()
 //------------------------------------------------------------------------------
@@ -153,7 +153,14 @@ protected:
    /// published data map
    std::map<GmatBase*, std::vector<DataType>* > providerMap;
    
+   /// Buffer reused to build the data string sent to the subscribers
+   char                     *streamBuffer;
+   /// Allocated size of streamBuffer
+   Integer                  streamBufferSize;
+   
    void                 UpdateProviderId(Integer newId);
+   char*                GetStreamBuffer(Integer length);
+   static Integer       AppendSeparator(char *end, bool more);
    
    // for debug
    void                 ShowSubscribers();
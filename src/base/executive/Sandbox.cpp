@@ -45,6 +45,8 @@
 #include "SubscriberException.hpp"
 #include "CommandUtil.hpp"         // for GetCommandSeqString()
 #include "MessageInterface.hpp"
+#include "Profiler.hpp"
+#include "MemoryTracker.hpp"
 
 #include <algorithm>       // for find
 
@@ -72,9 +74,6 @@
 //#define DEBUG_MEMORY
 //#endif
 
-#ifdef DEBUG_MEMORY
-#include "MemoryTracker.hpp"
-#endif
 
 #ifdef DEBUG_SANDBOX_INIT
    ObjectMap::iterator omIter;
@@ -216,6 +215,8 @@ GmatBase* Sandbox::AddObject(GmatBase *obj)
       #endif
       
       cloned = obj->Clone();
+      if (MemoryTracker::IsCounting())
+         MemoryTracker::CountAllocation(MemoryTracker::SANDBOX_CLONE);
       
       #ifdef DEBUG_MEMORY
       MemoryTracker::Instance()->Add
@@ -1175,7 +1176,17 @@ bool Sandbox::Execute()
                }
             }
 
-            rv = current->Execute();
+            {
+               ProfileScope profile("Command", current);
+               if (MemoryTracker::IsCounting())
+               {
+                  MemoryTracker::Instance()->StartCommandCount(current);
+                  rv = current->Execute();
+                  MemoryTracker::Instance()->EndCommandCount(current);
+               }
+               else
+                  rv = current->Execute();
+            }
          
             if (!rv)
             {
@@ -1384,6 +1395,8 @@ void Sandbox::Clear()
             (omi->second, omi->first, "Sandbox::Clear()",
              " deleting cloned obj from objectMap");
          #endif
+         if (MemoryTracker::IsCounting())
+            MemoryTracker::CountRelease(MemoryTracker::SANDBOX_CLONE);
          delete omi->second;
          omi->second = NULL;
 
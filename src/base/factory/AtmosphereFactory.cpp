@@ -36,6 +36,7 @@
 #include "ExponentialAtmosphere.hpp"
 #include "Msise90Atmosphere.hpp"
 #include "JacchiaRobertsAtmosphere.hpp"
+#include "TabulatedAtmosphere.hpp"
 #include "SimpleExponentialAtmosphere.hpp"
 
 
@@ -93,6 +94,10 @@ AtmosphereFactory::CreateAtmosphereModel(const std::string &ofType,
       return new Msise90Atmosphere(withName);
    else if (ofType == "JacchiaRoberts")
       return new JacchiaRobertsAtmosphere(withName);
+   else if (ofType == "TabulatedMSISE90")
+      return new TabulatedAtmosphere("MSISE90", withName);
+   else if (ofType == "TabulatedJacchiaRoberts")
+      return new TabulatedAtmosphere("JacchiaRoberts", withName);
    return NULL;
 }
 
@@ -116,6 +121,8 @@ Factory(Gmat::ATMOSPHERE)
 //      creatables.push_back("Simple");
       creatables.push_back("MSISE90");
       creatables.push_back("JacchiaRoberts");
+      creatables.push_back("TabulatedMSISE90");
+      creatables.push_back("TabulatedJacchiaRoberts");
    }
    GmatType::RegisterType(Gmat::ATMOSPHERE, "Atmosphere");
 }
@@ -197,6 +204,8 @@ StringArray AtmosphereFactory::GetListOfCreatableObjects(
       // hand here
       qualifiedCreatables.push_back("MSISE90");
       qualifiedCreatables.push_back("JacchiaRoberts");
+      qualifiedCreatables.push_back("TabulatedMSISE90");
+      qualifiedCreatables.push_back("TabulatedJacchiaRoberts");
    }
    else if ("Mars")
    {
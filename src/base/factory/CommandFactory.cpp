@@ -59,6 +59,7 @@
 #include "BeginFiniteBurn.hpp"// for BeginFiniteBurn command
 #include "EndFiniteBurn.hpp"  // for EndFiniteBurn command
 #include "BeginScript.hpp"    // for BeginScript command
+#include "BranchMission.hpp"  // for BranchMission command
 #include "EndScript.hpp"      // for EndScript command
 #include "Optimize.hpp"       // for Optimize command
 #include "EndOptimize.hpp"    // for EndOptimize command
@@ -184,6 +185,8 @@ GmatCommand* CommandFactory::CreateCommand(const std::string &ofType,
          return new EndFiniteBurn;
     else if (ofType == "BeginScript")
         return new BeginScript;
+    else if (ofType == "BranchMission")
+        return new BranchMission;
     else if (ofType == "EndScript")
          return new EndScript;
     else if (ofType == "Stop")
@@ -243,6 +246,7 @@ CommandFactory::CommandFactory() :
       creatables.push_back("BeginMissionSequence");
       sequenceStarters.push_back("BeginMissionSequence");
       creatables.push_back("BeginScript");
+      creatables.push_back("BranchMission");
       creatables.push_back("CallFunction");
       creatables.push_back("CallBuiltinGmatFunction");
 //      creatables.push_back("CallGmatFunction");
@@ -304,6 +308,9 @@ CommandFactory::CommandFactory() :
       // These commands only works in object setup mode and inside a GmatFunction
       unviewables.push_back("Create");
 
+      // Script-only; it splits a console run into processes
+      unviewables.push_back("BranchMission");
+
       // Commented out. If this breaks lots of GUI testing uncomment this
       //unviewables.push_back("Write");
       
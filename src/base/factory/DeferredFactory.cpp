@@ -0,0 +1,568 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             DeferredFactory
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation code for the DeferredFactory class, which loads a plug-in
+ * library when the first object of one of its types is created.
+ */
+//------------------------------------------------------------------------------
+#include "DeferredFactory.hpp"
+#include "FactoryException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_DEFERRED_FACTORY
+
+//---------------------------------
+//  public methods
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// DeferredFactory(UnsignedInt ofType, const StringArray &createList,
+//       const StringArray &unviewableList, const StringArray &starterList,
+//       bool caseSensitive, const std::string &libraryName, Integer index,
+//       FactoryLoader loader)
+//------------------------------------------------------------------------------
+/**
+ * Constructs a stand-in for a plug-in factory.
+ *
+ * @param ofType         The type of the plug-in factory
+ * @param createList     The types the plug-in factory creates
+ * @param unviewableList The types that are not shown on the GUI
+ * @param starterList    The mission sequence starting commands it creates
+ * @param caseSensitive  True if the type names are case sensitive
+ * @param libraryName    The plug-in library name
+ * @param index          The index of the factory in the library
+ * @param loader         The function that loads the library
+ */
+//------------------------------------------------------------------------------
+DeferredFactory::DeferredFactory(UnsignedInt ofType,
+                                 const StringArray &createList,
+                                 const StringArray &unviewableList,
+                                 const StringArray &starterList,
+                                 bool caseSensitive,
+                                 const std::string &libraryName,
+                                 Integer index, FactoryLoader loader) :
+   Factory          (createList, ofType),
+   theFactory       (NULL),
+   libraryName      (libraryName),
+   factoryIndex     (index),
+   loader           (loader),
+   sequenceStarters (starterList)
+{
+   unviewables = unviewableList;
+   isCaseSensitive = caseSensitive;
+}
+
+
+//------------------------------------------------------------------------------
+// ~DeferredFactory()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; deletes the plug-in factory if it was loaded.
+ */
+//------------------------------------------------------------------------------
+DeferredFactory::~DeferredFactory()
+{
+   delete theFactory;
+}
+
+
+//------------------------------------------------------------------------------
+// Creation methods
+//------------------------------------------------------------------------------
+// Each passes the request on to the plug-in factory, loading its library the
+// first time.
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// GmatBase* CreateObject(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+GmatBase* DeferredFactory::CreateObject(const std::string &ofType,
+                                        const std::string &withName)
+{
+   return GetFactory()->CreateObject(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// SpaceObject* CreateSpacecraft(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+SpaceObject* DeferredFactory::CreateSpacecraft(const std::string &ofType,
+                                               const std::string &withName)
+{
+   return GetFactory()->CreateSpacecraft(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Plate* CreatePlate(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Plate* DeferredFactory::CreatePlate(const std::string &ofType,
+                                    const std::string &withName)
+{
+   return GetFactory()->CreatePlate(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// SpacePoint* CreateSpacePoint(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+SpacePoint* DeferredFactory::CreateSpacePoint(const std::string &ofType,
+                                              const std::string &withName)
+{
+   return GetFactory()->CreateSpacePoint(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Propagator* CreatePropagator(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Propagator* DeferredFactory::CreatePropagator(const std::string &ofType,
+                                              const std::string &withName)
+{
+   return GetFactory()->CreatePropagator(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// ODEModel* CreateODEModel(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+ODEModel* DeferredFactory::CreateODEModel(const std::string &ofType,
+                                          const std::string &withName)
+{
+   return GetFactory()->CreateODEModel(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// PhysicalModel* CreatePhysicalModel(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+PhysicalModel* DeferredFactory::CreatePhysicalModel(const std::string &ofType,
+                                                    const std::string &withName)
+{
+   return GetFactory()->CreatePhysicalModel(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// PropSetup* CreatePropSetup(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+PropSetup* DeferredFactory::CreatePropSetup(const std::string &ofType,
+                                            const std::string &withName)
+{
+   return GetFactory()->CreatePropSetup(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Parameter* CreateParameter(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Parameter* DeferredFactory::CreateParameter(const std::string &ofType,
+                                            const std::string &withName)
+{
+   return GetFactory()->CreateParameter(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Burn* CreateBurn(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Burn* DeferredFactory::CreateBurn(const std::string &ofType,
+                                  const std::string &withName)
+{
+   return GetFactory()->CreateBurn(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// StopCondition* CreateStopCondition(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+StopCondition* DeferredFactory::CreateStopCondition(const std::string &ofType,
+                                                    const std::string &withName)
+{
+   return GetFactory()->CreateStopCondition(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// CalculatedPoint* CreateCalculatedPoint(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+CalculatedPoint* DeferredFactory::CreateCalculatedPoint(
+      const std::string &ofType, const std::string &withName)
+{
+   return GetFactory()->CreateCalculatedPoint(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// CelestialBody* CreateCelestialBody(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+CelestialBody* DeferredFactory::CreateCelestialBody(const std::string &ofType,
+                                                    const std::string &withName)
+{
+   return GetFactory()->CreateCelestialBody(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// SolarSystem* CreateSolarSystem(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+SolarSystem* DeferredFactory::CreateSolarSystem(const std::string &ofType,
+                                                const std::string &withName)
+{
+   return GetFactory()->CreateSolarSystem(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Solver* CreateSolver(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Solver* DeferredFactory::CreateSolver(const std::string &ofType,
+                                      const std::string &withName)
+{
+   return GetFactory()->CreateSolver(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Subscriber* CreateSubscriber(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Subscriber* DeferredFactory::CreateSubscriber(const std::string &ofType,
+                                              const std::string &withName)
+{
+   return GetFactory()->CreateSubscriber(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// EphemerisFile* CreateEphemerisFile(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+EphemerisFile* DeferredFactory::CreateEphemerisFile(const std::string &ofType,
+                                                    const std::string &withName)
+{
+   return GetFactory()->CreateEphemerisFile(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// GmatCommand* CreateCommand(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+GmatCommand* DeferredFactory::CreateCommand(const std::string &ofType,
+                                            const std::string &withName)
+{
+   return GetFactory()->CreateCommand(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// AtmosphereModel* CreateAtmosphereModel(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+AtmosphereModel* DeferredFactory::CreateAtmosphereModel(
+      const std::string &ofType, const std::string &withName)
+{
+   return GetFactory()->CreateAtmosphereModel(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Function* CreateFunction(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Function* DeferredFactory::CreateFunction(const std::string &ofType,
+                                          const std::string &withName)
+{
+   return GetFactory()->CreateFunction(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Hardware* CreateHardware(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Hardware* DeferredFactory::CreateHardware(const std::string &ofType,
+                                          const std::string &withName)
+{
+   return GetFactory()->CreateHardware(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// FieldOfView* CreateFieldOfView(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+FieldOfView* DeferredFactory::CreateFieldOfView(const std::string &ofType,
+                                                const std::string &withName)
+{
+   return GetFactory()->CreateFieldOfView(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// AxisSystem* CreateAxisSystem(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+AxisSystem* DeferredFactory::CreateAxisSystem(const std::string &ofType,
+                                              const std::string &withName)
+{
+   return GetFactory()->CreateAxisSystem(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// CoordinateSystem* CreateCoordinateSystem(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+CoordinateSystem* DeferredFactory::CreateCoordinateSystem(
+      const std::string &ofType, const std::string &withName)
+{
+   return GetFactory()->CreateCoordinateSystem(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// MathNode* CreateMathNode(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+MathNode* DeferredFactory::CreateMathNode(const std::string &ofType,
+                                          const std::string &withName)
+{
+   return GetFactory()->CreateMathNode(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Attitude* CreateAttitude(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Attitude* DeferredFactory::CreateAttitude(const std::string &ofType,
+                                          const std::string &withName)
+{
+   return GetFactory()->CreateAttitude(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// MeasurementModelBase* CreateMeasurementModel(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+MeasurementModelBase* DeferredFactory::CreateMeasurementModel(
+      const std::string &ofType, const std::string &withName)
+{
+   return GetFactory()->CreateMeasurementModel(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// ErrorModel* CreateErrorModel(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+ErrorModel* DeferredFactory::CreateErrorModel(const std::string &ofType,
+                                              const std::string &withName)
+{
+   return GetFactory()->CreateErrorModel(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// DataFilter* CreateDataFilter(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+DataFilter* DeferredFactory::CreateDataFilter(const std::string &ofType,
+                                              const std::string &withName)
+{
+   return GetFactory()->CreateDataFilter(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// DataFile* CreateDataFile(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+DataFile* DeferredFactory::CreateDataFile(const std::string &ofType,
+                                          const std::string &withName)
+{
+   return GetFactory()->CreateDataFile(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// ObType* CreateObType(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+ObType* DeferredFactory::CreateObType(const std::string &ofType,
+                                      const std::string &withName)
+{
+   return GetFactory()->CreateObType(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Event* CreateEvent(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Event* DeferredFactory::CreateEvent(const std::string &ofType,
+                                    const std::string &withName)
+{
+   return GetFactory()->CreateEvent(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// EventLocator* CreateEventLocator(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+EventLocator* DeferredFactory::CreateEventLocator(const std::string &ofType,
+                                                  const std::string &withName)
+{
+   return GetFactory()->CreateEventLocator(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// Interface* CreateInterface(const std::string &ofType, const std::string &withName)
+//------------------------------------------------------------------------------
+Interface* DeferredFactory::CreateInterface(const std::string &ofType,
+                                            const std::string &withName)
+{
+   return GetFactory()->CreateInterface(ofType, withName);
+}
+
+
+//------------------------------------------------------------------------------
+// StringArray GetListOfCreatableObjects(const std::string &qualifier)
+//------------------------------------------------------------------------------
+/**
+ * Returns the creatable types recorded for the plug-in factory.
+ *
+ * Qualified lists other than the mission sequence starters are only known to
+ * the plug-in factory, so they load the library.
+ *
+ * @param qualifier Qualifier for a list of subtypes
+ *
+ * @return The list of creatable types
+ */
+//------------------------------------------------------------------------------
+StringArray DeferredFactory::GetListOfCreatableObjects(
+                                  const std::string &qualifier)
+{
+   if (theFactory != NULL)
+      return theFactory->GetListOfCreatableObjects(qualifier);
+   
+   if (qualifier == "")
+      return creatables;
+   if (qualifier == "SequenceStarters")
+      return sequenceStarters;
+   
+   return GetFactory()->GetListOfCreatableObjects(qualifier);
+}
+
+
+//------------------------------------------------------------------------------
+// bool DoesObjectTypeMatchSubtype(const std::string &theType,
+//       const std::string &theSubtype)
+//------------------------------------------------------------------------------
+/**
+ * Checks if a creatable type matches a subtype, using the plug-in factory.
+ *
+ * @param theType    The script identifier for the object type
+ * @param theSubtype The subtype being checked
+ *
+ * @return true if the type matches the subtype
+ */
+//------------------------------------------------------------------------------
+bool DeferredFactory::DoesObjectTypeMatchSubtype(const std::string &theType,
+                                                 const std::string &theSubtype)
+{
+   return GetFactory()->DoesObjectTypeMatchSubtype(theType, theSubtype);
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsLoaded() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the plug-in library of the factory has been loaded.
+ */
+//------------------------------------------------------------------------------
+bool DeferredFactory::IsLoaded() const
+{
+   return (theFactory != NULL);
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetLibraryName() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the name of the plug-in library of the factory.
+ */
+//------------------------------------------------------------------------------
+const std::string& DeferredFactory::GetLibraryName() const
+{
+   return libraryName;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetFactoryIndex() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the index of the factory in its plug-in library.
+ */
+//------------------------------------------------------------------------------
+Integer DeferredFactory::GetFactoryIndex() const
+{
+   return factoryIndex;
+}
+
+
+//---------------------------------
+//  protected methods
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// Factory* GetFactory()
+//------------------------------------------------------------------------------
+/**
+ * Returns the plug-in factory, loading its library on the first call.
+ *
+ * @return The plug-in factory
+ *
+ * @exception <FactoryException> thrown if the library or the factory cannot
+ *            be loaded
+ */
+//------------------------------------------------------------------------------
+Factory* DeferredFactory::GetFactory()
+{
+   if (theFactory == NULL)
+   {
+      #ifdef DEBUG_DEFERRED_FACTORY
+      MessageInterface::ShowMessage
+         ("DeferredFactory::GetFactory() loading factory %d of \"%s\"\n",
+          factoryIndex, libraryName.c_str());
+      #endif
+      
+      if (loader != NULL)
+         theFactory = loader(libraryName, factoryIndex);
+      
+      if (theFactory == NULL)
+         throw FactoryException("The plug-in library \"" + libraryName +
+                                "\" did not provide the factory its manifest "
+                                "entry lists; delete the plug-in manifest "
+                                "file to rebuild it");
+      
+      if (theFactory->GetFactoryType() != itsType)
+      {
+         delete theFactory;
+         theFactory = NULL;
+         throw FactoryException("The plug-in library \"" + libraryName +
+                                "\" does not match its manifest entry; delete "
+                                "the plug-in manifest file to rebuild it");
+      }
+   }
+   
+   return theFactory;
+}
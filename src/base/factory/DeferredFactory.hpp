@@ -0,0 +1,150 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             DeferredFactory
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Stand-in for a plug-in factory whose library has not been loaded yet.
+ */
+//------------------------------------------------------------------------------
+#ifndef DeferredFactory_hpp
+#define DeferredFactory_hpp
+
+#include "Factory.hpp"
+
+/**
+ * A DeferredFactory reports the creatable types of a plug-in factory, as
+ * recorded in the plug-in manifest, without the plug-in library loaded.  The
+ * first request to create an object loads the library through the loader
+ * function, and the request and all later ones are passed on to the loaded
+ * factory.
+ */
+class GMAT_API DeferredFactory : public Factory
+{
+public:
+   /// Function that loads a plug-in library and returns its factory at index
+   typedef Factory* (*FactoryLoader)(const std::string &libraryName,
+                                     Integer index);
+   
+   DeferredFactory(UnsignedInt ofType, const StringArray &createList,
+                   const StringArray &unviewableList,
+                   const StringArray &starterList, bool caseSensitive,
+                   const std::string &libraryName, Integer index,
+                   FactoryLoader loader);
+   virtual ~DeferredFactory();
+   
+   virtual GmatBase*        CreateObject(const std::string &ofType,
+                                         const std::string &withName = "");
+   virtual SpaceObject*     CreateSpacecraft(const std::string &ofType,
+                                             const std::string &withName = "");
+   virtual Plate*           CreatePlate(const std::string &ofType,
+                                        const std::string &withName = "");
+   virtual SpacePoint*      CreateSpacePoint(const std::string &ofType,
+                                             const std::string &withName = "");
+   virtual Propagator*      CreatePropagator(const std::string &ofType,
+                                             const std::string &withName = "");
+   virtual ODEModel*        CreateODEModel(const std::string &ofType,
+                                           const std::string &withName = "");
+   virtual PhysicalModel*   CreatePhysicalModel(const std::string &ofType,
+                                                const std::string &withName = "");
+   virtual PropSetup*       CreatePropSetup(const std::string &ofType,
+                                            const std::string &withName = "");
+   virtual Parameter*       CreateParameter(const std::string &ofType,
+                                            const std::string &withName = "");
+   virtual Burn*            CreateBurn(const std::string &ofType,
+                                       const std::string &withName = "");
+   virtual StopCondition*   CreateStopCondition(const std::string &ofType,
+                                                const std::string &withName = "");
+   virtual CalculatedPoint* CreateCalculatedPoint(const std::string &ofType,
+                                                  const std::string &withName = "");
+   virtual CelestialBody*   CreateCelestialBody(const std::string &ofType,
+                                                const std::string &withName = "");
+   virtual SolarSystem*     CreateSolarSystem(const std::string &ofType,
+                                              const std::string &withName = "");
+   virtual Solver*          CreateSolver(const std::string &ofType,
+                                         const std::string &withName = "");
+   virtual Subscriber*      CreateSubscriber(const std::string &ofType,
+                                             const std::string &withName = "");
+   virtual EphemerisFile*   CreateEphemerisFile(const std::string &ofType,
+                                                const std::string &withName = "");
+   virtual GmatCommand*     CreateCommand(const std::string &ofType,
+                                          const std::string &withName = "");
+   virtual AtmosphereModel* CreateAtmosphereModel(const std::string &ofType,
+                                                  const std::string &withName = "");
+   virtual Function*        CreateFunction(const std::string &ofType,
+                                           const std::string &withName = "");
+   virtual Hardware*        CreateHardware(const std::string &ofType,
+                                           const std::string &withName = "");
+   virtual FieldOfView*     CreateFieldOfView(const std::string &ofType,
+                                              const std::string &withName = "");
+   virtual AxisSystem*      CreateAxisSystem(const std::string &ofType,
+                                             const std::string &withName = "");
+   virtual CoordinateSystem*CreateCoordinateSystem(const std::string &ofType,
+                                                   const std::string &withName = "");
+   virtual MathNode*        CreateMathNode(const std::string &ofType,
+                                           const std::string &withName = "");
+   virtual Attitude*        CreateAttitude(const std::string &ofType,
+                                           const std::string &withName = "");
+   virtual MeasurementModelBase*CreateMeasurementModel(const std::string &ofType,
+                                                       const std::string &withName = "");
+   virtual ErrorModel*      CreateErrorModel(const std::string &ofType,
+                                             const std::string &withName = "");
+   virtual DataFilter*      CreateDataFilter(const std::string &ofType,
+                                             const std::string &withName = "");
+   virtual DataFile*        CreateDataFile(const std::string &ofType,
+                                           const std::string &withName = "");
+   virtual ObType*          CreateObType(const std::string &ofType,
+                                         const std::string &withName = "");
+   virtual Event*           CreateEvent(const std::string &ofType,
+                                        const std::string &withName = "");
+   virtual EventLocator*    CreateEventLocator(const std::string &ofType,
+                                               const std::string &withName = "");
+   virtual Interface*       CreateInterface(const std::string &ofType,
+                                            const std::string &withName = "");
+   
+   virtual StringArray      GetListOfCreatableObjects(
+                                  const std::string &qualifier = "");
+   virtual bool             DoesObjectTypeMatchSubtype(
+                                  const std::string &theType,
+                                  const std::string &theSubtype);
+   
+   bool                     IsLoaded() const;
+   const std::string&       GetLibraryName() const;
+   Integer                  GetFactoryIndex() const;
+   
+protected:
+   /// The plug-in factory, once its library is loaded
+   Factory                  *theFactory;
+   /// Name of the plug-in library, as listed in the startup file
+   std::string              libraryName;
+   /// Index of the factory in the library
+   Integer                  factoryIndex;
+   /// Function that loads the library
+   FactoryLoader            loader;
+   /// Mission sequence starting commands of the factory
+   StringArray              sequenceStarters;
+   
+   Factory*                 GetFactory();
+   
+private:
+   // Deferred factories are not copied
+   DeferredFactory(const DeferredFactory &fact);
+   DeferredFactory& operator=(const DeferredFactory &fact);
+};
+
+#endif // DeferredFactory_hpp
@@ -0,0 +1,435 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             DerivativeContext
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the DerivativeContext class, the epoch dependent data shared by
+ * the members of an ODEModel during a derivative evaluation.
+ */
+//------------------------------------------------------------------------------
+
+#include "DerivativeContext.hpp"
+#include "AxisSystem.hpp"
+#include "ODEModelException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_DERIVATIVE_CONTEXT
+
+
+//------------------------------------------------------------------------------
+// DerivativeContext()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+DerivativeContext::DerivativeContext()
+{
+   for (Integer i = 0; i < 6; ++i)
+   {
+      dummyState[i] = 0.0;
+      convertedState[i] = 0.0;
+   }
+   // Any position will do; the conversion is only used for its rotation
+   dummyState[0] = 7000.0;
+}
+
+
+//------------------------------------------------------------------------------
+// ~DerivativeContext()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+DerivativeContext::~DerivativeContext()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// DerivativeContext(const DerivativeContext &dc)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * The slots refer to the forces of the model that owns the context, so they
+ * are not copied; the copy is filled when its own model is initialized.
+ *
+ * @param dc The context copied
+ */
+//------------------------------------------------------------------------------
+DerivativeContext::DerivativeContext(const DerivativeContext &dc)
+{
+   for (Integer i = 0; i < 6; ++i)
+   {
+      dummyState[i] = dc.dummyState[i];
+      convertedState[i] = 0.0;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// DerivativeContext& operator=(const DerivativeContext &dc)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * As for the copy constructor, the slots are cleared rather than copied.
+ *
+ * @param dc The context copied
+ *
+ * @return This context
+ */
+//------------------------------------------------------------------------------
+DerivativeContext& DerivativeContext::operator=(const DerivativeContext &dc)
+{
+   if (this != &dc)
+      Clear();
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all of the registered slots.
+ */
+//------------------------------------------------------------------------------
+void DerivativeContext::Clear()
+{
+   bodies.clear();
+   rotations.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * Marks the cached data stale, keeping the registered slots.
+ */
+//------------------------------------------------------------------------------
+void DerivativeContext::Reset()
+{
+   for (UnsignedInt i = 0; i < bodies.size(); ++i)
+      bodies[i].isSet = false;
+   for (UnsignedInt i = 0; i < rotations.size(); ++i)
+      rotations[i].isSet = false;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer AddBody(CelestialBody *body)
+//------------------------------------------------------------------------------
+/**
+ * Registers a body whose state is needed during derivative evaluation.
+ *
+ * @param body The body
+ *
+ * @return The slot holding the body state
+ */
+//------------------------------------------------------------------------------
+Integer DerivativeContext::AddBody(CelestialBody *body)
+{
+   if (body == NULL)
+      throw ODEModelException("A derivative context cannot use a NULL body");
+
+   for (UnsignedInt i = 0; i < bodies.size(); ++i)
+      if (bodies[i].body == body)
+         return i;
+
+   BodySlot slot;
+   slot.body = body;
+   slot.isSet = false;
+   slot.usedGmatTime = false;
+   slot.time = 0.0;
+   for (Integer i = 0; i < 6; ++i)
+      slot.state[i] = 0.0;
+   bodies.push_back(slot);
+
+   #ifdef DEBUG_DERIVATIVE_CONTEXT
+      MessageInterface::ShowMessage("DerivativeContext <%p>: body slot %d is "
+            "%s\n", this, (Integer)bodies.size() - 1, body->GetName().c_str());
+   #endif
+
+   return bodies.size() - 1;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer AddRotation(CoordinateSystem *fromCS, CoordinateSystem *toCS)
+//------------------------------------------------------------------------------
+/**
+ * Registers a rotation needed during derivative evaluation.
+ *
+ * @param fromCS The frame rotated from
+ * @param toCS   The frame rotated to
+ *
+ * @return The slot holding the rotation matrix
+ */
+//------------------------------------------------------------------------------
+Integer DerivativeContext::AddRotation(CoordinateSystem *fromCS,
+      CoordinateSystem *toCS)
+{
+   if ((fromCS == NULL) || (toCS == NULL))
+      throw ODEModelException("A derivative context cannot rotate to or from "
+            "a NULL coordinate system");
+
+   for (UnsignedInt i = 0; i < rotations.size(); ++i)
+      if (SameFrame(rotations[i].fromCS, fromCS) &&
+          SameFrame(rotations[i].toCS, toCS))
+         return i;
+
+   RotationSlot slot;
+   slot.fromCS = fromCS;
+   slot.toCS = toCS;
+   slot.isSet = false;
+   slot.usedGmatTime = false;
+   slot.time = 0.0;
+   for (Integer i = 0; i < 9; ++i)
+   {
+      slot.matrix[i] = 0.0;
+      slot.matrixDot[i] = 0.0;
+   }
+   rotations.push_back(slot);
+
+   #ifdef DEBUG_DERIVATIVE_CONTEXT
+      MessageInterface::ShowMessage("DerivativeContext <%p>: rotation slot %d "
+            "is %s to %s\n", this, (Integer)rotations.size() - 1,
+            fromCS->GetName().c_str(), toCS->GetName().c_str());
+   #endif
+
+   return rotations.size() - 1;
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetBodyState(Integer slot, const A1Mjd &atTime)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the state of a registered body.
+ *
+ * @param slot   The slot returned by AddBody()
+ * @param atTime The epoch of the state
+ *
+ * @return The Cartesian state of the body, in the body's J2000 frame
+ */
+//------------------------------------------------------------------------------
+const Real* DerivativeContext::GetBodyState(Integer slot, const A1Mjd &atTime)
+{
+   BodySlot &bs = bodies[slot];
+   if (!bs.isSet || bs.usedGmatTime || (bs.time != atTime.Get()))
+   {
+      const Real *data = bs.body->GetState(atTime).GetDataVector();
+      for (Integer i = 0; i < 6; ++i)
+         bs.state[i] = data[i];
+      bs.time = atTime.Get();
+      bs.usedGmatTime = false;
+      bs.isSet = true;
+   }
+   return bs.state;
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetBodyState(Integer slot, const GmatTime &atTime)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the state of a registered body.
+ *
+ * @param slot   The slot returned by AddBody()
+ * @param atTime The epoch of the state
+ *
+ * @return The Cartesian state of the body, in the body's J2000 frame
+ */
+//------------------------------------------------------------------------------
+const Real* DerivativeContext::GetBodyState(Integer slot,
+      const GmatTime &atTime)
+{
+   BodySlot &bs = bodies[slot];
+   if (!bs.isSet || !bs.usedGmatTime || (bs.timeGT != atTime))
+   {
+      const Real *data = bs.body->GetState(atTime).GetDataVector();
+      for (Integer i = 0; i < 6; ++i)
+         bs.state[i] = data[i];
+      bs.timeGT = atTime;
+      bs.usedGmatTime = true;
+      bs.isSet = true;
+   }
+   return bs.state;
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetRotation(Integer slot, const A1Mjd &atTime)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a registered rotation matrix.
+ *
+ * @param slot   The slot returned by AddRotation()
+ * @param atTime The epoch of the rotation
+ *
+ * @return The row major matrix rotating vectors from the first frame into the
+ *         second one
+ */
+//------------------------------------------------------------------------------
+const Real* DerivativeContext::GetRotation(Integer slot, const A1Mjd &atTime)
+{
+   RotationSlot &rs = rotations[slot];
+   if (!rs.isSet || rs.usedGmatTime || (rs.time != atTime.Get()))
+   {
+      converter.Convert(atTime, dummyState, rs.fromCS, convertedState,
+            rs.toCS, false, true);
+      StoreRotation(rs);
+      rs.time = atTime.Get();
+      rs.usedGmatTime = false;
+   }
+   return rs.matrix;
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetRotation(Integer slot, const GmatTime &atTime)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a registered rotation matrix.
+ *
+ * @param slot   The slot returned by AddRotation()
+ * @param atTime The epoch of the rotation
+ *
+ * @return The row major matrix rotating vectors from the first frame into the
+ *         second one
+ */
+//------------------------------------------------------------------------------
+const Real* DerivativeContext::GetRotation(Integer slot,
+      const GmatTime &atTime)
+{
+   RotationSlot &rs = rotations[slot];
+   if (!rs.isSet || !rs.usedGmatTime || (rs.timeGT != atTime))
+   {
+      converter.Convert(atTime, dummyState, rs.fromCS, convertedState,
+            rs.toCS, false, true);
+      StoreRotation(rs);
+      rs.timeGT = atTime;
+      rs.usedGmatTime = true;
+   }
+   return rs.matrix;
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetRotationDot(Integer slot, const A1Mjd &atTime)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the time derivative of a registered rotation matrix.
+ *
+ * @param slot   The slot returned by AddRotation()
+ * @param atTime The epoch of the rotation
+ *
+ * @return The row major derivative of the matrix returned by GetRotation()
+ */
+//------------------------------------------------------------------------------
+const Real* DerivativeContext::GetRotationDot(Integer slot,
+      const A1Mjd &atTime)
+{
+   GetRotation(slot, atTime);
+   return rotations[slot].matrixDot;
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetRotationDot(Integer slot, const GmatTime &atTime)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the time derivative of a registered rotation matrix.
+ *
+ * @param slot   The slot returned by AddRotation()
+ * @param atTime The epoch of the rotation
+ *
+ * @return The row major derivative of the matrix returned by GetRotation()
+ */
+//------------------------------------------------------------------------------
+const Real* DerivativeContext::GetRotationDot(Integer slot,
+      const GmatTime &atTime)
+{
+   GetRotation(slot, atTime);
+   return rotations[slot].matrixDot;
+}
+
+
+//------------------------------------------------------------------------------
+// bool SameFrame(CoordinateSystem *cs1, CoordinateSystem *cs2)
+//------------------------------------------------------------------------------
+/**
+ * Tests if two coordinate systems have the same orientation at all epochs.
+ *
+ * @param cs1 The first coordinate system
+ * @param cs2 The second coordinate system
+ *
+ * @return true if a rotation to or from one can stand in for the other
+ */
+//------------------------------------------------------------------------------
+bool DerivativeContext::SameFrame(CoordinateSystem *cs1,
+      CoordinateSystem *cs2)
+{
+   if (cs1 == cs2)
+      return true;
+
+   AxisSystem *axes1 = cs1->GetAxisSystem();
+   AxisSystem *axes2 = cs2->GetAxisSystem();
+   if ((axes1 == NULL) || (axes2 == NULL))
+      return false;
+
+   if (axes1->IsOfType("MJ2000EqAxes") && axes2->IsOfType("MJ2000EqAxes"))
+      return true;
+
+   // The body rotation model is set on the body, so the origin fixes the frame
+   if (axes1->IsOfType("BodyFixedAxes") && axes2->IsOfType("BodyFixedAxes"))
+      return cs1->GetOrigin() == cs2->GetOrigin();
+
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void StoreRotation(RotationSlot &slot)
+//------------------------------------------------------------------------------
+/**
+ * Saves the rotation matrix and its derivative from the last conversion in a
+ * slot.
+ *
+ * @param slot The slot that receives the matrices
+ */
+//------------------------------------------------------------------------------
+void DerivativeContext::StoreRotation(RotationSlot &slot)
+{
+   lastRotation = converter.GetLastRotationMatrix();
+   lastRotationDot = converter.GetLastRotationDotMatrix();
+   const Real *data = lastRotation.GetDataVector();
+   const Real *dotData = lastRotationDot.GetDataVector();
+   for (Integer i = 0; i < 9; ++i)
+   {
+      slot.matrix[i] = data[i];
+      slot.matrixDot[i] = dotData[i];
+   }
+   slot.isSet = true;
+}
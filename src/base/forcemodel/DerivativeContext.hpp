@@ -0,0 +1,131 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             DerivativeContext
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Declares the DerivativeContext class, the epoch dependent data shared by the
+ * members of an ODEModel during a derivative evaluation.
+ */
+//------------------------------------------------------------------------------
+#ifndef DerivativeContext_hpp
+#define DerivativeContext_hpp
+
+#include "gmatdefs.hpp"
+#include "CelestialBody.hpp"
+#include "CoordinateSystem.hpp"
+#include "CoordinateConverter.hpp"
+#include "GmatTime.hpp"
+
+/**
+ * Per epoch cache of body states and frame rotations for an ODEModel
+ *
+ * The forces in a model register the bodies and rotations they need when the
+ * ODEModel is initialized, and receive a slot index for each.  During a
+ * derivative evaluation, the first request for a slot at a new epoch
+ * computes the data; the other forces evaluated at that epoch read the cached
+ * values.  The storage for every slot is allocated at registration, so the
+ * lookups made while the model is evaluated do not allocate.  Each rotation
+ * slot holds the rotation matrix and its time derivative, so forces needing
+ * the body spin, like the relativistic correction, share the conversion with
+ * the gravity field.
+ *
+ * Rotations are shared between forces when the frames match: two
+ * MJ2000Eq frames match regardless of origin, and two body fixed frames match
+ * when they share an origin.  Other frames are only shared by pointer.
+ */
+class GMAT_API DerivativeContext
+{
+public:
+   DerivativeContext();
+   virtual ~DerivativeContext();
+   DerivativeContext(const DerivativeContext &dc);
+   DerivativeContext& operator=(const DerivativeContext &dc);
+
+   void           Clear();
+   void           Reset();
+
+   Integer        AddBody(CelestialBody *body);
+   Integer        AddRotation(CoordinateSystem *fromCS, CoordinateSystem *toCS);
+
+   const Real*    GetBodyState(Integer slot, const A1Mjd &atTime);
+   const Real*    GetBodyState(Integer slot, const GmatTime &atTime);
+   const Real*    GetRotation(Integer slot, const A1Mjd &atTime);
+   const Real*    GetRotation(Integer slot, const GmatTime &atTime);
+   const Real*    GetRotationDot(Integer slot, const A1Mjd &atTime);
+   const Real*    GetRotationDot(Integer slot, const GmatTime &atTime);
+
+protected:
+   /// Cached state of a body
+   struct BodySlot
+   {
+      /// The body
+      CelestialBody     *body;
+      /// Flag indicating that the state holds data
+      bool              isSet;
+      /// Flag indicating that the state was computed at a GmatTime epoch
+      bool              usedGmatTime;
+      /// Epoch of the state, when usedGmatTime is false
+      Real              time;
+      /// Epoch of the state, when usedGmatTime is true
+      GmatTime          timeGT;
+      /// Cartesian state of the body
+      Real              state[6];
+   };
+
+   /// Cached rotation between two frames
+   struct RotationSlot
+   {
+      /// Frame rotated from
+      CoordinateSystem  *fromCS;
+      /// Frame rotated to
+      CoordinateSystem  *toCS;
+      /// Flag indicating that the matrix holds data
+      bool              isSet;
+      /// Flag indicating that the matrix was computed at a GmatTime epoch
+      bool              usedGmatTime;
+      /// Epoch of the matrix, when usedGmatTime is false
+      Real              time;
+      /// Epoch of the matrix, when usedGmatTime is true
+      GmatTime          timeGT;
+      /// Row major rotation matrix
+      Real              matrix[9];
+      /// Row major time derivative of the rotation matrix
+      Real              matrixDot[9];
+   };
+
+   /// Registered bodies
+   std::vector<BodySlot>      bodies;
+   /// Registered rotations
+   std::vector<RotationSlot>  rotations;
+   /// Converter used to build the rotation matrices
+   CoordinateConverter        converter;
+   /// Rotation matrix read from the converter
+   Rmatrix33                  lastRotation;
+   /// Rotation matrix derivative read from the converter
+   Rmatrix33                  lastRotationDot;
+   /// Input state for the conversions; only the rotation is used
+   Real                       dummyState[6];
+   /// Output state for the conversions
+   Real                       convertedState[6];
+
+   bool           SameFrame(CoordinateSystem *cs1, CoordinateSystem *cs2);
+   void           StoreRotation(RotationSlot &slot);
+};
+
+#endif // DerivativeContext_hpp
@@ -38,6 +38,7 @@
 #include "TimeTypes.hpp"
 #include "FileManager.hpp"    // for flux files
 #include "PropagationStateManager.hpp"
+#include "DerivativeContext.hpp"
 
 #include <sstream>                 // for <<
 #include <cmath>
@@ -104,6 +105,8 @@ DragForce::PARAMETER_TEXT[DragForceParamCount - PhysicalModelParamCount] =
    "KpToApMethod",                  // KP2AP_METHOD (Read-only)
    "DensityModel",                  // DENSITY_MODEL         used for MarsGRAM2005
    "InputFile",                     // INPUTFILE             used for MarsGRAM2005
+   "DensityTableFile",              // DENSITY_TABLE_FILE    used for tabulated models
+   "DensityTableTolerance",         // DENSITY_TABLE_TOLERANCE
 };
 
 const Gmat::ParameterType
@@ -127,6 +130,8 @@ DragForce::PARAMETER_TYPE[DragForceParamCount - PhysicalModelParamCount] =
    Gmat::INTEGER_TYPE,  // "KpToApMethod"
    Gmat::STRING_TYPE,   // "DensityModel"
    Gmat::STRING_TYPE,   // "InputFile"
+   Gmat::FILENAME_TYPE, // "DensityTableFile"
+   Gmat::REAL_TYPE,     // "DensityTableTolerance"
 };
 
 //------------------------------------------------------------------------------
@@ -142,6 +147,8 @@ DragForce::DragForce(const std::string &name) :
    PhysicalModel           (Gmat::PHYSICAL_MODEL, "DragForce", name),
    sun                     (NULL),
    centralBody             (NULL),
+   sunSlot                 (-1),
+   bodySlot                (-1),
    angVel                  (NULL),
    useExternalAtmosphere   (true),
    atmosphereType          (""),
@@ -150,6 +157,8 @@ DragForce::DragForce(const std::string &name) :
    density                 (NULL),
    densityModel            (""),
    inputFile               (""),
+   densityTableFile        (""),
+   densityTableTolerance   (0.01),
    prefactor               (NULL),
    firedOnce               (false),
    hasWindModel            (false),
@@ -304,6 +313,8 @@ DragForce::DragForce(const DragForce& df) :
    PhysicalModel           (df),
    sun                     (NULL),
    centralBody             (NULL),
+   sunSlot                 (-1),
+   bodySlot                (-1),
    angVel                  (NULL),
    useExternalAtmosphere   (df.useExternalAtmosphere),
    atmosphereType          (df.atmosphereType),
@@ -311,6 +322,8 @@ DragForce::DragForce(const DragForce& df) :
    density                 (NULL),
    densityModel            (df.densityModel),
    inputFile               (df.inputFile),
+   densityTableFile        (df.densityTableFile),
+   densityTableTolerance   (df.densityTableTolerance),
    prefactor               (NULL),
    firedOnce               (false),
    hasWindModel            (df.hasWindModel),
@@ -451,6 +464,8 @@ DragForce& DragForce::operator=(const DragForce& df)
    
    sun                   = NULL;
    centralBody           = NULL;
+   sunSlot               = -1;
+   bodySlot              = -1;
    useExternalAtmosphere = df.useExternalAtmosphere;
    atmosphereType        = df.atmosphereType;
    
@@ -565,6 +580,8 @@ DragForce& DragForce::operator=(const DragForce& df)
 
    densityModel = df.densityModel;
    inputFile    = df.inputFile;
+   densityTableFile      = df.densityTableFile;
+   densityTableTolerance = df.densityTableTolerance;
    
    dragShapeModel      = df.dragShapeModel;
    dragShapeModelIndex = df.dragShapeModelIndex;
@@ -1122,6 +1139,7 @@ bool DragForce::Initialize()
 
             angVel = atmos->GetAngularVelocity();
             hasWindModel = atmos->HasWindModel();
+            CheckTimeJacobian();
 
             F107ID = atmos->GetParameterID("F107");
             F107AID = atmos->GetParameterID("F107A");
@@ -1185,6 +1203,13 @@ bool DragForce::Initialize()
 			      atmos->SetStringParameter("InputFile", inputFile);		   // made changes for GMT-4299
             } catch (...){}
 
+            if (atmos->IsOfType("TabulatedAtmosphere"))
+            {
+               atmos->SetStringParameter("DensityTableFile", densityTableFile);
+               atmos->SetRealParameter(atmos->GetParameterID(
+                     "DensityTableTolerance"), densityTableTolerance);
+            }
+
 
 			   atmos->Initialize();										// Note: it needs to initialize before use. Fixed bug GMT-4124
             // Set the source flags: constants, files, etc
@@ -1288,6 +1313,53 @@ void DragForce::BuildPrefactors(const std::string &forModel)
 }
 
 
+//------------------------------------------------------------------------------
+// void SetDerivativeContext(DerivativeContext *context)
+//------------------------------------------------------------------------------
+/**
+ * Sets the shared epoch data, and registers the Sun and central body states
+ * used for the atmospheric bulge
+ *
+ * @param context The context, or NULL to read the states from the bodies
+ */
+//------------------------------------------------------------------------------
+void DragForce::SetDerivativeContext(DerivativeContext *context)
+{
+   PhysicalModel::SetDerivativeContext(context);
+
+   sunSlot = bodySlot = -1;
+   if ((context != NULL) && (sun != NULL) && (centralBody != NULL))
+   {
+      sunSlot = context->AddBody(sun);
+      bodySlot = context->AddBody(centralBody);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckTimeJacobian()
+//------------------------------------------------------------------------------
+/**
+ * Determines if the time Jacobian can be built analytically.
+ *
+ * The relative velocity v - w x r uses the constant angular velocity of the
+ * atmosphere, so the spherical drag model has no explicit time dependence
+ * when the density at a fixed position does not change with epoch, there is
+ * no wind model, and the body with the atmosphere is at the origin of its
+ * J2000 frame (so the body location passed to the atmosphere is fixed).  The
+ * time Jacobian is zero in that case.  SPAD models depend on the attitude, and
+ * so are differenced.
+ */
+//------------------------------------------------------------------------------
+void DragForce::CheckTimeJacobian()
+{
+   hasTimeJacobian = (atmos != NULL) && !hasWindModel &&
+         !atmos->HasEpochDependentDensity() &&
+         (dragShapeModelIndex == ShapeModel::SPHERICAL_MODEL) &&
+         (centralBody != NULL) && (centralBody->GetJ2000Body() == centralBody);
+}
+
+
 //------------------------------------------------------------------------------
 // void TranslateOrigin(const Real *state, const Real now)
 //------------------------------------------------------------------------------
@@ -1368,6 +1440,13 @@ bool DragForce::GetDerivatives(Real *state, Real dt, Integer order,
       throw ODEModelException(msg.str());
    }
 
+   // See CheckTimeJacobian(): the analytic time Jacobian is zero
+   if (fillTimeJacobian && hasTimeJacobian && (timeJacobian != NULL))
+   {
+      for (Integer j = 0; j < stmRowCount; ++j)
+         timeJacobian[j] = 0.0;
+   }
+
    Integer i, i6, ix, j6;
    Real vRelative[3], vRelMag, factor;
 
@@ -2142,11 +2221,12 @@ std::string DragForce::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer DragForce::GetParameterID(const std::string &str) const
 {
-   for (int i = PhysicalModelParamCount; i < DragForceParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, PhysicalModelParamCount,
+               DragForceParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return PhysicalModel::GetParameterID(str);
 }
@@ -2220,6 +2300,10 @@ bool DragForce::IsParameterReadOnly(const Integer id) const
        id == FIXED_COORD_SYSTEM || id == W_UPDATE_INTERVAL ||
        id == KP2AP_METHOD)
       return true;
+
+   // The grid settings only apply to the tabulated models
+   if (id == DENSITY_TABLE_FILE || id == DENSITY_TABLE_TOLERANCE)
+      return (atmosphereType.find("Tabulated") != 0);
    
    return PhysicalModel::IsParameterReadOnly(id);
 }
@@ -2272,6 +2356,9 @@ Real DragForce::GetRealParameter(const Integer id) const
    if (id == W_UPDATE_INTERVAL)
       return wUpdateInterval;
 
+   if (id == DENSITY_TABLE_TOLERANCE)
+      return densityTableTolerance;
+
    return PhysicalModel::GetRealParameter(id);
 }
 
@@ -2391,6 +2478,27 @@ Real DragForce::SetRealParameter(const Integer id, const Real value)
       return wUpdateInterval;
    }
 
+   if (id == DENSITY_TABLE_TOLERANCE)
+   {
+      if (value > 0.0)
+      {
+         densityTableTolerance = value;
+         if ((atmos != NULL) && atmos->IsOfType("TabulatedAtmosphere"))
+            atmos->SetRealParameter(atmos->GetParameterID(
+                  "DensityTableTolerance"), densityTableTolerance);
+      }
+      else
+      {
+         std::stringstream buffer;
+         buffer << value;
+         throw ODEModelException(
+            "The value of \"" + buffer.str() + "\" for field \"DensityTableTolerance\""
+            " on object \"" + instanceName + "\" is not an allowed value.\n"
+            "The allowed values are: [Real Number > 0.0]. ");
+      }
+      return densityTableTolerance;
+   }
+
    return PhysicalModel::SetRealParameter(id, value);
 }
 
@@ -2450,6 +2558,9 @@ std::string DragForce::GetStringParameter(const Integer id) const
    if (id == INPUT_FILE)
       return inputFile;
 
+   if (id == DENSITY_TABLE_FILE)
+      return densityTableFile;
+
    if (id == DENSITY_MODEL)
       return densityModel;
 
@@ -2694,6 +2805,14 @@ bool DragForce::SetStringParameter(const Integer id, const std::string &value)
       return true;
    }
 
+   if (id == DENSITY_TABLE_FILE)
+   {
+      densityTableFile = value;
+      if ((atmos != NULL) && atmos->IsOfType("TabulatedAtmosphere"))
+         return atmos->SetStringParameter("DensityTableFile", densityTableFile);
+      return true;
+   }
+
    return PhysicalModel::SetStringParameter(id, value);
 }
 
@@ -3345,8 +3464,17 @@ Real DragForce::GetDensity(Real *state, Real when, Integer count)
          if (sun && centralBody)
          {
             // Update the Sun vector
-            Rvector sunV = sun->GetState(when);
-            Rvector cbV  = centralBody->GetState(when);
+            const Real *sunV, *cbV;
+            if (sunSlot >= 0)
+            {
+               sunV = derivativeContext->GetBodyState(sunSlot, A1Mjd(when));
+               cbV  = derivativeContext->GetBodyState(bodySlot, A1Mjd(when));
+            }
+            else
+            {
+               sunV = sun->GetState(when).GetDataVector();
+               cbV  = centralBody->GetState(when).GetDataVector();
+            }
                 
             sunLoc[0] = sunV[0];
             sunLoc[1] = sunV[1];
@@ -78,6 +78,7 @@ public:
                                        Integer order = 1, 
                                        const Integer id = -1);
    virtual Rvector6     GetDerivativesForSpacecraft(Spacecraft *sc);
+   virtual void         SetDerivativeContext(DerivativeContext *context);
 
    // inherited from GmatBase
    virtual GmatBase*    Clone() const;
@@ -165,6 +166,10 @@ protected:
    CelestialBody        *centralBody;
    /// Position of the body with the atmosphere
    Real                 cbLoc[3];
+   /// Slot of the Sun state in the derivative context, or -1 if not used
+   Integer              sunSlot;
+   /// Slot of the central body state in the derivative context
+   Integer              bodySlot;
    /// Angular velocity of the central body
    Real                 *angVel;
    /// Flag to indicate if the atmosphere model is externally owned or internal
@@ -181,6 +186,10 @@ protected:
    std::string          densityModel;
    /// Inputfile containing all setting parameters for MarsGRAM
    std::string          inputFile;
+   /// File keeping the grid of a tabulated atmosphere, or empty for none
+   std::string          densityTableFile;
+   /// Relative density error allowed by a tabulated atmosphere
+   Real                 densityTableTolerance;
    /// Array of products of spacecraft properties
    Real                 *prefactor;
    /// Flag used to determine if data has changed for the prefactors
@@ -313,6 +322,7 @@ protected:
    
    void                 BuildPrefactors(const std::string &forModel = "Spherical");
    void                 TranslateOrigin(const Real *state, const Real now);
+   void                 CheckTimeJacobian();
 //   void                 GetDensity(Real *state, Real when = GmatTimeConstants::MJD_OF_J2000);
       
    Real                 CalculateAp(Real kp);
@@ -341,6 +351,8 @@ protected:
       KP2AP_METHOD,
       DENSITY_MODEL,
       INPUT_FILE,
+      DENSITY_TABLE_FILE,
+      DENSITY_TABLE_TOLERANCE,
       DragForceParamCount
    };
    
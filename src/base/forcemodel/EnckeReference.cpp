@@ -0,0 +1,438 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              EnckeReference
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the EnckeReference class, the reference conics used by an
+ * ODEModel that propagates with the Encke formulation.
+ */
+//------------------------------------------------------------------------------
+
+#include "EnckeReference.hpp"
+#include "ODEModelException.hpp"
+#include "GmatConstants.hpp"
+#include "MessageInterface.hpp"
+#include <cmath>
+#include <sstream>
+
+//#define DEBUG_ENCKE_REFERENCE
+
+
+//------------------------------------------------------------------------------
+// EnckeReference()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+EnckeReference::EnckeReference() :
+   mu       (0.0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~EnckeReference()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+EnckeReference::~EnckeReference()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// EnckeReference(const EnckeReference &er)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * The conics belong to the spacecraft of the model that owns the reference,
+ * so they are not copied; the copy is sized when its own model is
+ * initialized.
+ *
+ * @param er The reference copied
+ */
+//------------------------------------------------------------------------------
+EnckeReference::EnckeReference(const EnckeReference &er) :
+   mu       (er.mu)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// EnckeReference& operator=(const EnckeReference &er)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * As for the copy constructor, the conics are cleared rather than copied.
+ *
+ * @param er The reference copied
+ *
+ * @return This reference
+ */
+//------------------------------------------------------------------------------
+EnckeReference& EnckeReference::operator=(const EnckeReference &er)
+{
+   if (this != &er)
+   {
+      conics.clear();
+      mu = er.mu;
+   }
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetSize(Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Allocates the conics
+ *
+ * The conics are unset until Rectify() is called for them.
+ *
+ * @param count The number of spacecraft in the model
+ */
+//------------------------------------------------------------------------------
+void EnckeReference::SetSize(Integer count)
+{
+   Conic empty;
+   for (Integer i = 0; i < 6; ++i)
+   {
+      empty.state[i] = 0.0;
+      empty.lastState[i] = 0.0;
+   }
+   for (Integer i = 0; i < 3; ++i)
+      empty.lastAcceleration[i] = 0.0;
+   empty.epoch = empty.offset = 0.0;
+   empty.isSet = false;
+   empty.lastDt = empty.lastChi = 0.0;
+
+   conics.assign(count, empty);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetSize() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of conics
+ *
+ * @return The number of conics
+ */
+//------------------------------------------------------------------------------
+Integer EnckeReference::GetSize() const
+{
+   return (Integer)conics.size();
+}
+
+
+//------------------------------------------------------------------------------
+// void SetMu(Real gm)
+//------------------------------------------------------------------------------
+/**
+ * Sets the gravitational parameter of the conics
+ *
+ * @param gm The gravitational parameter of the force model origin, in km^3/s^2
+ */
+//------------------------------------------------------------------------------
+void EnckeReference::SetMu(Real gm)
+{
+   mu = gm;
+   for (UnsignedInt i = 0; i < conics.size(); ++i)
+      conics[i].isSet = false;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetMu() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the gravitational parameter of the conics
+ *
+ * @return The gravitational parameter
+ */
+//------------------------------------------------------------------------------
+Real EnckeReference::GetMu() const
+{
+   return mu;
+}
+
+
+//------------------------------------------------------------------------------
+// void Rectify(Integer index, const Real *state, Real atEpoch, Real atOffset)
+//------------------------------------------------------------------------------
+/**
+ * Starts a new reference conic for a spacecraft
+ *
+ * @param index    The index of the spacecraft
+ * @param state    The Cartesian state of the spacecraft about the origin
+ * @param atEpoch  The epoch of the state, in days
+ * @param atOffset The offset of the state from atEpoch, in seconds
+ */
+//------------------------------------------------------------------------------
+void EnckeReference::Rectify(Integer index, const Real *state, Real atEpoch,
+      Real atOffset)
+{
+   Conic &conic = conics[index];
+   for (Integer i = 0; i < 6; ++i)
+      conic.state[i] = state[i];
+   conic.epoch = atEpoch;
+   conic.offset = atOffset;
+   conic.isSet = false;
+
+   #ifdef DEBUG_ENCKE_REFERENCE
+      MessageInterface::ShowMessage("Encke reference %d rectified at %.12lf "
+            "+ %.6lf sec: [%.12lf %.12lf %.12lf %.12lf %.12lf %.12lf]\n",
+            index, atEpoch, atOffset, state[0], state[1], state[2], state[3],
+            state[4], state[5]);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void GetState(Integer index, Real atEpoch, Real atOffset, Real *state,
+//       Real *acceleration)
+//------------------------------------------------------------------------------
+/**
+ * Computes the state of a reference conic
+ *
+ * @param index        The index of the spacecraft
+ * @param atEpoch      The epoch requested, in days
+ * @param atOffset     The offset of the requested time from atEpoch, in
+ *                     seconds
+ * @param state        Array that receives the Cartesian state on the conic
+ * @param acceleration Array that receives the two body acceleration at that
+ *                     state, or NULL if it is not needed
+ */
+//------------------------------------------------------------------------------
+void EnckeReference::GetState(Integer index, Real atEpoch, Real atOffset,
+      Real *state, Real *acceleration)
+{
+   Conic &conic = conics[index];
+
+   Real dt = atOffset - conic.offset;
+   if (atEpoch != conic.epoch)
+      dt += (atEpoch - conic.epoch) * GmatTimeConstants::SECS_PER_DAY;
+
+   if (!conic.isSet || (dt != conic.lastDt))
+   {
+      Real chi = 0.0;
+      if (conic.isSet && (conic.lastDt != 0.0))
+         chi = conic.lastChi * dt / conic.lastDt;
+
+      if (!SolveKepler(conic.state, mu, dt, conic.lastState, chi))
+      {
+         std::stringstream msg;
+         msg << "The Encke reference orbit could not be propagated "
+             << dt << " seconds from its reference epoch\n";
+         throw ODEModelException(msg.str());
+      }
+
+      const Real *r = conic.lastState;
+      Real rMag = sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
+      Real factor = -mu / (rMag * rMag * rMag);
+      for (Integer i = 0; i < 3; ++i)
+         conic.lastAcceleration[i] = factor * r[i];
+
+      conic.lastDt = dt;
+      conic.lastChi = chi;
+      conic.isSet = true;
+   }
+
+   for (Integer i = 0; i < 6; ++i)
+      state[i] = conic.lastState[i];
+   if (acceleration != NULL)
+      for (Integer i = 0; i < 3; ++i)
+         acceleration[i] = conic.lastAcceleration[i];
+}
+
+
+//------------------------------------------------------------------------------
+// bool SolveKepler(const Real *state0, Real gm, Real dt, Real *state,
+//       Real &chi)
+//------------------------------------------------------------------------------
+/**
+ * Propagates a two body state with the universal variable formulation
+ *
+ * Kepler's equation in the universal anomaly is solved with the Laguerre
+ * method, which converges from the starting guesses used here for every type
+ * of conic (see D. Vallado, "Fundamentals of Astrodynamics and Applications",
+ * algorithm 8, and B. Conway, "An Improved Algorithm due to Laguerre for the
+ * Solution of Kepler's Equation", Celestial Mechanics 39, 1986).
+ *
+ * @param state0 The Cartesian state at the start
+ * @param gm     The gravitational parameter
+ * @param dt     The propagation time, in seconds
+ * @param state  Array that receives the propagated state
+ * @param chi    On input, a guess for the universal anomaly, or 0.0 to build
+ *               one; on output, the universal anomaly at dt
+ *
+ * @return true if the solution converged
+ */
+//------------------------------------------------------------------------------
+bool EnckeReference::SolveKepler(const Real *state0, Real gm, Real dt,
+      Real *state, Real &chi)
+{
+   if (dt == 0.0)
+   {
+      for (Integer i = 0; i < 6; ++i)
+         state[i] = state0[i];
+      chi = 0.0;
+      return true;
+   }
+
+   const Real *r0 = state0, *v0 = state0 + 3;
+   Real r0Mag = sqrt(r0[0]*r0[0] + r0[1]*r0[1] + r0[2]*r0[2]);
+   Real v0Sq = v0[0]*v0[0] + v0[1]*v0[1] + v0[2]*v0[2];
+   Real rDotV = r0[0]*v0[0] + r0[1]*v0[1] + r0[2]*v0[2];
+   Real sqrtMu = sqrt(gm);
+   Real sigma0 = rDotV / sqrtMu;
+   // Reciprocal of the semimajor axis
+   Real alpha = 2.0 / r0Mag - v0Sq / gm;
+
+   if (chi == 0.0)
+   {
+      if (alpha * r0Mag > 1.0e-6)
+         chi = sqrtMu * dt * alpha;
+      else if (alpha * r0Mag < -1.0e-6)
+      {
+         Real a = 1.0 / alpha;
+         Real sign = (dt > 0.0 ? 1.0 : -1.0);
+         Real arg = -2.0 * gm * alpha * dt /
+               (rDotV + sign * sqrt(-gm * a) * (1.0 - r0Mag * alpha));
+         if (arg > 0.0)
+            chi = sign * sqrt(-a) * log(arg);
+         else
+            chi = sqrtMu * dt / r0Mag;
+      }
+      else
+         chi = sqrtMu * dt / r0Mag;
+   }
+
+   // Laguerre iteration
+   const Real n = 5.0;
+   Real c2 = 0.5, c3 = 1.0 / 6.0, psi = 0.0, r = r0Mag;
+   bool converged = false;
+   for (Integer i = 0; i < 50; ++i)
+   {
+      Real chiSq = chi * chi;
+      psi = chiSq * alpha;
+      Stumpff(psi, c2, c3);
+
+      Real terms[4] = {chiSq * chi * c3, sigma0 * chiSq * c2,
+            r0Mag * chi * (1.0 - psi * c3), -sqrtMu * dt};
+      Real f = terms[0] + terms[1] + terms[2] + terms[3];
+      Real scale = fabs(terms[0]) + fabs(terms[1]) + fabs(terms[2]) +
+            fabs(terms[3]);
+      // f' is the radius
+      r = chiSq * c2 + sigma0 * chi * (1.0 - psi * c3) +
+            r0Mag * (1.0 - psi * c2);
+      Real fpp = sigma0 * (1.0 - psi * c2) +
+            (1.0 - alpha * r0Mag) * chi * (1.0 - psi * c3);
+
+      Real root = sqrt(fabs((n - 1.0) * (n - 1.0) * r * r -
+            n * (n - 1.0) * f * fpp));
+      Real denominator = (r >= 0.0 ? r + root : r - root);
+      if (denominator == 0.0)
+         return false;
+      Real dChi = n * f / denominator;
+      chi -= dChi;
+
+      // The residual stops at the rounding of the terms of Kepler's equation
+      if ((fabs(dChi) <= 1.0e-15 * (1.0 + fabs(chi))) ||
+          (fabs(f) <= 4.0e-15 * scale))
+      {
+         converged = true;
+         break;
+      }
+   }
+
+   if (!converged || !(r > 0.0))
+      return false;
+
+   // Lagrange coefficients at the converged anomaly
+   Real chiSq = chi * chi;
+   psi = chiSq * alpha;
+   Stumpff(psi, c2, c3);
+   r = chiSq * c2 + sigma0 * chi * (1.0 - psi * c3) + r0Mag * (1.0 - psi * c2);
+
+   Real f    = 1.0 - chiSq * c2 / r0Mag;
+   Real g    = dt - chiSq * chi * c3 / sqrtMu;
+   Real fDot = sqrtMu / (r * r0Mag) * chi * (psi * c3 - 1.0);
+   Real gDot = 1.0 - chiSq * c2 / r;
+
+   for (Integer i = 0; i < 3; ++i)
+   {
+      state[i]     = f * r0[i] + g * v0[i];
+      state[i + 3] = fDot * r0[i] + gDot * v0[i];
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void Stumpff(Real z, Real &c2, Real &c3)
+//------------------------------------------------------------------------------
+/**
+ * Computes the Stumpff functions c2(z) and c3(z)
+ *
+ * Near z = 0 the closed forms lose precision, so the power series are used
+ * there.
+ *
+ * @param z  The argument, the square of the universal anomaly over the
+ *           semimajor axis
+ * @param c2 The function c2(z) = (1 - cos(sqrt(z))) / z
+ * @param c3 The function c3(z) = (sqrt(z) - sin(sqrt(z))) / sqrt(z)^3
+ */
+//------------------------------------------------------------------------------
+void EnckeReference::Stumpff(Real z, Real &c2, Real &c3)
+{
+   if (z > 0.1)
+   {
+      Real s = sqrt(z);
+      c2 = (1.0 - cos(s)) / z;
+      c3 = (s - sin(s)) / (s * z);
+   }
+   else if (z < -0.1)
+   {
+      Real s = sqrt(-z);
+      c2 = (cosh(s) - 1.0) / -z;
+      c3 = (sinh(s) - s) / (s * -z);
+   }
+   else
+   {
+      // c2 = sum (-z)^k / (2k+2)!, c3 = sum (-z)^k / (2k+3)!
+      Real term2 = 0.5, term3 = 1.0 / 6.0;
+      c2 = term2;
+      c3 = term3;
+      for (Integer k = 1; k < 8; ++k)
+      {
+         term2 *= -z / ((2.0 * k + 1.0) * (2.0 * k + 2.0));
+         term3 *= -z / ((2.0 * k + 2.0) * (2.0 * k + 3.0));
+         c2 += term2;
+         c3 += term3;
+      }
+   }
+}
@@ -0,0 +1,100 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              EnckeReference
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Declares the EnckeReference class, the reference conics used by an ODEModel
+ * that propagates with the Encke formulation.
+ */
+//------------------------------------------------------------------------------
+#ifndef EnckeReference_hpp
+#define EnckeReference_hpp
+
+#include "gmatdefs.hpp"
+
+/**
+ * Two body reference orbits for the Encke formulation of an ODEModel
+ *
+ * Each spacecraft in the model has a reference conic about the force model
+ * origin, set from the spacecraft state at a reference time.  The model
+ * integrates the deviation of the spacecraft from its conic; the conic state
+ * at other times comes from the universal variable solution of Kepler's
+ * equation, so the same code covers elliptic, parabolic and hyperbolic
+ * references.
+ *
+ * Times are passed as an epoch in days and an offset in seconds from that
+ * epoch, matching the epoch and elapsed time held by the ODEModel.  Offsets
+ * from an unchanged epoch are differenced without rounding the epoch.
+ *
+ * The last solution for each spacecraft is cached, because the model asks for
+ * the conic state at each epoch more than once during a derivative
+ * evaluation.
+ */
+class GMAT_API EnckeReference
+{
+public:
+   EnckeReference();
+   virtual ~EnckeReference();
+   EnckeReference(const EnckeReference &er);
+   EnckeReference& operator=(const EnckeReference &er);
+
+   void           SetSize(Integer count);
+   Integer        GetSize() const;
+   void           SetMu(Real gm);
+   Real           GetMu() const;
+
+   void           Rectify(Integer index, const Real *state, Real atEpoch,
+                          Real atOffset);
+   void           GetState(Integer index, Real atEpoch, Real atOffset,
+                           Real *state, Real *acceleration);
+
+   static bool    SolveKepler(const Real *state0, Real gm, Real dt,
+                              Real *state, Real &chi);
+
+protected:
+   /// Reference conic and the cached solution for one spacecraft
+   struct Conic
+   {
+      /// Cartesian state at the reference time
+      Real              state[6];
+      /// Epoch of the reference time, in days
+      Real              epoch;
+      /// Offset of the reference time from the epoch, in seconds
+      Real              offset;
+      /// Flag indicating that the cached solution holds data
+      bool              isSet;
+      /// Time from the reference of the cached solution, in seconds
+      Real              lastDt;
+      /// Universal anomaly of the cached solution
+      Real              lastChi;
+      /// Cached Cartesian state
+      Real              lastState[6];
+      /// Cached two body acceleration
+      Real              lastAcceleration[3];
+   };
+
+   /// The reference conics
+   std::vector<Conic>   conics;
+   /// Gravitational parameter of the force model origin
+   Real                 mu;
+
+   static void    Stumpff(Real z, Real &c2, Real &c3);
+};
+
+#endif // EnckeReference_hpp
@@ -712,14 +712,16 @@ bool FiniteThrust::GetDerivatives(Real * state, Real dt, Integer order,
                "burns cannot maneuver " + sat->GetTypeName() + " objects");
             // Start with zero thrust
             mDot = accel[0] = accel[1] = accel[2] = 0.0;
+            Real now = epoch + (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
    
             // Accumulate thrust and mass flow for each active thruster
             for (std::vector <FiniteBurn*>::iterator fb = burns.begin();
                  fb != burns.end(); ++fb)
             {
-               // Setting the spacecraft here makes the setting too late for parameters evaluated at maneuver start
-               (*fb)->SetSpacecraftToManeuver((Spacecraft*)sat);
-               Real now = epoch + (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
+               // Setting the spacecraft here makes the setting too late for parameters evaluated at maneuver start.
+               // The burn is fired at the stage epoch below, so there is no
+               // need to evaluate it at the spacecraft epoch first.
+               (*fb)->SetManeuveringSpacecraft((Spacecraft*)sat);
                if ((*fb)->Fire(burnData, now)) 
                {
                   #ifdef DEBUG_FINITETHRUST_EXE
@@ -851,13 +853,13 @@ Rvector6 FiniteThrust::GetDerivativesForSpacecraft(Spacecraft* sc)
       // Start with zero thrust
       //mDot =
       accel[0] = accel[1] = accel[2] = 0.0;
+      Real now = sc->GetEpoch();
 
       // Accumulate thrust and mass flow for each active thruster
       for (std::vector <FiniteBurn*>::iterator fb = burns.begin();
            fb != burns.end(); ++fb)
       {
-         (*fb)->SetSpacecraftToManeuver(sc);
-         Real now = sc->GetEpoch();
+         (*fb)->SetManeuveringSpacecraft(sc);
          if ((*fb)->Fire(burnData, now))
          {
             accel[0] += burnData[0];
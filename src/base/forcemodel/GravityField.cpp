@@ -78,6 +78,7 @@
 #include "GmatDefaults.hpp"
 #include "UtilityException.hpp"
 #include "FileManager.hpp"
+#include "DerivativeContext.hpp"
 #include <sstream>                 // for <<
 
 //#define DEBUG_GRAVITY_FIELD
@@ -113,6 +114,10 @@ GravityField::PARAMETER_TEXT[GravityFieldParamCount - HarmonicFieldParamCount] =
    "TideFile",
    "TideFileFullPath",
    "TideModel",
+   "DifferentialGravityRadius",
+   "ThreadCount",
+   "UsePackedKernel",
+   "UseZonalKernel",
 };
 
 const Gmat::ParameterType
@@ -123,6 +128,10 @@ GravityField::PARAMETER_TYPE[GravityFieldParamCount - HarmonicFieldParamCount] =
    Gmat::FILENAME_TYPE,  // "TideFile",
    Gmat::FILENAME_TYPE,  // "TideFileFullPath",
    Gmat::STRING_TYPE,
+   Gmat::REAL_TYPE,      // "DifferentialGravityRadius",
+   Gmat::INTEGER_TYPE,   // "ThreadCount",
+   Gmat::BOOLEAN_TYPE,   // "UsePackedKernel",
+   Gmat::BOOLEAN_TYPE,   // "UseZonalKernel",
 };
 //------------------------------------------------------------------------------
 const std::string GravityField::GRAVITY_MODEL_NAMES[NumGravityModels] =
@@ -164,6 +173,10 @@ GravityField::GravityField(const std::string &name, const std::string &forBodyNa
    tideFilename           (""),
    tideFilenameFullPath   (""),
    TideModel              ("None"),
+   differentialRadius     (0.0),
+   threadCount            (1),
+   usePackedKernel        (false),
+   useZonalKernel         (false),
    defaultMu              (GmatSolarSystemDefaults::PLANET_MU[GmatSolarSystemDefaults::EARTH]),
    defaultA               (GmatSolarSystemDefaults::PLANET_EQUATORIAL_RADIUS[GmatSolarSystemDefaults::EARTH]),
    gfInitialized          (false),
@@ -171,6 +184,7 @@ GravityField::GravityField(const std::string &name, const std::string &forBodyNa
    degreeTruncateReported (false),
    offsetBodyOrigin       (false),
    gravityModel           (NULL),
+   rotationSlot           (-1),
    j2k                    (NULL)
 {
    objectTypeNames.push_back("GravityField");
@@ -221,6 +235,10 @@ GravityField::GravityField(const GravityField &gf) :
     tideFilename           (gf.tideFilename),
     tideFilenameFullPath   (gf.tideFilenameFullPath),
     TideModel              (gf.TideModel),
+    differentialRadius     (gf.differentialRadius),
+    threadCount            (gf.threadCount),
+    usePackedKernel        (gf.usePackedKernel),
+    useZonalKernel         (gf.useZonalKernel),
     defaultMu              (gf.defaultMu),
     defaultA               (gf.defaultA),
     gfInitialized          (false),
@@ -228,6 +246,7 @@ GravityField::GravityField(const GravityField &gf) :
     degreeTruncateReported (gf.degreeTruncateReported),
     offsetBodyOrigin       (gf.offsetBodyOrigin),
     gravityModel           (NULL),
+    rotationSlot           (-1),
     j2k                    (NULL),
     frv                    (gf.frv),
     trv                    (gf.trv),
@@ -269,6 +288,10 @@ GravityField& GravityField::operator=(const GravityField &gf)
    tideFilename           = gf.tideFilename;
    tideFilenameFullPath   = gf.tideFilenameFullPath;
    TideModel              = gf.TideModel;
+   differentialRadius     = gf.differentialRadius;
+   threadCount            = gf.threadCount;
+   usePackedKernel        = gf.usePackedKernel;
+   useZonalKernel         = gf.useZonalKernel;
    defaultMu              = gf.defaultMu;
    defaultA               = gf.defaultA;
    bodyName               = gf.bodyName;
@@ -279,6 +302,7 @@ GravityField& GravityField::operator=(const GravityField &gf)
 //   if ((gravityModel) && (gravityModel->GetFilename() == "")) delete gravityModel;  // delete only Body ones
    gravityModel           = gf.gravityModel;
 //   gravityModel           = NULL;
+   rotationSlot           = -1;
    j2k                    = NULL;
    frv                    = gf.frv;
    trv                    = gf.trv;
@@ -302,6 +326,7 @@ GravityField& GravityField::operator=(const GravityField &gf)
 //------------------------------------------------------------------------------
 bool GravityField::Initialize()
 {
+   CheckTimeJacobian();
    if (gfInitialized && hMinitialized) return true;
    if (!HarmonicField::Initialize())
    {
@@ -343,7 +368,10 @@ bool GravityField::Initialize()
       offsetBodyOrigin = true;
    }
 
-   if ((!fileRead) || (!gravityModel))
+   // The model holds only the degree and order it was loaded for, so it is
+   // loaded again if either was raised since
+   if ((!fileRead) || (!gravityModel) || (gravityModel->GetNN() < degree) ||
+       (gravityModel->GetMM() < (order < degree ? order : degree)))
    {
       Integer fileDegree = 0;
       Integer fileOrder  = 0;
@@ -364,7 +392,8 @@ bool GravityField::Initialize()
 
          // Changed to open filenameFullPath (LOJ: 2014.06.26)
          //gravityModel = GetGravityFile(filename,a,mu);
-         gravityModel = GetHarmonicGravity(filenameFullPath,tideFilenameFullPath,a,mu,body->GetName(), true);
+         gravityModel = GetHarmonicGravity(filenameFullPath,tideFilenameFullPath,a,mu,body->GetName(), true,
+               degree, order);
          if (!gravityModel)
          {
             std::string errmsg = "Gravity file ";
@@ -377,8 +406,8 @@ bool GravityField::Initialize()
             #ifdef DEBUG_GRAVITY_FILE_READ
                MessageInterface::ShowMessage("--- HarmonicGravity object retrieved is <%p>\n", gravityModel);
             #endif
-            fileDegree =   gravityModel->GetNN();
-            fileOrder  =   gravityModel->GetMM();
+            fileDegree =   gravityModel->GetFileNN();
+            fileOrder  =   gravityModel->GetFileMM();
             mu         = - gravityModel->GetFactor();
             a          =   gravityModel->GetFieldRadius();
          }
@@ -536,12 +565,15 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
          throw ODEModelException("GetDerivatives: cartesianCount < stmCount or aMatrixCount\n");
       }
       Real originacc[3] = { 0.0,0.0,0.0 };  // JPD code
-      Rmatrix33 origingrad (0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
-      Rmatrix33 emptyGradient(0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
-      Rmatrix33 gradnew (0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
+      // The gradients are members, so no matrices are built per call
+      Rmatrix33 &origingrad = originGradient;
+      Rmatrix33 &gradnew = fieldGradient;
       if (body != forceOrigin)
       {
          Real originstate[6] = { 0.0,0.0,0.0,0.0,0.0,0.0 };
+         for (Integer i = 0; i < 3; ++i)
+            for (Integer j = 0; j < 3; ++j)
+               origingrad(i,j) = 0.0;
          Calculate(dt,originstate,originacc,origingrad);
 #ifdef DEBUG_DERIVATIVES
       MessageInterface::ShowMessage("---------> origingrad = %s\n", origingrad.ToString().c_str());
@@ -549,6 +581,17 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
       }
 
 
+      // Without STM or A-matrix data, several spacecraft are evaluated
+      // together so that the epoch dependent data is computed only once
+      bool useBatch = (cartesianCount > 1) && !fillSTM && !fillAMatrix &&
+            !fillTimeJacobian && (gravityModel != NULL);
+      if (useBatch)
+      {
+         batchAcc.resize(3 * cartesianCount);
+         CalculateBatch(dt, &state[cartesianStart], cartesianCount,
+               &batchAcc[0]);
+      }
+
 		Integer i6 = (fillSTM ? stmStart : aMatrixStart);
       for (Integer n = 0; n < cartesianCount; ++n)
       {
@@ -557,13 +600,24 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
             satState[i] = state[i+nOffset];
 
          Real accnew[3];  // JPD code
-         gradnew = emptyGradient;
-         Calculate(dt,satState,accnew,gradnew);
+         for (Integer i = 0; i < 3; ++i)
+            for (Integer j = 0; j < 3; ++j)
+               gradnew(i,j) = 0.0;
+         if (useBatch)
+         {
+            for (Integer i = 0; i < 3; ++i)
+               accnew[i] = batchAcc[3*n+i];
+         }
+         else
+            Calculate(dt,satState,accnew,gradnew);
          if (body != forceOrigin)
          {
             for (Integer i=0;  i<=2;  ++i)
+            {
                accnew[i] -= originacc[i];
-            gradnew -= origingrad;
+               for (Integer j=0;  j<=2;  ++j)
+                  gradnew(i,j) -= origingrad(i,j);
+            }
 #ifdef DEBUG_DERIVATIVES
       MessageInterface::ShowMessage("---------> body not equal to forceOrigin\n");
 #endif
@@ -571,6 +625,11 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
 #ifdef DEBUG_DERIVATIVES
       MessageInterface::ShowMessage("---------> gradnew (%d) = %s\n", n, gradnew.ToString().c_str());
 #endif
+
+         // The time Jacobian is built for the first spacecraft
+         if ((n == 0) && fillTimeJacobian && hasTimeJacobian &&
+             (timeJacobian != NULL))
+            FillTimeJacobian(satState, accnew, gradnew);
          
          // Fill Derivatives
          switch (dvorder)
@@ -634,8 +693,10 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
 					//Create aTilde
 					stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");
 					Integer stmSize = stmRowCount * stmRowCount;
-					Real *aTilde;
-					aTilde = new Real[stmSize];
+					// The buffer only grows, so it is sized on the first call
+					if ((Integer)aTildeBuffer.size() < stmSize)
+					   aTildeBuffer.resize(stmSize);
+					Real *aTilde = &aTildeBuffer[0];
                for (Integer i = 0; i < stmRowCount; ++i)
                {
                   ix = i * stmRowCount;
@@ -670,7 +731,6 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
                   }
                }
 
-					delete[] aTilde;
 					i6 = i6 + stmSize;
             }
          }
@@ -690,8 +750,10 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
 					//Create aTilde
 					stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");
 					Integer stmSize = stmRowCount * stmRowCount;
-					Real *aTilde;
-					aTilde = new Real[stmSize];
+					// The buffer only grows, so it is sized on the first call
+					if ((Integer)aTildeBuffer.size() < stmSize)
+					   aTildeBuffer.resize(stmSize);
+					Real *aTilde = &aTildeBuffer[0];
                for (Integer i = 0; i < stmRowCount; ++i)
                {
                   ix = i * stmRowCount;
@@ -726,7 +788,6 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
                   }
                }
 
-					delete[] aTilde;
 					i6 = i6 + stmSize;
 				}
          }
@@ -754,6 +815,29 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
 }
 
 
+//------------------------------------------------------------------------------
+// void SetDerivativeContext(DerivativeContext *context)
+//------------------------------------------------------------------------------
+/**
+ * Sets the shared epoch data, and registers the body fixed rotation
+ *
+ * The shared matrix is a pure rotation, so it is only used when the input
+ * and body fixed frames have the same origin.
+ *
+ * @param context The context, or NULL to use the coordinate converter
+ */
+//------------------------------------------------------------------------------
+void GravityField::SetDerivativeContext(DerivativeContext *context)
+{
+   PhysicalModel::SetDerivativeContext(context);
+
+   rotationSlot = -1;
+   if ((context != NULL) && (inputCS != NULL) && (fixedCS != NULL) &&
+       (inputCS->GetOrigin() == fixedCS->GetOrigin()))
+      rotationSlot = context->AddRotation(inputCS, fixedCS);
+}
+
+
 //------------------------------------------------------------------------------
 // Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc)
 //------------------------------------------------------------------------------
@@ -912,11 +996,12 @@ Integer     GravityField::GetParameterID(const std::string &str) const
       return TIDE_MODEL;
    }
 
-   for (Integer i = HarmonicFieldParamCount; i < GravityFieldParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - HarmonicFieldParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, HarmonicFieldParamCount,
+               GravityFieldParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return HarmonicField::GetParameterID(str);
 }
 
@@ -960,6 +1045,18 @@ bool GravityField::IsParameterReadOnly(const Integer id) const
    if (id == TIDE_FILENAME)
       return false;
 
+   if (id == DIFFERENTIAL_RADIUS)
+      return false;
+
+   if (id == THREAD_COUNT)
+      return false;
+
+   if (id == USE_PACKED_KERNEL)
+      return false;
+
+   if (id == USE_ZONAL_KERNEL)
+      return false;
+
    if ((id == TIDE_MODEL) && (bodyName == GmatSolarSystemDefaults::EARTH_NAME)) return false;
    if ((id == TIDE_MODEL) && (bodyName == GmatSolarSystemDefaults::MOON_NAME)) return false;
    if ((id == TIDE_MODEL) && (bodyName == GmatSolarSystemDefaults::MERCURY_NAME)) return false;
@@ -1029,6 +1126,7 @@ Real        GravityField::GetRealParameter(const Integer id) const
 {
    if (id == MU)       return mu;
    if (id == A)        return a;
+   if (id == DIFFERENTIAL_RADIUS) return differentialRadius;
 
    return HarmonicField::GetRealParameter(id);
 }
@@ -1048,6 +1146,13 @@ Real        GravityField::SetRealParameter(const Integer id,
 {
    if (id == MU)       return (mu     = value);
    if (id == A)        return (a      = value);
+   if (id == DIFFERENTIAL_RADIUS)
+   {
+      if (value < 0.0)
+         throw ODEModelException("The DifferentialGravityRadius on " +
+               instanceName + " must be zero or positive");
+      return (differentialRadius = value);
+   }
 
    return HarmonicField::SetRealParameter(id, value);
 }
@@ -1085,6 +1190,164 @@ Real GravityField::SetRealParameter(const std::string &label,
    return SetRealParameter(id, value);
 }
 
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to obtain a parameter value
+ *
+ * @param id    Integer ID for the requested parameter
+ */
+//------------------------------------------------------------------------------
+Integer GravityField::GetIntegerParameter(const Integer id) const
+{
+   if (id == THREAD_COUNT) return threadCount;
+
+   return HarmonicField::GetIntegerParameter(id);
+}
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to set a parameter value
+ *
+ * @param    id    Integer ID for the parameter
+ * @param    value The new value for the parameter
+ */
+//------------------------------------------------------------------------------
+Integer GravityField::SetIntegerParameter(const Integer id,
+                                          const Integer value)
+{
+   if (id == THREAD_COUNT)
+   {
+      if (value < 0)
+         throw ODEModelException("The ThreadCount on " + instanceName +
+               " must be 0 or greater");
+      return (threadCount = value);
+   }
+
+   return HarmonicField::SetIntegerParameter(id, value);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to obtain a parameter value
+ *
+ * @param label    string ID for the requested parameter
+ */
+//------------------------------------------------------------------------------
+Integer GravityField::GetIntegerParameter(const std::string &label) const
+{
+   Integer id = GetParameterID(label);
+   return GetIntegerParameter(id);
+}
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const std::string &label, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to set a parameter value
+ *
+ * @param    label    string ID for the requested parameter
+ * @param    value    The new value for the parameter
+ */
+//------------------------------------------------------------------------------
+Integer GravityField::SetIntegerParameter(const std::string &label,
+                                          const Integer value)
+{
+   Integer id = GetParameterID(label);
+   return SetIntegerParameter(id, value);
+}
+
+//------------------------------------------------------------------------------
+// bool GetBooleanParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to obtain a parameter value
+ *
+ * @param id    Integer ID for the requested parameter
+ */
+//------------------------------------------------------------------------------
+bool GravityField::GetBooleanParameter(const Integer id) const
+{
+   if (id == USE_PACKED_KERNEL) return usePackedKernel;
+   if (id == USE_ZONAL_KERNEL)  return useZonalKernel;
+
+   return HarmonicField::GetBooleanParameter(id);
+}
+
+//------------------------------------------------------------------------------
+// bool SetBooleanParameter(const Integer id, const bool value)
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to set a parameter value
+ *
+ * UsePackedKernel selects the packed Legendre row kernel for acceleration
+ * only evaluations.  Its sums are accumulated in vector lanes, so the results
+ * differ from the default recursion in the last bits, and between hosts with
+ * different instruction sets.
+ *
+ * UseZonalKernel evaluates fields without tesseral terms and without tides,
+ * such as J2 only models, by the closed form zonal kernel.  Its results agree
+ * with the recursion to about 1e-12 relative, not bit for bit.
+ *
+ * @param    id    Integer ID for the parameter
+ * @param    value The new value for the parameter
+ */
+//------------------------------------------------------------------------------
+bool GravityField::SetBooleanParameter(const Integer id, const bool value)
+{
+   if (id == USE_PACKED_KERNEL)
+   {
+      usePackedKernel = value;
+      gravityWorkspace.UsePackedKernel = value;
+      return usePackedKernel;
+   }
+
+   if (id == USE_ZONAL_KERNEL)
+   {
+      useZonalKernel = value;
+      return useZonalKernel;
+   }
+
+   return HarmonicField::SetBooleanParameter(id, value);
+}
+
+//------------------------------------------------------------------------------
+// bool GetBooleanParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to obtain a parameter value
+ *
+ * @param label    string ID for the requested parameter
+ */
+//------------------------------------------------------------------------------
+bool GravityField::GetBooleanParameter(const std::string &label) const
+{
+   Integer id = GetParameterID(label);
+   return GetBooleanParameter(id);
+}
+
+//------------------------------------------------------------------------------
+// bool SetBooleanParameter(const std::string &label, const bool value)
+//------------------------------------------------------------------------------
+/**
+ * Accessor method used to set a parameter value
+ *
+ * @param    label    string ID for the requested parameter
+ * @param    value    The new value for the parameter
+ */
+//------------------------------------------------------------------------------
+bool GravityField::SetBooleanParameter(const std::string &label,
+                                       const bool value)
+{
+   Integer id = GetParameterID(label);
+   return SetBooleanParameter(id, value);
+}
+
 //------------------------------------------------------------------------------
 // std::string GetStringParameter(const Integer id) const
 //------------------------------------------------------------------------------
@@ -1137,7 +1400,8 @@ bool GravityField::SetStringParameter(const Integer id,
    }
    if (id == TIDE_MODEL)
    {
-       HarmonicGravity *gm = GetHarmonicGravity(filenameFullPath, tideFilenameFullPath, a, mu, bodyName, true);
+       // Only the tide flags are needed, so the coefficients are cut to degree 2
+       HarmonicGravity *gm = GetHarmonicGravity(filenameFullPath, tideFilenameFullPath, a, mu, bodyName, true, 2, 2);
 
        if (gm != NULL)
        {
@@ -1445,19 +1709,35 @@ void GravityField::Calculate (Real dt, Real state[6],
    }
 
    // convert to body fixed coordinate system
-   Real tmpState[6];
-//   CoordinateConverter cc; - move back to class, for performance
-   if (hasPrecisionTime)
-      cc.Convert(nowGT, state, inputCS, tmpState, fixedCS);  // which CSs to use here???
-   else
-      cc.Convert(now, state, inputCS, tmpState, fixedCS);  // which CSs to use here???
+   Real tmpState[3];
+   RotateToFixed(dt, state, tmpState);
+
+   bool computeMatrix = fillAMatrix || fillSTM ||
+         (fillTimeJacobian && hasTimeJacobian);
+   gravityWorkspace.UsePackedKernel = usePackedKernel;
+
+   if (UseZonalField())
+   {
+      // The zonal field only needs the pole, so it is evaluated in the axes
+      // of the input frame and nothing is rotated back
+      Real pos[3], pole[3];
+      for (Integer i = 0; i < 3; ++i)
+      {
+         pos[i]  = rotMatrix(0,i) * tmpState[0] + rotMatrix(1,i) * tmpState[1] +
+                   rotMatrix(2,i) * tmpState[2];
+         pole[i] = rotMatrix(2,i);
+      }
+      gravityModel->CalculateFullZonalField(
+            (hasPrecisionTime ? jdayGT.GetMjd() : jday), pos, pole, degree,
+            computeMatrix, stmLimit, acc, grad, gravityWorkspace);
+      return;
+   }
 
    #ifdef DEBUG_CALCULATE
       MessageInterface::ShowMessage(
-            "After Convert, jday = %s, now = %s, and tmpState = %12.10f  %12.10f  %12.10f  %12.10f  %12.10f  %12.10f\n",
-            jdayGT.ToString().c_str(), nowGT.ToString().c_str(), tmpState[0], tmpState[1], tmpState[2], tmpState[3], tmpState[4], tmpState[5]);
+            "After Convert, jday = %s, now = %s, and tmpState = %12.10f  %12.10f  %12.10f\n",
+            jdayGT.ToString().c_str(), nowGT.ToString().c_str(), tmpState[0], tmpState[1], tmpState[2]);
    #endif
-   Rmatrix33 rotMatrix = cc.GetLastRotationMatrix();
    #ifdef DEBUG_DERIVATIVES
       MessageInterface::ShowMessage("---->>>> rotMatrix = %s\n", rotMatrix.ToString().c_str());
    #endif
@@ -1468,8 +1748,250 @@ void GravityField::Calculate (Real dt, Real state[6],
    Real othermukm   = 0.0; 
    // Acceleration
    Real      rotacc[3];
-   Rmatrix33 rotgrad;
-   Integer   tideLevel = -1;
+   Rmatrix33 &rotgrad = rotGradient;
+   Integer   tideLevel;
+   Real      xp, yp;
+   GetFieldEpochData(dt, tideLevel, sunpos, sunmukm, otherpos, othermukm,
+         xp, yp);
+
+   if (hasPrecisionTime)
+      gravityModel->CalculateFullField(jdayGT.GetMjd(), tmpState, degree, order, tideLevel,
+         sunpos, sunmukm, otherpos, othermukm,
+         xp, yp, computeMatrix, stmLimit, rotacc, rotgrad, gravityWorkspace);
+   else
+      gravityModel->CalculateFullField (jday, tmpState, degree, order, tideLevel, 
+         sunpos, sunmukm, otherpos, othermukm,
+         xp, yp, computeMatrix, stmLimit, rotacc, rotgrad, gravityWorkspace);
+
+   #ifdef DEBUG_DERIVATIVES
+      MessageInterface::ShowMessage("after CalculateFullField, rotgrad = %s\n", rotgrad.ToString().c_str());
+   #endif
+   /*
+    MessageInterface::ShowMessage
+    ("HarmonicField::Calculate pos= %20.14f %20.14f %20.14f\n",
+    tmpState[0],tmpState[1],tmpState[2]);
+    MessageInterface::ShowMessage
+    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
+    rotgrad(0,0),rotgrad(0,1),rotgrad(0,2));
+    MessageInterface::ShowMessage
+    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
+    rotgrad(1,0),rotgrad(1,1),rotgrad(1,2));
+    MessageInterface::ShowMessage
+    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
+    rotgrad(2,0),rotgrad(2,1),rotgrad(2,2));
+    */
+   
+   // Convert back to target CS
+   InverseRotate (rotMatrix,rotacc,acc);
+
+   // grad = rotMatrix^T * rotgrad * rotMatrix, built in place
+   Real gr[3][3];
+   for (Integer i = 0; i < 3; ++i)
+      for (Integer j = 0; j < 3; ++j)
+         gr[i][j] = rotgrad(i,0) * rotMatrix(0,j) +
+                    rotgrad(i,1) * rotMatrix(1,j) +
+                    rotgrad(i,2) * rotMatrix(2,j);
+   for (Integer i = 0; i < 3; ++i)
+      for (Integer j = 0; j < 3; ++j)
+         grad(i,j) = rotMatrix(0,i) * gr[0][j] + rotMatrix(1,i) * gr[1][j] +
+                     rotMatrix(2,i) * gr[2][j];
+   #ifdef DEBUG_DERIVATIVES
+      MessageInterface::ShowMessage("at end of Calculate, after rotation, grad = %s\n", grad.ToString().c_str());
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// void RotateToFixed(Real dt, const Real *state, Real *fixedPos)
+//------------------------------------------------------------------------------
+/**
+ * Converts a position to the body fixed frame, and sets rotMatrix.
+ *
+ * The rotation shared through the derivative context is used when one was
+ * registered; otherwise the full conversion is made by the coordinate
+ * converter.
+ *
+ * @param dt       Time offset from the current epoch
+ * @param state    Cartesian state in the input frame
+ * @param fixedPos Body fixed position
+ */
+//------------------------------------------------------------------------------
+void GravityField::RotateToFixed(Real dt, const Real *state, Real *fixedPos)
+{
+   if (rotationSlot >= 0)
+   {
+      const Real *rm, *rmDot = NULL;
+      if (hasPrecisionTime)
+      {
+         GmatTime atTime = epochGT;
+         atTime.AddSeconds(elapsedTime);
+         atTime.AddSeconds(dt);
+         rm = derivativeContext->GetRotation(rotationSlot, atTime);
+         if (fillTimeJacobian)
+            rmDot = derivativeContext->GetRotationDot(rotationSlot, atTime);
+      }
+      else
+      {
+         A1Mjd atTime(epoch + (elapsedTime + dt) /
+               GmatTimeConstants::SECS_PER_DAY);
+         rm = derivativeContext->GetRotation(rotationSlot, atTime);
+         if (fillTimeJacobian)
+            rmDot = derivativeContext->GetRotationDot(rotationSlot, atTime);
+      }
+
+      // The frames share an origin, so only the rotation is applied
+      for (Integer i = 0; i < 3; ++i)
+      {
+         for (Integer j = 0; j < 3; ++j)
+         {
+            rotMatrix(i,j) = rm[3*i+j];
+            if (rmDot != NULL)
+               rotDotMatrix(i,j) = rmDot[3*i+j];
+         }
+         fixedPos[i] = rm[3*i] * state[0] + rm[3*i+1] * state[1] +
+                       rm[3*i+2] * state[2];
+      }
+   }
+   else
+   {
+      Real tmpState[6];
+      if (hasPrecisionTime)
+      {
+         GmatTime atTime = epochGT;
+         atTime.AddSeconds(elapsedTime);
+         atTime.AddSeconds(dt);
+         cc.Convert(atTime, state, inputCS, tmpState, fixedCS);
+      }
+      else
+         cc.Convert(epoch + (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY,
+               state, inputCS, tmpState, fixedCS);
+      rotMatrix = cc.GetLastRotationMatrix();
+      if (fillTimeJacobian)
+         rotDotMatrix = cc.GetLastRotationDotMatrix();
+      for (Integer i = 0; i < 3; ++i)
+         fixedPos[i] = tmpState[i];
+   }
+}
+
+//------------------------------------------------------------------------------
+// void CheckTimeJacobian()
+//------------------------------------------------------------------------------
+/**
+ * Determines if the time Jacobian can be built analytically.
+ *
+ * Without tides, the coefficients of the field are constant, so the field
+ * depends on time only through the rotation of the body fixed frame.  That
+ * dependence is built analytically when the field is about the force origin
+ * and the input and body fixed frames share that origin.  Other
+ * configurations are left to the finite difference time Jacobian of the
+ * ODEModel.
+ */
+//------------------------------------------------------------------------------
+void GravityField::CheckTimeJacobian()
+{
+   hasTimeJacobian = (TideModel == "None") && (body != NULL) &&
+         (body == forceOrigin) && (inputCS != NULL) && (fixedCS != NULL) &&
+         (inputCS->GetOrigin() == fixedCS->GetOrigin());
+}
+
+//------------------------------------------------------------------------------
+// bool UseZonalField() const
+//------------------------------------------------------------------------------
+/**
+ * Determines if the field is evaluated by the closed form zonal kernel.
+ *
+ * Fields with order 0, or loaded from a file of zonal terms only, have no
+ * tesseral terms; without tides their coefficients are also constant, so
+ * HarmonicGravity::CalculateFullZonalField gives the field and its gradient from
+ * the pole direction alone.  The kernel is used for them only when
+ * UseZonalKernel is set.
+ *
+ * @return true if the zonal kernel is used
+ */
+//------------------------------------------------------------------------------
+bool GravityField::UseZonalField() const
+{
+   return useZonalKernel && (gravityModel != NULL) && (TideModel == "None") &&
+          ((order == 0) || (gravityModel->GetMM() == 0));
+}
+
+//------------------------------------------------------------------------------
+// void FillTimeJacobian(const Real *pos, const Real *acc,
+//       const Rmatrix33 &grad)
+//------------------------------------------------------------------------------
+/**
+ * Builds the time Jacobian of the field from the rotation of the body.
+ *
+ * With R the rotation from the input frame to the body fixed frame, the
+ * acceleration at a fixed input position r is a = R^T g(R r), so
+ *
+ *    da/dt = Rdot^T R a + G R^T Rdot r
+ *
+ * where G = R^T (dg/dr) R is the gradient in the input frame.  The rotation
+ * data are the matrices set by the last call to RotateToFixed().
+ *
+ * @param pos  Position of the spacecraft in the input frame
+ * @param acc  Field acceleration at pos, in the input frame
+ * @param grad Field gradient at pos, in the input frame
+ */
+//------------------------------------------------------------------------------
+void GravityField::FillTimeJacobian(const Real *pos, const Real *acc,
+      const Rmatrix33 &grad)
+{
+   Real fixedAcc[3], fixedRate[3], inputRate[3];
+   for (Integer i = 0; i < 3; ++i)
+   {
+      fixedAcc[i]  = rotMatrix(i,0) * acc[0] + rotMatrix(i,1) * acc[1] +
+                     rotMatrix(i,2) * acc[2];
+      fixedRate[i] = rotDotMatrix(i,0) * pos[0] + rotDotMatrix(i,1) * pos[1] +
+                     rotDotMatrix(i,2) * pos[2];
+   }
+   for (Integer i = 0; i < 3; ++i)
+      inputRate[i] = rotMatrix(0,i) * fixedRate[0] +
+                     rotMatrix(1,i) * fixedRate[1] +
+                     rotMatrix(2,i) * fixedRate[2];
+
+   for (Integer i = 0; i < stmRowCount; ++i)
+      timeJacobian[i] = 0.0;
+   for (Integer i = 0; i < 3; ++i)
+      timeJacobian[i+3] = rotDotMatrix(0,i) * fixedAcc[0] +
+                          rotDotMatrix(1,i) * fixedAcc[1] +
+                          rotDotMatrix(2,i) * fixedAcc[2] +
+                          grad(i,0) * inputRate[0] +
+                          grad(i,1) * inputRate[1] +
+                          grad(i,2) * inputRate[2];
+}
+
+//------------------------------------------------------------------------------
+// void GetFieldEpochData(Real dt, Integer& tideLevel, Real sunpos[3],
+//       Real& sunmukm, Real otherpos[3], Real& othermukm, Real& xp, Real& yp)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the epoch dependent inputs to the harmonic field computation.
+ *
+ * @param dt        Time offset from the current epoch
+ * @param tideLevel The tide level to apply
+ * @param sunpos    Body fixed Sun position, when tides are on
+ * @param sunmukm   Sun gravitational parameter, when tides are on
+ * @param otherpos  Body fixed position of the other tide raising body
+ * @param othermukm Gravitational parameter of the other tide raising body
+ * @param xp        Polar motion x component
+ * @param yp        Polar motion y component
+ */
+//------------------------------------------------------------------------------
+void GravityField::GetFieldEpochData(Real dt, Integer& tideLevel,
+      Real sunpos[3], Real& sunmukm, Real otherpos[3], Real& othermukm,
+      Real& xp, Real& yp)
+{
+   Real     now;
+   GmatTime nowGT;
+   if (hasPrecisionTime)
+   {
+      nowGT = epochGT; nowGT.AddSeconds(elapsedTime); nowGT.AddSeconds(dt);
+   }
+   else
+      now = epoch + (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
+
+   tideLevel = -1;
    if (gravityModel != NULL)
       {
       for (int i=0;  i<=HarmonicGravity::ETideCount-1;  ++i)
@@ -1496,58 +2018,126 @@ void GravityField::Calculate (Real dt, Real state[6],
          }
       }
    // Get xp and yp from the EOP file
-   Real xp, yp, lod;
+   Real lod;
    Real utcmjd;
    GmatTime utcmjdGT;
    if (hasPrecisionTime)
    {
       utcmjdGT = theTimeConverter->Convert(nowGT, TimeSystemConverter::A1MJD, TimeSystemConverter::UTCMJD,
          GmatTimeConstants::JD_JAN_5_1941);
-      eop->GetPolarMotionAndLod(utcmjdGT, xp, yp, lod);
+      eop->GetPolarMotionAndLod(utcmjdGT, xp, yp, lod, eopIndexHint);
    }
    else
    {
       utcmjd = theTimeConverter->Convert(now, TimeSystemConverter::A1MJD, TimeSystemConverter::UTCMJD,
          GmatTimeConstants::JD_JAN_5_1941);
-      eop->GetPolarMotionAndLod(utcmjd, xp, yp, lod);
+      eop->GetPolarMotionAndLod(utcmjd, xp, yp, lod, eopIndexHint);
    }
+}
 
-   bool computeMatrix = fillAMatrix || fillSTM;
 
+//------------------------------------------------------------------------------
+// void CalculateBatch(Real dt, const Real *state, Integer count, Real *force)
+//------------------------------------------------------------------------------
+/**
+ * Acceleration only evaluation for a set of spacecraft at a common epoch.
+ *
+ * The body fixed rotation, tide data and polar motion are computed once, and
+ * the harmonic sums for all of the spacecraft are evaluated together by
+ * HarmonicGravity::CalculateFullFieldBatch.  When DifferentialGravityRadius
+ * is set, spacecraft within that distance of the first one use the field and
+ * gradient at the first spacecraft instead
+ * (HarmonicGravity::CalculateFullFieldDifferential).  ThreadCount threads
+ * share the blocks of a large batch, such as a Monte Carlo ensemble
+ * propagated in one state vector.
+ *
+ * @param dt    Time offset from the current epoch
+ * @param state Cartesian states, 6 elements per spacecraft
+ * @param count Number of spacecraft in state
+ * @param force Accelerations in the input frame, 3 elements per spacecraft
+ */
+//------------------------------------------------------------------------------
+void GravityField::CalculateBatch(Real dt, const Real *state, Integer count,
+      Real *force)
+{
+   Real jday;
    if (hasPrecisionTime)
-      gravityModel->CalculateFullField(jdayGT.GetMjd(), tmpState, degree, order, tideLevel,
-         sunpos, sunmukm, otherpos, othermukm,
-         xp, yp, computeMatrix, stmLimit, rotacc, rotgrad);
+   {
+      GmatTime jdayGT = epochGT + GmatTimeConstants::JD_JAN_5_1941;
+      jdayGT.AddSeconds(elapsedTime);
+      jdayGT.AddSeconds(dt);
+      jday = jdayGT.GetMjd();
+   }
    else
-      gravityModel->CalculateFullField (jday, tmpState, degree, order, tideLevel, 
-         sunpos, sunmukm, otherpos, othermukm,
-         xp, yp, computeMatrix, stmLimit, rotacc, rotgrad);
+      jday = epoch + GmatTimeConstants::JD_JAN_5_1941 +
+         (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
 
-   #ifdef DEBUG_DERIVATIVES
-      MessageInterface::ShowMessage("after CalculateFullField, rotgrad = %s\n", rotgrad.ToString().c_str());
-   #endif
-   /*
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate pos= %20.14f %20.14f %20.14f\n",
-    tmpState[0],tmpState[1],tmpState[2]);
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
-    rotgrad(0,0),rotgrad(0,1),rotgrad(0,2));
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
-    rotgrad(1,0),rotgrad(1,1),rotgrad(1,2));
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
-    rotgrad(2,0),rotgrad(2,1),rotgrad(2,2));
-    */
-   
-   // Convert back to target CS
-   InverseRotate (rotMatrix,rotacc,acc);
-   grad = rotMatrix.Transpose() * rotgrad * rotMatrix;
-   #ifdef DEBUG_DERIVATIVES
-      MessageInterface::ShowMessage("at end of Calculate, after rotation, grad = %s\n", grad.ToString().c_str());
-   #endif
+   // Only the first state is converted; the transformation is affine in
+   // position, so the others follow from the rotation matrix
+   Real tmpState[3];
+   RotateToFixed(dt, state, tmpState);
+   const Real *rm = rotMatrix.GetDataVector();
+
+   batchPos.resize(6 * count);
+   Real *px = &batchPos[0];
+   Real *py = px + count;
+   Real *pz = py + count;
+   Real *ax = pz + count;
+   Real *ay = ax + count;
+   Real *az = ay + count;
+   for (Integer k = 0; k < count; ++k)
+   {
+      const Real *sat = state + k * stateSize;
+      Real d0 = sat[0] - state[0];
+      Real d1 = sat[1] - state[1];
+      Real d2 = sat[2] - state[2];
+      px[k] = tmpState[0] + rm[0]*d0 + rm[1]*d1 + rm[2]*d2;
+      py[k] = tmpState[1] + rm[3]*d0 + rm[4]*d1 + rm[5]*d2;
+      pz[k] = tmpState[2] + rm[6]*d0 + rm[7]*d1 + rm[8]*d2;
+   }
+
+   if (UseZonalField())
+   {
+      const Real pole[3] = {0.0, 0.0, 1.0};
+      for (Integer k = 0; k < count; ++k)
+      {
+         Real pos[3] = {px[k], py[k], pz[k]};
+         Real rotacc[3];
+         gravityModel->CalculateFullZonalField(jday, pos, pole, degree, false,
+               0, rotacc, rotGradient, gravityWorkspace);
+         InverseRotate(rotMatrix, rotacc, force + 3 * k);
+      }
+      return;
+   }
+
+   Real sunpos[3]   = {0.0,0.0,0.0};
+   Real otherpos[3] = {0.0,0.0,0.0};
+   Real sunmukm     = 0.0;
+   Real othermukm   = 0.0;
+   Integer tideLevel;
+   Real    xp, yp;
+   GetFieldEpochData(dt, tideLevel, sunpos, sunmukm, otherpos, othermukm,
+         xp, yp);
+
+   gravityWorkspace.BatchThreads = threadCount;
+   gravityWorkspace.UsePackedKernel = usePackedKernel;
+   if (differentialRadius > 0.0)
+      gravityModel->CalculateFullFieldDifferential(jday, count, px, py, pz,
+            degree, order, tideLevel, sunpos, sunmukm, otherpos, othermukm,
+            xp, yp, differentialRadius, ax, ay, az, gravityWorkspace);
+   else
+      gravityModel->CalculateFullFieldBatch(jday, count, px, py, pz, degree,
+            order, tideLevel, sunpos, sunmukm, otherpos, othermukm, xp, yp,
+            ax, ay, az, gravityWorkspace);
+
+   // Convert back to the input CS
+   for (Integer k = 0; k < count; ++k)
+   {
+      Real rotacc[3] = {ax[k], ay[k], az[k]};
+      InverseRotate(rotMatrix, rotacc, force + 3 * k);
+   }
 }
+
 //------------------------------------------------------------------------------
 // GmatGrav::GravityModelType GetModelType(const char *filename, const char *forBody)
 //------------------------------------------------------------------------------
@@ -1675,9 +2265,11 @@ GravityField::GravityModelType GravityField::GetModelType
 HarmonicGravity* GravityField::GetHarmonicGravity 
   (const std::string& filename, const std::string& tideFilename,
    const Real &radius, const Real &mukm, const std::string& bodyname,
-   const bool& loadCoefficients)
+   const bool& loadCoefficients, const Integer& maxDegree,
+   const Integer& maxOrder)
    {
-   HarmonicGravity* hg = new HarmonicGravity (filename,tideFilename,radius,mukm,bodyname,loadCoefficients);
+   HarmonicGravity* hg = new HarmonicGravity (filename,tideFilename,radius,
+      mukm,bodyname,loadCoefficients,maxDegree,maxOrder);
    if (hg->GetNN() == 0) return NULL;
    return hg;
    }
@@ -103,6 +103,7 @@ public:
    GravityField&   operator=(const GravityField & gf);
 
    virtual bool    Initialize();
+   virtual void    SetDerivativeContext(DerivativeContext *context);
    
    virtual bool    GetDerivatives(Real *state, Real dt = 0.0, 
                                   Integer order = 1, 
@@ -129,6 +130,18 @@ public:
    virtual Real        GetRealParameter(const std::string &label) const;
    virtual Real        SetRealParameter(const std::string &label,
                                         const Real value);
+   virtual Integer     GetIntegerParameter(const Integer id) const;
+   virtual Integer     SetIntegerParameter(const Integer id,
+                                           const Integer value);
+   virtual Integer     GetIntegerParameter(const std::string &label) const;
+   virtual Integer     SetIntegerParameter(const std::string &label,
+                                           const Integer value);
+   virtual bool        GetBooleanParameter(const Integer id) const;
+   virtual bool        SetBooleanParameter(const Integer id,
+                                           const bool value);
+   virtual bool        GetBooleanParameter(const std::string &label) const;
+   virtual bool        SetBooleanParameter(const std::string &label,
+                                           const bool value);
    virtual std::string GetStringParameter(const Integer id) const;
    virtual bool        SetStringParameter(const Integer id,
                                           const std::string &value);
@@ -149,7 +162,8 @@ public:
    static HarmonicGravity* GetHarmonicGravity 
      (const std::string& filename, const std::string& tideFilename,
       const Real &radius, const Real &mukm, const std::string& bodyname,
-      const bool& loadCoefficients);
+      const bool& loadCoefficients, const Integer& maxDegree = -1,
+      const Integer& maxOrder = -1);
 
    // constants defining maximum degree and order
    static const Integer DEFAULT_DEGREE = 360;
@@ -190,6 +204,10 @@ protected:
       TIDE_FILENAME,
       TIDE_FILE_FULLPATH,
       TIDE_MODEL,
+      DIFFERENTIAL_RADIUS,
+      THREAD_COUNT,
+      USE_PACKED_KERNEL,
+      USE_ZONAL_KERNEL,
       GravityFieldParamCount
    };
 
@@ -211,6 +229,14 @@ protected:
    std::string        tideFilenameFullPath;
    /// string for tide model
    std::string        TideModel;
+   /// Cluster radius (km) for differential batch evaluation; 0 turns it off
+   Real               differentialRadius;
+   /// Threads sharing the batch evaluation; 0 uses one per hardware thread
+   Integer            threadCount;
+   /// Use the packed Legendre row kernel for acceleration only evaluations
+   bool               usePackedKernel;
+   /// Use the closed form zonal kernel for fields without tesseral terms
+   bool               useZonalKernel;
    /// default mu
    Real               defaultMu;
    /// default equatorial radius
@@ -227,6 +253,26 @@ protected:
    bool               offsetBodyOrigin;
 
    HarmonicGravity    *gravityModel;    // JPD
+   /// Scratch data for gravityModel evaluations made by this force
+   HarmonicWorkspace  gravityWorkspace;
+   /// Structure-of-arrays buffers for the batched (multi-spacecraft) path
+   std::vector<Real>  batchPos;
+   std::vector<Real>  batchAcc;
+   /// Derivative context slot for the rotation from the input frame to the
+   /// body fixed frame; -1 when the coordinate converter is used
+   Integer            rotationSlot;
+   /// Rotation from the input frame to the body fixed frame
+   Rmatrix33          rotMatrix;
+   /// Time derivative of rotMatrix, set when the time Jacobian is filled
+   Rmatrix33          rotDotMatrix;
+   /// Body fixed gradient from the harmonic field
+   Rmatrix33          rotGradient;
+   /// Gradient at the force origin, for fields about other bodies
+   Rmatrix33          originGradient;
+   /// Gradient at the spacecraft
+   Rmatrix33          fieldGradient;
+   /// Work space for the A-tilde matrices
+   RealArray          aTildeBuffer;
    
 
    bool          IsBlank(char* aLine);  // leaving this one in for now
@@ -248,7 +294,16 @@ protected:
       Real pos[3], Real& mukm);
    void Calculate (Real dt, Real state[6],
       Real force[3], Rmatrix33& grad);
+   void CalculateBatch (Real dt, const Real *state, Integer count,
+      Real *force);
+   void GetFieldEpochData (Real dt, Integer& tideLevel, Real sunpos[3],
+      Real& sunmukm, Real otherpos[3], Real& othermukm, Real& xp, Real& yp);
    void InverseRotate(Rmatrix33& rot, const Real in[3], Real out[3]);
+   void RotateToFixed(Real dt, const Real *state, Real *fixedState);
+   void CheckTimeJacobian();
+   bool UseZonalField() const;
+   void FillTimeJacobian(const Real *pos, const Real *acc,
+      const Rmatrix33 &grad);
    
 };
 
@@ -153,7 +153,8 @@ potPath                 (""),
 inputCS                 (NULL),
 fixedCS                 (NULL),
 targetCS                (NULL),
-eop                     (NULL)
+eop                     (NULL),
+eopIndexHint            (0)
 {
    objectTypeNames.push_back("HarmonicField");
    parameterCount = HarmonicFieldParamCount;
@@ -209,7 +210,8 @@ potPath                 (hf.potPath),
 inputCS                 (NULL),
 fixedCS                 (NULL),
 targetCS                (NULL),
-eop                     (hf.eop)
+eop                     (hf.eop),
+eopIndexHint            (hf.eopIndexHint)
 {
    #ifdef DEBUG_EOP_FILE
    MessageInterface::ShowMessage
@@ -252,6 +254,7 @@ HarmonicField& HarmonicField::operator=(const HarmonicField& hf)
    fixedCS        = hf.fixedCS;
    targetCS       = hf.targetCS;
    eop            = hf.eop;
+   eopIndexHint   = hf.eopIndexHint;
    #ifdef DEBUG_EOP_FILE
    MessageInterface::ShowMessage
       ("HarmonicField() operator=, this=<%p>, eop=<%p>\n", eop, this);
@@ -529,11 +532,12 @@ Integer HarmonicField::GetParameterID(const std::string &str) const
    if (useStr == "Model")
       useStr = "PotentialFile";
  
-   for (Integer i = GravityBaseParamCount; i < HarmonicFieldParamCount; i++)
-   {
-      if (useStr == PARAMETER_TEXT[i - GravityBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GravityBaseParamCount,
+               HarmonicFieldParamCount);
+   Integer parameterId = parameterIndex.Find(useStr);
+   if (parameterId != -1)
+      return parameterId;
    return GravityBase::GetParameterID(str);
 }
 
@@ -196,6 +196,8 @@ protected:
    CoordinateSystem        *fixedCS;
    CoordinateSystem        *targetCS;
    EopFile                 *eop;
+   /// This force's table index hint for EOP lookups
+   Integer                 eopIndexHint;
    
 };
 
@@ -62,6 +62,7 @@
 
 #include "ODEModel.hpp"
 #include "MessageInterface.hpp"
+#include "Profiler.hpp"
 #include "PropagationStateManager.hpp"
 #include "TextParser.hpp"
 #include "TimeTypes.hpp"
@@ -107,11 +108,13 @@
 //#define DEBUG_FORMATION_PROPERTIES
 //#define DEBUG_NAN_CONDITIONS
 //#define DEBUG_AMATRIX
+//#define DEBUG_STM_SPARSITY
 //#define DEBUG_RANGECHECK_TOGGLES
 //#define DEBUG_TIME_ADDITION
 //#define DEBUG_MASS_JACOBIAN
 //#define DEBUG_TIME_JACOBIAN
 //#define DEBUG_FORCE_IDS
+//#define DEBUG_ENCKE
 
 
  
@@ -144,6 +147,10 @@ std::ofstream debugFile;
 static bool firstCallFired = false;
 #endif
 
+/// Difference, in seconds, within which an epoch is taken as the model epoch
+/// when the Encke formulation decides to rectify
+static const Real ENCKE_EPOCH_TOLERANCE = 1.0e-6;
+
 
 const std::string
 ODEModel::PARAMETER_TEXT[ODEModelParamCount - PhysicalModelParamCount] =
@@ -169,7 +176,10 @@ ODEModel::PARAMETER_TEXT[ODEModelParamCount - PhysicalModelParamCount] =
    "BodyDensity",
 
    "UserDefined",
-   "External"
+   "External",
+
+   "Formulation",
+   "RectificationTolerance"
 };
 
 
@@ -201,6 +211,8 @@ ODEModel::PARAMETER_TYPE[ODEModelParamCount - PhysicalModelParamCount] =
    Gmat::OBJECTARRAY_TYPE,  // "UserDefined",
    Gmat::STRING_TYPE,     // "External",
 
+   Gmat::ENUMERATION_TYPE,  // "Formulation",
+   Gmat::REAL_TYPE,         // "RectificationTolerance",
 };
 
 
@@ -302,7 +314,13 @@ ODEModel::ODEModel(const std::string &modelName, const std::string typeName) :
    j2kBody           (NULL),
    transientCount    (0),
    finiteDifferencingTimeJac (false),
-   nonAnalyticTimeDerivs (NULL)
+   nonAnalyticTimeDerivs (NULL),
+   j2kSlot           (-1),
+   originSlot        (-1),
+   derivativeAllocations (-1),
+   formulation       ("Cowell"),
+   useEncke          (false),
+   rectificationTolerance (0.01)
 {
    #ifdef DEBUG_ODEMODEL
       MessageInterface::ShowMessage("ODEModel default construction <'%s',%p>\n",
@@ -409,7 +427,14 @@ ODEModel::ODEModel(const ODEModel& fdf) :
    j2kBody                    (fdf.j2kBody),
    transientCount             (fdf.transientCount),
    finiteDifferencingTimeJac  (fdf.finiteDifferencingTimeJac),
-   nonAnalyticTimeDerivs      (NULL)
+   nonAnalyticTimeDerivs      (NULL),
+   j2kSlot                    (-1),
+   originSlot                 (-1),
+   derivativeAllocations      (-1),
+   formulation                (fdf.formulation),
+   useEncke                   (fdf.useEncke),
+   rectificationTolerance     (fdf.rectificationTolerance),
+   enckeReference             (fdf.enckeReference)
 {
    #ifdef DEBUG_ODEMODEL
    MessageInterface::ShowMessage("ODEModel copy constructor (from <'%s',%p> to <'%s',%p>) entered\n", fdf.GetName().c_str(), &fdf, GetName().c_str(), &(*this));
@@ -546,6 +571,19 @@ ODEModel& ODEModel::operator=(const ODEModel& fdf)
    transientCount      = fdf.transientCount;
 
    finiteDifferencingTimeJac = fdf.finiteDifferencingTimeJac;
+   // The epoch data is registered again when this model is initialized
+   epochContext.Clear();
+   initialDerivs.clear();
+   j2kSlot = originSlot = -1;
+
+   formulation = fdf.formulation;
+   useEncke = fdf.useEncke;
+   rectificationTolerance = fdf.rectificationTolerance;
+   // The reference conics are rebuilt when this model is initialized
+   enckeReference = fdf.enckeReference;
+   enckeState.clear();
+   enckeScale.clear();
+   derivativeAllocations = -1;
 
    // Clear owned objects before clone
    ClearForceList();
@@ -1202,6 +1240,16 @@ void ODEModel::UpdateSpaceObject(Real newEpoch)
    Integer vectorSize;
    GmatState *state;
    ReturnFromOrigin(newEpoch);
+
+   // New reference conics are only started at the model epoch, where the
+   // integrator continues from
+   if (useEncke)
+   {
+      Real modelEpoch = epoch + elapsedTime / GmatTimeConstants::SECS_PER_DAY;
+      if ((newEpoch < 0.0) || (fabs(newEpoch - modelEpoch) *
+            GmatTimeConstants::SECS_PER_DAY < ENCKE_EPOCH_TOLERANCE))
+         RectifyDeviations(epoch, elapsedTime);
+   }
    
    state = psm->GetState();
    stateSize = state->GetSize();
@@ -1268,6 +1316,17 @@ void ODEModel::UpdateSpaceObjectGT(GmatTime newEpoch)
 
    ReturnFromOriginGT(newEpoch);
 
+   // New reference conics are only started at the model epoch, where the
+   // integrator continues from
+   if (useEncke)
+   {
+      GmatTime modelEpoch = epochGT;
+      modelEpoch.AddSeconds(elapsedTime);
+      if ((newEpoch < 0.0) || (fabs((newEpoch - modelEpoch).GetTimeInSec()) <
+            ENCKE_EPOCH_TOLERANCE))
+         RectifyDeviations(epoch, elapsedTime);
+   }
+
    state = psm->GetState();
    stateSize = state->GetSize();
    vectorSize = stateSize * sizeof(Real);
@@ -1932,6 +1991,21 @@ bool ODEModel::Initialize()
       }
       coverageStartDetermined = true;
    }
+
+   // The Encke formulation integrates the deviations from conics about the
+   // origin; the conics are started when the state is moved to the origin
+   if (useEncke)
+   {
+      Real gm = forceOrigin->GetGravitationalConstant();
+      if (gm <= 0.0)
+         throw ODEModelException("The Encke formulation on " + instanceName +
+               " needs a force model origin with a gravitational constant, "
+               "but " + forceOrigin->GetName() + " has none");
+      enckeReference.SetMu(gm);
+      enckeReference.SetSize(cartesianCount);
+      enckeState.assign(dimension, 0.0);
+      enckeScale.assign(cartStateSize, 0.0);
+   }
       
    if (hasPrecisionTime)
       MoveToOriginGT();
@@ -2087,6 +2161,21 @@ bool ODEModel::Initialize()
             " is empty, so it cannot be used for propagation.");
 
    nomDerivs.resize(dimension);
+   nomTimeDerivs.resize(dimension);
+   BuildInitialDerivatives();
+
+   // Register the epoch data shared by the forces during evaluation
+   epochContext.Clear();
+   for (std::vector<PhysicalModel *>::iterator current = forceList.begin();
+        current != forceList.end(); ++current)
+      (*current)->SetDerivativeContext(&epochContext);
+
+   j2kSlot = originSlot = -1;
+   if ((j2kBody != NULL) && (forceOrigin != NULL) && (j2kBody != forceOrigin))
+   {
+      j2kSlot = epochContext.AddBody(j2kBody);
+      originSlot = epochContext.AddBody(forceOrigin);
+   }
 
    if (nonAnalyticTimeDerivs)
    {
@@ -2100,6 +2189,11 @@ bool ODEModel::Initialize()
    if (!nonAnalyticTimeDerivs)
       return false;
 
+   #ifdef DEBUG_TIME_JACOBIAN
+      MessageInterface::ShowMessage("Time Jacobian sources for %s:\n%s",
+            instanceName.c_str(), GetTimeJacobianReport().c_str());
+   #endif
+
    isInitialized = true;
 
    #ifdef DEBUG_MU_MAP
@@ -2184,10 +2278,15 @@ void ODEModel::ClearForceList(bool deleteTransient)
                    "\" PhysicalModel", this);
             #endif
             delete pm;
+            pm = NULL;
          }
       }
+      // Forces that outlive the list must not keep this model's context
+      if (pm != NULL)
+         pm->SetDerivativeContext(NULL);
       ppm = forceList.begin();
    }
+   epochContext.Clear();
    
    #ifdef DEBUG_ODEMODEL_CLEAR
       MessageInterface::ShowMessage("ODEModel::ClearForceList() exit\n");
@@ -3147,6 +3246,10 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
       }
    #endif
 
+   #ifdef DEBUG_ARRAY_ALLOCATIONS
+      Integer allocationsAtStart = GmatArrayAllocation::GetCount();
+   #endif
+
    // Temporary code: prevent multiple spacecraft in finite burn PropSetup
    stateObjects.clear();
 
@@ -3176,6 +3279,17 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
 	   throw ODEModelException("Second order integrators cannot be used when "
 			   "propagating the Orbit State Transition Matrix (STM); please "
 			   "use a different integrator.");
+
+   // In the Encke formulation the state holds the deviations from the
+   // reference conics; the forces are evaluated on the full state
+   if (useEncke)
+   {
+      memcpy(&enckeState[0], state, dimension * sizeof(Real));
+      AddReferenceStates(&enckeState[0], NULL, epoch, elapsedTime + dt);
+      state = &enckeState[0];
+      for (Integer i = 0; i < cartStateSize; ++i)
+         enckeScale[i] = state[cartesianStart + i];
+   }
 	
    if (dynamicProperties)
    {
@@ -3264,10 +3378,18 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
       MessageInterface::ShowMessage("\nODE epoch, elapsed, dt: %.12lf, %lf, %lf ", epoch, elapsedTime, dt);
    #endif
    
+   // Set when a force without an analytic time Jacobian is evaluated
+   bool differenceTime = false;
+
    // Apply superposition of forces/derivatives
    for (std::vector<PhysicalModel *>::iterator i = forceList.begin();
          i != forceList.end(); ++i)
    {
+      // The differenced evaluation only needs the forces that lack the
+      // analytic terms; the nominal derivatives are restored afterwards
+      if (finiteDifferencingTimeJac && (*i)->HasTimeJacobian())
+         continue;
+
       #ifdef DEBUG_ODEMODEL_EXE
          MessageInterface::ShowMessage("   %s\n", ((*i)->GetTypeName()).c_str());
          MessageInterface::ShowMessage("   dt = %le  order = %d\n", dt, order);
@@ -3286,7 +3408,12 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
       // ODE::GetDerivative(state, dt = 0.0) with dt = 0.0.
 
       //ddt = (*i)->GetDerivativeArray();
-      if (!(*i)->GetDerivatives(state, dt, order))
+      bool evaluated;
+      {
+         ProfileScope profile("Force", *i);
+         evaluated = (*i)->GetDerivatives(state, dt, order);
+      }
+      if (!evaluated)
       {
          #ifdef DEBUG_ODEMODEL_EXE
             MessageInterface::ShowMessage("Derivative %s failed\n",
@@ -3354,6 +3481,7 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
          {
             for (Integer j = 0; j < dimension; ++j)
                nonAnalyticTimeDerivs[j] += ddt[j];
+            differenceTime = true;
          }
       }
 
@@ -3399,8 +3527,8 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
    if (psm->RequiresCompletion())
       CompleteDerivativeCalculations(state);
 
-   // Calculate time Jacobian
-   if (fillTimeJacobian && !finiteDifferencingTimeJac)
+   // Difference the time Jacobian terms that are not built analytically
+   if (fillTimeJacobian && !finiteDifferencingTimeJac && differenceTime)
       FiniteDiffTimeJacobian(state, dt, order);
 
    #ifdef DEBUG_TIME_JACOBIAN
@@ -3517,29 +3645,52 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
    if ((fillCartesian) && (j2kBody != forceOrigin))
    {
       // Calculate state change and acceleration change when change coordinate system from force central body to j2k internal coordinate system
-      Real now;
-      GmatTime nowGT;
-      Rvector6 cbState, j2kState, delta;
-      Rvector3 cbAcceleration, j2kAcceleration, deltaAcceleration;
+      // The body data is read in place, so no vectors are built here
+      const Real *cbState, *j2kState;
+      Real delta[6], deltaAcceleration[3];
       if (hasPrecisionTime)
       {
-         nowGT = epochGT;
+         GmatTime nowGT = epochGT;
          nowGT.AddSeconds(dt);
-         cbState = forceOrigin->GetState(nowGT);
-         j2kState = j2kBody->GetState(nowGT);
-         cbAcceleration = forceOrigin->GetAcceleration(nowGT);
-         j2kAcceleration = j2kBody->GetAcceleration(nowGT);
+         if (j2kSlot >= 0)
+         {
+            cbState = epochContext.GetBodyState(originSlot, nowGT);
+            j2kState = epochContext.GetBodyState(j2kSlot, nowGT);
+         }
+         else
+         {
+            cbState = forceOrigin->GetState(nowGT).GetDataVector();
+            j2kState = j2kBody->GetState(nowGT).GetDataVector();
+         }
+         const Real *cbAcceleration =
+               forceOrigin->GetAcceleration(nowGT).GetDataVector();
+         const Real *j2kAcceleration =
+               j2kBody->GetAcceleration(nowGT).GetDataVector();
+         for (Integer i = 0; i < 3; ++i)
+            deltaAcceleration[i] = j2kAcceleration[i] - cbAcceleration[i];
       }
       else
       {
-         now = epoch + dt / GmatTimeConstants::SECS_PER_DAY;
-         cbState = forceOrigin->GetState(now);
-         j2kState = j2kBody->GetState(now);
-         cbAcceleration = forceOrigin->GetAcceleration(now);
-         j2kAcceleration = j2kBody->GetAcceleration(now);
+         Real now = epoch + dt / GmatTimeConstants::SECS_PER_DAY;
+         if (j2kSlot >= 0)
+         {
+            cbState = epochContext.GetBodyState(originSlot, A1Mjd(now));
+            j2kState = epochContext.GetBodyState(j2kSlot, A1Mjd(now));
+         }
+         else
+         {
+            cbState = forceOrigin->GetState(now).GetDataVector();
+            j2kState = j2kBody->GetState(now).GetDataVector();
+         }
+         const Real *cbAcceleration =
+               forceOrigin->GetAcceleration(now).GetDataVector();
+         const Real *j2kAcceleration =
+               j2kBody->GetAcceleration(now).GetDataVector();
+         for (Integer i = 0; i < 3; ++i)
+            deltaAcceleration[i] = j2kAcceleration[i] - cbAcceleration[i];
       }
-      delta = j2kState - cbState;
-      deltaAcceleration = j2kAcceleration - cbAcceleration;
+      for (Integer i = 0; i < 6; ++i)
+         delta[i] = j2kState[i] - cbState[i];
 
       // Convert state derivative from force model coordinate system to j2k body internal coordinate system 
       if (order == 1)  // Fill in 1st dv of position with the input velocity
@@ -3565,10 +3716,95 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
    //for (Integer i = 0; i < dimension; ++i)
    //   MessageInterface::ShowMessage("@@@@   rawDeriv[%d] = %.15le\n", i, rawDeriv[i]);
 
+   // The integrator works with the derivatives of the deviations; the state
+   // derivatives passed to the spacecraft above stay the full ones
+   if (useEncke && fillCartesian)
+   {
+      SubtractReferenceDerivatives(order, epoch, elapsedTime + dt);
+      memcpy(modelStateDot, deriv, dimension * sizeof(Real));
+   }
+
+   #ifdef DEBUG_ARRAY_ALLOCATIONS
+      derivativeAllocations = GmatArrayAllocation::GetCount() -
+            allocationsAtStart;
+   #endif
+
    return true;
 }
 
 
+//------------------------------------------------------------------------------
+// Integer GetDerivativeAllocationCount() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of vector and matrix allocations made by the last
+ * derivative evaluation.
+ *
+ * The count is only kept in builds that define DEBUG_ARRAY_ALLOCATIONS, where
+ * it is used to check that the evaluations do not build Rvector or Rmatrix
+ * temporaries.
+ *
+ * @return The allocation count, or -1 if allocations are not counted
+ */
+//------------------------------------------------------------------------------
+Integer ODEModel::GetDerivativeAllocationCount() const
+{
+   return derivativeAllocations;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetTimeJacobianReport()
+//------------------------------------------------------------------------------
+/**
+ * Lists how each force contributes to the time Jacobian.
+ *
+ * Forces with analytic time Jacobians supply their terms directly; the others
+ * are evaluated again at a perturbed epoch and differenced.
+ *
+ * @return One line per force, giving the force and the method used
+ */
+//------------------------------------------------------------------------------
+std::string ODEModel::GetTimeJacobianReport()
+{
+   std::stringstream report;
+   for (std::vector<PhysicalModel *>::iterator i = forceList.begin();
+         i != forceList.end(); ++i)
+   {
+      report << "   " << (*i)->GetTypeName();
+      if ((*i)->GetName() != "")
+         report << " " << (*i)->GetName();
+      report << ": " << ((*i)->HasTimeJacobian() ? "analytic" :
+            "finite difference") << "\n";
+   }
+   return report.str();
+}
+
+
+//------------------------------------------------------------------------------
+// void BuildInitialDerivatives()
+//------------------------------------------------------------------------------
+/**
+ * Builds the values that the derivative array starts from on each evaluation
+ *
+ * Most elements start at zero; elements flagged in the state map, like the
+ * derivative of time, start at their initial value.  The values are taken
+ * from the state map once, so the derivative evaluations only copy them.
+ */
+//------------------------------------------------------------------------------
+void ODEModel::BuildInitialDerivatives()
+{
+   initialDerivs.assign(dimension, 0.0);
+   if (psm == NULL)
+      return;
+
+   const std::vector<ListItem*> *smap = psm->GetStateMap();
+   for (Integer i = 0; (i < dimension) && (i < (Integer)smap->size()); ++i)
+      if ((*smap)[i]->nonzeroInit)
+         initialDerivs[i] = (*smap)[i]->initialValue;
+}
+
+
 //------------------------------------------------------------------------------
 // bool PrepareDerivativeArray()
 //------------------------------------------------------------------------------
@@ -3587,27 +3823,25 @@ bool ODEModel::PrepareDerivativeArray()
       MessageInterface::ShowMessage("Derivative initializes non-zero:\n");
    #endif
 
-   const std::vector<ListItem*> *smap = psm->GetStateMap();
+   // Initialize the derivative array from the values built at initialization
+   if ((Integer)initialDerivs.size() != dimension)
+      BuildInitialDerivatives();
 
-   // Initialize the derivative array
-   for (Integer i = 0; i < dimension; ++i)
-   {
-      #ifdef DEBUG_STM_AMATRIX_DERIVS
-         if (eins == false)
+   #ifdef DEBUG_STM_AMATRIX_DERIVS
+      if (eins == false)
+      {
+         const std::vector<ListItem*> *smap = psm->GetStateMap();
+         for (Integer i = 0; i < dimension; ++i)
             MessageInterface::ShowMessage("   Mapping [%d] %s\n", i,
                   ((*smap)[i]->nonzeroInit == true ? "true" : "false"));
-      #endif
-
-      if ((*smap)[i]->nonzeroInit)
-      {
-         deriv[i] = (*smap)[i]->initialValue;
-         nonAnalyticTimeDerivs[i] = (*smap)[i]->initialValue;
-      }
-      else
-      {
-         deriv[i] = 0.0;
-         nonAnalyticTimeDerivs[i] = 0.0;
       }
+   #endif
+
+   if (dimension > 0)
+   {
+      memcpy(deriv, &initialDerivs[0], dimension * sizeof(Real));
+      memcpy(nonAnalyticTimeDerivs, &initialDerivs[0],
+            dimension * sizeof(Real));
    }
 
    if (!finiteDifferencingTimeJac)
@@ -3684,13 +3918,9 @@ bool ODEModel::CompleteDerivativeCalculations(Real *state)
 		// Get Spacecraft object
 		Spacecraft* sc = (Spacecraft*)scObjs[i];
 
-		// Create aTilde matrix
 		Integer stmRows = sc->GetIntegerParameter("FullSTMRowCount");
 		Integer stmSize = stmRows * stmRows;
-      Real *aTilde = new Real[stmSize];
-      
-	   for (Integer m = 0; m < stmSize; ++m)
-         aTilde[m] = deriv[i6+m];
+      const Real *aTilde = &deriv[i6];
 
       #ifdef DEBUG_AMATRIX
 			MessageInterface::ShowMessage("A matrix last column: [");
@@ -3714,21 +3944,57 @@ bool ODEModel::CompleteDerivativeCalculations(Real *state)
       {
          // Convert A to Phi dot for STM pieces
          // \Phi\dot = A\tilde \Phi
+         //
+         // Most of A is zero once parameters are estimated: the rows of
+         // constant parameters are empty, and the position rows only hold the
+         // identity block.  The nonzero elements are collected by row, so the
+         // product only visits them, and empty rows give zero STM rates.
+         aMatrixRowStart.resize(stmRows + 1);
+         if ((Integer)aMatrixValues.size() < stmSize)
+         {
+            aMatrixValues.resize(stmSize);
+            aMatrixColumns.resize(stmSize);
+         }
+
+         Integer nonzeroCount = 0;
          for (Integer j = 0; j < stmRows; ++j)
          {
-            for (Integer k = 0; k < stmRows; ++k)
+            aMatrixRowStart[j] = nonzeroCount;
+            for (Integer l = 0; l < stmRows; ++l)
             {
-               Integer element = j * stmRows + k;
-               deriv[i6+element] = 0.0;
-               for (Integer l = 0; l < stmRows; ++l)
+               if (aTilde[j*stmRows+l] != 0.0)
                {
-                  deriv[i6+element] += aTilde[j*stmRows+l] * state[i6+l*stmRows+k];
+                  aMatrixValues[nonzeroCount] = aTilde[j*stmRows+l];
+                  aMatrixColumns[nonzeroCount] = l;
+                  ++nonzeroCount;
                }
             }
+         }
+         aMatrixRowStart[stmRows] = nonzeroCount;
+
+         #ifdef DEBUG_STM_SPARSITY
+            MessageInterface::ShowMessage("STM %d: %d of %d A-matrix elements "
+                  "are nonzero; %d multiplies instead of %d\n", i,
+                  nonzeroCount, stmSize, nonzeroCount * stmRows,
+                  stmSize * stmRows);
+         #endif
+
+         for (Integer j = 0; j < stmRows; ++j)
+         {
+            Real *phiDotRow = &deriv[i6 + j*stmRows];
+            for (Integer k = 0; k < stmRows; ++k)
+               phiDotRow[k] = 0.0;
+
+            for (Integer m = aMatrixRowStart[j]; m < aMatrixRowStart[j+1]; ++m)
+            {
+               const Real a = aMatrixValues[m];
+               const Real *phiRow = &state[i6 + aMatrixColumns[m]*stmRows];
+               for (Integer k = 0; k < stmRows; ++k)
+                  phiDotRow[k] += a * phiRow[k];
+            }
          }
 		}
 
-      delete [] aTilde;
 		i6 = i6 + stmSize;
    }
    return retval;
@@ -3741,6 +4007,9 @@ bool ODEModel::CompleteDerivativeCalculations(Real *state)
 * Finite differences the time Jacobian for derivatives that do not already have
 * an analytical time Jacobian
 *
+* Only the forces without analytic time Jacobians are evaluated at the
+* perturbed epoch.
+*
 * @param    state   The current state vector
 * @param    dt      The current time interval from epoch
 * @param    order   Order of the derivative to be taken
@@ -3750,8 +4019,6 @@ void ODEModel::FiniteDiffTimeJacobian(Real * state, Real dt, Integer order)
 {
    finiteDifferencingTimeJac = true;
    Real timePert = 1.0;
-   Rvector nomDerivs(dimension);
-   Rvector nomTimeDerivs(dimension);
    for (UnsignedInt j = 0; j < dimension; ++j)
    {
       nomDerivs[j] = deriv[j];
@@ -3858,6 +4125,33 @@ Real ODEModel::EstimateError(Real *diffs, Real *answer) const
    // Handle the Cartesian piece
    for (int i = cartesianStart; i < cartesianStart + cartStateSize; i += 3)
    {
+      // The deviations of the Encke formulation change too little over a
+      // step to scale the error; the full state is used for every norm
+      if (useEncke && (normType != NO_CONTROL))
+      {
+         const Real *full = &enckeScale[i - cartesianStart];
+         if ((normType == L1_MAGNITUDE) || (normType == L1_DIFFERENCES))
+         {
+            mag = fabs(full[0]) + fabs(full[1]) + fabs(full[2]);
+            err = fabs(diffs[i]) + fabs(diffs[i+1]) + fabs(diffs[i+2]);
+            if (mag > relativeErrorThreshold)
+               err = err / mag;
+         }
+         else
+         {
+            mag = full[0]*full[0] + full[1]*full[1] + full[2]*full[2];
+            err = diffs[i]*diffs[i] + diffs[i+1]*diffs[i+1] + diffs[i+2]*diffs[i+2];
+            if (mag > relativeErrorThreshold)
+               err = sqrt(err / mag);
+            else
+               err = sqrt(err);
+         }
+
+         if (err > retval)
+            retval = err;
+         continue;
+      }
+
       switch (normType)
       {
          case -2:
@@ -4827,6 +5121,9 @@ Real ODEModel::GetRealParameter(const Integer id) const
       return pm->GetRealParameter(id);
    }
 
+   if (id == RECTIFICATION_TOLERANCE)
+      return rectificationTolerance;
+
    // Handler for force based solve-for parameters
    if (id >= ODEModelParamCount)
    {
@@ -4879,6 +5176,22 @@ Real ODEModel::SetRealParameter(const Integer id, const Real value)
       return pm->SetRealParameter(id, value);
    }
 
+   if (id == RECTIFICATION_TOLERANCE)
+   {
+      if (value <= 0.0)
+      {
+         char msg[1024];
+         std::stringstream val;
+         val.precision(16);
+         val << value;
+         sprintf(msg, errorMessageFormat.c_str(), val.str().c_str(),
+               "RectificationTolerance", "Real number > 0.0");
+         throw ODEModelException(msg);
+      }
+      rectificationTolerance = value;
+      return rectificationTolerance;
+   }
+
    // Handler for force based solve-for parameters
    if (id >= ODEModelParamCount)
    {
@@ -5236,6 +5549,9 @@ std::string ODEModel::GetStringParameter(const Integer id) const
          }
          break;
 
+      case FORMULATION:
+         return formulation;
+
 //      case POTENTIAL_FILE:
 //         {
 //            // Get actual id
@@ -5342,6 +5658,21 @@ bool ODEModel::SetStringParameter(const Integer id, const std::string &value)
             return true;
          }
          throw ODEModelException("Unrecognized error control method.");
+
+      case FORMULATION:
+         if ((value == "Cowell") || (value == "Encke"))
+         {
+            formulation = value;
+            useEncke = (value == "Encke");
+            return true;
+         }
+         else
+         {
+            char msg[1024];
+            sprintf(msg, errorMessageFormat.c_str(), value.c_str(),
+                  "Formulation", "Cowell or Encke");
+            throw ODEModelException(msg);
+         }
          
 //      case POTENTIAL_FILE:
 //         {
@@ -6044,6 +6375,15 @@ void ODEModel::MoveToOrigin(Real newEpoch)
          #endif
       }
    }
+
+   // Restart the reference conics from the state at the origin
+   if (useEncke)
+   {
+      if (newEpoch < 0.0)
+         StartDeviations(epoch, elapsedTime);
+      else
+         StartDeviations(newEpoch, 0.0);
+   }
    
    #ifdef DEBUG_REORIGIN
       MessageInterface::ShowMessage(
@@ -6150,6 +6490,15 @@ void ODEModel::MoveToOriginGT(GmatTime newEpoch)
       }
    }
 
+   // Restart the reference conics from the state at the origin
+   if (useEncke)
+   {
+      if (newEpoch < 0.0)
+         StartDeviations(epoch, elapsedTime);
+      else
+         StartDeviations(newEpoch.GetMjd(), 0.0);
+   }
+
 #ifdef DEBUG_REORIGIN
    MessageInterface::ShowMessage(
       "   Move Complete\n   Input state: [ ");
@@ -6182,6 +6531,15 @@ void ODEModel::ReturnFromOrigin(Real newEpoch)
    memcpy(rawState, modelState, dimension*sizeof(Real));
    memcpy(rawStateDot, modelStateDot, dimension * sizeof(Real));
 
+   // Add the reference conics to the deviations
+   if (useEncke)
+   {
+      if (newEpoch < 0.0)
+         AddReferenceStates(rawState, rawStateDot, epoch, elapsedTime);
+      else
+         AddReferenceStates(rawState, rawStateDot, newEpoch, 0.0);
+   }
+
    if (centralBodyName != j2kBodyName)
    {
       Rvector6 cbState, j2kState, delta;
@@ -6202,7 +6560,7 @@ void ODEModel::ReturnFromOrigin(Real newEpoch)
          // Calculate value of rawState
          for (Integer j = 0; j < 6; ++j)
          {
-            rawState[i6 + j] = modelState[i6 + j] - delta[j];
+            rawState[i6 + j] -= delta[j];
          }
 
          // Calculate value of rawStateDot
@@ -6211,12 +6569,12 @@ void ODEModel::ReturnFromOrigin(Real newEpoch)
             if (j < 3)
             {
                // Calculate rDot (velocity)
-               rawStateDot[i6 + j] = modelStateDot[i6 + j] - delta[j + 3];
+               rawStateDot[i6 + j] -= delta[j + 3];
             }
             else
             {
                // Calculate vDot (acceleration)
-               rawStateDot[i6 + j] = modelStateDot[i6 + j] - deltaAcceleration[j - 3];
+               rawStateDot[i6 + j] -= deltaAcceleration[j - 3];
             }
          }
          #ifdef DEBUG_REORIGIN
@@ -6250,6 +6608,15 @@ void ODEModel::ReturnFromOriginGT(GmatTime newEpoch)
    memcpy(rawState, modelState, dimension*sizeof(Real));
    memcpy(rawStateDot, modelStateDot, dimension * sizeof(Real));
 
+   // Add the reference conics to the deviations
+   if (useEncke)
+   {
+      if (newEpoch < 0.0)
+         AddReferenceStates(rawState, rawStateDot, epoch, elapsedTime);
+      else
+         AddReferenceStates(rawState, rawStateDot, newEpoch.GetMjd(), 0.0);
+   }
+
    if (centralBodyName != j2kBodyName)
    {
       Rvector6 cbState, j2kState, delta;
@@ -6272,7 +6639,7 @@ void ODEModel::ReturnFromOriginGT(GmatTime newEpoch)
          // Calculate value of rawState
          for (Integer j = 0; j < 6; ++j)
          {
-            rawState[i6 + j] = modelState[i6 + j] - delta[j];
+            rawState[i6 + j] -= delta[j];
          }
 
          // Calculate value of rawStateDot
@@ -6281,12 +6648,12 @@ void ODEModel::ReturnFromOriginGT(GmatTime newEpoch)
             if (j < 3)
             {
                // Calculate rDot (velocity)
-               rawStateDot[i6 + j] = modelStateDot[i6 + j] - delta[j + 3];
+               rawStateDot[i6 + j] -= delta[j + 3];
             }
             else
             {
                // Calculate vDot (acceleration)
-               rawStateDot[i6 + j] = modelStateDot[i6 + j] - deltaAcceleration[j - 3];
+               rawStateDot[i6 + j] -= deltaAcceleration[j - 3];
             }
          }
 
@@ -6312,6 +6679,176 @@ void ODEModel::ReturnFromOriginGT(GmatTime newEpoch)
 }
 
 
+//------------------------------------------------------------------------------
+// void StartDeviations(Real atEpoch, Real atOffset)
+//------------------------------------------------------------------------------
+/**
+ * Starts the Encke reference conics from the Cartesian states at the origin
+ *
+ * The model state is replaced by the deviations from the new conics, which
+ * are zero, and the model state derivative by the derivatives of the
+ * deviations.
+ *
+ * @param atEpoch  The epoch of the model state, in days
+ * @param atOffset The offset of the model state from atEpoch, in seconds
+ */
+//------------------------------------------------------------------------------
+void ODEModel::StartDeviations(Real atEpoch, Real atOffset)
+{
+   Real reference[6], acceleration[3];
+
+   for (Integer i = 0; i < cartesianCount; ++i)
+   {
+      Integer i6 = cartesianStart + i * 6;
+      enckeReference.Rectify(i, &modelState[i6], atEpoch, atOffset);
+      enckeReference.GetState(i, atEpoch, atOffset, reference, acceleration);
+
+      for (Integer j = 0; j < 6; ++j)
+         modelState[i6 + j] = 0.0;
+      for (Integer j = 0; j < 3; ++j)
+      {
+         modelStateDot[i6 + j] -= reference[j + 3];
+         modelStateDot[i6 + j + 3] -= acceleration[j];
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void AddReferenceStates(Real *theState, Real *theStateDot, Real atEpoch,
+//       Real atOffset)
+//------------------------------------------------------------------------------
+/**
+ * Adds the Encke reference conics to deviations, giving the full states
+ *
+ * @param theState    The state holding the deviations
+ * @param theStateDot The derivative of theState, or NULL if not needed
+ * @param atEpoch     The epoch of the state, in days
+ * @param atOffset    The offset of the state from atEpoch, in seconds
+ */
+//------------------------------------------------------------------------------
+void ODEModel::AddReferenceStates(Real *theState, Real *theStateDot,
+      Real atEpoch, Real atOffset)
+{
+   Real reference[6], acceleration[3];
+
+   for (Integer i = 0; i < cartesianCount; ++i)
+   {
+      Integer i6 = cartesianStart + i * 6;
+      enckeReference.GetState(i, atEpoch, atOffset, reference,
+            (theStateDot == NULL ? NULL : acceleration));
+
+      for (Integer j = 0; j < 6; ++j)
+         theState[i6 + j] += reference[j];
+
+      if (theStateDot != NULL)
+      {
+         for (Integer j = 0; j < 3; ++j)
+         {
+            theStateDot[i6 + j] += reference[j + 3];
+            theStateDot[i6 + j + 3] += acceleration[j];
+         }
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SubtractReferenceDerivatives(Integer order, Real atEpoch,
+//       Real atOffset)
+//------------------------------------------------------------------------------
+/**
+ * Removes the motion of the Encke reference conics from the derivative array
+ *
+ * @param order    The order of the derivatives
+ * @param atEpoch  The epoch of the derivatives, in days
+ * @param atOffset The offset of the derivatives from atEpoch, in seconds
+ */
+//------------------------------------------------------------------------------
+void ODEModel::SubtractReferenceDerivatives(Integer order, Real atEpoch,
+      Real atOffset)
+{
+   Real reference[6], acceleration[3];
+
+   for (Integer i = 0; i < cartesianCount; ++i)
+   {
+      Integer i6 = cartesianStart + i * 6;
+      enckeReference.GetState(i, atEpoch, atOffset, reference, acceleration);
+
+      if (order == 1)
+      {
+         for (Integer j = 0; j < 3; ++j)
+         {
+            deriv[i6 + j] -= reference[j + 3];
+            deriv[i6 + j + 3] -= acceleration[j];
+         }
+      }
+      else
+      {
+         // Second order integrators take the accelerations in the position
+         // rows
+         for (Integer j = 0; j < 3; ++j)
+            deriv[i6 + j] -= acceleration[j];
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void RectifyDeviations(Real atEpoch, Real atOffset)
+//------------------------------------------------------------------------------
+/**
+ * Starts new Encke reference conics for the spacecraft that drifted away
+ *
+ * A spacecraft is rectified when its position deviation exceeds the
+ * RectificationTolerance fraction of its reference position.  Its full state
+ * becomes the new reference, and its deviations are reset to zero.
+ *
+ * @param atEpoch  The epoch of the model state, in days
+ * @param atOffset The offset of the model state from atEpoch, in seconds
+ */
+//------------------------------------------------------------------------------
+void ODEModel::RectifyDeviations(Real atEpoch, Real atOffset)
+{
+   Real reference[6], acceleration[3], newAcceleration[3], full[6];
+
+   for (Integer i = 0; i < cartesianCount; ++i)
+   {
+      Integer i6 = cartesianStart + i * 6;
+      enckeReference.GetState(i, atEpoch, atOffset, reference, acceleration);
+
+      const Real *delta = &modelState[i6];
+      Real deltaMag = delta[0]*delta[0] + delta[1]*delta[1] +
+            delta[2]*delta[2];
+      Real referenceMag = reference[0]*reference[0] +
+            reference[1]*reference[1] + reference[2]*reference[2];
+      if (deltaMag <= rectificationTolerance * rectificationTolerance *
+            referenceMag)
+         continue;
+
+      #ifdef DEBUG_ENCKE
+         MessageInterface::ShowMessage("Rectifying spacecraft %d at %.12lf + "
+               "%.6lf sec; deviation %le km\n", i, atEpoch, atOffset,
+               sqrt(deltaMag));
+      #endif
+
+      for (Integer j = 0; j < 6; ++j)
+         full[j] = delta[j] + reference[j];
+      enckeReference.Rectify(i, full, atEpoch, atOffset);
+      enckeReference.GetState(i, atEpoch, atOffset, reference,
+            newAcceleration);
+
+      for (Integer j = 0; j < 6; ++j)
+         modelState[i6 + j] = 0.0;
+      for (Integer j = 0; j < 3; ++j)
+      {
+         modelStateDot[i6 + j] = 0.0;
+         modelStateDot[i6 + j + 3] += acceleration[j] - newAcceleration[j];
+      }
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // void ReportEpochData()
 //------------------------------------------------------------------------------
@@ -70,6 +70,8 @@
 #define ODEModel_hpp
 
 #include "PhysicalModel.hpp"
+#include "DerivativeContext.hpp"
+#include "EnckeReference.hpp"
 #include "MessageInterface.hpp"
 #include "gmatdefs.hpp"
 
@@ -89,6 +91,14 @@
  * integrators in GMAT.  The ODEModel class implements the superposition of 
  * these contributors, and manages mapping into the correct elements of the 
  * output vector of derivative information. 
+ *
+ * With Formulation = Encke, the Cartesian states are integrated as deviations
+ * from two body reference conics about the force model origin.  The forces
+ * are evaluated on the full state, so they are scripted as for the default
+ * Cowell formulation.  A spacecraft's conic is restarted from its full state
+ * when the position deviation exceeds RectificationTolerance times the
+ * reference radius.  The conics change between steps, so the formulation is
+ * meant for the single step integrators.
  */
 class GMAT_API ODEModel : public PhysicalModel
 {
@@ -125,6 +135,8 @@ public:
    virtual bool GetDerivatives(Real * state, Real dt = 0.0, Integer order = 1, 
          const Integer id = -1);
    virtual Real EstimateError(Real *diffs, Real *answer) const;
+   Integer GetDerivativeAllocationCount() const;
+   std::string GetTimeJacobianReport();
 
    // Methods used for parameter access
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
@@ -403,6 +415,38 @@ protected:
    bool finiteDifferencingTimeJac;
    /// Array containing the most recent derivative calculation, when needed
    Real * nonAnalyticTimeDerivs;
+   /// The nominal derivatives of the forces that are differenced in time
+   RealArray nomTimeDerivs;
+   /// Values the derivative array is set to at the start of each evaluation
+   RealArray initialDerivs;
+   /// Nonzero A-matrix elements, by row, used to build the STM derivatives
+   RealArray aMatrixValues;
+   /// Column indices of the elements in aMatrixValues
+   IntegerArray aMatrixColumns;
+   /// Start of each A-matrix row in aMatrixValues, plus the end of the last
+   IntegerArray aMatrixRowStart;
+   /// Body states and rotations shared by the forces during an evaluation
+   DerivativeContext epochContext;
+   /// Context slots for the J2000 body and force origin states
+   Integer j2kSlot, originSlot;
+   /// Vector and matrix allocations made by the last derivative evaluation
+   /// (DEBUG_ARRAY_ALLOCATIONS builds only)
+   Integer derivativeAllocations;
+
+   /// Equations integrated for the Cartesian states, "Cowell" or "Encke"
+   std::string formulation;
+   /// Flag indicating that the Encke formulation is used
+   bool useEncke;
+   /// Deviation, relative to the reference position, that triggers a
+   /// rectification in the Encke formulation
+   Real rectificationTolerance;
+   /// Reference conics of the Encke formulation
+   EnckeReference enckeReference;
+   /// Full state passed to the forces in the Encke formulation
+   RealArray enckeState;
+   /// Full Cartesian states at the last derivative evaluation, used to scale
+   /// the error estimates in the Encke formulation
+   RealArray enckeScale;
    
    const StringArray&  BuildBodyList(std::string type) const;
    const StringArray&  BuildCoordinateList() const;
@@ -435,6 +479,15 @@ protected:
    void                      MoveToOriginGT(GmatTime newEpoch = -1.0);
    void                      ReturnFromOriginGT(GmatTime newEpoch = -1.0);
 
+   // Encke formulation
+   void                      StartDeviations(Real atEpoch, Real atOffset);
+   void                      AddReferenceStates(Real *theState,
+                                                Real *theStateDot,
+                                                Real atEpoch, Real atOffset);
+   void                      SubtractReferenceDerivatives(Integer order,
+                                                Real atEpoch, Real atOffset);
+   void                      RectifyDeviations(Real atEpoch, Real atOffset);
+
    
    // Elements from the redesign
    struct StateStructure
@@ -472,6 +525,7 @@ protected:
                                                Integer objectCount,
                                                Integer totalSize);
    bool                      PrepareDerivativeArray();
+   void                      BuildInitialDerivatives();
    bool                      CompleteDerivativeCalculations(Real *state);
 
    void                      FiniteDiffTimeJacobian(Real * state, Real dt, Integer order);
@@ -510,6 +564,10 @@ protected:
       // Plug-in forces not otherwise handled
       USER_DEFINED,
       EXTERNAL,
+
+      // Formulation of the equations of motion
+      FORMULATION,
+      RECTIFICATION_TOLERANCE,
       ODEModelParamCount	  
    };
    
@@ -104,6 +104,7 @@
 #include "MessageInterface.hpp"
 #include "TimeTypes.hpp"
 #include "PropagationStateManager.hpp"
+#include "MemoryTracker.hpp"
 
 
 //#define PHYSICAL_MODEL_DEBUG_INIT
@@ -119,9 +120,6 @@
 //#define DEBUG_MEMORY
 //#endif
 
-#ifdef DEBUG_MEMORY
-#include "MemoryTracker.hpp"
-#endif
 
 //---------------------------------
 // static data
@@ -171,6 +169,7 @@ PhysicalModel::PhysicalModel(UnsignedInt id, const std::string &typeStr,
    stateChanged                (false),
    allowODEDelete              (true),
    psm                         (NULL),
+   derivativeContext           (NULL),
    theState                    (NULL),
    modelState                  (NULL),
    modelStateDot               (NULL),
@@ -210,6 +209,9 @@ PhysicalModel::PhysicalModel(UnsignedInt id, const std::string &typeStr,
    // Do not allow ODE model changes in command mode
    blockCommandModeAssignment = true;
    theTimeConverter = TimeSystemConverter::Instance();
+
+   if (MemoryTracker::IsCounting())
+      MemoryTracker::CountAllocation(MemoryTracker::FORCE_MODEL);
 }
              
 //------------------------------------------------------------------------------
@@ -222,6 +224,9 @@ PhysicalModel::PhysicalModel(UnsignedInt id, const std::string &typeStr,
 //------------------------------------------------------------------------------
 PhysicalModel::~PhysicalModel()
 {
+   if (MemoryTracker::IsCounting())
+      MemoryTracker::CountRelease(MemoryTracker::FORCE_MODEL);
+
    #ifdef DEBUG_STATE_ALLOCATION
       MessageInterface::ShowMessage("Deleting PhysicalModel (type %s) at %p\n",
             typeName.c_str(), this);
@@ -331,6 +336,7 @@ PhysicalModel::PhysicalModel(const PhysicalModel& pm) :
    stateChanged                (pm.stateChanged),
    allowODEDelete              (pm.allowODEDelete),
    psm                         (NULL),
+   derivativeContext           (NULL),
    theState                    (NULL),
    modelState                  (NULL),
    modelStateDot               (NULL),
@@ -436,6 +442,9 @@ PhysicalModel::PhysicalModel(const PhysicalModel& pm) :
    }
 
    theTimeConverter = TimeSystemConverter::Instance();
+
+   if (MemoryTracker::IsCounting())
+      MemoryTracker::CountAllocation(MemoryTracker::FORCE_MODEL);
 }
 
 //------------------------------------------------------------------------------
@@ -468,6 +477,7 @@ PhysicalModel& PhysicalModel::operator=(const PhysicalModel& pm)
    /// @note: Since the next two are global objects, assignment works
    body        = pm.body;
    forceOrigin = pm.forceOrigin;
+   derivativeContext = NULL;
 
    bodyName        = pm.bodyName;
    dimension       = pm.dimension;
@@ -2035,11 +2045,12 @@ std::string PhysicalModel::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PhysicalModel::GetParameterID(const std::string &str) const
 {
-   for (int i = GmatBaseParamCount; i < PhysicalModelParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               PhysicalModelParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return GmatBase::GetParameterID(str);
 }
 
@@ -2675,6 +2686,25 @@ void PhysicalModel::SetPropStateManager(PropagationStateManager *sm)
 }
 
 
+//------------------------------------------------------------------------------
+// void SetDerivativeContext(DerivativeContext *context)
+//------------------------------------------------------------------------------
+/**
+ * Sets the epoch data cache shared by the members of the owning ODEModel
+ *
+ * The ODEModel calls this method after the force is initialized.  Forces that
+ * use the context override the method to register the body states and
+ * rotations they need.
+ *
+ * @param context The context, or NULL to stop using one
+ */
+//------------------------------------------------------------------------------
+void PhysicalModel::SetDerivativeContext(DerivativeContext *context)
+{
+   derivativeContext = context;
+}
+
+
 //------------------------------------------------------------------------------
 // bool BuildModelState(GmatEpoch now, Real* state, Real* j2kState,
 //       Integer dimension)
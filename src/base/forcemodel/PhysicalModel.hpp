@@ -124,6 +124,7 @@
 
 
 class PropagationStateManager;
+class DerivativeContext;
 
 
 /** 
@@ -293,6 +294,7 @@ public:
                               const std::string &name, const Integer index);
 
    virtual void        SetPropStateManager(PropagationStateManager *sm);
+   virtual void        SetDerivativeContext(DerivativeContext *context);
 
    // Methods used for PM based Parameters
    virtual bool        BuildModelState(GmatEpoch now, Real *state,
@@ -344,6 +346,8 @@ protected:
    
    /// Prop State Manager
    PropagationStateManager *psm;
+   /// Epoch data shared by the members of the owning ODEModel
+   DerivativeContext *derivativeContext;
    /// GMAT state that the physical model uses
    GmatState *theState;
    /// Array of data parameters containing the model data
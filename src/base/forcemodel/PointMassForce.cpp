@@ -77,6 +77,7 @@
 #include "GmatDefaults.hpp"
 #include "ODEModelException.hpp"
 #include "TimeTypes.hpp"
+#include "DerivativeContext.hpp"
 
 //#define DEBUG_PMF_BODY 0
 //#define DEBUG_PMF_DERV 0
@@ -133,6 +134,8 @@ PointMassForce::PointMassForce(const std::string &name) :
    mu                     (GmatSolarSystemDefaults::PLANET_MU[GmatSolarSystemDefaults::EARTH]),
    estimationMethod       (1.0),
    isPrimaryBody          (true),
+   bodySlot               (-1),
+   originSlot             (-1),
    satCount               (0)
 {
    parameterCount = PointMassParamCount;
@@ -183,6 +186,8 @@ PointMassForce::PointMassForce(const PointMassForce& pmf) :
    rv                     (pmf.rv),
    now                    (pmf.now),
    nowGT                  (pmf.nowGT),
+   bodySlot               (-1),
+   originSlot             (-1),
    satCount               (pmf.satCount)
 {
    parameterCount = PointMassParamCount;
@@ -219,6 +224,8 @@ PointMassForce& PointMassForce::operator= (const PointMassForce& pmf)
    rv               = pmf.rv;
    now              = pmf.now;
    nowGT            = pmf.nowGT;
+   bodySlot         = -1;
+   originSlot       = -1;
    satCount         = pmf.satCount;
 
    return *this;
@@ -296,6 +303,27 @@ bool PointMassForce::Initialize()
    return true;
 }
 
+//------------------------------------------------------------------------------
+// void SetDerivativeContext(DerivativeContext *context)
+//------------------------------------------------------------------------------
+/**
+ * Sets the shared epoch data, and registers the body and origin states
+ *
+ * @param context The context, or NULL to read the states from the bodies
+ */
+//------------------------------------------------------------------------------
+void PointMassForce::SetDerivativeContext(DerivativeContext *context)
+{
+   PhysicalModel::SetDerivativeContext(context);
+
+   bodySlot = originSlot = -1;
+   if ((context != NULL) && (body != NULL) && (forceOrigin != NULL))
+   {
+      bodySlot = context->AddBody(body);
+      originSlot = context->AddBody(forceOrigin);
+   }
+}
+
 //------------------------------------------------------------------------------
 // bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order)
 //------------------------------------------------------------------------------
@@ -353,15 +381,34 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
       #endif
 
       Real relativePosition[3];
-      if (hasPrecisionTime)
+      const Real *brv, *orv;
+      if (bodySlot >= 0)
       {
-         bodyrv = body->GetState(nowGT);
-         orig = forceOrigin->GetState(nowGT);
+         if (hasPrecisionTime)
+         {
+            brv = derivativeContext->GetBodyState(bodySlot, nowGT);
+            orv = derivativeContext->GetBodyState(originSlot, nowGT);
+         }
+         else
+         {
+            brv = derivativeContext->GetBodyState(bodySlot, now);
+            orv = derivativeContext->GetBodyState(originSlot, now);
+         }
       }
       else
       {
-         bodyrv = body->GetState(now);
-         orig = forceOrigin->GetState(now);
+         if (hasPrecisionTime)
+         {
+            bodyrv = body->GetState(nowGT);
+            orig = forceOrigin->GetState(nowGT);
+         }
+         else
+         {
+            bodyrv = body->GetState(now);
+            orig = forceOrigin->GetState(now);
+         }
+         brv = bodyrv.GetDataVector();
+         orv = orig.GetDataVector();
       }
 
       #ifdef DUMP_PLANET_DATA
@@ -369,13 +416,12 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
             "%17.12lf, %17.16lf, %17.16lf, %17.16lf, %s, %17.12lf, %17.12lf, "
             "%17.12lf, %17.12lf, %17.16lf, %17.16lf, %s, %17.12lf, %17.12lf, "
             "%17.12lf, %17.12lf, %17.16lf, %17.16lf\n", 
-            body->GetName().c_str(), now.Get(), bodyrv[0], bodyrv[1], bodyrv[2], 
-            bodyrv[3], bodyrv[4], bodyrv[5], "SC_Data", state[0], state[1], 
-            state[2], state[3], state[4], state[5], "origin", orig[0], orig[1],
-            orig[2], orig[3], orig[4], orig[5]);
+            body->GetName().c_str(), now.Get(), brv[0], brv[1], brv[2], 
+            brv[3], brv[4], brv[5], "SC_Data", state[0], state[1], 
+            state[2], state[3], state[4], state[5], "origin", orv[0], orv[1],
+            orv[2], orv[3], orv[4], orv[5]);
       #endif
 
-      const Real *brv = bodyrv.GetDataVector(), *orv = orig.GetDataVector();
       Real rv[6];
       rv[0] = brv[0] - orv[0];
       rv[1] = brv[1] - orv[1];
@@ -455,7 +501,8 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
       #ifdef DEBUG_FORCE_ORIGIN
          MessageInterface::ShowMessage(
             "Epoch:  %16.11lf\n  Origin:  [%s]\n  J2KBod:  [%s]\n",
-            now.Get(), orig.ToString().c_str(), bodyrv.ToString().c_str());
+            now.Get(), Rvector6(orv).ToString().c_str(),
+            Rvector6(brv).ToString().c_str());
          MessageInterface::ShowMessage(
             "Now = %16.11lf rbb3 = %16.11le rv = [%16lf %16lf %16lf]\n",
             now.Get(), rbb3, rv[0], rv[1], rv[2]);
@@ -465,9 +512,9 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
          MessageInterface::ShowMessage("Indirect term for %s with mu %.15le:\n",
                body->GetName().c_str(), mu);
          MessageInterface::ShowMessage("   Origin   = [%16le %16le %16le]\n",
-               orig[0], orig[1], orig[2]);
+               orv[0], orv[1], orv[2]);
          MessageInterface::ShowMessage("   Position = [%16le %16le %16le]\n",
-               bodyrv[0], bodyrv[1], bodyrv[2]);
+               brv[0], brv[1], brv[2]);
          MessageInterface::ShowMessage("   a_indirect = [%16le %16le %16le]\n",
                body->GetName().c_str(), a_indirect[0],
                a_indirect[1], a_indirect[2]);
@@ -483,7 +530,10 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
              satCount);
       #endif
       
-      if (fillCartesian)
+      // Sets of spacecraft (formations, debris clouds) are filled in blocks
+      if (fillCartesian && (satCount > 1))
+         FillCartesianBlocks(state, rv, a_indirect, order);
+      else if (fillCartesian)
       {
          for (Integer i = 0; i < satCount; i++) 
          {
@@ -595,7 +645,10 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
 				// Create aTilde matrix
 				stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");
 				Integer stmSize = stmRowCount * stmRowCount;
-				Real *aTilde = new Real[stmSize];
+				// The buffer only grows, so it is sized on the first call
+				if ((Integer)aTildeBuffer.size() < stmSize)
+				   aTildeBuffer.resize(stmSize);
+				Real *aTilde = &aTildeBuffer[0];
             for (Integer i = 0; i < stmRowCount; ++i)
             {
                ix = i * stmRowCount;
@@ -665,7 +718,6 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
                }
             }
 
-				delete[] aTilde;
 				if (fillSTM)
 					s6 = s6 + stmSize;
 				if (fillAMatrix)
@@ -678,6 +730,70 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
    return true;
 }
 
+//------------------------------------------------------------------------------
+// void FillCartesianBlocks(const Real *state, const Real *rv,
+//       const Real *a_indirect, Integer order)
+//------------------------------------------------------------------------------
+/**
+ * Fills the Cartesian derivatives of a set of spacecraft in blocks.
+ *
+ * The positions of BATCH_BLOCK spacecraft at a time are gathered into
+ * component arrays, so that the distance and acceleration loops have a fixed
+ * length and no branches and can be vectorized by the compiler.  Unused lanes
+ * of the last block repeat its first spacecraft.  The arithmetic is the same
+ * as in the loop over single spacecraft in GetDerivatives().
+ *
+ * @param state      The state vector
+ * @param rv         State of the body with respect to the force origin
+ * @param a_indirect The indirect acceleration of the force origin
+ * @param order      1 for first order derivatives, 2 for the accelerations
+ *                   used by the Runge-Kutta-Nystrom integrators
+ */
+//------------------------------------------------------------------------------
+void PointMassForce::FillCartesianBlocks(const Real *state, const Real *rv,
+      const Real *a_indirect, Integer order)
+{
+   const Integer B = BATCH_BLOCK;
+   Real dx[B], dy[B], dz[B], mu_r[B];
+
+   // Rows that receive the accelerations and the rows that are zeroed
+   Integer accel = (order == 1 ? 3 : 0);
+   Integer other = (order == 1 ? 0 : 3);
+
+   for (Integer first = 0; first < satCount; first += B)
+   {
+      Integer nk = (satCount - first < B ? satCount - first : B);
+      const Real *s = state + cartesianStart + first * 6;
+
+      for (Integer k = 0; k < B; ++k)
+      {
+         Integer src = (k < nk ? k : 0) * 6;
+         dx[k] = rv[0] - s[ src ];
+         dy[k] = rv[1] - s[src+1];
+         dz[k] = rv[2] - s[src+2];
+      }
+
+      for (Integer k = 0; k < B; ++k)
+      {
+         Real r3 = dx[k]*dx[k] + dy[k]*dy[k] + dz[k]*dz[k];
+         Real radius = sqrt(r3);
+         r3 *= radius;
+         mu_r[k] = mu / r3;
+      }
+
+      Real *d = deriv + cartesianStart + first * 6;
+      for (Integer k = 0; k < nk; ++k)
+      {
+         Real *dk = d + k * 6;
+         dk[accel]   = dx[k] * mu_r[k] - a_indirect[0];
+         dk[accel+1] = dy[k] * mu_r[k] - a_indirect[1];
+         dk[accel+2] = dz[k] * mu_r[k] - a_indirect[2];
+         dk[other] = dk[other+1] = dk[other+2] = 0.0;
+      }
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // bool PointMassForce::GetComponentMap(Integer * map, Integer order) const
 //------------------------------------------------------------------------------
@@ -923,11 +1039,12 @@ std::string PointMassForce::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PointMassForce::GetParameterID(const std::string &str) const
 {
-   for (Integer i = PhysicalModelParamCount; i < PointMassParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, PhysicalModelParamCount,
+               PointMassParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return PhysicalModel::GetParameterID(str);
 }
 
@@ -88,6 +88,7 @@ public:
          const Integer id = -1);
    bool GetComponentMap(Integer * map, Integer order) const;
    bool Initialize();
+   virtual void SetDerivativeContext(DerivativeContext *context);
    virtual Real EstimateError(Real *diffs, Real *answer) const;
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
 
@@ -164,9 +165,19 @@ protected:
    Rvector3 rv;
    A1Mjd now;
    GmatTime nowGT;
+   /// Derivative context slots for the body and force origin states; -1
+   /// when the states are read from the bodies
+   Integer bodySlot, originSlot;
+   /// Work space for the A-tilde matrices
+   RealArray aTildeBuffer;
 
    Integer satCount;
 //   Integer cartIndex;
+
+   /// Number of spacecraft filled together by FillCartesianBlocks
+   static const Integer BATCH_BLOCK = 8;
+   void FillCartesianBlocks(const Real *state, const Real *rv,
+                            const Real *a_indirect, Integer order);
    
    // for Debug
    void ShowBodyState(const std::string &header, Real time, Rvector6 &rv);
@@ -41,6 +41,8 @@
 #include "RelativisticCorrection.hpp"
 #include "TimeSystemConverter.hpp"
 #include "MessageInterface.hpp"
+#include "DerivativeContext.hpp"
+#include "Profiler.hpp"           // for ProfileScope
 
 //#define DEBUG_RELATIVISTIC_CORRECTION
 //#define DEBUG_DERIVATIVES
@@ -83,7 +85,14 @@ RelativisticCorrection::RelativisticCorrection(const std::string &name, const st
   satCount               (0),
   bodyInertial           (NULL),
   bodyFixed              (NULL),
-  eop                    (NULL)
+  eop                    (NULL),
+  sunSlot                (-1),
+  bodySlot               (-1),
+  rotationSlot           (-1),
+  isSunCentered          (false),
+  termsEpoch             (-1.0),
+  termsFromContext       (false),
+  termsValid             (false)
 {
    objectTypeNames.push_back("RelativisticCorrection");
    parameterCount = RelativisticCorrectionParamCount;
@@ -130,7 +139,14 @@ RelativisticCorrection::RelativisticCorrection(const RelativisticCorrection &rc)
    satCount       (rc.satCount),
    bodyInertial   (NULL),
    bodyFixed      (NULL),
-   eop            (rc.eop)
+   eop            (rc.eop),
+   sunSlot        (-1),
+   bodySlot       (-1),
+   rotationSlot   (-1),
+   isSunCentered  (rc.isSunCentered),
+   termsEpoch     (-1.0),
+   termsFromContext (false),
+   termsValid     (false)
 {
    objectTypeNames.push_back("RelativisticCorrection");
    parameterCount = RelativisticCorrectionParamCount;
@@ -166,6 +182,11 @@ RelativisticCorrection& RelativisticCorrection::operator=(const RelativisticCorr
    bodyInertial   = (CoordinateSystem*) rc.bodyInertial->Clone();
    bodyFixed      = (CoordinateSystem*) rc.bodyFixed->Clone();
    eop            = rc.eop;
+   sunSlot        = -1;
+   bodySlot       = -1;
+   rotationSlot   = -1;
+   isSunCentered  = rc.isSunCentered;
+   termsValid     = false;
 
    return *this;
 }
@@ -217,10 +238,42 @@ bool RelativisticCorrection::Initialize()
                                        NULL, NULL, body->GetJ2000Body(), solarSystem);
 //   }
 
+   isSunCentered = (body->GetName() == GmatSolarSystemDefaults::SUN_NAME);
+   termsValid    = false;
+
    return true;
 }
 
 
+//------------------------------------------------------------------------------
+//  void SetDerivativeContext(DerivativeContext *context)
+//------------------------------------------------------------------------------
+/**
+ * Sets the shared epoch data, and registers the Sun and body states and the
+ * body rotation
+ *
+ * @param context The context, or NULL to compute the data locally
+ */
+//------------------------------------------------------------------------------
+void RelativisticCorrection::SetDerivativeContext(DerivativeContext *context)
+{
+   PhysicalModel::SetDerivativeContext(context);
+
+   sunSlot = bodySlot = rotationSlot = -1;
+   termsValid = false;
+   if (context != NULL)
+   {
+      if ((theSun != NULL) && (body != NULL))
+      {
+         sunSlot  = context->AddBody(theSun);
+         bodySlot = context->AddBody(body);
+      }
+      if ((bodyInertial != NULL) && (bodyFixed != NULL))
+         rotationSlot = context->AddRotation(bodyInertial, bodyFixed);
+   }
+}
+
+
 //------------------------------------------------------------------------------
 //  bool GetDerivatives(Real *state, Real dt = 0.0, Integer order = 1,
 //                      const Integer id = -1)
@@ -243,7 +296,6 @@ bool RelativisticCorrection::GetDerivatives(Real *state, Real dt, Integer order,
    if (fillCartesian)
    {
       Real      c      = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM * GmatMathConstants::M_TO_KM;
-      sunMu            = theSun->GetGravitationalConstant();
       bodyMu           = body->GetGravitationalConstant();  // this is passed in by the ODEModel
 
       #ifdef DEBUG_RELATIVISTIC_CORRECTION
@@ -252,86 +304,19 @@ bool RelativisticCorrection::GetDerivatives(Real *state, Real dt, Integer order,
          MessageInterface::ShowMessage("bodyMu                 = %12.10f\n", bodyMu);
       #endif
 
-      Rvector6  dummy(0.0, 1.0, 2.0, 3.0, 4.0, 5.0), dummyResult;
+      // The geodesic and spin terms depend only on the epoch, so they are
+      // built once and shared by every spacecraft in the state vector
+      ComputeEpochTerms(now.Get(), GmatTime(now.Get()), true);
+      const Real *omega = geodesicOmega;
+      const Real *J     = bodyAngularMomentum;
+
       Real      r, v, s1, rvDotvvX4, s2_1, lt1, lt2;
-      Rmatrix33 R;    // fixed to inertial rotation matrix
-      Rmatrix33 Rdot; // fixed to inertial rotation Dot matrix
-      Real      ar[3], geodesic[3], s2[3], s3[3], schwarzschild[3], J1[3], J[3], rvCrossvv[3], vvCrossJ[3];
-      Real      rv[3], vv[3], omega[3], lenseThirring[3];
-      Rvector3  bodySpinVector;
-
-      J[0]             = J[1]             = J[2]             = 0.0;
-      omega[0]         = omega[1]         = omega[2]         = 0.0;
+      Real      ar[3], geodesic[3], s2[3], s3[3], schwarzschild[3], rvCrossvv[3], vvCrossJ[3];
+      Real      rv[3], vv[3], lenseThirring[3];
+
       geodesic[0]      = geodesic[1]      = geodesic[2]      = 0.0;
       lenseThirring[0] = lenseThirring[1] = lenseThirring[2] = 0.0;
 
-
-      // compute quantities needed for geodesic (for non-Sun only) and lense-thirring terms
-      if (body->GetName() != GmatSolarSystemDefaults::SUN_NAME)
-      {
-         Rvector6  stateWRTSun;
-         Real      posWRTSun[3], velWRTSun[3], vel[3], pos[3];
-         Real      posMag, muCBc2r3;
-         Real      threeOver2 = 3.0 / 2.0;
-
-         stateWRTSun  = body->GetMJ2000State(now) - theSun->GetMJ2000State(now);
-         posWRTSun[0] = stateWRTSun[0];
-         posWRTSun[1] = stateWRTSun[1];
-         posWRTSun[2] = stateWRTSun[2];
-         velWRTSun[0] = stateWRTSun[3];
-         velWRTSun[1] = stateWRTSun[4];
-         velWRTSun[2] = stateWRTSun[5];
-         posMag       = GmatMathUtil::Sqrt(posWRTSun[0] * posWRTSun[0] + posWRTSun[1] * posWRTSun[1] + posWRTSun[2] * posWRTSun[2]);
-
-         muCBc2r3     = sunMu/ (c * c * posMag * posMag * posMag);
-
-         vel[0]       = threeOver2 * velWRTSun[0];
-         vel[1]       = threeOver2 * velWRTSun[1];
-         vel[2]       = threeOver2 * velWRTSun[2];
-         pos[0]       = -muCBc2r3 * posWRTSun[0];
-         pos[1]       = -muCBc2r3 * posWRTSun[1];
-         pos[2]       = -muCBc2r3 * posWRTSun[2];
-         // Compute cross product
-         omega[0]     = vel[1]*pos[2] - vel[2]*pos[1];
-         omega[1]     = vel[2]*pos[0] - vel[0]*pos[2];
-         omega[2]     = vel[0]*pos[1] - vel[1]*pos[0];
-         #ifdef DEBUG_RELATIVISTIC_CORRECTION
-            MessageInterface::ShowMessage("muCBc2r3  = %le\n", muCBc2r3);
-            MessageInterface::ShowMessage("posMag    = %le\n", posMag);
-            MessageInterface::ShowMessage("pos       = %le   %le   %le\n", pos[0], pos[1], pos[2]);
-            MessageInterface::ShowMessage("vel       = %le   %le   %le\n", vel[0], vel[1], vel[2]);
-            MessageInterface::ShowMessage("posWRTSun = %le   %le   %le\n", posWRTSun[0], posWRTSun[1], posWRTSun[2]);
-            MessageInterface::ShowMessage("velWRTSun = %le   %le   %le\n", velWRTSun[0], velWRTSun[1], velWRTSun[2]);
-            MessageInterface::ShowMessage("big Omega = %le   %le   %le\n", omega[0], omega[1], omega[2]);
-         #endif
-      }
-
-      bodyRadius   = body->GetEquatorialRadius();
-      // We want the body's fixed to inertial rotation matrix
-      cc.Convert(now, dummy, bodyFixed, dummyResult, bodyInertial);
-      R            = cc.GetLastRotationMatrix();
-      Rdot         = cc.GetLastRotationDotMatrix();
-
-      // Compute the body spin rate
-      bodySpinVector[0] = (-R(0,2) * Rdot(0,1)) - (R(1,2) * Rdot(1,1)) - (R(2,2) * Rdot(2,1));
-      bodySpinVector[1] = ( R(0,2) * Rdot(0,0)) + (R(1,2) * Rdot(1,0)) + (R(2,2) * Rdot(2,0));
-      bodySpinVector[2] = (-R(0,1) * Rdot(0,0)) - (R(1,1) * Rdot(1,0)) - (R(2,1) * Rdot(2,0));
-      bodySpinRate = GmatMathUtil::Sqrt(bodySpinVector[0] * bodySpinVector[0] + bodySpinVector[1] * bodySpinVector[1] + bodySpinVector[2] * bodySpinVector[2]);
-      J1[0] = 0.0;
-      J1[1] = 0.0;
-      J1[2] = (2.0 / 5.0) * bodyRadius * bodyRadius * bodySpinRate;
-      J[0] = R(0,0)*J1[0] + R(0,1)*J1[1] + R(0,2)*J1[2];
-      J[1] = R(1,0)*J1[0] + R(1,1)*J1[1] + R(1,2)*J1[2];
-      J[2] = R(2,0)*J1[0] + R(2,1)*J1[1] + R(2,2)*J1[2];
-
-      #ifdef DEBUG_RELATIVISTIC_CORRECTION
-         MessageInterface::ShowMessage("R    = %s\n", R.ToString().c_str());
-         MessageInterface::ShowMessage("Rdot = %s\n", Rdot.ToString().c_str());
-         MessageInterface::ShowMessage("J                      = %le   %le   %le\n", J[0], J[1], J[2]);
-         MessageInterface::ShowMessage("bodySpinVector         = %le   %le   %le\n", bodySpinVector[0], bodySpinVector[1], bodySpinVector[2]);
-         MessageInterface::ShowMessage("bodySpinRate           = %le\n", bodySpinRate);
-      #endif
-
       Integer nOffset;
       for (Integer n = 0; n < cartesianCount; ++n)
       {
@@ -359,7 +344,7 @@ bool RelativisticCorrection::GetDerivatives(Real *state, Real dt, Integer order,
          schwarzschild[2] = s1 * (s2[2] + s3[2]);
 
          // IF the body is not the Sun, compute the geodesic term
-         if (body->GetName() != GmatSolarSystemDefaults::SUN_NAME)
+         if (!isSunCentered)
          {
             // Compute the geodesic precession
             geodesic[0]       =  2.0 * (omega[1]*vv[2] - omega[2]*vv[1]);
@@ -428,84 +413,36 @@ bool RelativisticCorrection::GetDerivatives(Real *state, Real dt, Integer order,
 
    if (fillSTM)
    {
-		Integer i6 = stmStart;
-      Integer element;
+      // The correction does not contribute to the variational equations
+      Integer i6 = stmStart;
       for (Integer i = 0; i < stmCount; ++i)
       {
-			Integer ix;
-         
-			// Get Spacecraft object
-			Spacecraft* sc = (Spacecraft*)scObjs[i];
-
-			// Create aTilde matrix
-			stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");
-			Integer stmSize = stmRowCount * stmRowCount;
-			Real *aTilde = new Real[stmSize];
-
-			// Calculate A-tilde
-			for (Integer j = 0; j < stmRowCount; ++j)
-         {
-            ix = j * stmRowCount;
-            for (Integer k = 0; k < stmRowCount; ++k)
-               aTilde[ix+k] = 0.0;
-         }
+         // Get Spacecraft object
+         Spacecraft* sc = (Spacecraft*)scObjs[i];
 
-			
-         for (Integer j = 0; j < stmRowCount; j++)
-         {
-            for (Integer k = 0; k < stmRowCount; k++)
-            {
-               element = j * stmRowCount + k;
-               #ifdef DEBUG_DERIVATIVES
-                  MessageInterface::ShowMessage("------ deriv[%d] = %12.10f\n", (i6+element), aTilde[element]);
-               #endif
-               deriv[i6+element] = aTilde[element];
-            }
-         }
+         stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");
+         Integer stmSize = stmRowCount * stmRowCount;
+         for (Integer element = 0; element < stmSize; ++element)
+            deriv[i6+element] = 0.0;
 
-			delete[] aTilde;
-			i6 = i6 + stmSize;
+         i6 = i6 + stmSize;
       }
    }
    if (fillAMatrix)
    {
       Integer i6 = aMatrixStart;
-      Integer element;
       for (Integer i = 0; i < stmCount; ++i)
       {
-			Integer ix;
-
-			// Get Spacecraft object
-			Spacecraft* sc = (Spacecraft*)scObjs[i];
-
-         // Create aTilde matrix
-			stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");
-			Integer stmSize = stmRowCount * stmRowCount;
-			Real *aTilde = new Real[stmSize];
-
-			// Calculate A-tilde
-         for (Integer j = 0; j < stmRowCount; ++j)
-         {
-            ix = j * stmRowCount;
-            for (Integer k = 0; k < stmRowCount; ++k)
-               aTilde[ix+k] = 0.0;
-         }
+         // Get Spacecraft object
+         Spacecraft* sc = (Spacecraft*)scObjs[i];
 
-         for (Integer j = 0; j < stmRowCount; j++)
-         {
-            for (Integer k = 0; k < stmRowCount; k++)
-            {
-               element = j * stmRowCount + k;
-               #ifdef DEBUG_DERIVATIVES
-                  MessageInterface::ShowMessage("------ deriv[%d] = %12.10f\n", (i6+element), aTilde[element]);
-               #endif
-               deriv[i6+element] = aTilde[element];
-            }
-         }
+         stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");
+         Integer stmSize = stmRowCount * stmRowCount;
+         for (Integer element = 0; element < stmSize; ++element)
+            deriv[i6+element] = 0.0;
 
-			delete[] aTilde;
-			i6 = i6 + stmSize;
-		}
+         i6 = i6 + stmSize;
+      }
    }
 
    return true;
@@ -539,112 +476,21 @@ Rvector6 RelativisticCorrection::GetDerivativesForSpacecraft(Spacecraft* sc)
 
    Real      c      = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM *
          GmatMathConstants::M_TO_KM;
-   sunMu            = theSun->GetGravitationalConstant();
    bodyMu           = body->GetGravitationalConstant();  // from ODEModel
 
-   Rvector6  dummy(0.0, 1.0, 2.0, 3.0, 4.0, 5.0), dummyResult;
+   // Spacecraft at the same epoch share the geodesic and spin terms
+   ComputeEpochTerms(now, nowgt, false);
+   const Real *omega = geodesicOmega;
+   const Real *J     = bodyAngularMomentum;
+
    Real      r, v, s1, rvDotvvX4, s2_1, lt1, lt2;
-   Rmatrix33 R;    // fixed to inertial rotation matrix
-   Rmatrix33 Rdot; // fixed to inertial rotation Dot matrix
-   Real      ar[3], geodesic[3], s2[3], s3[3], schwarzschild[3], J1[3], J[3],
+   Real      ar[3], geodesic[3], s2[3], s3[3], schwarzschild[3],
              rvCrossvv[3], vvCrossJ[3];
-   Real      rv[3], vv[3], omega[3], lenseThirring[3];
-   Rvector3  bodySpinVector;
+   Real      rv[3], vv[3], lenseThirring[3];
 
-   J[0]             = J[1]             = J[2]             = 0.0;
-   omega[0]         = omega[1]         = omega[2]         = 0.0;
    geodesic[0]      = geodesic[1]      = geodesic[2]      = 0.0;
    lenseThirring[0] = lenseThirring[1] = lenseThirring[2] = 0.0;
 
-   // needed for geodesic (for non-Sun only) and lense-thirring terms
-   if (body->GetName() != GmatSolarSystemDefaults::SUN_NAME)
-   {
-      Rvector6  stateWRTSun;
-      Real      posWRTSun[3], velWRTSun[3], vel[3], pos[3];
-      Real      posMag, muCBc2r3;
-      Real      threeOver2 = 3.0 / 2.0;
-
-      if (hasPrecisionTime)
-         stateWRTSun = body->GetMJ2000State(nowgt) - theSun->GetMJ2000State(nowgt);
-      else
-         stateWRTSun  = body->GetMJ2000State(now) - theSun->GetMJ2000State(now);
-
-      posWRTSun[0] = stateWRTSun[0];
-      posWRTSun[1] = stateWRTSun[1];
-      posWRTSun[2] = stateWRTSun[2];
-      velWRTSun[0] = stateWRTSun[3];
-      velWRTSun[1] = stateWRTSun[4];
-      velWRTSun[2] = stateWRTSun[5];
-      posMag       = GmatMathUtil::Sqrt(posWRTSun[0] * posWRTSun[0] +
-                                        posWRTSun[1] * posWRTSun[1] +
-                                        posWRTSun[2] * posWRTSun[2]);
-
-      muCBc2r3     = sunMu/ (c * c * posMag * posMag * posMag);
-
-      vel[0]       = threeOver2 * velWRTSun[0];
-      vel[1]       = threeOver2 * velWRTSun[1];
-      vel[2]       = threeOver2 * velWRTSun[2];
-      pos[0]       = -muCBc2r3 * posWRTSun[0];
-      pos[1]       = -muCBc2r3 * posWRTSun[1];
-      pos[2]       = -muCBc2r3 * posWRTSun[2];
-      // Compute cross product
-      omega[0]     = vel[1]*pos[2] - vel[2]*pos[1];
-      omega[1]     = vel[2]*pos[0] - vel[0]*pos[2];
-      omega[2]     = vel[0]*pos[1] - vel[1]*pos[0];
-      #ifdef DEBUG_RELATIVISTIC_CORRECTION
-         MessageInterface::ShowMessage("muCBc2r3  = %le\n", muCBc2r3);
-         MessageInterface::ShowMessage("posMag    = %le\n", posMag);
-         MessageInterface::ShowMessage("pos       = %le   %le   %le\n", pos[0],
-               pos[1], pos[2]);
-         MessageInterface::ShowMessage("vel       = %le   %le   %le\n", vel[0],
-               vel[1], vel[2]);
-         MessageInterface::ShowMessage("posWRTSun = %le   %le   %le\n",
-               posWRTSun[0], posWRTSun[1], posWRTSun[2]);
-         MessageInterface::ShowMessage("velWRTSun = %le   %le   %le\n",
-               velWRTSun[0], velWRTSun[1], velWRTSun[2]);
-         MessageInterface::ShowMessage("big Omega = %le   %le   %le\n",
-               omega[0], omega[1], omega[2]);
-      #endif
-   }
-
-   bodyRadius   = body->GetEquatorialRadius();
-   // We want the body's fixed to inertial rotation matrix
-   if (hasPrecisionTime)
-      cc.Convert(nowgt, dummy, bodyFixed, dummyResult, bodyInertial);
-   else
-      cc.Convert(now, dummy, bodyFixed, dummyResult, bodyInertial);
-
-   R            = cc.GetLastRotationMatrix();
-   Rdot         = cc.GetLastRotationDotMatrix();
-
-   // Compute the body spin rate
-   bodySpinVector[0] = (-R(0,2) * Rdot(0,1)) - (R(1,2) * Rdot(1,1)) -
-         (R(2,2) * Rdot(2,1));
-   bodySpinVector[1] = ( R(0,2) * Rdot(0,0)) + (R(1,2) * Rdot(1,0)) +
-         (R(2,2) * Rdot(2,0));
-   bodySpinVector[2] = (-R(0,1) * Rdot(0,0)) - (R(1,1) * Rdot(1,0)) -
-         (R(2,1) * Rdot(2,0));
-   bodySpinRate = GmatMathUtil::Sqrt(bodySpinVector[0] * bodySpinVector[0] +
-                                     bodySpinVector[1] * bodySpinVector[1] +
-                                     bodySpinVector[2] * bodySpinVector[2]);
-   J1[0] = 0.0;
-   J1[1] = 0.0;
-   J1[2] = (2.0 / 5.0) * bodyRadius * bodyRadius * bodySpinRate;
-   J[0] = R(0,0)*J1[0] + R(0,1)*J1[1] + R(0,2)*J1[2];
-   J[1] = R(1,0)*J1[0] + R(1,1)*J1[1] + R(1,2)*J1[2];
-   J[2] = R(2,0)*J1[0] + R(2,1)*J1[1] + R(2,2)*J1[2];
-
-   #ifdef DEBUG_RELATIVISTIC_CORRECTION
-      MessageInterface::ShowMessage("R    = %s\n", R.ToString().c_str());
-      MessageInterface::ShowMessage("Rdot = %s\n", Rdot.ToString().c_str());
-      MessageInterface::ShowMessage("J                      = %le   %le   "
-            "%le\n", J[0], J[1], J[2]);
-      MessageInterface::ShowMessage("bodySpinVector         = %le   %le   "
-            "%le\n", bodySpinVector[0], bodySpinVector[1], bodySpinVector[2]);
-      MessageInterface::ShowMessage("bodySpinRate           = %le\n",
-            bodySpinRate);
-   #endif
-
    for (Integer i = 0; i < 3; ++i)
    {
       rv[i] = state[i];
@@ -668,7 +514,7 @@ Rvector6 RelativisticCorrection::GetDerivativesForSpacecraft(Spacecraft* sc)
    schwarzschild[2] = s1 * (s2[2] + s3[2]);
 
    // IF the body is not the Sun, compute the geodesic term
-   if (body->GetName() != GmatSolarSystemDefaults::SUN_NAME)
+   if (!isSunCentered)
    {
       // Compute the geodesic precession
       geodesic[0]       =  2.0 * (omega[1]*vv[2] - omega[2]*vv[1]);
@@ -712,6 +558,168 @@ Rvector6 RelativisticCorrection::GetDerivativesForSpacecraft(Spacecraft* sc)
 }
 
 
+//------------------------------------------------------------------------------
+// void ComputeEpochTerms(Real when, const GmatTime &whenGT, bool fromContext)
+//------------------------------------------------------------------------------
+/**
+ * Builds the terms of the correction that depend only on the epoch
+ *
+ * The geodesic precession vector and the body angular momentum depend on the
+ * Sun and body states and the body rotation, but not on the spacecraft.  They
+ * are computed once per epoch and reused for every spacecraft, and for repeat
+ * evaluations at the same epoch.
+ *
+ * @param when        The A.1 epoch of the terms
+ * @param whenGT      The same epoch with full precision
+ * @param fromContext true to use the derivative context data when available,
+ *                    as the ODEModel derivative calls do
+ */
+//------------------------------------------------------------------------------
+void RelativisticCorrection::ComputeEpochTerms(Real when, const GmatTime &whenGT,
+      bool fromContext)
+{
+   // Single spacecraft evaluations use the precise epoch when there is one
+   bool precise = hasPrecisionTime && !fromContext;
+
+   if (termsValid && (termsFromContext == fromContext) &&
+       (termsEpoch == when) && (!precise || (termsEpochGT == whenGT)))
+      return;
+
+   static const std::string profileLabel = "RelativisticCorrection epoch terms";
+   ProfileScope profile("Force", profileLabel);
+
+   A1Mjd     whenA1(when);
+   Real      c      = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM *
+         GmatMathConstants::M_TO_KM;
+   Rmatrix33 R;    // fixed to inertial rotation matrix
+   Rmatrix33 Rdot; // fixed to inertial rotation Dot matrix
+   Real      J1[3];
+   Rvector3  bodySpinVector;
+
+   sunMu = theSun->GetGravitationalConstant();
+   geodesicOmega[0] = geodesicOmega[1] = geodesicOmega[2] = 0.0;
+
+   // compute quantities needed for geodesic (for non-Sun only) term
+   if (!isSunCentered)
+   {
+      Real      posWRTSun[3], velWRTSun[3], vel[3], pos[3];
+      Real      posMag, muCBc2r3;
+      Real      threeOver2 = 3.0 / 2.0;
+
+      if (fromContext && (sunSlot >= 0))
+      {
+         // Both states are in the solar system J2000 frame
+         const Real *bodyState = derivativeContext->GetBodyState(bodySlot, whenA1);
+         const Real *sunState  = derivativeContext->GetBodyState(sunSlot, whenA1);
+         for (Integer i = 0; i < 3; ++i)
+         {
+            posWRTSun[i] = bodyState[i]   - sunState[i];
+            velWRTSun[i] = bodyState[i+3] - sunState[i+3];
+         }
+      }
+      else
+      {
+         Rvector6 stateWRTSun;
+         if (precise)
+            stateWRTSun = body->GetMJ2000State(whenGT) - theSun->GetMJ2000State(whenGT);
+         else
+            stateWRTSun = body->GetMJ2000State(whenA1) - theSun->GetMJ2000State(whenA1);
+         for (Integer i = 0; i < 3; ++i)
+         {
+            posWRTSun[i] = stateWRTSun[i];
+            velWRTSun[i] = stateWRTSun[i+3];
+         }
+      }
+      posMag       = GmatMathUtil::Sqrt(posWRTSun[0] * posWRTSun[0] +
+                                        posWRTSun[1] * posWRTSun[1] +
+                                        posWRTSun[2] * posWRTSun[2]);
+
+      muCBc2r3     = sunMu/ (c * c * posMag * posMag * posMag);
+
+      vel[0]       = threeOver2 * velWRTSun[0];
+      vel[1]       = threeOver2 * velWRTSun[1];
+      vel[2]       = threeOver2 * velWRTSun[2];
+      pos[0]       = -muCBc2r3 * posWRTSun[0];
+      pos[1]       = -muCBc2r3 * posWRTSun[1];
+      pos[2]       = -muCBc2r3 * posWRTSun[2];
+      // Compute cross product
+      geodesicOmega[0] = vel[1]*pos[2] - vel[2]*pos[1];
+      geodesicOmega[1] = vel[2]*pos[0] - vel[0]*pos[2];
+      geodesicOmega[2] = vel[0]*pos[1] - vel[1]*pos[0];
+      #ifdef DEBUG_RELATIVISTIC_CORRECTION
+         MessageInterface::ShowMessage("muCBc2r3  = %le\n", muCBc2r3);
+         MessageInterface::ShowMessage("posMag    = %le\n", posMag);
+         MessageInterface::ShowMessage("posWRTSun = %le   %le   %le\n",
+               posWRTSun[0], posWRTSun[1], posWRTSun[2]);
+         MessageInterface::ShowMessage("velWRTSun = %le   %le   %le\n",
+               velWRTSun[0], velWRTSun[1], velWRTSun[2]);
+         MessageInterface::ShowMessage("big Omega = %le   %le   %le\n",
+               geodesicOmega[0], geodesicOmega[1], geodesicOmega[2]);
+      #endif
+   }
+
+   bodyRadius   = body->GetEquatorialRadius();
+   // We want the body's fixed to inertial rotation matrix
+   if (fromContext && (rotationSlot >= 0))
+   {
+      // The context holds the inertial to fixed rotation, which is shared
+      // with the gravity field; its transpose is the rotation needed here
+      const Real *rm    = derivativeContext->GetRotation(rotationSlot, whenA1);
+      const Real *rmDot = derivativeContext->GetRotationDot(rotationSlot, whenA1);
+      for (Integer i = 0; i < 3; ++i)
+      {
+         for (Integer j = 0; j < 3; ++j)
+         {
+            R(i,j)    = rm[j*3+i];
+            Rdot(i,j) = rmDot[j*3+i];
+         }
+      }
+   }
+   else
+   {
+      Rvector6  dummy(0.0, 1.0, 2.0, 3.0, 4.0, 5.0), dummyResult;
+      if (precise)
+         cc.Convert(whenGT, dummy, bodyFixed, dummyResult, bodyInertial);
+      else
+         cc.Convert(whenA1, dummy, bodyFixed, dummyResult, bodyInertial);
+      R            = cc.GetLastRotationMatrix();
+      Rdot         = cc.GetLastRotationDotMatrix();
+   }
+
+   // Compute the body spin rate
+   bodySpinVector[0] = (-R(0,2) * Rdot(0,1)) - (R(1,2) * Rdot(1,1)) -
+         (R(2,2) * Rdot(2,1));
+   bodySpinVector[1] = ( R(0,2) * Rdot(0,0)) + (R(1,2) * Rdot(1,0)) +
+         (R(2,2) * Rdot(2,0));
+   bodySpinVector[2] = (-R(0,1) * Rdot(0,0)) - (R(1,1) * Rdot(1,0)) -
+         (R(2,1) * Rdot(2,0));
+   bodySpinRate = GmatMathUtil::Sqrt(bodySpinVector[0] * bodySpinVector[0] +
+                                     bodySpinVector[1] * bodySpinVector[1] +
+                                     bodySpinVector[2] * bodySpinVector[2]);
+   J1[0] = 0.0;
+   J1[1] = 0.0;
+   J1[2] = (2.0 / 5.0) * bodyRadius * bodyRadius * bodySpinRate;
+   bodyAngularMomentum[0] = R(0,0)*J1[0] + R(0,1)*J1[1] + R(0,2)*J1[2];
+   bodyAngularMomentum[1] = R(1,0)*J1[0] + R(1,1)*J1[1] + R(1,2)*J1[2];
+   bodyAngularMomentum[2] = R(2,0)*J1[0] + R(2,1)*J1[1] + R(2,2)*J1[2];
+
+   #ifdef DEBUG_RELATIVISTIC_CORRECTION
+      MessageInterface::ShowMessage("R    = %s\n", R.ToString().c_str());
+      MessageInterface::ShowMessage("Rdot = %s\n", Rdot.ToString().c_str());
+      MessageInterface::ShowMessage("J                      = %le   %le   "
+            "%le\n", bodyAngularMomentum[0], bodyAngularMomentum[1],
+            bodyAngularMomentum[2]);
+      MessageInterface::ShowMessage("bodySpinRate           = %le\n",
+            bodySpinRate);
+   #endif
+
+   termsEpoch       = when;
+   termsEpochGT     = whenGT;
+   termsFromContext = fromContext;
+   termsValid       = true;
+}
+
+
 //------------------------------------------------------------------------------
 //  void SetEopFile(EopFile *eopF)
 //------------------------------------------------------------------------------
@@ -725,6 +733,7 @@ Rvector6 RelativisticCorrection::GetDerivativesForSpacecraft(Spacecraft* sc)
 void RelativisticCorrection::SetEopFile(EopFile *eopF)
 {
    eop = eopF;
+   termsValid = false;
 }
 
 
@@ -769,11 +778,12 @@ std::string RelativisticCorrection::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer RelativisticCorrection::GetParameterID(const std::string &str) const
 {
-   for (Integer i = PhysicalModelParamCount; i < RelativisticCorrectionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, PhysicalModelParamCount,
+               RelativisticCorrectionParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return PhysicalModel::GetParameterID(str);
 }
 
@@ -39,6 +39,7 @@
 #include "CoordinateConverter.hpp"
 #include "A1Mjd.hpp"
 #include "Rvector6.hpp"
+#include "GmatTime.hpp"
 #include "gmatdefs.hpp"
 
 /**
@@ -57,6 +58,7 @@ public:
    virtual bool GetDerivatives(Real *state, Real dt = 0.0, Integer order = 1,
                                const Integer id = -1);
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
+   virtual void SetDerivativeContext(DerivativeContext *context);
 
    virtual void SetEopFile(EopFile *eopF);
 
@@ -112,6 +114,31 @@ protected:
 
    CoordinateConverter cc;
 
+   /// Slot of the Sun state in the derivative context, or -1 if not used
+   Integer          sunSlot;
+   /// Slot of the body state in the derivative context
+   Integer          bodySlot;
+   /// Slot of the inertial to body fixed rotation in the derivative context
+   Integer          rotationSlot;
+
+   /// Flag set when the central body is the Sun, so there is no geodesic term
+   bool             isSunCentered;
+   /// Geodesic precession vector at termsEpoch, shared by all spacecraft
+   Real             geodesicOmega[3];
+   /// Body angular momentum term at termsEpoch, shared by all spacecraft
+   Real             bodyAngularMomentum[3];
+   /// Epoch of the shared terms
+   Real             termsEpoch;
+   /// Precise epoch of the shared terms
+   GmatTime         termsEpochGT;
+   /// Flag indicating the shared terms were built for the ODEModel derivatives
+   bool             termsFromContext;
+   /// Flag indicating that the shared terms have been built
+   bool             termsValid;
+
+   void             ComputeEpochTerms(Real when, const GmatTime &whenGT,
+                                      bool fromContext);
+
 
 private:
 
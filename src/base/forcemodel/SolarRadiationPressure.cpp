@@ -62,6 +62,7 @@
 #include "GmatDefaults.hpp"
 #include "PropagationStateManager.hpp"
 #include "Plate.hpp"
+#include "DerivativeContext.hpp"
 
 //#define DEBUG_SRP_ORIGIN
 //#define DEBUG_SOLAR_RADIATION_PRESSURE
@@ -170,6 +171,8 @@ SolarRadiationPressure::SolarRadiationPressure(const std::string &name) :
    percentSun          (1.0),
    warnSRPMath         (true),
    bodyID              (-1),
+   sunSlot             (-1),
+   bodySlot            (-1),
    satCount            (0),
    massID              (-1),
    crID                (-1),
@@ -222,6 +225,8 @@ SolarRadiationPressure::SolarRadiationPressure(const SolarRadiationPressure &srp
    percentSun          (srp.percentSun),
    warnSRPMath         (srp.warnSRPMath),
    bodyID              (srp.bodyID),
+   sunSlot             (-1),
+   bodySlot            (-1),
    satCount            (srp.satCount),
    massID              (srp.massID),
    crID                (srp.crID),
@@ -275,6 +280,8 @@ SolarRadiationPressure& SolarRadiationPressure::operator=(const SolarRadiationPr
       percentSun   = srp.percentSun;
       warnSRPMath  = srp.warnSRPMath;
       bodyID       = srp.bodyID;
+      sunSlot      = -1;
+      bodySlot     = -1;
    
       satCount     = srp.satCount;
       massID       = srp.massID;
@@ -811,6 +818,27 @@ bool SolarRadiationPressure::SetCentralBody()
    return true;
 }
 
+//------------------------------------------------------------------------------
+// void SetDerivativeContext(DerivativeContext *context)
+//------------------------------------------------------------------------------
+/**
+ * Sets the shared epoch data, and registers the Sun and central body states
+ *
+ * @param context The context, or NULL to read the states from the bodies
+ */
+//------------------------------------------------------------------------------
+void SolarRadiationPressure::SetDerivativeContext(DerivativeContext *context)
+{
+   PhysicalModel::SetDerivativeContext(context);
+
+   sunSlot = bodySlot = -1;
+   if ((context != NULL) && (theSun != NULL) && (body != NULL))
+   {
+      sunSlot = context->AddBody(theSun);
+      bodySlot = context->AddBody(body);
+   }
+}
+
 //------------------------------------------------------------------------------
 // bool SolarRadiationPressure::GetDerivatives(Real *state,Real dt,Integer order)
 //------------------------------------------------------------------------------
@@ -877,13 +905,28 @@ bool SolarRadiationPressure::GetDerivatives(Real *state, Real dt, Integer order,
    bool inSunlight = true, inShadow = false;
 
    Real ep = epoch + (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
-   sunrv = theSun->GetState(ep);
+   if (sunSlot >= 0)
+   {
+      const Real *data = derivativeContext->GetBodyState(sunSlot, A1Mjd(ep));
+      for (Integer i = 0; i < 6; ++i)
+         sunrv[i] = data[i];
+   }
+   else
+      sunrv = theSun->GetState(ep);
    
    // Rvector6 is initialized to all 0.0's; only change it if the body is not 
    // the Sun
    if (!bodyIsTheSun)
    {
-      cbrv = body->GetState(ep);
+      if (bodySlot >= 0)
+      {
+         const Real *data = derivativeContext->GetBodyState(bodySlot,
+               A1Mjd(ep));
+         for (Integer i = 0; i < 6; ++i)
+            cbrv[i] = data[i];
+      }
+      else
+         cbrv = body->GetState(ep);
       cbSunVector[0] = sunrv[0] - cbrv[0];
       cbSunVector[1] = sunrv[1] - cbrv[1];
       cbSunVector[2] = sunrv[2] - cbrv[2];
@@ -918,6 +961,15 @@ bool SolarRadiationPressure::GetDerivatives(Real *state, Real dt, Integer order,
    
    if (fillCartesian)
    {
+      // Light the whole formation at once; the body is at the origin
+      if (!bodyIsTheSun && (satCount > 0))
+      {
+         Real origin[3] = {0.0, 0.0, 0.0};
+         satLighting.resize(satCount);
+         shadowState->FindShadowStates(satCount, &state[cartesianStart], 6, 1,
+               origin, &bodyRadius, cbSunVector, sunRadius, &satLighting[0]);
+      }
+
       for (Integer i = 0; i < satCount; ++i) 
       {
          #ifdef DEBUG_DERIVATIVE
@@ -953,9 +1005,6 @@ bool SolarRadiationPressure::GetDerivatives(Real *state, Real dt, Integer order,
             psunrad = asin(sunRadius / sunDistance);
             if (sunRadius < sunDistance)                                             // This change avoids ASIN() error
             {
-               std::string shModel = "DualCone";
-               if (shadowModel == CYLINDRICAL_MODEL) shModel = "Cylindrical";
-
                #ifdef DEBUG_SHADOW_STATE
                   MessageInterface::ShowMessage("before FSS, sunRadius= %12.10f, psunrad = %12.10f\n",
                      sunRadius, psunrad);
@@ -969,10 +1018,9 @@ bool SolarRadiationPressure::GetDerivatives(Real *state, Real dt, Integer order,
                      forceVector[0], forceVector[1], forceVector[2]);
                #endif
 
-               percentSun = shadowState->FindShadowState(inSunlight, inShadow,
-                     shModel, &state[i6], cbSunVector, sunSat, forceVector,
-                     sunRadius, bodyRadius, psunrad, appSunRad, appBodyRad,
-                     appDistFromSunToBody);
+               inSunlight = satLighting[i].lit;
+               inShadow   = satLighting[i].dark;
+               percentSun = satLighting[i].percentSun;
             }
             else
             {
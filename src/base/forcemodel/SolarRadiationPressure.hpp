@@ -94,6 +94,7 @@ public:
    virtual bool GetDerivatives(Real *state, Real dt = 0.0, Integer order = 1, 
                                const Integer id = -1);
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
+   virtual void SetDerivativeContext(DerivativeContext *context);
 
    // inherited from GmatBase
    virtual GmatBase* Clone() const;
@@ -176,6 +177,8 @@ protected:
    CelestialBody *theSun;
    /// Pointer to the ShadowState
    ShadowState   *shadowState;
+   /// Lighting of the spacecraft found for the current derivative
+   std::vector<ShadowState::Lighting> satLighting;
 
    /// Flag used to indicate using an analytic model to locate the Sun
    bool useAnalytic;
@@ -234,6 +237,10 @@ protected:
    
    Rvector6 sunrv;
    Rvector6 cbrv;
+   /// Slot of the Sun state in the derivative context, or -1 if not used
+   Integer sunSlot;
+   /// Slot of the central body state in the derivative context
+   Integer bodySlot;
 
    /// Number of spacecraft in the state vector that use CartesianState
    Integer              satCount;
@@ -29,7 +29,10 @@
  */
 //------------------------------------------------------------------------------
 #include <math.h>
+#include <atomic>
+#include <thread>
 #include "Harmonic.hpp"
+#include "HarmonicKernel.hpp"
 #include "ODEModelException.hpp"
 #include "MessageInterface.hpp"
 #include "RealUtilities.hpp"
@@ -37,7 +40,56 @@
 //------------------------------------------------------------------------------
 // static data
 //------------------------------------------------------------------------------
-bool Harmonic::matrixTruncationWasPosted = false;
+std::atomic<bool> Harmonic::matrixTruncationWasPosted(false);
+//------------------------------------------------------------------------------
+// HarmonicWorkspace
+//------------------------------------------------------------------------------
+HarmonicWorkspace::HarmonicWorkspace ()
+   : Size       (-1),
+     A          (NULL),
+     Re         (NULL),
+     Im         (NULL),
+     PackedA    (NULL),
+     TideLevel  (0),
+     UsePackedKernel (false),
+     BatchSize  (-1),
+     BatchA     (NULL),
+     BatchRe    (NULL),
+     BatchIm    (NULL),
+     BatchThreads (1)
+   {
+   ClearDeltaCS();
+   }
+//------------------------------------------------------------------------------
+HarmonicWorkspace::~HarmonicWorkspace()
+   {
+   if (Size >= 0)
+      {
+      Harmonic::DeallocateArray(A,Size,3);
+      Harmonic::DeallocateArray(Re,Size,3);
+      Harmonic::DeallocateArray(Im,Size,3);
+      }
+   if (PackedA != NULL)
+      delete[] PackedA;
+   if (BatchA != NULL)
+      delete[] BatchA;
+   if (BatchRe != NULL)
+      delete[] BatchRe;
+   if (BatchIm != NULL)
+      delete[] BatchIm;
+   for (UnsignedInt i=0;  i<Helpers.size();  ++i)
+      delete Helpers[i];
+   }
+//------------------------------------------------------------------------------
+void HarmonicWorkspace::ClearDeltaCS ()
+   {
+   for (Integer n=0;  n<=LoveMax;  ++n)
+      for (Integer m=0;  m<=LoveMax;  ++m)
+         {
+         DeltaC[n][m] = 0;
+         DeltaS[n][m] = 0;
+         }
+   }
 //------------------------------------------------------------------------------
 // public methods
 //------------------------------------------------------------------------------
@@ -48,17 +100,22 @@ Harmonic::Harmonic ()
      Factor     (0.0),
      C          (NULL),
      S          (NULL),
-     A          (NULL),
+     ADiag      (NULL),
      V          (NULL),
-     Re         (NULL),
-     Im         (NULL),
      N1         (NULL),
      N2         (NULL),
      VR01       (NULL),
      VR11       (NULL),
      VR02       (NULL),
      VR12       (NULL),
-     VR22       (NULL)
+     VR22       (NULL),
+     CP         (NULL),
+     SP         (NULL),
+     N1P        (NULL),
+     N2P        (NULL),
+     VR01P      (NULL),
+     VR11P      (NULL),
+     coefficientsPacked (false)
    {
       theTimeConverter = TimeSystemConverter::Instance();
    }
@@ -92,6 +149,283 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
    const Integer& nn, const Integer& mm, const bool& fillgradient,
    const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient) const
    {
+   CalculateField(jday,pos,nn,mm,fillgradient,gradientlimit,acc,gradient,
+         defaultWorkspace);
+   }
+//------------------------------------------------------------------------------
+// Sizes ws for this field and loads the position independent part of A.
+// Calling it up front is optional; CalculateField does it when needed.
+//------------------------------------------------------------------------------
+void Harmonic::PrepareWorkspace (HarmonicWorkspace& ws) const
+   {
+   if (ws.Size == NN)
+      return;
+   if (ws.Size >= 0)
+      {
+      DeallocateArray(ws.A,ws.Size,3);
+      DeallocateArray(ws.Re,ws.Size,3);
+      DeallocateArray(ws.Im,ws.Size,3);
+      delete[] ws.PackedA;
+      }
+   AllocateArray(ws.A,NN,3);
+   AllocateArray(ws.Re,NN,3);
+   AllocateArray(ws.Im,NN,3);
+   Integer packedSize = HarmonicKernel::PackedSize(NN+3);
+   ws.PackedA = new Real[packedSize];
+   for (Integer i=0;  i<packedSize;  ++i)
+      ws.PackedA[i] = 0.0;
+   for (Integer n=0;  n<=NN+2;  ++n)
+      {
+      ws.A[n][n] = ADiag[n];
+      ws.PackedA[HarmonicKernel::RowOffset(n)+n] = ADiag[n];
+      }
+   ws.Size = NN;
+   }
+//------------------------------------------------------------------------------
+// Batch counterpart of PrepareWorkspace, sizing the [n][m][k] block arrays
+//------------------------------------------------------------------------------
+void Harmonic::PrepareBatchWorkspace (HarmonicWorkspace& ws) const
+   {
+   if (ws.BatchSize == NN)
+      return;
+   const Integer B = HarmonicWorkspace::BATCH_BLOCK;
+   const Integer w = NN+3;
+   if (ws.BatchA != NULL)
+      delete[] ws.BatchA;
+   if (ws.BatchRe != NULL)
+      delete[] ws.BatchRe;
+   if (ws.BatchIm != NULL)
+      delete[] ws.BatchIm;
+   ws.BatchA  = new Real[w*w*B];
+   ws.BatchRe = new Real[w*B];
+   ws.BatchIm = new Real[w*B];
+   for (Integer i=0;  i<w*w*B;  ++i)
+      ws.BatchA[i] = 0.0;
+   for (Integer i=0;  i<w*B;  ++i)
+      ws.BatchRe[i] = ws.BatchIm[i] = 0.0;
+   for (Integer n=0;  n<=NN+2;  ++n)
+      for (Integer k=0;  k<B;  ++k)
+         ws.BatchA[(n*w+n)*B+k] = ADiag[n];
+   ws.BatchSize = NN;
+   }
+//------------------------------------------------------------------------------
+// Acceleration only evaluation of the field at count positions, given in
+// structure-of-arrays form.  Positions are processed in blocks of
+// HarmonicWorkspace::BATCH_BLOCK so that the coefficient lookups and the
+// recursion bookkeeping are shared, and the innermost loops run over the
+// positions of a block with unit stride.  Results match CalculateField.
+//
+// Large batches (ensembles at high degree) are shared out block by block
+// between ws.BatchThreads threads.  The coefficient tables are read-only and
+// shared by all of them; each extra thread works in its own helper
+// workspace, kept in ws so it is only sized once, with the tide corrections
+// of ws copied in.  Every position is evaluated by the same block code
+// whichever thread takes it, so the results do not depend on the threads.
+//------------------------------------------------------------------------------
+void Harmonic::CalculateFieldBatch (const Real& jday, const Integer& count,
+   const Real *px, const Real *py, const Real *pz,
+   const Integer& nn, const Integer& mm,
+   Real *ax, Real *ay, Real *az, HarmonicWorkspace& ws) const
+   {
+   PrepareBatchWorkspace(ws);
+   const Integer B = HarmonicWorkspace::BATCH_BLOCK;
+   const Integer blocks = (count+B-1)/B;
+   const Integer threadCount = GetBatchThreadCount(blocks,nn,ws);
+
+   std::atomic<Integer> next(0);
+   auto worker = [&](HarmonicWorkspace* lane)
+      {
+      for (Integer b=next++;  b<blocks;  b=next++)
+         {
+         Integer first = b*B;
+         Integer nk = (count-first < B) ? count-first : B;
+         CalculateFieldBlock(jday,nk,px+first,py+first,pz+first,nn,mm,
+               ax+first,ay+first,az+first,*lane);
+         }
+      };
+
+   std::vector<std::thread> threads;
+   for (Integer i=1;  i<threadCount;  ++i)
+      threads.push_back(std::thread(worker,ws.Helpers[i-1]));
+   worker(&ws);
+   for (UnsignedInt i=0;  i<threads.size();  ++i)
+      threads[i].join();
+   }
+//------------------------------------------------------------------------------
+// Number of threads CalculateFieldBatch uses for blocks blocks at degree nn,
+// preparing the helper workspaces they need.  Small batches stay on the
+// calling thread, where starting threads would cost more than it saves.
+//------------------------------------------------------------------------------
+Integer Harmonic::GetBatchThreadCount (const Integer& blocks,
+   const Integer& nn, HarmonicWorkspace& ws) const
+   {
+   Integer threadCount = ws.BatchThreads;
+   if (threadCount <= 0)
+      threadCount = (Integer)std::thread::hardware_concurrency();
+   Integer degree = (nn < NN ? nn : NN) + 1;
+   Integer maxThreads = (Integer)((long long)blocks*degree*degree /
+         HarmonicWorkspace::BATCH_THREAD_WORK);
+   if (threadCount > maxThreads)
+      threadCount = maxThreads;
+   if (threadCount > blocks)
+      threadCount = blocks;
+   if (threadCount <= 1)
+      return 1;
+
+   while ((Integer)ws.Helpers.size() < threadCount-1)
+      ws.Helpers.push_back(new HarmonicWorkspace());
+   for (Integer i=0;  i<threadCount-1;  ++i)
+      {
+      HarmonicWorkspace* lane = ws.Helpers[i];
+      PrepareBatchWorkspace(*lane);
+      lane->TideLevel = ws.TideLevel;
+      for (Integer n=0;  n<=LoveMax;  ++n)
+         for (Integer m=0;  m<=LoveMax;  ++m)
+            {
+            lane->DeltaC[n][m] = ws.DeltaC[n][m];
+            lane->DeltaS[n][m] = ws.DeltaS[n][m];
+            }
+      }
+   return threadCount;
+   }
+//------------------------------------------------------------------------------
+// Zonal (order 0) part of the field in closed form, for fields without
+// tesseral terms.  The zonal field is symmetric about the pole, so it depends
+// on the position only through r and u = pole.pos/r; pos and the unit pole
+// vector may be given in any frame, and the acceleration and gradient are
+// returned in that frame without a body fixed rotation.  With
+// Jn = C(n,0) V(n,0) (R/r)^n and the Legendre polynomials Pn, the sums
+//    A = sum (n+1) Jn Pn(u),   B = sum Jn Pn'(u)
+// give acc = -Factor/r^2 [-(A + uB) pos/r + B pole], and the gradient follows
+// from their r and u derivatives.  Tide corrections are not applied, and the
+// gradient includes the degrees up to gradientlimit, as in CalculateField.
+//------------------------------------------------------------------------------
+void Harmonic::CalculateZonalField (const Real& jday, const Real pos[3],
+   const Real pole[3], const Integer& nn, const bool& fillgradient,
+   const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient) const
+   {
+   Real r = sqrt(pos[0]*pos[0] + pos[1]*pos[1] + pos[2]*pos[2]);
+   Real u   = (pole[0]*pos[0] + pole[1]*pos[1] + pole[2]*pos[2]) / r;
+   Real rho = FieldRadius / r;
+
+   // Sums for the acceleration, and for the gradient the truncated sums,
+   // r times their r derivatives (Ar, Br) and their u derivatives (Au, Bu)
+   Real A  = 0, B  = 0;
+   Real AG = 0, BG = 0, Ar = 0, Br = 0, Au = 0, Bu = 0;
+   // P(n-2), P(n-1), P'(n-1) and P''(n-1)
+   Real p0 = 1, p1 = u, d1 = 1, s1 = 0;
+   Real rhon = rho;
+   for (Integer n=2;  n<=NN && n<=nn;  ++n)
+      {
+      Real pn = ((2*n-1)*u*p1 - (n-1)*p0) / n;
+      Real dn = n*p1 + u*d1;
+      Real sn = (n+1)*d1 + u*s1;
+      rhon *= rho;
+      Real jn = Cnm(jday,n,0) * V[n][0] * rhon;
+      A += (n+1) * jn * pn;
+      B +=         jn * dn;
+      if (fillgradient && (n <= gradientlimit))
+         {
+         AG += (n+1)   * jn * pn;
+         BG +=           jn * dn;
+         Ar -= n*(n+1) * jn * pn;
+         Br -= n       * jn * dn;
+         Au += (n+1)   * jn * dn;
+         Bu +=           jn * sn;
+         }
+      p0 = p1;
+      p1 = pn;
+      d1 = dn;
+      s1 = sn;
+      }
+
+   Real xhat[3] = {pos[0]/r, pos[1]/r, pos[2]/r};
+   Real mu_r_2 = -Factor / (r * r);   // Factor = -mu
+   for (Integer i=0;  i<=2;  ++i)
+      acc[i] = mu_r_2 * (-(A + u*B) * xhat[i] + B * pole[i]);
+
+   if (fillgradient)
+      {
+      Real mu_r_3 = mu_r_2 / r;
+      Real K   = AG + u*BG;
+      Real cxx = 3*K - Ar - u*Br;
+      Real cxq = -(Au + BG + u*Bu);
+      Real cpx = Br - 2*BG;
+      for (Integer i=0;  i<=2;  ++i)
+         for (Integer j=0;  j<=2;  ++j)
+            {
+            Real qj = pole[j] - u*xhat[j];
+            gradient(i,j) = mu_r_3 * (cxx*xhat[i]*xhat[j] + cxq*xhat[i]*qj +
+                  cpx*pole[i]*xhat[j] + Bu*pole[i]*qj);
+            if (i==j)
+               gradient(i,j) -= mu_r_3 * K;
+            }
+      }
+   }
+//------------------------------------------------------------------------------
+// Acceleration only evaluation for a cluster of positions, differential about
+// the first one (the chief).  The field and its gradient are evaluated at the
+// chief, and positions within radius of it get the chief acceleration plus
+// the gradient times their offset.  The error grows with the square of the
+// offset, so the radius bounds it; positions outside the radius are
+// evaluated in full.
+//------------------------------------------------------------------------------
+void Harmonic::CalculateFieldDifferential (const Real& jday,
+   const Integer& count, const Real *px, const Real *py, const Real *pz,
+   const Integer& nn, const Integer& mm, const Real& radius,
+   Real *ax, Real *ay, Real *az, HarmonicWorkspace& ws) const
+   {
+   if (count < 1)
+      return;
+   Real chief[3] = {px[0], py[0], pz[0]};
+   Real acc[3];
+   Rmatrix33 &gradient = ws.GradientHarmonic;
+   CalculateField(jday,chief,nn,mm,true,nn,acc,gradient,ws);
+   const Real *g = gradient.GetDataVector();
+   ax[0] = acc[0];
+   ay[0] = acc[1];
+   az[0] = acc[2];
+
+   Real radius2 = radius*radius;
+   for (Integer k=1;  k<count;  ++k)
+      {
+      Real d0 = px[k] - chief[0];
+      Real d1 = py[k] - chief[1];
+      Real d2 = pz[k] - chief[2];
+      if (d0*d0 + d1*d1 + d2*d2 <= radius2)
+         {
+         ax[k] = acc[0] + g[0]*d0 + g[1]*d1 + g[2]*d2;
+         ay[k] = acc[1] + g[3]*d0 + g[4]*d1 + g[5]*d2;
+         az[k] = acc[2] + g[6]*d0 + g[7]*d1 + g[8]*d2;
+         }
+      else
+         {
+         Real pos[3] = {px[k], py[k], pz[k]}, far[3];
+         CalculateField(jday,pos,nn,mm,false,0,far,ws.GradientPoint,ws);
+         ax[k] = far[0];
+         ay[k] = far[1];
+         az[k] = far[2];
+         }
+      }
+   }
+//------------------------------------------------------------------------------
+void Harmonic::CalculateField (const Real& jday, const Real pos[3], 
+   const Integer& nn, const Integer& mm, const bool& fillgradient,
+   const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient,
+   HarmonicWorkspace& ws) const
+   {
+   if (!fillgradient && coefficientsPacked && ws.UsePackedKernel)
+      {
+      CalculateFieldPacked(jday,pos,nn,mm,acc,ws);
+      return;
+      }
+
+   PrepareWorkspace(ws);
+   Real** A  = ws.A;
+   Real*  Re = ws.Re;
+   Real*  Im = ws.Im;
+   bool   tides = ws.TideLevel > 0;
+
    Integer XS = fillgradient ? 2 : 1;
    // calculate vector components ----------------------------------
    Real r = sqrt (pos[0]*pos[0] + pos[1]*pos[1] + pos[2]*pos[2]);    // Naming scheme from ref [3]
@@ -156,6 +490,11 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
          {
          Real Cval = Cnm (jday,n,m);
          Real Sval = Snm (jday,n,m);
+         if (tides && (n <= LoveMax) && (m <= LoveMax))
+            {
+            Cval += ws.DeltaC[n][m];
+            Sval += ws.DeltaS[n][m];
+            }
          // Pines Equation 27 (Part of)
          Real D =            (Cval*Re[m]   + Sval*Im[m]) * sqrt2;
          Real E = m==0 ? 0 : (Cval*Re[m-1] + Sval*Im[m-1]) * sqrt2;
@@ -199,13 +538,12 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
                }
             else
                {
-               if (matrixTruncationWasPosted == false)
+               if (!matrixTruncationWasPosted.exchange(true))
                   {
                   MessageInterface::ShowMessage("*** WARNING *** Gradient data "
                         "for the state transition matrix and A-matrix "
                         "computations are truncated at degree and order "
                         "<= %d.\n", gradientlimit);
-                  matrixTruncationWasPosted = true;
                   }
                }
             } 
@@ -260,14 +598,271 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
+// Acceleration only field using the packed degree-major tables.  The
+// recursion is run a row (degree) at a time so that the HarmonicKernel loops
+// run over contiguous orders.  Gradients use the Real** path above.
+//------------------------------------------------------------------------------
+void Harmonic::CalculateFieldPacked (const Real& jday, const Real pos[3],
+   const Integer& nn, const Integer& mm, Real acc[3],
+   HarmonicWorkspace& ws) const
+   {
+   PrepareWorkspace(ws);
+   Real* A  = ws.PackedA;
+   Real* Re = ws.Re;
+   Real* Im = ws.Im;
+   bool  tides = ws.TideLevel > 0;
+
+   Integer nmax = NN < nn ? NN : nn;
+   Integer mmax = MM < mm ? MM : mm;
+   if (mmax > nmax)
+      mmax = nmax;
+
+   Real r = sqrt (pos[0]*pos[0] + pos[1]*pos[1] + pos[2]*pos[2]);
+   Real s = pos[0]/r;
+   Real t = pos[1]/r;
+   Real u = pos[2]/r;
+
+   // Off-diagonal elements, then the recursion row by row
+   A[HarmonicKernel::RowOffset(1)] = u*sqrt(Real(3.0));
+   for (Integer n=1;  n<=nmax;  ++n)
+      A[HarmonicKernel::RowOffset(n+1)+n] = u*sqrt(Real(2*n+3))*ADiag[n];
+   for (Integer n=2;  n<=nmax+1;  ++n)
+      {
+      Integer count = (n-2 < mmax+1 ? n-2 : mmax+1) + 1;
+      Integer row = HarmonicKernel::RowOffset(n);
+      HarmonicKernel::FillRow(count,u,N1P+row,N2P+row,
+            A+HarmonicKernel::RowOffset(n-1),A+HarmonicKernel::RowOffset(n-2),
+            A+row);
+      }
+
+   // Ref.[3], Eq.(24)
+   Re[0] = 1;
+   Im[0] = 0;
+   for (Integer m=1;  m<=mmax;  ++m)
+      {
+      Re[m] = s*Re[m-1] - t*Im[m-1];
+      Im[m] = s*Im[m-1] + t*Re[m-1];
+      }
+
+   // Summation
+   Real rho = FieldRadius/r;
+   Real rho_np1 = -Factor/r * rho;
+   Real sqrt2 = sqrt (Real(2));
+   Real a1 = 0;
+   Real a2 = 0;
+   Real a3 = 0;
+   Real a4 = 0;
+   Real sums[4];
+   Real ctide[LoveMax+2];
+   Real stide[LoveMax+2];
+   for (Integer n=1;  n<=nmax;  ++n)
+      {
+      rho_np1 *= rho;
+      Integer count = (n < mmax ? n : mmax) + 1;
+      Integer row = HarmonicKernel::RowOffset(n);
+      const Real* c = CP+row;
+      const Real* sv = SP+row;
+      if (tides && (n <= LoveMax))
+         {
+         for (Integer m=0;  m<count;  ++m)
+            {
+            ctide[m] = c[m] + (m <= LoveMax ? ws.DeltaC[n][m] : 0.0);
+            stide[m] = sv[m] + (m <= LoveMax ? ws.DeltaS[n][m] : 0.0);
+            }
+         c = ctide;
+         sv = stide;
+         }
+      HarmonicKernel::SumRow(count,c,sv,Re,Im,A+row,
+            A+HarmonicKernel::RowOffset(n+1),VR01P+row,VR11P+row,sums);
+      Real rr = rho_np1/FieldRadius*sqrt2;
+      a1 += rr*sums[0];
+      a2 += rr*sums[1];
+      a3 += rr*sums[2];
+      a4 -= rr*sums[3];
+      }
+
+   // Pines Equation 31 
+   acc[0] = a1+a4*s;
+   acc[1] = a2+a4*t;
+   acc[2] = a3+a4*u;
+   }
+//------------------------------------------------------------------------------
+// Copies the loaded C and S into the packed tables used by
+// CalculateFieldPacked.  Derived classes call this once their coefficients
+// are in place; until then CalculateField uses the Real** path only.
+//------------------------------------------------------------------------------
+void Harmonic::PackCoefficients ()
+   {
+   if (CP == NULL)
+      return;
+   for (Integer n=0;  n<=NN;  ++n)
+      {
+      Integer row = HarmonicKernel::RowOffset(n);
+      for (Integer m=0;  m<=n;  ++m)
+         {
+         CP[row+m] = C[n][m];
+         SP[row+m] = S[n][m];
+         }
+      }
+   coefficientsPacked = true;
+   }
+//------------------------------------------------------------------------------
+// One block of CalculateFieldBatch.  Unused lanes (k >= nk) repeat the first
+// position so every inner loop has the fixed length BATCH_BLOCK.
+//------------------------------------------------------------------------------
+void Harmonic::CalculateFieldBlock (const Real& jday, const Integer& nk,
+   const Real *px, const Real *py, const Real *pz,
+   const Integer& nn, const Integer& mm,
+   Real *ax, Real *ay, Real *az, HarmonicWorkspace& ws) const
+   {
+   const Integer B = HarmonicWorkspace::BATCH_BLOCK;
+   const Integer w = NN+3;
+   Real* A  = ws.BatchA;
+   Real* Re = ws.BatchRe;
+   Real* Im = ws.BatchIm;
+   bool  tides = ws.TideLevel > 0;
+
+   Real r[B], s[B], t[B], u[B];
+   for (Integer k=0;  k<B;  ++k)
+      {
+      Integer src = k < nk ? k : 0;
+      r[k] = sqrt (px[src]*px[src] + py[src]*py[src] + pz[src]*pz[src]);
+      s[k] = px[src]/r[k];
+      t[k] = py[src]/r[k];
+      u[k] = pz[src]/r[k];
+      }
+
+   // Off-diagonal elements of A
+   Real sqrt3 = sqrt(Real(3.0));
+   for (Integer k=0;  k<B;  ++k)
+      A[w*B+k] = u[k]*sqrt3;
+   for (Integer n=1;  n<=NN+1 && n<=nn+1;  ++n)
+      {
+      Real f = sqrt(Real(2*n+3))*ADiag[n];
+      Real* an = A + ((n+1)*w+n)*B;
+      for (Integer k=0;  k<B;  ++k)
+         an[k] = u[k]*f;
+      }
+
+   // Column-fill recursion (Table 2, Row I, Ref.[1]) and Ref.[3], Eq.(24)
+   for (Integer m=0;  m<=MM+1 && m<=mm+1;  ++m)
+      {
+      for (Integer n=m+2;  n<=NN+1 && n<=nn+1;  ++n)
+         {
+         Real n1 = N1[n][m];
+         Real n2 = N2[n][m];
+         Real*       an  = A + (n*w+m)*B;
+         const Real* an1 = A + ((n-1)*w+m)*B;
+         const Real* an2 = A + ((n-2)*w+m)*B;
+         for (Integer k=0;  k<B;  ++k)
+            an[k] = u[k]*n1*an1[k] - n2*an2[k];
+         }
+      Real* re = Re + m*B;
+      Real* im = Im + m*B;
+      if (m == 0)
+         {
+         for (Integer k=0;  k<B;  ++k)
+            {
+            re[k] = 1.0;
+            im[k] = 0.0;
+            }
+         }
+      else
+         {
+         const Real* re1 = re - B;
+         const Real* im1 = im - B;
+         for (Integer k=0;  k<B;  ++k)
+            {
+            re[k] = s[k]*re1[k] - t[k]*im1[k];
+            im[k] = s[k]*im1[k] + t[k]*re1[k];
+            }
+         }
+      }
+
+   // Summation
+   Real rho[B], rho_np1[B];
+   Real a1[B], a2[B], a3[B], a4[B];
+   for (Integer k=0;  k<B;  ++k)
+      {
+      rho[k]     = FieldRadius/r[k];
+      rho_np1[k] = -Factor/r[k] * rho[k];
+      a1[k] = a2[k] = a3[k] = a4[k] = 0.0;
+      }
+   Real sqrt2 = sqrt (Real(2));
+   for (Integer n=1;  n<=NN && n<=nn;  ++n)
+      {
+      Real sum1[B], sum2[B], sum3[B], sum4[B];
+      for (Integer k=0;  k<B;  ++k)
+         {
+         rho_np1[k] *= rho[k];
+         sum1[k] = sum2[k] = sum3[k] = sum4[k] = 0.0;
+         }
+      for (Integer m=0;  m <= n && m<=MM && m<=mm;  ++m)
+         {
+         Real Cval = Cnm (jday,n,m);
+         Real Sval = Snm (jday,n,m);
+         if (tides && (n <= LoveMax) && (m <= LoveMax))
+            {
+            Cval += ws.DeltaC[n][m];
+            Sval += ws.DeltaS[n][m];
+            }
+         Real vr01 = VR01[n][m];
+         Real vr11 = VR11[n][m];
+         const Real* a00 = A + (n*w+m)*B;
+         const Real* a01 = A + (n*w+m+1)*B;
+         const Real* a11 = A + ((n+1)*w+m+1)*B;
+         const Real* re  = Re + m*B;
+         const Real* im  = Im + m*B;
+         if (m == 0)
+            {
+            for (Integer k=0;  k<B;  ++k)
+               {
+               Real D = (Cval*re[k] + Sval*im[k]) * sqrt2;
+               sum3[k] += vr01 * a01[k] * D;
+               sum4[k] += vr11 * a11[k] * D;
+               }
+            }
+         else
+            {
+            const Real* re1 = re - B;
+            const Real* im1 = im - B;
+            for (Integer k=0;  k<B;  ++k)
+               {
+               Real D = (Cval*re[k]  + Sval*im[k])  * sqrt2;
+               Real E = (Cval*re1[k] + Sval*im1[k]) * sqrt2;
+               Real F = (Sval*re1[k] - Cval*im1[k]) * sqrt2;
+               sum1[k] += m * a00[k] * E;
+               sum2[k] += m * a00[k] * F;
+               sum3[k] += vr01 * a01[k] * D;
+               sum4[k] += vr11 * a11[k] * D;
+               }
+            }
+         }
+      for (Integer k=0;  k<B;  ++k)
+         {
+         Real rr = rho_np1[k]/FieldRadius;
+         a1[k] += rr*sum1[k];
+         a2[k] += rr*sum2[k];
+         a3[k] += rr*sum3[k];
+         a4[k] -= rr*sum4[k];
+         }
+      }
+
+   // Pines Equation 31
+   for (Integer k=0;  k<nk;  ++k)
+      {
+      ax[k] = a1[k]+a4[k]*s[k];
+      ay[k] = a2[k]+a4[k]*t[k];
+      az[k] = a3[k]+a4[k]*u[k];
+      }
+   }
+//------------------------------------------------------------------------------
 void Harmonic::Allocate()
    {
    AllocateArray(C,NN,0);
    AllocateArray(S,NN,0);
-   AllocateArray(A,NN,3);
+   AllocateArray(ADiag,NN,3);
    AllocateArray(V,NN,3);
-   AllocateArray(Re,NN,3);
-   AllocateArray(Im,NN,3);
    AllocateArray(N1,NN,3);
    AllocateArray(N2,NN,3);
    AllocateArray(VR01,NN,0);
@@ -277,9 +872,9 @@ void Harmonic::Allocate()
    AllocateArray(VR22,NN,0);
 
    // initialize the diagonal elements (not a function of the input)
-   A[0][0] = 1.0;
+   ADiag[0] = 1.0;
    for (Integer n=1;  n<=NN+2;  ++n)
-      A[n][n] = sqrt (Real(2*n+1)/Real(2*n)) * A[n-1][n-1];
+      ADiag[n] = sqrt (Real(2*n+1)/Real(2*n)) * ADiag[n-1];
 
    // Compute normalization coefficients V(n,m)     V(0..degree,0..order)
    //   V(n,0) = sqrt (2n+1)
@@ -323,16 +918,41 @@ void Harmonic::Allocate()
                           Real((2*n-3)*(n+m)*(n-m)));
          }
       }
+
+   // Packed copies for the row kernels; entries past the last order of a
+   // row stay zero
+   Integer packedSize = HarmonicKernel::PackedSize(NN+3);
+   CP    = new Real[packedSize];
+   SP    = new Real[packedSize];
+   N1P   = new Real[packedSize];
+   N2P   = new Real[packedSize];
+   VR01P = new Real[packedSize];
+   VR11P = new Real[packedSize];
+   for (Integer i=0;  i<packedSize;  ++i)
+      CP[i] = SP[i] = N1P[i] = N2P[i] = VR01P[i] = VR11P[i] = 0.0;
+   for (Integer n=0;  n<=NN+2;  ++n)
+      {
+      Integer row = HarmonicKernel::RowOffset(n);
+      for (Integer m=0;  m<=n+1 && m<=NN+3;  ++m)
+         {
+         N1P[row+m] = N1[n][m];
+         N2P[row+m] = N2[n][m];
+         if (n <= NN && m <= n)
+            {
+            VR01P[row+m] = VR01[n][m];
+            VR11P[row+m] = VR11[n][m];
+            }
+         }
+      }
+   coefficientsPacked = false;
    }
 //------------------------------------------------------------------------------
 void Harmonic::Deallocate()
    {
    DeallocateArray(C,NN,0);
    DeallocateArray(S,NN,0);
-   DeallocateArray(A,NN,3);
+   DeallocateArray(ADiag,NN,3);
    DeallocateArray(V,NN,3);
-   DeallocateArray(Re,NN,3);
-   DeallocateArray(Im,NN,3);
    DeallocateArray(N1,NN,3);
    DeallocateArray(N2,NN,3);
    DeallocateArray(VR01,NN,0);
@@ -340,6 +960,13 @@ void Harmonic::Deallocate()
    DeallocateArray(VR02,NN,0);
    DeallocateArray(VR12,NN,0);
    DeallocateArray(VR22,NN,0);
+   DeallocateArray(CP,NN,0);
+   DeallocateArray(SP,NN,0);
+   DeallocateArray(N1P,NN,0);
+   DeallocateArray(N2P,NN,0);
+   DeallocateArray(VR01P,NN,0);
+   DeallocateArray(VR11P,NN,0);
+   coefficientsPacked = false;
    }
 //------------------------------------------------------------------------------
 void Harmonic::AllocateArray(Real**& a, const Integer& nn, const Integer& excess)
@@ -61,10 +61,63 @@
 #include "gmatdefs.hpp"
 #include "Rmatrix33.hpp"
 #include "TimeSystemConverter.hpp"   // for the TimeSystemConverter singleton
+#include <atomic>
+
+//------------------------------------------------------------------------------
+const Integer LoveMax = 4;
+//------------------------------------------------------------------------------
+/**
+ * Scratch storage used by Harmonic::CalculateField.
+ *
+ * The coefficient and normalization tables of a Harmonic are read-only once
+ * the field is loaded; everything written during a field evaluation lives in
+ * a workspace instead.  A single loaded field can therefore be evaluated from
+ * several threads at once, provided each caller owns its own workspace.
+ */
+class GMAT_API HarmonicWorkspace
+{
+public:
+   HarmonicWorkspace();
+private: // Copy protected
+   HarmonicWorkspace(const HarmonicWorkspace& x);
+   HarmonicWorkspace& operator=(const HarmonicWorkspace& x);
+public:
+   ~HarmonicWorkspace();
+
+   void ClearDeltaCS();
+
+   Integer     Size;      // Degree the arrays are sized for (-1 = none)
+   Real**      A;         // Normalized 'derived' Assoc. Legendre Poly
+   Real*       Re;        // powers of projection of pos onto x_ecf (re)
+   Real*       Im;        // powers of projection of pos onto y_ecf (im)
+   Real*       PackedA;   // A in packed degree-major form (HarmonicKernel)
+   Integer     TideLevel; // Tide level applied to DeltaC/DeltaS
+   /// Use the packed kernel for acceleration only calls.  Off by default: its
+   /// summation order, and so its round-off, depends on the instruction set
+   bool        UsePackedKernel;
+   Real        DeltaC[LoveMax+1][LoveMax+1];  // Tide corrections to C
+   Real        DeltaS[LoveMax+1][LoveMax+1];  // Tide corrections to S
+
+   /// Number of positions evaluated together by CalculateFieldBatch
+   static const Integer BATCH_BLOCK = 8;
+   Integer     BatchSize; // Degree the batch arrays are sized for (-1 = none)
+   Real*       BatchA;    // A for a block of positions, [n][m][k] order
+   Real*       BatchRe;   // Re for a block of positions, [m][k] order
+   Real*       BatchIm;   // Im for a block of positions, [m][k] order
+
+   /// Minimum blocks*(nn+1)^2 given to each CalculateFieldBatch thread
+   static const Integer BATCH_THREAD_WORK = 65536;
+   Integer     BatchThreads; // Threads for CalculateFieldBatch (0 = per core)
+   std::vector<HarmonicWorkspace*> Helpers; // Workspaces of the extra threads
+
+   Rmatrix33   GradientPoint;     // Point mass gradient (HarmonicGravity)
+   Rmatrix33   GradientHarmonic;  // Harmonic gradient (HarmonicGravity)
+};
 
 //------------------------------------------------------------------------------
 class GMAT_API Harmonic
 {
+   friend class HarmonicWorkspace;
 public:
    Harmonic();
 private: // Copy protected
@@ -84,6 +137,23 @@ public:
    void CalculateField(const Real& jday, const Real pos[3], 
        const Integer& nn, const Integer& mm, const bool& fillgradient, 
        const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient) const;
+   void CalculateField(const Real& jday, const Real pos[3], 
+       const Integer& nn, const Integer& mm, const bool& fillgradient, 
+       const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient,
+       HarmonicWorkspace& ws) const;
+   void CalculateFieldBatch(const Real& jday, const Integer& count,
+       const Real *px, const Real *py, const Real *pz,
+       const Integer& nn, const Integer& mm,
+       Real *ax, Real *ay, Real *az, HarmonicWorkspace& ws) const;
+   void CalculateFieldDifferential(const Real& jday, const Integer& count,
+       const Real *px, const Real *py, const Real *pz,
+       const Integer& nn, const Integer& mm, const Real& radius,
+       Real *ax, Real *ay, Real *az, HarmonicWorkspace& ws) const;
+   void CalculateZonalField(const Real& jday, const Real pos[3],
+       const Real pole[3], const Integer& nn, const bool& fillgradient,
+       const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient) const;
+   void PrepareWorkspace(HarmonicWorkspace& ws) const;
+   void PrepareBatchWorkspace(HarmonicWorkspace& ws) const;
 //--------------------------------------------------------------------
 protected:
    Integer     NN;      // Maximum value of n (Jn=J2,J3...)
@@ -92,10 +162,8 @@ protected:
    Real        Factor;  // Factor = 1 (magnetic) or -mu (gravity)
    Real**      C;       // Normalized harmonic coefficients
    Real**      S;       // Normalized harmonic coefficients
-   Real**      A;       // Normalized 'derived' Assoc. Legendre Poly
+   Real*       ADiag;   // Diagonal of A (independent of position)
    Real**      V;       // Normalization factor
-   Real*       Re;      // powers of projection of pos onto x_ecf (re)
-   Real*       Im;      // powers of projection of pos onto y_ecf (im)
    Real**      N1;      // Temporary
    Real**      N2;      // Temporary
    Real**      VR01;    // Temporary
@@ -103,14 +171,36 @@ protected:
    Real**      VR02;    // Temporary
    Real**      VR12;    // Temporary
    Real**      VR22;    // Temporary
-   /// Flag used to warn about truncating matrix calculations to 20x20 only once
-   static bool matrixTruncationWasPosted;
+   // Packed degree-major copies of the tables for the row kernels
+   Real*       CP;      // C, rows 0..NN
+   Real*       SP;      // S, rows 0..NN
+   Real*       N1P;     // N1, rows 0..NN+2
+   Real*       N2P;     // N2, rows 0..NN+2
+   Real*       VR01P;   // VR01, rows 0..NN
+   Real*       VR11P;   // VR11, rows 0..NN
+   /// Set once CP and SP hold the loaded coefficients
+   bool        coefficientsPacked;
+   /// Flag used to warn about truncating matrix calculations to 20x20 only
+   /// once; atomic, as CalculateField runs on several threads
+   static std::atomic<bool> matrixTruncationWasPosted;
+   /// Workspace used by the calls that do not supply their own
+   mutable HarmonicWorkspace defaultWorkspace;
 
    /// Time converter singleton
    TimeSystemConverter *theTimeConverter;
 protected:
    void Allocate();
    void Deallocate();
+   void CalculateFieldPacked(const Real& jday, const Real pos[3],
+       const Integer& nn, const Integer& mm, Real acc[3],
+       HarmonicWorkspace& ws) const;
+   void PackCoefficients();
+   void CalculateFieldBlock(const Real& jday, const Integer& nk,
+       const Real *px, const Real *py, const Real *pz,
+       const Integer& nn, const Integer& mm,
+       Real *ax, Real *ay, Real *az, HarmonicWorkspace& ws) const;
+   Integer GetBatchThreadCount(const Integer& blocks, const Integer& nn,
+       HarmonicWorkspace& ws) const;
 protected:
    static void AllocateArray (Real**& a,   
       const Integer& nn, const Integer& excess);
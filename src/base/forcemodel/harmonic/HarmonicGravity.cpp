@@ -37,6 +37,8 @@
 #include "RealUtilities.hpp"
 #include "TimeSystemConverter.hpp"
 #include "SolarSystem.hpp"
+#include "DataFileCache.hpp"
+#include <cstring>
 //------------------------------------------------------------------------------
 using namespace GmatMathUtil;
 //------------------------------------------------------------------------------
@@ -59,17 +61,21 @@ HarmonicValue::HarmonicValue (const Integer& n, const Integer& m,
 //------------------------------------------------------------------------------
 HarmonicGravity::HarmonicGravity 
   (const std::string& filename, const std::string& tideFilename, const Real& radius,
-   const Real& mukm, const std::string& bodyname, const bool& loadCoefficients)
+   const Real& mukm, const std::string& bodyname, const bool& loadCoefficients,
+   const Integer& maxDegree, const Integer& maxOrder)
    : Harmonic (),
      Filename (filename),
      TideFilename (tideFilename),
      BodyName (bodyname),
      ModelName (""),
+     FileNN (0),
+     FileMM (0),
+     MaxDegree (maxDegree),
+     MaxOrder (maxOrder),
      Normalized (true),
      HaveTideFree (true),
      HaveZeroTide (false),
      HaveLoveNumbers (false),
-     TideLevel (0),
      ZeroTideMax (0),
      ZeroTideValues (0)
    {
@@ -81,6 +87,7 @@ HarmonicGravity::HarmonicGravity
    FieldRadius = radius;
    Factor = -mukm;
    LM_Load (loadCoefficients);
+   PackCoefficients ();
    }
 //------------------------------------------------------------------------------
 HarmonicGravity::~HarmonicGravity()
@@ -102,6 +109,19 @@ std::string HarmonicGravity::GetBodyName()
    return BodyName;
    }
 //------------------------------------------------------------------------------
+// Degree and order on the gravity file; GetNN and GetMM give the extent
+// loaded, which is smaller when the model was built for a lower degree
+//------------------------------------------------------------------------------
+Integer HarmonicGravity::GetFileNN() const
+   {
+   return FileNN;
+   }
+//------------------------------------------------------------------------------
+Integer HarmonicGravity::GetFileMM() const
+   {
+   return FileMM;
+   }
+//------------------------------------------------------------------------------
 bool HarmonicGravity::HaveTideModel (const int& etide)
    {
    switch (etide) {
@@ -143,32 +163,18 @@ std::string HarmonicGravity::TideString()
 //------------------------------------------------------------------------------
 Real HarmonicGravity::Cnm (const Real& jday, const Integer& n, const Integer& m) const
    {
-   if ((n <= LoveMax) && (m <= LoveMax) && (TideLevel > 0))
-      {
-      return C[n][m] + DeltaC[n][m];
-      }
-   else
-      {
-      return C[n][m];
-      }
+   return C[n][m];
    }
 //------------------------------------------------------------------------------
 Real HarmonicGravity::Snm (const Real& jday, const Integer& n, const Integer& m) const
    {
-   if ((n <= LoveMax) && (m <= LoveMax) && (TideLevel > 0))
-      {
-      return S[n][m] + DeltaS[n][m];
-      }
-   else
-      {
-      return S[n][m];
-      }
+   return S[n][m];
    }
 //------------------------------------------------------------------------------
 void HarmonicGravity::CalculatePointField (const Real& jday, const Real pos[3],
    const Integer& nn, const Integer& mm,
    const bool& fillgradient, const Integer& gradientlimit,
-   Real  acc[3], Rmatrix33& gradient)
+   Real  acc[3], Rmatrix33& gradient) const
    {
    Real r = sqrt(pos[0]*pos[0] + pos[1]*pos[1] + pos[2]*pos[2]);
    if (r == 0)
@@ -202,32 +208,122 @@ void HarmonicGravity::CalculateFullField (const Real& jday, const Real pos[3],
    const bool& fillgradient, const Integer& gradientlimit, 
    Real acc[3], Rmatrix33& gradient)
    {
-   TideLevel = tidelevel;
-   ClearDeltaCS ();
-   if (tidelevel >= 2 && BodyName == GmatSolarSystemDefaults::EARTH_NAME)
-      IncrementEarthTide(jday,sunpos,sunmukm,otherpos,othermukm,xp,yp);
-   else if (tidelevel >= 1)
-      {
-      IncrementSolidTide (sunpos,sunmukm);
-      if (othermukm > 0)
-         IncrementSolidTide (otherpos,othermukm);
-      }
+   CalculateFullField(jday,pos,nn,mm,tidelevel,sunpos,sunmukm,otherpos,
+         othermukm,xp,yp,fillgradient,gradientlimit,acc,gradient,
+         defaultWorkspace);
+   }
+//------------------------------------------------------------------------------
+// Thread-safe form: all intermediate data is written to ws, so one
+// HarmonicGravity can be shared by callers that each own a workspace.
+//------------------------------------------------------------------------------
+void HarmonicGravity::CalculateFullField (const Real& jday, const Real pos[3],
+   const Integer& nn, const Integer& mm, const Integer& tidelevel, 
+   const Real sunpos[3], const Real& sunmukm, 
+   const Real otherpos[3], const Real& othermukm,
+   const Real &xp, const Real &yp, 
+   const bool& fillgradient, const Integer& gradientlimit, 
+   Real acc[3], Rmatrix33& gradient, HarmonicWorkspace& ws) const
+   {
+   SetTideCorrections(jday,tidelevel,sunpos,sunmukm,otherpos,othermukm,
+         xp,yp,ws);
    Real      accpoint[3];
    Real      accharmonic[3];
-   Rmatrix33 gradientpoint;
-   Rmatrix33 gradientharmonic;
+   // The gradients are kept in the workspace so no matrices are built here
+   Rmatrix33 &gradientpoint = ws.GradientPoint;
+   Rmatrix33 &gradientharmonic = ws.GradientHarmonic;
    CalculatePointField(jday,pos,nn,mm,fillgradient,gradientlimit,accpoint,gradientpoint);
-   CalculateField(jday,pos,nn,mm,fillgradient,gradientlimit,accharmonic,gradientharmonic);
+   CalculateField(jday,pos,nn,mm,fillgradient,gradientlimit,accharmonic,gradientharmonic,ws);
    for (Integer i=0;  i<=2;  ++i)
       acc[i] = accpoint[i] + accharmonic[i];
    if (fillgradient)
-      gradient = gradientpoint + gradientharmonic;
+      for (Integer i=0;  i<=2;  ++i)
+         for (Integer j=0;  j<=2;  ++j)
+            gradient(i,j) = gradientpoint(i,j) + gradientharmonic(i,j);
    #ifdef DEBUG_GRADIENT
       MessageInterface::ShowMessage("In CalFullField, fillgradient = %s\n", (fillgradient? "true" : "false"));
       MessageInterface::ShowMessage("gradient = %s\n", gradient.ToString().c_str());
    #endif
    }
 //------------------------------------------------------------------------------
+// Acceleration only field (point mass plus harmonics) at count positions in
+// structure-of-arrays form.  The tide corrections are computed once for the
+// whole set, as they only depend on the epoch and the perturbing bodies.
+//------------------------------------------------------------------------------
+void HarmonicGravity::CalculateFullFieldBatch (const Real& jday,
+   const Integer& count, const Real *px, const Real *py, const Real *pz,
+   const Integer& nn, const Integer& mm, const Integer& tidelevel, 
+   const Real sunpos[3], const Real& sunmukm, 
+   const Real otherpos[3], const Real& othermukm,
+   const Real &xp, const Real &yp, 
+   Real *ax, Real *ay, Real *az, HarmonicWorkspace& ws) const
+   {
+   SetTideCorrections(jday,tidelevel,sunpos,sunmukm,otherpos,othermukm,
+         xp,yp,ws);
+   CalculateFieldBatch(jday,count,px,py,pz,nn,mm,ax,ay,az,ws);
+   for (Integer k=0;  k<count;  ++k)
+      {
+      Real r = sqrt(px[k]*px[k] + py[k]*py[k] + pz[k]*pz[k]);
+      if (r == 0)
+         r = 0.01;
+      Real mu_r_3 = (-Factor) / (r * r * r);   // Factor = -mu
+      ax[k] -= mu_r_3 * px[k];
+      ay[k] -= mu_r_3 * py[k];
+      az[k] -= mu_r_3 * pz[k];
+      }
+   }
+//------------------------------------------------------------------------------
+// Acceleration only field for a cluster of positions about the first one.
+// The harmonic part is linearized about the first position (see
+// Harmonic::CalculateFieldDifferential) while the point mass term, which
+// dominates the second order error, is evaluated at every position.
+//------------------------------------------------------------------------------
+void HarmonicGravity::CalculateFullFieldDifferential (const Real& jday,
+   const Integer& count, const Real *px, const Real *py, const Real *pz,
+   const Integer& nn, const Integer& mm, const Integer& tidelevel, 
+   const Real sunpos[3], const Real& sunmukm, 
+   const Real otherpos[3], const Real& othermukm,
+   const Real &xp, const Real &yp, const Real& radius,
+   Real *ax, Real *ay, Real *az, HarmonicWorkspace& ws) const
+   {
+   SetTideCorrections(jday,tidelevel,sunpos,sunmukm,otherpos,othermukm,
+         xp,yp,ws);
+   CalculateFieldDifferential(jday,count,px,py,pz,nn,mm,radius,ax,ay,az,ws);
+   for (Integer k=0;  k<count;  ++k)
+      {
+      Real r = sqrt(px[k]*px[k] + py[k]*py[k] + pz[k]*pz[k]);
+      if (r == 0)
+         r = 0.01;
+      Real mu_r_3 = (-Factor) / (r * r * r);   // Factor = -mu
+      ax[k] -= mu_r_3 * px[k];
+      ay[k] -= mu_r_3 * py[k];
+      az[k] -= mu_r_3 * pz[k];
+      }
+   }
+//------------------------------------------------------------------------------
+// Point mass plus the closed form zonal field (see Harmonic::
+// CalculateZonalField), for fields without tesseral terms or tides.  Both
+// parts are symmetric about the pole, so pos, pole and the results may be in
+// any frame.
+//------------------------------------------------------------------------------
+void HarmonicGravity::CalculateFullZonalField (const Real& jday,
+   const Real pos[3], const Real pole[3], const Integer& nn,
+   const bool& fillgradient, const Integer& gradientlimit,
+   Real acc[3], Rmatrix33& gradient, HarmonicWorkspace& ws) const
+   {
+   Real      accpoint[3];
+   Real      acczonal[3];
+   Rmatrix33 &gradientpoint = ws.GradientPoint;
+   Rmatrix33 &gradientzonal = ws.GradientHarmonic;
+   CalculatePointField(jday,pos,nn,0,fillgradient,gradientlimit,accpoint,gradientpoint);
+   CalculateZonalField(jday,pos,pole,nn,fillgradient,gradientlimit,acczonal,gradientzonal);
+   for (Integer i=0;  i<=2;  ++i)
+      acc[i] = accpoint[i] + acczonal[i];
+   if (fillgradient)
+      for (Integer i=0;  i<=2;  ++i)
+         for (Integer j=0;  j<=2;  ++j)
+            gradient(i,j) = gradientpoint(i,j) + gradientzonal(i,j);
+   }
+//------------------------------------------------------------------------------
 void HarmonicGravity::AddZeroTide (const Integer& n, const Integer& m, 
    const Real& c, const Real& s)
    {
@@ -414,17 +510,25 @@ static void PolarToLegendre(const Real polar[3], Real P[5][5])
       }
    }
 //------------------------------------------------------------------------------
-void HarmonicGravity::ClearDeltaCS ()
+void HarmonicGravity::SetTideCorrections (const Real &jday,
+   const Integer& tidelevel, const Real sunpos[3], const Real& sunmukm, 
+   const Real otherpos[3], const Real& othermukm,
+   const Real &xp, const Real &yp, HarmonicWorkspace& ws) const
    {
-   for (int n=0;  n<=LoveMax;  ++n)
-      for (int m=0;  m<=LoveMax;  ++m)
-         {
-         DeltaC[n][m] = 0;
-         DeltaS[n][m] = 0;
-         }
+   ws.TideLevel = tidelevel;
+   ws.ClearDeltaCS ();
+   if (tidelevel >= 2 && BodyName == GmatSolarSystemDefaults::EARTH_NAME)
+      IncrementEarthTide(jday,sunpos,sunmukm,otherpos,othermukm,xp,yp,ws);
+   else if (tidelevel >= 1)
+      {
+      IncrementSolidTide (sunpos,sunmukm,ws);
+      if (othermukm > 0)
+         IncrementSolidTide (otherpos,othermukm,ws);
+      }
    }
 //------------------------------------------------------------------------------
-void HarmonicGravity::IncrementSolidTide (const Real pos[3], const Real& mukm)
+void HarmonicGravity::IncrementSolidTide (const Real pos[3], const Real& mukm,
+   HarmonicWorkspace& ws) const
    {
    Real massratio    = -mukm/Factor;      // factor is minus body mukm
    Real polar[3];    // R,Latitude,Longitude (Radians)
@@ -438,12 +542,12 @@ void HarmonicGravity::IncrementSolidTide (const Real pos[3], const Real& mukm)
       for (Integer m=0;  m<=n;  ++m)  // should this be m <= 2????
          {
          Real f  = massratio*Pow(FieldRadius/polar[0],n+1)*poly[n][m];
-         DeltaC[n][m] += K[n][m]/(2*n+1) * (f*Cos(m*polar[2]));
-         DeltaS[n][m] += K[n][m]/(2*n+1) * (f*Sin(m*polar[2]));
+         ws.DeltaC[n][m] += K[n][m]/(2*n+1) * (f*Cos(m*polar[2]));
+         ws.DeltaS[n][m] += K[n][m]/(2*n+1) * (f*Sin(m*polar[2]));
          if (n==2)
             {
-            DeltaC[4][m] += KPlus[m]/(2*n+1) * (f*Cos(m*polar[2]));
-            DeltaS[4][m] += KPlus[m]/(2*n+1) * (f*Sin(m*polar[2]));
+            ws.DeltaC[4][m] += KPlus[m]/(2*n+1) * (f*Cos(m*polar[2]));
+            ws.DeltaS[4][m] += KPlus[m]/(2*n+1) * (f*Sin(m*polar[2]));
             }
          }
    }
@@ -451,7 +555,7 @@ void HarmonicGravity::IncrementSolidTide (const Real pos[3], const Real& mukm)
 void HarmonicGravity::IncrementEarthTide (const Real& jday, 
    const Real sunpos[3], const Real& sunmukm, 
    const Real otherpos[3], const Real& othermukm,
-   const Real &xp, const Real &yp)
+   const Real &xp, const Real &yp, HarmonicWorkspace& ws) const
 
    {
    // Solid Earth Tide Model
@@ -477,8 +581,8 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
    // table_63b = data from TechNote 32, p.66
    // table_63c = data from TechNote 32, p.66
 
-   IncrementSolidTide (sunpos,sunmukm);
-   IncrementSolidTide (otherpos,othermukm);
+   IncrementSolidTide (sunpos,sunmukm,ws);
+   IncrementSolidTide (otherpos,othermukm,ws);
    // IERS Step 3 (correct for permanent tide if needed, IERS p.66)
    // This has been moved to model setup, and correction to TideFree coefficients
    
@@ -527,7 +631,7 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
       theta_f = -theta_f * GmatMathConstants::RAD_PER_DEG; // radians
       freq_dep_C20 += (Table63b[f][5]*Cos(theta_f)-Table63b[f][6]*Sin(theta_f)); // eqn 5a
       }
-   DeltaC[2][0] += freq_dep_C20 * 1e-12;
+   ws.DeltaC[2][0] += freq_dep_C20 * 1e-12;
 
    // compute (2,1) freq dependent terms, IERS eqn 5b, p.60, (n=2,m=1)
    Real freq_dep_C21 = 0;
@@ -543,8 +647,8 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
       freq_dep_C21 += Table63a[f][5]*Sin(theta_f)+Table63a[f][6]*Cos(theta_f); // eqn 5b
       freq_dep_S21 += Table63a[f][5]*Cos(theta_f)-Table63a[f][6]*Sin(theta_f); // eqn 5b
       }
-   DeltaC[2][1] += freq_dep_C21 * 1e-12;
-   DeltaS[2][1] += freq_dep_S21 * 1e-12;
+   ws.DeltaC[2][1] += freq_dep_C21 * 1e-12;
+   ws.DeltaS[2][1] += freq_dep_S21 * 1e-12;
 
    // compute (2,2) freq dependent terms, IERS eqn 5b, p.60, (n=2,m=2)
    Real freq_dep_C22 = 0;
@@ -561,8 +665,8 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
       freq_dep_S22 += (-Table63c[f][5]*Sin(theta_f));
       }
 
-   DeltaC[2][2] += freq_dep_C22 * 1e-12;
-   DeltaS[2][2] += freq_dep_S22 * 1e-12;
+   ws.DeltaC[2][2] += freq_dep_C22 * 1e-12;
+   ws.DeltaS[2][2] += freq_dep_S22 * 1e-12;
 
    // solid earth pole tide, IERS p.65
    // Commented out unless we have xp and yp data
@@ -574,12 +678,12 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
    Real m1 =   xp-xp_bar;
    Real m2 = -(yp-yp_bar);
 
-   DeltaC[2][1] -= 1.333E-09*(m1+0.0115*m2);
-   DeltaS[2][1] -= 1.333E-09*(m2-0.0115*m1);
+   ws.DeltaC[2][1] -= 1.333E-09*(m1+0.0115*m2);
+   ws.DeltaS[2][1] -= 1.333E-09*(m2-0.0115*m1);
 
    // ocean pole tide (TechNote 32 working version, section 6.3, p.10)
-   DeltaC[2][1] -= 2.2344E-10*(m1-0.01737*m2);
-   DeltaS[2][1] -= 1.7680E-10*(m2-0.03351*m1);
+   ws.DeltaC[2][1] -= 2.2344E-10*(m1-0.01737*m2);
+   ws.DeltaS[2][1] -= 1.7680E-10*(m2-0.03351*m1);
 
    #ifdef DEBUG_TIDE
       MessageInterface::ShowMessage("Tide coefficients:\n");
@@ -715,14 +819,163 @@ void HarmonicGravity::LM_SetDefaultEarthTide ()
       }
    }
 //------------------------------------------------------------------------------
+// Loads the model from its cache entry when there is one.  Otherwise the
+// files are parsed in full, the result shared for later loads, and the model
+// then cut to the requested degree and order from the shared entry.
+//------------------------------------------------------------------------------
 void HarmonicGravity::LM_Load (const bool& loadcoefficients)
    {
+   if (loadcoefficients && LM_LoadCached (
+         DataFileCache::Find (LM_CacheFiles (),LM_CacheFormat ())))
+      return;
    LM_Load (Filename,loadcoefficients);
    if (TideFilename.find(".tide") != std::string::npos)
    {
        LM_LoadTide(TideFilename, loadcoefficients);
    }
    LM_SetDefaultEarthTide ();
+   FileNN = NN;
+   FileMM = MM;
+   if (loadcoefficients)
+      {
+      LM_ShareCached ();
+      if (LoadedFile && ((MaxDegree >= 0 && MaxDegree < NN) ||
+                         (MaxOrder >= 0 && MaxOrder < MM)))
+         {
+         Deallocate ();
+         LM_LoadCached (LoadedFile);
+         }
+      }
+   }
+//------------------------------------------------------------------------------
+// The gravity and tide files a loaded model depends on, the key of its cache
+// entry
+//------------------------------------------------------------------------------
+StringArray HarmonicGravity::LM_CacheFiles () const
+   {
+   StringArray files (1,Filename);
+   if (TideFilename.find(".tide") != std::string::npos)
+      files.push_back (TideFilename);
+   return files;
+   }
+//------------------------------------------------------------------------------
+// Format of the cache entry.  It names the coefficient layout, so entries
+// written with the older square tables are not found, and the body, since
+// the Earth tide defaults depend on it.
+//------------------------------------------------------------------------------
+std::string HarmonicGravity::LM_CacheFormat () const
+   {
+   return "HarmonicGravity|Triangular|" + BodyName;
+   }
+//------------------------------------------------------------------------------
+// Restores the loaded model from a DataFileCache entry written by
+// LM_ShareCached, in place of parsing the files.
+//
+// C and S are stored as packed triangles, row n starting at n(n+1)/2, so the
+// coefficients through degree D are the first (D+1)(D+2)/2 values of each
+// table.  Only that prefix is copied; from a mapped cache file the pages of
+// the higher degrees are never read.  The model is never cut below degree 1,
+// as an NN of 0 marks a file that could not be read.
+//------------------------------------------------------------------------------
+bool HarmonicGravity::LM_LoadCached
+  (const std::shared_ptr<const DataFileCache>& cached)
+   {
+   if (!cached)
+      return false;
+   const Real* scalars = cached->GetTable ("Scalars");
+   if (cached->GetTableSize ("Scalars") != 9 || scalars[0] < 1)
+      return false;
+   Integer fileNN = (Integer)scalars[0];
+   Integer fileMM = (Integer)scalars[1];
+   Integer triangle = (fileNN+1)*(fileNN+2)/2;
+   Integer zeroTideSize = cached->GetTableSize ("ZeroTide");
+   if (fileMM < 0 || fileMM > fileNN ||
+       cached->GetTableSize ("C") != triangle ||
+       cached->GetTableSize ("S") != triangle ||
+       cached->GetTableSize ("K") != (LoveMax+1)*(LoveMax+1) ||
+       cached->GetTableSize ("KPlus") != LoveMax+1 ||
+       zeroTideSize < 0 || zeroTideSize % 4 != 0)
+      return false;
+
+   FileNN          = fileNN;
+   FileMM          = fileMM;
+   NN              = fileNN;
+   if (MaxDegree >= 0 && MaxDegree < NN)
+      NN = (MaxDegree > 1 ? MaxDegree : 1);
+   MM              = (fileMM < NN ? fileMM : NN);
+   if (MaxOrder >= 0 && MaxOrder < MM)
+      MM = MaxOrder;
+   Factor          = scalars[2];
+   FieldRadius     = scalars[3];
+   Normalized      = scalars[4] != 0;
+   HaveZeroTide    = scalars[5] != 0;
+   HaveTideFree    = scalars[6] != 0;
+   HaveLoveNumbers = scalars[7] != 0;
+   ZeroTideMax     = (Integer)scalars[8];
+   ModelName       = cached->GetText ("ModelName");
+
+   Allocate ();
+   const Real* cc = cached->GetTable ("C");
+   const Real* ss = cached->GetTable ("S");
+   for (Integer n=0;  n<=NN;  ++n)
+      {
+      Integer row = n*(n+1)/2;
+      Integer count = (n < MM ? n : MM) + 1;
+      memcpy (C[n],cc+row,count*sizeof(Real));
+      memcpy (S[n],ss+row,count*sizeof(Real));
+      }
+   const Real* kk = cached->GetTable ("K");
+   for (Integer n=0;  n<=LoveMax;  ++n)
+      for (Integer m=0;  m<=LoveMax;  ++m)
+         K[n][m] = kk[n*(LoveMax+1)+m];
+   const Real* kplus = cached->GetTable ("KPlus");
+   for (Integer m=0;  m<=LoveMax;  ++m)
+      KPlus[m] = kplus[m];
+   const Real* zt = cached->GetTable ("ZeroTide");
+   ZeroTideValues.clear ();
+   for (Integer i=0;  i<zeroTideSize;  i+=4)
+      ZeroTideValues.push_back (HarmonicValue ((Integer)zt[i],(Integer)zt[i+1],
+         zt[i+2],zt[i+3]));
+
+   LoadedFile = cached;
+   return true;
+   }
+//------------------------------------------------------------------------------
+// Stores the loaded model in a DataFileCache entry, so later models of the
+// same files in this process, and in other processes when DATA_CACHE_PATH is
+// set, skip the parsing.  The entry always holds the full file.
+//------------------------------------------------------------------------------
+void HarmonicGravity::LM_ShareCached ()
+   {
+   if (NN < 1 || C == NULL)
+      return;
+   DataFileCache* entry = new DataFileCache ();
+   Real scalars[9] = { Real(NN), Real(MM), Factor, FieldRadius,
+      Real(Normalized), Real(HaveZeroTide), Real(HaveTideFree),
+      Real(HaveLoveNumbers), Real(ZeroTideMax) };
+   entry->AddTable ("Scalars",scalars,9);
+   RealArray cc ((NN+1)*(NN+2)/2), ss (cc.size());
+   for (Integer n=0;  n<=NN;  ++n)
+      {
+      Integer row = n*(n+1)/2;
+      memcpy (&cc[row],C[n],(n+1)*sizeof(Real));
+      memcpy (&ss[row],S[n],(n+1)*sizeof(Real));
+      }
+   entry->AddTable ("C",&cc[0],cc.size());
+   entry->AddTable ("S",&ss[0],ss.size());
+   entry->AddTable ("K",&K[0][0],(LoveMax+1)*(LoveMax+1));
+   entry->AddTable ("KPlus",KPlus,LoveMax+1);
+   RealArray zt;
+   for (UnsignedInt i=0;  i<ZeroTideValues.size();  ++i)
+      {
+      zt.push_back (ZeroTideValues[i].N);
+      zt.push_back (ZeroTideValues[i].M);
+      zt.push_back (ZeroTideValues[i].C);
+      zt.push_back (ZeroTideValues[i].S);
+      }
+   entry->AddTable ("ZeroTide",zt.empty() ? NULL : &zt[0],zt.size());
+   entry->SetText ("ModelName",ModelName);
+   LoadedFile = DataFileCache::Share (LM_CacheFiles (),LM_CacheFormat (),entry);
    }
 //------------------------------------------------------------------------------
 void HarmonicGravity::LM_Load (std::string& filename, const bool& loadcoefficients)
@@ -34,8 +34,9 @@
 #include "gmatdefs.hpp"
 #include "Harmonic.hpp"
 #include "Rmatrix33.hpp"
+#include <memory>
 //------------------------------------------------------------------------------
-const Integer LoveMax = 4;
+class DataFileCache;
 //------------------------------------------------------------------------------
 class GMAT_API HarmonicValue {
 public:
@@ -53,7 +54,8 @@ class GMAT_API HarmonicGravity : public Harmonic {
 public:
    HarmonicGravity 
      (const std::string& filename, const std::string& tideFilename, const Real& radius,
-      const Real& mukm, const std::string& bodyname, const bool& loadCoefficients);
+      const Real& mukm, const std::string& bodyname, const bool& loadCoefficients,
+      const Integer& maxDegree = -1, const Integer& maxOrder = -1);
 private: // Copy protected
    HarmonicGravity (const HarmonicGravity& hg);
    HarmonicGravity& operator=(const HarmonicGravity& hg);
@@ -63,6 +65,8 @@ public:
    std::string GetFilename();
    std::string GetTideFilename();
    std::string GetBodyName();
+   Integer GetFileNN() const;
+   Integer GetFileMM() const;
    bool HaveTideModel (const int& etide);
    bool IsTideFree();
    bool IsZeroTide();
@@ -72,7 +76,7 @@ public:
    void CalculatePointField(const Real& jday, const Real pos[3],
       const Integer& nn, const Integer& mm,
       const bool& fillgradient,  const Integer& gradientlimit,
-      Real  acc[3], Rmatrix33& gradient);
+      Real  acc[3], Rmatrix33& gradient) const;
    void CalculateFullField(const Real& jday, const Real pos[3],
       const Integer& nn, const Integer& mm, const Integer& tidelevel, 
       const Real sunpos[3], const Real& sunmukm, 
@@ -80,6 +84,31 @@ public:
       const Real &xp, const Real &yp,
       const bool& fillgradient,  const Integer& gradientlimit,
       Real acc[3], Rmatrix33& gradient);
+   void CalculateFullField(const Real& jday, const Real pos[3],
+      const Integer& nn, const Integer& mm, const Integer& tidelevel, 
+      const Real sunpos[3], const Real& sunmukm, 
+      const Real otherpos[3], const Real& othermukm,
+      const Real &xp, const Real &yp,
+      const bool& fillgradient,  const Integer& gradientlimit,
+      Real acc[3], Rmatrix33& gradient, HarmonicWorkspace& ws) const;
+   void CalculateFullFieldBatch(const Real& jday, const Integer& count,
+      const Real *px, const Real *py, const Real *pz,
+      const Integer& nn, const Integer& mm, const Integer& tidelevel, 
+      const Real sunpos[3], const Real& sunmukm, 
+      const Real otherpos[3], const Real& othermukm,
+      const Real &xp, const Real &yp,
+      Real *ax, Real *ay, Real *az, HarmonicWorkspace& ws) const;
+   void CalculateFullFieldDifferential(const Real& jday,
+      const Integer& count, const Real *px, const Real *py, const Real *pz,
+      const Integer& nn, const Integer& mm, const Integer& tidelevel, 
+      const Real sunpos[3], const Real& sunmukm, 
+      const Real otherpos[3], const Real& othermukm,
+      const Real &xp, const Real &yp, const Real& radius,
+      Real *ax, Real *ay, Real *az, HarmonicWorkspace& ws) const;
+   void CalculateFullZonalField(const Real& jday, const Real pos[3],
+      const Real pole[3], const Integer& nn,
+      const bool& fillgradient,  const Integer& gradientlimit,
+      Real acc[3], Rmatrix33& gradient, HarmonicWorkspace& ws) const;
 
    void AddZeroTide (const Integer& n, const Integer& m, 
       const Real& c, const Real& s);
@@ -94,11 +123,16 @@ private:
    std::string TideFilename;
    std::string BodyName;
    std::string ModelName;
+   // Degree and order on file; NN and MM are the loaded (truncated) extent
+   Integer FileNN;
+   Integer FileMM;
+   // Requested degree and order to load, or -1 for all on file
+   Integer MaxDegree;
+   Integer MaxOrder;
    bool Normalized;
    bool HaveZeroTide;         // In C,s
    bool HaveTideFree;         // In CTideFree,STideFree
    bool HaveLoveNumbers;      // In K,KPlus
-   Integer TideLevel;   // Temporary during full field call
 
    // Tide Free coefficients
    Integer  ZeroTideMax;
@@ -106,17 +140,21 @@ private:
    // Love Numbers
    Real   K[LoveMax+1][LoveMax+1];   
    Real   KPlus[LoveMax+1];
-   // Variable Coefficients (Temporary)
-   Real   DeltaC[LoveMax+1][LoveMax+1];  // Temporary during full field call
-   Real   DeltaS[LoveMax+1][LoveMax+1];  // Temporary during full field call
+   // Variable coefficients (DeltaC, DeltaS) live in the HarmonicWorkspace
+   // Parsed file contents, held so other models of the same file reuse them
+   std::shared_ptr<const DataFileCache> LoadedFile;
 
    // Methods useful in Tide computations
-   void ClearDeltaCS ();
-   void IncrementSolidTide (const Real pos[3], const Real& mukm);
+   void SetTideCorrections (const Real &jday, const Integer& tidelevel,
+      const Real sunpos[3], const Real& sunmukm, 
+      const Real otherpos[3], const Real& othermukm,
+      const Real &xp, const Real &yp, HarmonicWorkspace& ws) const;
+   void IncrementSolidTide (const Real pos[3], const Real& mukm,
+      HarmonicWorkspace& ws) const;
    void IncrementEarthTide (const Real &jday, 
       const Real sunpos[3], const Real& sunmukm, 
       const Real otherpos[3], const Real& othermukm,
-      const Real &xp, const Real &yp);
+      const Real &xp, const Real &yp, HarmonicWorkspace& ws) const;
    // Load Module
    void LM_Error (const std::string& error);
    void LM_TideError (const std::string& error);
@@ -137,6 +175,10 @@ private:
    void LM_LoadGrv (std::ifstream& instream, const bool& loadcoefficients);
    void LM_LoadTab (std::ifstream& instream, const bool& loadcoefficients);
    void LM_LoadTide (std::string& filename, const bool& loadcoefficients);
+   StringArray LM_CacheFiles () const;
+   std::string LM_CacheFormat () const;
+   bool LM_LoadCached (const std::shared_ptr<const DataFileCache>& cached);
+   void LM_ShareCached ();
    void CheckEarthCoefficient ();
 };
 //------------------------------------------------------------------------------
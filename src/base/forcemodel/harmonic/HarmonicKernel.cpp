@@ -0,0 +1,146 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           HarmonicKernel
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Row kernels for the packed-triangular Legendre recursion.
+ */
+//------------------------------------------------------------------------------
+#include "HarmonicKernel.hpp"
+
+// Runtime selected instruction set clones (GCC ifunc, so Linux only)
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && \
+    defined(__linux__)
+   #define HARMONIC_KERNEL_CLONES \
+      __attribute__((target_clones("avx512f","avx2","default")))
+#else
+   #define HARMONIC_KERNEL_CLONES
+#endif
+
+// Number of independent partial sums in SumRow.  Using separate lanes keeps
+// the reduction vectorizable without reassociating the floating point sums.
+static const Integer LANES = 8;
+
+//------------------------------------------------------------------------------
+// void FillRow(const Integer count, const Real u, const Real *n1,
+//       const Real *n2, const Real *a1, const Real *a2, Real *a)
+//------------------------------------------------------------------------------
+/**
+ * Column-fill recursion (Table 2, Row I, Ref.[1] of Harmonic.hpp) applied
+ * across one row:  a[m] = u * n1[m] * a1[m] - n2[m] * a2[m], m < count.
+ */
+//------------------------------------------------------------------------------
+HARMONIC_KERNEL_CLONES
+void HarmonicKernel::FillRow(const Integer count, const Real u,
+      const Real *n1, const Real *n2, const Real *a1, const Real *a2,
+      Real *a)
+{
+   for (Integer m = 0; m < count; ++m)
+      a[m] = u * n1[m] * a1[m] - n2[m] * a2[m];
+}
+
+//------------------------------------------------------------------------------
+// void SumRow(const Integer count, const Real *c, const Real *s,
+//       const Real *re, const Real *im, const Real *aRow, const Real *aNext,
+//       const Real *vr01, const Real *vr11, Real sums[4])
+//------------------------------------------------------------------------------
+/**
+ * Pines Equation 30 and 30b partial sums for orders 0..count-1 of one degree.
+ *
+ * @param c,s   Packed coefficients of the row
+ * @param re,im Real and imaginary parts of (s + i*t)^m
+ * @param aRow  Packed A row n;  aNext is row n+1
+ * @param sums  Receives sum1..sum4, without the sqrt(2) factor
+ */
+//------------------------------------------------------------------------------
+HARMONIC_KERNEL_CLONES
+void HarmonicKernel::SumRow(const Integer count, const Real *c, const Real *s,
+      const Real *re, const Real *im, const Real *aRow, const Real *aNext,
+      const Real *vr01, const Real *vr11, Real sums[4])
+{
+   // m = 0 has no E and F terms
+   Real D0 = c[0]*re[0] + s[0]*im[0];
+   Real s1 = 0.0;
+   Real s2 = 0.0;
+   Real s3 = vr01[0] * aRow[1]  * D0;
+   Real s4 = vr11[0] * aNext[1] * D0;
+
+   Real p1[LANES], p2[LANES], p3[LANES], p4[LANES];
+   for (Integer l = 0; l < LANES; ++l)
+      p1[l] = p2[l] = p3[l] = p4[l] = 0.0;
+
+   Integer m = 1;
+   for (; m + LANES <= count; m += LANES)
+   {
+      for (Integer l = 0; l < LANES; ++l)
+      {
+         Integer k = m + l;
+         Real D  = c[k]*re[k]   + s[k]*im[k];
+         Real E  = c[k]*re[k-1] + s[k]*im[k-1];
+         Real F  = s[k]*re[k-1] - c[k]*im[k-1];
+         Real mA = Real(k) * aRow[k];
+         p1[l] += mA * E;
+         p2[l] += mA * F;
+         p3[l] += vr01[k] * aRow[k+1]  * D;
+         p4[l] += vr11[k] * aNext[k+1] * D;
+      }
+   }
+   for (; m < count; ++m)
+   {
+      Real D  = c[m]*re[m]   + s[m]*im[m];
+      Real E  = c[m]*re[m-1] + s[m]*im[m-1];
+      Real F  = s[m]*re[m-1] - c[m]*im[m-1];
+      Real mA = Real(m) * aRow[m];
+      s1 += mA * E;
+      s2 += mA * F;
+      s3 += vr01[m] * aRow[m+1]  * D;
+      s4 += vr11[m] * aNext[m+1] * D;
+   }
+   for (Integer l = 0; l < LANES; ++l)
+   {
+      s1 += p1[l];
+      s2 += p2[l];
+      s3 += p3[l];
+      s4 += p4[l];
+   }
+   sums[0] = s1;
+   sums[1] = s2;
+   sums[2] = s3;
+   sums[3] = s4;
+}
+
+//------------------------------------------------------------------------------
+// std::string GetInstructionSet()
+//------------------------------------------------------------------------------
+/**
+ * Reports which kernel build the host runs, for diagnostics and benchmarks.
+ */
+//------------------------------------------------------------------------------
+std::string HarmonicKernel::GetInstructionSet()
+{
+   #if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && \
+       defined(__linux__)
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f"))
+         return "AVX-512";
+      if (__builtin_cpu_supports("avx2"))
+         return "AVX2";
+   #endif
+   return "Scalar";
+}
@@ -0,0 +1,63 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           HarmonicKernel
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Row kernels for the packed-triangular Legendre recursion used by
+ * Harmonic::CalculateField.
+ *
+ * The tables are stored degree-major: row n holds the orders m = 0..n+1
+ * contiguously, starting at HarmonicKernel::RowOffset(n).  Each kernel works
+ * on one row with unit stride, so the loops vectorize.  On x86-64 Linux
+ * builds with GCC the kernels are compiled for AVX-512, AVX2 and baseline
+ * instruction sets, and the loader selects the best one for the host CPU at
+ * run time; other platforms get the baseline build.
+ */
+//------------------------------------------------------------------------------
+#ifndef HarmonicKernel_hpp
+#define HarmonicKernel_hpp
+
+#include "gmatdefs.hpp"
+
+namespace HarmonicKernel
+{
+   /// Start of row n in the packed tables
+   inline Integer RowOffset(const Integer n)
+   {
+      return n*(n+3)/2;
+   }
+
+   /// Number of packed entries needed for rows 0..rows-1
+   inline Integer PackedSize(const Integer rows)
+   {
+      return RowOffset(rows);
+   }
+
+   GMAT_API void FillRow(const Integer count, const Real u,
+         const Real *n1, const Real *n2, const Real *a1, const Real *a2,
+         Real *a);
+
+   GMAT_API void SumRow(const Integer count, const Real *c, const Real *s,
+         const Real *re, const Real *im, const Real *aRow, const Real *aNext,
+         const Real *vr01, const Real *vr11, Real sums[4]);
+
+   GMAT_API std::string GetInstructionSet();
+}
+
+#endif // HarmonicKernel_hpp
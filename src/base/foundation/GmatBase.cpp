@@ -1541,11 +1541,11 @@ bool GmatBase::HasDecoratedFields()
 //---------------------------------------------------------------------------
 Integer GmatBase::GetParameterID(const std::string &str) const
 {
-   for (Integer i = 0; i < GmatBaseParamCount; ++i)
-      if (str == PARAMETER_LABEL[i])
-      {
-         return i;
-      }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_LABEL, 0, GmatBaseParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    throw GmatBaseException
       ("GmatBase::GetParameterID() The object named \"" + GetName() +
@@ -45,6 +45,7 @@
 #include "Rmatrix.hpp"
 #include "Covariance.hpp"
 #include "GmatWidget.hpp"
+#include "ParameterIndex.hpp"
 
 // Make the typename singleton available everywhere
 #include "GmatType.hpp"
@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+//                           ParameterIndex
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Hashed lookup of parameter IDs from the parameter label tables
+ */
+//------------------------------------------------------------------------------
+
+#include "ParameterIndex.hpp"
+
+
+//------------------------------------------------------------------------------
+// ParameterIndex(const std::string *labels, Integer firstId, Integer endId)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param labels  The parameter label table; labels[0] is the label of firstId
+ * @param firstId The ID of the first parameter in the table
+ * @param endId   One past the ID of the last parameter in the table
+ */
+//------------------------------------------------------------------------------
+ParameterIndex::ParameterIndex(const std::string *labels, Integer firstId,
+      Integer endId)
+{
+   if (endId > firstId)
+      ids.reserve(endId - firstId);
+   for (Integer i = firstId; i < endId; ++i)
+      ids.insert(std::make_pair(labels[i - firstId], i));
+}
+
+
+//------------------------------------------------------------------------------
+// Integer Find(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the ID of a parameter in the table
+ *
+ * @param label The parameter label
+ *
+ * @return The parameter ID, or -1 if the label is not in the table
+ */
+//------------------------------------------------------------------------------
+Integer ParameterIndex::Find(const std::string &label) const
+{
+   std::unordered_map<std::string, Integer>::const_iterator i = ids.find(label);
+   if (i == ids.end())
+      return -1;
+   return i->second;
+}
@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+//                           ParameterIndex
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Hashed lookup of parameter IDs from the parameter label tables
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef ParameterIndex_hpp
+#define ParameterIndex_hpp
+
+#include "gmatdefs.hpp"
+#include <unordered_map>
+
+/**
+ * ParameterIndex maps the labels of a class's parameter table to their IDs.
+ *
+ * Each class keeps one index for its own PARAMETER_TEXT (or PARAMETER_LABEL)
+ * table as a function local static in GetParameterID(), so the index is built
+ * the first time an object of the class is asked for an ID, and shared by all
+ * objects of the class:
+ *
+ *    static const ParameterIndex index(PARAMETER_TEXT, ParentParamCount,
+ *                                      MyParamCount);
+ *    Integer id = index.Find(str);
+ *    if (id != -1)
+ *       return id;
+ *    return Parent::GetParameterID(str);
+ *
+ * When a label appears more than once in a table the first entry wins, as it
+ * did for the linear searches the index replaces.
+ */
+class GMAT_API ParameterIndex
+{
+public:
+   ParameterIndex(const std::string *labels, Integer firstId, Integer endId);
+
+   Integer Find(const std::string &label) const;
+
+private:
+   /// Parameter IDs keyed by label
+   std::unordered_map<std::string, Integer> ids;
+};
+
+#endif /* ParameterIndex_hpp */
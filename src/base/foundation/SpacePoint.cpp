@@ -1213,11 +1213,12 @@ std::string SpacePoint::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SpacePoint::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < SpacePointParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               SpacePointParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatBase::GetParameterID(str);
 }
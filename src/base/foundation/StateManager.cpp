@@ -52,7 +52,9 @@
 StateManager::StateManager(Integer size) :
    stateSize      (size),
    state          (size),
-   current        (NULL)
+   current        (NULL),
+   publishIndexNames     (NULL),
+   publishIndexNameCount (0)
 {
    objects.clear();
    epochIDs.clear();
@@ -87,7 +89,9 @@ StateManager::StateManager(const StateManager& sm) :
    state       (sm.state),
    objectNames (sm.objectNames),
    current     (NULL),
-   stateMap    (sm.stateMap)
+   stateMap    (sm.stateMap),
+   publishIndexNames     (NULL),
+   publishIndexNameCount (0)
 {
    objects.clear();
    epochIDs.clear();
@@ -115,6 +119,11 @@ StateManager& StateManager::operator=(const StateManager& sm)
       current     = NULL;
       objectNames = sm.objectNames;
       stateMap    = sm.stateMap;
+
+      publishIndex.clear();
+      publishIndexMap.clear();
+      publishIndexNames     = NULL;
+      publishIndexNameCount = 0;
    }
    
    return *this;
@@ -410,16 +419,25 @@ Integer StateManager::PrepareCovAndAccelerationInfoToPublish(StringArray &ownerN
 
 
 
-bool StateManager::PrepareStateDataToPublish(Real* publishData, Integer publishDataSize, StringArray& elementNames)
+//------------------------------------------------------------------------------
+// void BuildPublishIndex(const StringArray &elementNames)
+//------------------------------------------------------------------------------
+/**
+ * Finds the published data slot of each element in the state map
+ *
+ * The names are built and matched once, when the publishing list or the state
+ * map changes, rather than on every published step.
+ *
+ * @param elementNames The names of the published elements
+ */
+//------------------------------------------------------------------------------
+void StateManager::BuildPublishIndex(const StringArray &elementNames)
 {
    StringArray stateNames;
    stateNames.push_back("X"); stateNames.push_back("Y"); stateNames.push_back("Z");
    stateNames.push_back("Vx"); stateNames.push_back("Vy"); stateNames.push_back("Vz");
 
-   //Integer Index = len;
-
-   // Publish value of each element handling by state manager sm 
-   Integer size = state.GetSize();
+   publishIndex.assign(stateMap.size(), -1);
    for (Integer i = 0; i < stateMap.size(); ++i)
    {
       ListItem *item = stateMap[i];
@@ -448,43 +466,42 @@ bool StateManager::PrepareStateDataToPublish(Real* publishData, Integer publishD
             ss << item->objectName << "." << item->elementName << "." << item->subelement;
       }
       std::string name = ss.str();
-      
-      bool found = false;
-      Integer idx = 0;
-      for (; idx < elementNames.size(); ++idx)
+
+      // Elements not in the publishing list keep the -1 index
+      for (Integer idx = 0; idx < elementNames.size(); ++idx)
       {
          if (name == elementNames[idx])
          {
-            found = true;
+            publishIndex[i] = idx;
             break;
          }
       }
+   }
 
-      if (found)
-         publishData[idx] = state[i];
-      // Skip filling data to publishData when element is not in publishing list.
-
-
-      //if (index >= publishDataSize)
-      //{
-      //   std::stringstream ss;
-      //   ss << "Error: Data is overflowed in StateManager::PrepareStateDataToPublish()"
-      //      << " function when data are filled publishData array: publishDataSize = " 
-      //      << publishDataSize << ". Fill data for stateMap[" << i 
-      //      << "]: object name = <" << stateMap[i]->object->GetName()
-      //      << ">     elementName = <" << stateMap[i]->elementName << ">   subelement = <" 
-      //      << stateMap[i]->subelement << ">\n";
-      //   throw GmatBaseException(ss.str());
-      //}
-      //
-      //publishData[index] = state[i];
-      //++index;
+   publishIndexMap       = stateMap;
+   publishIndexNames     = &elementNames;
+   publishIndexNameCount = elementNames.size();
+}
+
+
+bool StateManager::PrepareStateDataToPublish(Real* publishData, Integer publishDataSize, StringArray& elementNames)
+{
+   // Publish value of each element handling by state manager sm 
+   if ((publishIndexNames != &elementNames) ||
+       (publishIndexNameCount != elementNames.size()) ||
+       (publishIndexMap != stateMap))
+      BuildPublishIndex(elementNames);
+
+   for (Integer i = 0; i < stateMap.size(); ++i)
+   {
+      if (publishIndex[i] >= 0)
+         publishData[publishIndex[i]] = state[i];
    }
-   //len = index;
 
    #ifdef DEBUG_PUBLISHED_DATA
-   for (Integer i = len; i < index; ++i)
-      MessageInterface::ShowMessage("publishData[%d] = %.12lf\n", i, publishData[i]);
+   for (Integer i = 0; i < stateMap.size(); ++i)
+      if (publishIndex[i] >= 0)
+         MessageInterface::ShowMessage("publishData[%d] = %.12lf\n", publishIndex[i], publishData[publishIndex[i]]);
    #endif
    return true;
 }
@@ -497,7 +514,8 @@ bool StateManager::PrepareCovAndAccelerationDataToPublish(Real* publishData, Int
    Integer index = covStartIndex;
 
    // 1. Specify all object in state map
-   ObjectArray objs;
+   ObjectArray &objs = publishObjects;
+   objs.clear();
    for (Integer j = 0; j < stateMap.size(); ++j)
    {
       GmatBase* obj = stateMap[j]->object;
@@ -518,7 +536,7 @@ bool StateManager::PrepareCovAndAccelerationDataToPublish(Real* publishData, Int
       if (obj->IsOfType(Gmat::FORMATION) && !found)
       {
          if (obj);
-         ObjectArray fromationComponents = obj->GetRefObjectArray("Spacecraft");
+         const ObjectArray &fromationComponents = obj->GetRefObjectArray("Spacecraft");
          for (Integer k = 0; k < fromationComponents.size(); k++)
          {
             objs.push_back(fromationComponents[k]);
@@ -534,29 +552,19 @@ bool StateManager::PrepareCovAndAccelerationDataToPublish(Real* publishData, Int
          Spacecraft *sc = (Spacecraft*)objs[j];
 
          // 2.1. Specify covariance and publish it
-         // Specify object's State Transition Mamtrix STM(t0,t)
-         Rmatrix phi = sc->GetRmatrixParameter("FullSTM");
-
-         // Specify object's covariance cov(t0) at time t0
-         Rmatrix covt0 = sc->GetRmatrixParameter("OrbitErrorCovariance");
-         Rmatrix Pt0;
-         Pt0.SetSize(phi.GetNumRows(), phi.GetNumColumns(), true);
-         for (Integer row = 0; row < phi.GetNumRows(); ++row)
-         {
-            for (Integer col = 0; col < phi.GetNumColumns(); ++col)
-            {
-               if ((row < covt0.GetNumRows()) && (col < covt0.GetNumColumns()))
-                  Pt0(row, col) = covt0(row, col);
-               else
-                  continue;
-            }
-         }
+         // Specify object's covariance cov(t0) at time t0.  The matrices
+         // are read by reference so that no copies are made on each step.
+         static const std::string stmName = "FullSTM";
+         static const std::string covName = "OrbitErrorCovariance";
+         const Rmatrix &phi = sc->GetRmatrixParameter(stmName);
+         const Rmatrix &covt0 = sc->GetRmatrixParameter(covName);
 
          // Specify object's covariance P(t) at time t in MJ2000Eq axis: 
          // P(t) = STM(t,t0) * P(t0) * STM(t,t0).Transpose
          //Rmatrix Pt = phi * Pt0 * phi.Transpose();
-         // At here, matrix Pt0 is matrix P(t).
-         Rmatrix Pt = Pt0;
+         // At here, P(t) is P(t0) padded with zeros to the size of the STM.
+         Integer ptRows = phi.GetNumRows(), ptCols = phi.GetNumColumns();
+         Integer covRows = covt0.GetNumRows(), covCols = covt0.GetNumColumns();
 
          // @todo: if wanted P(t) in other axis, it needs to have 6x6 rotation matrix R = [Rot     0  ]
          //                                                                               [RotDot  Rot]
@@ -579,7 +587,12 @@ bool StateManager::PrepareCovAndAccelerationDataToPublish(Real* publishData, Int
                   throw GmatBaseException(ss.str());
                }
 
-               publishData[index] = Pt(row, col);
+               if ((row >= ptRows) || (col >= ptCols))
+                  throw GmatBaseException("Error: The STM is smaller than "
+                        "the published covariance in StateManager::"
+                        "PrepareCovAndAccelerationDataToPublish()\n");
+               publishData[index] = ((row < covRows) && (col < covCols) ?
+                     covt0(row, col) : 0.0);
                ++index;
             }
          }
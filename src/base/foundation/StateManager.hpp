@@ -165,6 +165,8 @@ public:
    virtual Rvector3 GetAccelerationOfSpacecraft(GmatBase* obj);
 
 protected:
+   void             BuildPublishIndex(const StringArray &elementNames);
+
    /// Size of the managed state vector
    Integer                    stateSize;
    /// The state in J2000BodyMJ2000Eq coordinates (currently it is in EarthMJ2000Eq - GMAT internal coordinates).
@@ -178,6 +180,17 @@ protected:
    GmatBase*                  current;
 
    std::vector<ListItem*>     stateMap;
+
+   /// Published data index for each state element, -1 if not published
+   std::vector<Integer>       publishIndex;
+   /// The state map the publish index was built for
+   std::vector<ListItem*>     publishIndexMap;
+   /// The element name list the publish index was built for
+   const StringArray          *publishIndexNames;
+   /// The size of that list when the index was built
+   UnsignedInt                publishIndexNameCount;
+   /// Objects publishing covariance and acceleration, reused between steps
+   ObjectArray                publishObjects;
 };
 
 #endif /*StateManager_hpp*/
@@ -104,6 +104,7 @@ FunctionManager::FunctionManager() :
    currentFunction     (NULL),
    firstExecution      (true),
    isFinalized         (false),
+   frameReusable       (false),
    numVarsCreated      (0),
    validator           (NULL),
    realResult          (-999.99),
@@ -174,6 +175,7 @@ FunctionManager::FunctionManager(const FunctionManager &fm) :
    outputWrappers      (fm.outputWrappers), // is that right?
    firstExecution      (true),
    isFinalized         (false),
+   frameReusable       (false),
    numVarsCreated      (fm.numVarsCreated),
    validator           (NULL),
    realResult          (fm.realResult),
@@ -218,6 +220,7 @@ FunctionManager& FunctionManager::operator=(const FunctionManager &fm)
       passedOuts          = fm.passedOuts;
       firstExecution      = true;
       isFinalized         = false;
+      frameReusable       = false;
       numVarsCreated      = fm.numVarsCreated;
       validator           = NULL;
       //inputWrapperMap       = fm.inputWrapperMap; // is that right?
@@ -915,6 +918,9 @@ bool FunctionManager::Execute(FunctionManager *callingFM)
    PrepareObjectMap();
    PrepareExecution(callingFM);
    
+   // Set when the objects and commands from the previous call are kept
+   bool reuseFrame = false;
+   
    if (firstExecution)
    {
       #ifdef DEBUG_FM_EXECUTE
@@ -924,13 +930,25 @@ bool FunctionManager::Execute(FunctionManager *callingFM)
    }
    else
    {
-      #ifdef DEBUG_FM_EXECUTE
-      MessageInterface::ShowMessage
-         ("   NOT First execution, so calling RefreshFOS()\n");
-      #endif
-      // Need to refresh for nested or recursive function call or
-      // function call in math equation for input/output arguments
-      RefreshFOS();
+      reuseFrame = CanReuseFrame();
+      if (reuseFrame)
+      {
+         #ifdef DEBUG_FM_EXECUTE
+         MessageInterface::ShowMessage
+            ("   NOT First execution, so resetting the call frame\n");
+         #endif
+         ResetFrame();
+      }
+      else
+      {
+         #ifdef DEBUG_FM_EXECUTE
+         MessageInterface::ShowMessage
+            ("   NOT First execution, so calling RefreshFOS()\n");
+         #endif
+         // Need to refresh for nested or recursive function call or
+         // function call in math equation for input/output arguments
+         RefreshFOS();
+      }
       RefreshFormalInputObjects();
    } // end if not first time through
    
@@ -960,56 +978,6 @@ bool FunctionManager::Execute(FunctionManager *callingFM)
       currentFunction->SetInputElementWrapper(ewi->first, ewi->second);
    }
    
-   // create new ObjectInitializer   
-   #ifdef DEBUG_FM_EXECUTE
-   MessageInterface::ShowMessage
-      ("in FM::Execute (%s), about to create new ObjectInitializer, objInit=<%p>,\n   "
-       "solarSys=<%p>, FOS=<%p>, GOS=<%p>, internalCS=<%p>, and true for useGOS\n",
-       functionName.c_str(), objInit, solarSys, functionObjectStore, globalObjectStore, internalCS);
-   #endif
-   
-   if (objInit)
-   {
-      #ifdef DEBUG_MEMORY
-      MemoryTracker::Instance()->Remove
-         (objInit, "objInit", "FunctionManager::Execute()");
-      #endif
-      delete objInit;
-   }
-
-   #ifdef DUMP_OBJECT_STORES
-   MessageInterface::ShowMessage("FunctionObjectStore:\n");
-   for(ObjectMap::iterator it = functionObjectStore->begin(); it != functionObjectStore->end(); ++it)
-   {
-      GmatBase *obj = it->second;
-      MessageInterface::ShowMessage("  %p:  %s ==> %s of type %s\n", obj,
-            it->first.c_str(), obj->GetName().c_str(), obj->GetTypeName().c_str());
-
-      if (obj->IsOfType(Gmat::COORDINATE_SYSTEM))
-         MessageInterface::ShowMessage("%s\n",
-               obj->GetGeneratingString(Gmat::SCRIPTING).c_str());
-   }
-   MessageInterface::ShowMessage("GlobalObjectStore:\n");
-   for(ObjectMap::iterator it = globalObjectStore->begin(); it != globalObjectStore->end(); ++it)
-   {
-      GmatBase *obj = it->second;
-      MessageInterface::ShowMessage("  %p:  %s ==> %s of type %s\n", obj,
-            it->first.c_str(), obj->GetName().c_str(), obj->GetTypeName().c_str());
-
-      if (obj->IsOfType(Gmat::COORDINATE_SYSTEM))
-         MessageInterface::ShowMessage("%s\n",
-               obj->GetGeneratingString(Gmat::SCRIPTING).c_str());
-   }
-   #endif
-
-   objInit = new ObjectInitializer(solarSys, functionObjectStore,
-                                   globalObjectStore, internalCS, true, true);
-   
-   #ifdef DEBUG_MEMORY
-   MemoryTracker::Instance()->Add
-      (objInit, "objInit", "FunctionManager::Execute()", "objInit = new ObjectInitializer");
-   #endif
-   
    // Set re-initialize flag, set to true if it is nested function call
    //bool reinitialize = false;
    // if (callingFunction != NULL)
@@ -1018,47 +986,111 @@ bool FunctionManager::Execute(FunctionManager *callingFM)
    // Must re-initialize the function each time, as it may be called in more than
    // one place. This will make function to run properly inside a target loop.
    // This fixes GMT-5311 (LOJ: 2015.10.05)
-   bool reinitialize = true;
+   // A reused frame was initialized by the previous call from this caller, and
+   // no other caller has initialized the function since.
+   bool reinitialize = !reuseFrame;
    
-   #ifdef DEBUG_FM_EXECUTE
-   MessageInterface::ShowMessage
-      ("FunctionManager::Execute() Now initializing currentFunction '%s'\n",
-       currentFunction->GetName().c_str());
-   #endif
-   if (!(currentFunction->Initialize(objInit, reinitialize)))
+   // The objects, ObjectInitializer and commands of the previous call are
+   // still set up when the frame is reused
+   if (!reuseFrame)
    {
-      std::string errMsg = "FunctionManager:: Error initializing function \"";
-      errMsg += currentFunction->GetStringParameter("FunctionName") + "\"\n";
-      throw FunctionException(errMsg);
-   }
-   
-   // tell the fcs that this is the calling function
-   #ifdef DEBUG_FM_EXECUTE
-   MessageInterface::ShowMessage("   new objInit=<%p> created\n", objInit);
-   MessageInterface::ShowMessage(
-      "in FM::Execute (%s), calling function is <%p>'%s'\n",
-      functionName.c_str(), callingFunction, callingFunction ?
-      callingFunction->GetFunctionName().c_str() : "NULL");
-   #endif
+      // create new ObjectInitializer   
+      #ifdef DEBUG_FM_EXECUTE
+      MessageInterface::ShowMessage
+         ("in FM::Execute (%s), about to create new ObjectInitializer, objInit=<%p>,\n   "
+          "solarSys=<%p>, FOS=<%p>, GOS=<%p>, internalCS=<%p>, and true for useGOS\n",
+          functionName.c_str(), objInit, solarSys, functionObjectStore, globalObjectStore, internalCS);
+      #endif
    
-   if (currentFunction->IsOfType("UserDefinedFunction"))
-   {
-      UserDefinedFunction *udf = (UserDefinedFunction*)currentFunction;
-      ////GmatCommand *cmd = currentFunction->GetFunctionControlSequence();
-      GmatCommand *cmd = udf->GetFunctionControlSequence();
-      while (cmd) 
+      if (objInit)
       {
-         #ifdef DEBUG_FM_EXECUTE
-         MessageInterface::ShowMessage(
-            "in FM::Execute, about to set calling function manager <%p> on command '%s'\n",
-            this, (cmd->GetTypeName()).c_str());
+         #ifdef DEBUG_MEMORY
+         MemoryTracker::Instance()->Remove
+            (objInit, "objInit", "FunctionManager::Execute()");
          #endif
-         cmd->SetCallingFunction(this);
-         cmd->SetInternalCoordSystem(internalCS);
-         cmd = cmd->GetNext();
+         delete objInit;
+      }
+
+      #ifdef DUMP_OBJECT_STORES
+      MessageInterface::ShowMessage("FunctionObjectStore:\n");
+      for(ObjectMap::iterator it = functionObjectStore->begin(); it != functionObjectStore->end(); ++it)
+      {
+         GmatBase *obj = it->second;
+         MessageInterface::ShowMessage("  %p:  %s ==> %s of type %s\n", obj,
+               it->first.c_str(), obj->GetName().c_str(), obj->GetTypeName().c_str());
+
+         if (obj->IsOfType(Gmat::COORDINATE_SYSTEM))
+            MessageInterface::ShowMessage("%s\n",
+                  obj->GetGeneratingString(Gmat::SCRIPTING).c_str());
+      }
+      MessageInterface::ShowMessage("GlobalObjectStore:\n");
+      for(ObjectMap::iterator it = globalObjectStore->begin(); it != globalObjectStore->end(); ++it)
+      {
+         GmatBase *obj = it->second;
+         MessageInterface::ShowMessage("  %p:  %s ==> %s of type %s\n", obj,
+               it->first.c_str(), obj->GetName().c_str(), obj->GetTypeName().c_str());
+
+         if (obj->IsOfType(Gmat::COORDINATE_SYSTEM))
+            MessageInterface::ShowMessage("%s\n",
+                  obj->GetGeneratingString(Gmat::SCRIPTING).c_str());
+      }
+      #endif
+
+      objInit = new ObjectInitializer(solarSys, functionObjectStore,
+                                      globalObjectStore, internalCS, true, true);
+   
+      #ifdef DEBUG_MEMORY
+      MemoryTracker::Instance()->Add
+         (objInit, "objInit", "FunctionManager::Execute()", "objInit = new ObjectInitializer");
+      #endif
+   
+      #ifdef DEBUG_FM_EXECUTE
+      MessageInterface::ShowMessage
+         ("FunctionManager::Execute() Now initializing currentFunction '%s'\n",
+          currentFunction->GetName().c_str());
+      #endif
+      if (!(currentFunction->Initialize(objInit, reinitialize)))
+      {
+         std::string errMsg = "FunctionManager:: Error initializing function \"";
+         errMsg += currentFunction->GetStringParameter("FunctionName") + "\"\n";
+         throw FunctionException(errMsg);
+      }
+   
+      // tell the fcs that this is the calling function
+      #ifdef DEBUG_FM_EXECUTE
+      MessageInterface::ShowMessage("   new objInit=<%p> created\n", objInit);
+      MessageInterface::ShowMessage(
+         "in FM::Execute (%s), calling function is <%p>'%s'\n",
+         functionName.c_str(), callingFunction, callingFunction ?
+         callingFunction->GetFunctionName().c_str() : "NULL");
+      #endif
+   
+      if (currentFunction->IsOfType("UserDefinedFunction"))
+      {
+         UserDefinedFunction *udf = (UserDefinedFunction*)currentFunction;
+         ////GmatCommand *cmd = currentFunction->GetFunctionControlSequence();
+         GmatCommand *cmd = udf->GetFunctionControlSequence();
+         while (cmd) 
+         {
+            #ifdef DEBUG_FM_EXECUTE
+            MessageInterface::ShowMessage(
+               "in FM::Execute, about to set calling function manager <%p> on command '%s'\n",
+               this, (cmd->GetTypeName()).c_str());
+            #endif
+            cmd->SetCallingFunction(this);
+            cmd->SetInternalCoordSystem(internalCS);
+            cmd = cmd->GetNext();
+         }
+      
+         // Later calls from this caller may keep the frame built here
+         udf->SetFrameOwner(this);
+         frameReusable = udf->IsFrameReusable();
       }
    }
    
+   if (currentFunction->IsOfType("UserDefinedFunction"))
+      ((UserDefinedFunction*)currentFunction)->SetFrameReused(reuseFrame);
+   
    
    #ifdef DEBUG_FM_EXECUTE
    MessageInterface::ShowMessage
@@ -1749,6 +1781,76 @@ void FunctionManager::RefreshFOS()
 }
 
 
+//------------------------------------------------------------------------------
+// bool CanReuseFrame()
+//------------------------------------------------------------------------------
+/*
+ * Checks if the function objects, ObjectInitializer and commands set up by the
+ * previous call from this caller can be used for this call.
+ *
+ * The frame is kept when the function only works on Parameters (see
+ * UserDefinedFunction::IsFrameReusable()), this FunctionManager initialized
+ * the function last, and the function has not been finalized since.  Nested
+ * and recursive calls always rebuild their frame.
+ */
+//------------------------------------------------------------------------------
+bool FunctionManager::CanReuseFrame()
+{
+   if (!frameReusable || callingFunction != NULL || objInit == NULL ||
+       functionObjectStore == NULL)
+      return false;
+   
+   if (!currentFunction->IsOfType("UserDefinedFunction"))
+      return false;
+   
+   UserDefinedFunction *udf = (UserDefinedFunction*)currentFunction;
+   if (udf->GetFrameOwner() != this || udf->IsFcsFinalized())
+      return false;
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void ResetFrame()
+//------------------------------------------------------------------------------
+/*
+ * Resets the objects created in the function to their parsed values, in
+ * place, so the commands keep their references to them.  This replaces the
+ * delete and clone done by RefreshFOS() and GmatFunction::Initialize().
+ * Formal arguments are kept, as in RefreshFOS(), and automatic objects hold
+ * no values of their own.
+ */
+//------------------------------------------------------------------------------
+void FunctionManager::ResetFrame()
+{
+   UserDefinedFunction *udf = (UserDefinedFunction*)currentFunction;
+   StringArray formalNames =
+      currentFunction->GetStringArrayParameter(currentFunction->GetParameterID("Input"));
+   StringArray outFormalNames =
+      currentFunction->GetStringArrayParameter(currentFunction->GetParameterID("Output"));
+   formalNames.insert(formalNames.end(), outFormalNames.begin(), outFormalNames.end());
+   
+   std::map<std::string, GmatBase *>::iterator omi;
+   for (omi = functionObjectStore->begin(); omi != functionObjectStore->end(); ++omi)
+   {
+      if (find(formalNames.begin(), formalNames.end(), omi->first) != formalNames.end())
+         continue;
+      
+      GmatBase *original = udf->FindFunctionObject(omi->first);
+      if (original != NULL && omi->second != NULL && original != omi->second)
+      {
+         #ifdef DEBUG_FM_EXECUTE
+         MessageInterface::ShowMessage
+            ("   Resetting <%p>'%s' from <%p>\n", omi->second, omi->first.c_str(),
+             original);
+         #endif
+         omi->second->Copy(original);
+      }
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // void RefreshFormalInputObjects()
 //------------------------------------------------------------------------------
@@ -141,6 +141,8 @@ protected:
    bool                 firstExecution;
    /// flag indicating whether or not FunctionManager is finalized
    bool                 isFinalized;
+   /// flag indicating the function objects and commands can be kept between calls
+   bool                 frameReusable;
    // number of Variables created for the FOS
    Integer              numVarsCreated;
    /// Output Objects
@@ -182,6 +184,8 @@ protected:
    bool                 CreatePassingArgWrappers();
    void                 RefreshFOS();
    void                 RefreshFormalInputObjects();
+   bool                 CanReuseFrame();
+   void                 ResetFrame();
    GmatBase*            FindObject(const std::string &name, bool arrayElementsAllowed = false);
    GmatBase*            CreateObject(const std::string &fromString);
    GmatBase*            CreateObjectForBuiltinGmatFunction(
@@ -34,6 +34,8 @@
 #include "FunctionException.hpp"    // for exception
 #include "StringUtil.hpp"           // for GmatStringUtil::
 #include "Parameter.hpp"            // for GetOwner()
+#include "Assignment.hpp"           // for GetMathTree()
+#include "MathTree.hpp"             // for GetFunctions()
 #include "MessageInterface.hpp"
 
 //#define DEBUG_FUNCTION_SET
@@ -67,7 +69,9 @@ UserDefinedFunction::UserDefinedFunction(const std::string &typeStr, const std::
    fcsInitialized     (false),
    fcsFinalized       (false),
    validator          (NULL),
-   objectsInitialized (false)
+   objectsInitialized (false),
+   frameOwner         (NULL),
+   frameReused        (false)
 {
    if (typeStr != "")
       objectTypeNames.push_back(typeStr);
@@ -118,7 +122,9 @@ UserDefinedFunction::UserDefinedFunction(const UserDefinedFunction &f) :
    fcsFinalized       (f.fcsFinalized),
    functionObjectMap  (f.functionObjectMap), // Do I want to do this?
    validator          (f.validator),
-   objectsInitialized (false)
+   objectsInitialized (false),
+   frameOwner         (NULL),
+   frameReused        (false)
 {
    //parameterCount = UserDefinedFunctionParamCount;
 }
@@ -147,6 +153,8 @@ UserDefinedFunction& UserDefinedFunction::operator=(const UserDefinedFunction &f
    fcsFinalized       = f.fcsFinalized;
    validator          = f.validator;
    objectsInitialized = f.objectsInitialized;
+   frameOwner         = NULL;
+   frameReused        = false;
    return *this;
 }
 
@@ -180,6 +188,10 @@ void UserDefinedFunction::Finalize(bool cleanUp)
       ("\nUserDefinedFunction::Finalize() entered, fcsFinalized=%d\n", fcsFinalized);
    #endif
    
+   // The next call builds its call frame again
+   frameOwner = NULL;
+   frameReused = false;
+   
    if (sandboxObjects.size() == 0)
    {
       #ifdef DEBUG_FUNCTION_FINALIZE
@@ -742,9 +754,132 @@ ObjectMap* UserDefinedFunction::GetAutomaticObjectMap()
 }
 
 
+//------------------------------------------------------------------------------
+// bool IsFrameReusable()
+//------------------------------------------------------------------------------
+/**
+ * Checks if the objects and commands of a call can be kept for the next call
+ * from the same caller.
+ *
+ * This is true when every object the function creates is a Parameter, such
+ * as a Variable, Array or String, that can be reset from its parsed copy,
+ * and the function control sequence holds only assignments, without function
+ * calls, and If, For and While blocks of them.  Calls to such functions
+ * depend only on their arguments, so rebuilding the function objects and the
+ * commands on each call is not needed.
+ *
+ * @return true if the call frame can be reused
+ */
+//------------------------------------------------------------------------------
+bool UserDefinedFunction::IsFrameReusable()
+{
+   if (fcs == NULL)
+      return false;
+   
+   ObjectMap::iterator omi;
+   for (omi = functionObjectMap.begin(); omi != functionObjectMap.end(); ++omi)
+   {
+      if (omi->second == NULL || !omi->second->IsOfType(Gmat::PARAMETER))
+         return false;
+   }
+   for (omi = automaticObjectMap.begin(); omi != automaticObjectMap.end(); ++omi)
+   {
+      if (omi->second == NULL || !omi->second->IsOfType(Gmat::PARAMETER))
+         return false;
+   }
+   
+   return IsSimpleSequence(fcs, NULL);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetFrameOwner(FunctionManager *fm)
+//------------------------------------------------------------------------------
+/**
+ * Records the FunctionManager whose object store the function was last
+ * initialized with.
+ */
+//------------------------------------------------------------------------------
+void UserDefinedFunction::SetFrameOwner(FunctionManager *fm)
+{
+   frameOwner = fm;
+}
+
+
+//------------------------------------------------------------------------------
+// FunctionManager* GetFrameOwner()
+//------------------------------------------------------------------------------
+FunctionManager* UserDefinedFunction::GetFrameOwner()
+{
+   return frameOwner;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetFrameReused(bool reused)
+//------------------------------------------------------------------------------
+/**
+ * Sets the flag telling Execute() that the objects and commands are still
+ * initialized from the previous call.
+ */
+//------------------------------------------------------------------------------
+void UserDefinedFunction::SetFrameReused(bool reused)
+{
+   frameReused = reused;
+}
+
+
 //---------------------------------
 // protected
 //---------------------------------
+//------------------------------------------------------------------------------
+// bool IsSimpleSequence(GmatCommand *cmd, GmatCommand *endCmd)
+//------------------------------------------------------------------------------
+/**
+ * Checks that a command list holds only commands that keep no state between
+ * calls, descending into If, For and While blocks.
+ *
+ * @param cmd    The first command of the list
+ * @param endCmd The command ending the list; the owning branch command for
+ *               a branch, or NULL for the function control sequence
+ */
+//------------------------------------------------------------------------------
+bool UserDefinedFunction::IsSimpleSequence(GmatCommand *cmd, GmatCommand *endCmd)
+{
+   while (cmd != NULL && cmd != endCmd)
+   {
+      std::string cmdType = cmd->GetTypeName();
+      
+      if (cmd->IsOfType("BranchCommand"))
+      {
+         if (cmdType != "If" && cmdType != "For" && cmdType != "While")
+            return false;
+         
+         GmatCommand *child;
+         for (Integer i = 0; (child = cmd->GetChildCommand(i)) != NULL; ++i)
+            if (!IsSimpleSequence(child, cmd))
+               return false;
+      }
+      else if (cmdType == "GMAT")
+      {
+         // Nested function calls build frames of their own
+         MathTree *tree = ((Assignment*)cmd)->GetMathTree();
+         if (tree != NULL && (!tree->GetFunctions().empty() ||
+                              !tree->GetGmatFunctionNames().empty()))
+            return false;
+      }
+      else if (cmdType != "NoOp" && cmdType != "Create" && cmdType != "Global" &&
+               cmdType != "BeginMissionSequence" && cmdType != "Else" &&
+               cmdType != "EndIf" && cmdType != "EndFor" && cmdType != "EndWhile")
+         return false;
+      
+      cmd = cmd->GetNext();
+   }
+   
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // GmatBase* FindObject(const std::string &name)
 //------------------------------------------------------------------------------
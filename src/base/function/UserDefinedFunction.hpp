@@ -35,6 +35,8 @@
 
 #include "ObjectManagedFunction.hpp"
 
+class FunctionManager;
+
 class GMAT_API UserDefinedFunction : public ObjectManagedFunction
 {
 public:
@@ -66,6 +68,12 @@ public:
    virtual GmatBase*    FindAutomaticObject(const std::string &name);
    virtual ObjectMap*   GetAutomaticObjectMap();
    
+   // methods for reusing the call frame on repeated calls from one caller
+   virtual bool         IsFrameReusable();
+   void                 SetFrameOwner(FunctionManager *fm);
+   FunctionManager*     GetFrameOwner();
+   void                 SetFrameReused(bool reused);
+   
    DEFAULT_TO_NO_CLONES
    DEFAULT_TO_NO_REFOBJECTS
 
@@ -100,8 +108,13 @@ protected:
    
    /// the flag indicating local objects are initialized
    bool                 objectsInitialized;
+   /// the FunctionManager whose object store the function was last initialized with
+   FunctionManager      *frameOwner;
+   /// the flag indicating the current call reuses the initialized call frame
+   bool                 frameReused;
    
    GmatBase* FindObject(const std::string &name);
+   bool      IsSimpleSequence(GmatCommand *cmd, GmatCommand *endCmd);
    bool      IsAutomaticObjectGlobal(const std::string &autoObjName, GmatBase **owner);
    
    // for debug
@@ -261,11 +261,12 @@ std::string ChemicalTank::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ChemicalTank::GetParameterID(const std::string &str) const
 {
-   for (Integer i = FuelTankParamCount; i < ChemicalTankParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - FuelTankParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, FuelTankParamCount,
+               ChemicalTankParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return FuelTank::GetParameterID(str);
 }
@@ -108,7 +108,11 @@ ChemicalThruster::PARAMETER_TYPE[ChemicalThrusterParamCount - ThrusterParamCount
  */
 //------------------------------------------------------------------------------
 ChemicalThruster::ChemicalThruster(const std::string &nomme) :
-   Thruster             ("ChemicalThruster", nomme)
+   Thruster             ("ChemicalThruster", nomme),
+   tankIdSource         (NULL),
+   pressureId           (-1),
+   temperatureId        (-1),
+   refTemperatureId     (-1)
 {
    objectTypes.push_back(Gmat::CHEMICAL_THRUSTER);
    objectTypeNames.push_back("ChemicalThruster");
@@ -189,7 +193,11 @@ ChemicalThruster::~ChemicalThruster()
  */
 //------------------------------------------------------------------------------
 ChemicalThruster::ChemicalThruster(const ChemicalThruster& th) :
-   Thruster             (th)
+   Thruster             (th),
+   tankIdSource         (NULL),
+   pressureId           (-1),
+   temperatureId        (-1),
+   refTemperatureId     (-1)
 {
    #ifdef DEBUG_CHEMICAL_THRUSTER_CONSTRUCTOR
    MessageInterface::ShowMessage
@@ -236,7 +244,7 @@ ChemicalThruster& ChemicalThruster::operator=(const ChemicalThruster& th)
 
    memcpy(cCoefficients, th.cCoefficients, COEFFICIENT_COUNT * sizeof(Real));
    memcpy(kCoefficients, th.kCoefficients, COEFFICIENT_COUNT * sizeof(Real));
-
+   tankIdSource = NULL;
 
    #ifdef DEBUG_CHEMICAL_THRUSTER_CONSTRUCTOR
    MessageInterface::ShowMessage("ChemicalThruster::operator= exiting\n");
@@ -311,11 +319,12 @@ std::string ChemicalThruster::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ChemicalThruster::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ThrusterParamCount; i < ChemicalThrusterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ThrusterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ThrusterParamCount,
+               ChemicalThrusterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Thruster::GetParameterID(str);
 }
@@ -803,10 +812,18 @@ bool ChemicalThruster::CalculateThrustAndIsp()
          throw HardwareException("ChemicalThruster \"" + instanceName +
                                  "\" does not have a fuel tank");
 
-      // Require that the tanks all be at the same pressure and temperature
-      Integer pressID = tanks[0]->GetParameterID("Pressure");
-      Integer tempID = tanks[0]->GetParameterID("Temperature");
-      Integer refTempID = tanks[0]->GetParameterID("RefTemperature");
+      // Require that the tanks all be at the same pressure and temperature.
+      // The IDs are looked up once per tank rather than on every evaluation.
+      if (tanks[0] != tankIdSource)
+      {
+         pressureId       = tanks[0]->GetParameterID("Pressure");
+         temperatureId    = tanks[0]->GetParameterID("Temperature");
+         refTemperatureId = tanks[0]->GetParameterID("RefTemperature");
+         tankIdSource     = tanks[0];
+      }
+      Integer pressID = pressureId;
+      Integer tempID = temperatureId;
+      Integer refTempID = refTemperatureId;
 
 //      pressure = tanks[0]->GetRealParameter(pressID);
 //      temperatureRatio = tanks[0]->GetRealParameter(tempID) /
@@ -80,6 +80,14 @@ protected:
    Real                       cCoefficients[COEFFICIENT_COUNT];
    /// Array of specific impulse coefficients
    Real                       kCoefficients[COEFFICIENT_COUNT];
+   /// Tank whose parameter IDs are held in the IDs below
+   FuelTank                   *tankIdSource;
+   /// Tank parameter ID for Pressure
+   Integer                    pressureId;
+   /// Tank parameter ID for Temperature
+   Integer                    temperatureId;
+   /// Tank parameter ID for RefTemperature
+   Integer                    refTemperatureId;
 
    /// C-coefficient units
    static  StringArray        cCoefUnits;
@@ -257,11 +257,12 @@ std::string ConicalFOV::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ConicalFOV::GetParameterID(const std::string &str) const
 {
-   for (Integer i = FieldOfViewParamCount; i < ConicalFOVParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - FieldOfViewParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, FieldOfViewParamCount,
+               ConicalFOVParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return FieldOfView::GetParameterID(str);
 }
@@ -87,8 +87,10 @@ CustomFOV::CustomFOV(const std::string &itsName) :
    minXExcursion (0),
    maxYExcursion (0),
    minYExcursion(0),
+   isInitialized (false),
    fovFileName  (""),
-   isInitialized (false)
+   gridCellX    (0.0),
+   gridCellY    (0.0)
 {
    parameterCount = CustomFOVParamCount;
    objectTypes.push_back(Gmat::CUSTOM_FOV);
@@ -169,6 +171,10 @@ CustomFOV::CustomFOV(const CustomFOV &copy) :
    isClockCone = copy.isClockCone;
    interpolationSize = copy.interpolationSize;
    pointsInterpolated = copy.pointsInterpolated;
+   visibilityGrid = copy.visibilityGrid;
+   boundaryCellSum = copy.boundaryCellSum;
+   gridCellX = copy.gridCellX;
+   gridCellY = copy.gridCellY;
    isInitialized = copy.isInitialized;
 }
 
@@ -237,6 +243,10 @@ CustomFOV& CustomFOV::operator= (const CustomFOV &copy)
    interpolationSize = copy.interpolationSize;
    pointsInterpolated = copy.pointsInterpolated;
    isClockCone = copy.isClockCone;
+   visibilityGrid = copy.visibilityGrid;
+   boundaryCellSum = copy.boundaryCellSum;
+   gridCellX = copy.gridCellX;
+   gridCellY = copy.gridCellY;
    isInitialized = copy.isInitialized;
 	return *this;
 }
@@ -434,6 +444,7 @@ bool CustomFOV::Initialize()
 	// want to make it an input parameter to the constructor if this can vary
    numTestPoints = 3;
    ComputeExternalPoints();
+   BuildVisibilityGrid();
 
    #ifdef DEBUG_CUSTOM_FOV
       MessageInterface::ShowMessage(
@@ -484,90 +495,122 @@ bool CustomFOV::CheckTargetVisibility(Real viewConeAngle,Real viewClockAngle)
 	   possiblyInView = false;
 
 	// we've executed the quick tests, if point is possibly in the FOV
-	// then run a line intersection test to determine if it is or not
+	// then look it up in the visibility grid, and run a line intersection
+	// test if it is in a cell the FOV boundary may pass through
    bool inView;
    if (!possiblyInView)
 	   inView = false;
    else
    {
-	   // outputs of LineSegmentIntersect
-	   Rmatrix distanceMatrix(numTestPoints, 1); //used in validation
-	   std::vector<IntegerArray> adjacency; // used in counting crossings
-
-		// outputs not used in visibility check
-		Rmatrix huey(numTestPoints, 1);
-		Rmatrix dewey(numTestPoints, 1);
-		Rmatrix louie(numTestPoints, 1);
-		std::vector<IntegerArray> romulus, remus;
-
-		// vectors of integer arrays have to be loaded to allocate memory
-		// N - vector where each element is an integer array of 1 element
-		IntegerArray row;
-		row.push_back(0);
-		for (int i = 0; i < numTestPoints; i++)
-		{
-			adjacency.push_back(row);
-			romulus.push_back(row);
-			remus.push_back(row);
-		}
+      Integer cell = CELL_BOUNDARY;
+      if (!visibilityGrid.empty())
+         cell = visibilityGrid[
+               GetGridCellIndex(xCoord, minXExcursion, gridCellX) *
+               VISIBILITY_GRID_SIZE +
+               GetGridCellIndex(yCoord, minYExcursion, gridCellY)];
+
+      if (cell == CELL_INSIDE)
+         inView = true;
+      else if (cell == CELL_OUTSIDE)
+         inView = false;
+      else
+         inView = CheckTargetCrossings(xCoord, yCoord);
+   }
+   return inView;
+}
 
-		//  other declarations
-		Real distance;
-		Real distTol = 1.0e-12;
-		Rmatrix lineSeg(1, 4);
-		bool foundValidPoint = false;
+//------------------------------------------------------------------------------
+// bool CheckTargetCrossings(Real xCoord, Real yCoord)
+//------------------------------------------------------------------------------
+/*
+ * Determines if a point in the stereographic projection is in the FOV by
+ * counting the FOV boundary crossings of a line to an external point
+ *
+ * @param   xCoord   x coordinate for point being tested
+ * @param   yCoord   y coordinate for point being tested
+ * @return  returns true if point is within the FOV
+ */
+//------------------------------------------------------------------------------
+bool CustomFOV::CheckTargetCrossings(Real xCoord, Real yCoord)
+{
+   bool inView;
+   // outputs of LineSegmentIntersect
+   Rmatrix distanceMatrix(numTestPoints, 1); //used in validation
+   std::vector<IntegerArray> adjacency; // used in counting crossings
+
+	// outputs not used in visibility check
+	Rmatrix huey(numTestPoints, 1);
+	Rmatrix dewey(numTestPoints, 1);
+	Rmatrix louie(numTestPoints, 1);
+	std::vector<IntegerArray> romulus, remus;
+
+	// vectors of integer arrays have to be loaded to allocate memory
+	// N - vector where each element is an integer array of 1 element
+	IntegerArray row;
+	row.push_back(0);
+	for (int i = 0; i < numTestPoints; i++)
+	{
+		adjacency.push_back(row);
+		romulus.push_back(row);
+		remus.push_back(row);
+	}
+
+	//  other declarations
+	Real distance;
+	Real distTol = 1.0e-12;
+	Rmatrix lineSeg(1, 4);
+	bool foundValidPoint = false;
 
-		// valid point test:
-		// See if there is at least 1 valid external point
-		for (int i = 0; i < numTestPoints; i++)
+	// valid point test:
+	// See if there is at least 1 valid external point
+	for (int i = 0; i < numTestPoints; i++)
+	{
+		// lineSeg = (xCoord, yCoord, externalPointArray.GetElement(i,0),
+	   // externalPointArray.GetElement(i,1));
+		lineSeg.SetElement(0, 0, xCoord);
+		lineSeg.SetElement(0, 1, yCoord);
+		lineSeg.SetElement(0, 2, externalPointArray.GetElement(i, 0));
+		lineSeg.SetElement(0, 3, externalPointArray.GetElement(i, 1));
+		LineSegmentIntersect(segmentArray, lineSeg, adjacency,huey, dewey,
+                           louie, distanceMatrix, romulus, remus);
+
+		// loop exits on finding first valid point or finding none at all
+		// distance matrix computed by LineSegmentIntersect is a
+		// numFOVpoints x 1 matrix
+		for (int j = 0; j < numFOVPoints; j++)
 		{
-			// lineSeg = (xCoord, yCoord, externalPointArray.GetElement(i,0),
-		   // externalPointArray.GetElement(i,1));
-			lineSeg.SetElement(0, 0, xCoord);
-			lineSeg.SetElement(0, 1, yCoord);
-			lineSeg.SetElement(0, 2, externalPointArray.GetElement(i, 0));
-			lineSeg.SetElement(0, 3, externalPointArray.GetElement(i, 1));
-			LineSegmentIntersect(segmentArray, lineSeg, adjacency,huey, dewey,
-                              louie, distanceMatrix, romulus, remus);
-
-			// loop exits on finding first valid point or finding none at all
-			// distance matrix computed by LineSegmentIntersect is a
-			// numFOVpoints x 1 matrix
-			for (int j = 0; j < numFOVPoints; j++)
+			distance = distanceMatrix.GetElement(j, 0);
+			if (!(abs(distance) <= distTol || abs(distance - 1.0) <= distTol))
 			{
-				distance = distanceMatrix.GetElement(j, 0);
-				if (!(abs(distance) <= distTol || abs(distance - 1.0) <= distTol))
-				{
-					foundValidPoint = true;
-					break;
-				}
+				foundValidPoint = true;
+				break;
 			}
-			if (foundValidPoint) break;
+		}
+		if (foundValidPoint) break;
 
-		} // valid point test
+	} // valid point test
 
-		// count crossings by iterating across the (numFOVpoints x 1)
-		// adjacency matrix, use result to determine if point is in FOV
-		if (foundValidPoint)
-		{
-			Integer numCrossings = 0;
-			for (int i = 0; i < numFOVPoints; i++)
-				if (adjacency[i][0] == 1)
-					numCrossings++;
-			if (numCrossings % 2 == 1)
-				inView = true;
-			else
-				inView = false;
-		}
+	// count crossings by iterating across the (numFOVpoints x 1)
+	// adjacency matrix, use result to determine if point is in FOV
+	if (foundValidPoint)
+	{
+		Integer numCrossings = 0;
+		for (int i = 0; i < numFOVPoints; i++)
+			if (adjacency[i][0] == 1)
+				numCrossings++;
+		if (numCrossings % 2 == 1)
+			inView = true;
 		else
-		{
-         #ifdef DEBUG_CUSTOM_FOV
-            MessageInterface::ShowMessage(
-                     "Internal Error: No valid external point was found");
-         #endif // DEBUG_CUSTOM_FOV
 			inView = false;
-		}
-   } // line intersection test
+	}
+	else
+	{
+      #ifdef DEBUG_CUSTOM_FOV
+         MessageInterface::ShowMessage(
+                  "Internal Error: No valid external point was found");
+      #endif // DEBUG_CUSTOM_FOV
+		inView = false;
+	}
    return inView;
 }
 
@@ -659,8 +702,39 @@ bool CustomFOV::CheckRegionVisibility(const Rvector &coneAngleVector,const Rvect
       MessageInterface::ShowMessage("DEBUG: calling intersect routine\n");
    #endif
 
+   // Only region segments that may reach a grid cell the FOV boundary
+   // passes through can cross the FOV boundary
+   const Rmatrix *regionSegments = &lineSegArray;
+   Rmatrix candidates;
+   if (!visibilityGrid.empty())
+   {
+      IntegerArray nearBoundary;
+      for (Integer i = 0; i < size; i++)
+      {
+         if (SegmentNearBoundary(lineSegArray(i, 0), lineSegArray(i, 1),
+               lineSegArray(i, 2), lineSegArray(i, 3)))
+            nearBoundary.push_back(i);
+      }
+
+      #ifdef DEBUG_CUSTOM_FOV
+         MessageInterface::ShowMessage("DEBUG: %d of %d region segments are "
+               "near the FOV boundary\n", (Integer)nearBoundary.size(), size);
+      #endif
+
+      if (nearBoundary.empty())
+         return true;
+      if ((Integer)nearBoundary.size() < size)
+      {
+         candidates.SetSize(nearBoundary.size(), 4);
+         for (UnsignedInt i = 0; i < nearBoundary.size(); i++)
+            for (Integer j = 0; j < 4; j++)
+               candidates(i, j) = lineSegArray(nearBoundary[i], j);
+         regionSegments = &candidates;
+      }
+   }
+
 	// get adjacency matrix for containment test
-	LineSegmentIntersect(segmentArray, lineSegArray, adjacency,matrixX, matrixY, d1To2, d2To1,
+	LineSegmentIntersect(segmentArray, *regionSegments, adjacency,matrixX, matrixY, d1To2, d2To1,
 		                 parallel, coincident);
    #ifdef DEBUG_CUSTOM_FOV
       MessageInterface::ShowMessage("DEBUG:Returned from intersect routine\n");
@@ -737,11 +811,12 @@ std::string CustomFOV::GetParameterText(const Integer id) const
  //------------------------------------------------------------------------------
 Integer CustomFOV::GetParameterID(const std::string &str) const
 {
-	for (Integer i = FieldOfViewParamCount; i < CustomFOVParamCount; i++)
-	{
-		if (str == PARAMETER_TEXT[i - FieldOfViewParamCount])
-			return i;
-	}
+	static const ParameterIndex
+	      parameterIndex(PARAMETER_TEXT, FieldOfViewParamCount,
+	            CustomFOVParamCount);
+	Integer parameterId = parameterIndex.Find(str);
+	if (parameterId != -1)
+	   return parameterId;
 	return FieldOfView::GetParameterID(str);
 }
 
@@ -1833,6 +1908,183 @@ void CustomFOV::ComputeExternalPoints()
    #endif
 }
 
+//------------------------------------------------------------------------------
+// void BuildVisibilityGrid()
+//------------------------------------------------------------------------------
+/*
+ * Classifies the cells of a grid over the stereographic bounding box as
+ * inside, outside, or on the FOV boundary
+ *
+ * Cells a FOV segment passes through, or nearly touches, are boundary cells.  The
+ * other cells are grouped into sets connected through shared edges; no FOV
+ * segment separates the cells of a set, so the whole set is inside or
+ * outside the FOV.  Each set is classified with the line intersection test
+ * at two points, and is left as boundary cells if the tests disagree.
+ * Points in inside or outside cells are then classified without a line
+ * intersection test.
+ */
+//------------------------------------------------------------------------------
+void CustomFOV::BuildVisibilityGrid()
+{
+   const Integer N = VISIBILITY_GRID_SIZE;
+   visibilityGrid.clear();
+   boundaryCellSum.clear();
+
+   gridCellX = (maxXExcursion - minXExcursion) / N;
+   gridCellY = (maxYExcursion - minYExcursion) / N;
+   if ((gridCellX <= 0.0) || (gridCellY <= 0.0) || (numTestPoints == 0))
+      return;
+
+   // Mark the boundary cells, with a margin well above the tolerances of
+   // the line intersection test
+   Real marginX = 1.0e-6 * gridCellX;
+   Real marginY = 1.0e-6 * gridCellY;
+   IntegerArray grid(N * N, -1);
+   for (Integer i = 0; i < numFOVPoints; i++)
+   {
+      Real x1 = segmentArray(i, 0), y1 = segmentArray(i, 1);
+      Real x2 = segmentArray(i, 2), y2 = segmentArray(i, 3);
+      Integer i0 = GetGridCellIndex((x1 < x2 ? x1 : x2) - marginX, minXExcursion, gridCellX);
+      Integer i1 = GetGridCellIndex((x1 > x2 ? x1 : x2) + marginX, minXExcursion, gridCellX);
+      Integer j0 = GetGridCellIndex((y1 < y2 ? y1 : y2) - marginY, minYExcursion, gridCellY);
+      Integer j1 = GetGridCellIndex((y1 > y2 ? y1 : y2) + marginY, minYExcursion, gridCellY);
+      for (Integer ii = i0; ii <= i1; ii++)
+      {
+         Real cx0 = minXExcursion + ii * gridCellX - marginX;
+         Real cx1 = cx0 + gridCellX + 2.0 * marginX;
+         for (Integer jj = j0; jj <= j1; jj++)
+         {
+            // Skip cells whose corners are all on one side of the segment
+            Real cy0 = minYExcursion + jj * gridCellY - marginY;
+            Real cy1 = cy0 + gridCellY + 2.0 * marginY;
+            Real s00 = (x2 - x1) * (cy0 - y1) - (y2 - y1) * (cx0 - x1);
+            Real s01 = (x2 - x1) * (cy1 - y1) - (y2 - y1) * (cx0 - x1);
+            Real s10 = (x2 - x1) * (cy0 - y1) - (y2 - y1) * (cx1 - x1);
+            Real s11 = (x2 - x1) * (cy1 - y1) - (y2 - y1) * (cx1 - x1);
+            if (((s00 > 0.0) && (s01 > 0.0) && (s10 > 0.0) && (s11 > 0.0)) ||
+                ((s00 < 0.0) && (s01 < 0.0) && (s10 < 0.0) && (s11 < 0.0)))
+               continue;
+            grid[ii * N + jj] = CELL_BOUNDARY;
+         }
+      }
+   }
+
+   // Classify each connected set of the other cells
+   IntegerArray members;
+   for (Integer start = 0; start < N * N; start++)
+   {
+      if (grid[start] != -1)
+         continue;
+
+      members.clear();
+      members.push_back(start);
+      grid[start] = CELL_BOUNDARY + 1;    // visited
+      for (UnsignedInt k = 0; k < members.size(); k++)
+      {
+         Integer ii = members[k] / N, jj = members[k] % N;
+         Integer neighbors[4] = { (ii > 0     ? members[k] - N : -1),
+                                  (ii < N - 1 ? members[k] + N : -1),
+                                  (jj > 0     ? members[k] - 1 : -1),
+                                  (jj < N - 1 ? members[k] + 1 : -1) };
+         for (Integer n = 0; n < 4; n++)
+         {
+            if ((neighbors[n] >= 0) && (grid[neighbors[n]] == -1))
+            {
+               grid[neighbors[n]] = CELL_BOUNDARY + 1;
+               members.push_back(neighbors[n]);
+            }
+         }
+      }
+
+      Integer ii = start / N, jj = start % N;
+      Real x = minXExcursion + (ii + 0.5) * gridCellX;
+      Real y = minYExcursion + (jj + 0.5) * gridCellY;
+      bool centerInView = CheckTargetCrossings(x, y);
+      bool offsetInView = CheckTargetCrossings(x + 0.25 * gridCellX,
+                                               y + 0.125 * gridCellY);
+      Integer cell = CELL_BOUNDARY;
+      if (centerInView == offsetInView)
+         cell = (centerInView ? CELL_INSIDE : CELL_OUTSIDE);
+
+      for (UnsignedInt k = 0; k < members.size(); k++)
+         grid[members[k]] = cell;
+
+      #ifdef DEBUG_CUSTOM_FOV
+         MessageInterface::ShowMessage("DEBUG: grid set of %d cells at (%d, "
+               "%d) classified as %d\n", (Integer)members.size(), ii, jj, cell);
+      #endif
+   }
+
+   // Running count of boundary cells used by SegmentNearBoundary()
+   boundaryCellSum.assign((N + 1) * (N + 1), 0);
+   for (Integer ii = 0; ii < N; ii++)
+      for (Integer jj = 0; jj < N; jj++)
+         boundaryCellSum[(ii + 1) * (N + 1) + jj + 1] =
+               (grid[ii * N + jj] == CELL_BOUNDARY ? 1 : 0) +
+               boundaryCellSum[ii * (N + 1) + jj + 1] +
+               boundaryCellSum[(ii + 1) * (N + 1) + jj] -
+               boundaryCellSum[ii * (N + 1) + jj];
+
+   visibilityGrid = grid;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetGridCellIndex(Real coord, Real minCoord, Real cellSize)
+//------------------------------------------------------------------------------
+/*
+ * Returns the visibility grid row or column containing a coordinate, limited
+ * to the grid
+ *
+ * @param   coord      x or y coordinate in the stereographic projection
+ * @param   minCoord   minimum FOV excursion in that coordinate
+ * @param   cellSize   grid cell size in that coordinate
+ * @return  grid row (x) or column (y) index
+ */
+//------------------------------------------------------------------------------
+Integer CustomFOV::GetGridCellIndex(Real coord, Real minCoord, Real cellSize)
+{
+   Real index = GmatMathUtil::Floor((coord - minCoord) / cellSize);
+   if (index < 0.0)
+      return 0;
+   if (index > VISIBILITY_GRID_SIZE - 1)
+      return VISIBILITY_GRID_SIZE - 1;
+   return (Integer)index;
+}
+
+//------------------------------------------------------------------------------
+// bool SegmentNearBoundary(Real x1, Real y1, Real x2, Real y2)
+//------------------------------------------------------------------------------
+/*
+ * Determines if a line segment in the stereographic projection may intersect
+ * the FOV boundary, by checking its bounding box for boundary grid cells
+ *
+ * @param   x1, y1   start point of the segment
+ * @param   x2, y2   end point of the segment
+ * @return  false if the segment cannot intersect a FOV segment
+ */
+//------------------------------------------------------------------------------
+bool CustomFOV::SegmentNearBoundary(Real x1, Real y1, Real x2, Real y2)
+{
+   // The FOV boundary lies inside the stereographic bounding box
+   if (((x1 < minXExcursion) && (x2 < minXExcursion)) ||
+       ((x1 > maxXExcursion) && (x2 > maxXExcursion)) ||
+       ((y1 < minYExcursion) && (y2 < minYExcursion)) ||
+       ((y1 > maxYExcursion) && (y2 > maxYExcursion)))
+      return false;
+
+   const Integer N = VISIBILITY_GRID_SIZE;
+   Integer i0 = GetGridCellIndex((x1 < x2 ? x1 : x2), minXExcursion, gridCellX);
+   Integer i1 = GetGridCellIndex((x1 > x2 ? x1 : x2), minXExcursion, gridCellX);
+   Integer j0 = GetGridCellIndex((y1 < y2 ? y1 : y2), minYExcursion, gridCellY);
+   Integer j1 = GetGridCellIndex((y1 > y2 ? y1 : y2), minYExcursion, gridCellY);
+
+   Integer count = boundaryCellSum[(i1 + 1) * (N + 1) + j1 + 1] -
+                   boundaryCellSum[i0 * (N + 1) + j1 + 1] -
+                   boundaryCellSum[(i1 + 1) * (N + 1) + j0] +
+                   boundaryCellSum[i0 * (N + 1) + j0];
+   return (count > 0);
+}
+
 //------------------------------------------------------------------------------
 // bool RegionIsFullyContained (std::vector<IntegerArray &adjacency);
 //------------------------------------------------------------------------------
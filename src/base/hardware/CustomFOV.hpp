@@ -130,6 +130,26 @@ protected:
 
    Real interpolationSize = 0.2* GmatMathConstants::RAD_PER_DEG;
 	std::string  fovFileName;
+
+   /// Classification of the cells of a grid over the stereographic bounding
+   /// box: CELL_INSIDE, CELL_OUTSIDE, or CELL_BOUNDARY for cells that a FOV
+   /// segment may touch; empty when no grid could be built
+   IntegerArray visibilityGrid;
+   /// Number of boundary cells in the grid rows and columns before each
+   /// (row, column) pair, (VISIBILITY_GRID_SIZE + 1)^2 entries
+   IntegerArray boundaryCellSum;
+   /// Grid cell size in the stereographic x and y directions
+   Real gridCellX;
+   Real gridCellY;
+
+   /// Number of grid cells along each side of the bounding box
+   static const Integer VISIBILITY_GRID_SIZE = 64;
+   enum GridCell
+   {
+      CELL_OUTSIDE = 0,
+      CELL_INSIDE,
+      CELL_BOUNDARY
+   };
 	
 	// protected methods
     ///  Reads cone and clock angle from a file
@@ -139,6 +159,10 @@ protected:
    bool CheckTargetMaxExcursionCoordinates(Real xCoord, Real yCoord);
    Rmatrix PointsToSegments(const Rvector &xCoords, const Rvector &yCoords);
    void ComputeExternalPoints();
+   void BuildVisibilityGrid();
+   bool CheckTargetCrossings(Real xCoord, Real yCoord);
+   Integer GetGridCellIndex(Real coord, Real minCoord, Real cellSize);
+   bool SegmentNearBoundary(Real x1, Real y1, Real x2, Real y2);
 
    /// helper methods for checkRegionVisibility()
    bool RegionIsFullyContained(std::vector<IntegerArray> &adjacency);
@@ -358,11 +358,12 @@ std::string ElectricThruster::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElectricThruster::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ThrusterParamCount; i < ElectricThrusterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ThrusterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ThrusterParamCount,
+               ElectricThrusterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Thruster::GetParameterID(str);
 }
@@ -181,11 +181,12 @@ std::string FieldOfView::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer FieldOfView::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < FieldOfViewParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               FieldOfViewParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatBase::GetParameterID(str);
 }
@@ -256,11 +256,11 @@ std::string FuelTank::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer FuelTank::GetParameterID(const std::string &str) const
 {
-   for (Integer i = HardwareParamCount; i < FuelTankParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - HardwareParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, HardwareParamCount, FuelTankParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Hardware::GetParameterID(str);
 }
@@ -484,11 +484,11 @@ std::string Hardware::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Hardware::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < HardwareParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount, HardwareParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatBase::GetParameterID(str);
 }
@@ -233,11 +233,11 @@ std::string Imager::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Imager::GetParameterID(const std::string &str) const
 {
-   for (Integer i = HardwareParamCount; i < ImagerParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - HardwareParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, HardwareParamCount, ImagerParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Hardware::GetParameterID(str);
 }
@@ -109,7 +109,12 @@ PowerSystem::PowerSystem(const std::string &systemType, const std::string &nomme
    sun                  (NULL),
    spacecraft           (NULL),
    scOrigin             (NULL),
-   sunRadius            (GmatSolarSystemDefaults::STAR_EQUATORIAL_RADIUS)
+   sunRadius            (GmatSolarSystemDefaults::STAR_EQUATORIAL_RADIUS),
+   powerCacheValid      (false),
+   powerCacheEpoch      (-1.0),
+   cachedPowerGenerated (0.0),
+   cachedBusPower       (0.0),
+   cachedThrustPower    (0.0)
 {
    objectTypes.push_back(Gmat::POWER_SYSTEM);
    objectTypeNames.push_back("PowerSystem");
@@ -160,7 +165,12 @@ PowerSystem::PowerSystem(const PowerSystem& copy) :
    sun                  (NULL),
    spacecraft           (NULL),
    scOrigin             (NULL),
-   sunRadius            (copy.sunRadius)
+   sunRadius            (copy.sunRadius),
+   powerCacheValid      (false),
+   powerCacheEpoch      (-1.0),
+   cachedPowerGenerated (0.0),
+   cachedBusPower       (0.0),
+   cachedThrustPower    (0.0)
 {
    theTimeConverter = copy.theTimeConverter;
    for (Integer i = HardwareParamCount; i < PowerSystemParamCount; ++i)
@@ -204,6 +214,7 @@ PowerSystem& PowerSystem::operator=(const PowerSystem& copy)
       scOrigin              = NULL;
       sunRadius             = copy.sunRadius;
       theTimeConverter      = copy.theTimeConverter;
+      InvalidatePowerCache();
    }
 
    return *this;
@@ -232,6 +243,7 @@ bool PowerSystem::Initialize()
 
 //   initialEp   = EpochToReal(initialEpoch);  // already done
 
+   InvalidatePowerCache();
    isInitialized = true;
 
    return isInitialized;
@@ -258,6 +270,7 @@ void PowerSystem::Copy(const GmatBase* orig)
 //------------------------------------------------------------------------------
 void PowerSystem::SetSolarSystem(SolarSystem *ss)
 {
+   InvalidatePowerCache();
    solarSystem = ss;
    sun         = solarSystem->GetBody(GmatSolarSystemDefaults::SUN_NAME);
    sunRadius   = sun->GetEquatorialRadius();
@@ -274,6 +287,7 @@ void PowerSystem::SetSpacecraft(Spacecraft *sc)
       errmsg += instanceName + ": sc is NULL\n";
       throw HardwareException(errmsg);
    }
+   InvalidatePowerCache();
    spacecraft = sc;
    scOrigin   = sc->GetOrigin();
 }
@@ -335,20 +349,13 @@ Real PowerSystem::GetSpacecraftBusPower() const
 //------------------------------------------------------------------------------
 Real PowerSystem::GetThrustPower() const
 {
-   Real atEpoch        = spacecraft->GetEpoch();
-   Real powerGenerated = GetPowerGenerated();
-   Real busPower       = GetSpacecraftBusPower();
-
-   //  Englander: Eq. 16
-   Real powerAvailable = (1-margin /100.00) * (powerGenerated - busPower);
-   if (powerAvailable < 0)
-       powerAvailable = 0;
+   UpdatePowerCache();
    #ifdef DEBUG_POWER_SYSTEM
       MessageInterface::ShowMessage(
             "In PowerSystem::GetThrustPower, powerAvailable = %12.10f\n",
-            powerAvailable);
+            cachedThrustPower);
    #endif
-   return powerAvailable;
+   return cachedThrustPower;
 }
 
 //------------------------------------------------------------------------------
@@ -362,6 +369,8 @@ Real PowerSystem::GetThrustPower() const
 //------------------------------------------------------------------------------
 void PowerSystem::SetEpoch(const std::string &ep)
 {
+   InvalidatePowerCache();
+
    #ifdef DEBUG_DATE_FORMAT
    MessageInterface::ShowMessage
       ("PowerSystem::SetEpoch() Setting epoch  for spacecraft %s to %s\n",
@@ -472,11 +481,12 @@ std::string PowerSystem::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PowerSystem::GetParameterID(const std::string &str) const
 {
-   for (Integer i = HardwareParamCount; i < PowerSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - HardwareParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, HardwareParamCount,
+               PowerSystemParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Hardware::GetParameterID(str);
 }
@@ -600,10 +610,12 @@ Real PowerSystem::GetRealParameter(const Integer id) const
          return busCoeff3;
 
       case TOTAL_POWER_AVAILABLE:
-         return GetPowerGenerated();
+         UpdatePowerCache();
+         return cachedPowerGenerated;
 
       case REQUIRED_BUS_POWER:
-         return GetSpacecraftBusPower();
+         UpdatePowerCache();
+         return cachedBusPower;
 
       case THRUST_POWER_AVAILABLE:
          return GetThrustPower();
@@ -636,6 +648,7 @@ Real PowerSystem::SetRealParameter(const Integer id, const Real value)
    MessageInterface::ShowMessage
       ("PowerSystem::SetRealParameter(), id=%d, value=%f\n", id, value);
    #endif
+   InvalidatePowerCache();
 
    switch (id)
    {
@@ -750,6 +763,7 @@ bool PowerSystem::SetStringParameter(const Integer id, const std::string &value)
       ("PowerSystem::SetStringParameter() entered, id=%d, value='%s'\n", id,
        value.c_str());
    #endif
+   InvalidatePowerCache();
 
    if (id == EPOCH_FORMAT)
    {
@@ -812,7 +826,7 @@ bool PowerSystem::SetStringParameter(const Integer id,
                                      const std::string &value,
                                      const Integer index)
 {
-
+   InvalidatePowerCache();
    return Hardware::SetStringParameter(id, value, index);
 }
 
@@ -901,3 +915,59 @@ Real PowerSystem::GetSunToSCDistance(Real atEpoch) const
    return sunSCDist;
 }
 
+
+//------------------------------------------------------------------------------
+//  void UpdatePowerCache() const
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the generated, bus and thrust power for the current spacecraft
+ * state, unless they were already evaluated at that state.
+ *
+ * The power models depend only on the spacecraft epoch and position, so the
+ * values (and the shadow geometry behind them) are reused while those are
+ * unchanged.  Finite burns ask once per thruster set and per reported
+ * parameter at the same state, which previously repeated the eclipse
+ * computation each time.
+ */
+//------------------------------------------------------------------------------
+void PowerSystem::UpdatePowerCache() const
+{
+   Real atEpoch  = spacecraft->GetEpoch();
+   Real *state   = (spacecraft->GetState()).GetState();
+
+   if (powerCacheValid && (atEpoch == powerCacheEpoch) &&
+       (state[0] == powerCachePosition[0]) &&
+       (state[1] == powerCachePosition[1]) &&
+       (state[2] == powerCachePosition[2]))
+      return;
+
+   Real powerGenerated = GetPowerGenerated();
+   Real busPower       = GetSpacecraftBusPower();
+
+   //  Englander: Eq. 16
+   Real powerAvailable = (1-margin /100.00) * (powerGenerated - busPower);
+   if (powerAvailable < 0)
+       powerAvailable = 0;
+
+   cachedPowerGenerated  = powerGenerated;
+   cachedBusPower        = busPower;
+   cachedThrustPower     = powerAvailable;
+   powerCacheEpoch       = atEpoch;
+   powerCachePosition[0] = state[0];
+   powerCachePosition[1] = state[1];
+   powerCachePosition[2] = state[2];
+   powerCacheValid       = true;
+}
+
+
+//------------------------------------------------------------------------------
+//  void InvalidatePowerCache()
+//------------------------------------------------------------------------------
+/**
+ * Marks the cached power values stale; called when a model setting changes.
+ */
+//------------------------------------------------------------------------------
+void PowerSystem::InvalidatePowerCache()
+{
+   powerCacheValid = false;
+}
@@ -132,6 +132,19 @@ protected:
    /// Time converter singleton
    TimeSystemConverter *theTimeConverter;
 
+   /// Flag indicating that the cached power values below are usable
+   mutable bool        powerCacheValid;
+   /// Spacecraft epoch of the cached power values
+   mutable Real        powerCacheEpoch;
+   /// Spacecraft position of the cached power values
+   mutable Real        powerCachePosition[3];
+   /// Cached total power generated
+   mutable Real        cachedPowerGenerated;
+   /// Cached bus power required
+   mutable Real        cachedBusPower;
+   /// Cached power available for thrusting
+   mutable Real        cachedThrustPower;
+
    /// Published parameters for all power systems
    enum
    {
@@ -159,6 +172,8 @@ protected:
 
    Real EpochToReal(const std::string &ep);
    Real GetSunToSCDistance(Real atEpoch) const;
+   void UpdatePowerCache() const;
+   void InvalidatePowerCache();
 
 };
 
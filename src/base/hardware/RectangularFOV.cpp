@@ -312,11 +312,12 @@ std::string RectangularFOV::GetParameterText(const Integer id) const
  //------------------------------------------------------------------------------
 Integer RectangularFOV::GetParameterID(const std::string &str) const
 {
-	for (Integer i = FieldOfViewParamCount; i < RectangleFOVParamCount; i++)
-	{
-		if (str == PARAMETER_TEXT[i - FieldOfViewParamCount])
-			return i;
-	}
+	static const ParameterIndex
+	      parameterIndex(PARAMETER_TEXT, FieldOfViewParamCount,
+	            RectangleFOVParamCount);
+	Integer parameterId = parameterIndex.Find(str);
+	if (parameterId != -1)
+	   return parameterId;
 
 	return FieldOfView::GetParameterID(str);
 }
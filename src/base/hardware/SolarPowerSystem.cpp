@@ -355,6 +355,7 @@ bool SolarPowerSystem::TakeAction(const std::string &action,
 {
    if (action == "ClearShadowBodies")
    {
+      InvalidatePowerCache();
       shadowBodyNames.clear();
       shadowBodies.clear();
    }
@@ -420,95 +421,45 @@ Real SolarPowerSystem::GetPowerGenerated() const
    Real percentSunAll = 1;
    if ((shadowModel != "None") && !shadowBodies.empty())
    {
-      bool lit           = true;
-      bool dark          = false;
       Rvector3  sunPos   = sun->GetMJ2000Position(atEpoch); // relative to Earth
       Rvector3  cbPos    = scOrigin->GetMJ2000Position(atEpoch); // relative to Earth
-      Real      bodySunVector[3];
-      Real      state[3];
-      Real      sunSat[3];
-      Real      force[3];
-      Rvector3  stateRelToOrigin(stateRelToEarth[0] - cbPos[0],
-                                 stateRelToEarth[1] - cbPos[1],
-                                 stateRelToEarth[2] - cbPos[2]);
-
-      for (unsigned int jj = 0; jj < shadowBodies.size(); jj++)
+      Real      state[3] = {stateRelToEarth[0] - cbPos[0],
+                            stateRelToEarth[1] - cbPos[1],
+                            stateRelToEarth[2] - cbPos[2]};
+      Real      sunRelToOrigin[3] = {sunPos[0] - cbPos[0],
+                                     sunPos[1] - cbPos[1],
+                                     sunPos[2] - cbPos[2]};
+
+      // Positions of the shadow bodies with respect to the origin, so all
+      // of the bodies are lit in a single call
+      Integer   bodyCount = (Integer)shadowBodies.size();
+      RealArray bodyPositions(3 * bodyCount, 0.0);
+      RealArray bodyRadii(bodyCount);
+      for (Integer jj = 0; jj < bodyCount; jj++)
       {
-         std::string bodyName     = shadowBodies.at(jj)->GetName();
-         bool        bodyIsSun    = (bodyName == GmatSolarSystemDefaults::SUN_NAME);
-         bool        bodyIsOrigin = (bodyName == scOrigin->GetName());
-         Real        bodyRadius   = shadowBodies.at(jj)->GetEquatorialRadius();
-
-         Rvector3 bodyPos  = shadowBodies.at(jj)->GetMJ2000Position(atEpoch); // with respect to Earth
+         bodyRadii[jj] = shadowBodies.at(jj)->GetEquatorialRadius();
+         if (shadowBodies.at(jj)->GetName() != scOrigin->GetName())
+         {
+            Rvector3 bodyPos = shadowBodies.at(jj)->GetMJ2000Position(atEpoch); // with respect to Earth
+            for (Integer kk = 0; kk < 3; kk++)
+               bodyPositions[3*jj + kk] = bodyPos[kk] - cbPos[kk];
+         }
          #ifdef DEBUG_SOLAR_POWER_PERCENT
-            MessageInterface::ShowMessage("shadow body is %s\n", bodyName.c_str());
+            MessageInterface::ShowMessage("shadow body is %s\n",
+                  shadowBodies.at(jj)->GetName().c_str());
             MessageInterface::ShowMessage("origin is      %s\n", (scOrigin->GetName()).c_str());
-            MessageInterface::ShowMessage("   cbPos   = %12.10f  %12.10f  %12.10f\n",
-                  cbPos[0], cbPos[1], cbPos[2]);
             MessageInterface::ShowMessage("   bodyPos = %12.10f  %12.10f  %12.10f\n",
-                  bodyPos[0], bodyPos[1], bodyPos[2]);
+                  bodyPositions[3*jj], bodyPositions[3*jj+1], bodyPositions[3*jj+2]);
          #endif
+      }
 
-         // Find vector from the body to the Sun
-         if (!bodyIsSun)
-         {
-            bodySunVector[0]    = sunPos[0] - bodyPos[0];
-            bodySunVector[1]    = sunPos[1] - bodyPos[1];
-            bodySunVector[2]    = sunPos[2] - bodyPos[2];
-         }
-         else  // should never happen, as the Sun is not allowed as a Shadow Body
-         {
-            bodySunVector[0] = 0.0;
-            bodySunVector[1] = 0.0;
-            bodySunVector[2] = 0.0;
-         }
-         // Convert state to be relative to the current body
-         if (!bodyIsOrigin)
-         {
-            // state is from origin to spacecraft ; cb - body = origin wrt shadow body
-            state[0] = stateRelToOrigin[0] + (cbPos[0] - bodyPos[0]);
-            state[1] = stateRelToOrigin[1] + (cbPos[1] - bodyPos[1]);
-            state[2] = stateRelToOrigin[2] + (cbPos[2] - bodyPos[2]);
-         }
-         else  // SC state with respect to the origin (which is the current body)
-         {
-            state[0] = stateRelToOrigin[0];
-            state[1] = stateRelToOrigin[1];
-            state[2] = stateRelToOrigin[2];
-         }
-
-         // Find vector from Sun to the SC
-         sunSat[0] = state[0] - bodySunVector[0];
-         sunSat[1] = state[1] - bodySunVector[1];
-         sunSat[2] = state[2] - bodySunVector[2];
-         Real sunDistance = GmatMathUtil::Sqrt(sunSat[0]*sunSat[0] +
-                                               sunSat[1]*sunSat[1] +
-                                               sunSat[2]*sunSat[2]);
-         if (sunDistance == 0.0)
-            sunDistance = 1.0;
-         // Make a unit vector for the force direction
-         force[0] = sunSat[0] / sunDistance;
-         force[1] = sunSat[1] / sunDistance;
-         force[2] = sunSat[2] / sunDistance;
-
-         Real psunrad = asin(sunRadius / sunDistance);
-
-         #ifdef DEBUG_SOLAR_POWER
-            MessageInterface::ShowMessage(
-                  "In SolarPowerSystem,  body = %s\n",
-                  shadowBodies.at(jj)->GetName().c_str());
-            MessageInterface::ShowMessage("   bodySunVector = %12.10f  %12.10f  %12.10f\n",
-                  bodySunVector[0], bodySunVector[1], bodySunVector[2]);
-            MessageInterface::ShowMessage("   sunSat      = %12.10f  %12.10f  %12.10f\n",
-                  sunSat[0], sunSat[1], sunSat[2]);
-            MessageInterface::ShowMessage("   force       = %12.10f  %12.10f  %12.10f\n",
-                  force[0], force[1], force[2]);
-         #endif
+      std::vector<ShadowState::Lighting> lighting(bodyCount);
+      shadowState->FindShadowStates(1, state, 3, bodyCount, &bodyPositions[0],
+            &bodyRadii[0], sunRelToOrigin, sunRadius, &lighting[0]);
 
-         Real appSunRad, appBodyRad, appDistFromSunToBody;
-         percentSun  = shadowState->FindShadowState(lit, dark, "DualCone",
-               state, bodySunVector,sunSat, force, sunRadius, bodyRadius,
-               psunrad, appSunRad, appBodyRad, appDistFromSunToBody);
+      for (Integer jj = 0; jj < bodyCount; jj++)
+      {
+         percentSun = lighting[jj].percentSun;
 
          // Is there more than one occultation? -  we don't currently model that
          if (percentSun < 1.0)
@@ -600,11 +551,12 @@ std::string SolarPowerSystem::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SolarPowerSystem::GetParameterID(const std::string &str) const
 {
-   for (Integer i = PowerSystemParamCount; i < SolarPowerSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PowerSystemParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, PowerSystemParamCount,
+               SolarPowerSystemParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return PowerSystem::GetParameterID(str);
 }
@@ -724,6 +676,7 @@ Real SolarPowerSystem::SetRealParameter(const Integer id, const Real value)
    MessageInterface::ShowMessage
       ("PowerSystem::SetRealParameter(), id=%d, value=%f\n", id, value);
    #endif
+   InvalidatePowerCache();
 
    switch (id)
    {
@@ -799,6 +752,7 @@ bool SolarPowerSystem::SetStringParameter(const Integer id, const std::string &v
       ("SolarPowerSystem::SetStringParameter() entered, id=%d, value='%s'\n", id,
        value.c_str());
    #endif
+   InvalidatePowerCache();
 
    if (id == SHADOW_MODEL)
    {
@@ -875,6 +829,7 @@ bool SolarPowerSystem::SetStringParameter(const Integer id,
             "Entering SetStringParameter with id = %d, value = %s, and index = %d\n",
             id, value.c_str(), index);
    #endif
+   InvalidatePowerCache();
    if (id == SHADOW_BODIES)
    {
       // Check to see if we are setting a blank list here; if we are,
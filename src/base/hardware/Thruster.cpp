@@ -161,6 +161,8 @@ Thruster::Thruster(const std::string &typeStr, const std::string &nomme) :
    inertialDirection[0] = 1.0;
    inertialDirection[1] = 0.0;
    inertialDirection[2] = 0.0;
+   for (Integer i = 0; i < 9; ++i)
+      inertialRotation[i] = (i % 4 == 0 ? 1.0 : 0.0);
 
    // Available local axes labels
    // Since it is static data, clear it first
@@ -282,6 +284,8 @@ Thruster::Thruster(const Thruster& th) :
    inertialDirection[0] = th.inertialDirection[0];
    inertialDirection[1] = th.inertialDirection[1];
    inertialDirection[2] = th.inertialDirection[2];
+   for (Integer i = 0; i < 9; ++i)
+      inertialRotation[i] = th.inertialRotation[i];
    
    #ifdef DEBUG_THRUSTER_CONSTRUCTOR
    MessageInterface::ShowMessage
@@ -393,6 +397,8 @@ Thruster& Thruster::operator=(const Thruster& th)
    mixRatio.SetSize(th.mixRatio.GetSize());
    mixRatio            = th.mixRatio;
    inertialEpoch       = th.inertialEpoch;
+   for (Integer i = 0; i < 9; ++i)
+      inertialRotation[i] = th.inertialRotation[i];
    derivState          = nullptr;
    derivOrigin         = nullptr;
 
@@ -485,11 +491,11 @@ std::string Thruster::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Thruster::GetParameterID(const std::string &str) const
 {
-   for (Integer i = HardwareParamCount; i < ThrusterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - HardwareParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, HardwareParamCount, ThrusterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    if (str == "ThrustDirection1")
       return DIRECTION_X;
@@ -2010,6 +2016,7 @@ void Thruster::ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epo
       // Now rotate to base system axes, we don't want to translate so
       // set coincident to true
       coordSystem->ToBaseSystem(A1Mjd(epoch), inDir, outDir, true); // @todo - need ToMJ2000Eq here?
+      RecordRotation(coordSystem);
       
       #ifdef DEBUG_BURN_CONVERT_ROTMAT
       Rmatrix33 rotMat = coordSystem->GetLastRotationMatrix();
@@ -2026,7 +2033,7 @@ void Thruster::ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epo
       // if MJ2000Eq axes rotation matrix is always identity matrix
       if (isMJ2000EqAxes)
       {
-
+         RecordRotation(NULL);
          dirInertial[0] = dir[0];
          dirInertial[1] = dir[1];
          dirInertial[2] = dir[2];
@@ -2041,6 +2048,9 @@ void Thruster::ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epo
          Rmatrix33 inertialToBody = spacecraft->GetAttitude(epoch);
          Rmatrix33 rotMat = inertialToBody.Transpose();
          outDir = inDir * rotMat;
+         for (Integer i=0; i<3; i++)
+            for (Integer j=0; j<3; j++)
+               inertialRotation[3*i+j] = rotMat(i,j);
          for (Integer i=0; i<3; i++)
             dirInertial[i] = outDir[i];
       }
@@ -2057,6 +2067,7 @@ void Thruster::ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epo
 
 
          localCoordSystem->ToBaseSystem(A1Mjd(epoch), inDir, outDir, true);  // @todo - do we need ToMJ2000Eq here?
+         RecordRotation(localCoordSystem);
          
          dirInertial[0] = outDir[0];
          dirInertial[1] = outDir[1];
@@ -2085,6 +2096,92 @@ void Thruster::ComputeInertialDirection(Real epoch)
 }
 
 
+//---------------------------------------------------------------------------
+// void ComputeInertialDirection(const Thruster &frameSource)
+//---------------------------------------------------------------------------
+/**
+ * Projects the thrust direction using the rotation most recently computed by
+ * another thruster that shares this thruster's frame.
+ *
+ * The products are formed in the same order used by the axis systems, so the
+ * result matches a full ConvertDirectionToInertial() call at the source's
+ * epoch.
+ *
+ * @param frameSource Thruster that has just computed its inertial direction
+ */
+//---------------------------------------------------------------------------
+void Thruster::ComputeInertialDirection(const Thruster &frameSource)
+{
+   for (Integer i = 0; i < 9; ++i)
+      inertialRotation[i] = frameSource.inertialRotation[i];
+   inertialEpoch = frameSource.inertialEpoch;
+
+   if (usingLocalCoordSys && isMJ2000EqAxes)
+   {
+      inertialDirection[0] = direction[0];
+      inertialDirection[1] = direction[1];
+      inertialDirection[2] = direction[2];
+   }
+   else
+      Rmatrix33::MultiplyVector(inertialRotation, direction,
+            inertialDirection);
+}
+
+
+//---------------------------------------------------------------------------
+// bool SharesFrameWith(const Thruster &other) const
+//---------------------------------------------------------------------------
+/**
+ * Checks if another thruster projects its direction through the same frame,
+ * so that one rotation computation serves both.
+ *
+ * @param other The thruster to compare with
+ *
+ * @return true if the frames are known to be identical
+ */
+//---------------------------------------------------------------------------
+bool Thruster::SharesFrameWith(const Thruster &other) const
+{
+   if (usingLocalCoordSys != other.usingLocalCoordSys)
+      return false;
+
+   if (!usingLocalCoordSys)
+      return (coordSystem != NULL) && (coordSystem == other.coordSystem);
+
+   if (isMJ2000EqAxes || other.isMJ2000EqAxes)
+      return isMJ2000EqAxes && other.isMJ2000EqAxes;
+
+   if ((localCoordSystem == NULL) || (other.localCoordSystem == NULL))
+      return false;
+
+   return (spacecraft == other.spacecraft) &&
+          (isSpacecraftBodyAxes == other.isSpacecraftBodyAxes) &&
+          (localAxesName == other.localAxesName) &&
+          (localOriginName == other.localOriginName) &&
+          (j2000Body == other.j2000Body);
+}
+
+
+//---------------------------------------------------------------------------
+// void RecordRotation(CoordinateSystem *cs)
+//---------------------------------------------------------------------------
+/**
+ * Saves the rotation used by the last direction conversion.
+ *
+ * @param cs The coordinate system that performed the conversion, or NULL when
+ *           no rotation was applied
+ */
+//---------------------------------------------------------------------------
+void Thruster::RecordRotation(CoordinateSystem *cs)
+{
+   if ((cs != NULL) && (cs->GetAxisSystem() != NULL))
+      cs->GetLastRotationMatrix(inertialRotation);
+   else
+      for (Integer i = 0; i < 9; ++i)
+         inertialRotation[i] = (i % 4 == 0 ? 1.0 : 0.0);
+}
+
+
 //------------------------------------------------------------------------------
 // void WriteDeprecatedMessage(const std::string &oldProp,
 //                             const std::string &newProp) const
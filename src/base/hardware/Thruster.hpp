@@ -188,6 +188,8 @@ protected:
    Real                       mDot;
    /// Thrust direction projected into the inertial coordinate system
    Real                       inertialDirection[3];
+   /// Row-major rotation used for the most recent inertial projection
+   Real                       inertialRotation[9];
    /// Decrement mass flag
    bool                       decrementMass;
    /// Flag used to turn thruster on or off
@@ -256,6 +258,9 @@ protected:
    void                 ConvertDirectionToInertial(Real *dv, Real *dvInertial,
                                                    Real epoch);
    void                 ComputeInertialDirection(Real epoch);
+   void                 ComputeInertialDirection(const Thruster &frameSource);
+   bool                 SharesFrameWith(const Thruster &other) const;
+   void                 RecordRotation(CoordinateSystem *cs);
    void                 WriteDeprecatedMessage(const std::string &oldProp,
                                                const std::string &newProp) const;
    
@@ -11,6 +11,8 @@
 
 #include "SocketServer.hpp"
 #include "GmatInterface.hpp"
+#include <cstdlib>
+#include <cstring>
 //#include "MessageInterface.hpp"
 
 
@@ -43,116 +45,286 @@ bool SocketServer::RunRequest(int sock)
 bool SocketServer::RunRequest(SOCKET sock)
 #endif
 {
-	char lenc, len1c;
-	unsigned char len, len1;
-	char *buf, *buf1, *msg;
-
 	// 1. Read data
+	std::string message;
+	int status = ReadMessage(sock, message);
+	if (status == 0)
+		return false;
+	if (status < 0)
+		return true;		// the client closed the connection
+
+	#ifdef DEBUG_SOCKET
+		#ifdef MessageInterface_hpp
+			MessageInterface::ShowMessage("Client %d: Read message:%s\n", sock, message.c_str());
+		#else
+			printf("Client %d: Read message:%s\n", sock, message.c_str());
+		#endif
+	#endif
+
+
+	// 2. Echo back the data
+	SendAll(sock, message.c_str(), message.size());
+	#ifdef DEBUG_SOCKET
+		#ifdef MessageInterface_hpp
+			MessageInterface::ShowMessage("Client %d: Echo back:%s\n", sock, message.c_str());
+		#else
+			printf("Client %d: Echo back:%s\n", sock, message.c_str());
+		#endif
+	#endif
+
+
+	// 3. if the received message is a request, evaluate it and send the
+	//    result once the client reports its 'Idle' state
+	std::string reply;
+	bool isRequest = true;
+	if (message.compare(0, strlen("Request,"), "Request,") == 0)
+		reply = RequestValue(message.substr(strlen("Request,")));
+	else if (message.compare(0, strlen("Requests,"), "Requests,") == 0)
+		RequestValues(message.substr(strlen("Requests,")), reply);
+	else if (message.compare(0, strlen("RequestBinary,"), "RequestBinary,") == 0)
+		RequestNumbers(message.substr(strlen("RequestBinary,")), reply);
+	else
+		isRequest = false;
+
+	if (isRequest)
+	{
+		// 3.1. Read 'Idle' state
+		std::string idle;
+		while ((status = ReadMessage(sock, idle)) == 0)
+			;
+		if (status < 0)
+			return true;
+
+		// 3.2. Send results to client
+		SendAll(sock, reply.c_str(), reply.size());
+		#ifdef DEBUG_SOCKET
+			#ifdef MessageInterface_hpp
+				MessageInterface::ShowMessage("Client %d: Send result:%s\n", sock, reply.c_str());
+			#else
+				printf("Client %d: Send result:%s\n", sock, reply.c_str());
+			#endif
+		#endif
+	}
+	else if (message.compare(0, strlen("script,"), "script,") == 0)
+	{
+		// 4.Run OnPoke function:
+		std::vector<char> msg(message.begin() + strlen("script,"), message.end());
+		msg.push_back('\0');
+		OnPoke(&msg[0]);
+		if (strcmp(&msg[0], "Close;") == 0)
+			return true;
+	}
+
+	return false;
+}
+
+
+//------------------------------------------------------------------------------
+// int ReadMessage(int sock, std::string &message)
+//------------------------------------------------------------------------------
+/**
+ * Reads one message: a length byte followed by that many bytes of text
+ *
+ * The call waits up to 2 seconds for the message to start, and then reads
+ * until the whole message has arrived; a message may come in several pieces.
+ *
+ * @param sock    The client socket
+ * @param message The message text
+ *
+ * @return 1 if a message was read, 0 if none arrived, -1 if the connection
+ *         was closed
+ */
+//------------------------------------------------------------------------------
+#ifdef LINUX_MAC
+int SocketServer::ReadMessage(int sock, std::string &message)
+#else
+int SocketServer::ReadMessage(SOCKET sock, std::string &message)
+#endif
+{
 	struct timeval time;
-	time.tv_sec = 0;
-	time.tv_usec = 2000000;
+	time.tv_sec = 2;
+	time.tv_usec = 0;
 #ifdef LINUX_MAC
 	fd_set socks_set;
 	FD_ZERO(&socks_set);
 	FD_SET(sock, &socks_set);
 	int count = select(sock+1, &socks_set, NULL, NULL, &time);
 #else
-	struct fd_set socks_set;
-	socks_set.fd_count = 1;
-	socks_set.fd_array[0] = sock;
+	fd_set socks_set;
+	FD_ZERO(&socks_set);
+	FD_SET(sock, &socks_set);
 	int count = select(0, &socks_set, NULL, NULL, &time);
 #endif
 
 	if (count == 0)
-		return false;
+		return 0;
+	if (count < 0)
+		return -1;
+
+	char lenc;
+	if (recv(sock, &lenc, 1, 0) <= 0)
+		return -1;
+
+	size_t len = (unsigned char)lenc;
+	message.assign(len, '\0');
+	size_t received = 0;
+	while (received < len)
+	{
+		int numBytes = recv(sock, &message[received], (int)(len - received), 0);
+		if (numBytes <= 0)
+			return -1;
+		received += numBytes;
+	}
 
-	int numBytes = recv(sock, &lenc, 1, 0);
-	if (numBytes == 0)
-		return false;
+	return 1;
+}
 
-	len = (unsigned char)lenc;
-	buf = new char[len+1];
-	while (recv(sock, buf, len, 0) == 0)
-	{
+
+//------------------------------------------------------------------------------
+// bool SendAll(int sock, const char *data, size_t size)
+//------------------------------------------------------------------------------
+/**
+ * Sends a block of data, repeating the send until all of it is written
+ *
+ * @param sock The client socket
+ * @param data The data
+ * @param size The number of bytes to send
+ *
+ * @return true if all of the data was sent, false if the connection failed
+ */
+//------------------------------------------------------------------------------
 #ifdef LINUX_MAC
-		usleep(1000);
+bool SocketServer::SendAll(int sock, const char *data, size_t size)
 #else
-		_sleep(1);
+bool SocketServer::SendAll(SOCKET sock, const char *data, size_t size)
 #endif
+{
+	size_t sent = 0;
+	while (sent < size)
+	{
+		int numBytes = send(sock, data + sent, (int)(size - sent), 0);
+		if (numBytes <= 0)
+			return false;
+		sent += numBytes;
 	}
-	buf[len] = '\0';
-
-	#ifdef DEBUG_SOCKET
-		#ifdef MessageInterface_hpp
-			MessageInterface::ShowMessage("Client %d: Read message:%s\n", sock, buf);
-		#else
-			printf("Client %d: Read message:%s\n", sock, buf);
-		#endif
-	#endif
+	return true;
+}
 
 
-	// 2. Echo back the data
-	send(sock, buf, len, 0);
-	#ifdef DEBUG_SOCKET
-		#ifdef MessageInterface_hpp
-			MessageInterface::ShowMessage("Client %d: Echo back:%s\n", sock, buf);
-		#else
-			printf("Client %d: Echo back:%s\n", sock, buf);
-		#endif
-	#endif
+//------------------------------------------------------------------------------
+// std::string RequestValue(const std::string &item)
+//------------------------------------------------------------------------------
+/**
+ * Returns the text value of a parameter or object
+ *
+ * GmatInterface returns its values in static buffers, so the call and the
+ * copy of the value are made under the interface lock.
+ *
+ * @param item The parameter name, or the object name followed by '.'
+ *
+ * @return The value
+ */
+//------------------------------------------------------------------------------
+std::string SocketServer::RequestValue(const std::string &item)
+{
+	std::vector<char> name(item.begin(), item.end());
+	name.push_back('\0');
+	if (name.size() == 1)
+		return "";
+
+	std::lock_guard<std::mutex> lock(interfaceMutex);
+	char *data = OnRequest(&name[0]);
+	return (data == NULL ? std::string("") : std::string(data));
+}
 
 
-	// 3. if the received message contains 'Request' string then run
-	//    OnRequest() function
-	if (strncmp(buf, "Request,", strlen("Request,")) == 0)
+//------------------------------------------------------------------------------
+// void RequestValues(const std::string &items, std::string &reply)
+//------------------------------------------------------------------------------
+/**
+ * Returns the text values of a ';' separated list of items, one per line
+ *
+ * A client polling many parameters gets them in one exchange rather than one
+ * request, idle and reply round trip per parameter.
+ *
+ * @param items The items, separated by ';'
+ * @param reply The values, each followed by a newline
+ */
+//------------------------------------------------------------------------------
+void SocketServer::RequestValues(const std::string &items, std::string &reply)
+{
+	reply = "";
+	size_t start = 0;
+	while (start < items.size())
 	{
-		msg = &buf[strlen("Request,")];
-
-		// 3.1. Run OnRequest function:
-		char* result = OnRequest(msg);
-
-		// 3.2. Read 'Idle' state
-		#ifdef LINUX_MAC
-		while (select(0, &socks_set, NULL, NULL, &time) == 0)
+		size_t end = items.find(';', start);
+		if (end == std::string::npos)
+			end = items.size();
+		if (end > start)
 		{
-			usleep(1000);
+			reply += RequestValue(items.substr(start, end - start));
+			reply += "\n";
 		}
-		#else
-		while (select(sock+1, &socks_set, NULL, NULL, &time) == 0)
-		{
-			_sleep(1);
-		}
-		#endif
-		recv(sock, &len1c, 1, 0);
-		len1 = (unsigned char)len1c;
-		buf1 = new char[len1+1];
-		recv(sock, buf1, len1, 0);
-		buf1[len1] = '\0';
-
-		// 3.3. Send results to client
-		send(sock, result, strlen(result), 0);
-		#ifdef DEBUG_SOCKET
-			#ifdef MessageInterface_hpp
-				MessageInterface::ShowMessage("Client %d: Send result:%s\n", sock, result);
-			#else
-				printf("Client %d: Send result:%s\n", sock, result);
-			#endif
-		#endif
+		start = end + 1;
+	}
+}
 
-		delete[] buf1;
-   }
-   else if (strncmp(buf, "script,", strlen("script,")) == 0)
-   {
-	    // 4.Run OnPoke function:
-	    msg = &buf[strlen("script,")];
-	    OnPoke(msg);
-	    if (strcmp(msg, "Close;") == 0)
-	    	return true;
-   }
 
-   delete[] buf;
+//------------------------------------------------------------------------------
+// void RequestNumbers(const std::string &items, std::string &reply)
+//------------------------------------------------------------------------------
+/**
+ * Returns the numeric values of a ';' separated list of items in binary form
+ *
+ * For each item the reply holds a 4 byte count and that many 8 byte doubles,
+ * in host byte order, taken from the text value of the item ("[1.5]" or
+ * "[1 2 3]").  An item with no numeric value has a count of 0.  The client
+ * reads the numbers directly instead of parsing formatted text.
+ *
+ * @param items The items, separated by ';'
+ * @param reply The binary values
+ */
+//------------------------------------------------------------------------------
+void SocketServer::RequestNumbers(const std::string &items, std::string &reply)
+{
+	reply = "";
+	size_t start = 0;
+	while (start < items.size())
+	{
+		size_t end = items.find(';', start);
+		if (end == std::string::npos)
+			end = items.size();
+		if (end > start)
+		{
+			std::string value = RequestValue(items.substr(start, end - start));
+			std::vector<double> numbers;
+			const char *text = value.c_str();
+			while (*text != '\0')
+			{
+				if (*text == '[' || *text == ']' || isspace((unsigned char)*text))
+				{
+					++text;
+					continue;
+				}
+				char *next;
+				double number = strtod(text, &next);
+				if (next == text)
+				{
+					// Not a numeric value
+					numbers.clear();
+					break;
+				}
+				numbers.push_back(number);
+				text = next;
+			}
 
-   return false;
+			unsigned int count = (unsigned int)numbers.size();
+			reply.append((const char*)&count, 4);
+			if (count > 0)
+				reply.append((const char*)&numbers[0], count * sizeof(double));
+		}
+		start = end + 1;
+	}
 }
 
 
@@ -256,6 +428,15 @@ bool SocketServer::OnPoke(char* data)
     // save data to string stream
     //------------------------------
 
+    // Script changes and runs of the clients do not interleave; queries only
+    // take the interface lock, so they are answered while a run is going on
+    std::lock_guard<std::mutex> runLock(runMutex);
+    bool isRun = ((strcmp(data, "Build+Run;") == 0) ||
+                  (strcmp(data, "Run;") == 0));
+    std::unique_lock<std::mutex> lock(interfaceMutex, std::defer_lock);
+    if (!isRun)
+       lock.lock();
+
     if (strcmp(data, "Open;") == 0)
     {
     	GmatInterface::Instance()->OpenScript();
@@ -274,7 +455,10 @@ bool SocketServer::OnPoke(char* data)
     }
     else if (strcmp(data, "Build+Run;") == 0)
     {
-    	GmatInterface::Instance()->BuildObject();
+    	{
+    		std::lock_guard<std::mutex> buildLock(interfaceMutex);
+    		GmatInterface::Instance()->BuildObject();
+    	}
     	GmatInterface::Instance()->RunScript();
     }
     else if (strcmp(data, "Run;") == 0)
@@ -304,7 +488,7 @@ bool SocketServer::OnPoke(char* data)
 	   strcpy(s, data);
        GmatInterface::Instance()->PutScript(s);
 
-       delete s;
+       delete [] s;
     }
 
    return true;
@@ -356,9 +540,9 @@ void SocketServer::OnAccept(SOCKET sk)
 
 	#ifdef DEBUG_SOCKET
 		#ifdef MessageInterface_hpp
-			MessageInterface::ShowMessage("number of clients = %d\n", m_numClients);
+			MessageInterface::ShowMessage("number of clients = %d\n", m_numClients.load());
 		#else
-			printf("number of clients = %d\n", m_numClients);
+			printf("number of clients = %d\n", m_numClients.load());
 		#endif
 	#endif
 
@@ -385,9 +569,9 @@ void SocketServer::OnAccept(SOCKET sk)
 
 	#ifdef DEBUG_SOCKET
 		#ifdef MessageInterface_hpp
-			MessageInterface::ShowMessage("number of clients = %d\n", m_numClients);
+			MessageInterface::ShowMessage("number of clients = %d\n", m_numClients.load());
 		#else
-			printf("number of clients = %d\n", m_numClients);
+			printf("number of clients = %d\n", m_numClients.load());
 		#endif
 	#endif
 
@@ -566,9 +750,17 @@ void SocketServer::RunServer()
 				shutdownserver = true;
 				break;
 			}
+			ClientStart* start = new ClientStart;
+			start->server = this;
+			start->sock = this->client_sock;
 			pthread_t threadID;
-			pthread_create(&threadID, NULL, StaticOnAccept,(void *)this);
-			usleep(10000);
+			if (pthread_create(&threadID, NULL, StaticOnAccept, (void *)start) == 0)
+				pthread_detach(threadID);
+			else
+			{
+				delete start;
+				close(this->client_sock);
+			}
 
 		 #else
 		    if (this->client_sock == INVALID_SOCKET)
@@ -576,8 +768,14 @@ void SocketServer::RunServer()
 				shutdownserver = true;
 				break;
 			}
-			_beginthread(StaticOnAccept,0,(void *)this);
-			_sleep(10);
+			ClientStart* start = new ClientStart;
+			start->server = this;
+			start->sock = this->client_sock;
+			if (_beginthread(StaticOnAccept, 0, (void *)start) == -1L)
+			{
+				delete start;
+				closesocket(this->client_sock);
+			}
 		 #endif
      }
 
@@ -34,10 +34,34 @@
 #endif
 
 
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #define IP_ADDRESS	"localhost"
 #define TCP_PORT	3000
 
 
+/**
+ * Socket server for remote GMAT execution
+ *
+ * Each client connection is served on its own thread, so a client that runs
+ * a script does not hold up the status and parameter queries of the others.
+ * Calls into GmatInterface, which returns its results in static buffers, are
+ * serialized and their results copied before the next call; script runs are
+ * serialized separately, so queries are answered while a run is in progress.
+ *
+ * Messages are a length byte followed by the text.  The verbs are
+ *
+ * - "Request,<item>": the text value of a parameter or object
+ * - "Requests,<item>;<item>;...": the text values, one per line, in one reply
+ * - "RequestBinary,<item>;<item>;...": the numeric values of each item as a
+ *   4 byte count followed by that many 8 byte doubles, in host byte order
+ * - "script,<text>": a script line or a script command (Open;, Build;, Run;,
+ *   ...)
+ */
+
 class SocketServer
 {
 public:
@@ -54,13 +78,20 @@ public:
 	char* OnRequest(char* item);
 	bool OnPoke(char* data);
 
+	std::string RequestValue(const std::string &item);
+	void RequestValues(const std::string &items, std::string &reply);
+	void RequestNumbers(const std::string &items, std::string &reply);
+
 	void RunServer();
 #ifdef LINUX_MAC
 	void OnAccept(int sock);
 	static void* StaticOnAccept(void* objPtr)
 	{
-		SocketServer* pThis = (SocketServer*)objPtr;
-		pThis->OnAccept(pThis->client_sock);
+		ClientStart* start = (ClientStart*)objPtr;
+		SocketServer* pThis = start->server;
+		int sock = start->sock;
+		delete start;
+		pThis->OnAccept(sock);
 		return NULL;
 	}
 	static void* StaticRunServer(void* objPtr)
@@ -73,8 +104,11 @@ public:
 	void OnAccept(SOCKET sock);
 	static void StaticOnAccept(void* objPtr)
 	{
-		SocketServer* pThis = (SocketServer*)objPtr;
-		pThis->OnAccept(pThis->client_sock);
+		ClientStart* start = (ClientStart*)objPtr;
+		SocketServer* pThis = start->server;
+		SOCKET sock = start->sock;
+		delete start;
+		pThis->OnAccept(sock);
 	}
 	static void StaticRunServer(void* objPtr)
 	{
@@ -83,9 +117,33 @@ public:
 	}
 #endif
 private:
+	/// The server and socket handed to a new client thread
+	struct ClientStart
+	{
+		SocketServer* server;
+#ifdef LINUX_MAC
+		int sock;
+#else
+		SOCKET sock;
+#endif
+	};
+
 	int error;
-	int m_numClients;
-	bool shutdownserver;
+	std::atomic<int> m_numClients;
+	std::atomic<bool> shutdownserver;
+
+	/// Serializes the calls into GmatInterface
+	std::mutex interfaceMutex;
+	/// Serializes the script builds and runs of the clients
+	std::mutex runMutex;
+
+#ifdef LINUX_MAC
+	int ReadMessage(int sock, std::string &message);
+	bool SendAll(int sock, const char *data, size_t size);
+#else
+	int ReadMessage(SOCKET sock, std::string &message);
+	bool SendAll(SOCKET sock, const char *data, size_t size);
+#endif
 
 #ifdef LINUX_MAC
 	int Server;
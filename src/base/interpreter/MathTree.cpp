@@ -35,6 +35,8 @@
 #include "StringUtil.hpp"            // for GetArrayIndex()
 #include "InterpreterException.hpp"
 #include "MessageInterface.hpp"
+#include "RealUtilities.hpp"
+#include <cmath>                     // for atan2()
 
 //#define DEBUG_MATH_TREE 1
 //#define DEBUG_MATH_TREE_INIT 1
@@ -43,6 +45,7 @@
 //#define DEBUG_VALIDATE
 //#define DEBUG_RENAME
 //#define DEBUG_FUNCTION
+//#define DEBUG_MATH_TREE_COMPILE
 
 //#ifndef DEBUG_MEMORY
 //#define DEBUG_MEMORY
@@ -64,7 +67,9 @@ MathTree::MathTree(const std::string &typeStr, const std::string &nomme) :
    theTopNode(NULL),
    theObjectMap(NULL),
    theGlobalObjectMap(NULL),
-   theWrapperMap(NULL)
+   theWrapperMap(NULL),
+   isCompiled(false),
+   isProgramValid(false)
 {
 }
 
@@ -117,7 +122,9 @@ MathTree::MathTree(const MathTree &mt) :
    GmatBase           (mt),
    theTopNode         (mt.theTopNode),
    theObjectMap       (NULL),
-   theGlobalObjectMap (NULL)
+   theGlobalObjectMap (NULL),
+   isCompiled         (false),
+   isProgramValid     (false)
 {
 }
 
@@ -143,6 +150,7 @@ MathTree& MathTree::operator=(const MathTree &mt)
    theTopNode         = mt.theTopNode;
    theObjectMap       = NULL;
    theGlobalObjectMap = NULL;
+   ClearProgram();
    
    return *this;
 }
@@ -255,6 +263,7 @@ MathNode* MathTree::GetTopNode()
 void MathTree::SetTopNode(MathNode *node)
 {
    theTopNode = node;
+   ClearProgram();
 }
 
 
@@ -267,6 +276,7 @@ void MathTree::SetMathWrappers(std::map<std::string, ElementWrapper*> *wrapperMa
       return;
    
    theWrapperMap = wrapperMap;
+   ClearProgram();
    
    #ifdef DEBUG_MATH_WRAPPERS
    MessageInterface::ShowMessage
@@ -365,6 +375,13 @@ bool MathTree::Validate(std::string &msg)
 //------------------------------------------------------------------------------
 // void Evaluate() const
 //------------------------------------------------------------------------------
+/**
+ * Evaluates a scalar math tree.
+ *
+ * The tree is compiled into a flat program the first time it is evaluated
+ * after initialization; the program is then run in place of the tree walk.
+ */
+//------------------------------------------------------------------------------
 Real MathTree::Evaluate()
 {
    #ifdef DEBUG_MATH_TREE_EVAL
@@ -372,6 +389,21 @@ Real MathTree::Evaluate()
       ("MathTree::Evaluate() theTopNode=%s, %s\n", theTopNode->GetTypeName().c_str(),
        theTopNode->GetName().c_str());
    #endif
+   
+   if (!isCompiled)
+      CompileProgram();
+   
+   if (isProgramValid)
+   {
+      UnsignedInt count = theProgram.size();
+      for (UnsignedInt i = 0; i < count; ++i)
+      {
+         if (theProgram[i].op != CONSTANT_OP)
+            theSlots[i] = RunInstruction(theProgram[i]);
+      }
+      return theSlots[count - 1];
+   }
+   
    return theTopNode->Evaluate();
 }
 
@@ -409,6 +441,9 @@ bool MathTree::Initialize(ObjectMap *objectMap, ObjectMap *globalObjectMap)
    if (globalObjectMap)
       theGlobalObjectMap = globalObjectMap;
    
+   // Leaf types are resolved here, so the tree is compiled again
+   ClearProgram();
+   
    #ifdef DEBUG_MATH_TREE_INIT
    MessageInterface::ShowMessage
       ("MathTree::Initialize() theTopNode=%s, %s\n", theTopNode->GetTypeName().c_str(),
@@ -1283,3 +1318,258 @@ void MathTree::DeleteNode(MathNode *node)
       DeleteNode(right);
 }
 
+
+//------------------------------------------------------------------------------
+// void CompileProgram()
+//------------------------------------------------------------------------------
+/**
+ * Flattens a scalar tree into a program of instructions in evaluation order.
+ *
+ * Arithmetic and elementary functions of scalars become instructions, and
+ * those with constant operands are folded.  Leaves and other subtrees, such
+ * as GMAT functions, built in functions or matrix operations, are evaluated
+ * by their nodes.  Trees returning a matrix are not compiled.
+ */
+//------------------------------------------------------------------------------
+void MathTree::CompileProgram()
+{
+   ClearProgram();
+   isCompiled = true;
+   
+   if (theTopNode == NULL)
+      return;
+   
+   try
+   {
+      Integer type, rowCount, colCount;
+      theTopNode->GetOutputInfo(type, rowCount, colCount);
+      if (type != Gmat::REAL_TYPE)
+         return;
+      
+      CompileNode(theTopNode);
+      isProgramValid = true;
+   }
+   catch (BaseException &)
+   {
+      // Leave the tree walk to report the error when it is evaluated
+      theProgram.clear();
+      theSlots.clear();
+   }
+   
+   #ifdef DEBUG_MATH_TREE_COMPILE
+   MessageInterface::ShowMessage
+      ("MathTree::CompileProgram() '%s' compiled to %d instructions, valid=%d\n",
+       theTopNode->GetName().c_str(), theProgram.size(), isProgramValid);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// Integer CompileNode(MathNode *node)
+//------------------------------------------------------------------------------
+/**
+ * Appends the instructions of a scalar subtree to the program.
+ *
+ * @param  node  Top node of the subtree
+ *
+ * @return the slot holding the value of the subtree
+ */
+//------------------------------------------------------------------------------
+Integer MathTree::CompileNode(MathNode *node)
+{
+   MathInstruction inst;
+   inst.op    = NODE_OP;
+   inst.left  = -1;
+   inst.right = -1;
+   inst.node  = node;
+   Real value = 0.0;
+   
+   Integer type, rowCount, colCount;
+   
+   if (!node->IsFunction())
+   {
+      node->GetOutputInfo(type, rowCount, colCount);
+      if (node->IsNumber() && type == Gmat::REAL_TYPE)
+      {
+         inst.op = CONSTANT_OP;
+         value = node->GetRealValue();
+      }
+   }
+   else
+   {
+      MathOperation op = GetOperation(node);
+      MathNode *left = node->GetLeft();
+      MathNode *right = node->GetRight();
+      
+      // Unary plus
+      if ((op == ADD_OP) && (left == NULL))
+      {
+         left = right;
+         right = NULL;
+      }
+      
+      bool isBinary = (op == ADD_OP || op == SUBTRACT_OP || op == MULTIPLY_OP ||
+                       op == DIVIDE_OP || op == POWER_OP || op == ATAN2_OP) &&
+                      (right != NULL);
+      
+      // Only scalar operands are compiled; 1x1 matrices go through the node
+      bool isScalar = (op != NODE_OP) && (left != NULL) &&
+                      (isBinary || (right == NULL));
+      if (isScalar)
+      {
+         left->GetOutputInfo(type, rowCount, colCount);
+         isScalar = (type == Gmat::REAL_TYPE);
+      }
+      if (isScalar && isBinary)
+      {
+         right->GetOutputInfo(type, rowCount, colCount);
+         isScalar = (type == Gmat::REAL_TYPE);
+      }
+      
+      if (isScalar)
+      {
+         if ((op == ADD_OP) && !isBinary)
+            return CompileNode(left);
+         
+         inst.op = op;
+         inst.left = CompileNode(left);
+         if (isBinary)
+            inst.right = CompileNode(right);
+         
+         // Fold operations on constants; their operands are the last
+         // instructions of the program
+         if ((theProgram[inst.left].op == CONSTANT_OP) &&
+             (!isBinary || (theProgram[inst.right].op == CONSTANT_OP)))
+         {
+            try
+            {
+               value = RunInstruction(inst);
+               theProgram.resize(inst.left);
+               theSlots.resize(inst.left);
+               inst.op = CONSTANT_OP;
+               inst.left = -1;
+               inst.right = -1;
+            }
+            catch (BaseException &)
+            {
+               // Not folded; the error is raised when the program runs
+            }
+         }
+      }
+   }
+   
+   theProgram.push_back(inst);
+   theSlots.push_back(value);
+   
+   return theProgram.size() - 1;
+}
+
+
+//------------------------------------------------------------------------------
+// MathOperation GetOperation(MathNode *node)
+//------------------------------------------------------------------------------
+/**
+ * Returns the compiled operation for a function node, or NODE_OP if the node
+ * is evaluated by itself.
+ */
+//------------------------------------------------------------------------------
+MathTree::MathOperation MathTree::GetOperation(MathNode *node)
+{
+   std::string type = node->GetTypeName();
+   
+   if (type == "Add")       return ADD_OP;
+   if (type == "Subtract")  return SUBTRACT_OP;
+   if (type == "Multiply")  return MULTIPLY_OP;
+   if (type == "Divide")    return DIVIDE_OP;
+   if (type == "Negate")    return NEGATE_OP;
+   if (type == "Power")     return POWER_OP;
+   if (type == "Atan2")     return ATAN2_OP;
+   if (type == "Sin")       return SIN_OP;
+   if (type == "Cos")       return COS_OP;
+   if (type == "Tan")       return TAN_OP;
+   if (type == "Asin")      return ASIN_OP;
+   if (type == "Acos")      return ACOS_OP;
+   if (type == "Atan")      return ATAN_OP;
+   if (type == "Sinh")      return SINH_OP;
+   if (type == "Cosh")      return COSH_OP;
+   if (type == "Tanh")      return TANH_OP;
+   if (type == "Asinh")     return ASINH_OP;
+   if (type == "Acosh")     return ACOSH_OP;
+   if (type == "Sqrt")      return SQRT_OP;
+   if (type == "Exp")       return EXP_OP;
+   if (type == "Log")       return LOG_OP;
+   if (type == "Log10")     return LOG10_OP;
+   if (type == "Abs")       return ABS_OP;
+   if (type == "Floor")     return FLOOR_OP;
+   if (type == "Ceil")      return CEIL_OP;
+   if (type == "Fix")       return FIX_OP;
+   if (type == "DegToRad")  return DEG_TO_RAD_OP;
+   if (type == "RadToDeg")  return RAD_TO_DEG_OP;
+   
+   return NODE_OP;
+}
+
+
+//------------------------------------------------------------------------------
+// Real RunInstruction(const MathInstruction &inst)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates one instruction, using the same math as the nodes it replaces.
+ */
+//------------------------------------------------------------------------------
+Real MathTree::RunInstruction(const MathInstruction &inst)
+{
+   Real x = (inst.left >= 0 ? theSlots[inst.left] : 0.0);
+   Real y = (inst.right >= 0 ? theSlots[inst.right] : 0.0);
+   
+   switch (inst.op)
+   {
+   case NODE_OP:        return inst.node->Evaluate();
+   case ADD_OP:         return x + y;
+   case SUBTRACT_OP:    return x - y;
+   case MULTIPLY_OP:    return x * y;
+   case DIVIDE_OP:      return x / y;
+   case NEGATE_OP:      return x * -1;
+   case POWER_OP:       return GmatMathUtil::Pow(x, y);
+   case ATAN2_OP:       return atan2(x, y);
+   case SIN_OP:         return GmatMathUtil::Sin(x);
+   case COS_OP:         return GmatMathUtil::Cos(x);
+   case TAN_OP:         return GmatMathUtil::Tan(x);
+   case ASIN_OP:        return GmatMathUtil::ASin(x);
+   case ACOS_OP:        return GmatMathUtil::ACos(x);
+   case ATAN_OP:        return GmatMathUtil::ATan(x);
+   case SINH_OP:        return GmatMathUtil::Sinh(x);
+   case COSH_OP:        return GmatMathUtil::Cosh(x);
+   case TANH_OP:        return GmatMathUtil::Tanh(x);
+   case ASINH_OP:       return GmatMathUtil::ASinh(x);
+   case ACOSH_OP:       return GmatMathUtil::ACosh(x);
+   case SQRT_OP:        return GmatMathUtil::Sqrt(x);
+   case EXP_OP:         return GmatMathUtil::Exp(x);
+   case LOG_OP:         return GmatMathUtil::Log(x);
+   case LOG10_OP:       return GmatMathUtil::Log10(x);
+   case ABS_OP:         return GmatMathUtil::Abs(x);
+   case FLOOR_OP:       return GmatMathUtil::Floor(x);
+   case CEIL_OP:        return GmatMathUtil::Ceiling(x);
+   case FIX_OP:         return GmatMathUtil::Fix(x);
+   case DEG_TO_RAD_OP:  return GmatMathUtil::DegToRad(x);
+   case RAD_TO_DEG_OP:  return GmatMathUtil::RadToDeg(x);
+   default:             return x;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearProgram()
+//------------------------------------------------------------------------------
+/**
+ * Discards the compiled program, so the tree is compiled again when it is
+ * next evaluated.
+ */
+//------------------------------------------------------------------------------
+void MathTree::ClearProgram()
+{
+   theProgram.clear();
+   theSlots.clear();
+   isCompiled = false;
+   isProgramValid = false;
+}
@@ -117,6 +117,67 @@ protected:
    std::vector<Function*> theFunctions;
    std::vector<MathNode*> nodesToDelete;
    
+   /// Operations of the compiled scalar program
+   enum MathOperation
+   {
+      CONSTANT_OP,      // Folded value, set when the program is compiled
+      NODE_OP,          // Subtree evaluated by its MathNode
+      ADD_OP,
+      SUBTRACT_OP,
+      MULTIPLY_OP,
+      DIVIDE_OP,
+      NEGATE_OP,
+      POWER_OP,
+      ATAN2_OP,
+      SIN_OP,
+      COS_OP,
+      TAN_OP,
+      ASIN_OP,
+      ACOS_OP,
+      ATAN_OP,
+      SINH_OP,
+      COSH_OP,
+      TANH_OP,
+      ASINH_OP,
+      ACOSH_OP,
+      SQRT_OP,
+      EXP_OP,
+      LOG_OP,
+      LOG10_OP,
+      ABS_OP,
+      FLOOR_OP,
+      CEIL_OP,
+      FIX_OP,
+      DEG_TO_RAD_OP,
+      RAD_TO_DEG_OP
+   };
+   
+   /// One instruction of the compiled program; its result goes in the slot
+   /// with the index of the instruction
+   struct MathInstruction
+   {
+      MathOperation op;
+      /// Slots of the operands
+      Integer       left;
+      Integer       right;
+      /// Node evaluated by NODE_OP
+      MathNode      *node;
+   };
+   
+   /// Scalar trees flattened in evaluation order, and their result slots
+   std::vector<MathInstruction> theProgram;
+   RealArray   theSlots;
+   /// True once the tree has been compiled since the last change to it
+   bool        isCompiled;
+   /// True if the compiled program is used by Evaluate()
+   bool        isProgramValid;
+   
+   void CompileProgram();
+   Integer CompileNode(MathNode *node);
+   MathOperation GetOperation(MathNode *node);
+   Real RunInstruction(const MathInstruction &inst);
+   void ClearProgram();
+   
    bool InitializeParameter(MathNode *node);
    void FinalizeFunctionRunner(MathNode *node);
    void SetMathElementWrappers(MathNode *node);
@@ -370,6 +370,8 @@ bool ScriptInterpreter::Interpret(const std::string &scriptfile)
    
    mainScriptFilename = scriptfile;
    currentScriptBeingRead = mainScriptFilename;
+   scriptFilesRead.clear();
+   scriptFilesRead.push_back(mainScriptFilename);
    std::ifstream inFile(mainScriptFilename.c_str());
    inStream = &inFile; // This is needed for CheckEncoding()
    
@@ -1063,6 +1065,7 @@ bool ScriptInterpreter::InterpretIncludeFile(GmatCommand *inCmd)
    
    // Set include file as current instream
    currentScriptBeingRead = lastIncludeFile;   
+   scriptFilesRead.push_back(currentScriptBeingRead);
    std::ifstream inFile(currentScriptBeingRead.c_str());
    inStream = &inFile; // This is needed for CheckEncoding()
    
@@ -1862,6 +1865,19 @@ std::string ScriptInterpreter::GetMainScriptFileName()
    return mainScriptFilename;
 }
 
+//------------------------------------------------------------------------------
+// const StringArray& GetScriptFilesRead()
+//------------------------------------------------------------------------------
+/**
+ * Returns the main script and the include files read by the last script
+ * interpretation.
+ */
+//------------------------------------------------------------------------------
+const StringArray& ScriptInterpreter::GetScriptFilesRead()
+{
+   return scriptFilesRead;
+}
+
 //------------------------------------------------------------------------------
 // bool IncludeFoundInResource()
 //------------------------------------------------------------------------------
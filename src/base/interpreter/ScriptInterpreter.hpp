@@ -63,6 +63,7 @@ public:
    bool SetOutStream(std::ostream *ostrm);
 
    std::string GetMainScriptFileName();
+   const StringArray& GetScriptFilesRead();
    bool IncludeFoundInResource();
 
    virtual Integer ChangeRunState(const std::string &state, Integer sandboxNum = 1);
@@ -77,6 +78,8 @@ protected:
    
    /// Flag indicating #Include statement fouond in the resource mode
    bool includeFoundInResource;
+   /// The main script and the include files read by the last Interpret()
+   StringArray scriptFilesRead;
    
    void InitializeScriptData();
    bool InterpretIncludeFile(GmatCommand *inCmd);
@@ -335,11 +335,11 @@ std::string Array::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Array::GetParameterID(const std::string &str) const
 {
-   for (int i=ParameterParamCount; i<ArrayParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ParameterParamCount, ArrayParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Parameter::GetParameterID(str);
 }
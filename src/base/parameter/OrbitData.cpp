@@ -44,6 +44,7 @@
 #include "StringUtil.hpp"        // for ToString()
 #include "MessageInterface.hpp"
 #include "StateConversionUtil.hpp"
+#include <algorithm>             // for std::equal(), std::copy()
 
 
 //#define DEBUG_ORBITDATA_SET
@@ -70,6 +71,13 @@ using namespace GmatMathUtil;
 
 CoordinateConverter OrbitData::mCoordConverter = CoordinateConverter();
 
+OrbitData::ConversionMemo OrbitData::conversionMemo[OrbitData::MEMO_SIZE];
+Integer OrbitData::conversionMemoCount = 0;
+Integer OrbitData::conversionMemoNext  = 0;
+OrbitData::KeplerianMemo  OrbitData::keplerianMemo[OrbitData::MEMO_SIZE];
+Integer OrbitData::keplerianMemoCount  = 0;
+Integer OrbitData::keplerianMemoNext   = 0;
+
 const std::string
 OrbitData::VALID_OBJECT_TYPE_LIST[OrbitDataObjectCount] =
 {
@@ -225,6 +233,10 @@ OrbitData::~OrbitData()
    #ifdef DEBUG_ORBITDATA_DESTRUCTOR
    MessageInterface::ShowMessage("OrbitData::~OrbitData()\n");
    #endif
+   
+   // The memo is keyed by coordinate system pointers, which are not valid
+   // once the objects of a run are deleted
+   ClearMemos();
 }
 
 
@@ -683,8 +695,7 @@ Rvector6 OrbitData::GetCartState()
                   mInternalCS->GetName().c_str(),
                   mParameterCS->GetName().c_str());
          #endif
-         mCoordConverter.Convert(A1Mjd(mCartEpoch), lastCartState, mInternalCS,
-                                 lastCartState, mParameterCS, true);
+         lastCartState = ConvertToParameterCS(lastCartState);
          #ifdef DEBUG_ORBITDATA_CONVERT
             MessageInterface::ShowMessage
                ("   GetCartState() --> After convert: mCartEpoch=%f\n"
@@ -732,7 +743,7 @@ Rvector6 OrbitData::GetKepState()
    
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 kepState = StateConversionUtil::CartesianToKeplerian(mGravConst, state);
+   Rvector6 kepState = ConvertToKeplerian(state);
    
    #ifdef DEBUG_ORBITDATA_KEP_STATE
    MessageInterface::ShowMessage
@@ -837,7 +848,7 @@ Rvector6 OrbitData::GetModKepState()
       
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 kepState = StateConversionUtil::CartesianToKeplerian(mGravConst, state, "TA");
+   Rvector6 kepState = ConvertToKeplerian(state);
    Rvector6 modKepState = StateConversionUtil::KeplerianToModKeplerian(kepState);
    
    return modKepState;
@@ -2495,6 +2506,10 @@ bool OrbitData::SetRefObject(GmatBase *obj, const UnsignedInt type,
        (type == Gmat::BARYCENTER)       || (type == Gmat::CELESTIAL_BODY))
       useType = Gmat::SPACE_POINT;
    
+   // A replaced coordinate system may reuse the address of a memo key
+   if (type == Gmat::COORDINATE_SYSTEM)
+      ClearMemos();
+   
    return RefData::SetRefObject(obj, useType, name);
 }
 
@@ -3573,6 +3588,139 @@ void OrbitData::SetRealParameters(Integer item, Real rval)
 }
 
 
+//------------------------------------------------------------------------------
+// Rvector6 ConvertToParameterCS(const Rvector6 &state)
+//------------------------------------------------------------------------------
+/**
+ * Converts an internal state at mCartEpoch to the Parameter coordinate system.
+ *
+ * Conversions are memoized across Parameters, so the elements of one state
+ * reported together (X, Y, Z, ... or SMA, ECC, INC, ...) convert it once.
+ * Coordinate systems that depend on objects other than celestial bodies are
+ * always converted, since those objects may move while the state does not.
+ *
+ * @param  state  The state in the internal coordinate system
+ *
+ * @return the state in the Parameter coordinate system
+ */
+//------------------------------------------------------------------------------
+Rvector6 OrbitData::ConvertToParameterCS(const Rvector6 &state)
+{
+   bool useMemo = IsMemoizable(mInternalCS) && IsMemoizable(mParameterCS);
+   const Real *inState = state.GetDataVector();
+   
+   if (useMemo)
+   {
+      for (Integer i = 0; i < conversionMemoCount; ++i)
+      {
+         ConversionMemo &memo = conversionMemo[i];
+         if ((memo.epoch == mCartEpoch) && (memo.fromCS == mInternalCS) &&
+             (memo.toCS == mParameterCS) &&
+             std::equal(inState, inState + 6, memo.inState))
+            return memo.outState;
+      }
+   }
+   
+   Rvector6 outState;
+   mCoordConverter.Convert(A1Mjd(mCartEpoch), state, mInternalCS,
+                           outState, mParameterCS, true);
+   
+   if (useMemo)
+   {
+      ConversionMemo &memo = conversionMemo[conversionMemoNext];
+      memo.epoch    = mCartEpoch;
+      memo.fromCS   = mInternalCS;
+      memo.toCS     = mParameterCS;
+      std::copy(inState, inState + 6, memo.inState);
+      memo.outState = outState;
+      
+      conversionMemoNext = (conversionMemoNext + 1) % MEMO_SIZE;
+      if (conversionMemoCount < MEMO_SIZE)
+         ++conversionMemoCount;
+   }
+   
+   return outState;
+}
+
+
+//------------------------------------------------------------------------------
+// Rvector6 ConvertToKeplerian(const Rvector6 &state)
+//------------------------------------------------------------------------------
+/**
+ * Computes the Keplerian state, with true anomaly, of a Cartesian state in
+ * the Parameter coordinate system, using the memo shared by all Parameters.
+ *
+ * @param  state  The Cartesian state
+ *
+ * @return the Keplerian state
+ */
+//------------------------------------------------------------------------------
+Rvector6 OrbitData::ConvertToKeplerian(const Rvector6 &state)
+{
+   const Real *cartState = state.GetDataVector();
+   
+   for (Integer i = 0; i < keplerianMemoCount; ++i)
+   {
+      KeplerianMemo &memo = keplerianMemo[i];
+      if ((memo.mu == mGravConst) &&
+          std::equal(cartState, cartState + 6, memo.cartState))
+         return memo.kepState;
+   }
+   
+   Rvector6 kepState =
+      StateConversionUtil::CartesianToKeplerian(mGravConst, state, "TA");
+   
+   KeplerianMemo &memo = keplerianMemo[keplerianMemoNext];
+   memo.mu       = mGravConst;
+   std::copy(cartState, cartState + 6, memo.cartState);
+   memo.kepState = kepState;
+   
+   keplerianMemoNext = (keplerianMemoNext + 1) % MEMO_SIZE;
+   if (keplerianMemoCount < MEMO_SIZE)
+      ++keplerianMemoCount;
+   
+   return kepState;
+}
+
+
+//------------------------------------------------------------------------------
+// static bool IsMemoizable(CoordinateSystem *cs)
+//------------------------------------------------------------------------------
+/**
+ * Checks that conversions to a coordinate system depend only on the epoch
+ * and the state converted.
+ */
+//------------------------------------------------------------------------------
+bool OrbitData::IsMemoizable(CoordinateSystem *cs)
+{
+   if (cs == NULL)
+      return false;
+   
+   SpacePoint *origin = cs->GetOrigin();
+   if ((origin == NULL) || !origin->IsOfType(Gmat::CELESTIAL_BODY))
+      return false;
+   
+   return !cs->AreAxesOfType("ObjectReferencedAxes") &&
+          !cs->AreAxesOfType("LocalAlignedConstrainedAxes");
+}
+
+
+//------------------------------------------------------------------------------
+// static void ClearMemos()
+//------------------------------------------------------------------------------
+/**
+ * Discards the memoized conversions.
+ */
+//------------------------------------------------------------------------------
+void OrbitData::ClearMemos()
+{
+   conversionMemoCount = 0;
+   conversionMemoNext  = 0;
+   keplerianMemoCount  = 0;
+   keplerianMemoNext   = 0;
+}
+
+
 //------------------------------------------------------------------------------
 // void DebugWriteData(CoordinateSystem *paramOwnerCS)
 //------------------------------------------------------------------------------
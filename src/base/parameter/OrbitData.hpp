@@ -167,6 +167,8 @@ protected:
    Rvector6 GetCartStateInParameterCS(Integer item, Real rval);
    Rvector6 GetCartStateInParameterOrigin(Integer item, Real rval);
    void SetRealParameters(Integer item, Real rval);
+   Rvector6 ConvertToParameterCS(const Rvector6 &state);
+   Rvector6 ConvertToKeplerian(const Rvector6 &state);
    void DebugWriteData(CoordinateSystem *paramOwnerCS);
    void DebugWriteRefObjInfo();
    
@@ -196,6 +198,38 @@ protected:
    // only one CoordinateConverter needed
    static CoordinateConverter mCoordConverter;
    
+   /// A conversion of a state to a Parameter coordinate system
+   struct ConversionMemo
+   {
+      Real              epoch;
+      CoordinateSystem  *fromCS;
+      CoordinateSystem  *toCS;
+      Real              inState[6];
+      Rvector6          outState;
+   };
+   
+   /// A Keplerian state computed from a Cartesian state
+   struct KeplerianMemo
+   {
+      Real              mu;
+      Real              cartState[6];
+      Rvector6          kepState;
+   };
+   
+   /// Recent conversions, shared by all orbit Parameters so that the elements
+   /// of a state requested together are computed once.  Entries are keyed by
+   /// their inputs, so a changed state or epoch never matches a stale entry.
+   static const Integer MEMO_SIZE = 8;
+   static ConversionMemo conversionMemo[MEMO_SIZE];
+   static Integer        conversionMemoCount;
+   static Integer        conversionMemoNext;
+   static KeplerianMemo  keplerianMemo[MEMO_SIZE];
+   static Integer        keplerianMemoCount;
+   static Integer        keplerianMemoNext;
+   
+   static bool IsMemoizable(CoordinateSystem *cs);
+   static void ClearMemos();
+   
    // Other orbit items
    // @note - Do not add or remove items from this list without updating OrbitData.
    //         These enums are also used in OrbitData for passing parameter names to
@@ -1237,11 +1237,12 @@ std::string Parameter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Parameter::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<ParameterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               ParameterParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatBase::GetParameterID(str);
 }
@@ -287,11 +287,11 @@ void RealVar::SetReal(Real val)
 //------------------------------------------------------------------------------
 Integer RealVar::GetParameterID(const std::string &str) const
 {
-   for (int i=ParameterParamCount; i<RealVarParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ParameterParamCount, RealVarParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Parameter::GetParameterID(str);
 }
@@ -245,11 +245,12 @@ const Rvector& RvectorVar::EvaluateRvector()
 //------------------------------------------------------------------------------
 Integer RvectorVar::GetParameterID(const std::string &str) const
 {
-   for (int i = ParameterParamCount; i < RvectorVarParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ParameterParamCount,
+               RvectorVarParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Parameter::GetParameterID(str);
 }
@@ -289,11 +289,12 @@ void StringVar::Copy(const GmatBase* orig)
 //------------------------------------------------------------------------------
 Integer StringVar::GetParameterID(const std::string &str) const
 {
-   for (int i=ParameterParamCount; i<StringVarParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ParameterParamCount,
+               StringVarParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Parameter::GetParameterID(str);
 }
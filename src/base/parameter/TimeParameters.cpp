@@ -1499,11 +1499,12 @@ bool ElapsedDays::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedDays::GetParameterID(const std::string &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedDaysParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ParameterParamCount,
+               ElapsedDaysParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return TimeReal::GetParameterID(str);
 }
@@ -1793,11 +1794,12 @@ bool ElapsedDaysFromStart::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedDaysFromStart::GetParameterID(const std::string &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedDaysFromStartParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ParameterParamCount,
+               ElapsedDaysFromStartParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return TimeReal::GetParameterID(str);
 }
@@ -2088,11 +2090,12 @@ bool ElapsedSecs::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedSecs::GetParameterID(const std::string &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedSecsParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ParameterParamCount,
+               ElapsedSecsParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return TimeReal::GetParameterID(str);
 }
@@ -2382,11 +2385,12 @@ bool ElapsedSecsFromStart::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedSecsFromStart::GetParameterID(const std::string &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedSecsFromStartParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ParameterParamCount,
+               ElapsedSecsFromStartParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return TimeReal::GetParameterID(str);
 }
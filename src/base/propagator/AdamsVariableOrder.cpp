@@ -0,0 +1,1058 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             AdamsVariableOrder
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the variable step, variable order Adams-Bashforth-Moulton
+ * integrator.
+ */
+//------------------------------------------------------------------------------
+
+#include "AdamsVariableOrder.hpp"
+#include "PropagatorException.hpp"
+#include "MessageInterface.hpp"
+#include <string.h>
+#include <math.h>
+
+//#define DEBUG_PROPAGATION
+
+
+//---------------------------------
+// static data
+//---------------------------------
+
+/// Error estimate factors from Shampine and Gordon (index 0 is unused)
+const Real AdamsVariableOrder::GSTR[MAX_ORDER + 2] =
+{
+   0.0, 0.5, 0.0833, 0.0417, 0.0264, 0.0188, 0.0143, 0.0114, 0.00936,
+   0.00789, 0.00679, 0.00592, 0.00524, 0.00468
+};
+
+/// 2^i, used to decide if the step can be doubled (index 0 is unused)
+const Real AdamsVariableOrder::TWO[MAX_ORDER + 2] =
+{
+   0.0, 2.0, 4.0, 8.0, 16.0, 32.0, 64.0, 128.0, 256.0, 512.0, 1024.0, 2048.0,
+   4096.0, 8192.0
+};
+
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// AdamsVariableOrder(const std::string &nomme)
+//------------------------------------------------------------------------------
+/**
+ * The constructor
+ *
+ * @param nomme The name of the new propagator
+ */
+//------------------------------------------------------------------------------
+AdamsVariableOrder::AdamsVariableOrder(const std::string &nomme) :
+   Integrator              ("AdamsVariableOrder", nomme),
+   phiData                 (NULL),
+   trialPhi                (NULL),
+   savedPhi                (NULL),
+   predicted               (NULL),
+   corrected               (NULL),
+   derivatives             (NULL),
+   correction              (NULL),
+   lastState               (NULL),
+   savedState              (NULL),
+   order                   (1),
+   oldOrder                (0),
+   sameStepCount           (0),
+   oldStep                 (0.0),
+   startPhase              (true),
+   minimumStepReached      (false),
+   historyStarted          (false),
+   restartPending          (false),
+   lastTime                (0.0),
+   maxError                (0.0),
+   orderError              (0.0),
+   historySaved            (false),
+   savedTime               (0.0),
+   savedOrder              (1),
+   savedOldOrder           (0),
+   savedSameStepCount      (0),
+   savedStepSize           (0.0),
+   savedOldStep            (0.0),
+   savedStartPhase         (true),
+   savedMinimumStepReached (false)
+{
+   for (Integer i = 0; i < PHI_COLUMNS; ++i)
+      phi[i] = NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// ~AdamsVariableOrder()
+//------------------------------------------------------------------------------
+/**
+ * The destructor
+ */
+//------------------------------------------------------------------------------
+AdamsVariableOrder::~AdamsVariableOrder()
+{
+   FreeArrays();
+}
+
+
+//------------------------------------------------------------------------------
+// AdamsVariableOrder(const AdamsVariableOrder& avo)
+//------------------------------------------------------------------------------
+/**
+ * The copy constructor
+ *
+ * The step history is not copied; the copy starts itself when it is
+ * initialized.
+ *
+ * @param avo The propagator that supplies data for this one
+ */
+//------------------------------------------------------------------------------
+AdamsVariableOrder::AdamsVariableOrder(const AdamsVariableOrder& avo) :
+   Integrator              (avo),
+   phiData                 (NULL),
+   trialPhi                (NULL),
+   savedPhi                (NULL),
+   predicted               (NULL),
+   corrected               (NULL),
+   derivatives             (NULL),
+   correction              (NULL),
+   lastState               (NULL),
+   savedState              (NULL),
+   order                   (1),
+   oldOrder                (0),
+   sameStepCount           (0),
+   oldStep                 (0.0),
+   startPhase              (true),
+   minimumStepReached      (false),
+   historyStarted          (false),
+   restartPending          (false),
+   lastTime                (0.0),
+   maxError                (0.0),
+   orderError              (0.0),
+   historySaved            (false),
+   savedTime               (0.0),
+   savedOrder              (1),
+   savedOldOrder           (0),
+   savedSameStepCount      (0),
+   savedStepSize           (0.0),
+   savedOldStep            (0.0),
+   savedStartPhase         (true),
+   savedMinimumStepReached (false)
+{
+   for (Integer i = 0; i < PHI_COLUMNS; ++i)
+      phi[i] = NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// AdamsVariableOrder& operator=(const AdamsVariableOrder& avo)
+//------------------------------------------------------------------------------
+/**
+ * The assignment operator
+ *
+ * @param avo The propagator that supplies data for this one
+ *
+ * @return This propagator, configured to match avo
+ */
+//------------------------------------------------------------------------------
+AdamsVariableOrder& AdamsVariableOrder::operator=(const AdamsVariableOrder& avo)
+{
+   if (this == &avo)
+      return *this;
+
+   FreeArrays();
+   Integrator::operator=(avo);
+
+   historyStarted = false;
+   restartPending = false;
+   historySaved   = false;
+   maxError       = 0.0;
+   orderError     = 0.0;
+   isInitialized  = false;
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Method used to create a copy of the object
+ *
+ * @return A clone of this instance
+ */
+//------------------------------------------------------------------------------
+GmatBase* AdamsVariableOrder::Clone() const
+{
+   return new AdamsVariableOrder(*this);
+}
+
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Sets up the integrator for propagation
+ *
+ * The arrays are sized for the physical model, and the step history is
+ * cleared so that the next step starts the integrator.
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool AdamsVariableOrder::Initialize()
+{
+   Propagator::Initialize();
+
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("Initializing %s\n", typeName.c_str());
+   #endif
+
+   if (physicalModel == NULL)
+   {
+      isInitialized = false;
+      return isInitialized;
+   }
+
+   dimension = physicalModel->GetDimension();
+   if (!AllocateArrays())
+   {
+      isInitialized = false;
+      return isInitialized;
+   }
+
+   ddt = physicalModel->GetDerivativeArray();
+   Restart();
+   historySaved = false;
+   accuracyWarningTriggered = false;
+
+   return isInitialized;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step()
+//------------------------------------------------------------------------------
+/**
+ * Advances the state by one variable step
+ *
+ * The step taken is the step selected by the error control on the last step,
+ * limited by the maximum step settings.
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool AdamsVariableOrder::Step()
+{
+   if (!isInitialized)
+      return false;
+
+   if (stepSize == 0.0)
+      return false;
+
+   PrepareHistory(stepSize);
+
+   bool forceLimited = false;
+   Real h = LimitStep(stepSize, forceLimited);
+
+   if (!TakeStep(h))
+      return false;
+
+   // The forces can change at the end of a limited step, so the history
+   // does not carry across it
+   if (forceLimited && (stepTaken == h))
+      restartPending = true;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step(Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Advances the state across a specified interval
+ *
+ * The interval is split into equal steps no larger than the step selected by
+ * the error control.  Equal steps let the order rise when the caller asks for
+ * a series of fixed intervals, and the step selected before the split is kept
+ * for the next call, so that a short step at the end of an interval does not
+ * slow the steps that follow.
+ *
+ * @param dt The interval
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool AdamsVariableOrder::Step(Real dt)
+{
+   if (!isInitialized)
+      return false;
+
+   if (dt == 0.0)
+   {
+      stepTaken = 0.0;
+      return true;
+   }
+
+   PrepareHistory(dt);
+
+   if (stepSize * dt <= 0.0)
+      stepSize = dt;
+
+   timeleft = dt;
+   while (fabs(timeleft) > smallestTime)
+   {
+      bool forceLimited = false;
+      Real h = LimitStep(stepSize, forceLimited);
+      Real proposed = stepSize;
+
+      if (fabs(h) >= fabs(timeleft) - smallestTime)
+      {
+         h = timeleft;
+         forceLimited = false;
+      }
+      else if (!forceLimited)
+         h = timeleft / ceil(fabs(timeleft / h));
+
+      if (!TakeStep(h))
+         return false;
+      timeleft -= stepTaken;
+
+      // Keep the larger step unless the error control asked for a smaller one
+      if ((stepTaken == h) && (fabs(stepSize) >= fabs(h)) &&
+          (fabs(stepSize) < fabs(proposed)))
+         stepSize = proposed;
+
+      if (forceLimited && (stepTaken == h))
+         Restart();
+   }
+
+   stepTaken = dt;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool RawStep()
+//------------------------------------------------------------------------------
+/**
+ * Uncontrolled steps are not supported by the multistep integrator.
+ *
+ * @return false always
+ */
+//------------------------------------------------------------------------------
+bool AdamsVariableOrder::RawStep()
+{
+   return false;
+}
+
+
+//---------------------------------
+// protected
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// Real EstimateError()
+//------------------------------------------------------------------------------
+/**
+ * Returns the error estimate for the last step tried.
+ *
+ * The estimates are built inside of the step, at the current order and its
+ * neighbors, from the difference between the derivatives at the predicted
+ * state and the predicted derivatives.
+ *
+ * @return The error estimate of the last step
+ */
+//------------------------------------------------------------------------------
+Real AdamsVariableOrder::EstimateError()
+{
+   return maxError;
+}
+
+
+//------------------------------------------------------------------------------
+// bool AdaptStep(Real maxerror)
+//------------------------------------------------------------------------------
+/**
+ * Selects the next step after an accepted step.
+ *
+ * The step is doubled during start up, and when the estimated error at the
+ * order chosen for the next step is small enough that a doubled step still
+ * meets the accuracy.  Otherwise the step is kept if it meets the accuracy, or
+ * reduced to between 0.5 and 0.9 of its size.
+ *
+ * @param maxerror The error estimate at the order chosen for the next step
+ *
+ * @return true always
+ */
+//------------------------------------------------------------------------------
+bool AdamsVariableOrder::AdaptStep(Real maxerror)
+{
+   Real p5eps = 0.5 * tolerance;
+   Real newStep = stepTaken + stepTaken;
+
+   if (!startPhase && (p5eps < maxerror * TWO[order+1]))
+   {
+      newStep = stepTaken;
+      if (p5eps < maxerror)
+      {
+         Real r = pow(p5eps / maxerror, 1.0 / (order + 1));
+         if (r < 0.5)
+            r = 0.5;
+         if (r > 0.9)
+            r = 0.9;
+         newStep = r * stepTaken;
+      }
+   }
+
+   if (fabs(newStep) > maximumStep)
+      newStep = (newStep > 0.0 ? maximumStep : -maximumStep);
+
+   stepSize = newStep;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool AllocateArrays()
+//------------------------------------------------------------------------------
+/**
+ * Allocates the history and work arrays for the current dimension.
+ *
+ * @return true on success, false if memory could not be allocated
+ */
+//------------------------------------------------------------------------------
+bool AdamsVariableOrder::AllocateArrays()
+{
+   FreeArrays();
+
+   if (dimension <= 0)
+      return false;
+
+   Integer tableSize = (PHI_COLUMNS - 1) * dimension;
+
+   phiData      = new Real[tableSize];
+   trialPhi     = new Real[tableSize];
+   savedPhi     = new Real[tableSize];
+   predicted    = new Real[dimension];
+   corrected    = new Real[dimension];
+   derivatives  = new Real[dimension];
+   correction   = new Real[dimension];
+   lastState    = new Real[dimension];
+   savedState   = new Real[dimension];
+   errorEstimates = new Real[dimension];
+
+   memset(phiData, 0, tableSize * sizeof(Real));
+   for (Integer i = 1; i < PHI_COLUMNS; ++i)
+      phi[i] = phiData + (i-1) * dimension;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void FreeArrays()
+//------------------------------------------------------------------------------
+/**
+ * Releases the history and work arrays.
+ */
+//------------------------------------------------------------------------------
+void AdamsVariableOrder::FreeArrays()
+{
+   if (phiData)
+      delete [] phiData;
+   phiData = NULL;
+   if (trialPhi)
+      delete [] trialPhi;
+   trialPhi = NULL;
+   if (savedPhi)
+      delete [] savedPhi;
+   savedPhi = NULL;
+   if (predicted)
+      delete [] predicted;
+   predicted = NULL;
+   if (corrected)
+      delete [] corrected;
+   corrected = NULL;
+   if (derivatives)
+      delete [] derivatives;
+   derivatives = NULL;
+   if (correction)
+      delete [] correction;
+   correction = NULL;
+   if (lastState)
+      delete [] lastState;
+   lastState = NULL;
+   if (savedState)
+      delete [] savedState;
+   savedState = NULL;
+   if (errorEstimates)
+      delete [] errorEstimates;
+   errorEstimates = NULL;
+
+   for (Integer i = 0; i < PHI_COLUMNS; ++i)
+      phi[i] = NULL;
+
+   historyStarted = false;
+   historySaved = false;
+}
+
+
+//------------------------------------------------------------------------------
+// void Restart()
+//------------------------------------------------------------------------------
+/**
+ * Discards the step history, so the next step starts the integrator again.
+ */
+//------------------------------------------------------------------------------
+void AdamsVariableOrder::Restart()
+{
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("%s restarting\n", instanceName.c_str());
+   #endif
+
+   historyStarted = false;
+   restartPending = false;
+}
+
+
+//------------------------------------------------------------------------------
+// bool StartHistory()
+//------------------------------------------------------------------------------
+/**
+ * Starts the step history at the current state.
+ *
+ * The history starts with the derivatives at the current state, for order 1.
+ *
+ * @return true on success, false if the derivatives could not be evaluated
+ */
+//------------------------------------------------------------------------------
+bool AdamsVariableOrder::StartHistory()
+{
+   if (!physicalModel->GetDerivatives(inState))
+      return false;
+
+   memset(phiData, 0, (PHI_COLUMNS - 1) * dimension * sizeof(Real));
+   memcpy(phi[1], ddt, dimension * sizeof(Real));
+
+   for (Integer i = 0; i < MAX_ORDER + 2; ++i)
+      psi[i] = 0.0;
+
+   order              = 1;
+   oldOrder           = 0;
+   sameStepCount      = 0;
+   oldStep            = 0.0;
+   startPhase         = true;
+   minimumStepReached = false;
+   historyStarted     = true;
+   restartPending     = false;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void PrepareHistory(Real direction)
+//------------------------------------------------------------------------------
+/**
+ * Checks that the step history matches the state before a call steps it.
+ *
+ * The history carries on if the state is the one produced by the last step.
+ * If the state was moved back to the start of the previous call, the history
+ * saved then is restored.  Otherwise, or if the direction of propagation
+ * changed, the integrator restarts.  The history is then saved so that this
+ * call can be reverted in turn.
+ *
+ * @param direction A value whose sign is the direction of the call
+ */
+//------------------------------------------------------------------------------
+void AdamsVariableOrder::PrepareHistory(Real direction)
+{
+   if (inState != physicalModel->GetState())
+      memcpy(inState, physicalModel->GetState(), sizeof(Real) * dimension);
+
+   if (historyStarted && !restartPending && (oldStep * direction > 0.0) &&
+       MatchesState(lastState, lastTime))
+   {
+      // The history continues from the last step
+   }
+   else if (historySaved && (savedOldStep * direction > 0.0) &&
+            MatchesState(savedState, savedTime))
+   {
+      #ifdef DEBUG_PROPAGATION
+         MessageInterface::ShowMessage("%s restoring the history from the "
+               "start of the last call\n", instanceName.c_str());
+      #endif
+
+      memcpy(phiData, savedPhi, (PHI_COLUMNS-1) * dimension * sizeof(Real));
+      memcpy(psi, savedPsi, (MAX_ORDER + 2) * sizeof(Real));
+      memcpy(lastState, savedState, dimension * sizeof(Real));
+      lastTime           = savedTime;
+      order              = savedOrder;
+      oldOrder           = savedOldOrder;
+      sameStepCount      = savedSameStepCount;
+      stepSize           = savedStepSize;
+      oldStep            = savedOldStep;
+      startPhase         = savedStartPhase;
+      minimumStepReached = savedMinimumStepReached;
+      historyStarted     = true;
+      restartPending     = false;
+   }
+   else
+      Restart();
+
+   historySaved = historyStarted;
+   if (historySaved)
+   {
+      memcpy(savedPhi, phiData, (PHI_COLUMNS-1) * dimension * sizeof(Real));
+      memcpy(savedPsi, psi, (MAX_ORDER + 2) * sizeof(Real));
+      memcpy(savedState, inState, dimension * sizeof(Real));
+      savedTime               = physicalModel->GetTime();
+      savedOrder              = order;
+      savedOldOrder           = oldOrder;
+      savedSameStepCount      = sameStepCount;
+      savedStepSize           = stepSize;
+      savedOldStep            = oldStep;
+      savedStartPhase         = startPhase;
+      savedMinimumStepReached = minimumStepReached;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool MatchesState(const Real *ref, Real refTime)
+//------------------------------------------------------------------------------
+/**
+ * Checks the propagation state and time against a reference.
+ *
+ * The state is rebuilt from the propagated objects between steps, so a small
+ * relative difference is allowed for round off.
+ *
+ * @param ref     The reference state
+ * @param refTime The reference model time
+ *
+ * @return true if the propagation state matches the reference
+ */
+//------------------------------------------------------------------------------
+bool AdamsVariableOrder::MatchesState(const Real *ref, Real refTime)
+{
+   if (fabs(physicalModel->GetTime() - refTime) > smallestTime)
+      return false;
+
+   for (Integer j = 0; j < dimension; ++j)
+      if (fabs(inState[j] - ref[j]) > 1.0e-12 * (fabs(ref[j]) + 1.0))
+         return false;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real LimitStep(Real h, bool &forceLimited)
+//------------------------------------------------------------------------------
+/**
+ * Applies the maximum step settings to a step.
+ *
+ * @param h            The proposed step
+ * @param forceLimited Set to true if the force model cut the step
+ *
+ * @return The step to take
+ */
+//------------------------------------------------------------------------------
+Real AdamsVariableOrder::LimitStep(Real h, bool &forceLimited)
+{
+   forceLimited = false;
+
+   if (fabs(h) > maximumStep)
+      h = (h > 0.0 ? maximumStep : -maximumStep);
+
+   Real forceMaxStep = physicalModel->GetForceMaxStep(h > 0.0);
+   if ((fabs(h) > fabs(forceMaxStep)) && (forceMaxStep != 0.0))
+   {
+      h = forceMaxStep;
+      forceLimited = true;
+   }
+
+   return h;
+}
+
+
+//------------------------------------------------------------------------------
+// bool TakeStep(Real h)
+//------------------------------------------------------------------------------
+/**
+ * Takes one accepted step, starting with a trial step of size h.
+ *
+ * This is the STEP algorithm of Shampine and Gordon: the integration
+ * coefficients are formed for the step, the state is predicted and the
+ * derivatives there are evaluated, and the error is estimated at the current
+ * order and the two orders below it.  A failed step is retried with half the
+ * step (after the third failure, at order 1 and the step the estimate calls
+ * for).  An accepted step is corrected, the derivatives are evaluated at the
+ * corrected state, the differences are updated, and the order and step for
+ * the next step are selected.  The predictor and corrector sums are
+ * compensated for round off.
+ *
+ * Errors are measured with the physical model's error norm, as for the other
+ * integrators, against the Accuracy setting.
+ *
+ * On success, stepTaken holds the accepted step and stepSize the step to try
+ * next.
+ *
+ * @param h The step to try
+ *
+ * @return true on success, false if no step could be taken
+ */
+//------------------------------------------------------------------------------
+bool AdamsVariableOrder::TakeStep(Real h)
+{
+   Integer i, j;
+
+   if (inState != physicalModel->GetState())
+      memcpy(inState, physicalModel->GetState(), sizeof(Real) * dimension);
+
+   physicalModel->SetDirection(h > 0.0 ? 1.0 : -1.0);
+
+   if (!historyStarted)
+      if (!StartHistory())
+         return false;
+
+   Real p5eps = 0.5 * tolerance;
+   Integer failures = 0;
+   Integer tableSize = (PHI_COLUMNS - 1) * dimension;
+
+   memcpy(trialPhi, phiData, tableSize * sizeof(Real));
+
+   while (true)
+   {
+      Integer k = order;
+      // Steps that split an interval evenly can differ in the last bits
+      Integer ns = ((fabs(h - oldStep) > 1.0e-12 * fabs(h)) ? 0 :
+                    sameStepCount);
+      if (ns <= oldOrder)
+         ++ns;
+
+      ComputeCoefficients(h);
+
+      // Change phi to phi star
+      for (i = 2; i <= k; ++i)
+         for (j = 0; j < dimension; ++j)
+            phi[i][j] *= beta[i];
+
+      // Predict the solution and the differences
+      for (j = 0; j < dimension; ++j)
+      {
+         phi[k+2][j] = phi[k+1][j];
+         phi[k+1][j] = 0.0;
+         predicted[j] = 0.0;
+      }
+      for (i = k; i >= 1; --i)
+      {
+         for (j = 0; j < dimension; ++j)
+         {
+            predicted[j] += g[i] * phi[i][j];
+            phi[i][j] += phi[i+1][j];
+         }
+      }
+      for (j = 0; j < dimension; ++j)
+      {
+         Real tau = h * predicted[j] - phi[15][j];
+         predicted[j] = inState[j] + tau;
+         phi[16][j] = (predicted[j] - inState[j]) - tau;
+      }
+
+      if (!physicalModel->GetDerivatives(predicted, h))
+      {
+         memcpy(phiData, trialPhi, tableSize * sizeof(Real));
+         return false;
+      }
+      memcpy(derivatives, ddt, dimension * sizeof(Real));
+      for (j = 0; j < dimension; ++j)
+         correction[j] = derivatives[j] - phi[1][j];
+
+      // Estimate the errors at orders k, k-1 and k-2
+      Real absh = fabs(h);
+      Real base = ErrorNorm(correction, NULL, absh, predicted);
+      Real erkm1 = 0.0, erkm2 = 0.0;
+      if (k > 1)
+         erkm1 = absh * sig[k] * GSTR[k-1] *
+               ErrorNorm(correction, phi[k], 1.0, predicted);
+      if (k > 2)
+         erkm2 = absh * sig[k-1] * GSTR[k-2] *
+               ErrorNorm(correction, phi[k-1], 1.0, predicted);
+      Real err = base * (g[k] - g[k+1]);
+      Real erk = base * sig[k+1] * GSTR[k];
+
+      // Without error control the step stays fixed and the order rises
+      bool noErrorControl = ((base == 0.0) && (erkm1 == 0.0) &&
+                             (erkm2 == 0.0));
+
+      Integer newOrder = k;
+      if (!noErrorControl)
+      {
+         if (k > 2)
+         {
+            if (((erkm1 > erkm2) ? erkm1 : erkm2) <= erk)
+               newOrder = k - 1;
+         }
+         else if (k == 2)
+         {
+            if (erkm1 <= 0.5 * erk)
+               newOrder = k - 1;
+         }
+      }
+
+      maxError = err;
+
+      #ifdef DEBUG_PROPAGATION
+         MessageInterface::ShowMessage("   Step %.12le at order %d: error "
+               "%le\n", h, k, err);
+      #endif
+
+      if (err > tolerance)
+      {
+         // The step failed; on the third failure drop to order 1, and after
+         // that use the step the error estimate calls for
+         ++failures;
+         Real factor = 0.5;
+         if (failures >= 3)
+         {
+            newOrder = 1;
+            if ((failures > 3) && (p5eps < 0.25 * erk))
+               factor = sqrt(p5eps / erk);
+         }
+         Real newStep = factor * h;
+
+         bool acceptStep = false;
+         if (minimumStepReached && (fabs(newStep) < minimumStep))
+         {
+            if (fabs(h) <= minimumStep)
+            {
+               if (stopIfAccuracyViolated)
+               {
+                  memcpy(phiData, trialPhi, tableSize * sizeof(Real));
+                  throw PropagatorException(typeSource + ": Accuracy "
+                        "settings will be violated with current step size "
+                        "values.\n");
+               }
+               if (!accuracyWarningTriggered)
+               {
+                  accuracyWarningTriggered = true;
+                  MessageInterface::ShowMessage("**** Warning **** %s: "
+                        "Accuracy settings will be violated with current "
+                        "step size values.\n", typeSource.c_str());
+               }
+               acceptStep = true;
+            }
+            else
+               newStep = (h > 0.0 ? minimumStep : -minimumStep);
+         }
+
+         if (!acceptStep)
+         {
+            memcpy(phiData, trialPhi, tableSize * sizeof(Real));
+            startPhase = false;
+
+            if (failures >= maxStepAttempts)
+            {
+               MessageInterface::ShowMessage("%d step attempts taken; max is "
+                     "%d\n", failures, maxStepAttempts);
+               return false;
+            }
+
+            order = newOrder;
+            h = newStep;
+            continue;
+         }
+      }
+
+      // The step is good: correct, evaluate, and update the differences
+      Real hg = h * g[k+1];
+      for (j = 0; j < dimension; ++j)
+      {
+         Real rho = hg * correction[j] - phi[16][j];
+         corrected[j] = predicted[j] + rho;
+         phi[15][j] = (corrected[j] - predicted[j]) - rho;
+      }
+
+      if (!physicalModel->GetDerivatives(corrected, h))
+      {
+         memcpy(phiData, trialPhi, tableSize * sizeof(Real));
+         return false;
+      }
+      memcpy(derivatives, ddt, dimension * sizeof(Real));
+
+      for (j = 0; j < dimension; ++j)
+      {
+         phi[k+1][j] = derivatives[j] - phi[1][j];
+         phi[k+2][j] = phi[k+1][j] - phi[k+2][j];
+      }
+      for (i = 1; i <= k; ++i)
+         for (j = 0; j < dimension; ++j)
+            phi[i][j] += phi[k+1][j];
+
+      for (i = 1; i <= k; ++i)
+         psi[i] = trialPsi[i];
+      oldOrder = k;
+      oldStep = h;
+      sameStepCount = ns;
+
+      // Select the order for the next step.  The error at order k+1 is only
+      // estimated when the last k+1 steps had the same size.
+      if ((newOrder == k - 1) || (k == MAX_ORDER))
+         startPhase = false;
+
+      if (noErrorControl)
+      {
+         startPhase = false;
+         if (k < MAX_ORDER)
+            order = k + 1;
+      }
+      else if (startPhase)
+      {
+         order = k + 1;
+         erk = 0.0;
+      }
+      else if (newOrder == k - 1)
+      {
+         order = k - 1;
+         erk = erkm1;
+      }
+      else if (k + 1 <= ns)
+      {
+         Real erkp1 = absh * GSTR[k+1] *
+               ErrorNorm(phi[k+2], NULL, 1.0, corrected);
+         if (k == 1)
+         {
+            if (erkp1 < 0.5 * erk)
+            {
+               order = k + 1;
+               erk = erkp1;
+            }
+         }
+         else if (erkm1 <= ((erk < erkp1) ? erk : erkp1))
+         {
+            order = k - 1;
+            erk = erkm1;
+         }
+         else if ((erkp1 < erk) && (k != MAX_ORDER))
+         {
+            order = k + 1;
+            erk = erkp1;
+         }
+      }
+
+      memcpy(outState, corrected, dimension * sizeof(Real));
+      physicalModel->IncrementTime(h);
+
+      stepTaken = h;
+      stepAttempts = 0;
+      orderError = erk;
+      if (fabs(h) >= minimumStep)
+         minimumStepReached = true;
+
+      if (noErrorControl)
+         stepSize = h;
+      else
+         AdaptStep(orderError);
+
+      memcpy(lastState, outState, dimension * sizeof(Real));
+      lastTime = physicalModel->GetTime();
+
+      return true;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void ComputeCoefficients(Real h)
+//------------------------------------------------------------------------------
+/**
+ * Builds the integration coefficients for a step of size h at the current
+ * order.
+ *
+ * The coefficients follow from the spacing of the points in the history; they
+ * are recomputed in full on every step, which is cheap next to a derivative
+ * evaluation.
+ *
+ * @param h The step
+ */
+//------------------------------------------------------------------------------
+void AdamsVariableOrder::ComputeCoefficients(Real h)
+{
+   Integer k = order, i, q;
+
+   trialPsi[1] = h;
+   alpha[1] = 1.0;
+   beta[1] = 1.0;
+   for (i = 2; i <= k; ++i)
+   {
+      trialPsi[i] = psi[i-1] + h;
+      alpha[i] = h / trialPsi[i];
+      beta[i] = beta[i-1] * trialPsi[i-1] / psi[i-1];
+   }
+
+   sig[1] = 1.0;
+   for (i = 1; i <= k; ++i)
+      sig[i+1] = i * alpha[i] * sig[i];
+
+   for (q = 1; q <= k + 1; ++q)
+      w[q] = 1.0 / (q * (q + 1));
+
+   g[1] = 1.0;
+   g[2] = 0.5;
+   for (i = 3; i <= k + 1; ++i)
+   {
+      for (q = 1; q <= k + 2 - i; ++q)
+         w[q] -= alpha[i-1] * w[q+1];
+      g[i] = w[1];
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real ErrorNorm(const Real *diffs, const Real *column, Real scale,
+//                Real *answer)
+//------------------------------------------------------------------------------
+/**
+ * Measures an error vector with the physical model's error norm.
+ *
+ * @param diffs  The error vector
+ * @param column An array added to diffs, or NULL
+ * @param scale  Factor applied to the sum
+ * @param answer The candidate state the error is measured against
+ *
+ * @return The error
+ */
+//------------------------------------------------------------------------------
+Real AdamsVariableOrder::ErrorNorm(const Real *diffs, const Real *column,
+                                   Real scale, Real *answer)
+{
+   for (Integer j = 0; j < dimension; ++j)
+      errorEstimates[j] = scale * (column == NULL ? diffs[j] :
+                                   diffs[j] + column[j]);
+
+   return physicalModel->EstimateError(errorEstimates, answer);
+}
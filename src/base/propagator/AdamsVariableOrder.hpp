@@ -0,0 +1,177 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             AdamsVariableOrder
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the variable step, variable order Adams-Bashforth-Moulton
+ * integrator.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef AdamsVariableOrder_hpp
+#define AdamsVariableOrder_hpp
+
+#include "gmatdefs.hpp"
+#include "Integrator.hpp"
+
+/**
+ * Variable step, variable order Adams-Bashforth-Moulton integrator
+ *
+ * This integrator implements the Adams predictor-corrector method of Shampine
+ * and Gordon (the STEP integrator used in DE; see L. F. Shampine and M. K.
+ * Gordon, "Computer Solution of Ordinary Differential Equations: the Initial
+ * Value Problem", 1975).  The history of the solution is kept as modified
+ * divided differences of the derivatives, so the step can change on every
+ * step without restarting the method, and the order is selected between 1 and
+ * 12 from error estimates at the neighboring orders.  Each step is a PECE
+ * step: one derivative evaluation for the predicted state, and one for the
+ * corrected state.
+ *
+ * The integrator starts itself at order 1 with a small step, raising the order
+ * and doubling the step until the error estimates show that the order is
+ * high enough.  The minimum step setting is not applied during this start up.
+ * The history is kept across steps as long as the state handed to the
+ * integrator is the state it produced on its last step.  If the state is
+ * moved back to the start of the last call, as the Propagate command does when
+ * it searches for a stopping condition, the history saved at the start of
+ * that call is restored.  Any other change to the state, such as an impulsive
+ * maneuver, restarts the integrator.
+ *
+ * Steps are cut to the maximum step allowed by the force model; the integrator
+ * restarts at the end of such a step because the forces may be discontinuous
+ * there.
+ */
+class GMAT_API AdamsVariableOrder : public Integrator
+{
+public:
+   AdamsVariableOrder(const std::string &nomme = "");
+   virtual ~AdamsVariableOrder();
+   AdamsVariableOrder(const AdamsVariableOrder& avo);
+   AdamsVariableOrder& operator=(const AdamsVariableOrder& avo);
+
+   virtual GmatBase*       Clone() const;
+
+   virtual bool            Initialize();
+   virtual bool            Step();
+   virtual bool            Step(Real dt);
+   virtual bool            RawStep();
+
+protected:
+   /// The highest order used by the integrator
+   static const Integer    MAX_ORDER = 12;
+   /// Size of the column table: MAX_ORDER + 2 differences and two round off
+   /// columns, indexed from 1
+   static const Integer    PHI_COLUMNS = MAX_ORDER + 5;
+
+   /// Error estimate factors for the orders (indexed from 1)
+   static const Real       GSTR[MAX_ORDER + 2];
+   /// Powers of two used to test for step doubling (indexed from 1)
+   static const Real       TWO[MAX_ORDER + 2];
+
+   // Coefficient arrays are indexed from 1, as in the reference algorithm
+   /// Modified divided differences; columns 15 and 16 hold round off
+   Real                    *phi[PHI_COLUMNS];
+   /// Storage for the difference columns
+   Real                    *phiData;
+   /// Differences at the start of the current step, for failed steps
+   Real                    *trialPhi;
+   /// Differences at the start of the current call, for reverted calls
+   Real                    *savedPhi;
+   /// Predicted state
+   Real                    *predicted;
+   /// Corrected state
+   Real                    *corrected;
+   /// Derivatives at the predicted, then the corrected, state
+   Real                    *derivatives;
+   /// Derivatives at the predicted state less the predicted derivatives
+   Real                    *correction;
+   /// State at the end of the last accepted step
+   Real                    *lastState;
+   /// State at the start of the current call
+   Real                    *savedState;
+
+   /// Spacing between the last accepted point and the points before it
+   Real                    psi[MAX_ORDER + 2];
+   /// Spacing for the step being tried
+   Real                    trialPsi[MAX_ORDER + 2];
+   /// Step ratio coefficients for the step being tried
+   Real                    alpha[MAX_ORDER + 2];
+   /// Coefficients that convert the differences to the current step
+   Real                    beta[MAX_ORDER + 2];
+   /// Error estimate scale factors
+   Real                    sig[MAX_ORDER + 3];
+   /// Integration coefficients
+   Real                    g[MAX_ORDER + 3];
+   /// Work array used to build the integration coefficients
+   Real                    w[MAX_ORDER + 3];
+
+   /// Current order
+   Integer                 order;
+   /// Order used on the last accepted step
+   Integer                 oldOrder;
+   /// Number of steps taken with the current step size
+   Integer                 sameStepCount;
+   /// Last accepted step
+   Real                    oldStep;
+   /// Flag indicating the start up phase, when order and step are raised
+   bool                    startPhase;
+   /// Flag indicating that the step has grown past the minimum step
+   bool                    minimumStepReached;
+   /// Flag indicating that a history is available
+   bool                    historyStarted;
+   /// Flag indicating that the next step must restart the history
+   bool                    restartPending;
+   /// Model time at the end of the last accepted step
+   Real                    lastTime;
+   /// Error estimate for the last step tried
+   Real                    maxError;
+   /// Error estimate at the order selected for the next step
+   Real                    orderError;
+
+   /// Flag indicating that the history at the start of the call was saved
+   bool                    historySaved;
+   /// Model time at the start of the current call
+   Real                    savedTime;
+   // Step data at the start of the current call
+   Real                    savedPsi[MAX_ORDER + 2];
+   Integer                 savedOrder;
+   Integer                 savedOldOrder;
+   Integer                 savedSameStepCount;
+   Real                    savedStepSize;
+   Real                    savedOldStep;
+   bool                    savedStartPhase;
+   bool                    savedMinimumStepReached;
+
+   virtual Real            EstimateError();
+   virtual bool            AdaptStep(Real maxerror);
+
+   bool                    AllocateArrays();
+   void                    FreeArrays();
+   void                    Restart();
+   bool                    StartHistory();
+   void                    PrepareHistory(Real direction);
+   bool                    MatchesState(const Real *ref, Real refTime);
+   Real                    LimitStep(Real h, bool &forceLimited);
+   bool                    TakeStep(Real h);
+   void                    ComputeCoefficients(Real h);
+   Real                    ErrorNorm(const Real *diffs, const Real *column,
+                                     Real scale, Real *answer);
+};
+
+#endif // AdamsVariableOrder_hpp
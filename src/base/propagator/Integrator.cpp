@@ -265,11 +265,12 @@ std::string Integrator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Integrator::GetParameterID(const std::string &str) const
 {
-    for (int i = PropagatorParamCount; i < IntegratorParamCount; i++)
-    {
-        if (str == PARAMETER_TEXT[i - PropagatorParamCount])
-            return i;
-    }
+    static const ParameterIndex
+          parameterIndex(PARAMETER_TEXT, PropagatorParamCount,
+                IntegratorParamCount);
+    Integer parameterId = parameterIndex.Find(str);
+    if (parameterId != -1)
+       return parameterId;
     return Propagator::GetParameterID(str);
 }
 
@@ -905,11 +905,11 @@ std::string PropSetup::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PropSetup::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<PropSetupParamCount; i++)
-   {
-      if (str == PropSetup::PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount, PropSetupParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatBase::GetParameterID(str);
 }
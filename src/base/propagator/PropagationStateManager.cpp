@@ -1299,12 +1299,18 @@ Integer PropagationStateManager::SortVector()
 /**
  * Retrieves data from the objects that are to be propagated, and sets those
  * data in the propagation state vector
+ *
+ * The time update works in the workspaces owned by the state manager, so no
+ * matrices are allocated once they are sized on the first update.
+ *
  * @param indexNum the index of the stateMap where covariance begins
+ * @param oldSTMMat The STM at the previous covariance update
+ * @param propagatedCovarianceWithNoise Set to true if process noise was applied
  *
  * @return true on success, false on failure
  */
  //------------------------------------------------------------------------------
-bool PropagationStateManager::PropagateCovarianceMatrix(Integer indexNum, Rmatrix oldSTMMat, bool &propagatedCovarianceWithNoise)
+bool PropagationStateManager::PropagateCovarianceMatrix(Integer indexNum, const Rmatrix &oldSTMMat, bool &propagatedCovarianceWithNoise)
 {
    bool retval = false;
 
@@ -1312,15 +1318,21 @@ bool PropagationStateManager::PropagateCovarianceMatrix(Integer indexNum, Rmatri
    std::string covarianceObjectName = stateMap[indexNum]->objectName;
 
    // Move STM epoch from t_o to t_n-1, using equation STM(t_n,t_n-1) = STM(t_n, t_0)*STM(t_n-1,t_0)^-1
-   Rmatrix stm = (stateMap[indexNum]->object)->GetRmatrixParameter("FullSTM");
-   stm = stm * oldSTMMat.Inverse();  
-
-
-   Rmatrix cov = (stateMap[indexNum]->object)->GetRmatrixParameter("Covariance");
-   // Ensure that STM is same size as Cov (Revisit when propagating non-Cartesian covariance)
-   stm.ChangeSize(cov.GetNumRows(), cov.GetNumColumns(), false);
+   ComputeRelativeSTM((stateMap[indexNum]->object)->GetRmatrixParameter("FullSTM"),
+         oldSTMMat);
+   const Rmatrix &stm = covSTM;
+
+   const Rmatrix &cov = (stateMap[indexNum]->object)->GetRmatrixParameter("Covariance");
+   // Only the leading block of the STM that matches the covariance is used
+   // (Revisit when propagating non-Cartesian covariance)
+   Integer covSize = cov.GetNumRows();
+   if ((covUpdate.GetNumRows() != covSize) || (covUpdate.GetNumColumns() != covSize))
+   {
+      covUpdate.SetSize(covSize, covSize);
+      covProduct.SetSize(covSize, covSize);
+   }
 
-   Rmatrix newCov;
+   Rmatrix &newCov = covUpdate;
    Real timeSinceLast = GmatMathUtil::Abs(state.GetEpoch() - timeAtLastUpdate);
    Real timeSinceLastGT = GmatMathUtil::Abs((state.GetEpochGT() - timeAtLastUpdateGT).GetTimeInSec());
    // Check if time has passed since the last update
@@ -1352,8 +1364,8 @@ bool PropagationStateManager::PropagateCovarianceMatrix(Integer indexNum, Rmatri
          else  // Basic Propagation, no Noise
          {
             // (Revisit when propagating non-Cartesian covariance)
-            stm.ChangeSize(6, 6, false);
-            newCov = stm * cov*stm.Transpose();
+            MultiplyLeading(stm, cov, covSize, covProduct);
+            MultiplyByTransposeSymmetric(covProduct, stm, covSize, newCov);
          }
          covPropStorageMap[stateMap[indexNum]->objectName + "LastCov"] = cov;
       }
@@ -1472,7 +1484,8 @@ void PropagationStateManager::UpdateProcessNoiseQMAtrix(Integer indexNum, Rmatri
 
 
 //------------------------------------------------------------------------------
-// void UpdateProcessNoiseStandard(Rmatrix &stm,Rmatrix &cov, Integer indexNum, Rmatrix &pBar)
+// void UpdateProcessNoiseStandard(const Rmatrix &stm, const Rmatrix &cov,
+//       Integer indexNum, Rmatrix &pBar)
 //------------------------------------------------------------------------------
 /**
  * Performs the time update of the state error covariance
@@ -1485,28 +1498,35 @@ void PropagationStateManager::UpdateProcessNoiseQMAtrix(Integer indexNum, Rmatri
  * @param &pBar The output covariance (passthrough)
  */
  //------------------------------------------------------------------------------
-void PropagationStateManager::UpdateProcessNoiseStandard(Rmatrix &stm, Rmatrix &cov, Integer indexNum, Rmatrix &pBar)
+void PropagationStateManager::UpdateProcessNoiseStandard(const Rmatrix &stm,
+      const Rmatrix &cov, Integer indexNum, Rmatrix &pBar)
 {
    #ifdef DEBUG_PROPAGATE_SNC
       MessageInterface::ShowMessage("Performing time update\n");
    #endif
-      
-   // Calculate conversion derivative matrix [dX/dS] from Cartesian to Solve-for state
-   // see esm.CartToSolveForStateConversionDerivativeMatrix() for cart2SolvMatrix when going beyond cartesian
-   // With just cartesian, may set to just Identity, but left in to make easier in the future
-   Rmatrix cart2SolvMatrix = Rmatrix::Identity(6); 
-   Rmatrix dX_dS = cart2SolvMatrix; 
-   Rmatrix dS_dX = cart2SolvMatrix.Inverse();
+
+   // The conversion derivative matrix [dX/dS] from Cartesian to Solve-for
+   // state is the identity while only the Cartesian covariance is propagated,
+   // so Q_S = Q and stm_S = stm.  Apply dS/dX to both here when going beyond
+   // cartesian (see esm.CartToSolveForStateConversionDerivativeMatrix()).
+   Integer size = cov.GetNumRows();
    Rmatrix Q(6, 6);
    UpdateProcessNoiseQMAtrix(indexNum, Q);
 
-   Rmatrix Q_S = dS_dX * Q * dS_dX.Transpose();
+   if ((pBar.GetNumRows() != size) || (pBar.GetNumColumns() != size))
+      pBar.SetSize(size, size);
+   if ((covProduct.GetNumRows() != size) || (covProduct.GetNumColumns() != size))
+      covProduct.SetSize(size, size);
 
    // When using Process noise, must covariance and stm from t_n-1 to t_n, rather than t_0 to t_n
-   Rmatrix stm_S = dS_dX * (stm)* dX_dS;
-
+   MultiplyLeading(stm, cov, size, covProduct);
+   MultiplyByTransposeSymmetric(covProduct, stm, size, pBar);
 
-   pBar = stm_S * (cov)* stm_S.Transpose() + Q_S;
+   // Q only covers the leading Cartesian block
+   Integer qSize = (Q.GetNumRows() < size ? Q.GetNumRows() : size);
+   for (Integer i = 0; i < qSize; ++i)
+      for (Integer j = 0; j < qSize; ++j)
+         pBar(i, j) += Q(i, j);
 
    // make it symmetric!
    Symmetrize(pBar);
@@ -1539,7 +1559,8 @@ void PropagationStateManager::UpdateProcessNoiseStandard(Rmatrix &stm, Rmatrix &
 }
 
 //------------------------------------------------------------------------------
-// void UpdateProcessNoiseCholesky(Rmatrix &stm,Rmatrix &cov, Integer indexNum, Rmatrix &pBar)
+// void UpdateProcessNoiseCholesky(const Rmatrix &stm, const Rmatrix &cov,
+//       Integer indexNum, Rmatrix &pBar)
 //------------------------------------------------------------------------------
 /**
  * Performs the update of the state error covariance
@@ -1552,25 +1573,21 @@ void PropagationStateManager::UpdateProcessNoiseStandard(Rmatrix &stm, Rmatrix &
  * @param &pBar The output covariance (passthrough)
  */
  //------------------------------------------------------------------------------
-void PropagationStateManager::UpdateProcessNoiseCholesky(Rmatrix &stm,Rmatrix &cov, Integer indexNum, Rmatrix &pBar)
+void PropagationStateManager::UpdateProcessNoiseCholesky(const Rmatrix &stm,
+      const Rmatrix &cov, Integer indexNum, Rmatrix &pBar)
 {
    #ifdef DEBUG_PROPAGATE_SNC
       MessageInterface::ShowMessage("Performing time update\n");
    #endif
 
+   // The conversion derivative matrix [dX/dS] from Cartesian to Solve-for
+   // state is the identity while only the Cartesian covariance is propagated,
+   // so Q_S = Q and stm_S = stm.  Apply dS/dX to both here when going beyond
+   // cartesian (see esm.CartToSolveForStateConversionDerivativeMatrix()).
+   Integer size = cov.GetNumRows();
+   Rmatrix Q_S(6, 6);
 
-   // Calculate conversion derivative matrix [dX/dS] from Cartesian to Solve-for state
-   // see esm.CartToSolveForStateConversionDerivativeMatrix() for cart2SolvMatrix when going beyond cartesian
-   // With just cartesian, may set to just Identity, but left in to make easier in the future
-   Rmatrix cart2SolvMatrix = Rmatrix::Identity(6); 
-   Rmatrix dX_dS = cart2SolvMatrix; 
-   Rmatrix dS_dX = cart2SolvMatrix.Inverse();
-   Rmatrix Q(6, 6); 
-
-   UpdateProcessNoiseQMAtrix(indexNum,Q);
-
-   Rmatrix Q_S = dS_dX * Q * dS_dX.Transpose();
-   Rmatrix stm_S = dS_dX * (stm)* dX_dS;
+   UpdateProcessNoiseQMAtrix(indexNum, Q_S);
 
 
 #ifdef DEBUG_PROPAGATE_SNC
@@ -1631,21 +1648,26 @@ void PropagationStateManager::UpdateProcessNoiseCholesky(Rmatrix &stm,Rmatrix &c
          auxVector, numRemoved);
    }
    
-   Rmatrix sqrtP = Rmatrix::Identity(6);
+   std::string sqrtPKey = stateMap[indexNum]->objectName + "sqrtP";
 
    // If sqrtP does not exist, create and add it to map 
-   if (covPropStorageMap.find(stateMap[indexNum]->objectName + "sqrtP") == covPropStorageMap.end() || (GmatMathUtil::Abs(state.GetEpoch() - timeAtLastUpdate) < GmatMathUtil::Abs(timeBeforeLastUpdate- timeAtLastUpdate)))
+   if (covPropStorageMap.find(sqrtPKey) == covPropStorageMap.end() || (GmatMathUtil::Abs(state.GetEpoch() - timeAtLastUpdate) < GmatMathUtil::Abs(timeBeforeLastUpdate- timeAtLastUpdate)))
    {
-   cf.Factor(cov, sqrtP);
-      covPropStorageMap[stateMap[indexNum]->objectName + "sqrtP"] = sqrtP.Transpose();
+      if ((covFactor.GetNumRows() != size) || (covFactor.GetNumColumns() != size))
+         covFactor.SetSize(size, size);
+      cf.Factor(cov, covFactor);
+      covPropStorageMap[sqrtPKey] = covFactor.Transpose();
    }
-   sqrtP = covPropStorageMap.at(stateMap[indexNum]->objectName + "sqrtP");
+   // The square root is updated in place in the map
+   Rmatrix &sqrtP = covPropStorageMap[sqrtPKey];
 
-   Rmatrix stmP = stm_S * sqrtP;
+   if ((covProduct.GetNumRows() != size) || (covProduct.GetNumColumns() != size))
+      covProduct.SetSize(size, size);
+   MultiplyLeading(stm, sqrtP, size, covProduct);
+   const Rmatrix &stmP = covProduct;
    Rmatrix sqrtQ = sqrtQ_T.Transpose();
 
-   thinQR(stmP, sqrtQ,sqrtP);
-   covPropStorageMap[ stateMap[indexNum]->objectName + "sqrtP"] = sqrtP ;
+   thinQR(stmP, sqrtQ, sqrtP);
 
 
    // Warn if covariance is not positive definite
@@ -1658,10 +1680,10 @@ void PropagationStateManager::UpdateProcessNoiseCholesky(Rmatrix &stm,Rmatrix &c
       }
    }
 
-   pBar = sqrtP * sqrtP.Transpose();
-
-   // make it symmetric!
-   Symmetrize(pBar);
+   // pBar = sqrtP * sqrtP^T, built symmetric
+   if ((pBar.GetNumRows() != size) || (pBar.GetNumColumns() != size))
+      pBar.SetSize(size, size);
+   MultiplyByTransposeSymmetric(sqrtP, sqrtP, size, pBar);
 #ifdef DEBUG_PROPAGATE_SNC
    MessageInterface::ShowMessage("stm = \n");
    for (UnsignedInt i = 0; i < 6; ++i)
@@ -1678,30 +1700,6 @@ void PropagationStateManager::UpdateProcessNoiseCholesky(Rmatrix &stm,Rmatrix &c
          MessageInterface::ShowMessage("   %.12le", pBar(i, j));
       MessageInterface::ShowMessage("\n");
    }
-      MessageInterface::ShowMessage("Q = \n");
-      for (UnsignedInt i = 0; i < 6; ++i)
-      {
-         for (UnsignedInt j = 0; j < 6; ++j)
-            MessageInterface::ShowMessage("   %.12le", Q(i, j));
-         MessageInterface::ShowMessage("\n");
-      }
-      MessageInterface::ShowMessage("\n");
-      MessageInterface::ShowMessage("dS_dX = \n");
-      for (UnsignedInt i = 0; i < 6; ++i)
-      {
-         for (UnsignedInt j = 0; j < 6; ++j)
-            MessageInterface::ShowMessage("   %.12le", dS_dX(i, j));
-         MessageInterface::ShowMessage("\n");
-      }
-      MessageInterface::ShowMessage("\n");
-      MessageInterface::ShowMessage("dX_dS = \n");
-      for (UnsignedInt i = 0; i < 6; ++i)
-      {
-         for (UnsignedInt j = 0; j < 6; ++j)
-            MessageInterface::ShowMessage("   %.12le", dX_dS(i, j));
-         MessageInterface::ShowMessage("\n");
-      }
-      MessageInterface::ShowMessage("\n");
       MessageInterface::ShowMessage("stm = \n");
       for (UnsignedInt i = 0; i < 6; ++i)
       {
@@ -1800,28 +1798,195 @@ void PropagationStateManager::Symmetrize(Rmatrix& mat)
 void PropagationStateManager::thinQR(const Rmatrix &mat1, const Rmatrix &mat2, Rmatrix &QR)
 {
    QRFactorization qr(false);
-   Rmatrix mat(mat1.GetNumRows(), mat1.GetNumColumns() + mat2.GetNumColumns());
+   Integer rows = mat1.GetNumRows();
+   Integer cols = mat1.GetNumColumns() + mat2.GetNumColumns();
+
+   if ((qrCompound.GetNumRows() != cols) || (qrCompound.GetNumColumns() != rows))
+   {
+      qrCompound.SetSize(cols, rows);
+      qrQ.SetSize(cols, rows);
+      qrR.SetSize(cols, rows);
+   }
+
+   // Build the transpose of [mat1 mat2] directly
+   for (Integer ii = 0; ii < rows; ii++)
+   {
+      for (Integer jj = 0; jj < mat1.GetNumColumns(); jj++)
+         qrCompound(jj, ii) = mat1(ii, jj);
+
+      for (Integer jj = 0; jj < mat2.GetNumColumns(); jj++)
+         qrCompound(jj + mat1.GetNumColumns(), ii) = mat2(ii, jj);
+   }
+
+   qr.Factor(qrCompound, qrR, qrQ);
+
+   // QR is only written from here on, so it may be the matrix that mat1 was
+   // built from
+   if ((QR.GetNumRows() != rows) || (QR.GetNumColumns() != rows))
+      QR.SetSize(rows, rows);
+
+   for (Integer ii = 0; ii < rows; ii++)
+      for (Integer jj = 0; jj < rows; jj++)
+         QR(ii, jj) = (jj <= ii ? qrR(jj, ii) : 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// void ComputeRelativeSTM(const Rmatrix &stmNow, const Rmatrix &stmOld)
+//------------------------------------------------------------------------------
+/**
+ * Builds the STM from the previous covariance update to the current epoch
+ *
+ * The STM Phi(t_n, t_n-1) = Phi(t_n, t_0) Phi(t_n-1, t_0)^-1 is found without
+ * forming the inverse: each row x of the result solves Phi(t_n-1, t_0)^T x^T =
+ * (row of Phi(t_n, t_0))^T, using an LU factorization with partial pivoting.
+ * The result is written to covSTM.
+ *
+ * @param stmNow The STM from the initial epoch to the current epoch
+ * @param stmOld The STM from the initial epoch to the previous update
+ */
+//------------------------------------------------------------------------------
+void PropagationStateManager::ComputeRelativeSTM(const Rmatrix &stmNow,
+      const Rmatrix &stmOld)
+{
+   Integer n = stmOld.GetNumRows();
+
+   if ((stmOld.GetNumColumns() != n) || (stmNow.GetNumRows() != n) ||
+       (stmNow.GetNumColumns() != n))
+      throw PropagatorException("The state transition matrices used for "
+            "covariance propagation must be square and of the same size");
+
+   if (covLU.GetNumRows() != n)
+   {
+      covLU.SetSize(n, n);
+      covSTM.SetSize(n, n);
+      covPivots.resize(n);
+   }
+
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         covLU(i, j) = stmOld(j, i);
+
+   // Factor in place: L below the diagonal (unit diagonal), U on and above it
+   for (Integer k = 0; k < n; ++k)
+   {
+      Integer pivot = k;
+      Real maxElement = GmatMathUtil::Abs(covLU(k, k));
+      for (Integer i = k + 1; i < n; ++i)
+      {
+         if (GmatMathUtil::Abs(covLU(i, k)) > maxElement)
+         {
+            maxElement = GmatMathUtil::Abs(covLU(i, k));
+            pivot = i;
+         }
+      }
+      if (maxElement == 0.0)
+         throw PropagatorException("The state transition matrix at the "
+               "previous covariance update is singular");
+
+      covPivots[k] = pivot;
+      if (pivot != k)
+         for (Integer j = 0; j < n; ++j)
+            std::swap(covLU(k, j), covLU(pivot, j));
 
-   for (UnsignedInt ii = 0U; ii < mat.GetNumRows(); ii++)
+      for (Integer i = k + 1; i < n; ++i)
+      {
+         covLU(i, k) /= covLU(k, k);
+         Real factor = covLU(i, k);
+         if (factor != 0.0)
+            for (Integer j = k + 1; j < n; ++j)
+               covLU(i, j) -= factor * covLU(k, j);
+      }
+   }
+
+   for (Integer r = 0; r < n; ++r)
    {
-      for (UnsignedInt jj = 0U; jj < mat1.GetNumColumns(); jj++)
-         mat(ii, jj) = mat1(ii, jj);
+      for (Integer j = 0; j < n; ++j)
+         covSTM(r, j) = stmNow(r, j);
 
-      for (UnsignedInt jj = 0U; jj < mat2.GetNumColumns(); jj++)
-         mat(ii, jj + mat1.GetNumColumns()) = mat2(ii, jj);
+      for (Integer k = 0; k < n; ++k)
+         if (covPivots[k] != k)
+            std::swap(covSTM(r, k), covSTM(r, covPivots[k]));
+
+      for (Integer i = 1; i < n; ++i)
+      {
+         Real sum = covSTM(r, i);
+         for (Integer j = 0; j < i; ++j)
+            sum -= covLU(i, j) * covSTM(r, j);
+         covSTM(r, i) = sum;
+      }
+
+      for (Integer i = n - 1; i >= 0; --i)
+      {
+         Real sum = covSTM(r, i);
+         for (Integer j = i + 1; j < n; ++j)
+            sum -= covLU(i, j) * covSTM(r, j);
+         covSTM(r, i) = sum / covLU(i, i);
+      }
    }
+}
 
-   Rmatrix Q(mat.GetNumColumns(), mat.GetNumRows());
-   Rmatrix R(mat.GetNumColumns(), mat.GetNumRows());
-   qr.Factor(mat.Transpose(), R, Q);
 
-   Rmatrix N(mat.GetNumRows(), mat.GetNumRows());
+//------------------------------------------------------------------------------
+// void MultiplyLeading(const Rmatrix &a, const Rmatrix &b, Integer size,
+//       Rmatrix &result)
+//------------------------------------------------------------------------------
+/**
+ * Multiplies the leading size x size blocks of two matrices
+ *
+ * @param a The left matrix
+ * @param b The right matrix
+ * @param size The size of the blocks that are multiplied
+ * @param result The product; it must be sized, and cannot be a or b
+ */
+//------------------------------------------------------------------------------
+void PropagationStateManager::MultiplyLeading(const Rmatrix &a,
+      const Rmatrix &b, Integer size, Rmatrix &result)
+{
+   for (Integer i = 0; i < size; ++i)
+   {
+      for (Integer j = 0; j < size; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k < size; ++k)
+            sum += a(i, k) * b(k, j);
+         result(i, j) = sum;
+      }
+   }
+}
 
-   for (UnsignedInt ii = 0U; ii < mat.GetNumRows(); ii++)
-      for (UnsignedInt jj = 0U; jj <= ii; jj++)
-         N(ii, jj) = R(jj, ii);
 
-   QR = N;
+//------------------------------------------------------------------------------
+// void MultiplyByTransposeSymmetric(const Rmatrix &a, const Rmatrix &b,
+//       Integer size, Rmatrix &result)
+//------------------------------------------------------------------------------
+/**
+ * Builds a * b^T for products known to be symmetric
+ *
+ * This is used for Phi (P Phi^T) and S S^T: only the upper triangle is
+ * computed, and it is mirrored into the lower triangle, so the result is
+ * exactly symmetric.
+ *
+ * @param a The left matrix
+ * @param b The matrix whose transpose is on the right
+ * @param size The size of the leading blocks that are used
+ * @param result The product; it must be sized, and cannot be a or b
+ */
+//------------------------------------------------------------------------------
+void PropagationStateManager::MultiplyByTransposeSymmetric(const Rmatrix &a,
+      const Rmatrix &b, Integer size, Rmatrix &result)
+{
+   for (Integer i = 0; i < size; ++i)
+   {
+      for (Integer j = i; j < size; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k < size; ++k)
+            sum += a(i, k) * b(j, k);
+         result(i, j) = sum;
+         result(j, i) = sum;
+      }
+   }
 }
 //------------------------------------------------------------------------------
 // bool SatHasCovariance()
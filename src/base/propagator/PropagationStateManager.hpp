@@ -64,9 +64,9 @@ public:
    virtual Integer GetCompletionSize(const Integer which);
    virtual Integer GetSTMIndex(Integer forParameterID, GmatBase* scObj);
 
-   bool PropagateCovarianceMatrix(Integer indexNum, Rmatrix oldSTMMat, bool &propagatedCovarianceWithNoise);
-   void UpdateProcessNoiseCholesky(Rmatrix &stm, Rmatrix &cov, Integer indexNum, Rmatrix &pBar);
-   void UpdateProcessNoiseStandard(Rmatrix &stm, Rmatrix &cov, Integer indexNum, Rmatrix &pBar);
+   bool PropagateCovarianceMatrix(Integer indexNum, const Rmatrix &oldSTMMat, bool &propagatedCovarianceWithNoise);
+   void UpdateProcessNoiseCholesky(const Rmatrix &stm, const Rmatrix &cov, Integer indexNum, Rmatrix &pBar);
+   void UpdateProcessNoiseStandard(const Rmatrix &stm, const Rmatrix &cov, Integer indexNum, Rmatrix &pBar);
    void UpdateProcessNoiseQMAtrix(Integer indexNum, Rmatrix &Q); // Updates SNC matrix
    void thinQR(const Rmatrix &mat1, const Rmatrix &mat2, Rmatrix &QR);
    void Symmetrize(Rmatrix& mat);
@@ -93,6 +93,33 @@ protected:
    GmatTime timeAtLastUpdateGT;
    std::map<std::string, Rmatrix> covPropStorageMap;
 
+   // Workspaces for the covariance time update, sized on first use
+   /// STM from the previous covariance update to the current epoch
+   Rmatrix        covSTM;
+   /// LU factors of the transpose of the STM at the previous update
+   Rmatrix        covLU;
+   /// Row pivots of the LU factorization
+   IntegerArray   covPivots;
+   /// Product of the STM and the covariance (or its square root)
+   Rmatrix        covProduct;
+   /// The time updated covariance
+   Rmatrix        covUpdate;
+   /// Cholesky factor of the covariance when the square root is restarted
+   Rmatrix        covFactor;
+   /// Transposed compound matrix used in the thin QR decomposition
+   Rmatrix        qrCompound;
+   /// Q and R factors from the thin QR decomposition
+   Rmatrix        qrQ;
+   Rmatrix        qrR;
+
+   void           ComputeRelativeSTM(const Rmatrix &stmNow,
+                                     const Rmatrix &stmOld);
+   void           MultiplyLeading(const Rmatrix &a, const Rmatrix &b,
+                                  Integer size, Rmatrix &result);
+   void           MultiplyByTransposeSymmetric(const Rmatrix &a,
+                                  const Rmatrix &b, Integer size,
+                                  Rmatrix &result);
+
 private:
    Integer cartesianStateID;
 };
@@ -311,10 +311,12 @@ std::string Propagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Propagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < PropagatorParamCount; ++i)
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-        
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               PropagatorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return GmatBase::GetParameterID(str);
 }
 
@@ -1397,6 +1399,45 @@ bool Propagator::UsesErrorControl()
 }
 
 
+//------------------------------------------------------------------------------
+// bool HasDenseOutput(Real stepSpan)
+//------------------------------------------------------------------------------
+/**
+ * Checks if the propagator can interpolate the states across its last step.
+ *
+ * Propagators that provide dense output override this method.  The default
+ * implementation reports that no interpolant is available.
+ *
+ * @param stepSpan The span of the step the caller wants to interpolate across
+ *
+ * @return true if GetDenseState() can be called for that step
+ */
+//------------------------------------------------------------------------------
+bool Propagator::HasDenseOutput(Real stepSpan)
+{
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetDenseState(Real dt, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the state across the last step taken.
+ *
+ * @param dt    The time from the start of the last step, in seconds
+ * @param state The array that receives the interpolated state
+ *
+ * @return true if the state was filled in; the default implementation returns
+ *         false
+ */
+//------------------------------------------------------------------------------
+bool Propagator::GetDenseState(Real dt, Real *state)
+{
+   return false;
+}
+
+
 //------------------------------------------------------------------------------
 // void SetStepSize()
 //------------------------------------------------------------------------------
@@ -181,6 +181,8 @@ public:
    virtual void TurnDebug(bool debugFlag);
 
    virtual bool UsesErrorControl();
+   virtual bool HasDenseOutput(Real stepSpan);
+   virtual bool GetDenseState(Real dt, Real *state);
    bool FindTimeStep();
    bool SetNoiseStep();
 
@@ -97,7 +97,15 @@ RungeKutta::RungeKutta(Integer st, Integer order, const std::string &typeStr,
     incPower        (1.0/order),
     decPower        (1.0/(order-1)),
     stageState      (NULL),
-    candidateState  (NULL)
+    candidateState  (NULL),
+    denseStartState (NULL),
+    denseEndState   (NULL),
+    denseStartSlope (NULL),
+    denseEndSlope   (NULL),
+    denseStartTime  (0.0),
+    denseStep       (0.0),
+    denseValid      (false),
+    denseEndSlopeValid (false)
 {
 }
 
@@ -132,7 +140,15 @@ RungeKutta::RungeKutta(const RungeKutta& rk) :
     incPower        (rk.incPower),
     decPower        (rk.decPower),
     stageState      (NULL),
-    candidateState  (NULL)
+    candidateState  (NULL),
+    denseStartState (NULL),
+    denseEndState   (NULL),
+    denseStartSlope (NULL),
+    denseEndSlope   (NULL),
+    denseStartTime  (0.0),
+    denseStep       (0.0),
+    denseValid      (false),
+    denseEndSlopeValid (false)
 {
 }
 
@@ -163,6 +179,7 @@ RungeKutta& RungeKutta::operator=(const RungeKutta& rk)
     ee = NULL;
     stageState = NULL;
     candidateState = NULL;
+    denseValid = false;
 
     isInitialized = false;
 
@@ -404,6 +421,12 @@ bool RungeKutta::Step()
     bool goodStepTaken = false;
     Real maxerror;
 
+    // Save the start state for the dense output (inState is overwritten when
+    // the step is accepted)
+    denseValid = false;
+    if (denseStartState != NULL)
+       memcpy(denseStartState, inState, dimension*sizeof(Real));
+
     do
     {
         if (!RawStep())
@@ -441,6 +464,18 @@ bool RungeKutta::Step()
 
     physicalModel->IncrementTime(stepTaken);
 
+    // Keep the data for interpolation across this step.  Steps split by the
+    // force model span more than one set of stages, so they are not used.
+    if (!stepLimited && !followUpStep && (denseStartState != NULL))
+    {
+       memcpy(denseEndState, outState, dimension*sizeof(Real));
+       memcpy(denseStartSlope, ki[0], dimension*sizeof(Real));
+       denseStartTime = originalTime;
+       denseStep = stepTaken;
+       denseEndSlopeValid = false;
+       denseValid = true;
+    }
+
     if (stepLimited)
     {
        if (maxerror == 0.0)
@@ -651,6 +686,95 @@ bool RungeKutta::Step(Real dt)
    return true;
 }
 
+
+//------------------------------------------------------------------------------
+// bool HasDenseOutput(Real stepSpan)
+//------------------------------------------------------------------------------
+/**
+ * Checks if the last accepted step can be interpolated.
+ *
+ * The interpolant is only offered when the last step has the requested span
+ * and the propagation state has been moved back to the start of that step, as
+ * the Propagate command does before it searches for a stopping condition.
+ *
+ * @param stepSpan The span of the step the caller wants to interpolate across
+ *
+ * @return true if GetDenseState() can be used for the step
+ */
+//------------------------------------------------------------------------------
+bool RungeKutta::HasDenseOutput(Real stepSpan)
+{
+   if (!isInitialized || !denseValid || (inState == NULL))
+      return false;
+
+   if (fabs(stepSpan - denseStep) > smallestTime)
+      return false;
+
+   if (fabs(physicalModel->GetTime() - denseStartTime) > smallestTime)
+      return false;
+
+   // The state is rebuilt from the spacecraft when it is moved back, so
+   // allow for round off from the translation to the propagation origin
+   for (Integer j = 0; j < dimension; ++j)
+      if (fabs(inState[j] - denseStartState[j]) >
+          1.0e-12 * (fabs(denseStartState[j]) + 1.0))
+         return false;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetDenseState(Real dt, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the state across the last accepted step.
+ *
+ * The interpolant is the cubic Hermite polynomial matching the states and
+ * derivatives at the ends of the step.  The derivative at the start is the
+ * first stage of the step; the one at the end takes a single derivative
+ * evaluation, made the first time it is needed.  That replaces the full
+ * integration steps otherwise needed to sample the step.
+ *
+ * @param dt    The time from the start of the last step, in seconds
+ * @param state The array that receives the interpolated state
+ *
+ * @return true if the state was filled in
+ */
+//------------------------------------------------------------------------------
+bool RungeKutta::GetDenseState(Real dt, Real *state)
+{
+   if (!denseValid || (denseStep == 0.0))
+      return false;
+
+   if (!denseEndSlopeValid)
+   {
+      // ddt is evaluated at the model's elapsed time plus the offset passed in
+      Real offset = denseStartTime + denseStep - physicalModel->GetTime();
+      physicalModel->SetDirection(denseStep > 0.0 ? 1.0 : -1.0);
+      if (!physicalModel->GetDerivatives(denseEndState, offset))
+         return false;
+      for (Integer j = 0; j < dimension; ++j)
+         denseEndSlope[j] = denseStep * ddt[j];
+      denseEndSlopeValid = true;
+   }
+
+   Real theta  = dt / denseStep;
+   Real theta2 = theta * theta;
+   Real theta3 = theta2 * theta;
+
+   Real h00 = 2.0 * theta3 - 3.0 * theta2 + 1.0;
+   Real h10 = theta3 - 2.0 * theta2 + theta;
+   Real h01 = -2.0 * theta3 + 3.0 * theta2;
+   Real h11 = theta3 - theta2;
+
+   for (Integer j = 0; j < dimension; ++j)
+      state[j] = h00 * denseStartState[j] + h10 * denseStartSlope[j] +
+                 h01 * denseEndState[j]   + h11 * denseEndSlope[j];
+
+   return true;
+}
+
 //---------------------------------
 // protected
 //---------------------------------
@@ -815,6 +939,17 @@ void RungeKutta::ClearArrays()
         delete [] candidateState;
     }
 
+    if (denseStartState != NULL)
+        delete [] denseStartState;
+    if (denseEndState != NULL)
+        delete [] denseEndState;
+    if (denseStartSlope != NULL)
+        delete [] denseStartSlope;
+    if (denseEndSlope != NULL)
+        delete [] denseEndSlope;
+    denseStartState = denseEndState = denseStartSlope = denseEndSlope = NULL;
+    denseValid = false;
+
     ki = bij = NULL;
     ai = cj = ee = stageState = candidateState = NULL;
     //    ai = cj = ee = stageState = candidateState = errorEstimates = NULL;
@@ -856,6 +991,21 @@ bool RungeKutta::SetupAccumulator()
 
         ddt = physicalModel->GetDerivativeArray();
 
+        // Buffers for the dense output
+        if (denseStartState)
+            delete [] denseStartState;
+        if (denseEndState)
+            delete [] denseEndState;
+        if (denseStartSlope)
+            delete [] denseStartSlope;
+        if (denseEndSlope)
+            delete [] denseEndSlope;
+        denseStartState = new Real[dimension];
+        denseEndState   = new Real[dimension];
+        denseStartSlope = new Real[dimension];
+        denseEndSlope   = new Real[dimension];
+        denseValid = false;
+
         if (errorEstimates)
             delete [] errorEstimates;
 
@@ -163,6 +163,9 @@ public:
     virtual bool Step(Real dt);
     virtual bool RawStep();
 
+    virtual bool HasDenseOutput(Real stepSpan);
+    virtual bool GetDenseState(Real dt, Real *state);
+
 protected:
     /// The number of stages used to take an integration step
     Integer stages;
@@ -188,6 +191,23 @@ protected:
     /// Candidate state for the step (used if the error is acceptable)
     Real * candidateState;
 
+    /// State at the start of the last accepted step
+    Real * denseStartState;
+    /// State at the end of the last accepted step
+    Real * denseEndState;
+    /// First stage (step times derivative) at the start of the last step
+    Real * denseStartSlope;
+    /// Step times derivative at the end of the last step, built on demand
+    Real * denseEndSlope;
+    /// Elapsed time at the start of the last accepted step
+    Real denseStartTime;
+    /// Size of the last accepted step
+    Real denseStep;
+    /// Flag indicating that the dense output data describe the last step
+    bool denseValid;
+    /// Flag indicating that denseEndSlope has been evaluated
+    bool denseEndSlopeValid;
+
 
     bool SetupAccumulator();
     void ClearArrays();
@@ -127,7 +127,8 @@ AtmosphereModel::AtmosphereModel(const std::string &typeStr, const std::string &
    sod                  (0.0),
    yd                   (0),
    f107                 (0.0),
-   f107a                (0.0)
+   f107a                (0.0),
+   inputsEpoch          (-1.0)
 {
    objectTypes.push_back(Gmat::ATMOSPHERE);
    objectTypeNames.push_back("AtmosphereModel");
@@ -217,7 +218,8 @@ AtmosphereModel::AtmosphereModel(const AtmosphereModel& am) :
    sod                  (am.sod),
    yd                   (am.yd),
    f107                 (am.f107),
-   f107a                (am.f107a)
+   f107a                (am.f107a),
+   inputsEpoch          (-1.0)
 {
    parameterCount = AtmosphereModelParamCount;
    nominalAp = ConvertKpToAp(nominalKp);
@@ -287,6 +289,7 @@ AtmosphereModel& AtmosphereModel::operator=(const AtmosphereModel& am)
 
    for (Integer i = 0; i < 7; i++)
       ap[i] = am.ap[i];
+   inputsEpoch          = -1.0;
 
    isInitialized = false;
 
@@ -765,6 +768,8 @@ Real AtmosphereModel::ConvertKpToAp(const Real kp)
 void AtmosphereModel::SetInputSource(const std::string &historical,
                                      const std::string &predicted)
 {
+   inputsEpoch = -1.0;
+
    if (historical == "ConstantFluxAndGeoMag")
       historicalDataSource = 0;
    else if (historical == "CSSISpaceWeatherFile")
@@ -802,6 +807,8 @@ void AtmosphereModel::SetSchattenFlags(const std::string &timing,
             "(%s, %s)\n", timing.c_str(), magnitude.c_str());
    #endif
 
+   inputsEpoch = -1.0;
+
    if (timing == "EarlyCycle")
       schattenTimingModel = -1;
    if (timing == "NominalCycle")
@@ -821,6 +828,24 @@ void AtmosphereModel::SetSchattenFlags(const std::string &timing,
 }
 
 
+//-----------------------------------------------------------------------------
+// bool AtmosphereModel::HasEpochDependentDensity()
+//-----------------------------------------------------------------------------
+/**
+ * Checks to see if the density at a fixed position changes with epoch.
+ *
+ * Models driven by the Sun position or by space weather data depend on the
+ * epoch; models that only use the altitude override this method.
+ *
+ * @return true if the density depends on the epoch, false if not
+ */
+//-----------------------------------------------------------------------------
+bool AtmosphereModel::HasEpochDependentDensity()
+{
+   return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // bool AtmosphereModel::HasWindModel()
 //-----------------------------------------------------------------------------
@@ -1065,9 +1090,12 @@ std::string AtmosphereModel::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer AtmosphereModel::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < AtmosphereModelParamCount; ++i)
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               AtmosphereModelParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return GmatBase::GetParameterID(str);
 }
 
@@ -1149,6 +1177,8 @@ Real AtmosphereModel::GetRealParameter(const Integer id) const
 //------------------------------------------------------------------------------
 Real AtmosphereModel::SetRealParameter(const Integer id, const Real value)
 {
+   inputsEpoch = -1.0;
+
    if (id == NOMINAL_FLUX)
    {
       if (value > 0.0)
@@ -1234,6 +1264,8 @@ Real AtmosphereModel::SetRealParameter(const Integer id,
 bool AtmosphereModel::SetStringParameter(const Integer id,
       const std::string &value)
 {
+   inputsEpoch = -1.0;
+
    if (id == CSSI_WEATHER_FILE)
    {
       if (value != "")
@@ -1672,6 +1704,9 @@ Real AtmosphereModel::CalculateGeocentrics(Real *position, GmatEpoch when,
  *  Sets the input global data for the model, either from a file or from user
  *  input constants.
  *
+ *  The inputs are kept until the epoch changes, so the spacecraft and the
+ *  force evaluations at one epoch read the flux data once.
+ *
  *  @param epoch The current TAIJulian epoch
  */
 //------------------------------------------------------------------------------
@@ -1682,6 +1717,9 @@ void AtmosphereModel::GetInputs(GmatEpoch epoch)
             (fluxReaderLoaded ? "true" : "false"));
    #endif
 
+   if (fluxReaderLoaded && (epoch == inputsEpoch))
+      return;
+
    // Process the epoch information
    Integer iEpoch = (Integer)(epoch);  // Truncate the epoch
    Integer yearOffset = (Integer)((epoch + 5.5) / GmatTimeConstants::DAYS_PER_YEAR);
@@ -1824,6 +1862,7 @@ void AtmosphereModel::GetInputs(GmatEpoch epoch)
       for (Integer i = 0; i < 7; i++)
          ap[i] = nominalAp;
    }
+   inputsEpoch = epoch;
 
    #ifdef DUMP_FLUX_DATA
       MessageInterface::ShowMessage("%.12lf   %lf  %lf    [%lf %lf %lf %lf %lf "
@@ -105,6 +105,7 @@ public:
                                const std::string &magnitude);
 
    // Extra methods some models may support
+   virtual bool HasEpochDependentDensity();
    virtual bool HasWindModel();
    virtual bool Wind(Real *position, Real* wind, Real ep,
 						   Integer count = 1);
@@ -243,6 +244,8 @@ protected:
    Real                    f107a;
    /// Geomagnetic index (Ap, not Kp)
    Real                    ap[7];
+   /// Epoch of the flux inputs held above, or -1.0 when they must be read
+   GmatEpoch               inputsEpoch;
 
    /// Time converter singleton
    TimeSystemConverter     *theTimeConverter;
@@ -173,11 +173,15 @@ void Barycenter::Copy(const GmatBase* orig)
 //---------------------------------------------------------------------------
 const Rvector6 Barycenter::GetMJ2000State(const A1Mjd &atTime)
 {
+   // the forces, axes and parameters of a step all ask for the same epoch
+   if (FindMemoState(atTime))
+      return lastState;
+
    // if it's built-in, get the state from the SpacePoint
    if (isBuiltIn)
    {
-      lastStateTime = atTime;
       lastState     = builtInSP->GetMJ2000State(atTime);
+      MemoizeState(atTime);
       #ifdef DEBUG_BARYCENTER_STATE
          MessageInterface::ShowMessage("Computing state for Barycenter %s, whose builtInSP is %s\n",
                instanceName.c_str(), (builtInSP->GetName()).c_str());
@@ -222,20 +226,21 @@ const Rvector6 Barycenter::GetMJ2000State(const A1Mjd &atTime)
    #endif
    lastState.Set(sumMassPos(0), sumMassPos(1), sumMassPos(2),
          sumMassVel(0), sumMassVel(1), sumMassVel(2));
-   lastStateTime = atTime;
+   MemoizeState(atTime);
    return lastState;
 }
 
 
 const Rvector6 Barycenter::GetMJ2000State(const GmatTime &atTime)
 {
+   if (FindMemoState(atTime))
+      return lastState;
+
    // if it's built-in, get the state from the SpacePoint
    if (isBuiltIn)
    {
-      lastStateTimeGT = atTime;
-      lastStateTime   = GmatTime(atTime).GetMjd();
-
       lastState = builtInSP->GetMJ2000State(atTime);
+      MemoizeState(atTime);
 #ifdef DEBUG_BARYCENTER_STATE
       MessageInterface::ShowMessage("Computing state for Barycenter %s, whose builtInSP is %s\n",
          instanceName.c_str(), (builtInSP->GetName()).c_str());
@@ -280,9 +285,7 @@ const Rvector6 Barycenter::GetMJ2000State(const GmatTime &atTime)
 #endif
    lastState.Set(sumMassPos(0), sumMassPos(1), sumMassPos(2),
       sumMassVel(0), sumMassVel(1), sumMassVel(2));
-   
-   lastStateTimeGT = atTime;
-   lastStateTime   = GmatTime(atTime).GetMjd();
+   MemoizeState(atTime);
 
    return lastState;
 }
@@ -414,6 +417,7 @@ bool Barycenter::Initialize()
       for (unsigned int ii = 0; ii < defaultBodies.size(); ii++)
          MessageInterface::ShowMessage("   %d    %s\n", ii, (defaultBodies.at(ii)).c_str());
    #endif
+   ClearStateMemo();
    if (isBuiltIn)
    {
       // create the builtInSP here
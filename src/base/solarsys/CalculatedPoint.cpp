@@ -84,7 +84,9 @@ CalculatedPoint::CalculatedPoint(const std::string &ptType,
    isBuiltIn      (false),
    builtInType    (""),
    lastStateTime  (GmatTimeConstants::MJD_OF_J2000),
-   lastStateTimeGT(GmatTime(GmatTimeConstants::MJD_OF_J2000))
+   lastStateTimeGT(GmatTime(GmatTimeConstants::MJD_OF_J2000)),
+   stateMemoValid (false),
+   stateMemoIsGT  (false)
 {
    objectTypes.push_back(Gmat::CALCULATED_POINT);
    objectTypeNames.push_back("CalculatedPoint");
@@ -116,7 +118,9 @@ CalculatedPoint::CalculatedPoint(const CalculatedPoint &cp) :
    builtInType   (cp.builtInType),
    lastStateTime (cp.lastStateTime),
    lastStateTimeGT (cp.lastStateTimeGT),
-   lastState     (cp.lastState)
+   lastState     (cp.lastState),
+   stateMemoValid(false),
+   stateMemoIsGT (false)
 {
    bodyNames.clear();
    bodyList.clear();
@@ -183,6 +187,8 @@ CalculatedPoint& CalculatedPoint::operator=(const CalculatedPoint &cp)
    lastStateTime   = cp.lastStateTime;
    lastStateTimeGT = cp.lastStateTimeGT;
    lastState       = cp.lastState;
+   // The bodies of the copy may be different objects, so start a new memo
+   ClearStateMemo();
 
    return *this;
 }
@@ -229,6 +235,7 @@ void CalculatedPoint::SetIsBuiltIn(bool builtIn, const std::string &ofType)
 {
    isBuiltIn   = builtIn;
    builtInType = ofType;
+   ClearStateMemo();
    // Don't cloak the user-defined calculated points!
    if (isBuiltIn) cloaking  =  true;
    else           cloaking  =  false;
@@ -287,6 +294,116 @@ Rvector6 CalculatedPoint::GetLastState()
 }
 
 
+//------------------------------------------------------------------------------
+// void GetMJ2000States(const RealArray &epochs, std::vector<Rvector6> &states)
+//------------------------------------------------------------------------------
+/**
+ * Computes the MJ2000Eq states of the point at a set of A.1 epochs.
+ *
+ * Design loops (for example a halo orbit correction sweeping a set of node
+ * epochs) evaluate the point at many epochs, often repeating an epoch from one
+ * pass to the next.  Consecutive repeats are served from the state memo, and
+ * the constituent bodies serve repeats from their ephemeris memos.
+ *
+ * @param <epochs> The A.1 modified Julian epochs.
+ * @param <states> The states at the epochs, in the order of the epochs.
+ */
+//------------------------------------------------------------------------------
+void CalculatedPoint::GetMJ2000States(const RealArray &epochs,
+                                      std::vector<Rvector6> &states)
+{
+   states.resize(epochs.size());
+   for (UnsignedInt i = 0; i < epochs.size(); ++i)
+      states[i] = GetMJ2000State(A1Mjd(epochs[i]));
+}
+
+
+//------------------------------------------------------------------------------
+// bool FindMemoState(const A1Mjd &atTime) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if lastState is the state at an A.1 epoch.
+ *
+ * @param <atTime> The requested epoch.
+ *
+ * @return true if lastState can be returned for the epoch, false if not.
+ */
+//------------------------------------------------------------------------------
+bool CalculatedPoint::FindMemoState(const A1Mjd &atTime) const
+{
+   return (stateMemoValid && !stateMemoIsGT &&
+           (lastStateTime.Get() == atTime.Get()));
+}
+
+
+//------------------------------------------------------------------------------
+// bool FindMemoState(const GmatTime &atTime) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if lastState is the state at a GmatTime epoch.
+ *
+ * States at A.1 modified Julian and at GmatTime epochs are kept apart because
+ * the ephemerides compute them at different precision.
+ *
+ * @param <atTime> The requested epoch.
+ *
+ * @return true if lastState can be returned for the epoch, false if not.
+ */
+//------------------------------------------------------------------------------
+bool CalculatedPoint::FindMemoState(const GmatTime &atTime) const
+{
+   return (stateMemoValid && stateMemoIsGT && (lastStateTimeGT == atTime));
+}
+
+
+//------------------------------------------------------------------------------
+// void MemoizeState(const A1Mjd &atTime)
+//------------------------------------------------------------------------------
+/**
+ * Records that lastState is the state at an A.1 epoch.
+ *
+ * @param <atTime> The epoch of lastState.
+ */
+//------------------------------------------------------------------------------
+void CalculatedPoint::MemoizeState(const A1Mjd &atTime)
+{
+   lastStateTime  = atTime;
+   stateMemoValid = true;
+   stateMemoIsGT  = false;
+}
+
+
+//------------------------------------------------------------------------------
+// void MemoizeState(const GmatTime &atTime)
+//------------------------------------------------------------------------------
+/**
+ * Records that lastState is the state at a GmatTime epoch.
+ *
+ * @param <atTime> The epoch of lastState.
+ */
+//------------------------------------------------------------------------------
+void CalculatedPoint::MemoizeState(const GmatTime &atTime)
+{
+   lastStateTimeGT = atTime;
+   lastStateTime   = GmatTime(atTime).GetMjd();
+   stateMemoValid  = true;
+   stateMemoIsGT   = true;
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearStateMemo()
+//------------------------------------------------------------------------------
+/**
+ * Discards the remembered state, so the next request computes it again.
+ */
+//------------------------------------------------------------------------------
+void CalculatedPoint::ClearStateMemo()
+{
+   stateMemoValid = false;
+}
+
+
 //------------------------------------------------------------------------------
 //  std::string  GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
@@ -320,11 +437,12 @@ std::string CalculatedPoint::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer CalculatedPoint::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SpacePointParamCount; i < CalculatedPointParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpacePointParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SpacePointParamCount,
+               CalculatedPointParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    // Special handler for "Add" - per Steve 2005.05.18
    if (str == "Add") return BODY_NAMES;
@@ -638,6 +756,7 @@ bool CalculatedPoint::SetStringParameter(const Integer id,
    #endif
    if (id == BODY_NAMES)
    {
+      ClearStateMemo();
       if (isBuiltIn)
       {
          std::string errmsg = "The value of \"";
@@ -726,6 +845,7 @@ bool  CalculatedPoint::SetStringParameter(const Integer id,
    #endif
    if (id == BODY_NAMES)
    {
+      ClearStateMemo();
       if (isBuiltIn)
       {
          std::string errmsg = "The value of \"";
@@ -871,6 +991,7 @@ bool CalculatedPoint::SetRefObject(GmatBase *obj,
 {
    if (obj->IsOfType(Gmat::SPACE_POINT))
    {
+      ClearStateMemo();
       if (!obj->IsOfType("CelestialBody") && !obj->IsOfType("Barycenter"))
       {
          std::string errmsg = "The value of \"";
@@ -1052,6 +1173,7 @@ bool CalculatedPoint::TakeAction(const std::string &action,
    #endif
    if (action == "ClearBodies")
    {
+      ClearStateMemo();
       bodyNames.clear();
       bodyList.clear();
 //      defaultBodies.clear();
@@ -53,6 +53,11 @@
  *
  * @note Bodies are set on a(n) (sub)object of this class via the SetRefObject
  *       method.
+ *
+ * @note The last computed state is remembered together with its epoch, so the
+ *       forces, coordinate systems and parameters that ask for the point at
+ *       the same epoch share one evaluation.  The memo is discarded whenever
+ *       the bodies or the settings of the point change.
  */
 class GMAT_API CalculatedPoint : public SpacePoint
 {
@@ -76,6 +81,8 @@ public:
    virtual Real         SetEpoch(const GmatTime ep);
 
    virtual Rvector6     GetLastState();
+   virtual void         GetMJ2000States(const RealArray &epochs,
+                                        std::vector<Rvector6> &states);
 
    // methods inherited from SpacePoint, that must be implemented
    // in the derived classes
@@ -178,6 +185,16 @@ protected:
    GmatTime                    lastStateTimeGT;
 
    Rvector6                    lastState;
+   /// true when lastState holds the state at the last state epoch
+   bool                        stateMemoValid;
+   /// true when the memo state was computed at the GmatTime epoch
+   bool                        stateMemoIsGT;
+
+   bool FindMemoState(const A1Mjd &atTime) const;
+   bool FindMemoState(const GmatTime &atTime) const;
+   void MemoizeState(const A1Mjd &atTime);
+   void MemoizeState(const GmatTime &atTime);
+   void ClearStateMemo();
 
    bool ValidateBodyName(const std::string &itsName, bool addToList = true, bool addToEnd = true, Integer index = 0);
     
@@ -62,6 +62,9 @@
 #include "TimeTypes.hpp"
 #include "StateConversionUtil.hpp"
 #include "StringUtil.hpp"               // for ToString()
+#ifdef __USE_SPICE__
+#include "SpiceChebyshevEphemeris.hpp"
+#endif
 
 
 //#define DEBUG_CELESTIAL_BODY 1
@@ -217,6 +220,7 @@ const Real    CelestialBody::TDot                       = 1.0;
 const Real    CelestialBody::KEPLER_TOL                 = 1.0e-08;
 const Integer CelestialBody::KEPLER_MAX_ITERATIONS      = 50;
 const Real    CelestialBody::DEFAULT_INITIAL_STATE_TIME = GmatTimeConstants::A1MJD_OF_J2000;
+const Real    CelestialBody::SPICE_FIT_VELOCITY_SCALE   = 1.0e-3;
 
 
 //------------------------------------------------------------------------------
@@ -266,6 +270,8 @@ CelestialBody::CelestialBody(std::string itsBodyType, std::string name) :
    ephemUpdateInterval (0.0),
    lastEphemTime      (0.0),
    lastEphemTimeGT    (GmatTime(0.0)),
+   ephemMemo          (new EphemerisMemo),
+   spiceFitTolerance  (0.0),
    rotationSrc        (Gmat::IAU_SIMPLIFIED),
    userDefined        (false),
    allowSpice         (false),
@@ -398,6 +404,8 @@ CelestialBody::CelestialBody(Gmat::BodyType itsBodyType, std::string name) :
    ephemUpdateInterval (0.0),
    lastEphemTime      (0.0),
    lastEphemTimeGT    (GmatTime(0.0)),
+   ephemMemo          (new EphemerisMemo),
+   spiceFitTolerance  (0.0),
    rotationSrc        (Gmat::IAU_SIMPLIFIED),
    userDefined        (false),
    allowSpice         (false),
@@ -535,6 +543,8 @@ CelestialBody::CelestialBody(const CelestialBody &cBody) :
    ephemUpdateInterval (cBody.ephemUpdateInterval),
    lastEphemTime       (cBody.lastEphemTime),
    lastEphemTimeGT     (cBody.lastEphemTimeGT),
+   ephemMemo           (cBody.ephemMemo),
+   spiceFitTolerance   (cBody.spiceFitTolerance),
    lastState           (cBody.lastState),
    lastAcceleration    (cBody.lastAcceleration),
    j2kState            (cBody.j2kState),
@@ -711,6 +721,9 @@ CelestialBody& CelestialBody::operator=(const CelestialBody &cBody)
    ephemUpdateInterval = cBody.ephemUpdateInterval;
    lastEphemTime       = cBody.lastEphemTime;
    lastEphemTimeGT     = cBody.lastEphemTimeGT;
+   ephemMemo           = cBody.ephemMemo;
+   spiceFitTolerance   = cBody.spiceFitTolerance;
+   spiceFit            = cBody.spiceFit;
    lastState           = cBody.lastState;
    lastAcceleration    = cBody.lastAcceleration;
    j2kState            = cBody.j2kState;
@@ -1163,6 +1176,19 @@ const Rvector6&  CelestialBody::GetState(A1Mjd atTime)
       return lastState;
    }
    
+   Real memoState[6];
+   if (ephemMemo->Find(atTime.Get(), memoState))
+   {
+      state.Set(memoState[0], memoState[1], memoState[2],
+                memoState[3], memoState[4], memoState[5]);
+      stateTime     = atTime;
+      lastEphemTime = atTime;
+      lastState     = state;
+      for (Integer i=0;i<6;i++)
+         prevState[i] = memoState[i];
+      return state;
+   }
+   
    Real*     posVel = NULL;
    switch (posVelSrc)
    {
@@ -1195,6 +1221,13 @@ const Rvector6&  CelestialBody::GetState(A1Mjd atTime)
       {
          #ifdef __USE_SPICE__
             if (!spiceSetupDone) SetUpSPICE();
+            Real fitState[6];
+            if (spiceFit && spiceFit->GetState(atTime.Get(), fitState))
+            {
+               state.Set(fitState[0], fitState[1], fitState[2],
+                         fitState[3], fitState[4], fitState[5]);
+               break;
+            }
             Rvector6 spiceState = kernelReader->GetTargetState(naifName, naifId, atTime, j2000BodyName, naifIdObserver);
             state.Set(spiceState[0], spiceState[1], spiceState[2],
                       spiceState[3], spiceState[4], spiceState[5]);
@@ -1225,6 +1258,7 @@ const Rvector6&  CelestialBody::GetState(A1Mjd atTime)
    stateTime     = atTime;
    lastEphemTime = atTime;
    lastState     = state;
+   ephemMemo->Store(atTime.Get(), state.GetDataVector());
    
    for (Integer i=0;i<6;i++)
       prevState[i] = lastState[i];
@@ -1380,6 +1414,21 @@ const Rvector6&  CelestialBody::GetState(GmatTime atTime)
       return lastState;
    }
 
+   Real memoState[6];
+   if (ephemMemo->Find(atTime, memoState))
+   {
+      state.Set(memoState[0], memoState[1], memoState[2],
+         memoState[3], memoState[4], memoState[5]);
+      stateTimeGT     = atTime;
+      stateTime       = atTime.GetMjd();
+      lastEphemTimeGT = atTime;
+      lastEphemTime   = atTime.GetMjd();
+      lastState = state;
+      for (Integer i = 0; i<6; i++)
+         prevState[i] = memoState[i];
+      return state;
+   }
+
    //Real*     posVel = NULL;
    switch (posVelSrc)
    {
@@ -1451,6 +1500,7 @@ const Rvector6&  CelestialBody::GetState(GmatTime atTime)
    lastEphemTimeGT = atTime;
    lastEphemTime   = atTime.GetMjd();
    lastState = state;
+   ephemMemo->Store(atTime, state.GetDataVector());
 
    for (Integer i = 0; i<6; i++)
       prevState[i] = lastState[i];
@@ -3221,6 +3271,7 @@ bool CelestialBody::SetSource(Gmat::PosVelSource pvSrc)
       spiceSetupDone = false;
    }
    posVelSrc           = pvSrc;
+   DetachEphemerisMemo();
    return true;
 }
 
@@ -3242,6 +3293,7 @@ bool CelestialBody::SetSourceFile(PlanetaryEphem *src)
    theSourceFile  = src;
    sourceFilename = theSourceFile->GetName();
    bodyNumber     = theSourceFile->GetBodyID(instanceName);
+   DetachEphemerisMemo();
    #ifdef DEBUG_EPHEM_SOURCE
       MessageInterface::ShowMessage
          ("CelestialBody::SetSourceFile() <%p> %s, Setting source file to %p\n",
@@ -3339,6 +3391,8 @@ bool CelestialBody::SetOverrideTimeSystem(bool overrideIt)
       ("CelestialBody::SetOverrideTimeSystem() <%p> '%s' entered, overrideIt=%d\n",
        this, GetName().c_str(), overrideIt);
    #endif
+   if (overrideIt != overrideTime)
+      DetachEphemerisMemo();
    overrideTime        = overrideIt;
    return true;
 }
@@ -3371,6 +3425,73 @@ bool CelestialBody::SetEphemUpdateInterval(Real intvl)
 }
 
 
+//------------------------------------------------------------------------------
+// bool SetSpiceFitTolerance(Real tolerance)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the allowed position error (km) of the Chebyshev fit of the
+ * SPICE states.  The velocity tolerance is scaled from it.  A tolerance of 0
+ * turns the fit off, so that every state is read from the kernels.
+ *
+ * @param <tolerance> allowed position error of the fit
+ *
+ * @return flag indicating success of the method.
+ *
+ */
+//------------------------------------------------------------------------------
+bool CelestialBody::SetSpiceFitTolerance(Real tolerance)
+{
+   if (tolerance < 0.0)
+   {
+      SolarSystemException sse;
+      sse.SetDetails(errorMessageFormat.c_str(),
+                     GmatStringUtil::ToString(tolerance, GetDataPrecision()).c_str(),
+                     "SPICE Fit Tolerance", "Real Number >= 0.0");
+      throw sse;
+   }
+   if (tolerance != spiceFitTolerance)
+      spiceSetupDone = false;
+   spiceFitTolerance = tolerance;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetSpiceFitTolerance() const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the allowed position error (km) of the Chebyshev fit of
+ * the SPICE states; 0 if the fit is off.
+ *
+ * @return the fit tolerance
+ *
+ */
+//------------------------------------------------------------------------------
+Real CelestialBody::GetSpiceFitTolerance() const
+{
+   return spiceFitTolerance;
+}
+
+
+//------------------------------------------------------------------------------
+// void GetEphemerisMemoCounts(UnsignedInt &hits, UnsignedInt &misses) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of ephemeris states found in, and missing from, the memo
+ * of recent states.  The counts cover the clones that share the memo.
+ *
+ * @param <hits>   number of states found in the memo
+ * @param <misses> number of states read from the ephemeris source
+ */
+//------------------------------------------------------------------------------
+void CelestialBody::GetEphemerisMemoCounts(UnsignedInt &hits,
+                                           UnsignedInt &misses) const
+{
+   hits   = ephemMemo->GetHitCount();
+   misses = ephemMemo->GetMissCount();
+}
+
+
 //------------------------------------------------------------------------------
 // bool AddValidModelName(Gmat::ModelType m, const std::string &newModel)
 //------------------------------------------------------------------------------
@@ -3733,6 +3854,7 @@ bool CelestialBody::SetUserDefined(bool userDefinedBody)
 		   posVelSrc = (Gmat::PosVelSource)index;
    }
 
+   DetachEphemerisMemo();
    userDefined         = userDefinedBody;
    if (userDefined) allowSpice = true;
    #ifdef DEBUG_CB_USER_DEFINED
@@ -4363,11 +4485,12 @@ Integer CelestialBody::GetParameterID(const std::string &str) const
       MessageInterface::ShowMessage("In CB::GetParameterID, str = %s\n",
             str.c_str());
    #endif
-   for (Integer i = SpacePointParamCount; i < CelestialBodyParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpacePointParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SpacePointParamCount,
+               CelestialBodyParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    if (str == "PlanetarySpiceKernelName")
       return ATTITUDE_SPICE_KERNEL_NAME;
    else if (str == "AttitudeSpiceKernelName")
@@ -4827,6 +4950,7 @@ Integer CelestialBody::SetIntegerParameter(const Integer id,
    if (id == BODY_NUMBER)
    {
       bodyNumber          = value;
+      DetachEphemerisMemo();
       return bodyNumber;
    }
    if (id == REF_BODY_NUMBER)
@@ -4996,6 +5120,7 @@ bool CelestialBody::SetStringParameter(const Integer id,
          if (value == Gmat::POS_VEL_SOURCE_STRINGS[i])
          {
             posVelSrc = (Gmat::PosVelSource) i;
+            DetachEphemerisMemo();
             return true;
          }
       return false;
@@ -6656,6 +6781,14 @@ bool CelestialBody::SetUpSPICE()
             instanceName.c_str(), naifId);
    #endif
 
+   // The kernels or the observer may have changed
+   DetachEphemerisMemo();
+   if (spiceFitTolerance > 0.0)
+      spiceFit.reset(new SpiceChebyshevEphemeris(kernelReader, naifName,
+            naifId, j2000BodyName, naifIdObserver, spiceFitTolerance,
+            spiceFitTolerance * SPICE_FIT_VELOCITY_SCALE));
+   else
+      spiceFit.reset();
    spiceSetupDone = true;
 #endif
    return true;
@@ -6677,6 +6810,21 @@ bool CelestialBody::NeedsOnlyMainSPK()
    return false;
 }
 
+//------------------------------------------------------------------------------
+//  void DetachEphemerisMemo()
+//------------------------------------------------------------------------------
+/**
+ * Gives this body an empty memo of its own.
+ *
+ * Called when the source of the states changes.  The clones that share the old
+ * memo still read the old source, so they keep it.
+ */
+//------------------------------------------------------------------------------
+void CelestialBody::DetachEphemerisMemo()
+{
+   ephemMemo.reset(new EphemerisMemo);
+}
+
 //------------------------------------------------------------------------------
 // bool IsRealParameterValid(Integer id, Real realval, bool throwError = true)
 //------------------------------------------------------------------------------
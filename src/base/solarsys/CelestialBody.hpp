@@ -47,6 +47,9 @@
 #include "Rmatrix.hpp"
 #include "Rvector6.hpp"
 #include "TimeTypes.hpp"
+#include "EphemerisMemo.hpp"
+#include "ChebyshevEphemeris.hpp"
+#include <memory>
 #ifdef __USE_SPICE__
 #include "SpiceOrbitKernelReader.hpp"
 #endif
@@ -250,6 +253,10 @@ public:
    
    virtual bool           SetOverrideTimeSystem(bool overrideIt);
    virtual bool           SetEphemUpdateInterval(Real intvl);
+   void                   GetEphemerisMemoCounts(UnsignedInt &hits,
+                                                 UnsignedInt &misses) const;
+   virtual bool           SetSpiceFitTolerance(Real tolerance);
+   Real                   GetSpiceFitTolerance() const;
    virtual bool           AddValidModelName(Gmat::ModelType m, 
                                             const std::string &newModel);
    virtual bool           RemoveValidModelName(Gmat::ModelType m, 
@@ -453,6 +460,8 @@ protected:
    static const Real    KEPLER_TOL;
    static const Integer KEPLER_MAX_ITERATIONS;
    static const Real    DEFAULT_INITIAL_STATE_TIME;
+   /// velocity tolerance (km/s) of the SPICE fit per km of position tolerance
+   static const Real    SPICE_FIT_VELOCITY_SCALE;
    
    // body type of the body
    Gmat::BodyType           bodyType;
@@ -572,6 +581,15 @@ protected:
    /// last time that the state was calculated
    A1Mjd                  lastEphemTime;
    GmatTime               lastEphemTimeGT;
+   /// recent ephemeris states, shared with the clones reading the same source
+   std::shared_ptr<EphemerisMemo>
+                          ephemMemo;
+   /// allowed position error (km) of the Chebyshev fit of the SPICE states;
+   /// 0 reads every state from the kernels
+   Real                   spiceFitTolerance;
+   /// the fit, shared with the assigned copies that use the same kernel reader
+   std::shared_ptr<ChebyshevEphemeris>
+                          spiceFit;
 
    /// last state value calculated
    Rvector6               lastState;
@@ -650,6 +668,7 @@ protected:
    virtual Rvector6 KeplersProblem(const A1Mjd &forTime);
    virtual bool     SetUpSPICE();
    virtual bool     NeedsOnlyMainSPK();
+   void             DetachEphemerisMemo();
    
    bool IsRealParameterValid(Integer id, Real realval, bool throwError = true);
    bool SetTextureMapFileName(const std::string &fileName,
@@ -0,0 +1,360 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              ChebyshevEphemeris
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the ChebyshevEphemeris class.
+ */
+//------------------------------------------------------------------------------
+
+#include <cmath>
+#include "ChebyshevEphemeris.hpp"
+#include "GmatConstants.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_CHEBYSHEV_FIT
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const Real ChebyshevEphemeris::DEFAULT_SPAN = 8.0;
+const Real ChebyshevEphemeris::MIN_SPAN     = 1.0 / 64.0;
+
+
+//------------------------------------------------------------------------------
+//  public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// ChebyshevEphemeris(Real posTolerance, Real velTolerance, Real initialSpan)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param posTolerance Allowed position error of the fit, in km
+ * @param velTolerance Allowed velocity error of the fit, in km/s
+ * @param initialSpan  Span of the first segments, in days
+ */
+//------------------------------------------------------------------------------
+ChebyshevEphemeris::ChebyshevEphemeris(Real posTolerance, Real velTolerance,
+                                       Real initialSpan) :
+   positionTolerance (posTolerance),
+   velocityTolerance (velTolerance),
+   span              (initialSpan),
+   lastSegment       (NULL),
+   lastIndex         (0),
+   sampleCount       (0)
+{
+   for (Integer k = 0; k < NODE_COUNT; ++k)
+      nodes[k] = cos(GmatMathConstants::PI * (k + 0.5) / NODE_COUNT);
+}
+
+
+//------------------------------------------------------------------------------
+// ~ChebyshevEphemeris()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+ChebyshevEphemeris::~ChebyshevEphemeris()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetState(Real a1Mjd, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the fit, fitting the segment containing the epoch if needed.
+ *
+ * @param a1Mjd The A.1 modified Julian epoch
+ * @param state The position (km) and velocity (km/s) at the epoch
+ *
+ * @return true if the state was evaluated, false if the caller needs to use
+ *         the source
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevEphemeris::GetState(Real a1Mjd, Real *state)
+{
+   std::lock_guard<std::mutex> lock(access);
+
+   Real x, cell;
+   Segment *segment = NULL;
+   // NULL means that the span was halved, and the grid changed with it
+   while (segment == NULL)
+   {
+      x = a1Mjd / span;
+      cell = floor(x);
+      segment = GetSegment((Integer)cell);
+   }
+   if (!segment->valid)
+      return false;
+
+   Evaluate(*segment, 2.0 * (x - cell) - 1.0, state);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes the fitted segments, so they are fitted again from the source.
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemeris::Clear()
+{
+   std::lock_guard<std::mutex> lock(access);
+   segments.clear();
+   lastSegment = NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetSpan() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the span of the segments, in days.
+ *
+ * @return The span
+ */
+//------------------------------------------------------------------------------
+Real ChebyshevEphemeris::GetSpan() const
+{
+   std::lock_guard<std::mutex> lock(access);
+   return span;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetSegmentCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of segments fitted at the current span.
+ *
+ * @return The segment count
+ */
+//------------------------------------------------------------------------------
+Integer ChebyshevEphemeris::GetSegmentCount() const
+{
+   std::lock_guard<std::mutex> lock(access);
+   return (Integer)segments.size();
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetSampleCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of states sampled from the source.
+ *
+ * @return The sample count
+ */
+//------------------------------------------------------------------------------
+UnsignedInt ChebyshevEphemeris::GetSampleCount() const
+{
+   std::lock_guard<std::mutex> lock(access);
+   return sampleCount;
+}
+
+
+//------------------------------------------------------------------------------
+//  protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Segment* GetSegment(Integer index)
+//------------------------------------------------------------------------------
+/**
+ * Finds a segment, fitting it if needed; the caller holds the lock.
+ *
+ * @param index The segment index
+ *
+ * @return The segment, or NULL if the span was halved to fit it
+ */
+//------------------------------------------------------------------------------
+ChebyshevEphemeris::Segment* ChebyshevEphemeris::GetSegment(Integer index)
+{
+   if ((lastSegment != NULL) && (lastIndex == index))
+      return lastSegment;
+
+   std::map<Integer, Segment>::iterator i = segments.find(index);
+   if (i != segments.end())
+   {
+      lastSegment = &(i->second);
+      lastIndex = index;
+      return lastSegment;
+   }
+
+   Segment fitted;
+   if (!FitSegment(index, fitted))
+   {
+      if (span * 0.5 >= MIN_SPAN)
+      {
+         span *= 0.5;
+         segments.clear();
+         lastSegment = NULL;
+
+         #ifdef DEBUG_CHEBYSHEV_FIT
+            MessageInterface::ShowMessage("ChebyshevEphemeris: span reduced "
+                  "to %.10lf days\n", span);
+         #endif
+
+         return NULL;
+      }
+      fitted.valid = false;
+   }
+
+   lastSegment = &(segments[index] = fitted);
+   lastIndex = index;
+   return lastSegment;
+}
+
+
+//------------------------------------------------------------------------------
+// bool FitSegment(Integer index, Segment &segment)
+//------------------------------------------------------------------------------
+/**
+ * Samples the source at the nodes of a segment and checks the fit.
+ *
+ * @param index   The segment index
+ * @param segment The fitted segment; marked invalid if a sample failed
+ *
+ * @return false if the fit misses the tolerances
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevEphemeris::FitSegment(Integer index, Segment &segment)
+{
+   Real start = index * span;
+   // Check the ends and the middle, between the two central nodes
+   const Real checks[3] = {-1.0, 0.0, 1.0};
+
+   // The nodes and the check points are sampled in one batch
+   Real epochs[NODE_COUNT + 3];
+   Real values[NODE_COUNT + 3][6];
+   for (Integer k = 0; k < NODE_COUNT; ++k)
+      epochs[k] = start + 0.5 * (nodes[k] + 1.0) * span;
+   for (Integer m = 0; m < 3; ++m)
+      epochs[NODE_COUNT + m] = start + 0.5 * (checks[m] + 1.0) * span;
+
+   segment.valid = true;
+   sampleCount += NODE_COUNT + 3;
+   if (!SampleStates(NODE_COUNT + 3, epochs, values))
+   {
+      segment.valid = false;
+      return true;
+   }
+
+   // c_j = (2 / n) sum_k f(x_k) T_j(x_k), with the first term halved
+   for (Integer j = 0; j < NODE_COUNT; ++j)
+   {
+      Real scale = (j == 0 ? 1.0 : 2.0) / NODE_COUNT;
+      for (Integer c = 0; c < 6; ++c)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k < NODE_COUNT; ++k)
+            sum += values[k][c] *
+                   cos(GmatMathConstants::PI * j * (k + 0.5) / NODE_COUNT);
+         segment.coefficients[c * NODE_COUNT + j] = scale * sum;
+      }
+   }
+
+   for (Integer m = 0; m < 3; ++m)
+   {
+      const Real *truth = values[NODE_COUNT + m];
+      Real fit[6];
+      Evaluate(segment, checks[m], fit);
+
+      Real dr = 0.0, dv = 0.0;
+      for (Integer c = 0; c < 3; ++c)
+      {
+         dr += (fit[c] - truth[c]) * (fit[c] - truth[c]);
+         dv += (fit[c+3] - truth[c+3]) * (fit[c+3] - truth[c+3]);
+      }
+
+      #ifdef DEBUG_CHEBYSHEV_FIT
+         MessageInterface::ShowMessage("ChebyshevEphemeris: segment %d at "
+               "%.2lf: position error %le km, velocity error %le km/s\n", index,
+               checks[m], sqrt(dr), sqrt(dv));
+      #endif
+
+      if ((sqrt(dr) > positionTolerance) || (sqrt(dv) > velocityTolerance))
+         return false;
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool SampleStates(Integer count, const Real *a1Mjds, Real (*states)[6])
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the source at a batch of epochs.
+ *
+ * This default samples the epochs one at a time; sources that can answer a
+ * batch more cheaply override it.
+ *
+ * @param count  The number of epochs
+ * @param a1Mjds The A.1 modified Julian epochs
+ * @param states The states at the epochs
+ *
+ * @return false if the source has no state at one of the epochs
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevEphemeris::SampleStates(Integer count, const Real *a1Mjds,
+                                      Real (*states)[6])
+{
+   for (Integer k = 0; k < count; ++k)
+      if (!SampleState(a1Mjds[k], states[k]))
+         return false;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void Evaluate(const Segment &segment, Real x, Real *state) const
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the polynomials of a segment.
+ *
+ * @param segment The segment
+ * @param x       Normalized time in the segment, from -1 to 1
+ * @param state   The state
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemeris::Evaluate(const Segment &segment, Real x,
+                                  Real *state) const
+{
+   Real t[NODE_COUNT];
+   t[0] = 1.0;
+   t[1] = x;
+   for (Integer j = 2; j < NODE_COUNT; ++j)
+      t[j] = 2.0 * x * t[j-1] - t[j-2];
+
+   for (Integer c = 0; c < 6; ++c)
+   {
+      const Real *coefficient = &segment.coefficients[c * NODE_COUNT];
+      Real sum = 0.0;
+      for (Integer j = NODE_COUNT - 1; j >= 0; --j)
+         sum += coefficient[j] * t[j];
+      state[c] = sum;
+   }
+}
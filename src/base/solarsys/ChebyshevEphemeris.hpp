@@ -0,0 +1,132 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              ChebyshevEphemeris
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the ChebyshevEphemeris class, an ephemeris fitted on the fly
+ * with Chebyshev segments.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef ChebyshevEphemeris_hpp
+#define ChebyshevEphemeris_hpp
+
+#include "gmatdefs.hpp"
+#include <map>
+#include <mutex>
+
+/**
+ * Chebyshev fit of an ephemeris that is expensive to evaluate
+ *
+ * The states of the source are fitted in segments of equal span placed on a
+ * grid of A.1 modified Julian epochs.  A segment is fitted the first time an
+ * epoch in it is requested: the source is sampled at the DEGREE + 1 Chebyshev
+ * nodes of the segment, and the position and velocity components are
+ * interpolated separately.  The fit is checked against the source at both ends
+ * of the segment and at its middle, where the interpolation error is largest.
+ * When the check fails, the span is halved, the segments fitted so far are
+ * dropped, and the segment is fitted again, down to MIN_SPAN; a segment that
+ * still fails, or that could not be sampled, is marked so that its epochs go
+ * to the source.
+ *
+ * Derived classes supply the source through SampleState(), and may batch the
+ * samples of a segment through SampleStates().  The segments are shared by
+ * the bodies that share the object, so the accesses are serialized.
+ */
+class GMAT_API ChebyshevEphemeris
+{
+public:
+   ChebyshevEphemeris(Real posTolerance, Real velTolerance,
+                      Real initialSpan = DEFAULT_SPAN);
+   virtual ~ChebyshevEphemeris();
+
+   bool           GetState(Real a1Mjd, Real *state);
+   void           Clear();
+
+   Real           GetSpan() const;
+   Integer        GetSegmentCount() const;
+   UnsignedInt    GetSampleCount() const;
+
+   /// Degree of the segment polynomials
+   static const Integer DEGREE = 13;
+   /// Number of nodes of each segment
+   static const Integer NODE_COUNT = DEGREE + 1;
+   /// Span of the segments when the object is built, in days
+   static const Real    DEFAULT_SPAN;
+   /// Shortest span tried before a segment is given up, in days
+   static const Real    MIN_SPAN;
+
+protected:
+   /// One fitted segment
+   struct Segment
+   {
+      /// false if the epochs in the segment go to the source
+      bool        valid;
+      /// Chebyshev coefficients, NODE_COUNT per state component
+      Real        coefficients[6 * NODE_COUNT];
+   };
+
+   /// Allowed position error of the fit, in km
+   Real           positionTolerance;
+   /// Allowed velocity error of the fit, in km/s
+   Real           velocityTolerance;
+   /// Current span of the segments, in days
+   Real           span;
+   /// The segments, indexed by floor(epoch / span)
+   std::map<Integer, Segment>
+                  segments;
+   /// Segment used for the last request, and its index
+   Segment        *lastSegment;
+   Integer        lastIndex;
+   /// Number of states sampled from the source
+   UnsignedInt    sampleCount;
+   /// Node abscissae on [-1, 1]
+   Real           nodes[NODE_COUNT];
+   /// Serializes the accesses from the sharing bodies
+   mutable std::mutex
+                  access;
+
+   //---------------------------------------------------------------------------
+   // bool SampleState(Real a1Mjd, Real *state)
+   //---------------------------------------------------------------------------
+   /**
+    * Evaluates the source.
+    *
+    * @param a1Mjd The A.1 modified Julian epoch
+    * @param state The position (km) and velocity (km/s) at the epoch
+    *
+    * @return false if the source has no state at the epoch
+    */
+   //---------------------------------------------------------------------------
+   virtual bool   SampleState(Real a1Mjd, Real *state) = 0;
+   virtual bool   SampleStates(Integer count, const Real *a1Mjds,
+                               Real (*states)[6]);
+
+   Segment*       GetSegment(Integer index);
+   bool           FitSegment(Integer index, Segment &segment);
+   void           Evaluate(const Segment &segment, Real x, Real *state) const;
+
+private:
+   // copy constructor - NOT IMPLEMENTED
+   ChebyshevEphemeris(const ChebyshevEphemeris &ce);
+   // operator = - NOT IMPLEMENTED
+   const ChebyshevEphemeris& operator=(const ChebyshevEphemeris &ce);
+};
+
+#endif // ChebyshevEphemeris_hpp
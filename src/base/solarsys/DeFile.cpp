@@ -72,6 +72,14 @@
 
 #include <iostream>
 
+#if !defined(_WIN32)
+   #define DEFILE_USE_MMAP
+   #include <fcntl.h>
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <unistd.h>
+#endif
+
 
 #ifndef TRUE
 #define TRUE 1
@@ -126,7 +134,10 @@ const Real DeFile::TT_OFFSET      = GmatTimeConstants::TT_TAI_OFFSET;
 //------------------------------------------------------------------------------
 DeFile::DeFile(Gmat::DeFileType ofType, std::string fileName,
                Gmat::DeFileFormat fmt) :
-   PlanetaryEphem(fileName)
+   PlanetaryEphem(fileName),
+   mappedData    (NULL),
+   mappedSize    (0),
+   recordCount   (0)
 {
    defType       = ofType;
    theFileFormat = fmt;
@@ -159,6 +170,9 @@ DeFile::DeFile(const DeFile& def) :
    T_beg          (def.T_beg),
    T_end          (def.T_end),
    T_span         (def.T_span),
+   mappedData     (NULL),
+   mappedSize     (0),
+   recordCount    (0),
    baseEpoch      (def.baseEpoch),
    mFileBeg       (def.mFileBeg),
    mA1FileBeg     (def.mA1FileBeg),
@@ -173,6 +187,10 @@ DeFile::DeFile(const DeFile& def) :
 
    int i;
    for (i=0;i<MAX_ARRAY_SIZE;i++)  Coeff_Array[i] = def.Coeff_Array[i];
+
+   // Each copy holds its own map; the pages are shared by the OS
+   if (def.mappedData != NULL)
+      Map_Ephemeris(binaryFileName);
 }
 
 //------------------------------------------------------------------------------
@@ -217,6 +235,11 @@ DeFile& DeFile::operator=(const DeFile& def)
    mA1FileBeg     = def.mA1FileBeg;
 
    EPHEMERIS      = def.EPHEMERIS;
+
+   Unmap_Ephemeris();
+   if (def.mappedData != NULL)
+      Map_Ephemeris(binaryFileName);
+
    return *this;
 }
 
@@ -229,6 +252,8 @@ DeFile& DeFile::operator=(const DeFile& def)
 //------------------------------------------------------------------------------
 DeFile::~DeFile()
 {
+   Unmap_Ephemeris();
+
    // close the file, if it's open
    if (Ephemeris_File != NULL)
    {
@@ -984,6 +1009,10 @@ void DeFile::InitializeDeFile(std::string fName, Gmat::DeFileFormat fileFmt)
       throw PlanetaryEphemException("DE file is not of specified format!!"
                                     "DE file not able to be initialized!");
    }
+   // Records are read through a memory map when one is available, and with
+   // fseek/fread otherwise
+   Map_Ephemeris(binaryFileName);
+
    itsName           = binaryFileName;
    strcpy(g_pef_dcb.full_path,binaryFileName.c_str());
    g_pef_dcb.recl    = arraySize;
@@ -1186,6 +1215,213 @@ void DeFile::Read_Coefficients(GmatTime Time)
    }
 }
 
+//------------------------------------------------------------------------------
+// bool Map_Ephemeris(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Maps the binary DE file read-only into memory.
+ *
+ * With the file mapped, a coefficient record is located by arithmetic on the
+ * record index instead of by fseek/fread into the single Coeff_Array buffer,
+ * so bodies queried at different epochs no longer evict each other's record.
+ *
+ * @param fileName The binary DE file
+ *
+ * @return true if the file was mapped, false if fread access is used instead
+ */
+//------------------------------------------------------------------------------
+bool DeFile::Map_Ephemeris(const std::string &fileName)
+{
+   Unmap_Ephemeris();
+
+   #ifdef DEFILE_USE_MMAP
+      int fd = open(fileName.c_str(), O_RDONLY);
+      if (fd < 0)
+         return false;
+
+      struct stat info;
+      if (fstat(fd, &info) != 0)
+      {
+         close(fd);
+         return false;
+      }
+
+      // Two header records precede the coefficient records
+      size_t recordBytes = arraySize * sizeof(double);
+      Integer records = (Integer)(info.st_size / recordBytes) - 2;
+      if (records < 1)
+      {
+         close(fd);
+         return false;
+      }
+
+      void *addr = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+      close(fd);
+      if (addr == MAP_FAILED)
+         return false;
+
+      mappedData  = (const double*)addr;
+      mappedSize  = info.st_size;
+      recordCount = records;
+
+      #ifdef DEBUG_DEFILE_INIT
+      MessageInterface::ShowMessage
+         ("DeFile::Map_Ephemeris() mapped %d records of %s\n", recordCount,
+          fileName.c_str());
+      #endif
+
+      return true;
+   #else
+      return false;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void Unmap_Ephemeris()
+//------------------------------------------------------------------------------
+/**
+ * Releases the memory map of the DE file, if there is one.
+ */
+//------------------------------------------------------------------------------
+void DeFile::Unmap_Ephemeris()
+{
+   #ifdef DEFILE_USE_MMAP
+      if (mappedData != NULL)
+         munmap((void*)mappedData, mappedSize);
+   #endif
+
+   mappedData  = NULL;
+   mappedSize  = 0;
+   recordCount = 0;
+}
+
+
+//------------------------------------------------------------------------------
+// CoeffRecord Get_Mapped_Record(Integer index, double Time)
+//------------------------------------------------------------------------------
+/**
+ * Builds the view of a coefficient record in the memory map.
+ *
+ * @param index The 0-based coefficient record index
+ * @param Time  The requested time, used in the error message
+ *
+ * @return The record view
+ */
+//------------------------------------------------------------------------------
+DeFile::CoeffRecord DeFile::Get_Mapped_Record(Integer index, double Time)
+{
+   if ((index < 0) || (index >= recordCount))
+   {
+      PlanetaryEphemException ex;
+      ex.SetDetails("Requested epoch %.9f is not on the DE file '%s'.\n", Time,
+                    theFileName.c_str());
+      throw ex;
+   }
+
+   CoeffRecord rec;
+   rec.coeff = mappedData + (size_t)(index + 2) * arraySize;
+   rec.beg   = rec.coeff[0] - baseEpoch;
+   rec.end   = rec.coeff[1] - baseEpoch;
+   rec.span  = rec.end - rec.beg;
+   return rec;
+}
+
+
+//------------------------------------------------------------------------------
+// CoeffRecord Find_Record(double Time)
+//------------------------------------------------------------------------------
+/**
+ * Locates the coefficient record containing a time.
+ *
+ * When the file is mapped this only reads the map, so concurrent callers do
+ * not disturb one another.  Otherwise the record is loaded into Coeff_Array
+ * with Read_Coefficients, as needed.
+ *
+ * @param Time Time in the record, relative to baseEpoch
+ *
+ * @return The record view
+ */
+//------------------------------------------------------------------------------
+DeFile::CoeffRecord DeFile::Find_Record(double Time)
+{
+   CoeffRecord rec;
+
+   if (mappedData == NULL)
+   {
+      if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+      rec.coeff = Coeff_Array;
+      rec.beg   = T_beg;
+      rec.end   = T_end;
+      rec.span  = T_span;
+      return rec;
+   }
+
+   // Records have a fixed span, so the index follows from the first record
+   const double *first = mappedData + 2 * arraySize;
+   double firstBeg = first[0] - baseEpoch;
+   double span     = first[1] - first[0];
+
+   Integer index = (Integer) floor((Time - firstBeg) / span);
+   if (index == recordCount)  // Final boundary belongs to the last record
+      --index;
+
+   rec = Get_Mapped_Record(index, Time);
+   // Correct the index for roundoff.  A time on a record boundary is taken
+   // from the earlier record, as the granule search requires Time > rec.beg.
+   if ((Time < rec.beg) || ((Time == rec.beg) && (index > 0)))
+      rec = Get_Mapped_Record(index - 1, Time);
+   else if (Time > rec.end)
+      rec = Get_Mapped_Record(index + 1, Time);
+
+   return rec;
+}
+
+
+//------------------------------------------------------------------------------
+// CoeffRecord Find_Record(const GmatTime &Time)
+//------------------------------------------------------------------------------
+/**
+ * Locates the coefficient record containing a time.
+ *
+ * @param Time Time in the record, relative to baseEpoch
+ *
+ * @return The record view
+ */
+//------------------------------------------------------------------------------
+DeFile::CoeffRecord DeFile::Find_Record(const GmatTime &Time)
+{
+   CoeffRecord rec;
+
+   if (mappedData == NULL)
+   {
+      if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+      rec.coeff = Coeff_Array;
+      rec.beg   = T_beg;
+      rec.end   = T_end;
+      rec.span  = T_span;
+      return rec;
+   }
+
+   const double *first = mappedData + 2 * arraySize;
+   double firstBeg = first[0] - baseEpoch;
+   double span     = first[1] - first[0];
+
+   Integer index = (Integer) floor((Time - GmatTime(firstBeg)).GetTimeInSec() /
+         (span * GmatTimeConstants::SECS_PER_DAY));
+   if (index == recordCount)  // Final boundary belongs to the last record
+      --index;
+
+   rec = Get_Mapped_Record(index, Time.GetMjd());
+   // Correct the index for roundoff; boundary times use the earlier record
+   if ((Time < rec.beg) || ((Time <= rec.beg) && (index > 0)))
+      rec = Get_Mapped_Record(index - 1, Time.GetMjd());
+   else if (Time > rec.end)
+      rec = Get_Mapped_Record(index + 1, Time.GetMjd());
+
+   return rec;
+}
+
 
 /**==========================================================================**/
 /**  Initialize_Ephemeris                                                    **/
@@ -1307,8 +1543,6 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
    #ifdef DEBUG_DEFILE_LIB
       MessageInterface::ShowMessage
          ("DeFile::Interpolate_Libration(%.9f, %d)\n", Time, Target);
-      MessageInterface::ShowMessage("   addr T_beg=%p\n", &T_beg);
-      MessageInterface::ShowMessage("   addr T_end=%p\n", &T_end);
    #endif
   
    /*--------------------------------------------------------------------------*/
@@ -1331,16 +1565,7 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input (if so, get it).             */
    /*--------------------------------------------------------------------------*/
-   if ( Time < T_beg || Time > T_end )
-   {
-      #ifdef DEBUG_DEFILE_LIB
-         MessageInterface::ShowMessage
-            ("DeFile::Interpolate_Libration() Calling Read_Coefficients(%.9f)\n",
-             Time);
-      #endif
-     
-      Read_Coefficients(Time);
-   }
+   CoeffRecord rec = Find_Record(Time);
   
    /*--------------------------------------------------------------------------*/
    /* Read the coefficients from the binary record.                            */
@@ -1358,16 +1583,16 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
    /*--------------------------------------------------------------------------*/
    if ( G == 1 )
    {
-      Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      Tc = 2.0*(Time - rec.beg) / rec.span - 1.0;
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = rec.coeff[i];
    }
    else if ( G > 1 )
    {
-      T_sub = T_span / ((double) G);          /* Compute subgranule interval */
+      T_sub = rec.span / ((double) G);        /* Compute subgranule interval */
        
       for ( j=G ; j>0 ; j-- )
       {
-         T_break = T_beg + ((double) j-1) * T_sub;
+         T_break = rec.beg + ((double) j-1) * T_sub;
          if ( Time > T_break )
          {
             T_seg  = T_break;
@@ -1379,7 +1604,7 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = rec.coeff[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1411,7 +1636,7 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
       for ( j=N-1 ; j>-1 ; j-- )  sum[i]     = sum[i] + A[j+i*N] * Cp[j];
       for ( j=N-1 ; j>0  ; j-- )  rateSum[i] = rateSum[i] + A[j+i*N] * Up[j];
       Libration[i] = sum[i];
-      rates[i]     = rateSum[i] * 2.0 * ((double) G) / (T_span * GmatTimeConstants::SECS_PER_DAY);
+      rates[i]     = rateSum[i] * 2.0 * ((double) G) / (rec.span * GmatTimeConstants::SECS_PER_DAY);
    }
    /*--------------------------------------------------------------------------*/
    /* Compute interpolated the rates.                                          */
@@ -1432,8 +1657,6 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
    #ifdef DEBUG_DEFILE_LIB
       MessageInterface::ShowMessage
          ("DeFile::Interpolate_Libration(%.9f, %d)\n", Time, Target);
-      MessageInterface::ShowMessage("   addr T_beg=%p\n", &T_beg);
-      MessageInterface::ShowMessage("   addr T_end=%p\n", &T_end);
    #endif
   
    /*--------------------------------------------------------------------------*/
@@ -1456,16 +1679,7 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input (if so, get it).             */
    /*--------------------------------------------------------------------------*/
-   if ( Time < T_beg || Time > T_end )
-   {
-      #ifdef DEBUG_DEFILE_LIB
-         MessageInterface::ShowMessage
-            ("DeFile::Interpolate_Libration() Calling Read_Coefficients(%.9f)\n",
-             Time);
-      #endif
-     
-      Read_Coefficients(Time);
-   }
+   CoeffRecord rec = Find_Record(Time);
   
    /*--------------------------------------------------------------------------*/
    /* Read the coefficients from the binary record.                            */
@@ -1483,16 +1697,16 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
    /*--------------------------------------------------------------------------*/
    if ( G == 1 )
    {
-      Tc = 2.0*(Time - T_beg).GetMjd() / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      Tc = 2.0*(Time - rec.beg).GetMjd() / rec.span - 1.0;
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = rec.coeff[i];
    }
    else if ( G > 1 )
    {
-      T_sub = T_span / ((double) G);          /* Compute subgranule interval */
+      T_sub = rec.span / ((double) G);        /* Compute subgranule interval */
        
       for ( j=G ; j>0 ; j-- )
       {
-         T_break = T_beg + ((double) j-1) * T_sub;
+         T_break = rec.beg + ((double) j-1) * T_sub;
          if ( Time > T_break )
          {
             T_seg  = T_break;
@@ -1504,7 +1718,7 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
       Tc = 2.0*(Time - T_seg).GetMjd() / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = rec.coeff[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1536,7 +1750,7 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
       for ( j=N-1 ; j>-1 ; j-- )  sum[i]     = sum[i] + A[j+i*N] * Cp[j];
       for ( j=N-1 ; j>0  ; j-- )  rateSum[i] = rateSum[i] + A[j+i*N] * Up[j];
       Libration[i] = sum[i];
-      rates[i]     = rateSum[i] * 2.0 * ((double) G) / (T_span * GmatTimeConstants::SECS_PER_DAY);
+      rates[i]     = rateSum[i] * 2.0 * ((double) G) / (rec.span * GmatTimeConstants::SECS_PER_DAY);
    }
    /*--------------------------------------------------------------------------*/
    /* Compute interpolated the rates.                                          */
@@ -1588,7 +1802,7 @@ void DeFile::Interpolate_Nutation( double Time , int Target , double Nutation[2]
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input (if so, get it).             */
    /*--------------------------------------------------------------------------*/
-   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   CoeffRecord rec = Find_Record(Time);
 
    /*--------------------------------------------------------------------------*/
    /* Read the coefficients from the binary record.                            */
@@ -1606,16 +1820,16 @@ void DeFile::Interpolate_Nutation( double Time , int Target , double Nutation[2]
    /*--------------------------------------------------------------------------*/
    if ( G == 1 )
    {
-      Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      Tc = 2.0*(Time - rec.beg) / rec.span - 1.0;
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = rec.coeff[i];
    }
    else if ( G > 1 )
    {
-      T_sub = T_span / ((double) G);          /* Compute subgranule interval */
+      T_sub = rec.span / ((double) G);        /* Compute subgranule interval */
        
       for ( j=G ; j>0 ; j-- )
       {
-         T_break = T_beg + ((double) j-1) * T_sub;
+         T_break = rec.beg + ((double) j-1) * T_sub;
          if ( Time > T_break )
          {
             T_seg  = T_break;
@@ -1627,7 +1841,7 @@ void DeFile::Interpolate_Nutation( double Time , int Target , double Nutation[2]
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = rec.coeff[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1696,7 +1910,7 @@ void DeFile::Interpolate_Position( double Time , int Target , double Position[3]
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input (if so, get it).             */
    /*--------------------------------------------------------------------------*/
-   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   CoeffRecord rec = Find_Record(Time);
 
    /*--------------------------------------------------------------------------*/
    /* Read the coefficients from the binary record.                            */
@@ -1714,16 +1928,16 @@ void DeFile::Interpolate_Position( double Time , int Target , double Position[3]
    /*--------------------------------------------------------------------------*/
    if ( G == 1 )
    {
-      Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      Tc = 2.0*(Time - rec.beg) / rec.span - 1.0;
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = rec.coeff[i];
    }
    else if ( G > 1 )
    {
-      T_sub = T_span / ((double) G);          /* Compute subgranule interval */
+      T_sub = rec.span / ((double) G);        /* Compute subgranule interval */
        
       for ( j=G ; j>0 ; j-- )
       {
-         T_break = T_beg + ((double) j-1) * T_sub;
+         T_break = rec.beg + ((double) j-1) * T_sub;
          if ( Time > T_break )
          {
             T_seg  = T_break;
@@ -1735,7 +1949,7 @@ void DeFile::Interpolate_Position( double Time , int Target , double Position[3]
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = rec.coeff[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1808,18 +2022,12 @@ void DeFile::Interpolate_State(double Time , int Target, stateType *p)
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input.                             */
    /*--------------------------------------------------------------------------*/
-   #ifdef DEBUG_DEFILE_INTERPOLATE
-   MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State() before Read_Coefficients()\nTime=%f, T_beg=%f, "
-       "T_end=%f T_span=%f\n", Time, T_beg, T_end, T_span);
-   #endif
-  
-   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   CoeffRecord rec = Find_Record(Time);
   
    #ifdef DEBUG_DEFILE_INTERPOLATE
    MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State() after  Read_Coefficients()\nTime=%f, T_beg=%f, "
-       "T_end=%f T_span=%f\n", Time, T_beg, T_end, T_span);
+      ("DeFile::Interpolate_State() after  Find_Record()\nTime=%f, rec.beg=%f, "
+       "rec.end=%f rec.span=%f\n", Time, rec.beg, rec.end, rec.span);
    #endif
   
    /*--------------------------------------------------------------------------*/
@@ -1839,15 +2047,15 @@ void DeFile::Interpolate_State(double Time , int Target, stateType *p)
    /*--------------------------------------------------------------------------*/
    if ( G == 1 )
    {
-      Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      Tc = 2.0*(Time - rec.beg) / rec.span - 1.0;
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = rec.coeff[i];
    }
    else if ( G > 1 )
    {
-      T_sub = T_span / ((double) G);          /* Compute subgranule interval */
+      T_sub = rec.span / ((double) G);        /* Compute subgranule interval */
       for ( j=G ; j>0 ; j-- )
       {
-         T_break = T_beg + ((double) j-1) * T_sub;
+         T_break = rec.beg + ((double) j-1) * T_sub;
          if ( Time > T_break )
          {
             T_seg  = T_break;
@@ -1859,7 +2067,7 @@ void DeFile::Interpolate_State(double Time , int Target, stateType *p)
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = rec.coeff[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1901,9 +2109,9 @@ void DeFile::Interpolate_State(double Time , int Target, stateType *p)
       for ( j=N-1 ; j> 0 ; j-- )  A_Sum[i] = A_Sum[i] + A[j+i*N] * Wp[j];
 
       X.Position[i] = P_Sum[i];
-      X.Velocity[i] = V_Sum[i] * 2.0 * ((double) G) / (T_span * GmatTimeConstants::SECS_PER_DAY);
+      X.Velocity[i] = V_Sum[i] * 2.0 * ((double) G) / (rec.span * GmatTimeConstants::SECS_PER_DAY);
       // Calculate d[Tc]/dt
-      double dTcdt = 2.0 * ((double) G) / (T_span * GmatTimeConstants::SECS_PER_DAY);
+      double dTcdt = 2.0 * ((double) G) / (rec.span * GmatTimeConstants::SECS_PER_DAY);
       // Reverse to the origin code to calculate velocity in order to prevent a tiny change in result
       //X.Velocity[i] = V_Sum[i] * dTcdt;
       X.Acceleration[i] = A_Sum[i] * dTcdt * dTcdt;
@@ -1949,18 +2157,12 @@ void DeFile::Interpolate_State(GmatTime Time, int Target, stateType *p)
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input.                             */
    /*--------------------------------------------------------------------------*/
-#ifdef DEBUG_DEFILE_INTERPOLATE
-   MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State() before Read_Coefficients()\nTime=%f, T_beg=%f, "
-      "T_end=%f T_span=%f\n", Time, T_beg, T_end, T_span);
-#endif
-
-   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   CoeffRecord rec = Find_Record(Time);
 
 #ifdef DEBUG_DEFILE_INTERPOLATE
    MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State() after  Read_Coefficients()\nTime=%f, T_beg=%f, "
-      "T_end=%f T_span=%f\n", Time, T_beg, T_end, T_span);
+      ("DeFile::Interpolate_State() after  Find_Record()\nTime=%f, rec.beg=%f, "
+      "rec.end=%f rec.span=%f\n", Time, rec.beg, rec.end, rec.span);
 #endif
 
    /*--------------------------------------------------------------------------*/
@@ -1981,20 +2183,20 @@ void DeFile::Interpolate_State(GmatTime Time, int Target, stateType *p)
    Real dTc;
    if (G == 1)
    {
-      //Tc = 2.0*(Time.GetMjd() - T_beg) / T_span - 1.0;
-      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / T_span / GmatTimeConstants::SECS_PER_DAY;
+      //Tc = 2.0*(Time.GetMjd() - rec.beg) / rec.span - 1.0;
+      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / rec.span / GmatTimeConstants::SECS_PER_DAY;
       //Tc = Tc + dTc;
       
-      Tc = 2.0*(Time - T_beg).GetMjd() / T_span - 1.0;
+      Tc = 2.0*(Time - rec.beg).GetMjd() / rec.span - 1.0;
 
-      for (i = C; i<(C + 3 * N); i++)  A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++)  A[i - C] = rec.coeff[i];
    }
    else if (G > 1)
    {
-      T_sub = T_span / ((double)G);          /* Compute subgranule interval */
+      T_sub = rec.span / ((double)G);        /* Compute subgranule interval */
       for (j = G; j>0; j--)
       {
-         T_break = T_beg + ((double)j - 1) * T_sub;
+         T_break = rec.beg + ((double)j - 1) * T_sub;
          if (Time > T_break)
          {
             T_seg = T_break;
@@ -2004,13 +2206,13 @@ void DeFile::Interpolate_State(GmatTime Time, int Target, stateType *p)
       }
 
       //Tc = 2.0*(Time.GetMjd() - T_seg) / T_sub - 1.0;
-      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / T_span / GmatTimeConstants::SECS_PER_DAY;
+      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / rec.span / GmatTimeConstants::SECS_PER_DAY;
       //Tc = Tc + dTc;
 
       Tc = 2.0*(Time - T_seg).GetMjd() / T_sub - 1.0;
       C = C + 3 * offset * N;
 
-      for (i = C; i<(C + 3 * N); i++) A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++) A[i - C] = rec.coeff[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -2052,10 +2254,10 @@ void DeFile::Interpolate_State(GmatTime Time, int Target, stateType *p)
       for (j = N - 1; j>0; j--)  A_Sum[i] = A_Sum[i] + A[j + i*N] * Wp[j];
 
       X.Position[i] = P_Sum[i];
-      //X.Velocity[i] = V_Sum[i] * 2.0 * ((double)G) / (T_span * GmatTimeConstants::SECS_PER_DAY);
-      X.Velocity[i] = V_Sum[i] * 2.0 * ((double)G) / T_span / GmatTimeConstants::SECS_PER_DAY;
+      //X.Velocity[i] = V_Sum[i] * 2.0 * ((double)G) / (rec.span * GmatTimeConstants::SECS_PER_DAY);
+      X.Velocity[i] = V_Sum[i] * 2.0 * ((double)G) / rec.span / GmatTimeConstants::SECS_PER_DAY;
       // Calculate d[Tc]/dt
-      double dTcdt = 2.0 * ((double)G) / T_span / GmatTimeConstants::SECS_PER_DAY;
+      double dTcdt = 2.0 * ((double)G) / rec.span / GmatTimeConstants::SECS_PER_DAY;
       // Reverse to the origin code to calculate velocity in order to prevent a tiny change in result
       //X.Velocity[i] = V_Sum[i] * dTcdt; 
       X.Acceleration[i] = A_Sum[i] * dTcdt *dTcdt;
@@ -2117,18 +2319,12 @@ void DeFile::Interpolate_State_Delta(const GmatTime &Time, const GmatTime &Time2
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input.                             */
    /*--------------------------------------------------------------------------*/
-#ifdef DEBUG_DEFILE_INTERPOLATE
-   MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State_Delta() before Read_Coefficients()\nTime=%f, Time2=%f, T_beg=%f, "
-      "T_end=%f T_span=%f\n", Time, Time2, T_beg, T_end, T_span);
-#endif
-
-   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   CoeffRecord rec = Find_Record(Time);
 
 #ifdef DEBUG_DEFILE_INTERPOLATE
    MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State_Delta() after  Read_Coefficients()\nTime=%f, Time2=%f, T_beg=%f, "
-      "T_end=%f T_span=%f\n", Time, Time2, T_beg, T_end, T_span);
+      ("DeFile::Interpolate_State_Delta() after  Find_Record()\nTime=%f, Time2=%f, rec.beg=%f, "
+      "rec.end=%f rec.span=%f\n", Time, Time2, rec.beg, rec.end, rec.span);
 #endif
 
    /*--------------------------------------------------------------------------*/
@@ -2149,22 +2345,22 @@ void DeFile::Interpolate_State_Delta(const GmatTime &Time, const GmatTime &Time2
    Real dTc;
    if (G == 1)
    {
-      //Tc = 2.0*(Time.GetMjd() - T_beg) / T_span - 1.0;
-      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / T_span / GmatTimeConstants::SECS_PER_DAY;
+      //Tc = 2.0*(Time.GetMjd() - rec.beg) / rec.span - 1.0;
+      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / rec.span / GmatTimeConstants::SECS_PER_DAY;
       //Tc = Tc + dTc;
       
-      Tc = 2.0*(Time - T_beg).GetMjd() / T_span - 1.0;
-      Tc2 = 2.0*(Time2 - T_beg).GetMjd() / T_span - 1.0;
-      dt = 2.0*(Time2 - Time).GetMjd() / T_span;
+      Tc = 2.0*(Time - rec.beg).GetMjd() / rec.span - 1.0;
+      Tc2 = 2.0*(Time2 - rec.beg).GetMjd() / rec.span - 1.0;
+      dt = 2.0*(Time2 - Time).GetMjd() / rec.span;
 
-      for (i = C; i<(C + 3 * N); i++)  A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++)  A[i - C] = rec.coeff[i];
    }
    else if (G > 1)
    {
-      T_sub = T_span / ((double)G);          /* Compute subgranule interval */
+      T_sub = rec.span / ((double)G);        /* Compute subgranule interval */
       for (j = G; j>0; j--)
       {
-         T_break = T_beg + ((double)j - 1) * T_sub;
+         T_break = rec.beg + ((double)j - 1) * T_sub;
          if (Time > T_break)
          {
             T_seg = T_break;
@@ -2174,7 +2370,7 @@ void DeFile::Interpolate_State_Delta(const GmatTime &Time, const GmatTime &Time2
       }
 
       //Tc = 2.0*(Time.GetMjd() - T_seg) / T_sub - 1.0;
-      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / T_span / GmatTimeConstants::SECS_PER_DAY;
+      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / rec.span / GmatTimeConstants::SECS_PER_DAY;
       //Tc = Tc + dTc;
 
       Tc = 2.0*(Time - T_seg).GetMjd() / T_sub - 1.0;
@@ -2182,7 +2378,7 @@ void DeFile::Interpolate_State_Delta(const GmatTime &Time, const GmatTime &Time2
       dt = 2.0*(Time2 - Time).GetMjd() / T_sub;
       C = C + 3 * offset * N;
 
-      for (i = C; i<(C + 3 * N); i++) A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++) A[i - C] = rec.coeff[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -327,6 +327,15 @@ protected:
    typedef struct headerOne headOneType;
    typedef struct headerTwo headTwoType;
 
+   /// View of one coefficient record and the time span it covers
+   struct CoeffRecord
+   {
+      const double *coeff;
+      double       beg;
+      double       end;
+      double       span;
+   };
+
 private:
    std::string        theFileName;
    Gmat::DeFileFormat theFileFormat;
@@ -351,6 +360,12 @@ private:
    FILE               *Ephemeris_File;
    double             Coeff_Array[MAX_ARRAY_SIZE];   // MAX
    double             T_beg , T_end , T_span;
+   /// Read-only memory map of the binary file (NULL when read with fread)
+   const double       *mappedData;
+   /// Size of the memory map, in bytes
+   size_t             mappedSize;
+   /// Number of coefficient records in the memory map
+   Integer            recordCount;
    /// The base epoch for internal time calculations
    double             baseEpoch;
    double             mFileBeg;
@@ -379,6 +394,13 @@ private:
 
    void Read_Coefficients(GmatTime Time);
 
+   // Memory-mapped record access
+   bool        Map_Ephemeris(const std::string &fileName);
+   void        Unmap_Ephemeris();
+   CoeffRecord Get_Mapped_Record(Integer index, double Time);
+   CoeffRecord Find_Record(double Time);
+   CoeffRecord Find_Record(const GmatTime &Time);
+
    /*-------------------------------------------------------------------------*/
    /*  Initialize_Ephemeris      - from JPL/JSC code (Hoffman)                */
    /*-------------------------------------------------------------------------*/
@@ -328,35 +328,18 @@ void EphemSmoother::CreateSmoothedEphem(SpacePoint *refBody, SpacePoint *target,
       dydxf(ii) = cubicSpline->FiniteDifferenceAtEdge(timesFDEnd, vecEnd, "right");
    }
    
-   // Make sure the a, b, c, d matrices are the correct size
-   (newED->a).SetSize(nRegions,nStates);
-   (newED->b).SetSize(nRegions,nStates);
-   (newED->c).SetSize(nRegions,nStates);
-   (newED->d).SetSize(nRegions,nStates);
-   // once we have all the data, loop through the states to spline
-   Rvector theState(nKnots);
+   // once we have all the data, spline all of the states together; the knots
+   // are shared, so the spline system is factored only once
+   Rmatrix knotStates(nKnots, nStates);
+   for (Integer jj = 0; jj < nKnots; jj++)
+      for (Integer ii = 0; ii < nStates; ii++)
+         knotStates(jj, ii) = states.at(jj)(ii);
    Rvector times(newED->theTimes);// convert RealArray to Rvector
-   for (Integer ii = 0; ii < nStates; ii++)
-   {
-      // Need column vector
-      for (Integer jj = 0; jj < nKnots; jj++)
-      {
-         theState(jj) = states.at(jj)(ii);
-      }
-      Rvector a1, b1, c1, d1;
-      cubicSpline->CalculateClampedCubicSplineCoefficients(times, theState,
-                                                           dydx0(ii), dydxf(ii),
-                                                           a1, b1, c1, d1); // returned
-      // put output into the a, b, c, d matrices; these column vectors should
-      // be of size nRegions
-      for (Integer kk = 0; kk < nRegions; kk++)
-      {
-         (newED->a)(kk, ii) = a1(kk);
-         (newED->b)(kk, ii) = b1(kk);
-         (newED->c)(kk, ii) = c1(kk);
-         (newED->d)(kk, ii) = d1(kk);
-      }
-   }
+   // fills the a, b, c, d matrices, with nRegions rows and nStates columns
+   cubicSpline->CalculateClampedCubicSplineCoefficients(times, knotStates,
+                                                        dydx0, dydxf,
+                                                        newED->a, newED->b,
+                                                        newED->c, newED->d);
    
    // clean up
    states.clear();
@@ -0,0 +1,224 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                EphemerisMemo
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the EphemerisMemo class.
+ */
+//------------------------------------------------------------------------------
+
+#include "EphemerisMemo.hpp"
+
+
+//------------------------------------------------------------------------------
+// EphemerisMemo()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+EphemerisMemo::EphemerisMemo() :
+   count    (0),
+   next     (0),
+   hits     (0),
+   misses   (0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~EphemerisMemo()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+EphemerisMemo::~EphemerisMemo()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// bool Find(Real epoch, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Looks up the state at an A.1 MJD epoch.
+ *
+ * @param epoch The epoch
+ * @param state The remembered state, if found
+ *
+ * @return true if the state was found
+ */
+//------------------------------------------------------------------------------
+bool EphemerisMemo::Find(Real epoch, Real *state)
+{
+   std::lock_guard<std::mutex> lock(access);
+   for (Integer i = 0; i < count; ++i)
+   {
+      const Entry &entry = entries[i];
+      if (!entry.isGmatTime && (entry.epoch == epoch))
+      {
+         for (Integer j = 0; j < 6; ++j)
+            state[j] = entry.state[j];
+         ++hits;
+         return true;
+      }
+   }
+   ++misses;
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Find(const GmatTime &epoch, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Looks up the state at a GmatTime epoch.
+ *
+ * @param epoch The epoch
+ * @param state The remembered state, if found
+ *
+ * @return true if the state was found
+ */
+//------------------------------------------------------------------------------
+bool EphemerisMemo::Find(const GmatTime &epoch, Real *state)
+{
+   std::lock_guard<std::mutex> lock(access);
+   for (Integer i = 0; i < count; ++i)
+   {
+      const Entry &entry = entries[i];
+      if (entry.isGmatTime && (entry.epochGT == epoch))
+      {
+         for (Integer j = 0; j < 6; ++j)
+            state[j] = entry.state[j];
+         ++hits;
+         return true;
+      }
+   }
+   ++misses;
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void Store(Real epoch, const Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Remembers the state at an A.1 MJD epoch, replacing the oldest entry.
+ *
+ * @param epoch The epoch
+ * @param state The state
+ */
+//------------------------------------------------------------------------------
+void EphemerisMemo::Store(Real epoch, const Real *state)
+{
+   std::lock_guard<std::mutex> lock(access);
+   Entry &entry = NextEntry();
+   entry.isGmatTime = false;
+   entry.epoch = epoch;
+   for (Integer j = 0; j < 6; ++j)
+      entry.state[j] = state[j];
+}
+
+
+//------------------------------------------------------------------------------
+// void Store(const GmatTime &epoch, const Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Remembers the state at a GmatTime epoch, replacing the oldest entry.
+ *
+ * @param epoch The epoch
+ * @param state The state
+ */
+//------------------------------------------------------------------------------
+void EphemerisMemo::Store(const GmatTime &epoch, const Real *state)
+{
+   std::lock_guard<std::mutex> lock(access);
+   Entry &entry = NextEntry();
+   entry.isGmatTime = true;
+   entry.epochGT = epoch;
+   for (Integer j = 0; j < 6; ++j)
+      entry.state[j] = state[j];
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Forgets the remembered states.  The counts are kept.
+ */
+//------------------------------------------------------------------------------
+void EphemerisMemo::Clear()
+{
+   std::lock_guard<std::mutex> lock(access);
+   count = 0;
+   next  = 0;
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetHitCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of lookups that found their epoch.
+ *
+ * @return The hit count
+ */
+//------------------------------------------------------------------------------
+UnsignedInt EphemerisMemo::GetHitCount() const
+{
+   std::lock_guard<std::mutex> lock(access);
+   return hits;
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetMissCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of lookups that did not find their epoch.
+ *
+ * @return The miss count
+ */
+//------------------------------------------------------------------------------
+UnsignedInt EphemerisMemo::GetMissCount() const
+{
+   std::lock_guard<std::mutex> lock(access);
+   return misses;
+}
+
+
+//------------------------------------------------------------------------------
+// Entry& NextEntry()
+//------------------------------------------------------------------------------
+/**
+ * Returns the entry to fill for a new state; the caller holds the lock.
+ *
+ * @return The entry
+ */
+//------------------------------------------------------------------------------
+EphemerisMemo::Entry& EphemerisMemo::NextEntry()
+{
+   Entry &entry = entries[next];
+   next = (next + 1) % CAPACITY;
+   if (count < CAPACITY)
+      ++count;
+   return entry;
+}
@@ -0,0 +1,105 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                EphemerisMemo
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the EphemerisMemo class, the memo of the recent ephemeris
+ * states of a celestial body.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef EphemerisMemo_hpp
+#define EphemerisMemo_hpp
+
+#include "gmatdefs.hpp"
+#include "GmatTime.hpp"
+#include <mutex>
+
+/**
+ * Memo of the last few ephemeris states of a body, keyed by epoch
+ *
+ * A propagation asks for the same body states many times: every force at an
+ * integrator stage, every spacecraft propagated to the same stage epoch, and
+ * the bisection of a stopping condition that steps back and forth between a
+ * few epochs.  A single remembered state is evicted as soon as two of these
+ * sequences interleave, so the memo keeps CAPACITY entries, replaced oldest
+ * first.  An entry matches only the exact epoch; states at A.1 modified Julian
+ * epochs and at GmatTime epochs are kept apart because the ephemeris files
+ * compute them at different precision.
+ *
+ * The memo is shared by a body and its clones (for example the solar systems
+ * of the sandboxes) as long as they read the same ephemeris, so the accesses
+ * are serialized.  The hit and miss counts cover all of the sharing bodies.
+ */
+class GMAT_API EphemerisMemo
+{
+public:
+   EphemerisMemo();
+   virtual ~EphemerisMemo();
+
+   bool           Find(Real epoch, Real *state);
+   bool           Find(const GmatTime &epoch, Real *state);
+   void           Store(Real epoch, const Real *state);
+   void           Store(const GmatTime &epoch, const Real *state);
+   void           Clear();
+
+   UnsignedInt    GetHitCount() const;
+   UnsignedInt    GetMissCount() const;
+
+   /// Number of states kept
+   static const Integer CAPACITY = 8;
+
+protected:
+   /// One remembered state
+   struct Entry
+   {
+      /// true for GmatTime epochs, false for A.1 MJD epochs
+      bool        isGmatTime;
+      /// The A.1 MJD epoch
+      Real        epoch;
+      /// The GmatTime epoch
+      GmatTime    epochGT;
+      /// The state at the epoch
+      Real        state[6];
+   };
+
+   /// The entries
+   Entry          entries[CAPACITY];
+   /// Number of entries used
+   Integer        count;
+   /// Entry replaced by the next store
+   Integer        next;
+   /// Number of lookups that found their epoch
+   UnsignedInt    hits;
+   /// Number of lookups that did not find their epoch
+   UnsignedInt    misses;
+   /// Serializes the accesses from the sharing bodies
+   mutable std::mutex
+                  access;
+
+   Entry&         NextEntry();
+
+private:
+   // copy constructor - NOT IMPLEMENTED
+   EphemerisMemo(const EphemerisMemo &memo);
+   // operator = - NOT IMPLEMENTED
+   const EphemerisMemo& operator=(const EphemerisMemo &memo);
+};
+
+#endif // EphemerisMemo_hpp
@@ -299,6 +299,24 @@ bool ExponentialAtmosphere::Density(Real *position, Real *density, Real epoch,
 }
 
 
+//------------------------------------------------------------------------------
+// bool HasEpochDependentDensity()
+//------------------------------------------------------------------------------
+/**
+ * Checks to see if the density at a fixed position changes with epoch.
+ *
+ * The density is a function of the altitude alone, which only changes with
+ * epoch through the slow motion of the body's pole.
+ *
+ * @return false
+ */
+//------------------------------------------------------------------------------
+bool ExponentialAtmosphere::HasEpochDependentDensity()
+{
+   return false;
+}
+
+
 //------------------------------------------------------------------------------
 // void SetConstants()
 //------------------------------------------------------------------------------
@@ -496,7 +496,12 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
       fluxReader->SetSchattenFlags(schattenTimingModel, schattenErrorModel);
    }
 
-   if (fluxReaderLoaded && a1_time > 0.0)
+   if (a1_time == inputsEpoch)
+   {
+      // The temperature and Kp were set for this epoch by an earlier call,
+      // usually for another spacecraft
+   }
+   else if (fluxReaderLoaded && a1_time > 0.0)
    {
       SolarFluxReader::FluxData fD;
 
@@ -551,6 +556,7 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
       geo.xtemp = 379.0 + 3.24 * nominalF107a + 1.3 * (nominalF107 - nominalF107a);
       geo.tkp   = nominalKp;
    }
+   inputsEpoch = a1_time;
 
    #ifdef DUMP_FLUX_DATA
       MessageInterface::ShowMessage("%.12lf  %lf  %lf  [%lf]\n",
@@ -91,7 +91,10 @@ primaryBodyName     (""),
 secondaryBodyName   (""),
 whichPoint          (""),
 primaryBody         (NULL),
-secondaryBody       (NULL)
+secondaryBody       (NULL),
+gammaPoint          (""),
+gammaMuStar         (0.0),
+lastGamma           (0.0)
 {
    objectTypes.push_back(Gmat::LIBRATION_POINT);
    objectTypeNames.push_back("LibrationPoint");
@@ -117,7 +120,10 @@ primaryBodyName          (lp.primaryBodyName),
 secondaryBodyName        (lp.secondaryBodyName),
 whichPoint               (lp.whichPoint),
 primaryBody              (lp.primaryBody),   // (lp.primaryBody)
-secondaryBody            (lp.secondaryBody)    // (lp.secondaryBody)
+secondaryBody            (lp.secondaryBody),   // (lp.secondaryBody)
+gammaPoint               (lp.gammaPoint),
+gammaMuStar              (lp.gammaMuStar),
+lastGamma                (lp.lastGamma)
 {
    bodyList = lp.bodyList;
 }
@@ -145,6 +151,9 @@ LibrationPoint& LibrationPoint::operator=(const LibrationPoint &lp)
    whichPoint          = lp.whichPoint;
    primaryBody         = lp.primaryBody;
    secondaryBody       = lp.secondaryBody;
+   gammaPoint          = lp.gammaPoint;
+   gammaMuStar         = lp.gammaMuStar;
+   lastGamma           = lp.lastGamma;
    return *this;
 }
 
@@ -181,6 +190,10 @@ const Rvector6 LibrationPoint::GetMJ2000State(const A1Mjd &atTime)
        secondaryBody, secondaryBody->GetName().c_str());
    #endif
    
+   // the forces, axes and parameters of a step all ask for the same epoch
+   if (FindMemoState(atTime))
+      return lastState;
+
    CheckBodies();
    // Compute position and velocity from primary to secondary
    Rvector6 primaryState   = primaryBody->GetMJ2000State(atTime);
@@ -228,63 +241,8 @@ const Rvector6 LibrationPoint::GetMJ2000State(const A1Mjd &atTime)
       ("   Mass of the secondary is %f\n", massSecondary);
    #endif
    
-   Real gamma  = 0.0;
-   Real gamma2 = 0.0, gamma3 = 0.0, gamma4 = 0.0, gamma5 = 0.0, gammaPrev = 0.0;
-   Real F = 0.0, Fdot = 0.0;
-   if ((whichPoint == "L1") || (whichPoint == "L2") ||
-       (whichPoint == "L3"))
-   {
-      // Determine initial gamma
-      if (whichPoint == "L3")  gamma = 1.0;
-      else  gamma = GmatMathUtil::Pow((muStar / (3.0 * (1.0 - muStar))),
-                                      (1.0 / 3.0));
-      
+   Real gamma = ComputeGamma(muStar);
 
-      Integer counter = 0;
-      Real diff       = 999.99;
-      while (diff > CONVERGENCE_TOLERANCE)
-      {
-         if (counter > MAX_ITERATIONS)
-            throw SolarSystemException(
-                  "Libration point \"" + GetName() + "\" gamma not converging.");
-         gamma2 = gamma  * gamma;
-         gamma3 = gamma2 * gamma;
-         gamma4 = gamma3 * gamma;
-         gamma5 = gamma4 * gamma;
-         if (whichPoint == "L1")
-         {
-            F    = gamma5 - ((3.0 - muStar) * gamma4) +
-                   ((3.0 - 2.0 * muStar) * gamma3) -
-                   (muStar * gamma2) + (2.0 * muStar * gamma) - muStar;
-            Fdot = (5.0 * gamma4) - (4.0 * (3.0 - muStar) * gamma3) + 
-                   (3.0 * (3.0 - 2.0 * muStar) * gamma2) - 
-                   (2.0 * muStar * gamma) + (2.0 * muStar);
-         }
-         else if (whichPoint == "L2")
-         {
-            F    = gamma5 + ((3.0 - muStar) * gamma4) +
-                   ((3.0 - 2.0 * muStar) * gamma3) -
-                   (muStar * gamma2) - (2.0 * muStar * gamma) - muStar;
-            Fdot = (5.0 * gamma4) + (4.0 * (3.0 - muStar) * gamma3) + 
-                   (3.0 * (3.0 - 2.0 * muStar) * gamma2) - (2.0 * muStar * gamma) -
-                   (2.0 * muStar);
-         }
-         else  // whichPoint == "L3"
-         {
-            F    = gamma5 + ((2.0 + muStar) * gamma4) +
-                   ((1.0 + 2.0 * muStar) * gamma3) -
-                   ((1.0 - muStar) * gamma2) - (2.0 * (1.0 - muStar) * gamma) -
-                   (1.0 - muStar);
-            Fdot = (5.0 * gamma4) + (4.0 * (2.0 +  muStar) * gamma3) + 
-                   (3.0 * (1.0 +  2.0 * muStar) * gamma2) -
-                   (2.0 * (1.0 - muStar) * gamma) - (2.0 * (1.0 - muStar));
-         }
-         counter++;
-         gammaPrev = gamma;
-         gamma     = gammaPrev - (F / Fdot);
-         diff      = GmatMathUtil::Abs(gamma - gammaPrev);
-      }
-   }
    Real x = 0.0;
    Real y = 0.0;
    if (whichPoint == "L1") 
@@ -370,7 +328,7 @@ const Rvector6 LibrationPoint::GetMJ2000State(const A1Mjd &atTime)
    // Translate so that the origin is at the j2000Body
    Rvector6 rvResult = rvFK5 + primaryState;
    lastState         = rvResult;
-   lastStateTime     = atTime;
+   MemoizeState(atTime);
    #ifdef DEBUG_GET_STATE
    MessageInterface::ShowMessage
       ("LibrationPoint::GetMJ2000State() returning\n   %s\n",
@@ -390,6 +348,9 @@ const Rvector6 LibrationPoint::GetMJ2000State(const GmatTime &atTime)
       secondaryBody, secondaryBody->GetName().c_str());
 #endif
 
+   if (FindMemoState(atTime))
+      return lastState;
+
    CheckBodies();
    // Compute position and velocity from primary to secondary
    Rvector6 primaryState = primaryBody->GetMJ2000State(atTime);
@@ -437,63 +398,8 @@ const Rvector6 LibrationPoint::GetMJ2000State(const GmatTime &atTime)
       ("   Mass of the secondary is %f\n", massSecondary);
 #endif
 
-   Real gamma = 0.0;
-   Real gamma2 = 0.0, gamma3 = 0.0, gamma4 = 0.0, gamma5 = 0.0, gammaPrev = 0.0;
-   Real F = 0.0, Fdot = 0.0;
-   if ((whichPoint == "L1") || (whichPoint == "L2") ||
-      (whichPoint == "L3"))
-   {
-      // Determine initial gamma
-      if (whichPoint == "L3")  gamma = 1.0;
-      else  gamma = GmatMathUtil::Pow((muStar / (3.0 * (1.0 - muStar))),
-         (1.0 / 3.0));
-
+   Real gamma = ComputeGamma(muStar);
 
-      Integer counter = 0;
-      Real diff = 999.99;
-      while (diff > CONVERGENCE_TOLERANCE)
-      {
-         if (counter > MAX_ITERATIONS)
-            throw SolarSystemException(
-            "Libration point \"" + GetName() + "\" gamma not converging.");
-         gamma2 = gamma  * gamma;
-         gamma3 = gamma2 * gamma;
-         gamma4 = gamma3 * gamma;
-         gamma5 = gamma4 * gamma;
-         if (whichPoint == "L1")
-         {
-            F = gamma5 - ((3.0 - muStar) * gamma4) +
-               ((3.0 - 2.0 * muStar) * gamma3) -
-               (muStar * gamma2) + (2.0 * muStar * gamma) - muStar;
-            Fdot = (5.0 * gamma4) - (4.0 * (3.0 - muStar) * gamma3) +
-               (3.0 * (3.0 - 2.0 * muStar) * gamma2) -
-               (2.0 * muStar * gamma) + (2.0 * muStar);
-         }
-         else if (whichPoint == "L2")
-         {
-            F = gamma5 + ((3.0 - muStar) * gamma4) +
-               ((3.0 - 2.0 * muStar) * gamma3) -
-               (muStar * gamma2) - (2.0 * muStar * gamma) - muStar;
-            Fdot = (5.0 * gamma4) + (4.0 * (3.0 - muStar) * gamma3) +
-               (3.0 * (3.0 - 2.0 * muStar) * gamma2) - (2.0 * muStar * gamma) -
-               (2.0 * muStar);
-         }
-         else  // whichPoint == "L3"
-         {
-            F = gamma5 + ((2.0 + muStar) * gamma4) +
-               ((1.0 + 2.0 * muStar) * gamma3) -
-               ((1.0 - muStar) * gamma2) - (2.0 * (1.0 - muStar) * gamma) -
-               (1.0 - muStar);
-            Fdot = (5.0 * gamma4) + (4.0 * (2.0 + muStar) * gamma3) +
-               (3.0 * (1.0 + 2.0 * muStar) * gamma2) -
-               (2.0 * (1.0 - muStar) * gamma) - (2.0 * (1.0 - muStar));
-         }
-         counter++;
-         gammaPrev = gamma;
-         gamma = gammaPrev - (F / Fdot);
-         diff = GmatMathUtil::Abs(gamma - gammaPrev);
-      }
-   }
    Real x = 0.0;
    Real y = 0.0;
    if (whichPoint == "L1")
@@ -579,8 +485,7 @@ const Rvector6 LibrationPoint::GetMJ2000State(const GmatTime &atTime)
    // Translate so that the origin is at the j2000Body
    Rvector6 rvResult = rvFK5 + primaryState;
    lastState = rvResult;
-   lastStateTimeGT = atTime;
-   lastStateTime   = GmatTime(atTime).GetMjd();
+   MemoizeState(atTime);
 
 #ifdef DEBUG_GET_STATE
    MessageInterface::ShowMessage
@@ -591,6 +496,92 @@ const Rvector6 LibrationPoint::GetMJ2000State(const GmatTime &atTime)
 }
 
 
+//---------------------------------------------------------------------------
+//  Real ComputeGamma(Real muStar)
+//---------------------------------------------------------------------------
+/**
+ * Solves the quintic for the distance ratio gamma of a collinear point.
+ *
+ * The mass ratio of the primary and secondary does not change during a run,
+ * so the last solution is returned directly when the point and mass ratio are
+ * unchanged.  When only the mass ratio changed, Newton's method starts from
+ * the last solution, which is much closer than the Hill sphere estimate.
+ *
+ * @param <muStar> Mass ratio of the secondary to the primary plus secondary.
+ *
+ * @return gamma for L1, L2 and L3, 0.0 for the triangular points.
+ */
+//---------------------------------------------------------------------------
+Real LibrationPoint::ComputeGamma(Real muStar)
+{
+   if ((whichPoint != "L1") && (whichPoint != "L2") && (whichPoint != "L3"))
+      return 0.0;
+
+   if ((whichPoint == gammaPoint) && (muStar == gammaMuStar))
+      return lastGamma;
+
+   Real gamma  = 0.0;
+   Real gamma2 = 0.0, gamma3 = 0.0, gamma4 = 0.0, gamma5 = 0.0, gammaPrev = 0.0;
+   Real F = 0.0, Fdot = 0.0;
+
+   // Determine initial gamma
+   if (whichPoint == gammaPoint)  gamma = lastGamma;
+   else if (whichPoint == "L3")   gamma = 1.0;
+   else  gamma = GmatMathUtil::Pow((muStar / (3.0 * (1.0 - muStar))),
+                                   (1.0 / 3.0));
+
+   Integer counter = 0;
+   Real diff       = 999.99;
+   while (diff > CONVERGENCE_TOLERANCE)
+   {
+      if (counter > MAX_ITERATIONS)
+         throw SolarSystemException(
+               "Libration point \"" + GetName() + "\" gamma not converging.");
+      gamma2 = gamma  * gamma;
+      gamma3 = gamma2 * gamma;
+      gamma4 = gamma3 * gamma;
+      gamma5 = gamma4 * gamma;
+      if (whichPoint == "L1")
+      {
+         F    = gamma5 - ((3.0 - muStar) * gamma4) +
+                ((3.0 - 2.0 * muStar) * gamma3) -
+                (muStar * gamma2) + (2.0 * muStar * gamma) - muStar;
+         Fdot = (5.0 * gamma4) - (4.0 * (3.0 - muStar) * gamma3) + 
+                (3.0 * (3.0 - 2.0 * muStar) * gamma2) - 
+                (2.0 * muStar * gamma) + (2.0 * muStar);
+      }
+      else if (whichPoint == "L2")
+      {
+         F    = gamma5 + ((3.0 - muStar) * gamma4) +
+                ((3.0 - 2.0 * muStar) * gamma3) -
+                (muStar * gamma2) - (2.0 * muStar * gamma) - muStar;
+         Fdot = (5.0 * gamma4) + (4.0 * (3.0 - muStar) * gamma3) + 
+                (3.0 * (3.0 - 2.0 * muStar) * gamma2) - (2.0 * muStar * gamma) -
+                (2.0 * muStar);
+      }
+      else  // whichPoint == "L3"
+      {
+         F    = gamma5 + ((2.0 + muStar) * gamma4) +
+                ((1.0 + 2.0 * muStar) * gamma3) -
+                ((1.0 - muStar) * gamma2) - (2.0 * (1.0 - muStar) * gamma) -
+                (1.0 - muStar);
+         Fdot = (5.0 * gamma4) + (4.0 * (2.0 +  muStar) * gamma3) + 
+                (3.0 * (1.0 +  2.0 * muStar) * gamma2) -
+                (2.0 * (1.0 - muStar) * gamma) - (2.0 * (1.0 - muStar));
+      }
+      counter++;
+      gammaPrev = gamma;
+      gamma     = gammaPrev - (F / Fdot);
+      diff      = GmatMathUtil::Abs(gamma - gammaPrev);
+   }
+
+   gammaPoint  = whichPoint;
+   gammaMuStar = muStar;
+   lastGamma   = gamma;
+   return gamma;
+}
+
+
 //---------------------------------------------------------------------------
 //  const Rvector3 GetMJ2000Position(const A1Mjd &atTime)
 //---------------------------------------------------------------------------
@@ -690,11 +681,12 @@ std::string LibrationPoint::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer     LibrationPoint::GetParameterID(const std::string &str) const
 {
-   for (Integer i = CalculatedPointParamCount; i < LibrationPointParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CalculatedPointParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, CalculatedPointParamCount,
+               LibrationPointParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return CalculatedPoint::GetParameterID(str);
 }
@@ -833,6 +825,7 @@ bool LibrationPoint::SetStringParameter(const Integer id,
       // to see if primary and secondary bodies are the same
       primaryBodyName = value;
       ValidateBodyName(value, false);
+      ClearStateMemo();
       return true;
    }
    if (id == SECONDARY_BODY_NAME)             
@@ -841,6 +834,7 @@ bool LibrationPoint::SetStringParameter(const Integer id,
       // to see if primary and secondary bodies are the same
       secondaryBodyName = value;
       ValidateBodyName(value, false);
+      ClearStateMemo();
       return true;
    }
    if (id == WHICH_POINT)             
@@ -852,6 +846,7 @@ bool LibrationPoint::SetStringParameter(const Integer id,
             " on object \"" + instanceName + "\" is not an allowed value.\n"
             "The allowed values are: [ L1, L2, L3, L4, L5 ]. ");
       whichPoint = value;
+      ClearStateMemo();
       return true;
    }
    
@@ -1022,6 +1017,7 @@ bool LibrationPoint::SetRefObject(GmatBase *obj,
          primaryBody = (SpacePoint*)obj;
       else if (name == secondaryBodyName)
          secondaryBody = (SpacePoint*)obj;
+      ClearStateMemo();
    }
    #ifdef DEBUG_LP_OBJECT
    MessageInterface::ShowMessage
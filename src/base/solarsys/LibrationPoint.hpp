@@ -134,6 +134,15 @@ protected:
    
    SpacePoint  *primaryBody;
    SpacePoint  *secondaryBody;
+
+   /// Point whose gamma was solved last
+   std::string gammaPoint;
+   /// Mass ratio used for the last gamma
+   Real        gammaMuStar;
+   /// Last solved distance ratio of a collinear point from the nearer body
+   Real        lastGamma;
+
+   Real        ComputeGamma(Real muStar);
    
 private:
    
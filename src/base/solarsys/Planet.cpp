@@ -61,6 +61,7 @@ Planet::PARAMETER_TEXT[PlanetParamCount - CelestialBodyParamCount] =
 {
    "NutationUpdateInterval",
    "EopFileName",
+   "UseOrientationCache",
 };
 
 const Gmat::ParameterType
@@ -68,6 +69,7 @@ Planet::PARAMETER_TYPE[PlanetParamCount - CelestialBodyParamCount] =
 {
    Gmat::REAL_TYPE,
    Gmat::STRING_TYPE,
+   Gmat::BOOLEAN_TYPE,
 };
 
 
@@ -88,7 +90,8 @@ Planet::PARAMETER_TYPE[PlanetParamCount - CelestialBodyParamCount] =
 Planet::Planet(std::string name) :
    CelestialBody     ("Planet",name),
    nutationUpdateInterval    (60.0),
-   eopFileName               ("")
+   eopFileName               (""),
+   useOrientationCache       (false)
 {   
    // @todo This constructor should call the other one, setting Sun as central body!!!
    #ifdef DEBUG_PLANET_CONSTRUCT
@@ -148,7 +151,8 @@ Planet::Planet(std::string name) :
 Planet::Planet(std::string name, const std::string &cBody) :
    CelestialBody     ("Planet",name),
    nutationUpdateInterval    (60.0),
-   eopFileName               ("")
+   eopFileName               (""),
+   useOrientationCache       (false)
 {
 #ifdef DEBUG_PLANET_CONSTRUCT
    MessageInterface::ShowMessage("In Planet constructor for %s, with central body %s\n",
@@ -203,6 +207,7 @@ Planet::Planet(const Planet &pl) :
    CelestialBody  (pl),
    nutationUpdateInterval         (pl.nutationUpdateInterval),
    eopFileName                    (pl.eopFileName),
+   useOrientationCache            (pl.useOrientationCache),
    default_nutationUpdateInterval (pl.default_nutationUpdateInterval)
 {
 }
@@ -229,6 +234,7 @@ Planet& Planet::operator=(const Planet &pl)
    default_nutationUpdateInterval  = pl.default_nutationUpdateInterval;
    
    eopFileName                     = pl.eopFileName;
+   useOrientationCache             = pl.useOrientationCache;
    
    return *this;
 }
@@ -491,6 +497,27 @@ bool Planet::SetNutationUpdateInterval(Real val)
    return true;
 }
 
+//------------------------------------------------------------------------------
+//  bool GetUseOrientationCache() const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the flag that selects the EarthOrientationCache.
+ *
+ * When it is set, the axis systems interpolate the FK5 nutation angles and
+ * the IAU-2000/2006 X, Y and s values from the cache instead of evaluating
+ * the series and the data file at each nutation update.  The interpolated
+ * values differ from the direct ones in the last digits, so the cache is
+ * used only when it is asked for.
+ *
+ * @return true if the cache is used
+ *
+ */
+//------------------------------------------------------------------------------
+bool Planet::GetUseOrientationCache() const
+{
+   return useOrientationCache;
+}
+
 //------------------------------------------------------------------------------
 //  GmatBase* Clone() const
 //------------------------------------------------------------------------------
@@ -587,11 +614,12 @@ std::string Planet::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Planet::GetParameterID(const std::string &str) const
 {
-   for (Integer i = CelestialBodyParamCount; i < PlanetParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CelestialBodyParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, CelestialBodyParamCount,
+               PlanetParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return CelestialBody::GetParameterID(str);
 }
@@ -659,6 +687,11 @@ bool Planet::IsParameterReadOnly(const Integer id) const
       if (instanceName == GmatSolarSystemDefaults::EARTH_NAME) return false;
       else                                         return true;
    }
+   if (id == USE_ORIENTATION_CACHE)
+   {
+      if (instanceName == GmatSolarSystemDefaults::EARTH_NAME) return false;
+      else                                         return true;
+   }
    return CelestialBody::IsParameterReadOnly(id);
 }
 
@@ -838,6 +871,52 @@ Integer Planet::SetIntegerParameter(const Integer id,
 
 }
 
+//------------------------------------------------------------------------------
+//  bool  GetBooleanParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the bool parameter value, given the input
+ * parameter ID.
+ *
+ * @param <id> ID for the requested parameter.
+ *
+ * @return  bool value of the requested parameter.
+ *
+ */
+//------------------------------------------------------------------------------
+bool Planet::GetBooleanParameter(const Integer id) const
+{
+   if (id == USE_ORIENTATION_CACHE) return useOrientationCache;
+   return CelestialBody::GetBooleanParameter(id);
+}
+
+//------------------------------------------------------------------------------
+//  bool  SetBooleanParameter(const Integer id, const bool value)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the bool parameter value, given the input
+ * parameter ID.
+ *
+ * @param <id>    ID for the requested parameter.
+ * @param <value> bool value for the requested parameter.
+ *
+ * @return  bool value of the requested parameter.
+ *
+ */
+//------------------------------------------------------------------------------
+bool Planet::SetBooleanParameter(const Integer id, const bool value)
+{
+   if (id == USE_ORIENTATION_CACHE)
+   {
+      if (instanceName == GmatSolarSystemDefaults::EARTH_NAME)
+      {
+         useOrientationCache = value;
+         return useOrientationCache;
+      }
+   }
+   return CelestialBody::SetBooleanParameter(id, value);
+}
+
 
 
 //---------------------------------------------------------------------------
@@ -890,6 +969,8 @@ bool Planet::IsParameterEqualToDefault(const Integer id) const
       if (eopFileName == "")  return true;
       else                   return false;
    }
+   if (id == USE_ORIENTATION_CACHE)
+      return !useOrientationCache;
 
    return CelestialBody::IsParameterEqualToDefault(id);
 }
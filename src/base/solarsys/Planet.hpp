@@ -88,6 +88,7 @@ public:
    
    virtual Real          GetNutationUpdateInterval() const;
    virtual bool          SetNutationUpdateInterval(Real val);
+   virtual bool          GetUseOrientationCache() const;
 
    // inherited from GmatBase
    virtual GmatBase* Clone() const;
@@ -113,6 +114,9 @@ public:
                                               const std::string &value); 
    virtual Integer         SetIntegerParameter(const Integer id,
                                                const Integer value);
+   virtual bool            GetBooleanParameter(const Integer id) const;
+   virtual bool            SetBooleanParameter(const Integer id,
+                                               const bool value);
 
    virtual bool         IsParameterCloaked(const Integer id) const;
    virtual bool         IsParameterEqualToDefault(const Integer id) const;
@@ -125,6 +129,7 @@ protected:
    {
       NUTATION_UPDATE_INTERVAL = CelestialBodyParamCount,  // Earth only
       EOP_FILE_NAME,                                       // Earth only
+      USE_ORIENTATION_CACHE,                               // Earth only
       PlanetParamCount
    };
    
@@ -134,6 +139,8 @@ protected:
    
    Real        nutationUpdateInterval;
    std::string eopFileName;
+   /// Interpolate the nutation and X, Y, s terms from EarthOrientationCache
+   bool        useOrientationCache;
 
    /// default values for the parameter(s)
    Real        default_nutationUpdateInterval;
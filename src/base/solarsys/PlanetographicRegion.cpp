@@ -926,11 +926,12 @@ std::string PlanetographicRegion::GetParameterText(const Integer id) const
  //------------------------------------------------------------------------------
 Integer PlanetographicRegion::GetParameterID(const std::string &str) const
 {
-   for (int i = BodyFixedPointParamCount; i < PlanetographicRegionParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - BodyFixedPointParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, BodyFixedPointParamCount,
+               PlanetographicRegionParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    return BodyFixedPoint::GetParameterID(str);
 }
 
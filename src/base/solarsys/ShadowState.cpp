@@ -33,6 +33,7 @@
 #include "SolarSystemException.hpp"
 #include "RealUtilities.hpp"
 #include "MessageInterface.hpp"
+#include <algorithm>
 
 //#define DEBUG_SHADOW_STATE
 //#define DEBUG_SHADOW_STATE1
@@ -40,12 +41,6 @@
 //#define DEBUG_SHADOW_STATE_SUN_VECTOR
 //#define DEBUG_SHADOW_STATE_2
 
-
-//------------------------------------------------------------------------------
-// static data
-//------------------------------------------------------------------------------
-// none at this time
-
 //------------------------------------------------------------------------------
 // public methods
 //------------------------------------------------------------------------------
@@ -55,7 +50,9 @@
 //------------------------------------------------------------------------------
 ShadowState::ShadowState() :
    solarSystem  (NULL),
-   sun          (NULL)//,
+   sun          (NULL),
+   memoCount    (0),
+   memoNext     (0)
 {
 }
 
@@ -64,7 +61,9 @@ ShadowState::ShadowState() :
 //------------------------------------------------------------------------------
 ShadowState::ShadowState(const ShadowState &copy) :
    solarSystem  (NULL),
-   sun          (NULL)//,
+   sun          (NULL),
+   memoCount    (0),
+   memoNext     (0)
 {
 }
 
@@ -77,6 +76,8 @@ ShadowState& ShadowState::operator=(const ShadowState &copy)
    {
       solarSystem  = NULL;
       sun          = NULL;
+      memoCount    = 0;
+      memoNext     = 0;
    }
 
    return *this;
@@ -162,6 +163,199 @@ Real ShadowState::FindShadowState(bool &lit, bool &dark,
    }
    else
    {
+      percentSun = FindShadowedState(lit, dark, state, sunSat, sunRad, bodyRad,
+            apparentSunRadius, apparentBodyRadius, apparentDistFromSunToBody);
+   }
+   return percentSun;
+}
+
+//------------------------------------------------------------------------------
+// void FindShadowStates(Integer satCount, const Real *satPositions,
+//                       Integer satStride, Integer bodyCount,
+//                       const Real *bodyPositions, const Real *bodyRadii,
+//                       const Real *sunPosition, Real sunRad,
+//                       Lighting *lighting)
+//------------------------------------------------------------------------------
+/**
+ * Determines the lighting of several spacecraft past several shadow bodies
+ *
+ * This is the DualCone model of FindShadowState() for a constellation: the
+ * Sun direction is found once per body, and the sunny side test runs over all
+ * of the spacecraft before the apparent radii are computed for the ones behind
+ * the body.  The positions are in any one frame.
+ *
+ * @param <satCount>      Number of spacecraft
+ * @param <satPositions>  Spacecraft positions; the one of spacecraft i starts
+ *                        at satPositions[i * satStride]
+ * @param <satStride>     Spacing of the spacecraft positions, 3 or more
+ * @param <bodyCount>     Number of shadow bodies
+ * @param <bodyPositions> Body positions, 3 per body
+ * @param <bodyRadii>     Body radii
+ * @param <sunPosition>   Sun position
+ * @param <sunRad>        Sun radius
+ * @param <lighting>      The lighting of spacecraft i past body j, at
+ *                        lighting[i * bodyCount + j]
+ */
+//------------------------------------------------------------------------------
+void ShadowState::FindShadowStates(Integer satCount, const Real *satPositions,
+                          Integer satStride, Integer bodyCount,
+                          const Real *bodyPositions, const Real *bodyRadii,
+                          const Real *sunPosition, Real sunRad,
+                          Lighting *lighting)
+{
+   if ((satCount <= 0) || (bodyCount <= 0))
+      return;
+
+   sunwardDistances.resize(satCount);
+   Real *rdotsun = &sunwardDistances[0];
+   Real state[3], sunSat[3];
+
+   for (Integer j = 0; j < bodyCount; ++j)
+   {
+      const Real *body = &bodyPositions[3*j];
+      Real bodySun[3] = {sunPosition[0] - body[0], sunPosition[1] - body[1],
+                         sunPosition[2] - body[2]};
+      Real mag = GmatMathUtil::Sqrt(bodySun[0]*bodySun[0] +
+                                    bodySun[1]*bodySun[1] +
+                                    bodySun[2]*bodySun[2]);
+      Real ux = bodySun[0] / mag, uy = bodySun[1] / mag, uz = bodySun[2] / mag;
+      Real bx = body[0], by = body[1], bz = body[2];
+
+      // Sunny side test for every spacecraft, in a loop free of branches
+      for (Integer i = 0; i < satCount; ++i)
+      {
+         const Real *sat = &satPositions[i * satStride];
+         rdotsun[i] = (sat[0] - bx) * ux + (sat[1] - by) * uy +
+                      (sat[2] - bz) * uz;
+      }
+
+      for (Integer i = 0; i < satCount; ++i)
+      {
+         Lighting &light = lighting[i * bodyCount + j];
+         light.apparentSunRadius = light.apparentBodyRadius =
+               light.apparentDistFromSunToBody = -1.0;
+         if (rdotsun[i] > 0.0)
+         {
+            light.lit        = true;
+            light.dark       = false;
+            light.percentSun = 1.0;
+         }
+         else
+         {
+            const Real *sat = &satPositions[i * satStride];
+            for (Integer k = 0; k < 3; ++k)
+            {
+               state[k]  = sat[k] - body[k];
+               sunSat[k] = state[k] - bodySun[k];
+            }
+            light.percentSun = FindShadowedState(light.lit, light.dark, state,
+                  sunSat, sunRad, bodyRadii[j], light.apparentSunRadius,
+                  light.apparentBodyRadius, light.apparentDistFromSunToBody);
+         }
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Real FindShadowedState(bool &lit, bool &dark, const Real *state,
+//                        const Real *sunSat, Real sunRad, Real bodyRad,
+//                        Real &apparentSunRadius, Real &apparentBodyRadius,
+//                        Real &apparentDistFromSunToBody)
+//------------------------------------------------------------------------------
+/**
+ * Determines the lighting of a spacecraft on the night side of a body,
+ * reusing the result when this object saw the same geometry recently
+ *
+ * The geometries are compared exactly, so a hit returns the values
+ * ComputeShadowedState() would.  The apparent quantities that the computation
+ * would not have set are left unchanged.
+ *
+ * @param <lit>      Indicates if the spacecraft is in full sunlight
+ * @param <dark>     Indicates if the spacecraft is in umbra
+ * @param <state>    Spacecraft position relative to the body
+ * @param <sunSat>   Sun-to-SC vector
+ * @param <sunRad>   Sun radius
+ * @param <bodyRad>  Radius of body
+ *
+ * @return The percent sun
+ */
+//------------------------------------------------------------------------------
+Real ShadowState::FindShadowedState(bool &lit, bool &dark, const Real *state,
+                          const Real *sunSat, Real sunRad, Real bodyRad,
+                          Real &apparentSunRadius, Real &apparentBodyRadius,
+                          Real &apparentDistFromSunToBody)
+{
+   Real key[8] = {state[0], state[1], state[2], sunSat[0], sunSat[1],
+                  sunSat[2], sunRad, bodyRad};
+   Lighting light;
+   bool found = false;
+
+   for (Integer i = 0; (i < memoCount) && !found; ++i)
+   {
+      if (std::equal(key, key + 8, memo[i].key))
+      {
+         light = memo[i].lighting;
+         found = true;
+      }
+   }
+
+   if (!found)
+   {
+      light.apparentSunRadius = light.apparentBodyRadius =
+            light.apparentDistFromSunToBody = -1.0;
+      light.percentSun = ComputeShadowedState(light.lit, light.dark, state,
+            sunSat, sunRad, bodyRad, light.apparentSunRadius,
+            light.apparentBodyRadius, light.apparentDistFromSunToBody);
+
+      std::copy(key, key + 8, memo[memoNext].key);
+      memo[memoNext].lighting = light;
+      memoNext = (memoNext + 1) % MEMO_SIZE;
+      if (memoCount < MEMO_SIZE)
+         ++memoCount;
+   }
+
+   lit  = light.lit;
+   dark = light.dark;
+   if (light.apparentSunRadius >= 0.0)
+      apparentSunRadius = light.apparentSunRadius;
+   if (light.apparentBodyRadius >= 0.0)
+      apparentBodyRadius = light.apparentBodyRadius;
+   if (light.apparentDistFromSunToBody >= 0.0)
+      apparentDistFromSunToBody = light.apparentDistFromSunToBody;
+   return light.percentSun;
+}
+
+//------------------------------------------------------------------------------
+// Real ComputeShadowedState(bool &lit, bool &dark, const Real *state,
+//                           const Real *sunSat, Real sunRad, Real bodyRad,
+//                           Real &apparentSunRadius, Real &apparentBodyRadius,
+//                           Real &apparentDistFromSunToBody)
+//------------------------------------------------------------------------------
+/**
+ * Determines the lighting of a spacecraft on the night side of a body from
+ * the apparent radii of the Sun and the body
+ *
+ * @param <lit>      Indicates if the spacecraft is in full sunlight
+ * @param <dark>     Indicates if the spacecraft is in umbra
+ * @param <state>    Spacecraft position relative to the body
+ * @param <sunSat>   Sun-to-SC vector
+ * @param <sunRad>   Sun radius
+ * @param <bodyRad>  Radius of body
+ *
+ * @return The percent sun
+ */
+//------------------------------------------------------------------------------
+Real ShadowState::ComputeShadowedState(bool &lit, bool &dark,
+                          const Real *state, const Real *sunSat, Real sunRad,
+                          Real bodyRad, Real &apparentSunRadius,
+                          Real &apparentBodyRadius,
+                          Real &apparentDistFromSunToBody)
+{
+   Real      percentSun    = 1;   // default is full sun
 
 //      if (shadowModel == "Cylindrical")
 //      {
@@ -253,9 +447,8 @@ Real ShadowState::FindShadowState(bool &lit, bool &dark,
 		    // This is the penumbra case
             Real pcbrad = GmatMathUtil::ASin(bodyRad/satToBodyDist);
 			Real psunrad = GmatMathUtil::ASin(sunRad/satToSunDist);
-            Real f = GmatMathUtil::Sqrt(force[0]*force[0] + force[1]*force[1] + force[2]*force[2]);
    #ifdef DEBUG_SHADOW_STATE1
-         MessageInterface::ShowMessage("  force = %.12lf   apparentDistFromSunToBody = %.12lf     apparentSunRadius = %.12lf  apparentBodyRadius = %.12lf\n", f, apparentDistFromSunToBody, apparentSunRadius, apparentBodyRadius);
+         MessageInterface::ShowMessage("  apparentDistFromSunToBody = %.12lf     apparentSunRadius = %.12lf  apparentBodyRadius = %.12lf\n", apparentDistFromSunToBody, apparentSunRadius, apparentBodyRadius);
    #endif
             //percentSun = GetPercentSunInPenumbra(state, pcbrad, psunrad, force);
             percentSun = GetPercentSunInPenumbra(state, pcbrad, psunrad, unitSatToSun);
@@ -383,16 +576,10 @@ Real ShadowState::FindShadowState(bool &lit, bool &dark,
 //         errmsg += shadowModel + "\".\n";
 //         throw SolarSystemException(errmsg);
 //      }
-   }
-   return percentSun;
 }
 
 //------------------------------------------------------------------------------
-// protected methods
-//------------------------------------------------------------------------------
-
-//------------------------------------------------------------------------------
-// Real GetPercentSunInPenumbra(Real *state,
+// Real GetPercentSunInPenumbra(const Real *state,
 //                              Real *sunSat, Real *force,
 //                              Real pcbrad, Real psunrad)
 //------------------------------------------------------------------------------
@@ -409,7 +596,7 @@ Real ShadowState::FindShadowState(bool &lit, bool &dark,
  * NOTE: this code was adapted from original SRP Shadow code
  */
 //------------------------------------------------------------------------------
-Real ShadowState::GetPercentSunInPenumbra(Real *state,
+Real ShadowState::GetPercentSunInPenumbra(const Real *state,
                   Real pcbrad, Real psunrad, Real *unitSunToSat)
 {
    Real mag = GmatMathUtil::Sqrt(state[0]*state[0] +
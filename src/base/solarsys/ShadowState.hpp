@@ -36,6 +36,22 @@
 class GMAT_API ShadowState
 {
 public:
+   /// Lighting of one spacecraft by the Sun past one shadow body
+   struct Lighting
+   {
+      /// Fraction of the Sun disk seen, 1.0 in full sunlight
+      Real        percentSun;
+      /// Full sunlight
+      bool        lit;
+      /// Umbra
+      bool        dark;
+      /// Apparent angular radii and separation, in radians, or -1.0 where the
+      /// case was decided before they were needed
+      Real        apparentSunRadius;
+      Real        apparentBodyRadius;
+      Real        apparentDistFromSunToBody;
+   };
+
    /// class methods
    ShadowState();
    ShadowState(const ShadowState &copy);
@@ -50,12 +66,49 @@ public:
                                     Real bodyRad, Real psunrad, Real &apparentSunRadius,
                                     Real &apparentBodyRadius,
                                     Real &apparentDistFromSunToBody);
+   virtual void     FindShadowStates(Integer satCount, const Real *satPositions,
+                                     Integer satStride, Integer bodyCount,
+                                     const Real *bodyPositions,
+                                     const Real *bodyRadii,
+                                     const Real *sunPosition, Real sunRad,
+                                     Lighting *lighting);
 protected:
 
    SolarSystem                  *solarSystem;
    CelestialBody                *sun;
-   virtual Real   GetPercentSunInPenumbra(Real *state,
+   /// Sunward distances of the spacecraft in FindShadowStates()
+   RealArray                    sunwardDistances;
+   virtual Real   GetPercentSunInPenumbra(const Real *state,
                               Real pcbrad,  Real psunrad, Real *force);
+
+   Real           FindShadowedState(bool &lit, bool &dark, const Real *state,
+                                    const Real *sunSat, Real sunRad,
+                                    Real bodyRad, Real &apparentSunRadius,
+                                    Real &apparentBodyRadius,
+                                    Real &apparentDistFromSunToBody);
+   Real           ComputeShadowedState(bool &lit, bool &dark,
+                                       const Real *state, const Real *sunSat,
+                                       Real sunRad, Real bodyRad,
+                                       Real &apparentSunRadius,
+                                       Real &apparentBodyRadius,
+                                       Real &apparentDistFromSunToBody);
+
+   /// Number of shadowed geometries remembered
+   static const Integer MEMO_SIZE = 16;
+   /// A shadowed geometry (state, Sun-to-spacecraft vector, Sun and body
+   /// radii) and its lighting
+   struct MemoEntry
+   {
+      Real        key[8];
+      Lighting    lighting;
+   };
+   /// Geometries seen by this object, so the passes of its owner over the
+   /// same state do not compute them twice
+   MemoEntry         memo[MEMO_SIZE];
+   /// Number of memo entries filled
+   Integer           memoCount;
+   /// The memo entry replaced next
+   Integer           memoNext;
 };
 
 #endif   // ShadowState
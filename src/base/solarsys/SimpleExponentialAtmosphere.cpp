@@ -168,6 +168,24 @@ bool SimpleExponentialAtmosphere::Density(Real *position, Real *density,
 }
 
 
+//------------------------------------------------------------------------------
+// bool HasEpochDependentDensity()
+//------------------------------------------------------------------------------
+/**
+ * Checks to see if the density at a fixed position changes with epoch.
+ *
+ * The density is a function of the altitude alone, which only changes with
+ * epoch through the slow motion of the body's pole.
+ *
+ * @return false
+ */
+//------------------------------------------------------------------------------
+bool SimpleExponentialAtmosphere::HasEpochDependentDensity()
+{
+   return false;
+}
+
+
 //------------------------------------------------------------------------------
 // GmatBase* Clone() const
 //------------------------------------------------------------------------------
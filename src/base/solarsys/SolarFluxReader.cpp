@@ -36,6 +36,8 @@
 #include "FileManager.hpp"
 #include "FileUtil.hpp"
 #include <sstream>
+#include <algorithm>
+#include <sys/stat.h>            // for stat()
 
 
 //#define DEBUG_FILE_INDEXING
@@ -46,6 +48,12 @@
 
 //#define DEBUG_FIRSTFEW_READS
 
+//#define DEBUG_TABLE_CACHE
+
+std::map<std::string, std::weak_ptr<const SolarFluxReader::FluxTable> >
+      SolarFluxReader::tableCache;
+std::mutex SolarFluxReader::cacheMutex;
+
 #ifdef DEBUG_FIRSTFEW_READS
    Integer howMany = 5;
    Integer numberReadIndex = 0;
@@ -177,17 +185,15 @@ SolarFluxReader::SolarFluxReader():
    predictEnd        (-1.0),
    schattenFluxIndex (0),
    schattenApIndex   (0),
+   predictIndex      (1),
    warnEpochBefore   (true),
    warnEpochAfter    (true),
    f107RefEpoch      (18408.0),  // 5/31/91, epoch when the station moved (Vallado)
    interpolateFlux   (true),
    interpolateGeo    (false)
 {
-   if (!obsFluxData.empty())
-      obsFluxData.clear();
-
-   if (!predictFluxData.empty())
-      predictFluxData.clear();
+   obsTable.reset(new FluxTable);
+   predictTable.reset(new FluxTable);
 
    beg_ObsTag = "BEGIN OBSERVED";
    end_ObsTag = "END OBSERVED";
@@ -225,6 +231,7 @@ SolarFluxReader::SolarFluxReader(const SolarFluxReader &sfr) :
    predictEnd        (-1.0),
    schattenFluxIndex (1),
    schattenApIndex   (0),
+   predictIndex      (1),
    warnEpochBefore   (true),
    warnEpochAfter    (true),
    f107RefEpoch      (sfr.f107RefEpoch),
@@ -233,8 +240,8 @@ SolarFluxReader::SolarFluxReader(const SolarFluxReader &sfr) :
 {
    obsFileName = sfr.obsFileName;
    predictFileName = sfr.predictFileName;
-   obsFluxData = sfr.obsFluxData;
-   predictFluxData = sfr.predictFluxData;
+   obsTable = sfr.obsTable;
+   predictTable = sfr.predictTable;
    beg_ObsTag = sfr.beg_ObsTag;
    end_ObsTag = sfr.end_ObsTag;
    begObs = sfr.begObs;
@@ -257,8 +264,8 @@ SolarFluxReader& SolarFluxReader::operator=(const SolarFluxReader &sfr)
 
    obsFileName = sfr.obsFileName;
    predictFileName = sfr.predictFileName;
-   obsFluxData = sfr.obsFluxData;
-   predictFluxData = sfr.predictFluxData;
+   obsTable = sfr.obsTable;
+   predictTable = sfr.predictTable;
    beg_ObsTag = sfr.beg_ObsTag;
    end_ObsTag = sfr.end_ObsTag;
    begObs = sfr.begObs;
@@ -271,6 +278,7 @@ SolarFluxReader& SolarFluxReader::operator=(const SolarFluxReader &sfr)
    predictEnd = -1.0;
    schattenFluxIndex = 1;
    schattenApIndex = 0;
+   predictIndex = 1;
    
    warnEpochBefore = true;
    warnEpochAfter = true;
@@ -337,8 +345,9 @@ bool SolarFluxReader::LoadFluxData(const std::string &obsFile, const std::string
    if (!predictFile.empty())
       predictFileName = predictFile;
 
-   obsFluxData.clear();
-   predictFluxData.clear();
+   obsTable.reset(new FluxTable);
+   predictTable.reset(new FluxTable);
+   predictIndex = 1;
 
    FileManager *fm = FileManager::Instance();
 
@@ -366,10 +375,29 @@ bool SolarFluxReader::LoadFluxData(const std::string &obsFile, const std::string
       predictFileName = weatherfile;
    }
 
+   // Files already loaded by another reader are not read again
+   std::string obsKey = GetCacheKey(obsFileName);
+   std::string predictKey = GetCacheKey(predictFileName);
+   std::shared_ptr<const FluxTable> cachedObs = FindTable(obsKey);
+   std::shared_ptr<const FluxTable> cachedPredict = FindTable(predictKey);
+   if ((cachedObs || cachedPredict) &&
+       (cachedObs || (obsFileName == "")) &&
+       (cachedPredict || (predictFileName == "")))
+   {
+      if (cachedObs)
+         obsTable = cachedObs;
+      if (cachedPredict)
+         predictTable = cachedPredict;
+      SetSpans();
+      return true;
+   }
+   
    // Open the files to load
    Open();
    
-   if (obsFileName != "")
+   if (cachedObs)
+      obsTable = cachedObs;
+   else if (obsFileName != "")
    {
       if (inObs.is_open())
       {
@@ -390,7 +418,9 @@ bool SolarFluxReader::LoadFluxData(const std::string &obsFile, const std::string
                break;
             }
          }
-         LoadObsData();
+         FluxTable table;
+         LoadObsData(table);
+         obsTable = AddTable(obsKey, table);
       }
       else
       {
@@ -400,7 +430,9 @@ bool SolarFluxReader::LoadFluxData(const std::string &obsFile, const std::string
       }
    }
 
-   if (predictFileName != "")
+   if (cachedPredict)
+      predictTable = cachedPredict;
+   else if (predictFileName != "")
    {
       if (inPredict.is_open())
       {
@@ -416,7 +448,9 @@ bool SolarFluxReader::LoadFluxData(const std::string &obsFile, const std::string
                break;
             }
          }
-         LoadPredictData();
+         FluxTable table;
+         LoadPredictData(table);
+         predictTable = AddTable(predictKey, table);
       }
       else
       {
@@ -426,6 +460,8 @@ bool SolarFluxReader::LoadFluxData(const std::string &obsFile, const std::string
       }
    }
 
+   SetSpans();
+
    #ifdef DEBUG_INITIALIZATION
       MessageInterface::ShowMessage("Spans: [%lf %lf], [%lf %lf]\n",
             historicStart, historicEnd, predictStart, predictEnd);
@@ -467,19 +503,19 @@ bool SolarFluxReader::Close()
 
 
 //------------------------------------------------------------------------------
-// bool LoadObsData()
+// bool LoadObsData(FluxTable &obsFluxData)
 //------------------------------------------------------------------------------
 /**
  * Loads Observed input file data.
  *
  * This method will load Observed input file data.
  * 
- * @param none
+ * @param obsFluxData The table that receives the records
  *
  * @return bool
  */
 //------------------------------------------------------------------------------
-bool SolarFluxReader::LoadObsData()
+bool SolarFluxReader::LoadObsData(FluxTable &obsFluxData)
 {
    Integer hour = 0, minute = 0;
    Real sec = 0.0;
@@ -574,34 +610,27 @@ bool SolarFluxReader::LoadObsData()
             obsFluxData.size());
    #endif
 
-   if (obsFluxData.size() > 0)
-   {
-      historicStart = obsFluxData[0].epoch;
-      // Note that epoch of last record is at day start; add 1 to reach end!
-      historicEnd = obsFluxData[obsFluxData.size() - 1].epoch + 1.0;
-
-      for (Integer i = 0; i < obsFluxData.size(); ++i)
-         obsFluxData[i].id = i;
-   }
+   for (Integer i = 0; i < obsFluxData.size(); ++i)
+      obsFluxData[i].id = i;
 
    return true;
 }
 
 
 //------------------------------------------------------------------------------
-// bool LoadPredictData()
+// bool LoadPredictData(FluxTable &predictFluxData)
 //------------------------------------------------------------------------------
 /**
  * Loads Predict input file data.
  *
  * This method will load Predict input file data.
  * 
- * @param none
+ * @param predictFluxData The table that receives the records
  *
  * @return bool
  */
 //------------------------------------------------------------------------------
-bool SolarFluxReader::LoadPredictData()
+bool SolarFluxReader::LoadPredictData(FluxTable &predictFluxData)
 { 
    Integer hour = 0, minute = 0, dom = 1;
    Real sec = 0.0;
@@ -724,13 +753,10 @@ bool SolarFluxReader::LoadPredictData()
 
    if (predictFluxData.size() > 0)
    {
-      predictStart = predictFluxData[0].epoch;
-      predictEnd = predictFluxData[predictFluxData.size() - 1].epoch;
-
-      Integer runningDays = 0;
+      GmatEpoch firstEpoch = predictFluxData[0].epoch;
       for (Integer i = 0; i < predictFluxData.size(); ++i)
       {
-         predictFluxData[i].index = (Integer)(predictFluxData[i].epoch - predictStart);
+         predictFluxData[i].index = (Integer)(predictFluxData[i].epoch - firstEpoch);
          predictFluxData[i].id = i;
       }
    }
@@ -738,6 +764,127 @@ bool SolarFluxReader::LoadPredictData()
    return true;
 }
 
+
+//------------------------------------------------------------------------------
+// void SetSpans()
+//------------------------------------------------------------------------------
+/**
+ * Sets the historic and predict spans from the loaded tables.
+ */
+//------------------------------------------------------------------------------
+void SolarFluxReader::SetSpans()
+{
+   const FluxTable &obsFluxData = *obsTable;
+   const FluxTable &predictFluxData = *predictTable;
+
+   if (obsFluxData.size() > 0)
+   {
+      historicStart = obsFluxData[0].epoch;
+      // Note that epoch of last record is at day start; add 1 to reach end!
+      historicEnd = obsFluxData[obsFluxData.size() - 1].epoch + 1.0;
+   }
+
+   if (predictFluxData.size() > 0)
+   {
+      predictStart = predictFluxData[0].epoch;
+      predictEnd = predictFluxData[predictFluxData.size() - 1].epoch;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetCacheKey(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Builds the table cache key of a space weather file: its name, size and
+ * modification time, so an edited file is read again.
+ *
+ * @param fileName The full path of the file
+ *
+ * @return The key, or an empty string if there is no file to share
+ */
+//------------------------------------------------------------------------------
+std::string SolarFluxReader::GetCacheKey(const std::string &fileName)
+{
+   struct stat fileStatus;
+   if ((fileName == "") || (stat(fileName.c_str(), &fileStatus) != 0))
+      return "";
+
+   std::stringstream key;
+   key << fileName << "|" << (long long)fileStatus.st_size << "|"
+       << (long long)fileStatus.st_mtime;
+   return key.str();
+}
+
+
+//------------------------------------------------------------------------------
+// std::shared_ptr<const FluxTable> FindTable(const std::string &key)
+//------------------------------------------------------------------------------
+/**
+ * Finds a table loaded by a reader that still uses it.
+ *
+ * @param key The cache key of the file
+ *
+ * @return The table, or an empty pointer if it is not loaded
+ */
+//------------------------------------------------------------------------------
+std::shared_ptr<const SolarFluxReader::FluxTable>
+      SolarFluxReader::FindTable(const std::string &key)
+{
+   std::shared_ptr<const FluxTable> table;
+   if (key == "")
+      return table;
+
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   std::map<std::string, std::weak_ptr<const FluxTable> >::iterator entry =
+         tableCache.find(key);
+   if (entry != tableCache.end())
+   {
+      table = entry->second.lock();
+      if (!table)
+         tableCache.erase(entry);
+   }
+
+   #ifdef DEBUG_TABLE_CACHE
+      MessageInterface::ShowMessage("SolarFluxReader::FindTable(%s): %s\n",
+            key.c_str(), (table ? "shared" : "not loaded"));
+   #endif
+
+   return table;
+}
+
+
+//------------------------------------------------------------------------------
+// std::shared_ptr<const FluxTable> AddTable(const std::string &key,
+//       FluxTable &table)
+//------------------------------------------------------------------------------
+/**
+ * Makes a newly loaded table available to the other readers of the file.
+ *
+ * The table is not changed after loading, so the readers share it instead of
+ * each parsing and holding its own copy.  It is freed with its last reader.
+ *
+ * @param key   The cache key of the file
+ * @param table The loaded records; they are moved into the shared table
+ *
+ * @return The shared table
+ */
+//------------------------------------------------------------------------------
+std::shared_ptr<const SolarFluxReader::FluxTable>
+      SolarFluxReader::AddTable(const std::string &key, FluxTable &table)
+{
+   std::shared_ptr<FluxTable> shared(new FluxTable);
+   shared->swap(table);
+
+   if (key != "")
+   {
+      std::lock_guard<std::mutex> lock(cacheMutex);
+      tableCache[key] = shared;
+   }
+
+   return shared;
+}
+
 //------------------------------------------------------------------------------
 // FluxData SolarFluxReader::GetInputs(GmatEpoch epoch)
 //------------------------------------------------------------------------------
@@ -763,6 +910,8 @@ SolarFluxReader::FluxData SolarFluxReader::GetInputs(GmatEpoch epoch)
    // in the struct to be filled.
    FluxData fD;
    Integer index;
+   const FluxTable &obsFluxData = *obsTable;
+   const FluxTable &predictFluxData = *predictTable;
 
 
    #ifdef DEBUG_GETFLUXINPUTS
@@ -809,15 +958,23 @@ SolarFluxReader::FluxData SolarFluxReader::GetInputs(GmatEpoch epoch)
          }
          else
          {
-            // Look up the data for epoch
-            for (UnsignedInt i = 1; i < predictFluxData.size(); ++i)
+            // Look up the data for epoch: the first record after it, found
+            // from the last one unless the epoch moved out of its span
+            UnsignedInt i = predictIndex;
+            if ((i >= predictFluxData.size()) ||
+                (predictFluxData[i].epoch <= epoch) ||
+                ((i > 1) && (predictFluxData[i-1].epoch > epoch)))
+            {
+               i = (UnsignedInt)(std::upper_bound(predictFluxData.begin() + 1,
+                     predictFluxData.end(), epoch,
+                     [](GmatEpoch ep, const FluxData &rec)
+                     { return ep < rec.epoch; }) - predictFluxData.begin());
+               predictIndex = i;
+            }
+            if (i < predictFluxData.size())
             {
-               if (predictFluxData[i].epoch > epoch)
-               {
-                  fD = predictFluxData[i-1];
-                  fD.index = -1;
-                  break;
-               }
+               fD = predictFluxData[i-1];
+               fD.index = -1;
             }
          }
       }
@@ -919,6 +1076,8 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
          "fD.Epoch = %.12lf, index = %d\n", epoch, fD.epoch, fD.index);
    #endif
    
+   const FluxTable &obsFluxData = *obsTable;
+   const FluxTable &predictFluxData = *predictTable;
    Integer f107index = fD.index;
 
    if (fD.isObsData)
@@ -948,7 +1107,7 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
          apValues[j] = fD.ap[i];
       if (fD.index > 0)
       {
-         FluxData fD_OneBefore = obsFluxData[fD.index - 1];
+         const FluxData &fD_OneBefore = obsFluxData[fD.index - 1];
          for (i = 7; i >= 0; j++,i--)
             apValues[j] = fD_OneBefore.ap[i];
       }
@@ -959,7 +1118,7 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
       }
       if (fD.index > 1)
       {
-         FluxData fD_TwoBefore = obsFluxData[fD.index - 2];
+         const FluxData &fD_TwoBefore = obsFluxData[fD.index - 2];
          for (i = 7; i >= 0; j++,i--)
             apValues[j] = fD_TwoBefore.ap[i];
       }
@@ -971,7 +1130,7 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
 
       if ( fD.index > 2)
       {
-         FluxData fD_ThreeBefore = obsFluxData[fD.index - 3];
+         const FluxData &fD_ThreeBefore = obsFluxData[fD.index - 3];
          for (i = 7; i >= 0; j++,i--)
             apValues[j] = fD_ThreeBefore.ap[i];
       }
@@ -1179,6 +1338,7 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
 //------------------------------------------------------------------------------
 void SolarFluxReader::PrepareKpData(SolarFluxReader::FluxData &fD, GmatEpoch epoch )
 {
+   const FluxTable &obsFluxData = *obsTable;
    Integer f107index = fD.index;
    if (fD.isObsData)
    {
@@ -1208,7 +1368,7 @@ void SolarFluxReader::PrepareKpData(SolarFluxReader::FluxData &fD, GmatEpoch epo
 
       if (subIndex < 0 && fD.id > 0)
       {
-         FluxData fD_OneBefore = obsFluxData[fD.id - 1];
+         const FluxData &fD_OneBefore = obsFluxData[fD.id - 1];
          fD.kp[0] = fD_OneBefore.kp[8+subIndex];
       }
 
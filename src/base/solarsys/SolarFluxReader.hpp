@@ -39,6 +39,9 @@
 #include <iostream>
 #include <iterator>
 #include <sstream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include "DateUtil.hpp"
 #include "GmatConstants.hpp"
 #include "GmatBase.hpp"
@@ -153,6 +156,9 @@ public:
       Integer index;
       Integer id;
    };
+   
+   /// The records of a space weather file
+   typedef std::vector<FluxData> FluxTable;
   
 private:
    const char * beg_ObsTag;
@@ -173,10 +179,15 @@ private:
    std::ifstream inObs;
    /// Predict File Stream
    std::ifstream inPredict;
-   /// CSSI data array 
-   std::vector<FluxData> obsFluxData;
-   /// Schatten data array
-   std::vector<FluxData> predictFluxData;
+   /// CSSI data array, shared by the readers of the file
+   std::shared_ptr<const FluxTable> obsTable;
+   /// Schatten data array, shared by the readers of the file
+   std::shared_ptr<const FluxTable> predictTable;
+   
+   /// Tables loaded by any reader, by file name and file stamp
+   static std::map<std::string, std::weak_ptr<const FluxTable> > tableCache;
+   /// Guards the table cache
+   static std::mutex cacheMutex;
 
    GmatEpoch historicStart;
    GmatEpoch historicEnd;
@@ -187,6 +198,9 @@ private:
    Integer schattenFluxIndex;
    /// Index for Schatten Ap value
    Integer schattenApIndex;
+   /// Index of the predict record found after the one used last; the search
+   /// starts there, as the epochs usually advance slowly
+   UnsignedInt predictIndex;
       
    /// Flag used to indicate that the "Too early" warning not yet issued
    bool warnEpochBefore;
@@ -200,8 +214,15 @@ private:
    /// Flag used to toggle interpolation for the geomagnetic index (predict only)
    bool interpolateGeo;
 
-   bool LoadObsData();
-   bool LoadPredictData();
+   bool LoadObsData(FluxTable &obsFluxData);
+   bool LoadPredictData(FluxTable &predictFluxData);
+   void SetSpans();
+   
+   static std::string GetCacheKey(const std::string &fileName);
+   static std::shared_ptr<const FluxTable>
+                      FindTable(const std::string &key);
+   static std::shared_ptr<const FluxTable>
+                      AddTable(const std::string &key, FluxTable &table);
    Real ConvertApToKp(Real ap);
 
 public:
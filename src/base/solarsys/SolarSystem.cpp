@@ -2823,6 +2823,31 @@ bool SolarSystem::SetEphemUpdateInterval(Real intvl)
 }
 
 
+//------------------------------------------------------------------------------
+// bool SetSpiceFitTolerance(Real tolerance)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the allowed position error (km) of the Chebyshev fit of the
+ * SPICE states for each of the bodies in use; 0 turns the fit off.
+ *
+ * @param <tolerance> allowed position error of the fit
+ *
+ * @return success flag for the operation.
+ *
+ */
+//------------------------------------------------------------------------------
+bool SolarSystem::SetSpiceFitTolerance(Real tolerance)
+{
+   std::vector<CelestialBody*>::iterator cbi = bodiesInUse.begin();
+   while (cbi != bodiesInUse.end())
+   {
+      if ((*cbi)->SetSpiceFitTolerance(tolerance) == false)  return false;
+      ++cbi;
+   }
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // bool AddValidModelName(Gmat::ModelType m, const std::string &forBody,
 //                        const std::string &theModel)
@@ -3118,11 +3143,12 @@ std::string SolarSystem::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SolarSystem::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < SolarSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               SolarSystemParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatBase::GetParameterID(str);
 }
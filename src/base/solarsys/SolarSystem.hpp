@@ -137,6 +137,7 @@ public:
    
    bool                 SetOverrideTimeSystem(bool overrideIt);
    bool                 SetEphemUpdateInterval(Real intvl);
+   bool                 SetSpiceFitTolerance(Real tolerance);
    bool                 AddValidModelName(Gmat::ModelType m, const std::string &forBody,
                                           const std::string &theModel);
    bool                 RemoveValidModelName(Gmat::ModelType m,
@@ -312,11 +312,12 @@ std::string Star::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Star::GetParameterID(const std::string &str) const
 {
-   for (Integer i = CelestialBodyParamCount; i < StarParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CelestialBodyParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, CelestialBodyParamCount,
+               StarParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return CelestialBody::GetParameterID(str);
 }
@@ -0,0 +1,1070 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TabulatedAtmosphere
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the TabulatedAtmosphere class.
+ */
+//------------------------------------------------------------------------------
+
+#include "TabulatedAtmosphere.hpp"
+#include "Msise90Atmosphere.hpp"
+#include "JacchiaRobertsAtmosphere.hpp"
+#include "AtmosphereException.hpp"
+#include "CoordinateConverter.hpp"
+#include "CoordinateSystem.hpp"
+#include "TimeSystemConverter.hpp"
+#include "MessageInterface.hpp"
+#include "GmatConstants.hpp"
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+//#define DEBUG_TABULATED_ATMOSPHERE
+
+
+//---------------------------------
+// static data
+//---------------------------------
+
+const Real TabulatedAtmosphere::SLAB_SPAN       = 0.125;
+const Real TabulatedAtmosphere::ALTITUDE_STEP   = 5.0;
+const Real TabulatedAtmosphere::SOLAR_TIME_STEP = 1.0;
+const Real TabulatedAtmosphere::LATITUDE_STEP   = 5.0;
+const Real TabulatedAtmosphere::MAX_ALTITUDE    = 2000.0;
+
+std::mutex TabulatedAtmosphere::fileMutex;
+
+const std::string
+TabulatedAtmosphere::PARAMETER_TEXT[TabulatedAtmosphereParamCount -
+                                    AtmosphereModelParamCount] =
+{
+   "DensityTableFile",
+   "DensityTableTolerance",
+};
+
+const Gmat::ParameterType
+TabulatedAtmosphere::PARAMETER_TYPE[TabulatedAtmosphereParamCount -
+                                    AtmosphereModelParamCount] =
+{
+   Gmat::FILENAME_TYPE,
+   Gmat::REAL_TYPE,
+};
+
+/// First line of the table files
+static const std::string TABLE_TAG = "GMATDENSITYTABLE1";
+
+
+//------------------------------------------------------------------------------
+//  public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// TabulatedAtmosphere(const std::string &sourceType, const std::string &name)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param sourceType The model tabulated, "MSISE90" or "JacchiaRoberts"
+ * @param name       Name of the model
+ */
+//------------------------------------------------------------------------------
+TabulatedAtmosphere::TabulatedAtmosphere(const std::string &sourceType,
+                                         const std::string &name) :
+   AtmosphereModel      ("Tabulated" + sourceType, name),
+   sourceType           (sourceType),
+   source               (NULL),
+   tolerance            (0.01),
+   tableFile            (""),
+   minAltitude          (80.0),
+   tableOpened          (false),
+   utEpoch              (-1.0),
+   utHours              (0.0),
+   interpolatedCount    (0),
+   directCount          (0)
+{
+   objectTypeNames.push_back("TabulatedAtmosphere");
+   parameterCount = TabulatedAtmosphereParamCount;
+
+   if (sourceType == "MSISE90")
+      source = new Msise90Atmosphere(name);
+   else if (sourceType == "JacchiaRoberts")
+   {
+      // The Jacchia-Roberts model starts at 90 km; keep the grid well above
+      source = new JacchiaRobertsAtmosphere(name);
+      minAltitude = 110.0;
+   }
+   else
+      throw AtmosphereException("The atmosphere model " + sourceType +
+            " cannot be tabulated");
+
+   altitudeCount  = (Integer)((MAX_ALTITUDE - minAltitude) / ALTITUDE_STEP +
+                              0.5) + 1;
+   solarTimeCount = (Integer)(24.0 / SOLAR_TIME_STEP + 0.5);
+   latitudeCount  = (Integer)(180.0 / LATITUDE_STEP + 0.5) + 1;
+
+   for (Integer i = 0; i < 5; ++i)
+      configuredSettings[i] = -99;
+}
+
+
+//------------------------------------------------------------------------------
+// ~TabulatedAtmosphere()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; saves the nodes not yet in the table file
+ */
+//------------------------------------------------------------------------------
+TabulatedAtmosphere::~TabulatedAtmosphere()
+{
+   #ifdef DEBUG_TABULATED_ATMOSPHERE
+      MessageInterface::ShowMessage("%s: %d densities interpolated, %d "
+            "evaluated by %s\n", instanceName.c_str(), interpolatedCount,
+            directCount, sourceType.c_str());
+   #endif
+
+   while (!unsaved.empty())
+      SaveSlab(unsaved.begin()->first);
+
+   if (source != NULL)
+      delete source;
+}
+
+
+//------------------------------------------------------------------------------
+// TabulatedAtmosphere(const TabulatedAtmosphere& atm)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * The nodes held are copied; the original saves the ones it computed.
+ *
+ * @param atm The model copied
+ */
+//------------------------------------------------------------------------------
+TabulatedAtmosphere::TabulatedAtmosphere(const TabulatedAtmosphere& atm) :
+   AtmosphereModel      (atm),
+   sourceType           (atm.sourceType),
+   source               (NULL),
+   tolerance            (atm.tolerance),
+   tableFile            (atm.tableFile),
+   minAltitude          (atm.minAltitude),
+   altitudeCount        (atm.altitudeCount),
+   solarTimeCount       (atm.solarTimeCount),
+   latitudeCount        (atm.latitudeCount),
+   slabs                (atm.slabs),
+   savedRecords         (atm.savedRecords),
+   tableOpened          (atm.tableOpened),
+   utEpoch              (-1.0),
+   utHours              (0.0),
+   interpolatedCount    (0),
+   directCount          (0)
+{
+   parameterCount = TabulatedAtmosphereParamCount;
+   if (atm.source != NULL)
+      source = (AtmosphereModel*)atm.source->Clone();
+   for (Integer i = 0; i < 5; ++i)
+      configuredSettings[i] = atm.configuredSettings[i];
+}
+
+
+//------------------------------------------------------------------------------
+// TabulatedAtmosphere& operator=(const TabulatedAtmosphere& atm)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param atm The model copied
+ *
+ * @return This model
+ */
+//------------------------------------------------------------------------------
+TabulatedAtmosphere& TabulatedAtmosphere::operator=(
+      const TabulatedAtmosphere& atm)
+{
+   if (this == &atm)
+      return *this;
+
+   while (!unsaved.empty())
+      SaveSlab(unsaved.begin()->first);
+
+   AtmosphereModel::operator=(atm);
+
+   sourceType        = atm.sourceType;
+   tolerance         = atm.tolerance;
+   tableFile         = atm.tableFile;
+   minAltitude       = atm.minAltitude;
+   altitudeCount     = atm.altitudeCount;
+   solarTimeCount    = atm.solarTimeCount;
+   latitudeCount     = atm.latitudeCount;
+   slabs             = atm.slabs;
+   savedRecords      = atm.savedRecords;
+   tableOpened       = atm.tableOpened;
+   utEpoch           = -1.0;
+   utHours           = 0.0;
+   interpolatedCount = 0;
+   directCount       = 0;
+
+   if (source != NULL)
+      delete source;
+   source = (atm.source != NULL ? (AtmosphereModel*)atm.source->Clone() : NULL);
+   for (Integer i = 0; i < 5; ++i)
+      configuredSettings[i] = atm.configuredSettings[i];
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Density(Real *position, Real *density, Real epoch, Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Calculates the density at each of the states in the input vector
+ *
+ * @param position The input vector of spacecraft states
+ * @param density  The array of calculated densities
+ * @param epoch    The current TAIJulian epoch
+ * @param count    The number of spacecraft contained in position
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool TabulatedAtmosphere::Density(Real *position, Real *density, Real epoch,
+                                  Integer count)
+{
+   if (mCentralBody == NULL)
+      throw AtmosphereException(
+         "Central body pointer not set in the " + typeName + " model.");
+
+   ConfigureSource();
+
+   Integer slab = (Integer)floor(epoch / SLAB_SPAN);
+   Real hours = GetUniversalHours(epoch);
+
+   for (Integer i = 0; i < count; ++i)
+   {
+      Real altitude = CalculateGeodetics(&position[i*6], epoch, true);
+      if ((altitude < minAltitude) || (altitude >= MAX_ALTITUDE))
+      {
+         source->Density(&position[i*6], &density[i], epoch, 1);
+         ++directCount;
+         continue;
+      }
+
+      Real solarTime = fmod(hours + geoLong / 15.0, 24.0);
+      if (solarTime < 0.0)
+         solarTime += 24.0;
+      density[i] = Interpolate(slab, altitude, solarTime, geoLat,
+                               &position[i*6], epoch);
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool HasEpochDependentDensity()
+//------------------------------------------------------------------------------
+/**
+ * The grids change with the epoch
+ *
+ * @return true
+ */
+//------------------------------------------------------------------------------
+bool TabulatedAtmosphere::HasEpochDependentDensity()
+{
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Initializes the model and the model tabulated
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool TabulatedAtmosphere::Initialize()
+{
+   bool retval = AtmosphereModel::Initialize();
+   if (source != NULL)
+      retval = source->Initialize() && retval;
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetSolarSystem(SolarSystem *ss)
+//------------------------------------------------------------------------------
+/**
+ * Sets the solar system on the model and the model tabulated
+ *
+ * @param ss The solar system
+ */
+//------------------------------------------------------------------------------
+void TabulatedAtmosphere::SetSolarSystem(SolarSystem *ss)
+{
+   AtmosphereModel::SetSolarSystem(ss);
+   source->SetSolarSystem(ss);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetCentralBody(CelestialBody *cb)
+//------------------------------------------------------------------------------
+/**
+ * Sets the central body on the model and the model tabulated
+ *
+ * @param cb The central body
+ */
+//------------------------------------------------------------------------------
+void TabulatedAtmosphere::SetCentralBody(CelestialBody *cb)
+{
+   AtmosphereModel::SetCentralBody(cb);
+   source->SetCentralBody(cb);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetCentralBody(std::string cbName)
+//------------------------------------------------------------------------------
+/**
+ * Sets the central body on the model and the model tabulated
+ *
+ * @param cbName The name of the central body
+ */
+//------------------------------------------------------------------------------
+void TabulatedAtmosphere::SetCentralBody(std::string cbName)
+{
+   AtmosphereModel::SetCentralBody(cbName);
+   source->SetCentralBody(cbName);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetInternalCoordSystem(CoordinateSystem *cs)
+//------------------------------------------------------------------------------
+/**
+ * Sets the internal coordinate system on the model and the model tabulated
+ *
+ * @param cs The coordinate system
+ */
+//------------------------------------------------------------------------------
+void TabulatedAtmosphere::SetInternalCoordSystem(CoordinateSystem *cs)
+{
+   AtmosphereModel::SetInternalCoordSystem(cs);
+   source->SetInternalCoordSystem(cs);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetCbJ2000CoordinateSystem(CoordinateSystem *cs)
+//------------------------------------------------------------------------------
+/**
+ * Sets the body centered J2000 system on the model and the model tabulated
+ *
+ * @param cs The coordinate system
+ */
+//------------------------------------------------------------------------------
+void TabulatedAtmosphere::SetCbJ2000CoordinateSystem(CoordinateSystem *cs)
+{
+   AtmosphereModel::SetCbJ2000CoordinateSystem(cs);
+   source->SetCbJ2000CoordinateSystem(cs);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterText(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the script label of a parameter
+ *
+ * @param id The parameter ID
+ *
+ * @return The label
+ */
+//------------------------------------------------------------------------------
+std::string TabulatedAtmosphere::GetParameterText(const Integer id) const
+{
+   if ((id >= AtmosphereModelParamCount) && (id < TabulatedAtmosphereParamCount))
+      return PARAMETER_TEXT[id - AtmosphereModelParamCount];
+   return AtmosphereModel::GetParameterText(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetParameterID(const std::string &str) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the ID of a parameter
+ *
+ * @param str The script label of the parameter
+ *
+ * @return The ID
+ */
+//------------------------------------------------------------------------------
+Integer TabulatedAtmosphere::GetParameterID(const std::string &str) const
+{
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, AtmosphereModelParamCount,
+               TabulatedAtmosphereParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
+   return AtmosphereModel::GetParameterID(str);
+}
+
+
+//------------------------------------------------------------------------------
+// Gmat::ParameterType GetParameterType(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the type of a parameter
+ *
+ * @param id The parameter ID
+ *
+ * @return The type
+ */
+//------------------------------------------------------------------------------
+Gmat::ParameterType TabulatedAtmosphere::GetParameterType(
+      const Integer id) const
+{
+   if ((id >= AtmosphereModelParamCount) && (id < TabulatedAtmosphereParamCount))
+      return PARAMETER_TYPE[id - AtmosphereModelParamCount];
+   return AtmosphereModel::GetParameterType(id);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterTypeString(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the type of a parameter as a string
+ *
+ * @param id The parameter ID
+ *
+ * @return The type string
+ */
+//------------------------------------------------------------------------------
+std::string TabulatedAtmosphere::GetParameterTypeString(const Integer id) const
+{
+   return GmatBase::PARAM_TYPE_STRING[GetParameterType(id)];
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetRealParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Returns a Real parameter
+ *
+ * @param id The parameter ID
+ *
+ * @return The value
+ */
+//------------------------------------------------------------------------------
+Real TabulatedAtmosphere::GetRealParameter(const Integer id) const
+{
+   if (id == DENSITY_TABLE_TOLERANCE)
+      return tolerance;
+   return AtmosphereModel::GetRealParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Real SetRealParameter(const Integer id, const Real value)
+//------------------------------------------------------------------------------
+/**
+ * Sets a Real parameter; the atmosphere model settings are passed to the
+ * model tabulated
+ *
+ * @param id    The parameter ID
+ * @param value The new value
+ *
+ * @return The value set
+ */
+//------------------------------------------------------------------------------
+Real TabulatedAtmosphere::SetRealParameter(const Integer id, const Real value)
+{
+   if (id == DENSITY_TABLE_TOLERANCE)
+   {
+      if (value <= 0.0)
+      {
+         std::stringstream msg;
+         msg << "The density table tolerance " << value << " on " << instanceName
+             << " is not valid; it must be greater than 0";
+         throw AtmosphereException(msg.str());
+      }
+      if (value != tolerance)
+         ClearTable();
+      tolerance = value;
+      return tolerance;
+   }
+
+   if (id < AtmosphereModelParamCount)
+   {
+      if ((id >= GmatBaseParamCount) &&
+          (AtmosphereModel::GetRealParameter(id) != value))
+         ClearTable();
+      source->SetRealParameter(id, value);
+   }
+   return AtmosphereModel::SetRealParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetStringParameter(const Integer id, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets a string parameter; the atmosphere model settings are passed to the
+ * model tabulated
+ *
+ * @param id    The parameter ID
+ * @param value The new value
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool TabulatedAtmosphere::SetStringParameter(const Integer id,
+                                             const std::string &value)
+{
+   if (id == DENSITY_TABLE_FILE)
+   {
+      if (value != tableFile)
+         ClearTable();
+      tableFile = value;
+      return true;
+   }
+
+   if (id < AtmosphereModelParamCount)
+   {
+      if ((id >= GmatBaseParamCount) &&
+          (AtmosphereModel::GetStringParameter(id) != value))
+         ClearTable();
+      source->SetStringParameter(id, value);
+   }
+   return AtmosphereModel::SetStringParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetStringParameter(const std::string &label, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets a string parameter using its script label
+ *
+ * @param label The script label
+ * @param value The new value
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool TabulatedAtmosphere::SetStringParameter(const std::string &label,
+                                             const std::string &value)
+{
+   return SetStringParameter(GetParameterID(label), value);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetStringParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Returns a string parameter
+ *
+ * @param id The parameter ID
+ *
+ * @return The value
+ */
+//------------------------------------------------------------------------------
+std::string TabulatedAtmosphere::GetStringParameter(const Integer id) const
+{
+   if (id == DENSITY_TABLE_FILE)
+      return tableFile;
+   return AtmosphereModel::GetStringParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetStringParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Returns a string parameter using its script label
+ *
+ * @param label The script label
+ *
+ * @return The value
+ */
+//------------------------------------------------------------------------------
+std::string TabulatedAtmosphere::GetStringParameter(
+      const std::string &label) const
+{
+   return GetStringParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+// GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Clone the object (inherited from GmatBase).
+ *
+ * @return a clone of "this" object.
+ */
+//------------------------------------------------------------------------------
+GmatBase* TabulatedAtmosphere::Clone() const
+{
+   return (new TabulatedAtmosphere(*this));
+}
+
+
+//------------------------------------------------------------------------------
+//  protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void ConfigureSource()
+//------------------------------------------------------------------------------
+/**
+ * Passes the settings made through the non-virtual AtmosphereModel methods to
+ * the model tabulated.  A change of the space weather settings discards the
+ * nodes held.
+ */
+//------------------------------------------------------------------------------
+void TabulatedAtmosphere::ConfigureSource()
+{
+   source->SetSunVector(sunVector);
+   source->SetCentralBodyVector(centralBodyLocation);
+   source->SetUpdateParameters(wUpdateInterval);
+   if (cbFixed != NULL)
+      source->SetFixedCoordinateSystem(cbFixed);
+
+   Integer settings[5] = { historicalDataSource, predictedDataSource,
+                           schattenTimingModel, schattenErrorModel,
+                           kpApConversion };
+   if (std::equal(settings, settings + 5, configuredSettings))
+      return;
+
+   static const std::string fluxSources[3] =
+      { "ConstantFluxAndGeoMag", "CSSISpaceWeatherFile", "SchattenFile" };
+   static const std::string timings[3] =
+      { "EarlyCycle", "NominalCycle", "LateCycle" };
+   static const std::string errors[3] =
+      { "MinusTwoSigma", "Nominal", "PlusTwoSigma" };
+
+   ClearTable();
+   source->SetInputSource(fluxSources[historicalDataSource],
+                          fluxSources[predictedDataSource]);
+   source->SetSchattenFlags(timings[schattenTimingModel + 1],
+                            errors[schattenErrorModel + 1]);
+   source->SetKpApConversionMethod(kpApConversion);
+   std::copy(settings, settings + 5, configuredSettings);
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetUniversalHours(Real epoch)
+//------------------------------------------------------------------------------
+/**
+ * Returns the UTC time of day
+ *
+ * @param epoch The A.1 modified Julian epoch
+ *
+ * @return The time of day, in hours
+ */
+//------------------------------------------------------------------------------
+Real TabulatedAtmosphere::GetUniversalHours(Real epoch)
+{
+   if (epoch != utEpoch)
+   {
+      Real utc = theTimeConverter->Convert(epoch, TimeSystemConverter::A1MJD,
+            TimeSystemConverter::UTCMJD, GmatTimeConstants::JD_JAN_5_1941);
+      // GMAT modified Julian dates start at noon
+      Real dayFraction = utc + 0.5 - floor(utc + 0.5);
+      utHours = 24.0 * dayFraction;
+      utEpoch = epoch;
+   }
+   return utHours;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Interpolate(Integer slab, Real altitude, Real solarTime, Real latitude,
+//                  Real *position, Real epoch)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the density in a grid, or evaluates the model tabulated where
+ * the grid cell misses the tolerance
+ *
+ * @param slab      The slab index
+ * @param altitude  The geodetic altitude, in km
+ * @param solarTime The local mean solar time, in hours between 0 and 24
+ * @param latitude  The geodetic latitude, in degrees
+ * @param position  The state passed to the model tabulated if needed
+ * @param epoch     The epoch of the state
+ *
+ * @return The density
+ */
+//------------------------------------------------------------------------------
+Real TabulatedAtmosphere::Interpolate(Integer slab, Real altitude,
+      Real solarTime, Real latitude, Real *position, Real epoch)
+{
+   Real fa = (altitude - minAltitude) / ALTITUDE_STEP;
+   Integer ia = std::min((Integer)fa, altitudeCount - 2);
+   fa -= ia;
+   Real ft = solarTime / SOLAR_TIME_STEP;
+   Integer it = std::min((Integer)ft, solarTimeCount - 1);
+   ft -= it;
+   Real fl = (latitude + 90.0) / LATITUDE_STEP;
+   Integer il = std::max(std::min((Integer)fl, latitudeCount - 2), 0);
+   fl -= il;
+
+   Real corner[8];
+   for (Integer k = 0; k < 8; ++k)
+      corner[k] = GetNode(slab, ia + (k >> 2),
+                          (it + ((k >> 1) & 1)) % solarTimeCount, il + (k & 1));
+
+   SlabValues &values = GetSlab(slab);
+   Integer cell = altitudeCount * solarTimeCount * latitudeCount +
+                  (ia * solarTimeCount + it) * latitudeCount + il;
+   SlabValues::iterator test = values.find(cell);
+   if (test == values.end())
+   {
+      Real center = 0.0;
+      for (Integer k = 0; k < 8; ++k)
+         center += 0.125 * corner[k];
+      Real slabEpoch = (slab + 0.5) * SLAB_SPAN;
+      Real exact = EvaluateSource(minAltitude + (ia + 0.5) * ALTITUDE_STEP,
+            (it + 0.5) * SOLAR_TIME_STEP,
+            -90.0 + (il + 0.5) * LATITUDE_STEP, slabEpoch);
+      Real passed = ((exact > 0.0) &&
+            (fabs(exp(center) - exact) <= tolerance * exact) ? 1.0 : 0.0);
+
+      #ifdef DEBUG_TABULATED_ATMOSPHERE
+         if (passed == 0.0)
+            MessageInterface::ShowMessage("Cell at %.1lf km, %.1lf h, %.1lf "
+                  "deg of slab %d misses the tolerance: %le against %le\n",
+                  minAltitude + ia * ALTITUDE_STEP, it * SOLAR_TIME_STEP,
+                  -90.0 + il * LATITUDE_STEP, slab, exp(center), exact);
+      #endif
+
+      test = values.insert(std::make_pair(cell, passed)).first;
+      unsaved[slab][cell] = passed;
+   }
+
+   if (test->second == 0.0)
+   {
+      Real density;
+      source->Density(position, &density, epoch, 1);
+      ++directCount;
+      return density;
+   }
+
+   Real w[2][3] = { { 1.0 - fa, 1.0 - ft, 1.0 - fl }, { fa, ft, fl } };
+   Real logDensity = 0.0;
+   for (Integer k = 0; k < 8; ++k)
+      logDensity += w[k >> 2][0] * w[(k >> 1) & 1][1] * w[k & 1][2] * corner[k];
+   ++interpolatedCount;
+
+   return exp(logDensity);
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetNode(Integer slab, Integer ia, Integer it, Integer il)
+//------------------------------------------------------------------------------
+/**
+ * Returns the log density at a node, evaluating it if needed
+ *
+ * @param slab The slab index
+ * @param ia   The altitude index
+ * @param it   The local solar time index
+ * @param il   The latitude index
+ *
+ * @return The natural log of the density
+ */
+//------------------------------------------------------------------------------
+Real TabulatedAtmosphere::GetNode(Integer slab, Integer ia, Integer it,
+                                  Integer il)
+{
+   SlabValues &values = GetSlab(slab);
+   Integer index = (ia * solarTimeCount + it) * latitudeCount + il;
+
+   SlabValues::iterator node = values.find(index);
+   if (node != values.end())
+      return node->second;
+
+   Real density = EvaluateSource(minAltitude + ia * ALTITUDE_STEP,
+         it * SOLAR_TIME_STEP, -90.0 + il * LATITUDE_STEP,
+         (slab + 0.5) * SLAB_SPAN);
+   Real logDensity = log(std::max(density, 1.0e-300));
+
+   values[index] = logDensity;
+   unsaved[slab][index] = logDensity;
+   return logDensity;
+}
+
+
+//------------------------------------------------------------------------------
+// Real EvaluateSource(Real altitude, Real solarTime, Real latitude, Real epoch)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the model tabulated at a geodetic location
+ *
+ * @param altitude  The geodetic altitude, in km
+ * @param solarTime The local mean solar time, in hours
+ * @param latitude  The geodetic latitude, in degrees
+ * @param epoch     The A.1 modified Julian epoch
+ *
+ * @return The density
+ */
+//------------------------------------------------------------------------------
+Real TabulatedAtmosphere::EvaluateSource(Real altitude, Real solarTime,
+                                         Real latitude, Real epoch)
+{
+   Real lat = latitude * GmatMathConstants::RAD_PER_DEG;
+   Real lon = 15.0 * (solarTime - GetUniversalHours(epoch)) *
+              GmatMathConstants::RAD_PER_DEG;
+
+   Real ecc2 = cbFlattening * (2.0 - cbFlattening);
+   Real sinlat = sin(lat);
+   Real cFactor = cbRadius / sqrt(1.0 - ecc2 * sinlat * sinlat);
+
+   Real fixed[6] = { (cFactor + altitude) * cos(lat) * cos(lon),
+                     (cFactor + altitude) * cos(lat) * sin(lon),
+                     (cFactor * (1.0 - ecc2) + altitude) * sinlat,
+                     0.0, 0.0, 0.0 };
+   Real state[6];
+
+   CoordinateSystem *j2000ToUse = (cbJ2000 == NULL ? mInternalCoordSystem :
+                                   cbJ2000);
+   CoordinateConverter converter;
+   converter.Convert(A1Mjd(epoch), fixed, cbFixed, state, j2000ToUse);
+
+   Real density;
+   source->Density(state, &density, epoch, 1);
+   ++directCount;
+   return density;
+}
+
+
+//------------------------------------------------------------------------------
+// SlabValues& GetSlab(Integer slab)
+//------------------------------------------------------------------------------
+/**
+ * Returns the values of a slab, reading its saved records when it is not held
+ *
+ * When MAX_SLABS_HELD slabs are held, the farthest from the requested one is
+ * saved and released.
+ *
+ * @param slab The slab index
+ *
+ * @return The values held for the slab
+ */
+//------------------------------------------------------------------------------
+TabulatedAtmosphere::SlabValues& TabulatedAtmosphere::GetSlab(Integer slab)
+{
+   std::map<Integer, SlabValues>::iterator held = slabs.find(slab);
+   if (held != slabs.end())
+      return held->second;
+
+   if ((Integer)slabs.size() >= MAX_SLABS_HELD)
+   {
+      std::map<Integer, SlabValues>::iterator farthest = slabs.begin();
+      if (slab - slabs.begin()->first < slabs.rbegin()->first - slab)
+         farthest = --slabs.end();
+      SaveSlab(farthest->first);
+      slabs.erase(farthest);
+   }
+
+   SlabValues &values = slabs[slab];
+
+   if ((tableFile != "") && !tableOpened)
+      OpenTable();
+
+   std::map<Integer, std::vector<std::streamoff> >::iterator records =
+         savedRecords.find(slab);
+   if (records != savedRecords.end())
+   {
+      std::lock_guard<std::mutex> lock(fileMutex);
+      std::ifstream in(tableFile.c_str(), std::ios::binary);
+      for (UnsignedInt r = 0; r < records->second.size(); ++r)
+      {
+         std::int64_t recordSlab;
+         std::int32_t count, index;
+         Real value;
+         in.seekg(records->second[r]);
+         in.read((char*)&recordSlab, sizeof(recordSlab));
+         in.read((char*)&count, sizeof(count));
+         for (std::int32_t j = 0; (j < count) && in; ++j)
+         {
+            in.read((char*)&index, sizeof(index));
+            in.read((char*)&value, sizeof(value));
+            if (in)
+               values[index] = value;
+         }
+         in.clear();
+      }
+   }
+
+   return values;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetTableSettings()
+//------------------------------------------------------------------------------
+/**
+ * Describes the settings the nodes depend on, for the table file header
+ *
+ * @return The settings, on one line
+ */
+//------------------------------------------------------------------------------
+std::string TabulatedAtmosphere::GetTableSettings()
+{
+   std::stringstream settings;
+   settings.precision(17);
+   settings << sourceType << " " << centralBody << " " << minAltitude << " "
+            << MAX_ALTITUDE << " " << ALTITUDE_STEP << " " << SOLAR_TIME_STEP
+            << " " << LATITUDE_STEP << " " << SLAB_SPAN << " " << tolerance
+            << " " << nominalF107 << " " << nominalF107a << " " << nominalKp
+            << " " << historicalDataSource << " " << predictedDataSource << " "
+            << schattenTimingModel << " " << schattenErrorModel << " "
+            << kpApConversion << " " << obsFileName << " " << predictFileName;
+   return settings.str();
+}
+
+
+//------------------------------------------------------------------------------
+// void OpenTable()
+//------------------------------------------------------------------------------
+/**
+ * Finds the records of the table file, or starts the file when it is missing
+ * or was built with other settings
+ */
+//------------------------------------------------------------------------------
+void TabulatedAtmosphere::OpenTable()
+{
+   std::lock_guard<std::mutex> lock(fileMutex);
+
+   tableOpened = true;
+   savedRecords.clear();
+   std::string settings = GetTableSettings();
+
+   bool matches = false;
+   std::ifstream in(tableFile.c_str(), std::ios::binary);
+   if (in)
+   {
+      std::string tag, line;
+      std::getline(in, tag);
+      std::getline(in, line);
+      matches = (in && (tag == TABLE_TAG) && (line == settings));
+
+      while (matches)
+      {
+         std::streamoff at = in.tellg();
+         std::int64_t slab;
+         std::int32_t count;
+         in.read((char*)&slab, sizeof(slab));
+         in.read((char*)&count, sizeof(count));
+         if (!in)
+            break;
+         savedRecords[(Integer)slab].push_back(at);
+         in.seekg(count * (sizeof(std::int32_t) + sizeof(Real)), std::ios::cur);
+      }
+   }
+   in.close();
+
+   #ifdef DEBUG_TABULATED_ATMOSPHERE
+      MessageInterface::ShowMessage("Density table %s: %d slabs saved%s\n",
+            tableFile.c_str(), (Integer)savedRecords.size(),
+            (matches ? "" : ", restarting it"));
+   #endif
+
+   if (!matches)
+   {
+      std::ofstream out(tableFile.c_str(), std::ios::binary | std::ios::trunc);
+      if (!out)
+         throw AtmosphereException("The density table file " + tableFile +
+               " set on " + instanceName + " cannot be written");
+      out << TABLE_TAG << "\n" << settings << "\n";
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SaveSlab(Integer slab)
+//------------------------------------------------------------------------------
+/**
+ * Appends the values computed for a slab to the table file
+ *
+ * @param slab The slab index
+ */
+//------------------------------------------------------------------------------
+void TabulatedAtmosphere::SaveSlab(Integer slab)
+{
+   std::map<Integer, SlabValues>::iterator values = unsaved.find(slab);
+   if (values == unsaved.end())
+      return;
+
+   if ((tableFile != "") && tableOpened && !values->second.empty())
+   {
+      std::lock_guard<std::mutex> lock(fileMutex);
+      std::ofstream out(tableFile.c_str(), std::ios::binary | std::ios::app);
+      out.seekp(0, std::ios::end);
+      std::streamoff at = out.tellp();
+
+      std::int64_t recordSlab = slab;
+      std::int32_t count = (std::int32_t)values->second.size();
+      out.write((const char*)&recordSlab, sizeof(recordSlab));
+      out.write((const char*)&count, sizeof(count));
+      for (SlabValues::iterator v = values->second.begin();
+           v != values->second.end(); ++v)
+      {
+         std::int32_t index = v->first;
+         out.write((const char*)&index, sizeof(index));
+         out.write((const char*)&v->second, sizeof(v->second));
+      }
+      if (out)
+         savedRecords[slab].push_back(at);
+   }
+
+   unsaved.erase(values);
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearTable()
+//------------------------------------------------------------------------------
+/**
+ * Saves and releases the slabs, when settings the nodes depend on change
+ */
+//------------------------------------------------------------------------------
+void TabulatedAtmosphere::ClearTable()
+{
+   while (!unsaved.empty())
+      SaveSlab(unsaved.begin()->first);
+   slabs.clear();
+   savedRecords.clear();
+   tableOpened = false;
+}
@@ -0,0 +1,175 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TabulatedAtmosphere
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the TabulatedAtmosphere class, which interpolates the density
+ * of an MSISE90 or Jacchia-Roberts model from a lazily built grid.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef TabulatedAtmosphere_hpp
+#define TabulatedAtmosphere_hpp
+
+#include "AtmosphereModel.hpp"
+#include <map>
+#include <unordered_map>
+#include <mutex>
+
+/**
+ * Density interpolated from a grid sampled from another atmosphere model
+ *
+ * The grid spans geodetic altitude, local mean solar time and geodetic
+ * latitude.  It is rebuilt for each SLAB_SPAN of epochs, the cadence of the
+ * geomagnetic indices, so the solar flux and the season enter through the
+ * slab.  The logarithm of the density is interpolated trilinearly.
+ *
+ * The nodes are evaluated from the source model the first time they are
+ * needed, so only the cells the spacecraft cross are sampled.  The first
+ * use of a cell compares the interpolated density at its center with the
+ * source model; cells that miss the tolerance use the source model
+ * directly.  Altitudes outside the grid also use the source model.
+ *
+ * When a table file is set, the nodes are saved to it and read back by later
+ * runs with the same model, grid, tolerance and space weather settings.
+ */
+class GMAT_API TabulatedAtmosphere : public AtmosphereModel
+{
+public:
+   TabulatedAtmosphere(const std::string &sourceType,
+                       const std::string &name = "");
+   virtual ~TabulatedAtmosphere();
+   TabulatedAtmosphere(const TabulatedAtmosphere& atm);
+   TabulatedAtmosphere&    operator=(const TabulatedAtmosphere& atm);
+
+   virtual bool            Density(Real *position, Real *density,
+                                   Real epoch = GmatTimeConstants::MJD_OF_J2000,
+                                   Integer count = 1);
+   virtual bool            HasEpochDependentDensity();
+
+   virtual bool            Initialize();
+   virtual void            SetSolarSystem(SolarSystem *ss);
+   virtual void            SetCentralBody(CelestialBody *cb);
+   virtual void            SetCentralBody(std::string cbName);
+   virtual void            SetInternalCoordSystem(CoordinateSystem *cs);
+   virtual void            SetCbJ2000CoordinateSystem(CoordinateSystem *cs);
+
+   virtual std::string     GetParameterText(const Integer id) const;
+   virtual Integer         GetParameterID(const std::string &str) const;
+   virtual Gmat::ParameterType
+                           GetParameterType(const Integer id) const;
+   virtual std::string     GetParameterTypeString(const Integer id) const;
+
+   virtual Real            GetRealParameter(const Integer id) const;
+   virtual Real            SetRealParameter(const Integer id,
+                                            const Real value);
+   virtual bool            SetStringParameter(const Integer id,
+                                              const std::string &value);
+   virtual bool            SetStringParameter(const std::string &label,
+                                              const std::string &value);
+   virtual std::string     GetStringParameter(const Integer id) const;
+   virtual std::string     GetStringParameter(const std::string &label) const;
+
+   virtual GmatBase*       Clone() const;
+
+   /// Epochs covered by one grid, in days
+   static const Real       SLAB_SPAN;
+   /// Node spacings: altitude (km), local solar time (hours), latitude (deg)
+   static const Real       ALTITUDE_STEP;
+   static const Real       SOLAR_TIME_STEP;
+   static const Real       LATITUDE_STEP;
+   /// Highest altitude tabulated, in km
+   static const Real       MAX_ALTITUDE;
+   /// Number of slabs held in memory
+   static const Integer    MAX_SLABS_HELD = 8;
+
+protected:
+   /// Grid values of one slab: log densities of the nodes, and the tolerance
+   /// test results of the cells offset by the node count
+   typedef std::unordered_map<Integer, Real> SlabValues;
+
+   /// Type of the model sampled
+   std::string             sourceType;
+   /// The model sampled
+   AtmosphereModel         *source;
+   /// Relative density error allowed at the cell centers
+   Real                    tolerance;
+   /// Path of the file the nodes are kept in, or empty for none
+   std::string             tableFile;
+
+   /// Lowest altitude tabulated, in km
+   Real                    minAltitude;
+   /// Node counts along altitude, local solar time and latitude
+   Integer                 altitudeCount;
+   Integer                 solarTimeCount;
+   Integer                 latitudeCount;
+
+   /// Slabs held, keyed by slab index
+   std::map<Integer, SlabValues>
+                           slabs;
+   /// Values computed in this run, written when their slab is released
+   std::map<Integer, SlabValues>
+                           unsaved;
+   /// File offsets of the saved records of each slab
+   std::map<Integer, std::vector<std::streamoff> >
+                           savedRecords;
+   /// True once the table file was checked against the settings
+   bool                    tableOpened;
+   /// Epoch and universal time of day (hours) of the last Density() call
+   Real                    utEpoch;
+   Real                    utHours;
+   /// Flux sources, Schatten models and Kp to Ap method passed to the source
+   Integer                 configuredSettings[5];
+
+   /// Counts of densities interpolated and evaluated by the source model
+   Integer                 interpolatedCount;
+   Integer                 directCount;
+
+   /// Serializes the writes of the objects sharing a table file
+   static std::mutex       fileMutex;
+
+   void                    ConfigureSource();
+   Real                    GetUniversalHours(Real epoch);
+   Real                    Interpolate(Integer slab, Real altitude,
+                                       Real solarTime, Real latitude,
+                                       Real *position, Real epoch);
+   Real                    GetNode(Integer slab, Integer ia, Integer it,
+                                   Integer il);
+   Real                    EvaluateSource(Real altitude, Real solarTime,
+                                          Real latitude, Real epoch);
+   SlabValues&             GetSlab(Integer slab);
+   std::string             GetTableSettings();
+   void                    OpenTable();
+   void                    SaveSlab(Integer slab);
+   void                    ClearTable();
+
+   enum
+   {
+      DENSITY_TABLE_FILE = AtmosphereModelParamCount,
+      DENSITY_TABLE_TOLERANCE,
+      TabulatedAtmosphereParamCount
+   };
+
+   static const std::string
+      PARAMETER_TEXT[TabulatedAtmosphereParamCount - AtmosphereModelParamCount];
+   static const Gmat::ParameterType
+      PARAMETER_TYPE[TabulatedAtmosphereParamCount - AtmosphereModelParamCount];
+};
+
+#endif // TabulatedAtmosphere_hpp
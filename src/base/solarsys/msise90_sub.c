@@ -12,16 +12,28 @@
 
 #include "f2c.h"
 
+/* The common blocks and SAVEd locals below that change between calls are
+   kept per thread, so gtd6_ can be evaluated concurrently from several
+   threads.  The coefficient tables in lower6_, parm6_ and mavg6_ are only
+   read and remain shared. */
+#if defined(_MSC_VER)
+#define MSIS_TLS __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define MSIS_TLS __thread
+#else
+#define MSIS_TLS _Thread_local
+#endif
+
 /* Common Block Declarations */
 
-struct {
+MSIS_TLS struct {
     real tlb, s, db04, db16, db28, db32, db40, db48, db01, za, t0, z0, g0, rl,
 	     dd, db14, tr12;
 } gts3c_;
 
 #define gts3c_1 gts3c_
 
-struct {
+MSIS_TLS struct {
     real tn1[5], tn2[4], tn3[5], tgn1[2], tgn2[2], tgn3[2];
 } meso6_;
 
@@ -53,19 +65,19 @@ struct parm6_2_ {
 #define parm6_1 (*(struct parm6_1_ *) &parm6_)
 #define parm6_2 (*(struct parm6_2_ *) &parm6_)
 
-struct {
+MSIS_TLS struct {
     integer isd[3], ist[2], nam[2];
 } datim6_;
 
 #define datim6_1 datim6_
 
-struct {
+MSIS_TLS struct {
     integer isdate[3], istime[2], name__[2];
 } datime_;
 
 #define datime_1 datime_
 
-struct {
+MSIS_TLS struct {
     real sw[25];
     integer isw;
     real swc[25];
@@ -79,13 +91,13 @@ struct mavg6_1_ {
 
 #define mavg6_1 (*(struct mavg6_1_ *) &mavg6_)
 
-struct {
+MSIS_TLS struct {
     real dm04, dm16, dm28, dm32, dm40, dm01, dm14;
 } dmix_;
 
 #define dmix_1 dmix_
 
-struct {
+MSIS_TLS struct {
     real gsurf, re;
 } parmb_;
 
@@ -97,7 +109,7 @@ struct metsel_1_ {
 
 #define metsel_1 (*(struct metsel_1_ *) &metsel_)
 
-union {
+MSIS_TLS union {
     struct {
 	real tinfg, gb, rout, tt[15];
     } _1;
@@ -109,7 +121,7 @@ union {
 #define ttest_1 (ttest_._1)
 #define ttest_2 (ttest_._2)
 
-union {
+MSIS_TLS union {
     struct {
 	real plg[36]	/* was [9][4] */, ctloc, stloc, c2tloc, s2tloc, 
 		c3tloc, s3tloc;
@@ -127,7 +139,7 @@ union {
 #define lpoly_1 (lpoly_._1)
 #define lpoly_2 (lpoly_._2)
 
-struct {
+MSIS_TLS struct {
     integer mp, ii, jg, lt;
     real qpb[50];
     integer ierr, ifun, n, j;
@@ -136,7 +148,7 @@ struct {
 
 #define lsqv_1 lsqv_
 
-struct {
+MSIS_TLS struct {
     real taf;
 } fit_;
 
@@ -144,7 +156,7 @@ struct {
 
 /* Initialized data */
 
-struct {
+MSIS_TLS struct {
     integer e_1;
     } metsel_ = { 0 };
 
@@ -561,26 +573,26 @@ static integer c__4 = 4;
 {
     /* Initialized data */
 
-    static integer mn3 = 5;
-    static real zn3[5] = { 32.5f,20.f,15.f,10.f,0.f };
-    static integer mn2 = 4;
-    static real zn2[4] = { 72.5f,55.f,45.f,32.5f };
-    static real zmix = 62.5f;
-    static real alast = 99999.f;
-    static integer mssl = -999;
-    static real sv[25] = { 1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,
+    static MSIS_TLS integer mn3 = 5;
+    static MSIS_TLS real zn3[5] = { 32.5f,20.f,15.f,10.f,0.f };
+    static MSIS_TLS integer mn2 = 4;
+    static MSIS_TLS real zn2[4] = { 72.5f,55.f,45.f,32.5f };
+    static MSIS_TLS real zmix = 62.5f;
+    static MSIS_TLS real alast = 99999.f;
+    static MSIS_TLS integer mssl = -999;
+    static MSIS_TLS real sv[25] = { 1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,
 	    1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f };
 
     /* System generated locals */
     real r__1;
 
     /* Local variables */
-    static integer i__, j;
-    static real d6[8], v1, t6[2], tz, dmc, dmr, dz28, xmm;
-    static integer mss;
+    static MSIS_TLS integer i__, j;
+    static MSIS_TLS real d6[8], v1, t6[2], tz, dmc, dmr, dz28, xmm;
+    static MSIS_TLS integer mss;
     extern /* Subroutine */ int gts6_(integer *, real *, real *, real *, real 
 	    *, real *, real *, real *, real *, integer *, real *, real *);
-    static real dm28m, altt, xlat;
+    static MSIS_TLS real dm28m, altt, xlat;
     extern doublereal vtst_(integer *, real *, real *, real *, real *, real *,
 	     real *, real *, integer *);
     extern /* Subroutine */ int glatf_(real *, real *, real *);
@@ -853,9 +865,9 @@ L90:
 {
     /* Initialized data */
 
-    static real bm = 1.3806e-19f;
-    static real rgas = 831.4f;
-    static real test = 4.3e-4f;
+    static MSIS_TLS real bm = 1.3806e-19f;
+    static MSIS_TLS real rgas = 831.4f;
+    static MSIS_TLS real test = 4.3e-4f;
 
     /* Format strings */
     static char fmt_100[] = "(1x,\002GHP6 NOT CONVERGING FOR PRESS\002,1pe12"
@@ -869,13 +881,13 @@ L90:
     integer s_wsfe(cilist *), do_fio(integer *, char *, ftnlen), e_wsfe(void);
 
     /* Local variables */
-    static real g;
-    static integer l;
-    static real p, z__, ca, cd, cl, sh, pl, zi, xm, xn, cl2;
+    static MSIS_TLS real g;
+    static MSIS_TLS integer l;
+    static MSIS_TLS real p, z__, ca, cd, cl, sh, pl, zi, xm, xn, cl2;
     extern /* Subroutine */ int gtd6_(integer *, real *, real *, real *, real 
 	    *, real *, real *, real *, real *, integer *, real *, real *);
-    static real diff;
-    static integer iday;
+    static MSIS_TLS real diff;
+    static MSIS_TLS integer iday;
 
     /* Fortran I/O blocks */
     static cilist io___41 = { 0, 6, 0, fmt_100, 0 };
@@ -1011,14 +1023,14 @@ L20:
 {
     /* Initialized data */
 
-    static real dgtr = .0174533f;
-    static real latl = -999.f;
+    static MSIS_TLS real dgtr = .0174533f;
+    static MSIS_TLS real latl = -999.f;
 
     /* Builtin functions */
     double cos(doublereal);
 
     /* Local variables */
-    static real c2;
+    static MSIS_TLS real c2;
 
 /*      CALCULATE LATITUDE VARIABLE GRAVITY (GV) AND EFFECTIVE */
 /*      RADIUS (REFF) */
@@ -1037,24 +1049,24 @@ doublereal vtst_(integer *iyd, real *sec, real *glat, real *glong, real *stl,
 {
     /* Initialized data */
 
-    static integer iydl[2] = { -999,-999 };
-    static real secl[2] = { -999.f,-999.f };
-    static real glatl[2] = { -999.f,-999.f };
-    static real gll[2] = { -999.f,-999.f };
-    static real stll[2] = { -999.f,-999.f };
-    static real fal[2] = { -999.f,-999.f };
-    static real fl[2] = { -999.f,-999.f };
-    static real apl[14]	/* was [7][2] */ = { -999.f,-999.f,-999.f,-999.f,
+    static MSIS_TLS integer iydl[2] = { -999,-999 };
+    static MSIS_TLS real secl[2] = { -999.f,-999.f };
+    static MSIS_TLS real glatl[2] = { -999.f,-999.f };
+    static MSIS_TLS real gll[2] = { -999.f,-999.f };
+    static MSIS_TLS real stll[2] = { -999.f,-999.f };
+    static MSIS_TLS real fal[2] = { -999.f,-999.f };
+    static MSIS_TLS real fl[2] = { -999.f,-999.f };
+    static MSIS_TLS real apl[14]	/* was [7][2] */ = { -999.f,-999.f,-999.f,-999.f,
 	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
 	    -999.f };
-    static real swl[50]	/* was [25][2] */ = { -999.f,-999.f,-999.f,-999.f,
+    static MSIS_TLS real swl[50]	/* was [25][2] */ = { -999.f,-999.f,-999.f,-999.f,
 	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
 	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
 	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
 	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
 	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
 	    -999.f };
-    static real swcl[50]	/* was [25][2] */ = { -999.f,-999.f,-999.f,
+    static MSIS_TLS real swcl[50]	/* was [25][2] */ = { -999.f,-999.f,-999.f,
 	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
 	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
 	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
@@ -1066,7 +1078,7 @@ doublereal vtst_(integer *iyd, real *sec, real *glat, real *glong, real *stl,
     real ret_val;
 
     /* Local variables */
-    static integer i__;
+    static MSIS_TLS integer i__;
 
 /*       Test if geophysical variables or switches changed and save */
 /*       Return 0 if unchanged and 1 if changed */
@@ -1141,13 +1153,13 @@ L20:
 {
     /* Initialized data */
 
-    static integer mt[10] = { 48,0,4,16,28,32,40,1,49,14 };
-    static real altl[8] = { 200.f,400.f,160.f,200.f,240.f,450.f,320.f,450.f };
-    static integer mn1 = 5;
-    static real zn1[5] = { 120.f,110.f,100.f,90.f,72.5f };
-    static real dgtr = .0174533f;
-    static real dr = .0172142f;
-    static real alast = -999.f;
+    static MSIS_TLS integer mt[10] = { 48,0,4,16,28,32,40,1,49,14 };
+    static MSIS_TLS real altl[8] = { 200.f,400.f,160.f,200.f,240.f,450.f,320.f,450.f };
+    static MSIS_TLS integer mn1 = 5;
+    static MSIS_TLS real zn1[5] = { 120.f,110.f,100.f,90.f,72.5f };
+    static MSIS_TLS real dgtr = .0174533f;
+    static MSIS_TLS real dr = .0172142f;
+    static MSIS_TLS real alast = -999.f;
 
     /* Format strings */
     static char fmt_100[] = "(1x,\002MASS\002,i5,\002  NOT VALID\002)";
@@ -1161,16 +1173,16 @@ L20:
     double exp(doublereal), log(doublereal);
 
     /* Local variables */
-    static integer i__, j;
-    static real g1, g4, v2, b01, b04, b32, b16, g40, b28, g32, g16, b40, g14, 
+    static MSIS_TLS integer i__, j;
+    static MSIS_TLS real g1, g4, v2, b01, b04, b32, b16, g40, b28, g32, g16, b40, g14, 
 	    g28, b14, tz, hc04, hc32, hc16, rc16, day, zc04, zh04, zlb, zhf, 
 	    yrd, xmm, zh28, xmd, zh16, zc16, zh32, zc32, zh40, hc40, zc40, 
 	    zh01, hc01, zc01, rc01, zh14, hc14, zc14, rc14, hcc01, hcc14, 
 	    hcc16, zcc01, zcc14;
     extern doublereal ccor_(real *, real *, real *, real *);
-    static real zcc16, ddum;
+    static MSIS_TLS real zcc16, ddum;
     extern doublereal dnet_(real *, real *, real *, real *, real *);
-    static real zhm01, tinf, zhm04, zhm32, zhm16, zhm40, zhm14, zhm28;
+    static MSIS_TLS real zhm01, tinf, zhm04, zhm32, zhm16, zhm40, zhm14, zhm28;
     extern doublereal vtst_(integer *, real *, real *, real *, real *, real *,
 	     real *, real *, integer *), densu_(real *, real *, real *, real *
 	    , real *, real *, real *, real *, real *, integer *, real *, real 
@@ -1704,22 +1716,22 @@ doublereal globe6_(real *yrd, real *sec, real *lat, real *long__, real *tloc,
 {
     /* Initialized data */
 
-    static real dgtr = .0174533f;
-    static real dr = .0172142f;
-    static real xl = 1e3f;
-    static real tll = 1e3f;
-    static real sw9 = 1.f;
-    static real dayl = -1.f;
-    static real p14 = -1e3f;
-    static real p18 = -1e3f;
-    static real p32 = -1e3f;
-    static real hr = .2618f;
-    static real sr = 7.2722e-5f;
-    static real sv[25] = { 1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,
+    static MSIS_TLS real dgtr = .0174533f;
+    static MSIS_TLS real dr = .0172142f;
+    static MSIS_TLS real xl = 1e3f;
+    static MSIS_TLS real tll = 1e3f;
+    static MSIS_TLS real sw9 = 1.f;
+    static MSIS_TLS real dayl = -1.f;
+    static MSIS_TLS real p14 = -1e3f;
+    static MSIS_TLS real p18 = -1e3f;
+    static MSIS_TLS real p32 = -1e3f;
+    static MSIS_TLS real hr = .2618f;
+    static MSIS_TLS real sr = 7.2722e-5f;
+    static MSIS_TLS real sv[25] = { 1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,
 	    1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f };
-    static integer nsw = 14;
-    static real p39 = -1e3f;
-    static real longl = -999.f;
+    static MSIS_TLS integer nsw = 14;
+    static MSIS_TLS real p39 = -1e3f;
+    static MSIS_TLS real longl = -999.f;
 
     /* System generated locals */
     integer i__1;
@@ -1731,9 +1743,9 @@ doublereal globe6_(real *yrd, real *sec, real *lat, real *long__, real *tloc,
 	    doublereal *, doublereal *);
 
     /* Local variables */
-    static real c__;
-    static integer i__, j;
-    static real s, c2, c4, f1, f2, s2, p44, p45, t71, t72, t81, t82, cd14, 
+    static MSIS_TLS real c__;
+    static MSIS_TLS integer i__, j;
+    static MSIS_TLS real s, c2, c4, f1, f2, s2, p44, p45, t71, t72, t81, t82, cd14, 
 	    cd32, cd18, cd39, exp1, exp2;
     extern /* Subroutine */ int tselec_(real *);
 
@@ -2089,8 +2101,8 @@ L49:
     double r_mod(real *, real *);
 
     /* Local variables */
-    static integer i__;
-    static real sav[25];
+    static MSIS_TLS integer i__;
+    static MSIS_TLS real sav[25];
 
 /*        SET SWITCHES */
 /*        SW FOR MAIN TERMS, SWC FOR CROSS TERMS */
@@ -2144,12 +2156,12 @@ doublereal glob6s_(real *p)
 {
     /* Initialized data */
 
-    static real dr = .0172142f;
-    static real dayl = -1.f;
-    static real p32 = -1e3f;
-    static real p18 = -1e3f;
-    static real p14 = -1e3f;
-    static real p39 = -1e3f;
+    static MSIS_TLS real dr = .0172142f;
+    static MSIS_TLS real dayl = -1.f;
+    static MSIS_TLS real p32 = -1e3f;
+    static MSIS_TLS real p18 = -1e3f;
+    static MSIS_TLS real p14 = -1e3f;
+    static MSIS_TLS real p39 = -1e3f;
 
     /* System generated locals */
     real ret_val, r__1;
@@ -2158,8 +2170,8 @@ doublereal glob6s_(real *p)
     double cos(doublereal);
 
     /* Local variables */
-    static integer i__, j;
-    static real t[14], t71, t72, t81, t82, tt, cd32, cd14, cd18, cd39;
+    static MSIS_TLS integer i__, j;
+    static MSIS_TLS real t[14], t71, t72, t81, t82, tt, cd32, cd14, cd18, cd39;
 
 /*      VERSION OF GLOBE FOR LOWER ATMOSPHERE 1/17/90 */
 /*     GMAT Change: Removed DGTR due to warning messages */
@@ -2279,7 +2291,7 @@ doublereal densu_(real *alt, real *dlb, real *tinf, real *tlb, real *xm, real
 {
     /* Initialized data */
 
-    static real rgas = 831.4f;
+    static MSIS_TLS real rgas = 831.4f;
 
     /* System generated locals */
     integer i__1;
@@ -2290,10 +2302,10 @@ doublereal densu_(real *alt, real *dlb, real *tinf, real *tlb, real *xm, real
     double exp(doublereal), pow_dd(doublereal *, doublereal *);
 
     /* Local variables */
-    static integer k;
-    static real x, y, z__, t1, t2, z1, z2, ta, za;
-    static integer mn;
-    static real zg, yi, tt, xs[5], ys[5], yd1, yd2, zg2, glb, dta, gamm, expl,
+    static MSIS_TLS integer k;
+    static MSIS_TLS real x, y, z__, t1, t2, z1, z2, ta, za;
+    static MSIS_TLS integer mn;
+    static MSIS_TLS real zg, yi, tt, xs[5], ys[5], yd1, yd2, zg2, glb, dta, gamm, expl,
 	     y2out[5], gamma, densa, zgdif;
     extern /* Subroutine */ int spline_(real *, real *, integer *, real *, 
 	    real *, real *), splini_(real *, real *, real *, integer *, real *
@@ -2411,7 +2423,7 @@ doublereal densm_(real *alt, real *d0, real *xm, real *tz, integer *mn3, real
 {
     /* Initialized data */
 
-    static real rgas = 831.4f;
+    static MSIS_TLS real rgas = 831.4f;
 
     /* System generated locals */
     integer i__1;
@@ -2421,10 +2433,10 @@ doublereal densm_(real *alt, real *d0, real *xm, real *tz, integer *mn3, real
     double exp(doublereal);
 
     /* Local variables */
-    static integer k;
-    static real x, y, z__, t1, t2, z1, z2;
-    static integer mn;
-    static real zg, yi, xs[10], ys[10], yd1, yd2, glb, gamm, expl, y2out[10], 
+    static MSIS_TLS integer k;
+    static MSIS_TLS real x, y, z__, t1, t2, z1, z2;
+    static MSIS_TLS integer mn;
+    static MSIS_TLS real zg, yi, xs[10], ys[10], yd1, yd2, glb, gamm, expl, y2out[10], 
 	    zgdif;
     extern /* Subroutine */ int spline_(real *, real *, integer *, real *, 
 	    real *, real *), splini_(real *, real *, real *, integer *, real *
@@ -2557,8 +2569,8 @@ L50:
     integer i__1;
 
     /* Local variables */
-    static integer i__, k;
-    static real p, u[100], qn, un, sig;
+    static MSIS_TLS integer i__, k;
+    static MSIS_TLS real p, u[100], qn, un, sig;
 
 /*        CALCULATE 2ND DERIVATIVES OF CUBIC SPLINE INTERP FUNCTION */
 /*        ADAPTED FROM NUMERICAL RECIPES BY PRESS ET AL */
@@ -2615,8 +2627,8 @@ L50:
 	    e_wsle(void);
 
     /* Local variables */
-    static real a, b, h__;
-    static integer k, khi, klo;
+    static MSIS_TLS real a, b, h__;
+    static MSIS_TLS integer k, khi, klo;
 
     /* Fortran I/O blocks */
     static cilist io___241 = { 0, 6, 0, 0, 0 };
@@ -2668,8 +2680,8 @@ L1:
     real r__1, r__2;
 
     /* Local variables */
-    static real a, b, h__, a2, b2, xx;
-    static integer khi, klo;
+    static MSIS_TLS real a, b, h__, a2, b2, xx;
+    static MSIS_TLS integer khi, klo;
 
 /*       INTEGRATE CUBIC SPLINE FUNCTION FROM XA(1) TO X */
 /*        XA,YA: ARRAYS OF TABULATED FUNCTION IN ASCENDING ORDER BY X */
@@ -2723,7 +2735,7 @@ doublereal dnet_(real *dd, real *dm, real *zhm, real *xmm, real *xm)
 	    );
 
     /* Local variables */
-    static real a, ylog;
+    static MSIS_TLS real a, ylog;
 
     /* Fortran I/O blocks */
     static cilist io___253 = { 0, 6, 0, 0, 0 };
@@ -2789,7 +2801,7 @@ doublereal ccor_(real *alt, real *r__, real *h1, real *zh)
     double exp(doublereal);
 
     /* Local variables */
-    static real e, ex;
+    static MSIS_TLS real e, ex;
 
 /*        CHEMISTRY/DISSOCIATION CORRECTION FOR MSIS MODELS */
 /*        ALT - altitude */
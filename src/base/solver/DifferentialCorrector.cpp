@@ -74,6 +74,8 @@ DifferentialCorrector::PARAMETER_TYPE[DifferentialCorrectorParamCount -
    Gmat::ENUMERATION_TYPE
 };
 
+const Real DifferentialCorrector::BROYDEN_STALL_RATIO = 0.9;
+
 
 //---------------------------------
 // public methods
@@ -91,6 +93,8 @@ DifferentialCorrector::DifferentialCorrector(std::string name) :
    savedJacobian           (NULL),
    savedInverseJacobian    (NULL),
    skipPerts               (false),
+   refreshJacobian         (false),
+   previousErrorNorm       (GmatRealConstants::REAL_MAX),
 
    goalCount               (0),
    goal                    (NULL),
@@ -105,7 +109,9 @@ DifferentialCorrector::DifferentialCorrector(std::string name) :
    derivativeMethod        ("ForwardDifference"),
    diffMode                (1),
    firstPert               (true),
-   incrementPert           (true)
+   incrementPert           (true),
+   stmRejected             (false),
+   stmJacobianReady        (false)
 {
    #if DEBUG_DC_INIT
    MessageInterface::ShowMessage
@@ -138,6 +144,8 @@ DifferentialCorrector::DifferentialCorrector(const DifferentialCorrector &dc) :
    savedJacobian           (NULL),
    savedInverseJacobian    (NULL),
    skipPerts               (false),
+   refreshJacobian         (false),
+   previousErrorNorm       (GmatRealConstants::REAL_MAX),
 
    goalCount               (dc.goalCount),
    goal                    (NULL),
@@ -152,7 +160,9 @@ DifferentialCorrector::DifferentialCorrector(const DifferentialCorrector &dc) :
    derivativeMethod        (dc.derivativeMethod),
    diffMode                (dc.diffMode),
    firstPert               (dc.firstPert),
-   incrementPert           (dc.incrementPert)
+   incrementPert           (dc.incrementPert),
+   stmRejected             (false),
+   stmJacobianReady        (false)
 {
    #if DEBUG_DC_INIT
    MessageInterface::ShowMessage
@@ -186,12 +196,18 @@ DifferentialCorrector::operator=(const DifferentialCorrector& dc)
       savedInverseJacobian = NULL;
       savedVariable.clear();
       skipPerts = false;
+      refreshJacobian = false;
+      previousErrorNorm = GmatRealConstants::REAL_MAX;
 
       goalCount        = dc.goalCount;
       derivativeMethod = dc.derivativeMethod;
       diffMode         = dc.diffMode;
       firstPert        = dc.firstPert;
       incrementPert    = dc.incrementPert;
+      stmRejected      = false;
+      stmJacobianReady = false;
+      stateSensitivity.clear();
+      stmGoalSet.clear();
    }
    
    return *this;
@@ -279,11 +295,12 @@ Integer DifferentialCorrector::GetParameterID(const std::string &str) const
    }
 
    // 2. This part is kept for a future build:
-   for (Integer i = SolverParamCount; i < DifferentialCorrectorParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - SolverParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SolverParamCount,
+               DifferentialCorrectorParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Solver::GetParameterID(str);
 }
@@ -500,10 +517,14 @@ bool DifferentialCorrector::SetStringParameter(const Integer id,
          derivativeMethod = "ForwardDifference";
       // Allowed values for DerivativeMethod
       else if (value == "ForwardDifference" || value == "CentralDifference" ||
-               value == "BackwardDifference")
+               value == "BackwardDifference" ||
+               value == "StateTransitionMatrix")
       {
          derivativeMethod = value;
-         if (derivativeMethod == "ForwardDifference")
+         // STM derivatives fall back to forward differences when the
+         // variables or goals do not support them
+         if ((derivativeMethod == "ForwardDifference") ||
+             (derivativeMethod == "StateTransitionMatrix"))
          {
             diffMode = 1;
          }
@@ -627,6 +648,10 @@ bool DifferentialCorrector::TakeAction(const std::string &action,
          nominal[i] = goal[i] + 10.0 * tolerance[i];
       }
       skipPerts = false;
+      refreshJacobian = false;
+      previousErrorNorm = GmatRealConstants::REAL_MAX;
+      stmJacobianReady = false;
+      stmGoalSet.assign(goalNames.size(), false);
    }
 
    if (action == "SetMode")
@@ -769,6 +794,144 @@ void DifferentialCorrector::SetResultValue(Integer id, Real value,
 }
 
 
+//------------------------------------------------------------------------------
+// bool UsesStateTransitionDerivatives()
+//------------------------------------------------------------------------------
+/**
+ * Checks if the Jacobian is built from propagated STMs
+ *
+ * STM derivatives are requested by setting DerivativeMethod to
+ * StateTransitionMatrix.  They are used while every variable sets a Cartesian
+ * spacecraft state element or an impulsive burn component, and every goal can
+ * be differentiated with respect to the spacecraft states; otherwise the
+ * corrector warns once and uses forward differences.
+ *
+ * @return true if the Vary and Achieve commands should supply STM derivatives
+ */
+//------------------------------------------------------------------------------
+bool DifferentialCorrector::UsesStateTransitionDerivatives()
+{
+   return ((derivativeMethod == "StateTransitionMatrix") && !stmRejected);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetVariableSensitivity(Integer id, const StateSensitivity &sensitivity)
+//------------------------------------------------------------------------------
+/**
+ * Records the spacecraft state element that a variable sets
+ *
+ * @param id The ID of the variable
+ * @param sensitivity The state element description
+ */
+//------------------------------------------------------------------------------
+void DifferentialCorrector::SetVariableSensitivity(Integer id,
+      const StateSensitivity &sensitivity)
+{
+   if ((id < 0) || (id >= variableCount))
+      throw SolverException("The differential corrector " + instanceName +
+            " received an STM description for a variable that it does not "
+            "have");
+
+   if ((Integer)stateSensitivity.size() != variableCount)
+   {
+      StateSensitivity unset = {NULL, NULL, -1, 1.0, 0.0};
+      stateSensitivity.assign(variableCount, unset);
+   }
+   stateSensitivity[id] = sensitivity;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetVariableSensitivity(Integer id, StateSensitivity &sensitivity)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the spacecraft state element that a variable sets
+ *
+ * @param id The ID of the variable
+ * @param sensitivity The structure that receives the description
+ *
+ * @return true if the variable has a state element description
+ */
+//------------------------------------------------------------------------------
+bool DifferentialCorrector::GetVariableSensitivity(Integer id,
+      StateSensitivity &sensitivity)
+{
+   if ((id < 0) || (id >= (Integer)stateSensitivity.size()) ||
+       (stateSensitivity[id].owner == NULL))
+      return false;
+
+   sensitivity = stateSensitivity[id];
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetResultDerivatives(Integer id, const RealArray &derivatives)
+//------------------------------------------------------------------------------
+/**
+ * Passes in one row of the Jacobian, built from STMs on a nominal run
+ *
+ * @param id The ID of the goal
+ * @param derivatives The derivatives of the goal, one per scaled variable
+ */
+//------------------------------------------------------------------------------
+void DifferentialCorrector::SetResultDerivatives(Integer id,
+      const RealArray &derivatives)
+{
+   if ((currentState != NOMINAL) || !UsesStateTransitionDerivatives())
+      return;
+
+   if ((id < 0) || (id >= goalCount) ||
+       ((Integer)derivatives.size() != variableCount))
+      throw SolverException("The differential corrector " + instanceName +
+            " received STM derivatives that do not match its goals and "
+            "variables");
+
+   for (Integer i = 0; i < variableCount; ++i)
+   {
+      if (GmatMathUtil::IsNaN(derivatives[i]) ||
+          GmatMathUtil::IsInf(derivatives[i]))
+      {
+         RejectStateTransitionDerivatives("the STM derivative of " +
+               goalNames[id] + " is not a finite number");
+         return;
+      }
+      jacobian[i][id] = derivatives[i];
+   }
+
+   #ifdef DEBUG_JACOBIAN
+      MessageInterface::ShowMessage("   STM derivatives set for goal %d\n", id);
+   #endif
+
+   stmGoalSet.at(id) = true;
+}
+
+
+//------------------------------------------------------------------------------
+// void RejectStateTransitionDerivatives(const std::string &reason)
+//------------------------------------------------------------------------------
+/**
+ * Switches the corrector to forward differences for the rest of the run
+ *
+ * @param reason The reason, completing a sentence that starts "because"
+ */
+//------------------------------------------------------------------------------
+void DifferentialCorrector::RejectStateTransitionDerivatives(
+      const std::string &reason)
+{
+   if (stmRejected || (derivativeMethod != "StateTransitionMatrix"))
+      return;
+
+   stmRejected = true;
+   stmJacobianReady = false;
+   MessageInterface::ShowMessage("*** WARNING *** The differential corrector "
+         "%s cannot build its Jacobian from state transition matrices because "
+         "%s; forward differences are used instead.\n", instanceName.c_str(),
+         reason.c_str());
+}
+
+
 //------------------------------------------------------------------------------
 // bool Initialize()
 //------------------------------------------------------------------------------
@@ -825,6 +988,12 @@ bool DifferentialCorrector::Initialize()
       savedInverseJacobian[i] = new Real[localVariableCount];
    }
    skipPerts = false;
+   refreshJacobian = false;
+   previousErrorNorm = GmatRealConstants::REAL_MAX;
+   stmRejected = false;
+   stmJacobianReady = false;
+   stateSensitivity.clear();
+   stmGoalSet.assign(localGoalCount, false);
 
    Solver::Initialize();
 
@@ -1021,6 +1190,12 @@ void DifferentialCorrector::RunNominal()
 //------------------------------------------------------------------------------
 /**
  * Run out a perturbation, generating data used to evaluate the Jacobian.
+ *
+ * The perturbations are run one at a time: each pass executes the Target
+ * branch on the shared Sandbox objects (spacecraft, propagators, the solar
+ * system and the subscribers), so passes cannot overlap.  Achieved values are
+ * stored by perturbation index, so the Jacobian does not depend on the order
+ * in which the passes report.
  */
 //------------------------------------------------------------------------------
 void DifferentialCorrector::RunPerturbation()
@@ -1132,18 +1307,22 @@ void DifferentialCorrector::CalculateParameters()
    switch (dcTypeId)
    {
       case 1:           // Newton-Raphson
-         // Build and invert the sensitivity matrix
-         CalculateJacobian();
+         // Build and invert the sensitivity matrix; STM Jacobians were
+         // filled in on the nominal run
+         if (!stmJacobianReady)
+            CalculateJacobian();
          InvertJacobian();
          break;
 
       case 2:           // Broyden
          // Iteration counter already incremented at this point on 1st pass
-         if ( iterationsTaken == 1 )
+         if ( (iterationsTaken == 1) || refreshJacobian || stmJacobianReady )
          {
-            CalculateJacobian();
+            if (!stmJacobianReady)
+               CalculateJacobian();
             InvertJacobian();
             skipPerts = true;
+            refreshJacobian = false;
          }
          else
          {
@@ -1188,11 +1367,13 @@ void DifferentialCorrector::CalculateParameters()
 
       case 3:        // Modified Broyden
          // Iteration counter already incremented at this point on 1st pass
-         if ( iterationsTaken == 1 )
+         if ( (iterationsTaken == 1) || refreshJacobian || stmJacobianReady )
          {
-            CalculateJacobian();
+            if (!stmJacobianReady)
+               CalculateJacobian();
             InvertJacobian();
             skipPerts = true;
+            refreshJacobian = false;
          }
          else
          {
@@ -1368,10 +1549,45 @@ void DifferentialCorrector::CheckCompletion()
          converged = false;
    }
 
+   // The STM Jacobian is complete only if every goal supplied its row
+   stmJacobianReady = UsesStateTransitionDerivatives();
+   for (Integer i = 0; stmJacobianReady && (i < goalCount); ++i)
+   {
+      if (!stmGoalSet[i])
+      {
+         RejectStateTransitionDerivatives("the goal " + goalNames[i] +
+               " was not differentiated on the nominal run");
+         stmJacobianReady = false;
+      }
+   }
+   stmGoalSet.assign(goalNames.size(), false);
+
    if (!converged)
    {
-      if (iterationsTaken < maxIterations-1)
+      if (stmJacobianReady && (iterationsTaken < maxIterations-1))
       {
+         // The nominal run supplied the Jacobian, so no perturbations
+         pertNumber = -1;
+         currentState = CALCULATING;
+      }
+      else if (iterationsTaken < maxIterations-1)
+      {
+         // Broyden updates are kept only while they make progress; when the
+         // goal error stalls, the next Jacobian comes from perturbations
+         Real errorNorm = GetScaledGoalError();
+         if (skipPerts &&
+             (errorNorm >= BROYDEN_STALL_RATIO * previousErrorNorm))
+         {
+            #ifdef DEBUG_BROYDEN
+               MessageInterface::ShowMessage("Broyden error %.12le did not "
+                     "improve on %.12le; refreshing the Jacobian\n", errorNorm,
+                     previousErrorNorm);
+            #endif
+            skipPerts = false;
+            refreshJacobian = true;
+         }
+         previousErrorNorm = errorNorm;
+
          // Set to run perts if not converged
          pertNumber = -1;
          if (!skipPerts)
@@ -1565,6 +1781,27 @@ void DifferentialCorrector::CalculateJacobian()
 }
 
 
+//------------------------------------------------------------------------------
+//  Real GetScaledGoalError()
+//------------------------------------------------------------------------------
+/**
+ * Computes the RSS of the nominal goal errors, each scaled by its tolerance.
+ *
+ * @return The scaled goal error
+ */
+//------------------------------------------------------------------------------
+Real DifferentialCorrector::GetScaledGoalError()
+{
+   Real sum = 0.0;
+   for (Integer i = 0; i < goalCount; ++i)
+   {
+      Real error = (nominal[i] - goal[i]) / tolerance[i];
+      sum += error * error;
+   }
+   return GmatMathUtil::Sqrt(sum);
+}
+
+
 //------------------------------------------------------------------------------
 //  void InvertJacobian()
 //------------------------------------------------------------------------------
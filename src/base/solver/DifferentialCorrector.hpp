@@ -96,6 +96,16 @@ public:
    virtual void        SetResultValue(Integer id, Real value,
                                       const std::string &resultType = "");
 
+   virtual bool        UsesStateTransitionDerivatives();
+   virtual void        SetVariableSensitivity(Integer id,
+                                          const StateSensitivity &sensitivity);
+   virtual bool        GetVariableSensitivity(Integer id,
+                                          StateSensitivity &sensitivity);
+   virtual void        SetResultDerivatives(Integer id,
+                                          const RealArray &derivatives);
+   virtual void        RejectStateTransitionDerivatives(
+                                          const std::string &reason);
+
    DEFAULT_TO_NO_CLONES
    DEFAULT_TO_NO_REFOBJECTS
 
@@ -117,6 +127,10 @@ protected:
 	Real **savedInverseJacobian;
 	/// Flag used to trigger skipping perts for Broyden updates
 	bool skipPerts;
+	/// Flag set when stalled Broyden updates need a finite difference Jacobian
+	bool refreshJacobian;
+	/// Scaled goal error of the previous nominal run, for the stall check
+	Real previousErrorNorm;
 	
    // Core data members used for the targeter numerics
    /// The number of goals in the targeting problem
@@ -152,6 +166,15 @@ protected:
    bool                        firstPert;
    /// Flag used to indicate if it is time to move to next pert
    bool                        incrementPert;
+   /// Flag set once STM derivatives are found unusable for this problem
+   bool                        stmRejected;
+   /// Flag indicating that the nominal run supplied the full Jacobian
+   bool                        stmJacobianReady;
+   /// State elements set by the variables, for STM derivatives
+   std::vector<StateSensitivity>
+                               stateSensitivity;
+   /// Flags for the goals that supplied STM derivatives on the nominal run
+   std::vector<bool>           stmGoalSet;
 
    /// List of goals
    StringArray                 goalNames;
@@ -170,6 +193,8 @@ protected:
    static const Gmat::ParameterType
                                PARAMETER_TYPE[DifferentialCorrectorParamCount -
                                               SolverParamCount];
+   /// Fraction of the previous goal error a Broyden iteration must get below
+   static const Real           BROYDEN_STALL_RATIO;
 
    // Methods
    virtual void                RunNominal();
@@ -181,6 +206,7 @@ protected:
    // Methods used to perform differential correction
    void                        CalculateJacobian();
    void                        InvertJacobian();
+   Real                        GetScaledGoalError();
 
    void                        FreeArrays();
    virtual std::string         GetProgressString();
@@ -198,11 +198,12 @@ std::string ExternalOptimizer::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ExternalOptimizer::GetParameterID(const std::string &str) const
 {
-   for (Integer i = OptimizerParamCount; i < ExternalOptimizerParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - OptimizerParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, OptimizerParamCount,
+               ExternalOptimizerParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Optimizer::GetParameterID(str);
 }
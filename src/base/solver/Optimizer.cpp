@@ -580,11 +580,11 @@ std::string Optimizer::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Optimizer::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverParamCount; i < OptimizerParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - SolverParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SolverParamCount, OptimizerParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Solver::GetParameterID(str);
 }
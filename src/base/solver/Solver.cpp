@@ -611,6 +611,86 @@ const RealArray* Solver::GetSolverData(const std::string &type)
 }
 
 
+//------------------------------------------------------------------------------
+// bool UsesStateTransitionDerivatives()
+//------------------------------------------------------------------------------
+/**
+ * Checks if the solver takes its derivatives from propagated STMs
+ *
+ * Solvers that do not override this method use finite differences.
+ *
+ * @return true if the Vary and Achieve commands should supply STM derivatives
+ */
+//------------------------------------------------------------------------------
+bool Solver::UsesStateTransitionDerivatives()
+{
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetVariableSensitivity(Integer id, const StateSensitivity &sensitivity)
+//------------------------------------------------------------------------------
+/**
+ * Records the spacecraft state element that a variable sets
+ *
+ * @param id The ID of the variable
+ * @param sensitivity The state element description
+ */
+//------------------------------------------------------------------------------
+void Solver::SetVariableSensitivity(Integer id,
+      const StateSensitivity &sensitivity)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetVariableSensitivity(Integer id, StateSensitivity &sensitivity)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the spacecraft state element that a variable sets
+ *
+ * @param id The ID of the variable
+ * @param sensitivity The structure that receives the description
+ *
+ * @return true if the variable has a state element description
+ */
+//------------------------------------------------------------------------------
+bool Solver::GetVariableSensitivity(Integer id, StateSensitivity &sensitivity)
+{
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetResultDerivatives(Integer id, const RealArray &derivatives)
+//------------------------------------------------------------------------------
+/**
+ * Passes in the derivatives of a result with respect to the scaled variables
+ *
+ * @param id The ID used for the result
+ * @param derivatives The derivatives, one per variable
+ */
+//------------------------------------------------------------------------------
+void Solver::SetResultDerivatives(Integer id, const RealArray &derivatives)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void RejectStateTransitionDerivatives(const std::string &reason)
+//------------------------------------------------------------------------------
+/**
+ * Reports that STM derivatives cannot be built for the solver problem
+ *
+ * @param reason The reason, completing a sentence that starts "because"
+ */
+//------------------------------------------------------------------------------
+void Solver::RejectStateTransitionDerivatives(const std::string &reason)
+{
+}
+
+
 //------------------------------------------------------------------------------
 //  SolverState GetState()
 //------------------------------------------------------------------------------
@@ -806,11 +886,11 @@ Integer Solver::GetParameterID(const std::string &str) const
    }
    
    // 2. This part is kept for a future build:
-   for (Integer i = GmatBaseParamCount; i < SolverParamCount; ++i)
-   {
-      if (param_text == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount, SolverParamCount);
+   Integer parameterId = parameterIndex.Find(param_text);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatBase::GetParameterID(str);
 }
@@ -105,6 +105,21 @@ public:
       UNKNOWN_EXIT_MODE
    };
 
+   /// Dependence of a variable on a spacecraft state, for STM derivatives
+   struct StateSensitivity
+   {
+      /// The Spacecraft or ImpulsiveBurn that the variable sets
+      GmatBase    *owner;
+      /// The Spacecraft whose STM maps the variable to the goals
+      GmatBase    *spacecraft;
+      /// Cartesian state element (0-5) or burn element (0-2) that is set
+      Integer     element;
+      /// Derivative of the variable with respect to its scaled value
+      Real        scale;
+      /// Spacecraft epoch at which the STM was reset to identity
+      Real        epoch;
+   };
+
    // Moved to the Gmat namespace
 //   /// Current status of the Solver
 //   enum SolverStatus
@@ -197,6 +212,17 @@ public:
 
    virtual const RealArray*
                        GetSolverData(const std::string &type);
+
+   // State transition matrix derivatives, supplied by Vary and Achieve
+   virtual bool        UsesStateTransitionDerivatives();
+   virtual void        SetVariableSensitivity(Integer id,
+                                          const StateSensitivity &sensitivity);
+   virtual bool        GetVariableSensitivity(Integer id,
+                                          StateSensitivity &sensitivity);
+   virtual void        SetResultDerivatives(Integer id,
+                                          const RealArray &derivatives);
+   virtual void        RejectStateTransitionDerivatives(
+                                          const std::string &reason);
     
    //---------------------------------------------------------------------------
    //  Integer SetSolverResults(Real *data, std::string name)
@@ -0,0 +1,436 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              NPlateGeometry
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the packed plate data for the N-plate SRP model.
+ *
+ * The equations follow Plate::GetReflectanceI() and
+ * Plate::GetReflectanceDerivativeWRTSpacecraftStateI() (Eq.20 - Eq.37 of the
+ * SRP N-Plates MathSpec).
+ */
+//------------------------------------------------------------------------------
+
+#include "NPlateGeometry.hpp"
+#include "MessageInterface.hpp"
+#include <cmath>
+
+//#define DEBUG_NPLATE_PACK
+
+#define EPSILON      1.0e-10
+
+
+//------------------------------------------------------------------------------
+// NPlateGeometry()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+NPlateGeometry::NPlateGeometry() :
+   packedCount       (0),
+   fixedCount        (0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// NPlateGeometry(const NPlateGeometry &geom)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * The packed data refer to the plates of the copied spacecraft, so they are
+ * not copied; the new object packs its own plates when first used.
+ */
+//------------------------------------------------------------------------------
+NPlateGeometry::NPlateGeometry(const NPlateGeometry &geom) :
+   packedCount       (0),
+   fixedCount        (0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// NPlateGeometry& operator=(const NPlateGeometry &geom)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * Clears the packed data; see the copy constructor.
+ */
+//------------------------------------------------------------------------------
+NPlateGeometry& NPlateGeometry::operator=(const NPlateGeometry &geom)
+{
+   if (this != &geom)
+      Clear();
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// ~NPlateGeometry()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+NPlateGeometry::~NPlateGeometry()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsCurrent(const ObjectArray &plates) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the packed data still describe a list of plates
+ *
+ * @param plates   The spacecraft's plates
+ *
+ * @return true if the plates and their settings are unchanged since the last
+ *         call to Pack(), false otherwise
+ */
+//------------------------------------------------------------------------------
+bool NPlateGeometry::IsCurrent(const ObjectArray &plates) const
+{
+   if (plates.size() != plateRefs.size())
+      return false;
+
+   for (UnsignedInt i = 0; i < plates.size(); ++i)
+   {
+      if ((plates[i] != plateRefs[i]) ||
+          (plateRefs[i]->GetGeometryRevision() != revisions[i]))
+         return false;
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void Pack(const ObjectArray &plates)
+//------------------------------------------------------------------------------
+/**
+ * Copies the geometry and optical data of a list of plates into the arrays
+ *
+ * FixedInBody plates are stored first, followed by the SunFacing plates.
+ * File plates are collected in the unpacked list.
+ *
+ * @param plates   The spacecraft's plates
+ */
+//------------------------------------------------------------------------------
+void NPlateGeometry::Pack(const ObjectArray &plates)
+{
+   Clear();
+
+   std::vector<Plate*> sunFacing;
+   for (UnsignedInt i = 0; i < plates.size(); ++i)
+   {
+      Plate *plate = (Plate*)plates[i];
+      plateRefs.push_back(plate);
+      revisions.push_back(plate->GetGeometryRevision());
+
+      std::string plateType = plate->GetStringParameter("Type");
+      if (plateType == "FixedInBody")
+      {
+         const Rvector &normal = plate->GetRvectorParameter("PlateNormal");
+         normalX.push_back(normal[0]);
+         normalY.push_back(normal[1]);
+         normalZ.push_back(normal[2]);
+         effectiveArea.push_back(plate->GetRealParameter("AreaCoefficient") *
+               plate->GetRealParameter("Area") *
+               plate->GetRealParameter("LitFraction"));
+         rho.push_back(plate->GetRealParameter("SpecularFraction"));
+         delta.push_back(plate->GetRealParameter("DiffuseFraction"));
+      }
+      else if (plateType == "SunFacing")
+         sunFacing.push_back(plate);
+      else
+         unpacked.push_back(plate);
+   }
+   fixedCount = effectiveArea.size();
+
+   for (UnsignedInt i = 0; i < sunFacing.size(); ++i)
+   {
+      normalX.push_back(0.0);
+      normalY.push_back(0.0);
+      normalZ.push_back(0.0);
+      effectiveArea.push_back(sunFacing[i]->GetRealParameter("AreaCoefficient") *
+            sunFacing[i]->GetRealParameter("Area") *
+            sunFacing[i]->GetRealParameter("LitFraction"));
+      rho.push_back(sunFacing[i]->GetRealParameter("SpecularFraction"));
+      delta.push_back(sunFacing[i]->GetRealParameter("DiffuseFraction"));
+   }
+   packedCount = effectiveArea.size();
+
+   workX.assign(packedCount, 0.0);
+   workY.assign(packedCount, 0.0);
+   workZ.assign(packedCount, 0.0);
+
+   #ifdef DEBUG_NPLATE_PACK
+      MessageInterface::ShowMessage("NPlateGeometry::Pack(): %d FixedInBody, "
+            "%d SunFacing and %d unpacked plates\n", fixedCount,
+            packedCount - fixedCount, (Integer)unpacked.size());
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes the packed data
+ */
+//------------------------------------------------------------------------------
+void NPlateGeometry::Clear()
+{
+   plateRefs.clear();
+   revisions.clear();
+   unpacked.clear();
+   packedCount = 0;
+   fixedCount  = 0;
+   normalX.clear();
+   normalY.clear();
+   normalZ.clear();
+   effectiveArea.clear();
+   rho.clear();
+   delta.clear();
+   workX.clear();
+   workY.clear();
+   workZ.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetPackedCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of FixedInBody and SunFacing plates in the arrays
+ */
+//------------------------------------------------------------------------------
+Integer NPlateGeometry::GetPackedCount() const
+{
+   return packedCount;
+}
+
+
+//------------------------------------------------------------------------------
+// const std::vector<Plate*>& GetUnpackedPlates() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the plates the caller evaluates through the Plate methods
+ */
+//------------------------------------------------------------------------------
+const std::vector<Plate*>& NPlateGeometry::GetUnpackedPlates() const
+{
+   return unpacked;
+}
+
+
+//------------------------------------------------------------------------------
+// void AddReflectance(const Real sHatI[3], const Rmatrix33 &MT,
+//                     Real reflectance[3])
+//------------------------------------------------------------------------------
+/**
+ * Adds the reflectance of the packed plates, in the inertial frame, to a sum
+ *
+ * @param sHatI         Unit vector from the spacecraft to the Sun, inertial
+ * @param MT            Rotation matrix from the body frame to inertial
+ * @param reflectance   The sum the packed reflectance is added to
+ */
+//------------------------------------------------------------------------------
+void NPlateGeometry::AddReflectance(const Real sHatI[3], const Rmatrix33 &MT,
+      Real reflectance[3])
+{
+   const Real s0 = sHatI[0], s1 = sHatI[1], s2 = sHatI[2];
+   const Real m00 = MT(0,0), m01 = MT(0,1), m02 = MT(0,2);
+   const Real m10 = MT(1,0), m11 = MT(1,1), m12 = MT(1,2);
+   const Real m20 = MT(2,0), m21 = MT(2,1), m22 = MT(2,2);
+
+   const Real *bx = normalX.data(), *by = normalY.data(), *bz = normalZ.data();
+   const Real *area = effectiveArea.data();
+   const Real *r = rho.data(), *d = delta.data();
+   Real *wx = workX.data(), *wy = workY.data(), *wz = workZ.data();
+
+   // FixedInBody plates: nHatI = MT * plateNormal
+   for (Integer i = 0; i < fixedCount; ++i)
+   {
+      Real n0 = m00 * bx[i] + m01 * by[i] + m02 * bz[i];
+      Real n1 = m10 * bx[i] + m11 * by[i] + m12 * bz[i];
+      Real n2 = m20 * bx[i] + m21 * by[i] + m22 * bz[i];
+
+      Real D  = s0 * n0 + s1 * n1 + s2 * n2;                      // Eq.25
+      Real cs = 1.0 - r[i];
+      Real cn = 2.0 * (d[i] / 3.0 + r[i] * D);
+      Real AD = (D > EPSILON ? area[i] * D : 0.0);                // Eq.27
+      wx[i] = AD * (cs * s0 + cn * n0);                           // Eq.26
+      wy[i] = AD * (cs * s1 + cn * n1);
+      wz[i] = AD * (cs * s2 + cn * n2);
+   }
+
+   // SunFacing plates: nHatI = sHatI
+   for (Integer i = fixedCount; i < packedCount; ++i)
+   {
+      Real D  = s0 * s0 + s1 * s1 + s2 * s2;
+      Real cs = 1.0 - r[i];
+      Real cn = 2.0 * (d[i] / 3.0 + r[i] * D);
+      Real AD = (D > EPSILON ? area[i] * D : 0.0);
+      wx[i] = AD * (cs + cn) * s0;
+      wy[i] = AD * (cs + cn) * s1;
+      wz[i] = AD * (cs + cn) * s2;
+   }
+
+   for (Integer i = 0; i < packedCount; ++i)
+   {
+      reflectance[0] += wx[i];
+      reflectance[1] += wy[i];
+      reflectance[2] += wz[i];
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void AddReflectanceStateDerivative(const Real sunSC[3], const Rmatrix33 &MT,
+//       const std::vector<Rmatrix33> &dMT, Real deriv[3][6])
+//------------------------------------------------------------------------------
+/**
+ * Adds the derivative of the packed reflectance with respect to the
+ * spacecraft position and velocity to a sum
+ *
+ * The derivative is dA/dX = dA/dsHatI * dsHatI/dX + dA/dnHatI * dnHatI/dX
+ * (Eq.24).  The dA/dsHatI terms of all plates are summed first, so
+ * dsHatI/dX is applied once; the dA/dnHatI terms of FixedInBody plates are
+ * applied to dnHatI/dX = dMT/dX * plateNormal per plate.
+ *
+ * @param sunSC   Vector from the Sun to the spacecraft, inertial
+ * @param MT      Rotation matrix from the body frame to inertial
+ * @param dMT     Derivatives of MT with respect to the spacecraft state
+ * @param deriv   The sum the packed derivative is added to; column j is the
+ *                derivative with respect to state element j
+ */
+//------------------------------------------------------------------------------
+void NPlateGeometry::AddReflectanceStateDerivative(const Real sunSC[3],
+      const Rmatrix33 &MT, const std::vector<Rmatrix33> &dMT,
+      Real deriv[3][6])
+{
+   if (packedCount == 0)
+      return;
+
+   // Sun unit vector and its derivative w.r.t. position (Eq.36, Eq.37); the
+   // derivative w.r.t. velocity is zero
+   Real sI[3] = { -sunSC[0], -sunSC[1], -sunSC[2] };
+   Real sIMag = std::sqrt(sI[0] * sI[0] + sI[1] * sI[1] + sI[2] * sI[2]);
+   Real s[3]  = { sI[0] / sIMag, sI[1] / sIMag, sI[2] / sIMag };
+
+   Real m[3][3];
+   for (Integer i = 0; i < 3; ++i)
+      for (Integer j = 0; j < 3; ++j)
+         m[i][j] = MT(i,j);
+
+   Integer dMTCount = (dMT.size() < 6 ? dMT.size() : 6);
+   Real dm[6][3][3];
+   for (Integer k = 0; k < dMTCount; ++k)
+      for (Integer i = 0; i < 3; ++i)
+         for (Integer j = 0; j < 3; ++j)
+            dm[k][i][j] = dMT[k](i,j);
+
+   // Sum of dA/dsHatI, and of dA/dnHatI * dnHatI/dX
+   Real dAds[3][3] = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 } };
+   Real dAdX[3][6] = { { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+                       { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+                       { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 } };
+
+   for (Integer p = 0; p < packedCount; ++p)
+   {
+      bool sunFacing = (p >= fixedCount);
+      Real nB[3] = { normalX[p], normalY[p], normalZ[p] };
+      Real n[3];
+      if (sunFacing)
+      {
+         n[0] = s[0];  n[1] = s[1];  n[2] = s[2];
+      }
+      else
+      {
+         for (Integer i = 0; i < 3; ++i)
+            n[i] = m[i][0] * nB[0] + m[i][1] * nB[1] + m[i][2] * nB[2];
+      }
+
+      Real D = s[0] * n[0] + s[1] * n[1] + s[2] * n[2];           // Eq.25
+      if (D <= EPSILON)
+         continue;
+
+      Real A   = effectiveArea[p];
+      Real r   = rho[p];
+      Real k   = delta[p] / 3.0 + r * D;
+      Real dep = (sunFacing ? 1.0 : 0.0);        // dnHatI/dsHatI = dsHatI/dnHatI
+      Real C[3];
+      for (Integer i = 0; i < 3; ++i)
+         C[i] = (1.0 - r) * s[i] + 2.0 * k * n[i];                // Eq.26
+
+      Real dAdn[3][3];
+      for (Integer i = 0; i < 3; ++i)
+      {
+         for (Integer j = 0; j < 3; ++j)
+         {
+            Real I = (i == j ? 1.0 : 0.0);
+            // Eq.32 and Eq.28
+            Real dCds = I * (1.0 - r) + 2.0 * (r * n[i] * n[j] + I * dep * k);
+            Real dAdsij = A * (C[i] * n[j] + dCds * D);
+            // Eq.33 and Eq.29
+            Real dCdn = I * dep * (1.0 - r) + 2.0 * (r * n[i] * s[j] + I * k);
+            dAdn[i][j] = A * (C[i] * s[j] + dCdn * D);
+
+            // SunFacing: dnHatI/dX = dsHatI/dX
+            dAds[i][j] += (sunFacing ? dAdsij + dAdn[i][j] : dAdsij);
+         }
+      }
+
+      if (sunFacing)
+         continue;
+
+      // FixedInBody: dnHatI/dX = dMT/dX * plateNormal
+      for (Integer col = 0; col < dMTCount; ++col)
+      {
+         Real dn[3];
+         for (Integer i = 0; i < 3; ++i)
+            dn[i] = dm[col][i][0] * nB[0] + dm[col][i][1] * nB[1] +
+                    dm[col][i][2] * nB[2];
+         for (Integer i = 0; i < 3; ++i)
+            dAdX[i][col] += dAdn[i][0] * dn[0] + dAdn[i][1] * dn[1] +
+                            dAdn[i][2] * dn[2];
+      }
+   }
+
+   for (Integer i = 0; i < 3; ++i)
+   {
+      for (Integer col = 0; col < 3; ++col)
+      {
+         Real sum = 0.0;
+         for (Integer j = 0; j < 3; ++j)
+         {
+            Real dsdr = ((j == col ? -1.0 : 0.0) + s[j] * s[col]) / sIMag;
+            sum += dAds[i][j] * dsdr;
+         }
+         deriv[i][col] += sum + dAdX[i][col];
+      }
+      for (Integer col = 3; col < 6; ++col)
+         deriv[i][col] += dAdX[i][col];
+   }
+}
@@ -0,0 +1,101 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              NPlateGeometry
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Packed plate data for the N-plate SRP model.
+ */
+//------------------------------------------------------------------------------
+#ifndef NPlateGeometry_hpp
+#define NPlateGeometry_hpp
+
+#include "gmatdefs.hpp"
+#include "Plate.hpp"
+#include "Rmatrix33.hpp"
+
+/**
+ * NPlateGeometry keeps the normals, effective areas and optical coefficients
+ * of a spacecraft's plates in contiguous arrays.
+ *
+ * The reflectance of all FixedInBody and SunFacing plates, and its derivative
+ * with respect to the spacecraft state, are then computed in loops over plain
+ * arrays instead of one Plate call, with vector temporaries, per plate.  The
+ * per plate reflectance is written to work arrays so that loop has no
+ * reductions and can be vectorized by the compiler.  Plates with Type = File, whose
+ * normal comes from a history file, are not packed; callers evaluate them
+ * through the Plate methods.
+ *
+ * The data are repacked only when the plate list or a plate setting changes,
+ * as reported by Plate::GetGeometryRevision().  The class holds no SRP
+ * state, so other plate based force models can share the packed geometry.
+ */
+class GMAT_API NPlateGeometry
+{
+public:
+   NPlateGeometry();
+   NPlateGeometry(const NPlateGeometry &geom);
+   NPlateGeometry& operator=(const NPlateGeometry &geom);
+   ~NPlateGeometry();
+
+   bool           IsCurrent(const ObjectArray &plates) const;
+   void           Pack(const ObjectArray &plates);
+   void           Clear();
+
+   Integer        GetPackedCount() const;
+   const std::vector<Plate*>&
+                  GetUnpackedPlates() const;
+
+   void           AddReflectance(const Real sHatI[3], const Rmatrix33 &MT,
+                                 Real reflectance[3]);
+   void           AddReflectanceStateDerivative(const Real sunSC[3],
+                                 const Rmatrix33 &MT,
+                                 const std::vector<Rmatrix33> &dMT,
+                                 Real deriv[3][6]);
+
+private:
+   /// Plates the data were packed from, in spacecraft order
+   std::vector<Plate*>     plateRefs;
+   /// Geometry revision of each plate when the data were packed
+   std::vector<UnsignedInt> revisions;
+   /// Type = File plates, evaluated one at a time by the caller
+   std::vector<Plate*>     unpacked;
+
+   /// Number of packed plates; the FixedInBody plates come first
+   Integer                 packedCount;
+   /// Number of packed FixedInBody plates
+   Integer                 fixedCount;
+
+   /// Unit normals in the body frame (unused for SunFacing plates)
+   RealArray               normalX;
+   RealArray               normalY;
+   RealArray               normalZ;
+   /// AreaCoefficient * Area * LitFraction
+   RealArray               effectiveArea;
+   /// Specular fraction
+   RealArray               rho;
+   /// Diffuse fraction
+   RealArray               delta;
+
+   /// Per plate work arrays for the current evaluation
+   RealArray               workX;
+   RealArray               workY;
+   RealArray               workZ;
+};
+
+#endif // NPlateGeometry_hpp
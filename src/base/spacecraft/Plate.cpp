@@ -54,6 +54,8 @@
 // static data
 //---------------------------------
 
+UnsignedInt Plate::geometryRevisionCount = 0;
+
 const std::string Plate::PARAMETER_TEXT[PlateParamCount -
                                               GmatBaseParamCount] =
 {
@@ -131,7 +133,8 @@ Plate::Plate(UnsignedInt typeId, const std::string &typeStr,
    diffuseFrac       (0.0),
    diffuseFracSigma  (1.0e70),
    errorSelection    (true),
-   runningCommandFlag (0)                       // initially it is set to 0: not running any command
+   runningCommandFlag (0),                      // initially it is set to 0: not running any command
+   geometryRevision  (++geometryRevisionCount)
 {
    objectTypes.push_back(Gmat::PLATE);
    objectTypeNames.push_back("Plate");
@@ -189,7 +192,8 @@ Plate::Plate(const Plate& pl) :
    diffuseFracSigma  (pl.diffuseFracSigma),
    allowedSolveFors  (pl.allowedSolveFors),
    errorSelection    (pl.errorSelection),
-   runningCommandFlag (pl.runningCommandFlag)
+   runningCommandFlag (pl.runningCommandFlag),
+   geometryRevision  (++geometryRevisionCount)
 {
    if (pl.faceNormalFile)
       faceNormalFile = pl.faceNormalFile->Clone();
@@ -249,6 +253,8 @@ Plate& Plate::operator=(const Plate& pl)
    location[1] = pl.location[1];
    location[2] = pl.location[2];
 
+   geometryRevision = ++geometryRevisionCount;
+
    return *this;
 }
 
@@ -302,6 +308,7 @@ bool Plate::Initialize()
       }
 
       plateNormal = plateNormal / plateNormal.GetMagnitude();
+      geometryRevision = ++geometryRevisionCount;
 
       ///@todo: add initialize code here
       if (plateType == "File")
@@ -355,11 +362,11 @@ bool Plate::Initialize()
 //------------------------------------------------------------------------------
 Integer Plate::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < PlateParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount, PlateParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return GmatBase::GetParameterID(str);
 }
@@ -442,6 +449,7 @@ bool Plate::SetStringParameter(const Integer id, const char *value)
 
 bool Plate::SetStringParameter(const Integer id, const std::string &value)
 {
+   geometryRevision = ++geometryRevisionCount;
    if (id == TYPE_ID)
    {
       if ((value != "FixedInBody") && (value != "SunFacing") && (value != "File"))
@@ -530,6 +538,7 @@ std::string Plate::GetStringParameter(const Integer id, const Integer index) con
 
 bool Plate::SetStringParameter(const Integer id, const std::string &value, const Integer index)
 {
+   geometryRevision = ++geometryRevisionCount;
    if (id == SOLVEFORS_ID)
    {
       if ((index < 0) || (index > solveForList.size()))
@@ -635,6 +644,7 @@ const Rvector& Plate::GetRvectorParameter(const std::string &label) const
 
 const Rvector& Plate::SetRvectorParameter(const Integer id, const Rvector &value)
 {
+   geometryRevision = ++geometryRevisionCount;
    if (value.GetSize() != 3)
    {
       std::stringstream ss;
@@ -740,6 +750,7 @@ Real Plate::GetRealParameter(const std::string &label) const
 //------------------------------------------------------------------------------
 Real Plate::SetRealParameter(const Integer id, const Real value)
 {
+   geometryRevision = ++geometryRevisionCount;
    if (id == AREA_ID)
    {
       if (value <= 0.0)
@@ -938,6 +949,7 @@ Real Plate::SetRealParameter(const std::string &label, const Real value)
 //------------------------------------------------------------------------------
 Real Plate::SetRealParameter(const Integer id, const Real value, const Integer index)
 {
+   geometryRevision = ++geometryRevisionCount;
    if (id == PLATE_NORMAL_ID)
    {
       if ((index < 0) || (index > 2))
@@ -2214,3 +2226,20 @@ Integer Plate::SetRunningCommandFlag(Integer runningCommand)
    return temp;
 };
 
+
+//-------------------------------------------------------------------------------
+// UnsignedInt GetGeometryRevision() const
+//-------------------------------------------------------------------------------
+/**
+* Returns a number that changes whenever the plate type, normal, area or
+* optical settings may have changed.  Revisions are unique across plates, so
+* packed plate data can be checked against them.
+*
+* @return  the current geometry revision
+*/
+//-------------------------------------------------------------------------------
+UnsignedInt Plate::GetGeometryRevision() const
+{
+   return geometryRevision;
+}
+
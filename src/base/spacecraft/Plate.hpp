@@ -147,6 +147,8 @@ public:
 
    Integer              SetRunningCommandFlag(Integer runningCommand);
 
+   UnsignedInt          GetGeometryRevision() const;
+
 
 protected:
    /// Flag to indicate the Plate is running simulation, propagation, or estimation command 
@@ -187,6 +189,11 @@ protected:
    /// true: for display error message, false: for display warning message
    bool                    errorSelection;
 
+   /// Changes whenever a setting used by the reflectance computation changes
+   UnsignedInt             geometryRevision;
+   /// Last revision handed out, shared by all plates so revisions are unique
+   static UnsignedInt      geometryRevisionCount;
+
    StringArray             allowedSolveFors;
 
    /// Enumerated parameter IDs   
@@ -484,6 +484,10 @@ Spacecraft::Spacecraft(const std::string &name, const std::string &typeStr) :
    dryMass              (850.0),
    dryCM                (0.0, 0.0, 0.0),
    dryMOI               (Rmatrix33(true)),
+   cmTableIndex         (0),
+   cmLookupMass         (-1.0),
+   moiTableIndex        (0),
+   moiLookupMass        (-1.0),
    coeffDrag            (2.2),
    coeffDragSigma       (1.0e70),                 // set a large number to parameter's covariance
    dragArea             (15.0),
@@ -526,8 +530,6 @@ Spacecraft::Spacecraft(const std::string &name, const std::string &typeStr) :
    massProperties_MOI_LookupTable (""),
    massPropertiesModelType        ("Analytic"),
    massPropertiesModeled          ("None"),
-   cmInterp             (NULL),
-   moiInterp            (NULL),
    table_CM_Offset      (0.0, 0.0, 0.0),
    table_MOI_Offset     (0.0, 0.0, 0.0, 0.0, 0.0, 0.0),
    systemCM             (0.0, 0.0, 0.0),
@@ -828,6 +830,16 @@ Spacecraft::Spacecraft(const Spacecraft &a) :
    dryMass              (a.dryMass),
    dryCM                (a.dryCM),
    dryMOI               (a.dryMOI),
+   cmMasses             (a.cmMasses),
+   cmTableMasses        (a.cmTableMasses),
+   cmTableValues        (a.cmTableValues),
+   cmTableIndex         (0),
+   cmLookupMass         (-1.0),
+   moiMasses            (a.moiMasses),
+   moiTableMasses       (a.moiTableMasses),
+   moiTableValues       (a.moiTableValues),
+   moiTableIndex        (0),
+   moiLookupMass        (-1.0),
    coeffDrag            (a.coeffDrag),
    coeffDragSigma       (a.coeffDragSigma),
    dragArea             (a.dragArea),
@@ -872,8 +884,6 @@ Spacecraft::Spacecraft(const Spacecraft &a) :
    massProperties_MOI_LookupTable (a.massProperties_MOI_LookupTable),
    massPropertiesModelType        (a.massPropertiesModelType),
    massPropertiesModeled          (a.massPropertiesModeled),
-   cmInterp             (a.cmInterp),
-   moiInterp            (a.moiInterp),
    table_CM_Offset      (a.table_CM_Offset),
    table_MOI_Offset     (a.table_MOI_Offset),
    systemCM             (a.systemCM),
@@ -1182,8 +1192,16 @@ Spacecraft& Spacecraft::operator=(const Spacecraft &a)
    massPropertiesModelType        = a.massPropertiesModelType;
    massPropertiesModeled          = a.massPropertiesModeled;
 
-   cmInterp             = a.cmInterp;
-   moiInterp            = a.moiInterp;
+   cmMasses             = a.cmMasses;
+   cmTableMasses        = a.cmTableMasses;
+   cmTableValues        = a.cmTableValues;
+   cmTableIndex         = 0;
+   cmLookupMass         = -1.0;
+   moiMasses            = a.moiMasses;
+   moiTableMasses       = a.moiTableMasses;
+   moiTableValues       = a.moiTableValues;
+   moiTableIndex        = 0;
+   moiLookupMass        = -1.0;
 
    table_CM_Offset      = a.table_CM_Offset;
    table_MOI_Offset     = a.table_MOI_Offset;
@@ -1939,9 +1957,11 @@ Rvector3 Spacecraft::LookupSystemCM (Real currentMass)
       throw soe;
    }
 
-   if (cmInterp != NULL)
+   // The table is only interpolated when the mass has changed
+   if (!cmTableMasses.empty() && (currentMass != cmLookupMass))
    {
       systemCM = InterpolateCM(currentMass);
+      cmLookupMass = currentMass;
    }
 
    return systemCM;
@@ -1986,8 +2006,11 @@ Rmatrix33 Spacecraft::LookupSystemMOI (Real currentMass)
       throw soe;
    }
 
-   if (moiInterp != NULL)
+   if (!moiTableMasses.empty() && (currentMass != moiLookupMass))
+   {
       systemMOI = InterpolateMOI(currentMass);
+      moiLookupMass = currentMass;
+   }
 
    return systemMOI;
 }
@@ -2007,13 +2030,13 @@ Rvector3 Spacecraft::InterpolateCM(const Real currentMass)
    Rvector3 currentCM;
    Real     cmData[3];
 
-   if (cmInterp->Interpolate(currentMass, cmData))
-   {
-      // CM location
-      currentCM(0) = cmData[0] + table_CM_Offset[0];
-      currentCM(1) = cmData[1] + table_CM_Offset[1];
-      currentCM(2) = cmData[2] + table_CM_Offset[2];
-   }
+   InterpolateMassTable(cmTableMasses, cmTableValues, 3, currentMass,
+                        cmTableIndex, cmData);
+
+   // CM location
+   currentCM(0) = cmData[0] + table_CM_Offset[0];
+   currentCM(1) = cmData[1] + table_CM_Offset[1];
+   currentCM(2) = cmData[2] + table_CM_Offset[2];
 
    return currentCM;
 }
@@ -2033,45 +2056,45 @@ Rmatrix33 Spacecraft::InterpolateMOI(const Real currentMass)
    Rmatrix33 currentMOI;
    Real      moiData[6];
 
-   if (moiInterp->Interpolate(currentMass, moiData))
-   {
-      std::string warningMsg = "Warning:  MOI tensor must have diagonal "
-                               "elements greater than or equal to zero. "
-                               "The current MOI";
-      // MOI location
-      currentMOI(0,0) = moiData[0] + table_MOI_Offset[0];
-      if (currentMOI(0,0) < 0.0)
-      {
-         currentMOI(0,0) = 0.0;
-         MessageInterface::ShowMessage("\n%s XX is set to zero.\n",
-                                       warningMsg.c_str());
-      }
+   InterpolateMassTable(moiTableMasses, moiTableValues, 6, currentMass,
+                        moiTableIndex, moiData);
 
-      currentMOI(1,1) = moiData[1] + table_MOI_Offset[1];
-      if (currentMOI(1,1) < 0.0)
-      {
-         currentMOI(1,1) = 0.0;
-         MessageInterface::ShowMessage("\n%s YY is set to zero.\n",
-                                       warningMsg.c_str());
-      }
+   std::string warningMsg = "Warning:  MOI tensor must have diagonal "
+                            "elements greater than or equal to zero. "
+                            "The current MOI";
+   // MOI location
+   currentMOI(0,0) = moiData[0] + table_MOI_Offset[0];
+   if (currentMOI(0,0) < 0.0)
+   {
+      currentMOI(0,0) = 0.0;
+      MessageInterface::ShowMessage("\n%s XX is set to zero.\n",
+                                    warningMsg.c_str());
+   }
 
-      currentMOI(2,2) = moiData[2] + table_MOI_Offset[2];
-      if (currentMOI(2,2) < 0.0)
-      {
-         currentMOI(2,2) = 0.0;
-         MessageInterface::ShowMessage("\n%s ZZ is set to zero.\n",
-                                       warningMsg.c_str());
-      }
+   currentMOI(1,1) = moiData[1] + table_MOI_Offset[1];
+   if (currentMOI(1,1) < 0.0)
+   {
+      currentMOI(1,1) = 0.0;
+      MessageInterface::ShowMessage("\n%s YY is set to zero.\n",
+                                    warningMsg.c_str());
+   }
 
-      // Product - it's symmetric for MOI location
-      currentMOI(0,1) = moiData[3] + table_MOI_Offset[3];
-      currentMOI(1,0) = currentMOI(0,1);
-      currentMOI(0,2) = moiData[4] + table_MOI_Offset[4];
-      currentMOI(2,0) = currentMOI(0,2);
-      currentMOI(1,2) = moiData[5] + table_MOI_Offset[5];
-      currentMOI(2,1) = currentMOI(1,2);
+   currentMOI(2,2) = moiData[2] + table_MOI_Offset[2];
+   if (currentMOI(2,2) < 0.0)
+   {
+      currentMOI(2,2) = 0.0;
+      MessageInterface::ShowMessage("\n%s ZZ is set to zero.\n",
+                                    warningMsg.c_str());
    }
 
+   // Product - it's symmetric for MOI location
+   currentMOI(0,1) = moiData[3] + table_MOI_Offset[3];
+   currentMOI(1,0) = currentMOI(0,1);
+   currentMOI(0,2) = moiData[4] + table_MOI_Offset[4];
+   currentMOI(2,0) = currentMOI(0,2);
+   currentMOI(1,2) = moiData[5] + table_MOI_Offset[5];
+   currentMOI(2,1) = currentMOI(1,2);
+
    return currentMOI;
 }
 
@@ -2241,25 +2264,22 @@ void Spacecraft::LoadCMTable(const std::string &filename)
       throw soe;
    }
 
+   cmMasses.clear();
    cmMasses.push_back(lowMass);
    cmMasses.push_back(highMass);
 
-   // Create CM Lagrange Interprolator
-   if (cmInterp == NULL)
-      cmInterp = new LagrangeInterpolator("CM-Interpolator", 3, 1);
-
-   // Prepare the interpolator
-   cmInterp->Clear();
-
-   Real data[3];
+   // Build the interpolation table
+   RealArray rows;
    for (UnsignedInt i=0; i < masses.size(); ++i)
    {
       for (UnsignedInt j=0; j < 3; j++)
       {
-         data[j] = values[i][j];
+         rows.push_back(values[i][j]);
       }
-      cmInterp->AddPoint(masses[i], data);
    }
+   BuildMassTable(masses, rows, 3, cmTableMasses, cmTableValues);
+   cmTableIndex = 0;
+   cmLookupMass = -1.0;
 }
 
 //--------------------------------------------------------------------------
@@ -2442,25 +2462,111 @@ void Spacecraft::LoadMOITable(const std::string &filename)
       throw soe;
    }
 
+   moiMasses.clear();
    moiMasses.push_back(lowMass);
    moiMasses.push_back(highMass);
 
-   // Create CM Lagrange Interprolator
-   if (moiInterp == NULL)
-      moiInterp = new LagrangeInterpolator("MOI-Interpolator", 6, 1);
-
-   // Prepare the interpolator
-   moiInterp->Clear();
-
-   Real moiData[6];
+   // Build the interpolation table
+   RealArray rows;
    for (UnsignedInt i=0; i < masses.size(); ++i)
    {
       for (UnsignedInt j=0; j < 6; j++)
       {
-         moiData[j] = values[i][j];
+         rows.push_back(values[i][j]);
+      }
+   }
+   BuildMassTable(masses, rows, 6, moiTableMasses, moiTableValues);
+   moiTableIndex = 0;
+   moiLookupMass = -1.0;
+}
+
+//--------------------------------------------------------------------------
+// void BuildMassTable(const RealArray &masses, const RealArray &rows,
+//                     Integer width, RealArray &tableMasses,
+//                     RealArray &tableValues)
+//--------------------------------------------------------------------------
+/**
+ * Builds a mass properties table sorted by increasing mass.
+ *
+ * @param masses         The masses read from the file
+ * @param rows           The data read from the file, width values per mass
+ * @param width          The number of values in each row
+ * @param tableMasses    The sorted masses
+ * @param tableValues    The rows in the order of tableMasses
+ */
+void Spacecraft::BuildMassTable(const RealArray &masses, const RealArray &rows,
+                                Integer width, RealArray &tableMasses,
+                                RealArray &tableValues)
+{
+   std::vector<UnsignedInt> order(masses.size());
+   for (UnsignedInt i = 0; i < masses.size(); ++i)
+      order[i] = i;
+   std::stable_sort(order.begin(), order.end(),
+         [&masses](UnsignedInt a, UnsignedInt b)
+         { return masses[a] < masses[b]; });
+
+   tableMasses.resize(masses.size());
+   tableValues.resize(masses.size() * width);
+   for (UnsignedInt i = 0; i < order.size(); ++i)
+   {
+      tableMasses[i] = masses[order[i]];
+      for (Integer j = 0; j < width; ++j)
+         tableValues[i*width + j] = rows[order[i]*width + j];
+   }
+}
+
+//--------------------------------------------------------------------------
+// void InterpolateMassTable(const RealArray &tableMasses,
+//                           const RealArray &tableValues, Integer width,
+//                           Real currentMass, Integer &hint, Real *result)
+//--------------------------------------------------------------------------
+/**
+ * Linearly interpolates a mass properties table.
+ *
+ * The interval used last is tried first, then the one below it since mass
+ * drops steadily during a burn, before the table is searched.
+ *
+ * @param tableMasses    The table masses, in increasing order
+ * @param tableValues    The table rows, width values per mass
+ * @param width          The number of values in each row
+ * @param currentMass    The mass for the lookup
+ * @param hint           The first row of the interval used last; updated
+ * @param result         Array that receives the width interpolated values
+ */
+void Spacecraft::InterpolateMassTable(const RealArray &tableMasses,
+                                      const RealArray &tableValues,
+                                      Integer width, Real currentMass,
+                                      Integer &hint, Real *result)
+{
+   Integer last = (Integer)tableMasses.size() - 2;
+   Integer i = hint;
+
+   if ((i < 0) || (i > last))
+      i = 0;
+
+   if ((currentMass < tableMasses[i]) || (currentMass > tableMasses[i+1]))
+   {
+      if ((i > 0) && (currentMass < tableMasses[i]) &&
+          (currentMass >= tableMasses[i-1]))
+         --i;
+      else
+      {
+         i = (Integer)(std::upper_bound(tableMasses.begin(), tableMasses.end(),
+               currentMass) - tableMasses.begin()) - 1;
+         if (i < 0)
+            i = 0;
+         if (i > last)
+            i = last;
       }
-      moiInterp->AddPoint(masses[i], moiData);
    }
+   hint = i;
+
+   Real span   = tableMasses[i+1] - tableMasses[i];
+   Real factor = (span != 0.0 ? (currentMass - tableMasses[i]) / span : 0.0);
+   const Real *low  = &tableValues[i*width];
+   const Real *high = &tableValues[(i+1)*width];
+   for (Integer j = 0; j < width; ++j)
+      result[j] = low[j] + factor * (high[j] - low[j]);
 }
 
 //--------------------------------------------------------------------------
@@ -2548,13 +2654,23 @@ Rvector3 Spacecraft::GetNPlateSRPReflectance(const Rvector3 &sunSC, Rmatrix33 &M
          NULL, NULL, j2000Body, solarSystem);
    }
 
-   Rvector3 reflectance(0.0, 0.0, 0.0);
-   for (Integer i = 0; i < plateList.size(); ++i)
+   if (!plateGeometry.IsCurrent(plateList))
+      plateGeometry.Pack(plateList);
+
+   // FixedInBody and SunFacing plates are summed from the packed data
+   Real sHat[3] = { sHatI[0], sHatI[1], sHatI[2] };
+   Real packed[3] = { 0.0, 0.0, 0.0 };
+   plateGeometry.AddReflectance(sHat, MT, packed);
+   Rvector3 reflectance(packed[0], packed[1], packed[2]);
+
+   // Plates with a history file are evaluated one at a time
+   const std::vector<Plate*> &filePlates = plateGeometry.GetUnpackedPlates();
+   for (Integer i = 0; i < filePlates.size(); ++i)
    {
-      ((Plate*)plateList[i])->StoreSpacecraftInertialCoordinateSystem(scInertialCS);
+      filePlates[i]->StoreSpacecraftInertialCoordinateSystem(scInertialCS);
 
-      ////Rvector3 plateReflectance = ((Plate*)plateList[i])->GetReflectance(sHatB, epochGT, MT);
-      Rvector3 plateReflectance = ((Plate*)plateList[i])->GetReflectanceI(sHatI, epochGT, MT);
+      ////Rvector3 plateReflectance = filePlates[i]->GetReflectance(sHatB, epochGT, MT);
+      Rvector3 plateReflectance = filePlates[i]->GetReflectanceI(sHatI, epochGT, MT);
       reflectance = reflectance + plateReflectance;
    }
 
@@ -2617,6 +2733,38 @@ std::vector<Rvector3> Spacecraft::GetNPlateSRPReflectanceDerivative(const Rvecto
          reflectanceDeriv.push_back(zero);
       }
    }
+   else if ((runningCommandFlag == 1) || (runningCommandFlag == 2))
+   {
+      // When running simulation command or propagation command, only
+      // derivative w.r.t. spacecraft position and velocity is needed, so the
+      // packed plates are used and the solve-for derivatives are skipped
+      if (scInertialCS == NULL)
+      {
+         scInertialCS = CoordinateSystem::CreateLocalCoordinateSystem("scInertialCS", "MJ2000Eq", origin,
+            NULL, NULL, j2000Body, solarSystem);
+      }
+
+      if (!plateGeometry.IsCurrent(plateList))
+         plateGeometry.Pack(plateList);
+
+      Real sun[3] = { sunSC[0], sunSC[1], sunSC[2] };
+      Real deriv[3][6] = { { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+                           { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+                           { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 } };
+      plateGeometry.AddReflectanceStateDerivative(sun, MT, dMT, deriv);
+      for (Integer stateIndex = 0; stateIndex < 6; ++stateIndex)
+         reflectanceDeriv.push_back(Rvector3(deriv[0][stateIndex],
+               deriv[1][stateIndex], deriv[2][stateIndex]));
+
+      const std::vector<Plate*> &filePlates = plateGeometry.GetUnpackedPlates();
+      for (Integer i = 0; i < filePlates.size(); ++i)
+      {
+         filePlates[i]->StoreSpacecraftInertialCoordinateSystem(scInertialCS);
+         std::vector<Rvector3> plateDerivI = filePlates[i]->GetReflectanceDerivativeI(sunSC, MT, dMT, epochGT);
+         for (Integer stateIndex = 0; stateIndex < 6; ++stateIndex)
+            reflectanceDeriv[stateIndex] = reflectanceDeriv[stateIndex] + plateDerivI[stateIndex];
+      }
+   }
    else
    {
       // Create a MJ2000Eq coordinate system with origin at the center of j2000 body
@@ -2704,14 +2852,6 @@ std::vector<Rvector3> Spacecraft::GetNPlateSRPReflectanceDerivative(const Rvecto
             }
          }
       }
-
-      if ((runningCommandFlag == 1)|| (runningCommandFlag == 2))
-      {
-         // When running simulation command or propagation command, only derivative w.r.t. spacecraft position and velocity are kept.
-         Integer numRemove = reflectanceDeriv.size() - 6;
-         for (Integer i = 0; i < numRemove; ++i)
-            reflectanceDeriv.pop_back();
-      }
    }
    return reflectanceDeriv;
 }
@@ -4309,32 +4449,32 @@ Integer Spacecraft::GetParameterID(const std::string &strInput) const
          return ADD_HARDWARE;
 
       // first check the multiple reps
-      Integer sz = EndMultipleReps - CART_X;
-      for (Integer ii = 0; ii < sz; ii++)
+      static const ParameterIndex
+            multipleRepIndex(MULT_REP_STRINGS, CART_X, EndMultipleReps);
+      Integer parameterId = multipleRepIndex.Find(str);
+      if (parameterId != -1)
       {
-         if (str == MULT_REP_STRINGS[ii])
-         {
-            #ifdef DEBUG_GET_REAL
-            MessageInterface::ShowMessage(
-            "In SC::GetParameterID, multiple reps found!! - str = %s and id = %d\n ",
-            str.c_str(), (ii + CART_X));
-            #endif
-            return ii + CART_X;
-         }
+         #ifdef DEBUG_GET_REAL
+         MessageInterface::ShowMessage(
+         "In SC::GetParameterID, multiple reps found!! - str = %s and id = %d\n ",
+         str.c_str(), parameterId);
+         #endif
+         return parameterId;
       }
 
       // Check for element label
-      for (Integer i = SpaceObjectParamCount; i < SpacecraftParamCount; ++i)
+      static const ParameterIndex
+            parameterIndex(PARAMETER_LABEL, SpaceObjectParamCount,
+                  SpacecraftParamCount);
+      parameterId = parameterIndex.Find(str);
+      if (parameterId != -1)
       {
-         if (str == PARAMETER_LABEL[i - SpaceObjectParamCount])
-         {
-            #ifdef DEBUG_GET_REAL
-            MessageInterface::ShowMessage(
-            "In SC::GetParameterID, getting id %d for str = %s\n ",
-            i, str.c_str());
-            #endif
-            return i;
-         }
+         #ifdef DEBUG_GET_REAL
+         MessageInterface::ShowMessage(
+         "In SC::GetParameterID, getting id %d for str = %s\n ",
+         parameterId, str.c_str());
+         #endif
+         return parameterId;
       }
       if ((str == "STM") || (str == "OrbitSTM"))
          return FULL_STM;
@@ -5247,6 +5387,9 @@ Real Spacecraft::SetRealParameter(const Integer id, const Real value)
    if (id >= MASS_PROPERTIES_TBL_CM_OFFSET_X_ID &&
        id <= MASS_PROPERTIES_TBL_MOI_OFFSET_YZ_ID)
    {
+      // The offsets are part of the looked up values
+      cmLookupMass = moiLookupMass = -1.0;
+
       switch (id)
       {
          case MASS_PROPERTIES_TBL_CM_OFFSET_X_ID:
@@ -13374,3 +13517,162 @@ std::vector<std::string> Spacecraft::GetEphemerisFileTypes()
 {
    return ephemerisFileTypes;
 }
+
+
+//------------------------------------------------------------------------------
+// void SaveLoopState(LoopState &saved) const
+//------------------------------------------------------------------------------
+/**
+ * Saves the data that propagation and maneuvers change, so that a solver
+ * pass can be undone without copying the whole spacecraft
+ *
+ * The hardware layout and the force model settings are saved as well; the
+ * data can only be restored in place while those are unchanged.  The
+ * maneuvering state is not saved, matching the assignment operator.
+ *
+ * @param saved The saved data
+ */
+//------------------------------------------------------------------------------
+void Spacecraft::SaveLoopState(LoopState &saved) const
+{
+   saved.state           = state;
+   saved.epochString     = scEpochStr;
+   saved.anomaly         = trueAnomaly;
+   saved.mass            = totalMass;
+   if ((saved.stm.GetNumRows() != fullSTM.GetNumRows()) ||
+       (saved.stm.GetNumColumns() != fullSTM.GetNumColumns()))
+      saved.stm.SetSize(fullSTM.GetNumRows(), fullSTM.GetNumColumns());
+   saved.stm             = fullSTM;
+   if ((saved.aMatrix.GetNumRows() != fullAMatrix.GetNumRows()) ||
+       (saved.aMatrix.GetNumColumns() != fullAMatrix.GetNumColumns()))
+      saved.aMatrix.SetSize(fullAMatrix.GetNumRows(), fullAMatrix.GetNumColumns());
+   saved.aMatrix         = fullAMatrix;
+   saved.stopsTriggered  = lastStopTriggered;
+   saved.published       = hasPublished;
+   saved.ephemPropagated = hasEphemPropagated;
+
+   saved.fuelMasses.clear();
+   for (UnsignedInt i = 0; i < tanks.size(); ++i)
+      saved.fuelMasses.push_back(tanks[i]->GetRealParameter("FuelMass"));
+
+   saved.hardware = tankNames;
+   saved.hardware.insert(saved.hardware.end(), thrusterNames.begin(),
+         thrusterNames.end());
+   saved.hardware.insert(saved.hardware.end(), hardwareNames.begin(),
+         hardwareNames.end());
+   saved.hardware.insert(saved.hardware.end(), plateNames.begin(),
+         plateNames.end());
+   saved.hardware.push_back(attitude ? attitude->GetTypeName() : "");
+
+   saved.config[0] = dryMass;
+   saved.config[1] = coeffDrag;
+   saved.config[2] = reflectCoeff;
+   saved.config[3] = dragArea;
+   saved.config[4] = srpArea;
+   saved.config[5] = cdEpsilon;
+   saved.config[6] = crEpsilon;
+}
+
+
+//------------------------------------------------------------------------------
+// bool MatchesLoopState(const LoopState &saved) const
+//------------------------------------------------------------------------------
+/**
+ * Checks that the hardware layout and force model settings are the ones
+ * saved, so that RestoreLoopState() restores the spacecraft completely
+ *
+ * @param saved The saved data
+ *
+ * @return true if the spacecraft can be restored in place
+ */
+//------------------------------------------------------------------------------
+bool Spacecraft::MatchesLoopState(const LoopState &saved) const
+{
+   // An integrated attitude is not part of the saved data
+   if (attitudeDynamics)
+      return false;
+
+   if ((tanks.size() != saved.fuelMasses.size()) ||
+       (state.GetSize() != saved.state.GetSize()))
+      return false;
+
+   UnsignedInt count = tankNames.size() + thrusterNames.size() +
+         hardwareNames.size() + plateNames.size() + 1;
+   if (saved.hardware.size() != count)
+      return false;
+
+   UnsignedInt index = 0;
+   for (UnsignedInt i = 0; i < tankNames.size(); ++i, ++index)
+      if (tankNames[i] != saved.hardware[index])
+         return false;
+   for (UnsignedInt i = 0; i < thrusterNames.size(); ++i, ++index)
+      if (thrusterNames[i] != saved.hardware[index])
+         return false;
+   for (UnsignedInt i = 0; i < hardwareNames.size(); ++i, ++index)
+      if (hardwareNames[i] != saved.hardware[index])
+         return false;
+   for (UnsignedInt i = 0; i < plateNames.size(); ++i, ++index)
+      if (plateNames[i] != saved.hardware[index])
+         return false;
+   if ((attitude ? attitude->GetTypeName() : "") != saved.hardware[index])
+      return false;
+
+   return (dryMass == saved.config[0]) && (coeffDrag == saved.config[1]) &&
+          (reflectCoeff == saved.config[2]) && (dragArea == saved.config[3]) &&
+          (srpArea == saved.config[4]) && (cdEpsilon == saved.config[5]) &&
+          (crEpsilon == saved.config[6]);
+}
+
+
+//------------------------------------------------------------------------------
+// void RestoreLoopState(const LoopState &saved)
+//------------------------------------------------------------------------------
+/**
+ * Restores the data saved by SaveLoopState(), copying into the existing
+ * state, matrices and tanks
+ *
+ * Call MatchesLoopState() first; a spacecraft that does not match is
+ * restored from a full copy instead.
+ *
+ * @param saved The saved data
+ */
+//------------------------------------------------------------------------------
+void Spacecraft::RestoreLoopState(const LoopState &saved)
+{
+   Integer size = saved.state.GetSize();
+   if (state.GetSize() == size)
+   {
+      Real *data = state.GetState();
+      for (Integer i = 0; i < size; ++i)
+         data[i] = saved.state[i];
+      state.SetEpoch(saved.state.GetEpoch());
+      state.SetEpochGT(saved.state.GetEpochGT());
+      state.SetPrecisionTimeFlag(saved.state.HasPrecisionTime());
+   }
+   else
+      state = saved.state;
+
+   scEpochStr         = saved.epochString;
+   trueAnomaly        = saved.anomaly;
+   totalMass          = saved.mass;
+   if ((fullSTM.GetNumRows() != saved.stm.GetNumRows()) ||
+       (fullSTM.GetNumColumns() != saved.stm.GetNumColumns()))
+      fullSTM.SetSize(saved.stm.GetNumRows(), saved.stm.GetNumColumns());
+   fullSTM            = saved.stm;
+   if ((fullAMatrix.GetNumRows() != saved.aMatrix.GetNumRows()) ||
+       (fullAMatrix.GetNumColumns() != saved.aMatrix.GetNumColumns()))
+      fullAMatrix.SetSize(saved.aMatrix.GetNumRows(), saved.aMatrix.GetNumColumns());
+   fullAMatrix        = saved.aMatrix;
+   lastStopTriggered  = saved.stopsTriggered;
+   hasPublished       = saved.published;
+   hasEphemPropagated = saved.ephemPropagated;
+
+   for (UnsignedInt i = 0; i < tanks.size() && i < saved.fuelMasses.size(); ++i)
+   {
+      if (tanks[i]->GetRealParameter("FuelMass") != saved.fuelMasses[i])
+         tanks[i]->SetRealParameter("FuelMass", saved.fuelMasses[i]);
+   }
+
+   // Always update after restoring, as after assignment
+   parmsChanged = true;
+}
@@ -45,6 +45,7 @@
 #include "SPADFileReader.hpp"
 #include "Array.hpp"
 #include "LagrangeInterpolator.hpp"
+#include "NPlateGeometry.hpp"
 
 // Declare forward reference
 class EphemManager;
@@ -358,6 +359,29 @@ public:
    void                                  SetEphemerisFileTypes(std::string type);
    std::vector<std::string>              GetEphemerisFileTypes();
 
+   /// Runtime data that a solver pass changes, saved and restored in place
+   struct LoopState
+   {
+      GmatState      state;
+      std::string    epochString;
+      Real           anomaly;
+      Real           mass;
+      Rmatrix        stm;
+      Rmatrix        aMatrix;
+      RealArray      fuelMasses;
+      StringArray    stopsTriggered;
+      bool           published;
+      bool           ephemPropagated;
+
+      // Configuration that must match for an in place restore
+      StringArray    hardware;
+      Real           config[7];
+   };
+
+   void              SaveLoopState(LoopState &saved) const;
+   bool              MatchesLoopState(const LoopState &saved) const;
+   void              RestoreLoopState(const LoopState &saved);
+
 
 
 protected:
@@ -658,11 +682,25 @@ protected:
 
    // Center of Mass (CM) Table Data
    RealArray cmMasses;
-   LagrangeInterpolator *cmInterp;
+   /// CM table masses, sorted into increasing order when the table is loaded
+   RealArray cmTableMasses;
+   /// CM table rows (x, y, z) matching cmTableMasses
+   RealArray cmTableValues;
+   /// First row of the CM table interval used last
+   Integer   cmTableIndex;
+   /// Total mass used for the current systemCM, or -1 if it must be rebuilt
+   Real      cmLookupMass;
 
    // MOI Table Data
    RealArray moiMasses;
-   LagrangeInterpolator *moiInterp;
+   /// MOI table masses, sorted into increasing order when the table is loaded
+   RealArray moiTableMasses;
+   /// MOI table rows (xx, yy, zz, xy, xz, yz) matching moiTableMasses
+   RealArray moiTableValues;
+   /// First row of the MOI table interval used last
+   Integer   moiTableIndex;
+   /// Total mass used for the current systemMOI, or -1 if it must be rebuilt
+   Real      moiLookupMass;
 
 
    /// Cd0
@@ -943,6 +981,14 @@ protected:
    Rmatrix33         LookupSystemMOI(Real currentMass);
    Rvector3          InterpolateCM(const Real currentMass);
    Rmatrix33         InterpolateMOI(const Real currentMass);
+   void              BuildMassTable(const RealArray &masses,
+                                    const RealArray &rows, Integer width,
+                                    RealArray &tableMasses,
+                                    RealArray &tableValues);
+   void              InterpolateMassTable(const RealArray &tableMasses,
+                                          const RealArray &tableValues,
+                                          Integer width, Real currentMass,
+                                          Integer &hint, Real *result);
 
    // function to model change in mass
    bool              ApplyTotalMass(Real newMass);
@@ -1003,6 +1049,8 @@ private:
    std::vector<Rvector3>   reflectanceDeriv;
 
    CoordinateSystem*       scInertialCS;
+   /// Packed FixedInBody and SunFacing plates, repacked when a plate changes
+   NPlateGeometry          plateGeometry;
 
 };
 
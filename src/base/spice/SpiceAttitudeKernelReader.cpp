@@ -167,6 +167,8 @@ void  SpiceAttitudeKernelReader::GetCoverageStartAndEnd(StringArray       &kerne
                                                         Real              &end,
                                                         bool              needAngVel)
 {
+   AccessLock spiceLock;
+
    // first check to see if a kernel specified is not loaded; if not,
    // try to load it
    for (unsigned int ii = 0; ii < kernels.size(); ii++)
@@ -361,6 +363,8 @@ void SpiceAttitudeKernelReader::GetTargetOrientation(const std::string &objectNa
                                                      Rvector3          &angVel,
                                                      const std::string &referenceFrame)
 {
+   AccessLock spiceLock;
+
    #ifdef DEBUG_CK_READING
       MessageInterface::ShowMessage("Entering GetTargetOrientation for object %s, with NAIF ID %d, at time %12.10f, with frame = %s\n",
          objectName.c_str(), naifID, atTime.Get(), referenceFrame.c_str());
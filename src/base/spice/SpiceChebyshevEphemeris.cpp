@@ -0,0 +1,129 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            SpiceChebyshevEphemeris
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the SpiceChebyshevEphemeris class.
+ */
+//------------------------------------------------------------------------------
+
+#include "SpiceChebyshevEphemeris.hpp"
+#include "SpiceOrbitKernelReader.hpp"
+#include "GmatConstants.hpp"
+
+
+//------------------------------------------------------------------------------
+// SpiceChebyshevEphemeris(SpiceOrbitKernelReader *reader,
+//                         const std::string &targetName, Integer targetId,
+//                         const std::string &observerName, Integer observerId,
+//                         Real posTolerance, Real velTolerance)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param reader       The kernel reader, with the kernels loaded
+ * @param targetName   Name of the target body
+ * @param targetId     NAIF ID of the target body
+ * @param observerName Name of the observing body
+ * @param observerId   NAIF ID of the observing body
+ * @param posTolerance Allowed position error of the fit, in km
+ * @param velTolerance Allowed velocity error of the fit, in km/s
+ */
+//------------------------------------------------------------------------------
+SpiceChebyshevEphemeris::SpiceChebyshevEphemeris(
+      SpiceOrbitKernelReader *reader, const std::string &targetName,
+      Integer targetId, const std::string &observerName, Integer observerId,
+      Real posTolerance, Real velTolerance) :
+   ChebyshevEphemeris   (posTolerance, velTolerance),
+   kernelReader         (reader),
+   target               (targetName),
+   targetNaifId         (targetId),
+   observer             (observerName),
+   observerNaifId       (observerId)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~SpiceChebyshevEphemeris()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+SpiceChebyshevEphemeris::~SpiceChebyshevEphemeris()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// bool SampleState(Real a1Mjd, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Reads the state of the target from the kernels.
+ *
+ * @param a1Mjd The A.1 modified Julian epoch
+ * @param state The state
+ *
+ * @return false if the kernels do not cover the epoch
+ */
+//------------------------------------------------------------------------------
+bool SpiceChebyshevEphemeris::SampleState(Real a1Mjd, Real *state)
+{
+   Rvector6 spiceState = kernelReader->GetTargetState(target, targetNaifId,
+         A1Mjd(a1Mjd), observer, observerNaifId);
+
+   // The reader flags the epochs it could not read
+   if (spiceState[0] == -GmatRealConstants::REAL_MAX)
+      return false;
+
+   for (Integer i = 0; i < 6; ++i)
+      state[i] = spiceState[i];
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool SampleStates(Integer count, const Real *a1Mjds, Real (*states)[6])
+//------------------------------------------------------------------------------
+/**
+ * Reads the states of the target at a batch of epochs from the kernels,
+ * taking the CSPICE access lock once for the batch.
+ *
+ * @param count  The number of epochs
+ * @param a1Mjds The A.1 modified Julian epochs
+ * @param states The states
+ *
+ * @return false if the kernels do not cover one of the epochs
+ */
+//------------------------------------------------------------------------------
+bool SpiceChebyshevEphemeris::SampleStates(Integer count, const Real *a1Mjds,
+                                           Real (*states)[6])
+{
+   RealArray epochs(a1Mjds, a1Mjds + count);
+   std::vector<Rvector6> spiceStates;
+   if (!kernelReader->GetTargetStates(target, targetNaifId, epochs, observer,
+         observerNaifId, spiceStates))
+      return false;
+
+   for (Integer k = 0; k < count; ++k)
+      for (Integer i = 0; i < 6; ++i)
+         states[k][i] = spiceStates[k][i];
+   return true;
+}
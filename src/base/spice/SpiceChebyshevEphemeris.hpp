@@ -0,0 +1,68 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            SpiceChebyshevEphemeris
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the SpiceChebyshevEphemeris class, the Chebyshev fit of the
+ * SPK states of a body.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef SpiceChebyshevEphemeris_hpp
+#define SpiceChebyshevEphemeris_hpp
+
+#include "gmatdefs.hpp"
+#include "ChebyshevEphemeris.hpp"
+
+class SpiceOrbitKernelReader;
+
+/**
+ * Chebyshev fit of the states of a target body with respect to an observer,
+ * sampled from the loaded SPK kernels
+ *
+ * The kernel reader goes through the CSPICE global state for every state; the
+ * fit replaces those calls with a local polynomial evaluation once the segment
+ * covering an epoch has been built.  The states are sampled with no aberration
+ * correction in the J2000 frame, as CelestialBody reads them.
+ */
+class GMAT_API SpiceChebyshevEphemeris : public ChebyshevEphemeris
+{
+public:
+   SpiceChebyshevEphemeris(SpiceOrbitKernelReader *reader,
+                           const std::string &targetName, Integer targetId,
+                           const std::string &observerName, Integer observerId,
+                           Real posTolerance, Real velTolerance);
+   virtual ~SpiceChebyshevEphemeris();
+
+protected:
+   /// The kernel reader
+   SpiceOrbitKernelReader  *kernelReader;
+   /// The target body
+   std::string             target;
+   Integer                 targetNaifId;
+   /// The observing body
+   std::string             observer;
+   Integer                 observerNaifId;
+
+   virtual bool            SampleState(Real a1Mjd, Real *state);
+   virtual bool            SampleStates(Integer count, const Real *a1Mjds,
+                                        Real (*states)[6]);
+};
+
+#endif // SpiceChebyshevEphemeris_hpp
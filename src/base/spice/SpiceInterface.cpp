@@ -119,6 +119,24 @@ std::string    SpiceInterface::lsKernel = "";
 // static public methods
 //------------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------
+//  std::recursive_mutex& GetAccessMutex()
+//------------------------------------------------------------------------------
+/**
+ * This method returns the lock that serializes all calls into CSPICE.
+ *
+ * The lock is built on first use, so it is available to objects created
+ * during static initialization.
+ *
+ * @return the CSPICE access lock
+ */
+//------------------------------------------------------------------------------
+std::recursive_mutex& SpiceInterface::GetAccessMutex()
+{
+   static std::recursive_mutex spiceAccess;
+   return spiceAccess;
+}
+
 //------------------------------------------------------------------------------
 //  bool IsValidKernel(const std::string &fileName, const std::string &ofType)
 //------------------------------------------------------------------------------
@@ -136,6 +154,8 @@ std::string    SpiceInterface::lsKernel = "";
 //------------------------------------------------------------------------------
 bool SpiceInterface::IsValidKernel(const std::string &fileName, const std::string &ofType)
 {
+   AccessLock spiceLock;
+
    #ifdef DEBUG_VALID_KERNEL
       MessageInterface::ShowMessage("Entering SpiceInterface::IsValidKernel with fileName = \"%s\" and ofType = \"%s\"\n",
             fileName.c_str(), ofType.c_str());
@@ -214,6 +234,8 @@ bool SpiceInterface::IsValidKernel(const std::string &fileName, const std::strin
 SpiceInterface::SpiceInterface() :
    kernelNameSPICE         (NULL)
 {
+   AccessLock spiceLock;
+
    theTimeConverter = TimeSystemConverter::Instance();
    InitializeInterface();
    numInstances++;
@@ -233,6 +255,8 @@ SpiceInterface::SpiceInterface() :
 SpiceInterface::SpiceInterface(const SpiceInterface &copy) :
    kernelNameSPICE         (NULL)
 {
+   AccessLock spiceLock;
+
    theTimeConverter = TimeSystemConverter::Instance();
    numInstances++;
 //   // the kernels are all loaded into that one kernel pool,
@@ -280,6 +304,8 @@ SpiceInterface& SpiceInterface::operator=(const SpiceInterface &copy)
 //------------------------------------------------------------------------------
 SpiceInterface::~SpiceInterface()
 {
+   AccessLock spiceLock;
+
    numInstances--;
    if (numInstances <= 0)
    {
@@ -321,6 +347,8 @@ SpiceInterface* SpiceInterface::Clone() const
 //------------------------------------------------------------------------------
 bool SpiceInterface::LoadKernel(const std::string &fileName)
 {
+   AccessLock spiceLock;
+
    #ifdef DEBUG_SPK_LOADING
 //      char *path=NULL;
 //      size_t size = 0;
@@ -408,6 +436,8 @@ bool SpiceInterface::LoadKernel(const std::string &fileName)
 //------------------------------------------------------------------------------
 bool SpiceInterface::LoadKernels(const StringArray &fileNames)
 {
+   AccessLock spiceLock;
+
    for (unsigned int ii = 0; ii < fileNames.size(); ii++)
       LoadKernel(fileNames.at(ii));
    return true;
@@ -427,6 +457,8 @@ bool SpiceInterface::LoadKernels(const StringArray &fileNames)
 //------------------------------------------------------------------------------
 bool SpiceInterface::UnloadKernel(const std::string &fileName)
 {
+   AccessLock spiceLock;
+
    bool        found          = false;
    std::string kernelToUnload = "";
 
@@ -501,6 +533,8 @@ bool SpiceInterface::UnloadKernel(const std::string &fileName)
 //------------------------------------------------------------------------------
 bool SpiceInterface::UnloadKernels(const StringArray &fileNames)
 {
+   AccessLock spiceLock;
+
    for (unsigned int ii = 0; ii < fileNames.size(); ii++)
       UnloadKernel(fileNames.at(ii));
    return true;
@@ -518,6 +552,8 @@ bool SpiceInterface::UnloadKernels(const StringArray &fileNames)
 //------------------------------------------------------------------------------
 bool SpiceInterface::UnloadAllKernels()
 {
+   AccessLock spiceLock;
+
    std::string kName;
    std::map<std::string, std::string>::iterator ii;
    for (ii = loadedKernels.begin(); ii != loadedKernels.end(); ++ii)
@@ -570,6 +606,8 @@ bool SpiceInterface::UnloadAllKernels()
 //------------------------------------------------------------------------------
 bool SpiceInterface::IsLoaded(const std::string &fileName)
 {
+   AccessLock spiceLock;
+
    #ifdef DEBUG_SPK_ISLOADED
       MessageInterface::ShowMessage("IsLoaded::Now attempting to find kernel name %s\n", fileName.c_str());
    #endif
@@ -641,6 +679,8 @@ StringArray SpiceInterface::GetValidFrames()
 //------------------------------------------------------------------------------
 void SpiceInterface::SetLeapSecondKernel(const std::string &lsk)
 {
+   AccessLock spiceLock;
+
    lsKernel = lsk;
    if (!IsLoaded(lsKernel))
    {
@@ -673,6 +713,8 @@ void SpiceInterface::SetLeapSecondKernel(const std::string &lsk)
 //------------------------------------------------------------------------------
 Integer SpiceInterface::GetNaifID(const std::string &forObj, bool popupMsg)
 {
+   AccessLock spiceLock;
+
    SpiceBoolean   found;
    SpiceInt       id;
    std::string    nameToUse = forObj;
@@ -772,6 +814,8 @@ SpiceDouble SpiceInterface::A1ToSpiceTime(Real a1Time)
 //void SpiceInterface::InitializeReader()
 void SpiceInterface::InitializeInterface()
 {
+   AccessLock spiceLock;
+
    if (numInstances == 0)
    {
       loadedKernels.clear();
@@ -44,6 +44,12 @@
  *
  * This is the base class.  Classes inheriting from this one handle the reading
  * or writing of specific types of data (orbit, attitude, ...).
+ *
+ * The CSPICE kernel pool and error state are process global and CSPICE is not
+ * reentrant, so every call into CSPICE is made holding the lock returned by
+ * GetAccessMutex(), usually through an AccessLock on the stack.  The lock is
+ * recursive so that locked methods can call each other.  Code that makes many
+ * queries in a row should take one AccessLock around the whole batch.
  */
 //------------------------------------------------------------------------------
 
@@ -55,6 +61,7 @@
 #include "Rvector6.hpp"
 #include "Rmatrix33.hpp"
 #include "TimeSystemConverter.hpp"   // for the TimeSystemConverter singleton
+#include <mutex>
 
 // include the appropriate SPICE C header(s)
 extern "C"  
@@ -68,6 +75,20 @@ extern "C"
 class GMAT_API SpiceInterface
 {
 public:
+   /// Holds the CSPICE access lock for its lifetime
+   class AccessLock
+   {
+   public:
+      AccessLock()  { GetAccessMutex().lock(); }
+      ~AccessLock() { GetAccessMutex().unlock(); }
+   private:
+      AccessLock(const AccessLock &lock);
+      AccessLock& operator=(const AccessLock &lock);
+   };
+
+   /// static method returning the lock that serializes CSPICE calls
+   static std::recursive_mutex& GetAccessMutex();
+
    /// static method to check for valid kernels
    static bool         IsValidKernel(const std::string &fileName, const std::string &ofType);
 
@@ -188,6 +188,8 @@ void  SpiceOrbitKernelReader::GetCoverageStartAndEnd(StringArray       &kernels,
                                                      Real              &start,
                                                      Real              &end)
 {
+   AccessLock spiceLock;
+
    #ifdef DEBUG_SPK_COVERAGE
       MessageInterface::ShowMessage("Entering GetCoverageStartAndEnd:\n");
       MessageInterface::ShowMessage("   forNaifId = %d\n", forNaifId);
@@ -393,6 +395,8 @@ void  SpiceOrbitKernelReader::GetCoverageSpans(StringArray       &kernels,
                                                RealArray         &start,
                                                RealArray         &end)
 {
+   AccessLock spiceLock;
+
    // first check to see if a kernel specified is not loaded; if not,
    // try to load it
    for (unsigned int ii = 0; ii < kernels.size(); ii++)
@@ -557,6 +561,8 @@ Rvector6 SpiceOrbitKernelReader::GetTargetState(const std::string &targetName,
                                  const std::string &referenceFrame,
                                  const std::string &aberration)
 {
+   AccessLock spiceLock;
+
    #ifdef DEBUG_SPK_READING
       MessageInterface::ShowMessage(
             "Entering SPKReader::GetTargetState with target = %s, naifId = %d, time = %12.10f, observer = %s, aberration = %s\n",
@@ -685,6 +691,8 @@ Rvector6 SpiceOrbitKernelReader::GetTargetState(const std::string &targetName,
    const std::string &referenceFrame,
    const std::string &aberration)
 {
+   AccessLock spiceLock;
+
 #ifdef DEBUG_SPK_READING
    MessageInterface::ShowMessage(
       "Entering SPKReader::GetTargetState with target = %s, naifId = %d, time = %s, observer = %s, aberration = %s\n",
@@ -778,6 +786,58 @@ Rvector6 SpiceOrbitKernelReader::GetTargetState(const std::string &targetName,
 
 
 
+//------------------------------------------------------------------------------
+//  bool GetTargetStates(const std::string &targetName,
+//                       const Integer     targetNAIFId,
+//                       const RealArray   &atTimes,
+//                       const std::string &observingBodyName,
+//                       const Integer     observingBodyNAIFId,
+//                       std::vector<Rvector6> &states,
+//                       const std::string &referenceFrame,
+//                       const std::string &aberration)
+//------------------------------------------------------------------------------
+/**
+ * This method returns the states of the target with respect to the observing
+ * body at a set of times, holding the CSPICE access lock once for the batch.
+ *
+ * @param <targetName>        name of the target object.
+ * @param <targetNAIFId>      NAIF ID of the target body
+ * @param <atTimes>           A1Mjd times at which the states are requested.
+ * @param <observingBodyName> name of the observing body
+ * @param <observingBodyNAIFId> NAIF ID of the observing body
+ * @param <states>            the states, one per time; states that could not
+ *                            be read are flagged as GetTargetState flags them
+ * @param <referenceFrame>    frame in which states should be returned
+ * @param <aberration>        flag indicating aberration corrections, if any
+ *
+ * @return false if any of the states could not be read
+ *
+ */
+//------------------------------------------------------------------------------
+bool SpiceOrbitKernelReader::GetTargetStates(const std::string &targetName,
+                                 const Integer     targetNAIFId,
+                                 const RealArray   &atTimes,
+                                 const std::string &observingBodyName,
+                                 const Integer     observingBodyNAIFId,
+                                 std::vector<Rvector6> &states,
+                                 const std::string &referenceFrame,
+                                 const std::string &aberration)
+{
+   AccessLock spiceLock;
+
+   bool allRead = true;
+   states.resize(atTimes.size());
+   for (UnsignedInt i = 0; i < atTimes.size(); ++i)
+   {
+      states[i] = GetTargetState(targetName, targetNAIFId, A1Mjd(atTimes[i]),
+            observingBodyName, observingBodyNAIFId, referenceFrame, aberration);
+      if (states[i][0] == -GmatRealConstants::REAL_MAX)
+         allRead = false;
+   }
+   return allRead;
+}
+
+
 //------------------------------------------------------------------------------
 //  void StoreErrorMessage(const std::string & targetName)
 //------------------------------------------------------------------------------
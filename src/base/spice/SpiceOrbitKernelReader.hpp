@@ -86,8 +86,15 @@ public:
       const std::string &referenceFrame = "J2000",
       const std::string &aberration = "NONE");
 
+   bool      GetTargetStates(const std::string &targetName,
+                             const Integer     targetNAIFId,
+                             const RealArray   &atTimes,
+                             const std::string &observingBodyName,
+                             const Integer     observingBodyNAIFId,
+                             std::vector<Rvector6> &states,
+                             const std::string &referenceFrame = "J2000",
+                             const std::string &aberration = "NONE");
 
-   
 
 protected:
 
@@ -111,6 +111,8 @@ SpiceOrbitKernelWriter::SpiceOrbitKernelWriter(const std::string      &objName,
    fm              (NULL),
    renameSPK       (renameExistingSPK)
 {
+   AccessLock spiceLock;
+
    #ifdef DEBUG_SPK_INIT
       MessageInterface::ShowMessage(
             "Entering constructor for SPKOrbitWriter with fileName = %s, objectName = %s, "
@@ -399,6 +401,8 @@ SpiceOrbitKernelWriter* SpiceOrbitKernelWriter::Clone(void) const
 void SpiceOrbitKernelWriter::WriteSegment(const A1Mjd &start, const A1Mjd &end,
                                      const StateArray &states, const EpochArray &epochs)
 {
+   AccessLock spiceLock;
+
    #ifdef DEBUG_SPK_KERNELS
       MessageInterface::ShowMessage("In SOKW::WriteSegment, start = %12.10, end = %12.10\n",
             start.Get(), end.Get());
@@ -589,6 +593,8 @@ void SpiceOrbitKernelWriter::SetBasicMetaData()
 //------------------------------------------------------------------------------
 void SpiceOrbitKernelWriter::FinalizeKernel(bool done, bool writeMetaData)
 {
+   AccessLock spiceLock;
+
    #ifdef DEBUG_SPK_WRITING
       MessageInterface::ShowMessage("In FinalizeKernel .... tmpFileOK = %s\n",
             (tmpFileOK? "true" : "false"));
@@ -668,6 +674,8 @@ Integer SpiceOrbitKernelWriter::GetMinNumberOfStates()
 //------------------------------------------------------------------------------
 void SpiceOrbitKernelWriter::WriteMetaData()
 {
+   AccessLock spiceLock;
+
    // open the temporary file for writing the metadata
    tmpTxtFile = fopen(tmpTxtFileName.c_str(), "w");
 
@@ -730,6 +738,8 @@ void SpiceOrbitKernelWriter::WriteMetaData()
 //------------------------------------------------------------------------------
 bool SpiceOrbitKernelWriter::OpenFileForWriting()
 {
+   AccessLock spiceLock;
+
    // get a file handle here
    SpiceInt        maxChar = MAX_CHAR_COMMENT;
    #ifdef DEBUG_SPK_INIT
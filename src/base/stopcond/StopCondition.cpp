@@ -135,6 +135,7 @@ StopCondition::StopCondition(const std::string &name, const std::string &desc,
      rhsWrapper           (NULL),
      mNumValidPoints      (0),
      mBufferSize          (0),
+     mBufferHead          (0),
      mStopEpoch           (REAL_PARAMETER_UNDEFINED),
      mStopInterval        (0.0),
      previousEpoch        (-999999.999999),
@@ -211,6 +212,7 @@ StopCondition::StopCondition(const StopCondition &copy)
      rhsWrapper           (copy.rhsWrapper),
      mNumValidPoints      (0),
      mBufferSize          (0),
+     mBufferHead          (0),
      mStopEpoch           (copy.mStopEpoch),
      mStopInterval        (0.0),
      previousEpoch        (-999999.999999),
@@ -460,6 +462,31 @@ StopCondition::~StopCondition()
  */
 //------------------------------------------------------------------------------
 bool StopCondition::Evaluate()
+{
+   if (mStopParam == NULL || (mAllowGoalParam && mGoalParam == NULL))
+      Initialize();
+   
+   return Evaluate(mStopParam->EvaluateReal());
+}
+
+
+//------------------------------------------------------------------------------
+// virtual bool Evaluate(Real stopValue)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the stopping condition for a stop parameter value that has already
+ * been computed for the current state.
+ *
+ * Propagate uses this when several stopping conditions share a stop parameter,
+ * so that the parameter is evaluated once per step.
+ *
+ * @param stopValue The current value of the stop parameter
+ *
+ * @return true if single parameter value stopping condition has been met;
+ *   false otherwise
+ */
+//------------------------------------------------------------------------------
+bool StopCondition::Evaluate(Real stopValue)
 {
    #ifdef DEBUG_STOPCOND_EVAL
       MessageInterface::ShowMessage(
@@ -506,7 +533,7 @@ bool StopCondition::Evaluate()
       epoch = mEpochParam->EvaluateReal();
    
    // set current value
-   currentParmValue = mStopParam->EvaluateReal();
+   currentParmValue = stopValue;
    
    #ifdef DEBUG_BUFFER_FILLING
    MessageInterface::ShowMessage
@@ -781,6 +808,7 @@ bool StopCondition::AddToBuffer(bool isInitialPoint)
    {
       // Reset the internal buffer and the point count
       mNumValidPoints = 1;  // We always have the data for the initial point
+      mBufferHead = 0;
       
       for (int i = 0; i < mBufferSize; ++i)
       {
@@ -799,24 +827,20 @@ bool StopCondition::AddToBuffer(bool isInitialPoint)
          mEpochBuffer[mBufferSize-1] = previousEpoch;
    }
 
-   // Roll values in the ring buffer to make room for newest value
-   for (int i = 0; i < mBufferSize-1; ++i)
-   {
-      mEpochBuffer[i]   = mEpochBuffer[i+1];
-      lhsValueBuffer[i] = lhsValueBuffer[i+1];
-      rhsValueBuffer[i] = rhsValueBuffer[i+1];
-   }
+   // Replace the oldest value in the ring buffer with the newest one
+   Integer newest = mBufferHead;
+   mBufferHead = (mBufferHead + 1) % mBufferSize;
    
    // Fill in the next data point
-   mEpochBuffer[mBufferSize-1]   = epoch;
-   rhsValueBuffer[mBufferSize-1] = currentGoalValue;
-   lhsValueBuffer[mBufferSize-1] = currentParmValue;
+   mEpochBuffer[newest]   = epoch;
+   rhsValueBuffer[newest] = currentGoalValue;
+   lhsValueBuffer[newest] = currentParmValue;
    ++mNumValidPoints;
    
    // Only start looking for a solution when the ring buffer is full   
    if (mNumValidPoints >= mBufferSize)
    {
-      Real minVal = lhsValueBuffer[0], maxVal = lhsValueBuffer[mBufferSize - 1];
+      Real minVal = lhsValueBuffer[0], maxVal = lhsValueBuffer[0];
       for (int i = 0; i < mBufferSize; ++i)
       {
          if (minVal > lhsValueBuffer[i])
@@ -834,15 +858,17 @@ bool StopCondition::AddToBuffer(bool isInitialPoint)
       if ((currentGoalValue >= minVal) && (currentGoalValue <= maxVal))
       {
          // Prep the interpolator
+         // Prep the interpolator, oldest point first
          mInterpolator->Clear();
          for (int i=0; i<mBufferSize; i++)
          {
+            int j = (mBufferHead + i) % mBufferSize;
             #ifdef DEBUG_STOPCOND_EVAL
             MessageInterface::ShowMessage
                ("StopCondition::Evaluate() i=%d, lhsValueBuffer=%f, "
-                "mEpochBuffer=%f\n", i, lhsValueBuffer[i], mEpochBuffer[i]);
+                "mEpochBuffer=%f\n", i, lhsValueBuffer[j], mEpochBuffer[j]);
             #endif
-            mInterpolator->AddPoint(lhsValueBuffer[i], &mEpochBuffer[i]);
+            mInterpolator->AddPoint(lhsValueBuffer[j], &mEpochBuffer[j]);
          }
          
          // Finally, if we can interpolate an epoch, we have success!
@@ -864,8 +890,9 @@ bool StopCondition::AddToBuffer(bool isInitialPoint)
          mNumValidPoints);
       for (int i=0; i<mBufferSize; i++)
       {
+         int j = (mBufferHead + i) % mBufferSize;
          MessageInterface::ShowMessage
-            ("   [%d]   %.12lf  %.12lf\n", i, mEpochBuffer[i], lhsValueBuffer[i]);
+            ("   [%d]   %.12lf  %.12lf\n", i, mEpochBuffer[j], lhsValueBuffer[j]);
       }
    #endif
 
@@ -909,13 +936,14 @@ Real StopCondition::GetStopEpoch()
    mInterpolator->Clear();
    for (int i=0; i<mBufferSize; i++)
    {
+      int j = (mBufferHead + i) % mBufferSize;
       #ifdef DEBUG_STOPCOND_EPOCH
          MessageInterface::ShowMessage
             ("      i=%d, lhsValueBuffer=%.12lf, "
-             "mEpochBuffer=%.12lf\n", i, lhsValueBuffer[i], mEpochBuffer[i]);
+             "mEpochBuffer=%.12lf\n", i, lhsValueBuffer[j], mEpochBuffer[j]);
       #endif
       
-      mInterpolator->AddPoint(lhsValueBuffer[i], &mEpochBuffer[i]);
+      mInterpolator->AddPoint(lhsValueBuffer[j], &mEpochBuffer[j]);
    }
    
    if (mInterpolator->Interpolate(currentGoalValue, &stopEpoch))
@@ -1168,19 +1196,14 @@ bool StopCondition::Initialize()
       
       if (mNeedInterpolator)
       {
+         // The buffers keep this size, so AddToBuffer() does not allocate
          mBufferSize = mInterpolator->GetBufferSize();
-         mEpochBuffer.reserve(mBufferSize);
-         lhsValueBuffer.reserve(mBufferSize);
-         rhsValueBuffer.reserve(mBufferSize);
-         
-         for (int i=0; i<mBufferSize; i++)
-         {
-            mEpochBuffer.push_back(0.0);
-            lhsValueBuffer.push_back(0.0);
-            rhsValueBuffer.push_back(0.0);
-         }
+         mEpochBuffer.assign(mBufferSize, 0.0);
+         lhsValueBuffer.assign(mBufferSize, 0.0);
+         rhsValueBuffer.assign(mBufferSize, 0.0);
          
          mNumValidPoints = 0;
+         mBufferHead = 0;
          mInitialized = true;
       }
       else
@@ -2750,6 +2773,7 @@ void StopCondition::CopyDynamicData(const StopCondition &stopCond)
 {
    mNumValidPoints = stopCond.mNumValidPoints;
    mBufferSize = stopCond.mBufferSize;
+   mBufferHead = stopCond.mBufferHead;
 
    if ((Integer)mEpochBuffer.size() < mBufferSize)
       mEpochBuffer.resize(mBufferSize);
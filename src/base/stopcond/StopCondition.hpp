@@ -63,6 +63,7 @@ public:
    bool Initialize();
    virtual bool Validate();
    virtual bool Evaluate();
+   virtual bool Evaluate(Real stopValue);
    virtual bool IsTimeCondition();
    virtual bool AddToBuffer(bool isInitialPoint);
    virtual Real GetStopEpoch();
@@ -179,7 +180,7 @@ protected:
    ElementWrapper *lhsWrapper;
    ElementWrapper *rhsWrapper;
    
-   /// ring buffer for epochs
+   /// ring buffer for epochs; sized in Initialize() and not resized after
    RealArray mEpochBuffer;
    /// ring buffer for associated LHS values
    RealArray lhsValueBuffer;
@@ -188,6 +189,8 @@ protected:
    
    Integer mNumValidPoints;
    Integer mBufferSize;
+   /// Index of the oldest point in the ring buffers
+   Integer mBufferHead;
    Real mStopEpoch;
    Real mStopInterval;
    
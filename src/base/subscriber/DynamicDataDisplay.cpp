@@ -39,7 +39,8 @@ DynamicDataDisplay::PARAMETER_TEXT[DynamicDataDisplayParamCount - SubscriberPara
    "WarnBounds",
    "CritBounds",
    "WarnColor",
-   "CritColor"
+   "CritColor",
+   "UpdateRate"
 };
 
 const Gmat::ParameterType
@@ -52,7 +53,8 @@ DynamicDataDisplay::PARAMETER_TYPE[DynamicDataDisplayParamCount - SubscriberPara
    Gmat::STRINGARRAY_TYPE, //"WarnBounds"
    Gmat::STRINGARRAY_TYPE, //"CritBounds"
    Gmat::COLOR_TYPE,       //"WarnColor"
-   Gmat::COLOR_TYPE        //"CritColor"
+   Gmat::COLOR_TYPE,       //"CritColor"
+   Gmat::REAL_TYPE         //"UpdateRate"
 };
 
 //------------------------------------------------------------------------------
@@ -80,6 +82,9 @@ DynamicDataDisplay::DynamicDataDisplay(const std::string &name) :
    critTextColor = RgbColor::ToIntColor("[255 0 0]");
    paramToUpdate = "";
    errorAlreadyShown = false;
+   updateRate = 0.1;
+   pushPending = false;
+   pushedOnce = false;
 }
 
 //------------------------------------------------------------------------------
@@ -104,6 +109,9 @@ DynamicDataDisplay::DynamicDataDisplay(const DynamicDataDisplay &orig) :
    critTextColor = orig.critTextColor;
    paramToUpdate = orig.paramToUpdate;
    errorAlreadyShown = orig.errorAlreadyShown;
+   updateRate = orig.updateRate;
+   pushPending = false;
+   pushedOnce = false;
 }
 
 //------------------------------------------------------------------------------
@@ -132,6 +140,11 @@ DynamicDataDisplay& DynamicDataDisplay::operator=(const DynamicDataDisplay& orig
    critTextColor = orig.critTextColor;
    paramToUpdate = orig.paramToUpdate;
    errorAlreadyShown = orig.errorAlreadyShown;
+   updateRate = orig.updateRate;
+   realValues.clear();
+   realValueChanged.clear();
+   pushPending = false;
+   pushedOnce = false;
 
    return *this;
 }
@@ -155,6 +168,10 @@ DynamicDataDisplay::~DynamicDataDisplay()
 * Method called by the UpdateDynamicData command to get the current values of
 * the parameters being watched and sending them to be displayed on the table
 *
+* Real values are buffered numerically and only formatted when the display is
+* updated, which happens at most once per UpdateRate seconds of wall clock
+* time.  Updates arriving in between are coalesced into the next one.
+*
 * @return Returns true of the data was successfully sent to the display
 */
 //------------------------------------------------------------------------------
@@ -164,6 +181,12 @@ bool DynamicDataDisplay::UpdateData(StringArray valuesToUpdate)
    if (valuesToUpdate.size() > 0)
       checkParamNames = true;
 
+   if (realValues.size() != yParamWrappers.size())
+   {
+      realValues.assign(yParamWrappers.size(), 0.0);
+      realValueChanged.assign(yParamWrappers.size(), false);
+   }
+
    std::string desc;
    Integer wrapperIdx = 0;
    for (Integer i = 0; i < displayData.size(); ++i)
@@ -196,36 +219,15 @@ bool DynamicDataDisplay::UpdateData(StringArray valuesToUpdate)
             ++wrapperIdx;
             continue;
          }
-         desc = yParamWrappers[wrapperIdx]->GetDescription();
          Gmat::ParameterType dataType =
             yParamWrappers[wrapperIdx]->GetDataType();
          switch (dataType)
          {
          case Gmat::REAL_TYPE:
          {
-            displayData[i][j].paramValue =
-               GmatStringUtil::ToString(yParamWrappers[wrapperIdx]->EvaluateReal());
-
-            if (!displayData[i][j].isTextColorUserSet)
-            {
-               if (yParamWrappers[wrapperIdx]->EvaluateReal() <
-                  displayData[i][j].critLowerBound ||
-                  yParamWrappers[wrapperIdx]->EvaluateReal() >
-                  displayData[i][j].critUpperBound)
-               {
-                  displayData[i][j].paramTextColor = critTextColor;
-               }
-               else if (yParamWrappers[wrapperIdx]->EvaluateReal() <
-                  displayData[i][j].warnLowerBound ||
-                  yParamWrappers[wrapperIdx]->EvaluateReal() >
-                  displayData[i][j].warnUpperBound)
-               {
-                  displayData[i][j].paramTextColor = warnTextColor;
-               }
-               else
-                  displayData[i][j].paramTextColor =
-                     RgbColor::ToIntColor("[0 0 0]");
-            }
+            realValues[wrapperIdx] =
+               yParamWrappers[wrapperIdx]->EvaluateReal();
+            realValueChanged[wrapperIdx] = true;
             break;
          }
          case Gmat::STRING_TYPE:
@@ -235,18 +237,30 @@ bool DynamicDataDisplay::UpdateData(StringArray valuesToUpdate)
             break;
          }
          default:
+            desc = yParamWrappers[wrapperIdx]->GetDescription();
             throw SubscriberException("DynamicDataDisplay cannot display \"" +
                desc + "\", only real or string parameter types can be used.");
          }
          ++wrapperIdx;
-
-         
       }
    }
 
-   PlotInterface::UpdateDynamicDataDisplay(instanceName, displayData);
+   pushPending = true;
+   return PushData(false);
+}
 
-   return true;
+//------------------------------------------------------------------------------
+// bool FlushUpdates()
+//------------------------------------------------------------------------------
+/**
+* Sends any data held back by the update rate to the display
+*
+* @return Returns true if the data was successfully sent to the display
+*/
+//------------------------------------------------------------------------------
+bool DynamicDataDisplay::FlushUpdates()
+{
+   return PushData(true);
 }
 
 //------------------------------------------------------------------------------
@@ -259,6 +273,7 @@ bool DynamicDataDisplay::UpdateData(StringArray valuesToUpdate)
 //------------------------------------------------------------------------------
 std::vector<std::vector<DDD>> DynamicDataDisplay::GetDynamicDataStruct()
 {
+   FormatPendingValues();
    return displayData;
 }
 
@@ -284,6 +299,8 @@ void DynamicDataDisplay::SetParamSettings(std::vector<std::vector<DDD>> newSetti
    }
 
    ClearWrappers();
+   realValues.clear();
+   realValueChanged.clear();
 
    for (Integer i = 0; i < displayData.size(); ++i)
    {
@@ -329,6 +346,9 @@ bool DynamicDataDisplay::Initialize()
 
    PlotInterface::SetDynamicDataTableSize(instanceName, maxRowCount,
       maxColCount);
+   realValues.clear();
+   realValueChanged.clear();
+   pushedOnce = false;
    StringArray unusedArray;
    UpdateData(unusedArray);
    //PlotInterface::SetDynamicDataTextColor(instanceName, displayData);
@@ -368,6 +388,19 @@ void DynamicDataDisplay::Copy(const GmatBase* orig)
    operator=(*((DynamicDataDisplay *)(orig)));
 }
 
+//------------------------------------------------------------------------------
+// bool SetEndOfRun()
+//------------------------------------------------------------------------------
+/**
+* Sends the last buffered values to the display before the run ends
+*/
+//------------------------------------------------------------------------------
+bool DynamicDataDisplay::SetEndOfRun()
+{
+   FlushUpdates();
+   return Subscriber::SetEndOfRun();
+}
+
 //------------------------------------------------------------------------------
 // bool SetName(const std::string &who, const std;:string &oldName = "")
 //------------------------------------------------------------------------------
@@ -442,11 +475,12 @@ bool DynamicDataDisplay::RenameRefObject(const UnsignedInt type,
 //------------------------------------------------------------------------------
 Integer DynamicDataDisplay::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SubscriberParamCount; i < DynamicDataDisplayParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SubscriberParamCount,
+               DynamicDataDisplayParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return Subscriber::GetParameterID(str);
 }
@@ -522,6 +556,54 @@ bool DynamicDataDisplay::IsSquareBracketAllowedInSetting(const Integer id) const
       return Subscriber::IsSquareBracketAllowedInSetting(id);
 }
 
+//------------------------------------------------------------------------------
+// Real GetRealParameter(const Integer id) const
+//------------------------------------------------------------------------------
+Real DynamicDataDisplay::GetRealParameter(const Integer id) const
+{
+   if (id == UPDATE_RATE)
+      return updateRate;
+   return Subscriber::GetRealParameter(id);
+}
+
+//------------------------------------------------------------------------------
+// Real SetRealParameter(const Integer id, const Real value)
+//------------------------------------------------------------------------------
+Real DynamicDataDisplay::SetRealParameter(const Integer id, const Real value)
+{
+   if (id == UPDATE_RATE)
+   {
+      if (value < 0.0)
+      {
+         SubscriberException se;
+         se.SetDetails(errorMessageFormat.c_str(),
+                       GmatStringUtil::ToString(value, 16).c_str(),
+                       GetParameterText(id).c_str(), "Real Number >= 0.0");
+         throw se;
+      }
+      updateRate = value;
+      return updateRate;
+   }
+   return Subscriber::SetRealParameter(id, value);
+}
+
+//------------------------------------------------------------------------------
+// Real GetRealParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+Real DynamicDataDisplay::GetRealParameter(const std::string &label) const
+{
+   return GetRealParameter(GetParameterID(label));
+}
+
+//------------------------------------------------------------------------------
+// Real SetRealParameter(const std::string &label, const Real value)
+//------------------------------------------------------------------------------
+Real DynamicDataDisplay::SetRealParameter(const std::string &label,
+                                          const Real value)
+{
+   return SetRealParameter(GetParameterID(label), value);
+}
+
 //------------------------------------------------------------------------------
 // std::string GetStringParameter(const Integer id)
 //------------------------------------------------------------------------------
@@ -991,6 +1073,88 @@ void DynamicDataDisplay::WriteStringArrayValue(Gmat::WriteMode mode,
    }
 }
 
+//------------------------------------------------------------------------------
+// void FormatPendingValues()
+//------------------------------------------------------------------------------
+/**
+* Converts buffered real values to display strings and sets the bound colors
+* for the cells whose values changed since they were last formatted
+*/
+//------------------------------------------------------------------------------
+void DynamicDataDisplay::FormatPendingValues()
+{
+   if (realValueChanged.empty())
+      return;
+
+   UnsignedInt defaultTextColor = RgbColor::ToIntColor("[0 0 0]");
+   Integer wrapperIdx = 0;
+   for (Integer i = 0; i < displayData.size(); ++i)
+   {
+      for (Integer j = 0; j < displayData[i].size(); ++j)
+      {
+         if (displayData[i][j].paramName == "")
+            continue;
+
+         if (wrapperIdx < realValueChanged.size() &&
+             realValueChanged[wrapperIdx])
+         {
+            Real value = realValues[wrapperIdx];
+            displayData[i][j].paramValue = GmatStringUtil::ToString(value);
+
+            if (!displayData[i][j].isTextColorUserSet)
+            {
+               if (value < displayData[i][j].critLowerBound ||
+                   value > displayData[i][j].critUpperBound)
+                  displayData[i][j].paramTextColor = critTextColor;
+               else if (value < displayData[i][j].warnLowerBound ||
+                        value > displayData[i][j].warnUpperBound)
+                  displayData[i][j].paramTextColor = warnTextColor;
+               else
+                  displayData[i][j].paramTextColor = defaultTextColor;
+            }
+            realValueChanged[wrapperIdx] = false;
+         }
+         ++wrapperIdx;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// bool PushData(bool force)
+//------------------------------------------------------------------------------
+/**
+* Sends the buffered data to the display if it changed and the update rate
+* allows it
+*
+* @param force Set to true to ignore the update rate
+*
+* @return Returns true
+*/
+//------------------------------------------------------------------------------
+bool DynamicDataDisplay::PushData(bool force)
+{
+   if (!pushPending)
+      return true;
+
+   std::chrono::steady_clock::time_point now =
+      std::chrono::steady_clock::now();
+   if (!force && pushedOnce && updateRate > 0.0)
+   {
+      std::chrono::duration<Real> elapsed = now - lastPushTime;
+      if (elapsed.count() < updateRate)
+         return true;
+   }
+
+   FormatPendingValues();
+   PlotInterface::UpdateDynamicDataDisplay(instanceName, displayData);
+
+   lastPushTime = now;
+   pushedOnce = true;
+   pushPending = false;
+
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // bool AddParameter(const std::string &paramName, Integer index)
 //------------------------------------------------------------------------------
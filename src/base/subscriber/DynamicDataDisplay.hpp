@@ -39,6 +39,7 @@
 #include "ColorDatabase.hpp"
 #include "DynamicDataStruct.hpp"
 #include "TextParser.hpp"
+#include <chrono>
 
 class GMAT_API DynamicDataDisplay : public Subscriber
 {
@@ -50,6 +51,7 @@ public:
 
    // Methods for this class
    bool UpdateData(StringArray paramsToUpdate);
+   bool FlushUpdates();
    std::vector<std::vector<DDD>> GetDynamicDataStruct();
    void SetParamSettings(std::vector<std::vector<DDD>> newSettings);
 
@@ -57,6 +59,7 @@ public:
    virtual bool         Initialize();
    virtual GmatBase*    Clone() const;
    virtual void         Copy(const GmatBase* orig);
+   virtual bool         SetEndOfRun();
 
    virtual bool         SetName(const std::string &who,
                                 const std::string &inputOldName);
@@ -73,6 +76,13 @@ public:
    virtual bool         IsParameterCommandModeSettable(const Integer id) const;
    virtual bool         IsSquareBracketAllowedInSetting(const Integer id) const;
 
+   virtual Real         GetRealParameter(const Integer id) const;
+   virtual Real         SetRealParameter(const Integer id,
+                                         const Real value);
+   virtual Real         GetRealParameter(const std::string &label) const;
+   virtual Real         SetRealParameter(const std::string &label,
+                                         const Real value);
+
    virtual std::string  GetStringParameter(const Integer id) const;
    virtual bool         SetStringParameter(const Integer id,
                                            const std::string &value);
@@ -119,6 +129,8 @@ private:
    bool SetParameterWarnBounds(const std::string &scriptString, Integer index);
    bool SetParameterCritBounds(const std::string &scriptString, Integer index);
    //bool RemoveParameter(const std::string &paramName);
+   void FormatPendingValues();
+   bool PushData(bool force);
 
    /// Matrix of structs holding the parameter data for the display
    std::vector<std::vector<DDD>> displayData;
@@ -148,6 +160,18 @@ private:
    Real inf;
    /// Flag indicating that an error message has already posted
    bool errorAlreadyShown;
+   /// Minimum wall clock time, in seconds, between updates sent to the display
+   Real updateRate;
+   /// Latest numeric values, by wrapper index, not yet formatted for display
+   RealArray realValues;
+   /// Flags marking which entries in realValues need formatting
+   std::vector<bool> realValueChanged;
+   /// Flag indicating that data has changed since the last display update
+   bool pushPending;
+   /// Flag indicating that lastPushTime holds a valid time
+   bool pushedOnce;
+   /// Wall clock time of the last update sent to the display
+   std::chrono::steady_clock::time_point lastPushTime;
 
 public:
    enum
@@ -160,6 +184,7 @@ public:
       CRIT_BOUNDS,
       WARN_COLOR,
       CRIT_COLOR,
+      UPDATE_RATE,
       DynamicDataDisplayParamCount
    };
 
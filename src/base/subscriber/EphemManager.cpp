@@ -90,7 +90,8 @@ EphemManager::EphemManager(bool deleteFiles) :
    intStart               (0.0),
    intStop                (0.0),
    coverStart             (0.0),
-   coverStop              (0.0)
+   coverStop              (0.0),
+   writeKernel            (false)
 {
 #ifdef __USE_SPICE__
    spice = NULL;
@@ -187,7 +188,9 @@ EphemManager::EphemManager(const EphemManager& copy) :
    intStart               (copy.intStart),
    intStop                (copy.intStop),
    coverStart             (copy.coverStart),
-   coverStop              (copy.coverStop)
+   coverStop              (copy.coverStop),
+   trajectory             (copy.trajectory),
+   writeKernel            (copy.writeKernel)
 {
    #ifdef __USE_SPICE__
       spice = NULL;
@@ -222,6 +225,8 @@ EphemManager& EphemManager::operator=(const EphemManager& copy)
    intStop                  = copy.intStop;
    coverStart               = copy.coverStart;
    coverStop                = copy.coverStop;
+   trajectory               = copy.trajectory;
+   writeKernel              = copy.writeKernel;
 
    #ifdef __USE_SPICE__
       if (spice) delete spice;
@@ -337,6 +342,7 @@ bool EphemManager::RecordEphemerisData()
          ephemFile->SetInternalCoordSystem(coordSys);
          ephemFile->SetRefObject(theObj,   Gmat::SPACECRAFT,        theObjName);
          ephemFile->SetRefObject(coordSys, Gmat::COORDINATE_SYSTEM, coordSysName);
+         ephemFile->SetTrajectoryStore(&trajectory, !writeKernel);
 
          ephemFile->Initialize();
          ephemFile->TakeAction("ToggleOn");
@@ -461,7 +467,7 @@ void EphemManager::StopRecording(bool done)
 
    }
    // Load the current SPK file, if it has been written
-   if (GmatFileUtil::DoesFileExist(fileName))
+   if (writeKernel && GmatFileUtil::DoesFileExist(fileName))
    {
       #ifdef __USE_SPICE__
          #ifdef DEBUG_EPHEM_MANAGER
@@ -548,6 +554,10 @@ bool EphemManager::GetOccultationIntervals(const std::string &occType,
                                            RealArray         &starts,
                                            RealArray         &ends)
 {
+   #ifdef __USE_SPICE__
+      SpiceInterface::AccessLock spiceLock;
+   #endif
+
    Spacecraft  *theSc       = (Spacecraft*) theObj;
 
    #ifndef __USE_SPICE__
@@ -729,6 +739,10 @@ bool EphemManager::GetContactIntervals(const std::string &observerID,
                                        const std::string           idForInstrument,
                                        RealArray       &maxEl)
 {
+   #ifdef __USE_SPICE__
+      SpiceInterface::AccessLock spiceLock;
+   #endif
+
    Spacecraft  *theSc       = (Spacecraft*) theObj;
 
 #ifndef __USE_SPICE__
@@ -1088,6 +1102,10 @@ bool EphemManager::GetIntrusionIntervals(const std::string &instName,
                                          RealArray         &starts,
                                          RealArray         &ends)
 {
+   #ifdef __USE_SPICE__
+      SpiceInterface::AccessLock spiceLock;
+   #endif
+
    if (targetShape != "ELLIPSOID" && targetShape != "POINT")
    {
       std::string errmsg = "Error calling GetFOVIntervals! The provided "
@@ -1316,6 +1334,10 @@ bool EphemManager::GetCoverage(Real s, Real e,
                                Real &cvrStart,
                                Real &cvrStop)
 {
+   #ifdef __USE_SPICE__
+      SpiceInterface::AccessLock spiceLock;
+   #endif
+
    #ifndef __USE_SPICE__
       Spacecraft *theSc = (Spacecraft*) theObj;
       std::string errmsg = "ERROR - cannot compute occultation intervals for spacecraft ";
@@ -1372,6 +1394,10 @@ bool EphemManager::GetTargetPosition(Real epoch,
                                      Rvector3 &targPos,
                                      Real &lightTime)
 {
+   #ifdef __USE_SPICE__
+      SpiceInterface::AccessLock spiceLock;
+   #endif
+
    // Gather neccessary ID's from GMAT
    Spacecraft  *theSc = (Spacecraft*)theObj;
    Integer     scNAIFId = theSc->GetIntegerParameter("NAIFId");
@@ -1442,6 +1468,10 @@ bool EphemManager::GetTargetPosition(SpiceInt targetNaif,
                                   SpiceInt observerNaif,
                                   SpiceDouble *pos)
 {
+   #ifdef __USE_SPICE__
+      SpiceInterface::AccessLock spiceLock;
+   #endif
+
    if (!spice)
       spice = new SpiceInterface();
    SpiceDouble et = spice->A1ToSpiceTime(epoch);
@@ -1489,6 +1519,10 @@ Real EphemManager::GetPhaseAngle(Real epoch,
                                  const std::string &illmnName,
                                  const std::string &abCorrection)
 {
+   #ifdef __USE_SPICE__
+      SpiceInterface::AccessLock spiceLock;
+   #endif
+
    // Gather neccessary ID's from GMAT
    Spacecraft  *theSc = (Spacecraft*)theObj;
    Integer     scNAIFId = theSc->GetIntegerParameter("NAIFId");
@@ -1548,6 +1582,10 @@ void EphemManager::GetRequiredCoverageWindow(SpiceCell* w, Real s1, Real e1,
                                              Real stepSize,
                                              Integer obsID)
 {
+   #ifdef __USE_SPICE__
+      SpiceInterface::AccessLock spiceLock;
+   #endif
+
    #ifdef DEBUG_EM_COVERAGE
       MessageInterface::ShowMessage("In GetRequiredCoverageWindow:\n");
       MessageInterface::ShowMessage("   s1 = %12.10f\n", s1);
@@ -2035,6 +2073,72 @@ void EphemManager::SetEphemType(ManagedEphemType eType)
    theType = eType;
 }
 
+//------------------------------------------------------------------------------
+// const TrajectoryStore* GetTrajectoryStore() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the in-memory copy of the recorded states, held in the coordinate
+ * system of the EphemManager at the epochs written to the SPK files, or that
+ * would be written when no kernel is required.
+ *
+ * @return The store
+ */
+//------------------------------------------------------------------------------
+const TrajectoryStore* EphemManager::GetTrajectoryStore() const
+{
+   return &trajectory;
+}
+
+//------------------------------------------------------------------------------
+// void RequireKernel()
+//------------------------------------------------------------------------------
+/**
+ * Has the recorded states written to SPK kernels as well as kept in memory,
+ * for the searches made through SPICE.  The kernels are not written unless
+ * this is called; once called, they are written for the rest of the run.
+ * The call must precede the data it applies to, so it is made as the event
+ * locators are initialized.
+ */
+//------------------------------------------------------------------------------
+void EphemManager::RequireKernel()
+{
+   if (writeKernel)
+      return;
+
+   writeKernel = true;
+   if (ephemFile)
+      ephemFile->SetTrajectoryStore(&trajectory, false);
+}
+
+//------------------------------------------------------------------------------
+// bool IsWritingKernel() const
+//------------------------------------------------------------------------------
+/**
+ * Tells whether the recorded states are written to SPK kernels.
+ *
+ * @return true if kernels are written and loaded, false if the states are
+ *         only kept in memory
+ */
+//------------------------------------------------------------------------------
+bool EphemManager::IsWritingKernel() const
+{
+   return writeKernel;
+}
+
+//------------------------------------------------------------------------------
+// CoordinateSystem* GetCoordinateSystem() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the coordinate system of the recorded states.
+ *
+ * @return The coordinate system
+ */
+//------------------------------------------------------------------------------
+CoordinateSystem* EphemManager::GetCoordinateSystem() const
+{
+   return coordSys;
+}
+
 //------------------------------------------------------------------------------
 // SetCoordinateSystem()
 //------------------------------------------------------------------------------
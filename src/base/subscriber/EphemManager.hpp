@@ -26,7 +26,9 @@
  * responsible for creating, loading, and managing private/hidden EphemerisFile
  * objects associated with its specified Spacecraft or Asset object.
  * NOTE: currently, the EphemManager will only handle SPK Orbit files, and
- * FK text files for the GroundStation.
+ * FK text files for the GroundStation.  The recorded orbit is kept in memory,
+ * and only written to (and loaded from) an SPK file when RequireKernel() has
+ * been called.
  */
 //------------------------------------------------------------------------------
 
@@ -37,6 +39,7 @@
 #include "GmatBase.hpp"
 #include "CoordinateSystem.hpp"
 #include "SolarSystem.hpp"
+#include "TrajectoryStore.hpp"
 
 #ifdef __USE_SPICE__
    #include "SpiceInterface.hpp"
@@ -155,6 +158,14 @@ public:
                                       const std::string &illmnName,
                                       const std::string &abCorrection);
 
+   /// In-memory copy of the recorded states
+   const TrajectoryStore*
+                        GetTrajectoryStore() const;
+   /// Also write the recorded states to SPK kernels, for the SPICE searches
+   void                 RequireKernel();
+   bool                 IsWritingKernel() const;
+   CoordinateSystem*    GetCoordinateSystem() const;
+
    /// Set reference objects
    virtual void         SetObject(GmatBase *obj);
    virtual void         SetEphemType(ManagedEphemType eType);
@@ -202,6 +213,10 @@ protected:
    Real                 coverStart;
    /// stop time of the actual coverage window (coverage of loaded SPKs)
    Real                 coverStop;
+   /// The recorded states, kept in memory for the native event search
+   TrajectoryStore      trajectory;
+   /// Are the states also written to SPK kernels and loaded into SPICE?
+   bool                 writeKernel;
    #ifdef __USE_SPICE__
       /// need a SpiceInterface to load and unload kernels
       SpiceInterface       *spice;
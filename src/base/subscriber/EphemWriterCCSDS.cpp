@@ -335,21 +335,10 @@ void EphemWriterCCSDS::BufferOrbitData(Real epochInDays, const Real state[6],
    a1MjdArray.push_back(a1mjd);
    Rvector6 *rv6 = new Rvector6(state);
    stateArray.push_back(rv6);
-
-   Rvector *covar = new Rvector(21);
-   for (Integer i = 0; i < 21; ++i)
-      (*covar)[i] = cov[i];
-   covArray.push_back(covar);
-   Rvector3 *acc = new Rvector3(accel[0], accel[1], accel[2]);
-   accelArray.push_back(acc);
-   Rvector *rvacov = new Rvector(30);
-   for (Integer i = 0; i < 6; ++i)
-      (*rvacov)[i] = state[i];
-   for (Integer i = 0; i < 3; ++i)
-      (*rvacov)[i+6] = accel[i];
-   for (Integer i = 0; i < 21; ++i)
-      (*rvacov)[i+9] = cov[i];
-   rvacovArray.push_back(rvacov);
+   
+   oemData.insert(oemData.end(), state, state + 6);
+   oemData.insert(oemData.end(), accel, accel + 3);
+   oemData.insert(oemData.end(), cov, cov + 21);
 
    #ifdef DEBUG_EPHEMFILE_BUFFER
    MessageInterface::ShowMessage
@@ -1154,6 +1143,7 @@ void EphemWriterCCSDS::WriteCcsdsOrbitDataSegment()
    
    // Clear orbit buffer
    ClearOrbitData();
+   oemData.clear();
    
    #ifdef DEBUG_CCSDS_DATA_SEGMENT
    MessageInterface::ShowMessage
@@ -1383,21 +1373,21 @@ void EphemWriterCCSDS::WriteCcsdsOemData()
        this, ephemName.c_str(), a1MjdArray.size());
    #endif
    
-   bool dataAdded = false;
+   RealArray epochs(a1MjdArray.size());
    for (UnsignedInt i = 0; i < a1MjdArray.size(); i++)
    {
-      Real epoch = a1MjdArray[i]->GetReal();
+      epochs[i] = a1MjdArray[i]->GetReal();
       
       #ifdef DEBUG_TO_TEXT_EPHEM
       const Real *outState = stateArray[i]->GetDataVector();
-      std::string epochStr = ToUtcGregorian(epoch, true, 2);
+      std::string epochStr = ToUtcGregorian(epochs[i], true, 2);
       char strBuff[200];
       sprintf(strBuff, "%s  state = [% 1.15e  % 1.15e  % 1.15e  % 1.15e  % 1.15e  % 1.15e]\n",
               epochStr.c_str(), outState[0], outState[1], outState[2], outState[3],
               outState[4], outState[5]);
       dstream << strBuff; 
 
-      outState = accelArray[i]->GetDataVector();
+      outState = &oemData[i * 30 + 6];
       sprintf(strBuff, "%s  accel = [% 1.15e  % 1.15e  % 1.15e]\n",
          epochStr.c_str(), outState[0], outState[1], outState[2]);
       dstream << strBuff;
@@ -1406,25 +1396,17 @@ void EphemWriterCCSDS::WriteCcsdsOemData()
       #endif
    
       #ifdef DEBUG_EPHEMFILE_WRITE
-      MessageInterface::ShowMessage("rvacov array size = %d\n", (*rvacovArray[i]).GetSize());
-      for (Integer k = 0; k < (*rvacovArray[i]).GetSize(); ++k)
-         MessageInterface::ShowMessage("  (*rvacovArray[i])[%d] = %.15le\n", k, (*rvacovArray[i])[k]);
+      for (Integer k = 0; k < 30; ++k)
+         MessageInterface::ShowMessage("  oemData[%d][%d] = %.15le\n", i, k, oemData[i * 30 + k]);
       #endif
-
-      // Add data points to ccsds writer and then write
-      // This code changes is used to add acceleration and covarian matrix to funtion AddDataForWriting()
-      //if (ccsdsOemWriter && ccsdsOemWriter->AddDataForWriting(epoch, *stateArray[i]))
-      if (ccsdsOemWriter && ccsdsOemWriter->AddDataForWriting(epoch, *rvacovArray[i]))
-      {
-         dataAdded = true;
-      }
-      else
-      {
-         dataAdded = false;
-         break;
-      }
    }
    
+   // Add the state, acceleration and covariance of all points at once
+   bool dataAdded = (ccsdsOemWriter != NULL);
+   if (dataAdded && !epochs.empty())
+      dataAdded = ccsdsOemWriter->AddDataForWriting(&epochs[0], &oemData[0],
+                                                    epochs.size(), 30);
+   
    if (!dataAdded)
    {
       SubscriberException se;
@@ -82,6 +82,10 @@ protected:
    bool        firstTimeMetaData;
    bool        saveMetaDataStart;
    
+   /// State, acceleration and covariance of the buffered points, one point
+   /// after the other, as the OEM writer takes them
+   RealArray   oemData;
+   
    // Abstract methods required by all subclasses
    // virtual void BufferOrbitData(Real epochInDays, const Real state[6], const Real cov[21]);
    virtual void BufferOrbitData(Real epochInDays, const Real state[6], const Real cov[21], const Real accel[3]);
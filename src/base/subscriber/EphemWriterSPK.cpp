@@ -32,6 +32,7 @@
 #include "SubscriberException.hpp"   // for exception
 #include "RealUtilities.hpp"         // for IsEven()
 #include "MessageInterface.hpp"
+#include "TrajectoryStore.hpp"
 #include <sstream>                   // for <<, std::endl
 
 #ifdef __USE_SPICE__
@@ -226,6 +227,27 @@ void EphemWriterSPK::Copy(const EphemerisWriter* orig)
 }
 
 
+//------------------------------------------------------------------------------
+// void SetTrajectoryStore(TrajectoryStore *store, bool onlyToStore = false)
+//------------------------------------------------------------------------------
+/**
+ * Sets the store that receives the orbit states.  When only the store is
+ * filled no kernel is created, so no file is written; turning the file back
+ * on before the data arrives creates the kernel writer.
+ *
+ * @param store       The store, not owned; NULL to stop the copies
+ * @param onlyToStore true to fill the store without writing the SPK file
+ */
+//------------------------------------------------------------------------------
+void EphemWriterSPK::SetTrajectoryStore(TrajectoryStore *store,
+                                        bool onlyToStore)
+{
+   EphemerisWriter::SetTrajectoryStore(store, onlyToStore);
+   if (!storeOnly && isEphemFileOpened && (spkWriter == NULL))
+      CreateSpiceKernelWriter();
+}
+
+
 //--------------------------------------
 // protected methods
 //--------------------------------------
@@ -321,6 +343,10 @@ void EphemWriterSPK::CreateSpiceKernelWriter()
       return;
    }
    
+   // The states only go to the in-memory store
+   if (storeOnly)
+      return;
+   
    //=======================================================
    #ifdef __USE_SPICE__
    //=======================================================
@@ -519,6 +545,8 @@ void EphemWriterSPK::HandleSpkOrbitData(bool writeData, bool timeToWrite)
          }
          
          BufferOrbitData(currEpochInDays, outState, outCov, outAccel);
+         if (trajectoryStore)
+            trajectoryStore->AddState(currEpochInDays, outState);
          
          #ifdef DEBUG_EPHEMFILE_SPICE
          DebugWriteOrbit("In HandleSpkOrbitData:", currEpochInDays, currState, true, true);
@@ -739,7 +767,7 @@ void EphemWriterSPK::FinishUpWritingSPK()
       else
       {
          #ifdef __USE_SPICE__
-         if (a1MjdArray.size() > 0)
+         if ((a1MjdArray.size() > 0) && !storeOnly)
          {
             throw SubscriberException
                ("*** INTERNAL ERROR *** SPK Writer is NULL in "
@@ -847,6 +875,13 @@ void EphemWriterSPK::WriteSpkOrbitDataSegment()
        "stateArray.size()=%d\n", a1MjdArray.size(), stateArray.size());
    #endif
    
+   // Without a kernel the buffer only orders the states sent to the store
+   if (storeOnly)
+   {
+      ClearOrbitData();
+      return;
+   }
+   
    #ifdef __USE_SPICE__
    if (a1MjdArray.size() > 0)
    {
@@ -48,6 +48,8 @@ public:
    virtual bool             Initialize();
    virtual EphemerisWriter* Clone(void) const;
    virtual void             Copy(const EphemerisWriter* orig);
+   virtual void             SetTrajectoryStore(TrajectoryStore *store,
+                                               bool onlyToStore = false);
    
 protected:
    
@@ -1010,15 +1010,19 @@ void EphemWriterWithInterpolator::ProcessEpochsOnWaiting(bool checkFinalEpoch,
 
 
 //------------------------------------------------------------------------------
-// RealArray::iterator FindEpochOnWaiting(Real epochInSecs, const std::string &msg = "")
+// EpochQueue::iterator FindEpochOnWaiting(Real epochInSecs, const std::string &msg = "")
 //------------------------------------------------------------------------------
 /**
  * Finds epoch from epochsOnWaiting list.
  * It uses timeTolerance tolerance to find matching epoch.
+ *
+ * Epochs are requested in time order, so a repeated request usually matches
+ * the newest epoch; the search starts there.
  */
 //------------------------------------------------------------------------------
-RealArray::iterator EphemWriterWithInterpolator::FindEpochOnWaiting(Real epochInSecs,
-                                                                      const std::string &msg)
+EphemWriterWithInterpolator::EpochQueue::iterator
+EphemWriterWithInterpolator::FindEpochOnWaiting(Real epochInSecs,
+                                                const std::string &msg)
 {
    #ifdef DEBUG_FIND_EPOCH
    MessageInterface::ShowMessage("FindEpochOnWaiting() entered\n");
@@ -1027,9 +1031,10 @@ RealArray::iterator EphemWriterWithInterpolator::FindEpochOnWaiting(Real epochIn
    #endif
    
    // Find matching epoch
-   RealArray::iterator iterFound = epochsOnWaiting.begin();
-   while (iterFound != epochsOnWaiting.end())
+   EpochQueue::iterator iterFound = epochsOnWaiting.end();
+   while (iterFound != epochsOnWaiting.begin())
    {
+      --iterFound;
       #ifdef DEBUG_FIND_EPOCH
       DebugWriteTime("      iterFound, epoch = ", *iterFound);
       #endif
@@ -1041,7 +1046,6 @@ RealArray::iterator EphemWriterWithInterpolator::FindEpochOnWaiting(Real epochIn
          #endif
          return iterFound;
       }
-      iterFound++;
    }
    
    return epochsOnWaiting.end();
@@ -1059,8 +1063,18 @@ RealArray::iterator EphemWriterWithInterpolator::FindEpochOnWaiting(Real epochIn
 void EphemWriterWithInterpolator::RemoveEpochAlreadyWritten(Real epochInSecs,
                                                             const std::string &msg)
 {
+   // Written epochs are normally at the front, which the queue drops cheaply
+   while (!epochsOnWaiting.empty() &&
+          (GmatMathUtil::Abs(epochsOnWaiting.front() - epochInSecs) < timeTolerance))
+   {
+      #ifdef DEBUG_EPHEMFILE_ORBIT
+      DebugWriteTime(msg + " epoch = ", epochsOnWaiting.front());
+      #endif
+      epochsOnWaiting.pop_front();
+   }
+   
    // Find matching epoch
-   RealArray::iterator iterFound = epochsOnWaiting.begin();
+   EpochQueue::iterator iterFound = epochsOnWaiting.begin();
    while (iterFound != epochsOnWaiting.end())
    {
       if (GmatMathUtil::Abs(*iterFound - epochInSecs) < timeTolerance)
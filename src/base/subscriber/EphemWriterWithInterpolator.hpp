@@ -30,6 +30,7 @@
 
 #include "EphemerisWriter.hpp"
 #include "Interpolator.hpp"
+#include <deque>
 
 
 class GMAT_API EphemWriterWithInterpolator : public EphemerisWriter
@@ -53,7 +54,11 @@ protected:
    Integer      initialCount;
    Integer      waitCount;
    Integer      afterFinalEpochCount;
-   RealArray    epochsOnWaiting;
+   
+   /// Queue of epochs to write, in the order they were requested
+   typedef std::deque<Real> EpochQueue;
+   /// Epochs waiting for enough data to interpolate, written from the front
+   EpochQueue   epochsOnWaiting;
 
    bool         isNextOutputEpochInLeapSecond;
    bool         handleFinalEpoch;
@@ -88,7 +93,7 @@ protected:
                                        bool checkEventEpoch);
    
    // Epoch handling
-   RealArray::iterator
+   EpochQueue::iterator
                 FindEpochOnWaiting(Real epochInSecs, const std::string &msg);
    void         RemoveEpochAlreadyWritten(Real epochInSecs, const std::string &msg);
    void         AddNextEpochToWrite(Real epochInSecs, const std::string &msg);
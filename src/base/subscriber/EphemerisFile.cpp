@@ -163,6 +163,8 @@ EphemerisFile::EphemerisFile(const std::string &name, const std::string &type) :
    spacecraft              (NULL),
    outCoordSystem          (NULL),
    ephemWriter             (NULL),
+   trajectoryStore         (NULL),
+   storeOnly               (false),
    fullPathFileName        (""),
    spacecraftName          (""),
    spacecraftId            (""),
@@ -338,6 +340,8 @@ EphemerisFile::EphemerisFile(const EphemerisFile &ef) :
    spacecraft              (ef.spacecraft),
    outCoordSystem          (ef.outCoordSystem),
    ephemWriter             (NULL),
+   trajectoryStore         (NULL),
+   storeOnly               (false),
    fullPathFileName        (ef.fullPathFileName),
    spacecraftName          (ef.spacecraftName),
    spacecraftId            (ef.spacecraftId),
@@ -416,6 +420,8 @@ EphemerisFile& EphemerisFile::operator=(const EphemerisFile& ef)
    spacecraft           = ef.spacecraft;
    outCoordSystem       = ef.outCoordSystem;
    ephemWriter          = NULL;
+   trajectoryStore      = NULL;
+   storeOnly            = false;
    fullPathFileName     = ef.fullPathFileName;
    spacecraftName       = ef.spacecraftName;
    spacecraftId         = ef.spacecraftId;
@@ -565,6 +571,27 @@ void EphemerisFile::SetBackgroundGeneration(bool inBackground)
 }
 
 
+//------------------------------------------------------------------------------
+// void SetTrajectoryStore(TrajectoryStore *store, bool onlyToStore = false)
+//------------------------------------------------------------------------------
+/**
+ * Sets the store that receives a copy of the orbit states written to an SPK
+ * file, for the event locators that search in memory.
+ *
+ * @param store       The store, not owned; NULL to stop the copies
+ * @param onlyToStore true to fill the store without writing the SPK file
+ */
+//------------------------------------------------------------------------------
+void EphemerisFile::SetTrajectoryStore(TrajectoryStore *store,
+                                       bool onlyToStore)
+{
+   trajectoryStore = store;
+   storeOnly = onlyToStore;
+   if (ephemWriter)
+      ephemWriter->SetTrajectoryStore(store, onlyToStore);
+}
+
+
 //----------------------------------
 // methods inherited from Subscriber
 //----------------------------------
@@ -2039,6 +2066,7 @@ void EphemerisFile::CreateEphemerisWriter()
                                useFixedStepSize, interpolatorName, interpolationOrder);
    ephemWriter->SetInitialTime(initialEpochA1Mjd, finalEpochA1Mjd);
    ephemWriter->SetIsEphemGlobal(IsGlobal());
+   ephemWriter->SetTrajectoryStore(trajectoryStore, storeOnly);
    ephemWriter->Initialize();
    CreateEphemerisFile();
    
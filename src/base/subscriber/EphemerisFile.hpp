@@ -51,6 +51,8 @@ public:
                                           bool saveFileName);
    
    virtual void         SetBackgroundGeneration(bool inBackground);
+   void                 SetTrajectoryStore(TrajectoryStore *store,
+                                           bool onlyToStore = false);
    
    // Need to be able to close background SPKs and leave ready for appending
    // Finalization
@@ -126,6 +128,10 @@ protected:
    Spacecraft        *spacecraft;
    CoordinateSystem  *outCoordSystem;
    EphemerisWriter   *ephemWriter;
+   /// Store handed to the writer for an in-memory copy of the orbit states
+   TrajectoryStore   *trajectoryStore;
+   /// Fill only the store, without writing the file
+   bool              storeOnly;
    
    /// ephemeris full file name including the path
    std::string fullPathFileName;
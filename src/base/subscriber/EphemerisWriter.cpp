@@ -88,6 +88,8 @@ EphemerisWriter::EphemerisWriter(const std::string &name, const std::string &typ
    spacecraft           (NULL),
    dataCoordSystem      (NULL),
    outCoordSystem       (NULL),
+   trajectoryStore      (NULL),
+   storeOnly            (false),
    fullPathFileName     (""),
    spacecraftName       (""),
    spacecraftId         (""),
@@ -199,6 +201,8 @@ EphemerisWriter::EphemerisWriter(const EphemerisWriter &ef) :
    spacecraft           (ef.spacecraft),
    outCoordSystem       (ef.outCoordSystem),
    dataCoordSystem      (ef.outCoordSystem),
+   trajectoryStore      (NULL),
+   storeOnly            (false),
    fullPathFileName     (ef.fullPathFileName),
    spacecraftName       (ef.spacecraftName),
    spacecraftId         (ef.spacecraftId),
@@ -489,6 +493,24 @@ void EphemerisWriter::SetIsEphemLocal(bool isLocal)
    isEphemLocal = isLocal;
 }
 
+//------------------------------------------------------------------------------
+// void SetTrajectoryStore(TrajectoryStore *store, bool onlyToStore = false)
+//------------------------------------------------------------------------------
+/**
+ * Sets the store that receives a copy of the orbit states as they are
+ * written.  Only the SPK writer fills it.
+ *
+ * @param store       The store, not owned; NULL to stop the copies
+ * @param onlyToStore true to fill the store without writing the file
+ */
+//------------------------------------------------------------------------------
+void EphemerisWriter::SetTrajectoryStore(TrajectoryStore *store,
+                                         bool onlyToStore)
+{
+   trajectoryStore = store;
+   storeOnly = (onlyToStore && (store != NULL));
+}
+
 //------------------------------------------------------------------------------
 // void SetBackgroundGeneration(bool inBackground)
 //------------------------------------------------------------------------------
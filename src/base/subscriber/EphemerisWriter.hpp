@@ -34,6 +34,8 @@
 #include <iostream>
 #include <fstream>
 
+class TrajectoryStore;
+
 class GMAT_API EphemerisWriter
 {
 public:
@@ -67,6 +69,8 @@ public:
    void  SetIsEphemLocal(bool isLocal);
    void  SetBackgroundGeneration(bool inBackground);
    void  SetRunFlags(bool finalize, bool endOfRun, bool isFinalized);
+   virtual void SetTrajectoryStore(TrajectoryStore *store,
+                                   bool onlyToStore = false);
 
    // void  SetOrbitData(Real epochInDays, Real state[6], Real cov[21]);
    void  SetOrbitData(Real epochInDays, Real state[6], Real cov[21], Real accel[3]);
@@ -164,6 +168,10 @@ protected:
    Spacecraft       *spacecraft;
    CoordinateSystem *dataCoordSystem;
    CoordinateSystem *outCoordSystem;
+   /// In-memory copy of the written orbit states, if one is wanted
+   TrajectoryStore  *trajectoryStore;
+   /// Fill only the store, without writing the file
+   bool             storeOnly;
    
    // for buffering ephemeris data
    EpochArray  a1MjdArray;
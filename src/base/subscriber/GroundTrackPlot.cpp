@@ -586,11 +586,12 @@ std::string GroundTrackPlot::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer GroundTrackPlot::GetParameterID(const std::string &str) const
 {
-   for (int i=OrbitPlotParamCount; i<GroundTrackPlotParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - OrbitPlotParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, OrbitPlotParamCount,
+               GroundTrackPlotParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return OrbitPlot::GetParameterID(str);
 }
@@ -160,11 +160,12 @@ std::string MessageWindow::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer MessageWindow::GetParameterID(const std::string &str) const
 {
-   for (int i=SubscriberParamCount; i<MessageWindowParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SubscriberParamCount,
+               MessageWindowParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Subscriber::GetParameterID(str);
 }
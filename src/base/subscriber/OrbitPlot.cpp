@@ -264,6 +264,7 @@ OrbitPlot& OrbitPlot::operator=(const OrbitPlot& plot)
    mDrawObjectArray = plot.mDrawObjectArray;
    mAllSpArray = plot.mAllSpArray;
    mScNameArray = plot.mScNameArray;
+   mScLabelNames.clear();
    mObjectNameArray = plot.mObjectNameArray;
    mAllSpNameArray = plot.mAllSpNameArray;
    mAllRefObjectNames = plot.mAllRefObjectNames;
@@ -814,11 +815,12 @@ Integer OrbitPlot::GetParameterID(const std::string &str) const
    if (str == "OrbitColor" || str == "TargetColor")
       return Gmat::PARAMETER_REMOVED;
    
-   for (int i=SubscriberParamCount; i<OrbitPlotParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SubscriberParamCount,
+               OrbitPlotParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Subscriber::GetParameterID(str);
 }
@@ -1819,6 +1821,7 @@ bool OrbitPlot::RemoveSpacePoint(const std::string &name)
       
       // erase given spacecraft from the arrays
       mScNameArray.erase(scPos);      
+      mScLabelNames.clear();
       mScXArray.erase(mScXArray.begin());
       mScYArray.erase(mScYArray.begin());
       mScZArray.erase(mScZArray.begin());
@@ -1963,6 +1966,39 @@ Integer OrbitPlot::FindIndexOfElement(StringArray &labelArray,
 }
 
 
+//------------------------------------------------------------------------------
+// Integer FindLabelIndex(const StringArray &labelArray, Integer which)
+//------------------------------------------------------------------------------
+/*
+ * Finds the index of a spacecraft element label in the element label array.
+ * The index found last time is reused when the label is still at that
+ * position, so the label array is only searched when the published data
+ * changes layout.
+ *
+ * @param labelArray The published element labels
+ * @param which      Index into mScLabelNames of the label to find
+ *
+ * @return The index of the label, or -1 if it is not published
+ */
+//------------------------------------------------------------------------------
+Integer OrbitPlot::FindLabelIndex(const StringArray &labelArray, Integer which)
+{
+   Integer index = mScLabelIndex[which];
+   if ((index >= 0) && (index < (Integer)labelArray.size()) &&
+       (labelArray[index] == mScLabelNames[which]))
+      return index;
+   
+   StringArray::const_iterator pos =
+      find(labelArray.begin(), labelArray.end(), mScLabelNames[which]);
+   if (pos == labelArray.end())
+      index = -1;
+   else
+      index = distance(labelArray.begin(), pos);
+   mScLabelIndex[which] = index;
+   return index;
+}
+
+
 //------------------------------------------------------------------------------
 // void BuildDynamicArrays()
 //------------------------------------------------------------------------------
@@ -2058,6 +2094,7 @@ void OrbitPlot::ClearDynamicArrays()
    mDrawOrbitArray.clear();
    mDrawObjectArray.clear();
    mScNameArray.clear();
+   mScLabelNames.clear();
    mScXArray.clear();
    mScYArray.clear();
    mScZArray.clear();
@@ -2408,7 +2445,7 @@ Integer OrbitPlot::BufferOrbitData(const Real *dat, Integer len)
    // it just copies current labels. There was an issue with
    // provider id keep incrementing if data is regisgered and
    // published inside a GmatFunction
-   StringArray dataLabels = theDataLabels[0];
+   const StringArray &dataLabels = theDataLabels[0];
    
    #if DBGLVL_DATA_LABELS
    MessageInterface::ShowMessage("   Data labels for %s =\n   ", GetName().c_str());
@@ -2417,86 +2454,98 @@ Integer OrbitPlot::BufferOrbitData(const Real *dat, Integer len)
    MessageInterface::ShowMessage("\n");
    #endif
    
-   Integer idX, idY, idZ;
-   Integer idVx, idVy, idVz;
+   // Build the element labels once per spacecraft list
+   if (mScLabelNames.size() != (UnsignedInt)(6 * mScCount))
+   {
+      static const std::string elementSuffix[6] =
+         {".X", ".Y", ".Z", ".Vx", ".Vy", ".Vz"};
+      mScLabelNames.clear();
+      for (Integer i = 0; i < mScCount; i++)
+         for (Integer k = 0; k < 6; k++)
+            mScLabelNames.push_back(mScNameArray[i] + elementSuffix[k]);
+      mScLabelIndex.assign(6 * mScCount, -1);
+   }
+   
+   Integer ids[6];
    Integer scIndex = -1;
+   Integer presentCount = 0;
+   mPresentScIndex.resize(mScCount);
+   mConvertInState.resize(6 * mScCount);
+   mConvertOutState.resize(6 * mScCount);
    
    for (Integer i = 0; i < mScCount; i++)
    {
-      idX = FindIndexOfElement(dataLabels, mScNameArray[i]+".X");
-      idY = FindIndexOfElement(dataLabels, mScNameArray[i]+".Y");
-      idZ = FindIndexOfElement(dataLabels, mScNameArray[i]+".Z");
-      
-      idVx = FindIndexOfElement(dataLabels, mScNameArray[i]+".Vx");
-      idVy = FindIndexOfElement(dataLabels, mScNameArray[i]+".Vy");
-      idVz = FindIndexOfElement(dataLabels, mScNameArray[i]+".Vz");
+      bool found = true;
+      for (Integer k = 0; k < 6; k++)
+      {
+         ids[k] = FindLabelIndex(dataLabels, 6*i + k);
+         if (ids[k] == -1)
+            found = false;
+      }
       
       #if DBGLVL_DATA_LABELS
       MessageInterface::ShowMessage
          ("   mScNameArray[%d]=%s, idX=%d, idY=%d, idZ=%d, idVx=%d, idVy=%d, idVz=%d\n",
-          i, mScNameArray[i].c_str(), idX, idY, idZ, idVx, idVy, idVz);
+          i, mScNameArray[i].c_str(), ids[0], ids[1], ids[2], ids[3], ids[4], ids[5]);
       #endif
       
       scIndex++;
       
       // If any of index not found, handle absent data and continue with the next spacecraft
-      if (idX  == -1 || idY  == -1 || idZ  == -1 ||
-          idVx == -1 || idVy == -1 || idVz == -1)
+      if (!found)
       {
          HandleAbsentData(mScNameArray[i], scIndex, dat[0]);
          mScPrevDataPresent[scIndex] = false;
          continue;
       }
       
-      
-      // Buffer actual data
-      
       #if DBGLVL_DATA
       MessageInterface::ShowMessage
          ("   %s, sat='%s', epoch = %.11f, X,Y,Z = %f, %f, %f\n", GetName().c_str(),
-          mScNameArray[i].c_str(), dat[0], dat[idX], dat[idY], dat[idZ]);
+          mScNameArray[i].c_str(), dat[0], dat[ids[0]], dat[ids[1]], dat[ids[2]]);
       #endif
       
-      // If distributed data coordinate system is different from view
-      // coordinate system, convert data here.
-      // If we convert after current epoch, it will not give correct
-      // results, if origin is spacecraft,
-      // ie, sat->GetMJ2000State(epoch) will not give correct results.
-      if ((theDataCoordSystem != NULL && mViewCoordSystem != NULL) &&
-          (mViewCoordSystem != theDataCoordSystem))
-      {
-         #if DBGLVL_DATA
-         MessageInterface::ShowMessage
-            ("   Converting data from '%s' to '%s'\n", theDataCoordSystem->GetName().c_str(),
-             mViewCoordSystem->GetName().c_str());
-         #endif
-         
-         CoordinateConverter coordConverter;
-         Rvector6 inState, outState;
-         
-         // convert position and velocity
-         inState.Set(dat[idX], dat[idY], dat[idZ],
-                     dat[idVx], dat[idVy], dat[idVz]);
-         
-         coordConverter.Convert(dat[0], inState, theDataCoordSystem,
-                                outState, mViewCoordSystem);
-         
-         mScXArray[scIndex] = outState[0];
-         mScYArray[scIndex] = outState[1];
-         mScZArray[scIndex] = outState[2];
-         mScVxArray[scIndex] = outState[3];
-         mScVyArray[scIndex] = outState[4];
-         mScVzArray[scIndex] = outState[5];
-      }
-      else
-      {
-         mScXArray[scIndex] = dat[idX];
-         mScYArray[scIndex] = dat[idY];
-         mScZArray[scIndex] = dat[idZ];
-         mScVxArray[scIndex] = dat[idVx];
-         mScVyArray[scIndex] = dat[idVy];
-         mScVzArray[scIndex] = dat[idVz];
-      }
+      for (Integer k = 0; k < 6; k++)
+         mConvertInState[6*presentCount + k] = dat[ids[k]];
+      mPresentScIndex[presentCount] = scIndex;
+      ++presentCount;
+   }
+   
+   // If distributed data coordinate system is different from view
+   // coordinate system, convert data here.
+   // If we convert after current epoch, it will not give correct
+   // results, if origin is spacecraft,
+   // ie, sat->GetMJ2000State(epoch) will not give correct results.
+   // All spacecraft are converted in one call so they share the rotation
+   // computed for this epoch.
+   const Real *bufferedState = &mConvertInState[0];
+   if ((presentCount > 0) &&
+       (theDataCoordSystem != NULL && mViewCoordSystem != NULL) &&
+       (mViewCoordSystem != theDataCoordSystem))
+   {
+      #if DBGLVL_DATA
+      MessageInterface::ShowMessage
+         ("   Converting %d states from '%s' to '%s'\n", presentCount,
+          theDataCoordSystem->GetName().c_str(),
+          mViewCoordSystem->GetName().c_str());
+      #endif
+      
+      mCoordConverter.Convert(A1Mjd(dat[0]), presentCount,
+                              &mConvertInState[0], theDataCoordSystem,
+                              &mConvertOutState[0], mViewCoordSystem);
+      bufferedState = &mConvertOutState[0];
+   }
+   
+   for (Integer j = 0; j < presentCount; j++)
+   {
+      scIndex = mPresentScIndex[j];
+      const Real *state = bufferedState + 6*j;
+      mScXArray[scIndex] = state[0];
+      mScYArray[scIndex] = state[1];
+      mScZArray[scIndex] = state[2];
+      mScVxArray[scIndex] = state[3];
+      mScVyArray[scIndex] = state[4];
+      mScVzArray[scIndex] = state[5];
       
       // Save old data for next time
       mScPrevDataPresent[scIndex] = true;
@@ -2510,14 +2559,8 @@ Integer OrbitPlot::BufferOrbitData(const Real *dat, Integer len)
       
       #if DBGLVL_DATA
       MessageInterface::ShowMessage
-         ("   after buffering, scNo=%d, scIndex=%d, X,Y,Z = %f, %f, %f\n",
-          i, scIndex, mScXArray[scIndex], mScYArray[scIndex], mScZArray[scIndex]);
-      #endif
-      
-      #if DBGLVL_DATA > 1
-      MessageInterface::ShowMessage
-         ("   Vx,Vy,Vz = %f, %f, %f\n",
-          mScVxArray[scIndex], mScVyArray[scIndex], mScVzArray[scIndex]);
+         ("   scIndex=%d, x,y,z=%f, %f, %f\n", scIndex, mScXArray[scIndex],
+          mScYArray[scIndex], mScZArray[scIndex]);
       #endif
    }
    
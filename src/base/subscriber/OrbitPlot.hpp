@@ -34,6 +34,7 @@
 #include "Subscriber.hpp"
 #include "SpacePoint.hpp"
 #include "CoordinateSystem.hpp"
+#include "CoordinateConverter.hpp"
 #include <map>
 
 class GMAT_API OrbitPlot : public Subscriber
@@ -197,6 +198,16 @@ protected:
    RealArray mScPrevVy;
    RealArray mScPrevVz;
    
+   // cached element labels and their indices in the published data
+   StringArray mScLabelNames;
+   IntegerArray mScLabelIndex;
+   
+   // buffers for converting all spacecraft states in one call
+   IntegerArray mPresentScIndex;
+   RealArray mConvertInState;
+   RealArray mConvertOutState;
+   CoordinateConverter mCoordConverter;
+   
    // arrays for holding solver current data
    std::vector<StringArray> mCurrScArray;
    std::vector<Real> mCurrEpochArray;
@@ -246,6 +257,9 @@ protected:
    /// Finds the index of the element label from the element label array.
    Integer              FindIndexOfElement(StringArray &labelArray,
                                            const std::string &label);
+   /// Finds the index of a cached spacecraft element label
+   Integer              FindLabelIndex(const StringArray &labelArray,
+                                      Integer which);
    /// Builds dynamic arrays to pass to plotting canvas
    void                 BuildDynamicArrays();
    /// Clears dynamic arrays such as object name array, etc.
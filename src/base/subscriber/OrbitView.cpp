@@ -747,11 +747,12 @@ Integer OrbitView::GetParameterID(const std::string &str) const
        str == "MinFOV" || str == "MaxFOV" || str == "InitialFOV")
       return Gmat::PARAMETER_REMOVED;
    
-   for (int i=OrbitPlotParamCount; i<OrbitViewParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - OrbitPlotParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, OrbitPlotParamCount,
+               OrbitViewParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return OrbitPlot::GetParameterID(str);
 }
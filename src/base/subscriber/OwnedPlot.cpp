@@ -553,11 +553,12 @@ std::string OwnedPlot::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer OwnedPlot::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<OwnedPlotParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               OwnedPlotParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Subscriber::GetParameterID(str);
 }
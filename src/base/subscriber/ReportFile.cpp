@@ -34,6 +34,8 @@
 #include <stdio.h>
 #include <iomanip>
 #include <sstream>
+#include <limits>                  // for quiet_NaN()
+#include <algorithm>               // for find()
 #include "ReportFile.hpp"
 #include "MessageInterface.hpp"
 #include "Publisher.hpp"           // for Instance()
@@ -75,6 +77,7 @@ ReportFile::PARAMETER_TEXT[ReportFileParamCount - SubscriberParamCount] =
    "Delimiter",
    "ColumnWidth",
    "WriteReport",
+   "OutputFormat",
 };
 
 const Gmat::ParameterType
@@ -91,8 +94,16 @@ ReportFile::PARAMETER_TYPE[ReportFileParamCount - SubscriberParamCount] =
    Gmat::STRING_TYPE,        //"Delimiter",
    Gmat::INTEGER_TYPE,       //"ColumnWidth",
    Gmat::BOOLEAN_TYPE,       //"WriteReport",
+   Gmat::ENUMERATION_TYPE,   //"OutputFormat",
 };
 
+StringArray ReportFile::outputFormatList;
+
+const char    ReportFile::BINARY_MAGIC[16]       = "GMATReportFile";
+const Integer ReportFile::BINARY_VERSION         = 1;
+const Integer ReportFile::BINARY_BYTE_ORDER_MARK = 0x01020304;
+const Integer ReportFile::BINARY_BUFFER_SIZE     = 65536;
+
 
 //------------------------------------------------------------------------------
 // ReportFile(const std::string &type, const std::string &name,
@@ -120,6 +131,9 @@ ReportFile::ReportFile(const std::string &type, const std::string &name,
    writeFinalSolverData (false),
    finalSolverDataPosition (0),
    delimiter       (' '),
+   binaryFormat    (false),
+   binaryRowSize   (0),
+   binaryPosition  (0),
    lastUsedProvider(-1),
    mLastReportTime (0.0),
    usedByReport    (false),
@@ -139,6 +153,12 @@ ReportFile::ReportFile(const std::string &type, const std::string &name,
    initial = true;
    initialFromReport = true;
    
+   if (outputFormatList.empty())
+   {
+      outputFormatList.push_back("Text");
+      outputFormatList.push_back("Binary");
+   }
+   
    // If fileName is blank, give default name
    if (fileName == "")
    {
@@ -168,8 +188,7 @@ ReportFile::ReportFile(const std::string &type, const std::string &name,
 //------------------------------------------------------------------------------
 ReportFile::~ReportFile(void)
 {
-   dstream.flush();
-   dstream.close();
+   CloseReportFile();
 }
 
 
@@ -197,6 +216,9 @@ ReportFile::ReportFile(const ReportFile &rf) :
    writeFinalSolverData (rf.writeFinalSolverData),
    finalSolverDataPosition (0),
    delimiter       (rf.delimiter),
+   binaryFormat    (rf.binaryFormat),
+   binaryRowSize   (0),
+   binaryPosition  (0),
    lastUsedProvider(-1),
    mLastReportTime (rf.mLastReportTime),
    usedByReport    (rf.usedByReport),
@@ -248,6 +270,7 @@ ReportFile& ReportFile::operator=(const ReportFile& rf)
    writeFinalSolverData = rf.writeFinalSolverData;
    finalSolverDataPosition = 0;
    delimiter = rf.delimiter;
+   binaryFormat = rf.binaryFormat;
    mParams = rf.mParams; 
    mNumParams = rf.mNumParams;
    mParamNames = rf.mParamNames;
@@ -375,6 +398,9 @@ bool ReportFile::WriteData(WrapperArray wrapperArray, bool parsable)
    std::string desc;
    GmatBase *gb;
    
+   if (binaryFormat)
+      return WriteBinaryData(wrapperArray, parsable);
+   
    // create output buffer
    StringArray *output = new StringArray[numData];
    Integer *colWidths = new Integer[numData];
@@ -646,10 +672,7 @@ bool ReportFile::WriteData(WrapperArray wrapperArray, bool parsable)
    delete[] colWidths;
    
    if (isEndOfRun)  // close file
-   {
-      if (dstream.is_open())
-         dstream.close();
-      }
+      CloseReportFile();
    
    #if DBGLVL_WRITE_DATA > 0
    MessageInterface::ShowMessage("ReportFile::WriteData() returning true\n");
@@ -866,8 +889,17 @@ bool ReportFile::TakeAction(const std::string &action,
    }
    else if (action == "Finalize")
    {
+      CloseReportFile();
+      retval = true;
+   }
+   else if (action == "Flush")
+   {
+      // Writes out buffered rows, leaving the file open
       if (dstream.is_open())
-         dstream.close();
+      {
+         FlushBinaryData();
+         dstream.flush();
+      }
       retval = true;
    }
    
@@ -952,11 +984,12 @@ std::string ReportFile::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ReportFile::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SubscriberParamCount; i < ReportFileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, SubscriberParamCount,
+               ReportFileParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return Subscriber::GetParameterID(str);
 }
@@ -1023,8 +1056,8 @@ bool ReportFile::IsParameterCommandModeSettable(const Integer id) const
    if (id == SOLVER_ITERATIONS)
       return true;
 
-   // Turn these off
-   if (id == ADD)
+   // Turn these off; the format cannot change in the middle of a file
+   if (id == ADD || id == OUTPUT_FORMAT)
       return false;
 
    // Turn on the rest that are ReportFile specific (FILENAME, PRECISION, ADD,
@@ -1197,6 +1230,10 @@ std::string ReportFile::GetStringParameter(const Integer id) const
    {
       return std::string(1,delimiter);
    }
+   else if (id == OUTPUT_FORMAT)
+   {
+      return (binaryFormat ? "Binary" : "Text");
+   }
    
    return Subscriber::GetStringParameter(id);
 }
@@ -1256,8 +1293,8 @@ bool ReportFile::SetStringParameter(const Integer id, const std::string &value)
       // Close the stream if it is open
       if (dstream.is_open())
       {
-         dstream.close();
-         dstream.open(fullPathFileName.c_str());
+         CloseReportFile();
+         OpenReportFile();
       }
       
       return true;
@@ -1284,6 +1321,19 @@ bool ReportFile::SetStringParameter(const Integer id, const std::string &value)
 		delimiter = ' ';
       return true;
    }
+   else if (id == OUTPUT_FORMAT)
+   {
+      if (find(outputFormatList.begin(), outputFormatList.end(), value) ==
+          outputFormatList.end())
+      {
+         SubscriberException se;
+         se.SetDetails(errorMessageFormat.c_str(), value.c_str(), "OutputFormat",
+                       "Text, Binary");
+         throw se;
+      }
+      binaryFormat = (value == "Binary");
+      return true;
+   }
    
    return Subscriber::SetStringParameter(id, value);
 }
@@ -1419,6 +1469,26 @@ bool ReportFile::SetOnOffParameter(const std::string &label,
 }
 
 
+//---------------------------------------------------------------------------
+// const StringArray& GetPropertyEnumStrings(const Integer id) const
+//---------------------------------------------------------------------------
+/**
+ * Retrieves eumeration symbols of parameter of given id.
+ *
+ * @param <id> ID for the parameter.
+ *
+ * @return list of enumeration symbols
+ */
+//---------------------------------------------------------------------------
+const StringArray& ReportFile::GetPropertyEnumStrings(const Integer id) const
+{
+   if (id == OUTPUT_FORMAT)
+      return outputFormatList;
+   
+   return Subscriber::GetPropertyEnumStrings(id);
+}
+
+
 //------------------------------------------------------------------------------
 // virtual GmatBase* GetRefObject(const UnsignedInt type,
 //                                const std::string &name)
@@ -1597,10 +1667,17 @@ bool ReportFile::OpenReportFile()
       ("ReportFile::OpenReportFile() entered, fullPathFileName = %s\n", fullPathFileName.c_str());
    #endif
    
-   if (dstream.is_open())
-      dstream.close();
+   CloseReportFile();
    
-   dstream.open(fullPathFileName.c_str());
+   binaryColumnRows.clear();
+   binaryColumnCols.clear();
+   binaryRowSize = 0;
+   binaryPosition = 0;
+   
+   if (binaryFormat)
+      dstream.open(fullPathFileName.c_str(), std::ios::out | std::ios::binary);
+   else
+      dstream.open(fullPathFileName.c_str());
    if (!dstream.is_open())
    {
       #ifdef DEBUG_REPORTFILE_OPEN
@@ -1623,6 +1700,23 @@ bool ReportFile::OpenReportFile()
 }
 
 
+//------------------------------------------------------------------------------
+// void CloseReportFile()
+//------------------------------------------------------------------------------
+/**
+ * Writes any buffered binary rows and closes the report file.
+ */
+//------------------------------------------------------------------------------
+void ReportFile::CloseReportFile()
+{
+   if (dstream.is_open())
+   {
+      FlushBinaryData();
+      dstream.close();
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // void ClearYParameters()
 //------------------------------------------------------------------------------
@@ -1652,6 +1746,15 @@ void ReportFile::WriteHeaders()
        mNumParams, columnWidth);
    #endif
    
+   // Binary files describe their columns in a header written with the first
+   // row, since matrix sizes are only known from the data
+   if (binaryFormat)
+   {
+      initial = false;
+      headerReset = false;
+      return;
+   }
+   
    if (writeHeaders || headerReset)
    {
       if (!dstream.is_open())
@@ -1701,6 +1804,199 @@ void ReportFile::WriteHeaders()
 } // WriteHeaders()
 
 
+//------------------------------------------------------------------------------
+// bool WriteBinaryData(WrapperArray &wrapperArray, bool parsable)
+//------------------------------------------------------------------------------
+/**
+ * Appends one row of binary data to the output buffer.
+ *
+ * Real values, arrays and vectors can be written; undefined reals are written
+ * as NaN.  The first row sets the columns of the file.
+ *
+ * @param  wrapperArray  The wrappers of the reported data
+ * @param  parsable      True for script output, which cannot be written
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool ReportFile::WriteBinaryData(WrapperArray &wrapperArray, bool parsable)
+{
+   if (parsable)
+      throw SubscriberException("The ReportFile named \"" + GetName() +
+            "\" cannot write parsable data with OutputFormat = Binary");
+   
+   if (wrapperArray.empty())
+      return true;
+   
+   // Overwrite the final solver data, as the text format does
+   if (writeFinalSolverData && !binaryColumnRows.empty())
+   {
+      FlushBinaryData();
+      dstream.seekp(finalSolverDataPosition, std::ios_base::beg);
+      binaryPosition = finalSolverDataPosition;
+   }
+   
+   Integer numData = wrapperArray.size();
+   IntegerArray rows(numData, 1), cols(numData, 1);
+   UnsignedInt rowStart = binaryBuffer.size();
+   
+   for (Integer i = 0; i < numData; ++i)
+   {
+      ElementWrapper *wrapper = wrapperArray[i];
+      if (wrapper == NULL)
+      {
+         binaryBuffer.push_back(std::numeric_limits<Real>::quiet_NaN());
+         continue;
+      }
+      
+      Gmat::WrapperDataType wrapperType = wrapper->GetWrapperType();
+      Gmat::ParameterType dataType = Gmat::UNKNOWN_PARAMETER_TYPE;
+      if ((wrapperType == Gmat::VARIABLE_WT) ||
+          (wrapperType == Gmat::ARRAY_ELEMENT_WT) ||
+          (wrapperType == Gmat::OBJECT_PROPERTY_WT))
+         dataType = Gmat::REAL_TYPE;
+      else if (wrapperType == Gmat::ARRAY_WT)
+         dataType = Gmat::RMATRIX_TYPE;
+      else if (wrapperType == Gmat::PARAMETER_WT)
+         dataType = wrapper->GetDataType();
+      
+      switch (dataType)
+      {
+      case Gmat::REAL_TYPE:
+         {
+            Real rval = wrapper->EvaluateReal();
+            if (IsNotANumber(rval))
+               rval = std::numeric_limits<Real>::quiet_NaN();
+            binaryBuffer.push_back(rval);
+            break;
+         }
+      case Gmat::RMATRIX_TYPE:
+         {
+            Rmatrix rmat = wrapper->EvaluateArray();
+            rows[i] = rmat.GetNumRows();
+            cols[i] = rmat.GetNumColumns();
+            const Real *values = rmat.GetDataVector();
+            binaryBuffer.insert(binaryBuffer.end(), values,
+                                values + rows[i] * cols[i]);
+            break;
+         }
+      case Gmat::RVECTOR_TYPE:
+         {
+            Rvector rvec = wrapper->EvaluateRvector();
+            cols[i] = rvec.GetSize();
+            const Real *values = rvec.GetDataVector();
+            binaryBuffer.insert(binaryBuffer.end(), values, values + cols[i]);
+            break;
+         }
+      default:
+         binaryBuffer.resize(rowStart);
+         throw SubscriberException("The ReportFile named \"" + GetName() +
+               "\" cannot write \"" + wrapper->GetDescription() +
+               "\" with OutputFormat = Binary; only real numbers, arrays and "
+               "vectors can be written");
+      }
+   }
+   
+   if (binaryColumnRows.empty())
+      WriteBinaryHeaders(wrapperArray, rows, cols);
+   else if ((rows != binaryColumnRows) || (cols != binaryColumnCols))
+   {
+      binaryBuffer.resize(rowStart);
+      throw SubscriberException("The data reported to the ReportFile named \"" +
+            GetName() + "\" do not match the columns of its binary file");
+   }
+   
+   binaryPosition += (std::streamoff)(binaryRowSize * sizeof(Real));
+   
+   // Save current data position for use in writing final solver solution
+   if (!writeFinalSolverData)
+      finalSolverDataPosition = binaryPosition;
+   
+   if ((Integer)binaryBuffer.size() >= BINARY_BUFFER_SIZE)
+      FlushBinaryData();
+   
+   if (isEndOfRun)  // close file
+      CloseReportFile();
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteBinaryHeaders(WrapperArray &wrapperArray, const IntegerArray &rows,
+//                         const IntegerArray &cols)
+//------------------------------------------------------------------------------
+/**
+ * Writes the header of a binary file, describing its columns.
+ *
+ * @param  wrapperArray  The wrappers of the reported data, naming the columns
+ * @param  rows          Numbers of rows of the columns
+ * @param  cols          Numbers of columns of the columns
+ */
+//------------------------------------------------------------------------------
+void ReportFile::WriteBinaryHeaders(WrapperArray &wrapperArray,
+                                    const IntegerArray &rows,
+                                    const IntegerArray &cols)
+{
+   binaryColumnRows = rows;
+   binaryColumnCols = cols;
+   binaryRowSize = 0;
+   for (UnsignedInt i = 0; i < rows.size(); ++i)
+      binaryRowSize += rows[i] * cols[i];
+   
+   if (!dstream.good())
+      dstream.clear();
+   
+   Integer header[4] = { BINARY_VERSION, BINARY_BYTE_ORDER_MARK,
+                         (Integer)rows.size(), binaryRowSize };
+   dstream.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+   dstream.write((const char*)header, sizeof(header));
+   std::streamoff headerSize = sizeof(BINARY_MAGIC) + sizeof(header);
+   
+   for (UnsignedInt i = 0; i < rows.size(); ++i)
+   {
+      std::string name =
+         (wrapperArray[i] ? wrapperArray[i]->GetDescription() : "");
+      Integer column[3] = { rows[i], cols[i], (Integer)name.length() };
+      dstream.write((const char*)column, sizeof(column));
+      dstream.write(name.c_str(), name.length());
+      headerSize += sizeof(column) + name.length();
+   }
+   
+   // Align the rows to 8 bytes
+   const char padding[8] = { 0 };
+   Integer padSize = (8 - headerSize % 8) % 8;
+   dstream.write(padding, padSize);
+   
+   binaryPosition = headerSize + padSize;
+   finalSolverDataPosition = binaryPosition;
+   
+   #ifdef DEBUG_WRITE_HEADERS
+   MessageInterface::ShowMessage
+      ("ReportFile::WriteBinaryHeaders() wrote %d columns, %d values per row\n",
+       rows.size(), binaryRowSize);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void FlushBinaryData()
+//------------------------------------------------------------------------------
+/**
+ * Writes the buffered binary rows to the file.
+ */
+//------------------------------------------------------------------------------
+void ReportFile::FlushBinaryData()
+{
+   if (binaryBuffer.empty())
+      return;
+   
+   dstream.write((const char*)&binaryBuffer[0],
+                 binaryBuffer.size() * sizeof(Real));
+   binaryBuffer.clear();
+}
+
+
 //------------------------------------------------------------------------------
 // Integer WriteMatrix(StringArray *output, Integer param, const Rmatrix &rmat,
 //                     Integer &maxRow, Integer defWidth)
@@ -1794,6 +2090,11 @@ bool ReportFile::Distribute(int len)
    {
       if (len == 0)
          return false;
+      
+      // Text from the Report command (its column headers) has no place in
+      // a binary file
+      if (binaryFormat)
+         return true;
       else
       {
          if (!dstream.is_open())
@@ -1832,10 +2133,7 @@ bool ReportFile::Distribute(int len)
    }
    
    if (isEndOfRun)  // close file
-   {
-      if (dstream.is_open())
-         dstream.close();
-   }
+      CloseReportFile();
    
    return false;
 }
@@ -2007,10 +2305,7 @@ bool ReportFile::Distribute(const Real * dat, Integer len)
       mLastReportTime = dat[0];
       
       if (isEndOfRun)  // close file
-      {
-         if (dstream.is_open())
-            dstream.close();
-      }
+         CloseReportFile();
       
       #if DBGLVL_REPORTFILE_DATA > 1
       MessageInterface::ShowMessage
@@ -44,6 +44,22 @@
 #include <iostream>
 #include <iomanip>
 
+/**
+ * Writes reported data to a text file, or, with OutputFormat = Binary, to a
+ * file of fixed-size binary rows of real values.
+ *
+ * The binary file starts with a header describing the columns, written with
+ * the first row, followed by the rows, all in native byte order:
+ *
+ *    char     magic[16]               "GMATReportFile"
+ *    Integer  version, byte order mark, column count, values per row
+ *    per column:  Integer rows, Integer columns, Integer name length, name
+ *    padding to an 8 byte boundary
+ *    Real     values[values per row]  for each row
+ *
+ * Matrix columns are stored row by row.  Rows are buffered and written in
+ * blocks.  application/api/ReadGmatReport.py reads the files.
+ */
 class GMAT_API ReportFile : public Subscriber
 {
 public:
@@ -118,6 +134,8 @@ public:
    virtual std::string  GetOnOffParameter(const std::string &label) const;
    virtual bool         SetOnOffParameter(const std::string &label, 
                                           const std::string &value);
+   virtual const StringArray&
+                        GetPropertyEnumStrings(const Integer id) const;
 
    virtual GmatBase*    GetRefObject(const UnsignedInt type,
                                      const std::string &name);
@@ -164,6 +182,18 @@ protected:
    std::ofstream::pos_type finalSolverDataPosition;
    /// delimiter
    char                 delimiter;
+   /// Write real data as binary columns instead of text
+   bool                 binaryFormat;
+   /// Shapes (rows, columns) of the columns of a binary file, set when its
+   /// header is written
+   IntegerArray         binaryColumnRows;
+   IntegerArray         binaryColumnCols;
+   /// Number of values in a binary row
+   Integer              binaryRowSize;
+   /// Binary rows waiting to be written
+   RealArray            binaryBuffer;
+   /// File offset at the end of the buffered binary rows
+   std::ofstream::pos_type binaryPosition;
    
    /// output data stream
    std::ofstream        dstream;
@@ -180,8 +210,15 @@ protected:
    bool                 initialFromReport;
    
    virtual bool         OpenReportFile();
+   void                 CloseReportFile();
    void                 ClearParameters();
    void                 WriteHeaders();
+   bool                 WriteBinaryData(WrapperArray &wrapperArray,
+                                        bool parsable);
+   void                 WriteBinaryHeaders(WrapperArray &wrapperArray,
+                                           const IntegerArray &rows,
+                                           const IntegerArray &cols);
+   void                 FlushBinaryData();
    Integer              WriteMatrix(StringArray *output, Integer param,
                                     const Rmatrix &rmat, UnsignedInt &maxRow,
                                     Integer defWidth);
@@ -205,8 +242,19 @@ protected:
       DELIMITER,
       COL_WIDTH,
       WRITE_REPORT,
+      OUTPUT_FORMAT,
       ReportFileParamCount  ///< Count of the parameters for this class
    };
+   
+   /// Settings for OutputFormat
+   static StringArray   outputFormatList;
+   
+   /// Identifier and version of the binary layout
+   static const char    BINARY_MAGIC[16];
+   static const Integer BINARY_VERSION;
+   static const Integer BINARY_BYTE_ORDER_MARK;
+   /// Number of values buffered before binary rows are written
+   static const Integer BINARY_BUFFER_SIZE;
 
 private:
       
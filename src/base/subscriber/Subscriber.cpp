@@ -1243,11 +1243,12 @@ std::string Subscriber::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Subscriber::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<SubscriberParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, GmatBaseParamCount,
+               SubscriberParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
    
    return GmatBase::GetParameterID(str);
 }
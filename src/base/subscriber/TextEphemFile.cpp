@@ -238,11 +238,12 @@ GmatBase* TextEphemFile::Clone(void) const
 //------------------------------------------------------------------------------
 Integer TextEphemFile::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ReportFileParamCount; i < TextEphemFileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ReportFileParamCount])
-         return i;
-   }
+   static const ParameterIndex
+         parameterIndex(PARAMETER_TEXT, ReportFileParamCount,
+               TextEphemFileParamCount);
+   Integer parameterId = parameterIndex.Find(str);
+   if (parameterId != -1)
+      return parameterId;
 
    return ReportFile::GetParameterID(str);
 }
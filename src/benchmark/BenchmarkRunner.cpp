@@ -0,0 +1,439 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               BenchmarkRunner
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the timing harness used by the GMAT benchmark suite.
+ */
+//------------------------------------------------------------------------------
+
+
+#include "BenchmarkRunner.hpp"
+#include "BaseException.hpp"
+#include "MessageInterface.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <thread>
+
+//#define DEBUG_BENCHMARK_CALIBRATION
+
+namespace
+{
+   /// Sink for benchmark values, so the measured work is not optimized away
+   volatile Real benchmarkSink = 0.0;
+
+   /// Largest iteration count tried while calibrating
+   const Integer MAX_ITERATIONS = 1 << 30;
+
+   //---------------------------------------------------------------------------
+   // Real Median(std::vector<Real> values)
+   //---------------------------------------------------------------------------
+   Real Median(std::vector<Real> values)
+   {
+      std::sort(values.begin(), values.end());
+      Integer mid = (Integer)values.size() / 2;
+      if (values.size() % 2 == 1)
+         return values[mid];
+      return 0.5 * (values[mid - 1] + values[mid]);
+   }
+
+   //---------------------------------------------------------------------------
+   // std::string JsonString(const std::string &text)
+   //---------------------------------------------------------------------------
+   std::string JsonString(const std::string &text)
+   {
+      std::string quoted = "\"";
+      for (UnsignedInt i = 0; i < text.size(); ++i)
+      {
+         if ((text[i] == '"') || (text[i] == '\\'))
+            quoted += '\\';
+         quoted += text[i];
+      }
+      return quoted + "\"";
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// BenchmarkRunner()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+BenchmarkRunner::BenchmarkRunner() :
+   minTime        (0.2),
+   repetitions    (5),
+   filter         ("")
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void SetMinTime(Real seconds)
+//------------------------------------------------------------------------------
+/**
+ * Sets the least time a timed run takes
+ *
+ * @param seconds The time, in seconds
+ */
+//------------------------------------------------------------------------------
+void BenchmarkRunner::SetMinTime(Real seconds)
+{
+   if (seconds > 0.0)
+      minTime = seconds;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetRepetitions(Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of timed runs whose median is reported
+ *
+ * @param count The number of runs
+ */
+//------------------------------------------------------------------------------
+void BenchmarkRunner::SetRepetitions(Integer count)
+{
+   if (count > 0)
+      repetitions = count;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetFilter(const std::string &pattern)
+//------------------------------------------------------------------------------
+/**
+ * Limits the run to benchmarks whose names contain a pattern
+ *
+ * @param pattern The substring to match; empty runs every benchmark
+ */
+//------------------------------------------------------------------------------
+void BenchmarkRunner::SetFilter(const std::string &pattern)
+{
+   filter = pattern;
+}
+
+
+//------------------------------------------------------------------------------
+// void Add(const std::string &name, BenchmarkFunction function,
+//       Integer itemsPerIteration)
+//------------------------------------------------------------------------------
+/**
+ * Registers a benchmark
+ *
+ * @param name              The benchmark name, in Group/Operation/case form
+ * @param function          The function performing the measured operation
+ * @param itemsPerIteration Items, such as integration steps, processed in
+ *                          each iteration; 0 omits the item rate
+ */
+//------------------------------------------------------------------------------
+void BenchmarkRunner::Add(const std::string &name, BenchmarkFunction function,
+      Integer itemsPerIteration)
+{
+   Benchmark benchmark;
+   benchmark.name = name;
+   benchmark.function = function;
+   benchmark.itemsPerIteration = itemsPerIteration;
+   benchmarks.push_back(benchmark);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer Run()
+//------------------------------------------------------------------------------
+/**
+ * Times the registered benchmarks that match the filter
+ *
+ * A benchmark that throws is reported and left out of the results.
+ *
+ * @return The number of benchmarks that failed
+ */
+//------------------------------------------------------------------------------
+Integer BenchmarkRunner::Run()
+{
+   Integer failures = 0;
+   results.clear();
+
+   MessageInterface::ShowMessage("%-60s %14s %14s %12s\n", "Benchmark",
+         "Time (ns)", "CPU (ns)", "Iterations");
+   for (UnsignedInt i = 0; i < benchmarks.size(); ++i)
+   {
+      if ((filter != "") &&
+          (benchmarks[i].name.find(filter) == std::string::npos))
+         continue;
+
+      try
+      {
+         Result result = Measure(benchmarks[i]);
+         results.push_back(result);
+         MessageInterface::ShowMessage("%-60s %14.1lf %14.1lf %12d\n",
+               result.name.c_str(), result.realTime, result.cpuTime,
+               result.iterations);
+      }
+      catch (BaseException &be)
+      {
+         ++failures;
+         MessageInterface::ShowMessage("%-60s failed: %s\n",
+               benchmarks[i].name.c_str(), be.GetFullMessage().c_str());
+      }
+   }
+
+   return failures;
+}
+
+
+//------------------------------------------------------------------------------
+// const std::vector<Result>& GetResults() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the results of the last run
+ *
+ * @return The results, in run order
+ */
+//------------------------------------------------------------------------------
+const std::vector<BenchmarkRunner::Result>& BenchmarkRunner::GetResults() const
+{
+   return results;
+}
+
+
+//------------------------------------------------------------------------------
+// bool WriteJson(const std::string &fileName,
+//       const std::string &executable) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the results of the last run as JSON
+ *
+ * Each key is written on its own line, which Compare() relies on.
+ *
+ * @param fileName   The file written
+ * @param executable The name of the benchmark program, recorded in the context
+ *
+ * @return true if the file was written
+ */
+//------------------------------------------------------------------------------
+bool BenchmarkRunner::WriteJson(const std::string &fileName,
+      const std::string &executable) const
+{
+   std::ofstream json(fileName.c_str());
+   if (!json.is_open())
+      return false;
+
+   std::time_t now = std::time(NULL);
+   char date[64];
+   std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+   json << "{\n"
+        << "  \"context\": {\n"
+        << "    \"date\": " << JsonString(date) << ",\n"
+        << "    \"executable\": " << JsonString(executable) << ",\n"
+        << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+        #ifdef NDEBUG
+        << "    \"library_build_type\": \"release\",\n"
+        #else
+        << "    \"library_build_type\": \"debug\",\n"
+        #endif
+        << "    \"repetitions\": " << repetitions << ",\n"
+        << "    \"min_time\": " << minTime << "\n"
+        << "  },\n"
+        << "  \"benchmarks\": [";
+
+   json.precision(10);
+   for (UnsignedInt i = 0; i < results.size(); ++i)
+   {
+      json << (i == 0 ? "\n" : ",\n")
+           << "    {\n"
+           << "      \"name\": " << JsonString(results[i].name) << ",\n"
+           << "      \"run_type\": \"aggregate\",\n"
+           << "      \"aggregate_name\": \"median\",\n"
+           << "      \"iterations\": " << results[i].iterations << ",\n"
+           << "      \"real_time\": " << results[i].realTime << ",\n"
+           << "      \"cpu_time\": " << results[i].cpuTime << ",\n"
+           << "      \"time_unit\": \"ns\"";
+      if (results[i].itemsPerSecond > 0.0)
+         json << ",\n      \"items_per_second\": " << results[i].itemsPerSecond;
+      json << "\n    }";
+   }
+   json << "\n  ]\n}\n";
+
+   return json.good();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer Compare(const std::string &baselineFile, Real threshold)
+//------------------------------------------------------------------------------
+/**
+ * Compares the results of the last run with a baseline results file
+ *
+ * The baseline is read a line at a time, pairing each "name" key with the
+ * "real_time" key that follows it, so it must have been written by
+ * WriteJson() or in the same one key per line layout.  Times are compared in
+ * ns.
+ *
+ * @param baselineFile The results file of the earlier build
+ * @param threshold    The slowdown, in percent, reported as a regression
+ *
+ * @return The number of regressions found
+ */
+//------------------------------------------------------------------------------
+Integer BenchmarkRunner::Compare(const std::string &baselineFile,
+      Real threshold)
+{
+   std::ifstream json(baselineFile.c_str());
+   if (!json.is_open())
+   {
+      MessageInterface::ShowMessage("*** WARNING *** Unable to read the "
+            "benchmark baseline %s\n", baselineFile.c_str());
+      return 0;
+   }
+
+   std::map<std::string, Real> baseline;
+   std::string line, name;
+   while (std::getline(json, line))
+   {
+      std::string::size_type key = line.find("\"name\":");
+      if (key != std::string::npos)
+      {
+         std::string::size_type start = line.find('"', key + 7);
+         std::string::size_type end = line.rfind('"');
+         if ((start != std::string::npos) && (end > start))
+            name = line.substr(start + 1, end - start - 1);
+         continue;
+      }
+
+      key = line.find("\"real_time\":");
+      if ((key != std::string::npos) && (name != ""))
+      {
+         baseline[name] = atof(line.substr(key + 12).c_str());
+         name = "";
+      }
+   }
+
+   Integer regressions = 0;
+   MessageInterface::ShowMessage("\n%-60s %14s %14s %9s\n", "Benchmark",
+         "Baseline (ns)", "Current (ns)", "Change");
+   for (UnsignedInt i = 0; i < results.size(); ++i)
+   {
+      std::map<std::string, Real>::iterator old =
+            baseline.find(results[i].name);
+      if ((old == baseline.end()) || (old->second <= 0.0))
+      {
+         MessageInterface::ShowMessage("%-60s %14s %14.1lf %9s\n",
+               results[i].name.c_str(), "-", results[i].realTime, "new");
+         continue;
+      }
+
+      Real change = 100.0 * (results[i].realTime / old->second - 1.0);
+      bool regressed = (change > threshold);
+      if (regressed)
+         ++regressions;
+      MessageInterface::ShowMessage("%-60s %14.1lf %14.1lf %+8.1lf%%%s\n",
+            results[i].name.c_str(), old->second, results[i].realTime, change,
+            regressed ? "  REGRESSION" : "");
+   }
+
+   return regressions;
+}
+
+
+//------------------------------------------------------------------------------
+// void Consume(Real value)
+//------------------------------------------------------------------------------
+/**
+ * Keeps a computed value alive so the work producing it is not optimized away
+ *
+ * @param value The value
+ */
+//------------------------------------------------------------------------------
+void BenchmarkRunner::Consume(Real value)
+{
+   benchmarkSink = benchmarkSink + value;
+}
+
+
+//------------------------------------------------------------------------------
+// Result Measure(const Benchmark &benchmark)
+//------------------------------------------------------------------------------
+/**
+ * Calibrates the iteration count of a benchmark and times it
+ *
+ * @param benchmark The benchmark
+ *
+ * @return The timing
+ */
+//------------------------------------------------------------------------------
+BenchmarkRunner::Result BenchmarkRunner::Measure(const Benchmark &benchmark)
+{
+   typedef std::chrono::steady_clock Clock;
+
+   // Grow the count until a run takes the minimum time
+   Integer iterations = 1;
+   while (true)
+   {
+      Clock::time_point start = Clock::now();
+      benchmark.function(iterations);
+      Real elapsed = std::chrono::duration<Real>(Clock::now() - start).count();
+
+      #ifdef DEBUG_BENCHMARK_CALIBRATION
+         MessageInterface::ShowMessage("   %s: %d iterations in %le s\n",
+               benchmark.name.c_str(), iterations, elapsed);
+      #endif
+
+      if ((elapsed >= minTime) || (iterations >= MAX_ITERATIONS))
+         break;
+
+      // Aim past the minimum time, growing at most tenfold at a time
+      Real scale = (elapsed > 0.0 ? 1.4 * minTime / elapsed : 10.0);
+      scale = std::max(2.0, std::min(scale, 10.0));
+      iterations = (Integer)std::min((Real)MAX_ITERATIONS, iterations * scale);
+   }
+
+   std::vector<Real> realTimes, cpuTimes;
+   for (Integer i = 0; i < repetitions; ++i)
+   {
+      std::clock_t cpuStart = std::clock();
+      Clock::time_point start = Clock::now();
+      benchmark.function(iterations);
+      Real elapsed = std::chrono::duration<Real>(Clock::now() - start).count();
+      Real cpu = Real(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+      realTimes.push_back(elapsed * 1.0e9 / iterations);
+      cpuTimes.push_back(cpu * 1.0e9 / iterations);
+   }
+
+   Result result;
+   result.name = benchmark.name;
+   result.iterations = iterations;
+   result.realTime = Median(realTimes);
+   result.cpuTime = Median(cpuTimes);
+   result.itemsPerSecond = 0.0;
+   if ((benchmark.itemsPerIteration > 0) && (result.realTime > 0.0))
+      result.itemsPerSecond = benchmark.itemsPerIteration * 1.0e9 /
+            result.realTime;
+
+   return result;
+}
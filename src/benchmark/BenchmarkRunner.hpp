@@ -0,0 +1,103 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               BenchmarkRunner
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Declares the timing harness used by the GMAT benchmark suite.
+ */
+//------------------------------------------------------------------------------
+#ifndef BenchmarkRunner_hpp
+#define BenchmarkRunner_hpp
+
+#include "gmatdefs.hpp"
+#include <functional>
+
+/**
+ * BenchmarkRunner times registered benchmarks and writes the results.
+ *
+ * Each benchmark is a function that performs the measured operation a given
+ * number of times.  The runner doubles the count until one run takes at least
+ * the minimum time, then times the given number of repetitions at that count
+ * and keeps the median time per iteration.
+ *
+ * Results are written as JSON in the layout used by Google Benchmark, so
+ * existing comparison tools read them, and a results file from an earlier
+ * build can be used as a baseline to flag regressions.
+ */
+class BenchmarkRunner
+{
+public:
+   /// Performs the measured operation the number of times passed in
+   typedef std::function<void(Integer)> BenchmarkFunction;
+
+   /// Timing of one benchmark
+   struct Result
+   {
+      std::string name;
+      Integer     iterations;
+      /// Median wall clock time per iteration, in ns
+      Real        realTime;
+      /// Median process CPU time per iteration, in ns
+      Real        cpuTime;
+      /// Items processed per second of wall clock time, or 0
+      Real        itemsPerSecond;
+   };
+
+   BenchmarkRunner();
+
+   void           SetMinTime(Real seconds);
+   void           SetRepetitions(Integer count);
+   void           SetFilter(const std::string &pattern);
+
+   void           Add(const std::string &name, BenchmarkFunction function,
+                      Integer itemsPerIteration = 1);
+   Integer        Run();
+
+   const std::vector<Result>&
+                  GetResults() const;
+   bool           WriteJson(const std::string &fileName,
+                            const std::string &executable) const;
+   Integer        Compare(const std::string &baselineFile, Real threshold);
+
+   static void    Consume(Real value);
+
+private:
+   /// A registered benchmark
+   struct Benchmark
+   {
+      std::string       name;
+      BenchmarkFunction function;
+      Integer           itemsPerIteration;
+   };
+
+   /// Registered benchmarks, in run order
+   std::vector<Benchmark> benchmarks;
+   /// Results of the last Run()
+   std::vector<Result>    results;
+   /// Least time a timed run takes, in seconds
+   Real                   minTime;
+   /// Number of timed runs whose median is reported
+   Integer                repetitions;
+   /// Substring a benchmark name must contain to run
+   std::string            filter;
+
+   Result         Measure(const Benchmark &benchmark);
+};
+
+#endif // BenchmarkRunner_hpp
@@ -0,0 +1,619 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                GmatBenchmark
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * The GMAT benchmark suite.
+ *
+ * The micro-benchmarks time the gravity field, state conversion and number
+ * formatting code directly and need no data files.  The macro-benchmarks start the engine
+ * from a startup file and time the planetary ephemeris, coordinate
+ * conversions, force model derivatives and integrator steps on objects built
+ * through the API functions, as a script or API user would build them.
+ *
+ * Results are written as JSON, and can be compared with the results of an
+ * earlier build to catch regressions.
+ */
+//------------------------------------------------------------------------------
+
+
+#include "BenchmarkRunner.hpp"
+#include "ConsoleMessageReceiver.hpp"
+#include "MessageInterface.hpp"
+#include "BaseException.hpp"
+#include "APIFunctions.hpp"
+#include "APIException.hpp"
+#include "FileManager.hpp"
+#include "Moderator.hpp"
+#include "Harmonic.hpp"
+#include "StateConversionUtil.hpp"
+#include "StringUtil.hpp"
+#include "SolarSystem.hpp"
+#include "PlanetaryEphem.hpp"
+#include "CoordinateSystem.hpp"
+#include "CoordinateConverter.hpp"
+#include "PropSetup.hpp"
+#include "ODEModel.hpp"
+#include "Propagator.hpp"
+#include "Rmatrix33.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+namespace
+{
+   /// Engine object names start with this, to stay clear of script names
+   const std::string PREFIX = "Bench";
+
+   //---------------------------------------------------------------------------
+   // Harmonic with deterministic, decaying pseudo-coefficients
+   //---------------------------------------------------------------------------
+   class SyntheticHarmonic : public Harmonic
+   {
+   public:
+      SyntheticHarmonic(Integer degree)
+      {
+         NN = MM = degree;
+         FieldRadius = 6378.1363;
+         Factor = -398600.4415;
+         Allocate();
+         for (Integer n = 2; n <= NN; ++n)
+            for (Integer m = 0; m <= n; ++m)
+            {
+               C[n][m] = 1.0e-6 * sin(1.0 + n * 0.37 + m * 0.11) / (n * n);
+               S[n][m] = (m == 0 ? 0.0 :
+                          1.0e-6 * cos(2.0 + n * 0.23 + m * 0.19) / (n * n));
+            }
+         C[2][0] = -4.84e-4;
+         PackCoefficients();
+      }
+
+      virtual Real Cnm(const Real& jday, const Integer& n,
+            const Integer& m) const
+      {
+         return C[n][m];
+      }
+
+      virtual Real Snm(const Real& jday, const Integer& n,
+            const Integer& m) const
+      {
+         return S[n][m];
+      }
+   };
+
+
+   //---------------------------------------------------------------------------
+   // void SetText(GmatBase *obj, const std::string &label,
+   //       const std::string &value)
+   //---------------------------------------------------------------------------
+   /**
+    * Sets a string field; a quoted literal passed to SetField() would pick
+    * the bool overload
+    */
+   //---------------------------------------------------------------------------
+   void SetText(GmatBase *obj, const std::string &label,
+         const std::string &value)
+   {
+      obj->SetField(label, value);
+   }
+
+
+   //---------------------------------------------------------------------------
+   // void AddHarmonicBenchmarks(BenchmarkRunner &runner)
+   //---------------------------------------------------------------------------
+   void AddHarmonicBenchmarks(BenchmarkRunner &runner)
+   {
+      std::shared_ptr<SyntheticHarmonic> field(new SyntheticHarmonic(360));
+
+      const Integer degrees[] = {4, 8, 20, 70, 120, 360};
+      for (Integer d = 0; d < 6; ++d)
+      {
+         Integer degree = degrees[d];
+         for (Integer gradient = 0; gradient < 2; ++gradient)
+         {
+            // The gradient is only filled for the low degree fields used
+            // with the STM
+            if (gradient && (degree > 20))
+               continue;
+
+            std::string name = "Harmonic/CalculateField/degree:" +
+                  std::to_string(degree) + (gradient ? "/gradient" : "");
+            runner.Add(name, [field, degree, gradient](Integer iterations)
+            {
+               HarmonicWorkspace ws;
+               Rmatrix33 grad;
+               Real acc[3];
+               for (Integer k = 0; k < iterations; ++k)
+               {
+                  Real lon = 0.001 * k;
+                  Real pos[3] = {7000.0 * cos(lon), 7000.0 * sin(lon),
+                                 1200.0 * sin(3.0 * lon)};
+                  field->CalculateField(0.0, pos, degree, degree,
+                        gradient != 0, degree, acc, grad, ws);
+                  BenchmarkRunner::Consume(acc[0]);
+               }
+            });
+         }
+      }
+   }
+
+
+   //---------------------------------------------------------------------------
+   // void AddStateConversionBenchmarks(BenchmarkRunner &runner)
+   //---------------------------------------------------------------------------
+   void AddStateConversionBenchmarks(BenchmarkRunner &runner)
+   {
+      const std::string toTypes[] = {"Keplerian", "ModifiedKeplerian",
+            "SphericalAZFPA", "SphericalRADEC", "Equinoctial",
+            "ModifiedEquinoctial", "AlternateEquinoctial", "Delaunay",
+            "Planetodetic", "BrouwerMeanShort"};
+      Rvector6 cartesian(7100.0, 1200.0, 600.0, -1.0, 7.0, 1.5);
+
+      for (Integer i = 0; i < 10; ++i)
+      {
+         std::string toType = toTypes[i];
+         runner.Add("StateConversionUtil/Convert/Cartesian->" + toType,
+               [cartesian, toType](Integer iterations)
+         {
+            Rvector6 state = cartesian;
+            for (Integer k = 0; k < iterations; ++k)
+            {
+               state[0] = cartesian[0] + 1.0e-6 * (k & 1023);
+               Rvector6 converted =
+                     StateConversionUtil::Convert(state, "Cartesian", toType);
+               BenchmarkRunner::Consume(converted[0]);
+            }
+         });
+
+         runner.Add("StateConversionUtil/Convert/" + toType + "->Cartesian",
+               [cartesian, toType](Integer iterations)
+         {
+            Rvector6 elements =
+                  StateConversionUtil::Convert(cartesian, "Cartesian", toType);
+            for (Integer k = 0; k < iterations; ++k)
+            {
+               Rvector6 converted =
+                     StateConversionUtil::Convert(elements, toType, "Cartesian");
+               BenchmarkRunner::Consume(converted[0]);
+            }
+         });
+      }
+   }
+
+
+   //---------------------------------------------------------------------------
+   // void AddToStringBenchmarks(BenchmarkRunner &runner)
+   //---------------------------------------------------------------------------
+   void AddToStringBenchmarks(BenchmarkRunner &runner)
+   {
+      // The precision used to write reports and ephemerides
+      runner.Add("StringUtil/ToString/precision:16", [](Integer iterations)
+      {
+         for (Integer k = 0; k < iterations; ++k)
+         {
+            std::string str = GmatStringUtil::ToString(k * 1.2345e-3, 16);
+            BenchmarkRunner::Consume((Real)str.size());
+         }
+      });
+
+      runner.Add("StringUtil/RealToString/precision:16", [](Integer iterations)
+      {
+         for (Integer k = 0; k < iterations; ++k)
+         {
+            std::string str = GmatStringUtil::RealToString(k * 1.2345e-3, 16);
+            BenchmarkRunner::Consume((Real)str.size());
+         }
+      });
+
+      runner.Add("StringUtil/ToShortestString", [](Integer iterations)
+      {
+         for (Integer k = 0; k < iterations; ++k)
+         {
+            std::string str = GmatStringUtil::ToShortestString(k * 1.2345e-3);
+            BenchmarkRunner::Consume((Real)str.size());
+         }
+      });
+   }
+
+
+   //---------------------------------------------------------------------------
+   // void AddEphemerisBenchmarks(BenchmarkRunner &runner)
+   //---------------------------------------------------------------------------
+   void AddEphemerisBenchmarks(BenchmarkRunner &runner)
+   {
+      PlanetaryEphem *ephem = GetSolarSystem()->GetPlanetaryEphem();
+      if (ephem == NULL)
+      {
+         MessageInterface::ShowMessage("The solar system does not read a DE "
+               "file; the DeFile benchmarks are skipped\n");
+         return;
+      }
+
+      const std::string bodies[] = {"Luna", "Sun", "Mars", "Jupiter"};
+      for (Integer i = 0; i < 4; ++i)
+      {
+         Integer id = ephem->GetBodyID(bodies[i]);
+
+         // Epochs an hour apart, so most lookups stay in the same record
+         runner.Add("DeFile/GetPosVel/" + bodies[i], [ephem, id]
+               (Integer iterations)
+         {
+            for (Integer k = 0; k < iterations; ++k)
+            {
+               A1Mjd epoch(25000.0 + (k & 4095) / 24.0);
+               Real *posVel = ephem->GetPosVel(id, epoch);
+               BenchmarkRunner::Consume(posVel[0]);
+            }
+         });
+
+         // Epochs 20 days apart, so every lookup reads a new record
+         runner.Add("DeFile/GetPosVel/" + bodies[i] + "/scattered", [ephem, id]
+               (Integer iterations)
+         {
+            for (Integer k = 0; k < iterations; ++k)
+            {
+               A1Mjd epoch(22000.0 + (k & 511) * 20.0);
+               Real *posVel = ephem->GetPosVel(id, epoch);
+               BenchmarkRunner::Consume(posVel[0]);
+            }
+         });
+      }
+   }
+
+
+   //---------------------------------------------------------------------------
+   // void AddCoordinateBenchmarks(BenchmarkRunner &runner)
+   //---------------------------------------------------------------------------
+   void AddCoordinateBenchmarks(BenchmarkRunner &runner)
+   {
+      CoordinateSystem *fromCs = (CoordinateSystem*)GetObject("EarthMJ2000Eq");
+      if (fromCs == NULL)
+         throw APIException("The EarthMJ2000Eq coordinate system is missing");
+
+      const std::string origins[] = {"Earth", "Earth", "Earth", "Earth",
+            "Earth", "Earth", "Luna", "Luna"};
+      const std::string axes[] = {"MJ2000Ec", "ICRF", "MODEq", "TODEq",
+            "BodyFixed", "GSE", "MJ2000Eq", "BodyFixed"};
+
+      std::vector<std::pair<std::string, CoordinateSystem*> > targets;
+      for (Integer i = 0; i < 8; ++i)
+      {
+         CoordinateSystem *cs = (CoordinateSystem*)Construct(
+               "CoordinateSystem", PREFIX + origins[i] + axes[i], origins[i],
+               axes[i]);
+         targets.push_back(std::make_pair(origins[i] + axes[i], cs));
+      }
+      Initialize();
+
+      for (UnsignedInt i = 0; i < targets.size(); ++i)
+      {
+         CoordinateSystem *toCs = targets[i].second;
+         runner.Add("CoordinateConverter/Convert/EarthMJ2000Eq->" +
+               targets[i].first, [fromCs, toCs](Integer iterations)
+         {
+            CoordinateConverter converter;
+            Real inState[6] = {7000.0, 1000.0, 200.0, 0.5, 7.2, 1.1};
+            Real outState[6];
+            for (Integer k = 0; k < iterations; ++k)
+            {
+               // A new epoch each time, a second apart
+               A1Mjd epoch(25000.0 + (k & 65535) / 86400.0);
+               converter.Convert(epoch, inState, fromCs, outState, toCs);
+               BenchmarkRunner::Consume(outState[0]);
+            }
+         });
+      }
+   }
+
+
+   //---------------------------------------------------------------------------
+   // PropSetup* BuildPropagator(const std::string &name,
+   //       const std::string &integrator, Integer degree, bool thirdBodies,
+   //       bool srpAndDrag)
+   //---------------------------------------------------------------------------
+   /**
+    * Builds a propagator for a low Earth orbiter
+    *
+    * @param name        The base name of the objects built
+    * @param integrator  The integrator type
+    * @param degree      The degree and order of the Earth field; 0 for a point
+    *                    mass
+    * @param thirdBodies true to add Sun and Moon point masses
+    * @param srpAndDrag  true to add solar radiation pressure and Jacchia-Roberts
+    *                    drag
+    *
+    * @return The propagator, ready for PrepareInternals()
+    */
+   //---------------------------------------------------------------------------
+   PropSetup* BuildPropagator(const std::string &name,
+         const std::string &integrator, Integer degree, bool thirdBodies,
+         bool srpAndDrag)
+   {
+      GmatBase *sat = Construct("Spacecraft", name + "Sat");
+      SetText(sat, "DateFormat", "UTCGregorian");
+      SetText(sat, "Epoch", "20 Jul 2020 12:00:00.000");
+      SetText(sat, "CoordinateSystem", "EarthMJ2000Eq");
+      SetText(sat, "DisplayStateType", "Keplerian");
+      sat->SetField("SMA", 6800.0);
+      sat->SetField("ECC", 0.01);
+      sat->SetField("INC", 51.6);
+      sat->SetField("RAAN", 45.0);
+      sat->SetField("AOP", 90.0);
+      sat->SetField("TA", 0.0);
+      sat->SetField("SRPArea", 2.5);
+      sat->SetField("Cr", 1.75);
+      sat->SetField("DragArea", 1.8);
+      sat->SetField("Cd", 2.1);
+      sat->SetField("DryMass", 80.0);
+
+      ODEModel *fm = (ODEModel*)Construct("ForceModel", name + "FM");
+      SetText(fm, "CentralBody", "Earth");
+
+      if (degree > 0)
+      {
+         PhysicalModel *grav = (PhysicalModel*)Construct("GravityField",
+               name + "EarthGrav");
+         SetText(grav, "BodyName", "Earth");
+         SetText(grav, "PotentialFile",
+               FileManager::Instance()->GetFullPathname("JGM3_FILE"));
+         grav->SetField("Degree", degree);
+         grav->SetField("Order", degree);
+         fm->AddForce(grav);
+      }
+      else
+      {
+         PhysicalModel *earth = (PhysicalModel*)Construct("PointMassForce",
+               name + "EarthGrav");
+         SetText(earth, "BodyName", "Earth");
+         fm->AddForce(earth);
+      }
+
+      if (thirdBodies)
+      {
+         const std::string bodies[] = {"Sun", "Luna"};
+         for (Integer i = 0; i < 2; ++i)
+         {
+            PhysicalModel *pm = (PhysicalModel*)Construct("PointMassForce",
+                  name + bodies[i] + "Grav");
+            SetText(pm, "BodyName", bodies[i]);
+            fm->AddForce(pm);
+         }
+      }
+
+      if (srpAndDrag)
+      {
+         fm->AddForce((PhysicalModel*)Construct("SolarRadiationPressure",
+               name + "SRP"));
+
+         PhysicalModel *drag = (PhysicalModel*)Construct("DragForce",
+               name + "Drag");
+         SetText(drag, "AtmosphereModel", "JacchiaRoberts");
+         drag->SetReference(Construct("JacchiaRoberts", name + "Atmos"));
+         fm->AddForce(drag);
+      }
+
+      PropSetup *prop = (PropSetup*)Construct("Propagator", name + "Prop");
+      prop->SetReference(Construct(integrator, name + "Gator"));
+      prop->SetReference(fm);
+      prop->SetField("InitialStepSize", 60.0);
+      prop->SetField("Accuracy", 1.0e-11);
+      prop->SetField("MinStep", 0.0);
+      prop->AddPropObject(sat);
+
+      return prop;
+   }
+
+
+   //---------------------------------------------------------------------------
+   // void AddPropagationBenchmarks(BenchmarkRunner &runner)
+   //---------------------------------------------------------------------------
+   void AddPropagationBenchmarks(BenchmarkRunner &runner)
+   {
+      // Force stacks for the derivative benchmarks
+      struct Stack
+      {
+         std::string label;
+         Integer     degree;
+         bool        thirdBodies;
+         bool        srpAndDrag;
+      };
+      const Stack stacks[] = {
+            {"PointMass",               0, false, false},
+            {"JGM3_8x8+SunMoon",        8, true,  false},
+            {"JGM3_20x20+SunMoon+SRP+Drag", 20, true, true},
+            {"JGM3_70x70+SunMoon",     70, true,  false}};
+
+      // Integrators timed with the 8x8 stack
+      const std::string integrators[] = {"RungeKutta89", "PrinceDormand78",
+            "PrinceDormand45", "RungeKutta68", "RungeKutta56",
+            "AdamsBashforthMoulton", "BulirschStoer"};
+
+      std::vector<std::pair<std::string, PropSetup*> > derivProps, stepProps;
+      for (Integer i = 0; i < 4; ++i)
+         derivProps.push_back(std::make_pair(stacks[i].label,
+               BuildPropagator(PREFIX + "Deriv" + std::to_string(i),
+                     "RungeKutta89", stacks[i].degree, stacks[i].thirdBodies,
+                     stacks[i].srpAndDrag)));
+      for (Integer i = 0; i < 7; ++i)
+         stepProps.push_back(std::make_pair(integrators[i],
+               BuildPropagator(PREFIX + "Step" + std::to_string(i),
+                     integrators[i], 8, true, false)));
+
+      Initialize();
+
+      for (UnsignedInt i = 0; i < derivProps.size(); ++i)
+      {
+         PropSetup *prop = derivProps[i].second;
+         prop->PrepareInternals();
+         ODEModel *ode = prop->GetODEModel();
+         Propagator *gator = prop->GetPropagator();
+         std::shared_ptr<RealArray> state(new RealArray(gator->GetState(),
+               gator->GetState() + gator->GetDimension()));
+
+         runner.Add("ODEModel/GetDerivatives/" + derivProps[i].first,
+               [ode, state](Integer iterations)
+         {
+            for (Integer k = 0; k < iterations; ++k)
+            {
+               if (!ode->GetDerivatives(&(*state)[0], (k & 63) * 1.0, 1))
+                  throw APIException("GetDerivatives() failed");
+               BenchmarkRunner::Consume(ode->GetDerivativeArray()[3]);
+            }
+         });
+      }
+
+      for (UnsignedInt i = 0; i < stepProps.size(); ++i)
+      {
+         PropSetup *prop = stepProps[i].second;
+         prop->PrepareInternals();
+         Propagator *gator = prop->GetPropagator();
+
+         // The orbit keeps going; a year of 60 second steps is 525960 steps
+         runner.Add("Propagator/Step60s/" + stepProps[i].first +
+               "/JGM3_8x8+SunMoon", [gator](Integer iterations)
+         {
+            for (Integer k = 0; k < iterations; ++k)
+            {
+               if (!gator->Step(60.0))
+                  throw APIException("The integrator failed to step");
+            }
+            BenchmarkRunner::Consume(gator->GetState()[0]);
+         });
+      }
+   }
+
+
+   //---------------------------------------------------------------------------
+   // void ShowUsage()
+   //---------------------------------------------------------------------------
+   void ShowUsage()
+   {
+      std::cout
+         << "Usage: GmatBenchmark [option ...]\n"
+         << "   --startup <file>        Startup file for the engine benchmarks (default gmat_startup_file.txt)\n"
+         << "   --micro                 Runs only the benchmarks that need no startup file\n"
+         << "   --filter <text>         Runs the benchmarks whose names contain the text\n"
+         << "   --out <file>            Writes the results as JSON (default GmatBenchmark.json)\n"
+         << "   --baseline <file>       Compares the results with an earlier results file\n"
+         << "   --threshold <percent>   Slowdown reported as a regression (default 10)\n"
+         << "   --min_time <seconds>    Least time for each timed run (default 0.2)\n"
+         << "   --repetitions <n>       Timed runs whose median is reported (default 5)\n"
+         << "   --help                  Shows this message\n"
+         << "\nThe exit code is 1 when a regression is found and 2 when a benchmark fails.\n"
+         << std::endl;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   ConsoleMessageReceiver *theMessageReceiver =
+         ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(theMessageReceiver);
+
+   std::string startupFile = "gmat_startup_file.txt";
+   std::string outFile = "GmatBenchmark.json";
+   std::string baselineFile = "";
+   Real threshold = 10.0;
+   bool engine = true;
+
+   BenchmarkRunner runner;
+   for (Integer i = 1; i < argc; ++i)
+   {
+      std::string arg = argv[i];
+      bool hasValue = (i + 1 < argc);
+
+      if (arg == "--micro")
+         engine = false;
+      else if ((arg == "--startup") && hasValue)
+         startupFile = argv[++i];
+      else if ((arg == "--filter") && hasValue)
+         runner.SetFilter(argv[++i]);
+      else if ((arg == "--out") && hasValue)
+         outFile = argv[++i];
+      else if ((arg == "--baseline") && hasValue)
+         baselineFile = argv[++i];
+      else if ((arg == "--threshold") && hasValue)
+         threshold = atof(argv[++i]);
+      else if ((arg == "--min_time") && hasValue)
+         runner.SetMinTime(atof(argv[++i]));
+      else if ((arg == "--repetitions") && hasValue)
+         runner.SetRepetitions(atoi(argv[++i]));
+      else
+      {
+         ShowUsage();
+         return (arg == "--help" ? 0 : 2);
+      }
+   }
+
+   Integer failures = 0;
+   try
+   {
+      AddHarmonicBenchmarks(runner);
+      AddStateConversionBenchmarks(runner);
+      AddToStringBenchmarks(runner);
+
+      if (engine)
+      {
+         Setup(startupFile);
+         if (!Moderator::Instance()->IsInitialized())
+            throw APIException("Unable to start the engine from " +
+                  startupFile);
+         AddEphemerisBenchmarks(runner);
+         AddCoordinateBenchmarks(runner);
+         AddPropagationBenchmarks(runner);
+      }
+   }
+   catch (BaseException &be)
+   {
+      // The benchmarks set up so far still run
+      ++failures;
+      MessageInterface::ShowMessage("*** Benchmark setup failed: %s\n",
+            be.GetFullMessage().c_str());
+   }
+
+   failures += runner.Run();
+
+   if (runner.WriteJson(outFile, argv[0]))
+      MessageInterface::ShowMessage("\nResults written to %s\n",
+            outFile.c_str());
+   else
+   {
+      ++failures;
+      MessageInterface::ShowMessage("*** Unable to write %s\n",
+            outFile.c_str());
+   }
+
+   Integer regressions = 0;
+   if (baselineFile != "")
+   {
+      regressions = runner.Compare(baselineFile, threshold);
+      MessageInterface::ShowMessage("\n%d regression(s) over %.1lf%%\n",
+            regressions, threshold);
+   }
+
+   if (failures > 0)
+      return 2;
+   return (regressions > 0 ? 1 : 0);
+}
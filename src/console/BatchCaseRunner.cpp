@@ -0,0 +1,984 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  BatchCaseRunner
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the console batch case runner.
+ */
+//------------------------------------------------------------------------------
+
+
+#include "BatchCaseRunner.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+
+#include "CaseChannel.hpp"
+#include "ConsoleAppException.hpp"
+#include "ConsolePlotReceiver.hpp"
+#include "Moderator.hpp"
+#include "MessageInterface.hpp"
+#include "Profiler.hpp"
+#include "RandomNumber.hpp"
+#include "RandomStream.hpp"
+#include "StringUtil.hpp"
+
+#if !defined(_WIN32)
+   #define BATCH_CASES_USE_FORK
+   #include <unistd.h>
+   #include <sys/select.h>
+   #include <sys/types.h>
+   #include <sys/wait.h>
+#endif
+
+//#define DEBUG_BATCH_CASES
+
+
+//------------------------------------------------------------------------------
+// BatchCaseRunner(Moderator *mod)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param mod The (initialized) Moderator used to interpret and run the script
+ */
+//------------------------------------------------------------------------------
+BatchCaseRunner::BatchCaseRunner(Moderator *mod) :
+   theModerator      (mod),
+   useCaseSeeds      (false),
+   caseSeed          (0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~BatchCaseRunner()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+BatchCaseRunner::~BatchCaseRunner()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void LoadCases(const std::string &caseFile)
+//------------------------------------------------------------------------------
+/**
+ * Reads the case table
+ *
+ * @param caseFile The name of the file containing the case table
+ */
+//------------------------------------------------------------------------------
+void BatchCaseRunner::LoadCases(const std::string &caseFile)
+{
+   std::ifstream table(caseFile.c_str());
+   if (!table)
+      throw ConsoleAppException("Case file " + caseFile + " does not exist");
+
+   columns.clear();
+   cases.clear();
+
+   std::string line;
+   Integer lineNumber = 0;
+   while (std::getline(table, line))
+   {
+      ++lineNumber;
+      line = GmatStringUtil::Trim(line);
+      if ((line == "") || (line[0] == '%') || (line[0] == '#'))
+         continue;
+
+      StringArray values = GmatStringUtil::SeparateBy(line, " \t,");
+      if (columns.empty())
+      {
+         for (UnsignedInt i = 0; i < values.size(); ++i)
+         {
+            if (values[i].find('.') == std::string::npos)
+               throw ConsoleAppException("Case file " + caseFile +
+                     ": the column \"" + values[i] + "\" is not of the form "
+                     "Object.Field");
+         }
+         columns = values;
+      }
+      else
+      {
+         if (values.size() != columns.size())
+            throw ConsoleAppException("Case file " + caseFile + ", line " +
+                  GmatStringUtil::ToString(lineNumber, 1) + ": expected " +
+                  GmatStringUtil::ToString((Integer)columns.size(), 1) +
+                  " values, found " +
+                  GmatStringUtil::ToString((Integer)values.size(), 1));
+         cases.push_back(values);
+      }
+   }
+
+   if (columns.empty())
+      throw ConsoleAppException("Case file " + caseFile +
+            " does not contain a column header");
+}
+
+
+//------------------------------------------------------------------------------
+// void SetCaseSeed(unsigned int seed)
+//------------------------------------------------------------------------------
+/**
+ * Makes every case seed the random number generator before it runs
+ *
+ * The seed for a case is drawn from a counter based stream keyed on this seed
+ * and the case index, so it does not depend on the order the cases run in or
+ * on the host or process running them.
+ *
+ * @param seed The seed of the study
+ */
+//------------------------------------------------------------------------------
+void BatchCaseRunner::SetCaseSeed(unsigned int seed)
+{
+   useCaseSeeds = true;
+   caseSeed = seed;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer Run(const std::string &script, Integer workers)
+//------------------------------------------------------------------------------
+/**
+ * Interprets the script once, then runs every loaded case
+ *
+ * @param script  The mission script
+ * @param workers The maximum number of cases run at the same time
+ *
+ * @return The number of cases that failed
+ */
+//------------------------------------------------------------------------------
+Integer BatchCaseRunner::Run(const std::string &script, Integer workers)
+{
+   InterpretScript(script);
+   ResolveOverrides();
+
+   std::cout << "Running " << cases.size() << " cases of \"" << script
+             << "\" using " << (workers > 1 ? workers : 1) << " worker"
+             << (workers > 1 ? "s" : "") << std::endl;
+
+   Integer failed;
+   #ifdef BATCH_CASES_USE_FORK
+      if (workers > 1)
+         failed = RunParallel(workers);
+      else
+         failed = RunSequential();
+   #else
+      if (workers > 1)
+         std::cout << "Parallel case runs are not available on this "
+                   << "platform; running the cases sequentially" << std::endl;
+      failed = RunSequential();
+   #endif
+
+   ShowStatistics((Integer)cases.size(), failed);
+   return failed;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer Serve(Integer port)
+//------------------------------------------------------------------------------
+/**
+ * Hands the loaded cases out to worker hosts until every case has a result
+ *
+ * Workers connect at any time and ask for one case at a time, so faster hosts
+ * take more of the table.  The cases held by a worker that disconnects before
+ * reporting them are handed to the next worker that asks.  The script is not
+ * interpreted here; each worker interprets its own copy.
+ *
+ * @param port The TCP port the workers connect to
+ *
+ * @return The number of cases that failed
+ */
+//------------------------------------------------------------------------------
+Integer BatchCaseRunner::Serve(Integer port)
+{
+   Integer failed = 0;
+
+   #ifdef BATCH_CASES_USE_FORK
+      Integer count = (Integer)cases.size();
+      int listener = CaseChannel::Listen(port);
+
+      std::string columnText;
+      for (UnsignedInt i = 0; i < columns.size(); ++i)
+         columnText += (i == 0 ? "" : "\n") + columns[i];
+
+      std::deque<Integer> pending;
+      for (Integer i = 0; i < count; ++i)
+         pending.push_back(i);
+      std::vector<bool> finished(count, false);
+      Integer completed = 0;
+
+      std::map<int, CaseChannel*> channels;
+      std::map<int, std::string> hosts;
+      std::map<int, std::set<Integer> > assigned;
+
+      std::cout << "Serving " << count << " cases on port " << port
+                << std::endl;
+
+      while (completed < count)
+      {
+         fd_set readable;
+         FD_ZERO(&readable);
+         FD_SET(listener, &readable);
+         int maxFd = listener;
+         for (std::map<int, CaseChannel*>::iterator i = channels.begin();
+              i != channels.end(); ++i)
+         {
+            FD_SET(i->first, &readable);
+            if (i->first > maxFd)
+               maxFd = i->first;
+         }
+
+         if (select(maxFd + 1, &readable, NULL, NULL, NULL) < 0)
+         {
+            if (errno == EINTR)
+               continue;
+            break;
+         }
+
+         if (FD_ISSET(listener, &readable))
+         {
+            int connection = CaseChannel::Accept(listener);
+            if (connection >= 0)
+               channels[connection] = new CaseChannel(connection);
+         }
+
+         std::vector<int> ready;
+         for (std::map<int, CaseChannel*>::iterator i = channels.begin();
+              i != channels.end(); ++i)
+            if (FD_ISSET(i->first, &readable))
+               ready.push_back(i->first);
+
+         for (UnsignedInt r = 0; r < ready.size(); ++r)
+         {
+            int fd = ready[r];
+            CaseChannel *channel = channels[fd];
+            CaseChannel::MessageType type;
+            Integer caseIndex;
+            std::string payload;
+
+            bool ok = channel->Receive(type, caseIndex, payload);
+            if (ok)
+            {
+               switch (type)
+               {
+               case CaseChannel::HELLO:
+                  hosts[fd] = payload;
+                  std::cout << "*** Worker " << payload << " connected"
+                            << std::endl;
+                  ok = channel->Send(CaseChannel::COLUMNS, 0, columnText);
+                  break;
+
+               case CaseChannel::REQUEST:
+                  if (pending.empty())
+                     ok = channel->Send(CaseChannel::DONE);
+                  else
+                  {
+                     Integer next = pending.front();
+                     pending.pop_front();
+                     assigned[fd].insert(next);
+
+                     std::string values;
+                     for (UnsignedInt i = 0; i < cases[next].size(); ++i)
+                        values += (i == 0 ? "" : "\n") + cases[next][i];
+                     ok = channel->Send(CaseChannel::JOB, next, values);
+                  }
+                  break;
+
+               case CaseChannel::RESULT:
+                  {
+                     Integer status;
+                     Real runTime;
+                     if (!CaseChannel::UnpackResult(payload, status, runTime) ||
+                         (assigned[fd].erase(caseIndex) == 0))
+                     {
+                        ok = false;
+                        break;
+                     }
+                     if (finished[caseIndex])
+                        break;
+
+                     finished[caseIndex] = true;
+                     ++completed;
+                     if (status != 1)
+                        ++failed;
+                     std::cout << "*** Case " << (caseIndex + 1) << " of "
+                               << count << (status == 1 ? " completed" :
+                               " failed") << " on " << hosts[fd] << " ("
+                               << GmatStringUtil::ToString(runTime, 3)
+                               << " s)" << std::endl;
+                  }
+                  break;
+
+               default:
+                  ok = false;
+                  break;
+               }
+            }
+
+            if (!ok)
+            {
+               // Put the unfinished cases of the lost worker back in the queue
+               std::set<Integer> &lost = assigned[fd];
+               for (std::set<Integer>::reverse_iterator i = lost.rbegin();
+                    i != lost.rend(); ++i)
+                  if (!finished[*i])
+                     pending.push_front(*i);
+               if (!lost.empty())
+                  std::cout << "!!! Lost worker " << hosts[fd] << "; "
+                            << lost.size() << " case"
+                            << (lost.size() > 1 ? "s" : "")
+                            << " will be run again" << std::endl;
+
+               delete channel;
+               channels.erase(fd);
+               hosts.erase(fd);
+               assigned.erase(fd);
+            }
+         }
+      }
+
+      for (std::map<int, CaseChannel*>::iterator i = channels.begin();
+           i != channels.end(); ++i)
+         delete i->second;
+      close(listener);
+
+      // Cases never reported are failures
+      failed += count - completed;
+      ShowStatistics(count, failed);
+   #else
+      port = 0;
+      throw ConsoleAppException("Distributed case runs are not available on "
+            "this platform");
+   #endif
+
+   return failed;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer RunWorker(const std::string &script, const std::string &server,
+//       Integer workers)
+//------------------------------------------------------------------------------
+/**
+ * Interprets the script once, then runs cases handed out by a case server
+ * until the server has none left
+ *
+ * The case table comes from the server, so this host only needs the script
+ * and the files it reads.  Each case runs in a forked process as in Run(),
+ * and its status and run time are reported back when it finishes.
+ *
+ * @param script  The mission script
+ * @param server  The server, as host:port
+ * @param workers The maximum number of cases run at the same time on this host
+ *
+ * @return The number of cases run here that failed
+ */
+//------------------------------------------------------------------------------
+Integer BatchCaseRunner::RunWorker(const std::string &script,
+      const std::string &server, Integer workers)
+{
+   Integer failed = 0;
+
+   #ifdef BATCH_CASES_USE_FORK
+      std::string::size_type colon = server.find_last_of(':');
+      Integer port;
+      if ((colon == std::string::npos) ||
+          !GmatStringUtil::ToInteger(server.substr(colon + 1), port))
+         throw ConsoleAppException("The case server \"" + server +
+               "\" is not of the form host:port");
+
+      InterpretScript(script);
+
+      CaseChannel channel(CaseChannel::Connect(server.substr(0, colon), port));
+
+      char hostName[256] = "";
+      gethostname(hostName, sizeof(hostName) - 1);
+
+      CaseChannel::MessageType type;
+      Integer caseIndex;
+      std::string payload;
+      if (!channel.Send(CaseChannel::HELLO, 0, hostName) ||
+          !channel.Receive(type, caseIndex, payload) ||
+          (type != CaseChannel::COLUMNS))
+         throw ConsoleAppException("The case server at " + server +
+               " did not send the case columns");
+
+      columns = GmatStringUtil::SeparateBy(payload, "\n");
+      cases.clear();
+      ResolveOverrides();
+
+      if (workers < 1)
+         workers = 1;
+      std::cout << "Running cases of \"" << script << "\" from " << server
+                << " using " << workers << " worker"
+                << (workers > 1 ? "s" : "") << std::endl;
+
+      typedef std::chrono::steady_clock Clock;
+      std::map<pid_t, Integer> running;
+      std::map<pid_t, Clock::time_point> started;
+      bool more = true;
+
+      while (more || !running.empty())
+      {
+         while (more && ((Integer)running.size() < workers))
+         {
+            if (!channel.Send(CaseChannel::REQUEST) ||
+                !channel.Receive(type, caseIndex, payload))
+               throw ConsoleAppException("Lost the connection to the case "
+                     "server at " + server);
+
+            if (type == CaseChannel::DONE)
+            {
+               more = false;
+               break;
+            }
+
+            StringArray values = GmatStringUtil::SeparateBy(payload, "\n");
+            if ((type != CaseChannel::JOB) || (caseIndex < 0) ||
+                (values.size() != columns.size()))
+               throw ConsoleAppException("The case server at " + server +
+                     " sent an invalid case");
+
+            if ((Integer)cases.size() <= caseIndex)
+               cases.resize(caseIndex + 1);
+            cases[caseIndex] = values;
+
+            Clock::time_point start = Clock::now();
+            pid_t pid = (pid_t)ForkCase(caseIndex);
+            if (pid < 0)
+            {
+               MessageInterface::ShowMessage("Unable to start a worker "
+                     "process; running case %d in the driver\n",
+                     caseIndex + 1);
+               Integer status = RunCase(caseIndex);
+               RestoreOriginals();
+               if (status != 1)
+                  ++failed;
+               std::chrono::duration<Real> elapsed = Clock::now() - start;
+               channel.Send(CaseChannel::RESULT, caseIndex,
+                     CaseChannel::PackResult(status, elapsed.count()));
+            }
+            else
+            {
+               running[pid] = caseIndex;
+               started[pid] = start;
+            }
+         }
+
+         if (running.empty())
+            continue;
+
+         int status = 0;
+         pid_t done = waitpid(-1, &status, 0);
+         if (done < 0)
+            break;
+
+         std::map<pid_t, Integer>::iterator i = running.find(done);
+         if (i == running.end())
+            continue;
+
+         bool ok = WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+         std::chrono::duration<Real> elapsed = Clock::now() - started[done];
+         std::cout << "*** Case " << (i->second + 1)
+                   << (ok ? " completed" : " failed") << std::endl;
+         if (!ok)
+            ++failed;
+         if (!channel.Send(CaseChannel::RESULT, i->second,
+               CaseChannel::PackResult(ok ? 1 : -1, elapsed.count())))
+            MessageInterface::ShowMessage("Unable to report case %d to the "
+                  "case server\n", i->second + 1);
+         running.erase(i);
+         started.erase(done);
+      }
+   #else
+      throw ConsoleAppException("Distributed case runs are not available on "
+            "this platform");
+   #endif
+
+   return failed;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetCaseCount() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of cases read from the case table
+ *
+ * @return The case count
+ */
+//------------------------------------------------------------------------------
+Integer BatchCaseRunner::GetCaseCount() const
+{
+   return (Integer)cases.size();
+}
+
+
+//------------------------------------------------------------------------------
+// void InterpretScript(const std::string &script)
+//------------------------------------------------------------------------------
+/**
+ * Interprets the mission script the cases are run against
+ *
+ * @param script The mission script
+ */
+//------------------------------------------------------------------------------
+void BatchCaseRunner::InterpretScript(const std::string &script)
+{
+   std::ifstream fin(script.c_str());
+   if (!fin)
+      throw ConsoleAppException("Script file " + script + " does not exist");
+   fin.close();
+
+   if (!theModerator->InterpretScript(script))
+      throw ConsoleAppException("Errors were found in the script named \"" +
+            script + "\"\n");
+}
+
+
+//------------------------------------------------------------------------------
+// void ResolveOverrides()
+//------------------------------------------------------------------------------
+/**
+ * Maps the case table columns onto configured objects and parameter IDs, and
+ * records the script values so they can be restored between cases
+ */
+//------------------------------------------------------------------------------
+void BatchCaseRunner::ResolveOverrides()
+{
+   overrides.clear();
+
+   for (UnsignedInt i = 0; i < columns.size(); ++i)
+   {
+      std::string::size_type dot = columns[i].find('.');
+      std::string objName = columns[i].substr(0, dot);
+      std::string field = columns[i].substr(dot + 1);
+
+      GmatBase *obj = theModerator->GetConfiguredObject(objName);
+      if (obj == NULL)
+         throw ConsoleAppException("The case column \"" + columns[i] +
+               "\" refers to the unknown object \"" + objName + "\"");
+
+      Override ovr;
+      ovr.column = columns[i];
+      ovr.object = obj;
+      // GetParameterID throws for unknown fields
+      ovr.id     = obj->GetParameterID(field);
+      ovr.type   = obj->GetParameterType(ovr.id);
+      ovr.original = GetValue(ovr);
+
+      #ifdef DEBUG_BATCH_CASES
+         MessageInterface::ShowMessage("Case column %s -> id %d, type %d, "
+               "script value %s\n", ovr.column.c_str(), ovr.id, ovr.type,
+               ovr.original.c_str());
+      #endif
+
+      overrides.push_back(ovr);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void ApplyCase(Integer caseIndex)
+//------------------------------------------------------------------------------
+/**
+ * Sets the configured objects to the values for a case
+ *
+ * @param caseIndex The 0-based index of the case
+ */
+//------------------------------------------------------------------------------
+void BatchCaseRunner::ApplyCase(Integer caseIndex)
+{
+   std::string caseNumber = GmatStringUtil::ToString(caseIndex + 1, 1);
+   for (UnsignedInt i = 0; i < overrides.size(); ++i)
+   {
+      std::string value = cases[caseIndex][i];
+      value = GmatStringUtil::Replace(value, "$CASE", caseNumber);
+      SetValue(overrides[i], value);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void RestoreOriginals()
+//------------------------------------------------------------------------------
+/**
+ * Puts the script values back on the configured objects
+ */
+//------------------------------------------------------------------------------
+void BatchCaseRunner::RestoreOriginals()
+{
+   for (UnsignedInt i = 0; i < overrides.size(); ++i)
+      SetValue(overrides[i], overrides[i].original);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer RunCase(Integer caseIndex)
+//------------------------------------------------------------------------------
+/**
+ * Applies a case and runs the mission
+ *
+ * @param caseIndex The 0-based index of the case
+ *
+ * @return The Moderator::RunMission status (1 on success)
+ */
+//------------------------------------------------------------------------------
+Integer BatchCaseRunner::RunCase(Integer caseIndex)
+{
+   Integer status;
+   // Plot images and profiles written by the case are named for it, and are
+   // finished before a forked worker exits
+   ConsolePlotReceiver *plots = ConsolePlotReceiver::Instance();
+   plots->SetFileSuffix("_case" + GmatStringUtil::ToString(caseIndex + 1, 1));
+   std::string profileFile = Profiler::GetReportFile();
+   Profiler::SetReportFile(GetCaseFileName(profileFile, caseIndex));
+   try
+   {
+      if (useCaseSeeds)
+      {
+         std::uint32_t counter[4] = { 0, 0, (std::uint32_t)caseIndex, 0 };
+         std::uint32_t key[2] = { caseSeed, 0 };
+         std::uint32_t draw[4];
+         RandomStream::Philox(counter, key, draw);
+         RandomNumber::Instance()->SetSeed(draw[0]);
+      }
+      ApplyCase(caseIndex);
+      status = theModerator->RunMission();
+   }
+   catch (BaseException &ex)
+   {
+      MessageInterface::ShowMessage("Case %d failed: %s\n", caseIndex + 1,
+            ex.GetFullMessage().c_str());
+      status = -1;
+   }
+   plots->Flush();
+   plots->SetFileSuffix("");
+   Profiler::SetReportFile(profileFile);
+   return status;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer RunSequential()
+//------------------------------------------------------------------------------
+/**
+ * Runs the cases in this process, one after another
+ *
+ * @return The number of cases that failed
+ */
+//------------------------------------------------------------------------------
+Integer BatchCaseRunner::RunSequential()
+{
+   Integer failed = 0;
+   for (Integer i = 0; i < (Integer)cases.size(); ++i)
+   {
+      std::cout << "*** Case " << (i + 1) << " of " << cases.size()
+                << std::endl;
+      if (RunCase(i) != 1)
+      {
+         std::cout << "!!! Case " << (i + 1) << " failed" << std::endl;
+         ++failed;
+      }
+      RestoreOriginals();
+   }
+   return failed;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer RunParallel(Integer workers)
+//------------------------------------------------------------------------------
+/**
+ * Runs the cases in a pool of forked worker processes
+ *
+ * Each worker inherits the interpreted script and all loaded data from this
+ * process, applies its case, writes its own log file, runs the mission and
+ * exits.  The GMAT singletons are never shared between running missions.
+ *
+ * @param workers The maximum number of workers alive at once
+ *
+ * @return The number of cases that failed
+ */
+//------------------------------------------------------------------------------
+Integer BatchCaseRunner::RunParallel(Integer workers)
+{
+   Integer failed = 0;
+
+   #ifdef BATCH_CASES_USE_FORK
+      std::map<pid_t, Integer> running;
+      Integer next = 0, count = (Integer)cases.size();
+
+      while ((next < count) || !running.empty())
+      {
+         while ((next < count) && ((Integer)running.size() < workers))
+         {
+            pid_t pid = (pid_t)ForkCase(next);
+            if (pid < 0)
+            {
+               // Could not fork; run what is left in this process
+               MessageInterface::ShowMessage("Unable to start a worker "
+                     "process; running case %d in the driver\n", next + 1);
+               if (RunCase(next) != 1)
+                  ++failed;
+               RestoreOriginals();
+            }
+            else
+               running[pid] = next;
+            ++next;
+         }
+
+         if (running.empty())
+            continue;
+
+         int status = 0;
+         pid_t done = waitpid(-1, &status, 0);
+         if (done < 0)
+            break;
+
+         std::map<pid_t, Integer>::iterator i = running.find(done);
+         if (i == running.end())
+            continue;
+
+         bool ok = WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+         std::cout << "*** Case " << (i->second + 1) << " of " << count
+                   << (ok ? " completed" : " failed") << std::endl;
+         if (!ok)
+            ++failed;
+         running.erase(i);
+      }
+   #else
+      workers = 1;
+      failed = RunSequential();
+   #endif
+
+   return failed;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer ForkCase(Integer caseIndex)
+//------------------------------------------------------------------------------
+/**
+ * Starts a worker process that runs one case and exits
+ *
+ * @param caseIndex The 0-based index of the case
+ *
+ * @return The process id of the worker, or -1 if it could not be started
+ */
+//------------------------------------------------------------------------------
+Integer BatchCaseRunner::ForkCase(Integer caseIndex)
+{
+   #ifdef BATCH_CASES_USE_FORK
+      // Buffered output would otherwise be written by every worker
+      std::cout.flush();
+      fflush(NULL);
+
+      pid_t pid = fork();
+      if (pid == 0)
+      {
+         MessageInterface::SetLogFile(GetCaseLogName(caseIndex));
+         Integer status = RunCase(caseIndex);
+         MessageInterface::FlushLog();
+         std::cout.flush();
+         fflush(NULL);
+         _exit(status == 1 ? 0 : 1);
+      }
+      return (Integer)pid;
+   #else
+      caseIndex = 0;
+      return -1;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void ShowStatistics(Integer caseCount, Integer failed) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the case run summary
+ *
+ * @param caseCount The number of cases in the run
+ * @param failed    The number of cases that failed
+ */
+//------------------------------------------------------------------------------
+void BatchCaseRunner::ShowStatistics(Integer caseCount, Integer failed) const
+{
+   std::cout << "\n\n**************************************\n*** "
+             << "Case Run Statistics:"
+             << "\n***   Successful cases:  " << (caseCount - failed)
+             << "\n***   Failed cases:      " << failed
+             << "\n**************************************\n";
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetValue(const Override &ovr) const
+//------------------------------------------------------------------------------
+/**
+ * Reads the current value of an override field as a string
+ *
+ * @param ovr The override
+ *
+ * @return The value
+ */
+//------------------------------------------------------------------------------
+std::string BatchCaseRunner::GetValue(const Override &ovr) const
+{
+   switch (ovr.type)
+   {
+   case Gmat::REAL_TYPE:
+   case Gmat::TIME_TYPE:
+      return GmatStringUtil::ToString(ovr.object->GetRealParameter(ovr.id),
+            17);
+   case Gmat::INTEGER_TYPE:
+   case Gmat::UNSIGNED_INT_TYPE:
+      return GmatStringUtil::ToString(
+            ovr.object->GetIntegerParameter(ovr.id), 1);
+   case Gmat::BOOLEAN_TYPE:
+      return GmatStringUtil::ToString(ovr.object->GetBooleanParameter(ovr.id));
+   case Gmat::ON_OFF_TYPE:
+      return ovr.object->GetOnOffParameter(ovr.id);
+   case Gmat::STRING_TYPE:
+   case Gmat::ENUMERATION_TYPE:
+   case Gmat::FILENAME_TYPE:
+   case Gmat::OBJECT_TYPE:
+      return ovr.object->GetStringParameter(ovr.id);
+   default:
+      break;
+   }
+
+   throw ConsoleAppException("The case column \"" + ovr.column +
+         "\" has a type (" + ovr.object->GetParameterTypeString(ovr.id) +
+         ") that cannot be set from a case file");
+}
+
+
+//------------------------------------------------------------------------------
+// void SetValue(const Override &ovr, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets an override field from its string value
+ *
+ * @param ovr   The override
+ * @param value The new value
+ */
+//------------------------------------------------------------------------------
+void BatchCaseRunner::SetValue(const Override &ovr, const std::string &value)
+{
+   bool valid = true;
+
+   switch (ovr.type)
+   {
+   case Gmat::REAL_TYPE:
+   case Gmat::TIME_TYPE:
+      {
+         Real rval;
+         if ((valid = GmatStringUtil::ToReal(value, rval)))
+            ovr.object->SetRealParameter(ovr.id, rval);
+      }
+      break;
+   case Gmat::INTEGER_TYPE:
+   case Gmat::UNSIGNED_INT_TYPE:
+      {
+         Integer ival;
+         if ((valid = GmatStringUtil::ToInteger(value, ival)))
+            ovr.object->SetIntegerParameter(ovr.id, ival);
+      }
+      break;
+   case Gmat::BOOLEAN_TYPE:
+      {
+         bool bval;
+         if ((valid = GmatStringUtil::ToBoolean(value, &bval)))
+            ovr.object->SetBooleanParameter(ovr.id, bval);
+      }
+      break;
+   case Gmat::ON_OFF_TYPE:
+      ovr.object->SetOnOffParameter(ovr.id, value);
+      break;
+   default:
+      ovr.object->SetStringParameter(ovr.id, value);
+      break;
+   }
+
+   if (!valid)
+      throw ConsoleAppException("The value \"" + value + "\" is not valid "
+            "for the case column \"" + ovr.column + "\"");
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetCaseLogName(Integer caseIndex) const
+//------------------------------------------------------------------------------
+/**
+ * Builds the log file name used by the worker running a case
+ *
+ * @param caseIndex The 0-based index of the case
+ *
+ * @return The current log file name with "_case<n>" added before the extension
+ */
+//------------------------------------------------------------------------------
+std::string BatchCaseRunner::GetCaseLogName(Integer caseIndex) const
+{
+   std::string logName = MessageInterface::GetLogFileName();
+   if (logName == "")
+      logName = "GmatLog.txt";
+
+   return GetCaseFileName(logName, caseIndex);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetCaseFileName(const std::string &fileName,
+//       Integer caseIndex) const
+//------------------------------------------------------------------------------
+/**
+ * Builds the name of a file written for a case
+ *
+ * @param fileName  The file name used outside of the cases
+ * @param caseIndex The 0-based index of the case
+ *
+ * @return The file name with "_case<n>" added before the extension
+ */
+//------------------------------------------------------------------------------
+std::string BatchCaseRunner::GetCaseFileName(const std::string &fileName,
+      Integer caseIndex) const
+{
+   std::string suffix = "_case" + GmatStringUtil::ToString(caseIndex + 1, 1);
+   std::string::size_type dot = fileName.find_last_of('.');
+   std::string::size_type slash = fileName.find_last_of("/\\");
+   if ((dot == std::string::npos) ||
+       ((slash != std::string::npos) && (dot < slash)))
+      return fileName + suffix;
+
+   return fileName.substr(0, dot) + suffix + fileName.substr(dot);
+}
@@ -0,0 +1,114 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  BatchCaseRunner
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Runs one script many times with per-case parameter overrides.
+ *
+ * The script is interpreted once.  Each case in the case table sets fields on
+ * the configured objects (e.g. Sat.X, Sat.Cd, TOI.Element1) and then runs the
+ * mission.  On POSIX systems the cases are run in a pool of forked worker
+ * processes, so the loaded solar system, DE file and gravity coefficients are
+ * shared copy-on-write instead of being reloaded for every run.  Elsewhere the
+ * cases run one after another in this process.
+ *
+ * Case table format: the first non-comment line lists the override columns as
+ * Object.Field names, and each remaining line holds one value per column.
+ * Lines starting with % or # are comments.  The token $CASE in a string value
+ * is replaced with the case number, so output file names can be kept apart.
+ *
+ * For studies too large for one host, one process serves the case table over
+ * TCP (Serve()) and worker processes on any number of hosts take cases from
+ * it (RunWorker()), each running them in its own pool of forked processes.
+ * When a case seed is set, every case seeds the random number generator from
+ * its own counter based stream, so a case gives the same results whichever
+ * host or process runs it.
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef BatchCaseRunner_hpp
+#define BatchCaseRunner_hpp
+
+#include "gmatdefs.hpp"
+#include "GmatBase.hpp"
+
+class Moderator;
+
+// No GMAT_API here because this class is used in the exe, not in a DLL
+class BatchCaseRunner
+{
+public:
+   BatchCaseRunner(Moderator *mod);
+   ~BatchCaseRunner();
+
+   void     LoadCases(const std::string &caseFile);
+   void     SetCaseSeed(unsigned int seed);
+   Integer  Run(const std::string &script, Integer workers);
+   Integer  Serve(Integer port);
+   Integer  RunWorker(const std::string &script, const std::string &server,
+                      Integer workers);
+
+   Integer  GetCaseCount() const;
+
+private:
+   /// A single override column, resolved against the configured objects
+   struct Override
+   {
+      std::string          column;
+      GmatBase             *object;
+      Integer              id;
+      Gmat::ParameterType  type;
+      std::string          original;
+   };
+
+   /// The Moderator holding the interpreted script
+   Moderator                  *theModerator;
+   /// Override columns read from the case table header
+   StringArray                columns;
+   /// One row of values per case
+   std::vector<StringArray>   cases;
+   /// Overrides resolved for the current script
+   std::vector<Override>      overrides;
+   /// Flag indicating each case seeds the random number generator
+   bool                       useCaseSeeds;
+   /// Seed of the streams the case seeds are drawn from
+   unsigned int               caseSeed;
+
+   BatchCaseRunner(const BatchCaseRunner &bcr);
+   BatchCaseRunner& operator=(const BatchCaseRunner &bcr);
+
+   void        InterpretScript(const std::string &script);
+   void        ResolveOverrides();
+   void        ApplyCase(Integer caseIndex);
+   void        RestoreOriginals();
+   Integer     RunCase(Integer caseIndex);
+   Integer     RunSequential();
+   Integer     RunParallel(Integer workers);
+   Integer     ForkCase(Integer caseIndex);
+   void        ShowStatistics(Integer caseCount, Integer failed) const;
+
+   std::string GetValue(const Override &ovr) const;
+   void        SetValue(const Override &ovr, const std::string &value);
+   std::string GetCaseLogName(Integer caseIndex) const;
+   std::string GetCaseFileName(const std::string &fileName,
+                               Integer caseIndex) const;
+};
+
+#endif // BatchCaseRunner_hpp
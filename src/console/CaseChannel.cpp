@@ -0,0 +1,447 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  CaseChannel
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the coordinator/worker case connection.
+ */
+//------------------------------------------------------------------------------
+
+
+#include "CaseChannel.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "ConsoleAppException.hpp"
+#include "StringUtil.hpp"
+
+#if !defined(_WIN32)
+   #define CASE_CHANNEL_USE_SOCKETS
+   #include <unistd.h>
+   #include <netdb.h>
+   #include <netinet/in.h>
+   #include <netinet/tcp.h>
+   #include <arpa/inet.h>
+   #include <sys/types.h>
+   #include <sys/socket.h>
+#endif
+
+// Largest payload accepted; guards against reading a corrupt frame
+static const std::uint32_t MAX_PAYLOAD = 16777216;
+
+
+//------------------------------------------------------------------------------
+// CaseChannel(int socketFd)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param socketFd A connected socket that the channel takes over, or -1
+ */
+//------------------------------------------------------------------------------
+CaseChannel::CaseChannel(int socketFd) :
+   fd       (socketFd)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~CaseChannel()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; closes the socket
+ */
+//------------------------------------------------------------------------------
+CaseChannel::~CaseChannel()
+{
+   Close();
+}
+
+
+//------------------------------------------------------------------------------
+// int Listen(Integer port)
+//------------------------------------------------------------------------------
+/**
+ * Opens a socket that accepts worker connections on all interfaces
+ *
+ * @param port The TCP port
+ *
+ * @return The listening socket
+ */
+//------------------------------------------------------------------------------
+int CaseChannel::Listen(Integer port)
+{
+   #ifdef CASE_CHANNEL_USE_SOCKETS
+      int listener = socket(AF_INET, SOCK_STREAM, 0);
+      if (listener < 0)
+         throw ConsoleAppException("Unable to open the case server socket");
+
+      int reuse = 1;
+      setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+      sockaddr_in address;
+      memset(&address, 0, sizeof(address));
+      address.sin_family = AF_INET;
+      address.sin_addr.s_addr = htonl(INADDR_ANY);
+      address.sin_port = htons((unsigned short)port);
+
+      if ((bind(listener, (sockaddr*)&address, sizeof(address)) < 0) ||
+          (listen(listener, 64) < 0))
+      {
+         close(listener);
+         throw ConsoleAppException("Unable to listen for case workers on "
+               "port " + GmatStringUtil::ToString(port, 1));
+      }
+      return listener;
+   #else
+      throw ConsoleAppException("Distributed case runs are not available on "
+            "this platform");
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// int Accept(int listener)
+//------------------------------------------------------------------------------
+/**
+ * Accepts a worker connection
+ *
+ * @param listener The socket returned by Listen()
+ *
+ * @return The connected socket, or -1 on failure
+ */
+//------------------------------------------------------------------------------
+int CaseChannel::Accept(int listener)
+{
+   #ifdef CASE_CHANNEL_USE_SOCKETS
+      int connection = accept(listener, NULL, NULL);
+      if (connection >= 0)
+      {
+         int noDelay = 1;
+         setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &noDelay,
+               sizeof(noDelay));
+      }
+      return connection;
+   #else
+      return -1;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// int Connect(const std::string &host, Integer port)
+//------------------------------------------------------------------------------
+/**
+ * Connects to a case coordinator
+ *
+ * @param host The coordinator host name or address
+ * @param port The coordinator port
+ *
+ * @return The connected socket
+ */
+//------------------------------------------------------------------------------
+int CaseChannel::Connect(const std::string &host, Integer port)
+{
+   #ifdef CASE_CHANNEL_USE_SOCKETS
+      addrinfo hints, *found = NULL;
+      memset(&hints, 0, sizeof(hints));
+      hints.ai_family = AF_UNSPEC;
+      hints.ai_socktype = SOCK_STREAM;
+
+      std::string service = GmatStringUtil::ToString(port, 1);
+      if (getaddrinfo(host.c_str(), service.c_str(), &hints, &found) != 0)
+         throw ConsoleAppException("Unable to find the case server host \"" +
+               host + "\"");
+
+      int connection = -1;
+      for (addrinfo *ai = found; ai != NULL; ai = ai->ai_next)
+      {
+         connection = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+         if (connection < 0)
+            continue;
+         if (connect(connection, ai->ai_addr, ai->ai_addrlen) == 0)
+            break;
+         close(connection);
+         connection = -1;
+      }
+      freeaddrinfo(found);
+
+      if (connection < 0)
+         throw ConsoleAppException("Unable to connect to the case server at " +
+               host + ":" + service);
+
+      int noDelay = 1;
+      setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &noDelay,
+            sizeof(noDelay));
+      return connection;
+   #else
+      throw ConsoleAppException("Distributed case runs are not available on "
+            "this platform");
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsOpen() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the channel has a socket
+ *
+ * @return true if the socket is open
+ */
+//------------------------------------------------------------------------------
+bool CaseChannel::IsOpen() const
+{
+   return fd >= 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int GetDescriptor() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the socket, for use with select()
+ *
+ * @return The socket, or -1
+ */
+//------------------------------------------------------------------------------
+int CaseChannel::GetDescriptor() const
+{
+   return fd;
+}
+
+
+//------------------------------------------------------------------------------
+// void Close()
+//------------------------------------------------------------------------------
+/**
+ * Closes the socket
+ */
+//------------------------------------------------------------------------------
+void CaseChannel::Close()
+{
+   #ifdef CASE_CHANNEL_USE_SOCKETS
+      if (fd >= 0)
+         close(fd);
+   #endif
+   fd = -1;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Send(MessageType type, Integer caseIndex, const std::string &payload)
+//------------------------------------------------------------------------------
+/**
+ * Writes one message
+ *
+ * @param type      The message type
+ * @param caseIndex The case the message is about
+ * @param payload   The message payload
+ *
+ * @return true on success, false if the connection is lost
+ */
+//------------------------------------------------------------------------------
+bool CaseChannel::Send(MessageType type, Integer caseIndex,
+      const std::string &payload)
+{
+   #ifdef CASE_CHANNEL_USE_SOCKETS
+      std::uint32_t header[3];
+      header[0] = htonl((std::uint32_t)type);
+      header[1] = htonl((std::uint32_t)caseIndex);
+      header[2] = htonl((std::uint32_t)payload.size());
+
+      // One write per message keeps frames out of separate TCP segments
+      std::string frame((const char*)header, sizeof(header));
+      frame += payload;
+      return WriteAll(frame.data(), frame.size());
+   #else
+      return false;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// bool Receive(MessageType &type, Integer &caseIndex, std::string &payload)
+//------------------------------------------------------------------------------
+/**
+ * Reads one message, waiting until it has arrived
+ *
+ * @param type      The message type
+ * @param caseIndex The case the message is about
+ * @param payload   The message payload
+ *
+ * @return true on success, false if the connection is lost or the frame is
+ *         not valid
+ */
+//------------------------------------------------------------------------------
+bool CaseChannel::Receive(MessageType &type, Integer &caseIndex,
+      std::string &payload)
+{
+   #ifdef CASE_CHANNEL_USE_SOCKETS
+      std::uint32_t header[3];
+      if (!ReadAll((char*)header, sizeof(header)))
+         return false;
+
+      std::uint32_t size = ntohl(header[2]);
+      if (size > MAX_PAYLOAD)
+         return false;
+
+      type = (MessageType)ntohl(header[0]);
+      caseIndex = (Integer)ntohl(header[1]);
+      payload.assign(size, '\0');
+      if ((size > 0) && !ReadAll(&payload[0], size))
+         return false;
+      return true;
+   #else
+      return false;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// std::string PackResult(Integer status, Real runTime)
+//------------------------------------------------------------------------------
+/**
+ * Builds the payload of a RESULT message: the run status as a signed 32-bit
+ * integer followed by the run time in seconds as an IEEE double, both in
+ * network byte order.
+ *
+ * @param status  The Moderator::RunMission status of the case
+ * @param runTime The time taken by the case, in seconds
+ *
+ * @return The payload
+ */
+//------------------------------------------------------------------------------
+std::string CaseChannel::PackResult(Integer status, Real runTime)
+{
+   std::uint32_t words[3];
+   std::uint64_t bits;
+   memcpy(&bits, &runTime, sizeof(bits));
+
+   #ifdef CASE_CHANNEL_USE_SOCKETS
+      words[0] = htonl((std::uint32_t)status);
+      words[1] = htonl((std::uint32_t)(bits >> 32));
+      words[2] = htonl((std::uint32_t)(bits & 0xFFFFFFFFu));
+   #else
+      words[0] = (std::uint32_t)status;
+      words[1] = (std::uint32_t)(bits >> 32);
+      words[2] = (std::uint32_t)(bits & 0xFFFFFFFFu);
+   #endif
+
+   return std::string((const char*)words, sizeof(words));
+}
+
+
+//------------------------------------------------------------------------------
+// bool UnpackResult(const std::string &payload, Integer &status,
+//       Real &runTime)
+//------------------------------------------------------------------------------
+/**
+ * Reads the payload of a RESULT message
+ *
+ * @param payload The payload built by PackResult()
+ * @param status  The run status of the case
+ * @param runTime The time taken by the case, in seconds
+ *
+ * @return true if the payload is valid
+ */
+//------------------------------------------------------------------------------
+bool CaseChannel::UnpackResult(const std::string &payload, Integer &status,
+      Real &runTime)
+{
+   std::uint32_t words[3];
+   if (payload.size() != sizeof(words))
+      return false;
+   memcpy(words, payload.data(), sizeof(words));
+
+   #ifdef CASE_CHANNEL_USE_SOCKETS
+      for (Integer i = 0; i < 3; ++i)
+         words[i] = ntohl(words[i]);
+   #endif
+
+   std::uint64_t bits = ((std::uint64_t)words[1] << 32) | words[2];
+   status = (Integer)(std::int32_t)words[0];
+   memcpy(&runTime, &bits, sizeof(bits));
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool WriteAll(const char *data, size_t size)
+//------------------------------------------------------------------------------
+/**
+ * Writes a buffer to the socket, continuing after partial writes
+ *
+ * @param data The bytes to write
+ * @param size The number of bytes
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool CaseChannel::WriteAll(const char *data, size_t size)
+{
+   #ifdef CASE_CHANNEL_USE_SOCKETS
+      while ((size > 0) && (fd >= 0))
+      {
+         #ifdef MSG_NOSIGNAL
+            ssize_t written = send(fd, data, size, MSG_NOSIGNAL);
+         #else
+            ssize_t written = send(fd, data, size, 0);
+         #endif
+         if (written <= 0)
+            return false;
+         data += written;
+         size -= written;
+      }
+      return size == 0;
+   #else
+      return false;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// bool ReadAll(char *data, size_t size)
+//------------------------------------------------------------------------------
+/**
+ * Reads a buffer from the socket, waiting for all of it
+ *
+ * @param data The buffer to fill
+ * @param size The number of bytes
+ *
+ * @return true on success, false if the connection is closed
+ */
+//------------------------------------------------------------------------------
+bool CaseChannel::ReadAll(char *data, size_t size)
+{
+   #ifdef CASE_CHANNEL_USE_SOCKETS
+      while ((size > 0) && (fd >= 0))
+      {
+         ssize_t received = recv(fd, data, size, 0);
+         if (received <= 0)
+            return false;
+         data += received;
+         size -= received;
+      }
+      return size == 0;
+   #else
+      return false;
+   #endif
+}
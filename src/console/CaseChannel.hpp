@@ -0,0 +1,92 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  CaseChannel
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * TCP connection between a case coordinator and a case worker host.
+ *
+ * Every message is a frame of three unsigned 32-bit integers in network byte
+ * order -- the message type, the case index and the payload length -- followed
+ * by the payload bytes.  The exchange is:
+ *
+ *    worker -> coordinator   HELLO    payload: the worker host name
+ *    coordinator -> worker   COLUMNS  payload: case columns, '\n' separated
+ *    worker -> coordinator   REQUEST
+ *    coordinator -> worker   JOB      case index; payload: the case values,
+ *                                     '\n' separated
+ *                         or DONE     no cases are left
+ *    worker -> coordinator   RESULT   case index; payload: the run status and
+ *                                     run time, see PackResult()
+ *
+ * The channel is only available on POSIX systems.
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef CaseChannel_hpp
+#define CaseChannel_hpp
+
+#include "gmatdefs.hpp"
+
+// No GMAT_API here because this class is used in the exe, not in a DLL
+class CaseChannel
+{
+public:
+   enum MessageType
+   {
+      HELLO = 1,
+      COLUMNS,
+      REQUEST,
+      JOB,
+      DONE,
+      RESULT
+   };
+
+   CaseChannel(int socketFd = -1);
+   ~CaseChannel();
+
+   static int  Listen(Integer port);
+   static int  Accept(int listener);
+   static int  Connect(const std::string &host, Integer port);
+
+   bool        IsOpen() const;
+   int         GetDescriptor() const;
+   void        Close();
+
+   bool        Send(MessageType type, Integer caseIndex = 0,
+                    const std::string &payload = "");
+   bool        Receive(MessageType &type, Integer &caseIndex,
+                       std::string &payload);
+
+   static std::string   PackResult(Integer status, Real runTime);
+   static bool          UnpackResult(const std::string &payload,
+                                     Integer &status, Real &runTime);
+
+private:
+   /// The connected socket, or -1
+   int         fd;
+
+   CaseChannel(const CaseChannel &cc);
+   CaseChannel& operator=(const CaseChannel &cc);
+
+   bool        WriteAll(const char *data, size_t size);
+   bool        ReadAll(char *data, size_t size);
+};
+
+#endif // CaseChannel_hpp
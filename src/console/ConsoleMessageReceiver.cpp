@@ -85,20 +85,15 @@ ConsoleMessageReceiver* ConsoleMessageReceiver::Instance()
 /**
  * Displays a message passed in as an std::string.
  * 
- * This method sends the message to the user's console and to the log file by 
- * calling the variable argument method, ShowMessage(const char *msg, ...).
+ * This method sends the message to the user's console and to the log file.
+ * The message arrives formatted, so it is passed on as is.
  * 
  * @param msgString The message that is displayed.
  */
 //------------------------------------------------------------------------------
 void ConsoleMessageReceiver::ShowMessage(const std::string &msg)
 {
-   // We assume here that there are no formatting indicators in this
-   // string, e.g. "%s", "%d", etc.  We need to make sure that
-   // end-of-line oomments (which are preceded by '%') are written
-   // out correctly.
-   std::string tempStr = GmatStringUtil::Replace(msg, "%", "%%");
-   ShowMessage(tempStr.c_str());
+   LogMessage(msg);
 }
 
 //------------------------------------------------------------------------------
@@ -152,8 +147,7 @@ void ConsoleMessageReceiver::ShowMessage(const char *msg, ...)
  * The Console application does not support pop-ups, so the message cannot be 
  * shown as a pop-up.
  * 
- * This method calls the variable argument version of the method to perform the 
- * actual logging.
+ * The log is flushed, so the message is on file if the run stops here.
  * 
  * @param msgType The type of message that is displayed, selected from the set
  *                {ERROR_, WARNING_, INFO_} enumerated in the Gmat namespace.
@@ -166,7 +160,12 @@ void ConsoleMessageReceiver::PopupMessage(Gmat::MessageType msgType,
    popupMessage = msg;
    messageType = msgType;
    
-   PopupMessage(msgType, msg.c_str());
+   // if no EOL then append it
+   if (msg.empty() || (msg[msg.length() - 1] != '\n'))
+      LogMessage(msg + "\n\n");
+   else
+      LogMessage(msg + "\n");
+   logWriter.Flush();
 }
 
 //------------------------------------------------------------------------------
@@ -374,15 +373,7 @@ void ConsoleMessageReceiver::OpenLogFile(const std::string &filename,
    
    logFileName = filename;
    
-   if (logFile)
-      fclose(logFile);
-   
-   if (append)
-      logFile = fopen(logFileName.c_str(), "a");
-   else
-      logFile = fopen(logFileName.c_str(), "w");
-   
-   if (!logFile)
+   if (!logWriter.Open(logFileName, append))
    {
       std::cout << "**** ERROR **** Error setting the log file to \""
                 << logFileName
@@ -390,30 +381,24 @@ void ConsoleMessageReceiver::OpenLogFile(const std::string &filename,
                 << "executable directory\n";
       
       logFileName = "GmatLog.txt";
-      
-      if (append)
-         logFile = fopen(logFileName.c_str(), "a");
-      else
-         logFile = fopen(logFileName.c_str(), "w");
+      logWriter.Open(logFileName, append);
    }
    
-   if (logFile)
+   if (logWriter.IsOpen())
    {
       std::string logFileStart = GetLogFileText();
 
       // Fix bug GMT-7399
       // fprintf(logFile, "%s %s %s\n\n",  logFileStart.c_str(), __DATE__, __TIME__);
-      fprintf(logFile, "%s %s %s\n\n", logFileStart.c_str(),
-         GmatGlobal::Instance()->GetGMATBuildDate().c_str(),
-         GmatGlobal::Instance()->GetGMATBuildTime().c_str());
-
-
-      fprintf(logFile, "GMAT Log file set to %s\n", logFileName.c_str());
+      logWriter.Write(logFileStart + " " +
+         GmatGlobal::Instance()->GetGMATBuildDate() + " " +
+         GmatGlobal::Instance()->GetGMATBuildTime() + "\n\n");
+      logWriter.Write("GMAT Log file set to " + logFileName + "\n");
       
       if (append)
-         fprintf(logFile, "The log file mode is append\n");
+         logWriter.Write("The log file mode is append\n");
       else
-         fprintf(logFile, "The log file mode is create\n");
+         logWriter.Write("The log file mode is create\n");
       
       logFileSet = true;
    }
@@ -428,10 +413,7 @@ void ConsoleMessageReceiver::OpenLogFile(const std::string &filename,
 //------------------------------------------------------------------------------
 void ConsoleMessageReceiver::CloseLogFile()
 {
-   if (logFile)
-      fclose(logFile);
-   
-   logFile = NULL;
+   logWriter.Close();
    logFileSet = false;
 }
 
@@ -443,7 +425,8 @@ void ConsoleMessageReceiver::CloseLogFile()
  * Logs the message to the log file.
  * 
  * This method displays the input message on the console and writes it to the 
- * log file.
+ * log file.  The log file is written in batches by a writer thread, and
+ * flushed at the end of the run.
  * 
  * @param msg The message.
  */
@@ -457,7 +440,7 @@ void ConsoleMessageReceiver::LogMessage(const std::string &msg)
 
    if (logEnabled)
    {
-      if (logFile == NULL)
+      if (!logWriter.IsOpen())
       {
          SetLogFile(GetLogFileName());
       }
@@ -467,13 +450,9 @@ void ConsoleMessageReceiver::LogMessage(const std::string &msg)
       OpenLogFile(logFileName);
    }
    
-   if (logFile)
-   {
-//      std::string tempStr = GmatStringUtil::Replace(msg, "%", "%%");
-//      fprintf(logFile, "%s", tempStr.c_str());
-      fprintf(logFile, "%s", msg.c_str());
-      fflush(logFile);
-   }
+//   std::string tempStr = GmatStringUtil::Replace(msg, "%", "%%");
+//   fprintf(logFile, "%s", tempStr.c_str());
+   logWriter.Write(msg);
 }
 
 //------------------------------------------------------------------------------
@@ -586,6 +565,33 @@ void ConsoleMessageReceiver::ToggleConsolePrinting(bool printToCon)
    printToConsole = printToCon;
 }
 
+//------------------------------------------------------------------------------
+// bool AcceptsMessages()
+//------------------------------------------------------------------------------
+/**
+ * Reports whether messages are printed or logged, so that silenced messages
+ * are not formatted
+ *
+ * @return true if messages go to the console or the log file
+ */
+//------------------------------------------------------------------------------
+bool ConsoleMessageReceiver::AcceptsMessages()
+{
+   return printToConsole || logEnabled;
+}
+
+//------------------------------------------------------------------------------
+// void FlushLog()
+//------------------------------------------------------------------------------
+/**
+ * Writes the buffered log text to the log file
+ */
+//------------------------------------------------------------------------------
+void ConsoleMessageReceiver::FlushLog()
+{
+   logWriter.Flush();
+}
+
 //---------------------------------
 //  private methods
 //---------------------------------
@@ -599,7 +605,6 @@ void ConsoleMessageReceiver::ToggleConsolePrinting(bool printToCon)
 //------------------------------------------------------------------------------
 ConsoleMessageReceiver::ConsoleMessageReceiver() :
    MAX_MESSAGE_LENGTH      (10000),
-   logFile                 (NULL),
    logEnabled              (false),
    logFileSet              (false),
    printToConsole          (true)
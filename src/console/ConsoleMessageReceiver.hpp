@@ -33,6 +33,7 @@
 
 #include <queue>
 #include "MessageReceiver.hpp"
+#include "BufferedLogWriter.hpp"
 
 /**
  * ConsoleMessageReceiver implements the methods to present messages to the user
@@ -70,6 +71,8 @@ public:
    virtual void ClearMessageQueue();
 
    virtual void ToggleConsolePrinting(bool printToCon);
+   virtual bool AcceptsMessages();
+   virtual void FlushLog();
    
    // Other methods not implemented for the ConsoleMessageReceiver
    //virtual int  GetNumberOfMessageLines();
@@ -89,7 +92,7 @@ private:
    int showIntervalInMilSec;
    short messageExist;
    std::string logFileName;
-   FILE *logFile;
+   BufferedLogWriter logWriter;
    bool logEnabled;
    bool logFileSet;
    bool printToConsole;
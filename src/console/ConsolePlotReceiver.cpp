@@ -0,0 +1,1145 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              ConsolePlotReceiver
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the plot receiver that writes XYPlot and OrbitView images from
+ * the Console app.
+ */
+//------------------------------------------------------------------------------
+
+#include "ConsolePlotReceiver.hpp"
+#include "PlotRaster.hpp"
+#include "MessageInterface.hpp"
+#include "RealUtilities.hpp"
+#include "GmatConstants.hpp"
+#include <cstdio>
+
+//#define DEBUG_CONSOLE_PLOTS
+
+namespace
+{
+   /// Image size, in pixels
+   const Integer IMAGE_WIDTH   = 800;
+   const Integer IMAGE_HEIGHT  = 600;
+   /// Distance from the image edges to the plot frame, in pixels
+   const Integer MARGIN        = 40;
+   const UnsignedInt FRAME_COLOR = 0x000000;
+   const UnsignedInt GRID_COLOR  = 0xDCDCDC;
+}
+
+
+ConsolePlotReceiver* ConsolePlotReceiver::theInstance = NULL;
+
+
+//------------------------------------------------------------------------------
+// ConsolePlotReceiver* Instance()
+//------------------------------------------------------------------------------
+/**
+ * Accessor for the singleton
+ *
+ * @return The singleton
+ */
+//------------------------------------------------------------------------------
+ConsolePlotReceiver* ConsolePlotReceiver::Instance()
+{
+   if (theInstance == NULL)
+      theInstance = new ConsolePlotReceiver;
+
+   return theInstance;
+}
+
+
+//------------------------------------------------------------------------------
+// ConsolePlotReceiver()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+ConsolePlotReceiver::ConsolePlotReceiver() :
+   PlotReceiver   (),
+   outputPath     ("./"),
+   fileSuffix     (""),
+   frameInterval  (0),
+   writerBusy     (false),
+   stopWriter     (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~ConsolePlotReceiver()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; writes the queued images before stopping the writer thread
+ */
+//------------------------------------------------------------------------------
+ConsolePlotReceiver::~ConsolePlotReceiver()
+{
+   Flush();
+
+   if (writer.joinable())
+   {
+      {
+         std::lock_guard<std::mutex> lock(dataMutex);
+         stopWriter = true;
+      }
+      jobSignal.notify_all();
+      writer.join();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SetOutputPath(const std::string &path)
+//------------------------------------------------------------------------------
+/**
+ * Sets the directory receiving the image files
+ *
+ * @param path The directory
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::SetOutputPath(const std::string &path)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   outputPath = path;
+   if ((outputPath != "") && (outputPath[outputPath.length()-1] != '/') &&
+       (outputPath[outputPath.length()-1] != '\\'))
+      outputPath += "/";
+}
+
+
+//------------------------------------------------------------------------------
+// void SetFrameInterval(Integer interval)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of plot updates between frame images
+ *
+ * @param interval The number of updates; 0 writes only the end of run image
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::SetFrameInterval(Integer interval)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   frameInterval = (interval > 0 ? interval : 0);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetFileSuffix(const std::string &suffix)
+//------------------------------------------------------------------------------
+/**
+ * Sets text appended to the plot names in the image file names
+ *
+ * @param suffix The text
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::SetFileSuffix(const std::string &suffix)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   fileSuffix = suffix;
+}
+
+
+//------------------------------------------------------------------------------
+// void Flush()
+//------------------------------------------------------------------------------
+/**
+ * Writes every queued image before returning
+ *
+ * Queued jobs are rendered on the calling thread, alongside the job the writer
+ * thread may be working on, so the call also completes in a process forked
+ * from one whose writer was started.
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::Flush()
+{
+   std::unique_lock<std::mutex> lock(dataMutex);
+   while (!jobs.empty())
+   {
+      RenderJob job = jobs.front();
+      jobs.pop_front();
+      lock.unlock();
+      RenderPlot(job.plot, job.fileName);
+      lock.lock();
+   }
+
+   while (writerBusy)
+      jobSignal.wait(lock);
+}
+
+
+//------------------------------------------------------------------------------
+// void QueueImage(const std::string &plotName, PlotData &plot, bool isFrame)
+//------------------------------------------------------------------------------
+/**
+ * Queues a copy of a plot for the writer thread
+ *
+ * The data mutex must be held by the caller.
+ *
+ * @param plotName The name of the plot, used in the file name
+ * @param plot     The plot
+ * @param isFrame  true for an intermediate frame, false for the final image
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::QueueImage(const std::string &plotName,
+      PlotData &plot, bool isFrame)
+{
+   RenderJob job;
+   job.fileName = outputPath + plotName + fileSuffix;
+   if (isFrame)
+   {
+      char frame[16];
+      std::sprintf(frame, "_%04d", (int)plot.frameCount++);
+      job.fileName += frame;
+   }
+   job.fileName += ".png";
+   job.plot = plot;
+
+   #ifdef DEBUG_CONSOLE_PLOTS
+      MessageInterface::ShowMessage("ConsolePlotReceiver queueing %s\n",
+            job.fileName.c_str());
+   #endif
+
+   jobs.push_back(job);
+   if (!writer.joinable())
+      writer = std::thread(&ConsolePlotReceiver::WriterLoop, this);
+   jobSignal.notify_all();
+}
+
+
+//------------------------------------------------------------------------------
+// void WriterLoop()
+//------------------------------------------------------------------------------
+/**
+ * Renders queued plots until the receiver is destroyed
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::WriterLoop()
+{
+   std::unique_lock<std::mutex> lock(dataMutex);
+   while (true)
+   {
+      while (!stopWriter && jobs.empty())
+         jobSignal.wait(lock);
+      if (jobs.empty())
+         break;
+
+      RenderJob job = jobs.front();
+      jobs.pop_front();
+      writerBusy = true;
+      lock.unlock();
+
+      RenderPlot(job.plot, job.fileName);
+
+      lock.lock();
+      writerBusy = false;
+      jobSignal.notify_all();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void RenderPlot(const PlotData &plot, const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Draws a plot and writes it as a PNG file
+ *
+ * XY plots are scaled to fill the frame; orbit plots use the same scale on
+ * both axes and draw the axes through the origin.
+ *
+ * @param plot     The plot data
+ * @param fileName The file to write
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::RenderPlot(const PlotData &plot,
+      const std::string &fileName)
+{
+   Real xMin = 1.0e99, xMax = -1.0e99, yMin = 1.0e99, yMax = -1.0e99;
+   for (UnsignedInt c = 0; c < plot.curves.size(); ++c)
+   {
+      const CurveData &curve = plot.curves[c];
+      for (UnsignedInt i = 0; i < curve.x.size(); ++i)
+      {
+         xMin = GmatMathUtil::Min(xMin, curve.x[i]);
+         xMax = GmatMathUtil::Max(xMax, curve.x[i]);
+         yMin = GmatMathUtil::Min(yMin, curve.y[i]);
+         yMax = GmatMathUtil::Max(yMax, curve.y[i]);
+      }
+   }
+
+   if (xMin > xMax)
+   {
+      xMin = yMin = -1.0;
+      xMax = yMax = 1.0;
+   }
+   if (plot.isOrbit)
+   {
+      // Keep the origin in view
+      xMin = GmatMathUtil::Min(xMin, 0.0);
+      xMax = GmatMathUtil::Max(xMax, 0.0);
+      yMin = GmatMathUtil::Min(yMin, 0.0);
+      yMax = GmatMathUtil::Max(yMax, 0.0);
+   }
+   if (xMax - xMin <= 0.0)
+   {
+      xMin -= 0.5;
+      xMax += 0.5;
+   }
+   if (yMax - yMin <= 0.0)
+   {
+      yMin -= 0.5;
+      yMax += 0.5;
+   }
+
+   Integer left = MARGIN, top = MARGIN;
+   Integer right = IMAGE_WIDTH - MARGIN, bottom = IMAGE_HEIGHT - MARGIN;
+   Real xScale = (right - left) / (xMax - xMin);
+   Real yScale = (bottom - top) / (yMax - yMin);
+
+   if (plot.isOrbit)
+   {
+      // Equal scales, centered in the frame
+      Real scale = GmatMathUtil::Min(xScale, yScale);
+      Real xMid = 0.5 * (xMin + xMax), yMid = 0.5 * (yMin + yMax);
+      xMin = xMid - 0.5 * (right - left) / scale;
+      yMax = yMid + 0.5 * (bottom - top) / scale;
+      xScale = yScale = scale;
+   }
+
+   PlotRaster raster(IMAGE_WIDTH, IMAGE_HEIGHT);
+
+   if (plot.drawGrid)
+   {
+      for (Integer i = 1; i < 10; ++i)
+      {
+         Integer gx = left + i * (right - left) / 10;
+         Integer gy = top + i * (bottom - top) / 10;
+         raster.DrawLine(gx, top, gx, bottom, GRID_COLOR);
+         raster.DrawLine(left, gy, right, gy, GRID_COLOR);
+      }
+   }
+
+   if (plot.isOrbit)
+   {
+      Integer ox = Integer(left + (0.0 - xMin) * xScale + 0.5);
+      Integer oy = Integer(top + (yMax - 0.0) * yScale + 0.5);
+      raster.DrawLine(left, oy, right, oy, GRID_COLOR);
+      raster.DrawLine(ox, top, ox, bottom, GRID_COLOR);
+   }
+
+   for (UnsignedInt c = 0; c < plot.curves.size(); ++c)
+   {
+      const CurveData &curve = plot.curves[c];
+      UnsignedInt nextBreak = 0;
+      Integer x0 = 0, y0 = 0;
+
+      for (UnsignedInt i = 0; i < curve.x.size(); ++i)
+      {
+         Integer x1 = Integer(left + (curve.x[i] - xMin) * xScale + 0.5);
+         Integer y1 = Integer(top + (yMax - curve.y[i]) * yScale + 0.5);
+
+         bool startsSegment = (i == 0);
+         while ((nextBreak < curve.breaks.size()) &&
+                (curve.breaks[nextBreak] <= (Integer)i))
+         {
+            if (curve.breaks[nextBreak] == (Integer)i)
+               startsSegment = true;
+            ++nextBreak;
+         }
+
+         if (startsSegment)
+            raster.SetPixel(x1, y1, curve.color);
+         else
+            raster.DrawLine(x0, y0, x1, y1, curve.color);
+         x0 = x1;
+         y0 = y1;
+      }
+
+      for (UnsignedInt i = 0; i < curve.marks.size(); ++i)
+      {
+         Integer k = curve.marks[i];
+         if ((k >= 0) && (k < (Integer)curve.x.size()))
+            raster.DrawMarker(Integer(left + (curve.x[k] - xMin) * xScale + 0.5),
+                  Integer(top + (yMax - curve.y[k]) * yScale + 0.5), 2,
+                  curve.color);
+      }
+
+      // Orbits end with a marker at the spacecraft
+      if (plot.isOrbit && !curve.x.empty())
+         raster.DrawMarker(x0, y0, 3, curve.color);
+   }
+
+   raster.DrawRectangle(left, top, right, bottom, FRAME_COLOR);
+
+   if (!raster.WritePng(fileName, plot.title))
+      MessageInterface::ShowMessage("*** WARNING *** The plot image \"%s\" "
+            "could not be written\n", fileName.c_str());
+}
+
+
+//------------------------------------------------------------------------------
+// OpenGL plot methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// bool CreateGlPlotWindow(const std::string &plotName,
+//       const std::string &oldName, Real positionX, Real positionY,
+//       Real width, Real height, bool isMaximized, Integer numPtsToRedraw)
+//------------------------------------------------------------------------------
+/**
+ * Starts a new buffer for an orbit plot; the window settings are not used
+ */
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::CreateGlPlotWindow(const std::string &plotName,
+      const std::string &oldName, Real positionX, Real positionY,
+      Real width, Real height, bool isMaximized, Integer numPtsToRedraw)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+
+   if ((oldName != plotName) && (plots.find(oldName) != plots.end()))
+      plots.erase(oldName);
+
+   PlotData &plot = plots[plotName];
+   plot.title = plotName;
+   plot.xTitle = "X";
+   plot.yTitle = "Y";
+   plot.isOrbit = true;
+   plot.drawGrid = false;
+   plot.active = true;
+   plot.penDown = true;
+   plot.updateCount = 0;
+   plot.frameCount = 0;
+   plot.curves.clear();
+
+   return true;
+}
+
+
+void ConsolePlotReceiver::SetGlSolarSystem(const std::string &plotName,
+      SolarSystem *ss)
+{
+}
+
+
+void ConsolePlotReceiver::SetGlObject(const std::string &plotName,
+      const StringArray &objNames, const std::vector<SpacePoint*> &objArray)
+{
+}
+
+
+void ConsolePlotReceiver::SetGlCoordSystem(const std::string &plotName,
+      CoordinateSystem *internalCs, CoordinateSystem *viewCs,
+      CoordinateSystem *viewUpCs)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void SetGl2dDrawingOption(const std::string &plotName,
+//       const std::string &centralBodyName, const std::string &textureMap,
+//       Integer footPrintOption)
+//------------------------------------------------------------------------------
+/**
+ * Marks the plot as a ground track, drawn in longitude and latitude
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::SetGl2dDrawingOption(const std::string &plotName,
+      const std::string &centralBodyName, const std::string &textureMap,
+      Integer footPrintOption)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i != plots.end())
+   {
+      i->second.isOrbit = false;
+      i->second.drawGrid = true;
+      i->second.xTitle = "Longitude";
+      i->second.yTitle = "Latitude";
+   }
+}
+
+
+void ConsolePlotReceiver::SetGl3dDrawingOption(const std::string &plotName,
+      bool showLabels, bool drawEcPlane, bool drawXyPlane, bool drawWireFrame,
+      bool drawAxes, bool drawGrid, bool drawSunLine, bool overlapPlot,
+      bool usevpInfo, bool drawStars, bool drawConstellations,
+      Integer starCount)
+{
+}
+
+
+void ConsolePlotReceiver::SetGl3dViewOption(const std::string &plotName,
+      SpacePoint *vpRefObj, SpacePoint *vpVecObj, SpacePoint *vdObj,
+      Real vsFactor, const Rvector3 &vpRefVec, const Rvector3 &vpVec,
+      const Rvector3 &vdVec, const std::string &upAxis, bool usevpRefVec,
+      bool usevpVec, bool usevdVec)
+{
+}
+
+
+void ConsolePlotReceiver::SetGlDrawOrbitFlag(const std::string &plotName,
+      const std::vector<bool> &drawArray)
+{
+}
+
+
+void ConsolePlotReceiver::SetGlShowObjectFlag(const std::string &plotName,
+      const std::vector<bool> &showArray)
+{
+}
+
+
+void ConsolePlotReceiver::SetGlUpdateFrequency(const std::string &plotName,
+      Integer updFreq)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsThere(const std::string &plotName)
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::IsThere(const std::string &plotName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   return plots.find(plotName) != plots.end();
+}
+
+
+bool ConsolePlotReceiver::InitializeGlPlot(const std::string &plotName)
+{
+   return true;
+}
+
+
+bool ConsolePlotReceiver::RefreshGlPlot(const std::string &plotName)
+{
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool DeleteGlPlot(const std::string &plotName)
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::DeleteGlPlot(const std::string &plotName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   plots.erase(plotName);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetGlEndOfRun(const std::string &plotName)
+//------------------------------------------------------------------------------
+/**
+ * Queues the final image of an orbit plot
+ */
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::SetGlEndOfRun(const std::string &plotName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i != plots.end())
+      QueueImage(plotName, i->second, false);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool UpdateGlPlot(const std::string &plotName, const std::string &oldName,
+//       const StringArray &scNames, const Real &time, const RealArray &posX,
+//       const RealArray &posY, const RealArray &posZ, const RealArray &velX,
+//       const RealArray &velY, const RealArray &velZ,
+//       const ColorMap &orbitColorMap, const ColorMap &targetColorMap,
+//       bool solving, Integer solverOption, bool updateCanvas, bool drawing,
+//       bool inFunction)
+//------------------------------------------------------------------------------
+/**
+ * Buffers the spacecraft positions of an orbit or ground track plot
+ *
+ * Solver iterations are not drawn.  Ground tracks are stored as longitude and
+ * latitude, with a new segment where the track wraps in longitude.
+ */
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::UpdateGlPlot(const std::string &plotName,
+      const std::string &oldName, const StringArray &scNames, const Real &time,
+      const RealArray &posX, const RealArray &posY, const RealArray &posZ,
+      const RealArray &velX, const RealArray &velY, const RealArray &velZ,
+      const ColorMap &orbitColorMap, const ColorMap &targetColorMap,
+      bool solving, Integer solverOption, bool updateCanvas, bool drawing,
+      bool inFunction)
+{
+   if (solving || !drawing)
+      return true;
+
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator p = plots.find(plotName);
+   if (p == plots.end())
+      return false;
+   PlotData &plot = p->second;
+
+   for (UnsignedInt sc = 0; sc < scNames.size(); ++sc)
+   {
+      if ((sc >= posX.size()) || (sc >= posY.size()) || (sc >= posZ.size()))
+         break;
+
+      UnsignedInt c = 0;
+      while ((c < plot.curves.size()) && (plot.curves[c].title != scNames[sc]))
+         ++c;
+      if (c == plot.curves.size())
+      {
+         plot.curves.push_back(CurveData());
+         plot.curves[c].title = scNames[sc];
+         plot.curves[c].color = 0xFF0000;
+      }
+      CurveData &curve = plot.curves[c];
+
+      ColorMap::const_iterator color = orbitColorMap.find(scNames[sc]);
+      if (color != orbitColorMap.end())
+         curve.color = color->second;
+
+      if (plot.isOrbit)
+      {
+         curve.x.push_back(posX[sc]);
+         curve.y.push_back(posY[sc]);
+      }
+      else
+      {
+         Real r = GmatMathUtil::Sqrt(posX[sc] * posX[sc] +
+               posY[sc] * posY[sc] + posZ[sc] * posZ[sc]);
+         if (r == 0.0)
+            continue;
+         Real lon = GmatMathUtil::ATan(posY[sc], posX[sc]) *
+               GmatMathConstants::DEG_PER_RAD;
+         Real lat = GmatMathUtil::ASin(posZ[sc] / r) *
+               GmatMathConstants::DEG_PER_RAD;
+         if (!curve.x.empty() &&
+             (GmatMathUtil::Abs(lon - curve.x.back()) > 180.0))
+            curve.breaks.push_back((Integer)curve.x.size());
+         curve.x.push_back(lon);
+         curve.y.push_back(lat);
+      }
+   }
+
+   ++plot.updateCount;
+   if ((frameInterval > 0) && (plot.updateCount % frameInterval == 0))
+      QueueImage(plotName, plot, true);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool TakeGlAction(const std::string &plotName, const std::string &action)
+//------------------------------------------------------------------------------
+/**
+ * Clears the buffered orbits on a "ClearOrbit" action; other actions only
+ * affect the display
+ */
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::TakeGlAction(const std::string &plotName,
+      const std::string &action)
+{
+   if (action == "ClearOrbit")
+   {
+      std::lock_guard<std::mutex> lock(dataMutex);
+      std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+      if (i != plots.end())
+         i->second.curves.clear();
+   }
+   return true;
+}
+
+
+void ConsolePlotReceiver::SetMaxGlDataPoints(const std::string &plotName,
+      Integer maxDataPoints)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// XY plot methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// bool CreateXyPlotWindow(const std::string &plotName,
+//       const std::string &oldName, Real positionX, Real positionY,
+//       Real width, Real height, bool isMaximized,
+//       const std::string &plotTitle, const std::string &xAxisTitle,
+//       const std::string &yAxisTitle, bool drawGrid, bool canSaveLocation)
+//------------------------------------------------------------------------------
+/**
+ * Starts a new buffer for an XY plot; the window settings are not used
+ */
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::CreateXyPlotWindow(const std::string &plotName,
+      const std::string &oldName, Real positionX, Real positionY,
+      Real width, Real height, bool isMaximized,
+      const std::string &plotTitle, const std::string &xAxisTitle,
+      const std::string &yAxisTitle, bool drawGrid, bool canSaveLocation)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+
+   if ((oldName != plotName) && (plots.find(oldName) != plots.end()))
+      plots.erase(oldName);
+
+   PlotData &plot = plots[plotName];
+   plot.title = plotTitle;
+   plot.xTitle = xAxisTitle;
+   plot.yTitle = yAxisTitle;
+   plot.isOrbit = false;
+   plot.drawGrid = drawGrid;
+   plot.active = true;
+   plot.penDown = true;
+   plot.updateCount = 0;
+   plot.frameCount = 0;
+   plot.curves.clear();
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool DeleteXyPlot(const std::string &plotName)
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::DeleteXyPlot(const std::string &plotName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   plots.erase(plotName);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool AddXyPlotCurve(const std::string &plotName, int curveIndex,
+//       const std::string &curveTitle, UnsignedInt penColor)
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::AddXyPlotCurve(const std::string &plotName,
+      int curveIndex, const std::string &curveTitle, UnsignedInt penColor)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if ((i == plots.end()) || (curveIndex < 0))
+      return false;
+
+   if ((int)i->second.curves.size() <= curveIndex)
+      i->second.curves.resize(curveIndex + 1);
+   i->second.curves[curveIndex].title = curveTitle;
+   i->second.curves[curveIndex].color = penColor;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool DeleteAllXyPlotCurves(const std::string &plotName,
+//       const std::string &oldName)
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::DeleteAllXyPlotCurves(const std::string &plotName,
+      const std::string &oldName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i != plots.end())
+      i->second.curves.clear();
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool DeleteXyPlotCurve(const std::string &plotName, int curveIndex)
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::DeleteXyPlotCurve(const std::string &plotName,
+      int curveIndex)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if ((i == plots.end()) || (curveIndex < 0) ||
+       (curveIndex >= (int)i->second.curves.size()))
+      return false;
+
+   i->second.curves.erase(i->second.curves.begin() + curveIndex);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearXyPlotData(const std::string &plotName)
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::ClearXyPlotData(const std::string &plotName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i == plots.end())
+      return;
+
+   for (UnsignedInt c = 0; c < i->second.curves.size(); ++c)
+   {
+      CurveData &curve = i->second.curves[c];
+      curve.x.clear();
+      curve.y.clear();
+      curve.breaks.clear();
+      curve.marks.clear();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void XyPlotPenUp(const std::string &plotName)
+//------------------------------------------------------------------------------
+/**
+ * Stops buffering data; the next point received starts a new segment
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::XyPlotPenUp(const std::string &plotName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i == plots.end())
+      return;
+
+   i->second.penDown = false;
+   for (UnsignedInt c = 0; c < i->second.curves.size(); ++c)
+   {
+      CurveData &curve = i->second.curves[c];
+      Integer next = (Integer)curve.x.size();
+      if (curve.breaks.empty() || (curve.breaks.back() != next))
+         curve.breaks.push_back(next);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void XyPlotPenDown(const std::string &plotName)
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::XyPlotPenDown(const std::string &plotName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i != plots.end())
+      i->second.penDown = true;
+}
+
+
+void ConsolePlotReceiver::XyPlotDarken(const std::string &plotName,
+      Integer factor, Integer index, Integer forCurve)
+{
+}
+
+
+void ConsolePlotReceiver::XyPlotLighten(const std::string &plotName,
+      Integer factor, Integer index, Integer forCurve)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void XyPlotMarkPoint(const std::string &plotName, Integer index,
+//       Integer forCurve)
+//------------------------------------------------------------------------------
+/**
+ * Marks a point, by default the last one received, on one or all curves
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::XyPlotMarkPoint(const std::string &plotName,
+      Integer index, Integer forCurve)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i == plots.end())
+      return;
+
+   for (UnsignedInt c = 0; c < i->second.curves.size(); ++c)
+   {
+      if ((forCurve >= 0) && (forCurve != (Integer)c))
+         continue;
+      CurveData &curve = i->second.curves[c];
+      curve.marks.push_back(index == -1 ? (Integer)curve.x.size() - 1 : index);
+   }
+}
+
+
+void ConsolePlotReceiver::XyPlotMarkBreak(const std::string &plotName,
+      Integer index, Integer curveNumber)
+{
+}
+
+
+void ConsolePlotReceiver::XyPlotClearFromBreak(const std::string &plotName,
+      Integer breakNumber, Integer index, Integer curveNumber)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void XyPlotChangeColor(const std::string &plotName, Integer index,
+//       UnsignedInt newColor, Integer forCurve)
+//------------------------------------------------------------------------------
+/**
+ * Changes the color of one or all curves; the image uses one color per curve
+ */
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::XyPlotChangeColor(const std::string &plotName,
+      Integer index, UnsignedInt newColor, Integer forCurve)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i == plots.end())
+      return;
+
+   for (UnsignedInt c = 0; c < i->second.curves.size(); ++c)
+      if ((forCurve < 0) || (forCurve == (Integer)c))
+         i->second.curves[c].color = newColor;
+}
+
+
+void ConsolePlotReceiver::XyPlotChangeMarker(const std::string &plotName,
+      Integer index, Integer newMarker, int forCurve)
+{
+}
+
+
+void ConsolePlotReceiver::XyPlotChangeWidth(const std::string &plotName,
+      Integer index, Integer newWidth, int forCurve)
+{
+}
+
+
+void ConsolePlotReceiver::XyPlotChangeStyle(const std::string &plotName,
+      Integer index, Integer newStyle, int forCurve)
+{
+}
+
+
+void ConsolePlotReceiver::XyPlotRescale(const std::string &plotName)
+{
+}
+
+
+void ConsolePlotReceiver::XyPlotCurveSettings(const std::string &plotName,
+      bool useLines, Integer lineWidth, Integer lineStyle, bool useMarkers,
+      Integer markerSize, Integer marker, bool useHiLow, Integer forCurve)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void SetXyPlotTitle(const std::string &plotName,
+//       const std::string &plotTitle)
+//------------------------------------------------------------------------------
+void ConsolePlotReceiver::SetXyPlotTitle(const std::string &plotName,
+      const std::string &plotTitle)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i != plots.end())
+      i->second.title = plotTitle;
+}
+
+
+void ConsolePlotReceiver::ShowXyPlotLegend(const std::string &plotName)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// bool RefreshXyPlot(const std::string &plotName)
+//------------------------------------------------------------------------------
+/**
+ * Queues the final image of an XY plot; XYPlot calls this at the end of its
+ * data
+ */
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::RefreshXyPlot(const std::string &plotName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if ((i == plots.end()) || !i->second.active)
+      return false;
+
+   QueueImage(plotName, i->second, false);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool UpdateXyPlot(const std::string &plotName, const std::string &oldName,
+//       const Real &xval, const Rvector &yvals, const std::string &plotTitle,
+//       const std::string &xAxisTitle, const std::string &yAxisTitle,
+//       bool updateCanvas, bool drawGrid)
+//------------------------------------------------------------------------------
+/**
+ * Buffers one point on each curve of an XY plot
+ */
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::UpdateXyPlot(const std::string &plotName,
+      const std::string &oldName, const Real &xval, const Rvector &yvals,
+      const std::string &plotTitle, const std::string &xAxisTitle,
+      const std::string &yAxisTitle, bool updateCanvas, bool drawGrid)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i == plots.end())
+      return false;
+   PlotData &plot = i->second;
+   if (!plot.active || !plot.penDown)
+      return true;
+
+   Integer count = yvals.GetSize();
+   if (count > (Integer)plot.curves.size())
+      count = (Integer)plot.curves.size();
+   for (Integer c = 0; c < count; ++c)
+   {
+      plot.curves[c].x.push_back(xval);
+      plot.curves[c].y.push_back(yvals[c]);
+   }
+
+   ++plot.updateCount;
+   if ((frameInterval > 0) && (plot.updateCount % frameInterval == 0))
+      QueueImage(plotName, plot, true);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool UpdateXyPlotData(const std::string &plotName, const Real &xval,
+//       const Rvector &yvals, const Rvector *yhis, const Rvector *ylows)
+//------------------------------------------------------------------------------
+/**
+ * Buffers one point on each curve of an owned plot; error bars are not drawn
+ */
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::UpdateXyPlotData(const std::string &plotName,
+      const Real &xval, const Rvector &yvals, const Rvector *yhis,
+      const Rvector *ylows)
+{
+   return UpdateXyPlot(plotName, "", xval, yvals, "", "", "", false, false);
+}
+
+
+//------------------------------------------------------------------------------
+// bool UpdateXyPlotCurve(const std::string &plotName,
+//       const Integer whichCurve, const Real xval, const Real yval,
+//       const Real yhi, const Real ylow)
+//------------------------------------------------------------------------------
+/**
+ * Buffers one point on one curve; error bars are not drawn
+ */
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::UpdateXyPlotCurve(const std::string &plotName,
+      const Integer whichCurve, const Real xval, const Real yval,
+      const Real yhi, const Real ylow)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if ((i == plots.end()) || (whichCurve < 0) ||
+       (whichCurve >= (Integer)i->second.curves.size()))
+      return false;
+   if (!i->second.active || !i->second.penDown)
+      return true;
+
+   i->second.curves[whichCurve].x.push_back(xval);
+   i->second.curves[whichCurve].y.push_back(yval);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool DeactivateXyPlot(const std::string &plotName)
+//------------------------------------------------------------------------------
+/**
+ * Stops buffering data for a plot, and queues its image
+ */
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::DeactivateXyPlot(const std::string &plotName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i == plots.end())
+      return false;
+
+   if (i->second.active)
+      QueueImage(plotName, i->second, false);
+   i->second.active = false;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool ActivateXyPlot(const std::string &plotName)
+//------------------------------------------------------------------------------
+bool ConsolePlotReceiver::ActivateXyPlot(const std::string &plotName)
+{
+   std::lock_guard<std::mutex> lock(dataMutex);
+   std::map<std::string, PlotData>::iterator i = plots.find(plotName);
+   if (i == plots.end())
+      return false;
+
+   i->second.active = true;
+   return true;
+}
+
+
+bool ConsolePlotReceiver::TakeXYAction(const std::string &plotName,
+      const std::string &action)
+{
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Dynamic data display methods; the tables are not written by the Console
+//------------------------------------------------------------------------------
+
+bool ConsolePlotReceiver::CreateDynamicDataDisplay(const std::string &plotName,
+      const std::string &oldName, const std::string &plotTitle,
+      Real positionX, Real positionY, Real width, Real height)
+{
+   return false;
+}
+
+
+bool ConsolePlotReceiver::SetDynamicDataTableSize(const std::string &plotName,
+      Integer maxRowCount, Integer maxColCount)
+{
+   return false;
+}
+
+
+bool ConsolePlotReceiver::UpdateDynamicDataDisplay(const std::string &plotName,
+      std::vector<std::vector<DDD>> newData)
+{
+   return false;
+}
+
+
+bool ConsolePlotReceiver::DeleteDynamicData(const std::string &plotName,
+      const std::string &oldName)
+{
+   return false;
+}
+
+
+bool ConsolePlotReceiver::SetDynamicDataTextColor(const std::string &plotName,
+      std::vector<std::vector<DDD>> newData)
+{
+   return false;
+}
@@ -0,0 +1,393 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  PlotRaster
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the software plot raster.
+ */
+//------------------------------------------------------------------------------
+
+#include "PlotRaster.hpp"
+#include <cstdlib>
+#include <fstream>
+
+
+namespace
+{
+   /// Lookup table for the CRC-32 used by PNG chunks
+   struct CrcTable
+   {
+      UnsignedInt entry[256];
+
+      CrcTable()
+      {
+         for (UnsignedInt n = 0; n < 256; ++n)
+         {
+            UnsignedInt c = n;
+            for (Integer k = 0; k < 8; ++k)
+               c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            entry[n] = c;
+         }
+      }
+   };
+
+   //---------------------------------------------------------------------------
+   // UnsignedInt Crc32(const unsigned char *data, size_t size, UnsignedInt crc)
+   //---------------------------------------------------------------------------
+   /**
+    * Continues the CRC-32 used by PNG chunks
+    */
+   //---------------------------------------------------------------------------
+   UnsignedInt Crc32(const unsigned char *data, size_t size,
+         UnsignedInt crc = 0xFFFFFFFF)
+   {
+      // Built once, on first use, from any thread
+      static const CrcTable table;
+
+      for (size_t i = 0; i < size; ++i)
+         crc = table.entry[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+      return crc;
+   }
+
+   //---------------------------------------------------------------------------
+   // void PutInt(std::vector<unsigned char> &buffer, UnsignedInt value)
+   //---------------------------------------------------------------------------
+   /**
+    * Appends a big endian 32 bit value
+    */
+   //---------------------------------------------------------------------------
+   void PutInt(std::vector<unsigned char> &buffer, UnsignedInt value)
+   {
+      buffer.push_back((value >> 24) & 0xFF);
+      buffer.push_back((value >> 16) & 0xFF);
+      buffer.push_back((value >> 8) & 0xFF);
+      buffer.push_back(value & 0xFF);
+   }
+
+   //---------------------------------------------------------------------------
+   // void WriteChunk(std::ofstream &out, const char *type,
+   //       const std::vector<unsigned char> &data)
+   //---------------------------------------------------------------------------
+   /**
+    * Writes a PNG chunk: length, type, data and CRC
+    */
+   //---------------------------------------------------------------------------
+   void WriteChunk(std::ofstream &out, const char *type,
+         const std::vector<unsigned char> &data)
+   {
+      std::vector<unsigned char> header;
+      PutInt(header, (UnsignedInt)data.size());
+      header.insert(header.end(), type, type + 4);
+      out.write((const char*)&header[0], header.size());
+      if (!data.empty())
+         out.write((const char*)&data[0], data.size());
+
+      UnsignedInt crc = Crc32(&header[4], 4);
+      if (!data.empty())
+         crc = Crc32(&data[0], data.size(), crc);
+      std::vector<unsigned char> trailer;
+      PutInt(trailer, crc ^ 0xFFFFFFFF);
+      out.write((const char*)&trailer[0], trailer.size());
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// PlotRaster(Integer w, Integer h, UnsignedInt background)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param w          Width, in pixels
+ * @param h          Height, in pixels
+ * @param background Initial color of every pixel
+ */
+//------------------------------------------------------------------------------
+PlotRaster::PlotRaster(Integer w, Integer h, UnsignedInt background) :
+   width    (w > 0 ? w : 1),
+   height   (h > 0 ? h : 1),
+   pixels   (width * height * 3)
+{
+   Clear(background);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetWidth() const
+//------------------------------------------------------------------------------
+Integer PlotRaster::GetWidth() const
+{
+   return width;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetHeight() const
+//------------------------------------------------------------------------------
+Integer PlotRaster::GetHeight() const
+{
+   return height;
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear(UnsignedInt color)
+//------------------------------------------------------------------------------
+/**
+ * Sets every pixel to a color
+ *
+ * @param color The color, as 0xRRGGBB
+ */
+//------------------------------------------------------------------------------
+void PlotRaster::Clear(UnsignedInt color)
+{
+   for (size_t i = 0; i < pixels.size(); i += 3)
+   {
+      pixels[i]   = (color >> 16) & 0xFF;
+      pixels[i+1] = (color >> 8) & 0xFF;
+      pixels[i+2] = color & 0xFF;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SetPixel(Integer x, Integer y, UnsignedInt color)
+//------------------------------------------------------------------------------
+/**
+ * Sets a pixel; points off the raster are ignored
+ *
+ * @param x     Column, from the left
+ * @param y     Row, from the top
+ * @param color The color, as 0xRRGGBB
+ */
+//------------------------------------------------------------------------------
+void PlotRaster::SetPixel(Integer x, Integer y, UnsignedInt color)
+{
+   if ((x < 0) || (y < 0) || (x >= width) || (y >= height))
+      return;
+
+   size_t i = ((size_t)y * width + x) * 3;
+   pixels[i]   = (color >> 16) & 0xFF;
+   pixels[i+1] = (color >> 8) & 0xFF;
+   pixels[i+2] = color & 0xFF;
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetPixel(Integer x, Integer y) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the color of a pixel
+ *
+ * @param x Column, from the left
+ * @param y Row, from the top
+ *
+ * @return The color as 0xRRGGBB, or 0 for points off the raster
+ */
+//------------------------------------------------------------------------------
+UnsignedInt PlotRaster::GetPixel(Integer x, Integer y) const
+{
+   if ((x < 0) || (y < 0) || (x >= width) || (y >= height))
+      return 0;
+
+   size_t i = ((size_t)y * width + x) * 3;
+   return (pixels[i] << 16) | (pixels[i+1] << 8) | pixels[i+2];
+}
+
+
+//------------------------------------------------------------------------------
+// void DrawLine(Integer x0, Integer y0, Integer x1, Integer y1,
+//       UnsignedInt color)
+//------------------------------------------------------------------------------
+/**
+ * Draws a one pixel wide line with Bresenham's algorithm
+ *
+ * Lines are clipped pixel by pixel, after a check that skips lines that lie
+ * entirely off one side of the raster.
+ *
+ * @param x0    Starting column
+ * @param y0    Starting row
+ * @param x1    Ending column
+ * @param y1    Ending row
+ * @param color The color, as 0xRRGGBB
+ */
+//------------------------------------------------------------------------------
+void PlotRaster::DrawLine(Integer x0, Integer y0, Integer x1, Integer y1,
+      UnsignedInt color)
+{
+   if (((x0 < 0) && (x1 < 0)) || ((y0 < 0) && (y1 < 0)) ||
+       ((x0 >= width) && (x1 >= width)) || ((y0 >= height) && (y1 >= height)))
+      return;
+
+   Integer dx = std::abs(x1 - x0), sx = (x0 < x1 ? 1 : -1);
+   Integer dy = -std::abs(y1 - y0), sy = (y0 < y1 ? 1 : -1);
+   Integer err = dx + dy;
+
+   while (true)
+   {
+      SetPixel(x0, y0, color);
+      if ((x0 == x1) && (y0 == y1))
+         break;
+      Integer e2 = 2 * err;
+      if (e2 >= dy)
+      {
+         err += dy;
+         x0 += sx;
+      }
+      if (e2 <= dx)
+      {
+         err += dx;
+         y0 += sy;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void DrawRectangle(Integer x0, Integer y0, Integer x1, Integer y1,
+//       UnsignedInt color)
+//------------------------------------------------------------------------------
+/**
+ * Draws the outline of a rectangle
+ *
+ * @param x0    Left column
+ * @param y0    Top row
+ * @param x1    Right column
+ * @param y1    Bottom row
+ * @param color The color, as 0xRRGGBB
+ */
+//------------------------------------------------------------------------------
+void PlotRaster::DrawRectangle(Integer x0, Integer y0, Integer x1, Integer y1,
+      UnsignedInt color)
+{
+   DrawLine(x0, y0, x1, y0, color);
+   DrawLine(x1, y0, x1, y1, color);
+   DrawLine(x1, y1, x0, y1, color);
+   DrawLine(x0, y1, x0, y0, color);
+}
+
+
+//------------------------------------------------------------------------------
+// void DrawMarker(Integer x, Integer y, Integer size, UnsignedInt color)
+//------------------------------------------------------------------------------
+/**
+ * Draws a filled square marker centered on a point
+ *
+ * @param x     Center column
+ * @param y     Center row
+ * @param size  Half width of the marker, in pixels
+ * @param color The color, as 0xRRGGBB
+ */
+//------------------------------------------------------------------------------
+void PlotRaster::DrawMarker(Integer x, Integer y, Integer size,
+      UnsignedInt color)
+{
+   for (Integer j = y - size; j <= y + size; ++j)
+      for (Integer i = x - size; i <= x + size; ++i)
+         SetPixel(i, j, color);
+}
+
+
+//------------------------------------------------------------------------------
+// bool WritePng(const std::string &fileName, const std::string &title) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the raster as an 8 bit RGB PNG file
+ *
+ * @param fileName The file to write
+ * @param title    Text stored in the file's Title field, if not empty
+ *
+ * @return true if the file was written
+ */
+//------------------------------------------------------------------------------
+bool PlotRaster::WritePng(const std::string &fileName,
+      const std::string &title) const
+{
+   std::ofstream out(fileName.c_str(), std::ios::out | std::ios::binary);
+   if (!out)
+      return false;
+
+   const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+   out.write((const char*)signature, 8);
+
+   std::vector<unsigned char> chunk;
+   PutInt(chunk, width);
+   PutInt(chunk, height);
+   chunk.push_back(8);     // Bit depth
+   chunk.push_back(2);     // Truecolor
+   chunk.push_back(0);     // Deflate
+   chunk.push_back(0);     // Adaptive filtering
+   chunk.push_back(0);     // No interlace
+   WriteChunk(out, "IHDR", chunk);
+
+   if (title != "")
+   {
+      chunk.clear();
+      const char *key = "Title";
+      chunk.insert(chunk.end(), key, key + 6);
+      chunk.insert(chunk.end(), title.begin(), title.end());
+      WriteChunk(out, "tEXt", chunk);
+   }
+
+   // Filter type 0 on each row, followed by the row's pixels
+   std::vector<unsigned char> raw;
+   size_t rowSize = (size_t)width * 3;
+   raw.reserve((rowSize + 1) * height);
+   for (Integer y = 0; y < height; ++y)
+   {
+      raw.push_back(0);
+      raw.insert(raw.end(), pixels.begin() + y * rowSize,
+            pixels.begin() + (y + 1) * rowSize);
+   }
+
+   // zlib stream of stored deflate blocks, at most 65535 bytes each
+   chunk.clear();
+   chunk.reserve(raw.size() + raw.size() / 65535 * 5 + 11);
+   chunk.push_back(0x78);
+   chunk.push_back(0x01);
+   size_t pos = 0;
+   do
+   {
+      size_t blockSize = raw.size() - pos;
+      if (blockSize > 65535)
+         blockSize = 65535;
+      chunk.push_back(pos + blockSize == raw.size() ? 1 : 0);
+      chunk.push_back(blockSize & 0xFF);
+      chunk.push_back((blockSize >> 8) & 0xFF);
+      chunk.push_back(~blockSize & 0xFF);
+      chunk.push_back((~blockSize >> 8) & 0xFF);
+      chunk.insert(chunk.end(), raw.begin() + pos, raw.begin() + pos + blockSize);
+      pos += blockSize;
+   } while (pos < raw.size());
+
+   // Adler-32 of the uncompressed data
+   UnsignedInt a = 1, b = 0;
+   for (size_t i = 0; i < raw.size(); ++i)
+   {
+      a = (a + raw[i]) % 65521;
+      b = (b + a) % 65521;
+   }
+   PutInt(chunk, (b << 16) | a);
+   WriteChunk(out, "IDAT", chunk);
+
+   chunk.clear();
+   WriteChunk(out, "IEND", chunk);
+
+   return out.good();
+}
@@ -0,0 +1,66 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  PlotRaster
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Software raster used to draw plots without a display.
+ *
+ * The raster holds 24 bit RGB pixels, draws clipped lines and markers in
+ * GMAT integer colors, and writes itself as a PNG file.  The PNG data is
+ * stored in uncompressed deflate blocks, so no image or compression library
+ * is needed.
+ */
+//------------------------------------------------------------------------------
+#ifndef PlotRaster_hpp
+#define PlotRaster_hpp
+
+#include "gmatdefs.hpp"
+#include <vector>
+
+class PlotRaster
+{
+public:
+   PlotRaster(Integer w, Integer h, UnsignedInt background = 0xFFFFFF);
+
+   Integer     GetWidth() const;
+   Integer     GetHeight() const;
+
+   void        Clear(UnsignedInt color);
+   void        SetPixel(Integer x, Integer y, UnsignedInt color);
+   UnsignedInt GetPixel(Integer x, Integer y) const;
+   void        DrawLine(Integer x0, Integer y0, Integer x1, Integer y1,
+                        UnsignedInt color);
+   void        DrawRectangle(Integer x0, Integer y0, Integer x1, Integer y1,
+                             UnsignedInt color);
+   void        DrawMarker(Integer x, Integer y, Integer size,
+                          UnsignedInt color);
+
+   bool        WritePng(const std::string &fileName,
+                        const std::string &title = "") const;
+
+protected:
+   /// Width of the raster, in pixels
+   Integer                    width;
+   /// Height of the raster, in pixels
+   Integer                    height;
+   /// Pixel data, 3 bytes per pixel in row order from the top left
+   std::vector<unsigned char> pixels;
+};
+
+#endif // PlotRaster_hpp
@@ -44,6 +44,11 @@
 #include "CommandFactory.hpp"
 #include "PointMassForce.hpp"
 #include "PrintUtility.hpp"
+#include "BatchCaseRunner.hpp"
+#include "ConsolePlotReceiver.hpp"
+#include "PlotInterface.hpp"
+#include "Profiler.hpp"
+#include "MemoryTracker.hpp"
 
 //#define DEBUG_CONSOLE
 //#define DEBUG_CONSOLE_STARTUP
@@ -55,6 +60,10 @@
 static Moderator   *mod          = NULL;
 static GmatGlobal  *gmatGlobal   = NULL;
 static std::string lastRunScript = "";
+static Integer     caseWorkers   = 1;
+static Integer     casePort      = 0;
+static bool        useCaseSeed   = false;
+static Integer     caseSeed      = 0;
 
 //------------------------------------------------------------------------------
 //  void ShowHelp()
@@ -77,6 +86,11 @@ void ShowHelp()
              << "   --version, -v                 Show version and build information\n"
              << "   --batch, -b <filename>        Runs multiple scripts listed in specified file\n"
              << "   --run, -r <filename>          Runs the input script once, then exits\n"
+             << "   --cases <script> <casefile>   Runs the script once per row of the case file\n"
+             << "   --workers <n>                 Number of --cases runs made at the same time (default is 1)\n"
+             << "   --seed <n>                    Seeds the random numbers of each case from n and the case number (set before --cases)\n"
+             << "   --serve <port>                Makes --cases hand its cases to --connect workers on other hosts\n"
+             << "   --connect <host:port> <script> Runs cases served by --serve, up to --workers at a time\n"
              << "   --logfile, -l <filename>      Specify the log file (ignored in Console interactive mode)\n"
              << "   --startup_file, -s <filename> Specify the startup file (ignored in Console interactive mode)\n"
              << "   --minimize, -m                Opens with GUI minimized (ignored for Console)\n"
@@ -84,6 +98,10 @@ void ShowHelp()
              << "   --save                        Saves current script (interactive mode only)\n"
              << "   --summary                     Writes command summary (interactive mode only)\n"
              << "   --verbose <on/off>            Dump info messages to screen during run (default is on)\n"
+             << "   --plots <directory>           Writes XYPlot and OrbitView images to the directory (set before --run)\n"
+             << "   --plot_frames <n>             Also writes a plot image every n plot updates (default is 0, end of run only)\n"
+             << "   --profile <file>              Times commands, steps, forces, measurements and solvers and writes a profile report (set before --run)\n"
+             << "   --memory_telemetry            Counts allocations by subsystem and command and reports them after the run (set before --run)\n"
              << "   --exit, -x                    Exit after run (default)\n"
              << std::endl << std::endl;
 }
@@ -216,6 +234,8 @@ Integer RunBatch(std::string& batchfilename)
       return 0;
    }
    
+   // Scripts listed more than once are interpreted only once while unchanged
+   mod->SetReuseUnchangedScript(true);
    batchfile >> script;
 
    while (!batchfile.eof())
@@ -248,6 +268,7 @@ Integer RunBatch(std::string& batchfilename)
                          
                ++failed;
                failedScripts.push_back(script);
+               mod->SetReuseUnchangedScript(true);
             }
             catch (...)
             {
@@ -260,6 +281,7 @@ Integer RunBatch(std::string& batchfilename)
                          
                ++failed;
                failedScripts.push_back(script);
+               mod->SetReuseUnchangedScript(true);
             }
          }
          else {
@@ -273,6 +295,7 @@ Integer RunBatch(std::string& batchfilename)
       }
       batchfile >> script;
    }
+   mod->SetReuseUnchangedScript(false);
    
    std::cout << "\n\n**************************************\n*** "
              << "Batch Run Statistics:"
@@ -301,6 +324,58 @@ Integer RunBatch(std::string& batchfilename)
 }
 
 
+//------------------------------------------------------------------------------
+// Integer RunCases(const std::string &script, const std::string &casefile)
+//------------------------------------------------------------------------------
+/**
+ * Runs a script once for each row of parameter overrides in a case file.
+ *
+ * The script is parsed once; up to caseWorkers cases run at the same time.
+ * When casePort is set, the cases are served to remote workers instead.
+ *
+ * @param <script> The script file that is run.
+ * @param <casefile> The file containing the case table.
+ *
+ * @return The number of cases that failed.
+ */
+//------------------------------------------------------------------------------
+Integer RunCases(const std::string &script, const std::string &casefile)
+{
+   std::cout << "Running case file \"" << casefile << "\"" << std::endl;
+
+   BatchCaseRunner runner(mod);
+   runner.LoadCases(casefile);
+   if (useCaseSeed)
+      runner.SetCaseSeed((unsigned int)caseSeed);
+   if (casePort > 0)
+      return runner.Serve(casePort);
+   return runner.Run(script, caseWorkers);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer RunCaseWorker(const std::string &script, const std::string &server)
+//------------------------------------------------------------------------------
+/**
+ * Runs cases handed out by a case server started with --serve.
+ *
+ * @param <script> The script file that is run.
+ * @param <server> The case server, as host:port.
+ *
+ * @return The number of cases run here that failed.
+ */
+//------------------------------------------------------------------------------
+Integer RunCaseWorker(const std::string &script, const std::string &server)
+{
+   std::cout << "Connecting to case server " << server << std::endl;
+
+   BatchCaseRunner runner(mod);
+   if (useCaseSeed)
+      runner.SetCaseSeed((unsigned int)caseSeed);
+   return runner.RunWorker(script, server, caseWorkers);
+}
+
+
 //------------------------------------------------------------------------------
 // void SaveScript(std::string filename)
 //------------------------------------------------------------------------------
@@ -871,6 +946,149 @@ int main(int argc, char *argv[])
                      RunBatch(batchToRun);
                   }
                }
+               else if (arg == "--workers")
+               {
+                  Integer workers;
+                  if (argc < i + 2)
+                  {
+                     MessageInterface::ShowMessage("*** Missing worker count\n");
+                  }
+                  else if (GmatStringUtil::ToInteger(argv[i+1], workers) &&
+                           (workers > 0))
+                  {
+                     caseWorkers = workers;
+                     ++i;
+                  }
+                  else
+                  {
+                     MessageInterface::ShowMessage("Invalid option for --workers: %s\n", argv[i+1]);
+                     ++i;
+                  }
+               }
+               else if (arg == "--seed")
+               {
+                  Integer seed;
+                  if (argc < i + 2)
+                  {
+                     MessageInterface::ShowMessage("*** Missing case seed\n");
+                  }
+                  else if (GmatStringUtil::ToInteger(argv[i+1], seed) &&
+                           (seed >= 0))
+                  {
+                     useCaseSeed = true;
+                     caseSeed = seed;
+                     ++i;
+                  }
+                  else
+                  {
+                     MessageInterface::ShowMessage("Invalid option for --seed: %s\n", argv[i+1]);
+                     ++i;
+                  }
+               }
+               else if (arg == "--serve")
+               {
+                  Integer port;
+                  if (argc < i + 2)
+                  {
+                     MessageInterface::ShowMessage("*** Missing case server port\n");
+                  }
+                  else if (GmatStringUtil::ToInteger(argv[i+1], port) &&
+                           (port > 0) && (port < 65536))
+                  {
+                     casePort = port;
+                     ++i;
+                  }
+                  else
+                  {
+                     MessageInterface::ShowMessage("Invalid option for --serve: %s\n", argv[i+1]);
+                     ++i;
+                  }
+               }
+               else if (arg == "--connect")
+               {
+                  if (argc < i + 3)
+                  {
+                     MessageInterface::ShowMessage("*** Missing case server or script name\n");
+                  }
+                  else
+                  {
+                     std::string server      = argv[i+1];
+                     std::string scriptToRun = argv[i+2];
+                     // Replace single quotes
+                     scriptToRun = GmatStringUtil::Replace(scriptToRun, "'", "");
+                     i += 2;
+                     if (RunCaseWorker(scriptToRun, server) > 0)
+                        throw ConsoleAppException("One or more cases failed");
+                  }
+               }
+               else if (arg == "--plots")
+               {
+                  if (argc < i + 2)
+                  {
+                     MessageInterface::ShowMessage("*** Missing plot directory\n");
+                  }
+                  else
+                  {
+                     ConsolePlotReceiver *plots = ConsolePlotReceiver::Instance();
+                     plots->SetOutputPath(GmatStringUtil::Replace(argv[i+1], "'", ""));
+                     PlotInterface::SetPlotReceiver(plots);
+                     ++i;
+                  }
+               }
+               else if (arg == "--plot_frames")
+               {
+                  Integer frames;
+                  if (argc < i + 2)
+                  {
+                     MessageInterface::ShowMessage("*** Missing plot frame interval\n");
+                  }
+                  else if (GmatStringUtil::ToInteger(argv[i+1], frames) &&
+                           (frames >= 0))
+                  {
+                     ConsolePlotReceiver::Instance()->SetFrameInterval(frames);
+                     ++i;
+                  }
+                  else
+                  {
+                     MessageInterface::ShowMessage("Invalid option for --plot_frames: %s\n", argv[i+1]);
+                     ++i;
+                  }
+               }
+               else if (arg == "--profile")
+               {
+                  if (argc < i + 2)
+                  {
+                     MessageInterface::ShowMessage("*** Missing profile report file\n");
+                  }
+                  else
+                  {
+                     Profiler::SetReportFile(GmatStringUtil::Replace(argv[i+1], "'", ""));
+                     Profiler::SetEnabled(true);
+                     ++i;
+                  }
+               }
+               else if (arg == "--memory_telemetry")
+               {
+                  MemoryTracker::SetCounting(true);
+               }
+               else if (arg == "--cases")
+               {
+                  if (argc < i + 3)
+                  {
+                     MessageInterface::ShowMessage("*** Missing script or case file name\n");
+                  }
+                  else
+                  {
+                     std::string scriptToRun = argv[i+1];
+                     std::string casesToRun  = argv[i+2];
+                     // Replace single quotes
+                     scriptToRun = GmatStringUtil::Replace(scriptToRun, "'", "");
+                     casesToRun  = GmatStringUtil::Replace(casesToRun, "'", "");
+                     i += 2;
+                     if (RunCases(scriptToRun, casesToRun) > 0)
+                        throw ConsoleAppException("One or more cases failed");
+                  }
+               }
                else if ((arg == "--exit") || (arg == "-x"))
                {
                   ; // ignored - console always exits at end of non-interactive run
@@ -893,6 +1111,8 @@ int main(int argc, char *argv[])
       exit(EXIT_FAILURE);
    }
    
+   // Finish writing plot images before the process exits
+   ConsolePlotReceiver::Instance()->Flush();
    Moderator::Instance()->Finalize();
    
    exit(EXIT_SUCCESS);
@@ -51,6 +51,7 @@ void ShowHelp();
 void RunScriptInterpreter(std::string script, int verbosity, 
                           bool batchmode = false);
 Integer RunBatch(std::string& batchfilename);
+Integer RunCases(const std::string &script, const std::string &casefile);
 void SaveScript(std::string filename = "");
 void ShowVersionInfo();
 void ShowCommandSummary(std::string filename = "");
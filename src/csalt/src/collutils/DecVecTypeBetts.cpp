@@ -173,6 +173,92 @@ IntegerArray DecVecTypeBetts::GetControlIdxsAtMeshPoint(Integer meshIdx,
 }
 
 
+//------------------------------------------------------------------------------
+// DecVecView GetStateViewAtMeshPoint(Integer meshIdx, Integer stageIdx)
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the state at the given mesh and stage points.
+ * The state at a point is contiguous in the Betts layout.
+ *
+ * @param <meshIdx>      mesh point
+ * @param <stageIdx>     stage point
+ *
+ * @return view of the state at the given mesh and stage point
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecView DecVecTypeBetts::GetStateViewAtMeshPoint(Integer meshIdx,
+                                                    Integer stageIdx)
+{
+   ValidateMeshStageIndeces(meshIdx,stageIdx);
+   Integer indStart = timeStopIdx +
+              (meshIdx) * (numStagePoints + 1) *
+              numStateAndControlVars +
+              (stageIdx) * numStateAndControlVars + 1;
+   return DecVecView(decisionVector.GetDataVector() + indStart, numStateVars);
+}
+
+//------------------------------------------------------------------------------
+// DecVecView GetControlViewAtMeshPoint(Integer meshIdx, Integer stageIdx)
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the control at the given mesh and stage
+ * points
+ *
+ * @param <meshIdx>      mesh point
+ * @param <stageIdx>     stage point
+ *
+ * @return view of the control at the given mesh and stage point
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecView DecVecTypeBetts::GetControlViewAtMeshPoint(Integer meshIdx,
+                                                      Integer stageIdx)
+{
+   ValidateMeshStageIndeces(meshIdx,stageIdx);
+   Integer indStart = timeStopIdx + (meshIdx) * (numStagePoints + 1) *
+              numStateAndControlVars + (stageIdx) * numStateAndControlVars +
+              numStateVars + 1;
+   return DecVecView(decisionVector.GetDataVector() + indStart,
+                     numControlVars);
+}
+
+//------------------------------------------------------------------------------
+// DecVecArrayView GetStateArrayView()
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the state array.  Consecutive discretization
+ * points are numStateAndControlVars apart, so the rows of GetStateArray map
+ * onto the decision vector with a fixed stride.
+ *
+ * @return view of the state array
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecArrayView DecVecTypeBetts::GetStateArrayView()
+{
+   return DecVecArrayView(decisionVector.GetDataVector() + timeStopIdx + 1,
+                          numStatePoints, numStateVars,
+                          numStateAndControlVars);
+}
+
+//------------------------------------------------------------------------------
+// DecVecArrayView GetControlArrayView()
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the control array
+ *
+ * @return view of the control array
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecArrayView DecVecTypeBetts::GetControlArrayView()
+{
+   return DecVecArrayView(decisionVector.GetDataVector() + timeStopIdx + 1 +
+                          numStateVars, numControlPoints, numControlVars,
+                          numStateAndControlVars);
+}
+
 //------------------------------------------------------------------------------
 // IntegerArray GetStaticIdxs()
 //------------------------------------------------------------------------------
@@ -58,6 +58,12 @@ public:
    virtual Rmatrix  GetStateArray();
    virtual void     SetControlArray(const Rmatrix &cArray);
    virtual void     SetStateArray(const Rmatrix &sArray);
+   virtual DecVecView GetStateViewAtMeshPoint(Integer meshIdx,
+                                              Integer stageIdx = 0);
+   virtual DecVecView GetControlViewAtMeshPoint(Integer meshIdx,
+                                                Integer stageIdx = 0);
+   virtual DecVecArrayView GetStateArrayView();
+   virtual DecVecArrayView GetControlArrayView();
    
    // These are here only for test drivers?
    virtual bool     SetStateVector(Integer meshIdx,Integer stageIdx,
@@ -624,29 +624,16 @@ Rvector DecisionVector::GetStateAtMeshPoint(Integer meshIdx, Integer stageIdx)
       throw LowThrustException(errmsg);
    }
    
-   // Compute indeces of state vector components then extract the
-   // state vector
-   IntegerArray idxs = GetStateIdxsAtMeshPoint(meshIdx, stageIdx);
+   // Extract the state vector through a view of its components
+   DecVecView stateView = GetStateViewAtMeshPoint(meshIdx, stageIdx);
    #ifdef DEBUG_DEC_VEC_STATE
-      MessageInterface::ShowMessage("In GetStateAtMeshPoint, idxs size = %d\n",
-                                    idxs.size());
+      MessageInterface::ShowMessage("In GetStateAtMeshPoint, view size = %d\n",
+                                    stateView.GetSize());
       MessageInterface::ShowMessage(
                         "In GetStateAtMeshPoint, decisionVector size = %d\n",
                         decisionVector.GetSize());
    #endif
-   Integer num = idxs.size();
-   Rvector theStateVector(num);
-   for (Integer ii = 0; ii < num; ii++)
-   {
-      #ifdef DEBUG_DEC_VEC_STATE
-         MessageInterface::ShowMessage(
-                        "                  decisionVector(%d) = %12.10f\n",
-                        idxs[ii], decisionVector[idxs[ii]]);
-      #endif
-      theStateVector[ii] = decisionVector[idxs[ii]];
-   }
-   
-   return theStateVector;
+   return stateView.ToRvector();
 }
 
 //------------------------------------------------------------------------------
@@ -672,15 +659,136 @@ Rvector DecisionVector::GetControlAtMeshPoint(Integer meshIdx, Integer stageIdx)
       throw LowThrustException(errmsg);
    }
    
-   // Compute indeces of control vector components the extract the
-   // control vector
-   IntegerArray idxs = GetControlIdxsAtMeshPoint(meshIdx, stageIdx);
-   Integer num = idxs.size();
-   Rvector theControlVector(num);
-   for (Integer ii = 0; ii < num; ii++)
-      theControlVector[ii] = decisionVector[idxs[ii]];
-   
-   return theControlVector;
+   // Extract the control vector through a view of its components
+   return GetControlViewAtMeshPoint(meshIdx, stageIdx).ToRvector();
+}
+
+//------------------------------------------------------------------------------
+//  DecVecView GetTimeView()
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the initial and final times
+ *
+ * @return view of the time chunk of the decision vector
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecView DecisionVector::GetTimeView()
+{
+   return DecVecView(decisionVector.GetDataVector() + timeStartIdx, 2,
+                     timeStopIdx - timeStartIdx);
+}
+
+//------------------------------------------------------------------------------
+//  DecVecView GetStaticView()
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the static parameters
+ *
+ * @return view of the static chunk of the decision vector
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecView DecisionVector::GetStaticView()
+{
+   if (numStaticParams == 0)
+      return DecVecView();
+   return DecVecView(decisionVector.GetDataVector() + staticStartIdx,
+                     numStaticParams);
+}
+
+//------------------------------------------------------------------------------
+//  DecVecView GetIntegralView()
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the integral parameters
+ *
+ * @return view of the integral chunk of the decision vector
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecView DecisionVector::GetIntegralView()
+{
+   if (numIntegralParams == 0)
+      return DecVecView();
+   return DecVecView(decisionVector.GetDataVector() + integralStartIdx,
+                     numIntegralParams);
+}
+
+//------------------------------------------------------------------------------
+//  DecVecView GetStateViewAtMeshPoint(Integer meshIdx, Integer stageIdx = 0)
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the state at the given mesh and stage point.
+ * The default implementation builds the view from the index list; derived
+ * classes with a closed-form layout override it to avoid that allocation.
+ *
+ * @param <meshIdx>   input mesh point
+ * @param <stageIdx>  input stage point
+ *
+ * @return view of the state at the given mesh and stage point
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecView DecisionVector::GetStateViewAtMeshPoint(Integer meshIdx,
+                                                   Integer stageIdx)
+{
+   return MakeView(GetStateIdxsAtMeshPoint(meshIdx, stageIdx));
+}
+
+//------------------------------------------------------------------------------
+//  DecVecView GetControlViewAtMeshPoint(Integer meshIdx, Integer stageIdx = 0)
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the control at the given mesh and stage point
+ *
+ * @param <meshIdx>   input mesh point
+ * @param <stageIdx>  input stage point
+ *
+ * @return view of the control at the given mesh and stage point
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecView DecisionVector::GetControlViewAtMeshPoint(Integer meshIdx,
+                                                     Integer stageIdx)
+{
+   return MakeView(GetControlIdxsAtMeshPoint(meshIdx, stageIdx));
+}
+
+//------------------------------------------------------------------------------
+//  DecVecArrayView GetStateArrayView()
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the states at all discretization points,
+ * laid out like GetStateArray.  Only decision vector types that store the
+ * points at a fixed spacing support this.
+ *
+ * @return view of the state array
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecArrayView DecisionVector::GetStateArrayView()
+{
+   throw LowThrustException("For DecisionVector::GetStateArrayView, "
+                     "this decision vector type does not support array views\n");
+}
+
+//------------------------------------------------------------------------------
+//  DecVecArrayView GetControlArrayView()
+//------------------------------------------------------------------------------
+/**
+ * This method returns a view of the controls at all discretization points,
+ * laid out like GetControlArray.  Only decision vector types that store the
+ * points at a fixed spacing support this.
+ *
+ * @return view of the control array
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecArrayView DecisionVector::GetControlArrayView()
+{
+   throw LowThrustException("For DecisionVector::GetControlArrayView, "
+                     "this decision vector type does not support array views\n");
 }
 
 //------------------------------------------------------------------------------
@@ -726,3 +834,36 @@ Rvector DecisionVector::GetInterpolatedControlVector(Real atTime)
    return controlVec;
 }
 
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//  DecVecView MakeView(const IntegerArray &idxs)
+//------------------------------------------------------------------------------
+/**
+ * This method builds a view over evenly spaced decision vector indexes
+ *
+ * @param <idxs>   the decision vector indexes to view
+ *
+ * @return view of the indexed elements
+ *
+ */
+//------------------------------------------------------------------------------
+DecVecView DecisionVector::MakeView(const IntegerArray &idxs)
+{
+   Integer num = idxs.size();
+   if (num == 0)
+      return DecVecView();
+   Integer stride = (num > 1 ? idxs[1] - idxs[0] : 1);
+   for (Integer ii = 2; ii < num; ii++)
+   {
+      if (idxs[ii] - idxs[ii-1] != stride)
+      {
+         std::string errmsg = "For DecisionVector::MakeView, ";
+         errmsg += "indexes are not evenly spaced\n";
+         throw LowThrustException(errmsg);
+      }
+   }
+   return DecVecView(decisionVector.GetDataVector() + idxs[0], num, stride);
+}
@@ -27,6 +27,81 @@
 #include "Rvector.hpp"
 #include "Rmatrix.hpp"
 
+//------------------------------------------------------------------------------
+/**
+ * Non-owning, strided view of a block of decision vector elements.  A view
+ * reads straight from the decision vector storage, so it is only valid until
+ * the decision vector is resized or destroyed.
+ */
+//------------------------------------------------------------------------------
+class CSALT_API DecVecView
+{
+public:
+   DecVecView(const Real *start = NULL, Integer sz = 0, Integer str = 1) :
+      data (start), size (sz), stride (str) {}
+
+   Integer     GetSize() const                  { return size; }
+   const Real& operator()(Integer index) const  { return data[index*stride]; }
+   const Real& operator[](Integer index) const  { return data[index*stride]; }
+
+   /// Copies the viewed elements into an existing vector of the same size
+   void CopyTo(Rvector &toVec) const
+   {
+      for (Integer ii = 0; ii < size; ii++)
+         toVec(ii) = data[ii*stride];
+   }
+   Rvector ToRvector() const
+   {
+      Rvector theVec(size);
+      CopyTo(theVec);
+      return theVec;
+   }
+
+protected:
+   /// First viewed element
+   const Real *data;
+   /// Number of viewed elements
+   Integer    size;
+   /// Distance between consecutive viewed elements
+   Integer    stride;
+};
+
+//------------------------------------------------------------------------------
+/**
+ * Non-owning view of a row-major block of the decision vector, such as the
+ * state or control values at every discretization point.  Row r starts
+ * r*rowStride elements after the first row.
+ */
+//------------------------------------------------------------------------------
+class CSALT_API DecVecArrayView
+{
+public:
+   DecVecArrayView(const Real *start = NULL, Integer rows = 0,
+                   Integer cols = 0, Integer rStride = 0) :
+      data (start), numRows (rows), numCols (cols), rowStride (rStride) {}
+
+   Integer     GetNumRows() const  { return numRows; }
+   Integer     GetNumColumns() const  { return numCols; }
+   const Real& operator()(Integer row, Integer col) const
+   {
+      return data[row*rowStride + col];
+   }
+   DecVecView  GetRow(Integer row) const
+   {
+      return DecVecView(data + row*rowStride, numCols, 1);
+   }
+
+protected:
+   /// First element of the first row
+   const Real *data;
+   /// Number of rows (discretization points)
+   Integer    numRows;
+   /// Number of columns (variables per point)
+   Integer    numCols;
+   /// Distance between the starts of consecutive rows
+   Integer    rowStride;
+};
+
 class CSALT_API DecisionVector
 {
 public:
@@ -71,6 +146,17 @@ public:
    virtual Rvector  GetControlAtMeshPoint(Integer meshIdx,
                                           Integer stageIdx = 0);
    
+   // Copy-free access into the decision vector storage
+   virtual DecVecView GetTimeView();
+   virtual DecVecView GetStaticView();
+   virtual DecVecView GetIntegralView();
+   virtual DecVecView GetStateViewAtMeshPoint(Integer meshIdx,
+                                              Integer stageIdx = 0);
+   virtual DecVecView GetControlViewAtMeshPoint(Integer meshIdx,
+                                                Integer stageIdx = 0);
+   virtual DecVecArrayView GetStateArrayView();
+   virtual DecVecArrayView GetControlArrayView();
+
    virtual Rvector  GetInterpolatedStateVector(Real atTime);
    virtual Rvector  GetInterpolatedControlVector(Real atTime);
 
@@ -149,6 +235,7 @@ protected:
    
    // protected methods
    virtual void SetChunkIndeces() = 0;
+   DecVecView   MakeView(const IntegerArray &idxs);
 };
 
 #endif // DecisionVector_hpp
@@ -1204,23 +1204,21 @@ void NLPFuncUtilRadau::GetStateAndControlInMesh(
    for (Integer idx1 = 0; idx1 < numStateIdxs; ++idx1)
    {
       
-      tmpVec.SetSize(ptrConfig->GetNumStateVars());
-      tmpVec = (*ptrDecVector).GetStateVector(
-                              stateIdxs[idx1],0);      
+      DecVecView stateView = ptrDecVector->GetStateViewAtMeshPoint(
+                              stateIdxs[idx1],0);
       
       for (Integer idx2 = 0; idx2 < ptrConfig->GetNumStateVars(); ++idx2)
       {
-         stateVecRvector[idx2](idx1) = tmpVec(idx2);
+         stateVecRvector[idx2](idx1) = stateView(idx2);
       }      
    }
    for (Integer idx1 = 0; idx1 < numControlIdxs; ++idx1)
    {
-      tmpVec.SetSize(ptrConfig->GetNumControlVars());
-      tmpVec = (*ptrDecVector).GetControlVector(
-                              controlIdxs[idx1],0);      
+      DecVecView controlView = ptrDecVector->GetControlViewAtMeshPoint(
+                              controlIdxs[idx1],0);
       for (Integer idx2 = 0; idx2 < ptrConfig->GetNumControlVars(); ++idx2)
       {
-         controlVecRvector[idx2](idx1) = tmpVec(idx2);
+         controlVecRvector[idx2](idx1) = controlView(idx2);
       }      
    }   
 }
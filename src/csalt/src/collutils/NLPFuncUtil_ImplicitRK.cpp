@@ -1431,7 +1431,8 @@ void NLPFuncUtil_ImplicitRK::GetStateAndControlInMesh(
    // Loop over stage points used in current interval
    for (Integer stageIdx = 0; stageIdx < numStateIdxs; stageIdx++)
    {
-      Rvector stateVec = ptrDecVector->GetStateVector(meshIdx, stageIdx);
+      DecVecView stateVec =
+                     ptrDecVector->GetStateViewAtMeshPoint(meshIdx, stageIdx);
 
       for (Integer stateIdx = 0; stateIdx < numStateVars; stateIdx++)
          stateArray(stageIdx, stateIdx) = stateVec(stateIdx);
@@ -1439,7 +1440,8 @@ void NLPFuncUtil_ImplicitRK::GetStateAndControlInMesh(
 
    for (Integer stageIdx = 0; stageIdx < numControlIdxs; stageIdx++)
    {
-      Rvector controlVec = ptrDecVector->GetControlVector(meshIdx, stageIdx);
+      DecVecView controlVec =
+                   ptrDecVector->GetControlViewAtMeshPoint(meshIdx, stageIdx);
 
       for (Integer ctrIdx = 0; ctrIdx < numControlVars; ctrIdx++)
          controlArray(stageIdx, ctrIdx) = controlVec(ctrIdx);
@@ -16,6 +16,7 @@
  * Implementation for the NLPFunctionData class
  */
 //------------------------------------------------------------------------------
+#include <algorithm>
 #include <sstream>
 #include "NLPFunctionData.hpp"
 #include "LowThrustException.hpp"
@@ -36,7 +37,8 @@
 // default constructor
 //------------------------------------------------------------------------------
 NLPFunctionData::NLPFunctionData() :
-   isJacSparsityPatternComputed (false)
+   isJacSparsityPatternComputed (false),
+   areKernelsReady              (false)
 {
    SparseMatrixUtil::SetSize(AMatrix, 1, 1);
    SparseMatrixUtil::SetSize(BMatrix, 1, 1);
@@ -55,6 +57,7 @@ NLPFunctionData::NLPFunctionData(const NLPFunctionData &nlpFuncData)
    jacSparsityPattern = SparseMatrixUtil::CopySparseMatrix(&jacSparsityPattern);
 
    isJacSparsityPatternComputed = nlpFuncData.isJacSparsityPatternComputed;
+   areKernelsReady              = false;
 }
 
 //------------------------------------------------------------------------------
@@ -71,6 +74,7 @@ NLPFunctionData& NLPFunctionData::operator = (const NLPFunctionData &nlpFuncData
    jacSparsityPattern = SparseMatrixUtil::CopySparseMatrix(&jacSparsityPattern);
 
    isJacSparsityPatternComputed = nlpFuncData.isJacSparsityPatternComputed;
+   areKernelsReady              = false;
 
    return *this;
 }
@@ -107,6 +111,7 @@ void NLPFunctionData::Initialize(Integer numFuncs, Integer numVars,
 {
    //Integer numCols = numFuncDependencies*numFuncs;
    isJacSparsityPatternComputed = false;
+   areKernelsReady              = false;
 
    SparseMatrixUtil::SetSize(AMatrix,numFuncs, numVars);
    SparseMatrixUtil::SetSize(BMatrix,numFuncs, numFuncDependencies);
@@ -137,6 +142,7 @@ void NLPFunctionData::InsertAMatPartition(Integer rowOffSet, Integer colOffSet,
                                           const IntegerArray  *colIdxVec,
                                           const Rvector *valueVec)
 {
+   areKernelsReady = false;
    SparseMatrixUtil::SetSparseBLockMatrix(AMatrix, rowOffSet, colOffSet,
                                           rowIdxVec, colIdxVec, valueVec);
 }
@@ -159,6 +165,7 @@ void NLPFunctionData::InsertAMatPartition(Integer rowOffSet, Integer colOffSet,
 void NLPFunctionData::InsertAMatPartition(Integer rowOffSet, Integer colOffSet,
                                           const Rmatrix *blockMatrix)
 {
+   areKernelsReady = false;
    SparseMatrixUtil::SetSparseBLockMatrix(AMatrix, rowOffSet,
                                           colOffSet,
                                           blockMatrix);
@@ -181,6 +188,7 @@ void NLPFunctionData::InsertAMatPartition(Integer rowOffSet, Integer colOffSet,
 void NLPFunctionData::InsertAMatElement(Integer rowIdx, Integer colIdx,
                                         Real value)
 {
+   areKernelsReady = false;
    SparseMatrixUtil::SetElement(AMatrix, rowIdx, colIdx, value);
 }
 
@@ -208,6 +216,7 @@ void NLPFunctionData::InsertBMatPartition(Integer rowOffSet, Integer colOffSet,
                          const IntegerArray  *colIdxVec,
                          const Rvector *valueVec)
 {
+   areKernelsReady = false;
    SparseMatrixUtil::SetSparseBLockMatrix(BMatrix, rowOffSet, colOffSet,
                                           rowIdxVec, colIdxVec, valueVec);
 }
@@ -229,6 +238,7 @@ void NLPFunctionData::InsertBMatPartition(Integer rowOffSet, Integer colOffSet,
 void NLPFunctionData::InsertBMatPartition(Integer rowOffSet, Integer colOffSet,
                                           const Rmatrix *blockMatrix)
 {
+   areKernelsReady = false;
    SparseMatrixUtil::SetSparseBLockMatrix(BMatrix, rowOffSet,
                                           colOffSet,
                                           blockMatrix);
@@ -251,6 +261,7 @@ void NLPFunctionData::InsertBMatPartition(Integer rowOffSet, Integer colOffSet,
 void NLPFunctionData::InsertBMatElement(Integer rowIdx, Integer colIdx,
                                         Real value)
 {
+   areKernelsReady = false;
    SparseMatrixUtil::SetElement(BMatrix,rowIdx, colIdx, value);
 }
 
@@ -492,8 +503,8 @@ void NLPFunctionData::GetBMatrixThreeVectors(IntegerArray  &rowIdxVec,
  * @param <DecVector>    input decision vector
  * @param <funcValueVec> output function values
  *
- * Note that for performance improvement, 'fast_prod' is used here
- * instead of the ordinary 'prod'.
+ * Note that for performance, the products run over compressed row copies of
+ * AMatrix and BMatrix rather than over the sparse matrix iterators.
  *
  * @return STL vector contains function values.
  */
@@ -514,20 +525,31 @@ void NLPFunctionData::ComputeFunctions(const Rvector *QVector,
       SparseMatrixUtil::PrintNonZeroElements(&AMatrix);
    #endif
    
-   // initialize funcValueVec
-   bool isInitializing = true; // do not add previous results
-   SparseMatrixUtil::fast_prod(&AMatrix,DecVector,funcValueVec, 
-                              isInitializing);
-
    #ifdef DEBUG_NLP_FUNCTION_DATA
       MessageInterface::ShowMessage("BMatrix is given as follows:\n");
       SparseMatrixUtil::PrintNonZeroElements(&BMatrix);
    #endif
-   // sum up the previous result
-   isInitializing = false;  // add the previous values
-   SparseMatrixUtil::fast_prod(&BMatrix, QVector, funcValueVec,
-                               isInitializing);
 
+   if (!areKernelsReady)
+      PrepareKernels();
+   CheckProductSize(AMatrix, DecVector->GetSize());
+   CheckProductSize(BMatrix, QVector->GetSize());
+
+   Integer numRows = (Integer)AMatrix.size1();
+   if (!funcValueVec.IsSized() || (funcValueVec.GetSize() != numRows))
+      funcValueVec.SetSize(numRows);
+
+   const Real *decData = DecVector->GetDataVector();
+   const Real *qData   = QVector->GetDataVector();
+   for (Integer row = 0; row < numRows; ++row)
+   {
+      Real sum = 0.0;
+      for (Integer k = aRowStarts[row]; k < aRowStarts[row + 1]; ++k)
+         sum += aValues[k] * decData[aColumns[k]];
+      for (Integer k = bRowStarts[row]; k < bRowStarts[row + 1]; ++k)
+         sum += bValues[k] * qData[bColumns[k]];
+      funcValueVec(row) = sum;
+   }
 }
 
 //------------------------------------------------------------------------------
@@ -540,8 +562,8 @@ void NLPFunctionData::ComputeFunctions(const Rvector *QVector,
  * @param <QVector>      input Q-vector
  * @param <funcValueVec> output function values
  *
- * Note that for performance improvement, 'fast_prod' is used here
- * instead of the ordinary 'prod'.
+ * Note that for performance, the product runs over a compressed row copy of
+ * BMatrix rather than over the sparse matrix iterators.
  *
  * @return STL vector contains function values.
  */
@@ -549,8 +571,22 @@ void NLPFunctionData::ComputeFunctions(const Rvector *QVector,
 void NLPFunctionData::ComputeFunctions(const Rvector *QVector,
                                        Rvector       &funcValueVec)
 {
-   bool isInitializing = true; // do not add previous results
-   SparseMatrixUtil::fast_prod(&BMatrix, QVector, funcValueVec, isInitializing);
+   if (!areKernelsReady)
+      PrepareKernels();
+   CheckProductSize(BMatrix, QVector->GetSize());
+
+   Integer numRows = (Integer)BMatrix.size1();
+   if (!funcValueVec.IsSized() || (funcValueVec.GetSize() != numRows))
+      funcValueVec.SetSize(numRows);
+
+   const Real *qData = QVector->GetDataVector();
+   for (Integer row = 0; row < numRows; ++row)
+   {
+      Real sum = 0.0;
+      for (Integer k = bRowStarts[row]; k < bRowStarts[row + 1]; ++k)
+         sum += bValues[k] * qData[bColumns[k]];
+      funcValueVec(row) = sum;
+   }
 }
 
 //------------------------------------------------------------------------------
@@ -558,8 +594,12 @@ void NLPFunctionData::ComputeFunctions(const Rvector *QVector,
 //------------------------------------------------------------------------------
 /**
  * Compute function Jacobian based on parQMatrix.
- * Note that for performance improvement, 'fast_prod' is used here
- * instead of the ordinary 'prod'.
+ *
+ * Each Jacobian row is accumulated in a dense work row from the matching rows
+ * of AMatrix and of parQMat scaled by the BMatrix row, then appended to the
+ * Jacobian in column order.  The Jacobian keeps every structural entry of
+ * AMatrix + BMatrix*parQMat, so its pattern depends only on the patterns of
+ * the inputs.
  *
  * @param <parQMat>            Q matrix
  * @param <funcJacobianMatrix> output Jacobian matrix
@@ -570,10 +610,79 @@ void NLPFunctionData::ComputeFunctions(const Rvector *QVector,
 void NLPFunctionData::ComputeJacobian(RSMatrix *parQMat,
                                       RSMatrix &funcJacobianMatrix)
 {
-   funcJacobianMatrix  = AMatrix; // initialize funcJacobianMatrix
-   bool isInitializing = false;  // add the previous values
-   SparseMatrixUtil::fast_prod(&BMatrix,parQMat, funcJacobianMatrix, 
-                              isInitializing);
+   if (!areKernelsReady)
+      PrepareKernels();
+   if (BMatrix.size2() != parQMat->size1())
+   {
+      std::stringstream errmsg("");
+      errmsg << "Error: dimension mismatch between matrices.";
+      errmsg << std::endl;
+      throw LowThrustException(errmsg.str());
+   }
+
+   Integer numRows = (Integer)AMatrix.size1();
+   Integer numCols = (Integer)AMatrix.size2();
+   if ((Integer)parQMat->size2() != numCols)
+   {
+      std::stringstream errmsg("");
+      errmsg << "Error: the dimensions of the result matrix ";
+      errmsg << "are not correct!" << std::endl;
+      throw LowThrustException(errmsg.str());
+   }
+
+   ExtractRows(*parQMat, qRowStarts, qColumns, qValues);
+
+   if ((Integer)jacWorkValues.size() != numCols)
+   {
+      jacWorkValues.assign(numCols, 0.0);
+      jacWorkMarks.assign(numCols, -1);
+   }
+
+   // Upper bound of the Jacobian non-zeros, for the reservation
+   std::size_t maxNonZeros = aValues.size();
+   for (UnsignedInt k = 0; k < bColumns.size(); ++k)
+      maxNonZeros += qRowStarts[bColumns[k] + 1] - qRowStarts[bColumns[k]];
+
+   RSMatrix jacobian(numRows, numCols, 0);
+   jacobian.reserve(maxNonZeros, false);
+   IntegerArray rowColumns;
+   for (Integer row = 0; row < numRows; ++row)
+   {
+      rowColumns.clear();
+      for (Integer k = aRowStarts[row]; k < aRowStarts[row + 1]; ++k)
+      {
+         Integer col = aColumns[k];
+         if (jacWorkMarks[col] != row)
+         {
+            jacWorkMarks[col]  = row;
+            jacWorkValues[col] = 0.0;
+            rowColumns.push_back(col);
+         }
+         jacWorkValues[col] += aValues[k];
+      }
+      for (Integer k = bRowStarts[row]; k < bRowStarts[row + 1]; ++k)
+      {
+         Real    bValue = bValues[k];
+         Integer qRow   = bColumns[k];
+         for (Integer m = qRowStarts[qRow]; m < qRowStarts[qRow + 1]; ++m)
+         {
+            Integer col = qColumns[m];
+            if (jacWorkMarks[col] != row)
+            {
+               jacWorkMarks[col]  = row;
+               jacWorkValues[col] = 0.0;
+               rowColumns.push_back(col);
+            }
+            jacWorkValues[col] += bValue * qValues[m];
+         }
+      }
+      std::sort(rowColumns.begin(), rowColumns.end());
+      for (UnsignedInt k = 0; k < rowColumns.size(); ++k)
+         jacobian.push_back(row, rowColumns[k], jacWorkValues[rowColumns[k]]);
+   }
+   // The marks hold row numbers, which the next call reuses
+   jacWorkMarks.assign(numCols, -1);
+   funcJacobianMatrix.swap(jacobian);
 
    #ifdef DEBUG_NLP_FUNCTION_DATA
       MessageInterface::ShowMessage("jacobian matrix is given as follows:\n");
@@ -658,8 +767,89 @@ void NLPFunctionData::SumBMatPartition(Integer rowOffSet, Integer colOffSet,
    #endif
    // SetSparseBlockMatrix without initialization
    // So, the addition is conducted.
+   areKernelsReady = false;
    SparseMatrixUtil::SetSparseBLockMatrix(BMatrix, rowOffSet,
                                           colOffSet, rowIdxVec,
                                           colIdxVec, valueVec, false);
 }
 
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void PrepareKernels()
+//------------------------------------------------------------------------------
+/**
+ * Copies AMatrix and BMatrix into the contiguous compressed row arrays used
+ * by ComputeFunctions and ComputeJacobian.  The matrices are constant for a
+ * mesh, so the copies are made once after they are filled.
+ */
+//------------------------------------------------------------------------------
+void NLPFunctionData::PrepareKernels()
+{
+   ExtractRows(AMatrix, aRowStarts, aColumns, aValues);
+   ExtractRows(BMatrix, bRowStarts, bColumns, bValues);
+   areKernelsReady = true;
+}
+
+//------------------------------------------------------------------------------
+// void ExtractRows(const RSMatrix &mat, IntegerArray &rowStarts,
+//                  IntegerArray &columns, RealArray &values)
+//------------------------------------------------------------------------------
+/**
+ * Copies a compressed row matrix into plain arrays.
+ *
+ * @param <mat>        the matrix
+ * @param <rowStarts>  output - the start of each row in columns and values,
+ *                     with one more entry than the matrix has rows
+ * @param <columns>    output - the column of each stored element
+ * @param <values>     output - the value of each stored element
+ */
+//------------------------------------------------------------------------------
+void NLPFunctionData::ExtractRows(const RSMatrix &mat, IntegerArray &rowStarts,
+                                  IntegerArray &columns, RealArray &values)
+{
+   std::size_t numRows = mat.size1();
+   // Rows at or beyond filled1() - 1 of a compressed matrix are empty
+   std::size_t numFilledRows = (mat.filled1() > 0 ? mat.filled1() - 1 : 0);
+   std::size_t numNonZeros   = mat.filled2();
+   const RSMatrix::index_array_type &matRowStarts = mat.index1_data();
+   const RSMatrix::index_array_type &matColumns   = mat.index2_data();
+   const RSMatrix::value_array_type &matValues    = mat.value_data();
+
+   rowStarts.resize(numRows + 1);
+   for (std::size_t row = 0; row <= numRows; ++row)
+      rowStarts[row] = (Integer)(row <= numFilledRows ? matRowStarts[row] :
+                                                        numNonZeros);
+   columns.resize(numNonZeros);
+   values.resize(numNonZeros);
+   for (std::size_t k = 0; k < numNonZeros; ++k)
+   {
+      columns[k] = (Integer)matColumns[k];
+      values[k]  = matValues[k];
+   }
+}
+
+//------------------------------------------------------------------------------
+// void CheckProductSize(const RSMatrix &mat, Integer vecSize)
+//------------------------------------------------------------------------------
+/**
+ * Throws if a vector of the given size cannot multiply the matrix.
+ *
+ * @param <mat>      the matrix
+ * @param <vecSize>  the size of the vector
+ */
+//------------------------------------------------------------------------------
+void NLPFunctionData::CheckProductSize(const RSMatrix &mat, Integer vecSize)
+{
+   if (mat.size2() != (UnsignedInt)vecSize)
+   {
+      std::stringstream errmsg("");
+      errmsg << "vector size is" << vecSize;
+      errmsg << "the number of columns of matrix is" << mat.size2();
+      errmsg << "Error: dimension mismatch between matrix and vector.";
+      errmsg << std::endl;
+      throw LowThrustException(errmsg.str());
+   }
+}
@@ -136,6 +136,27 @@ protected:
    /// has the jacobian sparsity pattern has been computed?
    bool     isJacSparsityPatternComputed;
 
+   /// have the compressed row copies of AMatrix and BMatrix been made?
+   bool         areKernelsReady;
+   /// compressed row copies of AMatrix and BMatrix
+   IntegerArray aRowStarts;
+   IntegerArray aColumns;
+   RealArray    aValues;
+   IntegerArray bRowStarts;
+   IntegerArray bColumns;
+   RealArray    bValues;
+   /// compressed row copy of the parQ matrix of the last Jacobian
+   IntegerArray qRowStarts;
+   IntegerArray qColumns;
+   RealArray    qValues;
+   /// dense work row of the Jacobian, and the row each column was last used
+   RealArray    jacWorkValues;
+   IntegerArray jacWorkMarks;
+
+   void         PrepareKernels();
+   static void  ExtractRows(const RSMatrix &mat, IntegerArray &rowStarts,
+                            IntegerArray &columns, RealArray &values);
+   static void  CheckProductSize(const RSMatrix &mat, Integer vecSize);
 };
 
 #endif // NLPFunctionData_hpp
@@ -16,8 +16,11 @@
  */
 //------------------------------------------------------------------------------
 
+#include <atomic>
+#include <exception>
 #include <iostream>
 #include <sstream>
+#include <thread>
 #include "GmatConstants.hpp"
 #include "Phase.hpp"
 #include "DecVecTypeBetts.hpp"
@@ -65,6 +68,8 @@ Phase::Phase() :
    dynFunctionProps            (NULL),
    costFunctionProps           (NULL),
    algFunctionProps            (NULL),
+   numPathFunctionThreads      (1),
+   serialPathFunction          (false),
    guessGen                    (NULL),
    algPathNLPFuncUtil          (NULL),
    transUtil                   (NULL),
@@ -114,7 +119,12 @@ Phase::Phase(const Phase &copy) :
    recomputeNLPFunctions       (copy.recomputeNLPFunctions),
    isRefining                  (copy.isRefining),
    constraintTimeOffset        (copy.constraintTimeOffset),
-   relativeErrorTol            (copy.relativeErrorTol)
+   numPathFunctionThreads      (copy.numPathFunctionThreads),
+   serialPathFunction          (false),
+   relativeErrorTol            (copy.relativeErrorTol),
+   warmStartTimes              (copy.warmStartTimes),
+   warmStartDensities          (copy.warmStartDensities),
+   warmStartStates             (copy.warmStartStates)
 //   dynFunctionProps            (NULL),
 //   costFunctionProps           (NULL),
 //   algFunctionProps            (NULL),
@@ -220,7 +230,14 @@ Phase& Phase::operator=(const Phase &copy)
    isRefining                  = copy.isRefining;
    constraintTimeOffset        = copy.constraintTimeOffset;
    relativeErrorTol            = copy.relativeErrorTol;
+   numPathFunctionThreads      = copy.numPathFunctionThreads;
+   warmStartTimes              = copy.warmStartTimes;
+   warmStartDensities          = copy.warmStartDensities;
+   warmStartStates             = copy.warmStartStates;
    
+   // The clones evaluate the old path function
+   ClearPathFunctionWorkers();
+
    if (pathFunction) delete pathFunction;
    pathFunction   = copy.pathFunction;
    
@@ -272,6 +289,8 @@ Phase& Phase::operator=(const Phase &copy)
          pathFunctionInputData, guessGen);
 
    CopyArrays(copy);
+   defectJacobianSlots.Clear();
+   algPathJacobianSlots.Clear();
    // @todo - handle other pointers here - need to clone?
 
    return *this;
@@ -298,6 +317,8 @@ Phase::~Phase()
    if (costFunctionProps)     delete costFunctionProps;
    if (algFunctionProps)      delete algFunctionProps;
 
+   ClearPathFunctionWorkers();
+
    for (Integer i = 0; i < funcData.size(); ++i)
    {
       if (funcData.at(i))
@@ -393,6 +414,157 @@ Rvector Phase::ComputeMaxMeshError()
       pathFunctionManager);
 }
 
+//------------------------------------------------------------------------------
+// void SaveWarmStartData(const Rvector &decMul, const IntegerArray &decState,
+//                        const Rvector &conMul, const IntegerArray &conState)
+//------------------------------------------------------------------------------
+/**
+ * Saves the multipliers and optimizer states of the phase on the current
+ * mesh, so that GetWarmStartData can map them onto a refined mesh.
+ *
+ * Multipliers of collocated quantities scale with the local mesh spacing, so
+ * they are saved per unit normalized time.
+ *
+ * @param <decMul>    multipliers of the phase decision variable bounds
+ * @param <decState>  optimizer states of the phase decision variables
+ * @param <conMul>    multipliers of the phase constraints
+ * @param <conState>  optimizer states of the phase constraints
+ */
+//------------------------------------------------------------------------------
+void Phase::SaveWarmStartData(const Rvector      &decMul,
+                              const IntegerArray &decState,
+                              const Rvector      &conMul,
+                              const IntegerArray &conState)
+{
+   warmStartTimes.clear();
+   warmStartDensities.clear();
+   warmStartStates.clear();
+
+   Integer numDec = decMul.GetSize();
+   Integer numCon = conMul.GetSize();
+   if ((numDec != GetNumDecisionVarsNLP()) || (numCon != GetNumTotalConNLP()) ||
+       (decState.size() != (UnsignedInt)numDec) ||
+       (conState.size() != (UnsignedInt)numCon))
+      return;
+
+   std::vector<IntegerArray> seriesIdxs;
+   GetWarmStartLayout(seriesIdxs, warmStartTimes);
+
+   RealArray weights;
+   warmStartDensities.resize(seriesIdxs.size());
+   warmStartStates.resize(seriesIdxs.size());
+   for (UnsignedInt s = 0; s < seriesIdxs.size(); ++s)
+   {
+      GetWarmStartWeights(warmStartTimes[s], weights);
+      for (UnsignedInt k = 0; k < seriesIdxs[s].size(); ++k)
+      {
+         Integer idx = seriesIdxs[s][k];
+         if (idx < numDec)
+         {
+            warmStartDensities[s].push_back(decMul(idx) / weights[k]);
+            warmStartStates[s].push_back(decState[idx]);
+         }
+         else
+         {
+            warmStartDensities[s].push_back(conMul(idx - numDec) / weights[k]);
+            warmStartStates[s].push_back(conState[idx - numDec]);
+         }
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// bool GetWarmStartData(Rvector &decMul, IntegerArray &decState,
+//                       Rvector &conMul, IntegerArray &conState)
+//------------------------------------------------------------------------------
+/**
+ * Maps the data saved by SaveWarmStartData onto the current mesh.
+ *
+ * Multipliers are interpolated linearly in normalized phase time, since they
+ * need not be smooth; optimizer states are taken from the nearest saved
+ * point.  Decision variables and constraints with no saved series get zero
+ * multipliers and states.
+ *
+ * @param <decMul>    output - multipliers of the decision variable bounds
+ * @param <decState>  output - optimizer states of the decision variables
+ * @param <conMul>    output - multipliers of the phase constraints
+ * @param <conState>  output - optimizer states of the phase constraints
+ *
+ * @return true if saved data was mapped, false if none fits this phase
+ */
+//------------------------------------------------------------------------------
+bool Phase::GetWarmStartData(Rvector      &decMul,
+                             IntegerArray &decState,
+                             Rvector      &conMul,
+                             IntegerArray &conState)
+{
+   Integer numDec = GetNumDecisionVarsNLP();
+   Integer numCon = GetNumTotalConNLP();
+
+   std::vector<IntegerArray> seriesIdxs;
+   std::vector<RealArray>    seriesTimes;
+   GetWarmStartLayout(seriesIdxs, seriesTimes);
+   if (seriesIdxs.empty() || (seriesIdxs.size() != warmStartTimes.size()))
+      return false;
+
+   decMul.SetSize(numDec);
+   conMul.SetSize(numCon);
+   decState.assign(numDec, 0);
+   conState.assign(numCon, 0);
+
+   RealArray weights;
+   for (UnsignedInt s = 0; s < seriesIdxs.size(); ++s)
+   {
+      const RealArray    &oldTimes     = warmStartTimes[s];
+      const RealArray    &oldDensities = warmStartDensities[s];
+      const IntegerArray &oldStates    = warmStartStates[s];
+      Integer numOld = (Integer)oldTimes.size();
+      if (numOld == 0)
+         continue;
+
+      GetWarmStartWeights(seriesTimes[s], weights);
+      Integer low = 0;
+      for (UnsignedInt k = 0; k < seriesIdxs[s].size(); ++k)
+      {
+         // Saved interval [low, low + 1] containing the new time; the new
+         // times increase along a series, so the search resumes from the
+         // previous interval
+         Real t = seriesTimes[s][k];
+         while ((low < numOld - 2) && (oldTimes[low + 1] <= t))
+            ++low;
+
+         Real    density = oldDensities[low];
+         Integer state   = oldStates[low];
+         if (numOld > 1)
+         {
+            Real t0 = oldTimes[low], t1 = oldTimes[low + 1];
+            Real frac = (t1 > t0 ? (t - t0) / (t1 - t0) : 0.0);
+            if (frac < 0.0)
+               frac = 0.0;
+            if (frac > 1.0)
+               frac = 1.0;
+            density = oldDensities[low] +
+                      frac * (oldDensities[low + 1] - oldDensities[low]);
+            if (frac > 0.5)
+               state = oldStates[low + 1];
+         }
+
+         Integer idx = seriesIdxs[s][k];
+         if (idx < numDec)
+         {
+            decMul(idx)   = density * weights[k];
+            decState[idx] = state;
+         }
+         else
+         {
+            conMul(idx - numDec)   = density * weights[k];
+            conState[idx - numDec] = state;
+         }
+      }
+   }
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // void SetInitialGuessMode(const std::string &toMode)
 //------------------------------------------------------------------------------
@@ -547,6 +719,7 @@ void Phase::SetPathFunction(UserPathFunction* f)
       std::cout << "Entering SetPathFunction ...\n";
    #endif
    pathFunction = f;
+   ClearPathFunctionWorkers();
    #ifdef DEBUG_PHASE_INIT
       std::cout << "Exiting SetPathFunction ...\n";
    #endif
@@ -842,6 +1015,40 @@ void Phase::SetRelativeErrorTol(Real toNum)
    relativeErrorTol = toNum;
 }
 
+//------------------------------------------------------------------------------
+// void SetNumPathFunctionThreads(Integer toNum)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of threads that evaluate the path functions at the time
+ * points.  The default, 1, evaluates them on the calling thread.  More threads
+ * need a path function that supports UserPathFunction::Clone().
+ *
+ * @param toNum the number of threads; 0 uses one per hardware thread
+ */
+//------------------------------------------------------------------------------
+void Phase::SetNumPathFunctionThreads(Integer toNum)
+{
+   if (toNum < 0)
+      throw LowThrustException("ERROR setting the number of path function "
+                               "threads on Phase: the value is negative!\n");
+   numPathFunctionThreads = toNum;
+   ClearPathFunctionWorkers();
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumPathFunctionThreads()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of threads that evaluate the path functions
+ *
+ * @return the number of threads; 0 for one per hardware thread
+ */
+//------------------------------------------------------------------------------
+Integer Phase::GetNumPathFunctionThreads()
+{
+   return numPathFunctionThreads;
+}
+
 //------------------------------------------------------------------------------
 // Integer GetNumStateVars()
 //------------------------------------------------------------------------------
@@ -1854,7 +2061,7 @@ void Phase::ComputeDefectConstraints()
    IntegerArray idxs;
    idxs.push_back(defectConStartIdx);
    idxs.push_back(defectConEndIdx);
-   InsertJacobianRowChunk(jac,idxs);  
+   InsertJacobianRowChunk(jac, idxs, defectJacobianSlots);
    #ifdef DEBUG_PHASE
       MessageInterface::ShowMessage(
                               "LEAVING Phase::ComputeDefectConstraints ...\n");
@@ -1942,7 +2149,7 @@ void Phase::ComputeAlgebraicPathConstraints()
          MessageInterface::ShowMessage(
                                  "Phase: inserting jacobian row chunk ...\n");
    #endif
-   InsertJacobianRowChunk(jacValues,idxs);
+   InsertJacobianRowChunk(jacValues, idxs, algPathJacobianSlots);
    #ifdef DEBUG_PHASE_SPARSE
          MessageInterface::ShowMessage(
                         "LEAVING Phase: ComputeAlgebraicPathConstraints ...\n");
@@ -3000,6 +3207,8 @@ void Phase::IntializeJacobians()
                              config->GetNumDecisionVarsNLP());
    SparseMatrixUtil::SetSize(nlpCostJacobian, 1,
                              config->GetNumDecisionVarsNLP());
+   defectJacobianSlots.Clear();
+   algPathJacobianSlots.Clear();
 }
 
 
@@ -3182,128 +3391,93 @@ void Phase::ComputePathFunctions()
                                        ii, tvTypes.at(ii));
    #endif
    
-   // clear the arrays
-   for (Integer i = 0; i < funcData.size(); ++i)
+   // Reuse the containers of the last evaluation; the number of points only
+   // changes when the mesh is refined
+   for (Integer i = numTimePts; i < funcData.size(); ++i)
    {
       if (funcData.at(i))
          delete funcData.at(i);
    }
-   /*
-   for (Integer i = 0; i < userDynFunctionData.size(); ++i)
+   if (funcData.size() > numTimePts)
+      funcData.resize(numTimePts);
+   for (Integer i = 0; i < funcData.size(); ++i)
    {
-      if (userDynFunctionData.at(i))
-         delete userDynFunctionData.at(i);
+      if (!funcData.at(i))
+      {
+         funcData.at(i) = new PathFunctionContainer();
+         funcData.at(i)->Initialize();
+      }
+      else
+         funcData.at(i)->Reset();
    }
-   for (Integer i = 0; i < userAlgFunctionData.size(); ++i)
+   while (funcData.size() < numTimePts)
    {
-      if (userAlgFunctionData.at(i))
-         delete userAlgFunctionData.at(i);
-   }
-   for (Integer i = 0; i < costIntFunctionData.size(); ++i)
-   {
-      if (costIntFunctionData.at(i))
-         delete costIntFunctionData.at(i);
+      funcData.push_back(new PathFunctionContainer());
+      #ifdef DEBUG_PHASE_INIT
+         MessageInterface::ShowMessage(
+                                 "INITIALIZING PathFunctionContainer ... \n");
+      #endif
+      funcData.back()->Initialize();
    }
-   */
-   funcData.clear();
    userDynFunctionData.clear();
    userAlgFunctionData.clear();
    costIntFunctionData.clear();
    
+   // Evaluate user functions and Jacobians
+   EvaluatePathFunctions(tvTypes);
+   #ifdef DEBUG_PHASE_INIT
+      MessageInterface::ShowMessage(
+                           "AFTER calling EvalUserF and EvaluUserJ ... \n");
+      MessageInterface::ShowMessage("   dyn?  %s\n",
+                                    (pathFunctionManager->HasDynFunctions()?
+                                     "true" : "false"));
+      MessageInterface::ShowMessage("   cost? %s\n",
+                                    (pathFunctionManager->HasCostFunction()?
+                                     "true" : "false"));
+      MessageInterface::ShowMessage("   alg?  %s\n",
+                                    (pathFunctionManager->HasAlgFunctions()?
+                                     "true" : "false"));
+   #endif
+
    //YK mod static vars: save static idxs vector, here, and use it for loop
    IntegerArray stcIdxs = decVector->GetStaticIdxs();
 
    for (Integer pt = 0; pt < numTimePts; pt++)
    {
       // Extract info on the current mesh/stage point
-      Integer pointType   = tvTypes.at(pt);
       Integer meshIdx     = transUtil->GetMeshIndex(pt); 
       Integer stageIdx    = transUtil->GetStageIndex(pt);
-      #ifdef DEBUG_PHASE_INIT
-         MessageInterface::ShowMessage(
-                           "Before PreparePathFunction, meshIdx  = %d  ...\n",
-                           meshIdx);
-         MessageInterface::ShowMessage(
-                           "                            stageIdx = %d  ...\n",
-                           stageIdx);
-      #endif
-      IntegerArray tIdxs  = decVector->GetTimeIdxs();
       IntegerArray stIdxs = decVector->GetStateIdxsAtMeshPoint(meshIdx,
                                                                stageIdx);
       IntegerArray clIdxs = decVector->GetControlIdxsAtMeshPoint(meshIdx,
                                                                  stageIdx);
-      // Prepare the user function data structures then call the
-      // user function
       #ifdef DEBUG_PHASE_INIT
-         MessageInterface::ShowMessage("tIdxs  size = %d  ...\n",
-                                       (Integer) tIdxs.size());
          MessageInterface::ShowMessage("stIdxs size = %d  ...\n",
                                        (Integer) stIdxs.size());
          MessageInterface::ShowMessage("clIdxs size = %d  ...\n",
                                        (Integer) clIdxs.size());
       #endif
-      PreparePathFunction(meshIdx,stageIdx,pointType,pt);
-      
-      // CREATING NEW ONE HERE????  Is that what we want to do?
-      funcData.push_back(new PathFunctionContainer());
-      #ifdef DEBUG_PHASE_INIT
-         MessageInterface::ShowMessage(
-                                 "INITIALIZING PathFunctionContainer ... \n");
-      #endif
-      funcData.back()->Initialize();
-
-      #ifdef DEBUG_PHASE_INIT
-         MessageInterface::ShowMessage("Calling EvaluateUserFunction with phaseNum = %d, pathFunctionInputData = <%p> ... \n",
-                                       pathFunctionInputData->GetPhaseNum(), pathFunctionInputData);
-      #endif
-      // Evaluate user functions and Jacobians
-      funcData.back() = pathFunctionManager->EvaluateUserFunction(
-                                      pathFunctionInputData,funcData.back());
-      funcData.back() = pathFunctionManager->EvaluateUserJacobian(
-                                      pathFunctionInputData,funcData.back()); 
-      #ifdef DEBUG_PHASE_INIT
-         MessageInterface::ShowMessage(
-                              "AFTER calling EvalUserF and EvaluUserJ ... \n");
-         MessageInterface::ShowMessage("   dyn?  %s\n",
-                                       (pathFunctionManager->HasDynFunctions()?
-                                        "true" : "false"));
-         MessageInterface::ShowMessage("   cost? %s\n",
-                                       (pathFunctionManager->HasCostFunction()?
-                                        "true" : "false"));
-         MessageInterface::ShowMessage("   alg?  %s\n",
-                                       (pathFunctionManager->HasAlgFunctions()?
-                                        "true" : "false"));
-      #endif
 
       // Handle defect constraints
-      #ifdef DEBUG_PHASE_INIT
-         MessageInterface::ShowMessage("HasDynFunctions??? ... \n");
-      #endif
       if (pathFunctionManager->HasDynFunctions())
       {
-         FunctionOutputData *dyn = funcData.back()->GetDynData();
+         FunctionOutputData *dyn = funcData.at(pt)->GetDynData();
          userDynFunctionData.push_back(dyn);
          dyn->SetNLPData(meshIdx, stageIdx, stIdxs, clIdxs, stcIdxs);
       }
 
       // Handle cost function
-      #ifdef DEBUG_PHASE_INIT
-         MessageInterface::ShowMessage("HasCostFunction??? ... \n");
-      #endif
       if (pathFunctionManager->HasCostFunction())
       {
-         FunctionOutputData *cost = funcData.back()->GetCostData();
+         FunctionOutputData *cost = funcData.at(pt)->GetCostData();
          costIntFunctionData.push_back(cost);
          cost->SetNLPData(meshIdx, stageIdx, stIdxs, clIdxs, stcIdxs);
       }
 
       // Handle algebraic constraints
-      #ifdef DEBUG_PHASE_INIT
-         MessageInterface::ShowMessage("HasAlgFunction??? ... \n");
-      #endif
       if (pathFunctionManager->HasAlgFunctions())
       {
-         FunctionOutputData *alg = funcData.back()->GetAlgData();
+         FunctionOutputData *alg = funcData.at(pt)->GetAlgData();
          userAlgFunctionData.push_back(alg);
          alg->SetNLPData(meshIdx, stageIdx, stIdxs, clIdxs, stcIdxs);
       }
@@ -3390,6 +3564,13 @@ void Phase::ComputeSparsityPattern()
       costSparsityPattern = SparseMatrixUtil::CopySparseMatrix(
                                        transUtil->ComputeCostSparsityPattern());
    }
+
+   // Lay out the constraint Jacobian on the pattern once, so the Jacobian
+   // chunks are written into fixed slots rather than inserted
+   nlpConstraintJacobian =
+         SparseMatrixUtil::GetSparsityPattern(&conSparsityPattern, true);
+   defectJacobianSlots.Clear();
+   algPathJacobianSlots.Clear();
    #ifdef DEBUG_PHASE_SPARSE
       MessageInterface::ShowMessage("CSP: LEAVING\n");
    #endif
@@ -3439,6 +3620,9 @@ void Phase::InitializeUserFunctions()
       std::cout << " numStateVars, numControlVars = ";
       std::cout << GetNumStateVars() << " " << GetNumControlVars() << std::endl;
    #endif
+   // Copies of the path function are made again from the initialized one
+   ClearPathFunctionWorkers();
+
    // Initialize the path function
    pathFunctionInputData->Initialize(GetNumStateVars(), GetNumControlVars(), 
                                      GetNumStaticVars());
@@ -3878,7 +4062,8 @@ void Phase::SetInitialGuessFromGuessGen()
 
 //------------------------------------------------------------------------------
 // void PreparePathFunction(Integer meshIdx,   Integer stageIdx,
-//                          Integer pointType, Integer pointIdx)
+//                          Integer pointType, Integer pointIdx,
+//                          FunctionInputData *inputData)
 //------------------------------------------------------------------------------
 /**
  * Calls guess utility to compute guess for state and control
@@ -3887,11 +4072,13 @@ void Phase::SetInitialGuessFromGuessGen()
  * @param <stageIdx>  the stage index
  * @param <pointType> the point type
  * @param <pointIdx>  the point index
+ * @param <inputData> the input data to fill; NULL for pathFunctionInputData
  *
  */
 //------------------------------------------------------------------------------
 void Phase::PreparePathFunction(Integer meshIdx,   Integer stageIdx,
-                                Integer pointType, Integer pointIdx)
+                                Integer pointType, Integer pointIdx,
+                                FunctionInputData *inputData)
 {
    #ifdef DEBUG_PHASE_PATH_INIT
       MessageInterface::ShowMessage("ENTERING PreparePathFunction\n");
@@ -3902,57 +4089,399 @@ void Phase::PreparePathFunction(Integer meshIdx,   Integer stageIdx,
    // Prepares user path function evaluation at a specific point
 
    // This function extracts the state, control, and time from decision vector
-   pathFunctionInputData->SetPhaseNum(phaseNum);
+   if (!inputData)
+      inputData = pathFunctionInputData;
+   inputData->SetPhaseNum(phaseNum);
    if (pointType == 1 || pointType == 2)
    {
-      pathFunctionInputData->SetStateVector(
-                             decVector->GetStateAtMeshPoint(meshIdx,stageIdx));
+      inputData->SetStateVector(
+                         decVector->GetStateViewAtMeshPoint(meshIdx,stageIdx));
    }
    else
    {
       Rvector ones(GetNumStateVars());
       ones = ones * GmatMathConstants::QUIET_NAN;
-      pathFunctionInputData->SetStateVector(ones);
+      inputData->SetStateVector(ones);
    }
    if (pointType == 1 || pointType == 3)
    {
-      pathFunctionInputData->SetControlVector(
-                             decVector->GetControlAtMeshPoint(meshIdx,
+      inputData->SetControlVector(
+                         decVector->GetControlViewAtMeshPoint(meshIdx,
                                                               stageIdx));
    }
    else
    {
       Rvector ones(GetNumControlVars());
       ones = ones * GmatMathConstants::QUIET_NAN;
-      pathFunctionInputData->SetControlVector(ones); 
+      inputData->SetControlVector(ones); 
    }
-   pathFunctionInputData->SetTime(transUtil->GetTimeAtMeshPoint(pointIdx));
+   inputData->SetTime(transUtil->GetTimeAtMeshPoint(pointIdx));
 
    // YK mod static params; is it right to place this line here?
-   pathFunctionInputData->SetStaticVector(decVector->GetStaticVector());
+   inputData->SetStaticVector(decVector->GetStaticView());
 
    #ifdef DEBUG_PHASE_PATH_INIT
          MessageInterface::ShowMessage("LEAVING PreparePathFunction\n");
    #endif
 }
+
+//------------------------------------------------------------------------------
+// void EvaluatePathFunctions(const IntegerArray &tvTypes)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the user path functions and Jacobians at every time point, filling
+ * the containers in funcData.
+ *
+ * With more than one thread the input data of all points is prepared first,
+ * then the points are handed out to the calling thread and the workers, each
+ * evaluating a clone of the path function through its own manager.
+ *
+ * @param <tvTypes>  the time vector types of the points
+ *
+ */
+//------------------------------------------------------------------------------
+void Phase::EvaluatePathFunctions(const IntegerArray &tvTypes)
+{
+   Integer numTimePts = (Integer) funcData.size();
+
+   Integer threadCount = numPathFunctionThreads;
+   if (threadCount == 0)
+      threadCount = (Integer) std::thread::hardware_concurrency();
+   if (threadCount > numTimePts)
+      threadCount = numTimePts;
+
+   if ((threadCount <= 1) || !CreatePathFunctionWorkers(threadCount - 1))
+   {
+      for (Integer pt = 0; pt < numTimePts; pt++)
+      {
+         Integer meshIdx  = transUtil->GetMeshIndex(pt);
+         Integer stageIdx = transUtil->GetStageIndex(pt);
+         PreparePathFunction(meshIdx, stageIdx, tvTypes.at(pt), pt);
+         #ifdef DEBUG_PHASE_INIT
+            MessageInterface::ShowMessage("Calling EvaluateUserFunction with phaseNum = %d, pathFunctionInputData = <%p> ... \n",
+                                          pathFunctionInputData->GetPhaseNum(), pathFunctionInputData);
+         #endif
+         funcData.at(pt) = pathFunctionManager->EvaluateUserFunction(
+                                       pathFunctionInputData, funcData.at(pt));
+         funcData.at(pt) = pathFunctionManager->EvaluateUserJacobian(
+                                       pathFunctionInputData, funcData.at(pt));
+      }
+      return;
+   }
+
+   // The decision vector and transcription are read on this thread only
+   for (Integer pt = (Integer) pointInputData.size(); pt < numTimePts; pt++)
+      pointInputData.push_back(new FunctionInputData(*pathFunctionInputData));
+   for (Integer pt = 0; pt < numTimePts; pt++)
+   {
+      Integer meshIdx  = transUtil->GetMeshIndex(pt);
+      Integer stageIdx = transUtil->GetStageIndex(pt);
+      PreparePathFunction(meshIdx, stageIdx, tvTypes.at(pt), pt,
+                          pointInputData.at(pt));
+   }
+
+   std::atomic<Integer> next(0);
+   std::vector<std::exception_ptr> errors(numTimePts);
+
+   auto evaluate = [&](UserPathFunctionManager *manager)
+   {
+      for (Integer pt = next++; pt < numTimePts; pt = next++)
+      {
+         try
+         {
+            FunctionInputData *inputData = pointInputData.at(pt);
+            manager->EvaluateUserFunction(inputData, funcData.at(pt));
+            manager->EvaluateUserJacobian(inputData, funcData.at(pt));
+         }
+         catch (...)
+         {
+            errors[pt] = std::current_exception();
+         }
+      }
+   };
+
+   std::vector<std::thread> workers;
+   for (Integer i = 0; i < threadCount - 1; ++i)
+      workers.push_back(std::thread(evaluate, pathFunctionManagers.at(i)));
+   evaluate(pathFunctionManager);
+   for (Integer i = 0; i < workers.size(); ++i)
+      workers[i].join();
+
+   // Report the failure of the earliest point, as the serial loop would
+   for (Integer pt = 0; pt < numTimePts; pt++)
+   {
+      if (errors[pt])
+         std::rethrow_exception(errors[pt]);
+   }
+}
+
+//------------------------------------------------------------------------------
+// bool CreatePathFunctionWorkers(Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Makes sure there are count clones of the path function, each with its own
+ * function manager, for the worker threads.
+ *
+ * @param <count>  the number of worker threads
+ *
+ * @return true if the workers are available; false if the path function
+ *         cannot be cloned, in which case the evaluation stays serial
+ *
+ */
+//------------------------------------------------------------------------------
+bool Phase::CreatePathFunctionWorkers(Integer count)
+{
+   if (serialPathFunction)
+      return false;
+
+   while (pathFunctionManagers.size() < count)
+   {
+      UserPathFunction *clone = pathFunction->Clone();
+      if (!clone)
+      {
+         MessageInterface::ShowMessage(
+               "*** WARNING *** The path function of phase %d cannot be "
+               "cloned; its points are evaluated on a single thread\n",
+               phaseNum);
+         serialPathFunction = true;
+         return false;
+      }
+      UserPathFunctionManager *manager =
+            new UserPathFunctionManager(*pathFunctionManager);
+      manager->SetUserFunction(clone);
+      pathFunctionClones.push_back(clone);
+      pathFunctionManagers.push_back(manager);
+   }
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void ClearPathFunctionWorkers()
+//------------------------------------------------------------------------------
+/**
+ * Deletes the path function clones, managers and input data used by the
+ * worker threads.
+ *
+ */
+//------------------------------------------------------------------------------
+void Phase::ClearPathFunctionWorkers()
+{
+   for (Integer i = 0; i < pathFunctionManagers.size(); ++i)
+      delete pathFunctionManagers.at(i);
+   pathFunctionManagers.clear();
+   for (Integer i = 0; i < pathFunctionClones.size(); ++i)
+      delete pathFunctionClones.at(i);
+   pathFunctionClones.clear();
+   for (Integer i = 0; i < pointInputData.size(); ++i)
+      delete pointInputData.at(i);
+   pointInputData.clear();
+   serialPathFunction = false;
+}
+
+//------------------------------------------------------------------------------
+// void GetWarmStartLayout(std::vector<IntegerArray> &seriesIdxs,
+//                         std::vector<RealArray>    &seriesTimes)
+//------------------------------------------------------------------------------
+/**
+ * Splits the phase decision variables and constraints into series of values
+ * of one quantity along the phase, for the current mesh.  Indexes below the
+ * number of decision variables are decision vector indexes; the others are
+ * constraint indexes offset by the number of decision variables.
+ *
+ * Defect constraint rows are ordered by point, then by state; algebraic path
+ * constraint rows by point, then by function.
+ *
+ * @param <seriesIdxs>   output - the indexes of each series
+ * @param <seriesTimes>  output - the normalized times of the series points
+ */
+//------------------------------------------------------------------------------
+void Phase::GetWarmStartLayout(std::vector<IntegerArray> &seriesIdxs,
+                               std::vector<RealArray>    &seriesTimes)
+{
+   seriesIdxs.clear();
+   seriesTimes.clear();
+   if (!decVector || !transUtil)
+      return;
+
+   Rvector timeVector = transUtil->GetTimeVector();
+   Integer numTimePts = timeVector.GetSize();
+   Integer numDec     = GetNumDecisionVarsNLP();
+   if (numTimePts < 1)
+      return;
+
+   RealArray pointTimes(numTimePts, 0.0);
+   Real     duration = timeVector(numTimePts - 1) - timeVector(0);
+   for (Integer pt = 0; pt < numTimePts; ++pt)
+   {
+      if (duration != 0.0)
+         pointTimes[pt] = (timeVector(pt) - timeVector(0)) / duration;
+      else if (numTimePts > 1)
+         pointTimes[pt] = Real(pt) / Real(numTimePts - 1);
+   }
+
+   // State and control series; a decision variable shared by two points is
+   // assigned to the first one
+   Integer numStates   = config->GetNumStateVars();
+   Integer numControls = config->GetNumControlVars();
+   std::vector<bool> assigned(numDec, false);
+   seriesIdxs.resize(numStates + numControls);
+   seriesTimes.resize(numStates + numControls);
+   for (Integer pt = 0; pt < numTimePts; ++pt)
+   {
+      Integer meshIdx  = transUtil->GetMeshIndex(pt);
+      Integer stageIdx = transUtil->GetStageIndex(pt);
+      IntegerArray stIdxs = decVector->GetStateIdxsAtMeshPoint(meshIdx,
+                                                               stageIdx);
+      IntegerArray clIdxs = decVector->GetControlIdxsAtMeshPoint(meshIdx,
+                                                                 stageIdx);
+      for (Integer ii = 0; ii < (Integer)stIdxs.size() && ii < numStates; ++ii)
+      {
+         Integer idx = stIdxs[ii];
+         if ((idx < 0) || (idx >= numDec) || assigned[idx])
+            continue;
+         assigned[idx] = true;
+         seriesIdxs[ii].push_back(idx);
+         seriesTimes[ii].push_back(pointTimes[pt]);
+      }
+      for (Integer ii = 0; ii < (Integer)clIdxs.size() && ii < numControls;
+           ++ii)
+      {
+         Integer idx = clIdxs[ii];
+         if ((idx < 0) || (idx >= numDec) || assigned[idx])
+            continue;
+         assigned[idx] = true;
+         seriesIdxs[numStates + ii].push_back(idx);
+         seriesTimes[numStates + ii].push_back(pointTimes[pt]);
+      }
+   }
+
+   // Time and static variables map one to one
+   IntegerArray singleIdxs = decVector->GetTimeIdxs();
+   IntegerArray stcIdxs    = decVector->GetStaticIdxs();
+   singleIdxs.insert(singleIdxs.end(), stcIdxs.begin(), stcIdxs.end());
+   for (UnsignedInt ii = 0; ii < singleIdxs.size(); ++ii)
+   {
+      Integer idx = singleIdxs[ii];
+      if ((idx < 0) || (idx >= numDec) || assigned[idx])
+         continue;
+      assigned[idx] = true;
+      seriesIdxs.push_back(IntegerArray(1, idx));
+      seriesTimes.push_back(RealArray(1, 0.0));
+   }
+
+   // Defect constraints, one series per state
+   Integer numDefect = (config->HasDefectCons() ?
+                        defectConEndIdx - defectConStartIdx + 1 : 0);
+   if ((numStates > 0) && (numDefect > 0) && (numDefect % numStates == 0))
+   {
+      Integer numPts = numDefect / numStates;
+      Integer first  = (Integer)seriesIdxs.size();
+      seriesIdxs.resize(first + numStates);
+      seriesTimes.resize(first + numStates);
+      for (Integer pt = 0; pt < numPts; ++pt)
+      {
+         // Collocation points are the leading time points when they number
+         // one per point or one fewer (Radau); otherwise space them evenly
+         Real t = (numPts > 1 ? Real(pt) / Real(numPts - 1) : 0.0);
+         if (numPts <= numTimePts && numPts >= numTimePts - 1)
+            t = pointTimes[pt];
+         for (Integer ii = 0; ii < numStates; ++ii)
+         {
+            seriesIdxs[first + ii].push_back(numDec + defectConStartIdx +
+                                             pt * numStates + ii);
+            seriesTimes[first + ii].push_back(t);
+         }
+      }
+   }
+   else
+   {
+      for (Integer ii = 0; ii < numDefect; ++ii)
+      {
+         seriesIdxs.push_back(IntegerArray(1, numDec + defectConStartIdx + ii));
+         seriesTimes.push_back(RealArray(1, 0.0));
+      }
+   }
+
+   // Algebraic path constraints, one series per function
+   Integer numAlg = (HasAlgPathCons() ? numAlgPathConNLP : 0);
+   if ((numAlg > 0) && (numAlg % numTimePts == 0))
+   {
+      Integer numFuncs = numAlg / numTimePts;
+      Integer first    = (Integer)seriesIdxs.size();
+      seriesIdxs.resize(first + numFuncs);
+      seriesTimes.resize(first + numFuncs);
+      for (Integer pt = 0; pt < numTimePts; ++pt)
+      {
+         for (Integer ii = 0; ii < numFuncs; ++ii)
+         {
+            seriesIdxs[first + ii].push_back(numDec + algPathConStartIdx +
+                                             pt * numFuncs + ii);
+            seriesTimes[first + ii].push_back(pointTimes[pt]);
+         }
+      }
+   }
+   else
+   {
+      for (Integer ii = 0; ii < numAlg; ++ii)
+      {
+         seriesIdxs.push_back(IntegerArray(1, numDec + algPathConStartIdx + ii));
+         seriesTimes.push_back(RealArray(1, 0.0));
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void GetWarmStartWeights(const RealArray &times, RealArray &weights)
+//------------------------------------------------------------------------------
+/**
+ * Computes the normalized time spacing around each point of a warm start
+ * series; multipliers of collocated quantities scale with it.  Series of one
+ * point, or with repeated times, get unit weights.
+ *
+ * @param <times>    the normalized times of the series points
+ * @param <weights>  output - the spacing around each point
+ */
+//------------------------------------------------------------------------------
+void Phase::GetWarmStartWeights(const RealArray &times, RealArray &weights)
+{
+   Integer num = (Integer)times.size();
+   weights.assign(num, 1.0);
+   if (num < 2)
+      return;
+
+   RealArray spacing(num, 0.0);
+   for (Integer k = 0; k < num; ++k)
+   {
+      Real before = (k > 0 ? times[k] - times[k - 1] : 0.0);
+      Real after  = (k < num - 1 ? times[k + 1] - times[k] : 0.0);
+      spacing[k]  = 0.5 * (before + after);
+      if (spacing[k] <= 0.0)
+         return;
+   }
+   weights = spacing;
+}
  
 //------------------------------------------------------------------------------
 // void InsertJacobianRowChunk(const RSMatrix &jacChunk,
-//                             const IntegerArray &idxs)
+//                             const IntegerArray &idxs,
+//                             SparseMatrixUtil::BlockSlots &slots)
 //------------------------------------------------------------------------------
 /**
  * Inserts a chunk into the jacobian
  *
  * @param <jacChunk>   the input jacobian chunk
  * @param <idxs>       the input array of indexes
+ * @param <slots>      the slots of the chunk in the jacobian, reused while
+ *                     the sparsity pattern is unchanged
  *
  */
 //------------------------------------------------------------------------------
 void Phase::InsertJacobianRowChunk(const RSMatrix &jacChunk,
-                                   const IntegerArray &idxs)
+                                   const IntegerArray &idxs,
+                                   SparseMatrixUtil::BlockSlots &slots)
 {
-   SparseMatrixUtil::SetSparseBLockMatrix(nlpConstraintJacobian,
-                                          idxs[0], 0, &jacChunk);
+   SparseMatrixUtil::SetSparseBlockValues(nlpConstraintJacobian,
+                                          idxs[0], 0, &jacChunk, slots);
 }
 
 
@@ -82,6 +82,13 @@ public:
    
    virtual void            SetRelativeErrorTol(Real toNum);
 
+   /// Set the number of threads that evaluate the path functions
+   virtual void            SetNumPathFunctionThreads(Integer toNum);
+   /// Get the number of threads that evaluate the path functions
+   virtual Integer         GetNumPathFunctionThreads();
+   /// Recompute the user functions and quadratures if they are stale
+   void                    CheckFunctions();
+
 
    /// Get the number of state variables
    virtual Integer         GetNumStateVars();
@@ -233,6 +240,17 @@ public:
 
    /// Compute the max interval error of the current mesh
    virtual Rvector ComputeMaxMeshError();
+
+   /// Save multipliers and optimizer states for a warm start on a new mesh
+   virtual void            SaveWarmStartData(const Rvector      &decMul,
+                                             const IntegerArray &decState,
+                                             const Rvector      &conMul,
+                                             const IntegerArray &conState);
+   /// Map the saved warm start data onto the current mesh
+   virtual bool            GetWarmStartData(Rvector      &decMul,
+                                            IntegerArray &decState,
+                                            Rvector      &conMul,
+                                            IntegerArray &conState);
    
    /// Data access and reporting methods
    virtual Rmatrix         GetStateArray();
@@ -284,6 +302,10 @@ protected:
    Real                   costFunctionIntegral;
    /// Sparse Matrix: the jacobian of the NLP constraints  
    RSMatrix               nlpConstraintJacobian;
+   /// Slots of the defect and algebraic path Jacobian chunks in
+   /// nlpConstraintJacobian
+   SparseMatrixUtil::BlockSlots defectJacobianSlots;
+   SparseMatrixUtil::BlockSlots algPathJacobianSlots;
 
    /// Sparse matrix: the Jacbian of the NLP cost (algebraic + quadrature)
    RSMatrix               nlpCostJacobian;
@@ -361,6 +383,17 @@ protected:
    UserPathFunctionManager              *pathFunctionManager;
    /// Input data for user path functions
    FunctionInputData                    *pathFunctionInputData;
+   /// Number of threads evaluating the path functions; 1 evaluates them on
+   /// the calling thread only, 0 uses one thread per hardware thread
+   Integer                              numPathFunctionThreads;
+   /// Clones of the path function, one for each thread after the first
+   std::vector<UserPathFunction*>       pathFunctionClones;
+   /// Copies of the path function manager that evaluate the clones
+   std::vector<UserPathFunctionManager*> pathFunctionManagers;
+   /// Input data for each time point, used when evaluating on threads
+   std::vector<FunctionInputData*>      pointInputData;
+   /// Flag set when the path function cannot be cloned
+   bool                                 serialPathFunction;
    /// GuessGenerator.  Helper class for computing the intitial guess
    GuessGenerator                       *guessGen;
    /// NLPFuncUtil_AlgPath object.  Helper for NLP functions/Jacobian
@@ -380,6 +413,15 @@ protected:
    ///  Relative error tolerance.  Pass to transUtil Object, Not used by phase
    Real relativeErrorTol;
 
+   /// Warm start data saved before mesh refinement, one entry per series of
+   /// multipliers (a state, control or static variable, a time, a defect
+   /// component or an algebraic path function): the normalized times of the
+   /// series points, the multipliers per unit normalized time, and the
+   /// optimizer states
+   std::vector<RealArray>               warmStartTimes;
+   std::vector<RealArray>               warmStartDensities;
+   std::vector<IntegerArray>            warmStartStates;
+
 
    void     InitializePathFunctionInputData();
    void     IntializeJacobians();
@@ -387,9 +429,15 @@ protected:
    void     PrepareForMeshRefinement();
    void     InitializeDecisionVector();
 
-   void     CheckFunctions();
    void     ComputeUserFunctions();
    void     ComputePathFunctions();
+   void     EvaluatePathFunctions(const IntegerArray &tvTypes);
+   bool     CreatePathFunctionWorkers(Integer count);
+   void     ClearPathFunctionWorkers();
+   void     GetWarmStartLayout(std::vector<IntegerArray> &seriesIdxs,
+                               std::vector<RealArray>    &seriesTimes);
+   static void
+            GetWarmStartWeights(const RealArray &times, RealArray &weights);
    void     ComputeSparsityPattern();
    void     SetProblemCharacteristics();
    void     InitializeUserFunctions();
@@ -401,10 +449,12 @@ protected:
    void     SetPathConstraintBounds();
    void     SetInitialGuessFromGuessGen();
    void     PreparePathFunction(Integer meshIdx,Integer stageIdx,
-                                Integer pointType, Integer pointIdx);
+                                Integer pointType, Integer pointIdx,
+                                FunctionInputData *inputData = NULL);
    
    void     InsertJacobianRowChunk(const RSMatrix &jacChunk,
-                                   const IntegerArray &idxs);
+                                   const IntegerArray &idxs,
+                                   SparseMatrixUtil::BlockSlots &slots);
 
    void     CopyArrays(const Phase &copy);
 
@@ -55,8 +55,11 @@ SnoptOptimizer::SnoptOptimizer(const SnoptOptimizer &copy) :
    stopOptimization(copy.stopOptimization),
    totalNumIter(copy.totalNumIter),
    totalNumMajorIter(copy.totalNumMajorIter),
-   objFinalVal(copy.objFinalVal)
-
+   objFinalVal(copy.objFinalVal),
+   warmXState(copy.warmXState),
+   warmFState(copy.warmFState),
+   finalXState(copy.finalXState),
+   finalFState(copy.finalFState)
 {
 }
 
@@ -76,6 +79,10 @@ SnoptOptimizer& SnoptOptimizer::operator=(const SnoptOptimizer &copy)
    totalNumIter = copy.totalNumIter;
    totalNumMajorIter = copy.totalNumMajorIter;
    objFinalVal = copy.objFinalVal;
+   warmXState = copy.warmXState;
+   warmFState = copy.warmFState;
+   finalXState = copy.finalXState;
+   finalFState = copy.finalFState;
 
    return *this;   
 }
@@ -284,6 +291,44 @@ void SnoptOptimizer::SetCurrentIterationData(Integer iterCount,
    objFinalVal = objValue;
 }
 
+//------------------------------------------------------------------------------
+// void SetWarmStart(const IntegerArray &xState, const IntegerArray &fState)
+//------------------------------------------------------------------------------
+/**
+ * Requests a warm start for the next call to Optimize
+ *
+ * The multipliers passed to Optimize are used as the initial multiplier
+ * estimates, and the states set here as the initial SNOPT basis.  The data is
+ * used once; if its sizes do not match the next problem, SNOPT cold starts.
+ *
+ * @param xState the SNOPT states of the decision variables
+ * @param fState the SNOPT states of the objective and constraint functions
+ */
+ //------------------------------------------------------------------------------
+void SnoptOptimizer::SetWarmStart(const IntegerArray &xState,
+                                  const IntegerArray &fState)
+{
+   warmXState = xState;
+   warmFState = fState;
+}
+
+//------------------------------------------------------------------------------
+// void GetFinalStates(IntegerArray &xState, IntegerArray &fState)
+//------------------------------------------------------------------------------
+/**
+ * Returns the SNOPT states of the variables and functions at the end of the
+ * last call to Optimize
+ *
+ * @param xState the SNOPT states of the decision variables
+ * @param fState the SNOPT states of the objective and constraint functions
+ */
+ //------------------------------------------------------------------------------
+void SnoptOptimizer::GetFinalStates(IntegerArray &xState, IntegerArray &fState)
+{
+   xState = finalXState;
+   fState = finalFState;
+}
+
 //------------------------------------------------------------------------------
 // void Optimize(Rvector       &decVec,   const Rvector  &decVecLB,
 //               const Rvector &decVecUB, const Rvector  &funLB,
@@ -387,6 +432,28 @@ void SnoptOptimizer::Optimize(Rvector       &decVec, const Rvector  &decVecLB,
         F_localUB[ii] = funUB[ii];
     }
 
+    // Warm start from the states and multipliers of a related problem, e.g.
+    // the solution on the previous mesh, when they fit this problem
+    SNOPT_INTEGER startType = 0;
+    if ((warmXState.size() == (UnsignedInt)decVec.GetSize()) &&
+        (warmFState.size() == (UnsignedInt)F.GetSize()) &&
+        (xmul.GetSize() == decVec.GetSize()) && (Fmul.GetSize() == F.GetSize()))
+    {
+        for (Integer ii = 0; ii < decVec.GetSize(); ii++)
+        {
+            xmul_local[ii] = xmul[ii];
+            xstate[ii] = warmXState[ii];
+        }
+        for (Integer ii = 0; ii < F.GetSize(); ii++)
+        {
+            Fmul_local[ii] = Fmul[ii];
+            Fstate[ii] = warmFState[ii];
+        }
+        startType = 2;
+    }
+    warmXState.clear();
+    warmFState.clear();
+
     // Pass pointers to SNOPT for the decision vector and its bounds
     Problem.setX(x.data(), xLB.data(), xUB.data(),
         xmul_local.data(), xstate.data());
@@ -443,7 +510,10 @@ void SnoptOptimizer::Optimize(Rvector       &decVec, const Rvector  &decVecLB,
     Problem.setUserR((SNOPT_DOUBLE*)this, 500);
 
     // Run SNOPT and store the exit code
-    SNOPT_INTEGER snoptExitFlag = Problem.solve(0); 
+    SNOPT_INTEGER snoptExitFlag = Problem.solve(startType);
+
+    finalXState.assign(xstate.begin(), xstate.end());
+    finalFState.assign(Fstate.begin(), Fstate.end());
 
     // Put the std::vector data back into the Rvectors
     for (Integer ii = 0; ii < decVec.GetSize(); ii++)
@@ -62,6 +62,9 @@ public:
    virtual void SetSnoptConsoleOutputLevel(const Integer level);
    virtual void SetCurrentIterationData(Integer iterCount,
       Integer majorIterCount, Real objValue);
+   virtual void SetWarmStart(const IntegerArray &xState,
+                             const IntegerArray &fState);
+   virtual void GetFinalStates(IntegerArray &xState, IntegerArray &fState);
    
 
 
@@ -100,6 +103,12 @@ protected:
    Integer totalNumMajorIter;
    /// The final value of the objective function from the optimizer
    Real objFinalVal;
+   /// Variable and function states for a warm start of the next Optimize
+   IntegerArray warmXState;
+   IntegerArray warmFState;
+   /// Variable and function states at the end of the last Optimize
+   IntegerArray finalXState;
+   IntegerArray finalFState;
    
 //   Real        feasibilityTol;
 //   Real        majorOptimalityTol;
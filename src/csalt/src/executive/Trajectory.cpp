@@ -14,6 +14,9 @@
  * From original MATLAB prototype:
  */
 //------------------------------------------------------------------------------
+#include <atomic>
+#include <exception>
+#include <thread>
 #include "SnoptOptimizer.hpp"
 #include "Trajectory.hpp"
 #include "MessageInterface.hpp"
@@ -75,6 +78,9 @@ Trajectory::Trajectory() :
    isMeshRefining         (false),
    meshRefinementCount    (0),
    allowFailedMeshOptimizations(false),
+   warmStartMeshRefinement(false),
+   hasMeshWarmStart       (false),
+   numPhaseThreads        (1),
    meshGuessMode          ("LastSolutionMostRecentMesh"),
    guessMaxConViol        (std::numeric_limits<Real>::infinity()),
    guessCostVal           (std::numeric_limits<Real>::infinity()),
@@ -125,6 +131,9 @@ Trajectory::Trajectory(const Trajectory &copy) :
    isMeshRefining         (copy.isMeshRefining),
    meshRefinementCount    (copy.meshRefinementCount),
    allowFailedMeshOptimizations(copy.allowFailedMeshOptimizations),
+   warmStartMeshRefinement(copy.warmStartMeshRefinement),
+   hasMeshWarmStart       (false),
+   numPhaseThreads        (copy.numPhaseThreads),
    meshGuessMode          (copy.meshGuessMode),
    guessMaxConViol        (copy.guessMaxConViol),
    guessCostVal           (copy.guessCostVal),
@@ -181,6 +190,9 @@ Trajectory& Trajectory::operator=(const Trajectory &copy)
    isMeshRefining         = copy.isMeshRefining;
    meshRefinementCount    = copy.meshRefinementCount;
    allowFailedMeshOptimizations = copy.allowFailedMeshOptimizations;
+   warmStartMeshRefinement = copy.warmStartMeshRefinement;
+   hasMeshWarmStart       = false;
+   numPhaseThreads        = copy.numPhaseThreads;
    meshGuessMode          = copy.meshGuessMode;
    guessMaxConViol        = copy.guessMaxConViol;
    guessCostVal           = copy.guessCostVal;
@@ -197,6 +209,8 @@ Trajectory& Trajectory::operator=(const Trajectory &copy)
    if (trajOptimizer)
       delete trajOptimizer;
    trajOptimizer        = new SnoptOptimizer(this);
+   // The clones copy the old path function
+   ClearPhasePathFunctions();
    CopyArrays(copy);
 
    return *this;
@@ -254,6 +268,7 @@ Trajectory::~Trajectory()
       #endif
       delete scaleHelper;
    }
+   ClearPhasePathFunctions();
 
    #ifdef DEBUG_DECONSTRUCT
       std::cout << "  exiting destructor for Trajectory!\n";
@@ -993,6 +1008,10 @@ void Trajectory::Optimize(Rvector &decVec,
       }
       
       bool ifUpdateMeshInterval = true;
+      // Save the multipliers before the phases change their meshes
+      if (warmStartMeshRefinement)
+         SaveMeshWarmStart(xmul, Fmul);
+
       // Check to see if mesh refinement is required
       if (meshRefinementCount == maxMeshRefinementCount)
          ifUpdateMeshInterval = false;
@@ -1047,6 +1066,8 @@ void Trajectory::Optimize(Rvector &decVec,
          F.SetSize(allConVec.GetSize());
          xmul.SetSize(dvSz);
          Fmul.SetSize(allConVec.GetSize());
+         if (warmStartMeshRefinement)
+            PrepareMeshWarmStart(xmul, Fmul);
 
          #ifdef DEBUG_SPARSITY
             RSMatrix  tmpData = GetJacobian();
@@ -1159,7 +1180,16 @@ RSMatrix Trajectory::GetJacobian()
    Integer funcIdxHigh = 0;
    RSMatrix jac = SparseMatrixUtil::GetSparsityPattern(&sparsityPattern, true);
    
+   // The blocks are written into slots of the pattern found on the first call
+   if (phaseConJacobianSlots.size() != numPhases)
+   {
+      phaseCostJacobianSlots.clear();
+      phaseConJacobianSlots.clear();
+      phaseCostJacobianSlots.resize(numPhases);
+      phaseConJacobianSlots.resize(numPhases);
+   }
 
+   ComputePhaseFunctions();
    for (Integer phaseIdx = 0; phaseIdx < numPhases; phaseIdx++)
    {
       // Plus one is for cost function offset.
@@ -1169,11 +1199,11 @@ RSMatrix Trajectory::GetJacobian()
       // @todo need validation of matrix sizes here!
 
       RSMatrix tmpMatrix = phaseList.at(phaseIdx)->GetCostJacobian();
-      SparseMatrixUtil::SetSparseBLockMatrix(jac, 0, colLow,
-                                             &tmpMatrix);
+      SparseMatrixUtil::SetSparseBlockValues(jac, 0, colLow, &tmpMatrix,
+                                             phaseCostJacobianSlots[phaseIdx]);
       RSMatrix tmpMatrix2 = phaseList.at(phaseIdx)->GetConJacobian();
-      SparseMatrixUtil::SetSparseBLockMatrix(jac, rowLow, colLow,
-                                 &tmpMatrix2);
+      SparseMatrixUtil::SetSparseBlockValues(jac, rowLow, colLow, &tmpMatrix2,
+                                             phaseConJacobianSlots[phaseIdx]);
 
 
       // move out the point function lines out of the loop. YK 2017.09.26
@@ -1194,7 +1224,8 @@ RSMatrix Trajectory::GetJacobian()
       std::vector<Real> valueVec;
       RSMatrix tmpMatrix3 = pointFunctionManager->ComputeBoundNLPJacobian();
 
-      SparseMatrixUtil::SetSparseBLockMatrix(jac, funcIdxLow, 0, &tmpMatrix3);
+      SparseMatrixUtil::SetSparseBlockValues(jac, funcIdxLow, 0, &tmpMatrix3,
+                                             boundJacobianSlots);
       /*
       SparseMatrixUtil::GetThreeVectorForm(
          &tmpMatrix3,
@@ -1237,6 +1268,7 @@ Rvector Trajectory::GetCostConstraintFunctions()
    if (csaltExecInterface) 
 	   csaltExecInterface->Publish(csaltState);
    
+   ComputePhaseFunctions();
    Rvector conVec     = GetConstraintVector();
    Real    costFun    = GetCostFunction();
    Integer conVecSize = conVec.GetSize();
@@ -2230,6 +2262,22 @@ void Trajectory::SetFailedMeshOptimizationAllowance(bool toAllowance)
    allowFailedMeshOptimizations = toAllowance;
 }
 
+//------------------------------------------------------------------------------
+// void SetMeshRefinementWarmStart(bool toWarmStart)
+//------------------------------------------------------------------------------
+/**
+* Sets whether the optimization on a refined mesh is warm started from the
+* multipliers and optimizer states of the previous mesh
+*
+* @param <toWarmStart>   the new warm start setting
+*
+*/
+//------------------------------------------------------------------------------
+void Trajectory::SetMeshRefinementWarmStart(bool toWarmStart)
+{
+   warmStartMeshRefinement = toWarmStart;
+}
+
 //------------------------------------------------------------------------------
 // void SetCostScaling(Real toScaling)
 //------------------------------------------------------------------------------
@@ -2245,6 +2293,42 @@ void Trajectory::SetCostScaling(Real toScaling)
    costScaling = toScaling;
 }
 
+//------------------------------------------------------------------------------
+// void SetNumPhaseThreads(Integer toNum)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of threads that evaluate the phases on each function call.
+ * The default, 1, evaluates the phases in turn.  More threads need a path
+ * function that supports UserPathFunction::Clone(); the setting takes effect
+ * when the phases are initialized.
+ *
+ * @param <toNum>   the number of threads; 0 uses one per hardware thread
+ *
+ */
+//------------------------------------------------------------------------------
+void Trajectory::SetNumPhaseThreads(Integer toNum)
+{
+   if (toNum < 0)
+      throw LowThrustException("ERROR setting the number of phase threads "
+                               "on Trajectory: the value is negative!\n");
+   numPhaseThreads = toNum;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumPhaseThreads()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of threads that evaluate the phases
+ *
+ * @return the number of threads; 0 for one per hardware thread
+ *
+ */
+//------------------------------------------------------------------------------
+Integer Trajectory::GetNumPhaseThreads()
+{
+   return numPhaseThreads;
+}
+
 
 
 //------------------------------------------------------------------------------
@@ -2872,6 +2956,9 @@ void Trajectory::CopyArrays(const Trajectory &copy)
    sparsityCost = SparseMatrixUtil::CopySparseMatrix(&copy.sparsityCost);
    sparsityConstraints = SparseMatrixUtil::CopySparseMatrix(&copy.sparsityConstraints);
    sparsityPattern = SparseMatrixUtil::CopySparseMatrix(&copy.sparsityPattern);
+   phaseCostJacobianSlots.clear();
+   phaseConJacobianSlots.clear();
+   boundJacobianSlots.Clear();
    
    whichStateVar.clear();
    for (UnsignedInt ii = 0; ii < copy.whichStateVar.size(); ii++)
@@ -2886,6 +2973,110 @@ void Trajectory::CopyArrays(const Trajectory &copy)
       bestFeasibleDecVec.push_back(copy.bestFeasibleDecVec.at(ii));
 }
 
+//------------------------------------------------------------------------------
+// void CreatePhasePathFunctions()
+//------------------------------------------------------------------------------
+/**
+ * Gives each phase after the first its own clone of the path function when the
+ * phases are evaluated on more than one thread, so that no two threads call
+ * the same function object.  If the path function cannot be cloned, all phases
+ * share it and are evaluated in turn.
+ *
+ */
+//------------------------------------------------------------------------------
+void Trajectory::CreatePhasePathFunctions()
+{
+   ClearPhasePathFunctions();
+   if ((numPhaseThreads == 1) || (numPhases <= 1))
+      return;
+
+   for (Integer phaseIdx = 1; phaseIdx < numPhases; phaseIdx++)
+   {
+      UserPathFunction *clone = pathFunction->Clone();
+      if (!clone)
+      {
+         MessageInterface::ShowMessage(
+               "*** WARNING *** The path function cannot be cloned; the "
+               "phases are evaluated on a single thread\n");
+         ClearPhasePathFunctions();
+         return;
+      }
+      phasePathFunctions.push_back(clone);
+   }
+}
+
+//------------------------------------------------------------------------------
+// void ClearPhasePathFunctions()
+//------------------------------------------------------------------------------
+/**
+ * Deletes the path function clones used by the phases after the first
+ *
+ */
+//------------------------------------------------------------------------------
+void Trajectory::ClearPhasePathFunctions()
+{
+   for (UnsignedInt ii = 0; ii < phasePathFunctions.size(); ii++)
+      delete phasePathFunctions.at(ii);
+   phasePathFunctions.clear();
+}
+
+//------------------------------------------------------------------------------
+// void ComputePhaseFunctions()
+//------------------------------------------------------------------------------
+/**
+ * Brings the functions and Jacobians of all phases up to date.  When the phases
+ * have their own path functions they are evaluated concurrently; otherwise
+ * nothing is done here and each phase updates itself when it is queried.
+ * The point functions depend on all phases and are evaluated afterwards, on
+ * the calling thread.
+ *
+ */
+//------------------------------------------------------------------------------
+void Trajectory::ComputePhaseFunctions()
+{
+   if (phasePathFunctions.empty())
+      return;
+
+   Integer threadCount = numPhaseThreads;
+   if (threadCount == 0)
+      threadCount = (Integer) std::thread::hardware_concurrency();
+   if (threadCount > numPhases)
+      threadCount = numPhases;
+
+   std::atomic<Integer> next(0);
+   std::vector<std::exception_ptr> errors(numPhases);
+
+   auto evaluate = [&]()
+   {
+      for (Integer phaseIdx = next++; phaseIdx < numPhases;
+           phaseIdx = next++)
+      {
+         try
+         {
+            phaseList.at(phaseIdx)->CheckFunctions();
+         }
+         catch (...)
+         {
+            errors[phaseIdx] = std::current_exception();
+         }
+      }
+   };
+
+   std::vector<std::thread> workers;
+   for (Integer ii = 0; ii < threadCount - 1; ++ii)
+      workers.push_back(std::thread(evaluate));
+   evaluate();
+   for (UnsignedInt ii = 0; ii < workers.size(); ++ii)
+      workers[ii].join();
+
+   // Report the failure of the earliest phase, as the serial loop would
+   for (Integer phaseIdx = 0; phaseIdx < numPhases; phaseIdx++)
+   {
+      if (errors[phaseIdx])
+         std::rethrow_exception(errors[phaseIdx]);
+   }
+}
+
 //------------------------------------------------------------------------------
 // void InitializePhases()
 //------------------------------------------------------------------------------
@@ -2928,6 +3119,7 @@ void    Trajectory::InitializePhases()
       phaseScaleUtils.push_back(phaseList.at(ii)->GetScaleUtility());
    pathFunction->SetPhaseScaleUtilList(phaseScaleUtils);
    pointFunction->SetPhaseScaleUtilList(phaseScaleUtils);
+   CreatePhasePathFunctions();
 
    // Define an index to track location in the constraint vector
    Integer constraintStartIdx = 0;
@@ -2959,7 +3151,10 @@ void    Trajectory::InitializePhases()
        currentPhase->Initialize();
        */
       //   currentPhase->SetGuessFunctionName(guessFunctionName);
-      currentPhase->SetPathFunction(pathFunction);
+      if ((phaseIdx > 0) && !phasePathFunctions.empty())
+         currentPhase->SetPathFunction(phasePathFunctions.at(phaseIdx - 1));
+      else
+         currentPhase->SetPathFunction(pathFunction);
 #ifdef DEBUG_TRAJECTORY_INIT
       MessageInterface::ShowMessage("------- now calling initialize on phase\n");
       std::cout << "------- now calling initialize on phase\n";
@@ -3267,6 +3462,9 @@ void    Trajectory::SetSparsityPattern()
                              totalNumDecisionParams);
    SparseMatrixUtil::SetSize(sparsityPattern, 1+totalNumConstraints,
                              totalNumDecisionParams);
+   phaseCostJacobianSlots.clear();
+   phaseConJacobianSlots.clear();
+   boundJacobianSlots.Clear();
    
    // Handle the path constraints
    for (Integer phaseIdx = 0; phaseIdx < numPhases; phaseIdx++)
@@ -3512,3 +3710,130 @@ void Trajectory::ResetBestFeasibleSolution()
    ComputeMaxConstraintViolation(maxConViol, costVal);
    bestCostCurrMesh = costVal;
 }
+
+//------------------------------------------------------------------------------
+// void SaveMeshWarmStart(const Rvector &xmul, const Rvector &Fmul)
+//------------------------------------------------------------------------------
+/**
+ * Saves the multipliers and optimizer states of the last optimization, so
+ * that the optimization on the refined mesh can be warm started.  Nothing is
+ * saved if the optimization did not succeed.
+ *
+ * @param <xmul>   the multipliers of the decision vector bounds
+ * @param <Fmul>   the multipliers of the cost and constraint functions
+ */
+//------------------------------------------------------------------------------
+void Trajectory::SaveMeshWarmStart(const Rvector &xmul, const Rvector &Fmul)
+{
+   hasMeshWarmStart = false;
+   if (GetSimplifiedSNOPTExitFlag(optExitFlag) != 1)
+      return;
+
+   IntegerArray xState, fState;
+   trajOptimizer->GetFinalStates(xState, fState);
+   if ((xState.size() != (UnsignedInt)xmul.GetSize()) ||
+       (fState.size() != (UnsignedInt)Fmul.GetSize()) ||
+       (Fmul.GetSize() != totalNumConstraints + 1))
+      return;
+
+   for (Integer phaseIdx = 0; phaseIdx < numPhases; phaseIdx++)
+   {
+      Integer decLow = decVecStartIdx.at(phaseIdx);
+      Integer numDec = decVecEndIdx.at(phaseIdx) - decLow + 1;
+      Integer conLow = conPhaseStartIdx.at(phaseIdx) + 1;
+      Integer numCon = numPhaseConstraints.at(phaseIdx);
+
+      Rvector      decMul(numDec), conMul(numCon);
+      IntegerArray decState(numDec), conState(numCon);
+      for (Integer ii = 0; ii < numDec; ii++)
+      {
+         decMul(ii)   = xmul(decLow + ii);
+         decState[ii] = xState[decLow + ii];
+      }
+      for (Integer ii = 0; ii < numCon; ii++)
+      {
+         conMul(ii)   = Fmul(conLow + ii);
+         conState[ii] = fState[conLow + ii];
+      }
+      phaseList.at(phaseIdx)->SaveWarmStartData(decMul, decState,
+                                                conMul, conState);
+   }
+
+   // The cost and the boundary functions do not depend on the mesh
+   warmStartPointMul.SetSize(numBoundFunctions + 1);
+   warmStartPointState.assign(numBoundFunctions + 1, 0);
+   warmStartPointMul(0)   = Fmul(0);
+   warmStartPointState[0] = fState[0];
+   Integer funcIdxLow = totalNumConstraints - numBoundFunctions + 1;
+   for (Integer ii = 0; ii < numBoundFunctions; ii++)
+   {
+      warmStartPointMul(ii + 1)   = Fmul(funcIdxLow + ii);
+      warmStartPointState[ii + 1] = fState[funcIdxLow + ii];
+   }
+   hasMeshWarmStart = true;
+}
+
+//------------------------------------------------------------------------------
+// bool PrepareMeshWarmStart(Rvector &xmul, Rvector &Fmul)
+//------------------------------------------------------------------------------
+/**
+ * Maps the data saved by SaveMeshWarmStart onto the refined mesh and passes
+ * the optimizer states to the optimizer, so its next run is warm started.
+ *
+ * @param <xmul>   output - the multipliers of the decision vector bounds
+ * @param <Fmul>   output - the multipliers of the cost and constraint
+ *                 functions
+ *
+ * @return true if the next optimization is warm started
+ */
+//------------------------------------------------------------------------------
+bool Trajectory::PrepareMeshWarmStart(Rvector &xmul, Rvector &Fmul)
+{
+   if (!hasMeshWarmStart)
+      return false;
+   hasMeshWarmStart = false;
+
+   if ((xmul.GetSize() != totalNumDecisionParams) ||
+       (Fmul.GetSize() != totalNumConstraints + 1) ||
+       (warmStartPointMul.GetSize() != numBoundFunctions + 1))
+      return false;
+
+   IntegerArray xState(totalNumDecisionParams, 0);
+   IntegerArray fState(totalNumConstraints + 1, 0);
+   for (Integer phaseIdx = 0; phaseIdx < numPhases; phaseIdx++)
+   {
+      Rvector      decMul, conMul;
+      IntegerArray decState, conState;
+      if (!phaseList.at(phaseIdx)->GetWarmStartData(decMul, decState,
+                                                    conMul, conState))
+         return false;
+
+      Integer decLow = decVecStartIdx.at(phaseIdx);
+      Integer conLow = conPhaseStartIdx.at(phaseIdx) + 1;
+      if ((decMul.GetSize() != decVecEndIdx.at(phaseIdx) - decLow + 1) ||
+          (conMul.GetSize() != numPhaseConstraints.at(phaseIdx)))
+         return false;
+      for (Integer ii = 0; ii < decMul.GetSize(); ii++)
+      {
+         xmul(decLow + ii)   = decMul(ii);
+         xState[decLow + ii] = decState[ii];
+      }
+      for (Integer ii = 0; ii < conMul.GetSize(); ii++)
+      {
+         Fmul(conLow + ii)   = conMul(ii);
+         fState[conLow + ii] = conState[ii];
+      }
+   }
+
+   Fmul(0)   = warmStartPointMul(0);
+   fState[0] = warmStartPointState[0];
+   Integer funcIdxLow = totalNumConstraints - numBoundFunctions + 1;
+   for (Integer ii = 0; ii < numBoundFunctions; ii++)
+   {
+      Fmul(funcIdxLow + ii)   = warmStartPointMul(ii + 1);
+      fState[funcIdxLow + ii] = warmStartPointState[ii + 1];
+   }
+
+   trajOptimizer->SetWarmStart(xState, fState);
+   return true;
+}
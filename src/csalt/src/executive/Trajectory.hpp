@@ -125,7 +125,10 @@ public:
                                                const std::string &toGuessMode);
    virtual void                SetFailedMeshOptimizationAllowance(
                                                bool toAllowance);
+   virtual void                SetMeshRefinementWarmStart(bool toWarmStart);
    virtual void                SetCostScaling(Real toScaling);
+   virtual void                SetNumPhaseThreads(Integer toNum);
+   virtual Integer             GetNumPhaseThreads();
    virtual void                SetInitialGuess();
    
    /// Methods to set SNOPT inputs
@@ -262,6 +265,14 @@ protected:
    /// The sparsity pattern for the complete problem including cost and
    /// constraints.
    RSMatrix            sparsityPattern;
+   /// Slots of the phase and boundary function Jacobian blocks in the
+   /// Jacobian built on sparsityPattern
+   std::vector<SparseMatrixUtil::BlockSlots>
+                       phaseCostJacobianSlots;
+   std::vector<SparseMatrixUtil::BlockSlots>
+                       phaseConJacobianSlots;
+   SparseMatrixUtil::BlockSlots
+                       boundJacobianSlots;
    /// // YK mod IPOPT; hessian pattern
    RSMatrix            hessianPattern;
                      
@@ -300,6 +311,21 @@ protected:
    /// Flag indicating whether or not to continue with mesh refinement even
    /// if a previous optimization failed
    bool                     allowFailedMeshOptimizations;
+   /// Flag indicating whether the optimizer is warm started on a refined
+   /// mesh from the multipliers of the previous mesh
+   bool                     warmStartMeshRefinement;
+   /// Flag set when multipliers of the previous mesh have been saved
+   bool                     hasMeshWarmStart;
+   /// The number of threads evaluating the phases; 1 evaluates them in turn
+   /// and 0 uses one per hardware thread
+   Integer                  numPhaseThreads;
+   /// Clones of the path function for the phases after the first, used when
+   /// the phases are evaluated concurrently; empty otherwise
+   std::vector<UserPathFunction*> phasePathFunctions;
+   /// Multipliers and optimizer states of the cost and boundary functions,
+   /// saved before mesh refinement
+   Rvector                  warmStartPointMul;
+   IntegerArray             warmStartPointState;
    /// Indicates which method to use to create an initial guess for the next
    /// mesh refinement
    std::string              meshGuessMode;
@@ -347,6 +373,9 @@ protected:
    virtual void             CopyArrays(const Trajectory &copy);
    
    virtual void             InitializePhases();
+   virtual void             CreatePhasePathFunctions();
+   virtual void             ClearPhasePathFunctions();
+   virtual void             ComputePhaseFunctions();
    virtual Rvector          GetConstraintVector();
    virtual Real             GetCostFunction();
    virtual void             SetChunkIndexes();
@@ -358,6 +387,9 @@ protected:
    virtual void             SetSNOPTIterationDependentSettings(Integer iterNum);
 
    virtual void             ResetBestFeasibleSolution();
+   virtual void             SaveMeshWarmStart(const Rvector &xmul,
+                                              const Rvector &Fmul);
+   virtual bool             PrepareMeshWarmStart(Rvector &xmul, Rvector &Fmul);
 };
 
 #endif // Trajectory_hpp
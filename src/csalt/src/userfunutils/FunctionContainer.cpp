@@ -95,6 +95,22 @@ void FunctionContainer::Initialize()
 }
 
 
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * This method resets the function data so the container can be reused for
+ * another evaluation
+ *
+ */
+//------------------------------------------------------------------------------
+void FunctionContainer::Reset()
+{
+   if (costData) costData->Reset();
+   if (algData)  algData->Reset();
+}
+
+
 //------------------------------------------------------------------------------
 // FunctionOutputData* GetCostData()
 //------------------------------------------------------------------------------
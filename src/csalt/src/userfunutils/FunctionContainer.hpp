@@ -41,6 +41,8 @@ public:
    
    // Intialize the object <abstract>
    virtual void                Initialize();
+   // Prepares the data for another evaluation
+   virtual void                Reset();
 
    virtual FunctionOutputData* GetCostData();
    virtual FunctionOutputData* GetAlgData();
@@ -163,6 +163,44 @@ void FunctionInputData::SetControlVector(const Rvector& toControl)
    
 }
 
+//------------------------------------------------------------------------------
+// void SetStateVector(const DecVecView &toState);
+//------------------------------------------------------------------------------
+/**
+ * This method sets the state vector from a view into a decision vector,
+ * reusing the existing storage when the size is unchanged
+ *
+ * @param <toState>    view of the state values
+ *
+ */
+//------------------------------------------------------------------------------
+void FunctionInputData::SetStateVector(const DecVecView &toState)
+{
+   Integer sz = toState.GetSize();
+   if (state.GetSize() != sz)
+      state.SetSize(sz);
+   toState.CopyTo(state);
+}
+
+//------------------------------------------------------------------------------
+// void SetControlVector(const DecVecView &toControl);
+//------------------------------------------------------------------------------
+/**
+ * This method sets the control vector from a view into a decision vector,
+ * reusing the existing storage when the size is unchanged
+ *
+ * @param <toControl>    view of the control values
+ *
+ */
+//------------------------------------------------------------------------------
+void FunctionInputData::SetControlVector(const DecVecView &toControl)
+{
+   Integer sz = toControl.GetSize();
+   if (control.GetSize() != sz)
+      control.SetSize(sz);
+   toControl.CopyTo(control);
+}
+
 //------------------------------------------------------------------------------
 // void SetPhaseNum(Integer toNum);
 //------------------------------------------------------------------------------
@@ -363,6 +401,28 @@ void FunctionInputData::SetStaticVector(const Rvector &toStatic)
    }
 }
 
+//------------------------------------------------------------------------------
+// void SetStaticVector(const DecVecView &toStatic);
+//------------------------------------------------------------------------------
+/**
+* This method sets the static vector from a view into a decision vector,
+* reusing the existing storage when the size is unchanged
+*
+* @param <toStatic>    view of the static values
+*
+*/
+//------------------------------------------------------------------------------
+void FunctionInputData::SetStaticVector(const DecVecView &toStatic)
+{
+   Integer sz = toStatic.GetSize();
+   if (sz > 0)
+   {
+      if (staticVars.GetSize() != sz)
+         staticVars.SetSize(sz);
+      toStatic.CopyTo(staticVars);
+   }
+}
+
 //------------------------------------------------------------------------------
 // const Rvector& GetStaticVector();
 //------------------------------------------------------------------------------
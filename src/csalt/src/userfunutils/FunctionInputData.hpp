@@ -21,6 +21,7 @@
 
 #include "csaltdefs.hpp"
 #include "Rvector.hpp"
+#include "DecisionVector.hpp"
 
 class FunctionInputData
 {
@@ -36,6 +37,8 @@ public:
 
    virtual void           SetStateVector(const Rvector &toState);
    virtual void           SetControlVector(const Rvector& toControl);
+   virtual void           SetStateVector(const DecVecView &toState);
+   virtual void           SetControlVector(const DecVecView &toControl);
    
    virtual void           SetPhaseNum(Integer toNum);
    virtual void           SetIsPerturbing(bool isPerturb);
@@ -54,6 +57,7 @@ public:
 
    // YK mod static params
    virtual void           SetStaticVector(const Rvector& toStatic);
+   virtual void           SetStaticVector(const DecVecView &toStatic);
    virtual const Rvector& GetStaticVector();
    virtual Integer        GetNumStaticVars();
 
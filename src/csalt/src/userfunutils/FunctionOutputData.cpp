@@ -363,6 +363,24 @@ void FunctionOutputData::SetIsInitializing(bool isInit)
    isInitializing = isInit;
 }
 
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * This method returns the flags set by the user function to their values in
+ * a new object, so the object can be reused for another evaluation.  The
+ * function values and Jacobians keep their storage.
+ *
+ */
+//------------------------------------------------------------------------------
+void FunctionOutputData::Reset()
+{
+   hasUserFunction = false;
+   isInitializing  = true;
+   for (UnsignedInt idx1 = 0; idx1 < hasJacobian.size(); idx1++)
+      hasJacobian[idx1] = false;
+}
+
 //------------------------------------------------------------------------------
 // bool SetUpperBounds(const Rvector &toUpper)
 //------------------------------------------------------------------------------
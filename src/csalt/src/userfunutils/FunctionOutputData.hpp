@@ -52,6 +52,8 @@ public:
    virtual void    SetNumFunctions(Integer numFuncs);
    /// Sets initialization flag
    virtual void    SetIsInitializing(bool isInit);
+   /// Resets the flags set by the user function for a new evaluation
+   virtual void    Reset();
    /// Sets the upper bounds
    virtual bool    SetUpperBounds(const Rvector &toUpper);
    /// Sets the lower bounds
@@ -41,6 +41,7 @@ OptimalControlFunction::OptimalControlFunction(std::string functionName) :
    //VU              (1.0),
    //MU              (1.0),
    funcScaleUtil   (NULL),
+   funcUnitRevision(-1),
    dataInitialized (false),
    boundsScaled    (false)
 {
@@ -65,6 +66,7 @@ OptimalControlFunction::OptimalControlFunction(const OptimalControlFunction &cop
    //VU                    (copy.VU),
    //MU                    (copy.MU),
    funcScaleUtil         (NULL), //copy.funcScaleUtil),  GMT-7025
+   funcUnitRevision      (-1),
    dataInitialized       (copy.dataInitialized),
    boundsScaled          (copy.boundsScaled)
 {
@@ -144,6 +146,7 @@ OptimalControlFunction& OptimalControlFunction::operator=(const OptimalControlFu
    //VU                    = copy.VU;
    //MU                    = copy.MU;
    funcScaleUtil         = copy.funcScaleUtil;  // ????
+   funcUnitRevision      = -1;
    dataInitialized       = copy.dataInitialized;
    boundsScaled          = copy.boundsScaled;
 
@@ -448,7 +451,9 @@ void OptimalControlFunction::SetReferenceEpoch(Real referenceEpoch)
 Rvector OptimalControlFunction::GetUnscaledFunctionValues()
 {
    Rvector unscaledFuncs = EvaluateFunctions();
-   unscaledFuncs = funcScaleUtil->UnscaleVector(unscaledFuncs, funcUnitList);
+   CompileFuncUnits();
+   funcScaleUtil->UnscaleVectorInPlace(unscaledFuncs, funcUnitFactors,
+                                       funcUnitShifts);
    return unscaledFuncs;
 }
 
@@ -756,7 +761,11 @@ Rvector OptimalControlFunction::GetUpperBounds()
 //------------------------------------------------------------------------------
 Rvector OptimalControlFunction::GetUnscaledLowerBounds()
 {
-   return funcScaleUtil->UnscaleVector(lowerBounds, funcUnitList);
+   Rvector unscaled(lowerBounds);
+   CompileFuncUnits();
+   funcScaleUtil->UnscaleVectorInPlace(unscaled, funcUnitFactors,
+                                       funcUnitShifts);
+   return unscaled;
 }
 
 //------------------------------------------------------------------------------
@@ -770,7 +779,11 @@ Rvector OptimalControlFunction::GetUnscaledLowerBounds()
 //------------------------------------------------------------------------------
 Rvector OptimalControlFunction::GetUnscaledUpperBounds()
 {
-   return funcScaleUtil->UnscaleVector(upperBounds, funcUnitList);
+   Rvector unscaled(upperBounds);
+   CompileFuncUnits();
+   funcScaleUtil->UnscaleVectorInPlace(unscaled, funcUnitFactors,
+                                       funcUnitShifts);
+   return unscaled;
 }
 
 //------------------------------------------------------------------------------
@@ -1155,6 +1168,26 @@ void OptimalControlFunction::SetFuncScalingUtility(ScalingUtility *scaleUtil)
    if (funcScaleUtil)
       delete funcScaleUtil;
    funcScaleUtil = scaleUtil;
+   funcUnitRevision = -1;
+}
+
+//------------------------------------------------------------------------------
+// void CompileFuncUnits()
+//------------------------------------------------------------------------------
+/*
+* Resolves funcUnitList into factor and shift arrays, so that unscaling the
+* function values does not search the unit maps on every call.  The arrays
+* are rebuilt only when the unit list size or the scaling utility changes.
+*/
+//------------------------------------------------------------------------------
+void OptimalControlFunction::CompileFuncUnits()
+{
+   if ((funcUnitRevision == funcScaleUtil->GetUnitRevision()) &&
+       (funcUnitFactors.size() == funcUnitList.size()))
+      return;
+
+   funcScaleUtil->CompileUnits(funcUnitList, funcUnitFactors, funcUnitShifts);
+   funcUnitRevision = funcScaleUtil->GetUnitRevision();
 }
 
 //------------------------------------------------------------------------------
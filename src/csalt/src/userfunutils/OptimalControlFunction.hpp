@@ -81,6 +81,7 @@ protected:
       Integer pointIdx, bool &hasAnalyticJac, Rmatrix &jacArray);
    void ValidatePointIdx(Integer pointIdx);
    void ValidateFunctionBounds();
+   void CompileFuncUnits();
    virtual bool IsValidPhasePosition(const Integer &phasePos);
 
    /// The name of the algebraic function
@@ -159,6 +160,12 @@ protected:
    StringArray funcUnitList;
    /// The scaling utility used by the function
    ScalingUtility *funcScaleUtil;
+   /// Scale factors for funcUnitList, resolved once by CompileFuncUnits
+   RealArray funcUnitFactors;
+   /// Shifts for funcUnitList, resolved once by CompileFuncUnits
+   RealArray funcUnitShifts;
+   /// Unit revision of funcScaleUtil when the factors were compiled, or -1
+   Integer funcUnitRevision;
    /// List of all phase objects in optimization problem
    std::vector<Phase*> phaseList;
    /// Boolean of whether Jacobian initialization has been completed
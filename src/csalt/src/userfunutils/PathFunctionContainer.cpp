@@ -95,6 +95,22 @@ void PathFunctionContainer::Initialize()
 }
 
 
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * This method resets the function data so the container can be reused for
+ * another evaluation
+ *
+ */
+//------------------------------------------------------------------------------
+void PathFunctionContainer::Reset()
+{
+   FunctionContainer::Reset();
+   if (dynData)  dynData->Reset();
+}
+
+
 //------------------------------------------------------------------------------
 // UserPathFunctionData* GetDynData()
 //------------------------------------------------------------------------------
@@ -42,6 +42,7 @@ public:
    
    // Intialize the object
    virtual void                Initialize();
+   virtual void                Reset();
  
    virtual FunctionOutputData* GetDynData();
 
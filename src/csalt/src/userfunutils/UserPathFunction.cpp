@@ -79,6 +79,23 @@ UserPathFunction::~UserPathFunction()
 //   if (pfContainer)  delete pfContainer;
 }
 
+//------------------------------------------------------------------------------
+//  UserPathFunction* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * This method returns a copy of the user function that can be evaluated on
+ * another thread, at the same time as this one.  Path functions that support
+ * parallel evaluation override it; the default returns NULL, and the phase
+ * then evaluates the function on one thread.
+ *
+ * @return a new copy of the function, or NULL if it cannot be copied
+ */
+//------------------------------------------------------------------------------
+UserPathFunction* UserPathFunction::Clone() const
+{
+   return NULL;
+}
+
 //------------------------------------------------------------------------------
 //  void Initialize(FunctionInputData     *pd,
 //                  PathFunctionContainer *pfc)
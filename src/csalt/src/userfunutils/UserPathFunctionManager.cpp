@@ -100,10 +100,7 @@ UserPathFunctionManager::UserPathFunctionManager(const UserPathFunctionManager &
    jacPattern.clear();
    needsJacobianFiniteDiff.resize(UserFunction::ALLFUNCTIONS, UserFunction::ALLJACOBIANS, isPreserving);
 
-   for (Integer idx2 = UserFunction::STATE; idx2 < UserFunction::ALLJACOBIANS; idx2++)
-   {
-      numVars[idx2] = copy.numVars[idx2];
-   }
+   numVars = copy.numVars;
 
    for (Integer idx1 = UserFunction::DYNAMICS; idx1 < UserFunction::ALLFUNCTIONS; idx1++)
    {
@@ -124,6 +121,8 @@ UserPathFunctionManager::UserPathFunctionManager(const UserPathFunctionManager &
       jacobian.push_back(tmpJacobian);
    }
    
+   columnGroups = copy.columnGroups;
+
    if (copy.algFuncUpperBound.IsSized())
       algFuncUpperBound              = copy.algFuncUpperBound;
    if (copy.algFuncLowerBound.IsSized())
@@ -157,10 +156,7 @@ UserPathFunctionManager& UserPathFunctionManager::operator=(
    jacPattern.clear();
    needsJacobianFiniteDiff.resize(UserFunction::ALLFUNCTIONS, UserFunction::ALLJACOBIANS, isPreserving);
 
-   for (Integer idx2 = UserFunction::STATE; idx2 < UserFunction::ALLJACOBIANS; idx2++)
-   {
-      numVars[idx2] = copy.numVars[idx2];
-   }
+   numVars = copy.numVars;
 
    for (Integer idx1 = UserFunction::DYNAMICS; idx1 < UserFunction::ALLFUNCTIONS; idx1++)
    {
@@ -180,6 +176,7 @@ UserPathFunctionManager& UserPathFunctionManager::operator=(
       jacPattern.push_back(tmpJacPattern);
       jacobian.push_back(tmpJacobian);
    }
+   columnGroups = copy.columnGroups;
    
    if (copy.algFuncUpperBound.IsSized())
    {
@@ -684,6 +681,24 @@ void UserPathFunctionManager::SetFunctionData(PathFunctionContainer *fData)
    pfContainer = fData;
 }
 
+//------------------------------------------------------------------------------
+// void SetUserFunction(UserPathFunction *uData)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the user path function evaluated by an initialized
+ * manager, e.g. on a copy of the manager that evaluates a clone of the
+ * function on another thread
+ *
+ * @param <uData>   the user path function
+ *
+ */
+//------------------------------------------------------------------------------
+void UserPathFunctionManager::SetUserFunction(UserPathFunction *uData)
+{
+   userData    = uData;
+   hasFunction = (uData != NULL);
+}
+
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
@@ -864,6 +879,9 @@ void UserPathFunctionManager::ComputeAll(UserFunction::FunctionType fType,
    if ((!pData) || (!fData))
       throw LowThrustException(
          "ERROR!  fData or pData passed into ComputeStateJacobian is NULL!\n");
+   // Nothing uses the Jacobians of a function type the user does not provide
+   if (!hasFunctions[fType])
+      return;
    // If not initializing and all Jacobians are provided, nothing to do
    if ((!isInitializing) && (!needsJacobianFiniteDiff(fType, UserFunction::STATE))
       && (!needsJacobianFiniteDiff(fType, UserFunction::CONTROL))
@@ -926,14 +944,27 @@ void UserPathFunctionManager::ComputeAll(UserFunction::FunctionType fType,
       for (Integer ii = 0; ii < numVars; ii++)
          pertVector(ii) = 1.0e-07;
 
-      // Loop over state values and perturb them
-
+      // Perturb the columns a group at a time; the columns of a group share
+      // no nonzero rows, so one evaluation gives all of them.  Without the
+      // groups (before the sparsity is known) every column is its own group.
+      std::vector<IntegerArray> groups;
+      if (!isInitializing && (fType < columnGroups.size()))
+         groups = columnGroups[fType][idx1];
+      if (groups.empty())
+      {
+         for (Integer ss = 0; ss < numVars; ss++)
+            groups.push_back(IntegerArray(1, ss));
+      }
+      const Rmatrix &pattern = jacPattern[fType][idx1];
 
-      for (Integer ss = 0; ss < numVars; ss++)
+      for (Integer gg = 0; gg < groups.size(); gg++)
       {
+         const IntegerArray &group = groups[gg];
+
          // Perturb the state and recompute user functions
          Rvector deltaVector(numVars);  // values are zeros by default
-         deltaVector(ss) = pertVector(ss);
+         for (Integer cc = 0; cc < group.size(); cc++)
+            deltaVector(group[cc]) = pertVector(group[cc]);
          if (idx1 == UserFunction::STATE)
             pData->SetStateVector(nomStateVector + deltaVector);
          if (idx1 == UserFunction::CONTROL)
@@ -945,11 +976,21 @@ void UserPathFunctionManager::ComputeAll(UserFunction::FunctionType fType,
          
          EvaluateUserFunction(pData, fData);
 
-         // Compute and save current row of Jacobian
+         // Compute and save the current columns of the Jacobian; a column
+         // sharing its evaluation takes only the rows of its pattern
          Rvector pertValues = funcPt->GetFunctionValues();
-         Rvector jacValue = (pertValues - nomValues) / pertVector(ss);
-         for (Integer dd = 0; dd < numFunctions[fType]; dd++)
-            jacobian[fType][idx1](dd, ss) = jacValue(dd);
+         for (Integer cc = 0; cc < group.size(); cc++)
+         {
+            Integer ss = group[cc];
+            Rvector jacValue = (pertValues - nomValues) / pertVector(ss);
+            for (Integer dd = 0; dd < numFunctions[fType]; dd++)
+            {
+               if ((group.size() == 1) || (pattern(dd, ss) != 0.0))
+                  jacobian[fType][idx1](dd, ss) = jacValue(dd);
+               else
+                  jacobian[fType][idx1](dd, ss) = 0.0;
+            }
+         }
          
          if (isComputingHess == true)
          {
@@ -989,6 +1030,72 @@ void UserPathFunctionManager::ComputeAll(UserFunction::FunctionType fType,
 }
 
 
+//------------------------------------------------------------------------------
+// void ComputeColumnGroups()
+//------------------------------------------------------------------------------
+/**
+ * This method groups the columns of each Jacobian sparsity pattern so that no
+ * two columns of a group have a nonzero in the same row (Curtis, Powell and
+ * Reid).  The columns are assigned greedily, in order, to the first group
+ * they fit.  ComputeAll perturbs the columns of a group together.
+ *
+ */
+//------------------------------------------------------------------------------
+void UserPathFunctionManager::ComputeColumnGroups()
+{
+   columnGroups.clear();
+   columnGroups.resize(UserFunction::ALLFUNCTIONS);
+   for (Integer idx1 = UserFunction::DYNAMICS; idx1 < UserFunction::ALLFUNCTIONS; ++idx1)
+   {
+      columnGroups[idx1].resize(UserFunction::ALLJACOBIANS);
+      if (!hasFunctions[idx1])
+         continue;
+
+      for (Integer idx2 = UserFunction::STATE; idx2 < UserFunction::ALLJACOBIANS; ++idx2)
+      {
+         const Rmatrix &pattern = jacPattern[idx1][idx2];
+         Integer numR, numC;
+         pattern.GetSize(numR, numC);
+         if ((numR != numFunctions[idx1]) || (numC != numVars[idx2]))
+            continue;
+
+         std::vector<IntegerArray> &groups = columnGroups[idx1][idx2];
+         // Rows already used by each group
+         std::vector<std::vector<bool>> usedRows;
+         for (Integer cc = 0; cc < numC; ++cc)
+         {
+            Integer gg = 0;
+            for (; gg < groups.size(); ++gg)
+            {
+               bool fits = true;
+               for (Integer rr = 0; (rr < numR) && fits; ++rr)
+                  if ((pattern(rr, cc) != 0.0) && usedRows[gg][rr])
+                     fits = false;
+               if (fits)
+                  break;
+            }
+            if (gg == groups.size())
+            {
+               groups.push_back(IntegerArray());
+               usedRows.push_back(std::vector<bool>(numR, false));
+            }
+            groups[gg].push_back(cc);
+            for (Integer rr = 0; rr < numR; ++rr)
+               if (pattern(rr, cc) != 0.0)
+                  usedRows[gg][rr] = true;
+         }
+
+         #ifdef DEBUG_MANAGER
+            MessageInterface::ShowMessage(
+                  "   %s Jacobian type %d: %d columns in %d groups\n",
+                  FunctionTypeNames[idx1].c_str(), idx2, numC,
+                  (Integer) groups.size());
+         #endif
+      }
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // void ComputeSparsityPatterns(FunctionInputData     *pData,
 //                              PathFunctionContainer *fData,
@@ -1064,6 +1171,9 @@ void UserPathFunctionManager::ComputeSparsityPatterns(
    //for (Integer ii = 0; ii < 7; ++ii)
    //   MessageInterface::ShowMessage(jacPattern[UserFunction::DYNAMICS][UserFunction::STATE].GetRow(ii).ToString() + "\n");
 
+   // Group the columns that can be finite differenced together
+   ComputeColumnGroups();
+
    if (isComputingHess == true)
    {
       // do something for hessian here
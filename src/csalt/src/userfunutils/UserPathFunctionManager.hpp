@@ -73,6 +73,7 @@ public:
    
    virtual void           SetParamData(FunctionInputData *pData);
    virtual void           SetFunctionData(PathFunctionContainer *fData);
+   virtual void           SetUserFunction(UserPathFunction *uData);
    
 protected:
    
@@ -146,6 +147,10 @@ protected:
    // The sparsity patterns of the Jacobians
    std::vector<std::vector<Rmatrix>> jacPattern;
 
+   /// Groups of structurally orthogonal Jacobian columns, per function and
+   /// Jacobian type; the columns of a group are perturbed together
+   std::vector<std::vector<std::vector<IntegerArray>>> columnGroups;
+
    /// Upper bound on algebraic function values
    Rvector      algFuncUpperBound;
    /// Lower bound on algebraic function values
@@ -196,6 +201,7 @@ protected:
    virtual void ComputeAll(UserFunction::FunctionType fType, 
                            FunctionInputData        *pData,
                            PathFunctionContainer    *fData, bool isComputingHess = false);
+   virtual void ComputeColumnGroups();
 
    /// Compute sparsity patterns
    virtual void ComputeSparsityPatterns(FunctionInputData     *pData,
@@ -31,7 +31,9 @@
 //------------------------------------------------------------------------------
 // static data
 //------------------------------------------------------------------------------
-// none
+std::map<std::string, std::shared_ptr<OCHTrajectoryData> >
+                     GuessGenerator::ochFileCache;
+std::mutex           GuessGenerator::ochCacheMutex;
 
 //------------------------------------------------------------------------------
 // public methods
@@ -320,7 +322,12 @@ void GuessGenerator::ComputeGuessFromOCHFile(const std::string &OCHFileName,
     Rvector requestedTimes = ConvertTrajectoryTimeToGuessTime(timeVecType,
                                                               timeVector);
     
-    OCHTrajectoryData* guessData = new OCHTrajectoryData(OCHFileName);
+    // Phases and mesh refinement restarts that start from the same file
+    // share one parsed trajectory; it is read again only if the file changes
+    std::lock_guard<std::mutex> lock(ochCacheMutex);
+    std::shared_ptr<OCHTrajectoryData> &guessData = ochFileCache[OCHFileName];
+    if (!guessData || !guessData->IsFileCurrent())
+       guessData.reset(new OCHTrajectoryData(OCHFileName));
 
     guessData->SetInterpType(TrajectoryData::NOTAKNOT);
     guessData->SetAllowInterSegmentExtrapolation(true);
@@ -338,8 +345,19 @@ void GuessGenerator::ComputeGuessFromOCHFile(const std::string &OCHFileName,
     for (Integer idx = 0; idx < numControlPoints; idx++)
         for (Integer jdx = 0; jdx < numControls; jdx++)
             controlMat(idx,jdx) = interpGuessData.at(idx).controls(jdx);
+}
 
-    delete guessData;
+//------------------------------------------------------------------------------
+//  void ClearOCHFileCache()
+//------------------------------------------------------------------------------
+/**
+ * This method releases the OCH trajectories kept for later guesses
+ */
+//------------------------------------------------------------------------------
+void GuessGenerator::ClearOCHFileCache()
+{
+   std::lock_guard<std::mutex> lock(ochCacheMutex);
+   ochFileCache.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -34,6 +34,9 @@
 #include "OCHTrajectoryData.hpp"
 #include "ArrayTrajectoryData.hpp"
 #include "ScalingUtility.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
 
 class CSALT_API GuessGenerator
 {
@@ -84,6 +87,8 @@ public:
                            Rmatrix &stateMat,
                            Rmatrix &controlMat);
 
+   static void             ClearOCHFileCache();
+
 protected:
    /// vector of times in the phase
    Rvector               timeVector;
@@ -98,6 +103,12 @@ protected:
    /// indicates model for the guess
    std::string           guessMode;
 
+   /// OCH trajectories already read, by file name, shared by all phases
+   static std::map<std::string, std::shared_ptr<OCHTrajectoryData> >
+                         ochFileCache;
+   /// Guards ochFileCache and the shared trajectories' interpolators
+   static std::mutex     ochCacheMutex;
+
    Rvector GetEvenlySpacedArray(Real start, Real end, Integer numPts);
    Rvector ConvertTrajectoryTimeToGuessTime(const std::string &timeVecType,
                                             Rvector inputTimes);
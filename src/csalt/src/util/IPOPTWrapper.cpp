@@ -15,7 +15,10 @@ using namespace Ipopt;
 
 /* Constructor. */
 IPOPTWrapper::IPOPTWrapper(Trajectory * trajectory_in) :
-   TNLP()
+   TNLP(),
+   isDecVecSet(false),
+   areFuncsCurrent(false),
+   isJacCurrent(false)
 {
    traj = trajectory_in;
 }
@@ -24,7 +27,10 @@ IPOPTWrapper::IPOPTWrapper(Trajectory * trajectory_in) :
 // copy constructor
 //------------------------------------------------------------------------------
 IPOPTWrapper::IPOPTWrapper(const IPOPTWrapper &copy) :
-   traj(copy.traj)
+   traj(copy.traj),
+   isDecVecSet(false),
+   areFuncsCurrent(false),
+   isJacCurrent(false)
 {
 }
 
@@ -37,6 +43,9 @@ IPOPTWrapper& IPOPTWrapper::operator=(const IPOPTWrapper &copy)
       return *this;
 
    traj = copy.traj;
+   isDecVecSet     = false;
+   areFuncsCurrent = false;
+   isJacCurrent    = false;
    return *this;
 }
 
@@ -56,23 +65,21 @@ bool IPOPTWrapper::get_nlp_info(Ipopt::Index& numVars, Ipopt::Index& numConstr,
    // this method delivers the basic NLP information on the sizes of functions, jac., hess.,
    // and variables, and indexing setting
 
-   Rvector decVec = traj->GetDecisionVector();
+   // The problem may have changed (e.g. a new mesh), so nothing cached for
+   // the previous one is reused
+   isDecVecSet     = false;
+   areFuncsCurrent = false;
+   isJacCurrent    = false;
+   BuildIndexArrays();
 
    // n is the number of variables
-   numVars = decVec.GetSize();
-
-   // m is the number of constraints,
-   
-   // note that traj->GetConstraintVector() gives only 
-   // the path constraints not including point constraints.
-   Rvector costConstr = traj->GetCostConstraintFunctions();
-
-   numConstr = costConstr.GetSize() - 1;
+   numVars = traj->GetDecisionVector().GetSize();
 
-   RSMatrix jac = traj->GetConstraintSparsityPattern();
+   // m is the number of constraints, path and point constraints included
+   numConstr = traj->GetAllConLowerBound().size();
 
    // check the number of elements in constraint jacobian. 
-   numNZerosInConstrJac = SparseMatrixUtil::GetNumNonZeroElements(&jac);
+   numNZerosInConstrJac = jacRows.size();
 
    RSMatrix hessPattern = traj->GetHessianSparsityPattern();
    // the effective nonzeros in Lag. (lower triangular part)
@@ -146,101 +153,37 @@ bool IPOPTWrapper::get_starting_point(Ipopt::Index numVars, bool hasInitGuess, I
 bool IPOPTWrapper::eval_f(Ipopt::Index numVars, const Ipopt::Number* decVec, bool isNewDecVec, Ipopt::Number& costValue)
 {
    // return the value of the objective function
+   SetDecisionVector(numVars, decVec, isNewDecVec);
+   ComputeFunctions();
 
-   //RSMatrix            GetJacobian();
-   //Rvector             GetCostConstraintFunctions();
-
-   /*
-   // CSALT internally handle this by itself. 
-   if (isNewDecVec)
-   {
-      Rvector decRVec(numVars);
-      for (Integer idx = 0; idx < numVars; idx++)
-      {
-         decRVec(idx) = decVec[idx];
-      }
-
-      traj->SetDecisionVector(decRVec);
-   }
-   */
-   Rvector decRVec(numVars);
-   for (Integer idx = 0; idx < numVars; idx++)
-   {
-      decRVec(idx) = decVec[idx];
-   }
-
-   traj->SetDecisionVector(decRVec);
-   
-   costValue = traj->GetCostFunction();
+   costValue = funcValues(0);
    return true;
 }
 
 bool IPOPTWrapper::eval_grad_f(Ipopt::Index numVars, const Ipopt::Number* decVec, bool isNewDecVec, Ipopt::Number* costJac)
 {
-   // return the cost jacobian to IPOPT
-   /*
-   // CSALT internally handle this by itself.
-   if (isNewDecVec)
-   {
-   Rvector decRVec(numVars);
-   for (Integer idx = 0; idx < numVars; idx++)
-   {
-   decRVec(idx) = decVec[idx];
-   }
-
-   traj->SetDecisionVector(decRVec);
-   }
-   */
-   Rvector decRVec(numVars);
-   for (Integer idx = 0; idx < numVars; idx++)
-   {
-      decRVec(idx) = decVec[idx];
-   }
-
-   traj->SetDecisionVector(decRVec);
-
-   RSMatrix costJacRSMat = traj->GetCostJacobian();
-   Rmatrix costJacRmat = SparseMatrixUtil::RSMatrixToRmatrix(&costJacRSMat);
+   // return the cost jacobian to IPOPT; row 0 of the Jacobian is the cost
+   SetDecisionVector(numVars, decVec, isNewDecVec);
+   ComputeJacobian();
 
    for (Integer idx = 0; idx < numVars; idx++)
-   {
-      costJac[idx] = costJacRmat(0,idx);
-   }
+      costJac[idx] = 0.0;
+   for (UnsignedInt idx = 0; idx < costCols.size(); idx++)
+      costJac[costCols[idx]] = GetJacobianValue(0, costCols[idx], idx);
 
    return true;
 }
 
 bool IPOPTWrapper::eval_g(Ipopt::Index numVars, const Ipopt::Number* decVec, bool isNewDecVec, Ipopt::Index numConstr, Ipopt::Number* constrVec)
 {
-   // return the constraint vector to IPOPT
-
-   /*
-   // CSALT internally handle this by itself.
-   if (isNewDecVec)
-   {
-   Rvector decRVec(numVars);
-   for (Integer idx = 0; idx < numVars; idx++)
-   {
-   decRVec(idx) = decVec[idx];
-   }
-
-   traj->SetDecisionVector(decRVec);
-   }
-   */
-   Rvector decRVec(numVars);
-   for (Integer idx = 0; idx < numVars; idx++)
-   {
-      decRVec(idx) = decVec[idx];
-   }
-
-   traj->SetDecisionVector(decRVec);
-
-   Rvector constrRVec = traj->GetAllConstraintFunctions();
+   // return the constraint vector to IPOPT; it follows the cost in the
+   // function values
+   SetDecisionVector(numVars, decVec, isNewDecVec);
+   ComputeFunctions();
 
+   const Real *values = funcValues.GetDataVector() + 1;
    for (Integer idx = 0; idx < numConstr; idx++)
-   {
-      constrVec[idx] = constrRVec(idx);
-   }
+      constrVec[idx] = values[idx];
 
    return true;
 }
@@ -249,50 +192,25 @@ bool IPOPTWrapper::eval_jac_g(Ipopt::Index numVars, const Ipopt::Number* decVec,
                        Ipopt::Index numConstr, Ipopt::Index nele_jac, Ipopt::Index* iRow, Ipopt::Index *jCol,
                        Ipopt::Number* values)
 {
-   // provide constraint jacobian here
-   IntegerArray  rowIdxs, colIdxs;
+   // provide constraint jacobian here; the structure was found in
+   // get_nlp_info
    if (values == NULL) {
-
-      RSMatrix constJacPattern = traj->GetConstraintSparsityPattern();
-      SparseMatrixUtil::GetSparsityPattern(&constJacPattern, rowIdxs, colIdxs);
-      for (Integer idx = 0; idx < rowIdxs.size(); idx++)
+      for (UnsignedInt idx = 0; idx < jacRows.size(); idx++)
       {
-         iRow[idx] = rowIdxs[idx];
-         jCol[idx] = colIdxs[idx];
+         iRow[idx] = jacRows[idx];
+         jCol[idx] = jacCols[idx];
       }
       return true;
    }
 
-   /*
-   // CSALT internally handle this by itself.
-   if (isNewDecVec)
-   {
-   Rvector decRVec(numVars);
-   for (Integer idx = 0; idx < numVars; idx++)
-   {
-   decRVec(idx) = decVec[idx];
-   }
-
-   traj->SetDecisionVector(decRVec);
-   }
-   */
-   Rvector decRVec(numVars);
-   for (Integer idx = 0; idx < numVars; idx++)
-   {
-      decRVec(idx) = decVec[idx];
-   }
-
-   traj->SetDecisionVector(decRVec);
-
-   std::vector<Real> valueVec;
-   RSMatrix constrJacRSMat = traj->GetConstraintJacobian();
-   SparseMatrixUtil::GetThreeVectorForm(&constrJacRSMat, rowIdxs, colIdxs,valueVec);
-   for (Integer idx = 0; idx < valueVec.size(); idx++)
-   {
-      values[idx] = valueVec[idx];
-   }
-   
+   SetDecisionVector(numVars, decVec, isNewDecVec);
+   ComputeJacobian();
 
+   // The constraint elements follow the cost row in storage order
+   Integer offset = costCols.size();
+   for (UnsignedInt idx = 0; idx < jacRows.size(); idx++)
+      values[idx] = GetJacobianValue(jacRows[idx] + 1, jacCols[idx],
+                                     offset + idx);
 
    return true;
 }
@@ -343,6 +261,8 @@ bool IPOPTWrapper::eval_h(Ipopt::Index numVars, const Ipopt::Number* decVec, boo
       lambdaVec(idx+1) = constrFactor[idx];
    }
    RSMatrix hessMat = traj->ComputeHessianContraction(decRVec, lambdaVec);
+   // The contraction perturbs the decision vector set on the trajectory
+   isDecVecSet = false;
    SparseMatrixUtil::GetThreeVectorForm(&hessMat, rowIdxs, colIdxs, valueVec);
 
    for (Integer idx = 0; idx < valueVec.size(); idx++)
@@ -377,14 +297,130 @@ void IPOPTWrapper::finalize_solution(SolverReturn status,
    //   INTERNAL_ERROR: An unknown internal error occurred. Please contact the IPOPT authors through the mailing list. 
    
 
-   Rvector decRVec(numVars);
-   for (Integer idx = 0; idx < numVars; idx++)
+   SetDecisionVector(numVars, decVec, true);
+   ComputeFunctions();
+   ComputeJacobian();
+}
+
+//------------------------------------------------------------------------------
+// void BuildIndexArrays()
+//------------------------------------------------------------------------------
+/**
+ * Builds the cost gradient and constraint Jacobian indices from the sparsity
+ * pattern of the trajectory, in the storage order of the Jacobian.  This is
+ * done once per problem (mesh), so the callbacks only copy values.
+ */
+//------------------------------------------------------------------------------
+void IPOPTWrapper::BuildIndexArrays()
+{
+   RSMatrix pattern = traj->GetSparsityPattern();
+
+   costCols.clear();
+   jacRows.clear();
+   jacCols.clear();
+
+   std::size_t numRowStarts = pattern.filled1();
+   const RSMatrix::index_array_type &rowStarts = pattern.index1_data();
+   const RSMatrix::index_array_type &columns   = pattern.index2_data();
+
+   // Rows at or beyond filled1() - 1 of a compressed matrix are empty
+   for (std::size_t row = 0; row + 1 < numRowStarts; ++row)
    {
-      decRVec(idx) = decVec[idx];
+      for (std::size_t idx = rowStarts[row]; idx < rowStarts[row + 1]; ++idx)
+      {
+         if (row == 0)
+            costCols.push_back(columns[idx]);
+         else
+         {
+            jacRows.push_back(row - 1);
+            jacCols.push_back(columns[idx]);
+         }
+      }
    }
+}
+
+//------------------------------------------------------------------------------
+// void SetDecisionVector(Ipopt::Index numVars, const Ipopt::Number* decVec,
+//                        bool isNewDecVec)
+//------------------------------------------------------------------------------
+/**
+ * Passes the IPOPT iterate to the trajectory when it has changed.  The
+ * decision vector buffer is kept between callbacks, so IPOPT calls made at
+ * the same point (eval_f, eval_g, eval_grad_f, eval_jac_g) share one
+ * evaluation.
+ */
+//------------------------------------------------------------------------------
+void IPOPTWrapper::SetDecisionVector(Ipopt::Index numVars,
+                                     const Ipopt::Number* decVec,
+                                     bool isNewDecVec)
+{
+   if (isDecVecSet && !isNewDecVec)
+      return;
 
-   traj->SetDecisionVector(decRVec);
-   traj->GetCostConstraintFunctions();
-   traj->GetJacobian();
+   if (!decisionVec.IsSized() || (decisionVec.GetSize() != numVars))
+      decisionVec.SetSize(numVars);
+   for (Integer idx = 0; idx < numVars; idx++)
+      decisionVec(idx) = decVec[idx];
+
+   traj->SetDecisionVector(decisionVec);
+   isDecVecSet     = true;
+   areFuncsCurrent = false;
+   isJacCurrent    = false;
+}
+
+//------------------------------------------------------------------------------
+// void ComputeFunctions()
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the cost and constraints once per decision vector
+ */
+//------------------------------------------------------------------------------
+void IPOPTWrapper::ComputeFunctions()
+{
+   if (areFuncsCurrent)
+      return;
+
+   funcValues = traj->GetCostConstraintFunctions();
+   areFuncsCurrent = true;
+}
+
+//------------------------------------------------------------------------------
+// void ComputeJacobian()
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the cost and constraint Jacobian once per decision vector
+ */
+//------------------------------------------------------------------------------
+void IPOPTWrapper::ComputeJacobian()
+{
+   if (isJacCurrent)
+      return;
+
+   // The trajectory evaluates the Jacobian with the functions
+   ComputeFunctions();
+   jacobian = traj->GetJacobian();
+   isJacCurrent = true;
+}
+
+//------------------------------------------------------------------------------
+// Real GetJacobianValue(Integer row, Integer col, Integer idx)
+//------------------------------------------------------------------------------
+/**
+ * Returns a Jacobian element.  While the Jacobian keeps the sparsity pattern
+ * of the trajectory, element idx of its storage is read directly; otherwise
+ * the element is looked up.
+ *
+ * @param row The row of the element (row 0 is the cost)
+ * @param col The column of the element
+ * @param idx The position of the element in the sparsity pattern storage
+ *
+ * @return The Jacobian value
+ */
+//------------------------------------------------------------------------------
+Real IPOPTWrapper::GetJacobianValue(Integer row, Integer col, Integer idx)
+{
+   if (jacobian.nnz() == costCols.size() + jacRows.size())
+      return jacobian.value_data()[idx];
+   return jacobian(row, col);
 }
 
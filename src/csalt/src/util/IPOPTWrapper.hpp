@@ -97,6 +97,30 @@ private:
    Trajectory *traj;
    RealArray lastHessValueVec;
 
+   /// Decision vector most recently passed to the trajectory
+   Rvector decisionVec;
+   /// Cost (element 0) and constraint values at decisionVec
+   Rvector funcValues;
+   /// Jacobian of the cost (row 0) and constraints at decisionVec
+   RSMatrix jacobian;
+   /// Flags for the data that matches decisionVec
+   bool isDecVecSet;
+   bool areFuncsCurrent;
+   bool isJacCurrent;
+
+   /// Cost gradient columns, in Jacobian storage order
+   IntegerArray costCols;
+   /// Constraint Jacobian rows and columns, in Jacobian storage order
+   IntegerArray jacRows;
+   IntegerArray jacCols;
+
+   void BuildIndexArrays();
+   void SetDecisionVector(Ipopt::Index numVars, const Ipopt::Number* decVec,
+                          bool isNewDecVec);
+   void ComputeFunctions();
+   void ComputeJacobian();
+   Real GetJacobianValue(Integer row, Integer col, Integer idx);
+
 };
 
 #endif // IPOPTWrapper
\ No newline at end of file
@@ -23,6 +23,12 @@
 //#define DEBUG_READ_OCH
 //#define DEBUG_WRITE_OCH
 
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+/// Format of the parsed OCH data in the data file cache
+static const std::string OCH_CACHE_FORMAT = "OCHTrajectoryData|1";
+
 //------------------------------------------------------------------------------
 // public methods
 //------------------------------------------------------------------------------
@@ -60,7 +66,9 @@ OCHTrajectoryData::OCHTrajectoryData(const OCHTrajectoryData &copy) :
    maxConViolation(copy.maxConViolation),
    exitStatus(copy.exitStatus),
    exitCode(copy.exitCode),
-   solutionType(copy.solutionType)
+   solutionType(copy.solutionType),
+   loadedFileName(copy.loadedFileName),
+   loadedFile(copy.loadedFile)
 {
 }
 
@@ -83,6 +91,8 @@ OCHTrajectoryData& OCHTrajectoryData::operator=(const OCHTrajectoryData &copy)
    exitStatus = copy.exitStatus;
    exitCode = copy.exitCode;
    solutionType = copy.solutionType;
+   loadedFileName = copy.loadedFileName;
+   loadedFile = copy.loadedFile;
    return *this;
 }
 
@@ -647,6 +657,13 @@ void OCHTrajectoryData::ReadFromFile(std::string fileName)
    hasSegmentHadDuplicates.clear();
    
    numSegments = 0;
+   loadedFileName = fileName;
+   loadedFile.reset();
+
+   // Use the parsed contents of an unchanged file when they are cached
+   if (LoadCached(DataFileCache::Find(StringArray(1, fileName),
+                                      OCH_CACHE_FORMAT)))
+      return;
 
    // Open the file
    fIn.open(fileName);
@@ -1010,6 +1027,7 @@ void OCHTrajectoryData::ReadFromFile(std::string fileName)
          throw LowThrustException(errmsg);
       }
 
+      ShareCached(fileName);
    } // is file open
    else 
    {
@@ -1018,3 +1036,149 @@ void OCHTrajectoryData::ReadFromFile(std::string fileName)
       throw LowThrustException(errmsg);
    }
 }
+
+//------------------------------------------------------------------------------
+// bool IsFileCurrent()
+//------------------------------------------------------------------------------
+/**
+* This method checks whether the data still matches the file it was read
+* from, so that callers holding a parsed trajectory can reuse it
+*
+* @return true if the file is unchanged since it was read
+*
+*/
+//------------------------------------------------------------------------------
+bool OCHTrajectoryData::IsFileCurrent()
+{
+   if (!loadedFile)
+      return false;
+   return DataFileCache::Find(StringArray(1, loadedFileName),
+                              OCH_CACHE_FORMAT) == loadedFile;
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// bool LoadCached(const std::shared_ptr<const DataFileCache> &cached)
+//------------------------------------------------------------------------------
+/**
+* This method rebuilds the segments from a cache entry written by ShareCached,
+* in place of parsing the file
+*
+* @param <cached> the cache entry, or NULL if there is none
+*
+* @return true if the segments were restored
+*
+*/
+//------------------------------------------------------------------------------
+bool OCHTrajectoryData::LoadCached(
+                        const std::shared_ptr<const DataFileCache> &cached)
+{
+   if (!cached || (cached->GetTableSize("Segments") != 1))
+      return false;
+
+   Integer nmSegments = (Integer)cached->GetTable("Segments")[0];
+   TrajectoryDataStructure localData;
+   for (Integer s = 0; s < nmSegments; s++)
+   {
+      std::string prefix = "Segment" + GmatStringUtil::ToString(s, 1) + ".";
+      const Real *sizes = cached->GetTable(prefix + "Sizes");
+      if (cached->GetTableSize(prefix + "Sizes") != 3)
+         return false;
+      Integer nmStates    = (Integer)sizes[0];
+      Integer nmControls  = (Integer)sizes[1];
+      Integer nmIntegrals = (Integer)sizes[2];
+      Integer rowSize     = 1 + nmStates + nmControls + nmIntegrals;
+      Integer dataSize    = cached->GetTableSize(prefix + "Data");
+      if ((dataSize < 0) || (dataSize % rowSize != 0))
+         return false;
+
+      OCHTrajectorySegment *och = new OCHTrajectorySegment();
+      segments_.push_back(och);
+      hasSegmentHadDuplicates.push_back(false);
+      numSegments++;
+
+      och->SetCentralBody(cached->GetText(prefix + "CentralBody"));
+      och->SetObjectId(cached->GetText(prefix + "ObjectId"));
+      och->SetObjectName(cached->GetText(prefix + "ObjectName"));
+      och->SetRefFrame(cached->GetText(prefix + "RefFrame"));
+      och->SetTimeSystem(cached->GetText(prefix + "TimeSystem"));
+      SetNumStateParams(s, nmStates);
+      SetNumControlParams(s, nmControls);
+      SetNumIntegralParams(s, nmIntegrals);
+
+      localData.states.SetSize(nmStates);
+      localData.controls.SetSize(nmControls);
+      localData.integrals.SetSize(nmIntegrals);
+      const Real *row = cached->GetTable(prefix + "Data");
+      for (Integer r = 0; r < dataSize / rowSize; r++, row += rowSize)
+      {
+         Integer idx = 0;
+         localData.time = row[idx++];
+         for (Integer ii = 0; ii < nmStates; ii++)
+            localData.states(ii) = row[idx++];
+         for (Integer ii = 0; ii < nmControls; ii++)
+            localData.controls(ii) = row[idx++];
+         for (Integer ii = 0; ii < nmIntegrals; ii++)
+            localData.integrals(ii) = row[idx++];
+         och->AddDataPoint(localData);
+      }
+   }
+
+   dataFound  = true;
+   loadedFile = cached;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void ShareCached(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+* This method stores the parsed segments in a data file cache entry, so later
+* reads of the unchanged file in this process, and in other processes when
+* DATA_CACHE_PATH is set, skip the text parsing
+*
+* @param <fileName> the file the segments were read from
+*
+*/
+//------------------------------------------------------------------------------
+void OCHTrajectoryData::ShareCached(const std::string &fileName)
+{
+   DataFileCache *entry = new DataFileCache();
+   Real nmSegments = numSegments;
+   entry->AddTable("Segments", &nmSegments, 1);
+   for (Integer s = 0; s < numSegments; s++)
+   {
+      OCHTrajectorySegment *och = (OCHTrajectorySegment*)segments_.at(s);
+      std::string prefix = "Segment" + GmatStringUtil::ToString(s, 1) + ".";
+      Integer nmStates    = och->GetNumStates();
+      Integer nmControls  = och->GetNumControls();
+      Integer nmIntegrals = och->GetNumIntegrals();
+      Real sizes[3] = { Real(nmStates), Real(nmControls), Real(nmIntegrals) };
+      entry->AddTable(prefix + "Sizes", sizes, 3);
+
+      RealArray data;
+      for (Integer r = 0; r < och->GetNumDataPoints(); r++)
+      {
+         data.push_back(och->GetTime(r));
+         for (Integer ii = 0; ii < nmStates; ii++)
+            data.push_back(och->GetState(r, ii));
+         for (Integer ii = 0; ii < nmControls; ii++)
+            data.push_back(och->GetControl(r, ii));
+         for (Integer ii = 0; ii < nmIntegrals; ii++)
+            data.push_back(och->GetIntegral(r, ii));
+      }
+      entry->AddTable(prefix + "Data", data.empty() ? NULL : &data[0],
+                      data.size());
+
+      entry->SetText(prefix + "CentralBody", och->GetCentralBody());
+      entry->SetText(prefix + "ObjectId", och->GetObjectId());
+      entry->SetText(prefix + "ObjectName", och->GetObjectName());
+      entry->SetText(prefix + "RefFrame", och->GetRefFrame());
+      entry->SetText(prefix + "TimeSystem", och->GetTimeSystem());
+   }
+   loadedFile = DataFileCache::Share(StringArray(1, fileName),
+                                     OCH_CACHE_FORMAT, entry);
+}
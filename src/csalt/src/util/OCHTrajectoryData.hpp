@@ -25,6 +25,7 @@
 #include "StringUtil.hpp"
 #include "ArrayTrajectoryData.hpp"
 #include "TrajectoryData.hpp"
+#include "DataFileCache.hpp"
 #include <fstream>
 #include <iostream>
 #include <ctime>
@@ -46,6 +47,7 @@ public:
   
    virtual void WriteToFile(std::string fileName);
    virtual void ReadFromFile(std::string fileName);
+   virtual bool IsFileCurrent();
 
    virtual void SetNumSegments(Integer num);
    
@@ -81,6 +83,8 @@ public:
 protected:
 
    virtual Real ProcessTimeString(std::string input, std::string timeSystem);
+   bool         LoadCached(const std::shared_ptr<const DataFileCache> &cached);
+   void         ShareCached(const std::string &fileName);
 
    /// Boolean determining whether or not the DATA section of the och file 
    /// was found
@@ -106,6 +110,9 @@ protected:
    Real maxRelMeshError;
    /// The type of solution that has been saved to the trajectory data
    std::string solutionType;
+   /// The file last read, and its parsed contents shared through the cache
+   std::string loadedFileName;
+   std::shared_ptr<const DataFileCache> loadedFile;
 };
 
 #endif
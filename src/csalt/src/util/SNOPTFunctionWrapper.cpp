@@ -160,11 +160,21 @@ void SNOPTFunctionWrapper(SNOPT_INTEGER  *Status,
          MessageInterface::ShowMessage("SNOPTFunctionWrapper G:\n");
       }
    #endif
-	// Put the Jacobian Values in the SNOPT's c array
-	for (UnsignedInt k = 0; k < Opt->iGfun.size(); k++)
+	// Put the Jacobian Values in the SNOPT's c array.  (iGfun,jGvar) come
+	// from the sparsity pattern in storage order, so while the Jacobian keeps
+	// that pattern its values are copied without element lookups.
+	if (Jacobian.nnz() == Opt->iGfun.size())
 	{
-      // -1 here to 'fix' indexed
-		G[k] = Jacobian(Opt->iGfun[k]-1,Opt->jGvar[k]-1);
+		for (UnsignedInt k = 0; k < Opt->iGfun.size(); k++)
+			G[k] = Jacobian.value_data()[k];
+	}
+	else
+	{
+		for (UnsignedInt k = 0; k < Opt->iGfun.size(); k++)
+		{
+			// -1 here to 'fix' indexed
+			G[k] = Jacobian(Opt->iGfun[k]-1,Opt->jGvar[k]-1);
+		}
 	}
    #ifdef DEBUG_SNOPT_FUNCTION
       if (firstTime)
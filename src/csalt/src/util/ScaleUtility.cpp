@@ -342,7 +342,16 @@ void ScaleUtility::ScaleJacobian(RSMatrix &jac)
    if (numRowsinSparsity == 0)
        return;
 
-   // Scale the Jacobian
+   // Scale the Jacobian.  The index arrays are in the storage order of the
+   // sparsity pattern, so a Jacobian on that pattern is scaled in place.
+   if ((Integer) jac.nnz() == numRowsinSparsity)
+   {
+       RSMatrix::value_array_type &values = jac.value_data();
+       for (Integer arrIdx = 0; arrIdx < numRowsinSparsity; arrIdx++)
+           values[arrIdx] *= conVecWeight(jacRowIdxVec.at(arrIdx)) /
+                             decVecWeight(jacColIdxVec.at(arrIdx));
+       return;
+   }
    for (Integer arrIdx = 0; arrIdx < numRowsinSparsity; arrIdx++)
    {
        Integer funIdx = jacRowIdxVec.at(arrIdx);
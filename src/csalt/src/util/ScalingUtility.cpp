@@ -34,7 +34,8 @@
 //------------------------------------------------------------------------------
 // default constructor
 //------------------------------------------------------------------------------
-ScalingUtility::ScalingUtility()
+ScalingUtility::ScalingUtility() :
+   unitRevision (0)
 {
    // maps are empty at the start by default
    AddUnitAndShift("DU",   1.0, 0.0);
@@ -48,7 +49,8 @@ ScalingUtility::ScalingUtility()
 //------------------------------------------------------------------------------
 // copy constructor
 //------------------------------------------------------------------------------
-ScalingUtility::ScalingUtility(const ScalingUtility &copy)
+ScalingUtility::ScalingUtility(const ScalingUtility &copy) :
+   unitRevision (copy.unitRevision)
 {
    if (!copy.unitFactors.empty())
    {
@@ -78,6 +80,7 @@ ScalingUtility& ScalingUtility::operator=(const ScalingUtility &copy)
       unitShifts.clear();
       unitShifts = copy.unitShifts;
    }
+   ++unitRevision;
 
    return *this;
    
@@ -114,6 +117,7 @@ bool ScalingUtility::SetUnit(const std::string &unitName, Real factor)
    if (ValidateUnit(unitName))
    {
       unitFactors.at(unitName) = factor;
+      ++unitRevision;
       #ifdef DEBUG_ADD_SCALING
          MessageInterface::ShowMessage("SetUnit: SET "
                                        "unitName = %s, "
@@ -133,6 +137,7 @@ bool ScalingUtility::SetShift(const std::string &unitName, Real shift)
    if (ValidateUnit(unitName))
    {
       unitShifts.at(unitName) = shift;
+      ++unitRevision;
       #ifdef DEBUG_ADD_SCALING
          MessageInterface::ShowMessage("SetShift: SET "
                                        "unitName = %s, "
@@ -155,6 +160,7 @@ bool ScalingUtility::SetUnitAndShift(const std::string &unitName, Real factor,
    {
       unitFactors.at(unitName) = factor;
       unitShifts.at(unitName)  = shift;
+      ++unitRevision;
       #ifdef DEBUG_ADD_SCALING
          MessageInterface::ShowMessage("SetUnitAndShift: SET "
                                        "unitName = %s, "
@@ -182,6 +188,7 @@ bool ScalingUtility::AddUnitAndShift(const std::string &unitName, Real factor,
    {
       unitFactors.insert(std::make_pair(unitName, factor)); // @todo need validation here?
       unitShifts.insert(std::make_pair(unitName, shift));   // @todo need validation here?
+      ++unitRevision;
       #ifdef DEBUG_ADD_SCALING
          MessageInterface::ShowMessage("AddUnitAndShift: INSERTED "
                                        "unitName = %s, "
@@ -206,6 +213,43 @@ void ScalingUtility::GetUnitAndShift(const std::string &unitName, Real &factor,
    }
 }
 
+//------------------------------------------------------------------------------
+// Integer GetUnitRevision() const
+//------------------------------------------------------------------------------
+/**
+ * Returns a counter that changes whenever a unit factor or shift changes.
+ * Callers that cache the output of CompileUnits compare this value to decide
+ * when the cached arrays are stale.
+ */
+//------------------------------------------------------------------------------
+Integer ScalingUtility::GetUnitRevision() const
+{
+   return unitRevision;
+}
+
+//------------------------------------------------------------------------------
+// void CompileUnits(const StringArray &units, RealArray &factors,
+//                   RealArray &shifts)
+//------------------------------------------------------------------------------
+/**
+ * Resolves a list of unit names into parallel factor and shift arrays, so
+ * that a vector with a fixed unit layout can be scaled repeatedly without
+ * string lookups.
+ *
+ * @param units   The unit names, one per vector element
+ * @param factors Output scale factors, resized to match units
+ * @param shifts  Output shifts, resized to match units
+ */
+//------------------------------------------------------------------------------
+void ScalingUtility::CompileUnits(const StringArray &units, RealArray &factors,
+                                  RealArray &shifts)
+{
+   factors.resize(units.size());
+   shifts.resize(units.size());
+   for (UnsignedInt ii = 0; ii < units.size(); ii++)
+      LookupUnit(units[ii], factors[ii], shifts[ii]);
+}
+
 //------------------------------------------------------------------------------
 // Real ScaleParameter(const Real &unscaled, const std::string &unit)
 //------------------------------------------------------------------------------
@@ -242,26 +286,18 @@ Rvector ScalingUtility::ScaleVector(const Rvector &unscaled,
 {
    Integer szVector = unscaled.GetSize();
    Integer szUnits  = units.size();
-   Rvector scaled(szVector); // all zeroes by default
    if (szVector != szUnits)
    {
-      scaled = unscaled;
       // @todo - should this just be a warning?
       throw LowThrustException(
                      "ERROR - unscaled vector and units sizes don't match!\n");
    }
-   for (unsigned int ii = 0; ii < szVector; ii++)
+   Rvector scaled(unscaled);
+   Real factor, shift;
+   for (Integer ii = 0; ii < szVector; ii++)
    {
-      std::string unit = units.at(ii);
-      if (ValidateUnit(unit))
-      {
-         scaled(ii) = (unscaled(ii) - unitShifts.at(unit)) /
-                      unitFactors.at(unit);
-      }
-      else // unit invalid - no scaling
-      {
-         scaled(ii) = unscaled(ii);
-     }
+      LookupUnit(units[ii], factor, shift);
+      scaled(ii) = (scaled(ii) - shift) / factor;
    }
    return scaled;
 }
@@ -274,30 +310,98 @@ Rvector ScalingUtility::UnscaleVector(const Rvector &scaled,
 {
    Integer szVector = scaled.GetSize();
    Integer szUnits  = units.size();
-   Rvector unscaled(szVector); // all zeroes by default
    if (szVector != szUnits)
    {
-      unscaled = scaled;
       // @todo - should this just be a warning?
       throw LowThrustException(
                      "ERROR - scaled vector and units sizes don't match!\n");
    }
-   for (unsigned int ii = 0; ii < szVector; ii++)
+   Rvector unscaled(scaled);
+   Real factor, shift;
+   for (Integer ii = 0; ii < szVector; ii++)
    {
-      std::string unit = units.at(ii);
-      if (ValidateUnit(unit))
-      {
-         unscaled(ii) = (scaled(ii) * unitFactors.at(unit)) +
-                         unitShifts.at(unit);
-      }
-      else // unit invalid - no scaling
-      {
-         unscaled(ii) = scaled(ii);
-      }
+      LookupUnit(units[ii], factor, shift);
+      unscaled(ii) = (unscaled(ii) * factor) + shift;
    }
    return unscaled;
 }
 
+//------------------------------------------------------------------------------
+// void ScaleVectorInPlace(Real *values, Integer size,
+//                         const RealArray &factors, const RealArray &shifts)
+//------------------------------------------------------------------------------
+/**
+ * Scales a contiguous buffer in place using arrays built by CompileUnits.
+ *
+ * @param values  The buffer to scale
+ * @param size    The number of elements in the buffer
+ * @param factors The compiled scale factors
+ * @param shifts  The compiled shifts
+ */
+//------------------------------------------------------------------------------
+void ScalingUtility::ScaleVectorInPlace(Real *values, Integer size,
+                                        const RealArray &factors,
+                                        const RealArray &shifts)
+{
+   ValidateCompiledSize(size, factors, shifts);
+   const Real *factor = factors.data();
+   const Real *shift  = shifts.data();
+   for (Integer ii = 0; ii < size; ii++)
+      values[ii] = (values[ii] - shift[ii]) / factor[ii];
+}
+
+//------------------------------------------------------------------------------
+// void UnscaleVectorInPlace(Real *values, Integer size,
+//                           const RealArray &factors, const RealArray &shifts)
+//------------------------------------------------------------------------------
+/**
+ * Unscales a contiguous buffer in place using arrays built by CompileUnits.
+ *
+ * @param values  The buffer to unscale
+ * @param size    The number of elements in the buffer
+ * @param factors The compiled scale factors
+ * @param shifts  The compiled shifts
+ */
+//------------------------------------------------------------------------------
+void ScalingUtility::UnscaleVectorInPlace(Real *values, Integer size,
+                                          const RealArray &factors,
+                                          const RealArray &shifts)
+{
+   ValidateCompiledSize(size, factors, shifts);
+   const Real *factor = factors.data();
+   const Real *shift  = shifts.data();
+   for (Integer ii = 0; ii < size; ii++)
+      values[ii] = (values[ii] * factor[ii]) + shift[ii];
+}
+
+//------------------------------------------------------------------------------
+// void ScaleVectorInPlace(Rvector &values, const RealArray &factors,
+//                         const RealArray &shifts)
+//------------------------------------------------------------------------------
+void ScalingUtility::ScaleVectorInPlace(Rvector &values,
+                                        const RealArray &factors,
+                                        const RealArray &shifts)
+{
+   Integer szVector = values.GetSize();
+   ValidateCompiledSize(szVector, factors, shifts);
+   for (Integer ii = 0; ii < szVector; ii++)
+      values(ii) = (values(ii) - shifts[ii]) / factors[ii];
+}
+
+//------------------------------------------------------------------------------
+// void UnscaleVectorInPlace(Rvector &values, const RealArray &factors,
+//                           const RealArray &shifts)
+//------------------------------------------------------------------------------
+void ScalingUtility::UnscaleVectorInPlace(Rvector &values,
+                                          const RealArray &factors,
+                                          const RealArray &shifts)
+{
+   Integer szVector = values.GetSize();
+   ValidateCompiledSize(szVector, factors, shifts);
+   for (Integer ii = 0; ii < szVector; ii++)
+      values(ii) = (values(ii) * factors[ii]) + shifts[ii];
+}
+
 //------------------------------------------------------------------------------
 // Rmatrix ScaleJacobian(const Rmatrix &unscaled, const StringArray &funUnits,
 //                       const StringArray &varUnits)
@@ -310,38 +414,20 @@ Rmatrix ScalingUtility::ScaleJacobian(const Rmatrix &unscaled,
    unscaled.GetSize(row, col);
    Integer szFunUnits  = funUnits.size();
    Integer szVarUnits  = varUnits.size();
-   Rmatrix scaled(row, col);
-   if (szFunUnits != row)
-   {
-      scaled = unscaled;
-      // @todo - should this just be a warning?
-      throw LowThrustException(
-                  "ERROR - unscaled jacobian and units sizes don't match!\n");
-   }
-   if (szVarUnits != col)
+   if ((szFunUnits != row) || (szVarUnits != col))
    {
-      scaled = unscaled;
       // @todo - should this just be a warning?
       throw LowThrustException(
                   "ERROR - unscaled jacobian and units sizes don't match!\n");
    }
-   for (unsigned int ii = 0; ii < row; ii++)
-   {
-      std::string funUnit = funUnits.at(ii);
-      for (unsigned int jj = 0; jj < col; jj++)
-      {
-         std::string varUnit = varUnits.at(jj);
-         if (ValidateUnit(funUnit) && ValidateUnit(varUnit))
-         {
-            scaled(ii,jj) = (unscaled(ii,jj) * unitFactors.at(varUnit)) /
-                             unitFactors.at(funUnit);
-         }
-         else
-         {
-            scaled(ii,jj) = unscaled(ii,jj);
-         }
-      }
-   }
+   RealArray funFactors, funShifts, varFactors, varShifts;
+   CompileUnits(funUnits, funFactors, funShifts);
+   CompileUnits(varUnits, varFactors, varShifts);
+
+   Rmatrix scaled(unscaled);
+   for (Integer ii = 0; ii < row; ii++)
+      for (Integer jj = 0; jj < col; jj++)
+         scaled(ii,jj) = (scaled(ii,jj) * varFactors[jj]) / funFactors[ii];
    return scaled;
 }
 
@@ -355,29 +441,19 @@ Rmatrix ScalingUtility::ScaleJacobianByVars(const Rmatrix &unscaled,
    Integer row, col;
    unscaled.GetSize(row, col);
    Integer szVarUnits = varUnits.size();
-   Rmatrix scaled(row, col);
    if (szVarUnits != col)
    {
-      scaled = unscaled;
       // @todo - should this just be a warning?
       throw LowThrustException(
          "ERROR - unscaled jacobian and units sizes don't match!\n");
    }
-   for (unsigned int ii = 0; ii < row; ii++)
-   {
-      for (unsigned int jj = 0; jj < col; jj++)
-      {
-         std::string varUnit = varUnits.at(jj);
-         if (ValidateUnit(varUnit))
-         {
-            scaled(ii, jj) = unscaled(ii, jj) * unitFactors.at(varUnit);
-         }
-         else
-         {
-            scaled(ii, jj) = unscaled(ii, jj);
-         }
-      }
-   }
+   RealArray varFactors, varShifts;
+   CompileUnits(varUnits, varFactors, varShifts);
+
+   Rmatrix scaled(unscaled);
+   for (Integer ii = 0; ii < row; ii++)
+      for (Integer jj = 0; jj < col; jj++)
+         scaled(ii, jj) = scaled(ii, jj) * varFactors[jj];
    return scaled;
 }
 
@@ -391,28 +467,19 @@ Rmatrix ScalingUtility::ScaleJacobianByFun(const Rmatrix &unscaled,
    Integer row, col;
    unscaled.GetSize(row, col);
    Integer szFunUnits = funUnits.size();
-   Rmatrix scaled(row, col);
    if (szFunUnits != row)
    {
-      scaled = unscaled;
       // @todo - should this just be a warning?
       throw LowThrustException(
          "ERROR - unscaled jacobian and units sizes don't match!\n");
    }
-   for (unsigned int ii = 0; ii < row; ii++)
+   Rmatrix scaled(unscaled);
+   Real factor, shift;
+   for (Integer ii = 0; ii < row; ii++)
    {
-      std::string funUnit = funUnits.at(ii);
-      for (unsigned int jj = 0; jj < col; jj++)
-      {
-         if (ValidateUnit(funUnit))
-         {
-            scaled(ii, jj) = unscaled(ii, jj) / unitFactors.at(funUnit);
-         }
-         else
-         {
-            scaled(ii, jj) = unscaled(ii, jj);
-         }
-      }
+      LookupUnit(funUnits[ii], factor, shift);
+      for (Integer jj = 0; jj < col; jj++)
+         scaled(ii, jj) = scaled(ii, jj) / factor;
    }
    return scaled;
 }
@@ -429,40 +496,21 @@ Rmatrix ScalingUtility::UnscaleJacobian(const Rmatrix &scaled,
    scaled.GetSize(row, col);
    Integer szFunUnits  = funUnits.size();
    Integer szVarUnits  = varUnits.size();
-   Rmatrix unscaled(row, col);
-   if (szFunUnits != row)
-   {
-      unscaled = scaled;
-      // @todo - should this just be a warning?
-      throw LowThrustException(
-                     "ERROR - scaled jacobian and units sizes don't match!\n");
-   }
-   if (szVarUnits != col)
+   if ((szFunUnits != row) || (szVarUnits != col))
    {
-      unscaled = scaled;
       // @todo - should this just be a warning?
       throw LowThrustException(
                      "ERROR - scaled jacobian and units sizes don't match!\n");
    }
-   for (unsigned int ii = 0; ii < row; ii++)
-   {
-      std::string funUnit = funUnits.at(ii);
-      for (unsigned int jj = 0; jj < col; jj++)
-      {
-         std::string varUnit = varUnits.at(jj);
-         if (ValidateUnit(funUnit) && ValidateUnit(varUnit))
-         {
-            unscaled(ii,jj) = (scaled(ii,jj) * unitFactors.at(funUnit)) /
-            unitFactors.at(varUnit);
-         }
-         else
-         {
-            unscaled(ii,jj) = scaled(ii,jj);
-         }
-      }
-   }
-   return unscaled;
+   RealArray funFactors, funShifts, varFactors, varShifts;
+   CompileUnits(funUnits, funFactors, funShifts);
+   CompileUnits(varUnits, varFactors, varShifts);
 
+   Rmatrix unscaled(scaled);
+   for (Integer ii = 0; ii < row; ii++)
+      for (Integer jj = 0; jj < col; jj++)
+         unscaled(ii,jj) = (unscaled(ii,jj) * funFactors[ii]) / varFactors[jj];
+   return unscaled;
 }
 
 //------------------------------------------------------------------------------
@@ -475,29 +523,19 @@ Rmatrix ScalingUtility::UnscaleJacobianByVars(const Rmatrix &scaled,
    Integer row, col;
    scaled.GetSize(row, col);
    Integer szVarUnits = varUnits.size();
-   Rmatrix unscaled(row, col);
    if (szVarUnits != col)
    {
-      unscaled = scaled;
       // @todo - should this just be a warning?
       throw LowThrustException(
          "ERROR - scaled jacobian and units sizes don't match!\n");
    }
-   for (unsigned int ii = 0; ii < row; ii++)
-   {
-      for (unsigned int jj = 0; jj < col; jj++)
-      {
-         std::string varUnit = varUnits.at(jj);
-         if (ValidateUnit(varUnit))
-         {
-            unscaled(ii, jj) = scaled(ii, jj) /  unitFactors.at(varUnit);
-         }
-         else
-         {
-            unscaled(ii, jj) = scaled(ii, jj);
-         }
-      }
-   }
+   RealArray varFactors, varShifts;
+   CompileUnits(varUnits, varFactors, varShifts);
+
+   Rmatrix unscaled(scaled);
+   for (Integer ii = 0; ii < row; ii++)
+      for (Integer jj = 0; jj < col; jj++)
+         unscaled(ii, jj) = unscaled(ii, jj) / varFactors[jj];
    return unscaled;
 }
 
@@ -511,28 +549,55 @@ Rmatrix ScalingUtility::UnscaleJacobianByFun(const Rmatrix &scaled,
    Integer row, col;
    scaled.GetSize(row, col);
    Integer szFunUnits = funUnits.size();
-   Rmatrix unscaled(row, col);
    if (szFunUnits != row)
    {
-      unscaled = scaled;
       // @todo - should this just be a warning?
       throw LowThrustException(
          "ERROR - scaled jacobian and units sizes don't match!\n");
    }
-   for (unsigned int ii = 0; ii < row; ii++)
+   Rmatrix unscaled(scaled);
+   Real factor, shift;
+   for (Integer ii = 0; ii < row; ii++)
    {
-      std::string funUnit = funUnits.at(ii);
-      for (unsigned int jj = 0; jj < col; jj++)
-      {
-         if (ValidateUnit(funUnit))
-         {
-            unscaled(ii, jj) = scaled(ii, jj) * unitFactors.at(funUnit);
-         }
-         else
-         {
-            unscaled(ii, jj) = scaled(ii, jj);
-         }
-      }
+      LookupUnit(funUnits[ii], factor, shift);
+      for (Integer jj = 0; jj < col; jj++)
+         unscaled(ii, jj) = unscaled(ii, jj) * factor;
    }
    return unscaled;
 }
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void LookupUnit(const std::string &unitName, Real &factor, Real &shift)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the factor and shift for a unit with one search of each map,
+ * throwing the ValidateUnit error if the unit is unknown.
+ */
+//------------------------------------------------------------------------------
+void ScalingUtility::LookupUnit(const std::string &unitName, Real &factor,
+                                Real &shift)
+{
+   std::map<std::string, Real>::const_iterator f = unitFactors.find(unitName);
+   std::map<std::string, Real>::const_iterator s = unitShifts.find(unitName);
+   if ((f == unitFactors.end()) || (s == unitShifts.end()))
+      ValidateUnit(unitName);
+   factor = f->second;
+   shift  = s->second;
+}
+
+//------------------------------------------------------------------------------
+// void ValidateCompiledSize(Integer size, const RealArray &factors,
+//                           const RealArray &shifts)
+//------------------------------------------------------------------------------
+void ScalingUtility::ValidateCompiledSize(Integer size,
+                                          const RealArray &factors,
+                                          const RealArray &shifts)
+{
+   if ((size != (Integer)factors.size()) || (size != (Integer)shifts.size()))
+      throw LowThrustException(
+                     "ERROR - vector and compiled units sizes don't match!\n");
+}
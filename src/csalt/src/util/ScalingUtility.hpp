@@ -42,6 +42,11 @@ public:
 
    // Accessor methods
    void GetUnitAndShift(const std::string &unitName, Real &factor, Real &shift);
+   Integer GetUnitRevision() const;
+
+   // Precompiled unit lists, for repeated scaling of the same layout
+   void CompileUnits(const StringArray &units, RealArray &factors,
+                     RealArray &shifts);
 
    // Scaling methods
    Real ScaleParameter(const Real &unscaled, const std::string &unit);
@@ -49,6 +54,15 @@ public:
 
    Rvector ScaleVector(const Rvector &unscaled, const StringArray &units);
    Rvector UnscaleVector(const Rvector &scaled, const StringArray &units);
+
+   void ScaleVectorInPlace(Real *values, Integer size,
+                           const RealArray &factors, const RealArray &shifts);
+   void UnscaleVectorInPlace(Real *values, Integer size,
+                             const RealArray &factors, const RealArray &shifts);
+   void ScaleVectorInPlace(Rvector &values, const RealArray &factors,
+                           const RealArray &shifts);
+   void UnscaleVectorInPlace(Rvector &values, const RealArray &factors,
+                             const RealArray &shifts);
    
    Rmatrix ScaleJacobian(const Rmatrix &unscaled, const StringArray &funUnits,
                          const StringArray &varUnits);
@@ -69,6 +83,13 @@ protected:
    /// scale factors and shifts for the units   
    std::map<std::string, Real> unitFactors;
    std::map<std::string, Real> unitShifts;
+   /// Incremented whenever a factor or shift changes, so that callers holding
+   /// compiled unit arrays know when to recompile them
+   Integer unitRevision;
+
+   void LookupUnit(const std::string &unitName, Real &factor, Real &shift);
+   void ValidateCompiledSize(Integer size, const RealArray &factors,
+                             const RealArray &shifts);
 };
 
 #endif // ScalingUtility_hpp
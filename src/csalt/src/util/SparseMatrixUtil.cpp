@@ -676,6 +676,148 @@ void SparseMatrixUtil::SetSparseBLockMatrix(
    #endif
 }
 
+//------------------------------------------------------------------------------
+// void SetSparseBlockValues(RSMatrix &spMat,
+//                           Integer rowOffSet, Integer colOffSet,
+//                           const RSMatrix *spBlockMat,
+//                           BlockSlots &slots)
+//------------------------------------------------------------------------------
+/**
+ * Set the values of a sparse block whose elements are already part of the
+ * sparsity pattern of the larger sparse matrix.
+ *
+ * The position of each block element in the value array of spMat is found
+ * once and kept in slots; later calls with the same block structure write the
+ * values straight into those positions, without element lookups or
+ * insertions.  The slots are found again when the block structure or the
+ * number of nonzeros of spMat changes.  If a block element is not in the
+ * sparsity pattern of spMat, the block is inserted element by element as
+ * SetSparseBLockMatrix does.
+ *
+ * @param <spMat>      the larger sparse matrix, which is the object of
+ *                     operation.
+ * @param <rowOffSet>  the row offset of the sparse block.
+ * @param <colOffSet>  the column offset of the sparse block.
+ * @param <spBlockMat> the sparse block matrix to be set.
+ * @param <slots>      the slots found for the block; owned by the caller,
+ *                     which clears them when the pattern of spMat is rebuilt.
+ */
+//------------------------------------------------------------------------------
+void SparseMatrixUtil::SetSparseBlockValues(RSMatrix &spMat,
+                                            Integer rowOffSet, Integer colOffSet,
+                                            const RSMatrix *spBlockMat,
+                                            BlockSlots &slots)
+{
+   if ((spMat.size1() < (*spBlockMat).size1() + rowOffSet)
+      || (spMat.size2() < (*spBlockMat).size2() + colOffSet))
+   {
+      std::stringstream errmsg("");
+      errmsg << "Error: dimension mismatch!; do nothing";
+      throw LowThrustException(errmsg.str());
+   }
+
+   std::size_t numRowStarts = (*spBlockMat).filled1();
+   std::size_t numNonZeros  = (*spBlockMat).filled2();
+   const RSMatrix::index_array_type &rowStarts = (*spBlockMat).index1_data();
+   const RSMatrix::index_array_type &columns   = (*spBlockMat).index2_data();
+
+   bool isCurrent = slots.isValid &&
+      (slots.targetNonZeros == spMat.nnz()) &&
+      (slots.blockRowStarts.size() == numRowStarts) &&
+      (slots.blockColumns.size() == numNonZeros) &&
+      std::equal(slots.blockRowStarts.begin(), slots.blockRowStarts.end(),
+                 rowStarts.begin()) &&
+      std::equal(slots.blockColumns.begin(), slots.blockColumns.end(),
+                 columns.begin());
+
+   if (!isCurrent &&
+       !FindBlockSlots(spMat, rowOffSet, colOffSet, spBlockMat, slots))
+   {
+      #ifdef DEBUG_SPARSE_MATRIX_UTIL
+         MessageInterface::ShowMessage("SetSparseBlockValues: block is not in "
+                                       "the sparsity pattern; inserting it\n");
+      #endif
+      SetSparseBLockMatrix(spMat, rowOffSet, colOffSet, spBlockMat);
+      return;
+   }
+
+   RSMatrix::value_array_type       &values      = spMat.value_data();
+   const RSMatrix::value_array_type &blockValues = (*spBlockMat).value_data();
+   for (std::size_t idx = 0; idx < numNonZeros; ++idx)
+      values[slots.slots[idx]] = blockValues[idx];
+}
+
+//------------------------------------------------------------------------------
+// bool FindBlockSlots(const RSMatrix &spMat,
+//                     Integer rowOffSet, Integer colOffSet,
+//                     const RSMatrix *spBlockMat,
+//                     BlockSlots &slots)
+//------------------------------------------------------------------------------
+/**
+ * Find the position in the value array of spMat of each element of the block,
+ * by merging the sorted column indices of each block row with those of the
+ * matching row of spMat.
+ *
+ * @param <spMat>      the larger sparse matrix.
+ * @param <rowOffSet>  the row offset of the sparse block.
+ * @param <colOffSet>  the column offset of the sparse block.
+ * @param <spBlockMat> the sparse block matrix.
+ * @param <slots>      the slots found for the block.
+ *
+ * @return true if every block element is in the sparsity pattern of spMat;
+ *         otherwise false, and the slots are cleared.
+ */
+//------------------------------------------------------------------------------
+bool SparseMatrixUtil::FindBlockSlots(const RSMatrix &spMat,
+                                      Integer rowOffSet, Integer colOffSet,
+                                      const RSMatrix *spBlockMat,
+                                      BlockSlots &slots)
+{
+   slots.Clear();
+
+   std::size_t numRowStarts = (*spBlockMat).filled1();
+   std::size_t numNonZeros  = (*spBlockMat).filled2();
+   const RSMatrix::index_array_type &rowStarts = (*spBlockMat).index1_data();
+   const RSMatrix::index_array_type &columns   = (*spBlockMat).index2_data();
+
+   // Rows at or beyond filled1() - 1 of a compressed matrix are empty
+   std::size_t numTargetRows = spMat.filled1();
+   const RSMatrix::index_array_type &targetRowStarts = spMat.index1_data();
+   const RSMatrix::index_array_type &targetColumns   = spMat.index2_data();
+
+   slots.slots.resize(numNonZeros);
+   for (std::size_t row = 0; row + 1 < numRowStarts; ++row)
+   {
+      std::size_t targetRow = row + rowOffSet;
+      std::size_t pos = 0, end = 0;
+      if (targetRow + 1 < numTargetRows)
+      {
+         pos = targetRowStarts[targetRow];
+         end = targetRowStarts[targetRow + 1];
+      }
+
+      for (std::size_t idx = rowStarts[row]; idx < rowStarts[row + 1]; ++idx)
+      {
+         std::size_t col = columns[idx] + colOffSet;
+         while ((pos < end) && (targetColumns[pos] < col))
+            ++pos;
+         if ((pos == end) || (targetColumns[pos] != col))
+         {
+            slots.Clear();
+            return false;
+         }
+         slots.slots[idx] = pos;
+      }
+   }
+
+   slots.blockRowStarts.assign(rowStarts.begin(),
+                               rowStarts.begin() + numRowStarts);
+   slots.blockColumns.assign(columns.begin(), columns.begin() + numNonZeros);
+   slots.targetNonZeros = spMat.nnz();
+   slots.isValid        = true;
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // Real GetElement(const RSMatrix  *spMat,
 //                 Integer rowIdx, Integer colIdx)
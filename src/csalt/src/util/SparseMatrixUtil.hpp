@@ -61,6 +61,31 @@ class CSALT_API SparseMatrixUtil
 { 
 public:
 
+   /// positions of the elements of a sparse block in the value array of a
+   /// larger sparse matrix with a fixed sparsity pattern; see
+   /// SetSparseBlockValues
+   struct BlockSlots
+   {
+      /// true once the slots have been found
+      bool                     isValid;
+      /// number of nonzeros of the larger matrix when the slots were found
+      std::size_t              targetNonZeros;
+      /// row starts and column indices of the block the slots were found for
+      std::vector<std::size_t> blockRowStarts;
+      std::vector<std::size_t> blockColumns;
+      /// position in the larger matrix's value array of each block element
+      std::vector<std::size_t> slots;
+
+      BlockSlots() : isValid(false), targetNonZeros(0) {}
+      void Clear()
+      {
+         isValid = false;
+         blockRowStarts.clear();
+         blockColumns.clear();
+         slots.clear();
+      }
+   };
+
    // set methods
 
    /// set the element of sparse matrix
@@ -132,6 +157,15 @@ public:
                                     const Rmatrix  *blockMat,
                                     bool isNotAdding = true);
 
+   /// set the values of a sparse block whose elements are already in the
+   /// sparsity pattern of spMat, writing them straight into their slots.
+   /// the slots are found on the first call and reused while the structures
+   /// of spMat and the block do not change.
+   static void SetSparseBlockValues(RSMatrix  &spMat,
+                                    Integer rowOffSet, Integer colOffSet,
+                                    const RSMatrix  *spBlockMat,
+                                    BlockSlots &slots);
+
 
    /// get methods
    static Real GetElement(const RSMatrix  *spMat,
@@ -244,6 +278,11 @@ public:
    static void CopySparseMatrix(const RSMatrix &copyFrom, RSMatrix &copyTo);
    
 private:
+   static bool FindBlockSlots(const RSMatrix &spMat,
+                              Integer rowOffSet, Integer colOffSet,
+                              const RSMatrix *spBlockMat,
+                              BlockSlots &slots);
+
    /// private constructors, destructor, operator=   *** UNIMPLEMENTED ***
    SparseMatrixUtil();
    SparseMatrixUtil(const SparseMatrixUtil &copy);
@@ -397,6 +397,32 @@ int main(int argc, char *argv[])
          }
       }
       MessageInterface::ShowMessage("Done with control vector ----\n");
+
+      // views must match the copied arrays
+      DecVecArrayView stateView   = myVector->GetStateArrayView();
+      DecVecArrayView controlView = myVector->GetControlArrayView();
+      Rmatrix stateCopy   = myVector->GetStateArray();
+      Rmatrix controlCopy = myVector->GetControlArray();
+      if ((stateView.GetNumRows() != numStatePoints) ||
+          (controlView.GetNumRows() != numControlPoints))
+         MessageInterface::ShowMessage(
+                           "*** ERROR *** array view is of wrong dimension!!!\n");
+      for (Integer rr = 0; rr < numStatePoints; rr++)
+         for (Integer cc = 0; cc < numStates; cc++)
+            if (abs(stateView(rr,cc) - stateCopy(rr,cc)) > tolerance)
+               MessageInterface::ShowMessage(
+                                 "*** ERROR *** state array view failed!!!\n");
+      for (Integer rr = 0; rr < numControlPoints; rr++)
+         for (Integer cc = 0; cc < numControls; cc++)
+            if (abs(controlView(rr,cc) - controlCopy(rr,cc)) > tolerance)
+               MessageInterface::ShowMessage(
+                                 "*** ERROR *** control array view failed!!!\n");
+      DecVecView cvView = myVector->GetControlViewAtMeshPoint(0,2);
+      for (Integer ii = 0; ii < cvView.GetSize(); ii++)
+         if (abs(cvView(ii) - controlCopy(2,ii)) > tolerance)
+            MessageInterface::ShowMessage(
+                              "*** ERROR *** control view failed!!!\n");
+      MessageInterface::ShowMessage("Done with decision vector views ----\n");
    
       // Check getting state at mesh points and stage points
       Integer meshIdx  = 4;
@@ -0,0 +1,80 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           ArrayAllocationCounter
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the debug counter for ArrayTemplate and TableTemplate
+ * allocations.
+ */
+//------------------------------------------------------------------------------
+
+#include "ArrayAllocationCounter.hpp"
+
+namespace
+{
+   /// Number of allocations reported since the library was loaded
+   Integer allocationCount = 0;
+}
+
+//------------------------------------------------------------------------------
+// void Increment()
+//------------------------------------------------------------------------------
+/**
+ * Records one array allocation.
+ */
+//------------------------------------------------------------------------------
+void GmatArrayAllocation::Increment()
+{
+   ++allocationCount;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetCount()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of array allocations recorded so far.
+ *
+ * Callers compare the count before and after a block of code; the count is
+ * only advanced in builds that define DEBUG_ARRAY_ALLOCATIONS.
+ *
+ * @return The allocation count
+ */
+//------------------------------------------------------------------------------
+Integer GmatArrayAllocation::GetCount()
+{
+   return allocationCount;
+}
+
+//------------------------------------------------------------------------------
+// bool IsCounting()
+//------------------------------------------------------------------------------
+/**
+ * Reports if this library was built with the allocation counter turned on.
+ *
+ * @return true if allocations are counted
+ */
+//------------------------------------------------------------------------------
+bool GmatArrayAllocation::IsCounting()
+{
+   #ifdef DEBUG_ARRAY_ALLOCATIONS
+      return true;
+   #else
+      return false;
+   #endif
+}
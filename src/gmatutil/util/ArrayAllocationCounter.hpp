@@ -0,0 +1,43 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           ArrayAllocationCounter
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); 
+// You may not use this file except in compliance with the License. 
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0. 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either 
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Debug counter for the heap allocations made by ArrayTemplate and
+ * TableTemplate (and so by the Rvector and Rmatrix classes).
+ *
+ * The templates only report their allocations when the build defines
+ * DEBUG_ARRAY_ALLOCATIONS.  The flag changes code compiled into every library
+ * that uses the templates, so it has to be set for the whole build rather than
+ * in a single source file.
+ */
+//------------------------------------------------------------------------------
+#ifndef ArrayAllocationCounter_hpp
+#define ArrayAllocationCounter_hpp
+
+#include "utildefs.hpp"
+
+namespace GmatArrayAllocation
+{
+   void    GMATUTIL_API Increment();
+   Integer GMATUTIL_API GetCount();
+   bool    GMATUTIL_API IsCounting();
+}
+
+#endif // ArrayAllocationCounter_hpp
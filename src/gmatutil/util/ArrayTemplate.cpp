@@ -132,6 +132,25 @@ ArrayTemplate<T>::ArrayTemplate(const ArrayTemplate<T> &array)
    }
 }
 
+//------------------------------------------------------------------------------
+//  <move constructor>
+//  ArrayTemplate(ArrayTemplate<T> &&array)
+//
+//  Notes: takes over the heap storage of array, leaving it unsized; small
+//         arrays are copied
+//------------------------------------------------------------------------------
+template <class T>
+ArrayTemplate<T>::ArrayTemplate(ArrayTemplate<T> &&array)
+  :
+  elementD((T*) 0), sizeD(0), isSizedD(false)
+{
+   if (array.IsSized() == false)
+   {
+       throw ArrayTemplateExceptions::UnsizedArray();
+   }
+   take(array);
+}
+
 //------------------------------------------------------------------------------
 //  <destructor>
 //  ~ArrayTemplate()
@@ -139,7 +158,7 @@ ArrayTemplate<T>::ArrayTemplate(const ArrayTemplate<T> &array)
 template <class T>
 ArrayTemplate<T>::~ArrayTemplate()
 {
-   delete [] elementD;
+   release();
 }
 
 //------------------------------------------------------------------------------
@@ -173,6 +192,32 @@ const ArrayTemplate<T>& ArrayTemplate<T>::operator=(
    return *this;
 }
 
+//------------------------------------------------------------------------------
+//  const ArrayTemplate<T>& operator=(ArrayTemplate<T>&& array)
+//
+//  Notes: same checks as the copy assignment; the heap storage of array is
+//         taken over, leaving it unsized
+//------------------------------------------------------------------------------
+template <class T>
+const ArrayTemplate<T>& ArrayTemplate<T>::operator=(ArrayTemplate<T>&& array)
+{
+   if (array.IsSized() == false)
+   {
+       throw ArrayTemplateExceptions::UnsizedArray();
+   }
+   if ((isSizedD == true) && (sizeD != array.sizeD))
+   {
+      throw ArrayTemplateExceptions::DimensionError();
+   }
+
+   if (this != &array)
+   {
+      release();
+      take(array);
+   }
+   return *this;
+}
+
 //------------------------------------------------------------------------------
 //  bool operator==(const ArrayTemplate<T> &array) const
 //------------------------------------------------------------------------------
@@ -302,7 +347,7 @@ ArrayTemplate<T>::SetSize(int size)
    {
        //throw ArrayTemplateExceptions::ArrayAlreadySized();
       // wcs - 2005.02.01 - need to be able to resize
-      delete [] elementD;
+      release();
    }
 
    if (size < 0)
@@ -423,9 +468,66 @@ ArrayTemplate<T>::init(int s)
    {
        elementD = (T *) 0;
    }
+   else if (sizeD <= SMALL_SIZE)
+   {
+       elementD = smallD;
+   }
    else
    {
        elementD = new T[sizeD];
+       #ifdef DEBUG_ARRAY_ALLOCATIONS
+          GmatArrayAllocation::Increment();
+       #endif
+       if (MemoryTracker::IsCounting())
+          MemoryTracker::CountAllocation(MemoryTracker::ARRAY_BUFFER,
+                sizeD * sizeof(T));
    }
    isSizedD = true;
 }
+
+//------------------------------------------------------------------------------
+//  void release()
+//------------------------------------------------------------------------------
+template <class T>
+void
+ArrayTemplate<T>::release()
+{
+   if (elementD != smallD)
+   {
+      if ((elementD != (T *) 0) && MemoryTracker::IsCounting())
+         MemoryTracker::CountRelease(MemoryTracker::ARRAY_BUFFER,
+               sizeD * sizeof(T));
+      delete [] elementD;
+   }
+   elementD = (T *) 0;
+}
+
+//------------------------------------------------------------------------------
+//  void take(ArrayTemplate<T> &array)
+//
+//  Notes: used by the move operations on an object with no storage; array
+//         is left unsized
+//------------------------------------------------------------------------------
+template <class T>
+void
+ArrayTemplate<T>::take(ArrayTemplate<T> &array)
+{
+   if (array.elementD == array.smallD)
+   {
+      init(array.sizeD);
+      for (int i = 0; i < sizeD; i++)
+      {
+         elementD[i] = array.elementD[i];
+      }
+   }
+   else
+   {
+      elementD = array.elementD;
+      sizeD = array.sizeD;
+      isSizedD = true;
+   }
+
+   array.elementD = (T *) 0;
+   array.sizeD = 0;
+   array.isSizedD = false;
+}
@@ -36,6 +36,8 @@
 
 #include "utildefs.hpp"
 #include "BaseException.hpp"
+#include "ArrayAllocationCounter.hpp"
+#include "MemoryTracker.hpp"
 
 class GMATUTIL_API ArrayTemplateExceptions
 {
@@ -84,11 +86,13 @@ public:
                                                          // allowed by compiler
     ArrayTemplate(Integer sizeOfArray, const T* array); // copy from c style array  
     ArrayTemplate(const ArrayTemplate<T> &array); 
+    ArrayTemplate(ArrayTemplate<T> &&array);
     virtual ~ArrayTemplate();
    
     // operators
    
     const ArrayTemplate<T>& operator=(const ArrayTemplate<T> &array); 
+    const ArrayTemplate<T>& operator=(ArrayTemplate<T> &&array);
     bool operator==(const ArrayTemplate<T> &array) const;
     bool operator!=(const ArrayTemplate<T> &array) const;
     virtual T&        operator()(Integer index);          
@@ -106,11 +110,18 @@ public:
     const T* GetDataVector() const {return elementD;}
  
 protected:
+    /// Largest array kept in smallD rather than on the heap
+    static const Integer SMALL_SIZE = 6;
+
     void init(Integer s);      // used internally for initialization
+    void release();            // frees heap storage, if there is any
+    void take(ArrayTemplate<T> &array);
 
     T    *elementD;
     Integer  sizeD;
     bool isSizedD;
+    /// Storage for arrays of up to SMALL_SIZE elements
+    T    smallD[SMALL_SIZE];
 
 private:
 };
@@ -0,0 +1,262 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              AsyncStreamBuffer
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the stream buffer that writes on a background thread
+ */
+//------------------------------------------------------------------------------
+
+#include "AsyncStreamBuffer.hpp"
+
+const size_t AsyncStreamBuffer::BATCH_SIZE;
+const size_t AsyncStreamBuffer::PUT_AREA_SIZE;
+
+
+//------------------------------------------------------------------------------
+// AsyncStreamBuffer()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+AsyncStreamBuffer::AsyncStreamBuffer() :
+   stream      (NULL),
+   target      (NULL),
+   writer      (NULL),
+   writing     (false),
+   stopWriter  (false)
+{
+   setp(putArea, putArea + PUT_AREA_SIZE);
+}
+
+
+//------------------------------------------------------------------------------
+// ~AsyncStreamBuffer()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; writes the pending text and restores the stream's buffer
+ */
+//------------------------------------------------------------------------------
+AsyncStreamBuffer::~AsyncStreamBuffer()
+{
+   Detach();
+}
+
+
+//------------------------------------------------------------------------------
+// void Attach(std::ostream &toStream)
+//------------------------------------------------------------------------------
+/**
+ * Installs the buffer in a stream, detaching it from any other one first
+ *
+ * @param toStream The stream
+ */
+//------------------------------------------------------------------------------
+void AsyncStreamBuffer::Attach(std::ostream &toStream)
+{
+   Detach();
+
+   // Replacing the buffer clears the stream state; keep it
+   std::ios::iostate state = toStream.rdstate();
+   target = toStream.rdbuf(this);
+   toStream.clear(state);
+   stream = &toStream;
+
+   writer = new std::thread(&AsyncStreamBuffer::WriterLoop, this);
+}
+
+
+//------------------------------------------------------------------------------
+// void Detach()
+//------------------------------------------------------------------------------
+/**
+ * Writes all of the text, stops the writer thread and restores the stream's
+ * original buffer
+ */
+//------------------------------------------------------------------------------
+void AsyncStreamBuffer::Detach()
+{
+   if (stream == NULL)
+      return;
+
+   Flush();
+
+   {
+      std::lock_guard<std::mutex> lock(writerMutex);
+      stopWriter = true;
+   }
+   writerSignal.notify_all();
+   writer->join();
+   delete writer;
+   writer = NULL;
+   stopWriter = false;
+
+   std::ios::iostate state = stream->rdstate();
+   stream->rdbuf(target);
+   stream->clear(state);
+   stream = NULL;
+   target = NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsAttached() const
+//------------------------------------------------------------------------------
+bool AsyncStreamBuffer::IsAttached() const
+{
+   return stream != NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// void Flush()
+//------------------------------------------------------------------------------
+/**
+ * Writes all of the text to the original buffer, and flushes it, before
+ * returning
+ */
+//------------------------------------------------------------------------------
+void AsyncStreamBuffer::Flush()
+{
+   if (stream == NULL)
+      return;
+
+   MovePutArea();
+   HandOff();
+
+   std::unique_lock<std::mutex> lock(writerMutex);
+   while (writing)
+      writerSignal.wait(lock);
+   target->pubsync();
+}
+
+
+//------------------------------------------------------------------------------
+// int_type overflow(int_type ch)
+//------------------------------------------------------------------------------
+/**
+ * Moves the full put area to the pending text
+ *
+ * @param ch The character that did not fit, or EOF
+ *
+ * @return A value other than EOF
+ */
+//------------------------------------------------------------------------------
+AsyncStreamBuffer::int_type AsyncStreamBuffer::overflow(int_type ch)
+{
+   MovePutArea();
+   if (!traits_type::eq_int_type(ch, traits_type::eof()))
+   {
+      *pptr() = traits_type::to_char_type(ch);
+      pbump(1);
+   }
+
+   if (pending.size() >= BATCH_SIZE)
+      HandOff();
+
+   return traits_type::not_eof(ch);
+}
+
+
+//------------------------------------------------------------------------------
+// int sync()
+//------------------------------------------------------------------------------
+/**
+ * Moves the put area to the pending text; the text is written with the next
+ * batch, so flushing the stream does not wait for the file
+ *
+ * @return 0
+ */
+//------------------------------------------------------------------------------
+int AsyncStreamBuffer::sync()
+{
+   MovePutArea();
+   if (pending.size() >= BATCH_SIZE)
+      HandOff();
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// void MovePutArea()
+//------------------------------------------------------------------------------
+/**
+ * Appends the text in the put area to the pending text and empties the area
+ */
+//------------------------------------------------------------------------------
+void AsyncStreamBuffer::MovePutArea()
+{
+   if (pptr() > pbase())
+      pending.append(pbase(), pptr() - pbase());
+   setp(putArea, putArea + PUT_AREA_SIZE);
+}
+
+
+//------------------------------------------------------------------------------
+// void HandOff()
+//------------------------------------------------------------------------------
+/**
+ * Hands the pending text to the writer thread, after the batch it is writing
+ */
+//------------------------------------------------------------------------------
+void AsyncStreamBuffer::HandOff()
+{
+   if (pending.empty())
+      return;
+
+   std::unique_lock<std::mutex> lock(writerMutex);
+   while (writing)
+      writerSignal.wait(lock);
+
+   batch.swap(pending);
+   writing = true;
+   writerSignal.notify_all();
+}
+
+
+//------------------------------------------------------------------------------
+// void WriterLoop()
+//------------------------------------------------------------------------------
+/**
+ * Writes batches to the original buffer until the writer is stopped
+ *
+ * The batch is written with the mutex released; the stream's thread does not
+ * touch it until the writing flag is cleared.
+ */
+//------------------------------------------------------------------------------
+void AsyncStreamBuffer::WriterLoop()
+{
+   std::unique_lock<std::mutex> lock(writerMutex);
+   while (true)
+   {
+      while (!writing && !stopWriter)
+         writerSignal.wait(lock);
+      if (!writing)
+         break;
+
+      lock.unlock();
+      target->sputn(batch.data(), batch.size());
+      batch.clear();
+      lock.lock();
+
+      writing = false;
+      writerSignal.notify_all();
+   }
+}
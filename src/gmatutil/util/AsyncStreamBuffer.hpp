@@ -0,0 +1,101 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              AsyncStreamBuffer
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Stream buffer that collects the output of a stream in memory and passes it
+ * to the stream's own buffer on a background thread
+ */
+//------------------------------------------------------------------------------
+#ifndef AsyncStreamBuffer_hpp
+#define AsyncStreamBuffer_hpp
+
+#include "utildefs.hpp"
+#include <streambuf>
+#include <ostream>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+/**
+ * Collects the text written to a stream and writes it out in large batches.
+ *
+ * Attach() installs the buffer in a stream, such as an open std::ofstream.
+ * Text written to the stream, formatted as usual, is appended to a pending
+ * buffer; when that holds BATCH_SIZE bytes it is handed to a writer thread,
+ * which passes it to the stream's original buffer while formatting goes on.
+ * Flushing the stream does not wait for the file: the text reaches it with
+ * the next batch, or when Flush() or Detach() is called.  Detach() writes all
+ * of the text and puts the original buffer back, and must be called before
+ * the stream is closed.
+ *
+ * The stream is written from one thread, the one that attached the buffer.
+ */
+class GMATUTIL_API AsyncStreamBuffer : public std::streambuf
+{
+public:
+   AsyncStreamBuffer();
+   virtual ~AsyncStreamBuffer();
+
+   void           Attach(std::ostream &toStream);
+   void           Detach();
+   bool           IsAttached() const;
+   void           Flush();
+
+protected:
+   /// Pending text that is handed to the writer thread
+   static const size_t  BATCH_SIZE = 1048576;
+   /// Size of the put area filled by the stream
+   static const size_t  PUT_AREA_SIZE = 4096;
+
+   /// The stream the buffer is installed in
+   std::ostream            *stream;
+   /// The stream's original buffer, written by the writer thread
+   std::streambuf          *target;
+   /// The put area
+   char                    putArea[PUT_AREA_SIZE];
+   /// Text waiting to be handed to the writer thread
+   std::string             pending;
+   /// Text being written by the writer thread
+   std::string             batch;
+   /// Guards the batch and the flags
+   std::mutex              writerMutex;
+   /// Wakes the writer for a batch, and waiters when a batch is written
+   std::condition_variable writerSignal;
+   /// The writer thread
+   std::thread             *writer;
+   /// Flag set while a batch is being written
+   bool                    writing;
+   /// Flag telling the writer thread to exit
+   bool                    stopWriter;
+
+   virtual int_type        overflow(int_type ch);
+   virtual int             sync();
+
+   void                    MovePutArea();
+   void                    HandOff();
+   void                    WriterLoop();
+
+private:
+   // Not copyable
+   AsyncStreamBuffer(const AsyncStreamBuffer&);
+   AsyncStreamBuffer& operator=(const AsyncStreamBuffer&);
+};
+
+#endif // AsyncStreamBuffer_hpp
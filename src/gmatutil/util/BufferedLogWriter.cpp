@@ -0,0 +1,372 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              BufferedLogWriter
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the batching log file writer
+ */
+//------------------------------------------------------------------------------
+
+#include "BufferedLogWriter.hpp"
+#include <set>
+#include <chrono>
+#include <cstdlib>
+
+#if !defined(_WIN32)
+   #define LOG_WRITER_HANDLES_FORK
+   #include <pthread.h>
+#endif
+
+const size_t  BufferedLogWriter::BATCH_SIZE;
+const Integer BufferedLogWriter::FLUSH_INTERVAL_MS;
+
+
+namespace
+{
+   /// Guards the set of open writers
+   std::mutex& RegistryMutex()
+   {
+      static std::mutex registryMutex;
+      return registryMutex;
+   }
+
+   /// The open writers, flushed at exit and reset in forked children
+   std::set<BufferedLogWriter*>& Registry()
+   {
+      static std::set<BufferedLogWriter*> *registry =
+            new std::set<BufferedLogWriter*>;
+      return *registry;
+   }
+
+   /// Used to install the exit and fork handlers once
+   std::once_flag handlersInstalled;
+}
+
+
+//------------------------------------------------------------------------------
+// BufferedLogWriter()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+BufferedLogWriter::BufferedLogWriter() :
+   logFile     (NULL),
+   writer      (NULL),
+   writing     (false),
+   stopWriter  (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~BufferedLogWriter()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; writes the pending text and closes the file
+ */
+//------------------------------------------------------------------------------
+BufferedLogWriter::~BufferedLogWriter()
+{
+   Close();
+}
+
+
+//------------------------------------------------------------------------------
+// bool Open(const std::string &fileName, bool append)
+//------------------------------------------------------------------------------
+/**
+ * Opens a log file, closing the current one
+ *
+ * @param fileName The file
+ * @param append   true to append to the file, false to replace it
+ *
+ * @return true if the file was opened
+ */
+//------------------------------------------------------------------------------
+bool BufferedLogWriter::Open(const std::string &fileName, bool append)
+{
+   Close();
+
+   FILE *file = fopen(fileName.c_str(), append ? "a" : "w");
+   if (file == NULL)
+      return false;
+
+   {
+      std::lock_guard<std::mutex> lock(writerMutex);
+      logFile = file;
+   }
+   Register(this);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsOpen()
+//------------------------------------------------------------------------------
+bool BufferedLogWriter::IsOpen()
+{
+   std::lock_guard<std::mutex> lock(writerMutex);
+   return logFile != NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// void Write(const std::string &text)
+//------------------------------------------------------------------------------
+/**
+ * Queues text for the log file
+ *
+ * @param text The text
+ */
+//------------------------------------------------------------------------------
+void BufferedLogWriter::Write(const std::string &text)
+{
+   std::lock_guard<std::mutex> lock(writerMutex);
+   if (logFile == NULL)
+      return;
+
+   pending += text;
+   if (writer == NULL)
+      writer = new std::thread(&BufferedLogWriter::WriterLoop, this);
+   else if (pending.size() >= BATCH_SIZE)
+      writerSignal.notify_all();
+}
+
+
+//------------------------------------------------------------------------------
+// void Flush()
+//------------------------------------------------------------------------------
+/**
+ * Writes all pending text to the file before returning
+ */
+//------------------------------------------------------------------------------
+void BufferedLogWriter::Flush()
+{
+   std::unique_lock<std::mutex> lock(writerMutex);
+   WritePending(lock);
+   while (writing)
+      writerSignal.wait(lock);
+}
+
+
+//------------------------------------------------------------------------------
+// void Close()
+//------------------------------------------------------------------------------
+/**
+ * Writes the pending text, stops the writer thread and closes the file
+ */
+//------------------------------------------------------------------------------
+void BufferedLogWriter::Close()
+{
+   Flush();
+   StopWriter();
+   Unregister(this);
+
+   std::lock_guard<std::mutex> lock(writerMutex);
+   if (logFile != NULL)
+      fclose(logFile);
+   logFile = NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// void FlushAll()
+//------------------------------------------------------------------------------
+/**
+ * Writes the pending text of every open writer; installed as an exit handler
+ */
+//------------------------------------------------------------------------------
+void BufferedLogWriter::FlushAll()
+{
+   std::lock_guard<std::mutex> lock(RegistryMutex());
+   for (std::set<BufferedLogWriter*>::iterator i = Registry().begin();
+        i != Registry().end(); ++i)
+      (*i)->Flush();
+}
+
+
+//------------------------------------------------------------------------------
+// void WritePending(std::unique_lock<std::mutex> &lock)
+//------------------------------------------------------------------------------
+/**
+ * Writes the pending text as one batch, in order after any batch being written
+ *
+ * The file is written with the mutex released, so writes made meanwhile only
+ * wait for the buffer swap.
+ *
+ * @param lock The held lock on the writer mutex
+ */
+//------------------------------------------------------------------------------
+void BufferedLogWriter::WritePending(std::unique_lock<std::mutex> &lock)
+{
+   while (writing)
+      writerSignal.wait(lock);
+   if (pending.empty() || (logFile == NULL))
+      return;
+
+   batch.swap(pending);
+   writing = true;
+   FILE *file = logFile;
+   lock.unlock();
+
+   fwrite(batch.data(), 1, batch.size(), file);
+   fflush(file);
+   batch.clear();
+
+   lock.lock();
+   writing = false;
+   writerSignal.notify_all();
+}
+
+
+//------------------------------------------------------------------------------
+// void WriterLoop()
+//------------------------------------------------------------------------------
+/**
+ * Writes batches until the writer is stopped
+ */
+//------------------------------------------------------------------------------
+void BufferedLogWriter::WriterLoop()
+{
+   std::unique_lock<std::mutex> lock(writerMutex);
+   while (!stopWriter)
+   {
+      writerSignal.wait_for(lock,
+            std::chrono::milliseconds(FLUSH_INTERVAL_MS));
+      WritePending(lock);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void StopWriter()
+//------------------------------------------------------------------------------
+/**
+ * Stops and joins the writer thread
+ */
+//------------------------------------------------------------------------------
+void BufferedLogWriter::StopWriter()
+{
+   std::thread *running;
+   {
+      std::lock_guard<std::mutex> lock(writerMutex);
+      running = writer;
+      stopWriter = true;
+   }
+   writerSignal.notify_all();
+
+   if (running != NULL)
+   {
+      running->join();
+      delete running;
+   }
+
+   std::lock_guard<std::mutex> lock(writerMutex);
+   writer = NULL;
+   stopWriter = false;
+}
+
+
+//------------------------------------------------------------------------------
+// void Register(BufferedLogWriter *logWriter)
+//------------------------------------------------------------------------------
+/**
+ * Adds an open writer to the registry, installing the handlers on first use
+ */
+//------------------------------------------------------------------------------
+void BufferedLogWriter::Register(BufferedLogWriter *logWriter)
+{
+   std::call_once(handlersInstalled, []()
+   {
+      std::atexit(BufferedLogWriter::FlushAll);
+      #ifdef LOG_WRITER_HANDLES_FORK
+         pthread_atfork(BufferedLogWriter::PrepareFork,
+               BufferedLogWriter::ParentAfterFork,
+               BufferedLogWriter::ChildAfterFork);
+      #endif
+   });
+
+   std::lock_guard<std::mutex> lock(RegistryMutex());
+   Registry().insert(logWriter);
+}
+
+
+//------------------------------------------------------------------------------
+// void Unregister(BufferedLogWriter *logWriter)
+//------------------------------------------------------------------------------
+void BufferedLogWriter::Unregister(BufferedLogWriter *logWriter)
+{
+   std::lock_guard<std::mutex> lock(RegistryMutex());
+   Registry().erase(logWriter);
+}
+
+
+//------------------------------------------------------------------------------
+// void PrepareFork()
+//------------------------------------------------------------------------------
+/**
+ * Holds every writer mutex across fork(), so none is copied while locked by
+ * another thread
+ */
+//------------------------------------------------------------------------------
+void BufferedLogWriter::PrepareFork()
+{
+   RegistryMutex().lock();
+   for (std::set<BufferedLogWriter*>::iterator i = Registry().begin();
+        i != Registry().end(); ++i)
+      (*i)->writerMutex.lock();
+}
+
+
+//------------------------------------------------------------------------------
+// void ParentAfterFork()
+//------------------------------------------------------------------------------
+void BufferedLogWriter::ParentAfterFork()
+{
+   for (std::set<BufferedLogWriter*>::iterator i = Registry().begin();
+        i != Registry().end(); ++i)
+      (*i)->writerMutex.unlock();
+   RegistryMutex().unlock();
+}
+
+
+//------------------------------------------------------------------------------
+// void ChildAfterFork()
+//------------------------------------------------------------------------------
+/**
+ * Resets the writers in a forked child
+ *
+ * The child has no writer threads, so the thread objects are dropped and new
+ * threads start with the child's first write.  Text pending at the fork is
+ * written by the parent, so the child drops its copy.
+ */
+//------------------------------------------------------------------------------
+void BufferedLogWriter::ChildAfterFork()
+{
+   for (std::set<BufferedLogWriter*>::iterator i = Registry().begin();
+        i != Registry().end(); ++i)
+   {
+      (*i)->writer = NULL;
+      (*i)->writing = false;
+      (*i)->pending.clear();
+      (*i)->writerMutex.unlock();
+   }
+   RegistryMutex().unlock();
+}
@@ -0,0 +1,97 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              BufferedLogWriter
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Log file writer that batches writes on a background thread
+ */
+//------------------------------------------------------------------------------
+#ifndef BufferedLogWriter_hpp
+#define BufferedLogWriter_hpp
+
+#include "utildefs.hpp"
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+/**
+ * Writes log text to a file in batches.
+ *
+ * Write() appends the text to a pending buffer and returns.  A writer thread
+ * started with the first write moves the buffer to the file when it holds
+ * BATCH_SIZE bytes, or FLUSH_INTERVAL_MS after the last batch, and flushes the
+ * file once per batch.  Flush() writes the pending text before returning, and
+ * is called for every open writer when the process exits.  On POSIX systems a
+ * forked child gets a fresh writer thread, so its log text is not lost.
+ */
+class GMATUTIL_API BufferedLogWriter
+{
+public:
+   BufferedLogWriter();
+   ~BufferedLogWriter();
+
+   bool        Open(const std::string &fileName, bool append = false);
+   bool        IsOpen();
+   void        Write(const std::string &text);
+   void        Flush();
+   void        Close();
+
+   static void FlushAll();
+
+protected:
+   /// Pending text that starts a batch without waiting for the interval
+   static const size_t  BATCH_SIZE = 65536;
+   /// Longest time text waits in the pending buffer, in milliseconds
+   static const Integer FLUSH_INTERVAL_MS = 200;
+
+   /// The log file
+   FILE                    *logFile;
+   /// Text waiting to be written
+   std::string             pending;
+   /// Text being written
+   std::string             batch;
+   /// Guards the buffers and flags
+   std::mutex              writerMutex;
+   /// Wakes the writer for a full batch, and waiters when a batch is written
+   std::condition_variable writerSignal;
+   /// The writer thread; left unjoined in a forked child, where it is not run
+   std::thread             *writer;
+   /// Flag set while a batch is being written
+   bool                    writing;
+   /// Flag telling the writer thread to exit
+   bool                    stopWriter;
+
+   void        WritePending(std::unique_lock<std::mutex> &lock);
+   void        WriterLoop();
+   void        StopWriter();
+
+   static void Register(BufferedLogWriter *logWriter);
+   static void Unregister(BufferedLogWriter *logWriter);
+   static void PrepareFork();
+   static void ParentAfterFork();
+   static void ChildAfterFork();
+
+private:
+   // Not copyable
+   BufferedLogWriter(const BufferedLogWriter&);
+   BufferedLogWriter& operator=(const BufferedLogWriter&);
+};
+
+#endif // BufferedLogWriter_hpp
@@ -31,6 +31,7 @@
 #include <fstream>
 #include <sstream>
 #include <cstdlib>
+#include <algorithm>
 #include "FileUtil.hpp"
 #include "FileTypes.hpp"
 #include "StringUtil.hpp"
@@ -75,7 +76,9 @@ CCSDSEMReader::CCSDSEMReader() :
    metaDataTypeField     ("ANY"),
    dataType              (""),
    currentSegment        (NULL),
-   numSegments           (0)
+   numSegments           (0),
+   lastSegment           (-1),
+   segmentsOrdered       (false)
 {
    comments.clear();
    segments.clear();
@@ -100,7 +103,9 @@ CCSDSEMReader::CCSDSEMReader(const CCSDSEMReader &copy) :
    metaSpecifiesType     (copy.metaSpecifiesType),
    metaDataTypeField     (copy.metaDataTypeField),
    dataType              (copy.dataType),
-   currentSegment        (NULL)
+   currentSegment        (NULL),
+   lastSegment           (-1),
+   segmentsOrdered       (false)
 {
    segments.clear();
    numSegments = 0;
@@ -136,6 +141,9 @@ CCSDSEMReader& CCSDSEMReader::operator=(const CCSDSEMReader &copy)
    dataType                = copy.dataType;
    currentSegment          = NULL;   // not sure if this is right
    numSegments             = copy.numSegments;
+   lastSegment             = -1;
+   segmentStartTimes       = copy.segmentStartTimes;
+   segmentsOrdered         = copy.segmentsOrdered;
 
    for (unsigned int ii = 0; ii < segments.size(); ii++)
    {
@@ -300,6 +308,7 @@ void CCSDSEMReader::Initialize()
       MessageInterface::ShowMessage("      in CCSDSEMReader::Initialize, start and stop times have been checked.\n");
    #endif
 
+   BuildSegmentIndex();
    isInitialized = true;
 }
 
@@ -331,6 +340,9 @@ bool CCSDSEMReader::SetFile(const std::string &theEMFile)
       }
       segments.clear();
       numSegments = 0;
+      lastSegment = -1;
+      segmentStartTimes.clear();
+      segmentsOrdered = false;
 
       Initialize();
    }
@@ -402,13 +414,69 @@ CCSDSEMSegment* CCSDSEMReader::GetSegment(Integer num)
 // -----------------------------------------------------------------------------
 Integer CCSDSEMReader::GetSegmentNumber(Real epoch)
 {
+   // Successive lookups nearly always fall in the segment found last time.
+   // The segment before it is checked too, so that an epoch on a shared
+   // boundary still resolves to the first segment covering it.
+   if ((lastSegment >= 0) && (lastSegment < numSegments) &&
+       (segments.at(lastSegment))->CoversEpoch(epoch) &&
+       ((lastSegment == 0) ||
+        !(segments.at(lastSegment - 1))->CoversEpoch(epoch)))
+      return lastSegment;
+
+   // Binary search for the last segment starting at or before the epoch,
+   // then step back over the segments whose stop time reaches it; the
+   // lowest one covering the epoch is the one the linear search would find.
+   // The margin is well above the segment epoch match tolerance.
+   if (segmentsOrdered)
+   {
+      static const Real SEARCH_MARGIN = 1.0 / GmatTimeConstants::SECS_PER_DAY;
+      Integer found = -1;
+      Integer ii = (Integer)(std::upper_bound(segmentStartTimes.begin(),
+            segmentStartTimes.end(), epoch + SEARCH_MARGIN) -
+            segmentStartTimes.begin()) - 1;
+      for (; ii >= 0; ii--)
+      {
+         if ((segments.at(ii))->GetStopTime() < epoch - SEARCH_MARGIN)
+            break;
+         if ((segments.at(ii))->CoversEpoch(epoch))
+            found = ii;
+      }
+      if (found >= 0)
+         lastSegment = found;
+      return found;
+   }
+
    for (Integer ii = 0; ii < numSegments; ii++)
    {
-      if ((segments.at(ii))->CoversEpoch(epoch))  return ii;
+      if ((segments.at(ii))->CoversEpoch(epoch))
+      {
+         lastSegment = ii;
+         return ii;
+      }
    }
    return -1;
 }
 
+// -----------------------------------------------------------------------------
+// void BuildSegmentIndex()
+// Stores the segment start times for the epoch lookup.  The binary search is
+// only used when every segment stops no later than the next one starts;
+// otherwise GetSegmentNumber falls back to checking each segment in turn.
+// -----------------------------------------------------------------------------
+void CCSDSEMReader::BuildSegmentIndex()
+{
+   segmentStartTimes.clear();
+   segmentsOrdered = true;
+   for (Integer ii = 0; ii < numSegments; ii++)
+   {
+      Real segStart = (segments.at(ii))->GetStartTime();
+      if ((segStart > (segments.at(ii))->GetStopTime()) ||
+          ((ii > 0) && (segStart < (segments.at(ii-1))->GetStopTime())))
+         segmentsOrdered = false;
+      segmentStartTimes.push_back(segStart);
+   }
+}
+
 // -----------------------------------------------------------------------------
 // CCSDSEMSegment* GetSegment(Real epoch)
 // Returns the segment that contains the epoch specified
@@ -417,11 +485,10 @@ Integer CCSDSEMReader::GetSegmentNumber(Real epoch)
 // -----------------------------------------------------------------------------
 CCSDSEMSegment* CCSDSEMReader::GetSegment(Real epoch)
 {
-   for (Integer ii = 0; ii < numSegments; ii++)
-   {
-      if ((segments.at(ii))->CoversEpoch(epoch)) return segments.at(ii);
-   }
-   return NULL;
+   Integer segNum = GetSegmentNumber(epoch);
+   if (segNum < 0)
+      return NULL;
+   return segments.at(segNum);
 }
 
 // -----------------------------------------------------------------------------
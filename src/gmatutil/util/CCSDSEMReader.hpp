@@ -130,6 +130,12 @@ protected:
 
    /// the number of segments
    Integer        numSegments;
+   /// index of the segment found by the last epoch lookup, or -1
+   Integer        lastSegment;
+   /// segment start times, used for the binary search in GetSegmentNumber
+   RealArray      segmentStartTimes;
+   /// are the segments ordered so that the start times can be searched?
+   bool           segmentsOrdered;
    /// in stream
    std::ifstream ephFile;
 
@@ -154,6 +160,8 @@ protected:
    virtual bool            ParseFile() = 0;
 
 
+   virtual void            BuildSegmentIndex();
+
 private:
    void ReadLine(std::ifstream& ephFile, std::string&line);
    std::string LeftTrim(std::string str);
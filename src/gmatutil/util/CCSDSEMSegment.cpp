@@ -30,6 +30,7 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 #include "CCSDSEMSegment.hpp"
 #include "MessageInterface.hpp"
 #include "GmatConstants.hpp"
@@ -984,28 +985,29 @@ Rvector CCSDSEMSegment::DetermineState(Real atEpoch)
    }
    bool      exactMatchFound = false;
    Integer   matchPos        = -1;
-   for (unsigned int ii= 0; ii < dataStore.size(); ii++)
-   {
-      Real theTime = (dataStore.at(ii))->epoch;
-
+   // The data epochs increase strictly (see AddData), so binary search for the
+   // first point that is not before the epoch; the point before it is the
+   // last one earlier than the epoch
+   std::vector<EpochAndData*>::iterator next =
+         std::partition_point(dataStore.begin(), dataStore.end(),
+         [atEpoch](const EpochAndData *point)
+         {
+            return (point->epoch < atEpoch) &&
+               !GmatMathUtil::IsEqual(point->epoch, atEpoch, EPOCH_MATCH_TOLERANCE);
+         });
+   Integer nextPos = (Integer)(next - dataStore.begin());
+   if ((next != dataStore.end()) &&
+       GmatMathUtil::IsEqual((*next)->epoch, atEpoch, EPOCH_MATCH_TOLERANCE))
+   {
+      exactMatchFound = true;
+      matchPos        = nextPos;
       #ifdef DEBUG_EM_FIND_EXACT_MATCH
-         MessageInterface::ShowMessage("----  data epoch(%d) = %12.10f \n",
-               ii, theTime);
+         MessageInterface::ShowMessage("---- EXACT MATCH to epoch = %12.10f\n",
+               (*next)->epoch);
       #endif
-      if (GmatMathUtil::IsEqual(theTime, atEpoch, EPOCH_MATCH_TOLERANCE))
-      {
-         exactMatchFound = true;
-         matchPos        = ii;
-         #ifdef DEBUG_EM_FIND_EXACT_MATCH
-            MessageInterface::ShowMessage("---- EXACT MATCH to epoch = %12.10f\n",
-                  (dataStore.at(ii))->epoch);
-          #endif
-         break;
-      }
-      if (theTime < atEpoch)  matchPos = ii;
-      // if the time is bigger, we've gone past and won't find an exact match
-      else if (theTime > atEpoch) break;
    }
+   else
+      matchPos = nextPos - 1;
    // if we didn't find an exact match OR an epoch less than the input
    // epoch, that is an error
    if (matchPos < 0)
@@ -1133,17 +1135,17 @@ Rvector CCSDSEMSegment::InterpolateLagrange(Real atEpoch)
 
    // find intended position of epoch in ephemeris data
    // find correct (first largest) epoch in ephemeris data
-   Real    anEpoch  = 0.0;
    Integer epochPos = 0;
-   for (Integer ii = firstUsable; ii <= lastUsable; ii++)
-   {
-      anEpoch = (dataStore.at(ii))->epoch;
-      if ( anEpoch > atEpoch)
-      {
-         epochPos = ii;
-         break;
-      }
-   }
+   std::vector<EpochAndData*>::iterator usableEnd =
+         dataStore.begin() + lastUsable + 1;
+   std::vector<EpochAndData*>::iterator later =
+         std::upper_bound(dataStore.begin() + firstUsable, usableEnd, atEpoch,
+         [](Real epoch, const EpochAndData *point)
+         {
+            return epoch < point->epoch;
+         });
+   if (later != usableEnd)
+      epochPos = (Integer)(later - dataStore.begin());
    Integer initIndex = -1;
    // pick starting point for interpolation data
    // (region ending just before epoch's position in the ephemeris)
@@ -1262,16 +1264,20 @@ Rvector CCSDSEMSegment::InterpolateSLERP(Real atEpoch)
 
    // Interpolation Algorithm (SLERP)
    // find correct (first largest) epoch in ephemeris data
-   Real    anEpoch  = 0.0;
+   Real    anEpoch  = dataStore.at(lastUsable)->epoch;
    Integer epochPos = 0;
-   for (Integer ii = firstUsable; ii <= lastUsable; ii++)
+   std::vector<EpochAndData*>::iterator usableEnd =
+         dataStore.begin() + lastUsable + 1;
+   std::vector<EpochAndData*>::iterator later =
+         std::upper_bound(dataStore.begin() + firstUsable, usableEnd, atEpoch,
+         [](Real epoch, const EpochAndData *point)
+         {
+            return epoch < point->epoch;
+         });
+   if (later != usableEnd)
    {
-      anEpoch = (dataStore.at(ii))->epoch;
-      if ( anEpoch > atEpoch)
-      {
-         epochPos = ii;
-         break;
-      }
+      anEpoch  = (*later)->epoch;
+      epochPos = (Integer)(later - dataStore.begin());
    }
    #ifdef DEBUG_SLERP
       MessageInterface::ShowMessage("In SLERP, minEpoch = %12.10f\n", minEpoch);
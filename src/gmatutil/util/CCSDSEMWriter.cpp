@@ -100,6 +100,8 @@ CCSDSEMWriter& CCSDSEMWriter::operator=(const CCSDSEMWriter &copy)
 // -----------------------------------------------------------------------------
 CCSDSEMWriter::~CCSDSEMWriter()
 {
+   if (writerThread.joinable())
+      writerThread.join();
    emOutStream.flush();
    emOutStream.close();
 }
@@ -122,6 +124,7 @@ bool CCSDSEMWriter::OpenFile(const std::string &filename)
    
    bool retval = false;
    
+   WaitForWriter();
    if (emOutStream.is_open())
       emOutStream.close();
    
@@ -197,6 +200,7 @@ bool CCSDSEMWriter::SetHeaderForWriting(const std::string &fieldName,
 //------------------------------------------------------------------------------
 bool CCSDSEMWriter::WriteHeader(const std::string &versionFieldName)
 {
+   WaitForWriter();
    if (!emOutStream.is_open())
       return false;
    
@@ -229,6 +233,7 @@ bool CCSDSEMWriter::WriteHeader(const std::string &versionFieldName)
 //------------------------------------------------------------------------------
 bool CCSDSEMWriter::WriteBlankLine()
 {
+   WaitForWriter();
    if (!emOutStream.is_open())
       return false;
    
@@ -251,6 +256,7 @@ bool CCSDSEMWriter::WriteString(const std::string &str)
       ("CCSDSEMWriter::WriteString() entered, str='%s'\n", str.c_str());
    #endif
    
+   WaitForWriter();
    if (!emOutStream.is_open())
       return false;
    
@@ -335,6 +341,30 @@ std::string CCSDSEMWriter::A1ModJulianToUtcGregorian(Real epochInDays, Integer f
 }
 
 
+//------------------------------------------------------------------------------
+// void WaitForWriter()
+//------------------------------------------------------------------------------
+/**
+ * Waits for the data segment being written in the background, so that the
+ * file is written in order.
+ *
+ * @exception UtilityException if the segment could not be written
+ */
+//------------------------------------------------------------------------------
+void CCSDSEMWriter::WaitForWriter()
+{
+   if (writerThread.joinable())
+      writerThread.join();
+   
+   if (writerError != "")
+   {
+      std::string msg = writerError;
+      writerError = "";
+      throw UtilityException(msg);
+   }
+}
+
+
 
 bool CCSDSEMWriter::SetWritingAccelerationOption(const bool writeOption)
 {
@@ -33,6 +33,7 @@
 #include "Rvector.hpp"
 #include "utildefs.hpp"
 #include <fstream>
+#include <thread>
 #include "TimeSystemConverter.hpp"   // for the TimeSystemConverter singleton
 
 class GMATUTIL_API CCSDSEMWriter
@@ -99,8 +100,15 @@ protected:
    /// Time converter singleton
    TimeSystemConverter *theTimeConverter;
 
+   /// Thread writing the last data segment while the caller carries on
+   std::thread writerThread;
+   /// Error reported by the writer thread
+   std::string writerError;
+
    /// Time conversion
    std::string A1ModJulianToUtcGregorian(Real epochInDays, Integer format);
+
+   void        WaitForWriter();
 };
 
 #endif // CCSDSEMWriter_hpp
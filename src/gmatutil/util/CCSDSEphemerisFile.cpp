@@ -74,8 +74,7 @@
 //------------------------------------------------------------------------------
 CCSDSEphemerisFile::CCSDSEphemerisFile() :
    ccsdsFileNameForRead  (""),
-   stateType             ("OEM"),
-   fileReader            (NULL)
+   stateType             ("OEM")
 {
 }
 
@@ -84,12 +83,8 @@ CCSDSEphemerisFile::CCSDSEphemerisFile() :
 //------------------------------------------------------------------------------
 CCSDSEphemerisFile::CCSDSEphemerisFile(const CCSDSEphemerisFile &copy) :
    ccsdsFileNameForRead  (copy.ccsdsFileNameForRead),
-   stateType             (copy.stateType),
-   //fileReader            (copy.fileReader)
-   fileReader            (NULL)
+   stateType             (copy.stateType)
 {
-   if (copy.fileReader)
-      fileReader = copy.fileReader->Clone();
 }
 
 //------------------------------------------------------------------------------
@@ -102,13 +97,7 @@ CCSDSEphemerisFile& CCSDSEphemerisFile::operator=(const CCSDSEphemerisFile &copy
    
    ccsdsFileNameForRead  = copy.ccsdsFileNameForRead;
    stateType             = copy.stateType;
-
-   //fileReader            = copy.fileReader;
-   if (fileReader)
-      delete fileReader;
-   fileReader = NULL;
-   if (copy.fileReader)
-      fileReader = copy.fileReader->Clone();
+   ephemSource.reset();
 
    return *this;
 }
@@ -118,8 +107,6 @@ CCSDSEphemerisFile& CCSDSEphemerisFile::operator=(const CCSDSEphemerisFile &copy
 //------------------------------------------------------------------------------
 CCSDSEphemerisFile::~CCSDSEphemerisFile()
 {
-   if (fileReader != NULL)
-      delete fileReader;
 }
 
 //------------------------------------------------------------------------------
@@ -198,66 +185,10 @@ bool CCSDSEphemerisFile::OpenForRead(const std::string &filename,
    
 #ifdef DEBUG_CCSDS_FILE
    MessageInterface::ShowMessage
-   ("CCSDSEphemerisFile::OpenForRead() fileReader = <%p>\n", fileReader);
+   ("CCSDSEphemerisFile::OpenForRead() ephemSource = <%p>\n", ephemSource.get());
 #endif
-   if (fileReader == NULL)
-   {
-      if (stateType == "OEM")
-         fileReader = new CCSDSOEMReader();
-      else if (stateType == "AEM")
-         fileReader = new CCSDSAEMReader();
-
-      fileReader->SetFile(ccsdsFileNameForRead);
-      Integer numOfSegs = fileReader->GetNumberOfSegments();
-      Real startEp = -1.0;
-
-      theEphem.clear();
-      ephemRecords.clear();
-
-      for (Integer i = 0; i < numOfSegs; ++i)
-      {
-         CCSDSEMSegment* ccsdsSegment = fileReader->GetSegment(i);
-         Integer numOfDataPoints = ccsdsSegment->GetNumberOfDataPoints();
-         
-         Segment newsegment;
-         for (Integer index = 0; index < numOfDataPoints; ++index)
-         {
-            // Get epoch and state from CCSDS segment
-            Real epoch;
-            Rvector state;
-            ccsdsSegment->GetEpochAndData(index, epoch, state);
-            if (startEp == -1.0)
-               startEp = epoch;
-
-            // store epoch and state to Ephemeris' Segment
-            EphemPoint point;
-            point.theEpoch = epoch;
-            point.posvel = Rvector6(state[0], state[1], state[2], state[3], state[4], state[5]);
-            newsegment.points.push_back(point);
-
-            // Store time from start epoch and state to ephemRecords
-            EphemData eData;
-            eData.timeFromEpoch = (point.theEpoch - startEp) * GmatTimeConstants::SECS_PER_DAY;
-            for(Integer k = 0; k < 6; ++k)
-              eData.theState[k] = point.posvel(k);
-            ephemRecords.push_back(eData);
-         }
-         
-         newsegment.segStart = newsegment.points[0].theEpoch;
-         newsegment.segEnd   = newsegment.points[newsegment.points.size()-1].theEpoch;
-         theEphem.push_back(newsegment);
-      }
-      
-      a1StartEpoch = theEphem[0].points[0].theEpoch;
-      a1EndEpoch   = theEphem[theEphem.size()-1].points[theEphem[theEphem.size() - 1].points.size()-1].theEpoch;
-      scenarioEpochA1Mjd = a1StartEpoch;
-      
-      interpolatorName = fileReader->GetSegment(0)->GetStringMetaData("INTERPOLATION");
-      if (interpolatorName == "Lagrange")
-         useHermite = false;
-      
-      order = fileReader->GetSegment(0)->GetIntegerMetaData("INTERPOLATION_DEGREE");
-   }
+   if (!ephemSource)
+      LoadSource();
 
 #ifdef DEBUG_CCSDS_FILE
    MessageInterface::ShowMessage
@@ -310,12 +241,16 @@ bool CCSDSEphemerisFile::GetInitialAndFinalStates(Real &initialA1Mjd, Real &fina
    
    if (ReadDataRecords())
    {
-      int numRecords = ephemRecords.size();
-      
-      initialA1Mjd = scenarioEpochA1Mjd + ephemRecords[0].timeFromEpoch / GmatTimeConstants::SECS_PER_DAY;
-      finalA1Mjd = scenarioEpochA1Mjd + ephemRecords[numRecords - 1].timeFromEpoch / GmatTimeConstants::SECS_PER_DAY;
-      initialState = ephemRecords[0].theState;
-      finalState = ephemRecords[numRecords - 1].theState;
+      Integer lastSegment = ephemSource->GetSegmentCount() - 1;
+      Integer lastPoint = ephemSource->GetPointCount(lastSegment) - 1;
+      Real startEp = ephemSource->GetEpochs(0)[0];
+      Real finalTime = (ephemSource->GetEpochs(lastSegment)[lastPoint] -
+            startEp) * GmatTimeConstants::SECS_PER_DAY;
+
+      initialA1Mjd = scenarioEpochA1Mjd;
+      finalA1Mjd = scenarioEpochA1Mjd + finalTime / GmatTimeConstants::SECS_PER_DAY;
+      initialState.Set(ephemSource->GetState(0, 0));
+      finalState.Set(ephemSource->GetState(lastSegment, lastPoint));
 
       lastStateFound = true;
 
@@ -355,58 +290,8 @@ bool CCSDSEphemerisFile::ReadDataRecords(int logOption)
    std::vector<std::string> universallySupportedFrames = { "EME2000"};
 
    bool retval = false;
-   retval = fileReader->SetFile(ccsdsFileNameForRead);
-
-   Integer numOfSegs = fileReader->GetNumberOfSegments();
-   Real startEp = -1.0;
-   
-   theEphem.clear();
-   ephemRecords.clear();
-
-   for (Integer i = 0; i < numOfSegs; ++i)
-   {
-      CCSDSEMSegment* ccsdsSegment = fileReader->GetSegment(i);
-      Integer numOfDataPoints = ccsdsSegment->GetNumberOfDataPoints();
-      
-      Segment newsegment;
-      for (Integer index = 0; index < numOfDataPoints; ++index)
-      {
-         // Get epoch and state from CCSDS segment
-         Real epoch;
-         Rvector state;
-         ccsdsSegment->GetEpochAndData(index, epoch, state);
-         if (startEp == -1.0)
-            startEp = epoch;
-
-         // store epoch and state to Ephemeris' Segment
-         EphemPoint point;
-         point.theEpoch = epoch;
-         point.posvel = Rvector6(state[0], state[1], state[2], state[3], state[4], state[5]);
-         newsegment.points.push_back(point);
-
-         // Store time from start peoch and state to ephemRecords
-         EphemData eData;
-         eData.timeFromEpoch = (point.theEpoch - startEp) * GmatTimeConstants::SECS_PER_DAY;
-         for (Integer k = 0; k < 6; ++k)
-            eData.theState[k] = point.posvel(k);
-         ephemRecords.push_back(eData);
-      }
-      
-      newsegment.segStart = newsegment.points[0].theEpoch;
-      newsegment.segEnd = newsegment.points[newsegment.points.size() - 1].theEpoch;
-      theEphem.push_back(newsegment);
-   }
-
-   a1StartEpoch = theEphem[0].points[0].theEpoch;
-   a1EndEpoch = theEphem[theEphem.size() - 1].points[theEphem[theEphem.size() - 1].points.size() - 1].theEpoch;
-   scenarioEpochA1Mjd = a1StartEpoch;
-
-   interpolatorName = fileReader->GetSegment(0)->GetStringMetaData("INTERPOLATION");
-   if (interpolatorName == "Lagrange")
-      useHermite = false;
+   retval = LoadSource();
 
-   order = fileReader->GetSegment(0)->GetIntegerMetaData("INTERPOLATION_DEGREE");
-   
    std::string cb = GetCentralBody();
    if (cb == "Moon")
       cb = "Luna";
@@ -466,15 +351,8 @@ void CCSDSEphemerisFile::GetStartAndEndEpochs(GmatEpoch& startEpoch,
  //------------------------------------------------------------------------------
 std::string CCSDSEphemerisFile::GetCentralBody(Integer segmentNo)
 {
-   // Get segment with index given by segmentNo
-   CCSDSEMSegment* segment;
-   if (segmentNo == -1)
-      segment = fileReader->GetSegment();
-   else
-      segment = fileReader->GetSegment(segmentNo);
-
-   // Get central body name associate with this data segment
-   std::string cbName = segment->GetStringMetaData("CENTER_NAME");
+   // Get central body name associate with the data segment
+   std::string cbName = GetSegmentMetaData("CENTER_NAME", segmentNo);
    cbName = GmatStringUtil::ToUpper(cbName.substr(0, 1)) + GmatStringUtil::ToLower(cbName.substr(1));   // convert "LUNA", "EARTH", etc to "Luna", "Earth", etc
 
    return cbName;
@@ -491,34 +369,170 @@ std::string CCSDSEphemerisFile::GetCentralBody(Integer segmentNo)
  //------------------------------------------------------------------------------
 std::string CCSDSEphemerisFile::GetReferenceFrame(Integer segmentNo)
 {
-   // Get segment with index given by segmentNo
-   CCSDSEMSegment* segment;
-   if (segmentNo == -1)
-      segment = fileReader->GetSegment();
-   else
-      segment = fileReader->GetSegment(segmentNo);
-
-   // Get name of the reference frame associated with this data segment
-   std::string frameName = segment->GetStringMetaData("REF_FRAME");
+   // Get name of the reference frame associated with the data segment
+   std::string frameName = GetSegmentMetaData("REF_FRAME", segmentNo);
 
    return frameName;
 }
 
 void CCSDSEphemerisFile::GetInterpolationInfoFromSegment(Integer segmentNo)
 {
-   // Get segment with index given by segmentNo
-   CCSDSEMSegment* segment;
+   // Called for every interpolation, so the settings are read from the
+   // arrays LoadSource() filled rather than from the metadata strings
    if (segmentNo == -1)
-      segment = fileReader->GetSegment();
-   else
-      segment = fileReader->GetSegment(segmentNo);
-
-   // Get central body name associate with this data segment
-   order = segment->GetIntegerMetaData("INTERPOLATION_DEGREE");
-   std::string interpolationMethod = segment->GetStringMetaData("INTERPOLATION");
-   if (GmatStringUtil::ToLower(interpolationMethod) == "hermite")
-      useHermite = true;
-   else 
+      segmentNo = segmentOrders.size() - 1;
+   if ((segmentNo < 0) || ((UnsignedInt)segmentNo >= segmentOrders.size()))
+      throw UtilityException(
+            "EphemerisMessage:: segment number requested is out-of-range.");
+
+   order = segmentOrders[segmentNo];
+   useHermite = segmentUseHermite[segmentNo];
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetSegmentMetaData(const std::string &fieldName,
+//       Integer segmentNo)
+//------------------------------------------------------------------------------
+/**
+ * Returns a metadata value of a data segment
+ *
+ * @param fieldName The metadata keyword
+ * @param segmentNo The segment, or -1 for the last segment of the file
+ *
+ * @return The value
+ */
+//------------------------------------------------------------------------------
+std::string CCSDSEphemerisFile::GetSegmentMetaData(const std::string &fieldName,
+      Integer segmentNo)
+{
+   if (!ephemSource)
+      throw UtilityException("The CCSDS ephemeris file \"" +
+            ccsdsFileNameForRead + "\" has not been read");
+
+   if (segmentNo == -1)
+      segmentNo = ephemSource->GetSegmentCount() - 1;
+   if ((segmentNo < 0) || (segmentNo >= ephemSource->GetSegmentCount()))
+      throw UtilityException(
+            "EphemerisMessage:: segment number requested is out-of-range.");
+
+   return ephemSource->GetMetadata(fieldName, segmentNo);
+}
+
+
+//------------------------------------------------------------------------------
+// bool LoadSource()
+//------------------------------------------------------------------------------
+/**
+ * Loads the data points of the file
+ *
+ * The points are shared with any other reader of the file.  When the file is
+ * not already loaded (or in the ephemeris cache), it is parsed with a CCSDS
+ * reader, and the metadata the ephemeris needs is saved with the points so
+ * the reader can be discarded.
+ *
+ * @return true if the points were loaded
+ */
+//------------------------------------------------------------------------------
+bool CCSDSEphemerisFile::LoadSource()
+{
+   bool retval = true;
+
+   ephemSource = EphemerisSource::Find(ccsdsFileNameForRead, stateType);
+   ResetSearchData();
+
+   if (!ephemSource)
+   {
+      CCSDSEMReader *fileReader;
+      if (stateType == "AEM")
+         fileReader = new CCSDSAEMReader();
+      else
+         fileReader = new CCSDSOEMReader();
+
+      EphemerisSource *source = new EphemerisSource;
+      try
+      {
+         retval = fileReader->SetFile(ccsdsFileNameForRead);
+         Integer numOfSegs = fileReader->GetNumberOfSegments();
+
+         for (Integer i = 0; i < numOfSegs; ++i)
+         {
+            CCSDSEMSegment* ccsdsSegment = fileReader->GetSegment(i);
+            Integer numOfDataPoints = ccsdsSegment->GetNumberOfDataPoints();
+            if (numOfDataPoints == 0)
+               throw UtilityException("Data segment " +
+                     GmatStringUtil::ToString(i + 1, 1) +
+                     " of the CCSDS ephemeris file \"" +
+                     ccsdsFileNameForRead + "\" has no data points");
+
+            for (Integer index = 0; index < numOfDataPoints; ++index)
+            {
+               // Get epoch and state from CCSDS segment
+               Real epoch;
+               Rvector state;
+               ccsdsSegment->GetEpochAndData(index, epoch, state);
+
+               Real posvel[6];
+               for (Integer k = 0; k < 6; ++k)
+                  posvel[k] = state[k];
+               if (index == 0)
+                  source->AddSegment(epoch);
+               source->AddPoint(epoch, posvel);
+            }
+
+            std::stringstream degree;
+            degree << ccsdsSegment->GetIntegerMetaData("INTERPOLATION_DEGREE");
+            source->SetMetadata("INTERPOLATION_DEGREE", degree.str(), i);
+            source->SetMetadata("INTERPOLATION",
+                  ccsdsSegment->GetStringMetaData("INTERPOLATION"), i);
+            source->SetMetadata("CENTER_NAME",
+                  ccsdsSegment->GetStringMetaData("CENTER_NAME"), i);
+            source->SetMetadata("REF_FRAME",
+                  ccsdsSegment->GetStringMetaData("REF_FRAME"), i);
+         }
+      }
+      catch (...)
+      {
+         delete source;
+         delete fileReader;
+         throw;
+      }
+      delete fileReader;
+
+      if (source->GetSegmentCount() == 0)
+      {
+         delete source;
+         throw UtilityException("The CCSDS ephemeris file \"" +
+               ccsdsFileNameForRead + "\" has no data segments");
+      }
+
+      ephemSource = EphemerisSource::Share(ccsdsFileNameForRead, stateType,
+            source);
+   }
+
+   Integer numOfSegs = ephemSource->GetSegmentCount();
+   segmentOrders.clear();
+   segmentUseHermite.clear();
+   for (Integer i = 0; i < numOfSegs; ++i)
+   {
+      Integer degree = 0;
+      GmatStringUtil::ToInteger(
+            ephemSource->GetMetadata("INTERPOLATION_DEGREE", i), degree);
+      segmentOrders.push_back(degree);
+      segmentUseHermite.push_back(GmatStringUtil::ToLower(
+            ephemSource->GetMetadata("INTERPOLATION", i)) == "hermite");
+   }
+
+   a1StartEpoch = ephemSource->GetSegmentStart(0);
+   a1EndEpoch   = ephemSource->GetSegmentEnd(numOfSegs - 1);
+   scenarioEpochA1Mjd = a1StartEpoch;
+
+   interpolatorName = ephemSource->GetMetadata("INTERPOLATION", 0);
+   if (interpolatorName == "Lagrange")
       useHermite = false;
+
+   order = segmentOrders[0];
+
+   return retval;
 }
 
@@ -72,6 +72,8 @@ public:
    std::string GetReferenceFrame(Integer segmentNo = -1);     // when segmentNum = -1, it means the current segment
 
    virtual void GetInterpolationInfoFromSegment(Integer segmentNo);
+   std::string GetSegmentMetaData(const std::string &fieldName,
+      Integer segmentNo = -1);
 
 protected:
    /// state type would be: "OEM", "AEM", or "". 
@@ -80,9 +82,6 @@ protected:
    /// "AEM": (atitute, atituteDot) state
    std::string    stateType;
 
-   /// fileReader is either CCSDSOEMReader object or CCSDSAEMReader object
-   CCSDSEMReader* fileReader;
-   
    std::string ccsdsFileNameForRead;
    std::ifstream ccsdsInStream;
 
@@ -91,6 +90,11 @@ protected:
    Real        scenarioEpochA1Mjd;
 
    std::string interpolatorName;
+   /// Interpolation degree and type of each segment, from the segment metadata
+   IntegerArray segmentOrders;
+   BooleanArray segmentUseHermite;
+
+   bool LoadSource();
 };
 
 #endif // CCSDSEphemerisFile_hpp
@@ -56,6 +56,8 @@ CCSDSOEMWriter::CCSDSOEMWriter() :
    CCSDSEMWriter()
 {
    versionNumber = "1.0";
+   segmentData.dataSize = 0;
+   writerData.dataSize = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -64,6 +66,8 @@ CCSDSOEMWriter::CCSDSOEMWriter() :
 CCSDSOEMWriter::CCSDSOEMWriter(const CCSDSOEMWriter &copy) :
    CCSDSEMWriter(copy)
 {
+   segmentData.dataSize = 0;
+   writerData.dataSize = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -84,6 +88,9 @@ CCSDSOEMWriter& CCSDSOEMWriter::operator=(const CCSDSOEMWriter &copy)
 // -----------------------------------------------------------------------------
 CCSDSOEMWriter::~CCSDSOEMWriter()
 {
+   // The writer thread uses the members of this class
+   if (writerThread.joinable())
+      writerThread.join();
 }
 
 //------------------------------------------------------------------------------
@@ -108,6 +115,7 @@ bool CCSDSOEMWriter::WriteMetaData()
    MessageInterface::ShowMessage("CCSDSOEMWriter::WriteMetaData() entered\n");
    #endif
    
+   WaitForWriter();
    if (!emOutStream.is_open())
       return false;
    
@@ -139,6 +147,7 @@ bool CCSDSOEMWriter::WriteDataComments()
    MessageInterface::ShowMessage("CCSDSOEMWriter::WriteDataComments() entered\n");
    #endif
    
+   WaitForWriter();
    if (!emOutStream.is_open())
       return false;
    
@@ -158,6 +167,10 @@ bool CCSDSOEMWriter::WriteDataComments()
 //------------------------------------------------------------------------------
 /**
  * Writes saved data store to a file and then clears data store
+ *
+ * The data points are formatted and written by a writer thread, so the caller
+ * can go on collecting the next segment.  Other writes to the file wait for
+ * the thread to finish.
  */
 //------------------------------------------------------------------------------
 bool CCSDSOEMWriter::WriteDataSegment()
@@ -166,101 +179,19 @@ bool CCSDSOEMWriter::WriteDataSegment()
    MessageInterface::ShowMessage("CCSDSOEMWriter::WriteDataSegment() entered\n");
    #endif
    
+   WaitForWriter();
    if (!emOutStream.is_open())
       return false;
    
-   bool retval = true;
-   
-   Integer numPoints = currentOemSegment.GetNumberOfDataPoints();
-
-   std::stringstream ss;
-   if (writeCovariance)
-   {
-      ss << "\n";
-      ss << "COVARIANCE_START\n";
-   }
-
-   std::string covRefFrame = currentOemSegment.GetRefFrame();
-   
-   Real epoch;
-   Rvector data;
-   for (Integer i = 0; i < numPoints; i++)
-   {
-      if (currentOemSegment.GetEpochAndData(i, epoch, data))
-      {
-         if ((i > 0) && (writeCovariance))
-            ss << "\n";
-         
-         //if ((versionNumber == "1.0")&&(data.GetSize() != 6))
-         //{
-         //   MessageInterface::ShowMessage 
-         //      ("*** INTERNAL ERROR *** CCSDS OEM v1.0 data size is not 6\n");
-         //   retval = false;
-         //   break;
-         //}
-         
-         const Real *outState = data.GetDataVector();
-         std::string epochStr = A1ModJulianToUtcGregorian(epoch, 2);
-         char strBuff[300];
-         sprintf(strBuff, "%s  % 1.15e  % 1.15e  % 1.15e  % 1.15e  % 1.15e  % 1.15e",
-            epochStr.c_str(), outState[0], outState[1], outState[2], outState[3],
-            outState[4], outState[5]);
-         emOutStream << strBuff;
-
-         if (versionNumber == "2.0")
-         {
-            // Write out acceleration
-            if (writeAcceleration)
-            {
-               sprintf(strBuff, "  % 1.15e  % 1.15e  % 1.15e", 
-                  outState[6], outState[7], outState[8]);
-               emOutStream << strBuff;
-            }
-    
-            if (writeCovariance)
-            {
-               // Write out lower-left covariance matrix
-               char strBuff1[200];
-               ss << "EPOCH = " << epochStr << "\n";
-               ss << "COV_REF_FRAME = " << covRefFrame << "\n";
-               std::string lineFormat = "% 1.15e";
-               Integer idx = 9;
-               for (Integer row = 0; row < 6; ++row)
-               {
-                  for (Integer col = 0; col < 6; ++col)
-                  {
-                     if (row < col)
-                        continue;
-
-                     sprintf(strBuff1, "% 1.15e\0", outState[idx]);
-                     ++idx;
-                     ss << strBuff1;
-                     if (row == col)
-                        ss << "\n";
-                     else
-                        ss << "  ";
-                  }
-               }
-            }
-         }
-         emOutStream << "\n";
-      }
-      else
-      {
-         MessageInterface::ShowMessage
-            ("*** INTERNAL ERROR *** data index %d out of range\n", i);
-         retval = false;
-         break;
-      }
-   }
-   
-   if (writeCovariance)
-      ss << "COVARIANCE_STOP\n";
-
-   if (versionNumber == "2.0")
-      emOutStream << ss.str();
-
-   emOutStream.flush();      
+   // Hand the segment to the writer thread
+   writerData.epochs.swap(segmentData.epochs);
+   writerData.data.swap(segmentData.data);
+   writerData.dataSize = segmentData.dataSize;
+   writerData.refFrame = currentOemSegment.GetRefFrame();
+   writerData.version = versionNumber;
+   writerData.acceleration = writeAcceleration;
+   writerData.covariance = writeCovariance;
+   writerThread = std::thread(&CCSDSOEMWriter::WriteSegmentData, this);
    
    // Clears data store
    ClearDataStore();
@@ -269,9 +200,9 @@ bool CCSDSOEMWriter::WriteDataSegment()
    ClearMetaData();
    #ifdef DEBUG_DATA_SEGMENT
    MessageInterface::ShowMessage
-      ("CCSDSOEMWriter::WriteDataSegment() returning %d\n", retval);
+      ("CCSDSOEMWriter::WriteDataSegment() returning true\n");
    #endif
-   return retval;
+   return true;
 }
 
 //------------------------------------------------------------------------------
@@ -360,15 +291,67 @@ bool CCSDSOEMWriter::AddDataComment(const std::string& comment)
  */
 //------------------------------------------------------------------------------
 bool CCSDSOEMWriter::AddDataForWriting(Real epoch, Rvector &data)
+{
+   return AddDataForWriting(&epoch, data.GetDataVector(), 1, data.GetSize());
+}
+
+//------------------------------------------------------------------------------
+// bool AddDataForWriting(Real epoch, const Real *data, Integer size)
+//------------------------------------------------------------------------------
+/**
+ * Adds one data point to the data store for writing.
+ *
+ * @epoch Epoch of data to be added to the CCSDS data store
+ * @data Data to be added to the CCSDS data store
+ * @size Number of data values
+ */
+//------------------------------------------------------------------------------
+bool CCSDSOEMWriter::AddDataForWriting(Real epoch, const Real *data,
+                                       Integer size)
+{
+   return AddDataForWriting(&epoch, data, 1, size);
+}
+
+//------------------------------------------------------------------------------
+// bool AddDataForWriting(const Real *epochs, const Real *data, Integer count,
+//                        Integer size)
+//------------------------------------------------------------------------------
+/**
+ * Adds data points to the data store for writing. Once data segment is
+ * written to a file the data store will be cleared.
+ *
+ * @epochs Epochs of the data points
+ * @data Data of the points, one point after the other
+ * @count Number of data points
+ * @size Number of data values per point; all the points of a segment have
+ *       the same size
+ *
+ * @return false if the size differs from that of the points already added
+ */
+//------------------------------------------------------------------------------
+bool CCSDSOEMWriter::AddDataForWriting(const Real *epochs, const Real *data,
+                                       Integer count, Integer size)
 {
    #ifdef DEBUG_DATA_SEGMENT
-   MessageInterface::ShowMessage("CCSDSOEMWriter::AddDataForWriting() entered\n");
+   MessageInterface::ShowMessage
+      ("CCSDSOEMWriter::AddDataForWriting() entered, count=%d, size=%d\n",
+       count, size);
    #endif
    
-   currentOemSegment.AddDataForWriting(epoch, data);
+   // The writer needs at least the position and velocity
+   if (size < 6)
+      return false;
+   
+   if (segmentData.epochs.empty())
+      segmentData.dataSize = size;
+   else if (size != segmentData.dataSize)
+      return false;
+   
+   segmentData.epochs.insert(segmentData.epochs.end(), epochs, epochs + count);
+   segmentData.data.insert(segmentData.data.end(), data, data + count * size);
    
    #ifdef DEBUG_DATA_SEGMENT
-   MessageInterface::ShowMessage("CCSDSOEMWriter::AddDataForWriting() entered\n");
+   MessageInterface::ShowMessage("CCSDSOEMWriter::AddDataForWriting() leaving\n");
    #endif
    return true;
 }
@@ -429,6 +412,8 @@ void CCSDSOEMWriter::ClearDataStore()
    
    // ClearDataStore() also clears data comments
    currentOemSegment.ClearDataStore();
+   segmentData.epochs.clear();
+   segmentData.data.clear();
    
    #ifdef DEBUG_DATA_SEGMENT
    MessageInterface::ShowMessage("CCSDSOEMWriter::ClearDataStore() leaving\n");
@@ -439,3 +424,100 @@ void CCSDSOEMWriter::ClearDataStore()
 // protected methods
 // -----------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------
+// void WriteSegmentData()
+//------------------------------------------------------------------------------
+/**
+ * Formats the data points of writerData and writes them to the file.
+ *
+ * This runs on the writer thread; errors are left in writerError for
+ * WaitForWriter() to report.
+ */
+//------------------------------------------------------------------------------
+void CCSDSOEMWriter::WriteSegmentData()
+{
+   try
+   {
+      Integer numPoints = writerData.epochs.size();
+      bool version2 = (writerData.version == "2.0");
+      bool writeAccel = version2 && writerData.acceleration &&
+                        (writerData.dataSize >= 9);
+      bool writeCov = writerData.covariance && (writerData.dataSize >= 30);
+      
+      std::string text, covText;
+      text.reserve(numPoints * (writeAccel ? 200 : 140));
+      if (writerData.covariance)
+      {
+         covText += "\n";
+         covText += "COVARIANCE_START\n";
+      }
+      
+      char strBuff[300];
+      for (Integer i = 0; i < numPoints; i++)
+      {
+         if ((i > 0) && (writerData.covariance))
+            covText += "\n";
+         
+         const Real *outState = &writerData.data[i * writerData.dataSize];
+         std::string epochStr = A1ModJulianToUtcGregorian(writerData.epochs[i], 2);
+         snprintf(strBuff, sizeof(strBuff),
+                  "%s  % 1.15e  % 1.15e  % 1.15e  % 1.15e  % 1.15e  % 1.15e",
+                  epochStr.c_str(), outState[0], outState[1], outState[2],
+                  outState[3], outState[4], outState[5]);
+         text += strBuff;
+         
+         if (version2)
+         {
+            // Write out acceleration
+            if (writeAccel)
+            {
+               snprintf(strBuff, sizeof(strBuff), "  % 1.15e  % 1.15e  % 1.15e",
+                        outState[6], outState[7], outState[8]);
+               text += strBuff;
+            }
+            
+            if (writeCov)
+            {
+               // Write out lower-left covariance matrix
+               covText += "EPOCH = " + epochStr + "\n";
+               covText += "COV_REF_FRAME = " + writerData.refFrame + "\n";
+               Integer idx = 9;
+               for (Integer row = 0; row < 6; ++row)
+               {
+                  for (Integer col = 0; col <= row; ++col)
+                  {
+                     snprintf(strBuff, sizeof(strBuff), "% 1.15e",
+                              outState[idx]);
+                     ++idx;
+                     covText += strBuff;
+                     if (row == col)
+                        covText += "\n";
+                     else
+                        covText += "  ";
+                  }
+               }
+            }
+         }
+         text += "\n";
+      }
+      
+      if (writerData.covariance)
+         covText += "COVARIANCE_STOP\n";
+      
+      if (version2)
+         text += covText;
+      
+      emOutStream << text;
+      emOutStream.flush();
+   }
+   catch (BaseException &be)
+   {
+      writerError = be.GetFullMessage();
+   }
+   catch (...)
+   {
+      writerError = "Unable to write the data segment of CCSDS OEM file \"" +
+                    emFileName + "\"";
+   }
+}
+
@@ -54,6 +54,10 @@ public:
    virtual bool         AddMetaComment(const std::string& comment);
    virtual bool         AddDataComment(const std::string& comment);
    virtual bool         AddDataForWriting(Real epoch, Rvector &data);
+   bool                 AddDataForWriting(Real epoch, const Real *data,
+                                          Integer size);
+   bool                 AddDataForWriting(const Real *epochs, const Real *data,
+                                          Integer count, Integer size);
    
    virtual void         ClearMetaComments();
    virtual void         ClearDataComments();
@@ -63,9 +67,31 @@ public:
 
 protected:
    
+   /// A data segment and the settings for writing it
+   struct SegmentData
+   {
+      /// Epochs of the points
+      RealArray      epochs;
+      /// Data of the points, one point after the other
+      RealArray      data;
+      /// Number of data values per point
+      Integer        dataSize;
+      std::string    refFrame;
+      std::string    version;
+      bool           acceleration;
+      bool           covariance;
+   };
+   
    /// The current OEM segment that we are writing
    CCSDSOEMSegment currentOemSegment;
    
+   /// Data points collected for the current segment
+   SegmentData     segmentData;
+   /// Data segment being written by the writer thread
+   SegmentData     writerData;
+   
+   void            WriteSegmentData();
+   
 };
 
 #endif // CCSDSOEMWriter_hpp
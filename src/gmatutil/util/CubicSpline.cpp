@@ -25,6 +25,7 @@
 #include "UtilityException.hpp"
 
 #include "MessageInterface.hpp"
+#include <algorithm>
 
 //#define DEBUG_CUBIC_SPLINE
 //#define DEBUG_ARRAYS
@@ -95,60 +96,110 @@ void CubicSpline::EvaluateClampedCubicSplineVectorized(
                                           const Rvector &xArray, Real x,
                                           Rvector &y, Rvector &dy, Rvector &ddy)
 {
-   /// @todo Add validation to make sure input matrices and vectors are sized
-   /// correctly
-   /// a, b, c, d should be the same size
-   /// xarray size should match number of columns in a, b, c, d
-   
-   // calculate where we are in the spline (i.e., the value of i s.t.
-   // x[i] <= x < x[i+1], assuming all x[i+1] > x[i])
-   Integer s = xArray.GetSize();
+   EvaluateAt(a, b, c, d, xArray.GetDataVector(), xArray.GetSize(), x,
+              y, dy, ddy);
+}
+
+//---------------------------------------------------------------------------
+//  void EvaluateClampedCubicSplineVectorized(
+//                              const Rmatrix &a, const Rmatrix &b,
+//                              const Rmatrix &c, const Rmatrix &d,
+//                              const RealArray &xArray, Real x,
+//                              Rvector &y, Rvector &dy, Rvector &ddy)
+//---------------------------------------------------------------------------
+/**
+ * Evaluate the cubic spline for a vector of states, with the knots in a
+ * RealArray so callers that store them that way do not copy them per call.
+ *
+ * @see EvaluateClampedCubicSplineVectorized(const Rmatrix&, const Rmatrix&,
+ *      const Rmatrix&, const Rmatrix&, const Rvector&, Real, Rvector&,
+ *      Rvector&, Rvector&)
+ */
+//---------------------------------------------------------------------------
+void CubicSpline::EvaluateClampedCubicSplineVectorized(
+                                          const Rmatrix &a, const Rmatrix &b,
+                                          const Rmatrix &c, const Rmatrix &d,
+                                          const RealArray &xArray, Real x,
+                                          Rvector &y, Rvector &dy, Rvector &ddy)
+{
+   if (xArray.empty())
+      throw UtilityException("ERROR in EvaluateClampedCubicSplineVectorized: "
+                             "no knots\n");
+   EvaluateAt(a, b, c, d, &xArray[0], (Integer)xArray.size(), x, y, dy, ddy);
+}
+
+//---------------------------------------------------------------------------
+//  void EvaluateClampedCubicSplineBatch(
+//                              const Rmatrix &a, const Rmatrix &b,
+//                              const Rmatrix &c, const Rmatrix &d,
+//                              const Rvector &xArray, const Real *x,
+//                              Integer numX, Real *y, Real *dy, Real *ddy)
+//---------------------------------------------------------------------------
+/**
+ * Evaluate the cubic spline for a vector of states at many values of the
+ * independent variable, writing into caller supplied buffers.
+ *
+ * The outputs are laid out one row of states per abscissa, so the value of
+ * state j at x[k] is y[k * numStates + j].  Abscissae in increasing order are
+ * located in constant time from the previous one.
+ *
+ * @param a      [in] Constant coefficients, one row per region
+ * @param b      [in] Linear coefficients, one row per region
+ * @param c      [in] Quadratic coefficients, one row per region
+ * @param d      [in] Cubic coefficients, one row per region
+ * @param xArray [in] The knots used to generate the spline
+ * @param x      [in] The numX values at which the spline is desired
+ * @param numX   [in] The number of values in x
+ * @param y      [out] The splined values (numX * numStates entries)
+ * @param dy     [out] Splined dy/dx, or NULL if not needed
+ * @param ddy    [out] Splined d^2y/dx^2, or NULL if not needed
+ */
+//---------------------------------------------------------------------------
+void CubicSpline::EvaluateClampedCubicSplineBatch(
+                                          const Rmatrix &a, const Rmatrix &b,
+                                          const Rmatrix &c, const Rmatrix &d,
+                                          const Rvector &xArray, const Real *x,
+                                          Integer numX, Real *y, Real *dy,
+                                          Real *ddy)
+{
+   const Real *knots = xArray.GetDataVector();
+   Integer numKnots = xArray.GetSize();
    Integer numRows, numCols;
    a.GetSize(numRows, numCols);
    
+   if ((numKnots < 2) || (numRows < numKnots - 1))
+      throw UtilityException("ERROR in EvaluateClampedCubicSplineBatch: the "
+                             "coefficients do not match the knots\n");
+   
+   const Real *aData = a.GetDataVector();
+   const Real *bData = b.GetDataVector();
+   const Real *cData = c.GetDataVector();
+   const Real *dData = d.GetDataVector();
+   
    Integer idx = -1;
-   if (x < xArray(0))
-      idx = 0;
-   else
+   for (Integer k = 0; k < numX; k++)
    {
-      for (Integer ii = 0; ii < s-2; ii++)
+      idx = FindSplineRegion(knots, numKnots, x[k], idx);
+      
+      Real dx = x[k] - knots[idx];
+      Integer offset = idx * numCols;
+      Integer out    = k * numCols;
+      Real dxdNeeded;
+      Real threeDxdNeeded;
+      
+      for (Integer ii = 0; ii < numCols; ii++)
       {
-         if ((x == xArray(ii))   ||
-             ((x > xArray(ii)) && (x < xArray(ii+1))) )
-         {
-            idx = ii;
-            break;
-         }
-         else
-            continue;
+         dxdNeeded      = dx * dData[offset + ii];
+         threeDxdNeeded = 3.0 * dxdNeeded;
+         y[out + ii] = aData[offset + ii] + dx * (bData[offset + ii] + dx *
+                       (cData[offset + ii] + dxdNeeded));
+         if (dy != NULL)
+            dy[out + ii] = bData[offset + ii] + dx *
+                           (2.0 * cData[offset + ii] + threeDxdNeeded);
+         if (ddy != NULL)
+            ddy[out + ii] = 2.0 * (cData[offset + ii] + threeDxdNeeded);
       }
-      if (idx == -1) // x > last element of the array
-         idx = s-2;
-   }
-
-   Rvector aNeeded = a.GetRow(idx);
-   Rvector bNeeded = b.GetRow(idx);
-   Rvector cNeeded = c.GetRow(idx);
-   Rvector dNeeded = d.GetRow(idx);
-   
-   Real dx = x - xArray(idx);
-   
-   Real dxdNeeded;
-   Real threeDxdNeeded;
-   
-   y.SetSize(numCols);
-   dy.SetSize(numCols);
-   ddy.SetSize(numCols);
-   
-   for (Integer ii = 0; ii < numCols; ii++)
-   {
-      dxdNeeded      = dx * dNeeded(ii);
-      threeDxdNeeded = 3.0 * dxdNeeded;
-      y(ii)   = aNeeded(ii) + dx * (bNeeded(ii) + dx * (cNeeded(ii) + dxdNeeded));
-      dy(ii)  = bNeeded(ii) + dx * (2.0 * cNeeded(ii) + threeDxdNeeded);
-      ddy(ii) = 2.0 * (cNeeded(ii) + threeDxdNeeded);
    }
-   // returning  y, dy, ddy via argument list
 }
 
 //---------------------------------------------------------------------------
@@ -251,6 +302,104 @@ void CubicSpline::CalculateClampedCubicSplineCoefficients(
    /// returning a, b, c, d via argument list
 }
 
+//---------------------------------------------------------------------------
+//  void CalculateClampedCubicSplineCoefficients(const Rvector &x, const Rmatrix &y,
+//                                               const Rvector &dydx0,
+//                                               const Rvector &dydxf,
+//                                               Rmatrix &a, Rmatrix &b,
+//                                               Rmatrix &c, Rmatrix &d)
+//---------------------------------------------------------------------------
+/**
+ * Calculate constants for clamped cubic splines of several states sharing
+ * the same knots.
+ *
+ * The tridiagonal system depends only on the knots, so it is factored once
+ * and the factorization is reused for each state.  The results match calling
+ * the single state version once per state.
+ *
+ * @param x      [in] Array of values of independent variable (the knots)
+ * @param y      [in] Values of the dependent variables, one row per knot and
+ *                    one column per state
+ * @param dydx0  [in] dy/dx at x[0] for each state
+ * @param dydxf  [in] dy/dx at x[n-1] for each state
+ * @param a      [out] Constant coefficients, one row per region
+ * @param b      [out] Linear coefficients, one row per region
+ * @param c      [out] Quadratic coefficients, one row per region
+ * @param d      [out] Cubic coefficients, one row per region
+ */
+//---------------------------------------------------------------------------
+void CubicSpline::CalculateClampedCubicSplineCoefficients(
+                           const Rvector &x,     const Rmatrix &y,
+                           const Rvector &dydx0, const Rvector &dydxf,
+                           Rmatrix       &a,     Rmatrix       &b,
+                           Rmatrix       &c,     Rmatrix       &d)
+{
+   Integer np1 = x.GetSize(); // number of knots
+   Integer n   = np1 - 1;     // number of spline regions
+   Integer numRows, numStates;
+   y.GetSize(numRows, numStates);
+   
+   if ((n < 1) || (numRows != np1) || (dydx0.GetSize() != numStates) ||
+       (dydxf.GetSize() != numStates))
+      throw UtilityException("ERROR in CalculateClampedCubicSplineCoefficients: "
+                             "the knots, values and end derivatives do not "
+                             "match\n");
+   
+   RealArray h(n), oneByH(n);
+   for (Integer i = 0; i < n; i++)
+   {
+      h[i]      = x(i+1)-x(i);
+      oneByH[i] = 1.0 / h[i];
+   }
+   
+   // Factor the tridiagonal system; the sub- and super-diagonals are h
+   RealArray w(n), denom(np1);
+   denom[0] = 2.0 * h[0];
+   w[0]     = h[0] / denom[0];
+   for (Integer i = 1; i < np1; i++)
+   {
+      Real diag = (i < n ? 2.0 * (h[i-1] + h[i]) : 2.0 * h[n-1]);
+      denom[i] = diag - h[i-1] * w[i-1];
+      if (i < n)
+         w[i] = h[i] / denom[i];
+   }
+   
+   a.SetSize(n, numStates);
+   b.SetSize(n, numStates);
+   c.SetSize(n, numStates);
+   d.SetSize(n, numStates);
+   
+   RealArray dy(n), v(np1), g(np1), cTmp(np1);
+   for (Integer s = 0; s < numStates; s++)
+   {
+      for (Integer i = 0; i < n; i++)
+         dy[i] = y(i+1, s) - y(i, s);
+      
+      // the right-hand side vector
+      v[0] = 3.0 * (oneByH[0] * dy[0] - dydx0(s));
+      for (Integer i = 1; i < n; i++)
+         v[i] = 3.0 * (oneByH[i] * dy[i] - oneByH[i-1] * dy[i-1]);
+      v[n] = 3.0 * (dydxf(s) - oneByH[n-1] * dy[n-1]);
+      
+      // forward and back substitution with the factored system
+      g[0] = v[0] / denom[0];
+      for (Integer i = 1; i < np1; i++)
+         g[i] = (v[i] - h[i-1] * g[i-1]) / denom[i];
+      cTmp[n] = g[n];
+      for (Integer i = n; i > 0; i--)
+         cTmp[i-1] = g[i-1] - w[i-1] * cTmp[i];
+      
+      for (Integer ii = 0; ii < n; ii++)
+      {
+         b(ii, s) = oneByH[ii] * (y(ii+1, s) - y(ii, s)) - (h[ii] / 3.0) *
+                    (2.0 * cTmp[ii] + cTmp[ii+1]);
+         d(ii, s) = (1.0 / 3.0) * oneByH[ii] * (cTmp[ii+1] - cTmp[ii]);
+         a(ii, s) = y(ii, s);
+         c(ii, s) = cTmp[ii];
+      }
+   }
+}
+
 //---------------------------------------------------------------------------
 //  Rvector ThomasAlgorithm(const Rvector &a, const Rvector &b,
 //                          const Rvector &c, const Rvector &d)
@@ -350,3 +499,96 @@ CubicSpline::CubicSpline(const CubicSpline &copy)
    // unimplemented
 }
 
+//---------------------------------------------------------------------------
+//  Integer FindSplineRegion(const Real *xArray, Integer numKnots, Real x,
+//                           Integer hint)
+//---------------------------------------------------------------------------
+/**
+ * Finds the region i such that x[i] <= x < x[i+1], assuming increasing knots.
+ * Values before the first knot use the first region and values at or past the
+ * next to last knot use the last region.
+ *
+ * @param xArray   [in] The knots
+ * @param numKnots [in] The number of knots
+ * @param x        [in] The value to locate
+ * @param hint     [in] A region to check first, or -1
+ *
+ * @return The region index
+ */
+//---------------------------------------------------------------------------
+Integer CubicSpline::FindSplineRegion(const Real *xArray, Integer numKnots,
+                                      Real x, Integer hint)
+{
+   Integer last = numKnots - 2;
+   
+   // Sequential lookups usually land in the hinted region or the next one
+   if ((hint >= 0) && (hint <= last) && (x >= xArray[hint]))
+   {
+      if ((hint == last) || (x < xArray[hint+1]))
+         return hint;
+      if ((hint + 1 == last) || (x < xArray[hint+2]))
+         return hint + 1;
+   }
+   
+   Integer idx = (Integer)(std::upper_bound(xArray, xArray + numKnots, x) -
+                           xArray) - 1;
+   if (idx < 0)
+      idx = 0;
+   else if (idx > last)
+      idx = last;
+   return idx;
+}
+
+//---------------------------------------------------------------------------
+//  void EvaluateAt(const Rmatrix &a, const Rmatrix &b, const Rmatrix &c,
+//                  const Rmatrix &d, const Real *xArray, Integer numKnots,
+//                  Real x, Rvector &y, Rvector &dy, Rvector &ddy)
+//---------------------------------------------------------------------------
+/**
+ * Evaluates the spline for a vector of states at x, reading the coefficients
+ * for the region in place.
+ */
+//---------------------------------------------------------------------------
+void CubicSpline::EvaluateAt(const Rmatrix &a, const Rmatrix &b,
+                             const Rmatrix &c, const Rmatrix &d,
+                             const Real *xArray, Integer numKnots, Real x,
+                             Rvector &y, Rvector &dy, Rvector &ddy)
+{
+   /// @todo Add validation to make sure input matrices and vectors are sized
+   /// correctly
+   /// a, b, c, d should be the same size
+   /// xarray size should match number of columns in a, b, c, d
+   
+   // calculate where we are in the spline (i.e., the value of i s.t.
+   // x[i] <= x < x[i+1], assuming all x[i+1] > x[i])
+   Integer numRows, numCols;
+   a.GetSize(numRows, numCols);
+   
+   Integer idx = FindSplineRegion(xArray, numKnots, x);
+   Integer offset = idx * numCols;
+   
+   const Real *aNeeded = a.GetDataVector() + offset;
+   const Real *bNeeded = b.GetDataVector() + offset;
+   const Real *cNeeded = c.GetDataVector() + offset;
+   const Real *dNeeded = d.GetDataVector() + offset;
+   
+   Real dx = x - xArray[idx];
+   
+   Real dxdNeeded;
+   Real threeDxdNeeded;
+   
+   y.SetSize(numCols);
+   dy.SetSize(numCols);
+   ddy.SetSize(numCols);
+   
+   for (Integer ii = 0; ii < numCols; ii++)
+   {
+      dxdNeeded      = dx * dNeeded[ii];
+      threeDxdNeeded = 3.0 * dxdNeeded;
+      y(ii)   = aNeeded[ii] + dx * (bNeeded[ii] + dx * (cNeeded[ii] + dxdNeeded));
+      dy(ii)  = bNeeded[ii] + dx * (2.0 * cNeeded[ii] + threeDxdNeeded);
+      ddy(ii) = 2.0 * (cNeeded[ii] + threeDxdNeeded);
+   }
+   // returning  y, dy, ddy via argument list
+}
+
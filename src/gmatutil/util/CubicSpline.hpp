@@ -39,12 +39,27 @@ public:
                                              const Rvector &xArray, Real x,
                                              Rvector &y, Rvector &dy,
                                              Rvector &ddy);
+   void EvaluateClampedCubicSplineVectorized(const Rmatrix &a, const Rmatrix &b,
+                                             const Rmatrix &c, const Rmatrix &d,
+                                             const RealArray &xArray, Real x,
+                                             Rvector &y, Rvector &dy,
+                                             Rvector &ddy);
+   void EvaluateClampedCubicSplineBatch(const Rmatrix &a, const Rmatrix &b,
+                                        const Rmatrix &c, const Rmatrix &d,
+                                        const Rvector &xArray, const Real *x,
+                                        Integer numX, Real *y, Real *dy = NULL,
+                                        Real *ddy = NULL);
    
    void CalculateClampedCubicSplineCoefficients(
                            const Rvector &x,    const Rvector &y,
                            Real          dydx0, Real          dydxf,
                            Rvector       &a,    Rvector       &b,
                            Rvector       &c,    Rvector       &d);
+   void CalculateClampedCubicSplineCoefficients(
+                           const Rvector &x,     const Rmatrix &y,
+                           const Rvector &dydx0, const Rvector &dydxf,
+                           Rmatrix       &a,     Rmatrix       &b,
+                           Rmatrix       &c,     Rmatrix       &d);
    
    Rvector ThomasAlgorithm(const Rvector &a, const Rvector &b,
                            const Rvector &c, const Rvector &d);
@@ -56,6 +71,12 @@ protected:
    CubicSpline();
    CubicSpline(const CubicSpline &copy);
    
+   Integer FindSplineRegion(const Real *xArray, Integer numKnots, Real x,
+                            Integer hint = -1);
+   void EvaluateAt(const Rmatrix &a, const Rmatrix &b, const Rmatrix &c,
+                   const Rmatrix &d, const Real *xArray, Integer numKnots,
+                   Real x, Rvector &y, Rvector &dy, Rvector &ddy);
+   
    // The singleton
    static CubicSpline *theCubicSpline;
 };
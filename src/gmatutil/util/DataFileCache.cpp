@@ -0,0 +1,674 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           DataFileCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the shared data file tables
+ */
+//------------------------------------------------------------------------------
+
+#include "DataFileCache.hpp"
+#include "FileManager.hpp"
+#include "FileUtil.hpp"
+#include "BaseException.hpp"
+#include "MessageInterface.hpp"
+
+#include <sys/stat.h>            // for stat()
+#include <cstdio>                // for rename() and remove()
+#include <cstring>
+#include <fstream>
+#include <functional>            // for hash
+#include <sstream>
+
+#if !defined(_WIN32)
+   #define DATAFILECACHE_USE_MMAP
+   #include <fcntl.h>
+   #include <sys/mman.h>
+   #include <unistd.h>
+#endif
+
+
+//#define DEBUG_DATA_CACHE
+
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+
+std::map<std::string, std::weak_ptr<const DataFileCache> >
+      DataFileCache::entryCache;
+
+std::mutex DataFileCache::cacheMutex;
+
+const char DataFileCache::MAGIC[16] = "GMATDataCache";
+
+const Integer DataFileCache::VERSION = 1;
+
+const Integer DataFileCache::BYTE_ORDER_MARK = 0x01020304;
+
+
+//------------------------------------------------------------------------------
+// DataFileCache()
+//------------------------------------------------------------------------------
+/**
+ * Constructor, for an entry that a reader fills
+ */
+//------------------------------------------------------------------------------
+DataFileCache::DataFileCache() :
+   tableList         (NULL),
+   valueData         (NULL),
+   tableCount        (0),
+   valueCount        (0),
+   mappedData        (NULL),
+   mappedSize        (0),
+   isMapped          (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~DataFileCache()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+DataFileCache::~DataFileCache()
+{
+   #ifdef DATAFILECACHE_USE_MMAP
+      if (isMapped && (mappedData != NULL))
+         munmap((void*)mappedData, mappedSize);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void AddTable(const std::string &name, const Real *data, Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Stores a table of values with the entry
+ *
+ * @param name  The name of the table
+ * @param data  The values
+ * @param count The number of values
+ */
+//------------------------------------------------------------------------------
+void DataFileCache::AddTable(const std::string &name, const Real *data,
+      Integer count)
+{
+   TableEntry entry;
+   entry.firstValue = values.size();
+   entry.valueCount = count;
+   tables.push_back(entry);
+   tableNames.push_back(name);
+   values.insert(values.end(), data, data + count);
+
+   SetPointers();
+}
+
+
+//------------------------------------------------------------------------------
+// void SetText(const std::string &name, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Stores a named text value with the entry
+ *
+ * @param name  The name of the value
+ * @param value The value
+ */
+//------------------------------------------------------------------------------
+void DataFileCache::SetText(const std::string &name, const std::string &value)
+{
+   texts[name] = value;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetTableSize(const std::string &name) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of values in a table
+ *
+ * @param name The name of the table
+ *
+ * @return The number of values, or -1 if the entry has no such table
+ */
+//------------------------------------------------------------------------------
+Integer DataFileCache::GetTableSize(const std::string &name) const
+{
+   Integer index = FindTable(name);
+   return (index < 0 ? -1 : tableList[index].valueCount);
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetTable(const std::string &name) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the values of a table
+ *
+ * @param name The name of the table
+ *
+ * @return GetTableSize(name) values, or NULL if the entry has no such table
+ */
+//------------------------------------------------------------------------------
+const Real* DataFileCache::GetTable(const std::string &name) const
+{
+   Integer index = FindTable(name);
+   return (index < 0 ? NULL : valueData + tableList[index].firstValue);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetText(const std::string &name) const
+//------------------------------------------------------------------------------
+/**
+ * Returns a value stored with SetText()
+ *
+ * @param name The name of the value
+ *
+ * @return The value, or an empty string if it was not set
+ */
+//------------------------------------------------------------------------------
+std::string DataFileCache::GetText(const std::string &name) const
+{
+   std::map<std::string, std::string>::const_iterator pos = texts.find(name);
+   return (pos == texts.end() ? "" : pos->second);
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsMapped() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the data is read from a cache file rather than parsed
+ */
+//------------------------------------------------------------------------------
+bool DataFileCache::IsMapped() const
+{
+   return mappedData != NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// std::shared_ptr<const DataFileCache> Find(const StringArray &fileNames,
+//       const std::string &format)
+//------------------------------------------------------------------------------
+/**
+ * Finds the tables of a set of data files that are already loaded or cached
+ *
+ * @param fileNames The full paths of the data files the tables come from
+ * @param format    Name of the reader format, so readers that store different
+ *                  tables for the same files do not share them
+ *
+ * @return The entry, or an empty pointer if the files have to be parsed
+ */
+//------------------------------------------------------------------------------
+std::shared_ptr<const DataFileCache> DataFileCache::Find(
+      const StringArray &fileNames, const std::string &format)
+{
+   std::shared_ptr<const DataFileCache> entry;
+
+   std::string key = GetKey(fileNames, format);
+   if (key == "")
+      return entry;
+
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   std::map<std::string, std::weak_ptr<const DataFileCache> >::iterator
+         pos = entryCache.find(key);
+   if (pos != entryCache.end())
+   {
+      entry = pos->second.lock();
+      if (!entry)
+         entryCache.erase(pos);
+   }
+
+   if (!entry)
+   {
+      std::string cacheFile = GetCacheFileName(fileNames, format);
+      if (cacheFile != "")
+      {
+         DataFileCache *mapped = new DataFileCache;
+         if (mapped->MapCacheFile(cacheFile, key))
+         {
+            entry.reset(mapped);
+            entryCache[key] = entry;
+         }
+         else
+            delete mapped;
+      }
+   }
+
+   #ifdef DEBUG_DATA_CACHE
+      MessageInterface::ShowMessage("DataFileCache::Find(%s): %s\n",
+            (fileNames.empty() ? "" : fileNames[0].c_str()), (!entry ?
+            "not loaded" : (entry->IsMapped() ? "cache file" : "shared")));
+   #endif
+
+   return entry;
+}
+
+
+//------------------------------------------------------------------------------
+// std::shared_ptr<const DataFileCache> Share(const StringArray &fileNames,
+//       const std::string &format, DataFileCache *entry)
+//------------------------------------------------------------------------------
+/**
+ * Makes the tables parsed from a set of data files available to other readers
+ *
+ * When a cache directory is set, the tables are also written to a cache file,
+ * and the returned entry maps that file in place of the parsed arrays.
+ *
+ * @param fileNames The full paths of the data files the tables come from
+ * @param format    Name of the reader format
+ * @param entry     The parsed tables; the returned pointer takes ownership
+ *
+ * @return The shared entry
+ */
+//------------------------------------------------------------------------------
+std::shared_ptr<const DataFileCache> DataFileCache::Share(
+      const StringArray &fileNames, const std::string &format,
+      DataFileCache *entry)
+{
+   entry->SetPointers();
+   std::shared_ptr<const DataFileCache> shared(entry);
+
+   std::string key = GetKey(fileNames, format);
+   if (key == "")
+      return shared;
+
+   std::string cacheFile = GetCacheFileName(fileNames, format);
+   if ((cacheFile != "") && entry->WriteCacheFile(cacheFile, key))
+   {
+      DataFileCache *mapped = new DataFileCache;
+      if (mapped->MapCacheFile(cacheFile, key))
+         shared.reset(mapped);
+      else
+         delete mapped;
+   }
+
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   entryCache[key] = shared;
+
+   return shared;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FindTable(const std::string &name) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the index of a table in the table list, or -1 if it is not there
+ */
+//------------------------------------------------------------------------------
+Integer DataFileCache::FindTable(const std::string &name) const
+{
+   for (Integer i = 0; i < tableCount; ++i)
+      if (tableNames[i] == name)
+         return i;
+   return -1;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetPointers()
+//------------------------------------------------------------------------------
+/**
+ * Points the accessors at the arrays of an entry built by a reader
+ */
+//------------------------------------------------------------------------------
+void DataFileCache::SetPointers()
+{
+   tableCount = tables.size();
+   valueCount = values.size();
+   tableList  = (tables.empty() ? NULL : &tables[0]);
+   valueData  = (values.empty() ? NULL : &values[0]);
+}
+
+
+//------------------------------------------------------------------------------
+// bool MapCacheFile(const std::string &cacheFile, const std::string &key)
+//------------------------------------------------------------------------------
+/**
+ * Maps a cache file, if it was written for the current data files
+ *
+ * @param cacheFile The cache file
+ * @param key       The key of the data files
+ *
+ * @return true if the file is mapped, false if it is missing or out of date
+ */
+//------------------------------------------------------------------------------
+bool DataFileCache::MapCacheFile(const std::string &cacheFile,
+      const std::string &key)
+{
+   #ifdef DATAFILECACHE_USE_MMAP
+      int fd = open(cacheFile.c_str(), O_RDONLY);
+      if (fd < 0)
+         return false;
+
+      struct stat info;
+      if ((fstat(fd, &info) == 0) && (info.st_size > 0))
+      {
+         void *addr = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+         if (addr != MAP_FAILED)
+         {
+            mappedData = (const char*)addr;
+            mappedSize = info.st_size;
+            isMapped = true;
+         }
+      }
+      close(fd);
+   #endif
+
+   if (mappedData == NULL)
+   {
+      std::ifstream in(cacheFile.c_str(), std::ios::binary | std::ios::ate);
+      if (!in.is_open())
+         return false;
+      std::streamoff size = in.tellg();
+      if (size <= 0)
+         return false;
+      loadedData.resize((size_t)size);
+      in.seekg(0);
+      in.read(&loadedData[0], size);
+      if (!in)
+         return false;
+      mappedData = &loadedData[0];
+      mappedSize = (size_t)size;
+   }
+
+   CacheHeader hdr;
+   memset(&hdr, 0, sizeof(CacheHeader));
+   bool valid = (mappedSize >= sizeof(CacheHeader));
+   if (valid)
+   {
+      memcpy(&hdr, mappedData, sizeof(CacheHeader));
+      valid = (memcmp(hdr.magic, MAGIC, sizeof(MAGIC)) == 0) &&
+              (hdr.version == VERSION) &&
+              (hdr.byteOrder == BYTE_ORDER_MARK) &&
+              (hdr.tableCount >= 0) && (hdr.valueCount >= 0) &&
+              (hdr.keyBytes >= 0) && (hdr.nameBytes >= 0) &&
+              (hdr.textBytes >= 0);
+   }
+
+   size_t listOffset = sizeof(CacheHeader);
+   size_t valueOffset = listOffset + (size_t)hdr.tableCount * sizeof(TableEntry);
+   size_t keyOffset = valueOffset + (size_t)hdr.valueCount * sizeof(Real);
+   size_t nameOffset = keyOffset + (size_t)hdr.keyBytes;
+   size_t textOffset = nameOffset + (size_t)hdr.nameBytes;
+   if (valid)
+      valid = (textOffset + (size_t)hdr.textBytes == mappedSize) &&
+              (std::string(mappedData + keyOffset, hdr.keyBytes) == key);
+
+   if (valid)
+   {
+      tableList = (const TableEntry*)(mappedData + listOffset);
+      for (Integer i = 0; (i < hdr.tableCount) && valid; ++i)
+         valid = (tableList[i].firstValue >= 0) &&
+                 (tableList[i].valueCount >= 0) &&
+                 (tableList[i].firstValue <=
+                  hdr.valueCount - tableList[i].valueCount);
+   }
+
+   StringArray textFields;
+   if (valid)
+      valid = UnpackStrings(mappedData + nameOffset, hdr.nameBytes, tableNames) &&
+              ((Integer)tableNames.size() == hdr.tableCount) &&
+              UnpackStrings(mappedData + textOffset, hdr.textBytes, textFields) &&
+              (textFields.size() % 2 == 0);
+
+   if (!valid)
+   {
+      #ifdef DATAFILECACHE_USE_MMAP
+         if (isMapped)
+            munmap((void*)mappedData, mappedSize);
+      #endif
+      mappedData = NULL;
+      mappedSize = 0;
+      isMapped = false;
+      loadedData.clear();
+      tableList = NULL;
+      tableNames.clear();
+      return false;
+   }
+
+   for (UnsignedInt i = 0; i < textFields.size(); i += 2)
+      texts[textFields[i]] = textFields[i+1];
+
+   tableCount = hdr.tableCount;
+   valueCount = hdr.valueCount;
+   valueData  = (const Real*)(mappedData + valueOffset);
+
+   #ifdef DEBUG_DATA_CACHE
+      MessageInterface::ShowMessage("Mapped %d values from the data cache "
+            "file %s\n", valueCount, cacheFile.c_str());
+   #endif
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool WriteCacheFile(const std::string &cacheFile,
+//       const std::string &key) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the entry to a cache file
+ *
+ * The file is written under a temporary name and then renamed, so other
+ * processes never map a partly written file.
+ *
+ * @param cacheFile The cache file
+ * @param key       The key of the data files
+ *
+ * @return true if the file was written
+ */
+//------------------------------------------------------------------------------
+bool DataFileCache::WriteCacheFile(const std::string &cacheFile,
+      const std::string &key) const
+{
+   StringArray textFields;
+   for (std::map<std::string, std::string>::const_iterator i = texts.begin();
+        i != texts.end(); ++i)
+   {
+      textFields.push_back(i->first);
+      textFields.push_back(i->second);
+   }
+   std::string names = PackStrings(tableNames);
+   std::string text = PackStrings(textFields);
+
+   CacheHeader hdr;
+   memset(&hdr, 0, sizeof(CacheHeader));
+   memcpy(hdr.magic, MAGIC, sizeof(MAGIC));
+   hdr.version    = VERSION;
+   hdr.byteOrder  = BYTE_ORDER_MARK;
+   hdr.tableCount = tableCount;
+   hdr.valueCount = valueCount;
+   hdr.keyBytes   = key.size();
+   hdr.nameBytes  = names.size();
+   hdr.textBytes  = text.size();
+
+   std::stringstream tempName;
+   tempName << cacheFile << ".tmp";
+   #ifdef DATAFILECACHE_USE_MMAP
+      tempName << getpid();
+   #endif
+
+   bool written = false;
+   {
+      std::ofstream out(tempName.str().c_str(), std::ios::binary);
+      if (out.is_open())
+      {
+         out.write((const char*)&hdr, sizeof(CacheHeader));
+         out.write((const char*)tableList,
+               (std::streamsize)(tableCount * sizeof(TableEntry)));
+         out.write((const char*)valueData,
+               (std::streamsize)((size_t)valueCount * sizeof(Real)));
+         out.write(key.c_str(), key.size());
+         out.write(names.c_str(), names.size());
+         out.write(text.c_str(), text.size());
+         out.close();
+         written = !out.fail();
+      }
+   }
+
+   if (written && (std::rename(tempName.str().c_str(), cacheFile.c_str()) != 0))
+   {
+      // Windows does not rename onto an existing file
+      std::remove(cacheFile.c_str());
+      written = (std::rename(tempName.str().c_str(), cacheFile.c_str()) == 0);
+   }
+
+   if (!written)
+   {
+      std::remove(tempName.str().c_str());
+      MessageInterface::ShowMessage("*** WARNING *** The data cache file "
+            "%s could not be written\n", cacheFile.c_str());
+   }
+
+   return written;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string PackStrings(const StringArray &strings)
+//------------------------------------------------------------------------------
+/**
+ * Builds the cache file form of a list of strings, each ended by a null
+ * character
+ */
+//------------------------------------------------------------------------------
+std::string DataFileCache::PackStrings(const StringArray &strings)
+{
+   std::string text;
+   for (UnsignedInt i = 0; i < strings.size(); ++i)
+   {
+      text += strings[i];
+      text += '\0';
+   }
+   return text;
+}
+
+
+//------------------------------------------------------------------------------
+// bool UnpackStrings(const char *text, Integer size, StringArray &strings)
+//------------------------------------------------------------------------------
+/**
+ * Restores a list of strings from its cache file form
+ *
+ * @param text    The text written by PackStrings()
+ * @param size    The length of the text
+ * @param strings The list of strings
+ *
+ * @return false if the text is not well formed
+ */
+//------------------------------------------------------------------------------
+bool DataFileCache::UnpackStrings(const char *text, Integer size,
+      StringArray &strings)
+{
+   strings.clear();
+   Integer start = 0;
+   for (Integer i = 0; i < size; ++i)
+   {
+      if (text[i] == '\0')
+      {
+         strings.push_back(std::string(text + start, i - start));
+         start = i + 1;
+      }
+   }
+   return (start == size);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetKey(const StringArray &fileNames, const std::string &format)
+//------------------------------------------------------------------------------
+/**
+ * Builds the key identifying the tables of a set of data files
+ *
+ * The key holds the reader format and the name, size and modification time of
+ * each file, so an edited file is parsed again.
+ *
+ * @param fileNames The full paths of the data files
+ * @param format    Name of the reader format
+ *
+ * @return The key, or an empty string if the files cannot be shared
+ */
+//------------------------------------------------------------------------------
+std::string DataFileCache::GetKey(const StringArray &fileNames,
+      const std::string &format)
+{
+   if (fileNames.empty())
+      return "";
+
+   std::stringstream key;
+   key << format;
+   for (UnsignedInt i = 0; i < fileNames.size(); ++i)
+   {
+      struct stat fileStatus;
+      if ((fileNames[i] == "") || (stat(fileNames[i].c_str(), &fileStatus) != 0))
+         return "";
+      key << "|" << fileNames[i] << "|" << (long long)fileStatus.st_size
+          << "|" << (long long)fileStatus.st_mtime;
+   }
+
+   return key.str();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetCacheFileName(const StringArray &fileNames,
+//       const std::string &format)
+//------------------------------------------------------------------------------
+/**
+ * Builds the name of the cache file of a set of data files
+ *
+ * Cache files are written to the DATA_CACHE_PATH directory of the startup
+ * file.  The name is the first data file name with a hash of the full paths
+ * and the reader format, so files of the same name in other directories do
+ * not collide.
+ *
+ * @param fileNames The full paths of the data files
+ * @param format    Name of the reader format
+ *
+ * @return The cache file, or an empty string if cache files are not used
+ */
+//------------------------------------------------------------------------------
+std::string DataFileCache::GetCacheFileName(const StringArray &fileNames,
+      const std::string &format)
+{
+   std::string cachePath;
+   try
+   {
+      cachePath = FileManager::Instance()->GetPathname("DATA_CACHE_PATH");
+   }
+   catch (BaseException &)
+   {
+      return "";
+   }
+
+   std::string hashText = format;
+   for (UnsignedInt i = 0; i < fileNames.size(); ++i)
+      hashText += "|" + fileNames[i];
+
+   std::stringstream name;
+   name << cachePath << GmatFileUtil::ParseFileName(fileNames[0]) << "."
+        << std::hex << std::hash<std::string>()(hashText) << ".gdc";
+   return name.str();
+}
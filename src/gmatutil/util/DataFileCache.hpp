@@ -0,0 +1,158 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           DataFileCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Shared, read-only tables parsed from data files
+ */
+//------------------------------------------------------------------------------
+
+#ifndef DataFileCache_hpp
+#define DataFileCache_hpp
+
+#include "utildefs.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * The parsed contents of one or more read-only data files
+ *
+ * A cache entry holds named tables of Real values and named text values, as
+ * the reader of the files stored them.  Readers of gravity coefficient files
+ * and EOP files store the values they would otherwise parse again, and copy
+ * them back into their own structures.  An entry is never changed once it is
+ * shared.
+ *
+ * Entries are shared in two ways:
+ *
+ * - In a process, Share() registers an entry under a key built from the
+ *   reader format and the name, size and modification time of each file.
+ *   Find() returns it to later readers while any reader still holds it.
+ * - Across processes, when the startup file sets DATA_CACHE_PATH, Share()
+ *   also writes the entry to a binary cache file in that directory.  Find()
+ *   memory maps a cache file that matches the key and the cache format
+ *   version, so concurrent runs on a node skip the text parsing and share the
+ *   pages of one mapping.
+ */
+class GMATUTIL_API DataFileCache
+{
+public:
+   DataFileCache();
+   ~DataFileCache();
+
+   // Building an entry, before it is shared
+   void              AddTable(const std::string &name, const Real *data,
+                              Integer count);
+   void              SetText(const std::string &name,
+                             const std::string &value);
+
+   Integer           GetTableSize(const std::string &name) const;
+   const Real*       GetTable(const std::string &name) const;
+   std::string       GetText(const std::string &name) const;
+   bool              IsMapped() const;
+
+   static std::shared_ptr<const DataFileCache>
+                     Find(const StringArray &fileNames,
+                          const std::string &format);
+   static std::shared_ptr<const DataFileCache>
+                     Share(const StringArray &fileNames,
+                           const std::string &format,
+                           DataFileCache *entry);
+
+private:
+   /// Header of a cache file; the table list and the data follow it
+   struct CacheHeader
+   {
+      char           magic[16];
+      Integer        version;
+      Integer        byteOrder;
+      Integer        tableCount;
+      Integer        valueCount;
+      Integer        keyBytes;
+      Integer        nameBytes;
+      Integer        textBytes;
+      Integer        reserved;
+   };
+
+   /// Entry of the table list
+   struct TableEntry
+   {
+      Integer        firstValue;
+      Integer        valueCount;
+   };
+
+   /// Table list and values; in the owned arrays or the mapping
+   const TableEntry              *tableList;
+   const Real                    *valueData;
+   Integer                       tableCount;
+   Integer                       valueCount;
+
+   /// Table names, in table list order
+   StringArray                   tableNames;
+   /// Text values, by name
+   std::map<std::string, std::string>
+                                 texts;
+
+   /// Arrays of an entry built by a reader
+   std::vector<TableEntry>       tables;
+   RealArray                     values;
+
+   /// The mapped (or loaded) cache file, and its size in bytes
+   const char                    *mappedData;
+   size_t                        mappedSize;
+   /// True if mappedData is a memory map rather than loadedData
+   bool                          isMapped;
+   /// Cache file contents when no memory map is available
+   std::vector<char>             loadedData;
+
+   DataFileCache(const DataFileCache &entry);
+   DataFileCache&    operator=(const DataFileCache &entry);
+
+   Integer           FindTable(const std::string &name) const;
+   void              SetPointers();
+   bool              MapCacheFile(const std::string &cacheFile,
+                                  const std::string &key);
+   bool              WriteCacheFile(const std::string &cacheFile,
+                                    const std::string &key) const;
+
+   static std::string
+                     PackStrings(const StringArray &strings);
+   static bool       UnpackStrings(const char *text, Integer size,
+                                   StringArray &strings);
+   static std::string
+                     GetKey(const StringArray &fileNames,
+                            const std::string &format);
+   static std::string
+                     GetCacheFileName(const StringArray &fileNames,
+                                      const std::string &format);
+
+   /// Entries in use, by key
+   static std::map<std::string, std::weak_ptr<const DataFileCache> >
+                     entryCache;
+   /// Mutex guarding entryCache
+   static std::mutex cacheMutex;
+
+   static const char          MAGIC[16];
+   static const Integer       VERSION;
+   static const Integer       BYTE_ORDER_MARK;
+};
+
+#endif /* DataFileCache_hpp */
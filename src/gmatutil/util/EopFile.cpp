@@ -45,6 +45,7 @@
 #include "RealUtilities.hpp"
 #include "MessageInterface.hpp"
 #include "TimeSystemConverter.hpp"
+#include "DataFileCache.hpp"
 
 //#define DEBUG_OFFSET
 //#define DEBUG_EOP_READ
@@ -78,9 +79,11 @@ polarMotion     (new Rmatrix(MAX_TABLE_SIZE,4)),
 ut1UtcOffsets   (new Rmatrix(MAX_TABLE_SIZE,2)),
 taiTime         (new Rvector(MAX_TABLE_SIZE)),
 lastUtcJd       (0.0),
+lastTaiMjd      (0.0),
 lastOffset      (0.0),
 lastIndex       (0),
-isInitialized   (false)
+isInitialized   (false),
+previousIndex   (0)
 {
    theTimeConverter = TimeSystemConverter::Instance();
 }
@@ -103,10 +106,14 @@ tableSz         (eopF.tableSz),
 polarMotion     (new Rmatrix(*(eopF.polarMotion))),
 ut1UtcOffsets   (new Rmatrix(*(eopF.ut1UtcOffsets))),
 taiTime         (new Rvector(*(eopF.taiTime))),
+ut1UtcSteps     (eopF.ut1UtcSteps),
+cachedTable     (eopF.cachedTable),
 lastUtcJd       (eopF.lastUtcJd),
+lastTaiMjd      (eopF.lastTaiMjd),
 lastOffset      (eopF.lastOffset),
 lastIndex       (eopF.lastIndex),
-isInitialized   (eopF.isInitialized)
+isInitialized   (eopF.isInitialized),
+previousIndex   (eopF.previousIndex)
 {
    theTimeConverter = TimeSystemConverter::Instance();
 }
@@ -136,11 +143,15 @@ const EopFile& EopFile::operator=(const EopFile &eopF)
    polarMotion   = new Rmatrix(*(eopF.polarMotion));
    ut1UtcOffsets = new Rmatrix(*(eopF.ut1UtcOffsets));
    taiTime       = new Rvector(*(eopF.taiTime));
+   ut1UtcSteps   = eopF.ut1UtcSteps;
+   cachedTable   = eopF.cachedTable;
 
    lastUtcJd     = eopF.lastUtcJd;
+   lastTaiMjd    = eopF.lastTaiMjd;
    lastOffset    = eopF.lastOffset;
    lastIndex     = eopF.lastIndex;
    isInitialized = eopF.isInitialized;
+   previousIndex = eopF.previousIndex;
 
    return *this;
 }
@@ -203,7 +214,14 @@ void EopFile::Initialize()
       tableSz       = 0;
    }
    
-   if (eopFType == GmatEop::EOP_C04)
+   bool fromCache = LoadCachedTable();
+   if (fromCache)
+   {
+      #ifdef DEBUG_EOP_INITIALIZE
+         MessageInterface::ShowMessage("--- %d rows restored from the data cache\n", tableSz);
+      #endif
+   }
+   else if (eopFType == GmatEop::EOP_C04)
    {
       #ifdef DEBUG_EOP_INITIALIZE
          MessageInterface::ShowMessage("--- attempting to read file %s ...\n", eopFileName.c_str());
@@ -326,6 +344,8 @@ void EopFile::Initialize()
       throw UtilityException("Error In EopFile - file type unknown.");
    }
    if (eopFile.is_open())  eopFile.close();
+   if (!fromCache)
+      ShareTable();
    // set the last value to the end of the file (since we search from back 
    // to front)
    lastUtcJd  = ut1UtcOffsets->GetElement((tableSz-1), 0);
@@ -334,6 +354,20 @@ void EopFile::Initialize()
    lastIndex  = tableSz - 1;
    
    previousIndex = lastIndex;
+
+   // Tabulate the UT1-UTC change over each interval, removing the leap
+   // second jumps, so lookups only need the interpolation ratio
+   ut1UtcSteps.assign(tableSz, 0.0);
+   for (Integer i = 0; i < tableSz - 1; ++i)
+   {
+      Real diffJD  = taiTime->GetElement(i + 1) - taiTime->GetElement(i);
+      Real diffOff = ut1UtcOffsets->GetElement(i + 1, 1) -
+                     ut1UtcOffsets->GetElement(i, 1);
+      Real errorInSec = (diffJD - 1.0)*GmatTimeConstants::SECS_PER_DAY;
+      if (GmatMathUtil::Abs(errorInSec) > 0.6)
+         diffOff = diffOff - GmatMathUtil::Round(errorInSec);
+      ut1UtcSteps[i] = diffOff;
+   }
    
    isInitialized = true;
 
@@ -392,81 +426,8 @@ Real EopFile::GetUt1UtcOffset(const Real taiMjd)
    
    if (lastTaiMjd == taiMjd) return lastOffset;
    
-   Integer         i = 0;
-   const Real* data  = ut1UtcOffsets->GetDataVector();
-   Integer col     = ut1UtcOffsets->GetNumColumns();
-   Real    off     = 0.0;
-   /*
-   Integer row     = ut1UtcOffsets->GetNumRows();
-   MessageInterface::ShowMessage
-      ("===> after ut1UtcOffsets->GetData() tableSz=%d, row=%d, col=%d\n",
-       tableSz, row, col);
-   */
-   if (taiMjd >= taiTime->GetElement(tableSz-1))
-   {
-      off = data[((tableSz - 1) * col) + 1];
-      lastIndex = tableSz - 1;
-   }
-   else if (taiMjd <= taiTime->GetElement(0))
-   {
-      off = data[1];
-      lastIndex = 0;
-   }
-   else
-   {
-      //// for case: utcJD_Min < utcJD < utcJD_Max
-      if (taiMjd  < lastTaiMjd)
-      {
-         if (lastIndex > (tableSz-2)) i = tableSz - 2;
-         else                         i = lastIndex;
-         for (; i >=0; i--)
-         {
-            if (taiMjd >= taiTime->GetElement(i)) 
-            {
-               //Real diffJD  = data[(i+1)*col] - 
-               //               data[i*col];
-               //Real whereJD = utcJD - data[i*col];
-               Real diffJD = taiTime->GetElement(i + 1) - taiTime->GetElement(i);
-               Real whereJD = taiMjd - taiTime->GetElement(i);
-
-               Real ratio = whereJD / diffJD;
-               Real diffOff = data[(i + 1)*col + 1] -
-                              data[i*col + 1];
-               Real errorInSec = (diffJD - 1.0)*GmatTimeConstants::SECS_PER_DAY;
-               if (GmatMathUtil::Abs(errorInSec) > 0.6)
-                  diffOff = diffOff - GmatMathUtil::Round(errorInSec);
-               off = data[i*col + 1] + ratio * diffOff;
-               lastIndex = i;
-               break;
-            }
-         }
-      }
-      else
-      {
-         for (i = lastIndex; i <= tableSz-2; i++)
-         {
-            if ((taiMjd >= taiTime->GetElement(i)) &&
-                (taiMjd <  taiTime->GetElement(i+1)))
-            {
-               //Real diffJD  = data[(i+1)*col] - 
-               //               data[i*col];
-               //Real whereJD = utcJD - data[i*col];
-               Real diffJD = taiTime->GetElement(i + 1) - taiTime->GetElement(i);
-               Real whereJD = taiMjd - taiTime->GetElement(i);
-
-               Real ratio = whereJD / diffJD;
-               Real diffOff = data[(i + 1)*col + 1] -
-                              data[i*col + 1];
-               Real errorInSec = (diffJD - 1.0)*GmatTimeConstants::SECS_PER_DAY;
-               if (GmatMathUtil::Abs(errorInSec) > 0.6)
-                  diffOff = diffOff - GmatMathUtil::Round(errorInSec);
-               off = data[i*col + 1] + ratio * diffOff;
-               lastIndex    = i;
-               break;
-            }
-         }
-      }
-   }
+   Real off = GetUt1UtcOffset(taiMjd, lastIndex);
+
    lastTaiMjd = taiMjd;
    lastOffset = off;
    #ifdef DEBUG_OFFSET
@@ -477,6 +438,52 @@ Real EopFile::GetUt1UtcOffset(const Real taiMjd)
    return off;
 }
 
+
+//---------------------------------------------------------------------------
+//  Real GetUt1UtcOffset(const Real taiMjd, Integer &hint)
+//---------------------------------------------------------------------------
+/**
+ * Returns the UT1-UTC offset for the input TAI MJD time.
+ *
+ * The caller owns the table index hint, so callers that keep their own hint
+ * do not share any lookup state through this object.
+ *
+ * @param taiMjd time for which to return the offset
+ * @param hint   table index from the caller's previous lookup; set to the
+ *               index used for this lookup on return
+ *
+ * @return UT1-UTC offset (seconds)
+ */
+//---------------------------------------------------------------------------
+Real EopFile::GetUt1UtcOffset(const Real taiMjd, Integer &hint)
+{
+   if (!isInitialized)  Initialize();
+
+   const Real *data  = ut1UtcOffsets->GetDataVector();
+   const Real *times = taiTime->GetDataVector();
+   Integer col       = ut1UtcOffsets->GetNumColumns();
+
+   if (taiMjd >= times[tableSz-1])
+   {
+      hint = tableSz - 1;
+      return data[((tableSz - 1) * col) + 1];
+   }
+   if (taiMjd <= times[0])
+   {
+      hint = 0;
+      return data[1];
+   }
+
+   //// for case: utcJD_Min < utcJD < utcJD_Max
+   Integer i = FindInterval(times, 1, taiMjd, hint);
+   hint = i;
+
+   Real diffJD  = times[i + 1] - times[i];
+   Real whereJD = taiMjd - times[i];
+   Real ratio   = whereJD / diffJD;
+   return data[i*col + 1] + ratio * ut1UtcSteps[i];
+}
+
 //---------------------------------------------------------------------------
 //  Rmatrix GetPolarMotionData()
 //---------------------------------------------------------------------------
@@ -510,95 +517,75 @@ Rmatrix EopFile::GetPolarMotionData()
 //---------------------------------------------------------------------------
 bool EopFile::GetPolarMotionAndLod(const GmatTime &forUtcMjd, Real &xval, Real  &yval,
                                    Real &lodval)
+{
+   return GetPolarMotionAndLod(forUtcMjd, xval, yval, lodval, previousIndex);
+}
+
+
+//---------------------------------------------------------------------------
+//  bool GetPolarMotionAndLod(const GmatTime &forUtcMjd, Real &xval, Real  &yval,
+//                            Real &lodval, Integer &hint)
+//---------------------------------------------------------------------------
+/**
+ * Returns the polar motion data X, Y, and LOD, for the input UTC MJD time,
+ * using a caller-owned table index hint.
+ * 
+ * @param forUtcMjd time for which to return the data
+ * @param xval      return X value of polar motion data (arcsec)
+ * @param yval      return Y value of polar motion data (arcsec)
+ * @param lodval    return LOD value (seconds)
+ * @param hint      table index from the caller's previous lookup; set to the
+ *                  index used for this lookup on return
+ *
+ */
+//---------------------------------------------------------------------------
+bool EopFile::GetPolarMotionAndLod(const GmatTime &forUtcMjd, Real &xval, Real  &yval,
+                                   Real &lodval, Integer &hint)
 {
    if (!isInitialized)  Initialize();
    
-   Integer i = 0;
    GmatTime    utcJD = forUtcMjd + GmatTimeConstants::JD_NOV_17_1858;
    Integer col = polarMotion->GetNumColumns();
    const Real *data = polarMotion->GetDataVector();
    
    // if it's before the time on the file, return the first values
-   
-   //if (utcJD <= polarMotion->GetElement(0,0))
    if (utcJD <= data[0])
    {
       xval   = data[1];
       yval   = data[2];
       lodval = data[3];
-//       xval   = polarMotion->GetElement(0,1);
-//       yval   = polarMotion->GetElement(0,2);
-//       lodval = polarMotion->GetElement(0,3);
+      hint   = 0;
+   }
+   // if it's after the time on the file, return the last values
+   else if (utcJD >= data[(tableSz - 1)*col])
+   {
+      Integer last = (tableSz - 1)*col;
+      xval   = data[last + 1];
+      yval   = data[last + 2];
+      lodval = data[last + 3];
+      hint   = tableSz - 1;
    }
    else
    {
-      // First try to use the index from the last call
-      if ((previousIndex < tableSz - 1) && 
-          (utcJD <= data[(previousIndex+1)*col]) &&
-          (utcJD >= data[previousIndex*col]))
-      {
-         Integer leftIndex  = previousIndex*col, 
-                 rightIndex = (previousIndex+1)*col;
-         // otherwise, interpolate between values
-         Real diffJD  = data[rightIndex] - data[leftIndex];
-         GmatTime whereJD = utcJD - data[leftIndex];
+      Integer i = FindInterval(data, col, utcJD.GetMjd(), hint);
+      Integer leftIndex  = i*col,
+              rightIndex = (i+1)*col;
+      // otherwise, interpolate between values
+      Real diffJD  = data[rightIndex] - data[leftIndex];
+      GmatTime whereJD = utcJD - data[leftIndex];
 
-         Real ratio = whereJD.GetMjd() / diffJD;
-         Real diffX   = data[rightIndex + 1] - data[leftIndex + 1];
-         Real diffY   = data[rightIndex + 2] - data[leftIndex + 2];
+      Real ratio = whereJD.GetMjd() / diffJD;
+      Real diffX   = data[rightIndex + 1] - data[leftIndex + 1];
+      Real diffY   = data[rightIndex + 2] - data[leftIndex + 2];
 
+      xval   = data[leftIndex + 1] + ratio * diffX;
+      yval   = data[leftIndex + 2] + ratio * diffY;
 
-         //Real diffLOD = polarMotion->GetElement(i+1,3) -
-         //               polarMotion->GetElement(i,3);
-         xval   = data[leftIndex + 1] + ratio * diffX;
-         yval   = data[leftIndex + 2] + ratio * diffY;
+      // 2005.02.23 - Steve says not to interpolate lod
+      lodval = data[leftIndex + 3];
 
-         // 2005.02.23 - Steve says not to interpolate lod
-         //lodval = polarMotion->GetElement(i,3) + ratio * diffLOD;
-         lodval = data[leftIndex + 3];
-      }
-      else
-      {
-         for (i = (tableSz - 1); i >= 0; i--)
-         {
-            //if (utcJD >= polarMotion->GetElement(i,0))
-            if (utcJD >= data[i*col + 0])
-            {
-               // if it's greater than the last entry in the table, then return the 
-               // last value
-               if (i == (tableSz -1))
-               {
-                  xval   = data[i*col + 1];
-                  yval   = data[i*col + 2];
-                  lodval = data[i*col + 3];
-               }
-               else
-               {
-                  // otherwise, interpolate between values
-                  Real diffJD  = data[(i+1)*col + 0] - 
-                                 data[i*col + 0];
-                  GmatTime whereJD = utcJD - data[i*col + 0];
-
-                  Real ratio   = whereJD.GetMjd() / diffJD;
-                  Real diffX   = data[(i+1)*col + 1] -
-                                 data[i*col + 1];
-                  Real diffY   = data[(i+1)*col + 2] -
-                                 data[i*col + 2];
-                  //Real diffLOD = polarMotion->GetElement(i+1,3) -
-                  //               polarMotion->GetElement(i,3);
-                  xval   = data[i*col + 1] + ratio * diffX;
-                  yval   = data[i*col + 2] + ratio * diffY;
-                  // 2005.02.23 - Steve says not to interpolate lod
-                  //lodval = polarMotion->GetElement(i,3) + ratio * diffLOD;
-                  lodval = data[i*col + 3];
-                  
-               }
-               // Buffer the index for performance
-               previousIndex = i;
-               break;
-            }
-         }
-      }
+      // Buffer the index for performance
+      hint = i;
    }
    return true;
 }
@@ -624,6 +611,141 @@ bool EopFile::IsBlank(const char* aLine)
 }
 
 
+//------------------------------------------------------------------------------
+//  bool LoadCachedTable()
+//------------------------------------------------------------------------------
+/**
+ * Restores the table rows from a DataFileCache entry, in place of parsing
+ * the file.
+ *
+ * The rows hold the UTC Julian date, UT1-UTC, x, y and LOD that the parser
+ * stores.  The TAI times depend on the leap second file, so they are
+ * computed again here.
+ *
+ * @return true if the rows were restored, false if the file must be parsed.
+ */
+//------------------------------------------------------------------------------
+bool EopFile::LoadCachedTable()
+{
+   std::stringstream format;
+   format << "EopFile|" << eopFType;
+   cachedTable = DataFileCache::Find(StringArray(1, eopFileName), format.str());
+   if (!cachedTable)
+      return false;
+
+   Integer size = cachedTable->GetTableSize("Rows");
+   if ((size < 5) || (size % 5 != 0) || (size / 5 > MAX_TABLE_SIZE))
+   {
+      cachedTable.reset();
+      return false;
+   }
+
+   const Real *rows = cachedTable->GetTable("Rows");
+   for (tableSz = 0; tableSz < size / 5; ++tableSz)
+   {
+      const Real *row = rows + 5 * tableSz;
+      ut1UtcOffsets->SetElement(tableSz, 0, row[0]);
+      ut1UtcOffsets->SetElement(tableSz, 1, row[1]);
+
+      GmatEpoch utcepoch = row[0] - GmatTimeConstants::JD_JAN_5_1941;
+      GmatEpoch a1JD = theTimeConverter->Convert(utcepoch, TimeSystemConverter::UTCMJD, TimeSystemConverter::TAIMJD);
+      taiTime->SetElement(tableSz, a1JD); // is actually TAI
+
+      polarMotion->SetElement(tableSz, 0, row[0]);
+      polarMotion->SetElement(tableSz, 1, row[2]);
+      polarMotion->SetElement(tableSz, 2, row[3]);
+      polarMotion->SetElement(tableSz, 3, row[4]);
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+//  void ShareTable()
+//------------------------------------------------------------------------------
+/**
+ * Stores the parsed table rows in a DataFileCache entry, so later readers of
+ * the file in this process, and in other processes when DATA_CACHE_PATH is
+ * set, skip the parsing.
+ */
+//------------------------------------------------------------------------------
+void EopFile::ShareTable()
+{
+   if (tableSz < 1)
+      return;
+
+   RealArray rows(5 * tableSz);
+   for (Integer i = 0; i < tableSz; ++i)
+   {
+      rows[5*i]   = ut1UtcOffsets->GetElement(i, 0);
+      rows[5*i+1] = ut1UtcOffsets->GetElement(i, 1);
+      rows[5*i+2] = polarMotion->GetElement(i, 1);
+      rows[5*i+3] = polarMotion->GetElement(i, 2);
+      rows[5*i+4] = polarMotion->GetElement(i, 3);
+   }
+
+   DataFileCache *entry = new DataFileCache;
+   entry->AddTable("Rows", &rows[0], rows.size());
+
+   std::stringstream format;
+   format << "EopFile|" << eopFType;
+   cachedTable = DataFileCache::Share(StringArray(1, eopFileName), format.str(),
+                                      entry);
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer FindInterval(const Real *times, Integer stride, Real atTime,
+//                       Integer hint) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the table interval containing a time.
+ *
+ * The hint and the following interval are tried first, then a guess based
+ * on the (daily) table spacing, and then a binary search.
+ *
+ * @param times  the table times; row i is at times[i*stride]
+ * @param stride spacing between consecutive times in the array
+ * @param atTime the time; must lie between the first and last table times
+ * @param hint   the interval to try first
+ *
+ * @return the index i with times[i] <= atTime < times[i+1]
+ */
+//------------------------------------------------------------------------------
+Integer EopFile::FindInterval(const Real *times, Integer stride, Real atTime,
+                              Integer hint) const
+{
+   Integer last = tableSz - 2;
+
+   if ((hint >= 0) && (hint <= last) && (atTime >= times[hint*stride]))
+   {
+      if (atTime < times[(hint+1)*stride])
+         return hint;
+      if ((hint < last) && (atTime < times[(hint+2)*stride]))
+         return hint + 1;
+   }
+
+   Real spacing = (times[(tableSz-1)*stride] - times[0]) / (tableSz - 1);
+   Integer i = (Integer)((atTime - times[0]) / spacing);
+   if (i > last)  i = last;
+   if (i < 0)     i = 0;
+   if ((atTime >= times[i*stride]) && (atTime < times[(i+1)*stride]))
+      return i;
+
+   Integer lo = 0, hi = last + 1;
+   while (hi - lo > 1)
+   {
+      Integer mid = (lo + hi) / 2;
+      if (atTime >= times[mid*stride])
+         lo = mid;
+      else
+         hi = mid;
+   }
+   return lo;
+}
+
+
 void EopFile::GetTimeRange(Real& timeMin, Real& timeMax)
 {
    static RealArray ra;
@@ -37,9 +37,12 @@
 #include "utildefs.hpp"
 #include "Rmatrix.hpp"
 #include "Rvector.hpp"
+#include <memory>
+#include <vector>
 
 
 class TimeSystemConverter;
+class DataFileCache;
 
 
 namespace GmatEop
@@ -76,12 +79,17 @@ public:
    
    // method to return the UT1-UTC offset for the given TAIMjd
    virtual Real    GetUt1UtcOffset(const Real taiMjd);
+   // UT1-UTC offset lookup using a caller-owned table index hint
+   virtual Real    GetUt1UtcOffset(const Real taiMjd, Integer &hint);
    
    // method to return JD, X, Y, LOD data (for use by coordinate systems)
    virtual Rmatrix GetPolarMotionData();
    // interpolate x, y, and lod to input time
    virtual bool    GetPolarMotionAndLod(const GmatTime &forUtcMjd, Real &xval, Real  &yval,
                                         Real &lodval);
+   // polar motion and LOD lookup using a caller-owned table index hint
+   virtual bool    GetPolarMotionAndLod(const GmatTime &forUtcMjd, Real &xval, Real  &yval,
+                                        Real &lodval, Integer &hint);
    void            GetTimeRange(Real& timeMin, Real &timeMax);
 
 protected:
@@ -97,6 +105,11 @@ protected:
    /// vector of UT1-UTC offsets : MJD, offset
    Rmatrix*             ut1UtcOffsets;
    Rvector*             taiTime;
+   /// UT1-UTC change over each table interval, corrected for leap seconds
+   std::vector<Real>    ut1UtcSteps;
+   /// Parsed table rows, shared with other readers of the same file
+   std::shared_ptr<const DataFileCache>
+                        cachedTable;
    
    Real                 lastUtcJd;
    Real                 lastTaiMjd;
@@ -109,6 +122,10 @@ protected:
    TimeSystemConverter *theTimeConverter;
 
    bool IsBlank(const char* aLine);
+   bool LoadCachedTable();
+   void ShareTable();
+   Integer FindInterval(const Real *times, Integer stride, Real atTime,
+                        Integer hint) const;
    
    // Performance code
    Integer              previousIndex;
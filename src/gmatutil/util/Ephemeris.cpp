@@ -37,6 +37,7 @@
 #include "MessageInterface.hpp"
 
 #include <sstream>
+#include <algorithm>          // For upper_bound
 
 //#define TEST_HERMITE_INTERP
 
@@ -56,7 +57,11 @@ Ephemeris::Ephemeris() :
    order                         (7),
    currentOrder                  (-1),
    warnInterpolationDegradation  (true),
-   useHermite                    (true)
+   useHermite                    (true),
+   hintSegment                   (-1),
+   hintIndex                     (-1),
+   windowSegment                 (-1),
+   windowStart                   (-1)
 {
    #ifdef TEST_HERMITE_INTERP
       // Temporary code to test the Hermite interpolator
@@ -126,7 +131,11 @@ Ephemeris::Ephemeris(const Ephemeris& ephem) :
    order                         (ephem.order),
    currentOrder                  (-1),
    warnInterpolationDegradation  (true),
-   useHermite                    (ephem.useHermite)
+   useHermite                    (ephem.useHermite),
+   hintSegment                   (-1),
+   hintIndex                     (-1),
+   windowSegment                 (-1),
+   windowStart                   (-1)
 {
 }
 
@@ -157,6 +166,7 @@ Ephemeris& Ephemeris::operator=(const Ephemeris& ephem)
       warnInterpolationDegradation = true;
       useHermite                   = ephem.useHermite;
       segmentStartTimes.clear();
+      ResetSearchData();
    }
 
    return *this;
@@ -195,27 +205,34 @@ Integer Ephemeris::FindSegment(const GmatEpoch forEpoch)
 {
    Integer retval = -1;
 
-   for (UnsignedInt i = 0; i < theEphem.size(); ++i)
+   if (!ephemSource)
+      return retval;
+
+   Integer segmentCount = ephemSource->GetSegmentCount();
+   for (Integer i = 0; i < segmentCount; ++i)
    {
+      GmatEpoch segStart = ephemSource->GetSegmentStart(i);
+      GmatEpoch segEnd = ephemSource->GetSegmentEnd(i);
+
       #ifdef DEBUG_INTERPOLATION
          MessageInterface::ShowMessage("Checking if %.12lf is between %.12lf and %.12lf\n",
-               forEpoch, theEphem[i].segStart, theEphem[i].segEnd);
+               forEpoch, segStart, segEnd);
       #endif
 
-      if ((theEphem[i].segStart <= forEpoch) && (forEpoch < theEphem[i].segEnd))
+      if ((segStart <= forEpoch) && (forEpoch < segEnd))
       {
          retval = i;
          break;
       }
 
       // Special case: Only one point in the segment
-      if ((theEphem[i].segStart == forEpoch) && (forEpoch == theEphem[i].segEnd))
+      if ((segStart == forEpoch) && (forEpoch == segEnd))
          retval = i;
    }
 
    // Handle the last point on the ephemeris
    if (forEpoch == a1EndEpoch)
-      retval = theEphem.size() - 1;
+      retval = segmentCount - 1;
 
    return retval;
 }
@@ -235,8 +252,9 @@ Integer Ephemeris::PointsInSegment(const Integer forSegment)
 {
    Integer retval = -1;
 
-   if ((forSegment >= 0) && (theEphem.size() > forSegment))
-      retval = theEphem[forSegment].points.size();
+   if (ephemSource && (forSegment >= 0) &&
+       (ephemSource->GetSegmentCount() > forSegment))
+      retval = ephemSource->GetPointCount(forSegment);
 
    return retval;
 }
@@ -247,6 +265,11 @@ Integer Ephemeris::PointsInSegment(const Integer forSegment)
 /**
  * Locates the index of the ephem point closest to the input epoch
  *
+ * The points of a segment are in time order, so the pair of points bracketing
+ * the epoch is found by bisection.  Propagation walks through the ephem, so
+ * the pair found on the previous call, and the pair after it, are checked
+ * first.  When two points are equally close the earlier one is returned.
+ *
  * @param segNum The index of the segment containing the epoch
  * @param forEpoch The epoch
  *
@@ -255,19 +278,49 @@ Integer Ephemeris::PointsInSegment(const Integer forSegment)
 //------------------------------------------------------------------------------
 Integer Ephemeris::IndexInSegment(const Integer segNum, const GmatEpoch forEpoch)
 {
-   Integer retval = -1;
+   const Real *epochs = ephemSource->GetEpochs(segNum);
+   Integer count = ephemSource->GetPointCount(segNum);
 
-   Real diff = 9e99, temp;
-   for (UnsignedInt i = 0; i < theEphem[segNum].points.size(); ++i)
+   if (count == 0)
+      return -1;
+
+   // Find lower, the last point at or before the epoch (-1 if there is none)
+   Integer lower = -1;
+   bool bracketed = false;
+   if (hintSegment == segNum)
    {
-      temp = GmatMathUtil::Abs(theEphem[segNum].points[i].theEpoch - forEpoch);
-      if (temp < diff)
+      for (Integer i = hintIndex; (i <= hintIndex + 1) && !bracketed; ++i)
       {
-         diff = temp;
-         retval = i;
+         if ((i >= 0) && (i < count - 1) &&
+             (epochs[i] <= forEpoch) && (forEpoch < epochs[i+1]))
+         {
+            lower = i;
+            bracketed = true;
+         }
       }
    }
 
+   if (!bracketed)
+   {
+      const Real *upper = std::upper_bound(epochs, epochs + count, forEpoch);
+      lower = (Integer)(upper - epochs) - 1;
+   }
+
+   hintSegment = segNum;
+   hintIndex = lower;
+
+   Integer retval = lower;
+   if (lower < 0)
+      retval = 0;
+   else if ((lower < count - 1) &&
+            (GmatMathUtil::Abs(epochs[lower+1] - forEpoch) <
+             GmatMathUtil::Abs(epochs[lower] - forEpoch)))
+      retval = lower + 1;
+
+   // Repeated epochs resolve to the first of the repeats
+   while ((retval > 0) && (epochs[retval-1] == epochs[retval]))
+      --retval;
+
    return retval;
 }
 
@@ -298,6 +351,25 @@ void Ephemeris::GetInterpolationInfoFromSegment(Integer segmentNo)
 }
 
 
+//------------------------------------------------------------------------------
+// void ResetSearchData()
+//------------------------------------------------------------------------------
+/**
+ * Discards the search hint and the interpolator window
+ *
+ * Readers call this method when they replace ephemSource, so that
+ * the next interpolation does not use points from the old data.
+ */
+//------------------------------------------------------------------------------
+void Ephemeris::ResetSearchData()
+{
+   hintSegment = -1;
+   hintIndex = -1;
+   windowSegment = -1;
+   windowStart = -1;
+}
+
+
 //------------------------------------------------------------------------------
 // Rvector6 InterpolatePoint(const GmatEpoch forEpoch)
 //------------------------------------------------------------------------------
@@ -336,7 +408,10 @@ Rvector6 Ephemeris::InterpolatePoint(const GmatEpoch forEpoch)
 
    GetInterpolationInfoFromSegment(segNo);
 
-   Integer maxOrder = theEphem[segNo].points.size() - 1;
+   Integer pointCount = ephemSource->GetPointCount(segNo);
+   const Real *epochs = ephemSource->GetEpochs(segNo);
+
+   Integer maxOrder = pointCount - 1;
    if (maxOrder > order)
       maxOrder = order;
 
@@ -354,6 +429,7 @@ Rvector6 Ephemeris::InterpolatePoint(const GmatEpoch forEpoch)
       else
          interp = new LagrangeInterpolator("", 6, maxOrder);
       currentOrder = maxOrder;
+      windowSegment = -1;
    }
 
    if ((currentOrder < order) && warnInterpolationDegradation)
@@ -368,29 +444,38 @@ Rvector6 Ephemeris::InterpolatePoint(const GmatEpoch forEpoch)
    Integer startIndex = index - Integer(currentOrder / 2);
    if (startIndex < 0)
       startIndex = 0;
-   if (startIndex + currentOrder + 1 > theEphem[segNo].points.size())
-      startIndex = theEphem[segNo].points.size() - currentOrder - 1;
+   if (startIndex + currentOrder + 1 > pointCount)
+      startIndex = pointCount - currentOrder - 1;
+
+   // Successive epochs usually fall between the same points, so the
+   // interpolator is only reloaded when the window of points moves
+   bool reload = ((segNo != windowSegment) || (startIndex != windowStart));
+   windowSegment = segNo;
+   windowStart = startIndex;
 
-   interp->Clear();
-   for (UnsignedInt i = 0; i <= currentOrder; ++i)
-      interp->AddPoint(theEphem[segNo].points[startIndex+i].theEpoch,
-            theEphem[segNo].points[startIndex+i].posvel.GetDataVector());
+   if (reload)
+   {
+      interp->Clear();
+      for (UnsignedInt i = 0; i <= currentOrder; ++i)
+         interp->AddPoint(epochs[startIndex+i],
+               ephemSource->GetState(segNo, startIndex+i));
+   }
 
    // Use derivative data for problems with lower than 7th order polynomials
-   if ((useHermite) && (currentOrder < 7))
+   if (reload && (useHermite) && (currentOrder < 7))
    {
       Real vel[6];
       for (UnsignedInt i = 0; i <= currentOrder; ++i)
       {
-         const Real *v = theEphem[segNo].points[startIndex+i].posvel.GetDataVector();
+         const Real *v = ephemSource->GetState(segNo, startIndex+i);
          for (Integer j = 0; j < 3; ++j)
          {
             // Since independent variable is in days, scale velocity the same
             vel[j] = v[j+3] * GmatTimeConstants::SECS_PER_DAY;
             vel[j+3] = -9.999999999e99;
          }
-         ((HermiteInterpolator*)interp)->AddDerivative(
-               theEphem[segNo].points[startIndex+i].theEpoch, vel);
+         ((HermiteInterpolator*)interp)->AddDerivative(epochs[startIndex+i],
+               vel);
       }
    }
 
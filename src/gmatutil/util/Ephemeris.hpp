@@ -34,6 +34,7 @@
 #include "utildefs.hpp"       // Change to gmatutil for R2018a
 #include "Rvector6.hpp"
 #include "Interpolator.hpp"
+#include "EphemerisSource.hpp"
 
 /**
  * Base class for the ephemeris file components.
@@ -56,24 +57,7 @@ public:
 //         const Integer pointNumber, const Integer forSegment = 0);
    virtual Rvector6 InterpolatePoint(const GmatEpoch forEpoch);
    virtual void     GetInterpolationInfoFromSegment(Integer segmentNo);
-
-   /// Structure containing the minimal data GMAT needs for an ephem
-   struct EphemPoint
-   {
-      GmatEpoch               theEpoch;
-      Rvector6                posvel;
-   };
-
-   /// A container for spans of an ephem.
-   struct Segment
-   {
-      GmatEpoch               segStart;
-      GmatEpoch               segEnd;
-      std::vector<EphemPoint> points;
-   };
-
-   /// The full ephem, consisting of one or more segments
-   std::vector<Segment>       theEphem;
+   void             ResetSearchData();
 
 protected:
    /// @note: Add a precision time version of times for R2019a?
@@ -87,6 +71,10 @@ protected:
    GmatEpoch      a1EndEpoch;
    /// List of epochs that mark the start of a data segment
    RealArray      segmentStartTimes;
+   /// The full ephem, consisting of one or more segments; shared by the
+   /// readers of the same file
+   std::shared_ptr<const EphemerisSource>
+                  ephemSource;
 
    /// Interpolator used for epochs that are not points in the ephem
    Interpolator   *interp;
@@ -98,6 +86,13 @@ protected:
    bool warnInterpolationDegradation;
    /// Flag to toggle between Lagrange and Hermite interpolation
    bool useHermite;
+
+   /// Segment and point index of the last IndexInSegment() call; search hint
+   Integer hintSegment;
+   Integer hintIndex;
+   /// Segment and first point of the data loaded into interp; -1 if none
+   Integer windowSegment;
+   Integer windowStart;
 };
 
 #endif /* Ephemeris_hpp */
@@ -0,0 +1,767 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           EphemerisSource
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the shared ephemeris point data
+ */
+//------------------------------------------------------------------------------
+
+#include "EphemerisSource.hpp"
+#include "FileManager.hpp"
+#include "FileUtil.hpp"
+#include "StringUtil.hpp"
+#include "BaseException.hpp"
+#include "MessageInterface.hpp"
+
+#include <sys/stat.h>            // for stat()
+#include <cstdio>                // for rename() and remove()
+#include <cstring>
+#include <fstream>
+#include <functional>            // for hash
+#include <sstream>
+
+#if !defined(_WIN32)
+   #define EPHEMERISSOURCE_USE_MMAP
+   #include <fcntl.h>
+   #include <sys/mman.h>
+   #include <unistd.h>
+#endif
+
+
+//#define DEBUG_SOURCE_CACHE
+
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+
+std::map<std::string, std::weak_ptr<const EphemerisSource> >
+      EphemerisSource::sourceCache;
+
+std::mutex EphemerisSource::cacheMutex;
+
+const char EphemerisSource::MAGIC[16] = "GMATEphemCache";
+
+const Integer EphemerisSource::VERSION = 1;
+
+const Integer EphemerisSource::BYTE_ORDER_MARK = 0x01020304;
+
+
+//------------------------------------------------------------------------------
+// EphemerisSource()
+//------------------------------------------------------------------------------
+/**
+ * Constructor, for a source that a reader fills
+ */
+//------------------------------------------------------------------------------
+EphemerisSource::EphemerisSource() :
+   segmentTable      (NULL),
+   epochData         (NULL),
+   stateData         (NULL),
+   segmentCount      (0),
+   pointCount        (0),
+   mappedData        (NULL),
+   mappedSize        (0),
+   isMapped          (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~EphemerisSource()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+EphemerisSource::~EphemerisSource()
+{
+   #ifdef EPHEMERISSOURCE_USE_MMAP
+      if (isMapped && (mappedData != NULL))
+         munmap((void*)mappedData, mappedSize);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void AddSegment(GmatEpoch segStart)
+//------------------------------------------------------------------------------
+/**
+ * Starts a new segment; the points added next belong to it
+ *
+ * @param segStart The start epoch of the segment
+ */
+//------------------------------------------------------------------------------
+void EphemerisSource::AddSegment(GmatEpoch segStart)
+{
+   SegmentEntry entry;
+   entry.segStart   = segStart;
+   entry.segEnd     = segStart;
+   entry.firstPoint = epochs.size();
+   entry.pointCount = 0;
+   segments.push_back(entry);
+
+   SetPointers();
+}
+
+
+//------------------------------------------------------------------------------
+// void AddPoint(GmatEpoch epoch, const Real *posvel)
+//------------------------------------------------------------------------------
+/**
+ * Adds a point to the last segment, and moves the segment end to it
+ *
+ * @param epoch  The A.1 epoch of the point
+ * @param posvel The 6 element Cartesian state of the point
+ */
+//------------------------------------------------------------------------------
+void EphemerisSource::AddPoint(GmatEpoch epoch, const Real *posvel)
+{
+   if (segments.empty())
+      AddSegment(epoch);
+
+   epochs.push_back(epoch);
+   states.insert(states.end(), posvel, posvel + 6);
+   ++segments.back().pointCount;
+   segments.back().segEnd = epoch;
+
+   SetPointers();
+}
+
+
+//------------------------------------------------------------------------------
+// void SetMetadata(const std::string &keyword, const std::string &value,
+//       Integer forSegment)
+//------------------------------------------------------------------------------
+/**
+ * Stores a keyword and value pair with the source
+ *
+ * @param keyword    The keyword
+ * @param value      Its value
+ * @param forSegment The segment the value belongs to, or -1 for the file
+ */
+//------------------------------------------------------------------------------
+void EphemerisSource::SetMetadata(const std::string &keyword,
+      const std::string &value, Integer forSegment)
+{
+   metadataSegments.push_back(forSegment);
+   metadata.push_back(std::make_pair(keyword, value));
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetSegmentCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of segments
+ */
+//------------------------------------------------------------------------------
+Integer EphemerisSource::GetSegmentCount() const
+{
+   return segmentCount;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatEpoch GetSegmentStart(Integer segment) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the start epoch of a segment
+ *
+ * @param segment The index of the segment
+ */
+//------------------------------------------------------------------------------
+GmatEpoch EphemerisSource::GetSegmentStart(Integer segment) const
+{
+   return segmentTable[segment].segStart;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatEpoch GetSegmentEnd(Integer segment) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the end epoch of a segment, the epoch of its last point
+ *
+ * @param segment The index of the segment
+ */
+//------------------------------------------------------------------------------
+GmatEpoch EphemerisSource::GetSegmentEnd(Integer segment) const
+{
+   return segmentTable[segment].segEnd;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetPointCount(Integer segment) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of points in a segment
+ *
+ * @param segment The index of the segment
+ */
+//------------------------------------------------------------------------------
+Integer EphemerisSource::GetPointCount(Integer segment) const
+{
+   return segmentTable[segment].pointCount;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetTotalPointCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of points in all of the segments
+ */
+//------------------------------------------------------------------------------
+Integer EphemerisSource::GetTotalPointCount() const
+{
+   return pointCount;
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetEpochs(Integer segment) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the A.1 epochs of the points of a segment, in time order
+ *
+ * @param segment The index of the segment
+ *
+ * @return GetPointCount(segment) epochs
+ */
+//------------------------------------------------------------------------------
+const Real* EphemerisSource::GetEpochs(Integer segment) const
+{
+   return epochData + segmentTable[segment].firstPoint;
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetState(Integer segment, Integer point) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the Cartesian state of a point
+ *
+ * @param segment The index of the segment
+ * @param point   The index of the point in the segment
+ *
+ * @return The 6 state elements
+ */
+//------------------------------------------------------------------------------
+const Real* EphemerisSource::GetState(Integer segment, Integer point) const
+{
+   return stateData + 6 * (size_t)(segmentTable[segment].firstPoint + point);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetMetadata(const std::string &keyword, Integer forSegment) const
+//------------------------------------------------------------------------------
+/**
+ * Returns a value stored with SetMetadata()
+ *
+ * @param keyword    The keyword
+ * @param forSegment The segment the value belongs to, or -1 for the file
+ *
+ * @return The value, or an empty string if it was not set
+ */
+//------------------------------------------------------------------------------
+std::string EphemerisSource::GetMetadata(const std::string &keyword,
+      Integer forSegment) const
+{
+   for (UnsignedInt i = 0; i < metadata.size(); ++i)
+      if ((metadataSegments[i] == forSegment) && (metadata[i].first == keyword))
+         return metadata[i].second;
+   return "";
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsMapped() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the data is read from a cache file rather than parsed
+ */
+//------------------------------------------------------------------------------
+bool EphemerisSource::IsMapped() const
+{
+   return mappedData != NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// std::shared_ptr<const EphemerisSource> Find(const std::string &fileName,
+//       const std::string &format)
+//------------------------------------------------------------------------------
+/**
+ * Finds the data of an ephemeris file that is already loaded or cached
+ *
+ * @param fileName The full path of the ephemeris file
+ * @param format   Name of the reader format, so readers that store different
+ *                 data for the same file do not share it
+ *
+ * @return The source, or an empty pointer if the file has to be parsed
+ */
+//------------------------------------------------------------------------------
+std::shared_ptr<const EphemerisSource> EphemerisSource::Find(
+      const std::string &fileName, const std::string &format)
+{
+   std::shared_ptr<const EphemerisSource> source;
+
+   std::string key = GetKey(fileName, format);
+   if (key == "")
+      return source;
+
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   std::map<std::string, std::weak_ptr<const EphemerisSource> >::iterator
+         entry = sourceCache.find(key);
+   if (entry != sourceCache.end())
+   {
+      source = entry->second.lock();
+      if (!source)
+         sourceCache.erase(entry);
+   }
+
+   if (!source)
+   {
+      std::string cacheFile = GetCacheFileName(fileName, format);
+      if (cacheFile != "")
+      {
+         EphemerisSource *mapped = new EphemerisSource;
+         if (mapped->MapCacheFile(cacheFile, key))
+         {
+            source.reset(mapped);
+            sourceCache[key] = source;
+         }
+         else
+            delete mapped;
+      }
+   }
+
+   #ifdef DEBUG_SOURCE_CACHE
+      MessageInterface::ShowMessage("EphemerisSource::Find(%s): %s\n",
+            fileName.c_str(), (!source ? "not loaded" :
+            (source->IsMapped() ? "cache file" : "shared")));
+   #endif
+
+   return source;
+}
+
+
+//------------------------------------------------------------------------------
+// std::shared_ptr<const EphemerisSource> Share(const std::string &fileName,
+//       const std::string &format, EphemerisSource *source)
+//------------------------------------------------------------------------------
+/**
+ * Makes the data parsed from an ephemeris file available to its other readers
+ *
+ * When a cache directory is set, the data is also written to a cache file,
+ * and the returned source maps that file in place of the parsed arrays.
+ *
+ * @param fileName The full path of the ephemeris file
+ * @param format   Name of the reader format
+ * @param source   The parsed data; the returned pointer takes ownership of it
+ *
+ * @return The shared source
+ */
+//------------------------------------------------------------------------------
+std::shared_ptr<const EphemerisSource> EphemerisSource::Share(
+      const std::string &fileName, const std::string &format,
+      EphemerisSource *source)
+{
+   source->SetPointers();
+   std::shared_ptr<const EphemerisSource> shared(source);
+
+   std::string key = GetKey(fileName, format);
+   if (key == "")
+      return shared;
+
+   std::string cacheFile = GetCacheFileName(fileName, format);
+   if ((cacheFile != "") && source->WriteCacheFile(cacheFile, key))
+   {
+      EphemerisSource *mapped = new EphemerisSource;
+      if (mapped->MapCacheFile(cacheFile, key))
+         shared.reset(mapped);
+      else
+         delete mapped;
+   }
+
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   sourceCache[key] = shared;
+
+   return shared;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetPointers()
+//------------------------------------------------------------------------------
+/**
+ * Points the accessors at the arrays of a source built by a reader
+ */
+//------------------------------------------------------------------------------
+void EphemerisSource::SetPointers()
+{
+   segmentCount = segments.size();
+   pointCount   = epochs.size();
+   segmentTable = (segments.empty() ? NULL : &segments[0]);
+   epochData    = (epochs.empty() ? NULL : &epochs[0]);
+   stateData    = (states.empty() ? NULL : &states[0]);
+}
+
+
+//------------------------------------------------------------------------------
+// bool MapCacheFile(const std::string &cacheFile, const std::string &key)
+//------------------------------------------------------------------------------
+/**
+ * Maps a cache file, if it was written for the current ephemeris file
+ *
+ * @param cacheFile The cache file
+ * @param key       The key of the ephemeris file
+ *
+ * @return true if the file is mapped, false if it is missing or out of date
+ */
+//------------------------------------------------------------------------------
+bool EphemerisSource::MapCacheFile(const std::string &cacheFile,
+      const std::string &key)
+{
+   #ifdef EPHEMERISSOURCE_USE_MMAP
+      int fd = open(cacheFile.c_str(), O_RDONLY);
+      if (fd < 0)
+         return false;
+
+      struct stat info;
+      if ((fstat(fd, &info) == 0) && (info.st_size > 0))
+      {
+         void *addr = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+         if (addr != MAP_FAILED)
+         {
+            mappedData = (const char*)addr;
+            mappedSize = info.st_size;
+            isMapped = true;
+         }
+      }
+      close(fd);
+   #endif
+
+   if (mappedData == NULL)
+   {
+      std::ifstream in(cacheFile.c_str(), std::ios::binary | std::ios::ate);
+      if (!in.is_open())
+         return false;
+      std::streamoff size = in.tellg();
+      if (size <= 0)
+         return false;
+      loadedData.resize((size_t)size);
+      in.seekg(0);
+      in.read(&loadedData[0], size);
+      if (!in)
+         return false;
+      mappedData = &loadedData[0];
+      mappedSize = (size_t)size;
+   }
+
+   CacheHeader hdr;
+   bool valid = (mappedSize >= sizeof(CacheHeader));
+   if (valid)
+   {
+      memcpy(&hdr, mappedData, sizeof(CacheHeader));
+      valid = (memcmp(hdr.magic, MAGIC, sizeof(MAGIC)) == 0) &&
+              (hdr.version == VERSION) &&
+              (hdr.byteOrder == BYTE_ORDER_MARK) &&
+              (hdr.segmentCount >= 0) && (hdr.pointCount >= 0) &&
+              (hdr.keyBytes >= 0) && (hdr.metadataBytes >= 0);
+   }
+
+   size_t tableOffset = sizeof(CacheHeader);
+   size_t epochOffset = tableOffset +
+         (size_t)hdr.segmentCount * sizeof(SegmentEntry);
+   size_t stateOffset = epochOffset + (size_t)hdr.pointCount * sizeof(Real);
+   size_t keyOffset = stateOffset + (size_t)hdr.pointCount * 6 * sizeof(Real);
+   size_t metadataOffset = keyOffset + (size_t)hdr.keyBytes;
+   if (valid)
+      valid = (metadataOffset + (size_t)hdr.metadataBytes == mappedSize) &&
+              (std::string(mappedData + keyOffset, hdr.keyBytes) == key);
+
+   if (valid)
+   {
+      segmentTable = (const SegmentEntry*)(mappedData + tableOffset);
+      for (Integer i = 0; (i < hdr.segmentCount) && valid; ++i)
+         valid = (segmentTable[i].firstPoint >= 0) &&
+                 (segmentTable[i].pointCount >= 0) &&
+                 (segmentTable[i].firstPoint <=
+                  hdr.pointCount - segmentTable[i].pointCount);
+   }
+   if (valid)
+      valid = SetMetadataText(mappedData + metadataOffset, hdr.metadataBytes);
+
+   if (!valid)
+   {
+      #ifdef EPHEMERISSOURCE_USE_MMAP
+         if (isMapped)
+            munmap((void*)mappedData, mappedSize);
+      #endif
+      mappedData = NULL;
+      mappedSize = 0;
+      isMapped = false;
+      loadedData.clear();
+      segmentTable = NULL;
+      return false;
+   }
+
+   segmentCount = hdr.segmentCount;
+   pointCount   = hdr.pointCount;
+   epochData    = (const Real*)(mappedData + epochOffset);
+   stateData    = (const Real*)(mappedData + stateOffset);
+
+   #ifdef DEBUG_SOURCE_CACHE
+      MessageInterface::ShowMessage("Mapped %d points from the ephemeris "
+            "cache file %s\n", pointCount, cacheFile.c_str());
+   #endif
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool WriteCacheFile(const std::string &cacheFile,
+//       const std::string &key) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the source to a cache file
+ *
+ * The file is written under a temporary name and then renamed, so other
+ * processes never map a partly written file.
+ *
+ * @param cacheFile The cache file
+ * @param key       The key of the ephemeris file
+ *
+ * @return true if the file was written
+ */
+//------------------------------------------------------------------------------
+bool EphemerisSource::WriteCacheFile(const std::string &cacheFile,
+      const std::string &key) const
+{
+   std::string text = GetMetadataText();
+
+   CacheHeader hdr;
+   memset(&hdr, 0, sizeof(CacheHeader));
+   memcpy(hdr.magic, MAGIC, sizeof(MAGIC));
+   hdr.version       = VERSION;
+   hdr.byteOrder     = BYTE_ORDER_MARK;
+   hdr.segmentCount  = segmentCount;
+   hdr.pointCount    = pointCount;
+   hdr.keyBytes      = key.size();
+   hdr.metadataBytes = text.size();
+
+   std::stringstream tempName;
+   tempName << cacheFile << ".tmp";
+   #ifdef EPHEMERISSOURCE_USE_MMAP
+      tempName << getpid();
+   #endif
+
+   bool written = false;
+   {
+      std::ofstream out(tempName.str().c_str(), std::ios::binary);
+      if (out.is_open())
+      {
+         out.write((const char*)&hdr, sizeof(CacheHeader));
+         out.write((const char*)segmentTable,
+               (std::streamsize)(segmentCount * sizeof(SegmentEntry)));
+         out.write((const char*)epochData,
+               (std::streamsize)(pointCount * sizeof(Real)));
+         out.write((const char*)stateData,
+               (std::streamsize)((size_t)pointCount * 6 * sizeof(Real)));
+         out.write(key.c_str(), key.size());
+         out.write(text.c_str(), text.size());
+         out.close();
+         written = !out.fail();
+      }
+   }
+
+   if (written && (std::rename(tempName.str().c_str(), cacheFile.c_str()) != 0))
+   {
+      // Windows does not rename onto an existing file
+      std::remove(cacheFile.c_str());
+      written = (std::rename(tempName.str().c_str(), cacheFile.c_str()) == 0);
+   }
+
+   if (!written)
+   {
+      std::remove(tempName.str().c_str());
+      MessageInterface::ShowMessage("*** WARNING *** The ephemeris cache file "
+            "%s could not be written\n", cacheFile.c_str());
+   }
+
+   return written;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetMetadataText() const
+//------------------------------------------------------------------------------
+/**
+ * Builds the cache file form of the metadata: segment index, keyword and
+ * value of each pair, each ended by a null character
+ */
+//------------------------------------------------------------------------------
+std::string EphemerisSource::GetMetadataText() const
+{
+   std::string text;
+   for (UnsignedInt i = 0; i < metadata.size(); ++i)
+   {
+      std::stringstream segment;
+      segment << metadataSegments[i];
+      text += segment.str();
+      text += '\0';
+      text += metadata[i].first;
+      text += '\0';
+      text += metadata[i].second;
+      text += '\0';
+   }
+   return text;
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetMetadataText(const char *text, Integer size)
+//------------------------------------------------------------------------------
+/**
+ * Restores the metadata from its cache file form
+ *
+ * @param text The text written by GetMetadataText()
+ * @param size The length of the text
+ *
+ * @return false if the text is not well formed
+ */
+//------------------------------------------------------------------------------
+bool EphemerisSource::SetMetadataText(const char *text, Integer size)
+{
+   metadataSegments.clear();
+   metadata.clear();
+
+   StringArray fields;
+   Integer start = 0;
+   for (Integer i = 0; i < size; ++i)
+   {
+      if (text[i] == '\0')
+      {
+         fields.push_back(std::string(text + start, i - start));
+         start = i + 1;
+      }
+   }
+   if ((start != size) || (fields.size() % 3 != 0))
+      return false;
+
+   for (UnsignedInt i = 0; i < fields.size(); i += 3)
+   {
+      Integer segment;
+      if (!GmatStringUtil::ToInteger(fields[i], segment))
+         return false;
+      SetMetadata(fields[i+1], fields[i+2], segment);
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetKey(const std::string &fileName, const std::string &format)
+//------------------------------------------------------------------------------
+/**
+ * Builds the key identifying the data of an ephemeris file
+ *
+ * The key holds the reader format and the name, size and modification time of
+ * the file, so an edited file is parsed again.  The epochs are converted to
+ * A.1 with the leap second file, so its name, size and time are included too.
+ *
+ * @param fileName The full path of the ephemeris file
+ * @param format   Name of the reader format
+ *
+ * @return The key, or an empty string if the file cannot be shared
+ */
+//------------------------------------------------------------------------------
+std::string EphemerisSource::GetKey(const std::string &fileName,
+      const std::string &format)
+{
+   struct stat fileStatus;
+   if ((fileName == "") || (stat(fileName.c_str(), &fileStatus) != 0))
+      return "";
+
+   std::stringstream key;
+   key << format << "|" << fileName << "|" << (long long)fileStatus.st_size
+       << "|" << (long long)fileStatus.st_mtime;
+
+   std::string leapFile;
+   try
+   {
+      leapFile = FileManager::Instance()->GetFullPathname("LEAP_SECS_FILE");
+   }
+   catch (BaseException &)
+   {
+      leapFile = "";
+   }
+   struct stat leapStatus;
+   if ((leapFile != "") && (stat(leapFile.c_str(), &leapStatus) == 0))
+      key << "|" << leapFile << "|" << (long long)leapStatus.st_size << "|"
+          << (long long)leapStatus.st_mtime;
+
+   return key.str();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetCacheFileName(const std::string &fileName,
+//       const std::string &format)
+//------------------------------------------------------------------------------
+/**
+ * Builds the name of the cache file of an ephemeris file
+ *
+ * Cache files are written to the EPHEM_CACHE_PATH directory of the startup
+ * file.  The name is the ephemeris file name with a hash of its full path and
+ * the reader format, so files of the same name in other directories do not
+ * collide.
+ *
+ * @param fileName The full path of the ephemeris file
+ * @param format   Name of the reader format
+ *
+ * @return The cache file, or an empty string if cache files are not used
+ */
+//------------------------------------------------------------------------------
+std::string EphemerisSource::GetCacheFileName(const std::string &fileName,
+      const std::string &format)
+{
+   std::string cachePath;
+   try
+   {
+      cachePath = FileManager::Instance()->GetPathname("EPHEM_CACHE_PATH");
+   }
+   catch (BaseException &)
+   {
+      return "";
+   }
+
+   std::stringstream name;
+   name << cachePath << GmatFileUtil::ParseFileName(fileName) << "."
+        << std::hex << std::hash<std::string>()(format + "|" + fileName)
+        << ".gec";
+   return name.str();
+}
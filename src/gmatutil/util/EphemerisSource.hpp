@@ -0,0 +1,164 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           EphemerisSource
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Shared, read-only point data of an ephemeris file
+ */
+//------------------------------------------------------------------------------
+
+#ifndef EphemerisSource_hpp
+#define EphemerisSource_hpp
+
+#include "utildefs.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * The parsed points of an ephemeris file, shared by its readers
+ *
+ * A source holds the segments of an ephemeris as flat arrays: the segment
+ * table, the A.1 epochs of the points and their Cartesian states, plus any
+ * keyword and value pairs the reader needs to restore without parsing the
+ * file again.  A source is never changed once it is shared, so every reader
+ * of the same file uses one copy.
+ *
+ * Sources are shared in two ways:
+ *
+ * - In a process, Share() registers a source under a key built from the file
+ *   name, size and modification time, and the name of the leap second file.
+ *   Find() returns it to later readers while any reader still uses it.
+ * - Across processes, when the startup file sets EPHEM_CACHE_PATH, Share()
+ *   also writes the source to a binary cache file in that directory.  Find()
+ *   memory maps a cache file that matches the key, so later runs skip the
+ *   text parsing and all processes share the pages of one mapping.
+ */
+class GMATUTIL_API EphemerisSource
+{
+public:
+   /// Keyword and value pairs stored with a source
+   typedef std::vector<std::pair<std::string, std::string> > Metadata;
+
+   EphemerisSource();
+   ~EphemerisSource();
+
+   // Building a source, before it is shared
+   void              AddSegment(GmatEpoch segStart);
+   void              AddPoint(GmatEpoch epoch, const Real *posvel);
+   void              SetMetadata(const std::string &keyword,
+                                 const std::string &value,
+                                 Integer forSegment = -1);
+
+   Integer           GetSegmentCount() const;
+   GmatEpoch         GetSegmentStart(Integer segment) const;
+   GmatEpoch         GetSegmentEnd(Integer segment) const;
+   Integer           GetPointCount(Integer segment) const;
+   Integer           GetTotalPointCount() const;
+   const Real*       GetEpochs(Integer segment) const;
+   const Real*       GetState(Integer segment, Integer point) const;
+   std::string       GetMetadata(const std::string &keyword,
+                                 Integer forSegment = -1) const;
+   bool              IsMapped() const;
+
+   static std::shared_ptr<const EphemerisSource>
+                     Find(const std::string &fileName,
+                          const std::string &format);
+   static std::shared_ptr<const EphemerisSource>
+                     Share(const std::string &fileName,
+                           const std::string &format,
+                           EphemerisSource *source);
+
+private:
+   /// Header of a cache file; the segment table and the data follow it
+   struct CacheHeader
+   {
+      char           magic[16];
+      Integer        version;
+      Integer        byteOrder;
+      Integer        segmentCount;
+      Integer        pointCount;
+      Integer        keyBytes;
+      Integer        metadataBytes;
+   };
+
+   /// Entry of the segment table
+   struct SegmentEntry
+   {
+      GmatEpoch      segStart;
+      GmatEpoch      segEnd;
+      Integer        firstPoint;
+      Integer        pointCount;
+   };
+
+   /// Segment table, epochs and states; in the owned arrays or the mapping
+   const SegmentEntry            *segmentTable;
+   const Real                    *epochData;
+   const Real                    *stateData;
+   Integer                       segmentCount;
+   Integer                       pointCount;
+
+   /// Arrays of a source built by a reader
+   std::vector<SegmentEntry>     segments;
+   RealArray                     epochs;
+   RealArray                     states;
+
+   /// Metadata, with the segment it belongs to (-1 for the whole file)
+   std::vector<Integer>          metadataSegments;
+   Metadata                      metadata;
+
+   /// The mapped (or loaded) cache file, and its size in bytes
+   const char                    *mappedData;
+   size_t                        mappedSize;
+   /// True if mappedData is a memory map rather than loadedData
+   bool                          isMapped;
+   /// Cache file contents when no memory map is available
+   std::vector<char>             loadedData;
+
+   EphemerisSource(const EphemerisSource &source);
+   EphemerisSource&  operator=(const EphemerisSource &source);
+
+   void              SetPointers();
+   bool              MapCacheFile(const std::string &cacheFile,
+                                  const std::string &key);
+   bool              WriteCacheFile(const std::string &cacheFile,
+                                    const std::string &key) const;
+   std::string       GetMetadataText() const;
+   bool              SetMetadataText(const char *text, Integer size);
+
+   static std::string
+                     GetKey(const std::string &fileName,
+                            const std::string &format);
+   static std::string
+                     GetCacheFileName(const std::string &fileName,
+                                      const std::string &format);
+
+   /// Sources in use, by key
+   static std::map<std::string, std::weak_ptr<const EphemerisSource> >
+                     sourceCache;
+   /// Mutex guarding sourceCache
+   static std::mutex cacheMutex;
+
+   static const char          MAGIC[16];
+   static const Integer       VERSION;
+   static const Integer       BYTE_ORDER_MARK;
+};
+
+#endif /* EphemerisSource_hpp */
@@ -37,6 +37,8 @@
 #include "FileUtil.hpp"           // for GmatFileUtil::
 #include "StringTokenizer.hpp"    // for StringTokenizer()
 #include "GmatGlobal.hpp"         // for SetTestingMode()
+#include "Profiler.hpp"           // for SetEnabled()
+#include "MemoryTracker.hpp"      // for SetCounting()
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -317,6 +319,9 @@ bool FileManager::SetGmatWorkingDirectory(const std::string &newDir)
    MessageInterface::ShowMessage("Entering SetGmatWorkingDirectory with '%s'\n",
                                  newDir.c_str());
 #endif
+   // A new script may rely on files created since the last one was run
+   ClearPathCache();
+   
    // Allow resetting on purpose
    if (newDir == "")
    {
@@ -548,7 +553,7 @@ std::string FileManager::FindPath(const std::string &fileName, const std::string
       MessageInterface::ShowMessage("   The filename has absolute path\n");
 #endif
       
-      if (GmatFileUtil::DoesFileExist(fullname))
+      if (DoesFileExist(fullname))
       {
          pathToReturn = fullname;
       }
@@ -617,7 +622,7 @@ std::string FileManager::FindPath(const std::string &fileName, const std::string
             MessageInterface::ShowMessage("   => first search Path = '%s'\n", tempPath1.c_str());
          #endif
          
-         if (GmatFileUtil::DoesFileExist(tempPath1))
+         if (DoesFileExist(tempPath1))
          {
             pathToReturn = tempPath1;
          }
@@ -665,7 +670,7 @@ std::string FileManager::FindPath(const std::string &fileName, const std::string
                 "startup file\n   '%s'\n", fullname.c_str(), tempPath1.c_str(),
                 tempPath2.c_str());
             
-            if (GmatFileUtil::DoesFileExist(tempPath2))
+            if (DoesFileExist(tempPath2))
             {
                pathToReturn = tempPath2;
             }
@@ -800,6 +805,10 @@ std::string FileManager::FindPath(const std::string &fileName, const std::string
          MessageInterface::ShowMessage(mLastFilePathMessage + "\n");
    }
    
+   // An output file is about to be written, so a cached probe of it is stale
+   if (!forInput && pathToReturn != "")
+      ForgetPath(pathToReturn);
+   
    #ifdef DEBUG_FIND_PATH
       MessageInterface::ShowMessage
       ("FileManager::FindPath() returning '%s'\n", pathToReturn.c_str());
@@ -850,21 +859,71 @@ std::string FileManager::GetPathSeparator()
 // bool DoesDirectoryExist(const std::string &dirPath, bool isBlankOk = true)
 //------------------------------------------------------------------------------
 /*
+ * A directory found to exist is cached, so the file system is probed once
+ * per directory until the cache is cleared.  Missing directories are probed
+ * every time, so a directory created during a run is found.
+ *
  * @return  true  If directory exist, false otherwise
  */
 //------------------------------------------------------------------------------
 bool FileManager::DoesDirectoryExist(const std::string &dirPath, bool isBlankOk)
 {
-   return GmatFileUtil::DoesDirectoryExist(dirPath, isBlankOk);
+   if (dirPath == "")
+      return isBlankOk;
+   
+   std::lock_guard<std::mutex> lock(mPathCacheMutex);
+   if (mDirExistCache.find(dirPath) != mDirExistCache.end())
+      return true;
+   
+   bool dirExists = GmatFileUtil::DoesDirectoryExist(dirPath, isBlankOk);
+   if (dirExists)
+      mDirExistCache.insert(dirPath);
+   return dirExists;
 }
 
 
 //------------------------------------------------------------------------------
 // bool DoesFileExist(const std::string &filename)
 //------------------------------------------------------------------------------
+/*
+ * A file found to exist is cached, so the file system is probed once per
+ * file until the cache is cleared.  Missing files are probed every time, so
+ * a file written during a run is found.
+ *
+ * @return  true  If file exist, false otherwise
+ */
+//------------------------------------------------------------------------------
 bool FileManager::DoesFileExist(const std::string &filename)
 {
-   return GmatFileUtil::DoesFileExist(filename);
+   std::lock_guard<std::mutex> lock(mPathCacheMutex);
+   if (mFileExistCache.find(filename) != mFileExistCache.end())
+      return true;
+   
+   bool fileExists = GmatFileUtil::DoesFileExist(filename);
+   if (fileExists)
+      mFileExistCache.insert(filename);
+   return fileExists;
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearPathCache()
+//------------------------------------------------------------------------------
+/**
+ * Clears the cached file and directory existence results.
+ *
+ * FindPath(), DoesFileExist() and DoesDirectoryExist() remember the paths
+ * they find, and probe again for paths that were missing.  The cache is
+ * cleared when the startup file is read and when the GMAT working directory
+ * is set, which happens for every script run.  Call this method after files
+ * used by GMAT are removed by other programs during a run.
+ */
+//------------------------------------------------------------------------------
+void FileManager::ClearPathCache()
+{
+   std::lock_guard<std::mutex> lock(mPathCacheMutex);
+   mFileExistCache.clear();
+   mDirExistCache.clear();
 }
 
 
@@ -904,6 +963,8 @@ bool FileManager::RenameFile(const std::string &oldName,
                oldName.c_str(), newName.c_str());
       #endif
       retCode = rename(oldName.c_str(), newName.c_str()); // overwriting is platform-dependent!!!!
+      ForgetPath(oldName);
+      ForgetPath(newName);
       if (retCode == 0)
       {
          return true;
@@ -958,6 +1019,7 @@ bool FileManager::CopyFile(const std::string &oldName,
       std::ifstream src(oldName.c_str(), std::ios::binary);
       std::ofstream dest(newName.c_str(), std::ios::binary);
       dest << src.rdbuf();
+      ForgetPath(newName);
       retCode = src && dest;
       return retCode == 1;
    }
@@ -1260,6 +1322,22 @@ void FileManager::ReadStartupFile(const std::string &fileName)
             GmatGlobal::Instance()->SetWriteParameterInfo(true);
          }
       }
+      else if (type == "PROFILING")
+      {
+         if (name == "ON")
+         {
+            mProfiling = name;
+            Profiler::SetEnabled(true);
+         }
+      }
+      else if (type == "MEMORY_TELEMETRY")
+      {
+         if (name == "ON")
+         {
+            mMemoryTelemetry = name;
+            MemoryTracker::SetCounting(true);
+         }
+      }
       else if (type == "DEBUG_FILE_PATH")
       {
          if (name == "ON")
@@ -1305,6 +1383,13 @@ void FileManager::ReadStartupFile(const std::string &fileName)
          else
             GmatGlobal::Instance()->SetSkipSplashMode(false);
       }
+      else if (type == "LAZY_PLUGIN_LOADING")
+      {
+         if (name == "ON")
+            GmatGlobal::Instance()->SetLazyPluginLoading(true);
+         else
+            GmatGlobal::Instance()->SetLazyPluginLoading(false);
+      }
       else
       {
          // Ignore old VERSION specification (2011.03.18)
@@ -1534,9 +1619,32 @@ void FileManager::WriteStartupFile(const std::string &fileName)
       outStream << std::setw(22) << "WRITE_GMAT_KEYWORD" << " = " << mWriteGmatKeyword << "\n";
    }
    
+   //---------------------------------------------
+   // write PROFILING if not blank
+   //---------------------------------------------
+   if (mProfiling != "")
+   {
+      #ifdef DEBUG_WRITE_STARTUP_FILE
+      MessageInterface::ShowMessage("   .....Writing PROFILING\n");
+      #endif
+      outStream << std::setw(22) << "PROFILING" << " = " << mProfiling << "\n";
+   }
+   
+   //---------------------------------------------
+   // write MEMORY_TELEMETRY if not blank
+   //---------------------------------------------
+   if (mMemoryTelemetry != "")
+   {
+      #ifdef DEBUG_WRITE_STARTUP_FILE
+      MessageInterface::ShowMessage("   .....Writing MEMORY_TELEMETRY\n");
+      #endif
+      outStream << std::setw(22) << "MEMORY_TELEMETRY" << " = " << mMemoryTelemetry << "\n";
+   }
+   
    if (mRunMode != "" || mPlotMode != "" || mMatlabMode != "" ||
        mDebugMatlab != "" || mDebugMissionTree != "" || mWriteParameterInfo != "" ||
-       mWriteFilePathInfo != "" || mWriteGmatKeyword != "" )
+       mWriteFilePathInfo != "" || mWriteGmatKeyword != "" || mProfiling != "" ||
+       mMemoryTelemetry != "")
       outStream << "#-----------------------------------------------------------\n";
    
    //---------------------------------------------
@@ -3317,7 +3425,7 @@ std::string FileManager::GetGmatPath(GmatPathType type,
       MessageInterface::ShowMessage("   fullPath='%s'\n", fullPath.c_str());
       #endif
 
-      if (GmatFileUtil::DoesFileExist(fullPath))
+      if (DoesFileExist(fullPath))
       {
          fileFound = true;
          break;
@@ -3625,6 +3733,8 @@ void FileManager::RefreshFiles()
    mWriteParameterInfo = "";
    mWriteFilePathInfo = "";
    mWriteGmatKeyword = "";
+   mProfiling = "";
+   mMemoryTelemetry = "";
    mLastFilePathMessage = "";
    mPathMap.clear();
    mGmatFunctionPaths.clear();
@@ -3638,6 +3748,7 @@ void FileManager::RefreshFiles()
       delete iter->second;
 
    mFileMap.clear();
+   ClearPathCache();
    
    //-------------------------------------------------------
    // add root and data path
@@ -3784,6 +3895,22 @@ void FileManager::RefreshFiles()
 }
 
 
+//------------------------------------------------------------------------------
+// void ForgetPath(const std::string &path)
+//------------------------------------------------------------------------------
+/**
+ * Drops the cached existence results for a file that GMAT is creating,
+ * renaming or copying, so the next probe goes to the file system.
+ */
+//------------------------------------------------------------------------------
+void FileManager::ForgetPath(const std::string &path)
+{
+   std::lock_guard<std::mutex> lock(mPathCacheMutex);
+   mFileExistCache.erase(path);
+   mDirExistCache.erase(path);
+}
+
+
 //------------------------------------------------------------------------------
 // void ShowMaps(const std::string &msg)
 //------------------------------------------------------------------------------
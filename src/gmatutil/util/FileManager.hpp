@@ -40,7 +40,9 @@
 #include "utildefs.hpp"
 #include <map>
 #include <list>
+#include <set>
 #include <fstream>
+#include <mutex>
 
 class GMATUTIL_API FileManager
 {
@@ -160,6 +162,7 @@ public:
    std::string GetPathSeparator();
    bool DoesDirectoryExist(const std::string &dirPath, bool isBlankOk = true);
    bool DoesFileExist(const std::string &filename);
+   void ClearPathCache();
    bool RenameFile(const std::string &oldName, const std::string &newName,
                    Integer &retCode, bool overwriteIfExists = false);
    bool CopyFile(const std::string &oldName, const std::string &newName,
@@ -281,6 +284,8 @@ private:
    std::string mWriteParameterInfo;
    std::string mWriteFilePathInfo;
    std::string mWriteGmatKeyword;
+   std::string mProfiling;
+   std::string mMemoryTelemetry;
    std::string mLastFilePathMessage;
    
    std::ifstream mInStream;
@@ -305,6 +310,14 @@ private:
 
    StringArray mPluginList;
    
+   /// Files found to exist, keyed by the path probed; missing files are
+   /// not cached, so a file created later is seen on the next probe
+   std::set<std::string> mFileExistCache;
+   /// Directories found to exist, keyed by the path probed
+   std::set<std::string> mDirExistCache;
+   /// Guards the existence caches
+   std::mutex mPathCacheMutex;
+   
    std::string GetGmatPath(GmatPathType type, std::list<std::string> &pathList,
                            const std::string &name);
 
@@ -313,6 +326,7 @@ private:
    void WriteHeader(std::ofstream &outStream);
    void WriteFiles(std::ofstream &outStream, const std::string &type);
    void RefreshFiles();
+   void ForgetPath(const std::string &path);
    
    // For debugging
    void ShowMaps(const std::string &msg);
@@ -1260,6 +1260,34 @@ bool GmatGlobal::SkipSplashMode()
    return skipSplash;
 }
 
+//------------------------------------------------------------------------------
+// void SetLazyPluginLoading(bool lazy)
+//------------------------------------------------------------------------------
+/**
+* Sets whether plug-in libraries are loaded when their types are first used
+*
+* @param lazy true to load plug-ins on first use, false to load them on startup
+*/
+//------------------------------------------------------------------------------
+void GmatGlobal::SetLazyPluginLoading(bool lazy)
+{
+   lazyPluginLoading = lazy;
+}
+
+//------------------------------------------------------------------------------
+// bool IsLazyPluginLoading()
+//------------------------------------------------------------------------------
+/**
+* Returns whether plug-in libraries are loaded when their types are first used
+*
+* @return true if plug-ins listed in the plug-in manifest are loaded on first use
+*/
+//------------------------------------------------------------------------------
+bool GmatGlobal::IsLazyPluginLoading()
+{
+   return lazyPluginLoading;
+}
+
 //---------------------------------
 // private methods
 //---------------------------------
@@ -1299,6 +1327,7 @@ GmatGlobal::GmatGlobal()
    isWritingFilePathInfo        = false;
    isWritingGmatKeyword         = true;
    commandEchoMode              = false;
+   lazyPluginLoading            = false;
    runMode = NORMAL;
    runState         = Gmat::IDLE;
    detailedRunState = Gmat::IDLE;
@@ -162,6 +162,10 @@ public:
    void SetSkipSplashMode(bool tfSplash);
    bool SkipSplashMode();
 
+   // Plug-in loading on first use
+   void SetLazyPluginLoading(bool lazy);
+   bool IsLazyPluginLoading();
+
    // MATLAB
    Integer GetMatlabMode();
    void SetMatlabMode(Integer mode);
@@ -341,6 +345,7 @@ private:
    bool isWritingGmatKeyword;
    bool commandEchoMode;
    bool skipSplash;
+   bool lazyPluginLoading;
    
    bool isEventLocationAvailable;
    bool includeFoundInScriptResource;
@@ -42,6 +42,7 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 
 #include <cstdlib>			// Required for GCC 4.3
 
@@ -179,18 +180,9 @@ Real LeapSecsFileReader::NumberOfLeapSecondsFrom(UtcMjd utcMjd)
    {
       Real jd = utcMjd + GmatTimeConstants::JD_MJD_OFFSET;
       
-      // look up each entry in the table to see if value is greater then the
-      // julian date
-      std::vector<LeapSecondInformation>::iterator info;
-      for (std::vector<LeapSecondInformation>::iterator i = lookUpTable.end();
-           i > lookUpTable.begin(); i--)
-      {
-         info = i-1;
-         if (jd >= info->julianDate)
-         {
-            return (info->offset1 + ((utcMjd - info->offset2) * info->offset3));
-         }
-      }
+      const LeapSecondInformation *info = FindInterval(jd);
+      if (info != NULL)
+         return (info->offset1 + ((utcMjd - info->offset2) * info->offset3));
       
       return 0.0;
    }
@@ -295,33 +287,18 @@ bool LeapSecsFileReader::IsInLeapSecond(Real theTaiMjd)
       nearestLeapSecond = taif;
    else
    {
-      Real diff        = GmatRealConstants::REAL_MAX;
-      Real currDiff    = 0.0;
-      Real currTai     = 0.0;
-      Real previousTai = taif;
+      // Bracket the time by the table entries on either side of it; the
+      // later one wins when the time is exactly in-between
+      std::vector<LeapSecondInformation>::const_iterator later =
+         std::upper_bound(lookUpTable.begin(), lookUpTable.end(), theTaiMjd,
+                          IsBeforeTai);
+      std::vector<LeapSecondInformation>::const_iterator earlier = later - 1;
       
-      Integer lookupSize = lookUpTable.size();
-      for (Integer ii = lookupSize - 1; ii >= 0; ii--)
-      {
-         currTai  = lookUpTable.at(ii).taiMJD;
-         currDiff = GmatMathUtil::Abs(currTai - theTaiMjd);
-         // added '=' because if it's exactly in-between, we want the later one
-         // - is that correct?
-         if (currDiff >= diff)
-         {
-            nearestLeapSecond = previousTai;
-            break;
-         }
-         else // currDiff < diff   so save it as the smallest diff so far
-         {
-            diff        = currDiff;
-            previousTai = currTai;
-            if (ii == 0)  // we've reached the end (beginning!) of the table
-            {
-               nearestLeapSecond = currTai;
-            }
-         }
-      }
+      if (GmatMathUtil::Abs(earlier->taiMJD - theTaiMjd) <
+          GmatMathUtil::Abs(later->taiMJD - theTaiMjd))
+         nearestLeapSecond = earlier->taiMJD;
+      else
+         nearestLeapSecond = later->taiMJD;
    }
    if (nearestLeapSecond == 0.0) // something went wrong
    {
@@ -347,6 +324,71 @@ bool LeapSecsFileReader::IsInLeapSecond(Real theTaiMjd)
 //------------------------------------------------------------------------------
 
 
+//------------------------------------------------------------------------------
+// const LeapSecondInformation* FindInterval(Real utcJd) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the table entry in effect at the input UTC Julian date.
+ *
+ * Nearly all conversions are for epochs past the last leap second, so the
+ * final interval is checked first; earlier epochs are found with a binary
+ * search on the (ascending) table dates.
+ *
+ * @param utcJd  The UTC Julian date
+ *
+ * @return The entry in effect, or NULL if the date precedes the table
+ */
+//------------------------------------------------------------------------------
+const LeapSecondInformation* LeapSecsFileReader::FindInterval(Real utcJd) const
+{
+   if (lookUpTable.empty())
+      return NULL;
+   
+   if (utcJd >= lookUpTable.back().julianDate)
+      return &lookUpTable.back();
+   
+   std::vector<LeapSecondInformation>::const_iterator i =
+      std::upper_bound(lookUpTable.begin(), lookUpTable.end(), utcJd,
+                       IsBeforeJulianDate);
+   if (i == lookUpTable.begin())
+      return NULL;
+   
+   --i;
+   if (utcJd >= i->julianDate)
+      return &(*i);
+   
+   return NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsBeforeJulianDate(Real utcJd, const LeapSecondInformation &info)
+//------------------------------------------------------------------------------
+/**
+ * Ordering predicate used to search the table by Julian date
+ */
+//------------------------------------------------------------------------------
+bool LeapSecsFileReader::IsBeforeJulianDate(Real utcJd,
+                                            const LeapSecondInformation &info)
+{
+   return utcJd < info.julianDate;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsBeforeTai(Real taiMjd, const LeapSecondInformation &info)
+//------------------------------------------------------------------------------
+/**
+ * Ordering predicate used to search the table by TAI modified Julian date
+ */
+//------------------------------------------------------------------------------
+bool LeapSecsFileReader::IsBeforeTai(Real taiMjd,
+                                     const LeapSecondInformation &info)
+{
+   return taiMjd < info.taiMJD;
+}
+
+
 //------------------------------------------------------------------------------
 // bool Parse()
 //------------------------------------------------------------------------------
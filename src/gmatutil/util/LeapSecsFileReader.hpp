@@ -75,6 +75,10 @@ public:
 private:
 
    bool Parse(std::string line);
+   const LeapSecondInformation* FindInterval(Real utcJd) const;
+   
+   static bool IsBeforeJulianDate(Real utcJd, const LeapSecondInformation &info);
+   static bool IsBeforeTai(Real taiMjd, const LeapSecondInformation &info);
 
    // member data
    bool isInitialized;
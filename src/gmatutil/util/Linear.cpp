@@ -33,6 +33,14 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <vector>
+#include <stdio.h>               // for snprintf()
+#include <stdlib.h>              // for strtod()
+#if defined(__has_include)
+#if __has_include(<charconv>) && (__cplusplus >= 201703L)
+#include <charconv>              // for std::to_chars()
+#endif
+#endif
 #include "RealUtilities.hpp"     // for PI, TWO_PI, Acos(), Atan()
 #include "Rvector.hpp"
 #include "Rvector3.hpp"
@@ -45,6 +53,72 @@
 using namespace GmatRealUtil;
 using namespace GmatMathUtil;
 
+namespace
+{
+   //---------------------------------------------------------------------------
+   // std::string FormatReal(const Real &rval, char conversion, bool showPoint,
+   //                        Integer precision, Integer width)
+   //---------------------------------------------------------------------------
+   /*
+    * Formats a left justified Real value with snprintf().
+    *
+    * The C++ standard defines stream output of floating point numbers in
+    * terms of the printf() conversions, so this produces the same text as a
+    * std::stringstream with the same settings, without the stream and
+    * locale overhead.
+    *
+    * @param  rval  Real value
+    * @param  conversion  'g' for the default format, 'e' for scientific or
+    *                     'f' for fixed
+    * @param  showPoint  if true, shows decimal point and trailing zeros
+    * @param  precision  Precision to be used in formatting
+    * @param  width  Width to be used in formatting
+    */
+   //---------------------------------------------------------------------------
+   std::string FormatReal(const Real &rval, char conversion, bool showPoint,
+                          Integer precision, Integer width)
+   {
+      char format[8] = "%-";
+      char *spec = format + 2;
+      if (showPoint)
+         *spec++ = '#';
+      *spec++ = '*';
+      *spec++ = '.';
+      *spec++ = '*';
+      *spec++ = conversion;
+      *spec = '\0';
+      
+      // Streams do not pad for negative widths, while printf() would
+      if (width < 0)
+         width = 0;
+      
+      char buffer[128];
+      int size = snprintf(buffer, sizeof(buffer), format, (int)width,
+                          (int)precision, rval);
+      if (size < (int)sizeof(buffer))
+         return std::string(buffer, size);
+      
+      // Wide fixed format values do not fit in the buffer
+      std::vector<char> wide(size + 1);
+      snprintf(&wide[0], wide.size(), format, (int)width, (int)precision, rval);
+      return std::string(&wide[0], size);
+   }
+   
+   //---------------------------------------------------------------------------
+   // std::string FormatInteger(const Integer &ival)
+   //---------------------------------------------------------------------------
+   /*
+    * Formats the digits of an Integer value.
+    */
+   //---------------------------------------------------------------------------
+   std::string FormatInteger(const Integer &ival)
+   {
+      char buffer[16];
+      int size = snprintf(buffer, sizeof(buffer), "%d", (int)ival);
+      return std::string(buffer, size);
+   }
+}
+
 //---------------------------------
 //  pubic
 //---------------------------------
@@ -478,23 +552,8 @@ std::string GmatRealUtil::ToString(const Real &rval, bool useCurrentFormat,
       isShowPointSet = global->ShowPoint();
    }
    
-   std::stringstream ss("");
-   ss.width(w);
-   ss.precision(p);
-   ss.setf(std::ios::left);
-
-   if (isShowPointSet)
-      ss.setf(std::ios::showpoint);
-   else
-      ss.unsetf(std::ios::showpoint);
-
-   if (isScientific)
-      ss.setf(std::ios::scientific);
-   else
-      ss.unsetf(std::ios::scientific);
-
-   ss << rval;
-   //return ss.str();
+   std::string sval =
+      FormatReal(rval, (isScientific ? 'e' : 'g'), isShowPointSet, p, w);
    
    // How do I specify 2 digints of the exponent? (LOJ: 2010.05.03)
    // (This is what I got from internet search)
@@ -507,8 +566,6 @@ std::string GmatRealUtil::ToString(const Real &rval, bool useCurrentFormat,
    // So manually remove extra 0 in the exponent of scientific notation.
    // ex) 1.23456e-015 to 1.23456e-15
    
-   std::string sval = ss.str();
-
    if ((sval.find("e-0") != sval.npos) && (sval.size() - sval.find("e-0")) == 5)
       sval = GmatStringUtil::Replace(sval, "e-0", "e-");
    if ((sval.find("e+0") != sval.npos) && (sval.size() - sval.find("e+0")) == 5)
@@ -537,23 +594,8 @@ std::string GmatRealUtil::RealToString(const Real &rval, bool useCurrentFormat,
       isShowPointSet = global->ShowPoint();
    }
 
-   std::stringstream ss("");
-   ss.width(w);
-   ss.precision(p);
-   ss.setf(std::ios::left);
-
-   if (isShowPointSet)
-      ss << std::showpoint;
-   else
-      ss << std::noshowpoint;
-
-   if (isScientific)
-      ss << std::scientific;
-   else
-      ss << std::fixed;
-
-   ss << rval;
-   
+   std::string formatted =
+      FormatReal(rval, (isScientific ? 'e' : 'f'), isShowPointSet, p, w);
 
    // How do I specify 2 digints of the exponent? (LOJ: 2010.05.03)
    // (This is what I got from internet search)
@@ -566,7 +608,7 @@ std::string GmatRealUtil::RealToString(const Real &rval, bool useCurrentFormat,
    // So manually remove extra 0 in the exponent of scientific notation.
    // ex) 1.23456e-015 to 1.23456e-15
 
-   std::string sval = GmatStringUtil::Trim(ss.str());
+   std::string sval = GmatStringUtil::Trim(formatted);
    
    if ((sval.find("e-0") != std::string::npos) && (sval.size() - sval.find("e-0")) == 5)
       sval = GmatStringUtil::Replace(sval, "e-0", "e-");
@@ -619,8 +661,41 @@ std::string GmatRealUtil::ToString(const Integer &ival, bool useCurrentFormat,
    if (useCurrentFormat)
       w = GmatGlobal::Instance()->GetIntegerWidth();
    
-   std::stringstream ss("");
-   ss.width(w);
-   ss << ival;
-   return ss.str();
+   // Right justified, as the stream pads by default
+   std::string digits = FormatInteger(ival);
+   if ((Integer)digits.size() < w)
+      digits.insert(0, w - digits.size(), ' ');
+   
+   return digits;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string ToShortestString(const Real &rval)
+//------------------------------------------------------------------------------
+/*
+ * Formats Real value to the shortest string that reads back as the same value.
+ *
+ * @param  rval  Real value
+ */
+//------------------------------------------------------------------------------
+std::string GmatRealUtil::ToShortestString(const Real &rval)
+{
+   char buffer[32];
+   
+   #if defined(__cpp_lib_to_chars)
+   std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer),
+                                               rval);
+   return std::string(buffer, result.ptr);
+   #else
+   // Without std::to_chars(), use the fewest digits that round trip
+   int size = 0;
+   for (int digits = 15; digits <= 17; ++digits)
+   {
+      size = snprintf(buffer, sizeof(buffer), "%.*g", digits, rval);
+      if ((digits == 17) || (strtod(buffer, NULL) == rval))
+         break;
+   }
+   return std::string(buffer, size);
+   #endif
 }
@@ -88,6 +88,8 @@ namespace GmatRealUtil
    
    GMATUTIL_API std::string ToString(const Integer &ival, bool useCurrentFormat = true,
                         Integer width = GmatGlobal::INTEGER_WIDTH);
+   
+   GMATUTIL_API std::string ToShortestString(const Real &rval);
 }
 #endif // Linear_hpp
 
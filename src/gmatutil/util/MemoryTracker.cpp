@@ -33,11 +33,50 @@
 #include "MemoryTracker.hpp"
 #include "MessageInterface.hpp"
 #include <stdio.h>                 // for sprintf()
+#include <atomic>
+
+#ifdef _WIN32
+   #include <windows.h>
+   #include <psapi.h>              // for GetProcessMemoryInfo()
+#else
+   #include <sys/resource.h>       // for getrusage()
+   #include <unistd.h>             // for sysconf()
+#endif
 
 //--------------------------------------
 //  initialize static variables
 //--------------------------------------
 MemoryTracker* MemoryTracker::instance = NULL;
+bool MemoryTracker::counting = false;
+
+
+namespace
+{
+   /// Telemetry counters for one subsystem, updated from any thread
+   struct AtomicCounts
+   {
+      std::atomic<long long> allocations;
+      std::atomic<long long> releases;
+      std::atomic<long long> live;
+      std::atomic<long long> liveBytes;
+      std::atomic<long long> peakLive;
+      std::atomic<long long> peakBytes;
+   };
+
+   AtomicCounts categoryCounts[MemoryTracker::CATEGORY_COUNT];
+
+   //---------------------------------------------------------------------------
+   // void RaisePeak(std::atomic<long long> &peak, long long value)
+   //---------------------------------------------------------------------------
+   void RaisePeak(std::atomic<long long> &peak, long long value)
+   {
+      long long current = peak.load(std::memory_order_relaxed);
+      while ((value > current) &&
+             !peak.compare_exchange_weak(current, value,
+                   std::memory_order_relaxed))
+         ;
+   }
+}
 
 //------------------------------------------------------------------------------
 // MemoryTracker* Instance()
@@ -202,12 +241,319 @@ StringArray& MemoryTracker::GetTracks(bool clearTracks, bool writeScriptName)
 }
 
 
+//------------------------------------------------------------------------------
+// void SetCounting(bool flag)
+//------------------------------------------------------------------------------
+/**
+ * Turns telemetry mode on or off
+ *
+ * @param flag true to count allocations
+ */
+//------------------------------------------------------------------------------
+void MemoryTracker::SetCounting(bool flag)
+{
+   counting = flag;
+}
+
+
+//------------------------------------------------------------------------------
+// void CountAllocation(AllocationCategory category, size_t bytes)
+//------------------------------------------------------------------------------
+/**
+ * Counts an allocation in telemetry mode
+ *
+ * @param category The subsystem making the allocation
+ * @param bytes    The size of an allocated buffer, or 0 for an object
+ */
+//------------------------------------------------------------------------------
+void MemoryTracker::CountAllocation(AllocationCategory category, size_t bytes)
+{
+   AtomicCounts &counts = categoryCounts[category];
+   counts.allocations.fetch_add(1, std::memory_order_relaxed);
+   RaisePeak(counts.peakLive,
+         counts.live.fetch_add(1, std::memory_order_relaxed) + 1);
+   if (bytes > 0)
+      RaisePeak(counts.peakBytes, counts.liveBytes.fetch_add((long long)bytes,
+            std::memory_order_relaxed) + (long long)bytes);
+}
+
+
+//------------------------------------------------------------------------------
+// void CountRelease(AllocationCategory category, size_t bytes)
+//------------------------------------------------------------------------------
+/**
+ * Counts a release in telemetry mode
+ *
+ * @param category The subsystem releasing the memory
+ * @param bytes    The size of the released buffer, or 0 for an object
+ */
+//------------------------------------------------------------------------------
+void MemoryTracker::CountRelease(AllocationCategory category, size_t bytes)
+{
+   AtomicCounts &counts = categoryCounts[category];
+   counts.releases.fetch_add(1, std::memory_order_relaxed);
+   counts.live.fetch_sub(1, std::memory_order_relaxed);
+   if (bytes > 0)
+      counts.liveBytes.fetch_sub((long long)bytes, std::memory_order_relaxed);
+}
+
+
+//------------------------------------------------------------------------------
+// AllocationCounts GetCounts(AllocationCategory category)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the counts for a subsystem since telemetry was turned on
+ *
+ * @param category The subsystem
+ *
+ * @return The counts
+ */
+//------------------------------------------------------------------------------
+MemoryTracker::AllocationCounts MemoryTracker::GetCounts(
+      AllocationCategory category)
+{
+   AtomicCounts &counts = categoryCounts[category];
+   AllocationCounts retval;
+   retval.allocations = counts.allocations.load(std::memory_order_relaxed);
+   retval.releases    = counts.releases.load(std::memory_order_relaxed);
+   retval.liveBytes   = counts.liveBytes.load(std::memory_order_relaxed);
+   retval.peakLive    = counts.peakLive.load(std::memory_order_relaxed);
+   retval.peakBytes   = counts.peakBytes.load(std::memory_order_relaxed);
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetCategoryName(AllocationCategory category)
+//------------------------------------------------------------------------------
+std::string MemoryTracker::GetCategoryName(AllocationCategory category)
+{
+   switch (category)
+   {
+   case FORCE_MODEL:
+      return "Force models";
+   case MEASUREMENT_DATA:
+      return "Measurement data";
+   case ARRAY_BUFFER:
+      return "Rvector/Rmatrix buffers";
+   case SANDBOX_CLONE:
+      return "Sandbox clones";
+   default:
+      return "Unknown";
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetResidentMemory(bool peak)
+//------------------------------------------------------------------------------
+/**
+ * Samples the resident memory of the process
+ *
+ * The peak is read with one system call, so it can be sampled often.  Where
+ * the current value is not available the peak is returned.
+ *
+ * @param peak true for the largest resident memory of the run so far
+ *
+ * @return The resident memory in MB, or 0 if it cannot be read
+ */
+//------------------------------------------------------------------------------
+Real MemoryTracker::GetResidentMemory(bool peak)
+{
+   #ifdef _WIN32
+      PROCESS_MEMORY_COUNTERS pmc;
+      if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+         return 0.0;
+      return (peak ? pmc.PeakWorkingSetSize : pmc.WorkingSetSize) / 1048576.0;
+   #else
+      #ifdef __linux__
+         if (!peak)
+         {
+            long pages = 0, resident = 0;
+            FILE *statm = fopen("/proc/self/statm", "r");
+            if (statm != NULL)
+            {
+               if (fscanf(statm, "%ld %ld", &pages, &resident) != 2)
+                  resident = 0;
+               fclose(statm);
+            }
+            if (resident > 0)
+               return resident * (Real)sysconf(_SC_PAGESIZE) / 1048576.0;
+         }
+      #endif
+      
+      struct rusage usage;
+      if (getrusage(RUSAGE_SELF, &usage) != 0)
+         return 0.0;
+      #ifdef __APPLE__
+         // ru_maxrss is in bytes on macOS, and in KB elsewhere
+         return usage.ru_maxrss / 1048576.0;
+      #else
+         return usage.ru_maxrss / 1024.0;
+      #endif
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void StartCommandCount(const void *command)
+//------------------------------------------------------------------------------
+/**
+ * Records the allocation totals as a command starts executing
+ *
+ * @param command The command
+ */
+//------------------------------------------------------------------------------
+void MemoryTracker::StartCommandCount(const void *command)
+{
+   CommandStart start;
+   start.command = command;
+   start.allocations = start.releases = start.liveBytes = 0;
+   for (Integer i = 0; i < CATEGORY_COUNT; ++i)
+   {
+      AllocationCounts counts = GetCounts((AllocationCategory)i);
+      start.allocations += counts.allocations;
+      start.releases += counts.releases;
+      start.liveBytes += counts.liveBytes;
+   }
+   commandStarts.push_back(start);
+}
+
+
+//------------------------------------------------------------------------------
+// void EndCommandCount(const void *command)
+//------------------------------------------------------------------------------
+/**
+ * Adds the allocations made since a command started to its counts, and samples
+ * the peak resident memory
+ *
+ * Starts left by commands that threw are discarded.
+ *
+ * @param command The command
+ */
+//------------------------------------------------------------------------------
+void MemoryTracker::EndCommandCount(const void *command)
+{
+   Integer index = (Integer)commandStarts.size() - 1;
+   while ((index >= 0) && (commandStarts[index].command != command))
+      --index;
+   if (index < 0)
+      return;
+
+   CommandStart start = commandStarts[index];
+   commandStarts.resize(index);
+
+   // New counts start at zero
+   CommandCounts &counts = commandCounts[command];
+   ++counts.executions;
+   for (Integer i = 0; i < CATEGORY_COUNT; ++i)
+   {
+      AllocationCounts current = GetCounts((AllocationCategory)i);
+      counts.allocations += current.allocations;
+      counts.releases += current.releases;
+      counts.byteChange += current.liveBytes;
+   }
+   counts.allocations -= start.allocations;
+   counts.releases -= start.releases;
+   counts.byteChange -= start.liveBytes;
+
+   Real resident = GetResidentMemory(true);
+   if (resident > counts.peakResidentMemory)
+      counts.peakResidentMemory = resident;
+   if (resident > peakResidentMemory)
+      peakResidentMemory = resident;
+}
+
+
+//------------------------------------------------------------------------------
+// void ResetCommandCounts()
+//------------------------------------------------------------------------------
+/**
+ * Clears the command counts; called when a run starts
+ */
+//------------------------------------------------------------------------------
+void MemoryTracker::ResetCommandCounts()
+{
+   commandStarts.clear();
+   commandCounts.clear();
+   peakResidentMemory = 0.0;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetCommandSummary(const void *command)
+//------------------------------------------------------------------------------
+/**
+ * Describes the allocations made by a command in the last run
+ *
+ * @param command The command
+ *
+ * @return The description, or an empty string if the command was not counted
+ */
+//------------------------------------------------------------------------------
+std::string MemoryTracker::GetCommandSummary(const void *command)
+{
+   std::map<const void*, CommandCounts>::iterator counts =
+         commandCounts.find(command);
+   if (counts == commandCounts.end())
+      return "";
+
+   char buffer[256];
+   snprintf(buffer, sizeof(buffer), "Allocations: %lld in %d executions, "
+         "%lld releases, %+lld buffer bytes; peak resident memory %.1lf MB\n",
+         counts->second.allocations, counts->second.executions,
+         counts->second.releases, counts->second.byteChange,
+         counts->second.peakResidentMemory);
+   return buffer;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetTelemetrySummary()
+//------------------------------------------------------------------------------
+/**
+ * Describes the allocation counts of each subsystem and the resident memory
+ *
+ * @return The description, or an empty string outside of telemetry mode
+ */
+//------------------------------------------------------------------------------
+std::string MemoryTracker::GetTelemetrySummary()
+{
+   if (!counting)
+      return "";
+
+   std::string summary = "Allocation telemetry\n"
+         "   Subsystem                    Allocations     Releases"
+         "   Peak live   Live bytes   Peak bytes\n";
+   char buffer[256];
+   for (Integer i = 0; i < CATEGORY_COUNT; ++i)
+   {
+      AllocationCounts counts = GetCounts((AllocationCategory)i);
+      snprintf(buffer, sizeof(buffer),
+            "   %-26s %13lld %12lld %11lld %12lld %12lld\n",
+            GetCategoryName((AllocationCategory)i).c_str(), counts.allocations,
+            counts.releases, counts.peakLive, counts.liveBytes,
+            counts.peakBytes);
+      summary += buffer;
+   }
+
+   Real peak = GetResidentMemory(true);
+   if (peakResidentMemory > peak)
+      peak = peakResidentMemory;
+   snprintf(buffer, sizeof(buffer), "   Resident memory %.1lf MB, peak %.1lf "
+         "MB\n", GetResidentMemory(false), peak);
+   summary += buffer;
+   return summary;
+}
+
+
 //------------------------------------------------------------------------------
 //  MemoryTracker()
 //------------------------------------------------------------------------------
 MemoryTracker::MemoryTracker()
 {
    showTrace = false;
+   peakResidentMemory = 0.0;
 }
 
 //------------------------------------------------------------------------------
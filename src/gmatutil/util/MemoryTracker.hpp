@@ -33,13 +33,63 @@
 #define MemoryTracker_hpp
 
 #include "utildefs.hpp"
+#include <map>
 
+/**
+ * Tracks memory use.
+ *
+ * In debug builds, Add() and Remove() record the creation and deletion of
+ * objects as text traces.  Any build can also run in telemetry mode, turned on
+ * with MEMORY_TELEMETRY = ON in the startup file.  In that mode allocations are
+ * counted per subsystem with atomic counters, the peak resident memory is
+ * sampled after each command, and the allocations made by each command are
+ * summed for the run summary.  While the mode is off a counting site costs one
+ * flag test.
+ */
 class GMATUTIL_API MemoryTracker
 {
 public:
    
+   /// Subsystems counted in telemetry mode
+   enum AllocationCategory
+   {
+      FORCE_MODEL = 0,
+      MEASUREMENT_DATA,
+      ARRAY_BUFFER,
+      SANDBOX_CLONE,
+      CATEGORY_COUNT
+   };
+   
+   /// Counts for one subsystem since telemetry was turned on
+   struct AllocationCounts
+   {
+      long long allocations;
+      long long releases;
+      long long liveBytes;
+      long long peakLive;
+      long long peakBytes;
+   };
+   
    static MemoryTracker* Instance();
    
+   /// Returns true in telemetry mode
+   static bool    IsCounting() { return counting; }
+   static void    SetCounting(bool flag);
+   static void    CountAllocation(AllocationCategory category,
+                                  size_t bytes = 0);
+   static void    CountRelease(AllocationCategory category, size_t bytes = 0);
+   static AllocationCounts
+                  GetCounts(AllocationCategory category);
+   static std::string
+                  GetCategoryName(AllocationCategory category);
+   static Real    GetResidentMemory(bool peak = false);
+   
+   void           StartCommandCount(const void *command);
+   void           EndCommandCount(const void *command);
+   void           ResetCommandCounts();
+   std::string    GetCommandSummary(const void *command);
+   std::string    GetTelemetrySummary();
+   
    void           SetScript(const std::string &script);
    void           SetShowTrace(bool show);
    void           Add(void *addr, const std::string &objName,
@@ -54,6 +104,34 @@ public:
 private:
    
    static MemoryTracker *instance;
+   /// Flag tested by every counting site
+   static bool counting;
+   
+   /// Allocation totals taken when a command starts
+   struct CommandStart
+   {
+      const void *command;
+      long long allocations;
+      long long releases;
+      long long liveBytes;
+   };
+   
+   /// Allocations summed over the executions of a command
+   struct CommandCounts
+   {
+      Integer executions;
+      long long allocations;
+      long long releases;
+      long long byteChange;
+      Real peakResidentMemory;
+   };
+   
+   /// Starts of the commands executing, innermost last
+   std::vector<CommandStart> commandStarts;
+   /// Counts for each command executed in the run
+   std::map<const void*, CommandCounts> commandCounts;
+   /// Largest peak resident memory sampled, in MB
+   Real peakResidentMemory;
    
    struct TrackType
    {
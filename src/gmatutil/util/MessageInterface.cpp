@@ -29,6 +29,8 @@
 #include <stdarg.h>              // for va_start() and va_end()
 #include <cstdlib>               // for malloc() and free() - Required for GCC 4.3
 #include <stdio.h>               // for vsprintf(), vsnprintf()
+#include <mutex>                 // for recursive_mutex
+#include <vector>
 
 //---------------------------------
 //  static data
@@ -38,6 +40,67 @@ MessageReceiver* MessageInterface::theMessageReceiver = NULL;
 const int MessageInterface::MAX_MESSAGE_LENGTH = 30000;
 
 
+namespace
+{
+   //---------------------------------------------------------------------------
+   // std::recursive_mutex& ReceiverMutex()
+   //---------------------------------------------------------------------------
+   /**
+    * Returns the mutex that serializes calls into the MessageReceiver
+    *
+    * The mutex is recursive because receivers may send messages of their own.
+    */
+   //---------------------------------------------------------------------------
+   std::recursive_mutex& ReceiverMutex()
+   {
+      static std::recursive_mutex receiverMutex;
+      return receiverMutex;
+   }
+
+   //---------------------------------------------------------------------------
+   // bool FormatMessage(std::string &msg, const char *format, va_list args)
+   //---------------------------------------------------------------------------
+   /**
+    * Formats a message in a buffer owned by the calling thread
+    *
+    * The buffer starts at MAX_MESSAGE_LENGTH characters and grows to fit
+    * longer messages, so threads format without locking and nothing is
+    * truncated.
+    *
+    * @param msg    The formatted message
+    * @param format The format
+    * @param args   The parameters inserted into the format
+    *
+    * @return false if the message could not be formatted
+    */
+   //---------------------------------------------------------------------------
+   bool FormatMessage(std::string &msg, const char *format, va_list args)
+   {
+      thread_local std::vector<char> msgBuffer(
+            MessageInterface::MAX_MESSAGE_LENGTH);
+
+      va_list argsCopy;
+      va_copy(argsCopy, args);
+      int ret = vsnprintf(msgBuffer.data(), msgBuffer.size(), format,
+            argsCopy);
+      va_end(argsCopy);
+      if (ret < 0)
+         return false;
+
+      if ((size_t)ret >= msgBuffer.size())
+      {
+         msgBuffer.resize(ret + 1);
+         ret = vsnprintf(msgBuffer.data(), msgBuffer.size(), format, args);
+         if (ret < 0)
+            return false;
+      }
+
+      msg.assign(msgBuffer.data(), ret);
+      return true;
+   }
+}
+
+
 //---------------------------------
 //  private methods
 //---------------------------------
@@ -76,6 +139,7 @@ MessageInterface::~MessageInterface()
 //------------------------------------------------------------------------------
 bool MessageInterface::SetMessageReceiver(MessageReceiver *mr)
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    theMessageReceiver = mr;
    return true;
 }
@@ -86,6 +150,7 @@ bool MessageInterface::SetMessageReceiver(MessageReceiver *mr)
 //------------------------------------------------------------------------------
 MessageReceiver* MessageInterface::GetMessageReceiver()
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    return theMessageReceiver;
 }
 
@@ -101,7 +166,9 @@ MessageReceiver* MessageInterface::GetMessageReceiver()
 //------------------------------------------------------------------------------
 void MessageInterface::ShowMessage(const std::string &msgString)
 {
-   ShowMessage("%s", msgString.c_str());
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
+   if ((theMessageReceiver != NULL) && theMessageReceiver->AcceptsMessages())
+      theMessageReceiver->ShowMessage(msgString);
 }
 
 
@@ -119,71 +186,20 @@ void MessageInterface::ShowMessage(const std::string &msgString)
 //------------------------------------------------------------------------------
 void MessageInterface::ShowMessage(const char *format, ...)
 {
+   // Skip the formatting when the receiver discards the message
+   if (!AcceptsMessages())
+      return;
+
+   std::string msg;
+   va_list args;
+   va_start(args, format);
+   bool formatted = FormatMessage(msg, format, args);
+   va_end(args);
+
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
-   {
-      int      ret;
-      size_t   size;
-      va_list  args;
-      
-      // Try using fixed size buffer and vsnprintf to prevent buffer
-      // overrrun (LOJ: 2015.05.21)
-      //==============================================================
-      #if 1
-      //==============================================================
-      
-      char msgBuffer[MAX_MESSAGE_LENGTH];
-      va_start(args, format);
-      
-      // Used vsnprintf (LOJ: 2015.05.21)
-      // int vsnprintf (char * s, size_t n, const char * format, va_list arg );
-      
-      ret = vsnprintf(msgBuffer, MAX_MESSAGE_LENGTH, format, args);
-      
-      if (ret < 0) // vsnprintf failed
-         theMessageReceiver->ShowMessage("Unable to complete messaging\n");
-      else
-      {
-         va_end(args);
-         theMessageReceiver->ShowMessage(std::string(msgBuffer));
-      }
-      
-      //==============================================================
-      #else
-      //==============================================================
-      
-      char *msgBuffer = NULL;
-      std::string msgStr("*** WARNING *** Cannot allocate enough memory to show the message.\n");
-      
-      // format is vsprintf format
-      // actual max message length is MAX_MESSAGE_LENGTH
-      size = strlen(format) + MAX_MESSAGE_LENGTH;
-      //LogMessage("strlen(format)=%u, size=%u\n", strlen(format), size);
-      
-      if( (msgBuffer = (char *)malloc(size)) != NULL )
-      {
-         for (unsigned int i=0; i<size; i++)
-            msgBuffer[i] = '\0';
-         va_start(args, format);
-         ret = vsprintf(msgBuffer, format, args);
-         //LogMessage("return from vsprintf() is %d\n", ret);
-         if (ret < 0)
-            theMessageReceiver->ShowMessage("Unable to complete messaging");
-         else
-         {
-            va_end(args);
-            theMessageReceiver->ShowMessage(std::string(msgBuffer));
-         }
-      }
-      else
-      {
-         theMessageReceiver->ShowMessage(msgStr);
-      }
-      free(msgBuffer);
-      
-      //==============================================================
-      #endif
-      //==============================================================
-   }
+      theMessageReceiver->ShowMessage(formatted ? msg :
+            std::string("Unable to complete messaging\n"));
 } // end ShowMessage()
 
 
@@ -221,84 +237,21 @@ void MessageInterface::PopupMessage(Gmat::MessageType msgType, const std::string
 void MessageInterface::PopupMessage(Gmat::MessageType msgType, const char *format,
       ...)
 {
+   std::string msg;
+   va_list args;
+   va_start(args, format);
+   bool formatted = FormatMessage(msg, format, args);
+   va_end(args);
+
+   // if no EOL then append it
+   if (!formatted)
+      msg = "Unable to complete messaging\n";
+   else if (msg.empty() || (msg[msg.length() - 1] != '\n'))
+      msg += "\n";
+
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
-   {
-      int          ret;
-      unsigned int size;
-      va_list      args;
-      
-      // Try using fixed size buffer and vsnprintf to prevent buffer
-      // overrrun (LOJ: 2015.05.21)
-      //==============================================================
-      #if 1
-      //==============================================================
-      
-      char msgBuffer[MAX_MESSAGE_LENGTH];
-      va_start(args, format);
-      
-      // Used vsnprintf (LOJ: 2015.05.21)
-      // int vsnprintf (char * s, size_t n, const char * format, va_list arg );      
-      ret = vsnprintf(msgBuffer, MAX_MESSAGE_LENGTH, format, args);
-      
-      if (ret < 0) // vsnprintf failed
-         theMessageReceiver->PopupMessage(msgType, "Unable to complete messaging\n");
-      else
-      {
-         va_end(args);
-         
-         // if no EOL then append it
-         if (msgBuffer[ret-1] != '\n')
-         {
-            if ((ret+1) < MAX_MESSAGE_LENGTH)
-            {
-               msgBuffer[ret] = '\n';
-               msgBuffer[ret+1] = '\0';
-            }
-         }
-         theMessageReceiver->PopupMessage(msgType, std::string(msgBuffer));
-      }
-      
-      //==============================================================
-      #else
-      //==============================================================
-      
-      char *msgBuffer = NULL;
-      std::string msgStr("*** WARNING *** Cannot allocate enough memory to show the message.\n");
-      
-      // format is vsprintf format
-      // actual max message length is MAX_MESSAGE_LENGTH
-      size = strlen(format) + MAX_MESSAGE_LENGTH;
-      
-      if ( (msgBuffer = (char *)malloc(size)) != NULL )
-      {
-         for (unsigned int i=0; i<size; i++)
-            msgBuffer[i] = '\0';
-         va_start(args, format);
-         ret = vsprintf(msgBuffer, format, args);
-         if (ret < 0)
-            theMessageReceiver->PopupMessage(msgType,
-                  "Unable to complete messaging");
-         else
-         {
-            va_end(args);
-
-            // if no EOL then append it
-            if (msgBuffer[strlen(msgBuffer)-1] != '\n')
-               msgBuffer[strlen(msgBuffer)] = '\n';
-            theMessageReceiver->PopupMessage(msgType, std::string(msgBuffer));
-         }
-      }
-      else
-      {
-         theMessageReceiver->PopupMessage(msgType, msgStr);
-      }
-      
-      free(msgBuffer);
-      
-      //==============================================================
-      #endif
-      //==============================================================
-   }
+      theMessageReceiver->PopupMessage(msgType, msg);
 } // end PopupMessage()
 
 //------------------------------------------------------------------------------
@@ -312,6 +265,7 @@ void MessageInterface::PopupMessage(Gmat::MessageType msgType, const char *forma
 //------------------------------------------------------------------------------
 std::string MessageInterface::GetLogFileName()
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver == NULL)
       return "";
    return theMessageReceiver->GetLogFileName();
@@ -329,6 +283,7 @@ std::string MessageInterface::GetLogFileName()
 //------------------------------------------------------------------------------
 void MessageInterface::SetLogEnable(bool flag)
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
       theMessageReceiver->SetLogEnable(flag);
 }
@@ -343,6 +298,7 @@ void MessageInterface::SetLogEnable(bool flag)
 //------------------------------------------------------------------------------
 bool MessageInterface::GetLogEnable()
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
       return theMessageReceiver->GetLogEnable();
    else
@@ -361,6 +317,7 @@ bool MessageInterface::GetLogEnable()
 //------------------------------------------------------------------------------
 void MessageInterface::SetLogPath(const char *pathname, bool append)
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
       theMessageReceiver->SetLogPath(std::string(pathname), append);
 }
@@ -377,6 +334,7 @@ void MessageInterface::SetLogPath(const char *pathname, bool append)
 //------------------------------------------------------------------------------
 void MessageInterface::SetLogPath(const std::string &pathname, bool append)
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
       theMessageReceiver->SetLogPath(pathname, append);
 }
@@ -392,6 +350,7 @@ void MessageInterface::SetLogPath(const std::string &pathname, bool append)
 //------------------------------------------------------------------------------
 void MessageInterface::SetLogFile(const std::string &filename)
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
       theMessageReceiver->SetLogFile(filename);
 }
@@ -407,7 +366,8 @@ void MessageInterface::SetLogFile(const std::string &filename)
 //------------------------------------------------------------------------------
 void MessageInterface::LogMessage(const std::string &msg)
 {
-   if (theMessageReceiver != NULL)
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
+   if ((theMessageReceiver != NULL) && theMessageReceiver->AcceptsMessages())
       theMessageReceiver->LogMessage(msg);
 }
 
@@ -425,83 +385,20 @@ void MessageInterface::LogMessage(const std::string &msg)
 //------------------------------------------------------------------------------
 void MessageInterface::LogMessage(const char *format, ...)
 {
-   if (theMessageReceiver != NULL)
-   {
-      int     ret;
-      size_t  size;
-      va_list args;
-      
-      // Try using fixed size buffer and vsnprintf to prevent buffer
-      // overrrun (LOJ: 2015.05.21)
-      //==============================================================
-      #if 1
-      //==============================================================
-      
-      char msgBuffer[MAX_MESSAGE_LENGTH];
-      va_start(args, format);
-      
-      // Used vsnprintf (LOJ: 2015.05.21)
-      // int vsnprintf (char * s, size_t n, const char * format, va_list arg );
-      // Composes a string with the same text that would be printed if format was
-      // used on printf, but using the elements in the variable argument list
-      // identified by arg instead of additional function arguments and storing
-      // the resulting content as a C string in the buffer pointed by s
-      // (taking n as the maximum buffer capacity to fill).
-      // If the resulting string would be longer than n-1 characters, the remaining
-      // characters are discarded and not stored, but counted for the value returned
-      // by the function.
-      
-      ret = vsnprintf(msgBuffer, MAX_MESSAGE_LENGTH, format, args);
-      
-      if (ret < 0) // vsnprintf failed
-         theMessageReceiver->LogMessage("Unable to complete messaging\n");
-      else
-      {
-         va_end(args);
-         theMessageReceiver->LogMessage(std::string(msgBuffer));
-      }
+   // Skip the formatting when the receiver discards the message
+   if (!AcceptsMessages())
+      return;
 
-      //==============================================================
-      #else
-      //==============================================================
-      
-      char *msgBuffer = NULL;
-      std::string msgStr("*** WARNING *** Cannot allocate enough memory to log the message.\n");
-
-      // format is vsprintf format
-      // actual max message length is MAX_MESSAGE_LENGTH
-      size = strlen(format) + MAX_MESSAGE_LENGTH;
-      
-      // If allocation failes, try with smaller size
-      if ( (msgBuffer = (char *)malloc(size)) == NULL)
-         msgBuffer = (char *)malloc(10000);
-      
-      //if ( (msgBuffer = (char *)malloc(size)) != NULL )
-      if (msgBuffer != NULL )
-      {
-         for (size_t i=0; i<size; i++)
-            msgBuffer[i] = '\0';
-         va_start(args, format);
-         ret = vsprintf(msgBuffer, format, args);
-         if (ret < 0) // vsprintf failed
-            theMessageReceiver->LogMessage("Unable to complete messaging\n");
-         else
-         {
-            va_end(args);
-            theMessageReceiver->LogMessage(std::string(msgBuffer));
-         }
-      }
-      else
-      {
-         theMessageReceiver->LogMessage(msgStr);
-      }
-      
-      free(msgBuffer);
-      
-      //==============================================================
-      #endif
-      //==============================================================
-   }
+   std::string msg;
+   va_list args;
+   va_start(args, format);
+   bool formatted = FormatMessage(msg, format, args);
+   va_end(args);
+
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
+   if (theMessageReceiver != NULL)
+      theMessageReceiver->LogMessage(formatted ? msg :
+            std::string("Unable to complete messaging\n"));
 }
 
 //------------------------------------------------------------------------------
@@ -513,6 +410,7 @@ void MessageInterface::LogMessage(const char *format, ...)
 //------------------------------------------------------------------------------
 void MessageInterface::ClearMessage()
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
       theMessageReceiver->ClearMessage();
 }
@@ -526,6 +424,7 @@ void MessageInterface::ClearMessage()
 //------------------------------------------------------------------------------
 std::string MessageInterface::GetQueuedMessage()
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
       return theMessageReceiver->GetMessage();
    else
@@ -541,6 +440,7 @@ std::string MessageInterface::GetQueuedMessage()
 //------------------------------------------------------------------------------
 void MessageInterface::PutMessage(const std::string &msg)
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
       theMessageReceiver->PutMessage(msg);
 }
@@ -554,41 +454,16 @@ void MessageInterface::PutMessage(const std::string &msg)
 //------------------------------------------------------------------------------
 void MessageInterface::PutMessage(const char *format, ...)
 {
+   std::string msg;
+   va_list args;
+   va_start(args, format);
+   bool formatted = FormatMessage(msg, format, args);
+   va_end(args);
+
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
-   {
-      int     ret;
-      size_t  size;
-      va_list args;
-      char    *msgBuffer = NULL;
-      std::string msgStr("*** WARNING *** Cannot allocate enough memory to show the message.\n");
-      
-      // msg is vsprintf format
-      // actual max message length is MAX_MESSAGE_LENGTH
-      size = strlen(format) + MAX_MESSAGE_LENGTH;
-      //LogMessage("strlen(format)=%d, size=%d\n", strlen(format), size);
-      
-      if( (msgBuffer = (char *)malloc(size)) != NULL )
-      {
-         for (size_t i=0; i<size; i++)
-            msgBuffer[i] = '\0';
-         va_start(args, format);
-         ret = vsprintf(msgBuffer, format, args);
-         if (ret < 0) // vsprintf failed
-            theMessageReceiver->PutMessage("Unable to complete messaging\n");
-         else
-         {
-            va_end(args);
-            theMessageReceiver->PutMessage(std::string(msgBuffer));
-         }
-      }
-      else
-      {
-         theMessageReceiver->PutMessage(msgStr);
-      }
-      
-//      theMessageReceiver->LogMessage(std::string(msgBuffer));
-      free(msgBuffer);
-   }
+      theMessageReceiver->PutMessage(formatted ? msg :
+            std::string("Unable to complete messaging\n"));
 }
 
 //------------------------------------------------------------------------------
@@ -600,6 +475,7 @@ void MessageInterface::PutMessage(const char *format, ...)
 //------------------------------------------------------------------------------
 void MessageInterface::ClearMessageQueue()
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver != NULL)
       theMessageReceiver->ClearMessageQueue();
 }
@@ -615,6 +491,7 @@ void MessageInterface::ClearMessageQueue()
 //------------------------------------------------------------------------------
 void MessageInterface::SetEchoMode(bool echo)
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver)
       theMessageReceiver->SetEchoMode(echo);
 }
@@ -631,6 +508,38 @@ void MessageInterface::SetEchoMode(bool echo)
 //------------------------------------------------------------------------------
 void MessageInterface::ToggleConsolePrinting(bool printToCon)
 {
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
    if (theMessageReceiver)
       theMessageReceiver->ToggleConsolePrinting(printToCon);
 }
+
+//------------------------------------------------------------------------------
+// void FlushLog()
+//------------------------------------------------------------------------------
+/**
+ * Tells the MessageReceiver to write any buffered log text to the log file
+ */
+//------------------------------------------------------------------------------
+void MessageInterface::FlushLog()
+{
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
+   if (theMessageReceiver)
+      theMessageReceiver->FlushLog();
+}
+
+//------------------------------------------------------------------------------
+// bool AcceptsMessages()
+//------------------------------------------------------------------------------
+/**
+ * Checks that the MessageReceiver displays or logs messages before they are
+ * formatted
+ *
+ * @return true if a message sent now would be used
+ */
+//------------------------------------------------------------------------------
+bool MessageInterface::AcceptsMessages()
+{
+   std::lock_guard<std::recursive_mutex> lock(ReceiverMutex());
+   return (theMessageReceiver != NULL) &&
+          theMessageReceiver->AcceptsMessages();
+}
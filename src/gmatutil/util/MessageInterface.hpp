@@ -41,6 +41,10 @@
  * messages to the user.  MessageInterface passes these messages to an 
  * implementation specific class rerived from teh abstract  MessageReceiver 
  * class.  Display to the user is handled in the derived MessageReceiver.
+ *
+ * The methods may be called from any thread.  Messages are formatted in a
+ * buffer owned by the calling thread, and the calls into the MessageReceiver
+ * are serialized.
  */
 class GMATUTIL_API MessageInterface
 {
@@ -74,10 +78,13 @@ public:
    static void ClearMessageQueue();
    static void SetEchoMode(bool echo);
    static void ToggleConsolePrinting(bool printToCon);
+   static void FlushLog();
    
 private:
    static MessageReceiver  *theMessageReceiver;
    
+   static bool AcceptsMessages();
+   
    MessageInterface();
    virtual ~MessageInterface();
 };
@@ -67,6 +67,35 @@ void MessageReceiver::ToggleConsolePrinting(bool printToCon)
 {
 }
 
+//------------------------------------------------------------------------------
+// bool AcceptsMessages()
+//------------------------------------------------------------------------------
+/**
+ * Reports whether shown and logged messages are currently used
+ *
+ * MessageInterface checks this before formatting a message, so receivers that
+ * can be silenced skip the formatting cost.
+ *
+ * @return true, the default
+ */
+//------------------------------------------------------------------------------
+bool MessageReceiver::AcceptsMessages()
+{
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void FlushLog()
+//------------------------------------------------------------------------------
+/**
+ * Writes any buffered log text to the log file, for derived classes that
+ * buffer it
+ */
+//------------------------------------------------------------------------------
+void MessageReceiver::FlushLog()
+{
+}
+
 //---------------------------------
 //  protected methods
 //---------------------------------
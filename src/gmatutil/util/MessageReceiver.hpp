@@ -82,6 +82,8 @@ public:
    virtual void ClearMessageQueue() = 0;
    virtual void SetEchoMode(bool echo);
    virtual void ToggleConsolePrinting(bool printToCon);
+   virtual bool AcceptsMessages();
+   virtual void FlushLog();
    
 protected:
       
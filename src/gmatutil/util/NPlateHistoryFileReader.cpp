@@ -31,6 +31,7 @@
 #include <fstream>
 #include <sstream>
 #include <cstdlib>
+#include <algorithm>
 #include "FileUtil.hpp"
 #include "FileTypes.hpp"
 #include "NPlateHistoryFileReader.hpp"
@@ -67,7 +68,9 @@ NPlateHistoryFileReader::NPlateHistoryFileReader() :
    startTime     (0.0),
    csName        ("FixedToBody"),
    interpolator  ("Linear"),
-   isInitialized (false)
+   isInitialized (false),
+   lastInterval  (0),
+   lastFaceNormalValid (false)
 {
 }
 
@@ -79,19 +82,14 @@ NPlateHistoryFileReader::NPlateHistoryFileReader(const NPlateHistoryFileReader &
    startTime     (copy.startTime),
    csName        (copy.csName),
    interpolator  (copy.interpolator),
-   isInitialized (copy.isInitialized)
+   isInitialized (copy.isInitialized),
+   nplateData    (copy.nplateData),
+   lastInterval  (0),
+   lastFaceNormalValid (false)
 {
 #ifdef DEBUG_INITIALIZE_NPLATE_HISTORY_FILE
    MessageInterface::ShowMessage("NPlateHistoryFileReader::NPlateHistoryFileReader(copy = <%p>)\n", copy);
 #endif
-   for (unsigned int ii = 0; ii < copy.nplateData.size(); ii++)
-   {
-      Real timeOffset = copy.nplateData.at(ii)->timeOffset;
-      Real az         = copy.nplateData.at(ii)->azimuth;
-      Real el         = copy.nplateData.at(ii)->elevation;
-      Rvector3 r = copy.nplateData.at(ii)->r;
-      AddDataRecord(timeOffset, az, el, r[0], r[1], r[2]);
-   }
 #ifdef DEBUG_INITIALIZE_NPLATE_HISTORY_FILE
    MessageInterface::ShowMessage("NPlateHistoryFileReader::NPlateHistoryFileReader(copy) end\n");
 #endif
@@ -110,18 +108,9 @@ NPlateHistoryFileReader& NPlateHistoryFileReader::operator=(const NPlateHistoryF
    csName        = copy.csName;
    interpolator  = copy.interpolator;
    isInitialized = copy.isInitialized;
-
-   for (unsigned int ii = 0; ii < nplateData.size(); ii++)
-      delete nplateData[ii];
-   nplateData.clear();
-   for (unsigned int ii = 0; ii < copy.nplateData.size(); ii++)
-   {
-      Real timeOffset = copy.nplateData.at(ii)->timeOffset;
-      Real az      = copy.nplateData.at(ii)->azimuth;
-      Real el      = copy.nplateData.at(ii)->elevation;
-      Rvector3 r   = copy.nplateData.at(ii)->r;
-      AddDataRecord(timeOffset, az, el, r[0], r[1], r[2]);
-   }
+   nplateData    = copy.nplateData;
+   lastInterval  = 0;
+   lastFaceNormalValid = false;
 
    return *this;
 }
@@ -131,9 +120,6 @@ NPlateHistoryFileReader& NPlateHistoryFileReader::operator=(const NPlateHistoryF
 // -----------------------------------------------------------------------------
 NPlateHistoryFileReader::~NPlateHistoryFileReader()
 {
-   for (unsigned int ii = 0; ii < nplateData.size(); ii++)
-      delete nplateData[ii];
-   nplateData.clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -186,6 +172,7 @@ void NPlateHistoryFileReader::Initialize()
 bool NPlateHistoryFileReader::SetFile(const std::string &theNPlateHistoryFile)
 {
    nplateFile = theNPlateHistoryFile;
+   lastFaceNormalValid = false;
    return true;
 }
 
@@ -214,13 +201,13 @@ bool NPlateHistoryFileReader::SetInterpolator(const std::string &theInterpolator
 // -----------------------------------------------------------------------------
 bool NPlateHistoryFileReader::AddDataRecord(Real timeOffset, Real az, Real el, Real x, Real y, Real z)
 {
-   NPlateDataRecord *newNPlate = new NPlateDataRecord(timeOffset, az, el, x, y, z);
    #ifdef DEBUG_ADD_DATA_RECORD
       MessageInterface::ShowMessage(
          "Adding data record:   time offset = %12.10f   azimuth = %12.10f and elevation = %12.10f  r = [%12.10f  %12.10f  %12.10f]\n",
             timeOffset, az, el, x, y, z);
    #endif
-   nplateData.push_back(newNPlate);
+   nplateData.push_back(NPlateDataRecord(timeOffset, az, el, x, y, z));
+   lastFaceNormalValid = false;
    return true;
 }
 
@@ -369,9 +356,9 @@ bool NPlateHistoryFileReader::ParseFile()
 
          if (nplateData.size() > 0)
          {
-            if (timeOffset < nplateData[nplateData.size() - 1]->timeOffset)
+            if (timeOffset < nplateData[nplateData.size() - 1].timeOffset)
                throw UtilityException("Error: In NPlate face normal history file '" + nplateFile + "', time offset in line '" + lineStr.str() + "' is not in ascending order.\n");
-            else if (timeOffset == nplateData[nplateData.size() - 1]->timeOffset)
+            else if (timeOffset == nplateData[nplateData.size() - 1].timeOffset)
                throw UtilityException("Error: In NPlate face normal history file '" + nplateFile + "', it has a duplicated time offset in line '" + lineStr.str() + "'.\n");
          }
 
@@ -408,17 +395,21 @@ bool NPlateHistoryFileReader::ParseFile()
 
 // -----------------------------------------------------------------------------
 // Rvector3 Interpolate(Real x, Real x1, real x2, Rvector3 y1, Rvector3 y2)
-// Performs bilinear interpolation of the input values.
+// Performs bilinear interpolation of the input values.  The plate models ask
+// for the normal several times at each epoch, so the last result is reused.
 // -----------------------------------------------------------------------------
 Rvector3 NPlateHistoryFileReader::GetFaceNormal(GmatTime t)
 {
+   if (lastFaceNormalValid && (t == lastEpoch))
+      return lastFaceNormal;
+
    // Specify face normal unit vector at time t
    Real offset = GmatTime(t - startTime).GetTimeInSec();
    
-   if ((offset < nplateData[0]->timeOffset) || (offset > nplateData[nplateData.size() - 1]->timeOffset))
+   if ((offset < nplateData[0].timeOffset) || (offset > nplateData[nplateData.size() - 1].timeOffset))
    {
-      GmatTime t1 = startTime.SubtractSeconds(-nplateData[0]->timeOffset);
-      GmatTime t2 = startTime.SubtractSeconds(-nplateData[nplateData.size() - 1]->timeOffset);
+      GmatTime t1 = startTime.SubtractSeconds(-nplateData[0].timeOffset);
+      GmatTime t2 = startTime.SubtractSeconds(-nplateData[nplateData.size() - 1].timeOffset);
       MessageInterface::ShowMessage("Time t = %s  is out side of time range [%s  %s]\n", t.ToString().c_str(), t1.ToString().c_str(), t2.ToString().c_str());
       std::stringstream ss;
       ss << "Error: Cannot get face normal unit vector. Time " << t.ToString() << " is out of range";
@@ -426,29 +417,67 @@ Rvector3 NPlateHistoryFileReader::GetFaceNormal(GmatTime t)
    }
 
    Rvector3 result;
-   for (Integer i = 0; i < nplateData.size()-1; ++i)
+   if (nplateData.size() > 1)
    {
-      if ((nplateData[i]->timeOffset <= offset) && (offset <= nplateData[i + 1]->timeOffset))
-      {
-         // specify face normal unit vector 
-         Real factor = (offset - nplateData[i]->timeOffset) / (nplateData[i+1]->timeOffset - nplateData[i]->timeOffset);
-         //Real dAz = (nplateData[i+1]->azimuth - nplateData[i]->azimuth)*factor;
-         //Real dEl = (nplateData[i+1]->elevation - nplateData[i]->elevation)*factor;
-         //Real az = nplateData[i]->azimuth + dAz;
-         //Real el = nplateData[i]->elevation + dEl;
-         Real az = AzimuthInterpolation(nplateData[i]->azimuth, nplateData[i + 1]->azimuth, factor);
-         Real el = ElevationInterpolation(nplateData[i]->elevation, nplateData[i + 1]->elevation, factor);
-         result[0] = GmatMathUtil::Cos(el)*GmatMathUtil::Cos(az);     // x value
-         result[1] = GmatMathUtil::Cos(el)*GmatMathUtil::Sin(az);     // y value
-         result[2] = GmatMathUtil::Sin(el);     // z value
-         break;
-      }
+      Integer i = FindInterval(offset);
+      const NPlateDataRecord &rec1 = nplateData[i];
+      const NPlateDataRecord &rec2 = nplateData[i + 1];
+
+      // specify face normal unit vector 
+      Real factor = (offset - rec1.timeOffset) / (rec2.timeOffset - rec1.timeOffset);
+      Real az = AzimuthInterpolation(rec1.azimuth, rec2.azimuth, factor);
+      Real el = ElevationInterpolation(rec1.elevation, rec2.elevation, factor);
+      Real cosEl = GmatMathUtil::Cos(el);
+      result[0] = cosEl*GmatMathUtil::Cos(az);     // x value
+      result[1] = cosEl*GmatMathUtil::Sin(az);     // y value
+      result[2] = GmatMathUtil::Sin(el);     // z value
    }
 
+   lastEpoch           = t;
+   lastFaceNormal      = result;
+   lastFaceNormalValid = true;
+
    return result;
 }
 
 
+// -----------------------------------------------------------------------------
+// Integer FindInterval(Real offset)
+// Finds the first interval [t(i), t(i+1)] that contains the offset, checking
+// the last interval used and the one after it before a binary search.  The
+// offset must be inside the data span, and there must be at least 2 records.
+// -----------------------------------------------------------------------------
+Integer NPlateHistoryFileReader::FindInterval(Real offset)
+{
+   Integer last = (Integer)nplateData.size() - 2;
+
+   // An offset on a record time belongs to the interval that ends there
+   for (Integer i = lastInterval; (i <= lastInterval + 1) && (i <= last); ++i)
+   {
+      if ((offset <= nplateData[i + 1].timeOffset) &&
+          ((offset > nplateData[i].timeOffset) ||
+           ((i == 0) && (offset == nplateData[0].timeOffset))))
+      {
+         lastInterval = i;
+         return i;
+      }
+   }
+
+   std::vector<NPlateDataRecord>::const_iterator j =
+         std::lower_bound(nplateData.begin(), nplateData.end(), offset,
+               [](const NPlateDataRecord &rec, Real value)
+               { return rec.timeOffset < value; });
+
+   Integer i = (Integer)(j - nplateData.begin()) - 1;
+   if (i < 0)
+      i = 0;
+   if (i > last)
+      i = last;
+
+   lastInterval = i;
+   return i;
+}
+
 
 Real NPlateHistoryFileReader::AzimuthInterpolation(Real angle1, Real angle2, Real factor)
 {
@@ -108,13 +108,23 @@ protected:
    std::string interpolator;
    /// Has the file been read and the data stored and validated?
    bool        isInitialized;
-   // Store a vector of record pointers
-   std::vector<NPlateDataRecord*>   nplateData;
+   // Store the records contiguously, in time order
+   std::vector<NPlateDataRecord>    nplateData;
+   /// Index of the interval used for the last lookup
+   Integer     lastInterval;
+   /// Epoch of the last face normal returned
+   GmatTime    lastEpoch;
+   /// The last face normal returned
+   Rvector3    lastFaceNormal;
+   /// Flag indicating that lastEpoch and lastFaceNormal are set
+   bool        lastFaceNormalValid;
 
    /// Create a new record and add it to the data store
    virtual bool     AddDataRecord(Real timeOffset, Real az, Real el, Real x, Real y, Real z);
    /// Parse the file, validate, and store the data
    virtual bool     ParseFile();
+   /// Find the interval containing a time offset
+   Integer          FindInterval(Real offset);
 
 private:
    Real             AzimuthInterpolation(Real angle1, Real angle2, Real factor);
@@ -33,6 +33,9 @@
 #include "NumericJacobian.hpp"
 #include "StringUtil.hpp"
 #include "UtilityException.hpp"
+#include <atomic>
+#include <exception>
+#include <thread>
 
 //#define DEBUG_JACOBIAN_EVAL
 
@@ -60,7 +63,8 @@ NumericJacobian::NumericJacobian() :
    refineCurrCol(false),
    refineColIdx(0),
    tmpfac(0),
-   delVal(0)
+   delVal(0),
+   complexStep(false)
 {
 
 }
@@ -89,9 +93,10 @@ NumericJacobian::NumericJacobian(const NumericJacobian &copy) :
    refineCurrCol(copy.refineCurrCol),
    refineColIdx(copy.refineColIdx),
    tmpfac(copy.tmpfac),
-   delVal(copy.delVal)
+   delVal(copy.delVal),
+   complexStep(copy.complexStep)
 {
-
+   SetSparsity(copy.sparsity);
 }
 
 //------------------------------------------------------------------------------
@@ -120,6 +125,8 @@ NumericJacobian& NumericJacobian::operator=(const NumericJacobian &copy)
    refineColIdx = copy.refineColIdx;
    tmpfac = copy.tmpfac;
    delVal = copy.delVal;
+   SetSparsity(copy.sparsity);
+   complexStep = copy.complexStep;
 
    return *this;
 }
@@ -350,6 +357,222 @@ Rvector NumericJacobian::GetWorkingStorage()
    return fac;
 }
 
+//------------------------------------------------------------------------------
+// void SetSparsity(const Rmatrix &pattern)
+//------------------------------------------------------------------------------
+/**
+* Sets the nonzero pattern of the Jacobian used by ComputeJacobian().  Columns
+* that have no nonzero row in common are perturbed together, so a sparse
+* Jacobian takes fewer function evaluations than it has columns.
+*
+* @param pattern nF x ny matrix, nonzero where a function value depends on a
+*                variable; an empty matrix treats the Jacobian as full
+*/
+//------------------------------------------------------------------------------
+void NumericJacobian::SetSparsity(const Rmatrix &pattern)
+{
+   if (pattern.GetNumRows() > 0 && pattern.GetNumColumns() > 0)
+   {
+      sparsity.SetSize(pattern.GetNumRows(), pattern.GetNumColumns());
+      sparsity = pattern;
+   }
+   else
+      sparsity.SetSize(0, 0);
+}
+
+//------------------------------------------------------------------------------
+// void UseComplexStep(bool useIt)
+//------------------------------------------------------------------------------
+/**
+* Selects complex-step differentiation in ComputeJacobian().  A complex step
+* has no subtractive cancellation, so the Jacobian is accurate to the working
+* precision with one evaluation per column group and no refinement.  It is
+* used only when every function passed to ComputeJacobian() supports it;
+* otherwise the forward differences are taken.
+*
+* @param useIt True to use complex steps where they are supported
+*/
+//------------------------------------------------------------------------------
+void NumericJacobian::UseComplexStep(bool useIt)
+{
+   complexStep = useIt;
+}
+
+//------------------------------------------------------------------------------
+// void ComputeJacobian(const std::vector<Function*> &functions,
+//                      Integer threadCount)
+//------------------------------------------------------------------------------
+/**
+* Computes the Jacobian by calling the functions directly, instead of stepping
+* the caller through the state machine.  The perturbations, the Jacobian and
+* the refinement match those of the state machine; the perturbed columns (or
+* column groups) and the refined columns are independent, and are evaluated
+* on up to one thread per function.
+*
+* SetInitialValues() must be called first.  On return the state is FINISHED,
+* and GetJacobian() and GetWorkingStorage() return the results.
+*
+* @param functions   Clones of the function, one per thread; the first one is
+*                    used on the calling thread
+* @param threadCount Number of threads to use; 0 uses one per hardware thread.
+*                    No more threads than functions are used.
+*/
+//------------------------------------------------------------------------------
+void NumericJacobian::ComputeJacobian(const std::vector<Function*> &functions,
+                                      Integer threadCount)
+{
+   if (functions.empty())
+      throw UtilityException("No functions were provided to the numeric "
+         "Jacobian calculation.\n");
+   for (UnsignedInt i = 0; i < functions.size(); ++i)
+   {
+      if (functions[i] == NULL)
+         throw UtilityException("A NULL function was provided to the "
+            "numeric Jacobian calculation.\n");
+   }
+
+   CheckInitialParams();
+   if ((sparsity.GetNumRows() > 0) &&
+       ((sparsity.GetNumRows() != nF) || (sparsity.GetNumColumns() != ny)))
+   {
+      throw UtilityException("The sparsity pattern of the numeric Jacobian "
+         "must have a row for each function value and a column for each "
+         "input variable.\n");
+   }
+   BuildColumnGroups();
+   Integer groupCount = (Integer)columnGroups.size();
+
+   bool useComplex = complexStep;
+   for (UnsignedInt i = 0; i < functions.size(); ++i)
+      if (!functions[i]->SupportsComplexStep())
+         useComplex = false;
+
+   if (useComplex)
+   {
+      ComputeComplexStepJacobian(functions, threadCount);
+      currentState = FINISHED;
+      return;
+   }
+
+   currentState = PERTURBING;
+   stepSizeCalculated = false;
+   CalculatePerturbations();
+
+   // Forward differences, one evaluation per column group
+   std::vector<Rvector> groupValues(groupCount);
+   RunColumnTasks(functions, groupCount, threadCount,
+      [&](Function *function, Integer group)
+      {
+         Rvector vars = y;
+         const IntegerArray &cols = columnGroups[group];
+         for (UnsignedInt k = 0; k < cols.size(); ++k)
+            vars(cols[k]) = y(cols[k]) + del(cols[k]);
+         Rvector values = function->Evaluate(vars);
+         if (values.GetSize() != nF)
+            throw UtilityException("The number of function values returned "
+               "to the numeric Jacobian does not match the number of "
+               "initial function values.\n");
+         groupValues[group] = values;
+      });
+   nfevals += groupCount;
+   nfcalls += groupCount;
+
+   // A group evaluation gives each of its columns the values in the rows
+   // that column can change; the other rows are the nominal values
+   for (Integer group = 0; group < groupCount; ++group)
+   {
+      const IntegerArray &cols = columnGroups[group];
+      for (UnsignedInt k = 0; k < cols.size(); ++k)
+      {
+         for (Integer i = 0; i < nF; ++i)
+         {
+            if ((sparsity.GetNumRows() == 0) || (sparsity(i, cols[k]) != 0.0))
+               Fdel(i, cols[k]) = groupValues[group](i);
+            else
+               Fdel(i, cols[k]) = Fty(i);
+         }
+      }
+   }
+
+   currentState = CALCULATING;
+   colsToRefine.clear();
+   k1.clear();
+   CalculateJacobian();
+
+   if (refineCols)
+   {
+      currentState = REFINING;
+      PrepareForRefinement();
+
+      IntegerArray cols;
+      RealArray colFacs, colDels;
+      for (Integer j = 0; j < ny; ++j)
+      {
+         Real colFac, colDel;
+         if (colsToRefine.at(j) && k1.at(j) &&
+             RefinementStep(j, colFac, colDel))
+         {
+            cols.push_back(j);
+            colFacs.push_back(colFac);
+            colDels.push_back(colDel);
+         }
+      }
+
+      Integer refineCount = (Integer)cols.size();
+      std::vector<Rvector> colValues(refineCount);
+      RunColumnTasks(functions, refineCount, threadCount,
+         [&](Function *function, Integer idx)
+         {
+            Rvector vars = y;
+            vars(cols[idx]) = y(cols[idx]) + colDels[idx];
+            Rvector values = function->Evaluate(vars);
+            if (values.GetSize() != nF)
+               throw UtilityException("The number of function values "
+                  "returned to the numeric Jacobian does not match the "
+                  "number of initial function values.\n");
+            colValues[idx] = values;
+         });
+      nfevals += refineCount;
+      nfcalls += refineCount;
+
+      for (Integer idx = 0; idx < refineCount; ++idx)
+         RefineColumn(cols[idx], colValues[idx], colFacs[idx], colDels[idx]);
+      refineColIdx = ny;
+      UpdateWorkingStorage();
+   }
+
+   currentState = FINISHED;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumColumnGroups()
+//------------------------------------------------------------------------------
+/**
+* Returns the number of column groups used by the last ComputeJacobian() call
+*
+* @return The number of groups of columns perturbed together
+*/
+//------------------------------------------------------------------------------
+Integer NumericJacobian::GetNumColumnGroups()
+{
+   return (Integer)columnGroups.size();
+}
+
+//------------------------------------------------------------------------------
+// Integer GetFunctionEvaluations()
+//------------------------------------------------------------------------------
+/**
+* Returns the number of function evaluations made by the last
+* ComputeJacobian() call
+*
+* @return The number of evaluations
+*/
+//------------------------------------------------------------------------------
+Integer NumericJacobian::GetFunctionEvaluations()
+{
+   return nfevals;
+}
+
 //------------------------------------------------------------------------------
 // bool CheckInitialParams()
 //------------------------------------------------------------------------------
@@ -658,21 +881,8 @@ void NumericJacobian::PrepareForRefinement()
 //------------------------------------------------------------------------------
 void NumericJacobian::CalcRefinement()
 {
-   if (sqrt(fac(refineColIdx)) < facmax)
-      tmpfac = sqrt(fac(refineColIdx));
-   else
-      tmpfac = facmax;
-   delVal = tmpfac*yscale(refineColIdx);
-   if ((tmpfac != fac(refineColIdx)) && (delVal != 0))
+   if (RefinementStep(refineColIdx, tmpfac, delVal))
    {
-      if (nF == ny)
-      {
-         if (Fty(refineColIdx) >= 0) // keep del pointing into the region
-            delVal = GmatMathUtil::Abs(delVal);
-         else
-            delVal = -GmatMathUtil::Abs(delVal);
-      }
-
       ydel(refineColIdx, 0) = y(refineColIdx) + delVal;
       refineCurrCol = true;
    }
@@ -694,10 +904,98 @@ void NumericJacobian::CalcRefinement()
 void NumericJacobian::RefineJacColumn()
 {
    ydel(refineColIdx, 0) = y(refineColIdx);
-   Rvector fdiff = fdel - Fty;
+   RefineColumn(refineColIdx, fdel, tmpfac, delVal);
+   ++refineColIdx;
+}
+
+//------------------------------------------------------------------------------
+// void UpdateWorkingStorage()
+//------------------------------------------------------------------------------
+/**
+* Change the working storage if current perturbations caused very large or very
+* small changes to function values
+*/
+//------------------------------------------------------------------------------
+void NumericJacobian::UpdateWorkingStorage()
+{
+   for (Integer k = 0; k < colsToRefine.size(); ++k)
+   {
+      // If the difference is small, increase the increment
+      if (colsToRefine.at(k) && !k1.at(k) && (diffMax(k) <= bl*Fscale(k)))
+      {
+         if (10 * fac(k) < facmax)
+            fac(k) = 10 * fac(k);
+         else
+            fac(k) = facmax;
+      }
+
+      // If the difference is large, reduce the increment
+      if (colsToRefine.at(k) && (diffMax(k) > bu*Fscale(k)))
+      {
+         if (0.1*fac(k) > facmin)
+            fac(k) = 0.1*fac(k);
+         else
+            fac(k) = facmin;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// bool RefinementStep(Integer col, Real &colFac, Real &colDel)
+//------------------------------------------------------------------------------
+/**
+* Calculates the larger increment used to refine a column of the Jacobian
+*
+* @param col    The column
+* @param colFac Set to the working storage value for the increment
+* @param colDel Set to the increment
+*
+* @return True if the column is refined with the increment
+*/
+//------------------------------------------------------------------------------
+bool NumericJacobian::RefinementStep(Integer col, Real &colFac, Real &colDel)
+{
+   if (sqrt(fac(col)) < facmax)
+      colFac = sqrt(fac(col));
+   else
+      colFac = facmax;
+   colDel = colFac*yscale(col);
+   if ((colFac != fac(col)) && (colDel != 0))
+   {
+      if (nF == ny)
+      {
+         if (Fty(col) >= 0) // keep del pointing into the region
+            colDel = GmatMathUtil::Abs(colDel);
+         else
+            colDel = -GmatMathUtil::Abs(colDel);
+      }
+      return true;
+   }
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// void RefineColumn(Integer col, const Rvector &colDerivs, Real colFac,
+//                   Real colDel)
+//------------------------------------------------------------------------------
+/**
+* Replaces a column of the Jacobian by the difference taken with the larger
+* increment if that one is more significant, and adjusts the working storage
+* of the column
+*
+* @param col       The column
+* @param colDerivs The function values with the column variable perturbed
+* @param colFac    The working storage value for the increment
+* @param colDel    The increment
+*/
+//------------------------------------------------------------------------------
+void NumericJacobian::RefineColumn(Integer col, const Rvector &colDerivs,
+                                   Real colFac, Real colDel)
+{
+   Rvector fdiff = colDerivs - Fty;
    Rvector tmp(nF);
    for (Integer j = 0; j < nF; ++j)
-      tmp(j) = fdiff(j) / delVal;
+      tmp(j) = fdiff(j) / colDel;
 
    Real diffmax = GmatMathUtil::Abs(fdiff(0));
    Integer rowmax = 0;
@@ -716,22 +1014,22 @@ void NumericJacobian::RefineJacColumn()
       if (GmatMathUtil::Abs(tmp(j)) > tmpNorm)
          tmpNorm = GmatMathUtil::Abs(tmp(j));
    }
-   Real dFdyNorm = GmatMathUtil::Abs(dFdy(0, refineColIdx));
+   Real dFdyNorm = GmatMathUtil::Abs(dFdy(0, col));
    for (Integer j = 1; j < dFdy.GetNumRows(); ++j)
    {
-      if (GmatMathUtil::Abs(dFdy(j, refineColIdx)) > dFdyNorm)
-         dFdyNorm = GmatMathUtil::Abs(dFdy(j, refineColIdx));
+      if (GmatMathUtil::Abs(dFdy(j, col)) > dFdyNorm)
+         dFdyNorm = GmatMathUtil::Abs(dFdy(j, col));
    }
 
 
-   if (tmpfac * tmpNorm >= dFdyNorm)
+   if (colFac * tmpNorm >= dFdyNorm)
    {
       // The new difference is more signification, so
       // use the column computed with this increment
       if (S.GetNumRows() == 0 || S.GetNumColumns() == 0)
       {
          for (Integer j = 0; j < nF; ++j)
-            dFdy(j, refineColIdx) = tmp(j);
+            dFdy(j, col) = tmp(j);
 
 #ifdef DEBUG_JACOBIAN_EVAL
          MessageInterface::ShowMessage("Refined dFdy:\n");
@@ -752,63 +1050,241 @@ void NumericJacobian::RefineJacColumn()
 
    // Adjust fac for the next call to ComputeJacobian
    Real fscale;
-   if (GmatMathUtil::Abs(fdel(rowmax)) > absFty(rowmax))
-      fscale = GmatMathUtil::Abs(fdel(rowmax));
+   if (GmatMathUtil::Abs(colDerivs(rowmax)) > absFty(rowmax))
+      fscale = GmatMathUtil::Abs(colDerivs(rowmax));
    else
       fscale = absFty(rowmax);
 
    if (diffmax <= bl*fscale)
    {
       // The difference is small, so increase the increment
-      if (10 * tmpfac < facmax)
-         fac(refineColIdx) = 10 * tmpfac;
+      if (10 * colFac < facmax)
+         fac(col) = 10 * colFac;
       else
-         fac(refineColIdx) = facmax;
+         fac(col) = facmax;
    }
 
    else if (diffmax > bu*fscale)
    {
       // The difference is large, so reduce the increment
-      if (0.1 * tmpfac > facmin)
-         fac(refineColIdx) = 0.1 * tmpfac;
+      if (0.1 * colFac > facmin)
+         fac(col) = 0.1 * colFac;
       else
-         fac(refineColIdx) = facmin;
+         fac(col) = facmin;
    }
 
    else
-      fac(refineColIdx) = tmpfac;
-
-   ++refineColIdx;
+      fac(col) = colFac;
 }
 
+
 //------------------------------------------------------------------------------
-// void UpdateWorkingStorage()
+// void BuildColumnGroups()
 //------------------------------------------------------------------------------
 /**
-* Change the working storage if current perturbations caused very large or very
-* small changes to function values
+* Groups the columns for ComputeJacobian().  Without a sparsity pattern each
+* column is a group; with one, each column joins the first group that has no
+* nonzero row in common with it.
 */
 //------------------------------------------------------------------------------
-void NumericJacobian::UpdateWorkingStorage()
+void NumericJacobian::BuildColumnGroups()
 {
-   for (Integer k = 0; k < colsToRefine.size(); ++k)
+   columnGroups.clear();
+   if (sparsity.GetNumRows() == 0)
    {
-      // If the difference is small, increase the increment
-      if (colsToRefine.at(k) && !k1.at(k) && (diffMax(k) <= bl*Fscale(k)))
+      for (Integer j = 0; j < ny; ++j)
+         columnGroups.push_back(IntegerArray(1, j));
+      return;
+   }
+
+   // Rows touched by the columns of each group
+   std::vector<BooleanArray> groupRows;
+   for (Integer j = 0; j < ny; ++j)
+   {
+      UnsignedInt group = 0;
+      for (; group < columnGroups.size(); ++group)
       {
-         if (10 * fac(k) < facmax)
-            fac(k) = 10 * fac(k);
-         else
-            fac(k) = facmax;
+         bool overlaps = false;
+         for (Integer i = 0; i < nF && !overlaps; ++i)
+            overlaps = (sparsity(i, j) != 0.0) && groupRows[group][i];
+         if (!overlaps)
+            break;
       }
-
-      // If the difference is large, reduce the increment
-      if (colsToRefine.at(k) && (diffMax(k) > bu*Fscale(k)))
+      if (group == columnGroups.size())
       {
-         if (0.1*fac(k) > facmin)
-            fac(k) = 0.1*fac(k);
-         else
-            fac(k) = facmin;
+         columnGroups.push_back(IntegerArray());
+         groupRows.push_back(BooleanArray(nF, false));
       }
+      columnGroups[group].push_back(j);
+      for (Integer i = 0; i < nF; ++i)
+         if (sparsity(i, j) != 0.0)
+            groupRows[group][i] = true;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void ComputeComplexStepJacobian(const std::vector<Function*> &functions,
+//                                 Integer threadCount)
+//------------------------------------------------------------------------------
+/**
+* Computes the Jacobian with complex steps, dF/dy_j = Im(F(y + ih e_j)) / h,
+* one evaluation per column group.  The working storage is left unchanged.
+*
+* @param functions   Clones of the function, one per thread
+* @param threadCount Number of threads to use; 0 uses one per hardware thread
+*/
+//------------------------------------------------------------------------------
+void NumericJacobian::ComputeComplexStepJacobian(
+      const std::vector<Function*> &functions, Integer threadCount)
+{
+   // The step only has to keep h^2 below the precision of the values
+   RealArray step(ny);
+   for (Integer j = 0; j < ny; ++j)
+      step[j] = 1.0e-20 * GmatMathUtil::Max(1.0, GmatMathUtil::Abs(y(j)));
+
+   Integer groupCount = (Integer)columnGroups.size();
+   dFdy.SetSize(nF, ny);
+   RunColumnTasks(functions, groupCount, threadCount,
+      [&](Function *function, Integer group)
+      {
+         ComplexArray vars(ny), values;
+         for (Integer j = 0; j < ny; ++j)
+            vars[j] = y(j);
+         const IntegerArray &cols = columnGroups[group];
+         for (UnsignedInt k = 0; k < cols.size(); ++k)
+            vars[cols[k]] = std::complex<Real>(y(cols[k]), step[cols[k]]);
+         function->EvaluateComplex(vars, values);
+         if ((Integer)values.size() != nF)
+            throw UtilityException("The number of function values returned "
+               "to the numeric Jacobian does not match the number of "
+               "initial function values.\n");
+         // Each group writes only its own columns
+         for (UnsignedInt k = 0; k < cols.size(); ++k)
+         {
+            for (Integer i = 0; i < nF; ++i)
+            {
+               if ((sparsity.GetNumRows() == 0) ||
+                   (sparsity(i, cols[k]) != 0.0))
+                  dFdy(i, cols[k]) = values[i].imag() / step[cols[k]];
+               else
+                  dFdy(i, cols[k]) = 0.0;
+            }
+         }
+      });
+   nfevals = groupCount;
+   nfcalls = groupCount;
+}
+
+//------------------------------------------------------------------------------
+// void RunColumnTasks(const std::vector<Function*> &functions,
+//       Integer taskCount, Integer threadCount,
+//       const std::function<void(Function*, Integer)> &task)
+//------------------------------------------------------------------------------
+/**
+* Runs independent evaluation tasks on a set of threads, the calling one
+* included, each thread using its own function.
+*
+* An exception thrown by a task is rethrown on the calling thread once all of
+* the tasks are done; when several tasks throw, the exception of the first
+* one is rethrown.
+*
+* @param functions   Clones of the function, one per thread
+* @param taskCount   Number of tasks
+* @param threadCount Number of threads to use; 0 uses one per hardware thread
+* @param task        The task, called with a function and the task index
+*/
+//------------------------------------------------------------------------------
+void NumericJacobian::RunColumnTasks(const std::vector<Function*> &functions,
+      Integer taskCount, Integer threadCount,
+      const std::function<void(Function*, Integer)> &task)
+{
+   if (threadCount <= 0)
+      threadCount = (Integer)std::thread::hardware_concurrency();
+   if (threadCount > (Integer)functions.size())
+      threadCount = (Integer)functions.size();
+   if (threadCount > taskCount)
+      threadCount = taskCount;
+
+   if (threadCount <= 1)
+   {
+      for (Integer i = 0; i < taskCount; ++i)
+         task(functions[0], i);
+      return;
    }
+
+   std::vector<std::exception_ptr> errors(taskCount);
+   std::atomic<Integer> next(0);
+   auto worker = [&](Function *function)
+   {
+      for (Integer i = next++; i < taskCount; i = next++)
+      {
+         try
+         {
+            task(function, i);
+         }
+         catch (...)
+         {
+            errors[i] = std::current_exception();
+         }
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (Integer i = 1; i < threadCount; ++i)
+      threads.push_back(std::thread(worker, functions[i]));
+   worker(functions[0]);
+   for (UnsignedInt i = 0; i < threads.size(); ++i)
+      threads[i].join();
+
+   for (Integer i = 0; i < taskCount; ++i)
+      if (errors[i])
+         std::rethrow_exception(errors[i]);
+}
+
+//------------------------------------------------------------------------------
+// NumericJacobian::Function
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// ~Function()
+//------------------------------------------------------------------------------
+/**
+* Destructor
+*/
+//------------------------------------------------------------------------------
+NumericJacobian::Function::~Function()
+{
+}
+
+//------------------------------------------------------------------------------
+// bool SupportsComplexStep()
+//------------------------------------------------------------------------------
+/**
+* Tells whether EvaluateComplex() is implemented.  Functions that override
+* EvaluateComplex() must be analytic in each variable, with no abs, min, max
+* or branches on the values, for the complex step to give the derivatives.
+*
+* @return False; functions that implement EvaluateComplex() return true
+*/
+//------------------------------------------------------------------------------
+bool NumericJacobian::Function::SupportsComplexStep()
+{
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// void EvaluateComplex(const ComplexArray &vars, ComplexArray &values)
+//------------------------------------------------------------------------------
+/**
+* Evaluates the function at complex arguments
+*
+* @param vars   The variables
+* @param values Set to the function values
+*/
+//------------------------------------------------------------------------------
+void NumericJacobian::Function::EvaluateComplex(const ComplexArray &vars,
+                                                ComplexArray &values)
+{
+   throw UtilityException("Complex-step evaluation is not supported by the "
+      "function used in the numeric Jacobian calculation.\n");
 }
@@ -37,10 +37,33 @@
 #include "Rmatrix.hpp"
 #include "GmatConstants.hpp"
 #include "MessageInterface.hpp"
+#include <complex>
+#include <functional>
+#include <vector>
 
 class GMATUTIL_API NumericJacobian
 {
 public:
+   /// Complex valued vector used for complex-step differentiation
+   typedef std::vector<std::complex<Real> > ComplexArray;
+
+   /**
+    * Vector function differentiated by ComputeJacobian().  ComputeJacobian
+    * runs each object on its own thread, so the objects passed to it must be
+    * independent clones of the caller's function.
+    */
+   class GMATUTIL_API Function
+   {
+   public:
+      virtual ~Function();
+
+      /// Returns the function values at vars
+      virtual Rvector Evaluate(const Rvector &vars) = 0;
+      virtual bool    SupportsComplexStep();
+      virtual void    EvaluateComplex(const ComplexArray &vars,
+                                      ComplexArray &values);
+   };
+
    enum JacState
    {
       INITIALIZING,
@@ -63,6 +86,13 @@ public:
    Rmatrix GetJacobian();
    Rvector GetWorkingStorage();
 
+   void SetSparsity(const Rmatrix &pattern);
+   void UseComplexStep(bool useIt);
+   void ComputeJacobian(const std::vector<Function*> &functions,
+                        Integer threadCount = 0);
+   Integer GetNumColumnGroups();
+   Integer GetFunctionEvaluations();
+
 protected:
    bool CheckInitialParams();
    void CalculatePerturbations();
@@ -72,6 +102,15 @@ protected:
    void CalcRefinement();
    void RefineJacColumn();
    void UpdateWorkingStorage();
+   bool RefinementStep(Integer col, Real &colFac, Real &colDel);
+   void RefineColumn(Integer col, const Rvector &colDerivs, Real colFac,
+                     Real colDel);
+   void BuildColumnGroups();
+   void ComputeComplexStepJacobian(const std::vector<Function*> &functions,
+                                   Integer threadCount);
+   void RunColumnTasks(const std::vector<Function*> &functions,
+                       Integer taskCount, Integer threadCount,
+                       const std::function<void(Function*, Integer)> &task);
 
    JacState currentState;
    Rvector currentDerivs;
@@ -116,5 +155,13 @@ protected:
    Real bu;
    Real facmin;
    Real facmax;
+
+   // Parameters for the callback driven (ComputeJacobian) evaluation
+   /// Nonzero pattern of the Jacobian, nF x ny; empty for a full Jacobian
+   Rmatrix sparsity;
+   /// Use complex steps when all of the functions support them
+   bool complexStep;
+   /// Columns perturbed together, which share no nonzero row
+   std::vector<IntegerArray> columnGroups;
 };
 #endif
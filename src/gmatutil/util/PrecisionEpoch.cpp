@@ -0,0 +1,208 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                PrecisionEpoch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the conversions of the fixed point epoch type
+ */
+//------------------------------------------------------------------------------
+
+#include "PrecisionEpoch.hpp"
+#include "GmatTime.hpp"
+#include "GmatConstants.hpp"
+#include <cmath>
+
+constexpr long long PrecisionEpoch::NS_PER_SEC;
+constexpr long long PrecisionEpoch::NS_PER_DAY;
+
+
+namespace
+{
+   //---------------------------------------------------------------------------
+   // PrecisionEpoch FromDaysAndSeconds(long long days, long long sec,
+   //       Real fracSec)
+   //---------------------------------------------------------------------------
+   /**
+    * Builds an epoch from whole days, whole seconds and a fraction of a second
+    *
+    * @param days    Whole days
+    * @param sec     Whole seconds, of any sign and size
+    * @param fracSec Seconds to add, of any sign and size
+    *
+    * @return The epoch
+    */
+   //---------------------------------------------------------------------------
+   PrecisionEpoch FromDaysAndSeconds(long long days, long long sec,
+         Real fracSec)
+   {
+      Real wholeSec = std::floor(fracSec);
+      fracSec -= wholeSec;
+      sec += (long long)wholeSec;
+
+      long long dayCarry = sec / 86400LL - (sec % 86400LL < 0 ? 1 : 0);
+      sec -= dayCarry * 86400LL;
+
+      Real fracNs = fracSec * 1.0e9;
+      Real wholeNs = std::floor(fracNs);
+
+      return PrecisionEpoch(days + dayCarry,
+            sec * PrecisionEpoch::NS_PER_SEC + (long long)wholeNs,
+            fracNs - wholeNs);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// PrecisionEpoch(const GmatTime &gt)
+//------------------------------------------------------------------------------
+/**
+ * Builds the epoch matching a GmatTime
+ *
+ * @param gt The GmatTime
+ */
+//------------------------------------------------------------------------------
+PrecisionEpoch::PrecisionEpoch(const GmatTime &gt)
+{
+   *this = FromDaysAndSeconds(gt.GetDays(), gt.GetSec(), gt.GetFracSec());
+}
+
+
+//------------------------------------------------------------------------------
+// PrecisionEpoch FromMjd(const Real mjd)
+//------------------------------------------------------------------------------
+/**
+ * Builds an epoch from a modified Julian date
+ *
+ * @param mjd The date
+ *
+ * @return The epoch
+ */
+//------------------------------------------------------------------------------
+PrecisionEpoch PrecisionEpoch::FromMjd(const Real mjd)
+{
+   Real wholeDays = std::floor(mjd);
+   return FromDaysAndSeconds((long long)wholeDays, 0,
+         (mjd - wholeDays) * GmatTimeConstants::SECS_PER_DAY);
+}
+
+
+//------------------------------------------------------------------------------
+// PrecisionEpoch FromSeconds(const Real sec)
+//------------------------------------------------------------------------------
+/**
+ * Builds a time span from a number of seconds
+ *
+ * @param sec The number of seconds
+ *
+ * @return The time span
+ */
+//------------------------------------------------------------------------------
+PrecisionEpoch PrecisionEpoch::FromSeconds(const Real sec)
+{
+   Real wholeDays = std::floor(sec / GmatTimeConstants::SECS_PER_DAY);
+   Real remainder = sec - wholeDays * GmatTimeConstants::SECS_PER_DAY;
+   Real wholeSec = std::floor(remainder);
+
+   return FromDaysAndSeconds((long long)wholeDays, (long long)wholeSec,
+         remainder - wholeSec);
+}
+
+
+//------------------------------------------------------------------------------
+// GmatTime ToGmatTime() const
+//------------------------------------------------------------------------------
+/**
+ * Converts the epoch to a GmatTime
+ *
+ * @return The GmatTime, with its seconds in [0, 86400) and its fraction of a
+ *         second in [0, 1)
+ */
+//------------------------------------------------------------------------------
+GmatTime PrecisionEpoch::ToGmatTime() const
+{
+   long long day = days;
+   long long sec = nanoseconds / NS_PER_SEC;
+   Real fracSec = ((Real)(nanoseconds % NS_PER_SEC) + fraction) / 1.0e9;
+
+   // The division can round up to a whole second
+   if (fracSec >= 1.0)
+   {
+      fracSec = 0.0;
+      if (++sec == 86400)
+      {
+         sec = 0;
+         ++day;
+      }
+   }
+
+   GmatTime gt;
+   gt.SetDays((long)day);
+   gt.SetSec((long)sec);
+   gt.SetFracSec(fracSec);
+   return gt;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatEpoch GetMjd() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the epoch as a modified Julian date
+ *
+ * @return The date
+ */
+//------------------------------------------------------------------------------
+GmatEpoch PrecisionEpoch::GetMjd() const
+{
+   return days + ((Real)nanoseconds + fraction) / (Real)NS_PER_DAY;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetTimeInSec() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the epoch, or time span, in seconds
+ *
+ * @return The number of seconds
+ */
+//------------------------------------------------------------------------------
+Real PrecisionEpoch::GetTimeInSec() const
+{
+   Real wholeSec = (Real)(days * 86400LL + nanoseconds / NS_PER_SEC);
+   return wholeSec + ((Real)(nanoseconds % NS_PER_SEC) + fraction) / 1.0e9;
+}
+
+
+//------------------------------------------------------------------------------
+// PrecisionEpoch& AddSeconds(const Real sec)
+//------------------------------------------------------------------------------
+/**
+ * Adds a number of seconds to the epoch
+ *
+ * @param sec The number of seconds
+ *
+ * @return This epoch
+ */
+//------------------------------------------------------------------------------
+PrecisionEpoch& PrecisionEpoch::AddSeconds(const Real sec)
+{
+   *this += FromSeconds(sec);
+   return *this;
+}
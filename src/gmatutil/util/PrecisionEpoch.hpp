@@ -0,0 +1,201 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                PrecisionEpoch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Fixed point epoch type for high precision time arithmetic
+ */
+//------------------------------------------------------------------------------
+#ifndef PrecisionEpoch_hpp
+#define PrecisionEpoch_hpp
+
+#include "utildefs.hpp"
+#include <type_traits>
+
+class GmatTime;
+
+/**
+ * A high precision epoch, or time span, stored in fixed point
+ *
+ * The value is kept as whole days, whole nanoseconds of the day in the range
+ * [0, NS_PER_DAY) and a fraction of a nanosecond in the range [0, 1).  The
+ * integer parts add and subtract exactly, so sums only carry between the parts
+ * once, and comparisons are made part by part.
+ *
+ * Unlike GmatTime the class has no virtual methods and is trivially copyable,
+ * and its arithmetic is constexpr.  Conversions to and from GmatTime and Real
+ * values are explicit, so code that passes epochs along a chain of calls
+ * converts once at each end.
+ */
+class GMATUTIL_API PrecisionEpoch
+{
+public:
+   /// Nanoseconds in a second
+   static constexpr long long NS_PER_SEC = 1000000000LL;
+   /// Nanoseconds in a day
+   static constexpr long long NS_PER_DAY = 86400LL * NS_PER_SEC;
+
+   /// Default epoch, matching the GmatTime default of A.1 MJD 21545
+   constexpr PrecisionEpoch() :
+      days        (21545),
+      nanoseconds (0),
+      fraction    (0.0)
+   {
+   }
+
+   /**
+    * Builds an epoch from its parts
+    *
+    * @param inDays        Whole days
+    * @param inNanoseconds Nanoseconds, in the range (-NS_PER_DAY, 2 NS_PER_DAY)
+    * @param inFraction    Fraction of a nanosecond, in the range (-1, 2)
+    */
+   constexpr PrecisionEpoch(long long inDays, long long inNanoseconds,
+         Real inFraction = 0.0) :
+      days        (inDays + DayCarry(inNanoseconds +
+                                     NanosecondCarry(inFraction))),
+      nanoseconds (inNanoseconds + NanosecondCarry(inFraction) -
+                   DayCarry(inNanoseconds + NanosecondCarry(inFraction)) *
+                   NS_PER_DAY),
+      fraction    (WrapFraction(inFraction))
+   {
+   }
+
+   explicit PrecisionEpoch(const GmatTime &gt);
+
+   static PrecisionEpoch   FromMjd(const Real mjd);
+   static PrecisionEpoch   FromSeconds(const Real sec);
+
+   /**
+    * Builds a time span from a nanosecond count
+    *
+    * @param ns The number of nanoseconds
+    *
+    * @return The time span
+    */
+   static constexpr PrecisionEpoch FromNanoseconds(long long ns)
+   {
+      return PrecisionEpoch(ns / NS_PER_DAY - (ns % NS_PER_DAY < 0 ? 1 : 0),
+            ns % NS_PER_DAY + (ns % NS_PER_DAY < 0 ? NS_PER_DAY : 0));
+   }
+
+   GmatTime                ToGmatTime() const;
+   GmatEpoch               GetMjd() const;
+   Real                    GetTimeInSec() const;
+
+   constexpr long long     GetDays() const { return days; }
+   constexpr long long     GetNanoseconds() const { return nanoseconds; }
+   constexpr Real          GetFraction() const { return fraction; }
+
+   // Arithmetic operators
+   constexpr PrecisionEpoch operator+(const PrecisionEpoch &pe) const
+   {
+      return PrecisionEpoch(days + pe.days, nanoseconds + pe.nanoseconds,
+            fraction + pe.fraction);
+   }
+
+   constexpr PrecisionEpoch operator-(const PrecisionEpoch &pe) const
+   {
+      return PrecisionEpoch(days - pe.days, nanoseconds - pe.nanoseconds,
+            fraction - pe.fraction);
+   }
+
+   PrecisionEpoch& operator+=(const PrecisionEpoch &pe)
+   {
+      *this = *this + pe;
+      return *this;
+   }
+
+   PrecisionEpoch& operator-=(const PrecisionEpoch &pe)
+   {
+      *this = *this - pe;
+      return *this;
+   }
+
+   PrecisionEpoch&         AddSeconds(const Real sec);
+
+   // Logic operators
+   constexpr bool operator==(const PrecisionEpoch &pe) const
+   {
+      return (days == pe.days) && (nanoseconds == pe.nanoseconds) &&
+             (fraction == pe.fraction);
+   }
+
+   constexpr bool operator!=(const PrecisionEpoch &pe) const
+   {
+      return !(*this == pe);
+   }
+
+   constexpr bool operator<(const PrecisionEpoch &pe) const
+   {
+      return (days != pe.days) ? (days < pe.days) :
+             (nanoseconds != pe.nanoseconds) ?
+                   (nanoseconds < pe.nanoseconds) :
+             (fraction < pe.fraction);
+   }
+
+   constexpr bool operator>(const PrecisionEpoch &pe) const
+   {
+      return pe < *this;
+   }
+
+   constexpr bool operator<=(const PrecisionEpoch &pe) const
+   {
+      return !(pe < *this);
+   }
+
+   constexpr bool operator>=(const PrecisionEpoch &pe) const
+   {
+      return !(*this < pe);
+   }
+
+private:
+   /// Whole days
+   long long   days;
+   /// Nanoseconds of the day, in [0, NS_PER_DAY)
+   long long   nanoseconds;
+   /// Fraction of a nanosecond, in [0, 1)
+   Real        fraction;
+
+   /// Returns the nanosecond carried out of a fraction in (-1, 2)
+   static constexpr long long NanosecondCarry(Real frac)
+   {
+      // A tiny negative fraction rounds up to 1.0 when wrapped; it is kept
+      // in the current nanosecond instead
+      return (frac >= 1.0) ? 1 : ((frac < 0.0) && (frac + 1.0 < 1.0)) ? -1 : 0;
+   }
+
+   /// Returns a fraction in (-1, 2) wrapped into [0, 1)
+   static constexpr Real WrapFraction(Real frac)
+   {
+      return (frac >= 1.0) ? frac - 1.0 :
+             (frac < 0.0) ? ((frac + 1.0 < 1.0) ? frac + 1.0 : 0.0) : frac;
+   }
+
+   /// Returns the day carried out of nanoseconds in [-NS_PER_DAY-1, 2 NS_PER_DAY]
+   static constexpr long long DayCarry(long long ns)
+   {
+      return (ns >= NS_PER_DAY) ? 1 : (ns < 0) ? -1 : 0;
+   }
+};
+
+static_assert(std::is_trivially_copyable<PrecisionEpoch>::value,
+      "PrecisionEpoch must be trivially copyable");
+
+#endif // PrecisionEpoch_hpp
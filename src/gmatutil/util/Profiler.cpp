@@ -0,0 +1,424 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  Profiler
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the scoped timer profiler for mission runs
+ */
+//------------------------------------------------------------------------------
+
+#include "Profiler.hpp"
+#include <chrono>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <fstream>
+#include <algorithm>
+#include <cstdio>
+
+//---------------------------------
+//  static data
+//---------------------------------
+bool        Profiler::enabled = false;
+std::string Profiler::reportFile;
+
+
+namespace
+{
+   typedef std::chrono::steady_clock ProfileClock;
+
+   /// One node of a call tree
+   struct ProfileNode
+   {
+      std::string                      category;
+      std::string                      label;
+      Integer                          parent;
+      /// Child node indices; scopes have few children, so they are searched
+      std::vector<Integer>             children;
+      Integer                          calls;
+      Real                             seconds;
+   };
+
+   /// The call tree of one thread; node 0 is the root
+   struct ThreadProfile
+   {
+      std::vector<ProfileNode>               nodes;
+      Integer                                current;
+      std::vector<ProfileClock::time_point>  starts;
+   };
+
+   /// Calls and times summed over a category and label
+   struct ProfileTotal
+   {
+      Integer  calls;
+      Real     seconds;
+      Real     selfSeconds;
+   };
+
+   std::mutex& ProfilesMutex()
+   {
+      static std::mutex profilesMutex;
+      return profilesMutex;
+   }
+
+   /// Every thread's tree, in the order the threads first profiled
+   std::vector<ThreadProfile*>& Profiles()
+   {
+      static std::vector<ThreadProfile*> profiles;
+      return profiles;
+   }
+
+   thread_local ThreadProfile *threadProfile = NULL;
+
+   //---------------------------------------------------------------------------
+   // void ClearTree(ThreadProfile &profile)
+   //---------------------------------------------------------------------------
+   void ClearTree(ThreadProfile &profile)
+   {
+      profile.nodes.resize(1);
+      profile.nodes[0].category = "";
+      profile.nodes[0].label    = "GMAT";
+      profile.nodes[0].parent   = -1;
+      profile.nodes[0].children.clear();
+      profile.nodes[0].calls    = 0;
+      profile.nodes[0].seconds  = 0.0;
+      profile.current = 0;
+      profile.starts.clear();
+   }
+
+   //---------------------------------------------------------------------------
+   // ThreadProfile& GetThreadProfile()
+   //---------------------------------------------------------------------------
+   ThreadProfile& GetThreadProfile()
+   {
+      if (threadProfile == NULL)
+      {
+         threadProfile = new ThreadProfile;
+         ClearTree(*threadProfile);
+
+         std::lock_guard<std::mutex> lock(ProfilesMutex());
+         Profiles().push_back(threadProfile);
+      }
+      return *threadProfile;
+   }
+
+   //---------------------------------------------------------------------------
+   // std::string NodeName(const ProfileNode &node)
+   //---------------------------------------------------------------------------
+   std::string NodeName(const ProfileNode &node)
+   {
+      if (node.category == "")
+         return node.label;
+      return node.category + ": " + node.label;
+   }
+
+   //---------------------------------------------------------------------------
+   // Real SelfSeconds(const ThreadProfile &profile, Integer index)
+   //---------------------------------------------------------------------------
+   Real SelfSeconds(const ThreadProfile &profile, Integer index)
+   {
+      const ProfileNode &node = profile.nodes[index];
+      Real self = node.seconds;
+      for (UnsignedInt i = 0; i < node.children.size(); ++i)
+         self -= profile.nodes[node.children[i]].seconds;
+      return (self > 0.0 ? self : 0.0);
+   }
+
+   //---------------------------------------------------------------------------
+   // void WriteNode(std::ofstream &report, const ThreadProfile &profile,
+   //       Integer index, Integer depth, Real runSeconds, std::string stack,
+   //       std::map<std::string, Real> &folded,
+   //       std::map<std::string, ProfileTotal> &totals,
+   //       std::vector<std::string> &open)
+   //---------------------------------------------------------------------------
+   /**
+    * Writes a node and its children to the call tree, and adds them to the
+    * folded stacks and the totals
+    *
+    * Children are written in order of decreasing time.  A node inside a node
+    * with the same name, like a command in a branch command, adds its calls
+    * and self time to the totals but not its time, which the outer node holds.
+    */
+   //---------------------------------------------------------------------------
+   void WriteNode(std::ofstream &report, const ThreadProfile &profile,
+         Integer index, Integer depth, Real runSeconds, std::string stack,
+         std::map<std::string, Real> &folded,
+         std::map<std::string, ProfileTotal> &totals,
+         std::vector<std::string> &open)
+   {
+      const ProfileNode &node = profile.nodes[index];
+      std::string name = NodeName(node);
+      Real self = SelfSeconds(profile, index);
+
+      if (depth > 0)
+      {
+         char line[128];
+         snprintf(line, sizeof(line), "%10d %12.6f %12.6f %6.1f%%  ",
+               node.calls, node.seconds, self,
+               (runSeconds > 0.0 ? 100.0 * node.seconds / runSeconds : 0.0));
+         report << line << std::string(2 * (depth - 1), ' ') << name << "\n";
+
+         ProfileTotal &total = totals[node.category + "\t" + node.label];
+         total.calls += node.calls;
+         total.selfSeconds += self;
+         if (std::find(open.begin(), open.end(), name) == open.end())
+            total.seconds += node.seconds;
+      }
+
+      // Folded stack frames are separated by semicolons
+      std::string frame = name;
+      std::replace(frame.begin(), frame.end(), ';', ',');
+      stack += (stack == "" ? "" : ";") + frame;
+      if (self > 0.0)
+         folded[stack] += self;
+
+      std::vector<std::pair<Real, Integer> > children;
+      for (UnsignedInt i = 0; i < node.children.size(); ++i)
+         children.push_back(std::make_pair(
+               -profile.nodes[node.children[i]].seconds, node.children[i]));
+      std::sort(children.begin(), children.end());
+
+      open.push_back(name);
+      for (UnsignedInt i = 0; i < children.size(); ++i)
+         WriteNode(report, profile, children[i].second, depth + 1, runSeconds,
+               stack, folded, totals, open);
+      open.pop_back();
+   }
+}
+
+
+//---------------------------------
+//  public static methods
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// void SetEnabled(bool flag)
+//------------------------------------------------------------------------------
+/**
+ * Turns profiling on or off
+ *
+ * @param flag true to time the instrumented scopes
+ */
+//------------------------------------------------------------------------------
+void Profiler::SetEnabled(bool flag)
+{
+   enabled = flag;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetReportFile(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Sets the file that the end of run report is written to
+ *
+ * @param fileName The file; an empty name selects GmatProfile.txt
+ */
+//------------------------------------------------------------------------------
+void Profiler::SetReportFile(const std::string &fileName)
+{
+   reportFile = fileName;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetReportFile()
+//------------------------------------------------------------------------------
+std::string Profiler::GetReportFile()
+{
+   return (reportFile == "" ? "GmatProfile.txt" : reportFile);
+}
+
+
+//------------------------------------------------------------------------------
+// void Begin(const char *category, const std::string &label)
+//------------------------------------------------------------------------------
+/**
+ * Starts timing a scope on the calling thread
+ *
+ * @param category The kind of scope, such as "Command"
+ * @param label    The scope within the category, such as the command type
+ */
+//------------------------------------------------------------------------------
+void Profiler::Begin(const char *category, const std::string &label)
+{
+   ThreadProfile &profile = GetThreadProfile();
+
+   std::vector<Integer> &children = profile.nodes[profile.current].children;
+   Integer index = -1;
+   for (UnsignedInt i = 0; i < children.size(); ++i)
+   {
+      const ProfileNode &child = profile.nodes[children[i]];
+      if ((child.label == label) && (child.category == category))
+      {
+         index = children[i];
+         break;
+      }
+   }
+
+   if (index < 0)
+   {
+      index = (Integer)profile.nodes.size();
+      children.push_back(index);
+
+      ProfileNode node;
+      node.category = category;
+      node.label    = label;
+      node.parent   = profile.current;
+      node.calls    = 0;
+      node.seconds  = 0.0;
+      profile.nodes.push_back(node);
+   }
+
+   profile.current = index;
+   profile.starts.push_back(ProfileClock::now());
+}
+
+
+//------------------------------------------------------------------------------
+// void End()
+//------------------------------------------------------------------------------
+/**
+ * Stops timing the innermost scope on the calling thread
+ */
+//------------------------------------------------------------------------------
+void Profiler::End()
+{
+   ThreadProfile &profile = GetThreadProfile();
+   if (profile.starts.empty())
+      return;
+
+   ProfileNode &node = profile.nodes[profile.current];
+   node.seconds += std::chrono::duration<Real>(ProfileClock::now() -
+         profile.starts.back()).count();
+   ++node.calls;
+
+   profile.starts.pop_back();
+   profile.current = node.parent;
+}
+
+
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * Clears the call trees; called before a run, while no scope is open
+ */
+//------------------------------------------------------------------------------
+void Profiler::Reset()
+{
+   std::lock_guard<std::mutex> lock(ProfilesMutex());
+   for (UnsignedInt i = 0; i < Profiles().size(); ++i)
+      ClearTree(*Profiles()[i]);
+}
+
+
+//------------------------------------------------------------------------------
+// bool WriteReport(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Writes the profile of the run
+ *
+ * The report holds the call tree of each thread that profiled, with the calls,
+ * total and self seconds of each node, followed by the calls and times for
+ * each category and label, so that the evaluation counts of each force are
+ * listed together.  The folded stacks, with self time in microseconds, are
+ * written next to the report with the extension .folded.
+ *
+ * @param fileName The report file
+ *
+ * @return true if the files were written
+ */
+//------------------------------------------------------------------------------
+bool Profiler::WriteReport(const std::string &fileName)
+{
+   std::ofstream report(fileName.c_str());
+   std::string foldedName = fileName;
+   std::string::size_type dot = foldedName.find_last_of('.');
+   std::string::size_type slash = foldedName.find_last_of("/\\");
+   if ((dot != std::string::npos) &&
+       ((slash == std::string::npos) || (dot > slash)))
+      foldedName = foldedName.substr(0, dot);
+   std::ofstream foldedFile((foldedName + ".folded").c_str());
+   if (!report.is_open() || !foldedFile.is_open())
+      return false;
+
+   std::map<std::string, Real> folded;
+   std::map<std::string, ProfileTotal> totals;
+
+   report << "GMAT profile\n";
+   std::lock_guard<std::mutex> lock(ProfilesMutex());
+   for (UnsignedInt t = 0; t < Profiles().size(); ++t)
+   {
+      const ThreadProfile &profile = *Profiles()[t];
+      if (profile.nodes.size() < 2)
+         continue;
+
+      Real runSeconds = 0.0;
+      const ProfileNode &root = profile.nodes[0];
+      for (UnsignedInt i = 0; i < root.children.size(); ++i)
+         runSeconds += profile.nodes[root.children[i]].seconds;
+
+      report << "\nCall tree, thread " << t << "\n"
+             << "     Calls      Total s       Self s  % run  Scope\n";
+      std::vector<std::string> open;
+      WriteNode(report, profile, 0, 0, runSeconds, "", folded, totals, open);
+   }
+
+   report << "\nTotals by scope\n"
+          << "Category     Calls      Total s       Self s  Scope\n";
+   for (std::map<std::string, ProfileTotal>::iterator i = totals.begin();
+        i != totals.end(); ++i)
+   {
+      std::string::size_type tab = i->first.find('\t');
+      char line[128];
+      snprintf(line, sizeof(line), "%-12s %10d %12.6f %12.6f  ",
+            i->first.substr(0, tab).c_str(), i->second.calls,
+            i->second.seconds, i->second.selfSeconds);
+      report << line << i->first.substr(tab + 1) << "\n";
+   }
+
+   for (std::map<std::string, Real>::iterator i = folded.begin();
+        i != folded.end(); ++i)
+      foldedFile << i->first << " " << (long long)(i->second * 1.0e6 + 0.5)
+                 << "\n";
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string MakeLabel(const std::string &typeName, const std::string &name)
+//------------------------------------------------------------------------------
+/**
+ * Builds a scope label from an object's type and name
+ *
+ * @param typeName The object type
+ * @param name     The object name, which may be empty
+ *
+ * @return The label
+ */
+//------------------------------------------------------------------------------
+std::string Profiler::MakeLabel(const std::string &typeName,
+      const std::string &name)
+{
+   if (name == "")
+      return typeName;
+   return typeName + " " + name;
+}
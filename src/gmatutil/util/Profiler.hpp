@@ -0,0 +1,112 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  Profiler
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Declares the scoped timer profiler for mission runs
+ */
+//------------------------------------------------------------------------------
+#ifndef Profiler_hpp
+#define Profiler_hpp
+
+#include "utildefs.hpp"
+
+/**
+ * Collects a call tree of timed scopes for a mission run.
+ *
+ * Code is instrumented with ProfileScope objects, each with a category such as
+ * "Command" or "Force" and a label.  While profiling is off a scope costs one
+ * flag test.  While it is on, each scope adds its call count and time to a node
+ * of the calling thread's call tree.  WriteReport() writes the tree, a table of
+ * the calls and times for each category and label, and a folded stack file
+ * that flame graph tools read.
+ *
+ * Profiling is turned on with PROFILING = ON in the startup file, or with the
+ * GmatConsole --profile option.
+ */
+class GMATUTIL_API Profiler
+{
+public:
+   /// Returns true when scopes are timed
+   static bool          IsEnabled() { return enabled; }
+   static void          SetEnabled(bool flag);
+
+   static void          SetReportFile(const std::string &fileName);
+   static std::string   GetReportFile();
+
+   static void          Begin(const char *category, const std::string &label);
+   static void          End();
+
+   static void          Reset();
+   static bool          WriteReport(const std::string &fileName);
+
+   static std::string   MakeLabel(const std::string &typeName,
+                                  const std::string &name);
+
+private:
+   /// Flag tested by every scope
+   static bool          enabled;
+   /// The report file name, set from the command line
+   static std::string   reportFile;
+
+   Profiler();
+};
+
+
+/**
+ * Times the enclosing block when profiling is enabled.
+ *
+ * Scopes can be built from a label, or from an object with GetTypeName() and
+ * GetName() methods whose label is only built when profiling is on.
+ */
+class ProfileScope
+{
+public:
+   ProfileScope(const char *category, const std::string &label) :
+      active   (Profiler::IsEnabled())
+   {
+      if (active)
+         Profiler::Begin(category, label);
+   }
+
+   template <class T>
+   ProfileScope(const char *category, const T *object) :
+      active   (Profiler::IsEnabled())
+   {
+      if (active)
+         Profiler::Begin(category, Profiler::MakeLabel(object->GetTypeName(),
+               object->GetName()));
+   }
+
+   ~ProfileScope()
+   {
+      if (active)
+         Profiler::End();
+   }
+
+private:
+   /// Set when the scope was started, so it ends even if profiling is toggled
+   bool active;
+
+   // Not copyable
+   ProfileScope(const ProfileScope&);
+   ProfileScope& operator=(const ProfileScope&);
+};
+
+#endif // Profiler_hpp
@@ -34,6 +34,12 @@
 #include "MessageInterface.hpp"
 #include <time.h>
 
+namespace
+{
+   /// The stream selected for the calling thread, or NULL for the generator
+   thread_local RandomStream *selectedStream = NULL;
+}
+
 //#define DEBUG_CONSTRUCTOR
 
 //---------------------------------
@@ -81,6 +87,7 @@ RandomNumber::~RandomNumber()
 void RandomNumber::SetSeed(unsigned int s)
 {
    generator.seed(s);
+   ResetStreams(s);
 }
 
 
@@ -95,6 +102,7 @@ void RandomNumber::SetClockSeed()
 {
    unsigned int clockSeed = time(NULL);
    generator.seed(clockSeed);
+   ResetStreams(clockSeed);
 }
 
 
@@ -107,6 +115,9 @@ void RandomNumber::SetClockSeed()
 //------------------------------------------------------------------------------
 Real RandomNumber::Gaussian()
 {
+   if (selectedStream)
+      return selectedStream->Gaussian();
+
    std::normal_distribution<double> Gauss(0.0, 1.0);
    return Gauss(generator);
 }
@@ -125,6 +136,9 @@ Real RandomNumber::Gaussian()
 //------------------------------------------------------------------------------
 Real RandomNumber::Gaussian(const Real mean, const Real stdev)
 {
+   if (selectedStream)
+      return selectedStream->Gaussian(mean, stdev);
+
    std::normal_distribution<double> Gauss(mean, stdev);
    return Gauss(generator);
 }
@@ -143,6 +157,12 @@ Real RandomNumber::Gaussian(const Real mean, const Real stdev)
 //------------------------------------------------------------------------------
 void RandomNumber::GaussianArray(Real *myArray, const Integer size)
 {
+   if (selectedStream)
+   {
+      selectedStream->GaussianArray(myArray, size);
+      return;
+   }
+
    for (Integer i = 0; i < size; i++)
    {
       myArray[i] = Gaussian();
@@ -166,6 +186,12 @@ void RandomNumber::GaussianArray(Real *myArray, const Integer size)
 void RandomNumber::GaussianArray(Real *myArray, const Integer size,
                                  const Real mean, const Real stdev)
 {
+   if (selectedStream)
+   {
+      selectedStream->GaussianArray(myArray, size, mean, stdev);
+      return;
+   }
+
    for (Integer i = 0; i < size; i++)
    {
       myArray[i] = Gaussian(mean, stdev);
@@ -185,6 +211,9 @@ void RandomNumber::GaussianArray(Real *myArray, const Integer size,
 //------------------------------------------------------------------------------
 Real RandomNumber::Uniform()
 {
+   if (selectedStream)
+      return selectedStream->Uniform();
+
    Real rn;
    do
    {
@@ -227,6 +256,12 @@ Real RandomNumber::Uniform(const Real a, const Real b)
 //------------------------------------------------------------------------------
 void RandomNumber::UniformArray(Real* myArray, const Integer size)
 {
+   if (selectedStream)
+   {
+      selectedStream->UniformArray(myArray, size);
+      return;
+   }
+
    for (Integer i = 0; i < size; ++i)
       myArray[i] = Uniform();
 }
@@ -254,6 +289,86 @@ void RandomNumber::UniformArray(Real *myArray, const Integer size,
       myArray[i] = a + (b - a)*myArray[i];
 }
 
+
+//------------------------------------------------------------------------------
+//  RandomStream GetStream(UnsignedInt streamId) const
+//------------------------------------------------------------------------------
+/**
+ *  Returns a counter based stream keyed by the stream seed and an id.
+ *
+ *  The stream belongs to the caller and can be used on any thread; streams
+ *  with different ids are independent.  Giving each trial or worker thread of
+ *  a Monte Carlo run its own id makes the results independent of how the
+ *  trials are scheduled.
+ *
+ *  @param <streamId> The stream id
+ *  @return The stream, positioned at its start
+ */
+//------------------------------------------------------------------------------
+RandomStream RandomNumber::GetStream(UnsignedInt streamId) const
+{
+   return RandomStream(streamSeed, streamId);
+}
+
+
+//------------------------------------------------------------------------------
+//  void ResetStreams(unsigned int s)
+//------------------------------------------------------------------------------
+/**
+ *  Sets the stream seed and returns the streams used by SelectStream() to
+ *  their start.  SetSeed() and SetClockSeed() call this with their seed.
+ *
+ *  No thread may have a stream selected when this is called.
+ *
+ *  @param <s> The stream seed
+ */
+//------------------------------------------------------------------------------
+void RandomNumber::ResetStreams(unsigned int s)
+{
+   std::lock_guard<std::mutex> lock(streamMutex);
+   streamSeed = s;
+   streams.clear();
+   selectedStream = NULL;
+}
+
+
+//------------------------------------------------------------------------------
+//  void SelectStream(UnsignedInt streamId)
+//------------------------------------------------------------------------------
+/**
+ *  Draws the calling thread's deviates from a counter based stream until
+ *  ReleaseStream() is called.
+ *
+ *  The stream keeps its position between selections, so the deviates drawn
+ *  for an id depend only on the calls made while it is selected.  Each id
+ *  should be selected by one thread at a time.
+ *
+ *  @param <streamId> The stream id
+ */
+//------------------------------------------------------------------------------
+void RandomNumber::SelectStream(UnsignedInt streamId)
+{
+   std::lock_guard<std::mutex> lock(streamMutex);
+   std::map<UnsignedInt, RandomStream>::iterator i = streams.find(streamId);
+   if (i == streams.end())
+      i = streams.insert(std::make_pair(streamId,
+            RandomStream(streamSeed, streamId))).first;
+   selectedStream = &(i->second);
+}
+
+
+//------------------------------------------------------------------------------
+//  void ReleaseStream()
+//------------------------------------------------------------------------------
+/**
+ *  Returns the calling thread to the shared generator.
+ */
+//------------------------------------------------------------------------------
+void RandomNumber::ReleaseStream()
+{
+   selectedStream = NULL;
+}
+
 //---------------------------------
 // priviate methods
 //---------------------------------
@@ -272,7 +387,8 @@ RandomNumber::RandomNumber()
    #endif
 
    std::random_device rd;
-   generator.seed(rd());
+   streamSeed = rd();
+   generator.seed(streamSeed);
    
    std::uniform_real_distribution<>::param_type whiteParams(0.0, 1.0);
    white.param(whiteParams);
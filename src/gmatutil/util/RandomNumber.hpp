@@ -33,7 +33,10 @@
 #define _RandomNumber_hpp
 
 #include "utildefs.hpp"
+#include "RandomStream.hpp"
 #include <random>                // C++11 feature
+#include <map>
+#include <mutex>
 
 class GMATUTIL_API RandomNumber
 {
@@ -58,12 +61,24 @@ public:
    void UniformArray(Real *myArray, const Integer size,
        const Real a, const Real b);
 
+   // Counter based streams keyed by (stream seed, stream id)
+   RandomStream GetStream(UnsignedInt streamId) const;
+   void ResetStreams(unsigned int s);
+   void SelectStream(UnsignedInt streamId);
+   void ReleaseStream();
+
 private:
    /// The random number generator
    std::mt19937 generator;
    //std::default_random_engine generator;
    /// The white noise provider
    std::uniform_real_distribution<> white;
+   /// Key of the counter based streams
+   unsigned int streamSeed;
+   /// The streams used by SelectStream(), by id
+   std::map<UnsignedInt, RandomStream> streams;
+   /// Guards the stream map
+   std::mutex streamMutex;
    
 	static RandomNumber *theInstance;
    
@@ -0,0 +1,450 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              RandomStream
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the counter based random number stream
+ */
+//------------------------------------------------------------------------------
+
+#include "RandomStream.hpp"
+#include "GmatConstants.hpp"
+#include <cmath>
+
+namespace
+{
+   // Philox4x32 multipliers and Weyl key increments
+   const std::uint32_t PHILOX_M0 = 0xD2511F53u;
+   const std::uint32_t PHILOX_M1 = 0xCD9E8D57u;
+   const std::uint32_t PHILOX_W0 = 0x9E3779B9u;
+   const std::uint32_t PHILOX_W1 = 0xBB67AE85u;
+   const Integer       PHILOX_ROUNDS = 10;
+
+   // 2^-53, the spacing of the uniform deviates
+   const Real          UNIFORM_SCALE = 1.0 / 9007199254740992.0;
+
+   //---------------------------------------------------------------------------
+   // void Block(uint64_t seed, uint64_t streamId, uint64_t block,
+   //            Real &u0, Real &u1)
+   //---------------------------------------------------------------------------
+   /**
+    * Generates one block and converts it to two 53 bit deviates in [0,1)
+    */
+   //---------------------------------------------------------------------------
+   inline void Block(std::uint64_t seed, std::uint64_t streamId,
+                     std::uint64_t block, Real &u0, Real &u1)
+   {
+      std::uint32_t ctr[4] = {(std::uint32_t)block, (std::uint32_t)(block >> 32),
+            (std::uint32_t)streamId, (std::uint32_t)(streamId >> 32)};
+      std::uint32_t key[2] = {(std::uint32_t)seed, (std::uint32_t)(seed >> 32)};
+      std::uint32_t out[4];
+      RandomStream::Philox(ctr, key, out);
+
+      u0 = ((std::uint64_t)(out[0] >> 5) * 67108864u + (out[1] >> 6)) *
+            UNIFORM_SCALE;
+      u1 = ((std::uint64_t)(out[2] >> 5) * 67108864u + (out[3] >> 6)) *
+            UNIFORM_SCALE;
+   }
+
+   //---------------------------------------------------------------------------
+   // void BoxMuller(Real u0, Real u1, Real &z0, Real &z1)
+   //---------------------------------------------------------------------------
+   inline void BoxMuller(Real u0, Real u1, Real &z0, Real &z1)
+   {
+      // 1 - u0 is in (0,1], so the log is finite
+      Real r = std::sqrt(-2.0 * std::log(1.0 - u0));
+      Real theta = GmatMathConstants::TWO_PI * u1;
+      z0 = r * std::cos(theta);
+      z1 = r * std::sin(theta);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// RandomStream(std::uint64_t seed, std::uint64_t streamId)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param seed     The generator key
+ * @param streamId The stream id
+ */
+//------------------------------------------------------------------------------
+RandomStream::RandomStream(std::uint64_t seed, std::uint64_t streamId) :
+   seed              (seed),
+   streamId          (streamId),
+   block             (0),
+   spareGaussian     (0.0),
+   hasSpareGaussian  (false),
+   spareUniform      (0.0),
+   hasSpareUniform   (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// RandomStream(const RandomStream &rs)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor; the copy continues from the same position
+ */
+//------------------------------------------------------------------------------
+RandomStream::RandomStream(const RandomStream &rs) :
+   seed              (rs.seed),
+   streamId          (rs.streamId),
+   block             (rs.block),
+   spareGaussian     (rs.spareGaussian),
+   hasSpareGaussian  (rs.hasSpareGaussian),
+   spareUniform      (rs.spareUniform),
+   hasSpareUniform   (rs.hasSpareUniform)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// RandomStream& operator=(const RandomStream &rs)
+//------------------------------------------------------------------------------
+RandomStream& RandomStream::operator=(const RandomStream &rs)
+{
+   if (this != &rs)
+   {
+      seed             = rs.seed;
+      streamId         = rs.streamId;
+      block            = rs.block;
+      spareGaussian    = rs.spareGaussian;
+      hasSpareGaussian = rs.hasSpareGaussian;
+      spareUniform     = rs.spareUniform;
+      hasSpareUniform  = rs.hasSpareUniform;
+   }
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// ~RandomStream()
+//------------------------------------------------------------------------------
+RandomStream::~RandomStream()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void Reset(std::uint64_t seed, std::uint64_t streamId)
+//------------------------------------------------------------------------------
+/**
+ * Selects a stream and moves to its start
+ *
+ * @param seed     The generator key
+ * @param streamId The stream id
+ */
+//------------------------------------------------------------------------------
+void RandomStream::Reset(std::uint64_t seed, std::uint64_t streamId)
+{
+   this->seed = seed;
+   this->streamId = streamId;
+   SetPosition(0);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetPosition(std::uint64_t block)
+//------------------------------------------------------------------------------
+/**
+ * Moves to a block of the stream, dropping any spare deviates
+ *
+ * @param block The index of the next block to use
+ */
+//------------------------------------------------------------------------------
+void RandomStream::SetPosition(std::uint64_t block)
+{
+   this->block = block;
+   hasSpareGaussian = false;
+   hasSpareUniform = false;
+}
+
+
+//------------------------------------------------------------------------------
+// std::uint64_t GetPosition() const
+//------------------------------------------------------------------------------
+std::uint64_t RandomStream::GetPosition() const
+{
+   return block;
+}
+
+
+//------------------------------------------------------------------------------
+// std::uint64_t GetSeed() const
+//------------------------------------------------------------------------------
+std::uint64_t RandomStream::GetSeed() const
+{
+   return seed;
+}
+
+
+//------------------------------------------------------------------------------
+// std::uint64_t GetStreamId() const
+//------------------------------------------------------------------------------
+std::uint64_t RandomStream::GetStreamId() const
+{
+   return streamId;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Gaussian()
+//------------------------------------------------------------------------------
+/**
+ * Returns a normally distributed random deviate (zero mean, unit variance)
+ */
+//------------------------------------------------------------------------------
+Real RandomStream::Gaussian()
+{
+   if (hasSpareGaussian)
+   {
+      hasSpareGaussian = false;
+      return spareGaussian;
+   }
+
+   Real z0;
+   NextGaussianPair(z0, spareGaussian);
+   hasSpareGaussian = true;
+   return z0;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Gaussian(const Real mean, const Real stdev)
+//------------------------------------------------------------------------------
+/**
+ * Returns a normally distributed random deviate
+ *
+ * @param mean  Mean of the distribution
+ * @param stdev Standard deviation of the distribution
+ */
+//------------------------------------------------------------------------------
+Real RandomStream::Gaussian(const Real mean, const Real stdev)
+{
+   return mean + stdev * Gaussian();
+}
+
+
+//------------------------------------------------------------------------------
+// void GaussianArray(Real *myArray, const Integer size)
+//------------------------------------------------------------------------------
+/**
+ * Fills an array with normally distributed deviates (zero mean, unit
+ * variance)
+ *
+ * The blocks are generated and transformed in pairs straight into the array,
+ * with no per-value bookkeeping.
+ *
+ * @param myArray The array
+ * @param size    The number of deviates
+ */
+//------------------------------------------------------------------------------
+void RandomStream::GaussianArray(Real *myArray, const Integer size)
+{
+   Integer i = 0;
+   if ((size > 0) && hasSpareGaussian)
+   {
+      myArray[i++] = spareGaussian;
+      hasSpareGaussian = false;
+   }
+
+   for (; i + 1 < size; i += 2)
+      NextGaussianPair(myArray[i], myArray[i+1]);
+
+   if (i < size)
+      myArray[i] = Gaussian();
+}
+
+
+//------------------------------------------------------------------------------
+// void GaussianArray(Real *myArray, const Integer size, const Real mean,
+//                    const Real stdev)
+//------------------------------------------------------------------------------
+/**
+ * Fills an array with normally distributed deviates
+ *
+ * @param myArray The array
+ * @param size    The number of deviates
+ * @param mean    Mean of the distribution
+ * @param stdev   Standard deviation of the distribution
+ */
+//------------------------------------------------------------------------------
+void RandomStream::GaussianArray(Real *myArray, const Integer size,
+                                 const Real mean, const Real stdev)
+{
+   GaussianArray(myArray, size);
+   for (Integer i = 0; i < size; ++i)
+      myArray[i] = mean + stdev * myArray[i];
+}
+
+
+//------------------------------------------------------------------------------
+// Real Uniform()
+//------------------------------------------------------------------------------
+/**
+ * Returns a uniformly distributed random deviate in the range [0,1)
+ */
+//------------------------------------------------------------------------------
+Real RandomStream::Uniform()
+{
+   if (hasSpareUniform)
+   {
+      hasSpareUniform = false;
+      return spareUniform;
+   }
+
+   Real u0;
+   NextUniformPair(u0, spareUniform);
+   hasSpareUniform = true;
+   return u0;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Uniform(const Real a, const Real b)
+//------------------------------------------------------------------------------
+/**
+ * Returns a uniformly distributed random deviate in the range [a,b)
+ */
+//------------------------------------------------------------------------------
+Real RandomStream::Uniform(const Real a, const Real b)
+{
+   return a + (b - a) * Uniform();
+}
+
+
+//------------------------------------------------------------------------------
+// void UniformArray(Real *myArray, const Integer size)
+//------------------------------------------------------------------------------
+/**
+ * Fills an array with uniformly distributed deviates in the range [0,1)
+ *
+ * @param myArray The array
+ * @param size    The number of deviates
+ */
+//------------------------------------------------------------------------------
+void RandomStream::UniformArray(Real *myArray, const Integer size)
+{
+   Integer i = 0;
+   if ((size > 0) && hasSpareUniform)
+   {
+      myArray[i++] = spareUniform;
+      hasSpareUniform = false;
+   }
+
+   for (; i + 1 < size; i += 2)
+      NextUniformPair(myArray[i], myArray[i+1]);
+
+   if (i < size)
+      myArray[i] = Uniform();
+}
+
+
+//------------------------------------------------------------------------------
+// void UniformArray(Real *myArray, const Integer size, const Real a,
+//                   const Real b)
+//------------------------------------------------------------------------------
+/**
+ * Fills an array with uniformly distributed deviates in the range [a,b)
+ *
+ * @param myArray The array
+ * @param size    The number of deviates
+ * @param a       Distribution start
+ * @param b       Distribution end
+ */
+//------------------------------------------------------------------------------
+void RandomStream::UniformArray(Real *myArray, const Integer size,
+                                const Real a, const Real b)
+{
+   UniformArray(myArray, size);
+   for (Integer i = 0; i < size; ++i)
+      myArray[i] = a + (b - a) * myArray[i];
+}
+
+
+//------------------------------------------------------------------------------
+// void Philox(const std::uint32_t counter[4], const std::uint32_t key[2],
+//             std::uint32_t out[4])
+//------------------------------------------------------------------------------
+/**
+ * The Philox4x32-10 bijection of Salmon et al., "Parallel Random Numbers: As
+ * Easy as 1, 2, 3" (SC11)
+ *
+ * @param counter The counter
+ * @param key     The key
+ * @param out     The generated block
+ */
+//------------------------------------------------------------------------------
+void RandomStream::Philox(const std::uint32_t counter[4],
+                          const std::uint32_t key[2], std::uint32_t out[4])
+{
+   std::uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2],
+                 c3 = counter[3];
+   std::uint32_t k0 = key[0], k1 = key[1];
+
+   for (Integer round = 0; round < PHILOX_ROUNDS; ++round)
+   {
+      std::uint64_t p0 = (std::uint64_t)PHILOX_M0 * c0;
+      std::uint64_t p1 = (std::uint64_t)PHILOX_M1 * c2;
+      std::uint32_t n0 = (std::uint32_t)(p1 >> 32) ^ c1 ^ k0;
+      std::uint32_t n2 = (std::uint32_t)(p0 >> 32) ^ c3 ^ k1;
+      c1 = (std::uint32_t)p1;
+      c3 = (std::uint32_t)p0;
+      c0 = n0;
+      c2 = n2;
+      k0 += PHILOX_W0;
+      k1 += PHILOX_W1;
+   }
+
+   out[0] = c0;
+   out[1] = c1;
+   out[2] = c2;
+   out[3] = c3;
+}
+
+
+//------------------------------------------------------------------------------
+// void NextUniformPair(Real &u0, Real &u1)
+//------------------------------------------------------------------------------
+/**
+ * Returns the two uniform deviates of the next block and moves past it
+ */
+//------------------------------------------------------------------------------
+void RandomStream::NextUniformPair(Real &u0, Real &u1)
+{
+   Block(seed, streamId, block++, u0, u1);
+}
+
+
+//------------------------------------------------------------------------------
+// void NextGaussianPair(Real &z0, Real &z1)
+//------------------------------------------------------------------------------
+/**
+ * Returns the two Gaussian deviates of the next block and moves past it
+ */
+//------------------------------------------------------------------------------
+void RandomStream::NextGaussianPair(Real &z0, Real &z1)
+{
+   Real u0, u1;
+   Block(seed, streamId, block++, u0, u1);
+   BoxMuller(u0, u1, z0, z1);
+}
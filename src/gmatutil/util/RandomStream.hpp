@@ -0,0 +1,97 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              RandomStream
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Counter based random number stream
+ */
+//------------------------------------------------------------------------------
+#ifndef RandomStream_hpp
+#define RandomStream_hpp
+
+#include "utildefs.hpp"
+#include <cstdint>
+
+/**
+ * A random number stream built on the Philox4x32-10 counter based generator.
+ *
+ * Block n of the stream is the Philox function of the counter (n, streamId)
+ * under the key seed; nothing else is carried from one block to the next.
+ * Streams with different ids, or different seeds, are independent, and a
+ * stream can be positioned anywhere without generating the blocks before it.
+ * Streams can therefore be handed to threads or processes, one per trial or
+ * per tracking configuration, and give the same numbers however the work is
+ * scheduled.
+ *
+ * Each block gives two uniform deviates, or two Gaussian deviates through the
+ * Box-Muller transform.  The unused second value of a block is kept for the
+ * next call of the same kind, so the numbers drawn from a stream depend only
+ * on the sequence of calls made on it; the array methods give the same values
+ * as repeated scalar calls.
+ */
+class GMATUTIL_API RandomStream
+{
+public:
+   RandomStream(std::uint64_t seed = 0, std::uint64_t streamId = 0);
+   RandomStream(const RandomStream &rs);
+   RandomStream& operator=(const RandomStream &rs);
+   ~RandomStream();
+
+   void           Reset(std::uint64_t seed, std::uint64_t streamId);
+   void           SetPosition(std::uint64_t block);
+   std::uint64_t  GetPosition() const;
+   std::uint64_t  GetSeed() const;
+   std::uint64_t  GetStreamId() const;
+
+   Real           Gaussian();
+   Real           Gaussian(const Real mean, const Real stdev);
+   void           GaussianArray(Real *myArray, const Integer size);
+   void           GaussianArray(Real *myArray, const Integer size,
+                                const Real mean, const Real stdev);
+
+   Real           Uniform();
+   Real           Uniform(const Real a, const Real b);
+   void           UniformArray(Real *myArray, const Integer size);
+   void           UniformArray(Real *myArray, const Integer size,
+                               const Real a, const Real b);
+
+   static void    Philox(const std::uint32_t counter[4],
+                         const std::uint32_t key[2], std::uint32_t out[4]);
+
+protected:
+   /// The generator key
+   std::uint64_t  seed;
+   /// The stream id, the high half of the counter
+   std::uint64_t  streamId;
+   /// Index of the next block, the low half of the counter
+   std::uint64_t  block;
+   /// Second Gaussian deviate of the last block used for Gaussians
+   Real           spareGaussian;
+   /// Flag indicating spareGaussian has not been returned
+   bool           hasSpareGaussian;
+   /// Second uniform deviate of the last block used for uniforms
+   Real           spareUniform;
+   /// Flag indicating spareUniform has not been returned
+   bool           hasSpareUniform;
+
+   void           NextUniformPair(Real &u0, Real &u1);
+   void           NextGaussianPair(Real &z0, Real &z1);
+};
+
+#endif // RandomStream_hpp
@@ -38,6 +38,7 @@
 #include <stdarg.h>
 #include <sstream>
 #include <stdio.h>            // Fix for header rearrangement in gcc 4.4
+#include <utility>            // for std::move()
 #include "MessageInterface.hpp"
 #include "LUFactorization.hpp"
 
@@ -100,6 +101,14 @@ Rmatrix::Rmatrix(const Rmatrix &m)
 {
 }
 
+//------------------------------------------------------------------------------
+//  Rmatrix(Rmatrix &&m)
+//------------------------------------------------------------------------------
+Rmatrix::Rmatrix(Rmatrix &&m)
+   : TableTemplate<Real>(std::move(m)) 
+{
+}
+
 // ekf mod 12/16
 //------------------------------------------------------------------------------
 //  Rmatrix::Identity(unsigned int size)
@@ -241,6 +250,15 @@ const Rmatrix& Rmatrix::operator=(const Rmatrix &m)
    return *this;
 }
 
+//------------------------------------------------------------------------------
+//  const Rmatrix& operator=(Rmatrix &&m)
+//------------------------------------------------------------------------------
+const Rmatrix& Rmatrix::operator=(Rmatrix &&m) 
+{
+   TableTemplate<Real>::operator=(std::move(m));
+   return *this;
+}
+
 
 //------------------------------------------------------------------------------
 //  bool operator==(const Rmatrix &m)const
@@ -981,6 +999,7 @@ Real Rmatrix::Determinant() const
       {
          LUFactorization lu;
          D = lu.Determinant(*this);
+         return D;
 
          // std::string errmsg = "GMAT Determinant method not yet optimized.  ";
          // errmsg += "Currently limited to matrices of size 9x9 or smaller.";
@@ -64,6 +64,7 @@ public:
    Rmatrix(int r, int c);
    Rmatrix(int r, int c, Real a1, ...);
    Rmatrix(const Rmatrix &m);
+   Rmatrix(Rmatrix &&m);
    virtual ~Rmatrix();
    
 // ekf mod 12/16
@@ -77,6 +78,7 @@ public:
    IsOrthonormal(Real accuracyRequired = GmatRealConstants::REAL_EPSILON) const;
    
    const Rmatrix& operator=(const Rmatrix &m);
+   const Rmatrix& operator=(Rmatrix &&m);
    bool operator==(const Rmatrix &m)const;
    bool operator!=(const Rmatrix &m)const;
    
@@ -267,16 +267,9 @@ const Rmatrix33& Rmatrix33::operator-=(const Rmatrix33& m)
 //------------------------------------------------------------------------------
 Rmatrix33 Rmatrix33::operator*(const Rmatrix33& m) const 
 {
-    return
-    Rmatrix33((*this)(0,0)*m(0,0) + (*this)(0,1)*m(1,0) + (*this)(0,2)*m(2,0),
-         (*this)(0,0)*m(0,1) + (*this)(0,1)*m(1,1) + (*this)(0,2)*m(2,1),
-         (*this)(0,0)*m(0,2) + (*this)(0,1)*m(1,2) + (*this)(0,2)*m(2,2),
-         (*this)(1,0)*m(0,0) + (*this)(1,1)*m(1,0) + (*this)(1,2)*m(2,0),
-         (*this)(1,0)*m(0,1) + (*this)(1,1)*m(1,1) + (*this)(1,2)*m(2,1),
-         (*this)(1,0)*m(0,2) + (*this)(1,1)*m(1,2) + (*this)(1,2)*m(2,2),
-         (*this)(2,0)*m(0,0) + (*this)(2,1)*m(1,0) + (*this)(2,2)*m(2,0),
-         (*this)(2,0)*m(0,1) + (*this)(2,1)*m(1,1) + (*this)(2,2)*m(2,1),
-         (*this)(2,0)*m(0,2) + (*this)(2,1)*m(1,2) + (*this)(2,2)*m(2,2));
+    Rmatrix33 prod(false);
+    MultiplyMatrix(elementD, m.elementD, prod.elementD);
+    return prod;
 }
 
 //------------------------------------------------------------------------------
@@ -284,17 +277,10 @@ Rmatrix33 Rmatrix33::operator*(const Rmatrix33& m) const
 //------------------------------------------------------------------------------
 const Rmatrix33& Rmatrix33::operator*=(const Rmatrix33& m) 
 {
-    Rmatrix33& a = *this;  // rename the object on the left
-    
-    *this = Rmatrix33(a(0,0)*m(0,0) + a(0,1)*m(1,0) + a(0,2)*m(2,0),
-             a(0,0)*m(0,1) + a(0,1)*m(1,1) + a(0,2)*m(2,1),
-             a(0,0)*m(0,2) + a(0,1)*m(1,2) + a(0,2)*m(2,2),
-             a(1,0)*m(0,0) + a(1,1)*m(1,0) + a(1,2)*m(2,0),
-             a(1,0)*m(0,1) + a(1,1)*m(1,1) + a(1,2)*m(2,1),
-             a(1,0)*m(0,2) + a(1,1)*m(1,2) + a(1,2)*m(2,2),
-             a(2,0)*m(0,0) + a(2,1)*m(1,0) + a(2,2)*m(2,0),
-             a(2,0)*m(0,1) + a(2,1)*m(1,1) + a(2,2)*m(2,1),
-             a(2,0)*m(0,2) + a(2,1)*m(1,2) + a(2,2)*m(2,2));
+    Real a[9];
+    for (int i = 0; i < 9; ++i)
+       a[i] = elementD[i];
+    MultiplyMatrix(a, m.elementD, elementD);
     return *this;
 }
 
@@ -399,10 +385,9 @@ Rmatrix33 Rmatrix33::operator-() const
 //------------------------------------------------------------------------------
 Rvector3 Rmatrix33::operator*(const Rvector3& v) const 
 {
-    return Rvector3((*this)(0,0)*v(0) + (*this)(0,1)*v(1) + (*this)(0,2)*v(2),
-           (*this)(1,0)*v(0) + (*this)(1,1)*v(1) + (*this)(1,2)*v(2),
-           (*this)(2,0)*v(0) + (*this)(2,1)*v(1) + (*this)(2,2)*v(2));
-           
+    Rvector3 prod;
+    MultiplyVector(elementD, v.elementD, prod.elementD);
+    return prod;
 }
 
 //------------------------------------------------------------------------------
@@ -531,15 +516,9 @@ Rmatrix33 SkewSymmetric(const Rvector3& v)
 //------------------------------------------------------------------------------
 Rmatrix33 TransposeTimesMatrix(const Rmatrix33& m1, const Rmatrix33& m2)
 {
-    return Rmatrix33(m1(0,0)*m2(0,0) + m1(1,0)*m2(1,0) + m1(2,0)*m2(2,0),
-                     m1(0,0)*m2(0,1) + m1(1,0)*m2(1,1) + m1(2,0)*m2(2,1),
-                     m1(0,0)*m2(0,2) + m1(1,0)*m2(1,2) + m1(2,0)*m2(2,2),
-                     m1(0,1)*m2(0,0) + m1(1,1)*m2(1,0) + m1(2,1)*m2(2,0),
-                     m1(0,1)*m2(0,1) + m1(1,1)*m2(1,1) + m1(2,1)*m2(2,1),
-                     m1(0,1)*m2(0,2) + m1(1,1)*m2(1,2) + m1(2,1)*m2(2,2),
-                     m1(0,2)*m2(0,0) + m1(1,2)*m2(1,0) + m1(2,2)*m2(2,0),
-                     m1(0,2)*m2(0,1) + m1(1,2)*m2(1,1) + m1(2,2)*m2(2,1),
-                     m1(0,2)*m2(0,2) + m1(1,2)*m2(1,2) + m1(2,2)*m2(2,2));
+    Rmatrix33 prod(false);
+    Rmatrix33::MultiplyTransposeMatrix(m1.elementD, m2.elementD, prod.elementD);
+    return prod;
 }
 
 
@@ -549,15 +528,9 @@ Rmatrix33 TransposeTimesMatrix(const Rmatrix33& m1, const Rmatrix33& m2)
 //------------------------------------------------------------------------------
 Rmatrix33 MatrixTimesTranspose(const Rmatrix33& m1, const Rmatrix33& m2)
 {
-    return Rmatrix33(m1(0,0)*m2(0,0) + m1(0,1)*m2(0,1) + m1(0,2)*m2(0,2),
-                     m1(0,0)*m2(1,0) + m1(0,1)*m2(1,1) + m1(0,2)*m2(1,2),
-                     m1(0,0)*m2(2,0) + m1(0,1)*m2(2,1) + m1(0,2)*m2(2,2),
-                     m1(1,0)*m2(0,0) + m1(1,1)*m2(0,1) + m1(1,2)*m2(0,2),
-                     m1(1,0)*m2(1,0) + m1(1,1)*m2(1,1) + m1(1,2)*m2(1,2),
-                     m1(1,0)*m2(2,0) + m1(1,1)*m2(2,1) + m1(1,2)*m2(2,2),
-                     m1(2,0)*m2(0,0) + m1(2,1)*m2(0,1) + m1(2,2)*m2(0,2),
-                     m1(2,0)*m2(1,0) + m1(2,1)*m2(1,1) + m1(2,2)*m2(1,2),
-                     m1(2,0)*m2(2,0) + m1(2,1)*m2(2,1) + m1(2,2)*m2(2,2));
+    Rmatrix33 prod(false);
+    Rmatrix33::MultiplyMatrixTranspose(m1.elementD, m2.elementD, prod.elementD);
+    return prod;
 }
 
 
@@ -567,15 +540,12 @@ Rmatrix33 MatrixTimesTranspose(const Rmatrix33& m1, const Rmatrix33& m2)
 //------------------------------------------------------------------------------
 Rmatrix33 TransposeTimesTranspose(const Rmatrix33& m1, const Rmatrix33& m2) 
 {
-    return Rmatrix33(m1(0,0)*m2(0,0) + m1(1,0)*m2(0,1) + m1(2,0)*m2(0,2),
-                     m1(0,0)*m2(1,0) + m1(1,0)*m2(1,1) + m1(2,0)*m2(1,2),
-                     m1(0,0)*m2(2,0) + m1(1,0)*m2(2,1) + m1(2,0)*m2(2,2),
-                     m1(0,1)*m2(0,0) + m1(1,1)*m2(0,1) + m1(2,1)*m2(0,2),
-                     m1(0,1)*m2(1,0) + m1(1,1)*m2(1,1) + m1(2,1)*m2(1,2),
-                     m1(0,1)*m2(2,0) + m1(1,1)*m2(2,1) + m1(2,1)*m2(2,2),
-                     m1(0,2)*m2(0,0) + m1(1,2)*m2(0,1) + m1(2,2)*m2(0,2),
-                     m1(0,2)*m2(1,0) + m1(1,2)*m2(1,1) + m1(2,2)*m2(1,2),
-                     m1(0,2)*m2(2,0) + m1(1,2)*m2(2,1) + m1(2,2)*m2(2,2));
+    // m1^T m2^T = (m2 m1)^T
+    Real m2m1[9];
+    Rmatrix33::MultiplyMatrix(m2.elementD, m1.elementD, m2m1);
+    return Rmatrix33(m2m1[0], m2m1[3], m2m1[6],
+                     m2m1[1], m2m1[4], m2m1[7],
+                     m2m1[2], m2m1[5], m2m1[8]);
 }
 
 
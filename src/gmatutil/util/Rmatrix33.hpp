@@ -103,8 +103,105 @@ public:
                                              const Rmatrix33& m2); 
    
    const std::string* GetDataDescriptions() const;
+   
+   // Fixed size kernels on row major 3x3 data
+   static inline void MultiplyMatrix(const Real m1[9], const Real m2[9],
+                                     Real result[9]);
+   static inline void MultiplyTransposeMatrix(const Real m1[9],
+                                     const Real m2[9], Real result[9]);
+   static inline void MultiplyMatrixTranspose(const Real m1[9],
+                                     const Real m2[9], Real result[9]);
+   static inline void MultiplyVector(const Real m[9], const Real v[3],
+                                     Real result[3]);
+   static inline void MultiplyTransposeVector(const Real m[9],
+                                     const Real v[3], Real result[3]);
          
 private:
    static const std::string descs[9];
 };
+
+
+//------------------------------------------------------------------------------
+// static void MultiplyMatrix(const Real m1[9], const Real m2[9],
+//       Real result[9])
+//------------------------------------------------------------------------------
+/**
+ * Computes m1 * m2.
+ *
+ * The fixed size kernels work on raw row major data so that callers can keep
+ * their matrices on the stack; they are inlined, and do no checking.  The
+ * result cannot be one of the inputs.
+ */
+//------------------------------------------------------------------------------
+inline void Rmatrix33::MultiplyMatrix(const Real m1[9], const Real m2[9],
+                                      Real result[9])
+{
+   for (int i = 0; i < 9; i += 3)
+      for (int j = 0; j < 3; ++j)
+         result[i+j] = m1[i]*m2[j] + m1[i+1]*m2[j+3] + m1[i+2]*m2[j+6];
+}
+
+//------------------------------------------------------------------------------
+// static void MultiplyTransposeMatrix(const Real m1[9], const Real m2[9],
+//       Real result[9])
+//------------------------------------------------------------------------------
+/**
+ * Computes m1^T * m2; the result cannot be one of the inputs.
+ */
+//------------------------------------------------------------------------------
+inline void Rmatrix33::MultiplyTransposeMatrix(const Real m1[9],
+                                      const Real m2[9], Real result[9])
+{
+   for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 3; ++j)
+         result[3*i+j] = m1[i]*m2[j] + m1[i+3]*m2[j+3] + m1[i+6]*m2[j+6];
+}
+
+//------------------------------------------------------------------------------
+// static void MultiplyMatrixTranspose(const Real m1[9], const Real m2[9],
+//       Real result[9])
+//------------------------------------------------------------------------------
+/**
+ * Computes m1 * m2^T; the result cannot be one of the inputs.
+ */
+//------------------------------------------------------------------------------
+inline void Rmatrix33::MultiplyMatrixTranspose(const Real m1[9],
+                                      const Real m2[9], Real result[9])
+{
+   for (int i = 0; i < 9; i += 3)
+      for (int j = 0; j < 9; j += 3)
+         result[i+j/3] = m1[i]*m2[j] + m1[i+1]*m2[j+1] + m1[i+2]*m2[j+2];
+}
+
+//------------------------------------------------------------------------------
+// static void MultiplyVector(const Real m[9], const Real v[3], Real result[3])
+//------------------------------------------------------------------------------
+/**
+ * Computes m * v; the result cannot be v.
+ */
+//------------------------------------------------------------------------------
+inline void Rmatrix33::MultiplyVector(const Real m[9], const Real v[3],
+                                      Real result[3])
+{
+   result[0] = m[0]*v[0] + m[1]*v[1] + m[2]*v[2];
+   result[1] = m[3]*v[0] + m[4]*v[1] + m[5]*v[2];
+   result[2] = m[6]*v[0] + m[7]*v[1] + m[8]*v[2];
+}
+
+//------------------------------------------------------------------------------
+// static void MultiplyTransposeVector(const Real m[9], const Real v[3],
+//       Real result[3])
+//------------------------------------------------------------------------------
+/**
+ * Computes m^T * v (equivalently, v * m); the result cannot be v.
+ */
+//------------------------------------------------------------------------------
+inline void Rmatrix33::MultiplyTransposeVector(const Real m[9],
+                                      const Real v[3], Real result[3])
+{
+   result[0] = m[0]*v[0] + m[3]*v[1] + m[6]*v[2];
+   result[1] = m[1]*v[0] + m[4]*v[1] + m[7]*v[2];
+   result[2] = m[2]*v[0] + m[5]*v[1] + m[8]*v[2];
+}
+
 #endif // Rmatrix33_hpp
@@ -321,7 +321,8 @@ Rmatrix66 Rmatrix66::operator*(const Rmatrix66& m) const
       for (int j = 0; j < m.colsD; j++)
       {
          for (int k = 0; k < colsD; k++)
-            prod(i, j) += elementD[i*colsD + k]*m(k, j);
+            prod.elementD[i*m.colsD + j] +=
+                  elementD[i*colsD + k]*m.elementD[k*m.colsD + j];
       }
    }
    
@@ -34,6 +34,7 @@
 #include <stdarg.h>
 #include <sstream>
 #include <stdio.h>            // for sprintf()
+#include <utility>            // for std::move()
 #include "ArrayTemplate.hpp"
 #include "TableTemplate.hpp"
 #include "Rmatrix.hpp"
@@ -113,6 +114,14 @@ Rvector::Rvector(const Rvector &v)
 {
 }
 
+//------------------------------------------------------------------------------
+//  Rvector(Rvector &&v)
+//------------------------------------------------------------------------------
+Rvector::Rvector(Rvector &&v)
+   : ArrayTemplate<Real>(std::move(v))
+{
+}
+
 //------------------------------------------------------------------------------
 //  ~Rvector()
 //------------------------------------------------------------------------------
@@ -262,6 +271,15 @@ const Rvector& Rvector::operator=(const Rvector &v)
     return *this;
 }
 
+//------------------------------------------------------------------------------
+//  const Rvector& operator=(Rvector &&v)
+//------------------------------------------------------------------------------
+const Rvector& Rvector::operator=(Rvector &&v)
+{
+    ArrayTemplate<Real>::operator=(std::move(v));
+    return *this;
+}
+
 //------------------------------------------------------------------------------
 //  bool operator==(const Rvector &v) const
 //------------------------------------------------------------------------------
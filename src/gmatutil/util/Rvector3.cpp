@@ -67,8 +67,11 @@ Rvector3::Rvector3()
 //  Rvector3(const Real e1, const Real e2, const Real e3)
 //------------------------------------------------------------------------------
 Rvector3::Rvector3(const Real e1, const Real e2, const Real e3)
-   : Rvector(3, e1, e2, e3) 
+   : Rvector(3) 
 {
+   elementD[0] = e1;
+   elementD[1] = e2;
+   elementD[2] = e3;
 }
 
 //------------------------------------------------------------------------------
@@ -283,9 +286,7 @@ const Rvector3& Rvector3::operator*=(Real s)
 //------------------------------------------------------------------------------
 Real Rvector3::operator*(const Rvector3& v) const 
 {
-    return (elementD[0] * v.elementD[0] +
-            elementD[1] * v.elementD[1] +
-            elementD[2] * v.elementD[2]);
+    return DotProduct(elementD, v.elementD);
 }
 
 //------------------------------------------------------------------------------
@@ -320,9 +321,10 @@ const Rvector3& Rvector3::operator/=(Real s)
 //------------------------------------------------------------------------------
 Rvector3 Rvector3::operator*(const Rmatrix33& m) const
 {
-    return Rvector3(elementD[0]*m(0,0) + elementD[1]*m(0,1) + elementD[2]*m(0,2),
-           elementD[0]*m(1,0) + elementD[1]*m(1,1) + elementD[2]*m(1,2),
-           elementD[0]*m(2,0) + elementD[1]*m(2,1) + elementD[2]*m(2,2));
+    // Note that this product has always been defined as m * v
+    Rvector3 prod;
+    Rmatrix33::MultiplyVector(m.elementD, elementD, prod.elementD);
+    return prod;
 }
 
 //------------------------------------------------------------------------------
@@ -386,10 +388,9 @@ Rvector3 operator*(Real s, const Rvector3& v)
 //------------------------------------------------------------------------------
 Rvector3 Cross(const Rvector3 &v1, const Rvector3 &v2)
 {
-    return Rvector3(
-       v1.elementD[1]*v2.elementD[2] - v1.elementD[2]*v2.elementD[1],
-       v1.elementD[2]*v2.elementD[0] - v1.elementD[0]*v2.elementD[2],
-       v1.elementD[0]*v2.elementD[1] - v1.elementD[1]*v2.elementD[0]);
+    Rvector3 prod;
+    Rvector3::CrossProduct(v1.elementD, v2.elementD, prod.elementD);
+    return prod;
 }
 
 //------------------------------------------------------------------------------
@@ -82,6 +82,9 @@ public:
    
    static Real Normalize(const Real from[3], Real to[3]);
    static void Copy(const Real from[3], Real to[3]);
+   static inline Real DotProduct(const Real v1[3], const Real v2[3]);
+   static inline void CrossProduct(const Real v1[3], const Real v2[3],
+                                   Real result[3]);
    
    Integer GetNumData() const;
    const std::string* GetDataDescriptions() const;
@@ -93,4 +96,36 @@ private:
    static const Integer NUM_DATA = 3;
    static const std::string DATA_DESCRIPTIONS[NUM_DATA];
 };
+
+
+//------------------------------------------------------------------------------
+// static Real DotProduct(const Real v1[3], const Real v2[3])
+//------------------------------------------------------------------------------
+/**
+ * Dot product of two 3-element arrays.
+ *
+ * The fixed size kernels work on raw data so that callers can keep their
+ * vectors on the stack; they are inlined, and do no checking.
+ */
+//------------------------------------------------------------------------------
+inline Real Rvector3::DotProduct(const Real v1[3], const Real v2[3])
+{
+   return v1[0]*v2[0] + v1[1]*v2[1] + v1[2]*v2[2];
+}
+
+//------------------------------------------------------------------------------
+// static void CrossProduct(const Real v1[3], const Real v2[3], Real result[3])
+//------------------------------------------------------------------------------
+/**
+ * Cross product of two 3-element arrays; result cannot be v1 or v2.
+ */
+//------------------------------------------------------------------------------
+inline void Rvector3::CrossProduct(const Real v1[3], const Real v2[3],
+                                   Real result[3])
+{
+   result[0] = v1[1]*v2[2] - v1[2]*v2[1];
+   result[1] = v1[2]*v2[0] - v1[0]*v2[2];
+   result[2] = v1[0]*v2[1] - v1[1]*v2[0];
+}
+
 #endif // Rvector3_hpp
@@ -82,8 +82,14 @@ Rvector6::Rvector6()
 //------------------------------------------------------------------------------
 Rvector6::Rvector6(const Real e1, const Real e2, const Real e3,
                    const Real e4, const Real e5, const Real e6)
-   : Rvector(6, e1, e2, e3, e4, e5, e6) 
+   : Rvector(6) 
 {
+   elementD[0] = e1;
+   elementD[1] = e2;
+   elementD[2] = e3;
+   elementD[3] = e4;
+   elementD[4] = e5;
+   elementD[5] = e6;
 }
 
 //------------------------------------------------------------------------------
@@ -95,7 +95,10 @@ SPADFileReader::SPADFileReader(const SPADFileReader &copy) :
    azCount       (copy.azCount),
    elCount       (copy.elCount),
    azStepSize    (copy.azStepSize),
-   elStepSize    (copy.elStepSize)
+   elStepSize    (copy.elStepSize),
+   gridData      (copy.gridData),
+   bicubicCoeff  (copy.bicubicCoeff),
+   bicubicReady  (copy.bicubicReady)
 {
    spadData.clear();
    for (unsigned int ii = 0; ii < copy.spadData.size(); ii++)
@@ -134,6 +137,9 @@ SPADFileReader& SPADFileReader::operator=(const SPADFileReader &copy)
    elCount       = copy.elCount;
    azStepSize    = copy.azStepSize;
    elStepSize    = copy.elStepSize;
+   gridData      = copy.gridData;
+   bicubicCoeff  = copy.bicubicCoeff;
+   bicubicReady  = copy.bicubicReady;
 
    for (unsigned int ii = 0; ii < spadData.size(); ii++)
       delete spadData[ii];
@@ -250,6 +256,8 @@ void SPADFileReader::Initialize()
       throw UtilityException(errmsg);
    }
 
+   BuildGrid();
+
    isInitialized = true;
 }
 
@@ -1081,16 +1089,29 @@ Rvector3 SPADFileReader::Interpolate2Step(Real azimuth, Real elevation)
    
    // Find the azimuth and elevation values that bracket the
    // sun vector direction
-   Real azLow  = GmatMathUtil::Floor((azimuth + 180.)/azStepSize) * azStepSize - 180.;
+   Real azFloor = GmatMathUtil::Floor((azimuth + 180.)/azStepSize);
+   Real elFloor = GmatMathUtil::Floor((elevation + 90.)/elStepSize);
+
+   Real azLow  = azFloor * azStepSize - 180.;
    Real azHigh = azLow + azStepSize;
    
-   Real elLow  = GmatMathUtil::Floor((elevation + 90.)/elStepSize) * elStepSize - 90.;
+   Real elLow  = elFloor * elStepSize - 90.;
    Real elHigh = elLow + elStepSize;
-   
-   Rvector3 lowLow   = GetVec3At(azLow,  elLow);
-   Rvector3 lowHigh  = GetVec3At(azLow,  elHigh);
-   Rvector3 highLow  = GetVec3At(azHigh, elLow);
-   Rvector3 highHigh = GetVec3At(azHigh, elHigh);
+
+   // The grid points are found by index; at azimuth 180 or elevation 90 the
+   // high point has zero weight, so the last grid point is used
+   Integer azIndex = (Integer) azFloor;
+   Integer elIndex = (Integer) elFloor;
+   if ((azIndex < 0) || (azIndex >= azCount) ||
+       (elIndex < 0) || (elIndex >= elCount))
+      GetGridIndex(azLow, elLow);     // Throws the missing data exception
+   Integer azNext  = (azIndex + 1 < azCount ? azIndex + 1 : azIndex);
+   Integer elNext  = (elIndex + 1 < elCount ? elIndex + 1 : elIndex);
+
+   const Real *lowLow   = &gridData[3 * (azIndex * elCount + elIndex)];
+   const Real *lowHigh  = &gridData[3 * (azIndex * elCount + elNext)];
+   const Real *highLow  = &gridData[3 * (azNext  * elCount + elIndex)];
+   const Real *highHigh = &gridData[3 * (azNext  * elCount + elNext)];
    
 #ifdef DEBUG_SPAD_FILE_AREA
    MessageInterface::ShowMessage("In SPADFileReader::GetSRPArea, az = %12.10f,  el = %12.10f\n",
@@ -1106,11 +1127,18 @@ Rvector3 SPADFileReader::Interpolate2Step(Real azimuth, Real elevation)
                                  azHigh, elHigh, highHigh[0], highHigh[1], highHigh[2]);
 #endif
    
-   Rvector3 interp1, interp2;
+   // Same weights as Interpolate1D, applied in azimuth and then elevation
+   Real azW1 = (azHigh - azimuth) / (azHigh - azLow);
+   Real azW2 = (azimuth - azLow) / (azHigh - azLow);
+   Real elW1 = (elHigh - elevation) / (elHigh - elLow);
+   Real elW2 = (elevation - elLow) / (elHigh - elLow);
 
-   interp1 = Interpolate1D(azimuth, azLow, azHigh, lowLow,  highLow);
-   interp2 = Interpolate1D(azimuth, azLow, azHigh, lowHigh, highHigh);
-   result = Interpolate1D(elevation, elLow, elHigh, interp1, interp2);
+   for (UnsignedInt ii = 0U; ii < 3U; ii++)
+   {
+      Real interp1 = azW1 * lowLow[ii]  + azW2 * highLow[ii];
+      Real interp2 = azW1 * lowHigh[ii] + azW2 * highHigh[ii];
+      result[ii] = elW1 * interp1 + elW2 * interp2;
+   }
 
    return result;
 }
@@ -1125,13 +1153,19 @@ Rvector3 SPADFileReader::InterpolateBicubic(Real azimuth, Real elevation)
 
    // Find the azimuth and elevation values that bracket the
    // sun vector direction
-   Real azLow  = GmatMathUtil::Floor((azimuth + 180.)/azStepSize) * azStepSize - 180.;
-   Real elLow  = GmatMathUtil::Floor((elevation + 90.)/elStepSize) * elStepSize - 90.;
+   Real azFloor = GmatMathUtil::Floor((azimuth + 180.)/azStepSize);
+   Real elFloor = GmatMathUtil::Floor((elevation + 90.)/elStepSize);
+   Real azLow   = azFloor * azStepSize - 180.;
+   Real elLow   = elFloor * elStepSize - 90.;
 
    if (GmatMathUtil::IsEqual(azimuth, azLow) && GmatMathUtil::IsEqual(elevation, elLow))
-      return GetVec3At(azLow, elLow);
+   {
+      const Real *atGrid = &gridData[3 * GetGridIndex(azLow, elLow)];
+      result.Set(atGrid[0], atGrid[1], atGrid[2]);
+      return result;
+   }
 
-   RealArray azVals(4), elVals(4);
+   Real azVals[4], elVals[4];
 
    // These will be corrected for angle limits later
    for (UnsignedInt ii = 0U; ii < 4U; ii++)
@@ -1152,52 +1186,25 @@ Rvector3 SPADFileReader::InterpolateBicubic(Real azimuth, Real elevation)
    Real azFrac = (azimuth - azLow) / (azVals[2] - azLow);
    Real elFrac = (elevation - elLow) / (elVals[2] - elLow);
 
-   static const Rmatrix Binv(4, 4,
-      -1./6.,  1./2., -1./2.,  1./6.,
-       1./2., -1.   ,  1./2.,  0.,
-      -1./3., -1./2.,  1.   , -1./6.,
-       0.   ,  1.   ,  0.   ,  0.);
-   static const Rmatrix BinvT = Binv.Transpose();
+   const Real *coeff = GetBicubicCoefficients((Integer) azFloor,
+         (Integer) elFloor, azVals, elVals);
+
+   Real vec1[4] = { azFrac*azFrac*azFrac, azFrac*azFrac, azFrac, 1. };
+   Real vec2[4] = { elFrac*elFrac*elFrac, elFrac*elFrac, elFrac, 1. };
 
    for (UnsignedInt ii = 0U; ii < 3U; ii++) // Each force componenet
    {
-      // Matrix containing the SPAD values
-      Rmatrix F(4, 4);
-
-      for (UnsignedInt jj = 0U; jj < 4U; jj++) // Row
+      // result = vec1 * a * vec2
+      const Real *a = coeff + 16 * ii;
+      Real sum = 0.0;
+      for (UnsignedInt kk = 0U; kk < 4U; kk++)
       {
-         Real azVal = azVals[jj];
-
-         if (azVal > 180.)
-            azVal -= 360.;
-         else if (azVal < -180.)
-            azVal += 360.;
-
-         for (UnsignedInt kk = 0U; kk < 4U; kk++) // Column
-         {
-            Real elVal = elVals[kk];
-
-            if (elVal > 90. || elVal < -90.)
-            {
-               elVal = 180. - elVal;
-
-               if (azVal > 0.)
-                  azVal -= 180.;
-               else
-                  azVal += 180;
-            }
-
-            F(jj, kk) = GetVec3At(azVal, elVal)(ii);
-         }
+         Real row = 0.0;
+         for (UnsignedInt jj = 0U; jj < 4U; jj++)
+            row += vec1[jj] * a[4 * jj + kk];
+         sum += row * vec2[kk];
       }
-
-      // a = inv(B) * F * inv(B)^T
-      Rmatrix a = Binv * F * BinvT;
-
-      Rvector vec1(4, azFrac*azFrac*azFrac, azFrac*azFrac, azFrac, 1.);
-      Rvector vec2(4, elFrac*elFrac*elFrac, elFrac*elFrac, elFrac, 1.);
-
-      result[ii] = vec1 * a * vec2;
+      result[ii] = sum;
    }
 
    return result;
@@ -1233,3 +1240,160 @@ Rvector3 SPADFileReader::GetVec3At(Real azVal, Real elVal)
    errmsg += "not in its expected location in the SPAD file.\n";
    throw UtilityException(errmsg);
 }
+
+// -----------------------------------------------------------------------------
+// void BuildGrid()
+// Stores the vec3 data of the records on the regular azimuth/elevation grid,
+// so interpolation finds its data points by index rather than by searching
+// the data records.
+// -----------------------------------------------------------------------------
+void SPADFileReader::BuildGrid()
+{
+   gridData.assign(3 * azCount * elCount, 0.0);
+   for (Integer ii = 0; ii < azCount; ii++)
+   {
+      Real azVal = ii * azStepSize - 180.;
+      for (Integer jj = 0; jj < elCount; jj++)
+      {
+         Real elVal   = jj * elStepSize - 90.;
+         Rvector3 xyz = GetVec3At(azVal, elVal);
+         Integer  at  = 3 * (ii * elCount + jj);
+         gridData[at]     = xyz[0];
+         gridData[at + 1] = xyz[1];
+         gridData[at + 2] = xyz[2];
+      }
+   }
+
+   // Bicubic coefficients are computed per cell when first needed
+   bicubicCoeff.clear();
+   bicubicReady.clear();
+   if (interpolator == "Bicubic")
+   {
+      bicubicCoeff.assign(48 * azCount * elCount, 0.0);
+      bicubicReady.assign(azCount * elCount, false);
+   }
+
+   #ifdef DEBUG_SPAD_DATA
+      MessageInterface::ShowMessage("SPADFileReader::BuildGrid() stored %d x "
+            "%d grid points\n", azCount, elCount);
+   #endif
+}
+
+// -----------------------------------------------------------------------------
+// Integer GetGridIndex(Real azVal, Real elVal)
+// Returns the index of the grid point at the input azimuth and elevation
+// value, matching the data record found by GetVec3At
+// -----------------------------------------------------------------------------
+Integer SPADFileReader::GetGridIndex(Real azVal, Real elVal)
+{
+   Integer azIndex = (Integer) GmatMathUtil::Round((azVal + 180) / azStepSize);
+   Integer elIndex = (Integer) GmatMathUtil::Round((elVal + 90) / elStepSize);
+
+   if ((azIndex < 0) || (azIndex >= azCount) ||
+       (elIndex < 0) || (elIndex >= elCount))
+   {
+      std::string errmsg  = "SPAD file ";
+      errmsg += spadFile + " does not contain vec3 data for ";
+      errmsg += "the specified azimuth-elevation pair or it is ";
+      errmsg += "not in its expected location in the SPAD file.\n";
+      throw UtilityException(errmsg);
+   }
+
+   return azIndex * elCount + elIndex;
+}
+
+// -----------------------------------------------------------------------------
+// const Real* GetBicubicCoefficients(Integer azIndex, Integer elIndex,
+//       const Real azVals[4], const Real elVals[4])
+// Returns the bicubic coefficients a = inv(B) * F * inv(B)^T of the grid cell
+// starting at the input grid point, 16 for each vec3 component, computing
+// them on first use.  azVals and elVals are the angles of the 4x4 grid points
+// around the cell, before correction for the angle limits.
+// -----------------------------------------------------------------------------
+const Real* SPADFileReader::GetBicubicCoefficients(Integer azIndex,
+      Integer elIndex, const Real azVals[4], const Real elVals[4])
+{
+   if (bicubicReady.empty())
+   {
+      // The interpolator was changed after initialization
+      bicubicCoeff.assign(48 * azCount * elCount, 0.0);
+      bicubicReady.assign(azCount * elCount, false);
+   }
+
+   Integer cell = azIndex * elCount + elIndex;
+   if ((azIndex < 0) || (azIndex >= azCount) ||
+       (elIndex < 0) || (elIndex >= elCount))
+      cell = GetGridIndex(azIndex * azStepSize - 180., elIndex * elStepSize - 90.);
+
+   Real *coeff = &bicubicCoeff[48 * cell];
+   if (bicubicReady[cell])
+      return coeff;
+
+   static const Real Binv[4][4] = {
+      { -1./6.,  1./2., -1./2.,  1./6. },
+      {  1./2., -1.   ,  1./2.,  0.    },
+      { -1./3., -1./2.,  1.   , -1./6. },
+      {  0.   ,  1.   ,  0.   ,  0.    } };
+
+   // Grid points of the matrix containing the SPAD values
+   Integer points[4][4];
+   for (UnsignedInt jj = 0U; jj < 4U; jj++) // Row
+   {
+      Real azVal = azVals[jj];
+
+      if (azVal > 180.)
+         azVal -= 360.;
+      else if (azVal < -180.)
+         azVal += 360.;
+
+      for (UnsignedInt kk = 0U; kk < 4U; kk++) // Column
+      {
+         Real elVal = elVals[kk];
+
+         if (elVal > 90. || elVal < -90.)
+         {
+            elVal = 180. - elVal;
+
+            if (azVal > 0.)
+               azVal -= 180.;
+            else
+               azVal += 180;
+         }
+
+         points[jj][kk] = 3 * GetGridIndex(azVal, elVal);
+      }
+   }
+
+   for (UnsignedInt ii = 0U; ii < 3U; ii++) // Each force componenet
+   {
+      Real F[4][4], BF[4][4];
+      for (UnsignedInt jj = 0U; jj < 4U; jj++)
+         for (UnsignedInt kk = 0U; kk < 4U; kk++)
+            F[jj][kk] = gridData[points[jj][kk] + ii];
+
+      for (UnsignedInt jj = 0U; jj < 4U; jj++)
+      {
+         for (UnsignedInt kk = 0U; kk < 4U; kk++)
+         {
+            BF[jj][kk] = 0.0;
+            for (UnsignedInt mm = 0U; mm < 4U; mm++)
+               BF[jj][kk] += Binv[jj][mm] * F[mm][kk];
+         }
+      }
+
+      // a = inv(B) * F * inv(B)^T
+      for (UnsignedInt jj = 0U; jj < 4U; jj++)
+      {
+         for (UnsignedInt kk = 0U; kk < 4U; kk++)
+         {
+            Real sum = 0.0;
+            for (UnsignedInt mm = 0U; mm < 4U; mm++)
+               sum += BF[jj][mm] * Binv[kk][mm];
+            coeff[16 * ii + 4 * jj + kk] = sum;
+         }
+      }
+   }
+   bicubicReady[cell] = true;
+
+   return coeff;
+}
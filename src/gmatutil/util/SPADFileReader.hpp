@@ -152,6 +152,15 @@ protected:
    /// Store a vector of meta "Motion" data
    std::vector<SPADMotionRecord*> spadMotion;
 
+   /// The vec3 data on the azimuth/elevation grid, azimuth major, 3 values
+   /// per grid point
+   RealArray         gridData;
+   /// Bicubic coefficients, 16 per vec3 component, of the grid cell starting
+   /// at each grid point; computed when the cell is first used
+   RealArray         bicubicCoeff;
+   /// Flags for the grid cells whose bicubic coefficients are computed
+   std::vector<bool> bicubicReady;
+
    /// the meta data
 
    /// Create a new record and add it to the data store
@@ -174,6 +183,14 @@ protected:
    virtual Rvector3 InterpolateBicubic(Real azimuth, Real elevation);
    /// Get the vector data at the record with the specified Azimuth and Elevation
    virtual Rvector3 GetVec3At(Real azVal, Real elVal);
+   /// Store the data records on the regular azimuth/elevation grid
+   virtual void     BuildGrid();
+   /// Get the grid point index of the specified Azimuth and Elevation
+   Integer          GetGridIndex(Real azVal, Real elVal);
+   /// Get the bicubic coefficients of a grid cell
+   const Real*      GetBicubicCoefficients(Integer azIndex, Integer elIndex,
+                                           const Real azVals[4],
+                                           const Real elVals[4]);
 };
 
 #endif // SPADFileReader_hpp
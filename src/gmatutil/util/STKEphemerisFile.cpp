@@ -444,11 +444,10 @@ bool STKEphemerisFile::GetInitialAndFinalStates(Real &initialA1Mjd, Real &finalA
    
    if (ReadDataRecords())
    {
-      int numRecords = ephemRecords.size();
-      initialA1Mjd = scenarioEpochA1Mjd + ephemRecords[0].timeFromEpoch / 86400.0;
-      finalA1Mjd = scenarioEpochA1Mjd + ephemRecords[numRecords - 1].timeFromEpoch / 86400.0;
-      initialState = ephemRecords[0].theState;
-      finalState = ephemRecords[numRecords - 1].theState;
+      initialA1Mjd = scenarioEpochA1Mjd + initialSecsFromEpoch / 86400.0;
+      finalA1Mjd = scenarioEpochA1Mjd + finalSecsFromEpoch / 86400.0;
+      initialState = this->initialState;
+      finalState = this->finalState;
       
       cbName = centralBody;
       csName = coordinateSystem;
@@ -1601,153 +1600,179 @@ bool STKEphemerisFile::ReadDataRecords(int logOption)
    }
    else
    {
-      // Read initial TimePosVel
-      StringArray items;
-      ephemRecords.clear();
+      ephemSource = EphemerisSource::Find(stkFileNameForRead, "STK");
+      ResetSearchData();
 
-      while (!stkInStream.eof())
+      Real firstTime = 0.0, lastTime = 0.0;
+      Integer pointCount = 0;
+
+      // Without boundary times in the header, the first point starts the ephem
+      bool startFromData = (segmentStartTimes.size() == 0);
+
+      if (ephemSource)
       {
-         // Use cross-platform GetLine
-         GmatFileUtil::GetLine(&stkInStream, line);
+         // The points were parsed by another reader of this file
+         pointCount = ephemSource->GetTotalPointCount();
+         GmatStringUtil::ToReal(ephemSource->GetMetadata("FirstTime"),
+               firstTime);
+         GmatStringUtil::ToReal(ephemSource->GetMetadata("LastTime"),
+               lastTime);
+      }
+      else
+      {
+         EphemerisSource *source = new EphemerisSource;
 
-         if (line.find("END Ephemeris") != line.npos)
-            break;
-		 if (line.find("CovarianceTimePosVel") != line.npos || line.find("CovarianceTimePos") != line.npos)
-			 readingTPV = false;
-         if (line.find(timePosVelKeyword) != line.npos)
-            readingTPV = true;
+         // Read initial TimePosVel
+         StringArray items;
+         Integer segNum = 0;
+         GmatEpoch nextSegEpoch = 999999.0;
 
-         if (readingTPV)
+         while (!stkInStream.eof())
          {
-            if (line != "")
-            {
-               #ifdef DEBUG_INITIAL_FINAL
-                  MessageInterface::ShowMessage("   data line =\n   '%s'\n",
-                        line.c_str());
-               #endif
-               // Check if line has 7 items
-               items = GmatStringUtil::SeparateBy(line, " ");
-               if (items.size() != 7)
-               {
-                  MessageInterface::ShowMessage
-                     ("*** ERROR *** Did not find correct number of elements in the STK file " + stkFileNameForRead + 
-                           " the data may be incomplete\n");
-                  break;
-               }
-               else
-               {
-                  Real time;
-                  Rvector6 posvel;
-                  if (!GetEpochAndState(line, time, posvel))
-                  {
-                     throw UtilityException("Error reading the STK ephemeris file " +
-                           stkFileNameForRead);
-                  }
+            // Use cross-platform GetLine
+            GmatFileUtil::GetLine(&stkInStream, line);
 
-                  EphemData ed;
-                  ed.timeFromEpoch = time;
+            if (line.find("END Ephemeris") != line.npos)
+               break;
+            if (line.find("CovarianceTimePosVel") != line.npos || line.find("CovarianceTimePos") != line.npos)
+               readingTPV = false;
+            if (line.find(timePosVelKeyword) != line.npos)
+               readingTPV = true;
 
-                  #ifdef DEBUG_DISTANCEUNIT
-                     MessageInterface::ShowMessage("distanceUnit in ReadDataRecords: %s\n",s
-                           distanceUnit.c_str());
+            if (readingTPV)
+            {
+               if (line != "")
+               {
+                  #ifdef DEBUG_INITIAL_FINAL
+                     MessageInterface::ShowMessage("   data line =\n   '%s'\n",
+                           line.c_str());
                   #endif
-
-                  if(distanceUnit == "Meters")
+                  // Check if line has 7 items
+                  items = GmatStringUtil::SeparateBy(line, " ");
+                  if (items.size() != 7)
                   {
-                     ed.theState[0] = posvel[0]/1000.0;
-                     ed.theState[1] = posvel[1]/1000.0;
-                     ed.theState[2] = posvel[2]/1000.0;
-                     ed.theState[3] = posvel[3]/1000.0;
-                     ed.theState[4] = posvel[4]/1000.0;
-                     ed.theState[5] = posvel[5]/1000.0;
+                     MessageInterface::ShowMessage
+                        ("*** ERROR *** Did not find correct number of elements in the STK file " + stkFileNameForRead +
+                              " the data may be incomplete\n");
+                     break;
                   }
                   else
                   {
-                     ed.theState[0] = posvel[0];
-                     ed.theState[1] = posvel[1];
-                     ed.theState[2] = posvel[2];
-                     ed.theState[3] = posvel[3];
-                     ed.theState[4] = posvel[4];
-                     ed.theState[5] = posvel[5];
-                  }
+                     Real time;
+                     Rvector6 posvel;
+                     if (!GetEpochAndState(line, time, posvel))
+                     {
+                        delete source;
+                        throw UtilityException("Error reading the STK ephemeris file " +
+                              stkFileNameForRead);
+                     }
 
-                  if (ephemRecords.size() == 0)
-                  {
-                     if (segmentStartTimes.size() == 0)
+                     #ifdef DEBUG_DISTANCEUNIT
+                        MessageInterface::ShowMessage("distanceUnit in ReadDataRecords: %s\n",
+                              distanceUnit.c_str());
+                     #endif
+
+                     if(distanceUnit == "Meters")
+                        posvel /= 1000.0;
+
+                     if (pointCount == 0)
                      {
-                        a1StartEpoch += time / GmatTimeConstants::SECS_PER_DAY;
-                        segmentStartTimes.push_back(a1StartEpoch);
+                        if (segmentStartTimes.size() == 0)
+                           segmentStartTimes.push_back(scenarioEpochA1Mjd +
+                                 time / GmatTimeConstants::SECS_PER_DAY);
+                        source->AddSegment(segmentStartTimes[0]);
+                        nextSegEpoch = (segmentStartTimes.size() > 1 ?
+                              segmentStartTimes[1] : 999999.0);
+                        firstTime = time;
                      }
-                     if (segmentStartTimes[0] != a1StartEpoch)
-                        MessageInterface::ShowMessage("Warning!  The first "
-                              "ephemeris segment start time, %.12lf, does not "
-                              "match the start of the ephemeris file, %.12lf.\n",
-                              segmentStartTimes[0], a1StartEpoch);
-                  }
 
-                  ephemRecords.push_back(ed);
-                  retval = true;
+                     GmatEpoch currentEpoch = scenarioEpochA1Mjd + time /
+                           GmatTimeConstants::SECS_PER_DAY;
+                     source->AddPoint(currentEpoch, posvel.GetDataVector());
+                     lastTime = time;
+                     ++pointCount;
+
+                     // At a segment boundary, start the next segment
+                     if (currentEpoch >= nextSegEpoch)
+                     {
+                        ++segNum;
+                        if (segmentStartTimes.size() > segNum)
+                           source->AddSegment(segmentStartTimes[segNum]);
+                        nextSegEpoch = (segmentStartTimes.size() > segNum+1 ?
+                                 segmentStartTimes[segNum+1] : 999999.0);
+                     }
+                  }
                }
             }
          }
 
-         if (logOption == 1)
+         // Segments past the last point are kept, empty
+         while (source->GetSegmentCount() > 0 &&
+                source->GetSegmentCount() < segmentStartTimes.size())
+            source->AddSegment(
+                  segmentStartTimes[source->GetSegmentCount()]);
+
+         std::stringstream timeText;
+         timeText.precision(17);
+         timeText << firstTime;
+         source->SetMetadata("FirstTime", timeText.str());
+         timeText.str("");
+         timeText << lastTime;
+         source->SetMetadata("LastTime", timeText.str());
+
+         ephemSource = EphemerisSource::Share(stkFileNameForRead, "STK",
+               source);
+      }
+
+      if (pointCount > 0)
+      {
+         if (startFromData)
          {
-            MessageInterface::ShowMessage("Ephemeris Epoch:  %s\nData Size: %d\n"
-                  "\nData:\n", scenarioEpochUtcGreg.c_str(), ephemRecords.size());
-            for (UnsignedInt i = 0; i < ephemRecords.size(); ++i)
-               MessageInterface::ShowMessage("   %lf  [%lf %lf %lf %.12lf %.12lf "
-                     "%.12lf]\n", ephemRecords[i].timeFromEpoch,
-                     ephemRecords[i].theState[0], ephemRecords[i].theState[1],
-                     ephemRecords[i].theState[2], ephemRecords[i].theState[3],
-                     ephemRecords[i].theState[4], ephemRecords[i].theState[5]);
+            a1StartEpoch += firstTime / GmatTimeConstants::SECS_PER_DAY;
+            if (segmentStartTimes.size() == 0)
+               segmentStartTimes.push_back(a1StartEpoch);
          }
+         if (segmentStartTimes[0] != a1StartEpoch)
+            MessageInterface::ShowMessage("Warning!  The first "
+                  "ephemeris segment start time, %.12lf, does not "
+                  "match the start of the ephemeris file, %.12lf.\n",
+                  segmentStartTimes[0], a1StartEpoch);
+         a1EndEpoch = scenarioEpochA1Mjd + lastTime /
+               GmatTimeConstants::SECS_PER_DAY;
+
+         // Save the end points for GetInitialAndFinalStates()
+         Integer lastSegment = ephemSource->GetSegmentCount() - 1;
+         while (ephemSource->GetPointCount(lastSegment) == 0)
+            --lastSegment;
+         initialSecsFromEpoch = firstTime;
+         finalSecsFromEpoch = lastTime;
+         initialState.Set(ephemSource->GetState(0, 0));
+         finalState.Set(ephemSource->GetState(lastSegment,
+               ephemSource->GetPointCount(lastSegment) - 1));
+         retval = true;
       }
-   }
-
-   if (ephemRecords.size() == 0)
-   {
-      MessageInterface::ShowMessage("*** ERROR *** There are no ephemeris data "
-            "points\n");
-   }
-
-   // Now fill the base class data structure
-   theEphem.clear();
-   // Prepare the segment data structures
-   for (UnsignedInt i = 0; i < segmentStartTimes.size(); ++i)
-   {
-      Segment seg;
-      seg.segStart = segmentStartTimes[i];
-      theEphem.push_back(seg);
-   }
-   Integer segNum = 0;
-   GmatEpoch nextSegEpoch = (theEphem.size() > segNum+1 ?
-         theEphem[segNum+1].segStart : 999999.0);
-
-   GmatEpoch currentEpoch;
-   EphemPoint currentPoint;
-   currentPoint.theEpoch = 0.0;
-   for (UnsignedInt i = 0; i < ephemRecords.size(); ++i)
-   {
-      currentEpoch = scenarioEpochA1Mjd + ephemRecords[i].timeFromEpoch /
-            GmatTimeConstants::SECS_PER_DAY;
-
-      currentPoint.theEpoch = currentEpoch;
-      for (UnsignedInt j = 0; j < 6; ++j)
-         currentPoint.posvel[j] = ephemRecords[i].theState[j];
-
-      theEphem[segNum].points.push_back(currentPoint);
-      theEphem[segNum].segEnd = currentEpoch;
+      else
+         MessageInterface::ShowMessage("*** ERROR *** There are no ephemeris "
+               "data points\n");
 
-      // At a segment boundary, write the end epoch and update the segment index
-      if (currentEpoch >= nextSegEpoch)
+      if (logOption == 1)
       {
-         ++segNum;
-         nextSegEpoch = (theEphem.size() > segNum+1 ?
-                  theEphem[segNum+1].segStart : 999999.0);
+         MessageInterface::ShowMessage("Ephemeris Epoch:  %s\nData Size: %d\n"
+               "\nData:\n", scenarioEpochUtcGreg.c_str(), pointCount);
+         for (Integer i = 0; i < ephemSource->GetSegmentCount(); ++i)
+         {
+            const Real *epochs = ephemSource->GetEpochs(i);
+            for (Integer j = 0; j < ephemSource->GetPointCount(i); ++j)
+            {
+               const Real *state = ephemSource->GetState(i, j);
+               MessageInterface::ShowMessage("   %lf  [%lf %lf %lf %.12lf %.12lf "
+                     "%.12lf]\n", (epochs[j] - scenarioEpochA1Mjd) *
+                     GmatTimeConstants::SECS_PER_DAY, state[0], state[1],
+                     state[2], state[3], state[4], state[5]);
+            }
+         }
       }
    }
-   a1EndEpoch = currentEpoch;
 
    if (centralBody == "Moon")
       centralBody = "Luna";
@@ -1783,17 +1808,17 @@ bool STKEphemerisFile::ReadDataRecords(int logOption)
          MessageInterface::ShowMessage("   %.12lf\n", segmentStartTimes[i]);
 
       MessageInterface::ShowMessage("Segment data:\n");
-      for (UnsignedInt i = 0; i < theEphem.size(); ++i)
+      for (Integer i = 0; i < ephemSource->GetSegmentCount(); ++i)
       {
          MessageInterface::ShowMessage("   Segment %d, Spanning %.12lf to "
-               "%.12lf, has %d points\n", i, theEphem[i].segStart,
-               theEphem[i].segEnd, theEphem[i].points.size());
+               "%.12lf, has %d points\n", i, ephemSource->GetSegmentStart(i),
+               ephemSource->GetSegmentEnd(i), ephemSource->GetPointCount(i));
          #ifdef DUMP_SEGMENT_DATA
-            for (UnsignedInt j = 0; j < theEphem[i].points.size(); ++j)
+            for (Integer j = 0; j < ephemSource->GetPointCount(i); ++j)
             {
                MessageInterface::ShowMessage("      %4d:  %.12lf [%s]\n", j,
-                     theEphem[i].points[j].theEpoch,
-                     theEphem[i].points[j].posvel.ToString(15).c_str());
+                     ephemSource->GetEpochs(i)[j],
+                     Rvector6(ephemSource->GetState(i, j)).ToString(15).c_str());
             }
          #endif
       }
@@ -1818,12 +1843,12 @@ bool STKEphemerisFile::ReadDataRecords(int logOption)
 void STKEphemerisFile::GetStartAndEndEpochs(GmatEpoch& startEpoch,
       GmatEpoch& endEpoch, std::vector<EphemData>** records)
 {
-   if (ephemRecords.size() > 0)
+   if (ephemSource && (ephemSource->GetTotalPointCount() > 0))
    {
-      startEpoch = scenarioEpochA1Mjd + ephemRecords[0].timeFromEpoch /
+      startEpoch = scenarioEpochA1Mjd + initialSecsFromEpoch /
+            GmatTimeConstants::SECS_PER_DAY;
+      endEpoch = scenarioEpochA1Mjd + finalSecsFromEpoch /
             GmatTimeConstants::SECS_PER_DAY;
-      endEpoch = scenarioEpochA1Mjd + ephemRecords[ephemRecords.size()-1].timeFromEpoch /
-            GmatTimeConstants::SECS_PER_DAY;;
    }
    else
       MessageInterface::ShowMessage("Warning: STK Ephemeris file %s contains "
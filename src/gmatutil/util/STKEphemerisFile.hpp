@@ -142,7 +142,8 @@ protected:
    std::ofstream stkOutStream;
    std::ofstream stkCovOutStream;
    
-   // Epoch and state buffer for read/write
+   // Epoch and state buffer handed out by GetStartAndEndEpochs(); the points
+   // read from a file are held in ephemSource
    std::vector<EphemData> ephemRecords;
    
    // Initial/Final epochs and states read from file
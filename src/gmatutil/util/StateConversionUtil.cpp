@@ -5777,6 +5777,374 @@ Rvector6 StateConversionUtil::CartesianToAngularMomentum(Real mu, const Rvector3
    return h;
 }
 
+//------------------------------------------------------------------------------
+// batch conversion methods
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+// void CartesianToKeplerianBatch(Real mu, Integer count, const Real *cartesian,
+//                                Real *keplerian, AnomalyType anomalyType)
+//------------------------------------------------------------------------------
+/**
+ * Converts states from Cartesian to Keplerian.
+ *
+ * The states are converted BATCH_SIZE at a time in loops that do not branch
+ * on the orbit geometry, so the compiler can vectorize the arithmetic.  The
+ * circular, equatorial and near parabolic states, and the states the scalar
+ * conversion rejects, are passed to CartesianToKeplerian(), so the results
+ * and the exceptions match it.
+ *
+ * @param <mu>            Gravitational constant for the central body
+ * @param <count>         Number of states
+ * @param <cartesian>     Cartesian states, by component
+ * @param <keplerian>     Keplerian states, by component, with the anomaly of
+ *                        anomalyType (angles in degrees)
+ * @param <anomalyType>   Anomaly type
+ */
+//------------------------------------------------------------------------------
+void StateConversionUtil::CartesianToKeplerianBatch(Real mu, Integer count,
+      const Real *cartesian, Real *keplerian, AnomalyType anomalyType)
+{
+   bool regular[BATCH_SIZE];
+
+   for (Integer start = 0; start < count; start += BATCH_SIZE)
+   {
+      Integer size = (count - start < BATCH_SIZE ? count - start : BATCH_SIZE);
+
+      for (Integer k = 0; k < size; ++k)
+      {
+         Integer i = start + k;
+         Real rx = cartesian[i],           ry = cartesian[count + i],
+              rz = cartesian[2*count + i], vx = cartesian[3*count + i],
+              vy = cartesian[4*count + i], vz = cartesian[5*count + i];
+
+         // eqns 4.1 - 4.10, as in ComputeCartToKepl()
+         Real hx = ry*vz - rz*vy, hy = rz*vx - rx*vz, hz = rx*vy - ry*vx;
+         Real h = sqrt(hx*hx + hy*hy + hz*hz);
+         Real n = sqrt(hx*hx + hy*hy);
+         Real posMag = sqrt(rx*rx + ry*ry + rz*rz);
+         Real v2 = vx*vx + vy*vy + vz*vz;
+         Real rv = rx*vx + ry*vy + rz*vz;
+         Real c1 = v2 - mu/posMag;
+         Real ex = (c1*rx - rv*vx)/mu, ey = (c1*ry - rv*vy)/mu,
+              ez = (c1*rz - rv*vz)/mu;
+         Real e = sqrt(ex*ex + ey*ey + ez*ez);
+         Real zeta = 0.5*v2 - mu/posMag;
+         Real sma = -mu/(2.0*zeta);
+
+         Real cosInc  = hz/h;
+         Real cosRaan = -hy/n;
+         Real cosAop  = (-hy*ex + hx*ey)/(n*e);
+         Real cosTa   = (ex*rx + ey*ry + ez*rz)/(e*posMag);
+
+         // CASE 1 of ComputeCartToKepl(): non-circular, inclined orbits
+         regular[k] = (Abs(mu) >= 1.0e-30) && (posMag > 0.0) && (h > 0.0) &&
+                      (zeta != 0.0) &&
+                      (Abs(1.0 - e) > GmatOrbitConstants::KEP_ECC_TOL) &&
+                      (Abs(sma*(1.0 - e)) >= .001) && (e >= 1.0e-11) &&
+                      (Abs(cosInc) <= 1.0) && (Abs(cosRaan) <= 1.0) &&
+                      (Abs(cosAop) <= 1.0) && (Abs(cosTa) <= 1.0);
+
+         // Values of the other states are replaced below
+         Real inc = acos(cosInc);
+         regular[k] = regular[k] && (inc >= 1.0e-11) && (inc <= PI - 1.0e-11);
+
+         Real raan = acos(cosRaan);
+         if (hx < 0.0)
+            raan = TWO_PI - raan;
+         Real aop = acos(cosAop);
+         if (ez < 0.0)
+            aop = TWO_PI - aop;
+         Real ta = acos(cosTa);
+         if (rv < 0.0)
+            ta = TWO_PI - ta;
+
+         keplerian[i]           = sma;
+         keplerian[count + i]   = e;
+         keplerian[2*count + i] = inc*DEG_PER_RAD;
+         keplerian[3*count + i] = raan*DEG_PER_RAD;
+         keplerian[4*count + i] = aop*DEG_PER_RAD;
+         keplerian[5*count + i] = ta*DEG_PER_RAD;
+      }
+
+      for (Integer k = 0; k < size; ++k)
+      {
+         Integer i = start + k;
+         if (regular[k])
+         {
+            if (anomalyType != TA)
+               keplerian[5*count + i] = ConvertFromTrueAnomaly(anomalyType,
+                     keplerian[5*count + i]*RAD_PER_DEG, keplerian[count + i]) *
+                     DEG_PER_RAD;
+         }
+         else
+         {
+            Rvector6 kepl = CartesianToKeplerian(mu, Rvector6(cartesian[i],
+                  cartesian[count + i], cartesian[2*count + i],
+                  cartesian[3*count + i], cartesian[4*count + i],
+                  cartesian[5*count + i]), anomalyType);
+            for (Integer j = 0; j < 6; ++j)
+               keplerian[j*count + i] = kepl[j];
+         }
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void KeplerianToCartesianBatch(Real mu, Integer count, const Real *keplerian,
+//                                Real *cartesian, AnomalyType anomalyType)
+//------------------------------------------------------------------------------
+/**
+ * Converts states from Keplerian to Cartesian.
+ *
+ * Elliptic states are converted BATCH_SIZE at a time, solving Kepler's
+ * equation for all of them together when the anomaly is the mean anomaly.
+ * Other states are passed to KeplerianToCartesian(), so the results, the
+ * warnings and the exceptions match it.
+ *
+ * @param <mu>            Gravitational constant for the central body
+ * @param <count>         Number of states
+ * @param <keplerian>     Keplerian states, by component (angles in degrees)
+ * @param <cartesian>     Cartesian states, by component
+ * @param <anomalyType>   Anomaly type of the Keplerian states
+ */
+//------------------------------------------------------------------------------
+void StateConversionUtil::KeplerianToCartesianBatch(Real mu, Integer count,
+      const Real *keplerian, Real *cartesian, AnomalyType anomalyType)
+{
+   if (mu < MU_TOL)
+   {
+      std::stringstream errmsg("");
+      errmsg.precision(16);
+      errmsg << "Gravitational constant (" << mu << ") is too small to convert";
+      errmsg << " from Keplerian to Cartesian state." << std::endl;
+      throw UtilityException(errmsg.str());
+   }
+
+   bool regular[BATCH_SIZE];
+   Real anomaly[BATCH_SIZE], ecc[BATCH_SIZE];
+
+   for (Integer start = 0; start < count; start += BATCH_SIZE)
+   {
+      Integer size = (count - start < BATCH_SIZE ? count - start : BATCH_SIZE);
+
+      for (Integer k = 0; k < size; ++k)
+      {
+         Integer i = start + k;
+         Real sma = keplerian[i];
+         Real e = keplerian[count + i];
+         regular[k] = ((anomalyType == TA) || (anomalyType == MA)) &&
+                      (e >= 0.0) && (1.0 - e >= PARABOLIC_TOL) && (sma > 0.0) &&
+                      (Abs(sma*(1.0 - e)) >= SINGULAR_TOL);
+         ecc[k] = (regular[k] ? e : 0.0);
+         anomaly[k] = (regular[k] ? keplerian[5*count + i]*RAD_PER_DEG : 0.0);
+      }
+
+      if (anomalyType == MA)
+         MeanToTrueAnomalyBatch(size, anomaly, ecc, anomaly, 1.0e-8);
+
+      for (Integer k = 0; k < size; ++k)
+      {
+         Integer i = start + k;
+         Real sma  = keplerian[i],
+              e    = ecc[k],
+              inc  = keplerian[2*count + i]*RAD_PER_DEG,
+              raan = keplerian[3*count + i]*RAD_PER_DEG,
+              per  = keplerian[4*count + i]*RAD_PER_DEG,
+              anom = anomaly[k];
+
+         // eqns 4.24 - 4.28, as in ComputeKeplToCart()
+         Real p = sma*(1.0 - e*e);
+         Real rad = p/(1.0 + e*cos(anom));
+         Real cosPerAnom    = cos(per + anom);
+         Real sinPerAnom    = sin(per + anom);
+         Real cosInc        = cos(inc);
+         Real sinInc        = sin(inc);
+         Real cosRaan       = cos(raan);
+         Real sinRaan       = sin(raan);
+         Real sqrtGravP     = sqrt(mu/p);
+         Real cosAnomPlusE  = cos(anom) + e;
+         Real sinAnom       = sin(anom);
+         Real cosPer        = cos(per);
+         Real sinPer        = sin(per);
+
+         cartesian[i]           = rad * (cosPerAnom * cosRaan - cosInc * sinPerAnom * sinRaan);
+         cartesian[count + i]   = rad * (cosPerAnom * sinRaan + cosInc * sinPerAnom * cosRaan);
+         cartesian[2*count + i] = rad * sinPerAnom  * sinInc;
+
+         cartesian[3*count + i] = sqrtGravP * cosAnomPlusE*(-sinPer*cosRaan-cosInc*sinRaan*cosPer)
+                                - sqrtGravP*sinAnom*(cosPer*cosRaan-cosInc*sinRaan*sinPer);
+         cartesian[4*count + i] = sqrtGravP * cosAnomPlusE*(-sinPer*sinRaan+cosInc*cosRaan*cosPer)
+                                - sqrtGravP*sinAnom*(cosPer*sinRaan+cosInc*cosRaan*sinPer);
+         cartesian[5*count + i] = sqrtGravP * (cosAnomPlusE*sinInc*cosPer - sinAnom*sinInc*sinPer);
+      }
+
+      for (Integer k = 0; k < size; ++k)
+      {
+         if (regular[k])
+            continue;
+
+         Integer i = start + k;
+         Rvector6 cart = KeplerianToCartesian(mu, Rvector6(keplerian[i],
+               keplerian[count + i], keplerian[2*count + i],
+               keplerian[3*count + i], keplerian[4*count + i],
+               keplerian[5*count + i]), anomalyType);
+         for (Integer j = 0; j < 6; ++j)
+            cartesian[j*count + i] = cart[j];
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void MeanToTrueAnomalyBatch(Integer count, const Real *maRadians,
+//                             const Real *ecc, Real *taRadians, Real tol)
+//------------------------------------------------------------------------------
+/**
+ * Computes true anomalies from mean anomalies.
+ *
+ * Kepler's equation is solved for the elliptic orbits BATCH_SIZE at a time,
+ * iterating each anomaly as MeanToTrueAnomaly() does until it converges.
+ * Other orbits are passed to MeanToTrueAnomaly().  taRadians may be the
+ * maRadians array.
+ *
+ * @param <count>         Number of anomalies
+ * @param <maRadians>     Mean anomalies in radians
+ * @param <ecc>           Eccentricities
+ * @param <taRadians>     True anomalies in radians
+ * @param <tol>           Tolerance on the eccentric anomaly
+ */
+//------------------------------------------------------------------------------
+void StateConversionUtil::MeanToTrueAnomalyBatch(Integer count,
+      const Real *maRadians, const Real *ecc, Real *taRadians, Real tol)
+{
+   Real ea[BATCH_SIZE];
+   bool active[BATCH_SIZE];
+
+   for (Integer start = 0; start < count; start += BATCH_SIZE)
+   {
+      Integer size = (count - start < BATCH_SIZE ? count - start : BATCH_SIZE);
+      Integer remaining = 0;
+
+      // GTDS MathSpec Equation 3-182
+      for (Integer k = 0; k < size; ++k)
+      {
+         Integer i = start + k;
+         active[k] = (ecc[i] >= 0.0) && (ecc[i] < 1.0);
+         ea[k] = maRadians[i] + ecc[i] * sin(maRadians[i]);
+         if (active[k])
+            ++remaining;
+      }
+
+      // GTDS MathSpec Equations 3-180 and 3-181, stopping each anomaly when
+      // its correction is below the tolerance
+      Integer iter = 0;
+      while (remaining > 0)
+      {
+         if (++iter > 1000)
+            throw UtilityException
+               ("MeanToTrueAnomalyBatch() Stuck in infinite loop in elliptical "
+               "orbit computation using tolerance of " + GmatStringUtil::ToString(tol, 16) +
+               ". Stopped at iteration: " + GmatStringUtil::ToString(iter) + "\n");
+
+         remaining = 0;
+         for (Integer k = 0; k < size; ++k)
+         {
+            Integer i = start + k;
+            Real next = ea[k] - (ea[k] - ecc[i] * sin(ea[k]) - maRadians[i]) /
+                                (1.0 - ecc[i] * cos(ea[k]));
+            bool converged = (Abs(ea[k] - next) < tol);
+            ea[k] = (active[k] ? next : ea[k]);
+            active[k] = active[k] && !converged;
+            remaining += (active[k] ? 1 : 0);
+         }
+      }
+
+      for (Integer k = 0; k < size; ++k)
+      {
+         Integer i = start + k;
+         if ((ecc[i] < 0.0) || (ecc[i] >= 1.0))
+         {
+            taRadians[i] = MeanToTrueAnomaly(maRadians[i], ecc[i], tol);
+            continue;
+         }
+
+         Real e = ea[k];
+         if (e < 0.0)
+            e = e + TWO_PI;
+
+         Real ta = e;
+         if (Abs(e - PI) >= 1.0e-08)
+            ta = 2.0 * atan(sqrt((1.0 + ecc[i])/(1.0 - ecc[i])) * tan(e/2.0));
+         if (ta < 0.0)
+            ta = ta + TWO_PI;
+         taRadians[i] = ta;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// RealArray ConvertBatch(const RealArray &states, const std::string &fromType,
+//                        const std::string &toType, Real mu, Real flattening,
+//                        Real eqRadius, const std::string &anomalyType)
+//------------------------------------------------------------------------------
+/**
+ * Converts an array of states from fromType to toType.
+ *
+ * The array holds the states by component, so that element j of state i is
+ * at [j*count + i].  Conversions between Cartesian and Keplerian states use
+ * the batch methods; the others convert the states one at a time.
+ *
+ * @param <states>      states to convert
+ * @param <fromType>    state type to convert from
+ * @param <toType>      state type to convert to
+ * @param <mu>          gravitational constant for the central body
+ * @param <flattening>  flattening coefficient for the central body
+ * @param <eqRadius>    equatorial radius for the central body
+ * @param <anomalyType> anomaly type string if a type is Mod/Keplerian
+ *
+ * @return The converted states, by component
+ */
+//------------------------------------------------------------------------------
+RealArray StateConversionUtil::ConvertBatch(const RealArray &states,
+      const std::string &fromType, const std::string &toType, Real mu,
+      Real flattening, Real eqRadius, const std::string &anomalyType)
+{
+   if (states.size() % 6 != 0)
+      throw UtilityException("StateConversionUtil::ConvertBatch() The state "
+            "array holds " + GmatStringUtil::ToString((Integer)states.size()) +
+            " values, which is not a whole number of states\n");
+
+   Integer count = (Integer)states.size() / 6;
+   if ((count == 0) || (fromType == toType))
+      return states;
+
+   RealArray converted(states.size());
+   if ((fromType == "Cartesian") && (toType == "Keplerian"))
+      CartesianToKeplerianBatch(mu, count, &states[0], &converted[0],
+                                GetAnomalyType(anomalyType));
+   else if ((fromType == "Keplerian") && (toType == "Cartesian"))
+      KeplerianToCartesianBatch(mu, count, &states[0], &converted[0],
+                                GetAnomalyType(anomalyType));
+   else
+   {
+      Real state[6];
+      for (Integer i = 0; i < count; ++i)
+      {
+         for (Integer j = 0; j < 6; ++j)
+            state[j] = states[j*count + i];
+         Rvector6 outState = Convert(state, fromType, toType, mu, flattening,
+                                     eqRadius, anomalyType);
+         for (Integer j = 0; j < 6; ++j)
+            converted[j*count + i] = outState[j];
+      }
+   }
+
+   return converted;
+}
+
+
 //------------------------------------------------------------------------------
 // general derivative conversion methods
 //------------------------------------------------------------------------------
@@ -292,6 +292,26 @@ static Rvector3 CartesianToDirOfLineOfNode(const Rvector3 &pos,
 static Rvector6 CartesianToAngularMomentum(Real mu, const Rvector3 &pos,
                                            const Rvector3 &vel);
 
+//------------------------------------------------------------------------------
+// batch conversion methods; the arrays hold count states by component, so that
+// element j of state i is at [j*count + i]
+//------------------------------------------------------------------------------
+static void      CartesianToKeplerianBatch(Real mu, Integer count,
+                                           const Real *cartesian, Real *keplerian,
+                                           AnomalyType anomalyType = TA);
+static void      KeplerianToCartesianBatch(Real mu, Integer count,
+                                           const Real *keplerian, Real *cartesian,
+                                           AnomalyType anomalyType = TA);
+static void      MeanToTrueAnomalyBatch(Integer count, const Real *maRadians,
+                                        const Real *ecc, Real *taRadians,
+                                        Real tol = 1.0e-08);
+static RealArray ConvertBatch(const RealArray &states,
+                              const std::string &fromType, const std::string &toType,
+                              Real mu         = EARTH_MU,
+                              Real flattening = EARTH_FLATTENING,
+                              Real eqRadius   = EARTH_EQ_RADIUS,
+                              const std::string &anomalyType = "TA");
+
 //------------------------------------------------------------------------------
 // general derivative conversion methods
 //------------------------------------------------------------------------------
@@ -387,6 +407,8 @@ static const Real         EQUINOCTIAL_TOL;  // = 1.0E-5
 static const Real         ANGLE_TOL;        // = 0.0 for now
 
 static const Integer      MAX_ITERATIONS; // 75
+/// Number of states the batch methods convert together
+static const Integer      BATCH_SIZE = 64;
 
 static const Real         DEFAULT_MU;  // km^3/s^2
 static const std::string  STATE_TYPE_TEXT[StateTypeCount];
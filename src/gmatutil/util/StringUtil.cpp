@@ -1472,6 +1472,20 @@ std::string GmatStringUtil::ToStringNoZeros(const Real &val)
 }
 
 
+//------------------------------------------------------------------------------
+// std::string ToShortestString(const Real &val)
+//------------------------------------------------------------------------------
+/**
+ * Formats real number to the shortest string that reads back as the same
+ * number.
+ */
+//------------------------------------------------------------------------------
+std::string GmatStringUtil::ToShortestString(const Real &val)
+{
+   return GmatRealUtil::ToShortestString(val);
+}
+
+
 //------------------------------------------------------------------------------
 // std::string ToOrdinal(Integer i, bool textOnly = false)
 //------------------------------------------------------------------------------
@@ -97,6 +97,7 @@ namespace GmatStringUtil
    GMATUTIL_API std::string ToString(const Integer &val, bool useCurrentFormat = true,
                            Integer width = GmatGlobal::INTEGER_WIDTH);
    GMATUTIL_API std::string ToStringNoZeros(const Real &val);
+   GMATUTIL_API std::string ToShortestString(const Real &val);
    
    GMATUTIL_API std::string ToOrdinal(Integer i, bool textOnly = false);
 
@@ -137,6 +137,25 @@ TableTemplate<T>::TableTemplate(const TableTemplate<T> &Table)
    }
 }
 
+//------------------------------------------------------------------------------
+//  <move constructor>
+//  TableTemplate(TableTemplate<T> &&table)
+//
+//  Notes: takes over the heap storage of table, leaving it unsized; small
+//         tables are copied
+//------------------------------------------------------------------------------
+template <class T>
+TableTemplate<T>::TableTemplate(TableTemplate<T> &&table) 
+   :
+   elementD((T*) 0), rowsD(0), colsD(0), isSizedD(false)
+{
+   if (table.IsSized() == false)
+   {
+      throw TableTemplateExceptions::UnsizedTable();
+   }
+   take(table);
+}
+
 //------------------------------------------------------------------------------
 //  <destructor>
 //  ~TableTemplate()
@@ -144,7 +163,7 @@ TableTemplate<T>::TableTemplate(const TableTemplate<T> &Table)
 template <class T>
 TableTemplate<T>::~TableTemplate() 
 {
-   delete[] elementD;
+   release();
 }
 
 //------------------------------------------------------------------------------
@@ -256,6 +275,35 @@ TableTemplate<T>::operator=(const TableTemplate<T> &table)
    return *this;
 }
 
+//------------------------------------------------------------------------------
+//  TableTemplate<T>& operator=(TableTemplate<T> &&table)
+//
+//  Notes: throws DimensionError() if (rowsD != table.rowsD) or 
+//         (colsD != table.colsD) for a sized table; the heap storage of table
+//         is taken over, leaving it unsized
+//------------------------------------------------------------------------------
+template <class T>
+TableTemplate<T>&
+TableTemplate<T>::operator=(TableTemplate<T> &&table) 
+{
+   if (table.IsSized() == false)
+   {
+      throw TableTemplateExceptions::UnsizedTable();
+   }
+
+   if ((isSizedD == true) &&
+       ((rowsD != table.rowsD) || (colsD != table.colsD)))
+      throw TableTemplateExceptions::DimensionError();
+
+   if (this != &table)
+   {
+      release();
+      take(table);
+   }
+   
+   return *this;
+}
+
 //------------------------------------------------------------------------------
 //  virtual T GetElement(int r, int c)
 //
@@ -327,7 +375,7 @@ TableTemplate<T>::SetSize(int r, int c, bool zeroElements)
          for (int i=0; i<rowsD*colsD; i++)
             saved[i] = elementD[i];
       }
-      delete [] elementD;
+      release();
    }
 
    if ((r < 0) || (c < 0))
@@ -387,9 +435,7 @@ TableTemplate<T>::ChangeSize(int r, int c, bool zeroElements)
 
 
    // Step 2. Remove the current table
-   if (elementD != NULL)
-      delete [] elementD;
-   elementD = NULL;
+   release();
 
    // Step 3. Set new size and fill table content by 0
    init(r,c);
@@ -466,7 +512,18 @@ TableTemplate<T>::init(int r, int c)
    }
    else
    {
-      elementD = new T[rowsD*colsD];
+      if (rowsD*colsD <= SMALL_SIZE)
+         elementD = smallD;
+      else
+      {
+         elementD = new T[rowsD*colsD];
+         #ifdef DEBUG_ARRAY_ALLOCATIONS
+            GmatArrayAllocation::Increment();
+         #endif
+         if (MemoryTracker::IsCounting())
+            MemoryTracker::CountAllocation(MemoryTracker::ARRAY_BUFFER,
+                  rowsD * colsD * sizeof(T));
+      }
 
       //loj: 9/20/04 added to initialize to 0.0
       for (int i=0; i<rowsD*colsD; i++)
@@ -475,3 +532,51 @@ TableTemplate<T>::init(int r, int c)
    isSizedD = true;
 }
 
+//------------------------------------------------------------------------------
+//  void release()
+//------------------------------------------------------------------------------
+template <class T>
+void
+TableTemplate<T>::release()
+{
+   if (elementD != smallD)
+   {
+      if ((elementD != (T *) 0) && MemoryTracker::IsCounting())
+         MemoryTracker::CountRelease(MemoryTracker::ARRAY_BUFFER,
+               rowsD * colsD * sizeof(T));
+      delete [] elementD;
+   }
+   elementD = (T *) 0;
+}
+
+//------------------------------------------------------------------------------
+//  void take(TableTemplate<T> &table)
+//
+//  Notes: used by the move operations on an object with no storage; table
+//         is left unsized
+//------------------------------------------------------------------------------
+template <class T>
+void
+TableTemplate<T>::take(TableTemplate<T> &table)
+{
+   if (table.elementD == table.smallD)
+   {
+      init(table.rowsD, table.colsD);
+      for (int i = 0; i < rowsD*colsD; i++)
+      {
+         elementD[i] = table.elementD[i];
+      }
+   }
+   else
+   {
+      elementD = table.elementD;
+      rowsD = table.rowsD;
+      colsD = table.colsD;
+      isSizedD = true;
+   }
+
+   table.elementD = (T *) 0;
+   table.rowsD = table.colsD = 0;
+   table.isSizedD = false;
+}
+
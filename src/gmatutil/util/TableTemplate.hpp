@@ -35,6 +35,8 @@
 
 #include "utildefs.hpp"
 #include "BaseException.hpp"
+#include "ArrayAllocationCounter.hpp"
+#include "MemoryTracker.hpp"
 #include <iterator>           // For back_inserter() with VC++ 2010
 
 //  exceptions
@@ -86,11 +88,13 @@ public:
     // TableTemplate(Integer r, Integer c, const T &a11,...);
     TableTemplate(Integer r, Integer c, const T* array);
     TableTemplate(const TableTemplate<T> &table);
+    TableTemplate(TableTemplate<T> &&table);
     virtual ~TableTemplate();
 
     T& operator()(Integer r, Integer c);
     const T& operator()(Integer r, Integer c) const;
     TableTemplate<T>& operator=(const TableTemplate<T> &table);
+    TableTemplate<T>& operator=(TableTemplate<T> &&table);
     bool operator==(const TableTemplate<T> &table) const;
     bool operator!=(const TableTemplate<T> &table) const;
     
@@ -105,12 +109,20 @@ public:
     virtual Integer  GetNumRows() const;
     
     const T* GetDataVector() {return elementD;}
+    const T* GetDataVector() const {return elementD;}
    
 protected:
+    /// Largest table (6x6) kept in smallD rather than on the heap
+    static const Integer SMALL_SIZE = 36;
+
     T   *elementD;
     Integer rowsD, colsD;
     bool isSizedD;
+    /// Storage for tables of up to SMALL_SIZE elements
+    T   smallD[SMALL_SIZE];
     void init(Integer r, Integer c);
+    void release();
+    void take(TableTemplate<T> &table);
 
 private:
 };
@@ -172,6 +172,15 @@ Real TimeSystemConverter::Convert(const Real origValue,
          "      TimeSystemConverter::Converting %.18lf in %s to %s; refJD = %.18lf\n", origValue,
          TIME_SYSTEM_TEXT[fromType].c_str(), TIME_SYSTEM_TEXT[toType].c_str(), refJd);
    #endif
+   
+   // A1, TAI, TT and TDB are fixed (or closed-form) offsets from TAI, so
+   // conversions among them need no table lookups
+   if (insideLeapSec == NULL)
+   {
+      Real fixedTime;
+      if (ConvertFixedOffset(origValue, fromType, toType, refJd, fixedTime))
+         return fixedTime;
+   }
       
    Real newTime =
       ConvertToTaiMjd(fromType, origValue, refJd);
@@ -1788,6 +1797,112 @@ bool TimeSystemConverter::IsValidTimeSystem(const std::string& system)
 //}
 
 
+//------------------------------------------------------------------------------
+// bool IsFixedOffsetSystem(Integer timeType)
+//------------------------------------------------------------------------------
+/**
+ * Checks for time systems that are offset from TAI without leap second or EOP
+ * data
+ *
+ * @param timeType  The time system ID
+ *
+ * @return true for A1, TAI, TT and TDB
+ */
+//------------------------------------------------------------------------------
+bool TimeSystemConverter::IsFixedOffsetSystem(Integer timeType)
+{
+   switch (timeType)
+   {
+   case A1MJD:
+   case A1:
+   case TAIMJD:
+   case TAI:
+   case TTMJD:
+   case TT:
+   case TDBMJD:
+   case TDB:
+      return true;
+   default:
+      return false;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool ConvertFixedOffset(Real origValue, Integer fromType, Integer toType,
+//                         Real refJd, Real &toValue)
+//------------------------------------------------------------------------------
+/**
+ * Converts directly between the A1, TAI, TT and TDB time systems.
+ *
+ * The A1 and TT offsets are applied inline, and only the TDB leg calls the
+ * general TDB code, so these pairs skip the full dispatch through the TAI hub.
+ * The arithmetic matches the hub conversion step for step, so the results are
+ * identical.
+ *
+ * @param origValue  The time to convert
+ * @param fromType   The time system of origValue
+ * @param toType     The requested time system
+ * @param refJd      The reference Julian date
+ * @param toValue    The converted time
+ *
+ * @return true if the pair was converted here, false if it needs the hub
+ */
+//------------------------------------------------------------------------------
+bool TimeSystemConverter::ConvertFixedOffset(Real origValue, Integer fromType,
+                                             Integer toType, Real refJd,
+                                             Real &toValue)
+{
+   if (!IsFixedOffsetSystem(fromType) || !IsFixedOffsetSystem(toType))
+      return false;
+   
+   Real taiTime;
+   switch (fromType)
+   {
+   case A1MJD:
+   case A1:
+      taiTime = origValue -
+            (GmatTimeConstants::A1_TAI_OFFSET/GmatTimeConstants::SECS_PER_DAY);
+      break;
+   case TTMJD:
+   case TT:
+      taiTime = origValue -
+            (GmatTimeConstants::TT_TAI_OFFSET/GmatTimeConstants::SECS_PER_DAY);
+      break;
+   case TDBMJD:
+   case TDB:
+      taiTime = ConvertToTaiMjd(fromType, origValue, refJd);
+      break;
+   default:
+      taiTime = origValue;
+      break;
+   }
+   
+   switch (toType)
+   {
+   case A1MJD:
+   case A1:
+      toValue = taiTime +
+            (GmatTimeConstants::A1_TAI_OFFSET/GmatTimeConstants::SECS_PER_DAY);
+      break;
+   case TTMJD:
+   case TT:
+      toValue = taiTime +
+            (GmatTimeConstants::TT_TAI_OFFSET/GmatTimeConstants::SECS_PER_DAY);
+      break;
+   case TDBMJD:
+   case TDB:
+      toValue = ConvertFromTaiMjd(toType, taiTime, refJd);
+      break;
+   default:
+      toValue = taiTime;
+      break;
+   }
+   
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // bool IsInLeapSecond(Real theMjd, Integer epochSystem)
 //------------------------------------------------------------------------------
@@ -195,6 +195,10 @@ protected:
 
    bool        IsInLeapSecond(Real theTaiMjd);
    bool        IsInLeapSecond(const GmatTime &theTaiMjd);
+
+   bool        IsFixedOffsetSystem(Integer timeType);
+   bool        ConvertFixedOffset(Real origValue, Integer fromType,
+                                  Integer toType, Real refJd, Real &toValue);
    
 //   bool        HandleLeapSecond();
    
@@ -42,7 +42,8 @@
 DataBucket::DataBucket() :
    fillToMatch          (true),
    initialRealValue     (-1),
-   initialStringValue   ("N/A")
+   initialStringValue   ("N/A"),
+   reservedPoints       (0U)
 {
 }
 
@@ -85,7 +86,8 @@ DataBucket::DataBucket(const DataBucket& db) :
    string2DArrayValues  (db.string2DArrayValues),
    fillToMatch          (db.fillToMatch),
    initialRealValue     (db.initialRealValue),
-   initialStringValue   (db.initialStringValue)
+   initialStringValue   (db.initialStringValue),
+   reservedPoints       (db.reservedPoints)
 {
 }
 
@@ -122,6 +124,7 @@ DataBucket& DataBucket::operator =(const DataBucket& db)
       fillToMatch         = db.fillToMatch;
       initialRealValue    = db.initialRealValue;
       initialStringValue  = db.initialStringValue;
+      reservedPoints      = db.reservedPoints;
    }
 
    return *this;
@@ -201,6 +204,7 @@ Integer DataBucket::AddRealContainer(const std::string& name, UnsignedInt numEle
 
       realNames.push_back(name);
       realValues.push_back(data);
+      realValues.back().reserve(reservedPoints);
       realValueSize.push_back(numElements);
       retval = realValues.size() - 1;
    }
@@ -285,6 +289,7 @@ Integer DataBucket::AddReal3DContainer(const std::string& name)
 
       real3DNames.push_back(name);
       real3DValues.push_back(data);
+      real3DValues.back().reserve(reservedPoints);
       retval = real3DValues.size() - 1;
    }
 
@@ -405,6 +410,7 @@ Integer DataBucket::AddStringContainer(const std::string& name, UnsignedInt numE
 
       stringNames.push_back(name);
       stringValues.push_back(data);
+      stringValues.back().reserve(reservedPoints);
       stringValueSize.push_back(numElements);
       retval = stringValues.size() - 1;
    }
@@ -489,6 +495,7 @@ Integer DataBucket::AddString3DContainer(const std::string& name)
 
       string3DNames.push_back(name);
       string3DValues.push_back(data);
+      string3DValues.back().reserve(reservedPoints);
       retval = string3DValues.size() - 1;
    }
 
@@ -580,6 +587,34 @@ Integer DataBucket::FindString2DArray(const std::string& name)
 }
 
 
+//------------------------------------------------------------------------------
+// void Reserve(UnsignedInt numPoints)
+//------------------------------------------------------------------------------
+/**
+ * Sets aside room for numPoints data points in the per-point containers
+ *
+ * Containers added later are given the same capacity.  Clear() keeps the
+ * capacity, so a bucket reserved once is not regrown on later passes.
+ *
+ * @param numPoints The number of points expected
+ */
+//------------------------------------------------------------------------------
+void DataBucket::Reserve(UnsignedInt numPoints)
+{
+   reservedPoints = numPoints;
+
+   elementStatus.reserve(numPoints);
+   for (UnsignedInt i = 0; i < realValues.size(); ++i)
+      realValues[i].reserve(numPoints);
+   for (UnsignedInt i = 0; i < real3DValues.size(); ++i)
+      real3DValues[i].reserve(numPoints);
+   for (UnsignedInt i = 0; i < stringValues.size(); ++i)
+      stringValues[i].reserve(numPoints);
+   for (UnsignedInt i = 0; i < string3DValues.size(); ++i)
+      string3DValues[i].reserve(numPoints);
+}
+
+
 //------------------------------------------------------------------------------
 // Integer AddPoint()
 //------------------------------------------------------------------------------
@@ -597,31 +632,18 @@ Integer DataBucket::AddPoint()
 {
    elementStatus.push_back(initialRealValue);
 
+   // Build the new elements in place rather than copying a temporary
    for (UnsignedInt i = 0; i < realValues.size(); ++i)
-   {
-      RealArray initialValue;
-      initialValue.assign(realValueSize[i], initialRealValue);
-      realValues[i].push_back(initialValue);
-   }
+      realValues[i].emplace_back(realValueSize[i], initialRealValue);
 
    for (UnsignedInt i = 0; i < real3DValues.size(); ++i)
-   {
-      std::vector<RealArray> initialValue;
-      real3DValues[i].push_back(initialValue);
-   }
+      real3DValues[i].emplace_back();
 
    for (UnsignedInt i = 0; i < stringValues.size(); ++i)
-   {
-      StringArray initialValue;
-      initialValue.assign(stringValueSize[i], initialStringValue);
-      stringValues[i].push_back(initialValue);
-   }
+      stringValues[i].emplace_back(stringValueSize[i], initialStringValue);
 
    for (UnsignedInt i = 0; i < string3DValues.size(); ++i)
-   {
-      std::vector<StringArray> initialValue;
-      string3DValues[i].push_back(initialValue);
-   }
+      string3DValues[i].emplace_back();
 
    return elementStatus.size() - 1;
 }
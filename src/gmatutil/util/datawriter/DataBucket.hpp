@@ -69,6 +69,7 @@ public:
    Integer AddString2DArray(const std::string &name);
    Integer FindString2DArray(const std::string &name);
 
+   void Reserve(UnsignedInt numPoints);
    Integer AddPoint();
    Integer GetContainerSize();
    void Clear();
@@ -109,6 +110,8 @@ protected:
    bool fillToMatch;
    Real initialRealValue;
    std::string initialStringValue;
+   /// Number of points the per-point containers have room for
+   UnsignedInt reservedPoints;
 };
 
 #endif /* DataBucket_hpp */
@@ -46,7 +46,8 @@ HermiteInterpolator::HermiteInterpolator(const std::string &name, Integer dim,
       Integer points) :
    Interpolator            (name, "HermiteInterpolator", dim),
    pointsWanted            (points),
-   interpolateNewtonian    (true)
+   interpolateNewtonian    (true),
+   coefficientsValid       (false)
 {
    bufferSize = pointsWanted+1;
 }
@@ -76,7 +77,8 @@ HermiteInterpolator::~HermiteInterpolator()
 HermiteInterpolator::HermiteInterpolator(const HermiteInterpolator &hi) :
    Interpolator            (hi),
    pointsWanted            (hi.pointsWanted),
-   interpolateNewtonian    (hi.interpolateNewtonian)
+   interpolateNewtonian    (hi.interpolateNewtonian),
+   coefficientsValid       (false)
 {
 }
 
@@ -100,6 +102,7 @@ HermiteInterpolator& HermiteInterpolator::operator=(const HermiteInterpolator &h
 
       pointsWanted         = hi.pointsWanted;
       interpolateNewtonian = hi.interpolateNewtonian;
+      coefficientsValid    = false;
 
       CleanupArrays();
    }
@@ -133,10 +136,30 @@ void HermiteInterpolator::Clear()
    derivatives.clear();
    qCoeffs.clear();
    tValues.clear();
+   coefficientsValid = false;
    Interpolator::Clear();
 }
 
 
+//------------------------------------------------------------------------------
+// bool AddPoint(const Real ind, const Real *data)
+//------------------------------------------------------------------------------
+/**
+ * Adds a point to the buffer, discarding the polynomial built for the old data
+ *
+ * @param ind  The value of the independent parameter
+ * @param data The dependent data values
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool HermiteInterpolator::AddPoint(const Real ind, const Real *data)
+{
+   coefficientsValid = false;
+   return Interpolator::AddPoint(ind, data);
+}
+
+
 //------------------------------------------------------------------------------
 // bool AddDerivative(const Real ind, const Real *data, const Integer order)
 //------------------------------------------------------------------------------
@@ -160,6 +183,7 @@ bool HermiteInterpolator::AddDerivative(const Real ind, const Real *data,
 {
    bool retval = false;
    Integer dvIndex = order - 1;
+   coefficientsValid = false;
 
    if (order != 1)
       throw InterpolatorException("The Hermite interpolator is only configured "
@@ -269,7 +293,11 @@ bool HermiteInterpolator::Interpolate(const Real ind, Real *results)
 
    if (interpolateNewtonian)
    {
-      if (BuildQCoefficients())
+      // The divided differences only depend on the data, so they are built
+      // once and reused until points or derivatives are added
+      if (!coefficientsValid)
+         coefficientsValid = BuildQCoefficients();
+      if (coefficientsValid)
          retval = EvaluatePolynomial(ind, results);
    }
    else
@@ -305,7 +333,9 @@ bool HermiteInterpolator::InterpolateCartesianState(const Real ind, Real *result
    if (interpolateNewtonian)
    {
       Real derivative[6];
-      if (BuildQCoefficients())
+      if (!coefficientsValid)
+         coefficientsValid = BuildQCoefficients();
+      if (coefficientsValid)
       {
          retval = EvaluatePolynomial(ind, results);
          if (retval)
@@ -505,6 +535,11 @@ bool HermiteInterpolator::EvaluatePolynomial(const Real ind, Real *results)
 /**
  * Generates derivative data for the interpolating polynomial
  *
+ * The Newton basis products and their derivatives are accumulated term by
+ * term, so the derivative costs O(order) per element:
+ *
+ *    P_j  = P_(j-1) (t - t_(j-1)),   P'_j = P'_(j-1) (t - t_(j-1)) + P_(j-1)
+ *
  * @param ind The independent parameter value at which the derivative is needed
  * @param results The container for the derivative data
  *
@@ -518,12 +553,13 @@ bool HermiteInterpolator::EvaluatePolynomialDerivative(const Real ind, Real *res
    // Walk through element by element
    for (UnsignedInt i = 0; i < dimension; ++i)
    {
-      Real tProduct;
+      Real tProduct = 1.0, dProduct = 0.0;
       results[i] = 0.0;
       for (UnsignedInt j = 1; j < qCoeffs[i].size(); ++j)
       {
-         tProduct = EvaluateDerivativeIndependentTerm(ind, j, i);
-         results[i] += qCoeffs[i][j] * tProduct;
+         dProduct = dProduct * (ind - tValues[i][j-1]) + tProduct;
+         tProduct *= (ind - tValues[i][j-1]);
+         results[i] += qCoeffs[i][j] * dProduct;
       }
    }
 
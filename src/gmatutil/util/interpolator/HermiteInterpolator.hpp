@@ -74,10 +74,12 @@ public:
 
    virtual Interpolator*   Clone() const;
    virtual void            Clear();
+   virtual bool            AddPoint(const Real ind, const Real *data);
 
    virtual bool            AddDerivative(const Real ind, const Real *data,
                                  const Integer order = 1);
    virtual bool            Interpolate(const Real ind, Real *results);
+   using Interpolator::Interpolate;
    bool                    InterpolateCartesianState(const Real ind, Real *results);
 
 protected:
@@ -94,6 +96,8 @@ protected:
    std::vector<RealArray> qCoeffs;
    /// Independent data used with the polynomials
    std::vector<RealArray> tValues;
+   /// Flag indicating that qCoeffs and tValues match the current data
+   bool coefficientsValid;
 
 //   // Inherited methods that need some revision for HermiteInterpolator
 //   virtual void AllocateArrays();
@@ -239,6 +239,37 @@ Integer Interpolator::IsInterpolationFeasible(Real ind)
 }
 
 
+//------------------------------------------------------------------------------
+// bool Interpolate(const Real *inds, const Integer count, Real *results)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the data at a list of independent variable values.
+ *
+ * The values are interpolated in order from the same buffer of points, so an
+ * interpolator that caches its coefficients for a set of points builds them
+ * once for the whole list.
+ *
+ * @param inds    The values of the independent variable.
+ * @param count   The number of values in inds.
+ * @param results Array of count * dimension interpolated data; the data for
+ *                inds[k] starts at results[k * dimension].
+ *
+ * @return true if every value was interpolated, false if one failed.  The
+ *         values after a failure are not interpolated.
+ */
+//------------------------------------------------------------------------------
+bool Interpolator::Interpolate(const Real *inds, const Integer count,
+                               Real *results)
+{
+   for (Integer k = 0; k < count; ++k)
+   {
+      if (!Interpolate(inds[k], results + k * dimension))
+         return false;
+   }
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // void SetForceInterpolation(bool flag)
 //------------------------------------------------------------------------------
@@ -80,6 +80,8 @@ public:
     */
    //---------------------------------------------------------------------------
    virtual bool    Interpolate(const Real ind, Real *results) = 0;
+   virtual bool    Interpolate(const Real *inds, const Integer count,
+                               Real *results);
    
    virtual Interpolator* Clone() const = 0;
 
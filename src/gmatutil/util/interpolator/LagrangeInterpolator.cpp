@@ -66,7 +66,11 @@ LagrangeInterpolator::LagrangeInterpolator(const std::string &name, Integer dim,
    startPoint    (0),
    lastX         (-9.9999e75),
    x             (NULL),
-   y             (NULL)
+   y             (NULL),
+   weights       (NULL),
+   weightStart   (-1),
+   weightEnd     (-1),
+   pointsChanged (true)
 {
    // Made bufferSize 10 times bigger than order, so that we can collect more
    // data to place requested ind parameter in the near to the center of the
@@ -118,7 +122,11 @@ LagrangeInterpolator::LagrangeInterpolator(const LagrangeInterpolator &li) :
    startPoint     (li.startPoint),
    lastX          (li.lastX),
    x              (NULL),
-   y              (NULL)
+   y              (NULL),
+   weights        (NULL),
+   weightStart    (-1),
+   weightEnd      (-1),
+   pointsChanged  (true)
 {
    bufferSize = li.bufferSize;
    AllocateArrays();
@@ -152,6 +160,9 @@ LagrangeInterpolator::operator=(const LagrangeInterpolator &li)
    dataIndex  = li.dataIndex;
    startPoint = li.startPoint;
    lastX      = li.lastX;
+   pointsChanged = true;
+   weightStart = -1;
+   weightEnd  = -1;
    
    return *this;
 }
@@ -284,6 +295,9 @@ void LagrangeInterpolator::Clear()
    actualSize = 0;
    beginIndex = 0;
    startPoint = 0;
+   pointsChanged = true;
+   weightStart = -1;
+   weightEnd = -1;
    
    for (Integer i = 0; i <= bufferSize; ++i)
       x[i] = -9.9999e75;
@@ -322,6 +336,7 @@ bool LagrangeInterpolator::AddPoint(const Real ind, const Real *data)
    MessageInterface::ShowMessage
       ("Lagrange::AddPoint() returning Interpolator::AddPoint(ind, data)\n");
    #endif
+   pointsChanged = true;
    return Interpolator::AddPoint(ind, data);
 }
 
@@ -333,7 +348,10 @@ bool LagrangeInterpolator::AddPoint(const Real ind, const Real *data)
  * Perform the interpolation.
  * 
  * This method is the core interface for the lagrange interpolation.
- * See the GMAT math spec for the algorithm.
+ * See the GMAT math spec for the selection of the points.  The polynomial is
+ * evaluated in the barycentric form: the weights depend only on the points
+ * used, so they are computed once for a set of points and reused by the
+ * following calls, which then cost O(order) per element.
  * 
  * @param ind       The value of the independent parameter.
  * @param results   Data structure for the estimates.
@@ -365,8 +383,14 @@ bool LagrangeInterpolator::Interpolate(const Real ind, Real *results)
       return false;
    }
    
-   // Build data points
-   BuildDataPoints(ind);
+   // Build data points; x and y only change when points are added
+   if (pointsChanged)
+   {
+      BuildDataPoints(ind);
+      pointsChanged = false;
+      weightStart = -1;
+      weightEnd = -1;
+   }
    
    // Update index and check if it is inside a range
    if (!UpdateBeginAndEndIndex(ind))
@@ -400,10 +424,6 @@ bool LagrangeInterpolator::Interpolate(const Real ind, Real *results)
    // Find starting point that will put ind in the center
    FindStartingPoint(ind);
    
-   // Now interpolate using the algorithm in the Math Spec.
-   Real *products = new Real[dimension];
-   Real *estimates = new Real[dimension];
-   
    #ifdef DUMP_DATA_POINT_20
       if (!dataDumped)
       {
@@ -425,9 +445,6 @@ bool LagrangeInterpolator::Interpolate(const Real ind, Real *results)
       }
    #endif
    
-   for (Integer dim = 0; dim < dimension; ++dim)
-      estimates[dim] = 0.0;
-   
    Integer endPoint = startPoint + order;
    #ifdef DEBUG_LAGRANGE_INTERPOLATE
    MessageInterface::ShowMessage
@@ -453,68 +470,43 @@ bool LagrangeInterpolator::Interpolate(const Real ind, Real *results)
    #ifdef DEBUG_LAGRANGE_INTERPOLATE
    MessageInterface::ShowMessage("   new startPoint=%d, endPoint=%d\n", startPoint, endPoint);
    #endif
+   
+   if ((startPoint != weightStart) || (endPoint != weightEnd))
+      ComputeWeights(startPoint, endPoint);
+   
+   // Barycentric form: p(ind) = sum(w_i y_i / (ind - x_i)) / sum(w_i / (ind - x_i))
+   Real denominator = 0.0;
+   for (Integer dim = 0; dim < dimension; ++dim)
+      results[dim] = 0.0;
+   
    for (Integer i = startPoint; i <= endPoint; i++)
    {
       #ifdef DEBUG_LAGRANGE_INTERPOLATE
       MessageInterface::ShowMessage
          ("***** x[%d] = %.15f, y[%d] = %.15f, %.15f, %.15f\n", i, x[i], i, y[i][0], y[i][1], y[i][2]);
       #endif
-      for (Integer dim = 0; dim < dimension; dim++)
-      {
-         products[dim] = y[i][dim];
-         
-         #ifdef DEBUG_LAGRANGE_INTERPOLATE_MORE
-         MessageInterface::ShowMessage
-            ("  i=%d, products[%d]=%f\n", i, dim, products[dim]);
-         #endif
-      }
       
-      for (Integer j = startPoint; j <= endPoint; j++)
+      // At a data point the interpolated value is the data
+      if (ind == x[i])
       {
-         if (i != j)
-         {
-            for (Integer dim = 0; dim < dimension; ++dim)
-            {
-               // Should I check for divide by zero?
-               if ((x[i] - x[j] == 0.0))
-               {
-                  MessageInterface::ShowMessage("WARNING: Lagrange interpolation zero denominator\n");
-                  #ifdef DEBUG_LAGRANGE_INTERPOLATE_MORE
-                  MessageInterface::ShowMessage("   x[%d]- x[%d]=%f\n", i, j, (x[i]- x[j]));
-                  #endif
-               }
-               products[dim] = products[dim] * (ind - x[j]) / (x[i]- x[j]);
-            }
-         }
+         for (Integer dim = 0; dim < dimension; ++dim)
+            results[dim] = y[i][dim];
+         denominator = 1.0;
+         break;
       }
-
-      #ifdef DUMP_DATA_POINT_20
-         if (!dataDumped)
-         {
-            // Report from the 20th interpolation
-            if (calls == 20)
-            {
-               MessageInterface::ShowMessage("Products for %d:  ", i-startPoint); 
-               for (Integer dim = 0; dim < dimension; dim++)
-                  MessageInterface::ShowMessage("   %.12lf", products[dim]);
-               MessageInterface::ShowMessage("\n");
-            }
-         }
-      #endif
-
-      #ifdef DEBUG_LAGRANGE_INTERPOLATE
-      MessageInterface::ShowMessage
-         ("***** products[%d] = %.15f, %.15f, %.15f\n", i, products[0], products[1], products[2]);
-      #endif
+      
+      Real term = weights[i] / (ind - x[i]);
+      denominator += term;
       for (Integer dim = 0; dim < dimension; ++dim)
-      {
-         #ifdef DEBUG_LAGRANGE_INTERPOLATE_MORE
-         MessageInterface::ShowMessage
-            ("  i=%d, products[%d]=%f\n", i, dim, products[dim]);
-         #endif
-         estimates[dim] = estimates[dim] + products[dim];
-      }
+         results[dim] += term * y[i][dim];
+      
+      #ifdef DEBUG_LAGRANGE_INTERPOLATE_MORE
+      MessageInterface::ShowMessage("  i=%d, term=%.15le\n", i, term);
+      #endif
    }
+   
+   for (Integer dim = 0; dim < dimension; ++dim)
+      results[dim] /= denominator;
 
    #ifdef DUMP_DATA_POINT_20
       if (!dataDumped)
@@ -524,21 +516,12 @@ bool LagrangeInterpolator::Interpolate(const Real ind, Real *results)
          {
             MessageInterface::ShowMessage("\nFinal estimate:  "); 
             for (Integer dim = 0; dim < dimension; dim++)
-               MessageInterface::ShowMessage("   %.12lf", estimates[dim]);
+               MessageInterface::ShowMessage("   %.12lf", results[dim]);
             MessageInterface::ShowMessage("\n==================================================\n");
          }
       }
    #endif
    
-   // copy results
-   for (Integer dim = 0; dim < dimension; ++dim)
-   {
-      results[dim] = estimates[dim];
-   }
-   
-   delete [] products;
-   delete [] estimates;
-   
    #ifdef DEBUG_LAGRANGE_INTERPOLATE
    MessageInterface::ShowMessage
       ("Lagrange::Interpolate() returning true, results[0:2] = %f, %f, %f\n",
@@ -592,6 +575,9 @@ void LagrangeInterpolator::AllocateArrays()
    
    x = new Real[bufferSize+1];
    y = new Real*[bufferSize+1];
+   weights = new Real[bufferSize+1];
+   weightStart = -1;
+   weightEnd = -1;
 
    for (Integer i = 0; i <= bufferSize; ++i)
    {
@@ -619,9 +605,11 @@ void LagrangeInterpolator::CleanupArrays()
          delete [] y[i];
       delete [] x;
       delete [] y;
+      delete [] weights;
 
       x = NULL;
       y = NULL;
+      weights = NULL;
    }
 
    Interpolator::CleanupArrays();
@@ -904,3 +892,34 @@ Integer LagrangeInterpolator::FindStartingPoint(Real ind)
 }
 
 
+//------------------------------------------------------------------------------
+// void ComputeWeights(Integer start, Integer end)
+//------------------------------------------------------------------------------
+/**
+ * Computes the barycentric weights of a set of points,
+ * w_i = 1 / prod(x_i - x_j) for j != i.
+ *
+ * @param start Index of the first point used
+ * @param end   Index of the last point used
+ */
+//------------------------------------------------------------------------------
+void LagrangeInterpolator::ComputeWeights(Integer start, Integer end)
+{
+   for (Integer i = start; i <= end; ++i)
+   {
+      Real product = 1.0;
+      for (Integer j = start; j <= end; ++j)
+      {
+         if (i != j)
+         {
+            if ((x[i] - x[j] == 0.0))
+               MessageInterface::ShowMessage("WARNING: Lagrange interpolation zero denominator\n");
+            product *= (x[i] - x[j]);
+         }
+      }
+      weights[i] = 1.0 / product;
+   }
+   
+   weightStart = start;
+   weightEnd = end;
+}
@@ -48,6 +48,7 @@ public:
    virtual void         Clear();
    virtual bool         AddPoint(const Real ind, const Real *data);
    virtual bool         Interpolate(const Real ind, Real *results);
+   using Interpolator::Interpolate;
    
    // inherited from GmatBase
    virtual Interpolator*    Clone() const;
@@ -73,6 +74,13 @@ protected:
    Real  *x;
    /// Array of ordered dependent variables used
    Real  **y;
+   /// Barycentric weights of the points x[weightStart] to x[weightEnd]
+   Real  *weights;
+   /// Range of the points the weights were computed for; -1 if none
+   Integer weightStart;
+   Integer weightEnd;
+   /// Flag indicating that points were added since x and y were built
+   bool  pointsChanged;
    
    // Inherited methods that need some revision for LagrangeInterpolator
    virtual void AllocateArrays();
@@ -83,6 +91,7 @@ protected:
    bool    UpdateBeginAndEndIndex(Real ind);
    bool    IsDataNearCenter(Real ind);
    Integer FindStartingPoint(Real ind);
+   void    ComputeWeights(Integer start, Integer end);
 };
 
 
@@ -230,6 +230,58 @@ bool NotAKnotInterpolator::Interpolate(const Real ind, Real *results)
 }
 
 
+//------------------------------------------------------------------------------
+//  bool GetSplineCoefficients(Real *knots, Real *coefficients)
+//------------------------------------------------------------------------------
+/**
+ * Builds the splines for the buffered points and returns their coefficients.
+ *
+ * Callers that evaluate the same 5 points many times can store the splines and
+ * evaluate them directly.  For spline j (between knots j and j+1) and
+ * dependent element i, the value at ind is
+ *
+ *    a*dx^3 + b*dx^2 + c*dx + d,  with dx = ind - knots[j]
+ *
+ * where a = coefficients[(4*j) * dimension + i], b, c and d follow in the next
+ * three blocks of dimension elements.
+ *
+ * @param knots        Array of 5 elements receiving the ordered knots.
+ * @param coefficients Array of 16 * dimension elements receiving the spline
+ *                     coefficients.
+ *
+ * @return true on success, false if the splines could not be built.
+ */
+//------------------------------------------------------------------------------
+bool NotAKnotInterpolator::GetSplineCoefficients(Real *knots,
+      Real *coefficients)
+{
+   if (pointCount < requiredPoints)
+      throw InterpolatorException("ERROR - NotAKnotInterpolator: " +
+         GmatStringUtil::ToString(requiredPoints, 1) + " points "
+         "are required for interpolation, but only " +
+         GmatStringUtil::ToString(pointCount, 1) + " were provided.\n");
+
+   if (!BuildSplines())
+      return false;
+
+   for (Integer j = 0; j < 5; ++j)
+      knots[j] = x[j];
+
+   for (Integer j = 0; j < 4; ++j)
+   {
+      for (Integer i = 0; i < dimension; ++i)
+      {
+         coefficients[(4*j)   * dimension + i] = a[j][i];
+         coefficients[(4*j+1) * dimension + i] = b[j][i];
+         coefficients[(4*j+2) * dimension + i] = c[j][i];
+         coefficients[(4*j+3) * dimension + i] = d[j][i];
+      }
+   }
+
+   return true;
+}
+
+
 //---------------------------------
 //  protected methods
 //---------------------------------
@@ -35,6 +35,8 @@
 #include "MessageInterface.hpp"
 #include <iostream>
 
+const Integer CholeskyFactorization::BLOCK_SIZE;
+
 //------------------------------------------------------------------------------
 // CholeskyFactorization()
 //------------------------------------------------------------------------------
@@ -56,7 +58,7 @@ CholeskyFactorization::CholeskyFactorization() :
 //------------------------------------------------------------------------------
 CholeskyFactorization::CholeskyFactorization(const CholeskyFactorization
                                              &choleskyfactorization) :
-   sum1               (choleskyfactorization.sum1)
+   sum1               (nullptr)
 {
 }
 
@@ -228,6 +230,107 @@ void CholeskyFactorization::Factor(const Rmatrix &inputMatrix, Rmatrix &R)
 }
 
 
+//------------------------------------------------------------------------------
+// void FactorInPlace(Rmatrix &A)
+//------------------------------------------------------------------------------
+/**
+* Cholesky factorization in place, A = R^T R, without allocating memory
+*
+* The upper triangle of A is replaced by R and the lower triangle is zeroed;
+* only the upper triangle is read.  The rows are factored in blocks of
+* BLOCK_SIZE.  Each block is finished from its own rows, then applied to the
+* rows below it all at once with unit stride inner loops, so the block stays
+* in cache while the trailing rows stream past it.  Pivots are checked as in
+* Factor().
+*
+* @param A The symmetric positive definite matrix, replaced by R
+*/
+//------------------------------------------------------------------------------
+void CholeskyFactorization::FactorInPlace(Rmatrix &A)
+{
+   Integer n = A.GetNumRows();
+   if (n != A.GetNumColumns())
+   {
+      std::string errMessage =
+         "Matrix must be square for Cholesky decomposition.";
+      throw UtilityException(errMessage);
+   }
+
+   const Real epsilon = 1.0e-10;
+   bool reportWarning = false;
+   Real tolerance = 0.0;
+   Real *a = (Real*)A.GetDataVector();
+
+   for (Integer kb = 0; kb < n; kb += BLOCK_SIZE)
+   {
+      Integer ke = (kb + BLOCK_SIZE < n ? kb + BLOCK_SIZE : n);
+
+      // Finish the rows of the block
+      for (Integer k = kb; k < ke; ++k)
+      {
+         Real *rowK = a + k * n;
+         Real dsum = rowK[k];
+         // The original diagonal, before the updates from the rows above
+         Real original = dsum;
+         for (Integer i = 0; i < k; ++i)
+            original += a[i * n + k] * a[i * n + k];
+         tolerance = GmatMathUtil::Abs(epsilon * original);
+
+         if (dsum <= 0.0)
+         {
+            std::string errMessage =
+               "Matrix must be positive definite for Cholesky decomposition.";
+            throw UtilityException(errMessage);
+         }
+         if (dsum <= tolerance)
+            reportWarning = true;
+
+         Real pivot = GmatMathUtil::Sqrt(dsum);
+         Real inverse = 1.0 / pivot;
+         rowK[k] = pivot;
+         for (Integer j = k + 1; j < n; ++j)
+            rowK[j] *= inverse;
+
+         for (Integer i = k + 1; i < ke; ++i)
+         {
+            Real *rowI = a + i * n;
+            Real f = rowK[i];
+            if (f != 0.0)
+               for (Integer j = i; j < n; ++j)
+                  rowI[j] -= f * rowK[j];
+         }
+      }
+
+      // Apply the block to the rows below it
+      for (Integer i = ke; i < n; ++i)
+      {
+         Real *rowI = a + i * n;
+         for (Integer k = kb; k < ke; ++k)
+         {
+            const Real *rowK = a + k * n;
+            Real f = rowK[i];
+            if (f != 0.0)
+               for (Integer j = i; j < n; ++j)
+                  rowI[j] -= f * rowK[j];
+         }
+      }
+   }
+
+   for (Integer i = 1; i < n; ++i)
+      for (Integer j = 0; j < i; ++j)
+         a[i * n + j] = 0.0;
+
+   if (reportWarning)
+   {
+      MessageInterface::ShowMessage("**** WARNING **** Cholesky "
+         "factorization calculated one or more squared diagonal elements "
+         "of the factored matrix below the tolerance %.2e.  Diagonal "
+         "elements were still calculated normally by square roots, but "
+         "may have become very small in magnitude.\n", tolerance);
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // void CholeskyFactorization::Invert(Rmatrix &inputMatrix)
 //------------------------------------------------------------------------------
@@ -379,7 +482,7 @@ Integer CholeskyFactorization::Invert(Real* sum1, Integer array_size)
             sum1[j - 1] = dPivot;
             dPivot = 1.0 / dPivot;
          }
-         else if (dsum < 0.0)
+         else
          {
             std::string errMessage =
                "Matrix must be positive definite for Cholesky decomposition.";
@@ -47,10 +47,14 @@ public:
    virtual void Factor(const Rmatrix &inputMatrix, Rmatrix &R,
                        Rmatrix &blankMatrix);
    virtual void Factor(const Rmatrix &inputMatrix, Rmatrix &R);
+   void FactorInPlace(Rmatrix &A);
    virtual void Invert(Rmatrix &inputMatrix);
    virtual Integer Invert(Real* sum1, Integer array_size);
 
 private:
+   /// Rows factored together in FactorInPlace()
+   static const Integer BLOCK_SIZE = 32;
+
    /// Number of rows in input matrix
    Integer rowCount;
    /// Various indexes used in arrays along with error counters
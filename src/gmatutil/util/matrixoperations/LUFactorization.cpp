@@ -33,6 +33,9 @@
 #include "QRFactorization.hpp"
 #include "UtilityException.hpp"
 #include <iostream>
+#include <algorithm>        // for std::swap
+
+const Integer LUFactorization::BLOCK_SIZE;
 
 //------------------------------------------------------------------------------
 // LUFactorization(bool pivotOption)
@@ -198,6 +201,7 @@ void LUFactorization::Factor(const Rmatrix &inputMatrix, Rmatrix &L, Rmatrix &U)
                }
             }
          }
+         delete [] rows;
       }
    }
 
@@ -274,7 +278,12 @@ void LUFactorization::Invert(Rmatrix &inputMatrix)
       throw UtilityException(errMessage);
    }
 
-   determinant = Determinant(inputMatrix);
+   CopyToWorkspace(inputMatrix);
+   Integer sign = FactorInPlace(luWork, pivotWork);
+
+   determinant = sign;
+   for (Integer i = 0; i < rowCount; ++i)
+      determinant *= luWork(i, i);
 
    if (determinant == 0)
    {
@@ -283,71 +292,18 @@ void LUFactorization::Invert(Rmatrix &inputMatrix)
       throw UtilityException(errMessage);
    }
 
-   Rmatrix L(inputMatrix.GetNumRows(), inputMatrix.GetNumColumns());
-   Rmatrix U(inputMatrix.GetNumRows(), inputMatrix.GetNumColumns());
-   Factor(inputMatrix, L, U);
-
-   Rvector y(colCount); //Intermediate column vector
-   Real yHold;
-
-   for (Integer colNum = 0; colNum < colCount; ++colNum)
-   {
-      for (Integer i = 0; i < colCount; ++i)
-      {
-         if (i != colNum)
-            y[i] = 0;
-         else
-            y[i] = 1;
-      }
-
-      if (usePivot)
-      {
-         for (Integer k = 0; k < inputMatrix.GetNumRows() - 1; ++k)
-         {
-            yHold = y[k];
-            y[k] = y[(Integer)permuVector[k]];
-            y[(Integer)permuVector[k]] = yHold;
-            for (Integer i = k + 1; i < inputMatrix.GetNumRows(); ++i)
-            {
-               if (i <= k)
-                  y[i] -= y[k] * U(i, k);
-               else
-                  y[i] -= y[k] * L(i, k);
-            }
-         }
-      }
-
-      if (!usePivot)
-      {
-         for (Integer i = 0; i < colCount; ++i)
-         {
-            if (i != 0)
-            {
-               for (Integer j = 0; j < i; ++j)
-                  y[i] -= L(i, j) * y[j];
-            }
-         }
-      }
-
-      for (Integer i = 0; i < colCount; ++i)
-      {
-         inputMatrix(i, colNum) = y[i];
-      }
-
-      for (Integer i = colCount - 1; i >= 0; --i)
-      {
-         for (Integer j = i + 1; j < colCount; ++j)
-            inputMatrix(i, colNum) -= U(i, j) * inputMatrix(j, colNum);
-
-         inputMatrix(i, colNum) = inputMatrix(i, colNum) / U(i, i);
-      }
-   }
-
+   // Solve LU X = P I for all of the columns at once
+   Real *invData = (Real*)inputMatrix.GetDataVector();
+   for (Integer i = 0; i < rowCount * colCount; ++i)
+      invData[i] = 0.0;
+   for (Integer i = 0; i < rowCount; ++i)
+      invData[i * colCount + i] = 1.0;
+   SolveInPlace(luWork, pivotWork, inputMatrix);
 }
 
 
 //------------------------------------------------------------------------------
-// void SolveSystem(const Rmatrix inputMatrix, Rvector b, Rvector &x)
+// void SolveSystem(const Rmatrix &inputMatrix, const Rvector &b, Rvector &x)
 //------------------------------------------------------------------------------
 /**
 * Method used to solve system of equations using LU factorization (Ax = b).  For
@@ -361,64 +317,24 @@ void LUFactorization::Invert(Rmatrix &inputMatrix)
 * @param x Column vector containing solution values to solve system of equations
 */
 //------------------------------------------------------------------------------
-void LUFactorization::SolveSystem(const Rmatrix inputMatrix, Rvector b, Rvector &x)
+void LUFactorization::SolveSystem(const Rmatrix &inputMatrix, const Rvector &b,
+                                  Rvector &x)
 {
    if (inputMatrix.GetNumRows() == inputMatrix.GetNumColumns())
    {
-      // Use algorithms 3.1.1 and 3.1.2
-      Rmatrix L(inputMatrix.GetNumRows(), inputMatrix.GetNumColumns());
-      Rmatrix U(inputMatrix.GetNumRows(), inputMatrix.GetNumColumns());
-      Factor(inputMatrix, L, U);
-      Real bHold;
-
-      Rvector y(colCount); //Intermediate column vector
-      Real* UData = (Real*)U.GetDataVector();
-      Real* LData = (Real*)L.GetDataVector();
-
-      if (usePivot)
-      {
-         for (Integer k = 0; k < rowCount - 1; ++k)
-         {
-            bHold = b[k];
-            b[k] = b[(Integer)permuVector[k]];
-            b[(Integer)permuVector[k]] = bHold;
-            for (Integer i = k + 1; i < rowCount; ++i)
-            {
-               if (i <= k)
-                  b[i] -= b[k] * UData[i * colCount + k];
-               else
-                  b[i] -= b[k] * LData[i * colCount + k];
-            }
-         }
-      }
-
-      for (Integer i = 0; i < colCount; ++i)
-         y[i] = b[i];
-
-      if (!usePivot)
-      {
+      // Use algorithms 3.1.1 and 3.1.2 on the blocked in place factors
+      CopyToWorkspace(inputMatrix);
+      FactorInPlace(luWork, pivotWork);
+
+      if (x.GetSize() != colCount)
+         x.SetSize(colCount);
+      const Real *bData = b.GetDataVector();
+      Real *xData = (Real*)x.GetDataVector();
+      if (xData != bData)
          for (Integer i = 0; i < colCount; ++i)
-         {
-            if (i != 0)
-            {
-               for (Integer j = 0; j < i; ++j)
-                  y[i] -= LData[i * colCount + j] * y[j];
-            }
-         }
-      }
-
-      for (Integer i = 0; i < colCount; ++i)
-      {
-         x[i] = y[i];
-      }
-
-      for (Integer i = colCount - 1; i >= 0; --i)
-      {
-         for (Integer j = i + 1; j < colCount; ++j)
-            x[i] -= UData[i * colCount + j] * x[j];
+            xData[i] = bData[i];
 
-         x[i] = x[i] / U(i, i);
-      }
+      SolveInPlace(luWork, pivotWork, x);
    }
 
    else
@@ -428,8 +344,8 @@ void LUFactorization::SolveSystem(const Rmatrix inputMatrix, Rvector b, Rvector
          Rmatrix Q(inputMatrix.GetNumRows(), inputMatrix.GetNumRows());
          Rmatrix R(inputMatrix.GetNumRows(), inputMatrix.GetNumColumns());
 
-         QRFactorization *qr = new QRFactorization(usePivot);
-         qr->Factor(inputMatrix, R, Q);
+         QRFactorization qr(usePivot);
+         qr.Factor(inputMatrix, R, Q);
 
          Rvector y(b.GetSize());
          Rmatrix QTrans = Q.Transpose();
@@ -460,7 +376,7 @@ void LUFactorization::SolveSystem(const Rmatrix inputMatrix, Rvector b, Rvector
             x[i] = x[i] / RData[i *RColCount + i];
          }
 
-         Rmatrix paramMatrix = qr->GetParameterMatrix();
+         Rmatrix paramMatrix = qr.GetParameterMatrix();
          Rvector xcopy = x;
 
          for (Integer i = 0; i < paramMatrix.GetNumRows(); ++i)
@@ -480,8 +396,8 @@ void LUFactorization::SolveSystem(const Rmatrix inputMatrix, Rvector b, Rvector
          Rmatrix Q(inputMatrix.GetNumColumns(), inputMatrix.GetNumColumns());
          Rmatrix R(inputMatrix.GetNumColumns(), inputMatrix.GetNumRows());
 
-         QRFactorization *qr = new QRFactorization(usePivot);
-         qr->Factor(inputMatrix.Transpose(), R, Q);
+         QRFactorization qr(usePivot);
+         qr.Factor(inputMatrix.Transpose(), R, Q);
 
          Rvector y(inputMatrix.GetNumRows());
          Rmatrix partR(inputMatrix.GetNumRows(), inputMatrix.GetNumRows());
@@ -512,7 +428,7 @@ void LUFactorization::SolveSystem(const Rmatrix inputMatrix, Rvector b, Rvector
                x[i] += Q(i, j) * y[j];
          }
 
-         Rmatrix paramMatrix = qr->GetParameterMatrix();
+         Rmatrix paramMatrix = qr.GetParameterMatrix();
          Rvector xcopy = x;
 
          for (Integer i = 0; i < paramMatrix.GetNumRows(); ++i)
@@ -530,27 +446,296 @@ void LUFactorization::SolveSystem(const Rmatrix inputMatrix, Rvector b, Rvector
 }
 
 //------------------------------------------------------------------------------
-// Real GetDeterminant(Rmatrix A)
+// Real Determinant(const Rmatrix &A)
 //------------------------------------------------------------------------------
 /**
 * Method that determines the determinant of a square matrix
 *
+* The sign is taken from the row interchanges made while factoring.
+*
 * @param A The square matrix a determinant will be calculated for
 *
 * @return det The determinant of the matrix
 */
 //------------------------------------------------------------------------------
-Real LUFactorization::Determinant(Rmatrix A)
+Real LUFactorization::Determinant(const Rmatrix &A)
 {
-   Rmatrix L(A.GetNumRows(), A.GetNumColumns());
-   Rmatrix U(A.GetNumRows(), A.GetNumColumns());
+   if (A.GetNumRows() != A.GetNumColumns())
+   {
+      std::string errMessage =
+         "The matrix must be square to calculate its determinant.\n";
+      throw UtilityException(errMessage);
+   }
 
-   Factor(A, L, U);
-   Real det = U(0,0);
+   CopyToWorkspace(A);
+   Real det = FactorInPlace(luWork, pivotWork);
 
-   for (Integer i = 1; i < U.GetNumRows(); ++i)
-      det = det*U(i, i);
-   det = det*pow(-1, U.GetNumRows());
+   for (Integer i = 0; i < rowCount; ++i)
+      det = det*luWork(i, i);
 
    return det;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FactorInPlace(Rmatrix &A, IntegerArray &pivots)
+//------------------------------------------------------------------------------
+/**
+* Factors a square matrix in place, PA = LU, without allocating memory once
+* pivots is sized.
+*
+* The unit lower triangle L is stored below the diagonal of A and U on and
+* above it.  Entire rows are interchanged, so row k was swapped with row
+* pivots[k] at step k.  The columns are factored in panels of BLOCK_SIZE; the
+* rest of the matrix is updated once per panel rather than once per column,
+* with unit stride inner loops, so the panel rows stay in cache while the
+* trailing rows stream past them.  A zero pivot is left on the diagonal and
+* its column is not eliminated.
+*
+* @param A The matrix, replaced by its factors
+* @param pivots The row interchanges, resized to the matrix size if needed
+*
+* @return The sign of the permutation, +1 or -1
+*/
+//------------------------------------------------------------------------------
+Integer LUFactorization::FactorInPlace(Rmatrix &A, IntegerArray &pivots)
+{
+   Integer n = A.GetNumRows();
+   if (n != A.GetNumColumns())
+   {
+      std::string errMessage =
+         "The matrix must be square for in place LU factorization.\n";
+      throw UtilityException(errMessage);
+   }
+
+   if ((Integer)pivots.size() != n)
+      pivots.resize(n);
+
+   Real *a = (Real*)A.GetDataVector();
+   Integer sign = 1;
+
+   for (Integer kb = 0; kb < n; kb += BLOCK_SIZE)
+   {
+      Integer ke = (kb + BLOCK_SIZE < n ? kb + BLOCK_SIZE : n);
+
+      // Factor the panel of columns kb to ke - 1
+      for (Integer k = kb; k < ke; ++k)
+      {
+         Integer p = k;
+         if (usePivot)
+         {
+            Real maxElement = std::abs(a[k * n + k]);
+            for (Integer i = k + 1; i < n; ++i)
+            {
+               if (std::abs(a[i * n + k]) > maxElement)
+               {
+                  maxElement = std::abs(a[i * n + k]);
+                  p = i;
+               }
+            }
+            if (p != k)
+            {
+               for (Integer j = 0; j < n; ++j)
+                  std::swap(a[k * n + j], a[p * n + j]);
+               sign = -sign;
+            }
+         }
+         pivots[k] = p;
+
+         const Real *rowK = a + k * n;
+         if (rowK[k] == 0.0)
+            continue;
+
+         for (Integer i = k + 1; i < n; ++i)
+         {
+            Real *rowI = a + i * n;
+            Real l = rowI[k] / rowK[k];
+            rowI[k] = l;
+            for (Integer j = k + 1; j < ke; ++j)
+               rowI[j] -= l * rowK[j];
+         }
+      }
+
+      if (ke == n)
+         break;
+
+      // The panel rows of U right of the panel, from its unit lower triangle
+      for (Integer k = kb; k < ke; ++k)
+      {
+         const Real *rowK = a + k * n;
+         for (Integer i = k + 1; i < ke; ++i)
+         {
+            Real *rowI = a + i * n;
+            Real l = rowI[k];
+            if (l != 0.0)
+               for (Integer j = ke; j < n; ++j)
+                  rowI[j] -= l * rowK[j];
+         }
+      }
+
+      // The trailing rows, less the product of the panel's L and U parts;
+      // two rows of U are applied per pass over each trailing row
+      for (Integer i = ke; i < n; ++i)
+      {
+         Real *rowI = a + i * n;
+         Integer k = kb;
+         for (; k + 1 < ke; k += 2)
+         {
+            Real l0 = rowI[k], l1 = rowI[k + 1];
+            const Real *rowK0 = a + k * n;
+            const Real *rowK1 = rowK0 + n;
+            for (Integer j = ke; j < n; ++j)
+               rowI[j] -= l0 * rowK0[j] + l1 * rowK1[j];
+         }
+         if (k < ke)
+         {
+            Real l = rowI[k];
+            const Real *rowK = a + k * n;
+            for (Integer j = ke; j < n; ++j)
+               rowI[j] -= l * rowK[j];
+         }
+      }
+   }
+
+   return sign;
+}
+
+
+//------------------------------------------------------------------------------
+// void SolveInPlace(const Rmatrix &LU, const IntegerArray &pivots,
+//                   Rvector &b) const
+//------------------------------------------------------------------------------
+/**
+* Solves Ax = b from the factors made by FactorInPlace()
+*
+* @param LU The factors of A
+* @param pivots The row interchanges of the factors
+* @param b The right hand side, replaced by the solution
+*/
+//------------------------------------------------------------------------------
+void LUFactorization::SolveInPlace(const Rmatrix &LU,
+      const IntegerArray &pivots, Rvector &b) const
+{
+   Integer n = LU.GetNumRows();
+   if ((b.GetSize() != n) || ((Integer)pivots.size() != n))
+   {
+      std::string errMessage = "The right hand side or the pivots do not "
+         "match the size of the LU factors.\n";
+      throw UtilityException(errMessage);
+   }
+
+   const Real *lu = LU.GetDataVector();
+   Real *x = (Real*)b.GetDataVector();
+
+   for (Integer k = 0; k < n; ++k)
+      if (pivots[k] != k)
+         std::swap(x[k], x[pivots[k]]);
+
+   for (Integer i = 1; i < n; ++i)
+   {
+      const Real *rowI = lu + i * n;
+      Real sum = x[i];
+      for (Integer j = 0; j < i; ++j)
+         sum -= rowI[j] * x[j];
+      x[i] = sum;
+   }
+
+   for (Integer i = n - 1; i >= 0; --i)
+   {
+      const Real *rowI = lu + i * n;
+      Real sum = x[i];
+      for (Integer j = i + 1; j < n; ++j)
+         sum -= rowI[j] * x[j];
+      x[i] = sum / rowI[i];
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SolveInPlace(const Rmatrix &LU, const IntegerArray &pivots,
+//                   Rmatrix &B) const
+//------------------------------------------------------------------------------
+/**
+* Solves AX = B from the factors made by FactorInPlace(), for all of the
+* columns of B together, a row at a time
+*
+* @param LU The factors of A
+* @param pivots The row interchanges of the factors
+* @param B The right hand sides, replaced by the solutions
+*/
+//------------------------------------------------------------------------------
+void LUFactorization::SolveInPlace(const Rmatrix &LU,
+      const IntegerArray &pivots, Rmatrix &B) const
+{
+   Integer n = LU.GetNumRows();
+   Integer m = B.GetNumColumns();
+   if ((B.GetNumRows() != n) || ((Integer)pivots.size() != n))
+   {
+      std::string errMessage = "The right hand side or the pivots do not "
+         "match the size of the LU factors.\n";
+      throw UtilityException(errMessage);
+   }
+
+   const Real *lu = LU.GetDataVector();
+   Real *x = (Real*)B.GetDataVector();
+
+   for (Integer k = 0; k < n; ++k)
+      if (pivots[k] != k)
+         for (Integer j = 0; j < m; ++j)
+            std::swap(x[k * m + j], x[pivots[k] * m + j]);
+
+   for (Integer i = 1; i < n; ++i)
+   {
+      Real *rowX = x + i * m;
+      for (Integer k = 0; k < i; ++k)
+      {
+         Real l = lu[i * n + k];
+         if (l == 0.0)
+            continue;
+         const Real *rowK = x + k * m;
+         for (Integer j = 0; j < m; ++j)
+            rowX[j] -= l * rowK[j];
+      }
+   }
+
+   for (Integer i = n - 1; i >= 0; --i)
+   {
+      Real *rowX = x + i * m;
+      for (Integer k = i + 1; k < n; ++k)
+      {
+         Real u = lu[i * n + k];
+         if (u == 0.0)
+            continue;
+         const Real *rowK = x + k * m;
+         for (Integer j = 0; j < m; ++j)
+            rowX[j] -= u * rowK[j];
+      }
+      Real diag = lu[i * n + i];
+      for (Integer j = 0; j < m; ++j)
+         rowX[j] /= diag;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void CopyToWorkspace(const Rmatrix &A)
+//------------------------------------------------------------------------------
+/**
+* Copies a matrix into the factor workspace, resizing it only if the size has
+* changed
+*
+* @param A The matrix
+*/
+//------------------------------------------------------------------------------
+void LUFactorization::CopyToWorkspace(const Rmatrix &A)
+{
+   rowCount = A.GetNumRows();
+   colCount = A.GetNumColumns();
+   if ((luWork.GetNumRows() != rowCount) || (luWork.GetNumColumns() != colCount))
+      luWork.SetSize(rowCount, colCount);
+
+   const Real *from = A.GetDataVector();
+   Real *to = (Real*)luWork.GetDataVector();
+   for (Integer i = 0; i < rowCount * colCount; ++i)
+      to[i] = from[i];
 }
\ No newline at end of file
@@ -47,10 +47,20 @@ public:
 
    void Factor(const Rmatrix &inputMatrix, Rmatrix &L, Rmatrix &U);
    void Invert(Rmatrix &inputMatrix);
-   void SolveSystem(const Rmatrix inputMatrix, Rvector b, Rvector &x);
-   Real Determinant(Rmatrix A);
+   void SolveSystem(const Rmatrix &inputMatrix, const Rvector &b, Rvector &x);
+   Real Determinant(const Rmatrix &A);
+
+   // In place methods for square matrices, working on caller owned storage
+   Integer FactorInPlace(Rmatrix &A, IntegerArray &pivots);
+   void SolveInPlace(const Rmatrix &LU, const IntegerArray &pivots,
+                     Rvector &b) const;
+   void SolveInPlace(const Rmatrix &LU, const IntegerArray &pivots,
+                     Rmatrix &B) const;
 
 private:
+   /// Columns factored together in FactorInPlace()
+   static const Integer BLOCK_SIZE = 32;
+
    /// Number of rows in input matrix
    int rowCount;
    /// Number of columns in input matrix
@@ -61,5 +71,11 @@ private:
    bool usePivot;
    /// Permutation vector representing which rows are switched during pivoting
    Rvector permuVector;
+   /// Factors used by Invert(), SolveSystem() and Determinant()
+   Rmatrix luWork;
+   /// Row interchanges of luWork
+   IntegerArray pivotWork;
+
+   void CopyToWorkspace(const Rmatrix &A);
 };
 #endif
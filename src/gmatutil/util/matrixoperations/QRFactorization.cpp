@@ -343,8 +343,8 @@ void QRFactorization::Factor(const Rmatrix &A, Rmatrix &R, Rmatrix &Q)
 }
 
 //------------------------------------------------------------------------------
-// void RemoveFromQR(const Rmatrix R, const Rmatrix Q,
-// std::string dimensionToRemove, Integer locationToRemove, Rmatrix &R1,
+// void RemoveFromQR(const Rmatrix &R, const Rmatrix &Q,
+// const std::string &dimensionToRemove, Integer locationToRemove, Rmatrix &R1,
 // Rmatrix &Q1)
 //------------------------------------------------------------------------------
 /**
@@ -360,16 +360,19 @@ void QRFactorization::Factor(const Rmatrix &A, Rmatrix &R, Rmatrix &Q)
 *        factored matrix should be removed
 * @param &R1 New upper triangular matrix after removing row/column from A
 * @param &Q1 New orthogonal matrix after removing row/column from A
+*
+* R1 and Q1 must not be R or Q; a caller replacing its factors can move them
+* into temporaries and pass the originals as R1 and Q1.
 */
 //------------------------------------------------------------------------------
-void QRFactorization::RemoveFromQR(Rmatrix R, Rmatrix Q,
-   std::string dimensionToRemove, Integer locationToRemove, Rmatrix &R1,
-   Rmatrix &Q1)
+void QRFactorization::RemoveFromQR(const Rmatrix &R, const Rmatrix &Q,
+   const std::string &dimensionToRemove, Integer locationToRemove,
+   Rmatrix &R1, Rmatrix &Q1)
 {
    Rmatrix H;
    m = R.GetNumRows();
    n = R.GetNumColumns();
-   Real* RData = (Real*)R.GetDataVector();
+   const Real* RData = R.GetDataVector();
 
    if (locationToRemove < 0)
    {
@@ -528,9 +531,9 @@ void QRFactorization::RemoveFromQR(Rmatrix R, Rmatrix Q,
 }
 
 //------------------------------------------------------------------------------
-// void AddToQR(const Rmatrix R, const Rmatrix Q,
-// std::string dimensionToRemove, Integer locationToRemove, Rmatrix &R1,
-// Rmatrix &Q1)
+// void AddToQR(const Rmatrix &R, const Rmatrix &Q,
+// const std::string &dimensionToInsert, Integer locationToInsert,
+// const Rvector &newElements, Rmatrix &R1, Rmatrix &Q1)
 //------------------------------------------------------------------------------
 /**
 * Method used to update the QR factorization of a matrix by adding a row or
@@ -543,13 +546,17 @@ void QRFactorization::RemoveFromQR(Rmatrix R, Rmatrix Q,
 *        "row") or column (entered as "col") should be added
 * @param locationToInsert Index of which row/column from the original
 *        factored matrix should be added
+* @param newElements The row or column that is added
 * @param &R1 New upper triangular matrix after removing row/column from A
 * @param &Q1 New orthogonal matrix after removing row/column from A
+*
+* R1 and Q1 must not be R or Q; a caller replacing its factors can move them
+* into temporaries and pass the originals as R1 and Q1.
 */
 //------------------------------------------------------------------------------
-void QRFactorization::AddToQR(Rmatrix R, Rmatrix Q,
-   std::string dimensionToInsert, Integer locationToInsert,
-   Rvector newElements, Rmatrix &R1, Rmatrix &Q1)
+void QRFactorization::AddToQR(const Rmatrix &R, const Rmatrix &Q,
+   const std::string &dimensionToInsert, Integer locationToInsert,
+   const Rvector &newElements, Rmatrix &R1, Rmatrix &Q1)
 {
    if (locationToInsert < 0)
    {
@@ -564,8 +571,8 @@ void QRFactorization::AddToQR(Rmatrix R, Rmatrix Q,
    Real qElemHold = 0;
    Q1 = Q;
 
-   Real* RData = (Real*)R.GetDataVector();
-   Real* QData = (Real*)Q.GetDataVector();
+   const Real* RData = R.GetDataVector();
+   const Real* QData = Q.GetDataVector();
 
 
    if (dimensionToInsert == "col")
@@ -736,6 +743,87 @@ void QRFactorization::AddToQR(Rmatrix R, Rmatrix Q,
    }
 }
 
+//------------------------------------------------------------------------------
+// void Triangularize(Rmatrix &A, Integer columnCount, Integer rowCount)
+//------------------------------------------------------------------------------
+/**
+* Method used to reduce a matrix to upper triangular form in place with
+* Householder reflections, based on algorithm 5.2.1 from Gene H. Golub and
+* Charles F. Van Loan.  Q is not formed and no pivoting is used.
+*
+* Only the first columnCount columns are zeroed below the diagonal.  The
+* remaining columns, such as the right hand side of a least squares problem,
+* are transformed with them, so the rows below the triangle are left holding
+* the transformed right hand side.  The diagonal is made nonnegative, as in
+* Factor().  Columns that are already zero below the diagonal are skipped, so
+* sparse rows only cost the work of their nonzero columns.
+*
+* @param A The matrix that is triangularized
+* @param columnCount Number of leading columns to triangularize, or -1 for
+*        all of them
+* @param rowCount Number of leading rows that are used, or -1 for all of
+*        them; the rows below it are treated as zero and left unchanged
+*/
+//------------------------------------------------------------------------------
+void QRFactorization::Triangularize(Rmatrix &A, Integer columnCount,
+   Integer rowCount)
+{
+   Integer cols = A.GetNumColumns();
+   Integer rows = A.GetNumRows();
+   if ((rowCount >= 0) && (rowCount < rows))
+      rows = rowCount;
+   if ((columnCount < 0) || (columnCount > cols))
+      columnCount = cols;
+
+   Real *a = (Real*)A.GetDataVector();
+
+   for (Integer j = 0; (j < columnCount) && (j < rows); ++j)
+   {
+      Real *rowJ = a + j * cols;
+
+      Real sigma = 0.0;
+      for (Integer i = j + 1; i < rows; ++i)
+         sigma += a[i * cols + j] * a[i * cols + j];
+
+      if (sigma != 0.0)
+      {
+         // Reflect x = A(j:rows, j) onto beta * e1, with beta opposite in sign
+         // to x(0) so v(0) = x(0) - beta does not cancel
+         Real alpha = rowJ[j];
+         Real norm = sqrt(alpha * alpha + sigma);
+         Real beta = (alpha > 0.0 ? -norm : norm);
+         Real v0 = alpha - beta;
+         // H y = y + v (v^T y) / (beta v0), since v^T v = -2 beta v0
+         Real scale = 1.0 / (beta * v0);
+
+         for (Integer k = j + 1; k < cols; ++k)
+         {
+            Real dot = v0 * rowJ[k];
+            for (Integer i = j + 1; i < rows; ++i)
+               dot += a[i * cols + j] * a[i * cols + k];
+
+            Real f = dot * scale;
+            if (f == 0.0)
+               continue;
+
+            rowJ[k] += f * v0;
+            for (Integer i = j + 1; i < rows; ++i)
+               a[i * cols + k] += f * a[i * cols + j];
+         }
+
+         rowJ[j] = beta;
+         for (Integer i = j + 1; i < rows; ++i)
+            a[i * cols + j] = 0.0;
+      }
+
+      if (rowJ[j] < 0.0)
+      {
+         for (Integer k = j; k < cols; ++k)
+            rowJ[k] = -rowJ[k];
+      }
+   }
+}
+
 //------------------------------------------------------------------------------
 // void Invert(Rmatrix &inputMatrix)
 //------------------------------------------------------------------------------
@@ -878,7 +966,7 @@ void QRFactorization::Givens(const Real &el1, const Real &el2)
 }
 
 //------------------------------------------------------------------------------
-// Real Determinant(Rmatrix A)
+// Real Determinant(const Rmatrix &A)
 //------------------------------------------------------------------------------
 /**
 * Method that determines the determinant of a square matrix
@@ -888,14 +976,10 @@ void QRFactorization::Givens(const Real &el1, const Real &el2)
 * @return det The determinant of the matrix
 */
 //------------------------------------------------------------------------------
-Real QRFactorization::Determinant(Rmatrix A)
+Real QRFactorization::Determinant(const Rmatrix &A)
 {
-   Real det;
-
-   LUFactorization *lu = new LUFactorization();
-   det = lu->Determinant(A);
-
-   return det;
+   LUFactorization lu;
+   return lu.Determinant(A);
 }
 
 //------------------------------------------------------------------------------
@@ -44,12 +44,16 @@ public:
    QRFactorization& operator=(const QRFactorization &qrfactorization);
 
    void Factor(const Rmatrix &A, Rmatrix &R, Rmatrix &Q);
-   void RemoveFromQR(Rmatrix R, Rmatrix Q,
-      std::string dimensionToRemove, Integer locationToRemove, Rmatrix &R1, Rmatrix &Q1);
-   void AddToQR(Rmatrix R, Rmatrix Q,
-      std::string dimensionToInsert, Integer locationToInsert, Rvector newElements, Rmatrix &R1, Rmatrix &Q1);
+   void RemoveFromQR(const Rmatrix &R, const Rmatrix &Q,
+      const std::string &dimensionToRemove, Integer locationToRemove,
+      Rmatrix &R1, Rmatrix &Q1);
+   void AddToQR(const Rmatrix &R, const Rmatrix &Q,
+      const std::string &dimensionToInsert, Integer locationToInsert,
+      const Rvector &newElements, Rmatrix &R1, Rmatrix &Q1);
+   void Triangularize(Rmatrix &A, Integer columnCount = -1,
+      Integer rowCount = -1);
    void Invert(Rmatrix &inputMatrix);
-   Real Determinant(Rmatrix A);
+   Real Determinant(const Rmatrix &A);
    Rmatrix GetParameterMatrix();
 
 private:
@@ -0,0 +1,502 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             SymmetricMatrix
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the SymmetricMatrix class.
+ */
+//------------------------------------------------------------------------------
+
+#include "SymmetricMatrix.hpp"
+#include "CholeskyFactorization.hpp"
+#include "RealUtilities.hpp"
+#include "UtilityException.hpp"
+#include "MessageInterface.hpp"
+
+//------------------------------------------------------------------------------
+// SymmetricMatrix()
+//------------------------------------------------------------------------------
+/**
+ * Constructor for an unsized matrix
+ */
+//------------------------------------------------------------------------------
+SymmetricMatrix::SymmetricMatrix() :
+   size        (0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// SymmetricMatrix(Integer size)
+//------------------------------------------------------------------------------
+/**
+ * Constructor for a zero matrix
+ *
+ * @param size The number of rows and columns
+ */
+//------------------------------------------------------------------------------
+SymmetricMatrix::SymmetricMatrix(Integer size) :
+   size        (0)
+{
+   SetSize(size);
+}
+
+
+//------------------------------------------------------------------------------
+// SymmetricMatrix(const Rmatrix &mat)
+//------------------------------------------------------------------------------
+/**
+ * Constructor that packs the upper triangle of a square Rmatrix
+ *
+ * @param mat The matrix to pack; its lower triangle is not read
+ */
+//------------------------------------------------------------------------------
+SymmetricMatrix::SymmetricMatrix(const Rmatrix &mat) :
+   size        (0)
+{
+   Set(mat);
+}
+
+
+//------------------------------------------------------------------------------
+// SymmetricMatrix(const SymmetricMatrix &sm)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ */
+//------------------------------------------------------------------------------
+SymmetricMatrix::SymmetricMatrix(const SymmetricMatrix &sm) :
+   size        (sm.size),
+   elements    (sm.elements)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// SymmetricMatrix& operator=(const SymmetricMatrix &sm)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ */
+//------------------------------------------------------------------------------
+SymmetricMatrix& SymmetricMatrix::operator=(const SymmetricMatrix &sm)
+{
+   if (this != &sm)
+   {
+      size     = sm.size;
+      elements = sm.elements;
+   }
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// ~SymmetricMatrix()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+SymmetricMatrix::~SymmetricMatrix()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void SetSize(Integer size)
+//------------------------------------------------------------------------------
+/**
+ * Sizes the matrix and sets every element to zero
+ *
+ * @param size The number of rows and columns
+ */
+//------------------------------------------------------------------------------
+void SymmetricMatrix::SetSize(Integer size)
+{
+   if (size < 0)
+      throw UtilityException("SymmetricMatrix size cannot be negative");
+
+   this->size = size;
+   elements.assign(size * (size + 1) / 2, 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetSize() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of rows and columns
+ */
+//------------------------------------------------------------------------------
+Integer SymmetricMatrix::GetSize() const
+{
+   return size;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetElementCount() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of stored elements, size * (size + 1) / 2
+ */
+//------------------------------------------------------------------------------
+Integer SymmetricMatrix::GetElementCount() const
+{
+   return (Integer)elements.size();
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsSized() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the matrix has at least one row
+ */
+//------------------------------------------------------------------------------
+bool SymmetricMatrix::IsSized() const
+{
+   return size > 0;
+}
+
+
+//------------------------------------------------------------------------------
+// void Zero()
+//------------------------------------------------------------------------------
+/**
+ * Sets every element to zero, keeping the size
+ */
+//------------------------------------------------------------------------------
+void SymmetricMatrix::Zero()
+{
+   elements.assign(elements.size(), 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// Real& operator()(Integer row, Integer col)
+//------------------------------------------------------------------------------
+/**
+ * Element access; (row, col) and (col, row) are the same element
+ */
+//------------------------------------------------------------------------------
+Real& SymmetricMatrix::operator()(Integer row, Integer col)
+{
+   if (row > col)
+      return elements[RowStart(col) + row - col];
+   return elements[RowStart(row) + col - row];
+}
+
+
+//------------------------------------------------------------------------------
+// Real operator()(Integer row, Integer col) const
+//------------------------------------------------------------------------------
+/**
+ * Element access; (row, col) and (col, row) are the same element
+ */
+//------------------------------------------------------------------------------
+Real SymmetricMatrix::operator()(Integer row, Integer col) const
+{
+   if (row > col)
+      return elements[RowStart(col) + row - col];
+   return elements[RowStart(row) + col - row];
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetDataVector() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the packed upper triangle, or nullptr for an unsized matrix
+ */
+//------------------------------------------------------------------------------
+const Real* SymmetricMatrix::GetDataVector() const
+{
+   return (elements.empty() ? nullptr : &elements[0]);
+}
+
+
+//------------------------------------------------------------------------------
+// Real* GetDataVector()
+//------------------------------------------------------------------------------
+/**
+ * Returns the packed upper triangle, or nullptr for an unsized matrix
+ */
+//------------------------------------------------------------------------------
+Real* SymmetricMatrix::GetDataVector()
+{
+   return (elements.empty() ? nullptr : &elements[0]);
+}
+
+
+//------------------------------------------------------------------------------
+// SymmetricMatrix& operator+=(const SymmetricMatrix &sm)
+//------------------------------------------------------------------------------
+/**
+ * Adds another symmetric matrix of the same size
+ */
+//------------------------------------------------------------------------------
+SymmetricMatrix& SymmetricMatrix::operator+=(const SymmetricMatrix &sm)
+{
+   if (sm.size != size)
+      throw UtilityException("SymmetricMatrix sizes do not match for "
+            "addition");
+
+   for (UnsignedInt i = 0; i < elements.size(); ++i)
+      elements[i] += sm.elements[i];
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// void AddRankOne(const Real *row, Real weight)
+//------------------------------------------------------------------------------
+/**
+ * Adds row^T * weight * row
+ *
+ * @param row    The size values of the row
+ * @param weight The weight of the row
+ */
+//------------------------------------------------------------------------------
+void SymmetricMatrix::AddRankOne(const Real *row, Real weight)
+{
+   AddRankK(row, &weight, 1);
+}
+
+
+//------------------------------------------------------------------------------
+// void AddRankK(const Real *rows, const Real *weights, Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Adds H^T W H, for count rows of H and a diagonal weight matrix W
+ *
+ * Element (i, j) gets the terms rows[k][i] * rows[k][j] * weights[k] added
+ * one row at a time, in row order, so the result is identical to count calls
+ * to AddRankOne().  The loops run along the packed rows, so the innermost
+ * loop has unit stride in both the matrix and the row of partials.
+ *
+ * @param rows    The rows, count rows of size values one after another
+ * @param weights The weights of the rows
+ * @param count   The number of rows
+ */
+//------------------------------------------------------------------------------
+void SymmetricMatrix::AddRankK(const Real *rows, const Real *weights,
+      Integer count)
+{
+   for (Integer i = 0; i < size; ++i)
+   {
+      // Shifted so that packedRow[j] is element (i, j)
+      Real *packedRow = &elements[RowStart(i)] - i;
+      for (Integer k = 0; k < count; ++k)
+      {
+         const Real *hk = rows + k * size;
+         Real hi = hk[i];
+         Real wk = weights[k];
+         for (Integer j = i; j < size; ++j)
+            packedRow[j] += hi * hk[j] * wk;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void Set(const Rmatrix &mat)
+//------------------------------------------------------------------------------
+/**
+ * Sizes the matrix to a square Rmatrix and packs its upper triangle
+ *
+ * @param mat The matrix to pack; its lower triangle is not read
+ */
+//------------------------------------------------------------------------------
+void SymmetricMatrix::Set(const Rmatrix &mat)
+{
+   Integer n = mat.GetNumRows();
+   if (n != mat.GetNumColumns())
+      throw UtilityException("SymmetricMatrix requires a square matrix");
+
+   SetSize(n);
+   if (n == 0)
+      return;
+
+   const Real *data = mat.GetDataVector();
+   Real *packed = &elements[0];
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = i; j < n; ++j)
+         *packed++ = data[i * n + j];
+}
+
+
+//------------------------------------------------------------------------------
+// void AddTo(Rmatrix &mat) const
+//------------------------------------------------------------------------------
+/**
+ * Adds the matrix to both triangles of a dense Rmatrix of the same size
+ *
+ * @param mat The matrix to add to
+ */
+//------------------------------------------------------------------------------
+void SymmetricMatrix::AddTo(Rmatrix &mat) const
+{
+   if ((mat.GetNumRows() != size) || (mat.GetNumColumns() != size))
+      throw UtilityException("SymmetricMatrix sizes do not match for "
+            "addition");
+
+   Real *data = (Real*)mat.GetDataVector();
+   const Real *packed = GetDataVector();
+   for (Integer i = 0; i < size; ++i)
+   {
+      data[i * size + i] += *packed++;
+      for (Integer j = i + 1; j < size; ++j)
+      {
+         data[i * size + j] += *packed;
+         data[j * size + i] += *packed++;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void GetRmatrix(Rmatrix &mat) const
+//------------------------------------------------------------------------------
+/**
+ * Fills a dense Rmatrix, sizing it if needed, with both triangles
+ *
+ * @param mat The matrix to fill
+ */
+//------------------------------------------------------------------------------
+void SymmetricMatrix::GetRmatrix(Rmatrix &mat) const
+{
+   if ((mat.GetNumRows() != size) || (mat.GetNumColumns() != size))
+      mat.SetSize(size, size);
+   if (size == 0)
+      return;
+
+   Real *data = (Real*)mat.GetDataVector();
+   const Real *packed = GetDataVector();
+   for (Integer i = 0; i < size; ++i)
+      for (Integer j = i; j < size; ++j)
+      {
+         data[i * size + j] = *packed;
+         data[j * size + i] = *packed++;
+      }
+}
+
+
+//------------------------------------------------------------------------------
+// Rmatrix ToRmatrix() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the matrix as a dense Rmatrix
+ */
+//------------------------------------------------------------------------------
+Rmatrix SymmetricMatrix::ToRmatrix() const
+{
+   Rmatrix mat;
+   GetRmatrix(mat);
+   return mat;
+}
+
+
+//------------------------------------------------------------------------------
+// void CholeskyFactor()
+//------------------------------------------------------------------------------
+/**
+ * Cholesky factorization in place, A = R^T R
+ *
+ * The packed elements are replaced by the upper triangular factor R, so
+ * operator() no longer gives a symmetric matrix afterwards.  Each pivot row
+ * is applied to the rows below it along the packed rows.  Pivots are checked
+ * as in CholeskyFactorization::FactorInPlace().
+ */
+//------------------------------------------------------------------------------
+void SymmetricMatrix::CholeskyFactor()
+{
+   const Real epsilon = 1.0e-10;
+   bool reportWarning = false;
+   Real tolerance = 0.0;
+
+   for (Integer k = 0; k < size; ++k)
+   {
+      Real *rowK = &elements[RowStart(k)] - k;
+      Real dsum = rowK[k];
+
+      // The original diagonal, before the updates from the rows above
+      Real original = dsum;
+      for (Integer i = 0; i < k; ++i)
+      {
+         Real rik = elements[RowStart(i) + k - i];
+         original += rik * rik;
+      }
+      tolerance = GmatMathUtil::Abs(epsilon * original);
+
+      if (dsum <= 0.0)
+         throw UtilityException("Matrix must be positive definite for "
+               "Cholesky decomposition.");
+      if (dsum <= tolerance)
+         reportWarning = true;
+
+      Real pivot = GmatMathUtil::Sqrt(dsum);
+      Real inverse = 1.0 / pivot;
+      rowK[k] = pivot;
+      for (Integer j = k + 1; j < size; ++j)
+         rowK[j] *= inverse;
+
+      for (Integer i = k + 1; i < size; ++i)
+      {
+         Real *rowI = &elements[RowStart(i)] - i;
+         Real f = rowK[i];
+         if (f != 0.0)
+            for (Integer j = i; j < size; ++j)
+               rowI[j] -= f * rowK[j];
+      }
+   }
+
+   if (reportWarning)
+   {
+      MessageInterface::ShowMessage("**** WARNING **** Cholesky "
+         "factorization calculated one or more squared diagonal elements "
+         "of the factored matrix below the tolerance %.2e.  Diagonal "
+         "elements were still calculated normally by square roots, but "
+         "may have become very small in magnitude.\n", tolerance);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void Invert()
+//------------------------------------------------------------------------------
+/**
+ * Inverts the matrix in place by Cholesky decomposition
+ *
+ * The packed elements are handed straight to the GEODYN based
+ * CholeskyFactorization::Invert(Real*, Integer), so the inverse is the one
+ * CholeskyFactorization::Invert(Rmatrix&) gives, without its dense copies.
+ */
+//------------------------------------------------------------------------------
+void SymmetricMatrix::Invert()
+{
+   if (size == 0)
+      throw UtilityException("Cannot invert an unsized SymmetricMatrix");
+
+   CholeskyFactorization cf;
+   if (cf.Invert(&elements[0], GetElementCount()) != 0)
+      throw UtilityException("SymmetricMatrix Cholesky inversion failed");
+}
@@ -0,0 +1,92 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             SymmetricMatrix
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2022 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Declares the SymmetricMatrix class.
+ */
+//------------------------------------------------------------------------------
+#ifndef SymmetricMatrix_hpp
+#define SymmetricMatrix_hpp
+
+#include "utildefs.hpp"
+#include "Rmatrix.hpp"
+
+/**
+ * A symmetric matrix kept in packed upper triangular storage.
+ *
+ * Only the n(n+1)/2 elements on and above the diagonal are stored, row by
+ * row, in the layout of MatrixFactorization::PackedArrayIndex() and of the
+ * packed CholeskyFactorization::Invert().  Element (i, j) and (j, i) are the
+ * same storage, so the matrix cannot become unsymmetric and never needs to be
+ * symmetrized.
+ *
+ * The class is meant for normal (information) matrices: rank-k updates add
+ * weighted rows of partials, and the matrix can be Cholesky factored or
+ * inverted in place.  Dense Rmatrix copies are made only where a caller needs
+ * one.
+ */
+class GMATUTIL_API SymmetricMatrix
+{
+public:
+   SymmetricMatrix();
+   SymmetricMatrix(Integer size);
+   SymmetricMatrix(const Rmatrix &mat);
+   SymmetricMatrix(const SymmetricMatrix &sm);
+   SymmetricMatrix& operator=(const SymmetricMatrix &sm);
+   ~SymmetricMatrix();
+
+   void           SetSize(Integer size);
+   Integer        GetSize() const;
+   Integer        GetElementCount() const;
+   bool           IsSized() const;
+   void           Zero();
+
+   Real&          operator()(Integer row, Integer col);
+   Real           operator()(Integer row, Integer col) const;
+   const Real*    GetDataVector() const;
+   Real*          GetDataVector();
+
+   SymmetricMatrix& operator+=(const SymmetricMatrix &sm);
+   void           AddRankOne(const Real *row, Real weight);
+   void           AddRankK(const Real *rows, const Real *weights,
+                           Integer count);
+
+   void           Set(const Rmatrix &mat);
+   void           AddTo(Rmatrix &mat) const;
+   void           GetRmatrix(Rmatrix &mat) const;
+   Rmatrix        ToRmatrix() const;
+
+   void           CholeskyFactor();
+   void           Invert();
+
+protected:
+   /// Number of rows and columns
+   Integer        size;
+   /// The upper triangle, row by row
+   RealArray      elements;
+
+   /// Index in elements of diagonal element (row, row)
+   Integer        RowStart(Integer row) const
+   {
+      return row * size - (row * (row - 1)) / 2;
+   }
+};
+
+#endif // SymmetricMatrix_hpp
@@ -434,6 +434,9 @@ void ResourceTree::ClearResource(bool leaveScripts, bool onlyChildNodes)
 /**
  * Delete all nodes that are not folders, add default nodes
  *
+ * When restartCounter is false and the set of configured objects has not
+ * changed since the last rebuild, the existing nodes are kept as they are.
+ *
  * @param restartCounter  Restarting the counter from zero if true.
  */
 //------------------------------------------------------------------------------
@@ -447,6 +450,19 @@ void ResourceTree::UpdateResource(bool restartCounter, bool onlyChildNodes)
    
    if (restartCounter)
       theGuiInterpreter->ResetConfigurationChanged();
+   else if (!onlyChildNodes && mResourceSignature != "" &&
+            BuildResourceSignature() == mResourceSignature)
+   {
+      #ifdef DEBUG_RESOURCE_TREE_UPDATE
+      MessageInterface::ShowMessage
+         ("ResourceTree::UpdateResource() exiting, configuration unchanged\n");
+      #endif
+      theGuiManager->UpdateAll();
+      return;
+   }
+   
+   // Batch the node changes so the tree repaints once
+   Freeze();
    
    ClearResource(true, onlyChildNodes);
    
@@ -476,12 +492,16 @@ void ResourceTree::UpdateResource(bool restartCounter, bool onlyChildNodes)
    // Alphabetize the variables on load
    SortChildren(mVariableItem);
    theGuiManager->SortUserVariables();
+   
+   Thaw();
    ScrollTo(mSpacecraftItem);
    
    // Why the first item is always selected with WX3?
    // Add Unselect() (LOJ: 2014.09.16)
    Unselect();
    
+   mResourceSignature = BuildResourceSignature();
+   
    #ifdef DEBUG_RESOURCE_TREE_UPDATE
    MessageInterface::ShowMessage("ResourceTree::UpdateResource() exiting\n");
    #endif
@@ -884,6 +904,42 @@ GmatBase* ResourceTree::GetObject(const std::string &name)
 }
 
 
+//------------------------------------------------------------------------------
+// std::string BuildResourceSignature()
+//------------------------------------------------------------------------------
+/**
+ * Builds a string from the names and types of the configured objects and the
+ * solar system bodies in use, so UpdateResource() can tell whether the tree
+ * needs to be rebuilt.
+ */
+//------------------------------------------------------------------------------
+std::string ResourceTree::BuildResourceSignature()
+{
+   std::string signature;
+   
+   SolarSystem *ss = theGuiInterpreter->GetSolarSystemInUse();
+   if (ss != NULL)
+   {
+      StringArray bodies = ss->GetBodiesInUse();
+      for (UnsignedInt i = 0; i < bodies.size(); i++)
+         signature += bodies[i] + "|";
+   }
+   signature += "#";
+   
+   StringArray names = theGuiInterpreter->GetListOfObjects(Gmat::UNKNOWN_OBJECT);
+   for (UnsignedInt i = 0; i < names.size(); i++)
+   {
+      GmatBase *obj = GetObject(names[i]);
+      signature += names[i] + ":";
+      if (obj != NULL)
+         signature += obj->GetTypeName();
+      signature += "|";
+   }
+   
+   return signature;
+}
+
+
 //------------------------------------------------------------------------------
 // void UpdateGuiItem(GmatTree::ItemType itemType)
 //------------------------------------------------------------------------------
@@ -87,6 +87,8 @@ protected:
    bool mHasEventLocatorPlugin;
    wxString mLastScriptAdded;
    wxString mLastActiveScript;
+   /// Configured object names and types at the last tree rebuild
+   std::string mResourceSignature;
    
    // for script error log
    int mBuildErrorCount;
@@ -159,6 +161,7 @@ protected:
                           bool createDefault = false);
    GmatBase* GetObject(const char *name);
    GmatBase* GetObject(const std::string &name);
+   std::string BuildResourceSignature();
    void UpdateGuiItem(GmatTree::ItemType itemType);
    
    // resource tree
@@ -420,6 +420,9 @@ void MissionTree::UpdateMission(bool resetCounter, bool viewAll, bool collapse)
    //    mViewAll = viewAll;
    // }
    
+   // Batch the node changes so the tree repaints once
+   Freeze();
+   
    ClearMission();
    UpdateCommand();
    
@@ -428,6 +431,8 @@ void MissionTree::UpdateMission(bool resetCounter, bool viewAll, bool collapse)
       CollapseAllChildren(mMissionSeqSubId);
       Expand(mMissionSeqSubId);
    }
+   
+   Thaw();
 }
 
 
@@ -1169,12 +1174,14 @@ wxTreeItemId& MissionTree::UpdateCommandTree(wxTreeItemId parent,
        mViewLevel, level);
    #endif
    
+   // Expanding an already expanded node still makes the tree relayout, which
+   // adds up quickly when every command of a long sequence is appended
    if (mUsingViewLevel)
    {
-      if (mViewLevel > level + 1)
+      if (mViewLevel > level + 1 && !IsExpanded(parent))
          Expand(parent);
    }
-   else
+   else if (!IsExpanded(parent))
       Expand(parent);
    
    #if DEBUG_MISSION_TREE
@@ -207,10 +207,11 @@ void DCSetupPanel::Setup( wxWindow *parent)
    styleArray[2] = "Verbose";
    styleArray[3] = "Debug";
    
-   wxString *derivativeMethodArray = new wxString[3];
+   wxString *derivativeMethodArray = new wxString[4];
    derivativeMethodArray[0] = "CentralDifference";
    derivativeMethodArray[1] = "ForwardDifference";
    derivativeMethodArray[2] = "BackwardDifference";
+   derivativeMethodArray[3] = "StateTransitionMatrix";
    
    wxString *algorithmArray = new wxString[3];
    algorithmArray[0] = "NewtonRaphson";
@@ -244,7 +245,7 @@ void DCSetupPanel::Setup( wxWindow *parent)
       new wxStaticText( parent, ID_TEXT, wxT("Derivative Method"), wxDefaultPosition,wxDefaultSize, 0);
    derivativeMethodComboBox =
       new wxComboBox( parent, ID_COMBOBOX, wxT("CentralDifference"), wxDefaultPosition, 
-                      wxSize(200,-1), 3, derivativeMethodArray, wxCB_DROPDOWN|wxCB_READONLY );
+                      wxSize(200,-1), 4, derivativeMethodArray, wxCB_DROPDOWN|wxCB_READONLY );
    
    grid1->Add( algorithmStaticText, 0, wxALIGN_LEFT|wxALL, bsize );
    grid1->Add( algorithmComboBox, 0, wxALIGN_CENTRE|wxALL, bsize);
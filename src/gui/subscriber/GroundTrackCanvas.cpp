@@ -1426,13 +1426,7 @@ void GroundTrackCanvas::DrawGroundTrackLines(Rvector3 &r1, Rvector3 &v1,
       ("   color = [%u, %u, %u]\n", sGlColor->red, sGlColor->green, sGlColor->blue);
    #endif
    
-   // Turn on TEXTURE_2D to dim the color, alpha doen't seem to work!!
-   glEnable(GL_TEXTURE_2D);
-   glColor3ub(sGlColor->red, sGlColor->green, sGlColor->blue);
-   // Why  it doesn't use alpha?
-   //glColor4ub(sGlColor->red, sGlColor->green, sGlColor->blue, 255);
-   glLineWidth(0.5);
-   
+   // The lines are drawn with the other segments in DrawOrbitSegments()
    Real plusLon1 = GmatMathUtil::Mod(lon1, GmatMathConstants::TWO_PI_DEG);
    Real plusLon2 = GmatMathUtil::Mod(lon2, GmatMathConstants::TWO_PI_DEG);
    Real minusLon1 = GmatMathUtil::Mod(lon1, -GmatMathConstants::TWO_PI_DEG);
@@ -1467,8 +1461,10 @@ void GroundTrackCanvas::DrawGroundTrackLines(Rvector3 &r1, Rvector3 &v1,
       MessageInterface::ShowMessage("------> at LHS border, m1=%f, lat3=%f\n", m1, lat3);
       #endif
       
-      DrawLine(lon1, lat1, -GmatMathConstants::PI_DEG, lat3);
-      DrawLine(GmatMathConstants::PI_DEG, lat3, lon2, lat2);
+      AddOrbitSegment(sGlColor, Rvector3(lon1, lat1, 0.0),
+                      Rvector3(-GmatMathConstants::PI_DEG, lat3, 0.0));
+      AddOrbitSegment(sGlColor, Rvector3(GmatMathConstants::PI_DEG, lat3, 0.0),
+                      Rvector3(lon2, lat2, 0.0));
    }
    else if (atRhsBorder)
    {
@@ -1479,8 +1475,10 @@ void GroundTrackCanvas::DrawGroundTrackLines(Rvector3 &r1, Rvector3 &v1,
       MessageInterface::ShowMessage("------> at RHS border, m1=%f, lat3=%f\n", m1, lat3);
       #endif
       
-      DrawLine(lon1, lat1, GmatMathConstants::PI_DEG, lat3);
-      DrawLine(-GmatMathConstants::PI_DEG, lat3, lon2, lat2);
+      AddOrbitSegment(sGlColor, Rvector3(lon1, lat1, 0.0),
+                      Rvector3(GmatMathConstants::PI_DEG, lat3, 0.0));
+      AddOrbitSegment(sGlColor, Rvector3(-GmatMathConstants::PI_DEG, lat3, 0.0),
+                      Rvector3(lon2, lat2, 0.0));
    }
    else
    {
@@ -1488,12 +1486,10 @@ void GroundTrackCanvas::DrawGroundTrackLines(Rvector3 &r1, Rvector3 &v1,
       MessageInterface::ShowMessage("   ------> at normal drawing\n");
       #endif
       
-      DrawLine(lon1, lat1, lon2, lat2);
+      AddOrbitSegment(sGlColor, Rvector3(lon1, lat1, 0.0),
+                      Rvector3(lon2, lat2, 0.0));
    }
    
-   // Turn off TEXTURE_2D to go back to normal light
-   glDisable(GL_TEXTURE_2D);
-   
    #if DEBUG_DRAW_DEBUG
    DrawDebugMessage(" Leaving DrawGroundTrackLines --- ", GmatColor::RED, 0, 500);
    #endif
@@ -1504,6 +1500,27 @@ void GroundTrackCanvas::DrawGroundTrackLines(Rvector3 &r1, Rvector3 &v1,
 }
 
 
+//------------------------------------------------------------------------------
+// void DrawOrbitSegments()
+//------------------------------------------------------------------------------
+/**
+ * Draws the collected ground track lines, dimmed as the lines are drawn
+ * over the central body texture
+ */
+//------------------------------------------------------------------------------
+void GroundTrackCanvas::DrawOrbitSegments()
+{
+   // Turn on TEXTURE_2D to dim the color, alpha doen't seem to work!!
+   glEnable(GL_TEXTURE_2D);
+   glLineWidth(0.5);
+   
+   ViewCanvas::DrawOrbitSegments();
+   
+   // Turn off TEXTURE_2D to go back to normal light
+   glDisable(GL_TEXTURE_2D);
+}
+
+
 //---------------------------------------------------------------------------
 // void DrawGridLines()
 //---------------------------------------------------------------------------
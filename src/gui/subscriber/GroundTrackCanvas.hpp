@@ -161,6 +161,7 @@ private:
    void DrawOrbitLines(int i, const wxString &objName, int obj, int objId);
    void DrawGroundTrackLines(Rvector3 &r1, Rvector3 &v1,
                              Rvector3 &r2, Rvector3 &v2);
+   void DrawOrbitSegments();
    void DrawGridLines();
    void DrawCentralBodyTexture();
    void DrawCircleAt(GlColorType *color, double lon, double lat, double radius,
@@ -44,12 +44,189 @@ BEGIN_EVENT_TABLE(MdiTableViewFrame, GmatMdiChildFrame)
    EVT_SIZE(MdiTableViewFrame::OnSize)
    EVT_MOVE(MdiTableViewFrame::OnMove)
    EVT_CLOSE(MdiTableViewFrame::OnClose) 
+   EVT_TIMER(ID_REFRESH_TIMER, MdiTableViewFrame::OnRefreshTimer)
 END_EVENT_TABLE()
 
 //#define DEBUG_VIEW_FRAME
 //#define DEBUG_MDI_TABLE_FRAME_CLOSE
 //#define DEBUG_PLOT_PERSISTENCY
 
+const int MdiTableViewFrame::REFRESH_INTERVAL = 250;
+
+
+//------------------------------------------------------------------------------
+// SolverGridTable(const wxString &label0, ...)
+//------------------------------------------------------------------------------
+SolverGridTable::SolverGridTable(const wxString &label0, const wxString &label1,
+                                 const wxString &label2, const wxString &label3)
+{
+   colLabels[0] = label0;
+   colLabels[1] = label1;
+   colLabels[2] = label2;
+   colLabels[3] = label3;
+}
+
+
+//------------------------------------------------------------------------------
+// int GetNumberRows()
+//------------------------------------------------------------------------------
+int SolverGridTable::GetNumberRows()
+{
+   return (int)rows.size();
+}
+
+
+//------------------------------------------------------------------------------
+// int GetNumberCols()
+//------------------------------------------------------------------------------
+int SolverGridTable::GetNumberCols()
+{
+   return 4;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsEmptyCell(int row, int col)
+//------------------------------------------------------------------------------
+bool SolverGridTable::IsEmptyCell(int row, int col)
+{
+   if (row < 0 || row >= (int)rows.size() || col < 0 || col > 3)
+      return true;
+   if (col == 0)
+      return false;
+   return rows[row].kind[col-1] == EMPTY_CELL;
+}
+
+
+//------------------------------------------------------------------------------
+// wxString GetValue(int row, int col)
+//------------------------------------------------------------------------------
+/**
+ * Formats a cell on demand; numbers are kept unformatted until displayed.
+ */
+//------------------------------------------------------------------------------
+wxString SolverGridTable::GetValue(int row, int col)
+{
+   if (row < 0 || row >= (int)rows.size() || col < 0 || col > 3)
+      return "";
+   
+   const Row &theRow = rows[row];
+   if (col == 0)
+      return theRow.name.c_str();
+   
+   switch (theRow.kind[col-1])
+   {
+   case NUMBER_CELL:
+      return GmatStringUtil::ToString(theRow.number[col-1]).c_str();
+   case TEXT_CELL:
+      return theRow.text[col-1].c_str();
+   default:
+      return "";
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SetValue(int row, int col, const wxString &value)
+//------------------------------------------------------------------------------
+/**
+ * The grids are read only; values are set through SetNumber() and SetText().
+ */
+//------------------------------------------------------------------------------
+void SolverGridTable::SetValue(int row, int col, const wxString &value)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// wxString GetColLabelValue(int col)
+//------------------------------------------------------------------------------
+wxString SolverGridTable::GetColLabelValue(int col)
+{
+   if (col < 0 || col > 3)
+      return "";
+   return colLabels[col];
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FindOrAddRow(const std::string &name, bool &added)
+//------------------------------------------------------------------------------
+/**
+ * Returns the row for name, appending an empty row if there is none yet.
+ *
+ * The caller tells the grid about an appended row.
+ */
+//------------------------------------------------------------------------------
+Integer SolverGridTable::FindOrAddRow(const std::string &name, bool &added)
+{
+   std::map<std::string, Integer>::iterator found = rowIndex.find(name);
+   if (found != rowIndex.end())
+   {
+      added = false;
+      return found->second;
+   }
+   
+   Row newRow;
+   newRow.name = name;
+   for (Integer i = 0; i < 3; ++i)
+   {
+      newRow.kind[i] = EMPTY_CELL;
+      newRow.number[i] = 0.0;
+   }
+   rows.push_back(newRow);
+   
+   Integer row = (Integer)rows.size() - 1;
+   rowIndex[name] = row;
+   added = true;
+   return row;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetNumber(Integer row, Integer col, Real value)
+//------------------------------------------------------------------------------
+void SolverGridTable::SetNumber(Integer row, Integer col, Real value)
+{
+   rows[row].kind[col-1] = NUMBER_CELL;
+   rows[row].number[col-1] = value;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetText(Integer row, Integer col, const std::string &value)
+//------------------------------------------------------------------------------
+void SolverGridTable::SetText(Integer row, Integer col, const std::string &value)
+{
+   rows[row].kind[col-1] = TEXT_CELL;
+   rows[row].text[col-1] = value;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetNumber(Integer row, Integer col, Real &value)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a numeric cell; returns false if the cell does not hold a number.
+ */
+//------------------------------------------------------------------------------
+bool SolverGridTable::GetNumber(Integer row, Integer col, Real &value)
+{
+   if (rows[row].kind[col-1] != NUMBER_CELL)
+      return false;
+   value = rows[row].number[col-1];
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetText(Integer row, Integer col)
+//------------------------------------------------------------------------------
+std::string SolverGridTable::GetText(Integer row, Integer col)
+{
+   return GetValue(row, col).WX_TO_STD_STRING;
+}
+
 //------------------------------------------------------------------------------
 // MdiTableViewFrame(wxMDIParentFrame *parent, const wxString& title, ...)
 //------------------------------------------------------------------------------
@@ -58,7 +235,8 @@ MdiTableViewFrame::MdiTableViewFrame(wxMDIParentFrame *parent,
                                      const wxPoint& pos, const wxSize& size,
                                      const long style)
                                      : GmatMdiChildFrame(parent, plotName, title, GmatTree::OUTPUT_SOLVER_WINDOW, -1,
-                                       pos, size, style | wxNO_FULL_REPAINT_ON_RESIZE )
+                                       pos, size, style | wxNO_FULL_REPAINT_ON_RESIZE ),
+                                       refreshTimer(this, ID_REFRESH_TIMER)
 {
    mPlotTitle = plotName;
 
@@ -88,6 +266,8 @@ MdiTableViewFrame::~MdiTableViewFrame()
       ("~MdiTableViewFrame() mChildName=%s\n", mChildName.WX_TO_C_STRING);
    #endif
    
+   refreshTimer.Stop();
+   
    // make sure GUI Listener Manager knows that there is one less window
    GuiListenerManager::ClosingSolverListener();
 
@@ -118,44 +298,25 @@ void MdiTableViewFrame::Create()
 
    wxScrolledWindow *gridWindow = new wxScrolledWindow(this);
 
-   variableGrid = new wxGrid(gridWindow, wxID_ANY);
-   variableGrid->CreateGrid(0, 4);
-   variableGrid->EnableEditing(false);
-   variableGrid->EnableDragColMove(true);
-   // variable header
-   variableGrid->SetColLabelValue(0, "Control Variable");
-   variableGrid->SetColLabelValue(1, "Current Value");
-   variableGrid->SetColLabelValue(2, "Last Value");
-   variableGrid->SetColLabelValue(3, "Difference");
-   variableGrid->HideRowLabels();
+   // The grids are views of tables that keep the values as numbers
+   variableTable = new SolverGridTable("Control Variable", "Current Value",
+                                       "Last Value", "Difference");
+   constraintTable = new SolverGridTable("Constraints", "Desired",
+                                         "Achieved", "Difference");
+   objectiveTable = new SolverGridTable("Objective Function", "Current Value",
+                                        "Last Value", "Difference");
+   
+   variableGrid = CreateSolverGrid(gridWindow, variableTable);
    variableGrid->SetColSize(0, 200);
    variableGrid->SetColSize(1, variableGrid->GetColSize(0));
    variableGrid->SetColSize(2, variableGrid->GetColSize(0));
    variableGrid->SetColSize(3, variableGrid->GetColSize(0));
 
-   constraintGrid = new wxGrid(gridWindow, wxID_ANY);
-   constraintGrid->CreateGrid(0, 4);
-   constraintGrid->EnableEditing(false);
-   constraintGrid->EnableDragColMove();
+   constraintGrid = CreateSolverGrid(gridWindow, constraintTable);
    constraintGrid->SetColSizes(variableGrid->GetColSizes());
-   // constraint header
-   constraintGrid->SetColLabelValue(0, "Constraints");
-   constraintGrid->SetColLabelValue(1, "Desired");
-   constraintGrid->SetColLabelValue(2, "Achieved");
-   constraintGrid->SetColLabelValue(3, "Difference");
-   constraintGrid->HideRowLabels();
-
-   objectiveGrid = new wxGrid(gridWindow, wxID_ANY);
-   objectiveGrid->CreateGrid(0, 4);
-   objectiveGrid->EnableEditing(false);
-   objectiveGrid->EnableDragColMove();
+
+   objectiveGrid = CreateSolverGrid(gridWindow, objectiveTable);
    objectiveGrid->SetColSizes(variableGrid->GetColSizes());
-   // objective header
-   objectiveGrid->SetColLabelValue(0, "Objective Function");
-   objectiveGrid->SetColLabelValue(1, "Current Value");
-   objectiveGrid->SetColLabelValue(2, "Last Value");
-   objectiveGrid->SetColLabelValue(3, "Difference");
-   objectiveGrid->HideRowLabels();
    objectiveGrid->Hide();
 
    convergenceText = new wxBannerWindow(this, wxBOTTOM);
@@ -190,6 +351,82 @@ void MdiTableViewFrame::Create()
 }
 
 
+//------------------------------------------------------------------------------
+// wxGrid* CreateSolverGrid(wxWindow *parent, SolverGridTable *table)
+//------------------------------------------------------------------------------
+/**
+ * Creates a read only grid displaying table.  The grid owns the table.
+ */
+//------------------------------------------------------------------------------
+wxGrid* MdiTableViewFrame::CreateSolverGrid(wxWindow *parent,
+                                            SolverGridTable *table)
+{
+   wxGrid *grid = new wxGrid(parent, wxID_ANY);
+   grid->SetTable(table, true);
+   grid->EnableEditing(false);
+   grid->EnableDragColMove(true);
+   grid->HideRowLabels();
+   return grid;
+}
+
+
+//------------------------------------------------------------------------------
+// void AppendGridRow(wxGrid *grid)
+//------------------------------------------------------------------------------
+/**
+ * Tells grid that its table has one more row and relayouts the frame.
+ */
+//------------------------------------------------------------------------------
+void MdiTableViewFrame::AppendGridRow(wxGrid *grid)
+{
+   if (!IsShown() && (GmatGlobal::Instance()->GetGuiMode() != GmatGlobal::MINIMIZED_GUI))
+      Show();
+   
+   wxGridTableMessage msg(grid->GetTable(), wxGRIDTABLE_NOTIFY_ROWS_APPENDED, 1);
+   grid->ProcessTableMessage(msg);
+   
+   pageSizer->SetSizeHints(this);
+   pageSizer->Layout();
+}
+
+
+//------------------------------------------------------------------------------
+// void ScheduleRefresh()
+//------------------------------------------------------------------------------
+/**
+ * Asks for a repaint of the grids once the refresh interval has passed, so
+ * that a fast solver does not wait on the GUI every iteration.
+ */
+//------------------------------------------------------------------------------
+void MdiTableViewFrame::ScheduleRefresh()
+{
+   if (!refreshTimer.IsRunning())
+      refreshTimer.StartOnce(REFRESH_INTERVAL);
+}
+
+
+//------------------------------------------------------------------------------
+// void RefreshGrids()
+//------------------------------------------------------------------------------
+void MdiTableViewFrame::RefreshGrids()
+{
+   refreshTimer.Stop();
+   variableGrid->ForceRefresh();
+   constraintGrid->ForceRefresh();
+   if (objectiveGrid->IsShown())
+      objectiveGrid->ForceRefresh();
+}
+
+
+//------------------------------------------------------------------------------
+// void OnRefreshTimer(wxTimerEvent& event)
+//------------------------------------------------------------------------------
+void MdiTableViewFrame::OnRefreshTimer(wxTimerEvent& event)
+{
+   RefreshGrids();
+}
+
+
 //------------------------------------------------------------------------------
 // void OnChangeTitle(wxCommandEvent& WXUNUSED(event))
 //------------------------------------------------------------------------------
@@ -268,6 +505,7 @@ void MdiTableViewFrame::OnClose(wxCloseEvent &event)
       ("\nMdiTableViewFrame::OnClose() '%s' entered, mCanClose=%d\n", mChildName.WX_TO_C_STRING, mCanClose);
    #endif
    
+   refreshTimer.Stop();
    GmatMdiChildFrame::OnClose(event);
    event.Skip();
    
@@ -337,42 +575,26 @@ void MdiTableViewFrame::TakeAction(const std::string &action)
 void MdiTableViewFrame::ObjectiveChanged(std::string name, Real value)
 {
    SetConvergence(ITERATING);
-   int aRow = -1;
-   // find the row
-   for (int i=0;i<objectiveGrid->GetNumberRows();i++)
-   {
-      if (objectiveGrid->GetCellValue(i,0) == name)
-      {
-         aRow = i;
-         break;
-      }
-   }
+   bool added;
+   Integer aRow = objectiveTable->FindOrAddRow(name, added);
    // if row not found, add a row
-   if (aRow == -1)
+   if (added)
    {
-      if (!IsShown() && (GmatGlobal::Instance()->GetGuiMode() != GmatGlobal::MINIMIZED_GUI))
-         Show();
-      objectiveGrid->AppendRows();
-      if (objectiveGrid->GetNumberRows() == 1)
+      objectiveTable->SetNumber(aRow, 1, value);
+      if (objectiveTable->GetNumberRows() == 1)
          objectiveGrid->Show();
-      aRow = objectiveGrid->GetNumberRows() - 1;
-      objectiveGrid->SetCellValue(name, aRow, 0);
-      objectiveGrid->SetCellValue(GmatStringUtil::ToString(value), aRow, 1);
-      objectiveGrid->SetCellValue("", aRow, 2);
-      objectiveGrid->SetCellValue("", aRow, 3);
-      pageSizer->SetSizeHints(this);
-      pageSizer->Layout();
+      AppendGridRow(objectiveGrid);
    }
    else
    {
       // update row
-      Real oldValue;
-      GmatStringUtil::ToReal( objectiveGrid->GetCellValue(aRow, 1), &oldValue );
-      objectiveGrid->SetCellValue(GmatStringUtil::ToString(value), aRow, 1);
-      objectiveGrid->SetCellValue(GmatStringUtil::ToString(oldValue), aRow, 2);
-      objectiveGrid->SetCellValue(GmatStringUtil::ToString(value-oldValue), aRow, 3);
-      objectiveGrid->Update();
+      Real oldValue = 0.0;
+      objectiveTable->GetNumber(aRow, 1, oldValue);
+      objectiveTable->SetNumber(aRow, 1, value);
+      objectiveTable->SetNumber(aRow, 2, oldValue);
+      objectiveTable->SetNumber(aRow, 3, value-oldValue);
    }
+   ScheduleRefresh();
 }
 
 
@@ -382,42 +604,27 @@ void MdiTableViewFrame::ObjectiveChanged(std::string name, Real value)
 void MdiTableViewFrame::VariabledChanged(std::string name, Real value)
 {
    SetConvergence(ITERATING);
-   int aRow = -1;
-   // find the row
-   for (int i=0;i<variableGrid->GetNumberRows();i++)
-   {
-      if (variableGrid->GetCellValue(i,0) == name)
-      {
-         aRow = i; 
-         break;
-      }
-   }
+   bool added;
+   Integer aRow = variableTable->FindOrAddRow(name, added);
    // if row not found, add a row
-   if (aRow == -1)
+   if (added)
    {
-      if (!IsShown() && (GmatGlobal::Instance()->GetGuiMode() != GmatGlobal::MINIMIZED_GUI))
-         Show();
-      variableGrid->AppendRows();
+      variableTable->SetNumber(aRow, 1, value);
+      AppendGridRow(variableGrid);
       if (!variableGrid->IsEditable())
          variableGrid->Enable(true);
-      aRow = variableGrid->GetNumberRows() - 1;
-      variableGrid->SetCellValue(name, aRow, 0);
-      variableGrid->SetCellValue(GmatStringUtil::ToString(value), aRow, 1);
-      variableGrid->SetCellValue("", aRow, 2);
-      variableGrid->SetCellValue("", aRow, 3);
-      pageSizer->SetSizeHints(this);
-      pageSizer->Layout();
    }
    else
    {
       // update row
-      Real oldValue;
-      GmatStringUtil::ToReal( variableGrid->GetCellValue(aRow, 1), &oldValue );
-      variableGrid->SetCellValue(GmatStringUtil::ToString(value), aRow, 1);
-      variableGrid->SetCellValue(GmatStringUtil::ToString(oldValue), aRow, 2);
-      variableGrid->SetCellValue(GmatStringUtil::ToString(value-oldValue), aRow, 3);
-      variableGrid->Update();
+      Real oldValue = 0.0;
+      if (!variableTable->GetNumber(aRow, 1, oldValue))
+         GmatStringUtil::ToReal(variableTable->GetText(aRow, 1), &oldValue);
+      variableTable->SetNumber(aRow, 1, value);
+      variableTable->SetNumber(aRow, 2, oldValue);
+      variableTable->SetNumber(aRow, 3, value-oldValue);
    }
+   ScheduleRefresh();
 }
 
 
@@ -427,37 +634,21 @@ void MdiTableViewFrame::VariabledChanged(std::string name, Real value)
 void MdiTableViewFrame::VariabledChanged(std::string name, std::string &value)
 {
    SetConvergence(ITERATING);
-   int aRow = -1;
-   // find the row
-   for (int i=0;i<variableGrid->GetNumberRows();i++)
-   {
-      if (variableGrid->GetCellValue(i,0) == name)
-      {
-         aRow = i;
-         break;
-      }
-   }
+   bool added;
+   Integer aRow = variableTable->FindOrAddRow(name, added);
    // if row not found, add a row
-   if (aRow == -1)
+   if (added)
    {
-      if (!IsShown() && (GmatGlobal::Instance()->GetGuiMode() != GmatGlobal::MINIMIZED_GUI))
-         Show();
-      variableGrid->AppendRows();
-      aRow = variableGrid->GetNumberRows() - 1;
-      variableGrid->SetCellValue(name, aRow, 0);
-      variableGrid->SetCellValue(value, aRow, 1);
-      variableGrid->SetCellValue("", aRow, 2);
-      variableGrid->SetCellValue("", aRow, 3);
-      pageSizer->SetSizeHints(this);
-      pageSizer->Layout();
+      variableTable->SetText(aRow, 1, value);
+      AppendGridRow(variableGrid);
    }
    else
    {
       // update row
-      variableGrid->SetCellValue(variableGrid->GetCellValue(aRow, 1), aRow, 2);
-      variableGrid->SetCellValue(value, aRow, 1);
-      variableGrid->Update();
+      variableTable->SetText(aRow, 2, variableTable->GetText(aRow, 1));
+      variableTable->SetText(aRow, 1, value);
    }
+   ScheduleRefresh();
 }
 
 
@@ -468,7 +659,6 @@ void MdiTableViewFrame::ConstraintChanged(std::string name, Real desiredValue,
    Real value, Integer condition)
 {
    SetConvergence(ITERATING);
-   int aRow = -1;
    switch (condition)
    {
       case 0:
@@ -483,34 +673,19 @@ void MdiTableViewFrame::ConstraintChanged(std::string name, Real desiredValue,
       default:
          break;
    }
-   // find the row
-   for (int i=0;i<constraintGrid->GetNumberRows();i++)
-   {
-      if (constraintGrid->GetCellValue(i,0) == name)
-      {
-         aRow = i;
-         break;
-      }
-   }
-   // if row not found, add a row
-   if (aRow == -1)
-   {
-      if (!IsShown() && (GmatGlobal::Instance()->GetGuiMode() != GmatGlobal::MINIMIZED_GUI))
-         Show();
-      constraintGrid->AppendRows();
-      aRow = constraintGrid->GetNumberRows() - 1;
-      constraintGrid->SetCellValue(name, aRow, 0);
-      pageSizer->SetSizeHints(this);
-      pageSizer->Layout();
-   }
+   bool added;
+   Integer aRow = constraintTable->FindOrAddRow(name, added);
    // update row
-   constraintGrid->SetCellValue(GmatStringUtil::ToString(desiredValue), aRow, 1);
-   constraintGrid->SetCellValue(GmatStringUtil::ToString(value), aRow, 2);
+   constraintTable->SetNumber(aRow, 1, desiredValue);
+   constraintTable->SetNumber(aRow, 2, value);
    if (condition == 1)
-      constraintGrid->SetCellValue(GmatStringUtil::ToString(desiredValue-value), aRow, 3);
+      constraintTable->SetNumber(aRow, 3, desiredValue-value);
    else
-      constraintGrid->SetCellValue(GmatStringUtil::ToString(value-desiredValue), aRow, 3);
-   constraintGrid->Update();
+      constraintTable->SetNumber(aRow, 3, value-desiredValue);
+   // if row not found, add a row
+   if (added)
+      AppendGridRow(constraintGrid);
+   ScheduleRefresh();
 }
 
 
@@ -519,6 +694,9 @@ void MdiTableViewFrame::ConstraintChanged(std::string name, Real desiredValue,
 //------------------------------------------------------------------------------
 void MdiTableViewFrame::Convergence(bool value, std::string info)
 {
+   // Show the final values right away
+   RefreshGrids();
+   
    if (value)
    {
       SetConvergence(CONVERGENCE, info);
@@ -33,6 +33,9 @@
 #include "gmatdefs.hpp"
 #include <wx/grid.h>
 #include <wx/bannerwindow.h>
+#include <wx/timer.h>
+#include <map>
+#include <vector>
 
 // For compilers that support precompilation, includes "wx/wx.h".
 #include "wx/wxprec.h"
@@ -46,6 +49,50 @@
 #include "wx/mdi.h"
 #endif
 
+/**
+ * Grid table holding the solver window rows as numbers.  Cells are formatted
+ * only when the grid asks for them, i.e. for the rows that are visible.
+ */
+class SolverGridTable : public wxGridTableBase
+{
+public:
+   SolverGridTable(const wxString &label0, const wxString &label1,
+                   const wxString &label2, const wxString &label3);
+   
+   virtual int GetNumberRows();
+   virtual int GetNumberCols();
+   virtual bool IsEmptyCell(int row, int col);
+   virtual wxString GetValue(int row, int col);
+   virtual void SetValue(int row, int col, const wxString &value);
+   virtual wxString GetColLabelValue(int col);
+   
+   Integer FindOrAddRow(const std::string &name, bool &added);
+   void SetNumber(Integer row, Integer col, Real value);
+   void SetText(Integer row, Integer col, const std::string &value);
+   bool GetNumber(Integer row, Integer col, Real &value);
+   std::string GetText(Integer row, Integer col);
+   
+protected:
+   enum CellKind
+   {
+      EMPTY_CELL, NUMBER_CELL, TEXT_CELL
+   };
+   
+   struct Row
+   {
+      std::string name;
+      CellKind    kind[3];
+      Real        number[3];
+      std::string text[3];
+   };
+   
+   std::vector<Row> rows;
+   /// Row index by name, so an update does not scan the rows
+   std::map<std::string, Integer> rowIndex;
+   wxString colLabels[4];
+};
+
+
 class MdiTableViewFrame: public GmatMdiChildFrame, ISolverListener
 {
 public:
@@ -81,6 +128,7 @@ public:
    virtual void OnMove(wxMoveEvent& event);
    virtual void OnClose(wxCloseEvent &event);
    virtual void OnSize(wxSizeEvent& event);
+   virtual void OnRefreshTimer(wxTimerEvent& event);
    
    virtual void TakeAction(const std::string &action);
 
@@ -89,6 +137,11 @@ protected:
    wxGrid *variableGrid;
    wxGrid *constraintGrid;
    wxGrid *objectiveGrid;
+   SolverGridTable *variableTable;
+   SolverGridTable *constraintTable;
+   SolverGridTable *objectiveTable;
+   /// Repaints the grids at most once per interval while the solver runs
+   wxTimer refreshTimer;
    wxBoxSizer *gridSizer;
    wxBoxSizer *pageSizer;
    wxScrolledWindow *scrollWindow;
@@ -99,6 +152,18 @@ protected:
    
    void CheckFrame();
    virtual void Create();
+   wxGrid* CreateSolverGrid(wxWindow *parent, SolverGridTable *table);
+   void AppendGridRow(wxGrid *grid);
+   void ScheduleRefresh();
+   void RefreshGrids();
+   
+   enum
+   {
+      ID_REFRESH_TIMER = 9300
+   };
+   
+   /// Milliseconds between grid repaints
+   static const int REFRESH_INTERVAL;
    
    DECLARE_EVENT_TABLE()
 };
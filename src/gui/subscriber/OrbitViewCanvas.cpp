@@ -2320,8 +2320,8 @@ void OrbitViewCanvas::DrawOrbitLines(int i, const wxString &objName, int obj,
              *sIntColor, sGlColor);
          #endif
          
-         // PS - Rendering.cpp
-         DrawLine(sGlColor, r1, r2);
+         // Drawn with the other segments at the end of DrawOrbit()
+         AddOrbitSegment(sGlColor, r1, r2);
       }
       
       // save last valid frame to show object at final frame
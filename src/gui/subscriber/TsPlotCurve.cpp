@@ -26,6 +26,13 @@
 
 
 // #define TEST_POINT_22  // Tests curve change features starting at point 22
+//#define DEBUG_DECIMATION
+
+namespace
+{
+   /// Point count that triggers a coarser decimated level of detail
+   const int MAX_DECIMATED_POINTS = 8192;
+}
 
 //------------------------------------------------------------------------------
 // TsPlotCurve()
@@ -46,11 +53,15 @@ TsPlotCurve::TsPlotCurve() :
    lineWidth         (1),
    lineStyle         (wxSOLID),
    penIsDown         (true),
-   lastPointPlotted  (0)
+   lastPointPlotted  (0),
+   lodBucketSize     (1),
+   lodBucketStart    (0)
 {
 //   mInterp = new LinearInterpolator();
    ordinate.clear();
    abscissa.clear();
+   for (int i = 0; i < 4; ++i)
+      lodExtremes[i] = 0;
 }
 
 
@@ -128,6 +139,15 @@ void TsPlotCurve::AddData(double x, double y, double high, double low)
       {
          abscissa.push_back(x);
          ordinate.push_back(y);
+         AddToDecimation((int)abscissa.size() - 1);
+         // Coarsen the level of detail when it grows too large; each data
+         // point is revisited once per doubling of the bucket size
+         if (((int)lodIndex.size() > MAX_DECIMATED_POINTS) &&
+             (lodBucketSize < (int)abscissa.size()))
+         {
+            lodBucketSize *= 2;
+            RebuildDecimation();
+         }
          if (high > 0.0)
          {
             highError.push_back(high);
@@ -248,6 +268,10 @@ void TsPlotCurve::Clear()
    colorIndex.clear();
    markerIndex.clear();
 
+   lodIndex.clear();
+   lodBucketSize = 1;
+   lodBucketStart = 0;
+
    highlightIndex.clear();
 
 
@@ -437,6 +461,10 @@ void TsPlotCurve::SetColour(wxColour rgb, int where)
    {
       linecolor.push_back(rgb);
       colorIndex.push_back(where);
+      // Buckets start at color changes, so a change inside the data moves
+      // the bucket boundaries
+      if (where < (int)abscissa.size())
+         RebuildDecimation();
    }
    else
    {
@@ -616,6 +644,7 @@ void TsPlotCurve::BreakAndDiscard(int startBreakIndex, int endBreakIndex)
          start = abscissa.begin();
          advance(start, breakIndex[startBreakIndex]);
          abscissa.erase(start, abscissa.end());
+         RebuildDecimation();
       }
       else
       {
@@ -702,3 +731,130 @@ bool TsPlotCurve::UseHiLow(bool useHiLow)
    showHiLow = useHiLow;
    return showHiLow;
 }
+
+
+//------------------------------------------------------------------------------
+// bool IsDecimated()
+//------------------------------------------------------------------------------
+/**
+ * Reports if the decimated level of detail is coarser than the data
+ *
+ * @return true if each decimation bucket summarizes more than one point
+ */
+//------------------------------------------------------------------------------
+bool TsPlotCurve::IsDecimated()
+{
+   return lodBucketSize > 1;
+}
+
+
+//------------------------------------------------------------------------------
+// void GetDecimatedPoints(std::vector<int> &indices)
+//------------------------------------------------------------------------------
+/**
+ * Fills in the indices of the points in the decimated level of detail
+ *
+ * Each bucket of consecutive points contributes its first and last points and
+ * the points at its x and y extremes, in data order, so a line drawn through
+ * them covers the same extent as the full data.  Buckets end at pen ups and
+ * start at color changes, so those points are always included.
+ *
+ * @param indices The container receiving the point indices
+ */
+//------------------------------------------------------------------------------
+void TsPlotCurve::GetDecimatedPoints(std::vector<int> &indices)
+{
+   indices = lodIndex;
+
+   // Add the open bucket
+   int last = (int)abscissa.size() - 1;
+   if (last >= lodBucketStart)
+   {
+      int bucket[6] = { lodBucketStart, lodExtremes[0], lodExtremes[1],
+                        lodExtremes[2], lodExtremes[3], last };
+      std::sort(bucket, bucket + 6);
+      int *end = std::unique(bucket, bucket + 6);
+      indices.insert(indices.end(), bucket, end);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void AddToDecimation(int index)
+//------------------------------------------------------------------------------
+/**
+ * Adds a data point to the open decimation bucket, closing the bucket first
+ * when the point starts a new one
+ *
+ * @param index The index of the point in the data vectors
+ */
+//------------------------------------------------------------------------------
+void TsPlotCurve::AddToDecimation(int index)
+{
+   bool newBucket = (index == 0) || (index - lodBucketStart >= lodBucketSize) ||
+         (find(penUpIndex.begin(), penUpIndex.end(), index - 1) !=
+               penUpIndex.end()) ||
+         (find(colorIndex.begin(), colorIndex.end(), index) !=
+               colorIndex.end());
+
+   if (newBucket)
+   {
+      if (index > 0)
+         CloseDecimationBucket(index - 1);
+      lodBucketStart = index;
+      for (int i = 0; i < 4; ++i)
+         lodExtremes[i] = index;
+      return;
+   }
+
+   if (abscissa[index] < abscissa[lodExtremes[0]])
+      lodExtremes[0] = index;
+   if (abscissa[index] > abscissa[lodExtremes[1]])
+      lodExtremes[1] = index;
+   if (ordinate[index] < ordinate[lodExtremes[2]])
+      lodExtremes[2] = index;
+   if (ordinate[index] > ordinate[lodExtremes[3]])
+      lodExtremes[3] = index;
+}
+
+
+//------------------------------------------------------------------------------
+// void CloseDecimationBucket(int lastIndex)
+//------------------------------------------------------------------------------
+/**
+ * Moves the points kept from the open decimation bucket into the level of
+ * detail
+ *
+ * @param lastIndex The index of the last point in the bucket
+ */
+//------------------------------------------------------------------------------
+void TsPlotCurve::CloseDecimationBucket(int lastIndex)
+{
+   int bucket[6] = { lodBucketStart, lodExtremes[0], lodExtremes[1],
+                     lodExtremes[2], lodExtremes[3], lastIndex };
+   std::sort(bucket, bucket + 6);
+   int *end = std::unique(bucket, bucket + 6);
+   lodIndex.insert(lodIndex.end(), bucket, end);
+}
+
+
+//------------------------------------------------------------------------------
+// void RebuildDecimation()
+//------------------------------------------------------------------------------
+/**
+ * Rebuilds the decimated level of detail from the data at the current bucket
+ * size
+ */
+//------------------------------------------------------------------------------
+void TsPlotCurve::RebuildDecimation()
+{
+   #ifdef DEBUG_DECIMATION
+      MessageInterface::ShowMessage("Rebuilding decimation of %d points with "
+            "%d points per bucket\n", (int)abscissa.size(), lodBucketSize);
+   #endif
+
+   lodIndex.clear();
+   lodBucketStart = 0;
+   for (int i = 0; i < (int)abscissa.size(); ++i)
+      AddToDecimation(i);
+}
@@ -76,6 +76,9 @@ public:
 
    virtual void Rescale();
 
+   bool IsDecimated();
+   void GetDecimatedPoints(std::vector<int> &indices);
+
 protected:
    double minX;
    double maxX;
@@ -126,6 +129,19 @@ protected:
 
    /// Index of the last point that was plotted
    unsigned int         lastPointPlotted;
+
+   /// Indices of the points kept in the min/max decimated level of detail
+   std::vector<int>     lodIndex;
+   /// Number of data points summarized by each decimation bucket
+   int                  lodBucketSize;
+   /// Index of the first point in the open decimation bucket
+   int                  lodBucketStart;
+   /// Open bucket extremes: indices of the min x, max x, min y and max y
+   int                  lodExtremes[4];
+
+   void AddToDecimation(int index);
+   void CloseDecimationBucket(int lastIndex);
+   void RebuildDecimation();
    
    friend class TsPlotCanvas; 
    friend class TsPlotXYCanvas; 
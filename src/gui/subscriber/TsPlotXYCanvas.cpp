@@ -275,6 +275,7 @@ void TsPlotXYCanvas::PlotData(wxDC &dc)
       const std::vector<int> *ccs;
       const std::vector<int> *mcs;
       const std::vector<int> *highlights;
+      std::vector<int> lodPoints;
 
       for (std::vector<TsPlotCurve *>::iterator curve = data.begin(); 
            curve != data.end(); ++curve)
@@ -370,6 +371,70 @@ void TsPlotXYCanvas::PlotData(wxDC &dc)
             int  markerSize  = (*curve)->GetMarkerSize();
 
             bool showErrorBars = (*curve)->UseHiLow();
+
+            // Full redraws of long curves use the min/max decimated points,
+            // so the cost stays bounded as the run grows
+            if (((*curve)->lastPointPlotted == 0) && !zoomed && drawLines &&
+                !drawMarker && !showErrorBars && (*curve)->IsDecimated())
+            {
+               (*curve)->GetDecimatedPoints(lodPoints);
+               for (unsigned int k = 0; k + 1 < lodPoints.size(); ++k)
+               {
+                  j = lodPoints[k];
+                  if (j == ccLoc)
+                  {
+                     plotPens[n].SetColour((*curve)->GetColour(ccIndex));
+                     // Get the next color
+                     ++ccIndex;
+                     if (ccIndex < ccCount)
+                        ccLoc = (*ccs)[ccIndex];
+                     dc.SetPen(plotPens[n]);
+                  }
+
+                  if (j != pupLoc)
+                  {
+                     x0 = int(left +
+                           ((*curve)->abscissa[j]-currentXMin) * xScale + 0.5);
+                     y0 = int(top +
+                           (currentYMax-(*curve)->ordinate[j]) * yScale + 0.5);
+                     x1 = int(left + ((*curve)->abscissa[lodPoints[k+1]] -
+                           currentXMin) * xScale + 0.5);
+                     y1 = int(top + (currentYMax -
+                           (*curve)->ordinate[lodPoints[k+1]]) * yScale + 0.5);
+
+                     dc.DrawLine(x0, y0, x1, y1);
+                  }
+                  else
+                  {
+                     // Get the next penup
+                     ++pupIndex;
+                     if (pupIndex < locCount)
+                        pupLoc = (*pups)[pupIndex];
+                  }
+               }
+
+               j = lodPoints.back();
+               x1 = int(left + ((*curve)->abscissa[j]-currentXMin)*xScale + 0.5);
+               y1 = int(top + (currentYMax-(*curve)->ordinate[j])*yScale + 0.5);
+
+               // Highlighted points are placed from the full data; the last
+               // point is handled below
+               for (unsigned int k = 0; k < highlights->size(); ++k)
+               {
+                  int hp = highlights->at(k);
+                  if ((hp >= 0) && (hp < j))
+                     DrawMarker(dc, highlightMarker, markerSize,
+                           int(left + ((*curve)->abscissa[hp]-currentXMin) *
+                                 xScale + 0.5),
+                           int(top + (currentYMax-(*curve)->ordinate[hp]) *
+                                 yScale + 0.5),
+                           plotPens[n]);
+               }
+
+               // Resume the point by point drawing at the last point
+               (*curve)->lastPointPlotted = j;
+            }
+
             for (j = (*curve)->lastPointPlotted;
                  j < (int)((*curve)->abscissa.size())-1; ++j)
             {
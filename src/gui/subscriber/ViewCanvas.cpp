@@ -3139,6 +3139,10 @@ void ViewCanvas::DrawOrbit(const wxString &objName, int obj, int objId)
        "mRealEndIndex1=%d\n", objName.c_str(), mRealBeginIndex1, mRealEndIndex1);
    #endif
    
+   // The lines are collected and drawn in a single call
+   mOrbitVertices.clear();
+   mOrbitColors.clear();
+   
    // Draw first part from the ring buffer
    for (int i = mRealBeginIndex1 + 1; i <= mRealEndIndex1; i++)
    {
@@ -3160,12 +3164,72 @@ void ViewCanvas::DrawOrbit(const wxString &objName, int obj, int objId)
       }
    }
    
+   DrawOrbitSegments();
+   
    #if DEBUG_DRAW_DEBUG
    DrawDebugMessage(" Leaving DrawOrbit  --- ", GmatColor::RED32, 0, 240);
    #endif
 }
 
 
+//------------------------------------------------------------------------------
+// void AddOrbitSegment(GlColorType *color, const Rvector3 &start,
+//                      const Rvector3 &end)
+//------------------------------------------------------------------------------
+/**
+ * Adds a line of the given color to the orbit segments drawn by
+ * DrawOrbitSegments()
+ */
+//------------------------------------------------------------------------------
+void ViewCanvas::AddOrbitSegment(GlColorType *color, const Rvector3 &start,
+                                 const Rvector3 &end)
+{
+   for (int i = 0; i < 3; i++)
+      mOrbitVertices.push_back(start[i]);
+   for (int i = 0; i < 3; i++)
+      mOrbitVertices.push_back(end[i]);
+   
+   for (int i = 0; i < 2; i++)
+   {
+      mOrbitColors.push_back(color->red);
+      mOrbitColors.push_back(color->green);
+      mOrbitColors.push_back(color->blue);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void DrawOrbitSegments()
+//------------------------------------------------------------------------------
+/**
+ * Draws the collected orbit segments from vertex arrays in a single call,
+ * rather than a glBegin()/glEnd() pair for each line.  The arrays keep their
+ * capacity, so frames after the first do not allocate.
+ */
+//------------------------------------------------------------------------------
+void ViewCanvas::DrawOrbitSegments()
+{
+   if (mOrbitVertices.empty())
+      return;
+   
+   glEnableClientState(GL_VERTEX_ARRAY);
+   glEnableClientState(GL_COLOR_ARRAY);
+   glVertexPointer(3, GL_FLOAT, 0, &mOrbitVertices[0]);
+   glColorPointer(3, GL_UNSIGNED_BYTE, 0, &mOrbitColors[0]);
+   glDrawArrays(GL_LINES, 0, mOrbitVertices.size() / 3);
+   glDisableClientState(GL_COLOR_ARRAY);
+   glDisableClientState(GL_VERTEX_ARRAY);
+   
+   // Leave the current color at the last line color, as drawing the lines
+   // one at a time did
+   int last = mOrbitColors.size() - 3;
+   glColor3ub(mOrbitColors[last], mOrbitColors[last+1], mOrbitColors[last+2]);
+   
+   mOrbitVertices.clear();
+   mOrbitColors.clear();
+}
+
+
 //------------------------------------------------------------------------------
 //  void DrawSolverData()
 //------------------------------------------------------------------------------
@@ -39,6 +39,8 @@
 #include "ModelObject.hpp"
 #include <map>
 
+struct GlColorType;
+
 class ViewCanvas: public wxGLCanvas
 {
 public:
@@ -328,6 +330,10 @@ protected:
    // Space object velocities
    Real *mObjectViewVel;           // [mObjectCount][MAX_DATA][3]
    
+   // Orbit line segments collected by DrawOrbitLines() for DrawOrbitSegments()
+   std::vector<GLfloat> mOrbitVertices;  // [segments][2][3]
+   std::vector<GLubyte> mOrbitColors;    // [segments][2][3]
+   
    // Space object attitude
    Real *mObjectQuat;              // [mObjectCount][MAX_DATA][4]
    
@@ -396,6 +402,9 @@ protected:
    virtual void DrawObject(const wxString &objName, int obj) = 0;
    virtual void DrawOrbit(const wxString &objName, int obj, int objId);
    virtual void DrawOrbitLines(int i, const wxString &objName, int obj, int objId) = 0;
+   virtual void DrawOrbitSegments();
+   void AddOrbitSegment(GlColorType *color, const Rvector3 &start,
+                        const Rvector3 &end);
    
    virtual void DrawSolverData();
    
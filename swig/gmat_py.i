@@ -262,6 +262,27 @@ def __getitem__(self, index):
 
 %exceptionclass BaseException;
 
+// The propagation loop runs without the GIL so other Python threads keep
+// working.  GMAT does not lock its objects, so concurrent calls need
+// propagators that share no spacecraft, force models or ephemeris readers.
+%exception ::PropagateToEpochs {
+  PyThreadState *threadState = PyEval_SaveThread();
+  try {
+    $action
+  }
+  catch(BaseException &e) {
+    PyEval_RestoreThread(threadState);
+    GMAT_PyException("APIException", e.GetFullMessage().c_str());
+    SWIG_fail;
+  }
+  catch(...) {
+    PyEval_RestoreThread(threadState);
+    PyErr_SetString(PyExc_RuntimeError, "Unknown error in PropagateToEpochs");
+    SWIG_fail;
+  }
+  PyEval_RestoreThread(threadState);
+}
+
 %include "gmat.swg"
 
 %pythoncode %{